@@ -51,6 +51,15 @@ mark_as_advanced(SUNDIALS_NVECSERIAL_LIBRARY)
 find_library(SUNDIALS_SUNLINSOLKLU_LIBRARY NAME sundials_sunlinsolklu libsundials_sunlinsolklu HINTS ${SUNDIALS_LIBRARY_LOCATIONS})
 mark_as_advanced(SUNDIALS_SUNLINSOLKLU_LIBRARY)
 
+# Searching for sundials sunlinsolsuperlumt (optional multithreaded linear solver)
+find_library(SUNDIALS_SUNLINSOLSUPERLUMT_LIBRARY NAME sundials_sunlinsolsuperlumt libsundials_sunlinsolsuperlumt HINTS ${SUNDIALS_LIBRARY_LOCATIONS})
+mark_as_advanced(SUNDIALS_SUNLINSOLSUPERLUMT_LIBRARY)
+if(NOT SUPERLUMT_HOME AND NOT $ENV{SUPERLUMT_HOME} STREQUAL "")
+  set(SUPERLUMT_HOME $ENV{SUPERLUMT_HOME})
+endif()
+find_path(SUPERLUMT_INCLUDE_DIR NAME slu_mt_ddefs.h HINTS ${SUPERLUMT_HOME}/include ${SUPERLUMT_HOME}/SRC PATH_SUFFIXES superlu_mt)
+mark_as_advanced(SUPERLUMT_INCLUDE_DIR)
+
 if (SUNDIALS_INCLUDE_DIR AND SUNDIALS_IDA_LIBRARY)
   set(SundialsTest_DIR ${PROJECT_BINARY_DIR}/SundialsTest_DIR)
   file(MAKE_DIRECTORY ${SundialsTest_DIR})
@@ -176,4 +185,15 @@ if(Sundials_FOUND)
       $<TARGET_PROPERTY:Sundials::Sundials_SUNMATRIXSPARSE,IMPORTED_LOCATION>
       )
   endif()
+
+  if(NOT TARGET Sundials::Sundials_SUNLINSOLSUPERLUMT AND EXISTS "${SUNDIALS_SUNLINSOLSUPERLUMT_LIBRARY}" AND SUPERLUMT_INCLUDE_DIR)
+    add_library(Sundials::Sundials_SUNLINSOLSUPERLUMT UNKNOWN IMPORTED)
+    set_target_properties(Sundials::Sundials_SUNLINSOLSUPERLUMT PROPERTIES
+      INTERFACE_INCLUDE_DIRECTORIES "${Sundials_INCLUDE_DIRS};${SUPERLUMT_INCLUDE_DIR}"
+      IMPORTED_LINK_INTERFACE_LANGUAGES "C"
+      IMPORTED_LOCATION "${SUNDIALS_SUNLINSOLSUPERLUMT_LIBRARY}")
+    set_property(TARGET Sundials::Sundials_SUNLINSOLSUPERLUMT APPEND PROPERTY INTERFACE_LINK_LIBRARIES
+      $<TARGET_PROPERTY:Sundials::Sundials_SUNMATRIXSPARSE,IMPORTED_LOCATION>
+      )
+  endif()
 endif()
@@ -0,0 +1,194 @@
+//
+// Copyright (c) 2015-2019, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  CRVBinaryExporter.cpp
+ *
+ * @brief Dynawo curves collection binary columnar exporter : implementation file
+ *
+ */
+#include <fstream>
+#include <vector>
+
+#include <zlib.h>
+
+#include "DYNMacrosMessage.h"
+
+#include "CRVCurvesCollection.h"
+#include "CRVCurve.h"
+#include "CRVBinaryFormat.h"
+#include "CRVBinaryExporter.h"
+
+using std::fstream;
+using std::string;
+using std::ostream;
+
+namespace curves {
+
+/**
+ * @brief write raw bytes to the stream
+ *
+ * @param stream stream to write to
+ * @param data bytes to write
+ * @param size number of bytes to write
+ * @param position current position in the stream, updated
+ */
+static void
+writeBytes(ostream& stream, const void* data, const uint64_t size, uint64_t& position) {
+  stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+  position += size;
+}
+
+/**
+ * @brief write an unsigned integer to the stream
+ *
+ * @param stream stream to write to
+ * @param value integer to write
+ * @param position current position in the stream, updated
+ */
+static void
+writeUInt64(ostream& stream, const uint64_t value, uint64_t& position) {
+  writeBytes(stream, &value, sizeof(value), position);
+}
+
+/**
+ * @brief write a string, preceded by its length, to the stream
+ *
+ * @param stream stream to write to
+ * @param value string to write
+ * @param position current position in the stream, updated
+ */
+static void
+writeString(ostream& stream, const string& value, uint64_t& position) {
+  writeUInt64(stream, value.size(), position);
+  writeBytes(stream, value.data(), value.size(), position);
+}
+
+/**
+ * @brief write zeros up to the next aligned position
+ *
+ * @param stream stream to write to
+ * @param position current position in the stream, updated
+ */
+static void
+writePadding(ostream& stream, uint64_t& position) {
+  static const char zeros[binaryFormat::ALIGNMENT] = {};
+  const uint64_t remainder = position % binaryFormat::ALIGNMENT;
+  if (remainder != 0)
+    writeBytes(stream, zeros, binaryFormat::ALIGNMENT - remainder, position);
+}
+
+/**
+ * @brief compress a column: its bytes are grouped by significance before the zlib compression,
+ * which makes the slowly varying exponents and high order mantissa bytes of a curve compress well
+ *
+ * @param column values to compress
+ * @param compressed compressed bytes
+ */
+static void
+compressColumn(const std::vector<double>& column, std::vector<unsigned char>& compressed) {
+  const size_t nbValues = column.size();
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(column.data());
+  std::vector<unsigned char> shuffled(nbValues * sizeof(double));
+  for (size_t i = 0; i < nbValues; ++i)
+    for (size_t b = 0; b < sizeof(double); ++b)
+      shuffled[b * nbValues + i] = bytes[i * sizeof(double) + b];
+
+  uLongf compressedSize = compressBound(static_cast<uLong>(shuffled.size()));
+  compressed.resize(compressedSize);
+  if (compress2(compressed.data(), &compressedSize, shuffled.data(), static_cast<uLong>(shuffled.size()), Z_DEFAULT_COMPRESSION) != Z_OK)
+    throw DYNError(DYN::Error::API, CurvesBinaryCompressionFailed);
+  compressed.resize(compressedSize);
+}
+
+BinaryExporter::BinaryExporter(const bool compress) :
+compress_(compress) {
+}
+
+void
+BinaryExporter::exportToFile(const std::shared_ptr<CurvesCollection>& curves, const string& filePath) const {
+  // open export file
+  fstream file;
+  file.open(filePath.c_str(), fstream::out | fstream::binary);
+  if (!file.is_open()) {
+    throw DYNError(DYN::Error::API, FileGenerationFailed, filePath.c_str());
+  }
+  exportToStream(curves, file);
+  file.close();
+}
+
+void
+BinaryExporter::exportToStream(const std::shared_ptr<CurvesCollection>& curves, ostream& stream) const {
+  // filter curves to actually be exported
+  std::vector<std::shared_ptr<Curve> > curvesToExport;
+  for (const auto& curve : curves->getCurves())
+    if (curve->getAvailable() && curve->getExportType() != curves::Curve::EXPORT_AS_FINAL_STATE_VALUE)
+      curvesToExport.push_back(curve);
+
+  std::vector<double> times;
+  if (!curvesToExport.empty()) {
+    const std::shared_ptr<Curve>& reference = curvesToExport.front();
+    times.reserve(reference->getNbPoints());
+    for (size_t step = 0; step < reference->getNbPoints(); ++step)
+      times.push_back(reference->getTime(step));
+  }
+
+  std::vector<const std::vector<double>*> columns;
+  columns.push_back(&times);
+  for (const auto& curve : curvesToExport)
+    columns.push_back(&curve->getValues());
+
+  std::vector<std::vector<unsigned char> > compressedColumns;
+  if (compress_) {
+    compressedColumns.resize(columns.size());
+    for (size_t i = 0; i < columns.size(); ++i)
+      compressColumn(*columns[i], compressedColumns[i]);
+  }
+
+  // header
+  uint64_t position = 0;
+  writeBytes(stream, binaryFormat::MAGIC, binaryFormat::MAGIC_SIZE, position);
+  writeUInt64(stream, compress_ ? binaryFormat::ZLIB_SHUFFLE_COMPRESSION : binaryFormat::NO_COMPRESSION, position);
+  writeUInt64(stream, curvesToExport.size(), position);
+  for (const auto& curve : curvesToExport) {
+    writeString(stream, curve->getModelName(), position);
+    writeString(stream, curve->getVariable(), position);
+    const double factor = curve->getFactor();
+    writeBytes(stream, &factor, sizeof(factor), position);
+  }
+  writePadding(stream, position);
+
+  // directory
+  std::vector<uint64_t> storedSizes(columns.size());
+  for (size_t i = 0; i < columns.size(); ++i)
+    storedSizes[i] = compress_ ? compressedColumns[i].size() : columns[i]->size() * sizeof(double);
+  uint64_t columnPosition = position + columns.size() * 3 * sizeof(uint64_t);
+  for (size_t i = 0; i < columns.size(); ++i) {
+    writeUInt64(stream, columnPosition, position);
+    writeUInt64(stream, storedSizes[i], position);
+    writeUInt64(stream, columns[i]->size(), position);
+    columnPosition += storedSizes[i];
+    columnPosition += (binaryFormat::ALIGNMENT - columnPosition % binaryFormat::ALIGNMENT) % binaryFormat::ALIGNMENT;
+  }
+
+  // columns
+  for (size_t i = 0; i < columns.size(); ++i) {
+    if (compress_)
+      writeBytes(stream, compressedColumns[i].data(), storedSizes[i], position);
+    else
+      writeBytes(stream, columns[i]->data(), storedSizes[i], position);
+    writePadding(stream, position);
+  }
+}
+
+}  // namespace curves
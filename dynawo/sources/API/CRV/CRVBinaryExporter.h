@@ -0,0 +1,74 @@
+//
+// Copyright (c) 2015-2019, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  CRVBinaryExporter.h
+ *
+ * @brief Dynawo curves collection binary columnar exporter : header file
+ *
+ */
+#ifndef API_CRV_CRVBINARYEXPORTER_H_
+#define API_CRV_CRVBINARYEXPORTER_H_
+
+#include "CRVExporter.h"
+
+namespace curves {
+
+/**
+ * @class BinaryExporter
+ * @brief Binary columnar exporter class
+ *
+ * Binary export class for curves. The time and each curve are stored in separate columns
+ * so that a reader can load some curves only (see BinaryImporter). All integers are 64 bits
+ * unsigned and all numbers are stored in native byte order:
+ * - the 8 characters "DYNCRVC1";
+ * - the compression of the columns (0 for none, 1 for zlib after byte shuffling), the number of curves;
+ * - for each curve, its model name and its variable (both as length followed by characters) and its factor as a double;
+ * - a padding to a multiple of 8 bytes;
+ * - a directory with, for the time column then each curve column, the offset of the column in the file,
+ *   its stored size in bytes and its number of values;
+ * - the columns, each one starting at a multiple of 8 bytes so that uncompressed columns can be memory-mapped
+ *   as arrays of doubles. The values of a curve are aligned on the end of the time column.
+ */
+class BinaryExporter : public Exporter {
+ public:
+  /**
+   * @brief constructor
+   *
+   * @param compress @b true if the columns should be compressed
+   */
+  explicit BinaryExporter(bool compress = true);
+
+  /**
+   * @brief Export method in binary format
+   *
+   * @param curves curves to export
+   * @param filePath File to export binary formatted curves to
+   */
+  void exportToFile(const std::shared_ptr<CurvesCollection>& curves, const std::string& filePath) const override;
+
+  /**
+   * @brief Export method in binary format
+   *
+   * @param curves curves to export
+   * @param stream stream to export binary formatted curves to, opened in binary mode
+   */
+  void exportToStream(const std::shared_ptr<CurvesCollection>& curves, std::ostream& stream) const override;
+
+ private:
+  bool compress_;  ///< @b true if the columns are compressed
+};
+
+}  // namespace curves
+
+#endif  // API_CRV_CRVBINARYEXPORTER_H_
@@ -0,0 +1,37 @@
+//
+// Copyright (c) 2015-2019, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  CRVBinaryFormat.h
+ *
+ * @brief Constants of the binary columnar curves format, shared by its exporter and importer
+ *
+ */
+#ifndef API_CRV_CRVBINARYFORMAT_H_
+#define API_CRV_CRVBINARYFORMAT_H_
+
+#include <cstdint>
+
+namespace curves {
+namespace binaryFormat {
+
+static const char MAGIC[] = "DYNCRVC1";  ///< first characters of a binary columnar curves file
+static const uint64_t MAGIC_SIZE = sizeof(MAGIC) - 1;  ///< number of characters of the magic string
+static const uint64_t NO_COMPRESSION = 0;  ///< columns stored as raw doubles
+static const uint64_t ZLIB_SHUFFLE_COMPRESSION = 1;  ///< columns byte shuffled then compressed with zlib
+static const uint64_t ALIGNMENT = 8;  ///< alignment of the directory and of the columns in the file
+
+}  // namespace binaryFormat
+}  // namespace curves
+
+#endif  // API_CRV_CRVBINARYFORMAT_H_
@@ -0,0 +1,197 @@
+//
+// Copyright (c) 2015-2019, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  CRVBinaryImporter.cpp
+ *
+ * @brief Dynawo curves collection binary columnar importer : implementation file
+ *
+ */
+#include <cstring>
+#include <fstream>
+#include <unordered_set>
+
+#include <zlib.h>
+
+#include "DYNMacrosMessage.h"
+
+#include "CRVCurve.h"
+#include "CRVCurveFactory.h"
+#include "CRVCurvesCollection.h"
+#include "CRVCurvesCollectionFactory.h"
+#include "CRVBinaryFormat.h"
+#include "CRVBinaryImporter.h"
+
+using std::string;
+
+namespace curves {
+
+/**
+ * @brief read raw bytes from the stream
+ *
+ * @param stream stream to read from
+ * @param data buffer receiving the bytes
+ * @param size number of bytes to read
+ */
+static void
+readBytes(std::istream& stream, void* data, const uint64_t size) {
+  stream.read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+  if (!stream)
+    throw DYNError(DYN::Error::API, CurvesBinaryTruncated);
+}
+
+/**
+ * @brief read an unsigned integer from the stream
+ *
+ * @param stream stream to read from
+ * @return integer read
+ */
+static uint64_t
+readUInt64(std::istream& stream) {
+  uint64_t value = 0;
+  readBytes(stream, &value, sizeof(value));
+  return value;
+}
+
+/**
+ * @brief read a string, preceded by its length, from the stream
+ *
+ * @param stream stream to read from
+ * @return string read
+ */
+static string
+readString(std::istream& stream) {
+  string value(readUInt64(stream), '\0');
+  if (!value.empty())
+    readBytes(stream, &value[0], value.size());
+  return value;
+}
+
+/**
+ * @brief read a column from the stream
+ *
+ * @param stream stream to read from
+ * @param compression compression of the columns
+ * @param offset position of the column in the stream
+ * @param storedSize number of bytes of the column in the stream
+ * @param nbValues number of values of the column
+ * @param column values read
+ */
+static void
+readColumn(std::istream& stream, const uint64_t compression, const uint64_t offset, const uint64_t storedSize,
+    const uint64_t nbValues, std::vector<double>& column) {
+  column.resize(nbValues);
+  stream.seekg(static_cast<std::streamoff>(offset));
+  if (compression == binaryFormat::NO_COMPRESSION) {
+    if (storedSize != nbValues * sizeof(double))
+      throw DYNError(DYN::Error::API, CurvesBinaryInvalidFormat);
+    readBytes(stream, column.data(), storedSize);
+    return;
+  }
+
+  std::vector<unsigned char> compressed(storedSize);
+  readBytes(stream, compressed.data(), storedSize);
+  std::vector<unsigned char> shuffled(nbValues * sizeof(double));
+  uLongf size = static_cast<uLongf>(shuffled.size());
+  if (uncompress(shuffled.data(), &size, compressed.data(), static_cast<uLong>(storedSize)) != Z_OK || size != shuffled.size())
+    throw DYNError(DYN::Error::API, CurvesBinaryInvalidFormat);
+  unsigned char* bytes = reinterpret_cast<unsigned char*>(column.data());
+  for (size_t i = 0; i < nbValues; ++i)
+    for (size_t b = 0; b < sizeof(double); ++b)
+      bytes[i * sizeof(double) + b] = shuffled[b * nbValues + i];
+}
+
+std::shared_ptr<CurvesCollection>
+BinaryImporter::importFromFile(const string& fileName) const {
+  std::ifstream stream(fileName.c_str(), std::ios::in | std::ios::binary);
+  if (!stream)
+    throw DYNError(DYN::Error::API, FileSystemItemDoesNotExist, fileName);
+  return importFromStream(stream, nullptr);
+}
+
+std::shared_ptr<CurvesCollection>
+BinaryImporter::importFromStream(std::istream& stream) const {
+  return importFromStream(stream, nullptr);
+}
+
+std::shared_ptr<CurvesCollection>
+BinaryImporter::importFromFile(const string& fileName, const std::vector<string>& curvesNames) const {
+  std::ifstream stream(fileName.c_str(), std::ios::in | std::ios::binary);
+  if (!stream)
+    throw DYNError(DYN::Error::API, FileSystemItemDoesNotExist, fileName);
+  return importFromStream(stream, &curvesNames);
+}
+
+std::shared_ptr<CurvesCollection>
+BinaryImporter::importFromStream(std::istream& stream, const std::vector<string>* curvesNames) const {
+  char magic[binaryFormat::MAGIC_SIZE];
+  readBytes(stream, magic, binaryFormat::MAGIC_SIZE);
+  if (std::memcmp(magic, binaryFormat::MAGIC, binaryFormat::MAGIC_SIZE) != 0)
+    throw DYNError(DYN::Error::API, CurvesBinaryInvalidFormat);
+  const uint64_t compression = readUInt64(stream);
+  if (compression != binaryFormat::NO_COMPRESSION && compression != binaryFormat::ZLIB_SHUFFLE_COMPRESSION)
+    throw DYNError(DYN::Error::API, CurvesBinaryInvalidFormat);
+
+  const uint64_t nbCurves = readUInt64(stream);
+  std::vector<std::shared_ptr<Curve> > curves;
+  for (uint64_t i = 0; i < nbCurves; ++i) {
+    std::shared_ptr<Curve> curve = CurveFactory::newCurve();
+    curve->setModelName(readString(stream));
+    curve->setVariable(readString(stream));
+    double factor = 1.;
+    readBytes(stream, &factor, sizeof(factor));
+    curve->setFactor(factor);
+    curve->setAvailable(true);
+    curves.push_back(curve);
+  }
+  // skip the padding before the directory
+  uint64_t position = static_cast<uint64_t>(stream.tellg());
+  stream.seekg(static_cast<std::streamoff>((binaryFormat::ALIGNMENT - position % binaryFormat::ALIGNMENT) % binaryFormat::ALIGNMENT),
+      std::ios::cur);
+
+  // directory entries: offset, stored size and number of values for the time column then each curve
+  std::vector<uint64_t> directory(3 * (nbCurves + 1));
+  for (uint64_t& entry : directory)
+    entry = readUInt64(stream);
+
+  std::unordered_set<string> selectedNames;
+  if (curvesNames) {
+    selectedNames.insert(curvesNames->begin(), curvesNames->end());
+    for (const auto& curve : curves)
+      selectedNames.erase(curve->getUniqueName());
+    if (!selectedNames.empty())
+      throw DYNError(DYN::Error::API, CurvesBinaryUnknownCurve, *selectedNames.begin());
+    selectedNames.insert(curvesNames->begin(), curvesNames->end());
+  }
+
+  std::shared_ptr<std::vector<double> > times = std::make_shared<std::vector<double> >();
+  readColumn(stream, compression, directory[0], directory[1], directory[2], *times);
+
+  std::shared_ptr<CurvesCollection> collection = CurvesCollectionFactory::newInstance("");
+  for (uint64_t i = 0; i < nbCurves; ++i) {
+    const std::shared_ptr<Curve>& curve = curves[i];
+    if (curvesNames && selectedNames.find(curve->getUniqueName()) == selectedNames.end())
+      continue;
+    const uint64_t* entry = &directory[3 * (i + 1)];
+    if (entry[2] > times->size())
+      throw DYNError(DYN::Error::API, CurvesBinaryInvalidFormat);
+    std::vector<double> values;
+    readColumn(stream, compression, entry[0], entry[1], entry[2], values);
+    curve->shareTimes(times);
+    curve->setValues(std::move(values));
+    collection->add(curve);
+  }
+  return collection;
+}
+
+}  // namespace curves
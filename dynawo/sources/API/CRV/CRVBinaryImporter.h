@@ -0,0 +1,71 @@
+//
+// Copyright (c) 2015-2019, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  CRVBinaryImporter.h
+ *
+ * @brief Dynawo curves collection binary columnar importer : header file
+ *
+ */
+#ifndef API_CRV_CRVBINARYIMPORTER_H_
+#define API_CRV_CRVBINARYIMPORTER_H_
+
+#include <string>
+#include <vector>
+
+#include "CRVImporter.h"
+
+namespace curves {
+
+/**
+ * @class BinaryImporter
+ * @brief Binary columnar importer class
+ *
+ * Reads the curves written by BinaryExporter, with their points. The imported curves share a single time column.
+ */
+class BinaryImporter : public Importer {
+ public:
+  /**
+   * @copydoc Importer::importFromFile()
+   */
+  std::shared_ptr<CurvesCollection> importFromFile(const std::string& fileName) const override;
+
+  /**
+   * @copydoc Importer::importFromStream()
+   */
+  std::shared_ptr<CurvesCollection> importFromStream(std::istream& stream) const override;
+
+  /**
+   * @brief Import some curves from file, without reading the columns of the other curves
+   *
+   * @param fileName file name
+   * @param curvesNames unique names of the curves to import
+   *
+   * @return Curves collection imported, with the curves in the order of the file
+   */
+  std::shared_ptr<CurvesCollection> importFromFile(const std::string& fileName, const std::vector<std::string>& curvesNames) const;
+
+  /**
+   * @brief Import some curves from a seekable stream, without reading the columns of the other curves
+   *
+   * @param stream stream from where the curves must be imported, opened in binary mode
+   * @param curvesNames unique names of the curves to import, all curves being imported if the pointer is null
+   *
+   * @return Curves collection imported, with the curves in the order of the stream
+   */
+  std::shared_ptr<CurvesCollection> importFromStream(std::istream& stream, const std::vector<std::string>* curvesNames) const;
+};
+
+}  // namespace curves
+
+#endif  // API_CRV_CRVBINARYIMPORTER_H_
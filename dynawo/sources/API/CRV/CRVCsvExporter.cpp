@@ -26,7 +26,6 @@
 
 #include "CRVCurvesCollection.h"
 #include "CRVCurve.h"
-#include "CRVPoint.h"
 #include "CRVCsvExporter.h"
 
 using std::fstream;
@@ -69,12 +68,12 @@ CsvExporter::exportToStream(const std::shared_ptr<CurvesCollection>& curves, ost
 
   // for each time point, print value for all the curves if at least one value (including time) has changed
   std::string prevLine;
-  for (unsigned int step = 0; step < curvesToExport.front()->getPoints().size(); ++step) {
-    std::string newLine = DYN::double2String(curvesToExport.front()->getPoints()[step]->getTime());
+  for (size_t step = 0; step < curvesToExport.front()->getNbPoints(); ++step) {
+    std::string newLine = DYN::double2String(curvesToExport.front()->getTime(step));
     newLine += CSV_SEPARATOR;
 
     for (std::shared_ptr<Curve> curve : curvesToExport) {
-        newLine += DYN::double2String(curve->getPoints()[step]->getValue());
+        newLine += DYN::double2String(curve->getValue(step));
         newLine += CSV_SEPARATOR;
     }
     newLine += '\n';
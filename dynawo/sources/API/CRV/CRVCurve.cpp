@@ -19,10 +19,10 @@
  */
 #include "CRVCurve.h"
 
-#include "CRVPoint.h"
-#include "CRVPointFactory.h"
 #include "DYNCommon.h"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <sstream>
 #include <limits>
@@ -39,55 +39,123 @@ Curve::Curve::Curve() :
       available_(false),
       negated_(false),
       buffer_(NULL),
+      times_(std::make_shared<std::vector<double> >()),
+      ownsTimes_(true),
       isParameterCurve_(false),
       curveType_(UNDEFINED),
       indexInGlobalTable_(std::numeric_limits<size_t>::max()),
       indexCalculatedVarInSubModel_(std::numeric_limits<unsigned>::max()),
-      exportType_(EXPORT_AS_CURVE) {}
+      exportType_(EXPORT_AS_CURVE),
+      deadband_(-1.),
+      maxError_(-1.),
+      hasKeptPoint_(false),
+      keptTime_(0.),
+      keptValue_(0.),
+      slopeLow_(-std::numeric_limits<double>::infinity()),
+      slopeHigh_(std::numeric_limits<double>::infinity()),
+      pendingSlopeLow_(-std::numeric_limits<double>::infinity()),
+      pendingSlopeHigh_(std::numeric_limits<double>::infinity()) {}
 
 void
-Curve::update(const double time) {
+Curve::update(const double time, const bool replaceLast) {
   if (available_) {
-    if (!isParameterCurve_) {  // this is a variable curve
-      double value = buffer_[0] * factor_;
-      if (negated_)
-        value = -1 * value;
-
-      std::unique_ptr<Point> point = PointFactory::newPoint(time, value);
-      if (exportType_ == EXPORT_AS_CURVE || exportType_ == EXPORT_AS_BOTH || points_.empty()) {
-        points_.push_back(std::move(point));
-      } else {
-        points_.back() = std::move(point);
-      }
-    } else {  // this is a parameter curve
-              // we set the value of parameter curve to zero during the simulation
-              // and update the value at the end of simulation.
-      double value(0);
-      std::unique_ptr<Point> point = PointFactory::newPoint(time, value);
-      if (exportType_ == EXPORT_AS_CURVE || exportType_ == EXPORT_AS_BOTH || points_.empty()) {
-        points_.push_back(std::move(point));
-      } else {
-        points_.back() = std::move(point);
-      }
-    }
+    // the value of a parameter curve is set to zero during the simulation and updated at the end of simulation,
+    // unless it has already been set, in which case it is carried over
+    double value = values_.empty() ? 0. : values_.back();
+    if (!isParameterCurve_)  // this is a variable curve
+      value = getCurrentValue();
+    addPoint(time, value, replaceLast);
   }
 }
 
+double
+Curve::getCurrentValue() const {
+  const double value = buffer_[0] * factor_;
+  return negated_ ? -1 * value : value;
+}
+
+bool
+Curve::needsLastPoint(const double time) {
+  if (!available_ || isParameterCurve_ || exportType_ == EXPORT_AS_FINAL_STATE_VALUE || values_.empty())
+    return false;
+  if (!hasRecordingFilter() || !hasKeptPoint_)
+    return true;
+
+  pendingSlopeLow_ = slopeLow_;
+  pendingSlopeHigh_ = slopeHigh_;
+  const double lastTime = getLastTime();
+  const double lastValue = values_.back();
+  if (DYN::doubleEquals(lastTime, keptTime_) || DYN::doubleEquals(lastTime, time))
+    return true;  // discontinuity
+
+  bool needed = false;
+  if (deadband_ >= 0. && std::abs(lastValue - keptValue_) > deadband_)
+    needed = true;
+  if (maxError_ >= 0.) {
+    // the door from the last kept point must stay open on the last point to drop it
+    const double lastDeltaTime = lastTime - keptTime_;
+    pendingSlopeLow_ = std::max(slopeLow_, (lastValue - maxError_ - keptValue_) / lastDeltaTime);
+    pendingSlopeHigh_ = std::min(slopeHigh_, (lastValue + maxError_ - keptValue_) / lastDeltaTime);
+    const double slope = (getCurrentValue() - keptValue_) / (time - keptTime_);
+    if (slope < pendingSlopeLow_ || slope > pendingSlopeHigh_)
+      needed = true;
+  }
+  return needed;
+}
+
 void
-Curve::updateParameterCurveValue(std::string /*parameterName*/, double parameterValue) {
-  for (const auto& point : points_) {
-    point->setValue(parameterValue * factor_);
+Curve::applyRecordingDecision(const bool lastPointKept) {
+  if (!hasRecordingFilter() || values_.empty())
+    return;
+  if (lastPointKept || !hasKeptPoint_) {
+    hasKeptPoint_ = true;
+    keptTime_ = getLastTime();
+    keptValue_ = values_.back();
+    slopeLow_ = -std::numeric_limits<double>::infinity();
+    slopeHigh_ = std::numeric_limits<double>::infinity();
+  } else {
+    slopeLow_ = pendingSlopeLow_;
+    slopeHigh_ = pendingSlopeHigh_;
   }
 }
 
+void
+Curve::shareTimes(const std::shared_ptr<std::vector<double> >& times) {
+  times_ = times;
+  ownsTimes_ = false;
+}
+
+void
+Curve::keepLastPoints(const size_t nbKept) {
+  if (values_.size() <= nbKept)
+    return;
+  const size_t nbDropped = values_.size() - nbKept;
+  values_.erase(values_.begin(), values_.begin() + nbDropped);
+  if (ownsTimes_)
+    times_->erase(times_->begin(), times_->begin() + nbDropped);
+}
+
+size_t
+Curve::getMemoryUsage() const {
+  size_t memoryUsage = values_.capacity() * sizeof(double);
+  if (ownsTimes_ && times_)
+    memoryUsage += times_->capacity() * sizeof(double);
+  return memoryUsage;
+}
+
+void
+Curve::updateParameterCurveValue(std::string /*parameterName*/, double parameterValue) {
+  values_.assign(values_.size(), parameterValue * factor_);
+}
+
 double
 Curve::getLastTime() const {
-  return (points_.empty()) ? -1 : points_.back()->getTime();
+  return (values_.empty()) ? -1 : times_->back();
 }
 
 double
 Curve::getLastValue() const {
-  return (points_.empty()) ? 0 : points_.back()->getValue();
+  return (values_.empty()) ? 0 : values_.back();
 }
 
 void
@@ -20,12 +20,11 @@
 #ifndef API_CRV_CRVCURVE_H_
 #define API_CRV_CRVCURVE_H_
 
-#include "CRVPoint.h"
-
 #include <limits>
 #include <string>
 #include <vector>
 #include <memory>
+#include <utility>
 
 namespace curves {
 /**
@@ -53,9 +52,107 @@ class Curve {
 
   /**
    * @brief Add a new point to the curve
+   *
+   * If the curve shares the time column of a collection, the time is added to the column by the collection.
+   *
+   * @param time time associated to the new point created
+   * @param replaceLast @b true if the new point replaces the last one, dropped by the recording filters
+   */
+  void update(double time, bool replaceLast = false);
+
+  /**
+   * @brief Add a new point to the curve, its value being computed by the caller
+   *
    * @param time time associated to the new point created
+   * @param value value of the new point, factor and sign included
+   * @param replaceLast @b true if the new point replaces the last one, dropped by the recording filters
+   */
+  void addPoint(const double time, const double value, const bool replaceLast) {
+    if (values_.empty() || (!replaceLast && exportType_ != EXPORT_AS_FINAL_STATE_VALUE)) {
+      if (ownsTimes_)
+        times_->push_back(time);
+      values_.push_back(value);
+    } else {
+      if (ownsTimes_)
+        times_->back() = time;
+      values_.back() = value;
+    }
+  }
+
+  /**
+   * @brief set the deadband recording filter
+   *
+   * A point is then only needed if its value differs from the last kept one by more than the deadband.
+   *
+   * @param deadband deadband, negative to disable the filter
+   */
+  void setDeadband(double deadband) {
+    deadband_ = deadband;
+  }
+
+  /**
+   * @brief get the deadband recording filter
+   * @return deadband, negative if disabled
+   */
+  double getDeadband() const {
+    return deadband_;
+  }
+
+  /**
+   * @brief set the swinging door recording filter
+   *
+   * A point is then only needed if the straight line between the last kept point and the new one
+   * would be farther than the maximum error from one of the points in between.
+   *
+   * @param maxError maximum error, negative to disable the filter
+   */
+  void setMaxError(double maxError) {
+    maxError_ = maxError;
+  }
+
+  /**
+   * @brief get the swinging door recording filter
+   * @return maximum error, negative if disabled
+   */
+  double getMaxError() const {
+    return maxError_;
+  }
+
+  /**
+   * @brief whether a recording filter is set on this curve
+   * @return @b true if a deadband or a maximum error is set
+   */
+  bool hasRecordingFilter() const {
+    return deadband_ >= 0. || maxError_ >= 0.;
+  }
+
+  /**
+   * @brief whether the last point of the curve must be kept when a new point is recorded
+   *
+   * The curves that are not recorded at each update (unavailable, parameter or final state value only) never need it,
+   * the recorded curves without filter always need it. Points at a discontinuity (same time as the previous or the new point)
+   * are always needed.
+   *
+   * @param time time of the new point
+   * @return @b true if the last point must be kept
+   */
+  bool needsLastPoint(double time);
+
+  /**
+   * @brief update the state of the recording filters once the fate of the last point is decided for the whole collection
+   *
+   * @param lastPointKept @b true if the last point is kept, @b false if it is replaced by the new point
+   */
+  void applyRecordingDecision(bool lastPointKept);
+
+  /**
+   * @brief use a time column shared with other curves instead of an own one
+   *
+   * Must be called before the first point is added.
+   *
+   * @param times shared time column, filled by its owner before each update of the curve
    */
-  void update(double time);
+  void shareTimes(const std::shared_ptr<std::vector<double> >& times);
 
   /**
    * @brief get last point value
@@ -239,14 +336,90 @@ class Curve {
   void updateParameterCurveValue(std::string parameterName, double parameterValue);
 
   /**
-  * @brief get points
-  *
-  * @return points
-  */
-  const std::vector<std::unique_ptr<Point> >& getPoints() const {
-    return points_;
+   * @brief get the number of points of the curve
+   *
+   * @return number of points
+   */
+  size_t getNbPoints() const {
+    return values_.size();
   }
 
+  /**
+   * @brief get the time of a point
+   *
+   * The values are aligned on the end of the time column: a curve keeping only its last point uses the last time.
+   *
+   * @param index index of the point
+   * @return time of the point
+   */
+  double getTime(size_t index) const {
+    return (*times_)[times_->size() - values_.size() + index];
+  }
+
+  /**
+   * @brief get the value of a point
+   *
+   * @param index index of the point
+   * @return value of the point
+   */
+  double getValue(size_t index) const {
+    return values_[index];
+  }
+
+  /**
+   * @brief get the times of the points, aligned with the values column
+   *
+   * @return time of the first point, the getNbPoints() times being contiguous from there, null if there is no point
+   */
+  const double* getTimesData() const {
+    return values_.empty() ? nullptr : times_->data() + times_->size() - values_.size();
+  }
+
+  /**
+   * @brief get the values of the points
+   *
+   * @return values column
+   */
+  const std::vector<double>& getValues() const {
+    return values_;
+  }
+
+  /**
+   * @brief replace the values of the curve, for instance when it is read from a file
+   *
+   * The values are aligned on the end of the time column of the curve.
+   *
+   * @param values new values of the curve
+   */
+  void setValues(std::vector<double>&& values) {
+    values_ = std::move(values);
+  }
+
+  /**
+   * @brief drop the oldest points of the curve
+   *
+   * A shared time column is left untouched: its owner trims it after the curves.
+   *
+   * @param nbKept number of most recent points to keep
+   */
+  void keepLastPoints(size_t nbKept);
+
+  /**
+   * @brief get the memory allocated for the points of the curve
+   *
+   * A shared time column is accounted by its owner.
+   *
+   * @return number of bytes allocated for the values and the owned time column
+   */
+  size_t getMemoryUsage() const;
+
+ private:
+  /**
+   * @brief get the value of the variable of the curve in its buffer, with the factor and the sign of the curve
+   * @return current value of the curve
+   */
+  double getCurrentValue() const;
+
  private:
   // attributes read in input file
   std::string modelName_;  ///< Model's name for which we want have a curve
@@ -258,13 +431,26 @@ class Curve {
   bool available_;                                 ///< @b true if the variable is available, @b false else
   bool negated_;                                   ///< @b true if the variable must be negated at the export, @b false else
   const double* buffer_;                           ///< address buffer where to find value
-  std::vector<std::unique_ptr<Point> > points_;    ///< vector of each values
+  std::shared_ptr<std::vector<double> > times_;    ///< time column, possibly shared with the other curves of a collection
+  bool ownsTimes_;                                 ///< @b true if the time column is filled by the curve itself
+  std::vector<double> values_;                     ///< value column
   bool isParameterCurve_;                          ///< @b true if a parameter curve, @b false if variable
   CurveType_t curveType_;                          ///< @b true if a calculated variable curve, @b false if variable
   size_t indexInGlobalTable_;                      ///< curve's index in global table
   unsigned indexCalculatedVarInSubModel_;          ///< index of calculated variable in SubModel
 
   ExportType_t exportType_;                        ///< Whether this should be exported as a final state value or as a curve
+
+  // recording filters
+  double deadband_;                                ///< deadband of the recorded values, negative if disabled
+  double maxError_;                                ///< maximum error of the swinging door compression, negative if disabled
+  bool hasKeptPoint_;                              ///< @b true if a point has already been kept by the recording filters
+  double keptTime_;                                ///< time of the last kept point
+  double keptValue_;                               ///< value of the last kept point
+  double slopeLow_;                                ///< lowest slope from the last kept point respecting the maximum error for the dropped points
+  double slopeHigh_;                               ///< highest slope from the last kept point respecting the maximum error for the dropped points
+  double pendingSlopeLow_;                         ///< lowest slope if the last point is dropped
+  double pendingSlopeHigh_;                        ///< highest slope if the last point is dropped
 };
 
 }  // namespace curves
@@ -17,6 +17,9 @@
  * @brief Curves collection : implementation file
  *
  */
+#include <algorithm>
+#include <functional>
+
 #include "CRVCurvesCollection.h"
 #include "CRVCurve.h"
 
@@ -25,18 +28,140 @@ using std::string;
 namespace curves {
 
 CurvesCollection::CurvesCollection(const string& id) :
-id_(id) {
+id_(id),
+times_(std::make_shared<std::vector<double> >()),
+minInterval_(0.),
+hasKeptTime_(false),
+keptTime_(0.),
+updatePlanCompiled_(false),
+finalStateValuesAtEnd_(false) {
 }
 
 void
 CurvesCollection::add(const std::shared_ptr<Curve>& curve) {
   curves_.push_back(curve);
+  updatePlanCompiled_ = false;
+}
+
+void
+CurvesCollection::compileUpdatePlan() {
+  std::vector<size_t> planIndexes;
+  otherCurves_.clear();
+  finalStateValueCurves_.clear();
+  for (size_t i = 0; i < curves_.size(); ++i) {
+    const Curve& curve = *curves_[i];
+    if (isUpdatedAtEnd(curve))
+      finalStateValueCurves_.push_back(curves_[i].get());
+    else if (curve.getAvailable() && !curve.isParameterCurve() && curve.getBuffer() != nullptr)
+      planIndexes.push_back(i);
+    else
+      otherCurves_.push_back(curves_[i].get());
+  }
+  std::stable_sort(planIndexes.begin(), planIndexes.end(), [this](const size_t lhs, const size_t rhs) {
+    return std::less<const double*>()(curves_[lhs]->getBuffer(), curves_[rhs]->getBuffer());
+  });
+
+  planSources_.clear();
+  planScales_.clear();
+  planCurves_.clear();
+  for (const size_t index : planIndexes) {
+    Curve* curve = curves_[index].get();
+    planSources_.push_back(curve->getBuffer());
+    // -(value * factor) and value * (-factor) are the same number
+    planScales_.push_back(curve->getNegated() ? -curve->getFactor() : curve->getFactor());
+    planCurves_.push_back(curve);
+  }
+  planValues_.resize(planCurves_.size());
+  updatePlanCompiled_ = true;
 }
 
 void
 CurvesCollection::updateCurves(const double time) {
-  for (const auto& curve : curves_)
+  if (times_->empty()) {
+    // curves updated only through the collection share its time column
+    for (const auto& curve : curves_)
+      if (curve->getNbPoints() == 0 && !isUpdatedAtEnd(*curve))
+        curve->shareTimes(times_);
+  }
+
+  bool replaceLast = false;
+  if (!times_->empty()) {
+    bool filtered = minInterval_ > 0.;
+    for (const auto& curve : curves_)
+      filtered |= curve->hasRecordingFilter();
+    if (filtered) {
+      bool needed = false;
+      for (const auto& curve : curves_)
+        needed |= curve->needsLastPoint(time);  // every curve is asked as it prepares its filter state
+      if (minInterval_ > 0. && hasKeptTime_ && times_->back() - keptTime_ < minInterval_)
+        needed = false;
+      for (const auto& curve : curves_)
+        curve->applyRecordingDecision(needed);
+      if (needed) {
+        hasKeptTime_ = true;
+        keptTime_ = times_->back();
+      }
+      replaceLast = !needed;
+    }
+  }
+
+  if (replaceLast)
+    times_->back() = time;
+  else
+    times_->push_back(time);
+
+  if (!updatePlanCompiled_)
+    compileUpdatePlan();
+  const size_t nbPlanCurves = planCurves_.size();
+  const double* const* sources = planSources_.data();
+  const double* scales = planScales_.data();
+  double* values = planValues_.data();
+  for (size_t i = 0; i < nbPlanCurves; ++i)
+    values[i] = *sources[i] * scales[i];
+  for (size_t i = 0; i < nbPlanCurves; ++i)
+    planCurves_[i]->addPoint(time, values[i], replaceLast);
+  for (Curve* curve : otherCurves_)
+    curve->update(time, replaceLast);
+}
+
+void
+CurvesCollection::updateFinalStateValues(const double time) {
+  if (!updatePlanCompiled_)
+    compileUpdatePlan();
+  for (Curve* curve : finalStateValueCurves_)
     curve->update(time);
 }
 
+bool
+CurvesCollection::isUpdatedAtEnd(const Curve& curve) const {
+  return finalStateValuesAtEnd_ && curve.getExportType() == Curve::EXPORT_AS_FINAL_STATE_VALUE;
+}
+
+void
+CurvesCollection::keepLastPoints(const size_t nbKept) {
+  for (const auto& curve : curves_)
+    curve->keepLastPoints(nbKept);
+  if (times_->size() > nbKept)
+    times_->erase(times_->begin(), times_->end() - nbKept);
+}
+
+void
+CurvesCollection::appendPoints(const std::vector<double>& times, const std::vector<std::vector<double> >& values) {
+  times_->insert(times_->end(), times.begin(), times.end());
+  for (size_t i = 0, iEnd = std::min(curves_.size(), values.size()); i < iEnd; ++i) {
+    const std::vector<double>& curveValues = values[i];
+    const size_t firstTime = times.size() - std::min(times.size(), curveValues.size());
+    for (size_t j = 0, jEnd = times.size() - firstTime; j < jEnd; ++j)
+      curves_[i]->addPoint(times[firstTime + j], curveValues[curveValues.size() - jEnd + j], false);
+  }
+}
+
+size_t
+CurvesCollection::getMemoryUsage() const {
+  size_t memoryUsage = curves_.capacity() * sizeof(std::shared_ptr<Curve>) + times_->capacity() * sizeof(double);
+  for (const auto& curve : curves_)
+    memoryUsage += curve->getMemoryUsage();
+  return memoryUsage;
+}
+
 }  // namespace curves
@@ -23,7 +23,9 @@
 
 #include "CRVCurve.h"
 
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace curves {
 
@@ -52,10 +54,101 @@ class CurvesCollection {
   /**
    * @brief add a new point for each curve
    *
+   * The curves without any point at the first update share the time column of the collection.
+   *
+   * If recording filters are set, the previous point is replaced by the new one unless one of the curves
+   * needs it (see Curve::needsLastPoint), so that all the curves keep the same points. The last point of
+   * the curves is thus always the latest one.
+   *
+   * The values of the variable curves are gathered by following the update plan, compiled again first if a curve was
+   * added since the last compilation.
+   *
    * @param time time of the new point
    */
   void updateCurves(double time);
 
+  /**
+   * @brief set the value of the curves exported only as final state values at the end of the simulation
+   *
+   * These curves are then left out of the update plan and of the time column of the collection, and only get a point
+   * through updateFinalStateValues.
+   *
+   * @param finalStateValuesAtEnd @b true to update these curves only at the end of the simulation
+   */
+  void setFinalStateValuesAtEnd(bool finalStateValuesAtEnd) {
+    finalStateValuesAtEnd_ = finalStateValuesAtEnd;
+    updatePlanCompiled_ = false;
+  }
+
+  /**
+   * @brief indicate whether the curves exported only as final state values are updated at the end of the simulation
+   *
+   * @return @b true if they are only updated through updateFinalStateValues
+   */
+  bool getFinalStateValuesAtEnd() const {
+    return finalStateValuesAtEnd_;
+  }
+
+  /**
+   * @brief set the value of the curves exported only as final state values, when they are updated at the end of the simulation
+   *
+   * @param time time of the final state values
+   */
+  void updateFinalStateValues(double time);
+
+  /**
+   * @brief compile the update plan, once the buffers, factors and signs of the curves are set
+   *
+   * The plan lists the address and the signed factor of the value of each available variable curve, sorted by address so
+   * that the values read from the same array are gathered together. It must be compiled again if one of them changes.
+   */
+  void compileUpdatePlan();
+
+  /**
+   * @brief drop the oldest points of every curve, for instance once they have been streamed to a file
+   *
+   * @param nbKept number of most recent points to keep
+   */
+  void keepLastPoints(size_t nbKept);
+
+  /**
+   * @brief get the time column shared by the curves updated through the collection
+   *
+   * @return times of the points of these curves
+   */
+  const std::vector<double>& getTimes() const {
+    return *times_;
+  }
+
+  /**
+   * @brief append points recorded by a copy of the collection, for instance in a forked process
+   *
+   * The values of each curve are aligned on the end of the times, as the points of a curve updated only at the end of the
+   * simulation, and are appended without recording filter.
+   *
+   * @param times times of the points, appended to the time column of the collection
+   * @param values values of the points of each curve, in the order of the curves of the collection
+   */
+  void appendPoints(const std::vector<double>& times, const std::vector<std::vector<double> >& values);
+
+  /**
+   * @brief set the minimum time interval between two kept points
+   *
+   * @param minInterval minimum time interval, a point closer to the previous kept one being dropped even if a curve needs it
+   */
+  void setMinInterval(double minInterval) {
+    minInterval_ = minInterval;
+  }
+
+  /**
+   * @brief get the minimum time interval between two kept points
+   *
+   * @return minimum time interval, not positive if disabled
+   */
+  double getMinInterval() const {
+    return minInterval_;
+  }
+
   /**
   * @brief get curves
   *
@@ -65,9 +158,38 @@ class CurvesCollection {
     return curves_;
   }
 
+  /**
+   * @brief get the memory allocated for the points of the curves
+   *
+   * @return number of bytes allocated for the values and the time columns of the curves
+   */
+  size_t getMemoryUsage() const;
+
  private:
+  /**
+   * @brief indicate whether a curve is only updated at the end of the simulation
+   *
+   * @param curve curve of the collection
+   *
+   * @return @b true if the curve is exported only as a final state value and these curves are updated at the end
+   */
+  bool isUpdatedAtEnd(const Curve& curve) const;
+
   std::vector<std::shared_ptr<Curve> > curves_;    ///< Vector of the curves object
   std::string id_;                                 ///< Curves collections id
+  std::shared_ptr<std::vector<double> > times_;    ///< time column shared by the curves without point at the first update
+  double minInterval_;                             ///< minimum time interval between two kept points, not positive if disabled
+  bool hasKeptTime_;                               ///< @b true if a point has already been kept by the recording filters
+  double keptTime_;                                ///< time of the last kept point
+
+  bool updatePlanCompiled_;                        ///< @b true if the update plan matches the curves of the collection
+  std::vector<const double*> planSources_;         ///< address of the value of each variable curve of the plan, sorted
+  std::vector<double> planScales_;                 ///< signed factor of each variable curve of the plan
+  std::vector<Curve*> planCurves_;                 ///< variable curves of the plan
+  std::vector<double> planValues_;                 ///< values gathered for the variable curves of the plan
+  std::vector<Curve*> otherCurves_;                ///< curves outside of the plan, updated one by one
+  bool finalStateValuesAtEnd_;                     ///< @b true if the final state value curves are only updated at the end
+  std::vector<Curve*> finalStateValueCurves_;      ///< curves exported only as final state values, updated at the end
 };
 
 }  // namespace curves
@@ -0,0 +1,138 @@
+//
+// Copyright (c) 2015-2019, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  CRVStreamExporter.cpp
+ *
+ * @brief Dynawo curves collection streaming exporter : implementation file
+ *
+ */
+#include <cstdint>
+
+#include "DYNMacrosMessage.h"
+#include "DYNCommon.h"
+
+#include "CRVCurve.h"
+#include "CRVStreamExporter.h"
+
+using std::string;
+
+namespace curves {
+
+static const char CSV_SEPARATOR = ';';  ///< separator of the CSV format
+static const char BINARY_MAGIC[] = "DYNCRVB1";  ///< first characters of the binary format
+
+StreamExporter::StreamExporter(const Format_t format, const size_t chunkSize) :
+format_(format),
+chunkSize_(chunkSize > 0 ? chunkSize : 1),
+nbStoredPoints_(0) {
+}
+
+void
+StreamExporter::open(const std::shared_ptr<CurvesCollection>& curves, const string& filePath) {
+  curves_ = curves;
+  curvesToExport_.clear();
+  for (const auto& curve : curves_->getCurves())
+    if (curve->getAvailable() && curve->getExportType() != Curve::EXPORT_AS_FINAL_STATE_VALUE)
+      curvesToExport_.push_back(curve);
+
+  stream_.open(filePath.c_str(), format_ == BINARY ? std::ios::out | std::ios::binary : std::ios::out);
+  if (!stream_.is_open()) {
+    throw DYNError(DYN::Error::API, FileGenerationFailed, filePath.c_str());
+  }
+  writeHeader();
+  nbStoredPoints_ = curvesToExport_.empty() ? 0 : curvesToExport_.front()->getNbPoints();
+}
+
+void
+StreamExporter::update() {
+  ++nbStoredPoints_;
+  if (nbStoredPoints_ >= chunkSize_)
+    flush();
+}
+
+void
+StreamExporter::flush() {
+  if (!stream_.is_open())
+    return;
+  if (!curvesToExport_.empty() && curvesToExport_.front()->getNbPoints() > 1)
+    writePoints(curvesToExport_.front()->getNbPoints() - 1);
+  curves_->keepLastPoints(1);
+  stream_.flush();
+  nbStoredPoints_ = 1;
+}
+
+void
+StreamExporter::close() {
+  if (!stream_.is_open())
+    return;
+  if (!curvesToExport_.empty())
+    writePoints(curvesToExport_.front()->getNbPoints());
+  stream_.close();
+}
+
+void
+StreamExporter::writeHeader() {
+  if (format_ == BINARY) {
+    stream_.write(BINARY_MAGIC, sizeof(BINARY_MAGIC) - 1);
+    const uint64_t nbCurves = curvesToExport_.size();
+    stream_.write(reinterpret_cast<const char*>(&nbCurves), sizeof(nbCurves));
+    for (const auto& curve : curvesToExport_) {
+      const string name = curve->getUniqueName();
+      const uint64_t length = name.size();
+      stream_.write(reinterpret_cast<const char*>(&length), sizeof(length));
+      stream_.write(name.data(), static_cast<std::streamsize>(name.size()));
+    }
+    return;
+  }
+
+  if (curvesToExport_.empty())
+    return;
+  stream_ << "time" << CSV_SEPARATOR;
+  for (const auto& curve : curvesToExport_)
+    stream_ << curve->getUniqueName() << CSV_SEPARATOR;
+  stream_ << '\n';
+}
+
+void
+StreamExporter::writePoints(const size_t nbPoints) {
+  const std::shared_ptr<Curve>& reference = curvesToExport_.front();
+  if (format_ == BINARY) {
+    std::vector<double> record(curvesToExport_.size() + 1);
+    for (size_t step = 0; step < nbPoints; ++step) {
+      record[0] = reference->getTime(step);
+      for (size_t i = 0; i < curvesToExport_.size(); ++i)
+        record[i + 1] = curvesToExport_[i]->getValue(step);
+      stream_.write(reinterpret_cast<const char*>(record.data()), static_cast<std::streamsize>(record.size() * sizeof(double)));
+    }
+    return;
+  }
+
+  // as in CsvExporter, a line is only printed if at least one value (including time) has changed
+  for (size_t step = 0; step < nbPoints; ++step) {
+    std::string newLine = DYN::double2String(reference->getTime(step));
+    newLine += CSV_SEPARATOR;
+    for (const auto& curve : curvesToExport_) {
+      newLine += DYN::double2String(curve->getValue(step));
+      newLine += CSV_SEPARATOR;
+    }
+    newLine += '\n';
+
+    if (newLine != prevLine_) {
+      stream_ << newLine;
+      prevLine_ = newLine;
+    }
+  }
+}
+
+}  // namespace curves
@@ -0,0 +1,110 @@
+//
+// Copyright (c) 2015-2019, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  CRVStreamExporter.h
+ *
+ * @brief Dynawo curves collection streaming exporter : header file
+ *
+ */
+#ifndef API_CRV_CRVSTREAMEXPORTER_H_
+#define API_CRV_CRVSTREAMEXPORTER_H_
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "CRVCurvesCollection.h"
+
+namespace curves {
+
+/**
+ * @class StreamExporter
+ * @brief Streaming exporter for curves
+ *
+ * Writes the points of a curves collection to a file while the simulation runs and drops them
+ * from memory, so that only the last @p chunkSize points are kept by the curves.
+ *
+ * The CSV format is the one of CsvExporter. The binary format is made of:
+ * - the 8 characters "DYNCRVB1";
+ * - the number of curves as a 64 bits unsigned integer;
+ * - for each curve, the length of its unique name as a 64 bits unsigned integer followed by the name;
+ * - for each point, the time followed by the value of every curve, as native doubles.
+ */
+class StreamExporter {
+ public:
+  /**
+   * formats the curves can be streamed in
+   */
+  typedef enum { CSV, BINARY } Format_t;
+
+  /**
+   * @brief constructor
+   *
+   * @param format format of the output file
+   * @param chunkSize number of points stored in memory before they are written to the file
+   */
+  StreamExporter(Format_t format, size_t chunkSize);
+
+  /**
+   * @brief open the output file and write its header
+   *
+   * Must be called once the availability of the curves is known.
+   *
+   * @param curves curves to export
+   * @param filePath file to export the curves to
+   */
+  void open(const std::shared_ptr<CurvesCollection>& curves, const std::string& filePath);
+
+  /**
+   * @brief notify the exporter that a point has been added to the curves, writing the stored points when a chunk is full
+   */
+  void update();
+
+  /**
+   * @brief write the stored points but the last one, which may still be needed (final state values), and drop them from memory
+   */
+  void flush();
+
+  /**
+   * @brief write the remaining points and close the output file
+   */
+  void close();
+
+ private:
+  /**
+   * @brief write the header of the output file
+   */
+  void writeHeader();
+
+  /**
+   * @brief write stored points to the output file
+   *
+   * @param nbPoints number of oldest points to write
+   */
+  void writePoints(size_t nbPoints);
+
+ private:
+  Format_t format_;                                       ///< format of the output file
+  size_t chunkSize_;                                      ///< number of points stored before writing them
+  size_t nbStoredPoints_;                                 ///< number of points stored since the last write
+  std::shared_ptr<CurvesCollection> curves_;              ///< curves collection streamed
+  std::vector<std::shared_ptr<Curve> > curvesToExport_;  ///< curves actually written to the file
+  std::ofstream stream_;                                  ///< output file stream
+  std::string prevLine_;                                  ///< last line written in CSV format
+};
+
+}  // namespace curves
+
+#endif  // API_CRV_CRVSTREAMEXPORTER_H_
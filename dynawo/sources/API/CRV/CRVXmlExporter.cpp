@@ -20,26 +20,19 @@
 #include <fstream>
 #include <sstream>
 
-#include <xml/sax/formatter/AttributeList.h>
-#include <xml/sax/formatter/Formatter.h>
-
 #include "DYNMacrosMessage.h"
 
 #include "DYNCommon.h"
+#include "DYNXmlStreamWriter.h"
 
 #include "CRVCurvesCollection.h"
 #include "CRVCurve.h"
-#include "CRVPoint.h"
 #include "CRVXmlExporter.h"
 
 using std::fstream;
 using std::ostream;
 using std::string;
 
-using xml::sax::formatter::AttributeList;
-using xml::sax::formatter::Formatter;
-using xml::sax::formatter::FormatterPtr;
-
 namespace curves {
 
 void
@@ -56,33 +49,30 @@ XmlExporter::exportToFile(const std::shared_ptr<CurvesCollection>& curves, const
 
 void
 XmlExporter::exportToStream(const std::shared_ptr<CurvesCollection>& curves, ostream& stream) const {
-  FormatterPtr formatter = Formatter::createFormatter(stream, "http://www.rte-france.com/dynawo");
+  DYN::XmlStreamWriter writer(stream, "http://www.rte-france.com/dynawo");
 
-  formatter->startDocument();
-  AttributeList attrs;
-  formatter->startElement("curvesOutput", attrs);
+  writer.startDocument();
+  writer.startElement("curvesOutput");
 
   for (const auto& curve : curves->getCurves()) {
     const bool exportAsCurve = curve->getExportType() == Curve::EXPORT_AS_CURVE || curve->getExportType() == Curve::EXPORT_AS_BOTH;
     if (curve->getAvailable() && exportAsCurve) {
-      attrs.clear();
-      attrs.add("model", curve->getModelName());
-      attrs.add("variable", curve->getVariable());
+      writer.startElement("curve");
+      writer.addAttribute("model", curve->getModelName());
+      writer.addAttribute("variable", curve->getVariable());
       if (DYN::doubleNotEquals(curve->getFactor(), 1.))
-        attrs.add("factor", curve->getFactor());
-      formatter->startElement("curve", attrs);
-      for (const auto& point : curve->getPoints()) {
-        attrs.clear();
-        attrs.add("time", DYN::double2String(point->getTime()));
-        attrs.add("value", DYN::double2String(point->getValue()));
-        formatter->startElement("point", attrs);
-        formatter->endElement();   // point
+        writer.addAttribute("factor", curve->getFactor());
+      for (size_t i = 0; i < curve->getNbPoints(); ++i) {
+        writer.startElement("point");
+        writer.addAttribute("time", curve->getTime(i), DYN::XmlStreamWriter::DOUBLE_PRECISION);
+        writer.addAttribute("value", curve->getValue(i), DYN::XmlStreamWriter::DOUBLE_PRECISION);
+        writer.endElement();   // point
       }
-      formatter->endElement();   // curve
+      writer.endElement();   // curve
     }
   }
-  formatter->endElement();   // curvesOutput
-  formatter->endDocument();
+  writer.endElement();   // curvesOutput
+  writer.endDocument();
 }
 
 }  // namespace curves
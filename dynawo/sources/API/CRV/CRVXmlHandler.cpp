@@ -46,7 +46,10 @@ static parser::namespace_uri& namespace_uri() {
 
 XmlHandler::XmlHandler() :
 curvesCollection_(CurvesCollectionFactory::newInstance("")),
-curveHandler_(parser::ElementName(namespace_uri(), "curve")) {
+curveHandler_(parser::ElementName(namespace_uri(), "curve")),
+deadband_(-1.),
+maxError_(-1.) {
+  onStartElement(namespace_uri()("curvesInput"), lambda::bind(&XmlHandler::readRecordingFilters, lambda::ref(*this), lambda_args::arg2));
   onElement(namespace_uri()("curvesInput/curve"), curveHandler_);
   curveHandler_.onEnd(lambda::bind(&XmlHandler::addCurve, lambda::ref(*this)));
 }
@@ -60,7 +63,22 @@ XmlHandler::getCurvesCollection() {
 
 void
 XmlHandler::addCurve() {
-  curvesCollection_->add(curveHandler_.get());
+  const std::shared_ptr<Curve>& curve = curveHandler_.get();
+  if (!curve->hasRecordingFilter()) {
+    curve->setDeadband(deadband_);
+    curve->setMaxError(maxError_);
+  }
+  curvesCollection_->add(curve);
+}
+
+void
+XmlHandler::readRecordingFilters(parser::Attributes const& attributes) {
+  if (attributes.has("deadband"))
+    deadband_ = attributes["deadband"];
+  if (attributes.has("maxError"))
+    maxError_ = attributes["maxError"];
+  if (attributes.has("minInterval"))
+    curvesCollection_->setMinInterval(attributes["minInterval"]);
 }
 
 CurveHandler::CurveHandler(elementName_type const& root_element) {
@@ -75,6 +93,10 @@ void CurveHandler::create(attributes_type const & attributes) {
   curveRead_->setVariable(attributes["variable"]);
   if (attributes.has("factor"))
     curveRead_->setFactor(attributes["factor"]);
+  if (attributes.has("deadband"))
+    curveRead_->setDeadband(attributes["deadband"]);
+  if (attributes.has("maxError"))
+    curveRead_->setMaxError(attributes["maxError"]);
 }
 
 std::shared_ptr<Curve>
@@ -97,8 +97,17 @@ class XmlHandler : public xml::sax::parser::ComposableDocumentHandler {
    */
   void addCurve();
 
+  /**
+   * @brief read the recording filters set for the whole collection
+   *
+   * @param attributes attributes of the root element
+   */
+  void readRecordingFilters(xml::sax::parser::Attributes const& attributes);
+
   std::shared_ptr<CurvesCollection> curvesCollection_;  ///< Curves collection parsed
   CurveHandler curveHandler_;  ///< handler used to read curve element
+  double deadband_;  ///< deadband applied to the curves without their own, negative if disabled
+  double maxError_;  ///< maximum error applied to the curves without their own, negative if disabled
 };
 
 
@@ -21,7 +21,6 @@
 
 #include "CRVCurveFactory.h"
 #include "CRVCurve.h"
-#include "CRVPoint.h"
 
 namespace curves {
 
@@ -82,21 +81,20 @@ TEST(APICRVTest, CurveUpdate) {
   curve1->setNegated(true);
   ASSERT_NO_THROW(curve1->update(2));  // the curve is available and is not a parameter curve and the value has to be negated
 
-  int nbPoints = 0;
-  for (const auto& point : curve1->getPoints()) {
-    if (nbPoints == 0) {
-      ASSERT_EQ(point->getTime(), 0);  // uptade method called at time = 0
-      ASSERT_EQ(point->getValue(), 0);  // the curve is a parameter curve so the value is set to zero (default value)
-    } else if (nbPoints == 1) {
-      ASSERT_EQ(point->getTime(), 1);  // uptade method called at time = 1
-      ASSERT_EQ(point->getValue(), 1);  // negated is false so the value is 1 (value stored in the vector 'variables')
-    } else {
-      ASSERT_EQ(point->getTime(), 2);  // uptade method called at time = 2
-      ASSERT_EQ(point->getValue(), -1);  // negated is true so the value is -1 (inverse of the value stored in the vector 'variables')
-    }
-    ++nbPoints;
-  }
-  ASSERT_EQ(nbPoints, 3);
+  ASSERT_EQ(curve1->getNbPoints(), 3);
+  ASSERT_EQ(curve1->getTime(0), 0);  // uptade method called at time = 0
+  ASSERT_EQ(curve1->getValue(0), 0);  // the curve is a parameter curve so the value is set to zero (default value)
+  ASSERT_EQ(curve1->getTime(1), 1);  // uptade method called at time = 1
+  ASSERT_EQ(curve1->getValue(1), 1);  // negated is false so the value is 1 (value stored in the vector 'variables')
+  ASSERT_EQ(curve1->getTime(2), 2);  // uptade method called at time = 2
+  ASSERT_EQ(curve1->getValue(2), -1);  // negated is true so the value is -1 (inverse of the value stored in the vector 'variables')
+
+  // a curve exported as a final state value only keeps its last point
+  curve1->setExportType(Curve::EXPORT_AS_FINAL_STATE_VALUE);
+  ASSERT_NO_THROW(curve1->update(3));
+  ASSERT_EQ(curve1->getNbPoints(), 3);
+  ASSERT_EQ(curve1->getLastTime(), 3);
+  ASSERT_EQ(curve1->getLastValue(), -1);
 }
 
 TEST(APICRVTest, CurveUpdateParameterCurveValue) {
@@ -118,21 +116,11 @@ TEST(APICRVTest, CurveUpdateParameterCurveValue) {
   // test updateParameterCurveValue (set the value to a given value)
   ASSERT_NO_THROW(curve1->updateParameterCurveValue("variable1", 5));
 
-  int nbPoints = 0;
-  for (const auto& point : curve1->getPoints()) {
-    if (nbPoints == 0) {
-      ASSERT_EQ(point->getTime(), 0);  // uptade method called at time = 0
-      ASSERT_EQ(point->getValue(), 5);  // the value has been set to 5 by the updateParameterCurveValue method
-    } else if (nbPoints == 1) {
-      ASSERT_EQ(point->getTime(), 1);  // uptade method called at time = 1
-      ASSERT_EQ(point->getValue(), 5);  // the value has been set to 5 by the updateParameterCurveValue method
-    } else {
-      ASSERT_EQ(point->getTime(), 2);  // uptade method called at time = 2
-      ASSERT_EQ(point->getValue(), 5);  // the value has been set to 5 by the updateParameterCurveValue method
-    }
-    ++nbPoints;
+  ASSERT_EQ(curve1->getNbPoints(), 3);
+  for (size_t i = 0; i < curve1->getNbPoints(); ++i) {
+    ASSERT_EQ(curve1->getTime(i), static_cast<double>(i));  // uptade method called at time = i
+    ASSERT_EQ(curve1->getValue(i), 5);  // the value has been set to 5 by the updateParameterCurveValue method
   }
-  ASSERT_EQ(nbPoints, 3);
 
   boost::shared_ptr<Curve> curve2 = CurveFactory::newCurve();
   curve2->setVariable("variable1");
@@ -151,8 +139,8 @@ TEST(APICRVTest, CurveUpdateParameterCurveValue) {
   curve3->setFactor(10);
   curve3->setBuffer(&val3);
   curve3->update(2);
-  ASSERT_TRUE(curve3->getPoints().at(0)->getTime() == 2.);
-  ASSERT_TRUE(curve3->getPoints().at(0)->getValue() == 30.);
+  ASSERT_TRUE(curve3->getTime(0) == 2.);
+  ASSERT_TRUE(curve3->getValue(0) == 30.);
 }
 
 }  // namespace curves
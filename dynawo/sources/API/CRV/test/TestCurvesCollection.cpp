@@ -79,4 +79,254 @@ TEST(APICRVTest, CurvesCollectionIterator) {
   ASSERT_EQ(nbPoints, 2);
 }
 
+TEST(APICRVTest, CurvesCollectionSharedTimes) {
+  const std::unique_ptr<CurvesCollection> curvesCollection = CurvesCollectionFactory::newInstance("Curves");
+  std::vector<double> variables(2, 0.);
+
+  std::shared_ptr<Curve> curve1 = CurveFactory::newCurve();
+  curve1->setAvailable(true);
+  curve1->setBuffer(&variables[0]);
+  curvesCollection->add(curve1);
+
+  std::shared_ptr<Curve> curve2 = CurveFactory::newCurve();
+  curve2->setAvailable(true);
+  curve2->setBuffer(&variables[1]);
+  curve2->setExportType(Curve::EXPORT_AS_FINAL_STATE_VALUE);
+  curvesCollection->add(curve2);
+
+  for (int step = 0; step < 3; ++step) {
+    variables[0] = step;
+    variables[1] = 10. * step;
+    curvesCollection->updateCurves(0.5 * step);
+  }
+
+  // a curve added after the first update keeps its own time column
+  std::shared_ptr<Curve> curve3 = CurveFactory::newCurve();
+  curve3->setAvailable(true);
+  curve3->setBuffer(&variables[0]);
+  curvesCollection->add(curve3);
+  curvesCollection->updateCurves(2.);
+
+  ASSERT_EQ(curve1->getNbPoints(), 4);
+  ASSERT_DOUBLE_EQ(curve1->getTime(1), 0.5);
+  ASSERT_DOUBLE_EQ(curve1->getValue(1), 1.);
+  ASSERT_DOUBLE_EQ(curve1->getTime(3), 2.);
+  ASSERT_EQ(curve2->getNbPoints(), 1);
+  ASSERT_DOUBLE_EQ(curve2->getTime(0), 2.);
+  ASSERT_DOUBLE_EQ(curve2->getValue(0), 20.);
+  ASSERT_EQ(curve3->getNbPoints(), 1);
+  ASSERT_DOUBLE_EQ(curve3->getTime(0), 2.);
+  ASSERT_DOUBLE_EQ(curve3->getValue(0), 2.);
+}
+
+TEST(APICRVTest, CurvesCollectionAppendPoints) {
+  const std::unique_ptr<CurvesCollection> curvesCollection = CurvesCollectionFactory::newInstance("Curves");
+  std::vector<double> variables(2, 0.);
+
+  std::shared_ptr<Curve> curve = CurveFactory::newCurve();
+  curve->setAvailable(true);
+  curve->setBuffer(&variables[0]);
+  curvesCollection->add(curve);
+
+  std::shared_ptr<Curve> curveFinal = CurveFactory::newCurve();
+  curveFinal->setAvailable(true);
+  curveFinal->setBuffer(&variables[1]);
+  curveFinal->setExportType(Curve::EXPORT_AS_FINAL_STATE_VALUE);
+  curvesCollection->add(curveFinal);
+  curvesCollection->updateCurves(0.);
+
+  // the points recorded by a copy of the collection, the final state value only holding its last one
+  std::vector<double> times;
+  times.push_back(1.);
+  times.push_back(2.);
+  std::vector<std::vector<double> > values(2);
+  values[0].push_back(10.);
+  values[0].push_back(20.);
+  values[1].push_back(-2.);
+  curvesCollection->appendPoints(times, values);
+
+  ASSERT_EQ(curvesCollection->getTimes().size(), 3);
+  ASSERT_EQ(curve->getNbPoints(), 3);
+  ASSERT_DOUBLE_EQ(curve->getTime(1), 1.);
+  ASSERT_DOUBLE_EQ(curve->getValue(1), 10.);
+  ASSERT_DOUBLE_EQ(curve->getTime(2), 2.);
+  ASSERT_DOUBLE_EQ(curve->getValue(2), 20.);
+  ASSERT_EQ(curveFinal->getNbPoints(), 1);
+  ASSERT_DOUBLE_EQ(curveFinal->getTime(0), 2.);
+  ASSERT_DOUBLE_EQ(curveFinal->getValue(0), -2.);
+
+  // the next points are recorded after the appended ones
+  variables[0] = 30.;
+  curvesCollection->updateCurves(3.);
+  ASSERT_EQ(curve->getNbPoints(), 4);
+  ASSERT_DOUBLE_EQ(curve->getTime(3), 3.);
+  ASSERT_DOUBLE_EQ(curve->getValue(3), 30.);
+}
+
+TEST(APICRVTest, CurvesCollectionFinalStateValuesAtEnd) {
+  const std::unique_ptr<CurvesCollection> curvesCollection = CurvesCollectionFactory::newInstance("Curves");
+  std::vector<double> variables(3, 0.);
+  ASSERT_FALSE(curvesCollection->getFinalStateValuesAtEnd());
+  curvesCollection->setFinalStateValuesAtEnd(true);
+  ASSERT_TRUE(curvesCollection->getFinalStateValuesAtEnd());
+
+  std::shared_ptr<Curve> curve = CurveFactory::newCurve();
+  curve->setAvailable(true);
+  curve->setBuffer(&variables[0]);
+  curvesCollection->add(curve);
+
+  std::shared_ptr<Curve> curveFinal = CurveFactory::newCurve();
+  curveFinal->setAvailable(true);
+  curveFinal->setBuffer(&variables[1]);
+  curveFinal->setFactor(2.);
+  curveFinal->setExportType(Curve::EXPORT_AS_FINAL_STATE_VALUE);
+  curvesCollection->add(curveFinal);
+
+  std::shared_ptr<Curve> curveBoth = CurveFactory::newCurve();
+  curveBoth->setAvailable(true);
+  curveBoth->setBuffer(&variables[2]);
+  curveBoth->setExportType(Curve::EXPORT_AS_BOTH);
+  curvesCollection->add(curveBoth);
+  curvesCollection->compileUpdatePlan();
+
+  for (int step = 0; step < 3; ++step) {
+    variables[0] = step;
+    variables[1] = 10. * step;
+    variables[2] = -step;
+    curvesCollection->updateCurves(step);
+  }
+  // the final state value is left aside during the simulation
+  ASSERT_EQ(curve->getNbPoints(), 3);
+  ASSERT_EQ(curveBoth->getNbPoints(), 3);
+  ASSERT_EQ(curveFinal->getNbPoints(), 0);
+
+  curvesCollection->updateFinalStateValues(2.);
+  ASSERT_EQ(curveFinal->getNbPoints(), 1);
+  ASSERT_DOUBLE_EQ(curveFinal->getLastTime(), 2.);
+  ASSERT_DOUBLE_EQ(curveFinal->getLastValue(), 40.);
+  ASSERT_EQ(curve->getNbPoints(), 3);
+  ASSERT_DOUBLE_EQ(curveBoth->getLastValue(), -2.);
+
+  // updated at each time step otherwise
+  curvesCollection->setFinalStateValuesAtEnd(false);
+  variables[1] = 1.;
+  curvesCollection->updateCurves(3.);
+  ASSERT_EQ(curveFinal->getNbPoints(), 1);
+  ASSERT_DOUBLE_EQ(curveFinal->getLastValue(), 2.);
+}
+
+TEST(APICRVTest, CurvesCollectionUpdatePlan) {
+  const std::unique_ptr<CurvesCollection> curvesCollection = CurvesCollectionFactory::newInstance("Curves");
+  std::vector<double> variables(3, 0.);
+  std::vector<double> otherVariables(1, 0.);
+
+  // curves declared in another order than their buffers
+  std::shared_ptr<Curve> curveFactor = CurveFactory::newCurve();
+  curveFactor->setAvailable(true);
+  curveFactor->setBuffer(&variables[2]);
+  curveFactor->setFactor(2.);
+  curvesCollection->add(curveFactor);
+
+  std::shared_ptr<Curve> curveOther = CurveFactory::newCurve();
+  curveOther->setAvailable(true);
+  curveOther->setBuffer(&otherVariables[0]);
+  curvesCollection->add(curveOther);
+
+  std::shared_ptr<Curve> curveNegated = CurveFactory::newCurve();
+  curveNegated->setAvailable(true);
+  curveNegated->setBuffer(&variables[0]);
+  curveNegated->setNegated(true);
+  curveNegated->setFactor(0.5);
+  curvesCollection->add(curveNegated);
+
+  std::shared_ptr<Curve> curveParameter = CurveFactory::newCurve();
+  curveParameter->setAvailable(true);
+  curveParameter->setAsParameterCurve(true);
+  curvesCollection->add(curveParameter);
+
+  std::shared_ptr<Curve> curveUnavailable = CurveFactory::newCurve();
+  curveUnavailable->setAvailable(false);
+  curvesCollection->add(curveUnavailable);
+  curvesCollection->compileUpdatePlan();
+
+  for (int step = 0; step < 2; ++step) {
+    variables[0] = step + 1.;
+    variables[2] = 10. * step;
+    otherVariables[0] = -3. * step;
+    curvesCollection->updateCurves(step);
+  }
+  ASSERT_EQ(curveFactor->getNbPoints(), 2);
+  ASSERT_DOUBLE_EQ(curveFactor->getValue(1), 20.);
+  ASSERT_DOUBLE_EQ(curveOther->getValue(1), -3.);
+  ASSERT_DOUBLE_EQ(curveNegated->getValue(0), -0.5);
+  ASSERT_DOUBLE_EQ(curveNegated->getValue(1), -1.);
+  ASSERT_EQ(curveParameter->getNbPoints(), 2);
+  ASSERT_DOUBLE_EQ(curveParameter->getValue(1), 0.);
+  ASSERT_EQ(curveUnavailable->getNbPoints(), 0);
+
+  // a curve added after the compilation is taken into account at the next update
+  std::shared_ptr<Curve> curveAdded = CurveFactory::newCurve();
+  curveAdded->setAvailable(true);
+  curveAdded->setBuffer(&variables[1]);
+  curveAdded->setFactor(4.);
+  curvesCollection->add(curveAdded);
+  variables[1] = 1.5;
+  curvesCollection->updateCurves(2.);
+  ASSERT_EQ(curveAdded->getNbPoints(), 1);
+  ASSERT_DOUBLE_EQ(curveAdded->getValue(0), 6.);
+  ASSERT_EQ(curveFactor->getNbPoints(), 3);
+  ASSERT_DOUBLE_EQ(curveFactor->getTime(2), 2.);
+}
+
+TEST(APICRVTest, CurvesCollectionRecordingFilters) {
+  const std::unique_ptr<CurvesCollection> curvesCollection = CurvesCollectionFactory::newInstance("Curves");
+  std::vector<double> variables(2, 0.);
+
+  std::shared_ptr<Curve> ramp = CurveFactory::newCurve();
+  ramp->setAvailable(true);
+  ramp->setBuffer(&variables[0]);
+  ramp->setMaxError(0.01);
+  curvesCollection->add(ramp);
+
+  std::shared_ptr<Curve> step = CurveFactory::newCurve();
+  step->setAvailable(true);
+  step->setBuffer(&variables[1]);
+  step->setDeadband(0.5);
+  curvesCollection->add(step);
+
+  // a ramp up to t = 10 then a plateau, and a step at t = 5 with a small noise
+  for (int i = 0; i <= 20; ++i) {
+    const double t = i;
+    variables[0] = (t < 10.) ? t : 10.;
+    variables[1] = ((t < 5.) ? 0. : 1.) + ((i % 2) ? 0.1 : 0.);
+    curvesCollection->updateCurves(t);
+  }
+
+  // kept points: the start, the step of the second curve, the end of the ramp and the latest point
+  ASSERT_EQ(ramp->getNbPoints(), 4);
+  ASSERT_DOUBLE_EQ(ramp->getTime(0), 0.);
+  ASSERT_DOUBLE_EQ(ramp->getTime(1), 5.);
+  ASSERT_DOUBLE_EQ(ramp->getTime(2), 10.);
+  ASSERT_DOUBLE_EQ(ramp->getTime(3), 20.);
+  ASSERT_DOUBLE_EQ(ramp->getValue(2), 10.);
+  ASSERT_DOUBLE_EQ(step->getValue(1), 1.1);
+  ASSERT_DOUBLE_EQ(step->getLastValue(), 1.);
+
+  // with a minimum interval, points closer than it to the previous kept one are dropped
+  const std::unique_ptr<CurvesCollection> sparseCollection = CurvesCollectionFactory::newInstance("Sparse");
+  sparseCollection->setMinInterval(3.);
+  std::shared_ptr<Curve> curve = CurveFactory::newCurve();
+  curve->setAvailable(true);
+  curve->setBuffer(&variables[0]);
+  sparseCollection->add(curve);
+  for (int i = 0; i <= 10; ++i) {
+    variables[0] = i;
+    sparseCollection->updateCurves(i);
+  }
+  ASSERT_EQ(curve->getNbPoints(), 5);
+  ASSERT_DOUBLE_EQ(curve->getTime(1), 3.);
+  ASSERT_DOUBLE_EQ(curve->getTime(3), 9.);
+  ASSERT_DOUBLE_EQ(curve->getLastTime(), 10.);
+}
+
 }  // namespace curves
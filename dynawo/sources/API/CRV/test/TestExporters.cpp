@@ -25,6 +25,13 @@
 #include "CRVCurve.h"
 #include "CRVCsvExporter.h"
 #include "CRVXmlExporter.h"
+#include "CRVStreamExporter.h"
+#include "CRVBinaryExporter.h"
+#include "CRVBinaryImporter.h"
+
+#include <cstdint>
+#include <fstream>
+#include <sstream>
 
 namespace curves {
 
@@ -219,4 +226,157 @@ TEST(APICRVTest, CurvesCollectionDontExportUnmarked) {
       "xmlns=\"http://www.rte-france.com/dynawo\"/>\n");
 }
 
+TEST(APICRVTest, CurvesCollectionCsvStreamExporter) {
+  std::shared_ptr<CurvesCollection> curvesCollection = CurvesCollectionFactory::newInstance("Curves");
+  std::vector<double> variables(2, 0.);
+
+  std::shared_ptr<Curve> curve1 = CurveFactory::newCurve();
+  curve1->setModelName("model");
+  curve1->setVariable("variable1");
+  curve1->setAvailable(true);
+  curve1->setBuffer(&variables[0]);
+  curvesCollection->add(curve1);
+
+  std::shared_ptr<Curve> curve2 = CurveFactory::newCurve();
+  curve2->setModelName("model");
+  curve2->setVariable("variable2");
+  curve2->setAvailable(true);
+  curve2->setBuffer(&variables[1]);
+  curve2->setExportType(Curve::EXPORT_AS_BOTH);
+  curvesCollection->add(curve2);
+
+  StreamExporter exporter(StreamExporter::CSV, 2);
+  exporter.open(curvesCollection, "curvesStream.csv");
+  for (int step = 0; step < 5; ++step) {
+    variables[0] = step;
+    variables[1] = (step < 2) ? 1. : 2.;
+    curvesCollection->updateCurves(step);
+    exporter.update();
+    ASSERT_LE(curve1->getNbPoints(), 2);
+  }
+  // the last point is kept in memory for the final state values
+  ASSERT_DOUBLE_EQ(curve2->getLastValue(), 2.);
+  ASSERT_DOUBLE_EQ(curve2->getLastTime(), 4.);
+  exporter.close();
+
+  std::ifstream file("curvesStream.csv");
+  std::stringstream ss;
+  ss << file.rdbuf();
+  ASSERT_EQ(ss.str(), "time;model_variable1;model_variable2;\n0.000000;0.000000;1.000000;\n1.000000;1.000000;1.000000;\n"
+      "2.000000;2.000000;2.000000;\n3.000000;3.000000;2.000000;\n4.000000;4.000000;2.000000;\n");
+}
+
+TEST(APICRVTest, CurvesCollectionBinaryStreamExporter) {
+  std::shared_ptr<CurvesCollection> curvesCollection = CurvesCollectionFactory::newInstance("Curves");
+  double variable = 0.;
+
+  std::shared_ptr<Curve> curve = CurveFactory::newCurve();
+  curve->setModelName("model");
+  curve->setVariable("variable");
+  curve->setAvailable(true);
+  curve->setBuffer(&variable);
+  curvesCollection->add(curve);
+
+  StreamExporter exporter(StreamExporter::BINARY, 3);
+  exporter.open(curvesCollection, "curvesStream.bin");
+  for (int step = 0; step < 4; ++step) {
+    variable = 10. * step;
+    curvesCollection->updateCurves(step);
+    exporter.update();
+  }
+  exporter.close();
+
+  std::ifstream file("curvesStream.bin", std::ios::binary);
+  char magic[8];
+  file.read(magic, sizeof(magic));
+  ASSERT_EQ(std::string(magic, sizeof(magic)), "DYNCRVB1");
+  uint64_t nbCurves = 0;
+  file.read(reinterpret_cast<char*>(&nbCurves), sizeof(nbCurves));
+  ASSERT_EQ(nbCurves, 1U);
+  uint64_t length = 0;
+  file.read(reinterpret_cast<char*>(&length), sizeof(length));
+  std::string name(length, ' ');
+  file.read(&name[0], static_cast<std::streamsize>(length));
+  ASSERT_EQ(name, "model_variable");
+  for (int step = 0; step < 4; ++step) {
+    double record[2];
+    file.read(reinterpret_cast<char*>(record), sizeof(record));
+    ASSERT_DOUBLE_EQ(record[0], step);
+    ASSERT_DOUBLE_EQ(record[1], 10. * step);
+  }
+  char extra;
+  ASSERT_FALSE(file.read(&extra, 1));
+}
+
+TEST(APICRVTest, CurvesCollectionBinaryExporterImporter) {
+  std::shared_ptr<CurvesCollection> curvesCollection = CurvesCollectionFactory::newInstance("Curves");
+  std::vector<double> variables(2, 0.);
+
+  std::shared_ptr<Curve> curve1 = CurveFactory::newCurve();
+  curve1->setModelName("model");
+  curve1->setVariable("variable1");
+  curve1->setAvailable(true);
+  curve1->setBuffer(&variables[0]);
+  curvesCollection->add(curve1);
+
+  std::shared_ptr<Curve> curve2 = CurveFactory::newCurve();
+  curve2->setModelName("model");
+  curve2->setVariable("variable2");
+  curve2->setFactor(2.);
+  curve2->setAvailable(true);
+  curve2->setBuffer(&variables[1]);
+  curvesCollection->add(curve2);
+
+  std::shared_ptr<Curve> curve3 = CurveFactory::newCurve();
+  curve3->setModelName("model");
+  curve3->setVariable("variable3");
+  curve3->setAvailable(true);
+  curve3->setBuffer(&variables[1]);
+  curve3->setExportType(Curve::EXPORT_AS_FINAL_STATE_VALUE);
+  curvesCollection->add(curve3);
+
+  for (int step = 0; step < 100; ++step) {
+    variables[0] = 0.1 * step;
+    variables[1] = -1. * step;
+    curvesCollection->updateCurves(0.5 * step);
+  }
+
+  for (bool compress : {true, false}) {
+    BinaryExporter exporter(compress);
+    std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+    exporter.exportToStream(curvesCollection, ss);
+
+    BinaryImporter importer;
+    ss.seekg(0);
+    std::shared_ptr<CurvesCollection> imported = importer.importFromStream(ss);
+    ASSERT_EQ(imported->getCurves().size(), 2);
+    const std::shared_ptr<Curve>& importedCurve2 = imported->getCurves()[1];
+    ASSERT_EQ(importedCurve2->getUniqueName(), curve2->getUniqueName());
+    ASSERT_EQ(importedCurve2->getNbPoints(), 100);
+    for (size_t step = 0; step < 100; ++step) {
+      ASSERT_DOUBLE_EQ(importedCurve2->getTime(step), curve2->getTime(step));
+      ASSERT_DOUBLE_EQ(importedCurve2->getValue(step), curve2->getValue(step));
+    }
+
+    // read a single curve
+    ss.clear();
+    ss.seekg(0);
+    std::vector<std::string> names(1, "model_variable1");
+    imported = importer.importFromStream(ss, &names);
+    ASSERT_EQ(imported->getCurves().size(), 1);
+    ASSERT_EQ(imported->getCurves()[0]->getVariable(), "variable1");
+    ASSERT_DOUBLE_EQ(imported->getCurves()[0]->getLastValue(), 9.9);
+    ASSERT_DOUBLE_EQ(imported->getCurves()[0]->getLastTime(), 49.5);
+
+    ss.clear();
+    ss.seekg(0);
+    names.assign(1, "model_unknown");
+    ASSERT_THROW_DYNAWO(importer.importFromStream(ss, &names), DYN::Error::API, DYN::KeyError_t::CurvesBinaryUnknownCurve);
+  }
+
+  std::stringstream invalid("not a curves file");
+  BinaryImporter importer;
+  ASSERT_THROW_DYNAWO(importer.importFromStream(invalid), DYN::Error::API, DYN::KeyError_t::CurvesBinaryInvalidFormat);
+}
+
 }  // namespace curves
@@ -68,4 +68,23 @@ TEST(APICRVTest, testXmlStreamImporter) {
   ASSERT_NO_THROW(curves = importer->importFromStream(goodStream));
 }
 
+TEST(APICRVTest, testXmlStreamImporterRecordingFilters) {
+  XmlImporter importer;
+  std::shared_ptr<CurvesCollection> curves;
+  std::istringstream inputStream(
+    "<?xml version='1.0' encoding='UTF-8'?>"
+    "<curvesInput xmlns=\"http://www.rte-france.com/dynawo\" deadband=\"0.1\" minInterval=\"2\">"
+    "<curve model=\"CHAN5Y742_EC\" variable=\"P\"/>"
+    "<curve model=\"CHAN5Y742_EC\" variable=\"Q\" maxError=\"0.01\"/>"
+    "</curvesInput>");
+  std::istream stream(inputStream.rdbuf());
+  ASSERT_NO_THROW(curves = importer.importFromStream(stream));
+  ASSERT_DOUBLE_EQ(curves->getMinInterval(), 2.);
+  ASSERT_EQ(curves->getCurves().size(), 2);
+  ASSERT_DOUBLE_EQ(curves->getCurves()[0]->getDeadband(), 0.1);
+  ASSERT_LT(curves->getCurves()[0]->getMaxError(), 0.);
+  ASSERT_LT(curves->getCurves()[1]->getDeadband(), 0.);
+  ASSERT_DOUBLE_EQ(curves->getCurves()[1]->getMaxError(), 0.01);
+}
+
 }  // namespace curves
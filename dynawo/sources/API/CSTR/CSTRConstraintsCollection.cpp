@@ -22,14 +22,13 @@
 #include "CSTRConstraint.h"
 #include "CSTRConstraintFactory.h"
 
-#include <iostream>
-#include <sstream>
+#include <cstdio>
 #include <set>
 #include <unordered_map>
+#include <utility>
 
 using std::map;
 using std::string;
-using std::stringstream;
 using std::vector;
 using std::set;
 
@@ -40,19 +39,21 @@ ConstraintsCollection::ConstraintsCollection(const string& id) : id_(id) {}
 void
 ConstraintsCollection::addConstraint(const string& modelName, const string& description, const double& time, Type_t type,
                                      const string& modelType, const boost::optional<constraints::ConstraintData>& data) {
-  string id = idFromDetails(modelName, description, time, type);
-  if (constraintsById_.find(id) == constraintsById_.end()) {
-    std::shared_ptr<Constraint> constraint = ConstraintFactory::newConstraint();
-    constraint->setModelName(modelName);
-    constraint->setDescription(description);
-    constraint->setTime(time);
-    constraint->setType(type);
-    constraint->setData(data);
-    constraint->setModelType(modelType);
-
-    constraintsByModel_[modelName].push_back(constraint);
-    constraintsById_[id] = constraint;
-  }
+  // a single search of the id both detects the duplicates and reserves the place of a new constraint
+  std::pair<map<string, std::shared_ptr<Constraint> >::iterator, bool> inserted =
+      constraintsById_.emplace(idFromDetails(modelName, description, time, type), std::shared_ptr<Constraint>());
+  if (!inserted.second)
+    return;
+  std::shared_ptr<Constraint> constraint = ConstraintFactory::newConstraint();
+  constraint->setModelName(modelName);
+  constraint->setDescription(description);
+  constraint->setTime(time);
+  constraint->setType(type);
+  constraint->setData(data);
+  constraint->setModelType(modelType);
+
+  constraintsByModel_[modelName].push_back(constraint);
+  inserted.first->second = constraint;
 }
 
 void
@@ -107,7 +108,7 @@ ConstraintsCollection::filter(DYN::ConstraintValueType_t filterType) {
   constraintsById_.clear();
   for (auto & modelIt : constraintsByModel_)
     for (std::shared_ptr<Constraint> & constraint : modelIt.second)
-      constraintsById_[idFromDetails(modelIt.first, constraint->getDescription(), constraint->getTime(), constraint->getType())] = constraint;
+      constraintsById_.emplace(idFromDetails(modelIt.first, constraint->getDescription(), constraint->getTime(), constraint->getType()), constraint);
 }
 
 void
@@ -118,9 +119,14 @@ ConstraintsCollection::clear() {
 
 string
 ConstraintsCollection::idFromDetails(const string & modelName, const string & description, const double & time, Type_t type) const {
-  stringstream stream;
-  stream << modelName << "_" << time << "_" << type << "_" << description;  // allow to sort constraint by modelName, then time and type
-  return stream.str();
+  // same formatting as a default output stream, without its construction cost: the time is printed with 6 significant digits
+  char timeBuffer[32];
+  std::snprintf(timeBuffer, sizeof(timeBuffer), "%g", time);
+  string id;
+  id.reserve(modelName.size() + description.size() + 40);
+  // allow to sort constraint by modelName, then time and type
+  id.append(modelName).append("_").append(timeBuffer).append("_").append(std::to_string(static_cast<int>(type))).append("_").append(description);
+  return id;
 }
 
 }  // namespace constraints
@@ -20,11 +20,9 @@
 #include <fstream>
 #include <sstream>
 
-#include <xml/sax/formatter/AttributeList.h>
-#include <xml/sax/formatter/Formatter.h>
-
 #include "DYNMacrosMessage.h"
 #include "DYNCommon.h"
+#include "DYNXmlStreamWriter.h"
 
 #include "CSTRXmlExporter.h"
 #include "CSTRConstraintsCollection.h"
@@ -34,10 +32,6 @@ using std::fstream;
 using std::ostream;
 using std::string;
 
-using xml::sax::formatter::AttributeList;
-using xml::sax::formatter::Formatter;
-using xml::sax::formatter::FormatterPtr;
-
 namespace constraints {
 
 void
@@ -54,75 +48,73 @@ XmlExporter::exportToFile(const std::shared_ptr<ConstraintsCollection>& constrai
 
 void
 XmlExporter::exportToStream(const std::shared_ptr<ConstraintsCollection>& constraints, ostream& stream) const {
-  FormatterPtr formatter = Formatter::createFormatter(stream, "http://www.rte-france.com/dynawo");
+  DYN::XmlStreamWriter writer(stream, "http://www.rte-france.com/dynawo");
 
-  formatter->startDocument();
-  AttributeList attrs;
+  writer.startDocument();
 
-  formatter->startElement("constraints", attrs);
+  writer.startElement("constraints");
   for (const auto& constraintPair : constraints->getConstraintsById()) {
     const auto& constraint = constraintPair.second;
-    attrs.clear();
-    attrs.add("modelName", constraint->getModelName());
-    attrs.add("description", constraint->getDescription());
-    attrs.add("time", DYN::double2String(constraint->getTime()));
+    writer.startElement("constraint");
+    writer.addAttribute("modelName", constraint->getModelName());
+    writer.addAttribute("description", constraint->getDescription());
+    writer.addAttribute("time", constraint->getTime(), DYN::XmlStreamWriter::DOUBLE_PRECISION);
     if (constraint->hasModelType())
-      attrs.add("type", constraint->getModelType());
+      writer.addAttribute("type", constraint->getModelType());
 
     const boost::optional<ConstraintData>& data = constraint->getData();
     if (data) {
       switch (data->kind) {
         case ConstraintData::OverloadOpen:
-          attrs.add("kind", "OverloadOpen");
+          writer.addAttribute("kind", "OverloadOpen");
           break;
         case ConstraintData::OverloadUp:
-          attrs.add("kind", "OverloadUp");
+          writer.addAttribute("kind", "OverloadUp");
           break;
         case ConstraintData::PATL:
-          attrs.add("kind", "PATL");
+          writer.addAttribute("kind", "PATL");
           break;
         case ConstraintData::UInfUmin:
-          attrs.add("kind", "UInfUmin");
+          writer.addAttribute("kind", "UInfUmin");
           break;
         case ConstraintData::USupUmax:
-          attrs.add("kind", "USupUmax");
+          writer.addAttribute("kind", "USupUmax");
           break;
         case ConstraintData::FictLim:
-          attrs.add("kind", "Fictitious");
+          writer.addAttribute("kind", "Fictitious");
           break;
         case ConstraintData::Undefined:
           break;
       }
-      attrs.add("limit", data->limit);
-      attrs.add("value", data->value);
+      writer.addAttribute("limit", data->limit);
+      writer.addAttribute("value", data->value);
 
       boost::optional<double> valueMin = data->valueMin;
       if (valueMin)
-        attrs.add("valueMin", valueMin.value());
+        writer.addAttribute("valueMin", valueMin.value());
 
       boost::optional<double> valueMax = data->valueMax;
       if (valueMax)
-        attrs.add("valueMax", valueMax.value());
+        writer.addAttribute("valueMax", valueMax.value());
 
       boost::optional<int> side = data->side;
       if (side) {
-        attrs.add("side", side.value());
+        writer.addAttribute("side", side.value());
       }
       boost::optional<double> acceptableDuration = data->acceptableDuration;
       if (acceptableDuration) {
-        attrs.add("acceptableDuration", acceptableDuration.value());
+        writer.addAttribute("acceptableDuration", acceptableDuration.value());
       }
       const std::string& limitName = data->limitName;
       if (!limitName.empty()) {
-        attrs.add("limitName", limitName);
+        writer.addAttribute("limitName", limitName);
       }
     }
 
-    formatter->startElement("constraint", attrs);
-    formatter->endElement();   // constraint
+    writer.endElement();   // constraint
   }
-  formatter->endElement();   // constraints
-  formatter->endDocument();
+  writer.endElement();   // constraints
+  writer.endDocument();
 }
 
 }  // namespace constraints
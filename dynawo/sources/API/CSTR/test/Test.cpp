@@ -51,6 +51,20 @@ TEST(APICSTRTest, CollectionAddConstraints) {
   ASSERT_NO_THROW(TxtExporter.exportToFile(collection, "constraint.txt"));
 }
 
+TEST(APICSTRTest, CollectionIdFromDetails) {
+  std::shared_ptr<ConstraintsCollection> collection;
+  collection = ConstraintsCollectionFactory::newInstance("test");
+
+  ASSERT_EQ(collection->idFromDetails("model", "constraint 1", 1.5, CONSTRAINT_BEGIN), "model_1.5_0_constraint 1");
+  ASSERT_EQ(collection->idFromDetails("model", "constraint 1", 12, CONSTRAINT_END), "model_12_1_constraint 1");
+  // the time is written with 6 significant digits: constraints closer in time are duplicates
+  ASSERT_EQ(collection->idFromDetails("model", "constraint 1", 1.23456789, CONSTRAINT_BEGIN), "model_1.23457_0_constraint 1");
+  collection->addConstraint("model", "constraint 1", 1.2345678, CONSTRAINT_BEGIN);
+  collection->addConstraint("model", "constraint 1", 1.2345679, CONSTRAINT_BEGIN);
+  ASSERT_EQ(collection->getConstraintsById().size(), 1);
+  ASSERT_EQ(collection->getConstraintsByModel().at("model").size(), 1);
+}
+
 TEST(APICSTRTest, CollectionAddConstraintsWithDetails) {
   std::shared_ptr<ConstraintsCollection> collection;
   collection = ConstraintsCollectionFactory::newInstance("test");
@@ -22,22 +22,17 @@
 
 #include "DYNCommon.h"
 #include "DYNMacrosMessage.h"
+#include "DYNXmlStreamWriter.h"
 #include "FSVFinalStateValue.h"
 #include "FSVFinalStateValuesCollection.h"
 
 #include <fstream>
 #include <sstream>
-#include <xml/sax/formatter/AttributeList.h>
-#include <xml/sax/formatter/Formatter.h>
 
 using std::fstream;
 using std::ostream;
 using std::string;
 
-using xml::sax::formatter::AttributeList;
-using xml::sax::formatter::Formatter;
-using xml::sax::formatter::FormatterPtr;
-
 namespace finalStateValues {
 
 void
@@ -54,22 +49,20 @@ XmlExporter::exportToFile(const boost::shared_ptr<FinalStateValuesCollection>& f
 
 void
 XmlExporter::exportToStream(const boost::shared_ptr<FinalStateValuesCollection>& finalStateValues, ostream& stream) const {
-  FormatterPtr formatter = Formatter::createFormatter(stream, "http://www.rte-france.com/dynawo");
+  DYN::XmlStreamWriter writer(stream, "http://www.rte-france.com/dynawo");
 
-  formatter->startDocument();
-  AttributeList attrs;
-  formatter->startElement("finalStateValuesOutput", attrs);
+  writer.startDocument();
+  writer.startElement("finalStateValuesOutput");
 
   for (const auto& finalStateValue : finalStateValues->getFinalStateValues()) {
-    attrs.clear();
-    attrs.add("model", finalStateValue->getModelName());
-    attrs.add("variable", finalStateValue->getVariable());
-    attrs.add("value", DYN::double2String(finalStateValue->getValue()));
-    formatter->startElement("finalStateValue", attrs);
-    formatter->endElement();  // finalStateValue
+    writer.startElement("finalStateValue");
+    writer.addAttribute("model", finalStateValue->getModelName());
+    writer.addAttribute("variable", finalStateValue->getVariable());
+    writer.addAttribute("value", finalStateValue->getValue(), DYN::XmlStreamWriter::DOUBLE_PRECISION);
+    writer.endElement();  // finalStateValue
   }
-  formatter->endElement();  // finalStateValuesOutput
-  formatter->endDocument();
+  writer.endElement();  // finalStateValuesOutput
+  writer.endDocument();
 }
 
 }  // namespace finalStateValues
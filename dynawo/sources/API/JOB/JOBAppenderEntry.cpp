@@ -21,7 +21,8 @@
 
 namespace job {
 
-AppenderEntry::AppenderEntry() : tag_(""), filePath_(""), lvlFilter_(""), showLevelTag_(true), separator_(" | "), timeStampFormat_("%Y-%m-%d %H:%M:%S") {}
+AppenderEntry::AppenderEntry() : tag_(""), filePath_(""), lvlFilter_(""), showLevelTag_(true), separator_(" | "), timeStampFormat_("%Y-%m-%d %H:%M:%S"),
+  asynchronous_(false) {}
 
 const std::string&
 AppenderEntry::getTag() const {
@@ -53,6 +54,11 @@ AppenderEntry::getTimeStampFormat() const {
   return timeStampFormat_;
 }
 
+bool
+AppenderEntry::isAsynchronous() const {
+  return asynchronous_;
+}
+
 void
 AppenderEntry::setTag(const std::string& tag) {
   tag_ = tag;
@@ -83,4 +89,9 @@ AppenderEntry::setTimeStampFormat(const std::string& format) {
   timeStampFormat_ = format;
 }
 
+void
+AppenderEntry::setAsynchronous(const bool asynchronous) {
+  asynchronous_ = asynchronous;
+}
+
 }  // namespace job
@@ -71,6 +71,12 @@ class AppenderEntry {
    */
   const std::string& getTimeStampFormat() const;
 
+  /**
+   * @brief asynchronous attribute getter
+   * @return @b true if the log is written to the file by a dedicated thread
+   */
+  bool isAsynchronous() const;
+
   /**
    * @brief Tag attribute setter
    * @param tag Tag filtered by the appender
@@ -107,6 +113,12 @@ class AppenderEntry {
    */
   void setTimeStampFormat(const std::string& format);
 
+  /**
+   * @brief indicates if the log should be written to the file by a dedicated thread
+   * @param asynchronous @b true if the log should be written to the file by a dedicated thread
+   */
+  void setAsynchronous(const bool asynchronous);
+
  private:
   std::string tag_;              ///< Tag filtered by the appender
   std::string filePath_;         ///< Output file path of the appender
@@ -114,6 +126,7 @@ class AppenderEntry {
   bool showLevelTag_;            ///< @b true if the tag of the log should be printed
   std::string separator_;        ///< separator used between each log information
   std::string timeStampFormat_;  ///< format of the timestamp information , "" if no time to print
+  bool asynchronous_;            ///< @b true if the log is written to the file by a dedicated thread
 };
 
 }  // namespace job
@@ -35,6 +35,21 @@ ClockEntry::getTriggerChannel() const {
   return triggerChannel_;
 }
 
+double
+ClockEntry::getSpinGuard() const {
+  return spinGuard_;
+}
+
+int
+ClockEntry::getCpuAffinity() const {
+  return cpuAffinity_;
+}
+
+int
+ClockEntry::getRealTimePriority() const {
+  return realTimePriority_;
+}
+
 void
 ClockEntry::setType(const std::string& type) {
   type_ = type;
@@ -50,4 +65,19 @@ ClockEntry::setTriggerChannel(const std::string& triggerChannel) {
   triggerChannel_ = triggerChannel;
 }
 
+void
+ClockEntry::setSpinGuard(const double spinGuard) {
+  spinGuard_ = spinGuard;
+}
+
+void
+ClockEntry::setCpuAffinity(const int cpuAffinity) {
+  cpuAffinity_ = cpuAffinity;
+}
+
+void
+ClockEntry::setRealTimePriority(const int realTimePriority) {
+  realTimePriority_ = realTimePriority;
+}
+
 }  // namespace job
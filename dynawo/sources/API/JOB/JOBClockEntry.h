@@ -48,6 +48,24 @@ class ClockEntry {
    */
   const std::string& getTriggerChannel() const;
 
+  /**
+   * @brief Spin guard attribute getter
+   * @return time before the wait target from which the clock spins instead of sleeping, in microseconds
+   */
+  double getSpinGuard() const;
+
+  /**
+   * @brief Cpu affinity attribute getter
+   * @return cpu the simulation thread is pinned to, -1 if it is not pinned
+   */
+  int getCpuAffinity() const;
+
+  /**
+   * @brief Real-time priority attribute getter
+   * @return real-time scheduling priority of the simulation thread, 0 for the default scheduling
+   */
+  int getRealTimePriority() const;
+
   /**
    * @brief Type attribute setter
    * @param type Clock type ("INTERNAL" or "EXTERNAL")
@@ -66,10 +84,31 @@ class ClockEntry {
    */
   void setTriggerChannel(const std::string& triggerChannel);
 
+  /**
+   * @brief Spin guard attribute setter
+   * @param spinGuard time before the wait target from which the clock spins instead of sleeping, in microseconds
+   */
+  void setSpinGuard(double spinGuard);
+
+  /**
+   * @brief Cpu affinity attribute setter
+   * @param cpuAffinity cpu the simulation thread is pinned to, -1 if it is not pinned
+   */
+  void setCpuAffinity(int cpuAffinity);
+
+  /**
+   * @brief Real-time priority attribute setter
+   * @param realTimePriority real-time scheduling priority of the simulation thread, 0 for the default scheduling
+   */
+  void setRealTimePriority(int realTimePriority);
+
  private:
   std::string type_;                 ///< Clock type (INTERNAL or EXTERNAL)
   boost::optional<double> speedup_;  ///< Speed-up factor (optional)
   std::string triggerChannel_;       ///< Trigger channel (optional)
+  double spinGuard_ = 0.;            ///< Spin guard before the wait target in microseconds, 0 to only sleep
+  int cpuAffinity_ = -1;             ///< Cpu of the simulation thread, -1 if not pinned
+  int realTimePriority_ = 0;         ///< Real-time scheduling priority of the simulation thread, 0 if not real-time
 };
 
 }  // namespace job
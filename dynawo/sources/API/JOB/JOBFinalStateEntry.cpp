@@ -21,7 +21,7 @@
 
 namespace job {
 
-FinalStateEntry::FinalStateEntry() : exportIIDMFile_(false), exportDumpFile_(false), outputIIDMFile_(""), dumpFile_("") {}
+FinalStateEntry::FinalStateEntry() : exportIIDMFile_(false), exportDumpFile_(false), outputIIDMFile_(""), dumpFile_(""), dumpFormat_("ZIP") {}
 
 bool
 FinalStateEntry::getExportIIDMFile() const {
@@ -63,4 +63,14 @@ FinalStateEntry::setDumpFile(const std::string& dumpFile) {
   dumpFile_ = dumpFile;
 }
 
+const std::string&
+FinalStateEntry::getDumpFormat() const {
+  return dumpFormat_;
+}
+
+void
+FinalStateEntry::setDumpFormat(const std::string& dumpFormat) {
+  dumpFormat_ = dumpFormat;
+}
+
 }  // namespace job
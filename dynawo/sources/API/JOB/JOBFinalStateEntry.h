@@ -84,6 +84,18 @@ class FinalStateEntry {
    */
   void setDumpFile(const std::string& dumpFile);
 
+  /**
+   * @brief Dump format attribute getter
+   * @return format of the dump file, ZIP (default), RAW or DELTA
+   */
+  const std::string& getDumpFormat() const;
+
+  /**
+   * @brief Dump format attribute setter
+   * @param dumpFormat format of the dump file, ZIP, RAW, DELTA or COMPRESSED
+   */
+  void setDumpFormat(const std::string& dumpFormat);
+
   /**
    * @brief Get the Timestamp
    *
@@ -108,6 +120,7 @@ class FinalStateEntry {
   boost::optional<double> timestamp_;  ///< Timestamp of entry, if present
   std::string outputIIDMFile_;         ///< Output IIDM file for final state
   std::string dumpFile_;               ///< Dump file for final state
+  std::string dumpFormat_;             ///< Format of the dump file
 };
 
 }  // namespace job
@@ -22,7 +22,11 @@
 
 namespace job {
 
-InteractiveSettingsEntry::InteractiveSettingsEntry(): couplingTimeStep_(0.) { }
+InteractiveSettingsEntry::InteractiveSettingsEntry():
+couplingTimeStep_(0.),
+degradeAfterOverruns_(0),
+outputQueueSize_(64),
+outputQueuePolicy_("BLOCK") { }
 
 InteractiveSettingsEntry::InteractiveSettingsEntry(const InteractiveSettingsEntry& other) {
   copy(other);
@@ -37,6 +41,9 @@ InteractiveSettingsEntry::operator=(const InteractiveSettingsEntry& other) {
 void
 InteractiveSettingsEntry::copy(const InteractiveSettingsEntry& other) {
   couplingTimeStep_ = other.couplingTimeStep_;
+  degradeAfterOverruns_ = other.degradeAfterOverruns_;
+  outputQueueSize_ = other.outputQueueSize_;
+  outputQueuePolicy_ = other.outputQueuePolicy_;
 
   channels_ = DYN::clone(other.channels_);
   clock_ = DYN::clone(other.clock_);
@@ -82,4 +89,34 @@ double
 InteractiveSettingsEntry::getCouplingTimeStep() const {
   return couplingTimeStep_;
 }
+
+void
+InteractiveSettingsEntry::setDegradeAfterOverruns(const unsigned int degradeAfterOverruns) {
+  degradeAfterOverruns_ = degradeAfterOverruns;
+}
+
+unsigned int
+InteractiveSettingsEntry::getDegradeAfterOverruns() const {
+  return degradeAfterOverruns_;
+}
+
+void
+InteractiveSettingsEntry::setOutputQueueSize(const unsigned int outputQueueSize) {
+  outputQueueSize_ = outputQueueSize;
+}
+
+unsigned int
+InteractiveSettingsEntry::getOutputQueueSize() const {
+  return outputQueueSize_;
+}
+
+void
+InteractiveSettingsEntry::setOutputQueuePolicy(const std::string& outputQueuePolicy) {
+  outputQueuePolicy_ = outputQueuePolicy;
+}
+
+const std::string&
+InteractiveSettingsEntry::getOutputQueuePolicy() const {
+  return outputQueuePolicy_;
+}
 }  // namespace job
@@ -15,6 +15,7 @@
 #define API_JOB_JOBINTERACTIVESETTINGSENTRY_H_
 
 #include <memory>
+#include <string>
 #include <vector>
 #include "JOBClockEntry.h"
 #include "JOBChannelsEntry.h"
@@ -98,6 +99,42 @@ class InteractiveSettingsEntry {
    */
   void setCouplingTimeStep(const double couplingTimeStep);
 
+  /**
+   * @brief degradeAfterOverruns attribute getter
+   * @return number of consecutive deadline overruns after which the solver switches to cheaper settings, 0 if it never does
+   */
+  unsigned int getDegradeAfterOverruns() const;
+
+  /**
+   * @brief degradeAfterOverruns setter
+   * @param degradeAfterOverruns : number of consecutive deadline overruns after which the solver switches to cheaper settings, 0 if it never does
+   */
+  void setDegradeAfterOverruns(unsigned int degradeAfterOverruns);
+
+  /**
+   * @brief outputQueueSize attribute getter
+   * @return maximum number of publication frames waiting for the output writer thread
+   */
+  unsigned int getOutputQueueSize() const;
+
+  /**
+   * @brief outputQueueSize setter
+   * @param outputQueueSize : maximum number of publication frames waiting for the output writer thread
+   */
+  void setOutputQueueSize(unsigned int outputQueueSize);
+
+  /**
+   * @brief outputQueuePolicy attribute getter
+   * @return behaviour when the output queue is full: BLOCK or DROP_OLDEST
+   */
+  const std::string& getOutputQueuePolicy() const;
+
+  /**
+   * @brief outputQueuePolicy setter
+   * @param outputQueuePolicy : behaviour when the output queue is full: BLOCK or DROP_OLDEST
+   */
+  void setOutputQueuePolicy(const std::string& outputQueuePolicy);
+
  private:
   /**
    * @brief Copy
@@ -110,6 +147,9 @@ class InteractiveSettingsEntry {
   std::shared_ptr<ChannelsEntry> channels_;   ///< Channels entry container
   std::shared_ptr<StreamsEntry> streams_;     ///< Streams entry container
   double couplingTimeStep_;                   ///< Time step in s between two I/O phases with external systems in interactive mode
+  unsigned int degradeAfterOverruns_;         ///< Number of consecutive deadline overruns before switching to cheaper solver settings, 0 to disable
+  unsigned int outputQueueSize_;              ///< Maximum number of publication frames waiting for the output writer thread
+  std::string outputQueuePolicy_;             ///< Behaviour when the output queue is full: BLOCK or DROP_OLDEST
 };
 
 }  // namespace job
@@ -21,6 +21,8 @@
 
 namespace job {
 
+NetworkEntry::NetworkEntry() : eliminateStarBuses_(false), initialPowerFlow_(false), studyAreaDepth_(0) {}
+
 void
 NetworkEntry::setIidmFile(const std::string& iidmFile) {
   iidmFile_ = iidmFile;
@@ -51,4 +53,64 @@ NetworkEntry::getNetworkParId() const {
   return networkParId_;
 }
 
+void
+NetworkEntry::setReducedVoltageLevels(const std::vector<std::string>& reducedVoltageLevels) {
+  reducedVoltageLevels_ = reducedVoltageLevels;
+}
+
+const std::vector<std::string>&
+NetworkEntry::getReducedVoltageLevels() const {
+  return reducedVoltageLevels_;
+}
+
+void
+NetworkEntry::setCollapsedVoltageLevels(const std::vector<std::string>& collapsedVoltageLevels) {
+  collapsedVoltageLevels_ = collapsedVoltageLevels;
+}
+
+const std::vector<std::string>&
+NetworkEntry::getCollapsedVoltageLevels() const {
+  return collapsedVoltageLevels_;
+}
+
+void
+NetworkEntry::setEliminateStarBuses(const bool eliminateStarBuses) {
+  eliminateStarBuses_ = eliminateStarBuses;
+}
+
+bool
+NetworkEntry::getEliminateStarBuses() const {
+  return eliminateStarBuses_;
+}
+
+void
+NetworkEntry::setInitialPowerFlow(const bool initialPowerFlow) {
+  initialPowerFlow_ = initialPowerFlow;
+}
+
+bool
+NetworkEntry::getInitialPowerFlow() const {
+  return initialPowerFlow_;
+}
+
+void
+NetworkEntry::setStudyVoltageLevels(const std::vector<std::string>& studyVoltageLevels) {
+  studyVoltageLevels_ = studyVoltageLevels;
+}
+
+const std::vector<std::string>&
+NetworkEntry::getStudyVoltageLevels() const {
+  return studyVoltageLevels_;
+}
+
+void
+NetworkEntry::setStudyAreaDepth(const int studyAreaDepth) {
+  studyAreaDepth_ = studyAreaDepth;
+}
+
+int
+NetworkEntry::getStudyAreaDepth() const {
+  return studyAreaDepth_;
+}
+
 }  // namespace job
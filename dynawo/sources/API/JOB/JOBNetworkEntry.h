@@ -21,6 +21,7 @@
 #define API_JOB_JOBNETWORKENTRY_H_
 
 #include <string>
+#include <vector>
 
 namespace job {
 
@@ -30,6 +31,11 @@ namespace job {
  */
 class NetworkEntry {
  public:
+  /**
+   * @brief constructor
+   */
+  NetworkEntry();
+
   /**
    * @brief IIDM file setter
    * @param iidmFile : IIDM file for the job
@@ -66,10 +72,88 @@ class NetworkEntry {
    */
   const std::string& getNetworkParId() const;
 
+  /**
+   * @brief reduced voltage levels setter
+   * @param reducedVoltageLevels : id of the voltage levels whose passive part is replaced by an equivalent
+   */
+  void setReducedVoltageLevels(const std::vector<std::string>& reducedVoltageLevels);
+
+  /**
+   * @brief reduced voltage levels getter
+   * @return id of the voltage levels whose passive part is replaced by an equivalent
+   */
+  const std::vector<std::string>& getReducedVoltageLevels() const;
+
+  /**
+   * @brief collapsed voltage levels setter
+   * @param collapsedVoltageLevels : id of the voltage levels whose closed switches are removed, the buses they join being merged
+   */
+  void setCollapsedVoltageLevels(const std::vector<std::string>& collapsedVoltageLevels);
+
+  /**
+   * @brief collapsed voltage levels getter
+   * @return id of the voltage levels whose closed switches are removed, the buses they join being merged
+   */
+  const std::vector<std::string>& getCollapsedVoltageLevels() const;
+
+  /**
+   * @brief star buses elimination setter
+   * @param eliminateStarBuses : whether each static three windings transformer is replaced by an equivalent between its three buses
+   */
+  void setEliminateStarBuses(bool eliminateStarBuses);
+
+  /**
+   * @brief star buses elimination getter
+   * @return whether each static three windings transformer is replaced by an equivalent between its three buses
+   */
+  bool getEliminateStarBuses() const;
+
+  /**
+   * @brief initial power flow setter
+   * @param initialPowerFlow : whether the bus voltages are computed by a power flow on the static network before the initialization
+   */
+  void setInitialPowerFlow(bool initialPowerFlow);
+
+  /**
+   * @brief initial power flow getter
+   * @return whether the bus voltages are computed by a power flow on the static network before the initialization
+   */
+  bool getInitialPowerFlow() const;
+
+  /**
+   * @brief study voltage levels setter
+   * @param studyVoltageLevels : id of the voltage levels around which the network model is built, empty for the whole network
+   */
+  void setStudyVoltageLevels(const std::vector<std::string>& studyVoltageLevels);
+
+  /**
+   * @brief study voltage levels getter
+   * @return id of the voltage levels around which the network model is built, empty for the whole network
+   */
+  const std::vector<std::string>& getStudyVoltageLevels() const;
+
+  /**
+   * @brief study area depth setter
+   * @param studyAreaDepth : number of branches between the study voltage levels and the farthest voltage levels modelled
+   */
+  void setStudyAreaDepth(int studyAreaDepth);
+
+  /**
+   * @brief study area depth getter
+   * @return number of branches between the study voltage levels and the farthest voltage levels modelled
+   */
+  int getStudyAreaDepth() const;
+
  private:
   std::string iidmFile_;        ///< IIDM file for the simulation
   std::string networkParFile_;  ///< Parameters file for the network model
   std::string networkParId_;    ///< Number of the parameters set in parameters file
+  std::vector<std::string> reducedVoltageLevels_;  ///< voltage levels whose passive part is replaced by an equivalent
+  std::vector<std::string> collapsedVoltageLevels_;  ///< voltage levels whose closed switches are removed, the buses they join being merged
+  bool eliminateStarBuses_;  ///< whether the star buses of the static three windings transformers are eliminated
+  bool initialPowerFlow_;  ///< whether the bus voltages are computed by a power flow before the initialization
+  std::vector<std::string> studyVoltageLevels_;  ///< voltage levels around which the network model is built, empty for the whole network
+  int studyAreaDepth_;  ///< number of branches between the study voltage levels and the farthest voltage levels modelled
 };
 
 }  // namespace job
@@ -44,6 +44,7 @@ OutputsEntry::copy(const OutputsEntry& other) {
   timetableEntry_ = DYN::clone(other.timetableEntry_);
   curvesEntry_ = DYN::clone(other.curvesEntry_);
   lostEquipmentsEntry_ = DYN::clone(other.lostEquipmentsEntry_);
+  solverStatisticsEntry_ = DYN::clone(other.solverStatisticsEntry_);
   logsEntry_ = DYN::clone(other.logsEntry_);
   finalStateValuesEntry_ = DYN::clone(other.finalStateValuesEntry_);
 
@@ -147,6 +148,16 @@ OutputsEntry::getLostEquipmentsEntry() const {
   return lostEquipmentsEntry_;
 }
 
+void
+OutputsEntry::setSolverStatisticsEntry(const std::shared_ptr<SolverStatisticsEntry>& solverStatisticsEntry) {
+  solverStatisticsEntry_ = solverStatisticsEntry;
+}
+
+std::shared_ptr<SolverStatisticsEntry>
+OutputsEntry::getSolverStatisticsEntry() const {
+  return solverStatisticsEntry_;
+}
+
 void
 OutputsEntry::setLogsEntry(const std::shared_ptr<LogsEntry>& logsEntry) {
   logsEntry_ = logsEntry;
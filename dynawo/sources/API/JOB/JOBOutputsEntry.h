@@ -28,6 +28,7 @@
 #include "JOBInitValuesEntry.h"
 #include "JOBLogsEntry.h"
 #include "JOBLostEquipmentsEntry.h"
+#include "JOBSolverStatisticsEntry.h"
 #include "JOBTimelineEntry.h"
 #include "JOBTimetableEntry.h"
 
@@ -182,6 +183,18 @@ class OutputsEntry {
    */
   std::shared_ptr<LostEquipmentsEntry> getLostEquipmentsEntry() const;
 
+  /**
+   * @brief solverStatistics entry setter
+   * @param solverStatisticsEntry : solverStatistics for the job
+   */
+  void setSolverStatisticsEntry(const std::shared_ptr<SolverStatisticsEntry>& solverStatisticsEntry);
+
+  /**
+   * @brief solverStatistics entry getter
+   * @return the solverStatistics entry container
+   */
+  std::shared_ptr<SolverStatisticsEntry> getSolverStatisticsEntry() const;
+
   /**
    * @brief Logs entry container setter
    * @param logsEntry : logs entries container for the job
@@ -212,6 +225,7 @@ class OutputsEntry {
   std::shared_ptr<CurvesEntry> curvesEntry_;                          ///< Curves entries container
   std::shared_ptr<FinalStateValuesEntry> finalStateValuesEntry_;      ///< Final State values entries container
   std::shared_ptr<LostEquipmentsEntry> lostEquipmentsEntry_;          ///< Lost equipments entries container
+  std::shared_ptr<SolverStatisticsEntry> solverStatisticsEntry_;      ///< Solver statistics entries container
   std::shared_ptr<LogsEntry> logsEntry_;                              ///< Logs entries containe
 };
 
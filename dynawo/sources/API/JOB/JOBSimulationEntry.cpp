@@ -23,7 +23,10 @@
 
 namespace job {
 
-SimulationEntry::SimulationEntry() : startTime_(0), stopTime_(0), criteriaStep_(10), precision_(1e-6), timeout_(std::numeric_limits<double>::max()), enableRealTimeTracking_(false) {}
+SimulationEntry::SimulationEntry() : startTime_(0), stopTime_(0), criteriaStep_(10), criteriaMaxLag_(0), coherenceCheckStep_(1), precision_(1e-6), timeout_(std::numeric_limits<double>::max()),
+enableRealTimeTracking_(false), steadyStateThreshold_(0.), steadyStateDuration_(0.), profilingSamplingPeriod_(0),
+exportProfilingTrace_(false), profilingHardwareCounters_(false), subModelCostAccounting_(false), latencyPartition_(false),
+pararealSlices_(0), pararealMaxIterations_(10), pararealTolerance_(1e-6), memoryAccounting_(false), memoryReportInterval_(0.), hugePages_(false) {}
 
 void
 SimulationEntry::setStartTime(double startTime) {
@@ -71,6 +74,26 @@ SimulationEntry::getCriteriaStep() const {
   return criteriaStep_;
 }
 
+void
+SimulationEntry::setCriteriaMaxLag(int criteriaMaxLag) {
+  criteriaMaxLag_ = criteriaMaxLag;
+}
+
+int
+SimulationEntry::getCriteriaMaxLag() const {
+  return criteriaMaxLag_;
+}
+
+void
+SimulationEntry::setCoherenceCheckStep(int coherenceCheckStep) {
+  coherenceCheckStep_ = coherenceCheckStep;
+}
+
+int
+SimulationEntry::getCoherenceCheckStep() const {
+  return coherenceCheckStep_;
+}
+
 void
 SimulationEntry::setPrecision(double precision) {
   precision_ = precision;
@@ -91,4 +114,134 @@ SimulationEntry::setEnableRealTimeTracking(bool enable) {
   enableRealTimeTracking_ = enable;
 }
 
+void
+SimulationEntry::setSteadyStateThreshold(double steadyStateThreshold) {
+  steadyStateThreshold_ = steadyStateThreshold;
+}
+
+double
+SimulationEntry::getSteadyStateThreshold() const {
+  return steadyStateThreshold_;
+}
+
+void
+SimulationEntry::setSteadyStateDuration(double steadyStateDuration) {
+  steadyStateDuration_ = steadyStateDuration;
+}
+
+double
+SimulationEntry::getSteadyStateDuration() const {
+  return steadyStateDuration_;
+}
+
+void
+SimulationEntry::setProfilingSamplingPeriod(const unsigned int profilingSamplingPeriod) {
+  profilingSamplingPeriod_ = profilingSamplingPeriod;
+}
+
+unsigned int
+SimulationEntry::getProfilingSamplingPeriod() const {
+  return profilingSamplingPeriod_;
+}
+
+void
+SimulationEntry::setExportProfilingTrace(const bool exportProfilingTrace) {
+  exportProfilingTrace_ = exportProfilingTrace;
+}
+
+bool
+SimulationEntry::getExportProfilingTrace() const {
+  return exportProfilingTrace_;
+}
+
+void
+SimulationEntry::setProfilingHardwareCounters(const bool profilingHardwareCounters) {
+  profilingHardwareCounters_ = profilingHardwareCounters;
+}
+
+bool
+SimulationEntry::getProfilingHardwareCounters() const {
+  return profilingHardwareCounters_;
+}
+
+void
+SimulationEntry::setSubModelCostAccounting(const bool subModelCostAccounting) {
+  subModelCostAccounting_ = subModelCostAccounting;
+}
+
+bool
+SimulationEntry::getSubModelCostAccounting() const {
+  return subModelCostAccounting_;
+}
+
+void
+SimulationEntry::setLatencyPartition(const bool latencyPartition) {
+  latencyPartition_ = latencyPartition;
+}
+
+bool
+SimulationEntry::getLatencyPartition() const {
+  return latencyPartition_;
+}
+
+void
+SimulationEntry::setPararealSlices(const unsigned int pararealSlices) {
+  pararealSlices_ = pararealSlices;
+}
+
+unsigned int
+SimulationEntry::getPararealSlices() const {
+  return pararealSlices_;
+}
+
+void
+SimulationEntry::setPararealMaxIterations(const unsigned int pararealMaxIterations) {
+  pararealMaxIterations_ = pararealMaxIterations;
+}
+
+unsigned int
+SimulationEntry::getPararealMaxIterations() const {
+  return pararealMaxIterations_;
+}
+
+void
+SimulationEntry::setPararealTolerance(const double pararealTolerance) {
+  pararealTolerance_ = pararealTolerance;
+}
+
+double
+SimulationEntry::getPararealTolerance() const {
+  return pararealTolerance_;
+}
+
+void
+SimulationEntry::setMemoryAccounting(const bool memoryAccounting) {
+  memoryAccounting_ = memoryAccounting;
+}
+
+bool
+SimulationEntry::getMemoryAccounting() const {
+  return memoryAccounting_;
+}
+
+void
+SimulationEntry::setMemoryReportInterval(const double memoryReportInterval) {
+  memoryReportInterval_ = memoryReportInterval;
+}
+
+double
+SimulationEntry::getMemoryReportInterval() const {
+  return memoryReportInterval_;
+}
+
+void
+SimulationEntry::setHugePages(const bool hugePages) {
+  hugePages_ = hugePages;
+}
+
+bool
+SimulationEntry::getHugePages() const {
+  return hugePages_;
+}
+
 }  // namespace job
@@ -90,6 +90,30 @@ class SimulationEntry {
    */
   int getCriteriaStep() const;
 
+  /**
+   * @brief criteria maximum lag setter
+   * @param criteriaMaxLag : maximum number of iterations the simulation can run ahead of a criteria check, 0 to check them synchronously
+   */
+  void setCriteriaMaxLag(int criteriaMaxLag);
+
+  /**
+   * @brief criteria maximum lag getter
+   * @return maximum number of iterations the simulation can run ahead of a criteria check, 0 if they are checked synchronously
+   */
+  int getCriteriaMaxLag() const;
+
+  /**
+   * @brief coherence check step setter
+   * @param coherenceCheckStep : number of iterations between 2 data coherence checks, 0 to check only after the mode changes
+   */
+  void setCoherenceCheckStep(int coherenceCheckStep);
+
+  /**
+   * @brief coherence check step getter
+   * @return number of iterations between 2 data coherence checks, 0 if checked only after the mode changes
+   */
+  int getCoherenceCheckStep() const;
+
   /**
    * @brief precision setter
    * @param precision : double precision for the job
@@ -130,14 +154,185 @@ class SimulationEntry {
    */
   void setEnableRealTimeTracking(bool enable);
 
+  /**
+   * @brief steady state threshold setter
+   * @param steadyStateThreshold : weighted norm of the variations of the variables below which the system is steady, 0 to disable the early termination
+   */
+  void setSteadyStateThreshold(double steadyStateThreshold);
+
+  /**
+   * @brief steady state threshold getter
+   * @return weighted norm of the variations of the variables below which the system is steady
+   */
+  double getSteadyStateThreshold() const;
+
+  /**
+   * @brief steady state duration setter
+   * @param steadyStateDuration : duration during which the system has to stay steady before the simulation is stopped
+   */
+  void setSteadyStateDuration(double steadyStateDuration);
+
+  /**
+   * @brief steady state duration getter
+   * @return duration during which the system has to stay steady before the simulation is stopped
+   */
+  double getSteadyStateDuration() const;
+
+  /**
+   * @brief profiling sampling period setter
+   * @param profilingSamplingPeriod : 0 to disable the profiler, n to profile one out of n time steps
+   */
+  void setProfilingSamplingPeriod(unsigned int profilingSamplingPeriod);
+
+  /**
+   * @brief profiling sampling period getter
+   * @return 0 if the profiler is disabled, n if one out of n time steps is profiled
+   */
+  unsigned int getProfilingSamplingPeriod() const;
+
+  /**
+   * @brief profiling trace export setter
+   * @param exportProfilingTrace : whether the profiled scopes are exported in a trace
+   */
+  void setExportProfilingTrace(bool exportProfilingTrace);
+
+  /**
+   * @brief profiling trace export getter
+   * @return whether the profiled scopes are exported in a trace
+   */
+  bool getExportProfilingTrace() const;
+
+  /**
+   * @brief profiling hardware counters setter
+   * @param profilingHardwareCounters : whether the hardware performance counters are read around the profiled scopes
+   */
+  void setProfilingHardwareCounters(bool profilingHardwareCounters);
+
+  /**
+   * @brief profiling hardware counters getter
+   * @return whether the hardware performance counters are read around the profiled scopes
+   */
+  bool getProfilingHardwareCounters() const;
+
+  /**
+   * @brief sub model cost accounting setter
+   * @param subModelCostAccounting : whether the evaluation costs of the sub models are accounted
+   */
+  void setSubModelCostAccounting(bool subModelCostAccounting);
+
+  /**
+   * @brief sub model cost accounting getter
+   * @return whether the evaluation costs of the sub models are accounted
+   */
+  bool getSubModelCostAccounting() const;
+
+  /**
+   * @brief latency partition setter
+   * @param latencyPartition : whether the sub models are partitioned into fast and slow groups from their activity
+   */
+  void setLatencyPartition(bool latencyPartition);
+
+  /**
+   * @brief latency partition getter
+   * @return whether the sub models are partitioned into fast and slow groups from their activity
+   */
+  bool getLatencyPartition() const;
+
+  /**
+   * @brief parareal slices setter
+   * @param pararealSlices : number of time slices of the parareal algorithm, 0 to simulate sequentially
+   */
+  void setPararealSlices(unsigned int pararealSlices);
+
+  /**
+   * @brief parareal slices getter
+   * @return number of time slices of the parareal algorithm, 0 if the simulation is sequential
+   */
+  unsigned int getPararealSlices() const;
+
+  /**
+   * @brief parareal maximum iterations setter
+   * @param pararealMaxIterations : maximum number of iterations of the parareal algorithm
+   */
+  void setPararealMaxIterations(unsigned int pararealMaxIterations);
+
+  /**
+   * @brief parareal maximum iterations getter
+   * @return maximum number of iterations of the parareal algorithm
+   */
+  unsigned int getPararealMaxIterations() const;
+
+  /**
+   * @brief parareal tolerance setter
+   * @param pararealTolerance : largest relative correction of the continuous variables for the parareal iterations to stop
+   */
+  void setPararealTolerance(double pararealTolerance);
+
+  /**
+   * @brief parareal tolerance getter
+   * @return largest relative correction of the continuous variables for the parareal iterations to stop
+   */
+  double getPararealTolerance() const;
+
+  /**
+   * @brief memory accounting setter
+   * @param memoryAccounting : whether the memory allocated by the main structures is reported
+   */
+  void setMemoryAccounting(bool memoryAccounting);
+
+  /**
+   * @brief memory accounting getter
+   * @return whether the memory allocated by the main structures is reported
+   */
+  bool getMemoryAccounting() const;
+
+  /**
+   * @brief memory report interval setter
+   * @param memoryReportInterval : simulated time between two intermediate memory reports, 0 to disable them
+   */
+  void setMemoryReportInterval(double memoryReportInterval);
+
+  /**
+   * @brief memory report interval getter
+   * @return simulated time between two intermediate memory reports, 0 if disabled
+   */
+  double getMemoryReportInterval() const;
+
+  /**
+   * @brief huge pages setter
+   * @param hugePages : whether the large arrays of the model and of the solver are backed with huge pages
+   */
+  void setHugePages(bool hugePages);
+
+  /**
+   * @brief huge pages getter
+   * @return whether the large arrays of the model and of the solver are backed with huge pages
+   */
+  bool getHugePages() const;
+
  private:
   double startTime_;                        ///< Start time of the simulation
   double stopTime_;                         ///< Stop time of the simulation
   std::vector<std::string> criteriaFiles_;  ///< List of criteria files path
   int criteriaStep_;                        ///< criteria verification time step
+  int criteriaMaxLag_;                      ///< maximum number of iterations between a criteria check and its result, 0 if synchronous
+  int coherenceCheckStep_;                  ///< number of iterations between 2 data coherence checks, 0 if only after the mode changes
   double precision_;                        ///< precision of the simulation
   double timeout_;                          ///< simulation timeout
   bool enableRealTimeTracking_;             ///< enable real time tracking for timestep timing
+  double steadyStateThreshold_;             ///< threshold of the steady state early termination, 0 if disabled
+  double steadyStateDuration_;              ///< duration of the steady state before the early termination
+  unsigned int profilingSamplingPeriod_;    ///< sampling period of the profiler, 0 if disabled
+  bool exportProfilingTrace_;               ///< whether the profiled scopes are exported in a trace
+  bool profilingHardwareCounters_;          ///< whether the hardware performance counters are read around the profiled scopes
+  bool subModelCostAccounting_;             ///< whether the evaluation costs of the sub models are accounted
+  bool latencyPartition_;                   ///< whether the sub models are partitioned into fast and slow groups from their activity
+  unsigned int pararealSlices_;             ///< number of time slices of the parareal algorithm, 0 if the simulation is sequential
+  unsigned int pararealMaxIterations_;      ///< maximum number of iterations of the parareal algorithm
+  double pararealTolerance_;                ///< largest relative correction of the continuous variables for the parareal iterations to stop
+  bool memoryAccounting_;                   ///< whether the memory allocated by the main structures is reported
+  double memoryReportInterval_;             ///< simulated time between two intermediate memory reports, 0 if disabled
+  bool hugePages_;                          ///< whether the large arrays of the model and of the solver are backed with huge pages
 };
 
 }  // namespace job
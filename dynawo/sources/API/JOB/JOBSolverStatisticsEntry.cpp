@@ -0,0 +1,46 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file JOBSolverStatisticsEntry.cpp
+ * @brief SolverStatistics entry description : implementation file
+ *
+ */
+
+#include "JOBSolverStatisticsEntry.h"
+
+namespace job {
+
+SolverStatisticsEntry::SolverStatisticsEntry() : convergenceDiagnosticsDepth_(0) {}
+
+void
+SolverStatisticsEntry::setExportMode(const std::string& exportMode) {
+  exportMode_ = exportMode;
+}
+
+const std::string&
+SolverStatisticsEntry::getExportMode() const {
+  return exportMode_;
+}
+
+void
+SolverStatisticsEntry::setConvergenceDiagnosticsDepth(const unsigned int convergenceDiagnosticsDepth) {
+  convergenceDiagnosticsDepth_ = convergenceDiagnosticsDepth;
+}
+
+unsigned int
+SolverStatisticsEntry::getConvergenceDiagnosticsDepth() const {
+  return convergenceDiagnosticsDepth_;
+}
+
+}  // namespace job
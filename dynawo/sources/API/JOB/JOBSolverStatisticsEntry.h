@@ -0,0 +1,69 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file JOBSolverStatisticsEntry.h
+ * @brief SolverStatistics entries description : interface file
+ *
+ */
+
+#ifndef API_JOB_JOBSOLVERSTATISTICSENTRY_H_
+#define API_JOB_JOBSOLVERSTATISTICSENTRY_H_
+
+#include <string>
+
+namespace job {
+
+/**
+ * @class SolverStatisticsEntry
+ * @brief SolverStatistics entries container class: export of the statistics of the solver at each time step
+ */
+class SolverStatisticsEntry {
+ public:
+  /**
+   * @brief constructor
+   */
+  SolverStatisticsEntry();
+
+  /**
+   * @brief Export Mode attribute setter
+   * @param exportMode Export mode for the solver statistics
+   */
+  void setExportMode(const std::string& exportMode);
+
+  /**
+   * @brief Export mode attribute getter
+   * @return Export mode for the solver statistics
+   */
+  const std::string& getExportMode() const;
+
+  /**
+   * @brief Convergence diagnostics depth attribute setter
+   * @param convergenceDiagnosticsDepth number of Newton iterations kept in the convergence diagnostics, 0 to disable them
+   */
+  void setConvergenceDiagnosticsDepth(unsigned int convergenceDiagnosticsDepth);
+
+  /**
+   * @brief Convergence diagnostics depth attribute getter
+   * @return number of Newton iterations kept in the convergence diagnostics, 0 if disabled
+   */
+  unsigned int getConvergenceDiagnosticsDepth() const;
+
+ private:
+  std::string exportMode_;  ///< Export mode for the solver statistics output file
+  unsigned int convergenceDiagnosticsDepth_;  ///< number of Newton iterations kept in the convergence diagnostics, 0 if disabled
+};
+
+}  // namespace job
+
+#endif  // API_JOB_JOBSOLVERSTATISTICSENTRY_H_
@@ -50,4 +50,34 @@ StreamEntry::setFormat(const std::string& format) {
   format_ = format;
 }
 
+double
+StreamEntry::getDeadband() const {
+  return deadband_;
+}
+
+void
+StreamEntry::setDeadband(const double deadband) {
+  deadband_ = deadband;
+}
+
+double
+StreamEntry::getMinPeriod() const {
+  return minPeriod_;
+}
+
+void
+StreamEntry::setMinPeriod(const double minPeriod) {
+  minPeriod_ = minPeriod;
+}
+
+unsigned int
+StreamEntry::getKeyframeInterval() const {
+  return keyframeInterval_;
+}
+
+void
+StreamEntry::setKeyframeInterval(const unsigned int keyframeInterval) {
+  keyframeInterval_ = keyframeInterval;
+}
+
 }  // namespace job
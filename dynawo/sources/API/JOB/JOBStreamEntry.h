@@ -66,10 +66,49 @@ class StreamEntry {
    */
   void setFormat(const std::string& format);
 
+  /**
+   * @brief Deadband attribute getter
+   * @return minimum variation of a value since its last publication for it to be published again, 0 to publish every value
+   */
+  double getDeadband() const;
+
+  /**
+   * @brief Deadband attribute setter
+   * @param deadband minimum variation of a value since its last publication for it to be published again
+   */
+  void setDeadband(double deadband);
+
+  /**
+   * @brief Minimum period attribute getter
+   * @return minimum simulation time between two publications, 0 to publish at each coupling time step
+   */
+  double getMinPeriod() const;
+
+  /**
+   * @brief Minimum period attribute setter
+   * @param minPeriod minimum simulation time between two publications
+   */
+  void setMinPeriod(double minPeriod);
+
+  /**
+   * @brief Keyframe interval attribute getter
+   * @return number of publications between two publications of all the values whatever the deadband, 0 for the first one only
+   */
+  unsigned int getKeyframeInterval() const;
+
+  /**
+   * @brief Keyframe interval attribute setter
+   * @param keyframeInterval number of publications between two publications of all the values
+   */
+  void setKeyframeInterval(unsigned int keyframeInterval);
+
  private:
   std::string data_;                         ///< Data identifier (required)
   std::string channel_;                      ///< Channel name (required)
   std::string format_;                       ///< Output stream format (required)
+  double deadband_ = 0.;                     ///< Minimum variation of a value to publish it again
+  double minPeriod_ = 0.;                    ///< Minimum simulation time between two publications
+  unsigned int keyframeInterval_ = 0;        ///< Number of publications between two publications of all the values
 };
 
 }  // namespace job
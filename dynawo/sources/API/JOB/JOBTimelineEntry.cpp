@@ -78,4 +78,24 @@ TimelineEntry::isFilter() const {
   return filter_;
 }
 
+void
+TimelineEntry::setAllowedKeys(const std::vector<std::string>& allowedKeys) {
+  allowedKeys_ = allowedKeys;
+}
+
+const std::vector<std::string>&
+TimelineEntry::getAllowedKeys() const {
+  return allowedKeys_;
+}
+
+void
+TimelineEntry::setDeniedKeys(const std::vector<std::string>& deniedKeys) {
+  deniedKeys_ = deniedKeys;
+}
+
+const std::vector<std::string>&
+TimelineEntry::getDeniedKeys() const {
+  return deniedKeys_;
+}
+
 }  // namespace job
@@ -21,6 +21,7 @@
 #define API_JOB_JOBTIMELINEENTRY_H_
 
 #include <string>
+#include <vector>
 
 #include <boost/optional.hpp>
 
@@ -97,12 +98,38 @@ class TimelineEntry {
    */
   bool isFilter() const;
 
+  /**
+   * @brief allowed keys setter
+   * @param allowedKeys keys of the only events registered in the timeline, all events if empty
+   */
+  void setAllowedKeys(const std::vector<std::string>& allowedKeys);
+
+  /**
+   * @brief allowed keys getter
+   * @return keys of the only events registered in the timeline, all events if empty
+   */
+  const std::vector<std::string>& getAllowedKeys() const;
+
+  /**
+   * @brief denied keys setter
+   * @param deniedKeys keys of the events never registered in the timeline
+   */
+  void setDeniedKeys(const std::vector<std::string>& deniedKeys);
+
+  /**
+   * @brief denied keys getter
+   * @return keys of the events never registered in the timeline
+   */
+  const std::vector<std::string>& getDeniedKeys() const;
+
  private:
   std::string outputFile_;  ///< Export file for timeline
   std::string exportMode_;  ///< Export mode TXT, CSV, XML for timeline output file
   bool exportWithTime_;  ///< boolean indicating whether to export time when exporting timeline
   boost::optional<int> maxPriority_;  ///< maximum priority allowed when exporting timeline
   bool filter_;  ///< boolean indicating whether to filter timeline
+  std::vector<std::string> allowedKeys_;  ///< keys of the only events registered in the timeline, all events if empty
+  std::vector<std::string> deniedKeys_;  ///< keys of the events never registered in the timeline
 };
 
 }  // namespace job
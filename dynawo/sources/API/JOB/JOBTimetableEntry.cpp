@@ -22,7 +22,8 @@
 namespace job {
 
 TimetableEntry::TimetableEntry() :
-step_(1) {
+step_(1),
+exportMode_("FILE") {
 }
 
 void
@@ -35,4 +36,14 @@ TimetableEntry::getStep() const {
   return step_;
 }
 
+const std::string&
+TimetableEntry::getExportMode() const {
+  return exportMode_;
+}
+
+void
+TimetableEntry::setExportMode(const std::string& exportMode) {
+  exportMode_ = exportMode;
+}
+
 }  // namespace job
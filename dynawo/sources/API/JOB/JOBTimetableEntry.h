@@ -20,6 +20,8 @@
 #ifndef API_JOB_JOBTIMETABLEENTRY_H_
 #define API_JOB_JOBTIMETABLEENTRY_H_
 
+#include <string>
+
 namespace job {
 
 /**
@@ -45,8 +47,22 @@ class TimetableEntry {
    */
   void setStep(int step);
 
+  /**
+   * @brief export mode getter
+   * @return export mode of the timetable, FILE or SHARED_MEMORY
+   */
+  const std::string& getExportMode() const;
+
+  /**
+   * @brief export mode setter
+   * @param exportMode export mode of the timetable, FILE to rewrite a file at each dump or SHARED_MEMORY to update a
+   * progress record in a shared memory segment
+   */
+  void setExportMode(const std::string& exportMode);
+
  private:
   int step_;  ///< time to use
+  std::string exportMode_;  ///< export mode of the timetable
 };
 
 }  // namespace job
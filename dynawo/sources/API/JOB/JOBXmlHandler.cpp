@@ -18,6 +18,8 @@
  * JobsHandler is the implementation of Dynawo handler for parsing jobs
  * files.
  */
+#include <sstream>
+
 #include <boost/phoenix/core.hpp>
 #include <boost/phoenix/operator/self.hpp>
 #include <boost/phoenix/bind.hpp>
@@ -66,6 +68,20 @@ static parser::namespace_uri& namespace_uri() {
   return namespace_uri;
 }
 
+/**
+ * @brief split a list attribute into its items
+ * @param list items separated by white spaces
+ * @return items of the list
+ */
+static vector<string> splitList(const string& list) {
+  std::istringstream stream(list);
+  vector<string> items;
+  string item;
+  while (stream >> item)
+    items.push_back(item);
+  return items;
+}
+
 XmlHandler::XmlHandler() :
 jobsCollection_(JobsCollectionFactory::newInstance()),
 jobHandler_(parser::ElementName(namespace_uri(), "job")) {
@@ -263,6 +279,10 @@ SimulationHandler::create(attributes_type const& attributes) {
   simulation_->setStopTime(attributes["stopTime"]);
   if (attributes.has("criteriaStep"))
     simulation_->setCriteriaStep(attributes["criteriaStep"]);
+  if (attributes.has("criteriaMaxLag"))
+    simulation_->setCriteriaMaxLag(attributes["criteriaMaxLag"]);
+  if (attributes.has("coherenceCheckStep"))
+    simulation_->setCoherenceCheckStep(attributes["coherenceCheckStep"]);
   if (attributes.has("precision"))
     simulation_->setPrecision(attributes["precision"]);
   if (attributes.has("timeout")) {
@@ -271,6 +291,32 @@ SimulationHandler::create(attributes_type const& attributes) {
   if (attributes.has("enableRealTimeTracking")) {
     simulation_->setEnableRealTimeTracking(attributes["enableRealTimeTracking"]);
   }
+  if (attributes.has("steadyStateThreshold"))
+    simulation_->setSteadyStateThreshold(attributes["steadyStateThreshold"]);
+  if (attributes.has("steadyStateDuration"))
+    simulation_->setSteadyStateDuration(attributes["steadyStateDuration"]);
+  if (attributes.has("profilingSamplingPeriod"))
+    simulation_->setProfilingSamplingPeriod(attributes["profilingSamplingPeriod"]);
+  if (attributes.has("exportProfilingTrace"))
+    simulation_->setExportProfilingTrace(attributes["exportProfilingTrace"]);
+  if (attributes.has("profilingHardwareCounters"))
+    simulation_->setProfilingHardwareCounters(attributes["profilingHardwareCounters"]);
+  if (attributes.has("subModelCostAccounting"))
+    simulation_->setSubModelCostAccounting(attributes["subModelCostAccounting"]);
+  if (attributes.has("latencyPartition"))
+    simulation_->setLatencyPartition(attributes["latencyPartition"]);
+  if (attributes.has("pararealSlices"))
+    simulation_->setPararealSlices(attributes["pararealSlices"]);
+  if (attributes.has("pararealMaxIterations"))
+    simulation_->setPararealMaxIterations(attributes["pararealMaxIterations"]);
+  if (attributes.has("pararealTolerance"))
+    simulation_->setPararealTolerance(attributes["pararealTolerance"]);
+  if (attributes.has("memoryAccounting"))
+    simulation_->setMemoryAccounting(attributes["memoryAccounting"]);
+  if (attributes.has("memoryReportInterval"))
+    simulation_->setMemoryReportInterval(attributes["memoryReportInterval"]);
+  if (attributes.has("hugePages"))
+    simulation_->setHugePages(attributes["hugePages"]);
 }
 
 shared_ptr<SimulationEntry>
@@ -293,6 +339,7 @@ finalStateHandler_(parser::ElementName(namespace_uri(), "finalState")),
 curvesHandler_(parser::ElementName(namespace_uri(), "curves")),
 finalStateValuesHandler_(parser::ElementName(namespace_uri(), "finalStateValues")),
 lostEquipmentsHandler_(parser::ElementName(namespace_uri(), "lostEquipments")),
+solverStatisticsHandler_(parser::ElementName(namespace_uri(), "solverStatistics")),
 logsHandler_(parser::ElementName(namespace_uri(), "logs")) {
   onStartElement(root_element, lambda::bind(&OutputsHandler::create, lambda::ref(*this), lambda_args::arg2));
 
@@ -305,6 +352,7 @@ logsHandler_(parser::ElementName(namespace_uri(), "logs")) {
   onElement(root_element + namespace_uri()("curves"), curvesHandler_);
   onElement(root_element + namespace_uri()("finalStateValues"), finalStateValuesHandler_);
   onElement(root_element + namespace_uri()("lostEquipments"), lostEquipmentsHandler_);
+  onElement(root_element + namespace_uri()("solverStatistics"), solverStatisticsHandler_);
   onElement(root_element + namespace_uri()("logs"), logsHandler_);
 
   initValuesHandler_.onEnd(lambda::bind(&OutputsHandler::addInitValuesEntry, lambda::ref(*this)));
@@ -316,6 +364,7 @@ logsHandler_(parser::ElementName(namespace_uri(), "logs")) {
   curvesHandler_.onEnd(lambda::bind(&OutputsHandler::addCurves, lambda::ref(*this)));
   finalStateValuesHandler_.onEnd(lambda::bind(&OutputsHandler::addFinalStateValues, lambda::ref(*this)));
   lostEquipmentsHandler_.onEnd(lambda::bind(&OutputsHandler::addLostEquipments, lambda::ref(*this)));
+  solverStatisticsHandler_.onEnd(lambda::bind(&OutputsHandler::addSolverStatistics, lambda::ref(*this)));
   logsHandler_.onEnd(lambda::bind(&OutputsHandler::addLog, lambda::ref(*this)));
 }
 
@@ -366,6 +415,11 @@ OutputsHandler::addLostEquipments() {
   outputs_->setLostEquipmentsEntry(lostEquipmentsHandler_.get());
 }
 
+void
+OutputsHandler::addSolverStatistics() {
+  outputs_->setSolverStatisticsEntry(solverStatisticsHandler_.get());
+}
+
 void
 OutputsHandler::addLog() {
   outputs_->setLogsEntry(logsHandler_.get());
@@ -483,6 +537,10 @@ TimelineHandler::create(attributes_type const& attributes) {
     timeline_->setMaxPriority(attributes["maxPriority"]);
   if (attributes.has("filter"))
     timeline_->setFilter(attributes["filter"]);
+  if (attributes.has("allowedKeys"))
+    timeline_->setAllowedKeys(splitList(attributes["allowedKeys"].as_string()));
+  if (attributes.has("deniedKeys"))
+    timeline_->setDeniedKeys(splitList(attributes["deniedKeys"].as_string()));
 }
 
 shared_ptr<TimelineEntry>
@@ -500,6 +558,8 @@ void
 TimetableHandler::create(attributes_type const& attributes) {
   timetable_ = std::make_shared<TimetableEntry>();
   timetable_->setStep(attributes["step"]);
+  if (attributes.has("exportMode"))
+    timetable_->setExportMode(attributes["exportMode"]);
 }
 
 shared_ptr<TimetableEntry>
@@ -521,6 +581,8 @@ FinalStateHandler::create(attributes_type const& attributes) {
   }
   finalState_->setExportIIDMFile(attributes["exportIIDMFile"]);
   finalState_->setExportDumpFile(attributes["exportDumpFile"]);
+  if (attributes.has("dumpFormat"))
+    finalState_->setDumpFormat(attributes["dumpFormat"]);
 }
 
 shared_ptr<FinalStateEntry>
@@ -585,6 +647,25 @@ LostEquipmentsHandler::get() const {
   return lostEquipments_;
 }
 
+SolverStatisticsHandler::SolverStatisticsHandler(elementName_type const& root_element) {
+  onStartElement(root_element, lambda::bind(&SolverStatisticsHandler::create, lambda::ref(*this), lambda_args::arg2));
+}
+
+SolverStatisticsHandler::~SolverStatisticsHandler() {}
+
+void
+SolverStatisticsHandler::create(attributes_type const& attributes) {
+  solverStatistics_ = std::make_shared<SolverStatisticsEntry>();
+  solverStatistics_->setExportMode(attributes["exportMode"]);
+  if (attributes.has("convergenceDiagnosticsDepth"))
+    solverStatistics_->setConvergenceDiagnosticsDepth(attributes["convergenceDiagnosticsDepth"]);
+}
+
+shared_ptr<SolverStatisticsEntry>
+SolverStatisticsHandler::get() const {
+  return solverStatistics_;
+}
+
 LogsHandler::LogsHandler(elementName_type const& root_element) :
 appenderHandler_(parser::ElementName(namespace_uri(), "appender")) {
   onElement(root_element + namespace_uri()("appender"), appenderHandler_);
@@ -639,6 +720,9 @@ AppenderHandler::create(attributes_type const& attributes) {
 
   if (attributes.has("separator"))
     appender_->setSeparator(attributes["separator"]);
+
+  if (attributes.has("asynchronous"))
+    appender_->setAsynchronous(attributes["asynchronous"]);
 }
 
 shared_ptr<AppenderEntry>
@@ -660,6 +744,31 @@ NetworkHandler::create(attributes_type const& attributes) {
     network_->setNetworkParFile(attributes["parFile"]);
   if (attributes.has("parId"))
     network_->setNetworkParId(attributes["parId"]);
+  if (attributes.has("reducedVoltageLevels")) {
+    // list of ids separated by white spaces
+    std::istringstream reducedVoltageLevels(attributes["reducedVoltageLevels"].as_string());
+    std::vector<std::string> ids;
+    std::string id;
+    while (reducedVoltageLevels >> id)
+      ids.push_back(id);
+    network_->setReducedVoltageLevels(ids);
+  }
+  if (attributes.has("collapsedVoltageLevels")) {
+    std::istringstream collapsedVoltageLevels(attributes["collapsedVoltageLevels"].as_string());
+    std::vector<std::string> ids;
+    std::string id;
+    while (collapsedVoltageLevels >> id)
+      ids.push_back(id);
+    network_->setCollapsedVoltageLevels(ids);
+  }
+  if (attributes.has("eliminateStarBuses"))
+    network_->setEliminateStarBuses(attributes["eliminateStarBuses"]);
+  if (attributes.has("initialPowerFlow"))
+    network_->setInitialPowerFlow(attributes["initialPowerFlow"]);
+  if (attributes.has("studyVoltageLevels"))
+    network_->setStudyVoltageLevels(splitList(attributes["studyVoltageLevels"].as_string()));
+  if (attributes.has("studyAreaDepth"))
+    network_->setStudyAreaDepth(attributes["studyAreaDepth"]);
 }
 
 shared_ptr<NetworkEntry>
@@ -784,6 +893,12 @@ void
 InteractiveSettingsHandler::create(attributes_type const& attributes) {
   interactiveSettings_ = std::make_shared<InteractiveSettingsEntry>();
   interactiveSettings_->setCouplingTimeStep(attributes["couplingTimeStep"]);
+  if (attributes.has("degradeAfterOverruns"))
+    interactiveSettings_->setDegradeAfterOverruns(attributes["degradeAfterOverruns"]);
+  if (attributes.has("outputQueueSize"))
+    interactiveSettings_->setOutputQueueSize(attributes["outputQueueSize"]);
+  if (attributes.has("outputQueuePolicy"))
+    interactiveSettings_->setOutputQueuePolicy(attributes["outputQueuePolicy"]);
 }
 
 shared_ptr<InteractiveSettingsEntry>
@@ -806,6 +921,12 @@ ClockHandler::create(attributes_type const& attributes) {
     clock_->setSpeedup(attributes["speedup"]);
   if (attributes.has("triggerChannel"))
     clock_->setTriggerChannel(attributes["triggerChannel"]);
+  if (attributes.has("spinGuard"))
+    clock_->setSpinGuard(attributes["spinGuard"]);
+  if (attributes.has("cpuAffinity"))
+    clock_->setCpuAffinity(attributes["cpuAffinity"]);
+  if (attributes.has("realTimePriority"))
+    clock_->setRealTimePriority(attributes["realTimePriority"]);
 }
 
 shared_ptr<ClockEntry>
@@ -898,6 +1019,12 @@ StreamHandler::create(attributes_type const& attributes) {
   stream_->setData(attributes["data"]);
   stream_->setChannel(attributes["channel"]);
   stream_->setFormat(attributes["format"]);
+  if (attributes.has("deadband"))
+    stream_->setDeadband(attributes["deadband"]);
+  if (attributes.has("minPeriod"))
+    stream_->setMinPeriod(attributes["minPeriod"]);
+  if (attributes.has("keyframeInterval"))
+    stream_->setKeyframeInterval(attributes["keyframeInterval"]);
 }
 
 shared_ptr<StreamEntry>
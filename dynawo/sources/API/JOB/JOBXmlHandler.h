@@ -34,6 +34,7 @@
 #include "JOBJobsCollection.h"
 #include "JOBLogsEntry.h"
 #include "JOBLostEquipmentsEntry.h"
+#include "JOBSolverStatisticsEntry.h"
 #include "JOBModelerEntry.h"
 #include "JOBModelsDirEntry.h"
 #include "JOBNetworkEntry.h"
@@ -573,6 +574,40 @@ class LostEquipmentsHandler : public xml::sax::parser::ComposableElementHandler
   std::shared_ptr<LostEquipmentsEntry> lostEquipments_;  ///< current lostEquipments entry object
 };
 
+/**
+ * @class SolverStatisticsHandler
+ * @brief Handler used to parse solverStatistics element
+ */
+class SolverStatisticsHandler : public xml::sax::parser::ComposableElementHandler {
+ public:
+  /**
+   * @brief Constructor
+   * @param root_element complete name of the element read by the handler
+   */
+  explicit SolverStatisticsHandler(elementName_type const& root_element);
+
+  /**
+   * @brief Destructor
+   */
+  ~SolverStatisticsHandler() override;
+
+  /**
+   * @brief return the solverStatistics entry read in xml file
+   * @return solverStatistics entry object build thanks to infos read in xml file
+   */
+  std::shared_ptr<SolverStatisticsEntry> get() const;
+
+ protected:
+  /**
+   * @brief Called when the XML element opening tag is read
+   * @param attributes attributes of the element
+   */
+  void create(attributes_type const& attributes);
+
+ private:
+  std::shared_ptr<SolverStatisticsEntry> solverStatistics_;  ///< current solverStatistics entry object
+};
+
 /**
  * @class LogsHandler
  * @brief Handler used to parse logs element
@@ -681,6 +716,11 @@ class OutputsHandler : public xml::sax::parser::ComposableElementHandler {
    */
   void addLostEquipments();
 
+  /**
+   * @brief add a solverStatistics object to the current job
+   */
+  void addSolverStatistics();
+
   /**
    * @brief add a log object to the current job
    */
@@ -704,6 +744,7 @@ class OutputsHandler : public xml::sax::parser::ComposableElementHandler {
   CurvesHandler curvesHandler_;                      ///< handler used to read curves element
   FinalStateValuesHandler finalStateValuesHandler_;  ///< handler used to read finalStateValues element
   LostEquipmentsHandler lostEquipmentsHandler_;      ///< handler used to read curves element
+  SolverStatisticsHandler solverStatisticsHandler_;  ///< handler used to read solverStatistics element
   LogsHandler logsHandler_;                          ///< handler used to read logs element
 };
 
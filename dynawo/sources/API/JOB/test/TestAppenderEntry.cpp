@@ -32,6 +32,7 @@ TEST(APIJOBTest, testAppenderEntry) {
   ASSERT_EQ(appender->getTag(), "");
   ASSERT_EQ(appender->getLvlFilter(), "");
   ASSERT_EQ(appender->getFilePath(), "");
+  ASSERT_EQ(appender->isAsynchronous(), false);
 
   // use setters and check getters
   appender->setShowLevelTag(false);
@@ -40,6 +41,7 @@ TEST(APIJOBTest, testAppenderEntry) {
   appender->setTag("TAG");
   appender->setLvlFilter("DEBUG");
   appender->setFilePath("/tmp/log.txt");
+  appender->setAsynchronous(true);
 
   ASSERT_EQ(appender->getShowLevelTag(), false);
   ASSERT_EQ(appender->getSeparator(), " / ");
@@ -47,6 +49,7 @@ TEST(APIJOBTest, testAppenderEntry) {
   ASSERT_EQ(appender->getTag(), "TAG");
   ASSERT_EQ(appender->getLvlFilter(), "DEBUG");
   ASSERT_EQ(appender->getFilePath(), "/tmp/log.txt");
+  ASSERT_EQ(appender->isAsynchronous(), true);
 }
 
 }  // namespace job
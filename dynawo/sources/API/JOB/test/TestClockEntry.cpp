@@ -29,15 +29,24 @@ TEST(APIJOBTest, testClockEntry) {
   ASSERT_EQ(clock->getType(), "");
   ASSERT_FALSE(clock->getSpeedup());
   ASSERT_EQ(clock->getTriggerChannel(), "");
+  ASSERT_DOUBLE_EQ(clock->getSpinGuard(), 0.);
+  ASSERT_EQ(clock->getCpuAffinity(), -1);
+  ASSERT_EQ(clock->getRealTimePriority(), 0);
 
   clock->setType("type");
   clock->setSpeedup(2.6);
   clock->setTriggerChannel("channel");
+  clock->setSpinGuard(200.);
+  clock->setCpuAffinity(3);
+  clock->setRealTimePriority(50);
 
   ASSERT_EQ(clock->getType(), "type");
   ASSERT_TRUE(clock->getSpeedup());
   ASSERT_EQ(clock->getSpeedup().get(), 2.6);
   ASSERT_EQ(clock->getTriggerChannel(), "channel");
+  ASSERT_DOUBLE_EQ(clock->getSpinGuard(), 200.);
+  ASSERT_EQ(clock->getCpuAffinity(), 3);
+  ASSERT_EQ(clock->getRealTimePriority(), 50);
 }
 
 }  // namespace job
@@ -30,12 +30,14 @@ TEST(APIJOBTest, testFinalStateEntry) {
   ASSERT_EQ(finalState->getDumpFile(), "");
   ASSERT_EQ(finalState->getOutputIIDMFile(), "");
   ASSERT_FALSE(finalState->getTimestamp());
+  ASSERT_EQ(finalState->getDumpFormat(), "ZIP");
 
   finalState->setOutputIIDMFile("/tmp/exportIIDMFile.txt");
   finalState->setDumpFile("/tmp/dumpFile.dmp");
   finalState->setExportIIDMFile(true);
   finalState->setExportDumpFile(true);
   finalState->setTimestamp(15.);
+  finalState->setDumpFormat("RAW");
 
   ASSERT_EQ(finalState->getOutputIIDMFile(), "/tmp/exportIIDMFile.txt");
   ASSERT_EQ(finalState->getDumpFile(), "/tmp/dumpFile.dmp");
@@ -43,6 +45,7 @@ TEST(APIJOBTest, testFinalStateEntry) {
   ASSERT_EQ(finalState->getExportDumpFile(), true);
   ASSERT_TRUE(finalState->getTimestamp());
   ASSERT_EQ(*finalState->getTimestamp(), 15.);
+  ASSERT_EQ(finalState->getDumpFormat(), "RAW");
 }
 
 }  // namespace job
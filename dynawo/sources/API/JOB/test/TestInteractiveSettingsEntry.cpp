@@ -31,6 +31,9 @@ TEST(APIJOBTest, testInteractiveSetingsEntry) {
 
   // check default attributes
   ASSERT_EQ(interactiveSettings->getCouplingTimeStep(), 0.);
+  ASSERT_EQ(interactiveSettings->getDegradeAfterOverruns(), 0);
+  ASSERT_EQ(interactiveSettings->getOutputQueueSize(), 64);
+  ASSERT_EQ(interactiveSettings->getOutputQueuePolicy(), "BLOCK");
   ASSERT_EQ(interactiveSettings->getChannelsEntry(), std::shared_ptr<ChannelsEntry>());
   ASSERT_EQ(interactiveSettings->getClockEntry(), std::shared_ptr<ClockEntry>());
   ASSERT_EQ(interactiveSettings->getStreamsEntry(), std::shared_ptr<StreamsEntry>());
@@ -40,17 +43,26 @@ TEST(APIJOBTest, testInteractiveSetingsEntry) {
   std::shared_ptr<StreamsEntry> streams = std::make_shared<StreamsEntry>();
 
   interactiveSettings->setCouplingTimeStep(2.);
+  interactiveSettings->setDegradeAfterOverruns(5);
+  interactiveSettings->setOutputQueueSize(8);
+  interactiveSettings->setOutputQueuePolicy("DROP_OLDEST");
   interactiveSettings->setChannelsEntry(channels);
   interactiveSettings->setClockEntry(clock);
   interactiveSettings->setStreamsEntry(streams);
 
   ASSERT_EQ(interactiveSettings->getCouplingTimeStep(), 2.);
+  ASSERT_EQ(interactiveSettings->getDegradeAfterOverruns(), 5);
+  ASSERT_EQ(interactiveSettings->getOutputQueueSize(), 8);
+  ASSERT_EQ(interactiveSettings->getOutputQueuePolicy(), "DROP_OLDEST");
   ASSERT_EQ(interactiveSettings->getChannelsEntry(), channels);
   ASSERT_EQ(interactiveSettings->getClockEntry(), clock);
   ASSERT_EQ(interactiveSettings->getStreamsEntry(), streams);
 
   std::shared_ptr<InteractiveSettingsEntry> interactiveSettings_bis = DYN::clone(interactiveSettings);
   ASSERT_EQ(interactiveSettings_bis->getCouplingTimeStep(), 2.);
+  ASSERT_EQ(interactiveSettings_bis->getDegradeAfterOverruns(), 5);
+  ASSERT_EQ(interactiveSettings_bis->getOutputQueueSize(), 8);
+  ASSERT_EQ(interactiveSettings_bis->getOutputQueuePolicy(), "DROP_OLDEST");
   ASSERT_NE(interactiveSettings_bis->getChannelsEntry(), channels);
   ASSERT_NE(interactiveSettings_bis->getClockEntry(), clock);
   ASSERT_NE(interactiveSettings_bis->getStreamsEntry(), streams);
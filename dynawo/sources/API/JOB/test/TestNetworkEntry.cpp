@@ -28,14 +28,35 @@ TEST(APIJOBTest, testNetworkEntry) {
   ASSERT_EQ(network->getNetworkParFile(), "");
   ASSERT_EQ(network->getNetworkParId(), "");
   ASSERT_EQ(network->getIidmFile(), "");
+  ASSERT_TRUE(network->getReducedVoltageLevels().empty());
+  ASSERT_TRUE(network->getCollapsedVoltageLevels().empty());
+  ASSERT_FALSE(network->getEliminateStarBuses());
+  ASSERT_FALSE(network->getInitialPowerFlow());
+  ASSERT_TRUE(network->getStudyVoltageLevels().empty());
+  ASSERT_EQ(network->getStudyAreaDepth(), 0);
 
   network->setNetworkParFile("/tmp/networkParameters.par");
   network->setNetworkParId("network_par");
   network->setIidmFile("/tmp/iidm.xml");
+  network->setReducedVoltageLevels(std::vector<std::string>(1, "VL"));
+  network->setCollapsedVoltageLevels(std::vector<std::string>(1, "VL2"));
+  network->setEliminateStarBuses(true);
+  network->setInitialPowerFlow(true);
+  network->setStudyVoltageLevels(std::vector<std::string>(1, "VL3"));
+  network->setStudyAreaDepth(2);
 
   ASSERT_EQ(network->getNetworkParFile(), "/tmp/networkParameters.par");
   ASSERT_EQ(network->getNetworkParId(), "network_par");
   ASSERT_EQ(network->getIidmFile(), "/tmp/iidm.xml");
+  ASSERT_EQ(network->getReducedVoltageLevels().size(), 1);
+  ASSERT_EQ(network->getReducedVoltageLevels()[0], "VL");
+  ASSERT_EQ(network->getCollapsedVoltageLevels().size(), 1);
+  ASSERT_EQ(network->getCollapsedVoltageLevels()[0], "VL2");
+  ASSERT_TRUE(network->getEliminateStarBuses());
+  ASSERT_TRUE(network->getInitialPowerFlow());
+  ASSERT_EQ(network->getStudyVoltageLevels().size(), 1);
+  ASSERT_EQ(network->getStudyVoltageLevels()[0], "VL3");
+  ASSERT_EQ(network->getStudyAreaDepth(), 2);
 }
 
 }  // namespace job
@@ -25,6 +25,7 @@
 #include "JOBFinalStateEntry.h"
 #include "JOBCurvesEntry.h"
 #include "JOBLostEquipmentsEntry.h"
+#include "JOBSolverStatisticsEntry.h"
 #include "JOBLogsEntry.h"
 
 #include "DYNClone.hpp"
@@ -42,6 +43,7 @@ TEST(APIJOBTest, testOutputsEntry) {
   ASSERT_EQ(outputs->getFinalStateEntries().empty(), true);
   ASSERT_EQ(outputs->getCurvesEntry(), std::shared_ptr<CurvesEntry>());
   ASSERT_EQ(outputs->getLostEquipmentsEntry(), std::shared_ptr<LostEquipmentsEntry>());
+  ASSERT_EQ(outputs->getSolverStatisticsEntry(), std::shared_ptr<SolverStatisticsEntry>());
   ASSERT_EQ(outputs->getLogsEntry(), std::shared_ptr<LogsEntry>());
 
   outputs->setOutputsDirectory("/tmp/outputs");
@@ -67,6 +69,9 @@ TEST(APIJOBTest, testOutputsEntry) {
   std::shared_ptr<LostEquipmentsEntry> lostEquipments = std::make_shared<LostEquipmentsEntry>();
   outputs->setLostEquipmentsEntry(lostEquipments);
 
+  std::shared_ptr<SolverStatisticsEntry> solverStatistics = std::make_shared<SolverStatisticsEntry>();
+  outputs->setSolverStatisticsEntry(solverStatistics);
+
   std::shared_ptr<LogsEntry> logs = std::make_shared<LogsEntry>();
   outputs->setLogsEntry(logs);
 
@@ -80,6 +85,7 @@ TEST(APIJOBTest, testOutputsEntry) {
   ASSERT_EQ(outputs->getFinalStateEntries().front(), finalState);
   ASSERT_EQ(outputs->getCurvesEntry(), curves);
   ASSERT_EQ(outputs->getLostEquipmentsEntry(), lostEquipments);
+  ASSERT_EQ(outputs->getSolverStatisticsEntry(), solverStatistics);
   ASSERT_EQ(outputs->getLogsEntry(), logs);
 
   std::shared_ptr<OutputsEntry> outputs_bis = DYN::clone(outputs);
@@ -92,6 +98,7 @@ TEST(APIJOBTest, testOutputsEntry) {
   ASSERT_NE(outputs_bis->getFinalStateEntries().front(), finalState);
   ASSERT_NE(outputs_bis->getCurvesEntry(), curves);
   ASSERT_NE(outputs_bis->getLostEquipmentsEntry(), lostEquipments);
+  ASSERT_NE(outputs_bis->getSolverStatisticsEntry(), solverStatistics);
   ASSERT_NE(outputs_bis->getLogsEntry(), logs);
 
   OutputsEntry outputs_bis2 = *outputs;
@@ -104,6 +111,7 @@ TEST(APIJOBTest, testOutputsEntry) {
   ASSERT_NE(outputs_bis2.getFinalStateEntries().front(), finalState);
   ASSERT_NE(outputs_bis2.getCurvesEntry(), curves);
   ASSERT_NE(outputs_bis2.getLostEquipmentsEntry(), lostEquipments);
+  ASSERT_NE(outputs_bis2.getSolverStatisticsEntry(), solverStatistics);
   ASSERT_NE(outputs_bis2.getLogsEntry(), logs);
 }
 
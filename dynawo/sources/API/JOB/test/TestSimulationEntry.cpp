@@ -29,16 +29,46 @@ TEST(APIJOBTest, testSimulationEntry) {
   ASSERT_EQ(simulation->getStopTime(), 0);
   ASSERT_TRUE(simulation->getCriteriaFiles().empty());
   ASSERT_EQ(simulation->getCriteriaStep(), 10);
+  ASSERT_EQ(simulation->getCriteriaMaxLag(), 0);
+  ASSERT_EQ(simulation->getCoherenceCheckStep(), 1);
   ASSERT_EQ(simulation->getPrecision(), 1e-6);
   ASSERT_EQ(simulation->getTimeout(), std::numeric_limits<double>::max());
+  ASSERT_EQ(simulation->getSteadyStateThreshold(), 0.);
+  ASSERT_EQ(simulation->getSteadyStateDuration(), 0.);
+  ASSERT_EQ(simulation->getProfilingSamplingPeriod(), 0);
+  ASSERT_FALSE(simulation->getExportProfilingTrace());
+  ASSERT_FALSE(simulation->getProfilingHardwareCounters());
+  ASSERT_FALSE(simulation->getSubModelCostAccounting());
+  ASSERT_FALSE(simulation->getLatencyPartition());
+  ASSERT_EQ(simulation->getPararealSlices(), 0);
+  ASSERT_EQ(simulation->getPararealMaxIterations(), 10);
+  ASSERT_EQ(simulation->getPararealTolerance(), 1e-6);
+  ASSERT_FALSE(simulation->getMemoryAccounting());
+  ASSERT_EQ(simulation->getMemoryReportInterval(), 0.);
+  ASSERT_FALSE(simulation->getHugePages());
 
   simulation->setStartTime(10);
   simulation->setStopTime(100);
   simulation->addCriteriaFile("MyFile1");
   simulation->addCriteriaFile("MyFile2");
   simulation->setCriteriaStep(15);
+  simulation->setCriteriaMaxLag(30);
+  simulation->setCoherenceCheckStep(0);
   simulation->setPrecision(1e-8);
   simulation->setTimeout(10.);
+  simulation->setSteadyStateThreshold(1e-4);
+  simulation->setSteadyStateDuration(20.);
+  simulation->setProfilingSamplingPeriod(10);
+  simulation->setExportProfilingTrace(true);
+  simulation->setProfilingHardwareCounters(true);
+  simulation->setSubModelCostAccounting(true);
+  simulation->setLatencyPartition(true);
+  simulation->setPararealSlices(4);
+  simulation->setPararealMaxIterations(3);
+  simulation->setPararealTolerance(1e-4);
+  simulation->setMemoryAccounting(true);
+  simulation->setMemoryReportInterval(50.);
+  simulation->setHugePages(true);
 
   ASSERT_EQ(simulation->getStartTime(), 10);
   ASSERT_EQ(simulation->getStopTime(), 100);
@@ -48,8 +78,23 @@ TEST(APIJOBTest, testSimulationEntry) {
   ASSERT_TRUE(std::find(simulation->getCriteriaFiles().begin(),
       simulation->getCriteriaFiles().end(), "MyFile2") != simulation->getCriteriaFiles().end());
   ASSERT_EQ(simulation->getCriteriaStep(), 15);
+  ASSERT_EQ(simulation->getCriteriaMaxLag(), 30);
+  ASSERT_EQ(simulation->getCoherenceCheckStep(), 0);
   ASSERT_EQ(simulation->getPrecision(), 1e-8);
   ASSERT_EQ(simulation->getTimeout(), 10.);
+  ASSERT_EQ(simulation->getSteadyStateThreshold(), 1e-4);
+  ASSERT_EQ(simulation->getSteadyStateDuration(), 20.);
+  ASSERT_EQ(simulation->getProfilingSamplingPeriod(), 10);
+  ASSERT_TRUE(simulation->getExportProfilingTrace());
+  ASSERT_TRUE(simulation->getProfilingHardwareCounters());
+  ASSERT_TRUE(simulation->getSubModelCostAccounting());
+  ASSERT_TRUE(simulation->getLatencyPartition());
+  ASSERT_EQ(simulation->getPararealSlices(), 4);
+  ASSERT_EQ(simulation->getPararealMaxIterations(), 3);
+  ASSERT_EQ(simulation->getPararealTolerance(), 1e-4);
+  ASSERT_TRUE(simulation->getMemoryAccounting());
+  ASSERT_EQ(simulation->getMemoryReportInterval(), 50.);
+  ASSERT_TRUE(simulation->getHugePages());
 
   simulation->setCriteriaFile("MyFile");
   ASSERT_EQ(simulation->getCriteriaFiles().size(), 1);
@@ -0,0 +1,38 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file API/JOB/test/TestSolverStatisticsEntry.cpp
+ * @brief Unit tests for API_JOB/JOBSolverStatisticsEntry class
+ *
+ */
+
+#include "gtest_dynawo.h"
+#include "JOBSolverStatisticsEntry.h"
+
+namespace job {
+
+TEST(APIJOBTest, testSolverStatisticsEntry) {
+  std::shared_ptr<SolverStatisticsEntry> solverStatistics = std::make_shared<SolverStatisticsEntry>();
+  // check default attributes
+  ASSERT_EQ(solverStatistics->getExportMode(), "");
+  ASSERT_EQ(solverStatistics->getConvergenceDiagnosticsDepth(), 0);
+
+  solverStatistics->setExportMode("CSV");
+  solverStatistics->setConvergenceDiagnosticsDepth(20);
+
+  ASSERT_EQ(solverStatistics->getExportMode(), "CSV");
+  ASSERT_EQ(solverStatistics->getConvergenceDiagnosticsDepth(), 20);
+}
+
+}  // namespace job
@@ -29,14 +29,23 @@ TEST(APIJOBTest, testStreamEntry) {
   ASSERT_EQ(stream->getData(), "");
   ASSERT_EQ(stream->getChannel(), "");
   ASSERT_EQ(stream->getFormat(), "");
+  ASSERT_DOUBLE_EQ(stream->getDeadband(), 0.);
+  ASSERT_DOUBLE_EQ(stream->getMinPeriod(), 0.);
+  ASSERT_EQ(stream->getKeyframeInterval(), 0);
 
   stream->setData("data");
   stream->setChannel("channel");
   stream->setFormat("format");
+  stream->setDeadband(0.5);
+  stream->setMinPeriod(2.);
+  stream->setKeyframeInterval(10);
 
   ASSERT_EQ(stream->getData(), "data");
   ASSERT_EQ(stream->getChannel(), "channel");
   ASSERT_EQ(stream->getFormat(), "format");
+  ASSERT_DOUBLE_EQ(stream->getDeadband(), 0.5);
+  ASSERT_DOUBLE_EQ(stream->getMinPeriod(), 2.);
+  ASSERT_EQ(stream->getKeyframeInterval(), 10);
 }
 
 }  // namespace job
@@ -30,12 +30,16 @@ TEST(APIJOBTest, testTimelineEntry) {
   ASSERT_FALSE(timeline->getMaxPriority());
   ASSERT_EQ(timeline->getOutputFile(), "");
   ASSERT_EQ(timeline->isFilter(), false);
+  ASSERT_TRUE(timeline->getAllowedKeys().empty());
+  ASSERT_TRUE(timeline->getDeniedKeys().empty());
 
   timeline->setExportMode("TXT");
   timeline->setExportWithTime(false);
   timeline->setMaxPriority(2);
   timeline->setOutputFile("/tmp/output.txt");
   timeline->setFilter(true);
+  timeline->setAllowedKeys(std::vector<std::string>(1, "LineOpen"));
+  timeline->setDeniedKeys(std::vector<std::string>(1, "LineClosed"));
 
   ASSERT_EQ(timeline->getExportMode(), "TXT");
   ASSERT_EQ(timeline->getExportWithTime(), false);
@@ -43,6 +47,10 @@ TEST(APIJOBTest, testTimelineEntry) {
   ASSERT_EQ(*timeline->getMaxPriority(), 2.);
   ASSERT_EQ(timeline->getOutputFile(), "/tmp/output.txt");
   ASSERT_EQ(timeline->isFilter(), true);
+  ASSERT_EQ(timeline->getAllowedKeys().size(), 1);
+  ASSERT_EQ(timeline->getAllowedKeys()[0], "LineOpen");
+  ASSERT_EQ(timeline->getDeniedKeys().size(), 1);
+  ASSERT_EQ(timeline->getDeniedKeys()[0], "LineClosed");
 }
 
 }  // namespace job
@@ -169,6 +169,16 @@ TEST(APIJOBTest, testXmlImporter) {
   ASSERT_EQ(network->getIidmFile(), "myIIDM.iidm");
   ASSERT_EQ(network->getNetworkParFile(), "myPAR.par");
   ASSERT_EQ(network->getNetworkParId(), "1");
+  ASSERT_EQ(network->getReducedVoltageLevels().size(), 2);
+  ASSERT_EQ(network->getReducedVoltageLevels()[0], "VL1");
+  ASSERT_EQ(network->getReducedVoltageLevels()[1], "VL2");
+  ASSERT_EQ(network->getCollapsedVoltageLevels().size(), 1);
+  ASSERT_EQ(network->getCollapsedVoltageLevels()[0], "VL3");
+  ASSERT_TRUE(network->getEliminateStarBuses());
+  ASSERT_TRUE(network->getInitialPowerFlow());
+  ASSERT_EQ(network->getStudyVoltageLevels().size(), 1);
+  ASSERT_EQ(network->getStudyVoltageLevels()[0], "VL4");
+  ASSERT_EQ(network->getStudyAreaDepth(), 3);
 
   ASSERT_NE(modeler->getInitialStateEntry(), std::shared_ptr<InitialStateEntry>());
   std::shared_ptr<InitialStateEntry> initialState = modeler->getInitialStateEntry();
@@ -190,6 +200,10 @@ TEST(APIJOBTest, testXmlImporter) {
   ASSERT_TRUE(std::find(simulation->getCriteriaFiles().begin(),
       simulation->getCriteriaFiles().end(), "myCriteriaFile2.crt") != simulation->getCriteriaFiles().end());
   ASSERT_EQ(simulation->getCriteriaStep(), 5);
+  ASSERT_EQ(simulation->getCriteriaMaxLag(), 20);
+  ASSERT_EQ(simulation->getCoherenceCheckStep(), 50);
+  ASSERT_DOUBLE_EQ(simulation->getSteadyStateThreshold(), 0.001);
+  ASSERT_DOUBLE_EQ(simulation->getSteadyStateDuration(), 30.);
 
   // ===== OutputsEntry =====
   ASSERT_NE(job1->getOutputsEntry(), std::shared_ptr<OutputsEntry>());
@@ -221,11 +235,16 @@ TEST(APIJOBTest, testXmlImporter) {
   ASSERT_TRUE(timeline->getMaxPriority());
   ASSERT_EQ(*timeline->getMaxPriority(), 2);
   ASSERT_EQ(timeline->isFilter(), true);
+  ASSERT_TRUE(timeline->getAllowedKeys().empty());
+  ASSERT_EQ(timeline->getDeniedKeys().size(), 2);
+  ASSERT_EQ(timeline->getDeniedKeys()[0], "GeneratorDisconnected");
+  ASSERT_EQ(timeline->getDeniedKeys()[1], "LoadDisconnected");
 
   // ===== TimetableEntry =====
   ASSERT_NE(outputs->getTimetableEntry(), std::shared_ptr<TimetableEntry>());
   std::shared_ptr<TimetableEntry> timetable = outputs->getTimetableEntry();
   ASSERT_EQ(timetable->getStep(), 10);
+  ASSERT_EQ(timetable->getExportMode(), "SHARED_MEMORY");
 
   // ===== FinalStateEntry =====
   ASSERT_EQ(outputs->getFinalStateEntries().size(), 2);
@@ -233,12 +252,14 @@ TEST(APIJOBTest, testXmlImporter) {
   ASSERT_EQ(finalState->getExportIIDMFile(), true);
   ASSERT_EQ(finalState->getExportDumpFile(), true);
   ASSERT_FALSE(finalState->getTimestamp());
+  ASSERT_EQ(finalState->getDumpFormat(), "ZIP");
 
   finalState = outputs->getFinalStateEntries()[1];
   ASSERT_EQ(finalState->getExportIIDMFile(), true);
   ASSERT_EQ(finalState->getExportDumpFile(), true);
   ASSERT_TRUE(finalState->getTimestamp());
   ASSERT_EQ(*finalState->getTimestamp(), 10);
+  ASSERT_EQ(finalState->getDumpFormat(), "RAW");
 
   // ===== CurvesEntry =====
   ASSERT_NE(outputs->getCurvesEntry(), std::shared_ptr<CurvesEntry>());
@@ -262,6 +283,11 @@ TEST(APIJOBTest, testXmlImporter) {
   std::shared_ptr<LostEquipmentsEntry> lostEquipments = outputs->getLostEquipmentsEntry();
   ASSERT_EQ(lostEquipments->getDumpLostEquipments(), true);
 
+  // ===== SolverStatisticsEntry =====
+  ASSERT_NE(outputs->getSolverStatisticsEntry(), std::shared_ptr<SolverStatisticsEntry>());
+  ASSERT_EQ(outputs->getSolverStatisticsEntry()->getExportMode(), "CSV");
+  ASSERT_EQ(outputs->getSolverStatisticsEntry()->getConvergenceDiagnosticsDepth(), 20);
+
   // ===== LogsEntry =====
   ASSERT_NE(outputs->getLogsEntry(), std::shared_ptr<LogsEntry>());
   std::shared_ptr<LogsEntry> logs = outputs->getLogsEntry();
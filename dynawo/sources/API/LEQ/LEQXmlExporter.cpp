@@ -19,10 +19,8 @@
  */
 #include <fstream>
 
-#include <xml/sax/formatter/AttributeList.h>
-#include <xml/sax/formatter/Formatter.h>
-
 #include "DYNMacrosMessage.h"
+#include "DYNXmlStreamWriter.h"
 
 #include "LEQXmlExporter.h"
 #include "LEQLostEquipmentsCollection.h"
@@ -32,9 +30,6 @@ using std::fstream;
 using std::ostream;
 using std::string;
 
-using xml::sax::formatter::AttributeList;
-using xml::sax::formatter::Formatter;
-using xml::sax::formatter::FormatterPtr;
 
 
 namespace lostEquipments {
@@ -53,23 +48,21 @@ XmlExporter::exportToFile(const std::shared_ptr<LostEquipmentsCollection>& lostE
 
 void
 XmlExporter::exportToStream(const std::shared_ptr<LostEquipmentsCollection>& lostEquipments, ostream& stream) const {
-  FormatterPtr formatter = Formatter::createFormatter(stream, "http://www.rte-france.com/dynawo");
+  DYN::XmlStreamWriter writer(stream, "http://www.rte-france.com/dynawo");
 
-  formatter->startDocument();
-  AttributeList attrs;
+  writer.startDocument();
 
-  formatter->startElement("lostEquipments", attrs);
+  writer.startElement("lostEquipments");
   for (LostEquipmentsCollection::LostEquipmentsCollectionConstIterator itLostEquipment = lostEquipments->cbegin();
           itLostEquipment != lostEquipments->cend();
           ++itLostEquipment) {
-    attrs.clear();
-    attrs.add("id", (*itLostEquipment)->getId());
-    attrs.add("type", (*itLostEquipment)->getType());
-    formatter->startElement("lostEquipment", attrs);
-    formatter->endElement();   // lostEquipment
+    writer.startElement("lostEquipment");
+    writer.addAttribute("id", (*itLostEquipment)->getId());
+    writer.addAttribute("type", (*itLostEquipment)->getType());
+    writer.endElement();   // lostEquipment
   }
-  formatter->endElement();   // lostEquipments
-  formatter->endDocument();
+  writer.endElement();   // lostEquipments
+  writer.endDocument();
 }
 
 }  // namespace lostEquipments
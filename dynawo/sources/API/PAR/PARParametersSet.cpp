@@ -16,6 +16,7 @@
  * @brief Dynawo parameters set : implementation file
  *
  */
+#include <algorithm>
 #include <sstream>
 #include <set>
 #include "DYNMacrosMessage.h"
@@ -168,6 +169,17 @@ ParametersSet::getReference(const string& name) const {
   return itRef->second;
 }
 
+Parameter*
+ParametersSet::findParameter(const string& name) const {
+  const auto itParam = parameters_.find(name);
+  if (itParam == parameters_.end())
+    return nullptr;
+
+  itParam->second->setUsed(true);
+
+  return itParam->second.get();
+}
+
 bool
 ParametersSet::hasParameter(const string& name) const {
   return (parameters_.find(name) != parameters_.end());
@@ -190,7 +202,7 @@ ParametersSet::hasReference(const string& name) const {
 
 void
 ParametersSet::extend(const std::shared_ptr<ParametersSet>& parametersSet) {
-  const map<string, shared_ptr<Parameter> >& mapParameters = dynamic_pointer_cast<ParametersSet>(parametersSet)->getParameters();
+  const unordered_map<string, shared_ptr<Parameter> >& mapParameters = dynamic_pointer_cast<ParametersSet>(parametersSet)->getParameters();
   parameters_.insert(mapParameters.begin(), mapParameters.end());
 }
 
@@ -200,6 +212,7 @@ ParametersSet::getParametersNames() const {
   returnVector.reserve(parameters_.size());
   for (const auto& parameter : parameters_)
     returnVector.push_back(parameter.first);
+  std::sort(returnVector.begin(), returnVector.end());
 
   return returnVector;
 }
@@ -212,6 +225,7 @@ ParametersSet::getParamsUnused() const {
       returnVector.push_back(parameterPair.first);
     }
   }
+  std::sort(returnVector.begin(), returnVector.end());
   return returnVector;
 }
 
@@ -236,7 +250,7 @@ ParametersSet::addReference(const std::shared_ptr<Reference>& ref) {
   return shared_from_this();
 }
 
-const map<string, shared_ptr<Parameter> >&
+const unordered_map<string, shared_ptr<Parameter> >&
 ParametersSet::getParameters() {
   return parameters_;
 }
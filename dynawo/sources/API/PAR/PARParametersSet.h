@@ -221,6 +221,17 @@ class ParametersSet : public std::enable_shared_from_this<ParametersSet> {
    */
   const std::shared_ptr<Parameter>& getParameter(const std::string& name) const;
 
+  /**
+   * @brief Find a parameter in the parameters set
+   *
+   * Find the parameter with given name in the parameter set with a single lookup,
+   * the parameter found being marked as used as with getParameter
+   *
+   * @param name : Name of the parameter
+   * @returns the parameter, nullptr if it is not found
+   */
+  Parameter* findParameter(const std::string& name) const;
+
   /**
    * @brief Get a reference from the parameters set
    *
@@ -300,11 +311,11 @@ class ParametersSet : public std::enable_shared_from_this<ParametersSet> {
   std::vector<std::string> getReferencesNames() const;
 
   /**
-   * @brief Get a reference to the map of parameters
+   * @brief Get a reference to the map of parameters, not sorted
    *
    * @returns Reference to the map of parameters
    */
-  const std::map<std::string, std::shared_ptr<Parameter> >& getParameters();
+  const std::unordered_map<std::string, std::shared_ptr<Parameter> >& getParameters();
 
   /**
    * @brief Get a reference to the map of references
@@ -355,7 +366,7 @@ class ParametersSet : public std::enable_shared_from_this<ParametersSet> {
  private:
   std::string id_;                                                           /**< Parameters' set id */
   std::string filepath_;                                                     /**< Parameters' set filepath */
-  std::map<std::string, std::shared_ptr<Parameter> > parameters_;            /**< Map of the parameters */
+  std::unordered_map<std::string, std::shared_ptr<Parameter> > parameters_;  /**< Map of the parameters */
   std::unordered_map<std::string, std::shared_ptr<Reference> > references_;  /**< Map of the references */
   std::map<std::string, std::shared_ptr<MacroParSet> > macroParSets_;        ///< Map of the macroParSet
 };
@@ -0,0 +1,176 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+/**
+ * @file PARParametersSetCollectionCache.cpp
+ * @brief Cache of the parameters files parsed in the process : implementation file
+ *
+ */
+
+#include <algorithm>
+#include <set>
+
+#include <boost/filesystem.hpp>
+
+#include "DYNError.h"
+#include "DYNFileSystemUtils.h"
+#include "DYNThreadPool.h"
+
+#include "PARParametersSetCollectionCache.h"
+#include "PARXmlImporter.h"
+
+using std::string;
+using std::vector;
+
+namespace parameters {
+
+ParametersSetCollectionCache&
+ParametersSetCollectionCache::instance() {
+  static ParametersSetCollectionCache instance;
+  return instance;
+}
+
+std::shared_ptr<ParametersSetCollection>
+ParametersSetCollectionCache::importFromFile(const string& fileName) {
+  FileVersion version;
+  if (!fileVersion(fileName, version)) {
+    // the importer reports the missing file
+    const XmlImporter importer;
+    return importer.importFromFile(fileName);
+  }
+  std::shared_ptr<ParametersSetCollection> collection = find(fileName, version);
+  if (!collection)
+    collection = parse(fileName, version);
+  return copyCollection(*collection);
+}
+
+void
+ParametersSetCollectionCache::preload(const vector<string>& fileNames, const unsigned int nbThreads) {
+  vector<string> filesToParse;
+  vector<FileVersion> versions;
+  std::set<string> filesFound;
+  for (const auto& fileName : fileNames) {
+    FileVersion version;
+    if (filesFound.insert(fileName).second && fileVersion(fileName, version) && !find(fileName, version)) {
+      filesToParse.push_back(fileName);
+      versions.push_back(version);
+    }
+  }
+  if (filesToParse.empty())
+    return;
+
+  const unsigned int nbFiles = static_cast<unsigned int>(filesToParse.size());
+  DYN::ThreadPool threadPool(std::max(1U, std::min(nbThreads, nbFiles)));
+  threadPool.parallelFor(nbFiles, [this, &filesToParse, &versions](const unsigned int i) {
+    try {
+      parse(filesToParse[i], versions[i]);
+    } catch (const DYN::Error&) {
+      // reported when the file is imported, at the same place as without the preload
+    }
+  });
+}
+
+std::size_t
+ParametersSetCollectionCache::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+vector<string>
+ParametersSetCollectionCache::getFileNames() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  vector<string> fileNames;
+  fileNames.reserve(entries_.size());
+  for (const auto& entry : entries_)
+    fileNames.push_back(entry.first);
+  return fileNames;
+}
+
+void
+ParametersSetCollectionCache::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+}
+
+bool
+ParametersSetCollectionCache::fileVersion(const string& fileName, FileVersion& version) {
+  try {
+    version.lastWriteTime = lastWriteTime(fileName);
+    version.size = fileSize(fileName);
+  } catch (const boost::filesystem::filesystem_error&) {
+    return false;
+  }
+  return true;
+}
+
+std::shared_ptr<ParametersSetCollection>
+ParametersSetCollectionCache::find(const string& fileName, const FileVersion& version) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto it = entries_.find(fileName);
+  if (it == entries_.end() || it->second.version.lastWriteTime != version.lastWriteTime || it->second.version.size != version.size)
+    return std::shared_ptr<ParametersSetCollection>();
+  return it->second.collection;
+}
+
+std::shared_ptr<ParametersSetCollection>
+ParametersSetCollectionCache::parse(const string& fileName, const FileVersion& version) {
+  // the file is parsed without holding the lock, so that several files are parsed concurrently
+  const XmlImporter importer;
+  const std::shared_ptr<ParametersSetCollection> collection = importer.importFromFile(fileName);
+  Entry entry;
+  entry.version = version;
+  entry.collection = collection;
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_[fileName] = entry;
+  return collection;
+}
+
+std::shared_ptr<ParametersSetCollection>
+ParametersSetCollectionCache::copyCollection(const ParametersSetCollection& original) {
+  std::shared_ptr<ParametersSetCollection> collection = std::make_shared<ParametersSetCollection>();
+  for (const auto& parametersSetPair : original.getParametersSets()) {
+    const std::shared_ptr<ParametersSet>& originalSet = parametersSetPair.second;
+    std::shared_ptr<ParametersSet> set = std::make_shared<ParametersSet>(originalSet->getId());
+    set->setFilePath(originalSet->getFilePath());
+    // the aliases of a table parameter share the parameter of its first name: they are recreated on the copy
+    const std::unordered_map<string, std::shared_ptr<Parameter> >& parameters = originalSet->getParameters();
+    std::map<const Parameter*, string> copiedParameters;
+    for (const auto& parameterPair : parameters) {
+      if (parameterPair.first == parameterPair.second->getName()) {
+        set->addParameter(std::make_shared<Parameter>(*parameterPair.second));
+        copiedParameters[parameterPair.second.get()] = parameterPair.first;
+      }
+    }
+    for (const auto& parameterPair : parameters) {
+      if (parameterPair.first != parameterPair.second->getName())
+        set->createAlias(parameterPair.first, copiedParameters.at(parameterPair.second.get()));
+    }
+    for (const auto& referencePair : originalSet->getReferences())
+      set->addReference(std::make_shared<Reference>(*referencePair.second));
+    for (const auto& macroParSetPair : originalSet->getMacroParSets())
+      set->addMacroParSet(macroParSetPair.second);
+    collection->addParametersSet(set);
+  }
+  for (const auto& macroParametersSetPair : original.getMacroParametersSets()) {
+    const std::shared_ptr<MacroParameterSet>& originalSet = macroParametersSetPair.second;
+    std::shared_ptr<MacroParameterSet> set = std::make_shared<MacroParameterSet>(originalSet->getId());
+    for (const auto& referencePair : originalSet->getReferences())
+      set->addReference(std::make_shared<Reference>(*referencePair.second));
+    for (const auto& parameterPair : originalSet->getParameters())
+      set->addParameter(std::make_shared<Parameter>(*parameterPair.second));
+    collection->addMacroParameterSet(set);
+  }
+  return collection;
+}
+
+}  // namespace parameters
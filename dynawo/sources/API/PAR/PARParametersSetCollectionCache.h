@@ -0,0 +1,161 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+/**
+ * @file PARParametersSetCollectionCache.h
+ * @brief Cache of the parameters files parsed in the process : header file
+ *
+ */
+
+#ifndef API_PAR_PARPARAMETERSSETCOLLECTIONCACHE_H_
+#define API_PAR_PARPARAMETERSSETCOLLECTIONCACHE_H_
+
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+
+#include "PARParametersSetCollection.h"
+
+namespace parameters {
+
+/**
+ * @class ParametersSetCollectionCache
+ * @brief Cache of the parameters files parsed in the process
+ *
+ * The collection parsed from a file is kept with the last write time and the size of the file, so that a file used
+ * several times in a job or by several jobs of a launcher is only parsed once as long as it is not modified.
+ * Each import returns a deep copy of the parsed collection, as the collections are completed and their parameters
+ * marked as used by the simulations.
+ */
+class ParametersSetCollectionCache : private boost::noncopyable {
+ public:
+  /**
+   * @brief get the cache of the process
+   *
+   * @return cache of the process
+   */
+  static ParametersSetCollectionCache& instance();
+
+  /**
+   * @brief import a parameters file, parsed only if it is not cached or was modified since it was parsed
+   *
+   * @param fileName path of the parameters file, used as key of the cache
+   *
+   * @return copy of the parameters collection of the file
+   */
+  std::shared_ptr<ParametersSetCollection> importFromFile(const std::string& fileName);
+
+  /**
+   * @brief parse concurrently the parameters files not cached yet, so that their later imports are not parsed again
+   *
+   * The files that cannot be parsed are skipped: their error is reported when they are imported.
+   *
+   * @param fileNames paths of the parameters files
+   * @param nbThreads number of threads parsing the files
+   */
+  void preload(const std::vector<std::string>& fileNames, unsigned int nbThreads);
+
+  /**
+   * @brief get the number of files cached
+   *
+   * @return number of files cached
+   */
+  std::size_t size() const;
+
+  /**
+   * @brief get the paths of the files cached
+   *
+   * @return paths of the files cached
+   */
+  std::vector<std::string> getFileNames() const;
+
+  /**
+   * @brief remove all the files from the cache
+   */
+  void clear();
+
+ private:
+  /**
+   * @brief version of a file, changed when the file is written
+   */
+  struct FileVersion {
+    std::time_t lastWriteTime;  ///< last write time of the file
+    std::uintmax_t size;  ///< size of the file
+  };
+
+  /**
+   * @brief parsed collection of a file
+   */
+  struct Entry {
+    FileVersion version;  ///< version of the file parsed
+    std::shared_ptr<ParametersSetCollection> collection;  ///< collection parsed, never modified
+  };
+
+  /**
+   * @brief constructor
+   */
+  ParametersSetCollectionCache() = default;
+
+  /**
+   * @brief get the version of a file
+   *
+   * @param fileName path of the file
+   * @param version version of the file
+   *
+   * @return @b false if the file does not exist
+   */
+  static bool fileVersion(const std::string& fileName, FileVersion& version);
+
+  /**
+   * @brief find the collection cached for a file
+   *
+   * @param fileName path of the file
+   * @param version current version of the file
+   *
+   * @return collection cached, @b nullptr if the file is not cached or was modified since
+   */
+  std::shared_ptr<ParametersSetCollection> find(const std::string& fileName, const FileVersion& version) const;
+
+  /**
+   * @brief parse a file and cache its collection
+   *
+   * @param fileName path of the file
+   * @param version version of the file before it is parsed
+   *
+   * @return collection parsed
+   */
+  std::shared_ptr<ParametersSetCollection> parse(const std::string& fileName, const FileVersion& version);
+
+  /**
+   * @brief deep copy of a collection, so that the copy can be modified without modifying the original
+   *
+   * @param original collection to copy
+   *
+   * @return copy of the collection
+   */
+  static std::shared_ptr<ParametersSetCollection> copyCollection(const ParametersSetCollection& original);
+
+ private:
+  mutable std::mutex mutex_;  ///< mutex of the entries
+  std::unordered_map<std::string, Entry> entries_;  ///< parsed collections by file path
+};
+
+}  // namespace parameters
+
+#endif  // API_PAR_PARPARAMETERSSETCOLLECTIONCACHE_H_
@@ -114,8 +114,9 @@ XmlExporter::exportToStream(const std::shared_ptr<ParametersSetCollection>& coll
     attrs.add("id", paramSet->getId());
     vector <string> paramsExported;  ///< list of already exported parameters, to avoid exporting aliases
     formatter->startElement("set", attrs);
-     // write parameters
-    for (const auto& parameterPair : paramSet->getParameters()) {
+     // write parameters, sorted by name
+    const map<string, std::shared_ptr<Parameter> > sortedParams(paramSet->getParameters().begin(), paramSet->getParameters().end());
+    for (const auto& parameterPair : sortedParams) {
       const auto& parameter = parameterPair.second;
       const string& paramName = parameter->getName();
       const bool alreadyExported = std::find(paramsExported.begin(), paramsExported.end(), paramName) != paramsExported.end();
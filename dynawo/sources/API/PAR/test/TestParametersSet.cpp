@@ -18,6 +18,7 @@
 
 #include <vector>
 #include <map>
+#include <unordered_map>
 
 #include "gtest_dynawo.h"
 
@@ -78,6 +79,12 @@ TEST(APIPARTest, ParametersSetAddParameter) {
   // Try to get a nonexistent parameter: it should raise an error
   ASSERT_THROW_DYNAWO(parametersSet->getParameter("inexistant"), DYN::Error::API, DYN::KeyError_t::ParameterNotFoundInSet);
 
+  // Find the parameter with a single lookup, marking it as used
+  param->setUsed(false);
+  ASSERT_EQ(parametersSet->findParameter("param"), param.get());
+  ASSERT_TRUE(param->getUsed());
+  ASSERT_EQ(parametersSet->findParameter("inexistant"), nullptr);
+
   // Test hasParameter
   ASSERT_EQ(parametersSet->hasParameter("param"), true);
   ASSERT_EQ(parametersSet->hasParameter("inexistant"), false);
@@ -146,7 +153,7 @@ TEST(APIPARTest, ParametersSetGetParameters) {
   parametersSet->addParameter(param4);
 
   // Get the map of parameters associated with their names
-  map<string, std::shared_ptr<Parameter> > paramMap;
+  std::unordered_map<string, std::shared_ptr<Parameter> > paramMap;
   paramMap["param1"] = param1;
   paramMap["param2"] = param2;
   paramMap["param3"] = param3;
@@ -0,0 +1,123 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+/**
+ * @file API/PAR/test/TestParametersSetCollectionCache.cpp
+ * @brief Unit tests for API_PAR cache of the parsed files
+ */
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "gtest_dynawo.h"
+
+#include "PARParametersSetCollectionCache.h"
+#include "PARParametersSetCollection.h"
+
+namespace parameters {
+
+/**
+ * @brief copy a file
+ * @param from path of the file to copy
+ * @param to path of the copy
+ * @param extraSet whether a set is added at the end of the copy
+ */
+static void
+copyParFile(const std::string& from, const std::string& to, const bool extraSet) {
+  std::ifstream in(from.c_str());
+  std::ofstream out(to.c_str(), std::ios::trunc);
+  std::string line;
+  while (std::getline(in, line)) {
+    if (extraSet && line == "</parametersSet>")
+      out << "  <set id=\"4\">\n    <par type=\"DOUBLE\" name=\"x\" value=\"1.\"/>\n  </set>\n";
+    out << line << "\n";
+  }
+}
+
+//-----------------------------------------------------
+// TEST a file is parsed once, each import getting its own copy
+//-----------------------------------------------------
+
+TEST(APIPARTest, ParametersSetCollectionCacheCopies) {
+  ParametersSetCollectionCache& cache = ParametersSetCollectionCache::instance();
+  cache.clear();
+  std::shared_ptr<ParametersSetCollection> collection1 = cache.importFromFile("res/fileToImport.par");
+  std::shared_ptr<ParametersSetCollection> collection2 = cache.importFromFile("res/fileToImport.par");
+  ASSERT_EQ(cache.size(), 1);
+  ASSERT_NE(collection1, collection2);
+  ASSERT_EQ(collection1->getParametersSets().size(), 3);
+  ASSERT_EQ(collection2->getParametersSets().size(), 3);
+  ASSERT_TRUE(collection2->hasMacroParametersSet("test"));
+
+  std::shared_ptr<ParametersSet> set1 = collection1->getParametersSet("1");
+  std::shared_ptr<ParametersSet> set2 = collection2->getParametersSet("1");
+  ASSERT_NE(set1, set2);
+  ASSERT_EQ(set2->getParameters().size(), set1->getParameters().size());
+  ASSERT_EQ(set2->getReferences().size(), 3);
+  // the aliases of the table parameters share their parameter in each copy only
+  ASSERT_EQ(set1->getParameter("A_1_"), set1->getParameter("A_1_1_"));
+  ASSERT_EQ(set2->getParameter("A_1_"), set2->getParameter("A_1_1_"));
+  ASSERT_NE(set1->getParameter("A_1_"), set2->getParameter("A_1_"));
+  ASSERT_EQ(set2->getParameter("A_1_2_")->getDouble(), 0.5);
+
+  set1->createParameter("added", 1.);
+  set1->getReference("M")->setParId("other");
+  ASSERT_FALSE(set2->hasParameter("added"));
+  ASSERT_TRUE(set2->getReference("M")->getParId().empty());
+  ASSERT_FALSE(cache.importFromFile("res/fileToImport.par")->getParametersSet("1")->hasParameter("added"));
+
+  collection1->getParametersFromMacroParameter();
+  ASSERT_TRUE(collection1->getParametersSet("2")->hasParameter("tb"));
+  ASSERT_FALSE(collection2->getParametersSet("2")->hasParameter("tb"));
+
+  ASSERT_THROW_DYNAWO(cache.importFromFile("res/dummyFile.par"), DYN::Error::API, DYN::KeyError_t::FileSystemItemDoesNotExist);
+  ASSERT_EQ(cache.size(), 1);
+}
+
+//-----------------------------------------------------
+// TEST a modified file is parsed again
+//-----------------------------------------------------
+
+TEST(APIPARTest, ParametersSetCollectionCacheModifiedFile) {
+  ParametersSetCollectionCache& cache = ParametersSetCollectionCache::instance();
+  cache.clear();
+  copyParFile("res/fileToImport.par", "res/cachedFile.par", false);
+  ASSERT_FALSE(cache.importFromFile("res/cachedFile.par")->hasParametersSet("4"));
+  copyParFile("res/fileToImport.par", "res/cachedFile.par", true);
+  ASSERT_TRUE(cache.importFromFile("res/cachedFile.par")->hasParametersSet("4"));
+  ASSERT_EQ(cache.size(), 1);
+}
+
+//-----------------------------------------------------
+// TEST preload of several files
+//-----------------------------------------------------
+
+TEST(APIPARTest, ParametersSetCollectionCachePreload) {
+  ParametersSetCollectionCache& cache = ParametersSetCollectionCache::instance();
+  cache.clear();
+  copyParFile("res/fileToImport.par", "res/cachedFile.par", true);
+  std::vector<std::string> fileNames;
+  fileNames.push_back("res/fileToImport.par");
+  fileNames.push_back("res/cachedFile.par");
+  fileNames.push_back("res/fileToImport.par");
+  fileNames.push_back("res/dummyFile.par");
+  fileNames.push_back("res/wrongFile.par");
+  ASSERT_NO_THROW(cache.preload(fileNames, 2));
+  ASSERT_EQ(cache.size(), 2);
+  ASSERT_TRUE(cache.importFromFile("res/cachedFile.par")->hasParametersSet("4"));
+  ASSERT_THROW_DYNAWO(cache.importFromFile("res/wrongFile.par"), DYN::Error::API, DYN::KeyError_t::XmlFileParsingError);
+  ASSERT_EQ(cache.size(), 2);
+}
+
+}  // namespace parameters
@@ -23,7 +23,17 @@ using std::string;
 
 namespace timeline {
 
-Event::Event() : time_(0.), modelName_(""), message_(""), priority_(boost::none) {}
+/**
+ * @brief shared empty string used by default constructed events
+ * @return the shared empty string
+ */
+static const std::shared_ptr<const string>&
+emptyString() {
+  static const std::shared_ptr<const string> empty = std::make_shared<const string>();
+  return empty;
+}
+
+Event::Event() : time_(0.), modelName_(emptyString()), message_(emptyString()), key_(emptyString()), priority_(boost::none) {}
 
 void
 Event::setTime(const double& time) {
@@ -32,11 +42,21 @@ Event::setTime(const double& time) {
 
 void
 Event::setModelName(const string& modelName) {
+  modelName_ = std::make_shared<const string>(modelName);
+}
+
+void
+Event::setModelName(const std::shared_ptr<const string>& modelName) {
   modelName_ = modelName;
 }
 
 void
 Event::setMessage(const string& message) {
+  message_ = std::make_shared<const string>(message);
+}
+
+void
+Event::setMessage(const std::shared_ptr<const string>& message) {
   message_ = message;
 }
 
@@ -52,12 +72,12 @@ Event::getTime() const {
 
 const string&
 Event::getModelName() const {
-  return modelName_;
+  return *modelName_;
 }
 
 const string&
 Event::getMessage() const {
-  return message_;
+  return *message_;
 }
 
 }  // namespace timeline
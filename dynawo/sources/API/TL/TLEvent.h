@@ -21,6 +21,7 @@
 #define API_TL_TLEVENT_H_
 
 #include <boost/optional.hpp>
+#include <memory>
 #include <string>
 
 namespace timeline {
@@ -32,6 +33,9 @@ namespace timeline {
  * Interface class for event. Event is a container describing an event which occurs
  * during simulation:  for describing an event, there is three field: time of event,
  * model name in which event's occurs and message to describe the event
+ *
+ * Strings are held through shared pointers so that the timeline can share one
+ * interned copy of a model name, message or key between all its events.
  */
 class Event {
  public:
@@ -52,12 +56,24 @@ class Event {
    */
   void setModelName(const std::string& modelName);
 
+  /**
+   * @brief Setter for an interned modelName for which event occurs
+   * @param modelName Model's name for which event occurs, shared with other events
+   */
+  void setModelName(const std::shared_ptr<const std::string>& modelName);
+
   /**
    * @brief Setter for event's message
    * @param message message to describe event
    */
   void setMessage(const std::string& message);
 
+  /**
+   * @brief Setter for an interned event's message
+   * @param message message to describe event, shared with other events
+   */
+  void setMessage(const std::shared_ptr<const std::string>& message);
+
   /**
    * @brief Setter for event's priority
    * @param priority priority to describe event
@@ -104,6 +120,14 @@ class Event {
    * @param key new key to describe event
    */
   inline void setKey(const std::string& key) {
+    key_ = std::make_shared<const std::string>(key);
+  }
+
+  /**
+   * @brief Setter for an interned event's key
+   * @param key new key to describe event, shared with other events
+   */
+  inline void setKey(const std::shared_ptr<const std::string>& key) {
     key_ = key;
   }
 
@@ -112,14 +136,14 @@ class Event {
    * @return key to describe event
    */
   inline const std::string& getKey() const {
-    return key_;
+    return *key_;
   }
 
  private:
   double time_;                    ///< event's time
-  std::string modelName_;          ///< Model's name for which event occurs
-  std::string message_;            ///<  message to describe event
-  std::string key_;                 ///<  key used from the timeline dictionary, empty if none
+  std::shared_ptr<const std::string> modelName_;  ///< Model's name for which event occurs
+  std::shared_ptr<const std::string> message_;    ///<  message to describe event
+  std::shared_ptr<const std::string> key_;        ///<  key used from the timeline dictionary, empty if none
   boost::optional<int> priority_;  ///< priority of the event
 };
 
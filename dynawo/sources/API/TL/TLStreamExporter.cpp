@@ -0,0 +1,128 @@
+//
+// Copyright (c) 2015-2019, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  TLStreamExporter.cpp
+ *
+ * @brief Dynawo timeline streaming exporter : implementation file
+ *
+ */
+#include "DYNMacrosMessage.h"
+#include "DYNCommon.h"
+#include "DYNXmlStreamWriter.h"
+#include "TLStreamExporter.h"
+#include "TLEvent.h"
+
+using std::string;
+
+namespace timeline {
+
+static const char TXT_SEPARATOR[] = " | ";  ///< separator of the txt format
+static const char CSV_SEPARATOR[] = ";";  ///< separator of the csv format
+
+StreamExporter::StreamExporter(const Format_t format, const size_t chunkSize) :
+format_(format),
+chunkSize_(chunkSize > 0 ? chunkSize : 1),
+exportWithTime_(true),
+maxPriority_(boost::none) {
+}
+
+StreamExporter::~StreamExporter() {
+}
+
+void
+StreamExporter::open(const boost::shared_ptr<Timeline>& timeline, const string& filePath) {
+  timeline_ = timeline;
+  stream_.open(filePath.c_str(), std::ios::out);
+  if (!stream_.is_open()) {
+    throw DYNError(DYN::Error::API, FileGenerationFailed, filePath.c_str());
+  }
+  if (format_ == XML) {
+    xmlWriter_.reset(new DYN::XmlStreamWriter(stream_, "http://www.rte-france.com/dynawo"));
+    xmlWriter_->startDocument();
+    xmlWriter_->startElement("timeline");
+  }
+}
+
+void
+StreamExporter::update() {
+  if (static_cast<size_t>(timeline_->getSizeEvents()) >= chunkSize_)
+    flush();
+}
+
+void
+StreamExporter::flush() {
+  if (!stream_.is_open())
+    return;
+  size_t nbEvents = timeline_->getNbFinalEvents();
+  if (nbEvents > 0 && nbEvents == static_cast<size_t>(timeline_->getSizeEvents()))
+    --nbEvents;
+  if (nbEvents == 0)
+    return;
+  writeEvents(nbEvents);
+  if (xmlWriter_)
+    xmlWriter_->flush();
+  stream_.flush();
+}
+
+void
+StreamExporter::close() {
+  if (!stream_.is_open())
+    return;
+  writeEvents(static_cast<size_t>(timeline_->getSizeEvents()));
+  if (xmlWriter_) {
+    xmlWriter_->endDocument();
+    xmlWriter_.reset();
+  }
+  stream_.close();
+}
+
+void
+StreamExporter::writeEvents(const size_t nbEvents) {
+  const std::vector<Event*>& events = timeline_->getEvents();
+  for (size_t i = 0; i < nbEvents; ++i)
+    writeEvent(*events[i]);
+  timeline_->eraseFirstEvents(nbEvents);
+}
+
+void
+StreamExporter::writeEvent(const Event& event) {
+  if (event.hasPriority() && maxPriority_ != boost::none && event.getPriority() > maxPriority_)
+    return;
+  switch (format_) {
+    case TXT:
+    case CSV: {
+      const char* separator = (format_ == TXT) ? TXT_SEPARATOR : CSV_SEPARATOR;
+      if (exportWithTime_)
+        stream_ << DYN::double2String(event.getTime()) << separator;
+      stream_ << event.getModelName() << separator << event.getMessage();
+      if (event.hasPriority())
+        stream_ << separator << event.getPriority();
+      stream_ << "\n";
+      break;
+    }
+    case XML: {
+      xmlWriter_->startElement("event");
+      if (exportWithTime_)
+        xmlWriter_->addAttribute("time", event.getTime(), DYN::XmlStreamWriter::DOUBLE_PRECISION);
+      xmlWriter_->addAttribute("modelName", event.getModelName());
+      xmlWriter_->addAttribute("message", event.getMessage());
+      if (event.hasPriority())
+        xmlWriter_->addAttribute("priority", event.getPriority());
+      xmlWriter_->endElement();  // event
+      break;
+    }
+  }
+}
+
+}  // namespace timeline
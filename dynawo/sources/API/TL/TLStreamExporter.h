@@ -0,0 +1,138 @@
+//
+// Copyright (c) 2015-2019, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  TLStreamExporter.h
+ *
+ * @brief Dynawo timeline streaming exporter : header file
+ *
+ */
+#ifndef API_TL_TLSTREAMEXPORTER_H_
+#define API_TL_TLSTREAMEXPORTER_H_
+
+#include "TLTimeline.h"
+
+#include <boost/optional.hpp>
+#include <boost/shared_ptr.hpp>
+#include <fstream>
+#include <memory>
+#include <string>
+
+namespace DYN {
+class XmlStreamWriter;
+}
+
+namespace timeline {
+
+/**
+ * @class StreamExporter
+ * @brief Streaming exporter for timeline
+ *
+ * Writes the events of a timeline to a file while the simulation runs and erases them
+ * from the timeline, so that the number of events kept in memory stays bounded.
+ *
+ * Only final events are written: when the timeline is filtered online, the events of the
+ * time step in progress are kept until the simulation leaves it. The last event is also kept,
+ * as the timeline compares a new event with it to drop duplicates.
+ *
+ * The formats are the ones of TxtExporter, CsvExporter and XmlExporter.
+ */
+class StreamExporter {
+ public:
+  /**
+   * formats the timeline can be streamed in
+   */
+  typedef enum { TXT, CSV, XML } Format_t;
+
+  /**
+   * @brief constructor
+   *
+   * @param format format of the output file
+   * @param chunkSize number of events stored in memory before the final ones are written to the file
+   */
+  StreamExporter(Format_t format, size_t chunkSize);
+
+  /**
+   * @brief destructor
+   */
+  ~StreamExporter();
+
+  /**
+   * @brief whether to export time setter
+   * @param exportWithTime whether to export time
+   */
+  void setExportWithTime(const bool exportWithTime) {
+    exportWithTime_ = exportWithTime;
+  }
+
+  /**
+   * @brief maximum priority setter
+   * @param maxPriority maximum priority allowed
+   */
+  void setMaxPriority(const boost::optional<int>& maxPriority) {
+    maxPriority_ = maxPriority;
+  }
+
+  /**
+   * @brief open the output file and write its header
+   *
+   * @param timeline timeline to export
+   * @param filePath file to export the timeline to
+   */
+  void open(const boost::shared_ptr<Timeline>& timeline, const std::string& filePath);
+
+  /**
+   * @brief write the final events when a chunk of events is stored
+   */
+  void update();
+
+  /**
+   * @brief write the final events but the last one and erase them from the timeline
+   */
+  void flush();
+
+  /**
+   * @brief write the remaining events, the footer and close the output file
+   *
+   * The remaining events must have been filtered before if needed.
+   */
+  void close();
+
+ private:
+  /**
+   * @brief write the oldest events of the timeline and erase them
+   *
+   * @param nbEvents number of events to write
+   */
+  void writeEvents(size_t nbEvents);
+
+  /**
+   * @brief write an event
+   *
+   * @param event event to write
+   */
+  void writeEvent(const Event& event);
+
+ private:
+  Format_t format_;  ///< format of the output file
+  size_t chunkSize_;  ///< number of events stored before writing them
+  bool exportWithTime_;  ///< whether to export time
+  boost::optional<int> maxPriority_;  ///< maximum priority allowed
+  boost::shared_ptr<Timeline> timeline_;  ///< timeline streamed
+  std::ofstream stream_;  ///< output file stream
+  std::unique_ptr<DYN::XmlStreamWriter> xmlWriter_;  ///< writer of the document in XML format
+};
+
+}  // namespace timeline
+
+#endif  // API_TL_TLSTREAMEXPORTER_H_
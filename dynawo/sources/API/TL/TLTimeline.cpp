@@ -20,41 +20,77 @@
 #include "TLTimeline.h"
 
 #include "DYNCommon.h"
+#include "DYNMemoryUsage.h"
 #include "TLEvent.h"
-#include "TLEventFactory.h"
 
+#include <algorithm>
 #include <vector>
-#include <set>
-#include <map>
+#include <utility>
 
 using std::string;
 using std::vector;
-using std::map;
 using std::unordered_map;
 using std::unordered_set;
-using std::set;
+using std::pair;
 
 
 namespace timeline {
 
-Timeline::Timeline(const string& id) : id_(id) {}
+Timeline::Timeline(const string& id) : id_(id), onlineFilter_(false), timeStepBegin_(0), eventFilter_(false) {}
 
 void
 Timeline::addEvent(const double& time, const string& modelName, const std::string& message, const boost::optional<int>& priority, const std::string& key) {
-  std::unique_ptr<Event> event = EventFactory::newEvent();
+  if (eventFilter_ && !acceptsEvent(priority, key))
+    return;
+  if (!events_.empty() && eventEquals(*events_.back(), time, modelName, message, priority))
+    return;
+  if (onlineFilter_ && timeStepBegin_ < events_.size() && !DYN::doubleEquals(events_[timeStepBegin_]->getTime(), time))
+    filterPendingTimeStep();
+  Event* event = allocateEvent();
   event->setTime(time);
-  event->setModelName(modelName);
-  event->setMessage(message);
+  event->setModelName(intern(modelName));
+  event->setMessage(intern(message));
   event->setPriority(priority);
-  event->setKey(key);
-  if (events_.empty() || !eventEquals(*event, *events_.back()))
-    events_.push_back(std::move(event));
+  event->setKey(intern(key));
+  events_.push_back(event);
+  if (onlineFilter_ && timeStepBegin_ == events_.size() - 1) {
+    // the new time step may continue already filtered events of the same time
+    while (timeStepBegin_ > 0 && DYN::doubleEquals(events_[timeStepBegin_ - 1]->getTime(), time))
+      --timeStepBegin_;
+  }
 }
 
 bool
-Timeline::eventEquals(const Event& left, const Event& right) const {
-  return DYN::doubleEquals(left.getTime(), right.getTime()) && left.getModelName() == right.getModelName() && left.hasPriority() == right.hasPriority() &&
-         (!left.hasPriority() || !right.hasPriority() || left.getPriority() == right.getPriority()) && left.getMessage() == right.getMessage();
+Timeline::eventEquals(const Event& event, double time, const string& modelName, const string& message, const boost::optional<int>& priority) const {
+  return DYN::doubleEquals(event.getTime(), time) && event.getModelName() == modelName && event.hasPriority() == (priority != boost::none) &&
+         (!event.hasPriority() || event.getPriority() == *priority) && event.getMessage() == message;
+}
+
+const std::shared_ptr<const string>&
+Timeline::intern(const string& str) {
+  auto it = internedStrings_.find(&str);
+  if (it == internedStrings_.end()) {
+    std::shared_ptr<const string> interned = std::make_shared<const string>(str);
+    const string* internedPtr = interned.get();
+    it = internedStrings_.emplace(internedPtr, std::move(interned)).first;
+  }
+  return it->second;
+}
+
+Event*
+Timeline::allocateEvent() {
+  if (!freeEvents_.empty()) {
+    Event* event = freeEvents_.back();
+    freeEvents_.pop_back();
+    return event;
+  }
+  eventPool_.emplace_back();
+  return &eventPool_.back();
+}
+
+void
+Timeline::releaseEvent(Event* event) {
+  freeEvents_.push_back(event);
 }
 
 int
@@ -63,94 +99,198 @@ Timeline::getSizeEvents() {
 }
 
 /**
- * @brief double comparison with tolerance
+ * @brief hash of a pair of interned strings
  */
-struct dynawoDoubleLess : std::binary_function<double, vector<size_t>, bool> {
+struct StringPtrPairHash {
   /**
-   * @brief double comparison with tolerance
-   * @param left first real to compare
-   * @param right second real to compare
-   * @return true if left < right
+   * @brief compute the hash of a pair of interned strings through their addresses
+   * @param strings pair of interned strings
+   * @return hash of the pair
    */
-  bool operator() (const double left, const double right) const {
-    return !DYN::doubleEquals(left, right) && left < right;
+  std::size_t operator()(const pair<const string*, const string*>& strings) const {
+    const std::size_t firstHash = std::hash<const string*>()(strings.first);
+    return firstHash ^ (std::hash<const string*>()(strings.second) + 0x9e3779b9 + (firstHash << 6) + (firstHash >> 2));
   }
 };
 
-void
-Timeline::filter(const unordered_map<string, unordered_set<string>>& oppositeEventDico) {
-  map<double, vector<size_t>, dynawoDoubleLess> timeToEventIndexes;
-  for (size_t i = 0, iEnd = events_.size(); i < iEnd; ++i) {
-    timeToEventIndexes[events_[i]->getTime()].push_back(i);
+Timeline::InternedOppositeEvents
+Timeline::internOppositeEvents(const unordered_map<string, unordered_set<string>>& oppositeEventDico) {
+  InternedOppositeEvents oppositeEvents;
+  for (const auto& oppositeEvent : oppositeEventDico) {
+    vector<const string*>& oppositeKeys = oppositeEvents[intern(oppositeEvent.first).get()];
+    for (const auto& key : oppositeEvent.second)
+      oppositeKeys.push_back(intern(key).get());
   }
+  return oppositeEvents;
+}
 
-  // Remove duplicated events
-  set<size_t> indexesToRemove;
-  for (const auto& it : timeToEventIndexes) {
-    const auto& events = it.second;
-    unordered_set<string> eventFounds;
-    for (size_t i = 0, iEnd = events.size(); i < iEnd; ++i) {
-      size_t index = events[events.size() -1 - i];
-      if (indexesToRemove.find(index) != indexesToRemove.end()) {
-        continue;
-      }
-      const auto& event = events_[index];
-      string uniqueId = event->getModelName()+"_"+event->getMessage();
-      if (eventFounds.find(uniqueId) == eventFounds.end()) {
-        eventFounds.insert(uniqueId);
-      } else {
-        indexesToRemove.insert(index);
-      }
+void
+Timeline::filterTimeStep(const vector<Event*>& stepEvents, const InternedOppositeEvents& oppositeEvents, vector<bool>& removed) const {
+  // strings are interned: equal model names, messages and keys share the same address
+  // the latest events are kept: a duplicated event or an event cancelled by a later kept event is removed
+  unordered_set<pair<const string*, const string*>, StringPtrPairHash> foundEvents;  // (model, message) of later events
+  unordered_set<pair<const string*, const string*>, StringPtrPairHash> cancelledEvents;  // (model, key) opposed to later kept events
+  removed.assign(stepEvents.size(), false);
+  for (size_t i = stepEvents.size(); i-- > 0;) {
+    const Event& event = *stepEvents[i];
+    const string* modelName = &event.getModelName();
+    if (!foundEvents.insert(std::make_pair(modelName, &event.getMessage())).second ||
+        cancelledEvents.find(std::make_pair(modelName, &event.getKey())) != cancelledEvents.end()) {
+      removed[i] = true;
+      continue;
     }
+    InternedOppositeEvents::const_iterator it = oppositeEvents.find(&event.getKey());
+    if (it == oppositeEvents.end())
+      continue;
+    for (const string* oppositeKey : it->second)
+      cancelledEvents.insert(std::make_pair(modelName, oppositeKey));
+  }
+  if (!eventFilter_)
+    return;
+  // the events registered only to cancel their opposite events are removed once they did
+  for (size_t i = 0; i < stepEvents.size(); ++i) {
+    const Event& event = *stepEvents[i];
+    if (!removed[i] && isRejected(event.hasPriority() ? boost::optional<int>(event.getPriority()) : boost::none, event.getKey()))
+      removed[i] = true;
   }
+}
 
-  // Remove opposed events
-  for (const auto& itEvent : timeToEventIndexes) {
-    const auto& events = itEvent.second;
-    size_t indexToCheck = 1;
-    while (indexToCheck <= events.size() - 1) {
-      if (indexesToRemove.find(events[events.size() - indexToCheck]) != indexesToRemove.end()) {
-        ++indexToCheck;
-        continue;
-      }
-      const auto& currEvent = events_[events[events.size() - indexToCheck]];
-      const auto& it = oppositeEventDico.find(currEvent->getKey());
-      if (it == oppositeEventDico.end()) {
-        ++indexToCheck;
-        continue;
-      }
-      const auto & eventKeysToDelete = it->second;
-
-      for (size_t i = events.size() - indexToCheck - 1; i > 0; --i) {
-        if (events_[events[i]]->getModelName() == currEvent->getModelName() &&
-            eventKeysToDelete.find(events_[events[i]]->getKey()) != eventKeysToDelete.end()) {
-          indexesToRemove.insert(events[i]);
-        }
-      }
-      if (events_[events[0]]->getModelName() == currEvent->getModelName() &&
-          eventKeysToDelete.find(events_[events[0]]->getKey()) != eventKeysToDelete.end()) {
-        indexesToRemove.insert(events[0]);
-      }
-      ++indexToCheck;
-    }
+void
+Timeline::removeEvents(size_t first, const vector<bool>& removed) {
+  size_t kept = first;
+  for (size_t i = first, iEnd = events_.size(); i < iEnd; ++i) {
+    if (removed[i - first])
+      releaseEvent(events_[i]);
+    else
+      events_[kept++] = events_[i];
   }
+  events_.resize(kept);
+}
+
+void
+Timeline::filter(const unordered_map<string, unordered_set<string>>& oppositeEventDico) {
+  const InternedOppositeEvents oppositeEvents = internOppositeEvents(oppositeEventDico);
+
+  // events are added chronologically, so that a time step is a run of consecutive events
+  vector<size_t> indexes(events_.size());
+  for (size_t i = 0, iEnd = events_.size(); i < iEnd; ++i)
+    indexes[i] = i;
+  auto timeLess = [this](size_t left, size_t right) {
+    return !DYN::doubleEquals(events_[left]->getTime(), events_[right]->getTime()) && events_[left]->getTime() < events_[right]->getTime();
+  };
+  if (!std::is_sorted(indexes.begin(), indexes.end(), timeLess))
+    std::stable_sort(indexes.begin(), indexes.end(), timeLess);
 
-  for (auto it = indexesToRemove.rbegin(), itEnd = indexesToRemove.rend(); it != itEnd; ++it) {
-    events_.erase(events_.begin() + *it);
+  vector<bool> removed(events_.size(), false);
+  vector<Event*> stepEvents;
+  vector<bool> stepRemoved;
+  size_t stepBegin = 0;
+  while (stepBegin < indexes.size()) {
+    const double stepTime = events_[indexes[stepBegin]]->getTime();
+    size_t stepEnd = stepBegin;
+    stepEvents.clear();
+    for (; stepEnd < indexes.size() && DYN::doubleEquals(events_[indexes[stepEnd]]->getTime(), stepTime); ++stepEnd)
+      stepEvents.push_back(events_[indexes[stepEnd]]);
+    filterTimeStep(stepEvents, oppositeEvents, stepRemoved);
+    for (size_t i = stepBegin; i < stepEnd; ++i)
+      removed[indexes[i]] = stepRemoved[i - stepBegin];
+    stepBegin = stepEnd;
   }
+  removeEvents(0, removed);
+  if (onlineFilter_)
+    timeStepBegin_ = std::min(timeStepBegin_, events_.size());
+}
+
+void
+Timeline::setOnlineFilter(const unordered_map<string, unordered_set<string>>& oppositeEventDico) {
+  onlineFilter_ = true;
+  onlineOppositeEventDico_ = oppositeEventDico;
+  onlineOppositeEvents_ = internOppositeEvents(onlineOppositeEventDico_);
+  timeStepBegin_ = 0;
+  addOppositeEventKeys(oppositeEventDico);
+}
+
+void
+Timeline::setEventFilter(const boost::optional<int>& maxPriority, const unordered_set<string>& allowedKeys, const unordered_set<string>& deniedKeys,
+    const unordered_map<string, unordered_set<string>>& oppositeEventDico) {
+  eventFilter_ = true;
+  filterMaxPriority_ = maxPriority;
+  allowedKeys_ = allowedKeys;
+  deniedKeys_ = deniedKeys;
+  // the events added before the online filter is set must still cancel their opposite events in the later filters
+  addOppositeEventKeys(oppositeEventDico);
+}
+
+void
+Timeline::addOppositeEventKeys(const unordered_map<string, unordered_set<string>>& oppositeEventDico) {
+  for (const auto& oppositeEvent : oppositeEventDico) {
+    oppositeEventKeys_.insert(oppositeEvent.first);
+    oppositeEventKeys_.insert(oppositeEvent.second.begin(), oppositeEvent.second.end());
+  }
+}
+
+bool
+Timeline::isRejected(const boost::optional<int>& priority, const string& key) const {
+  if (filterMaxPriority_ && priority && *priority > *filterMaxPriority_)
+    return true;
+  if (deniedKeys_.find(key) != deniedKeys_.end())
+    return true;
+  return !allowedKeys_.empty() && allowedKeys_.find(key) == allowedKeys_.end();
+}
+
+bool
+Timeline::acceptsEvent(const boost::optional<int>& priority, const string& key) const {
+  if (!eventFilter_ || !isRejected(priority, key))
+    return true;
+  return oppositeEventKeys_.find(key) != oppositeEventKeys_.end();
+}
+
+void
+Timeline::filterPendingTimeStep() {
+  const vector<Event*> stepEvents(events_.begin() + timeStepBegin_, events_.end());
+  vector<bool> removed;
+  filterTimeStep(stepEvents, onlineOppositeEvents_, removed);
+  removeEvents(timeStepBegin_, removed);
+  timeStepBegin_ = events_.size();
 }
 
 void
 Timeline::clear() {
   events_.clear();
+  freeEvents_.clear();
+  eventPool_.clear();
+  internedStrings_.clear();
+  timeStepBegin_ = 0;
+  if (onlineFilter_)
+    onlineOppositeEvents_ = internOppositeEvents(onlineOppositeEventDico_);
 }
 
 void
 Timeline::eraseEvents(int nbEvents) {
-  std::vector<std::unique_ptr<Event> >::iterator firstPosition = events_.end();
-  for (int i = 0; i < nbEvents; i++)
-    firstPosition--;
+  std::vector<Event*>::iterator firstPosition = events_.end() - nbEvents;
+  for (std::vector<Event*>::iterator it = firstPosition; it != events_.end(); ++it)
+    releaseEvent(*it);
   events_.erase(firstPosition, events_.end());
+  timeStepBegin_ = std::min(timeStepBegin_, events_.size());
+}
+
+void
+Timeline::eraseFirstEvents(size_t nbEvents) {
+  nbEvents = std::min(nbEvents, events_.size());
+  for (size_t i = 0; i < nbEvents; ++i)
+    releaseEvent(events_[i]);
+  events_.erase(events_.begin(), events_.begin() + nbEvents);
+  timeStepBegin_ = (timeStepBegin_ > nbEvents) ? timeStepBegin_ - nbEvents : 0;
+}
+
+size_t
+Timeline::getMemoryUsage() const {
+  size_t memoryUsage = DYN::MemoryUsage::bytes(events_) + eventPool_.size() * sizeof(Event) + DYN::MemoryUsage::bytes(freeEvents_)
+      + DYN::MemoryUsage::bytes(internedStrings_);
+  // each interned string is allocated with its shared pointer control block
+  for (const auto& internedString : internedStrings_)
+    memoryUsage += sizeof(std::string) + 2 * sizeof(long) + DYN::MemoryUsage::bytes(*internedString.second);
+  return memoryUsage;
 }
 
 }  // namespace timeline
@@ -23,6 +23,7 @@
 #include "TLEvent.h"
 
 #include <boost/optional.hpp>
+#include <deque>
 #include <string>
 #include <vector>
 #include <unordered_set>
@@ -38,6 +39,10 @@ class Event;
  * @brief Timeline interface class
  *
  * Interface class for timeline object. This a container for events
+ *
+ * Events are allocated from a pool owned by the timeline and reused once erased.
+ * Model names, messages and keys are interned: events with the same strings share
+ * a single copy of them.
  */
 class Timeline {
  public:
@@ -85,6 +90,53 @@ class Timeline {
    */
   void filter(const std::unordered_map<std::string, std::unordered_set<std::string>>& oppositeEventDico);
 
+  /**
+   * @brief filter the timeline while the events are added
+   *
+   * The events of a time step are filtered as soon as an event of another time is added,
+   * so that removed events do not accumulate. The events of the last time step are only
+   * filtered by a call to filter, which leaves the already filtered time steps unchanged.
+   *
+   * @param oppositeEventDico the opposite event dictionary
+   */
+  void setOnlineFilter(const std::unordered_map<std::string, std::unordered_set<std::string>>& oppositeEventDico);
+
+  /**
+   * @brief filter the events before they are registered
+   *
+   * An event is rejected if its priority is above the maximum priority, if its key is denied or if some keys are
+   * allowed and its key is not one of them. The events whose key is in the opposite event dictionary, or in the one
+   * of the online filter, are registered anyway, so that they still cancel their opposite events, and removed once
+   * their time step is filtered.
+   *
+   * @param maxPriority maximum priority of the registered events, the events without priority being kept
+   * @param allowedKeys keys of the only events registered, all keys if empty
+   * @param deniedKeys keys of the events never registered
+   * @param oppositeEventDico opposite event dictionary of the filter applied later, empty if the timeline is not filtered
+   */
+  void setEventFilter(const boost::optional<int>& maxPriority, const std::unordered_set<std::string>& allowedKeys,
+      const std::unordered_set<std::string>& deniedKeys,
+      const std::unordered_map<std::string, std::unordered_set<std::string>>& oppositeEventDico =
+          std::unordered_map<std::string, std::unordered_set<std::string>>());
+
+  /**
+   * @brief whether events are filtered before they are registered
+   *
+   * @return true if an event filter is set
+   */
+  bool hasEventFilter() const {
+    return eventFilter_;
+  }
+
+  /**
+   * @brief whether an event would be registered, to check before formatting its message
+   *
+   * @param priority event priority, optional
+   * @param key event key, empty if none
+   * @return false if the event would be rejected by the event filter
+   */
+  bool acceptsEvent(const boost::optional<int>& priority, const std::string& key) const;
+
   /**
    * @brief Erase the nbEvents in the timeline being before lastEventPosition
    *
@@ -93,11 +145,27 @@ class Timeline {
   void eraseEvents(int nbEvents);
 
   /**
-   * @brief number of event getter
+   * @brief number of events which can not be removed by the online filter anymore
    *
-   * @return the number of events stored in timeline
+   * @return the number of oldest events which are final
    */
-  const std::vector<std::unique_ptr<Event> >& getEvents() const {
+  size_t getNbFinalEvents() const {
+    return onlineFilter_ ? timeStepBegin_ : events_.size();
+  }
+
+  /**
+   * @brief Erase the oldest events of the timeline, once they have been exported
+   *
+   * @param nbEvents number of events to delete from the timeline starting from first event
+   */
+  void eraseFirstEvents(size_t nbEvents);
+
+  /**
+   * @brief events getter
+   *
+   * @return the events stored in timeline, in insertion order
+   */
+  const std::vector<Event*>& getEvents() const {
     return events_;
   }
 
@@ -106,19 +174,142 @@ class Timeline {
    */
   void clear();
 
+  /**
+   * @brief get the memory allocated by the timeline
+   *
+   * @return number of bytes allocated for the events, their pool and the interned strings
+   */
+  size_t getMemoryUsage() const;
+
  private:
+  typedef std::unordered_map<const std::string*, std::vector<const std::string*> > InternedOppositeEvents;  ///< interned keys to their interned opposite keys
+
   /**
-   * @brief compare two events
+   * @brief compare an event with the attributes of an event to add
    *
-   * @param left first event to compare
-   * @param right second event to compare
-   * @return true if left is the same event as right
+   * @param event event to compare
+   * @param time time of the event to add
+   * @param modelName model of the event to add
+   * @param message message of the event to add
+   * @param priority priority of the event to add
+   * @return true if event is the same event as the one described by the attributes
+   */
+  bool eventEquals(const Event& event, double time, const std::string& modelName, const std::string& message,
+      const boost::optional<int>& priority) const;
+
+  /**
+   * @brief get the interned copy of a string, creating it if needed
+   *
+   * @param str string to intern
+   * @return the shared copy of the string
+   */
+  const std::shared_ptr<const std::string>& intern(const std::string& str);
+
+  /**
+   * @brief get an event from the pool
+   *
+   * @return an event, either reused or newly allocated in the pool
+   */
+  Event* allocateEvent();
+
+  /**
+   * @brief give an erased event back to the pool
+   *
+   * @param event event to release
+   */
+  void releaseEvent(Event* event);
+
+  /**
+   * @brief intern the keys of an opposite event dictionary
+   *
+   * @param oppositeEventDico the opposite event dictionary
+   * @return the interned keys associated to their interned opposite keys
+   */
+  InternedOppositeEvents internOppositeEvents(const std::unordered_map<std::string, std::unordered_set<std::string>>& oppositeEventDico);
+
+  /**
+   * @brief filter the events of a time step in a single backward pass
+   *
+   * @param stepEvents events of the time step, in insertion order
+   * @param oppositeEvents the interned opposite event dictionary
+   * @param removed whether each event of the time step is removed
+   */
+  void filterTimeStep(const std::vector<Event*>& stepEvents, const InternedOppositeEvents& oppositeEvents, std::vector<bool>& removed) const;
+
+  /**
+   * @brief remove events starting from a position, keeping the order of the others
+   *
+   * @param first position of the first event which may be removed
+   * @param removed whether each event from first is removed
+   */
+  void removeEvents(size_t first, const std::vector<bool>& removed);
+
+  /**
+   * @brief filter the events of the time step in progress in online mode
+   */
+  void filterPendingTimeStep();
+
+  /**
+   * @brief whether the event filter rejects an event, whatever the online filter
+   *
+   * @param priority event priority, optional
+   * @param key event key
+   * @return true if the event is rejected
+   */
+  bool isRejected(const boost::optional<int>& priority, const std::string& key) const;
+
+  /**
+   * @brief register anyway the events whose key is in an opposite event dictionary
+   *
+   * @param oppositeEventDico the opposite event dictionary
+   */
+  void addOppositeEventKeys(const std::unordered_map<std::string, std::unordered_set<std::string>>& oppositeEventDico);
+
+  /**
+   * @brief hash of an interned string through its pointer
+   */
+  struct StringPtrHash {
+    /**
+     * @brief compute the hash of the pointed string
+     * @param str pointer to the string
+     * @return hash of the string
+     */
+    std::size_t operator()(const std::string* str) const {
+      return std::hash<std::string>()(*str);
+    }
+  };
+
+  /**
+   * @brief equality of interned strings through their pointers
    */
-  bool eventEquals(const Event& left, const Event& right) const;
+  struct StringPtrEqual {
+    /**
+     * @brief compare the pointed strings
+     * @param left first string to compare
+     * @param right second string to compare
+     * @return true if both strings are equal
+     */
+    bool operator()(const std::string* left, const std::string* right) const {
+      return *left == *right;
+    }
+  };
 
  private:
-  std::vector<std::unique_ptr<Event> > events_;  ///< Array of events
-  std::string id_;                               ///< Timeline's id
+  std::vector<Event*> events_;  ///< Array of events
+  std::deque<Event> eventPool_;  ///< Storage of the events, stable when growing
+  std::vector<Event*> freeEvents_;  ///< Events of the pool available for reuse
+  std::unordered_map<const std::string*, std::shared_ptr<const std::string>, StringPtrHash, StringPtrEqual>
+      internedStrings_;  ///< Interned strings, indexed by the string they own
+  std::string id_;  ///< Timeline's id
+  bool onlineFilter_;  ///< whether events are filtered while they are added
+  std::unordered_map<std::string, std::unordered_set<std::string>> onlineOppositeEventDico_;  ///< opposite event dictionary of the online filter
+  InternedOppositeEvents onlineOppositeEvents_;  ///< interned opposite event dictionary of the online filter
+  size_t timeStepBegin_;  ///< position of the first event of the time step in progress in online mode
+  bool eventFilter_;  ///< whether events are filtered before they are registered
+  boost::optional<int> filterMaxPriority_;  ///< maximum priority of the registered events
+  std::unordered_set<std::string> allowedKeys_;  ///< keys of the only events registered, all keys if empty
+  std::unordered_set<std::string> deniedKeys_;  ///< keys of the events never registered
+  std::unordered_set<std::string> oppositeEventKeys_;  ///< keys of the opposite event dictionaries, registered anyway
 };
 
 }  // namespace timeline
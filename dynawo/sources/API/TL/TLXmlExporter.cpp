@@ -19,11 +19,9 @@
 #include <fstream>
 #include <sstream>
 
-#include <xml/sax/formatter/AttributeList.h>
-#include <xml/sax/formatter/Formatter.h>
-
 #include "DYNMacrosMessage.h"
 #include "DYNCommon.h"
+#include "DYNXmlStreamWriter.h"
 #include "TLXmlExporter.h"
 #include "TLTimeline.h"
 
@@ -31,10 +29,6 @@ using std::fstream;
 using std::ostream;
 using std::string;
 
-using xml::sax::formatter::AttributeList;
-using xml::sax::formatter::Formatter;
-using xml::sax::formatter::FormatterPtr;
-
 namespace timeline {
 
 void
@@ -51,27 +45,25 @@ XmlExporter::exportToFile(const boost::shared_ptr<Timeline>& timeline, const str
 
 void
 XmlExporter::exportToStream(const boost::shared_ptr<Timeline>& timeline, ostream& stream) const {
-  FormatterPtr formatter = Formatter::createFormatter(stream, "http://www.rte-france.com/dynawo");
+  DYN::XmlStreamWriter writer(stream, "http://www.rte-france.com/dynawo");
 
-  formatter->startDocument();
-  AttributeList attrs;
-  formatter->startElement("timeline", attrs);
+  writer.startDocument();
+  writer.startElement("timeline");
   for (const auto& event : timeline->getEvents()) {
     if (event->hasPriority() && maxPriority_ != boost::none && event->getPriority() > maxPriority_)
       continue;
-    attrs.clear();
+    writer.startElement("event");
     if (exportWithTime_)
-      attrs.add("time", DYN::double2String(event->getTime()));
-    attrs.add("modelName", event->getModelName());
-    attrs.add("message", event->getMessage());
+      writer.addAttribute("time", event->getTime(), DYN::XmlStreamWriter::DOUBLE_PRECISION);
+    writer.addAttribute("modelName", event->getModelName());
+    writer.addAttribute("message", event->getMessage());
     if (event->hasPriority()) {
-      attrs.add("priority", event->getPriority());
+      writer.addAttribute("priority", event->getPriority());
     }
-    formatter->startElement("event", attrs);
-    formatter->endElement();  // event
+    writer.endElement();  // event
   }
-  formatter->endElement();  // timeline
-  formatter->endDocument();
+  writer.endElement();  // timeline
+  writer.endDocument();
 }
 
 
@@ -20,6 +20,9 @@
 #include "gtest_dynawo.h"
 
 #include <boost/optional.hpp>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "TLTimeline.h"
 #include "TLTimelineFactory.h"
@@ -27,6 +30,7 @@
 #include "TLCsvExporter.h"
 #include "TLTxtExporter.h"
 #include "TLJsonExporter.h"
+#include "TLStreamExporter.h"
 #include "TestUtil.h"
 
 using boost::shared_ptr;
@@ -103,4 +107,44 @@ TEST(APITLTest, TimelineExporters) {
   ASSERT_TRUE(compareFiles("testJsonTimelineExportWithoutTime.json", "res/testJsonTimelineExportWithoutTime.json"));
 }
 
+//-----------------------------------------------------
+// TEST stream the timeline while events are added, the files being the same as the ones of the batch exporters
+//-----------------------------------------------------
+
+TEST(APITLTest, TimelineStreamExporters) {
+  const std::vector<std::pair<StreamExporter::Format_t, std::string> > formats = {
+    {StreamExporter::XML, "testXmlTimelineExport.xml"},
+    {StreamExporter::CSV, "testCsvTimelineExport.csv"},
+    {StreamExporter::TXT, "testTxtTimelineExport.txt"}};
+  for (const auto& format : formats) {
+    shared_ptr<Timeline> timeline = TimelineFactory::newInstance("timeline");
+    boost::optional<int> priority1 = 10;
+    boost::optional<int> priority2 = 5;
+    boost::optional<int> priorityNone = boost::none;
+    StreamExporter exporter(format.first, 2);
+    const std::string fileName = "testStream" + format.second.substr(4);
+    ASSERT_NO_THROW(exporter.open(timeline, fileName));
+
+    timeline->addEvent(10, "model1", "event1 at 10s", priorityNone, "");
+    exporter.update();
+    timeline->addEvent(10, "model1", "event2 at 10s", priority2, "");
+    exporter.update();
+    // the last event is kept to drop its duplicates
+    ASSERT_EQ(timeline->getSizeEvents(), 1);
+    timeline->addEvent(10, "model1", "event2 at 10s", priority2, "");
+    exporter.update();
+    timeline->addEvent(10, "model2", "event1 at 10s", priorityNone, "");
+    exporter.update();
+    timeline->addEvent(20, "model2", "event2 at 20s", priority1, "");
+    exporter.update();
+    timeline->addEvent(30, "model2", "event3 at 30s", priorityNone, "");
+    exporter.update();
+    ASSERT_EQ(timeline->getSizeEvents(), 1);
+
+    exporter.close();
+    ASSERT_EQ(timeline->getSizeEvents(), 0);
+    ASSERT_TRUE(compareFiles(fileName, "res/" + format.second));
+  }
+}
+
 }  // namespace timeline
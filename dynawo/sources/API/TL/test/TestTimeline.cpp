@@ -79,6 +79,37 @@ TEST(APITLTest, TimelineEraseEvents) {
   ASSERT_EQ(timeline->getEvents()[1]->getMessage(), "event2 at 10s");
 }
 
+//-----------------------------------------------------
+// TEST events share their interned strings and reuse erased events
+//-----------------------------------------------------
+
+TEST(APITLTest, TimelineInternedEvents) {
+  boost::shared_ptr<Timeline> timeline = TimelineFactory::newInstance("timeline");
+  boost::optional<int> priorityNone = boost::none;
+
+  timeline->addEvent(10, "model1", "disconnection", priorityNone, "Disconnection");
+  timeline->addEvent(20, "model1", "disconnection", priorityNone, "Disconnection");
+  timeline->addEvent(20, "model2", "disconnection", priorityNone, "Disconnection");
+
+  const auto& events = timeline->getEvents();
+  ASSERT_EQ(events.size(), 3);
+  ASSERT_EQ(&events[0]->getModelName(), &events[1]->getModelName());
+  ASSERT_NE(&events[1]->getModelName(), &events[2]->getModelName());
+  ASSERT_EQ(&events[0]->getMessage(), &events[2]->getMessage());
+  ASSERT_EQ(&events[0]->getKey(), &events[2]->getKey());
+  ASSERT_EQ(events[2]->getModelName(), "model2");
+
+  const Event* erasedEvent = events[2];
+  timeline->eraseEvents(1);
+  timeline->addEvent(30, "model3", "connection", priorityNone, "Connection");
+  ASSERT_EQ(timeline->getSizeEvents(), 3);
+  ASSERT_EQ(events[2], erasedEvent);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(events[2]->getTime(), 30);
+  ASSERT_EQ(events[2]->getModelName(), "model3");
+  ASSERT_EQ(events[2]->getMessage(), "connection");
+  ASSERT_EQ(events[2]->getKey(), "Connection");
+}
+
 TEST(APITLTest, TimelineFilter) {
   boost::optional<int> priorityNone = boost::none;
   boost::shared_ptr<Timeline> timeline = TimelineFactory::newInstance("timeline");
@@ -155,4 +186,122 @@ TEST(APITLTest, TimelineFilter) {
   timeline->clear();
   ASSERT_EQ(timeline->getEvents().size(), 0);
 }
+
+TEST(APITLTest, TimelineOnlineFilter) {
+  boost::optional<int> priorityNone = boost::none;
+  boost::shared_ptr<Timeline> timeline = TimelineFactory::newInstance("timeline");
+
+  std::unordered_map<std::string, std::unordered_set<std::string>> oppositeEventDico;
+  oppositeEventDico["ActivatePMIN"].insert("DeactivatePMIN");
+  oppositeEventDico["DeactivatePMIN"].insert("ActivatePMIN");
+  timeline->setOnlineFilter(oppositeEventDico);
+
+  timeline->addEvent(0, "GEN____8_SM", "PMIN : activation", priorityNone, "ActivatePMIN");
+  timeline->addEvent(0, "GEN____3_SM", "PMIN : activation", priorityNone, "ActivatePMIN");
+  timeline->addEvent(0, "GEN____3_SM", "PMIN : deactivation", priorityNone, "DeactivatePMIN");
+  timeline->addEvent(0, "GEN____8_SM", "PMIN : activation", priorityNone, "ActivatePMIN");
+  ASSERT_EQ(timeline->getSizeEvents(), 4);
+
+  // the first time step is filtered when the second one starts
+  timeline->addEvent(1, "GEN____3_SM", "PMIN : activation", priorityNone, "ActivatePMIN");
+  timeline->addEvent(1, "GEN____3_SM", "PMIN : deactivation", priorityNone, "DeactivatePMIN");
+  ASSERT_EQ(timeline->getSizeEvents(), 4);
+  ASSERT_EQ(timeline->getEvents()[0]->getModelName(), "GEN____3_SM");
+  ASSERT_EQ(timeline->getEvents()[0]->getMessage(), "PMIN : deactivation");
+  ASSERT_EQ(timeline->getEvents()[1]->getModelName(), "GEN____8_SM");
+  ASSERT_EQ(timeline->getEvents()[1]->getMessage(), "PMIN : activation");
+
+  timeline->filter(oppositeEventDico);
+  ASSERT_EQ(timeline->getSizeEvents(), 3);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(timeline->getEvents()[2]->getTime(), 1);
+  ASSERT_EQ(timeline->getEvents()[2]->getMessage(), "PMIN : deactivation");
+}
+
+TEST(APITLTest, TimelineEventFilter) {
+  boost::optional<int> priorityNone = boost::none;
+  boost::optional<int> priority1 = 1;
+  boost::optional<int> priority4 = 4;
+  boost::shared_ptr<Timeline> timeline = TimelineFactory::newInstance("timeline");
+  ASSERT_FALSE(timeline->hasEventFilter());
+  ASSERT_TRUE(timeline->acceptsEvent(priority4, "LineOpen"));
+
+  std::unordered_set<std::string> deniedKeys;
+  deniedKeys.insert("LineOpen");
+  timeline->setEventFilter(2, std::unordered_set<std::string>(), deniedKeys);
+  ASSERT_TRUE(timeline->hasEventFilter());
+  ASSERT_FALSE(timeline->acceptsEvent(priority4, "LineClosed"));
+  ASSERT_FALSE(timeline->acceptsEvent(priority1, "LineOpen"));
+  ASSERT_TRUE(timeline->acceptsEvent(priority1, "LineClosed"));
+  ASSERT_TRUE(timeline->acceptsEvent(priorityNone, "LineClosed"));
+
+  timeline->addEvent(0, "LINE1", "LINE : opening both sides", priority1, "LineOpen");
+  timeline->addEvent(0, "LINE2", "LINE : closing both sides", priority4, "LineClosed");
+  timeline->addEvent(0, "LINE3", "LINE : closing both sides", priority1, "LineClosed");
+  timeline->addEvent(0, "LINE4", "LINE : closing both sides", priorityNone, "LineClosed");
+  ASSERT_EQ(timeline->getSizeEvents(), 2);
+  ASSERT_EQ(timeline->getEvents()[0]->getModelName(), "LINE3");
+  ASSERT_EQ(timeline->getEvents()[1]->getModelName(), "LINE4");
+
+  // with allowed keys, only these keys are registered
+  std::unordered_set<std::string> allowedKeys;
+  allowedKeys.insert("LineOpen");
+  timeline->setEventFilter(priorityNone, allowedKeys, std::unordered_set<std::string>());
+  ASSERT_TRUE(timeline->acceptsEvent(priority4, "LineOpen"));
+  ASSERT_FALSE(timeline->acceptsEvent(priorityNone, "LineClosed"));
+}
+
+TEST(APITLTest, TimelineEventFilterWithOnlineFilter) {
+  boost::optional<int> priorityNone = boost::none;
+  boost::shared_ptr<Timeline> timeline = TimelineFactory::newInstance("timeline");
+
+  std::unordered_map<std::string, std::unordered_set<std::string>> oppositeEventDico;
+  oppositeEventDico["ActivatePMIN"].insert("DeactivatePMIN");
+  oppositeEventDico["DeactivatePMIN"].insert("ActivatePMIN");
+  timeline->setOnlineFilter(oppositeEventDico);
+  timeline->setEventFilter(priorityNone, std::unordered_set<std::string>(), {"DeactivatePMIN"});
+
+  // a denied event of the opposite event dictionary is registered to cancel its opposite event
+  ASSERT_TRUE(timeline->acceptsEvent(priorityNone, "DeactivatePMIN"));
+  timeline->addEvent(0, "GEN____3_SM", "PMIN : activation", priorityNone, "ActivatePMIN");
+  timeline->addEvent(0, "GEN____3_SM", "PMIN : deactivation", priorityNone, "DeactivatePMIN");
+  timeline->addEvent(0, "GEN____8_SM", "PMIN : deactivation", priorityNone, "DeactivatePMIN");
+  ASSERT_EQ(timeline->getSizeEvents(), 3);
+
+  // and removed once its time step is filtered
+  timeline->addEvent(1, "GEN____8_SM", "PMIN : activation", priorityNone, "ActivatePMIN");
+  ASSERT_EQ(timeline->getSizeEvents(), 1);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(timeline->getEvents()[0]->getTime(), 1);
+
+  timeline->addEvent(1, "GEN____3_SM", "PMIN : deactivation", priorityNone, "DeactivatePMIN");
+  timeline->filter(oppositeEventDico);
+  ASSERT_EQ(timeline->getSizeEvents(), 1);
+  ASSERT_EQ(timeline->getEvents()[0]->getModelName(), "GEN____8_SM");
+}
+
+TEST(APITLTest, TimelineEventFilterBeforeOnlineFilter) {
+  boost::optional<int> priorityNone = boost::none;
+  boost::shared_ptr<Timeline> timeline = TimelineFactory::newInstance("timeline");
+
+  std::unordered_map<std::string, std::unordered_set<std::string>> oppositeEventDico;
+  oppositeEventDico["ActivatePMIN"].insert("DeactivatePMIN");
+  oppositeEventDico["DeactivatePMIN"].insert("ActivatePMIN");
+  timeline->setEventFilter(priorityNone, std::unordered_set<std::string>(), {"DeactivatePMIN"}, oppositeEventDico);
+
+  // a denied event of the opposite event dictionary is registered even before the online filter is set
+  ASSERT_TRUE(timeline->acceptsEvent(priorityNone, "DeactivatePMIN"));
+  timeline->addEvent(0, "GEN____3_SM", "PMIN : activation", priorityNone, "ActivatePMIN");
+  timeline->addEvent(0, "GEN____3_SM", "PMIN : deactivation", priorityNone, "DeactivatePMIN");
+  timeline->addEvent(0, "GEN____8_SM", "PMIN : activation", priorityNone, "ActivatePMIN");
+  ASSERT_EQ(timeline->getSizeEvents(), 3);
+
+  // so that it still cancels its opposite event, and is then removed
+  timeline->filter(oppositeEventDico);
+  ASSERT_EQ(timeline->getSizeEvents(), 1);
+  ASSERT_EQ(timeline->getEvents()[0]->getModelName(), "GEN____8_SM");
+
+  // without opposite event dictionary, a denied event is rejected
+  boost::shared_ptr<Timeline> unfilteredTimeline = TimelineFactory::newInstance("timeline");
+  unfilteredTimeline->setEventFilter(priorityNone, std::unordered_set<std::string>(), {"DeactivatePMIN"});
+  ASSERT_FALSE(unfilteredTimeline->acceptsEvent(priorityNone, "DeactivatePMIN"));
+}
 }  // namespace timeline
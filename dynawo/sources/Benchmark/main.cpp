@@ -0,0 +1,265 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  main.cpp
+ *
+ * @brief micro benchmarks of the model evaluations and of the linear algebra kernels, on initialized jobs
+ *
+ * Usage: dynawo-bench [benchmark options] <jobs-file>...
+ * The first job of each jobs file is initialized, then each kernel is timed in isolation on its initial state.
+ * The google benchmark options apply, e.g. --benchmark_out=bench.json --benchmark_out_format=json for the CI.
+ */
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nvector/nvector_serial.h>
+#include <sundials/sundials_context.h>
+#include <sunmatrix/sunmatrix_sparse.h>
+
+#include "DYNError.h"
+#include "DYNMessageError.h"
+#include "DYNMacrosMessage.h"
+#include "DYNExecUtils.h"
+#include "DYNFileSystemUtils.h"
+#include "DYNInitXml.h"
+#include "DYNIoDico.h"
+#include "DYNTrace.h"
+#include "DYNModel.h"
+#include "DYNSparseMatrix.h"
+#include "DYNSolverCommon.h"
+#include "DYNLinearSolver.h"
+#include "DYNSimulation.h"
+#include "DYNSimulationContext.h"
+#include "JOBXmlImporter.h"
+#include "JOBJobsCollection.h"
+#include "JOBJobEntry.h"
+
+using DYN::Model;
+using DYN::Simulation;
+using DYN::SimulationContext;
+using DYN::SparseMatrix;
+
+/**
+ * @brief initialized job whose kernels are timed
+ */
+struct BenchmarkCase {
+  std::string name;  ///< name of the case, the name of its job
+  std::shared_ptr<Simulation> simulation;  ///< initialized simulation, owner of the model
+  double t;  ///< time of the evaluations
+  std::vector<double> y;  ///< continuous variables of the evaluations
+  std::vector<double> yp;  ///< derivatives of the continuous variables of the evaluations
+};
+
+/**
+ * @brief initialize the first job of a jobs file
+ *
+ * @param jobsFileName jobs file
+ * @return initialized case
+ */
+static std::shared_ptr<BenchmarkCase>
+loadCase(const std::string& jobsFileName) {
+  job::XmlImporter importer;
+  const std::shared_ptr<job::JobsCollection> jobsCollection = importer.importFromFile(jobsFileName);
+  if (jobsCollection->getJobs().empty())
+    throw DYNError(DYN::Error::SIMULATION, NoJobDefined);
+  const std::shared_ptr<job::JobEntry>& job = jobsCollection->getJobs().front();
+  const std::string prefixJobFile = absolute(removeFileName(jobsFileName));
+
+  const auto context = std::make_shared<SimulationContext>();
+  context->setResourcesDirectory(getMandatoryEnvVar("DYNAWO_RESOURCES_DIR"));
+  context->setLocale(getMandatoryEnvVar("DYNAWO_LOCALE"));
+  context->setInputDirectory(prefixJobFile);
+  context->setWorkingDirectory(prefixJobFile);
+
+  const auto benchmarkCase = std::make_shared<BenchmarkCase>();
+  benchmarkCase->name = job->getName();
+  benchmarkCase->simulation = std::make_shared<Simulation>(job, context);
+  benchmarkCase->simulation->init();
+  benchmarkCase->t = benchmarkCase->simulation->getCurrentTime();
+  benchmarkCase->simulation->getModel()->getY0(benchmarkCase->t, benchmarkCase->y, benchmarkCase->yp);
+  return benchmarkCase;
+}
+
+/**
+ * @brief evaluate the transposed Jacobian of a case in a matrix
+ *
+ * @param benchmarkCase case
+ * @param jt matrix to fill
+ */
+static void
+evalJt(const BenchmarkCase& benchmarkCase, SparseMatrix& jt) {
+  Model& model = *benchmarkCase.simulation->getModel();
+  const double cj = 1.;
+  jt.init(model.sizeY(), model.sizeY());
+  model.copyContinuousVariables(&benchmarkCase.y[0], &benchmarkCase.yp[0]);
+  model.evalJt(benchmarkCase.t, cj, jt);
+}
+
+static void
+benchmarkEvalF(benchmark::State& state, const std::shared_ptr<BenchmarkCase>& benchmarkCase) {
+  Model& model = *benchmarkCase->simulation->getModel();
+  std::vector<double> f(model.sizeF());
+  for (auto _ : state) {
+    model.evalF(benchmarkCase->t, &benchmarkCase->y[0], &benchmarkCase->yp[0], &f[0]);
+    benchmark::DoNotOptimize(f.data());
+  }
+  state.counters["sizeF"] = model.sizeF();
+}
+
+static void
+benchmarkEvalG(benchmark::State& state, const std::shared_ptr<BenchmarkCase>& benchmarkCase) {
+  Model& model = *benchmarkCase->simulation->getModel();
+  std::vector<DYN::state_g> g(model.sizeG());
+  model.copyContinuousVariables(&benchmarkCase->y[0], &benchmarkCase->yp[0]);
+  for (auto _ : state) {
+    model.evalG(benchmarkCase->t, g);
+    benchmark::DoNotOptimize(g.data());
+  }
+  state.counters["sizeG"] = model.sizeG();
+}
+
+static void
+benchmarkEvalZ(benchmark::State& state, const std::shared_ptr<BenchmarkCase>& benchmarkCase) {
+  Model& model = *benchmarkCase->simulation->getModel();
+  model.copyContinuousVariables(&benchmarkCase->y[0], &benchmarkCase->yp[0]);
+  for (auto _ : state)
+    model.evalZ(benchmarkCase->t);
+  state.counters["sizeZ"] = model.sizeZ();
+}
+
+static void
+benchmarkEvalJt(benchmark::State& state, const std::shared_ptr<BenchmarkCase>& benchmarkCase) {
+  SparseMatrix jt;
+  for (auto _ : state)
+    evalJt(*benchmarkCase, jt);
+  state.counters["nnz"] = jt.nbElem();
+}
+
+static void
+benchmarkSparseMatrixAssembly(benchmark::State& state, const std::shared_ptr<BenchmarkCase>& benchmarkCase) {
+  // the terms of the Jacobian are added again, without the model evaluation
+  SparseMatrix jt;
+  evalJt(*benchmarkCase, jt);
+  const int size = benchmarkCase->simulation->getModel()->sizeY();
+  SparseMatrix matrix;
+  for (auto _ : state) {
+    matrix.init(size, size);
+    for (int col = 0; col < size; ++col) {
+      matrix.changeCol();
+      for (unsigned ind = jt.Ap_[col]; ind < jt.Ap_[col + 1]; ++ind)
+        matrix.addTerm(jt.Ai_[ind], jt.Ax_[ind]);
+    }
+    matrix.changeCol();
+  }
+  state.counters["nnz"] = jt.nbElem();
+}
+
+static void
+benchmarkCopySparseToKINSOL(benchmark::State& state, const std::shared_ptr<BenchmarkCase>& benchmarkCase) {
+  SparseMatrix jt;
+  evalJt(*benchmarkCase, jt);
+  const int size = benchmarkCase->simulation->getModel()->sizeY();
+  SUNContext context;
+  if (SUNContext_Create(NULL, &context) != 0)
+    throw DYNError(DYN::Error::SUNDIALS_ERROR, SolverContextCreationError);
+  SUNMatrix JJ = SUNSparseMatrix(size, size, jt.nbElem(), CSR_MAT, context);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(DYN::SolverCommon::copySparseToKINSOL(jt, JJ, size, NULL));
+  SUNMatDestroy(JJ);
+  SUNContext_Free(&context);
+  state.counters["nnz"] = jt.nbElem();
+}
+
+static void
+benchmarkKLURefactorization(benchmark::State& state, const std::shared_ptr<BenchmarkCase>& benchmarkCase) {
+  SparseMatrix jt;
+  evalJt(*benchmarkCase, jt);
+  const int size = benchmarkCase->simulation->getModel()->sizeY();
+  SUNContext context;
+  if (SUNContext_Create(NULL, &context) != 0)
+    throw DYNError(DYN::Error::SUNDIALS_ERROR, SolverContextCreationError);
+  SUNMatrix JJ = SUNSparseMatrix(size, size, jt.nbElem(), CSR_MAT, context);
+  DYN::SolverCommon::copySparseToKINSOL(jt, JJ, size, NULL);
+  N_Vector y = N_VNew_Serial(size, context);
+  SUNLinearSolver linearSolver = DYN::LinearSolver::create(DYN::LinearSolver::KLU, 1, y, JJ, context);
+  // the first setup performs the symbolic analysis and the full factorization, the next ones only refactorize
+  if (SUNLinSolSetup(linearSolver, JJ) != SUNLS_SUCCESS) {
+    state.SkipWithError("singular Jacobian");
+  } else {
+    for (auto _ : state)
+      SUNLinSolSetup(linearSolver, JJ);
+  }
+  SUNLinSolFree(linearSolver);
+  N_VDestroy(y);
+  SUNMatDestroy(JJ);
+  SUNContext_Free(&context);
+  state.counters["nnz"] = jt.nbElem();
+}
+
+/**
+ * @brief main function of the benchmarks
+ *
+ * @param argc number of arguments passed to the program
+ * @param argv pointer to the first element of an array of pointers to arguments
+ *
+ * @return @b 0 if everything works fine, other value else
+ */
+int main(int argc, char ** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (argc < 2) {
+    std::cout << "Usage: dynawo-bench [benchmark options] <jobs-file>..." << std::endl;
+    return 1;
+  }
+
+  try {
+    DYN::InitXerces xerces;
+    DYN::InitLibXml2 libxml2;
+    DYN::IoDicos& dicos = DYN::IoDicos::instance();
+    dicos.addPath(getMandatoryEnvVar("DYNAWO_RESOURCES_DIR"));
+    dicos.addDicos(getMandatoryEnvVar("DYNAWO_DICTIONARIES"));
+    DYN::Trace::init();
+
+    std::vector<std::shared_ptr<BenchmarkCase> > benchmarkCases;
+    for (int i = 1; i < argc; ++i) {
+      const std::shared_ptr<BenchmarkCase> benchmarkCase = loadCase(argv[i]);
+      benchmarkCases.push_back(benchmarkCase);
+      benchmark::RegisterBenchmark(("evalF/" + benchmarkCase->name).c_str(), benchmarkEvalF, benchmarkCase);
+      benchmark::RegisterBenchmark(("evalG/" + benchmarkCase->name).c_str(), benchmarkEvalG, benchmarkCase);
+      benchmark::RegisterBenchmark(("evalZ/" + benchmarkCase->name).c_str(), benchmarkEvalZ, benchmarkCase);
+      benchmark::RegisterBenchmark(("evalJt/" + benchmarkCase->name).c_str(), benchmarkEvalJt, benchmarkCase);
+      benchmark::RegisterBenchmark(("sparseMatrixAssembly/" + benchmarkCase->name).c_str(), benchmarkSparseMatrixAssembly, benchmarkCase);
+      benchmark::RegisterBenchmark(("copySparseToKINSOL/" + benchmarkCase->name).c_str(), benchmarkCopySparseToKINSOL, benchmarkCase);
+      benchmark::RegisterBenchmark(("kluRefactorization/" + benchmarkCase->name).c_str(), benchmarkKLURefactorization, benchmarkCase);
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    for (const auto& benchmarkCase : benchmarkCases)
+      benchmarkCase->simulation->clean();
+  } catch (const DYN::Error& e) {
+    std::cerr << "DYN Error: " << e.what() << std::endl;
+    return e.type();
+  } catch (const DYN::MessageError& e) {
+    std::cerr << e.what() << std::endl;
+    return -1;
+  } catch (std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return -1;
+  }
+  return 0;
+}
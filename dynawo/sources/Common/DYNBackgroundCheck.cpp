@@ -0,0 +1,117 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNBackgroundCheck.cpp
+ *
+ * @brief Check run on a worker thread implementation
+ *
+ */
+#include "DYNBackgroundCheck.h"
+
+#include <cassert>
+
+namespace DYN {
+
+BackgroundCheck::BackgroundCheck(const std::function<bool(double)>& check) :
+check_(check),
+pending_(false),
+submitted_(false),
+done_(false),
+stop_(false),
+time_(0.),
+result_(true),
+worker_(&BackgroundCheck::workerLoop, this) {
+}
+
+BackgroundCheck::~BackgroundCheck() {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (pending_)
+      doneCondition_.wait(lock, [this]() { return done_; });
+    stop_ = true;
+  }
+  startCondition_.notify_one();
+  worker_.join();
+}
+
+void
+BackgroundCheck::submit(const double t) {
+  assert(!pending_ && "BackgroundCheck: the previous check has to be collected first");
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    time_ = t;
+    submitted_ = true;
+    done_ = false;
+    exception_ = std::exception_ptr();
+  }
+  pending_ = true;
+  startCondition_.notify_one();
+}
+
+bool
+BackgroundCheck::isDone() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return done_;
+}
+
+bool
+BackgroundCheck::wait() {
+  if (!pending_)
+    return true;
+  std::exception_ptr exception;
+  bool result;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    doneCondition_.wait(lock, [this]() { return done_; });
+    result = result_;
+    exception = exception_;
+  }
+  pending_ = false;
+  if (exception)
+    std::rethrow_exception(exception);
+  return result;
+}
+
+void
+BackgroundCheck::workerLoop() {
+  while (true) {
+    double t;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      startCondition_.wait(lock, [this]() { return stop_ || submitted_; });
+      if (stop_)
+        return;
+      submitted_ = false;
+      t = time_;
+    }
+
+    bool result = false;
+    std::exception_ptr exception;
+    try {
+      result = check_(t);
+    } catch (...) {
+      exception = std::current_exception();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      result_ = result;
+      exception_ = exception;
+      done_ = true;
+    }
+    doneCondition_.notify_all();
+  }
+}
+
+}  // namespace DYN
@@ -0,0 +1,119 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNBackgroundCheck.h
+ *
+ * @brief Check run on a worker thread while the calling thread keeps working
+ *
+ */
+#ifndef COMMON_DYNBACKGROUNDCHECK_H_
+#define COMMON_DYNBACKGROUNDCHECK_H_
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include <boost/core/noncopyable.hpp>
+
+namespace DYN {
+
+/**
+ * @class BackgroundCheck
+ * @brief Run a boolean check on a dedicated worker thread, one check at a time
+ *
+ * The calling thread submits a check for a given time and collects its result later on.
+ * The data read by the check must not be modified by the calling thread between the
+ * submission and the collection of the result.
+ */
+class BackgroundCheck : private boost::noncopyable {
+ public:
+  /**
+   * @brief constructor: starts the worker thread
+   *
+   * @param check function run by the worker, called with the time of the check and returning @b true if it succeeds
+   */
+  explicit BackgroundCheck(const std::function<bool(double)>& check);
+
+  /**
+   * @brief destructor: waits for the pending check and joins the worker
+   */
+  ~BackgroundCheck();
+
+  /**
+   * @brief submit a check, no check must be pending
+   *
+   * @param t time of the check
+   */
+  void submit(double t);
+
+  /**
+   * @brief whether a check was submitted and its result not collected yet
+   *
+   * @return @b true if a check is pending
+   */
+  bool isPending() const {
+    return pending_;
+  }
+
+  /**
+   * @brief whether the pending check is over, does not block
+   *
+   * @return @b true if the result of the pending check is available
+   */
+  bool isDone() const;
+
+  /**
+   * @brief time of the pending check
+   *
+   * @return time given when submitting the pending check
+   */
+  double getTime() const {
+    return time_;
+  }
+
+  /**
+   * @brief wait for the pending check and collect its result
+   *
+   * The exception thrown by the check, if any, is rethrown here.
+   *
+   * @return result of the pending check, @b true if no check is pending
+   */
+  bool wait();
+
+ private:
+  /**
+   * @brief main loop of the worker thread
+   */
+  void workerLoop();
+
+ private:
+  std::function<bool(double)> check_;  ///< check run by the worker
+  mutable std::mutex mutex_;  ///< mutex protecting the state of the check
+  std::condition_variable startCondition_;  ///< condition notified when a check is submitted or when the worker stops
+  std::condition_variable doneCondition_;  ///< condition notified when a check is over
+  bool pending_;  ///< @b true if a check was submitted and its result not collected yet, only used by the calling thread
+  bool submitted_;  ///< @b true if a check is waiting for the worker
+  bool done_;  ///< @b true if the last submitted check is over
+  bool stop_;  ///< @b true if the worker must exit
+  double time_;  ///< time of the last submitted check
+  bool result_;  ///< result of the last check
+  std::exception_ptr exception_;  ///< exception thrown by the last check
+  std::thread worker_;  ///< worker thread, started last once the state is initialized
+};
+
+}  // namespace DYN
+
+#endif  // COMMON_DYNBACKGROUNDCHECK_H_
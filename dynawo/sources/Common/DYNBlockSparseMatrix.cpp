@@ -0,0 +1,150 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNBlockSparseMatrix.cpp
+ *
+ * @brief Block sparse matrix class implementation
+ *
+ */
+#include <algorithm>
+#include <cassert>
+
+#include "DYNBlockSparseMatrix.h"
+
+using std::vector;
+
+namespace DYN {
+
+BlockSparseMatrix::BlockSparseMatrix() :
+nbRow_(0),
+nbCol_(0) { }
+
+void
+BlockSparseMatrix::build(const SparseMatrix& M, const vector<int>& blockStarts, const double minDensity) {
+  nbRow_ = M.nbRow();
+  nbCol_ = M.nbCol();
+  denseStarts_.clear();
+  denseSizes_.clear();
+  denseOffsets_.clear();
+  denseValues_.clear();
+  if (nbRow_ == 0 || nbCol_ == 0) {
+    nbRow_ = 0;
+    nbCol_ = 0;
+    sparse_.init(0, 0);
+    return;
+  }
+
+  // dense block of each column, -1 outside the dense blocks
+  vector<int> denseBlockOfCol(nbCol_, -1);
+  const int size = std::min(nbRow_, nbCol_);
+  for (unsigned i = 0; i < blockStarts.size(); ++i) {
+    const int start = blockStarts[i];
+    const int end = std::min(i + 1 < blockStarts.size() ? blockStarts[i + 1] : size, size);
+    assert(start >= 0 && start <= end);
+    const int blockSize = end - start;
+    if (blockSize < 2)
+      continue;
+    std::size_t nbTerms = 0;
+    for (int col = start; col < end; ++col) {
+      for (unsigned ind = M.Ap_[col]; ind < M.Ap_[col + 1]; ++ind) {
+        if (static_cast<int>(M.Ai_[ind]) >= start && static_cast<int>(M.Ai_[ind]) < end)
+          ++nbTerms;
+      }
+    }
+    if (nbTerms < minDensity * blockSize * blockSize)
+      continue;
+    std::fill(denseBlockOfCol.begin() + start, denseBlockOfCol.begin() + end, static_cast<int>(denseStarts_.size()));
+    denseStarts_.push_back(start);
+    denseSizes_.push_back(blockSize);
+    denseOffsets_.push_back(denseValues_.size());
+    denseValues_.resize(denseValues_.size() + static_cast<std::size_t>(blockSize) * blockSize, 0.);
+  }
+
+  sparse_.init(nbRow_, nbCol_);
+  for (int col = 0; col < nbCol_; ++col) {
+    sparse_.changeCol();
+    const int block = denseBlockOfCol[col];
+    for (unsigned ind = M.Ap_[col]; ind < M.Ap_[col + 1]; ++ind) {
+      const int row = static_cast<int>(M.Ai_[ind]);
+      if (block >= 0 && row >= denseStarts_[block] && row < denseStarts_[block] + denseSizes_[block]) {
+        const std::size_t position = denseOffsets_[block] + static_cast<std::size_t>(col - denseStarts_[block]) * denseSizes_[block]
+            + (row - denseStarts_[block]);
+        denseValues_[position] += M.Ax_[ind];
+      } else {
+        sparse_.addTerm(row, M.Ax_[ind]);
+      }
+    }
+  }
+}
+
+void
+BlockSparseMatrix::toSparseMatrix(SparseMatrix& M) const {
+  M.init(nbRow_, nbCol_);
+  unsigned block = 0;
+  for (int col = 0; col < nbCol_; ++col) {
+    M.changeCol();
+    while (block < denseStarts_.size() && denseStarts_[block] + denseSizes_[block] <= col)
+      ++block;
+    const bool inDenseBlock = block < denseStarts_.size() && denseStarts_[block] <= col;
+    if (!inDenseBlock) {
+      for (unsigned ind = sparse_.Ap_[col]; ind < sparse_.Ap_[col + 1]; ++ind)
+        M.addTerm(static_cast<int>(sparse_.Ai_[ind]), sparse_.Ax_[ind]);
+      continue;
+    }
+    // the rows of the dense block are inserted between the rows of the sparse part above and below the block
+    const int start = denseStarts_[block];
+    const int end = start + denseSizes_[block];
+    for (unsigned ind = sparse_.Ap_[col]; ind < sparse_.Ap_[col + 1]; ++ind) {
+      if (static_cast<int>(sparse_.Ai_[ind]) < start)
+        M.addTerm(static_cast<int>(sparse_.Ai_[ind]), sparse_.Ax_[ind]);
+    }
+    const double* values = denseBlockValues(block) + static_cast<std::size_t>(col - start) * denseSizes_[block];
+    for (int row = start; row < end; ++row)
+      M.addTerm(row, values[row - start]);
+    for (unsigned ind = sparse_.Ap_[col]; ind < sparse_.Ap_[col + 1]; ++ind) {
+      if (static_cast<int>(sparse_.Ai_[ind]) >= end)
+        M.addTerm(static_cast<int>(sparse_.Ai_[ind]), sparse_.Ax_[ind]);
+    }
+  }
+}
+
+void
+BlockSparseMatrix::multiply(const vector<double>& x, vector<double>& y) const {
+  assert(x.size() == static_cast<std::size_t>(nbCol_));
+  y.assign(nbRow_, 0.);
+  for (unsigned block = 0; block < denseStarts_.size(); ++block) {
+    const int start = denseStarts_[block];
+    const int blockSize = denseSizes_[block];
+    const double* values = denseBlockValues(block);
+    for (int j = 0; j < blockSize; ++j) {
+      const double xj = x[start + j];
+      const double* column = values + static_cast<std::size_t>(j) * blockSize;
+      double* yBlock = &y[start];
+      for (int i = 0; i < blockSize; ++i)
+        yBlock[i] += column[i] * xj;
+    }
+  }
+  for (int col = 0; col < nbCol_; ++col) {
+    for (unsigned ind = sparse_.Ap_[col]; ind < sparse_.Ap_[col + 1]; ++ind)
+      y[sparse_.Ai_[ind]] += sparse_.Ax_[ind] * x[col];
+  }
+}
+
+std::size_t
+BlockSparseMatrix::getIndexMemoryUsage() const {
+  const std::size_t sparseIndexes = nbCol_ > 0 ? (nbCol_ + 1 + sparse_.nbElem()) * sizeof(unsigned) : 0;
+  return sparseIndexes + denseStarts_.size() * (2 * sizeof(int) + sizeof(std::size_t));
+}
+
+}  // namespace DYN
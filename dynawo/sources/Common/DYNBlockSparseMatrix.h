@@ -0,0 +1,154 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNBlockSparseMatrix.h
+ *
+ * @brief Block sparse matrix class header
+ *
+ */
+#ifndef COMMON_DYNBLOCKSPARSEMATRIX_H_
+#define COMMON_DYNBLOCKSPARSEMATRIX_H_
+
+#include <cstddef>
+#include <vector>
+#include <boost/core/noncopyable.hpp>
+
+#include "DYNSparseMatrix.h"
+
+namespace DYN {
+
+/**
+ * @class BlockSparseMatrix
+ * @brief class Block Sparse Matrix : store the dense diagonal blocks of a sparse matrix contiguously
+ *
+ * The rows and columns of the matrix are partitioned into consecutive diagonal blocks, one by sub model for a Jacobian. A
+ * block dense enough is stored as a dense array by columns, its terms sharing the indexes of the block instead of having
+ * each its own row index. The terms outside these dense blocks stay in a sparse matrix stored by columns.
+ *
+ * The dense blocks are laid out for the dense linear algebra kernels, and the matrix is converted back into a sparse matrix
+ * stored by columns for the solvers.
+ */
+class BlockSparseMatrix : private boost::noncopyable {
+ public:
+  /**
+   * @brief default constructor
+   */
+  BlockSparseMatrix();
+
+  /**
+   * @brief build the block sparse matrix from a sparse matrix
+   *
+   * @param M sparse matrix stored by columns
+   * @param blockStarts first row and column of each diagonal block, in increasing order, a block ending at the start of
+   * the next one or at the end of the matrix
+   * @param minDensity proportion of non-null terms from which a diagonal block is stored dense
+   */
+  void build(const SparseMatrix& M, const std::vector<int>& blockStarts, double minDensity);
+
+  /**
+   * @brief convert the matrix into a sparse matrix stored by columns
+   *
+   * The null terms of the dense blocks are left out. When the rows of each column of the matrix built were sorted, the
+   * sparse matrix has the same terms in the same order, and so the same structure hash.
+   *
+   * @param M sparse matrix filled
+   */
+  void toSparseMatrix(SparseMatrix& M) const;
+
+  /**
+   * @brief compute the product of the matrix by a vector
+   *
+   * @param x vector of size the number of columns
+   * @param y result, of size the number of rows
+   */
+  void multiply(const std::vector<double>& x, std::vector<double>& y) const;
+
+  /**
+   * @brief getter of the number of rows
+   * @return number of rows of the matrix
+   */
+  inline int nbRow() const {
+    return nbRow_;
+  }
+
+  /**
+   * @brief getter of the number of columns
+   * @return number of columns of the matrix
+   */
+  inline int nbCol() const {
+    return nbCol_;
+  }
+
+  /**
+   * @brief getter of the number of dense blocks
+   * @return number of diagonal blocks stored dense
+   */
+  inline unsigned nbDenseBlocks() const {
+    return static_cast<unsigned>(denseStarts_.size());
+  }
+
+  /**
+   * @brief getter of the first row and column of a dense block
+   * @param block index of the dense block
+   * @return first row and column of the block in the matrix
+   */
+  inline int denseBlockStart(const unsigned block) const {
+    return denseStarts_[block];
+  }
+
+  /**
+   * @brief getter of the size of a dense block
+   * @param block index of the dense block
+   * @return number of rows and columns of the block
+   */
+  inline int denseBlockSize(const unsigned block) const {
+    return denseSizes_[block];
+  }
+
+  /**
+   * @brief getter of the values of a dense block
+   * @param block index of the dense block
+   * @return values of the block, stored by columns
+   */
+  inline const double* denseBlockValues(const unsigned block) const {
+    return &denseValues_[denseOffsets_[block]];
+  }
+
+  /**
+   * @brief getter of the terms outside the dense blocks
+   * @return sparse matrix of the terms outside the dense blocks
+   */
+  inline const SparseMatrix& sparsePart() const {
+    return sparse_;
+  }
+
+  /**
+   * @brief getter of the memory used by the indexes of the matrix
+   * @return number of bytes of the column pointers and row indexes of the sparse part and of the positions of the dense blocks
+   */
+  std::size_t getIndexMemoryUsage() const;
+
+ private:
+  int nbRow_;  ///< number of rows of the matrix
+  int nbCol_;  ///< number of columns of the matrix
+  std::vector<int> denseStarts_;  ///< first row and column of each dense block
+  std::vector<int> denseSizes_;  ///< size of each dense block
+  std::vector<std::size_t> denseOffsets_;  ///< position of the values of each dense block
+  std::vector<double> denseValues_;  ///< values of the dense blocks, each stored by columns
+  SparseMatrix sparse_;  ///< terms outside the dense blocks
+};
+
+}  // namespace DYN
+
+#endif  // COMMON_DYNBLOCKSPARSEMATRIX_H_
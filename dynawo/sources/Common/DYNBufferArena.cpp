@@ -0,0 +1,70 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNBufferArena.cpp
+ *
+ * @brief Single memory block holding several arrays used during the simulation
+ *
+ */
+#include <cstdint>
+#include <cstring>
+
+#include "DYNBufferArena.h"
+#include "DYNHugePages.h"
+
+namespace DYN {
+
+const std::size_t BufferArena::alignment;
+
+BufferArena::BufferArena() :
+hugePagesSize_(0),
+data_(nullptr),
+size_(0) {
+}
+
+BufferArena::~BufferArena() {
+  release();
+}
+
+void
+BufferArena::allocate() {
+  release();
+  // a block of huge pages is aligned and already zeroed
+  void* hugePages = HugePages::allocate(size_, hugePagesSize_);
+  if (hugePages) {
+    data_ = static_cast<unsigned char*>(hugePages);
+    return;
+  }
+  storage_.reset(new unsigned char[size_ + alignment]);
+  const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(storage_.get());
+  data_ = storage_.get() + (alignment - address % alignment) % alignment;
+  std::memset(data_, 0, size_);
+}
+
+void
+BufferArena::clear() {
+  release();
+  size_ = 0;
+}
+
+void
+BufferArena::release() {
+  if (hugePagesSize_ > 0)
+    HugePages::release(data_, hugePagesSize_);
+  hugePagesSize_ = 0;
+  storage_.reset();
+  data_ = nullptr;
+}
+
+}  // namespace DYN
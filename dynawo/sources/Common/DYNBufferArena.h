@@ -0,0 +1,128 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNBufferArena.h
+ *
+ * @brief Single memory block holding several arrays used during the simulation
+ *
+ */
+#ifndef COMMON_DYNBUFFERARENA_H_
+#define COMMON_DYNBUFFERARENA_H_
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#include <boost/core/noncopyable.hpp>
+
+namespace DYN {
+
+/**
+ * @class BufferArena
+ * @brief single memory block holding several arrays of trivial types
+ *
+ * The arrays are first declared with reserve, then the block is allocated once by allocate and the arrays are
+ * retrieved with get. Each array starts on a cache line, so that two arrays never share one and that the arrays
+ * used together stay close in memory. The content of the block is zeroed when allocated. A large block is backed
+ * with huge pages when they are enabled (see HugePages).
+ */
+class BufferArena : private boost::noncopyable {
+ public:
+  static const std::size_t alignment = 64;  ///< alignment of the arrays in bytes, size of a cache line
+
+  /**
+   * @brief constructor
+   */
+  BufferArena();
+
+  /**
+   * @brief destructor
+   */
+  ~BufferArena();
+
+  /**
+   * @brief declare an array in the arena
+   *
+   * Invalidates the arrays previously retrieved : allocate must be called again before using the arena.
+   *
+   * @param size number of elements of the array
+   *
+   * @return offset of the array, to give to get
+   */
+  template<typename T>
+  std::size_t reserve(std::size_t size) {
+    static_assert(std::is_trivial<T>::value, "only arrays of trivial types can be stored in an arena");
+    static_assert(alignof(T) <= alignment, "unsupported alignment");
+    const std::size_t offset = size_;
+    size_ += alignedSize(size * sizeof(T));
+    return offset;
+  }
+
+  /**
+   * @brief allocate the block holding all the arrays reserved, the previous content being lost
+   */
+  void allocate();
+
+  /**
+   * @brief release the block and forget the arrays reserved
+   */
+  void clear();
+
+  /**
+   * @brief get an array of the arena
+   *
+   * @param offset offset returned by reserve
+   *
+   * @return the first element of the array
+   */
+  template<typename T>
+  T* get(std::size_t offset) const {
+    return reinterpret_cast<T*>(data_ + offset);
+  }
+
+  /**
+   * @brief get the number of bytes reserved
+   *
+   * @return number of bytes reserved, padding included
+   */
+  std::size_t size() const {
+    return size_;
+  }
+
+ private:
+  /**
+   * @brief round a number of bytes up to a multiple of the alignment
+   *
+   * @param size number of bytes
+   *
+   * @return the aligned number of bytes
+   */
+  static std::size_t alignedSize(const std::size_t size) {
+    return (size + alignment - 1) / alignment * alignment;
+  }
+
+  /**
+   * @brief release the memory of the block
+   */
+  void release();
+
+  std::unique_ptr<unsigned char[]> storage_;  ///< memory allocated, larger than the block to be able to align it
+  std::size_t hugePagesSize_;  ///< number of bytes mapped when the block is backed with huge pages, 0 otherwise
+  unsigned char* data_;  ///< start of the block, aligned inside storage_
+  std::size_t size_;  ///< size of the block in bytes
+};
+
+}  // namespace DYN
+
+#endif  // COMMON_DYNBUFFERARENA_H_
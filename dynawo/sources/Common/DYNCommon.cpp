@@ -48,6 +48,10 @@ static const char extension[] = ".so";
 
 static double MAXIMUM_VALUE_FIXED = 1000000;  ///< maximum precision
 std::string double2String(const double value) {
+  char buffer[64];
+  const std::size_t length = double2Chars(value, buffer, sizeof(buffer));
+  if (length < sizeof(buffer))
+    return std::string(buffer, length);
   std::stringstream ss("");
   if (value > MAXIMUM_VALUE_FIXED)
     ss << std::setprecision(getPrecisionAsNbDecimal()) << std::scientific << value;
@@ -56,6 +60,12 @@ std::string double2String(const double value) {
   return ss.str();
 }
 
+std::size_t double2Chars(const double value, char* buffer, const std::size_t size) {
+  // same output as the std::fixed and std::scientific stream manipulators, without building a stream
+  const int length = snprintf(buffer, size, (value > MAXIMUM_VALUE_FIXED) ? "%.*e" : "%.*f", getPrecisionAsNbDecimal(), value);
+  return length < 0 ? 0 : static_cast<std::size_t>(length);
+}
+
 string typeVarC2Str(const typeVarC_t type) {
   string typeVarC;
   switch (type) {
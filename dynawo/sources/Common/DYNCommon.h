@@ -20,6 +20,7 @@
 #ifndef COMMON_DYNCOMMON_H_
 #define COMMON_DYNCOMMON_H_
 
+#include <cstddef>
 #include <string>
 #include <vector>
 #include <cmath>
@@ -48,6 +49,17 @@ namespace DYN {
    */
   std::string double2String(double value);
 
+  /**
+   * @brief writes a double number in a buffer with the format of double2String
+   *
+   * @param value : double to write
+   * @param buffer : buffer to write the value in
+   * @param size : size of the buffer, 32 characters are enough unless the precision has more than 20 decimals
+   *
+   * @return the length of the formatted value, the value being truncated if this length is not smaller than size
+   */
+  std::size_t double2Chars(double value, char* buffer, std::size_t size);
+
   /**
    * @brief determines the sign of a double number
    *
@@ -0,0 +1,444 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNCompressedStateDumpFile.cpp
+ *
+ * @brief Compressed dump state file, made of blocks compressed and decompressed in parallel
+ *
+ */
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <zlib.h>
+
+#include "DYNCompressedStateDumpFile.h"
+#include "DYNMacrosMessage.h"
+#include "DYNThreadPool.h"
+
+namespace DYN {
+
+namespace {
+
+const char magic[8] = {'D', 'Y', 'N', 'S', 'T', 'A', 'T', 'Z'};  ///< first and last bytes of the file
+const std::size_t headerSize = sizeof(magic) + 2 * sizeof(std::uint32_t);  ///< size of the header in bytes
+const std::size_t footerSize = sizeof(std::uint64_t) + sizeof(magic);  ///< size of the footer in bytes
+const std::size_t maxChunk = 1 << 30;  ///< largest number of bytes given at once to zlib, whose sizes are 32 bits integers
+
+/**
+ * @brief compressed block of the file
+ */
+struct Block {
+  std::uint64_t offset;  ///< position of the compressed block in the file
+  std::uint64_t compressedSize;  ///< size of the compressed block
+  std::uint64_t size;  ///< size of the block once decompressed
+};
+
+/**
+ * @brief position of an entry in the blocks
+ */
+struct EntryLocation {
+  std::string name;  ///< name of the entry
+  std::uint64_t block;  ///< index of the block holding the entry
+  std::uint64_t offset;  ///< offset of the entry in the decompressed block
+  std::uint64_t size;  ///< size of the entry
+};
+
+/**
+ * @brief zlib stream released at destruction
+ */
+struct ZStream {
+  /**
+   * @brief constructor
+   *
+   * @param deflating @b true to compress, @b false to decompress
+   */
+  explicit ZStream(const bool deflating) :
+  deflating_(deflating),
+  initialized_(false) {
+    std::memset(&stream_, 0, sizeof(stream_));
+    initialized_ = (deflating ? deflateInit(&stream_, Z_BEST_SPEED) : inflateInit(&stream_)) == Z_OK;
+  }
+
+  /**
+   * @brief destructor
+   */
+  ~ZStream() {
+    if (initialized_) {
+      if (deflating_)
+        deflateEnd(&stream_);
+      else
+        inflateEnd(&stream_);
+    }
+  }
+
+  z_stream stream_;  ///< zlib stream
+  const bool deflating_;  ///< whether the stream compresses
+  bool initialized_;  ///< whether the stream was successfully initialized
+};
+
+/**
+ * @brief write a 64 bits size
+ *
+ * @param stream stream to write
+ * @param size size to write
+ */
+void
+writeSize(std::ofstream& stream, const std::uint64_t size) {
+  stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+}
+
+/**
+ * @brief read a 64 bits size
+ *
+ * @param stream stream to read
+ * @param fileName path of the file read, for the error message
+ *
+ * @return the size read
+ */
+std::uint64_t
+readSize(std::ifstream& stream, const std::string& fileName) {
+  std::uint64_t size = 0;
+  if (!stream.read(reinterpret_cast<char*>(&size), sizeof(size)))
+    throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName);
+  return size;
+}
+
+/**
+ * @brief compress the entries of a block
+ *
+ * @param entries contents of the entries of the block, in order
+ * @param size total size of the entries
+ * @param fileName path of the file written, for the error message
+ * @param compressed compressed block, to fill
+ */
+void
+compressBlock(const std::vector<const std::string*>& entries, const std::uint64_t size, const std::string& fileName, std::string& compressed) {
+  ZStream zstream(true);
+  z_stream& stream = zstream.stream_;
+  if (!zstream.initialized_)
+    throw DYNError(Error::GENERAL, FileGenerationFailed, fileName);
+  compressed.resize(static_cast<std::size_t>(deflateBound(&stream, static_cast<uLong>(size))));
+  std::size_t written = 0;
+  // give zlib the room left in the output, the output growing if the bound was not enough
+  auto compress = [&stream, &compressed, &written, &fileName](const int flush) {
+    if (written == compressed.size())
+      compressed.resize(2 * compressed.size() + 64);
+    stream.next_out = reinterpret_cast<Bytef*>(&compressed[written]);
+    stream.avail_out = static_cast<uInt>(std::min(compressed.size() - written, maxChunk));
+    const uInt availOut = stream.avail_out;
+    const int status = deflate(&stream, flush);
+    if (status == Z_STREAM_ERROR)
+      throw DYNError(Error::GENERAL, FileGenerationFailed, fileName);
+    written += availOut - stream.avail_out;
+    return status;
+  };
+
+  for (const std::string* entry : entries) {
+    for (std::size_t position = 0; position < entry->size();) {
+      const std::size_t chunk = std::min(entry->size() - position, maxChunk);
+      stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(entry->data() + position));
+      stream.avail_in = static_cast<uInt>(chunk);
+      while (stream.avail_in > 0)
+        compress(Z_NO_FLUSH);
+      position += chunk;
+    }
+  }
+  while (compress(Z_FINISH) != Z_STREAM_END) {
+  }
+  compressed.resize(written);
+}
+
+/**
+ * @brief decompress a block into the buffers of its entries
+ *
+ * @param compressed compressed block
+ * @param entries first byte and size of the buffer of each entry of the block, in order
+ * @param fileName path of the file read, for the error message
+ */
+void
+decompressBlock(const std::string& compressed, const std::vector<std::pair<char*, std::size_t> >& entries, const std::string& fileName) {
+  ZStream zstream(false);
+  z_stream& stream = zstream.stream_;
+  if (!zstream.initialized_)
+    throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName);
+  std::size_t read = 0;
+  bool ended = false;
+  // decompress into a buffer, the input being given by chunks
+  auto decompress = [&stream, &compressed, &read, &ended, &fileName](char* output, const std::size_t size, const int flush) {
+    if (stream.avail_in == 0) {
+      stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(compressed.data() + read));
+      stream.avail_in = static_cast<uInt>(std::min(compressed.size() - read, maxChunk));
+    }
+    const uInt availIn = stream.avail_in;
+    stream.next_out = reinterpret_cast<Bytef*>(output);
+    stream.avail_out = static_cast<uInt>(size);
+    const int status = inflate(&stream, flush);
+    read += availIn - stream.avail_in;
+    if (status != Z_OK && status != Z_STREAM_END)
+      throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName);
+    ended = status == Z_STREAM_END;
+    return size - stream.avail_out;
+  };
+
+  for (const auto& entry : entries) {
+    for (std::size_t position = 0; position < entry.second;) {
+      if (ended)
+        throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName);
+      position += decompress(entry.first + position, std::min(entry.second - position, maxChunk), Z_NO_FLUSH);
+    }
+  }
+  // the stream must end exactly after the last entry
+  char extra = 0;
+  if (!ended && decompress(&extra, 1, Z_FINISH) > 0)
+    throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName);
+  if (!ended || read != compressed.size())
+    throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName);
+}
+
+/**
+ * @brief read a compressed block from the file
+ *
+ * @param stream stream of the file
+ * @param block block to read
+ * @param fileName path of the file read, for the error message
+ * @param compressed compressed block, to fill
+ */
+void
+readBlock(std::ifstream& stream, const Block& block, const std::string& fileName, std::string& compressed) {
+  compressed.resize(static_cast<std::size_t>(block.compressedSize));
+  stream.seekg(static_cast<std::streamoff>(block.offset));
+  if (!compressed.empty() && !stream.read(&compressed[0], static_cast<std::streamsize>(compressed.size())))
+    throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName);
+}
+
+/**
+ * @brief check the header of the file and read its index
+ *
+ * @param stream stream of the file
+ * @param fileName path of the file read, for the error message
+ * @param blocks blocks of the file, to fill
+ * @param entries location of the entries, in the order of the blocks, to fill
+ */
+void
+readIndex(std::ifstream& stream, const std::string& fileName, std::vector<Block>& blocks, std::vector<EntryLocation>& entries) {
+  char header[sizeof(magic)];
+  std::uint32_t fileVersion = 0;
+  std::uint32_t reserved = 0;
+  if (!stream.read(header, sizeof(header)) || std::memcmp(header, magic, sizeof(magic)) != 0
+      || !stream.read(reinterpret_cast<char*>(&fileVersion), sizeof(fileVersion))
+      || !stream.read(reinterpret_cast<char*>(&reserved), sizeof(reserved)))
+    throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName);
+  if (fileVersion > CompressedStateDumpFile::version)
+    throw DYNError(Error::GENERAL, StateDumpVersionUnsupported, fileName, fileVersion, CompressedStateDumpFile::version);
+
+  stream.seekg(0, std::ios::end);
+  const std::uint64_t fileSize = static_cast<std::uint64_t>(stream.tellg());
+  if (fileSize < headerSize + footerSize)
+    throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName);
+  stream.seekg(static_cast<std::streamoff>(fileSize - footerSize));
+  const std::uint64_t indexOffset = readSize(stream, fileName);
+  char footer[sizeof(magic)];
+  if (!stream.read(footer, sizeof(footer)) || std::memcmp(footer, magic, sizeof(magic)) != 0
+      || indexOffset < headerSize || indexOffset > fileSize - footerSize)
+    throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName);
+
+  // the sizes are checked against the size of the index before allocating anything
+  const std::uint64_t indexSize = fileSize - footerSize - indexOffset;
+  stream.seekg(static_cast<std::streamoff>(indexOffset));
+  const std::uint64_t nbBlocks = readSize(stream, fileName);
+  if (nbBlocks > indexSize / (3 * sizeof(std::uint64_t)))
+    throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName);
+  blocks.resize(static_cast<std::size_t>(nbBlocks));
+  for (Block& block : blocks) {
+    block.offset = readSize(stream, fileName);
+    block.compressedSize = readSize(stream, fileName);
+    block.size = readSize(stream, fileName);
+    if (block.offset < headerSize || block.offset > indexOffset || block.compressedSize > indexOffset - block.offset)
+      throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName);
+  }
+
+  const std::uint64_t nbEntries = readSize(stream, fileName);
+  if (nbEntries > indexSize / (4 * sizeof(std::uint64_t)))
+    throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName);
+  entries.resize(static_cast<std::size_t>(nbEntries));
+  // the entries of a block follow each other, in the order of the blocks
+  std::uint64_t currentBlock = 0;
+  std::uint64_t currentOffset = 0;
+  for (EntryLocation& entry : entries) {
+    const std::uint64_t nameSize = readSize(stream, fileName);
+    if (nameSize > indexSize)
+      throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName);
+    entry.name.resize(static_cast<std::size_t>(nameSize));
+    if (nameSize > 0 && !stream.read(&entry.name[0], static_cast<std::streamsize>(nameSize)))
+      throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName);
+    entry.block = readSize(stream, fileName);
+    entry.offset = readSize(stream, fileName);
+    entry.size = readSize(stream, fileName);
+    if (entry.block != currentBlock) {
+      if (entry.block < currentBlock || entry.block >= nbBlocks || currentOffset != blocks[currentBlock].size)
+        throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName);
+      currentBlock = entry.block;
+      currentOffset = 0;
+    }
+    if (entry.offset != currentOffset || entry.size > blocks[currentBlock].size - currentOffset)
+      throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName);
+    currentOffset += entry.size;
+  }
+  if (!blocks.empty() && (currentBlock + 1 != nbBlocks || currentOffset != blocks[currentBlock].size))
+    throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName);
+}
+
+}  // namespace
+
+const std::uint32_t CompressedStateDumpFile::version;
+const std::size_t CompressedStateDumpFile::blockSize;
+
+void
+CompressedStateDumpFile::write(const std::string& fileName, const std::map<std::string, std::string>& entries, const unsigned nbThreads) {
+  std::ofstream stream(fileName.c_str(), std::ios::binary | std::ios::trunc);
+  if (!stream.is_open())
+    throw DYNError(Error::GENERAL, OpenFileFailed, fileName);
+  const std::uint32_t fileVersion = version;
+  const std::uint32_t reserved = 0;
+  stream.write(magic, sizeof(magic));
+  stream.write(reinterpret_cast<const char*>(&fileVersion), sizeof(fileVersion));
+  stream.write(reinterpret_cast<const char*>(&reserved), sizeof(reserved));
+
+  // the entries fill a block until it reaches the block size
+  std::vector<Block> blocks;
+  std::vector<std::vector<const std::string*> > blocksEntries;
+  std::vector<EntryLocation> locations;
+  locations.reserve(entries.size());
+  for (const auto& entry : entries) {
+    if (blocks.empty() || blocks.back().size >= blockSize) {
+      blocks.push_back(Block{0, 0, 0});
+      blocksEntries.push_back(std::vector<const std::string*>());
+    }
+    Block& block = blocks.back();
+    locations.push_back(EntryLocation{entry.first, blocks.size() - 1, block.size, entry.second.size()});
+    blocksEntries.back().push_back(&entry.second);
+    block.size += entry.second.size();
+  }
+
+  // the blocks are compressed by waves, so that only a few compressed blocks are in memory at once
+  const unsigned nbBlocks = static_cast<unsigned>(blocks.size());
+  ThreadPool threadPool(std::max(1U, std::min(nbThreads, nbBlocks)));
+  const unsigned waveSize = 2 * threadPool.nbThreads();
+  std::vector<std::string> compressed(std::min(waveSize, nbBlocks));
+  for (unsigned first = 0; first < nbBlocks; first += waveSize) {
+    const unsigned nbBlocksInWave = std::min(waveSize, nbBlocks - first);
+    threadPool.parallelFor(nbBlocksInWave, [&](const unsigned i) {
+      compressBlock(blocksEntries[first + i], blocks[first + i].size, fileName, compressed[i]);
+    });
+    for (unsigned i = 0; i < nbBlocksInWave; ++i) {
+      Block& block = blocks[first + i];
+      block.offset = static_cast<std::uint64_t>(stream.tellp());
+      block.compressedSize = compressed[i].size();
+      stream.write(compressed[i].data(), static_cast<std::streamsize>(compressed[i].size()));
+    }
+  }
+
+  const std::uint64_t indexOffset = static_cast<std::uint64_t>(stream.tellp());
+  writeSize(stream, blocks.size());
+  for (const Block& block : blocks) {
+    writeSize(stream, block.offset);
+    writeSize(stream, block.compressedSize);
+    writeSize(stream, block.size);
+  }
+  writeSize(stream, locations.size());
+  for (const EntryLocation& location : locations) {
+    writeSize(stream, location.name.size());
+    stream.write(location.name.data(), static_cast<std::streamsize>(location.name.size()));
+    writeSize(stream, location.block);
+    writeSize(stream, location.offset);
+    writeSize(stream, location.size);
+  }
+  writeSize(stream, indexOffset);
+  stream.write(magic, sizeof(magic));
+
+  stream.close();
+  if (stream.fail())
+    throw DYNError(Error::GENERAL, FileGenerationFailed, fileName);
+}
+
+bool
+CompressedStateDumpFile::isCompressedStateDumpFile(const std::string& fileName) {
+  std::ifstream stream(fileName.c_str(), std::ios::binary);
+  char header[sizeof(magic)];
+  return stream.read(header, sizeof(header)) && std::memcmp(header, magic, sizeof(magic)) == 0;
+}
+
+void
+CompressedStateDumpFile::read(const std::string& fileName, std::map<std::string, std::string>& entries, const unsigned nbThreads) {
+  std::ifstream stream(fileName.c_str(), std::ios::binary);
+  if (!stream.is_open())
+    throw DYNError(Error::GENERAL, OpenFileFailed, fileName);
+  std::vector<Block> blocks;
+  std::vector<EntryLocation> locations;
+  readIndex(stream, fileName, blocks, locations);
+  stream.close();
+
+  // the buffers of the entries are allocated first, then filled in place by the threads
+  std::map<std::string, std::string> entriesRead;
+  std::vector<std::vector<std::pair<char*, std::size_t> > > blocksEntries(blocks.size());
+  for (const EntryLocation& location : locations) {
+    const auto inserted = entriesRead.insert(std::make_pair(location.name, std::string()));
+    if (!inserted.second)
+      throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName);
+    std::string& data = inserted.first->second;
+    data.resize(static_cast<std::size_t>(location.size));
+    blocksEntries[location.block].push_back(std::make_pair(data.empty() ? nullptr : &data[0], data.size()));
+  }
+
+  const unsigned nbBlocks = static_cast<unsigned>(blocks.size());
+  ThreadPool threadPool(std::max(1U, std::min(nbThreads, nbBlocks)));
+  threadPool.parallelFor(nbBlocks, [&](const unsigned i) {
+    std::ifstream blockStream(fileName.c_str(), std::ios::binary);
+    std::string compressed;
+    readBlock(blockStream, blocks[i], fileName, compressed);
+    decompressBlock(compressed, blocksEntries[i], fileName);
+  });
+
+  for (auto& entry : entriesRead)
+    entries[entry.first].swap(entry.second);
+}
+
+bool
+CompressedStateDumpFile::readEntry(const std::string& fileName, const std::string& name, std::string& data) {
+  std::ifstream stream(fileName.c_str(), std::ios::binary);
+  if (!stream.is_open())
+    throw DYNError(Error::GENERAL, OpenFileFailed, fileName);
+  std::vector<Block> blocks;
+  std::vector<EntryLocation> locations;
+  readIndex(stream, fileName, blocks, locations);
+  const auto location = std::find_if(locations.begin(), locations.end(), [&name](const EntryLocation& entry) { return entry.name == name; });
+  if (location == locations.end())
+    return false;
+
+  // the entries before the one read in the block must be decompressed too
+  const Block& block = blocks[location->block];
+  std::string compressed;
+  readBlock(stream, block, fileName, compressed);
+  std::string decompressed(static_cast<std::size_t>(block.size), '\0');
+  decompressBlock(compressed, std::vector<std::pair<char*, std::size_t> >(1, std::make_pair(decompressed.empty() ? nullptr : &decompressed[0],
+      decompressed.size())), fileName);
+  data.assign(decompressed, static_cast<std::size_t>(location->offset), static_cast<std::size_t>(location->size));
+  return true;
+}
+
+}  // end namespace DYN
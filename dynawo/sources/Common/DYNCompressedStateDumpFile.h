@@ -0,0 +1,95 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNCompressedStateDumpFile.h
+ *
+ * @brief Compressed dump state file, made of blocks compressed and decompressed in parallel
+ *
+ */
+#ifndef COMMON_DYNCOMPRESSEDSTATEDUMPFILE_H_
+#define COMMON_DYNCOMPRESSEDSTATEDUMPFILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace DYN {
+
+/**
+ * @class CompressedStateDumpFile
+ * @brief compressed alternative to the zip archive of the dump state files, using several threads
+ *
+ * The entries are grouped into blocks of about blockSize bytes, an entry never being split between two blocks. Each block is
+ * compressed with zlib independently of the others, so that the blocks are compressed and decompressed by several threads.
+ * The file starts with a header made of a magic string and of a version number, followed by the compressed blocks, then by an
+ * index giving the position of each block in the file and the block, the offset and the size of each entry. The file ends
+ * with the position of the index and with the magic string again, so that a single entry can be read without reading
+ * the whole file.
+ */
+class CompressedStateDumpFile {
+ public:
+  static const std::uint32_t version = 1;  ///< version of the format written
+  static const std::size_t blockSize = 4 * 1024 * 1024;  ///< number of bytes above which a block is not given more entries
+
+  /**
+   * @brief write all the entries in a compressed dump state file
+   *
+   * @param fileName path of the file to create
+   * @param entries map associating the name of each entry with its content
+   * @param nbThreads number of threads compressing the blocks
+   *
+   * @throw OpenFileFailed error if the file cannot be created, FileGenerationFailed error if it could not be written
+   */
+  static void write(const std::string& fileName, const std::map<std::string, std::string>& entries, unsigned nbThreads);
+
+  /**
+   * @brief indicate whether a file is a compressed dump state file
+   *
+   * @param fileName path of the file
+   *
+   * @return @b true if the file starts with the header of the format
+   */
+  static bool isCompressedStateDumpFile(const std::string& fileName);
+
+  /**
+   * @brief read all the entries of a compressed dump state file
+   *
+   * @param fileName path of the file
+   * @param entries map associating the name of each entry with its content, to fill
+   * @param nbThreads number of threads decompressing the blocks
+   *
+   * @throw StateDumpVersionUnsupported error if the file was written by a more recent format,
+   * StateDumpCorrupted error if the file is truncated or if a block cannot be decompressed
+   */
+  static void read(const std::string& fileName, std::map<std::string, std::string>& entries, unsigned nbThreads);
+
+  /**
+   * @brief read a single entry of a compressed dump state file, decompressing only the block holding it
+   *
+   * @param fileName path of the file
+   * @param name name of the entry
+   * @param data content of the entry, to fill
+   *
+   * @return @b false if the file has no entry with this name
+   *
+   * @throw StateDumpVersionUnsupported error if the file was written by a more recent format,
+   * StateDumpCorrupted error if the file is truncated or if the block cannot be decompressed
+   */
+  static bool readEntry(const std::string& fileName, const std::string& name, std::string& data);
+};
+
+}  // end namespace DYN
+
+#endif  // COMMON_DYNCOMPRESSEDSTATEDUMPFILE_H_
@@ -357,6 +357,16 @@ bool isAbsolutePath(const string& path) {
   return fspath.is_absolute();
 }
 
+std::time_t lastWriteTime(const string& path) {
+  const fs::path fspath(path);
+  return fs::last_write_time(fspath);
+}
+
+std::uintmax_t fileSize(const string& path) {
+  const fs::path fspath(path);
+  return fs::file_size(fspath);
+}
+
 void
 removeAllInDirectory(const std::string& directory) {
   const fs::path fspath(directory);
@@ -20,6 +20,8 @@
 #ifndef COMMON_DYNFILESYSTEMUTILS_H_
 #define COMMON_DYNFILESYSTEMUTILS_H_
 
+#include <cstdint>
+#include <ctime>
 #include <string>
 #include <list>
 #include <map>
@@ -343,4 +345,20 @@ std::string lastParentDirectory(const std::string& childPath);
  */
 bool isAbsolutePath(const std::string& path);
 
+/**
+ * @brief Get the last write time of a file
+ * @param[in] path : the path of the file
+ *
+ * @return the last write time of the file, in seconds since the epoch
+ */
+std::time_t lastWriteTime(const std::string& path);
+
+/**
+ * @brief Get the size of a file
+ * @param[in] path : the path of the file
+ *
+ * @return the size of the file in bytes
+ */
+std::uintmax_t fileSize(const std::string& path);
+
 #endif  // COMMON_DYNFILESYSTEMUTILS_H_
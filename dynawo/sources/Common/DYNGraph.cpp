@@ -17,7 +17,9 @@
  * @brief Encapsulation of boost::graph.
  *
  */
+#include <algorithm>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include "DYNGraph.h"
 #include "DYNMacrosMessage.h"
@@ -35,81 +37,134 @@ using boost::add_edge;
 
 namespace DYN {
 
-Graph::Graph() {
+Graph::Graph() :
+adjacencyUpToDate_(false) {
 }
 
 void
 Graph::addVertex(const unsigned vertexId) {
   vertices_[vertexId] = add_vertex(internalGraph_);
   put(boost::vertex_name_t(), internalGraph_, vertices_[vertexId], vertexId);
+  adjacencyUpToDate_ = false;
 }
 
-void
+unsigned int
 Graph::addEdge(const unsigned indexVertex1, const unsigned indexVertex2, const string& id) {
   if (!hasVertex(indexVertex1))
     throw DYNError(DYN::Error::GENERAL, UnknownVertex, indexVertex1);
   if (!hasVertex(indexVertex2))
     throw DYNError(DYN::Error::GENERAL, UnknownVertex, indexVertex2);
 
-  if (edges_.find(id) != edges_.end())
+  if (edgeIndexes_.find(id) != edgeIndexes_.end())
     throw DYNError(DYN::Error::GENERAL, AlreadyDefinedEdge, id);
 
-  const std::pair<Edge, bool> edgePair = add_edge(vertices_[indexVertex1], vertices_[indexVertex2], internalGraph_);
+  const Vertex vertex1 = vertices_[indexVertex1];
+  const Vertex vertex2 = vertices_[indexVertex2];
+  const std::pair<Edge, bool> edgePair = add_edge(vertex1, vertex2, internalGraph_);
+  const unsigned int edgeIndex = getNbEdges();
   put(boost::edge_name_t(), internalGraph_, edgePair.first, id);
-  edges_[id] = edgePair.first;
+  put(boost::edge_index_t(), internalGraph_, edgePair.first, edgeIndex);
+  edgeIndexes_[id] = edgeIndex;
+  edgeIds_.push_back(id);
+  edgeVertices_.push_back(std::make_pair(vertex1, vertex2));
+  edgeWeights_.push_back(0);
+  adjacencyUpToDate_ = false;
+  return edgeIndex;
+}
+
+unsigned int
+Graph::getEdgeIndex(const string& id) const {
+  const auto it = edgeIndexes_.find(id);
+  if (it == edgeIndexes_.end())
+    throw DYNError(DYN::Error::GENERAL, UnknownEdge, id);
+  return it->second;
+}
+
+void
+Graph::setEdgeWeight(const unsigned int edgeIndex, const float weight) {
+  edgeWeights_[edgeIndex] = weight;
 }
 
 void
 Graph::setEdgesWeight(const std::unordered_map<string, float>& edgeWeights) {
+  for (unsigned int i = 0, nbEdges = getNbEdges(); i < nbEdges; ++i) {
+    const auto& it = edgeWeights.find(edgeIds_[i]);
+    if (it != edgeWeights.end())
+      setEdgeWeight(i, it->second);
+  }
+}
+
+void
+Graph::updateBoostWeights() {
   auto edgeIterators = boost::edges(internalGraph_);
-  for (auto it = edgeIterators.first, itEnd = edgeIterators.second; it != itEnd; ++it) {
-    const auto& edgeName = boost::get(boost::edge_name, internalGraph_, *it);
-    const auto& it2 = edgeWeights.find(edgeName);
-    if (it2 != edgeWeights.end())
-      put(boost::edge_weight_t(), internalGraph_, *it, it2->second);
+  for (auto it = edgeIterators.first, itEnd = edgeIterators.second; it != itEnd; ++it)
+    put(boost::edge_weight_t(), internalGraph_, *it, edgeWeights_[boost::get(boost::edge_index, internalGraph_, *it)]);
+}
+
+void
+Graph::updateAdjacency() {
+  if (adjacencyUpToDate_)
+    return;
+  const unsigned int nbVertices = static_cast<unsigned int>(boost::num_vertices(internalGraph_));
+  adjacencyOffsets_.assign(nbVertices + 1, 0);
+  for (unsigned int i = 0, nbEdges = getNbEdges(); i < nbEdges; ++i) {
+    ++adjacencyOffsets_[edgeVertices_[i].first + 1];
+    ++adjacencyOffsets_[edgeVertices_[i].second + 1];
+  }
+  for (unsigned int v = 0; v < nbVertices; ++v)
+    adjacencyOffsets_[v + 1] += adjacencyOffsets_[v];
+
+  adjacency_.resize(adjacencyOffsets_[nbVertices]);
+  vector<unsigned int> position(adjacencyOffsets_.begin(), adjacencyOffsets_.end() - 1);
+  for (unsigned int i = 0, nbEdges = getNbEdges(); i < nbEdges; ++i) {
+    const Vertex vertex1 = edgeVertices_[i].first;
+    const Vertex vertex2 = edgeVertices_[i].second;
+    adjacency_[position[vertex1]++] = std::make_pair(vertex2, i);
+    adjacency_[position[vertex2]++] = std::make_pair(vertex1, i);
   }
+  adjacencyUpToDate_ = true;
 }
 
 void
-Graph::dijkstra(const unsigned vertexOrigin, const unsigned vertexExtremity,
+Graph::dijkstra(const unsigned vertexOrigin, const vector<unsigned>& vertexExtremities,
     const std::unordered_map<std::string, float>& edgeWeights,
-    PathDescription& path) {
-  if (vertexOrigin == vertexExtremity)
+    vector<PathDescription>& paths) {
+  paths.assign(vertexExtremities.size(), PathDescription());
+  setEdgesWeight(edgeWeights);
+  updateBoostWeights();
+  if (!hasVertex(vertexOrigin))
     return;
 
-  setEdgesWeight(edgeWeights);
-  if (hasVertex(vertexOrigin) && hasVertex(vertexExtremity)) {
-    positive_edge_weight<EdgeWeightMap> filter(get(boost::edge_weight_t(), internalGraph_));
-    FilteredBoostGraph filteredGraph = FilteredBoostGraph(internalGraph_, filter);
-
-    std::unordered_map<unsigned int, Vertex> filteredVertices;
-    auto vs = boost::vertices(filteredGraph);
-    for (auto it = vs.first; it != vs.second; ++it) {
-      filteredVertices[boost::get(boost::vertex_name, filteredGraph, *it)] = *it;
-    }
+  positive_edge_weight<EdgeWeightMap> filter(get(boost::edge_weight_t(), internalGraph_));
+  FilteredBoostGraph filteredGraph = FilteredBoostGraph(internalGraph_, filter);
 
-    Vertex start = filteredVertices[vertexOrigin];
-    std::vector<Vertex> predecessor(boost::num_vertices(filteredGraph));
-    std::vector<int> distance(boost::num_vertices(filteredGraph));
-    dijkstra_shortest_paths(filteredGraph, start, boost::predecessor_map(&predecessor[0]).distance_map(&distance[0]) );
+  // the filter only removes edges: the vertices of the filtered graph are the ones of the graph
+  const Vertex start = vertices_[vertexOrigin];
+  std::vector<Vertex> predecessor(boost::num_vertices(filteredGraph));
+  std::vector<int> distance(boost::num_vertices(filteredGraph));
+  dijkstra_shortest_paths(filteredGraph, start, boost::predecessor_map(&predecessor[0]).distance_map(&distance[0]) );
 
-    Vertex node = filteredVertices[vertexExtremity];
+  for (unsigned int i = 0; i < vertexExtremities.size(); ++i) {
+    const unsigned vertexExtremity = vertexExtremities[i];
+    if (vertexExtremity == vertexOrigin || !hasVertex(vertexExtremity))
+      continue;
+    Vertex node = vertices_[vertexExtremity];
     if (distance[node] == std::numeric_limits<int>::max())
-      return;
+      continue;
+    PathDescription& path = paths[i];
     while (node != start) {
-      Vertex prec = predecessor[node];
-      auto edgeIterators = boost::edges(filteredGraph);
+      const Vertex prec = predecessor[node];
+      // the out edges of a vertex are in the order of their creation: with parallel edges, the first one created is used
+      auto edgeIterators = boost::out_edges(node, filteredGraph);
       for (auto it = edgeIterators.first, itEnd = edgeIterators.second; it != itEnd; ++it) {
-        const auto& source = boost::source(*it, filteredGraph);
-        const auto& target = boost::target(*it, filteredGraph);
-        if ((source == node && target == prec) || (source == prec && target == node)) {
-          string edgeId = boost::get(boost::edge_name, filteredGraph, *it);
-          path.insert(path.begin(), edgeId);
+        if (boost::target(*it, filteredGraph) == prec) {
+          path.push_back(boost::get(boost::edge_name, filteredGraph, *it));
           break;
         }
       }
       node = prec;
     }
+    std::reverse(path.begin(), path.end());
   }
 }
 
@@ -117,17 +172,35 @@ bool
 Graph::pathExist(const unsigned vertexOrigin, const unsigned vertexExtremity, const std::unordered_map<string, float> & edgeWeights) {
   if (vertexOrigin == vertexExtremity)
     return true;
-  PathDescription path;
-
   setEdgesWeight(edgeWeights);
-  const positive_edge_weight<EdgeWeightMap> filter(get(boost::edge_weight_t(), internalGraph_));
-  const FilteredBoostGraph filteredGraph = FilteredBoostGraph(internalGraph_, filter);
-  if (hasVertex(vertexOrigin) && hasVertex(vertexExtremity)) {
-    const Vertex start = vertices_[vertexOrigin];
-    std::vector<Vertex> predecessor(boost::num_vertices(filteredGraph));
-    std::vector<int> distance(boost::num_vertices(filteredGraph));
-    dijkstra_shortest_paths(filteredGraph, start, boost::predecessor_map(&predecessor[0]).distance_map(&distance[0]) );
-    return distance[vertices_[vertexExtremity]] != std::numeric_limits<int>::max();
+  return pathExist(vertexOrigin, vertexExtremity);
+}
+
+bool
+Graph::pathExist(const unsigned vertexOrigin, const unsigned vertexExtremity) {
+  if (vertexOrigin == vertexExtremity)
+    return true;
+  if (!hasVertex(vertexOrigin) || !hasVertex(vertexExtremity))
+    return false;
+  updateAdjacency();
+
+  // breadth first search on the edges with a positive weight, stopped as soon as the extremity is reached
+  const Vertex start = vertices_[vertexOrigin];
+  const Vertex end = vertices_[vertexExtremity];
+  vector<bool> visited(boost::num_vertices(internalGraph_), false);
+  vector<Vertex> queue(1, start);
+  visited[start] = true;
+  for (unsigned int i = 0; i < queue.size(); ++i) {
+    const Vertex vertex = queue[i];
+    for (unsigned int j = adjacencyOffsets_[vertex], jEnd = adjacencyOffsets_[vertex + 1]; j < jEnd; ++j) {
+      const Vertex neighbor = adjacency_[j].first;
+      if (visited[neighbor] || !(0 < edgeWeights_[adjacency_[j].second]))
+        continue;
+      if (neighbor == end)
+        return true;
+      visited[neighbor] = true;
+      queue.push_back(neighbor);
+    }
   }
   return false;
 }
@@ -138,17 +211,64 @@ Graph::shortestPath(const unsigned vertexOrigin, const unsigned vertexExtremity,
   if (vertexOrigin == vertexExtremity)
     return;
 
-  dijkstra(vertexOrigin, vertexExtremity, edgeWeights, path);
+  vector<PathDescription> paths;
+  dijkstra(vertexOrigin, vector<unsigned>(1, vertexExtremity), edgeWeights, paths);
+  path.insert(path.end(), paths.front().begin(), paths.front().end());
+}
+
+void
+Graph::shortestPaths(const unsigned vertexOrigin, const vector<unsigned>& vertexExtremities,
+    const std::unordered_map<string, float>& edgeWeights, vector<PathDescription>& paths) {
+  dijkstra(vertexOrigin, vertexExtremities, edgeWeights, paths);
 }
 
 std::pair<unsigned int, vector<unsigned int> >
 Graph::calculateComponents(const std::unordered_map<string, float>& edgeWeights) {
   setEdgesWeight(edgeWeights);
-  const positive_edge_weight<EdgeWeightMap> filter(get(boost::edge_weight_t(), internalGraph_));
-  const FilteredBoostGraph filteredGraph = FilteredBoostGraph(internalGraph_, filter);
+  return calculateComponents();
+}
 
-  vector<unsigned int> component(boost::num_vertices(filteredGraph));
-  int nbComponents = boost::connected_components(filteredGraph, &component[0]);
+/**
+ * @brief find the root of the set of a vertex, halving the path on the way
+ *
+ * @param parents parent of each vertex in the union-find forest
+ * @param vertex vertex to look for
+ * @return root of the set of the vertex
+ */
+static Vertex
+findRoot(vector<Vertex>& parents, Vertex vertex) {
+  while (parents[vertex] != vertex) {
+    parents[vertex] = parents[parents[vertex]];
+    vertex = parents[vertex];
+  }
+  return vertex;
+}
+
+std::pair<unsigned int, vector<unsigned int> >
+Graph::calculateComponents() const {
+  const unsigned int nbVertices = static_cast<unsigned int>(boost::num_vertices(internalGraph_));
+  // union-find on the edges with a positive weight, the smallest vertex being kept as root
+  vector<Vertex> parents(nbVertices);
+  for (unsigned int v = 0; v < nbVertices; ++v)
+    parents[v] = v;
+  for (unsigned int i = 0, nbEdges = getNbEdges(); i < nbEdges; ++i) {
+    if (!(0 < edgeWeights_[i]))
+      continue;
+    const Vertex root1 = findRoot(parents, edgeVertices_[i].first);
+    const Vertex root2 = findRoot(parents, edgeVertices_[i].second);
+    if (root1 < root2)
+      parents[root2] = root1;
+    else if (root2 < root1)
+      parents[root1] = root2;
+  }
+
+  // the roots are the smallest vertices of their component: the components are numbered in the order of the vertices
+  unsigned int nbComponents = 0;
+  vector<unsigned int> component(nbVertices);
+  for (unsigned int v = 0; v < nbVertices; ++v) {
+    const Vertex root = findRoot(parents, v);
+    component[v] = (root == v) ? nbComponents++ : component[root];
+  }
   return std::pair<unsigned int, vector<unsigned int> >(nbComponents, component);
 }
 
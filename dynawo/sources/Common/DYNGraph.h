@@ -20,8 +20,10 @@
 #ifndef COMMON_DYNGRAPH_H_
 #define COMMON_DYNGRAPH_H_
 
+#include <string>
 #include <utility>
 #include <unordered_map>
+#include <vector>
 
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/adjacency_iterator.hpp>
@@ -35,7 +37,8 @@
 
 
 // definitions of typedef alias to hide boost types
-typedef boost::property<boost::edge_weight_t, float, boost::property<boost::edge_name_t, std::string> > EdgeProperty;  ///< properties associated to an edge
+typedef boost::property<boost::edge_weight_t, float,
+    boost::property<boost::edge_name_t, std::string, boost::property<boost::edge_index_t, unsigned int> > > EdgeProperty;  ///< properties associated to an edge
 typedef boost::property<boost::vertex_name_t, int> VertexProperty;  ///< property associated to a vertex
 typedef boost::adjacency_list <boost::vecS, boost::vecS, boost::undirectedS, VertexProperty, EdgeProperty> BoostGraph;  ///< graph description
 typedef boost::graph_traits < BoostGraph >::vertex_descriptor Vertex;  ///< vertex description
@@ -100,8 +103,34 @@ class Graph {
    * @param idVertex1 id of the first vertex
    * @param idVertex2 id of the second vertex
    * @param id id of the edge
+   * @return index of the edge, in the order of creation of the edges
    */
-  void addEdge(unsigned idVertex1, unsigned idVertex2, const std::string& id);
+  unsigned int addEdge(unsigned idVertex1, unsigned idVertex2, const std::string& id);
+
+  /**
+   * @brief get the index of an edge
+   *
+   * @param id id of the edge
+   * @return index of the edge, in the order of creation of the edges
+   */
+  unsigned int getEdgeIndex(const std::string& id) const;
+
+  /**
+   * @brief get the number of edges
+   *
+   * @return number of edges
+   */
+  inline unsigned int getNbEdges() const {
+    return static_cast<unsigned int>(edgeIds_.size());
+  }
+
+  /**
+   * @brief set the weight/mask of an edge, kept for the next analyses of the graph
+   *
+   * @param edgeIndex index of the edge
+   * @param weight weight of the edge, the edge being filtered if it is not positive
+   */
+  void setEdgeWeight(unsigned int edgeIndex, float weight);
 
   /**
    * @brief check if a vertex exists
@@ -121,6 +150,15 @@ class Graph {
    */
   bool pathExist(unsigned vertexOrigin, unsigned vertexExtremity, const std::unordered_map<std::string, float>& edgeWeights);
 
+  /**
+   * @brief check if a path exist between two vertices with the current weights of the edges
+   *
+   * @param vertexOrigin index of the first vertex
+   * @param vertexExtremity index of the second vertex
+   * @return @b true if a path exists, @b false otherwise
+   */
+  bool pathExist(unsigned vertexOrigin, unsigned vertexExtremity);
+
   /**
    * @brief find the shortest path between two vertices
    *
@@ -133,6 +171,20 @@ class Graph {
   void shortestPath(unsigned vertexOrigin, unsigned vertexExtremity,
       const std::unordered_map<std::string, float>& edgeWeights, PathDescription& path);
 
+  /**
+   * @brief find the shortest paths between a vertex and several other ones
+   *
+   * The paths are the same as the ones given by shortestPath for each extremity, but the graph is explored only once.
+   *
+   * @param vertexOrigin index of the first vertex
+   * @param vertexExtremities indexes of the other vertices
+   * @param edgeWeights weights/masks of each edge to filter the graph
+   * @param paths for each extremity, a list of edge's id encountered between origin and extremity of the path
+   * this list is empty if there is no path or if the vertexOrigin and extremity are the same
+   */
+  void shortestPaths(unsigned vertexOrigin, const std::vector<unsigned>& vertexExtremities,
+      const std::unordered_map<std::string, float>& edgeWeights, std::vector<PathDescription>& paths);
+
   /**
    * @brief calculate connected components of a graph
    *
@@ -141,6 +193,15 @@ class Graph {
    */
   std::pair<unsigned int, std::vector<unsigned int> > calculateComponents(const std::unordered_map<std::string, float>& edgeWeights);
 
+  /**
+   * @brief calculate connected components of a graph with the current weights of the edges
+   *
+   * The components are numbered in the order of the vertices creation.
+   *
+   * @return number of components and component per vertices
+   */
+  std::pair<unsigned int, std::vector<unsigned int> > calculateComponents() const;
+
  private:
   /**
    * @brief set the weight/mask of each edge
@@ -150,22 +211,38 @@ class Graph {
   void setEdgesWeight(const std::unordered_map<std::string, float>& edgeWeights);
 
   /**
-   * @brief find the shortest path between two vertices
+   * @brief find the shortest paths between a vertex and several other ones
    *
    * @param vertexOrigin index of the first vertex
-   * @param vertexExtremity index of the second vertex
+   * @param vertexExtremities indexes of the other vertices
    * @param edgeWeights weights/masks of each edge to filter the graph
-   * @param path a list of edge's id encountered between origin and extremity of the path
+   * @param paths for each extremity, a list of edge's id encountered between origin and extremity of the path
    * this list is empty if there is no path or if the vertexOrigin and extremity are the same
    */
-  void dijkstra(const unsigned vertexOrigin, const unsigned vertexExtremity,
+  void dijkstra(const unsigned vertexOrigin, const std::vector<unsigned>& vertexExtremities,
       const std::unordered_map<std::string, float>& edgeWeights,
-      PathDescription& path);
+      std::vector<PathDescription>& paths);
+
+  /**
+   * @brief copy the current weights of the edges in the boost graph
+   */
+  void updateBoostWeights();
+
+  /**
+   * @brief build the compressed adjacency of the vertices if edges or vertices were added since the last build
+   */
+  void updateAdjacency();
 
  private:
   BoostGraph internalGraph_;  ///< graph description
   std::unordered_map<unsigned int, Vertex> vertices_;  ///< association between vertices and their id
-  std::unordered_map<std::string, Edge> edges_;  ///< association between edges and their id
+  std::unordered_map<std::string, unsigned int> edgeIndexes_;  ///< association between edges id and their index
+  std::vector<std::string> edgeIds_;  ///< id of each edge
+  std::vector<std::pair<Vertex, Vertex> > edgeVertices_;  ///< vertices of each edge
+  std::vector<float> edgeWeights_;  ///< current weight of each edge
+  std::vector<unsigned int> adjacencyOffsets_;  ///< for each vertex, offset of its first neighbor in adjacency_
+  std::vector<std::pair<Vertex, unsigned int> > adjacency_;  ///< neighbor and index of the edge, grouped by vertex
+  bool adjacencyUpToDate_;  ///< whether adjacency_ describes all the edges and vertices
 };
 
 }  // namespace DYN
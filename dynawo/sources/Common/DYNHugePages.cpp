@@ -0,0 +1,113 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+
+/**
+ * @file  DYNHugePages.cpp
+ *
+ * @brief Huge pages backing of the large arrays implementation
+ *
+ */
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include "DYNHugePages.h"
+#include "DYNMacrosMessage.h"
+#include "DYNTrace.h"
+
+namespace DYN {
+
+const std::size_t HugePages::pageSize;
+std::atomic<bool> HugePages::enabled_(false);
+
+void
+HugePages::setEnabled(const bool enabled) {
+  enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+bool
+HugePages::isEnabled() {
+  static const bool enabledByEnvironment = std::getenv("DYNAWO_HUGE_PAGES") && std::strcmp(std::getenv("DYNAWO_HUGE_PAGES"), "true") == 0;
+  return enabledByEnvironment || enabled_.load(std::memory_order_relaxed);
+}
+
+void*
+HugePages::allocate(const std::size_t size, std::size_t& mappedSize) {
+  mappedSize = 0;
+#ifdef __linux__
+  if (!isEnabled() || size < pageSize)
+    return nullptr;
+  const std::size_t alignedSize = (size + pageSize - 1) / pageSize * pageSize;
+  // explicit huge pages, if some are reserved on the host
+  void* data = mmap(nullptr, alignedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  if (data != MAP_FAILED) {
+    mappedSize = alignedSize;
+    return data;
+  }
+
+  // transparent huge pages: the kernel only uses them for the parts of the mapping aligned on a huge page
+  data = mmap(nullptr, alignedSize + pageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (data == MAP_FAILED)
+    return nullptr;
+  unsigned char* const mapping = static_cast<unsigned char*>(data);
+  const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(mapping);
+  const std::size_t head = (pageSize - address % pageSize) % pageSize;
+  if (head > 0)
+    munmap(mapping, head);
+  munmap(mapping + head + alignedSize, pageSize - head);
+  unsigned char* const aligned = mapping + head;
+  if (madvise(aligned, alignedSize, MADV_HUGEPAGE) != 0) {
+    static std::atomic<bool> warned(false);
+    if (!warned.exchange(true))
+      Trace::warn() << DYNLog(HugePagesUnavailable, strerror(errno)) << Trace::endline;
+  }
+  mappedSize = alignedSize;
+  return aligned;
+#else
+  static_cast<void>(size);
+  return nullptr;
+#endif
+}
+
+void
+HugePages::release(void* data, const std::size_t mappedSize) {
+#ifdef __linux__
+  if (data)
+    munmap(data, mappedSize);
+#else
+  static_cast<void>(data);
+  static_cast<void>(mappedSize);
+#endif
+}
+
+void
+HugePages::advise(const void* data, const std::size_t size) {
+#ifdef __linux__
+  if (!isEnabled() || !data)
+    return;
+  const std::uintptr_t begin = (reinterpret_cast<std::uintptr_t>(data) + pageSize - 1) / pageSize * pageSize;
+  const std::uintptr_t end = (reinterpret_cast<std::uintptr_t>(data) + size) / pageSize * pageSize;
+  if (end > begin)
+    madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);
+#else
+  static_cast<void>(data);
+  static_cast<void>(size);
+#endif
+}
+
+}  // namespace DYN
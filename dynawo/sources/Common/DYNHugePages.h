@@ -0,0 +1,93 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+
+/**
+ * @file  DYNHugePages.h
+ *
+ * @brief Huge pages backing of the large arrays kept during the whole simulation
+ *
+ */
+#ifndef COMMON_DYNHUGEPAGES_H_
+#define COMMON_DYNHUGEPAGES_H_
+
+#include <atomic>
+#include <cstddef>
+
+namespace DYN {
+
+/**
+ * @class HugePages
+ * @brief allocation and advice of huge pages for the large long-lived arrays
+ *
+ * The arrays of a large case span hundreds of megabytes and are read at random by the Jacobian assembly and the sparse
+ * solves: backing them with 2 MB pages instead of 4 kB ones divides the number of TLB misses. Explicit huge pages
+ * (hugetlbfs) are used when some are reserved on the host, transparent huge pages otherwise. When none is available,
+ * the arrays fall back to the regular allocation.
+ *
+ * The huge pages are enabled by the job or by setting the environment variable DYNAWO_HUGE_PAGES to true.
+ */
+class HugePages {
+ public:
+  static const std::size_t pageSize = 2 * 1024 * 1024;  ///< size of a huge page in bytes
+
+  /**
+   * @brief enable or disable the huge pages for the arrays allocated from now on
+   *
+   * @param enabled @b true to back the large arrays with huge pages
+   */
+  static void setEnabled(bool enabled);
+
+  /**
+   * @brief whether the large arrays are backed with huge pages
+   *
+   * @return @b true if enabled by setEnabled or by the environment variable DYNAWO_HUGE_PAGES
+   */
+  static bool isEnabled();
+
+  /**
+   * @brief allocate a zeroed block backed with huge pages
+   *
+   * @param size number of bytes needed
+   * @param mappedSize number of bytes actually mapped, to give to release
+   *
+   * @return the block, aligned on a huge page, null if the huge pages are disabled, if the block is smaller than a huge
+   * page or if no huge page is available
+   */
+  static void* allocate(std::size_t size, std::size_t& mappedSize);
+
+  /**
+   * @brief release a block allocated by allocate
+   *
+   * @param data block to release
+   * @param mappedSize number of bytes mapped returned by allocate
+   */
+  static void release(void* data, std::size_t mappedSize);
+
+  /**
+   * @brief ask for transparent huge pages to back an array allocated by the regular allocator
+   *
+   * Only the huge pages entirely inside the array are concerned. Does nothing if the huge pages are disabled.
+   *
+   * @param data first byte of the array
+   * @param size number of bytes of the array
+   */
+  static void advise(const void* data, std::size_t size);
+
+ private:
+  static std::atomic<bool> enabled_;  ///< whether the huge pages are enabled by the job
+};
+
+}  // namespace DYN
+
+#endif  // COMMON_DYNHUGEPAGES_H_
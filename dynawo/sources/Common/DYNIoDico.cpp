@@ -66,6 +66,11 @@ std::shared_ptr<IoDico> IoDicos::getIoDico(const string& dicoName) {
   }
 }
 
+const IoDico* IoDicos::findIoDico(const string& dicoName) {
+  const auto it = instance().dicos_.find(dicoName);
+  return it != instance().dicos_.end() ? it->second.get() : NULL;
+}
+
 std::shared_ptr<OppositeEventDico> IoDicos::getOppositeEventsDico(const string& dicoName) {
   if (hasOppositeEventsDico(dicoName)) {
     return instance().oppositeEventsDicos_[dicoName];
@@ -226,6 +231,7 @@ void IoDico::readFile(const string& fileName) {
             throw MessageError(" Reading of the dictionary " + fileName + " the key '" + key + "' is not unique");
           }
           map_[key] = phrase;
+          templates_.emplace(key, MessageTemplate(phrase));
         }
       } else {
         throw MessageError("Error happened when reading the dictionary " + fileName);
@@ -235,15 +241,16 @@ void IoDico::readFile(const string& fileName) {
   }
 }
 
-string IoDico::msg(const string& msgId) {
-  string phrase = "";
-
-  if (map_.find(msgId) != map_.end()) {
-    phrase = map_[msgId];
-  } else {
+string IoDico::msg(const string& msgId) const {
+  const MessageTemplate* phrase = find(msgId);
+  if (!phrase)
     throw MessageError("there is no key '" + msgId + "' in the dictionary");
-  }
-  return phrase;
+  return phrase->description();
+}
+
+const MessageTemplate* IoDico::find(const string& msgId) const {
+  const auto it = templates_.find(msgId);
+  return it != templates_.end() ? &it->second : NULL;
 }
 
 std::map<string, string>::const_iterator IoDico::begin() const {
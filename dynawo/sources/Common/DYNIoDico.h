@@ -27,6 +27,8 @@
 #include <unordered_map>
 #include <boost/noncopyable.hpp>
 
+#include "DYNMessageTemplate.h"
+
 
 namespace DYN {
 
@@ -82,8 +84,18 @@ class IoDico {
    *
    * @return message description of the message
    */
-  std::string msg(const std::string& msgId);
+  std::string msg(const std::string& msgId) const;
 
+  /**
+   * @brief find the message description associated to the key, parsed when the dictionary was read
+   *
+   * @param msgId id/key of the message to find
+   *
+   * @return message description of the message, @b NULL if there is no such key in the dictionary
+   *
+   * @note the description stays valid as long as the dictionary, the keys being never removed
+   */
+  const MessageTemplate* find(const std::string& msgId) const;
 
   /**
    * @brief iteration over the key/msg map
@@ -108,6 +120,7 @@ class IoDico {
 
  private:
   std::map<std::string, std::string> map_;  ///< map association between key and message description
+  std::unordered_map<std::string, MessageTemplate> templates_;  ///< map association between key and parsed message description
   std::string name_;  ///< name of the dictionary
 };
 
@@ -146,6 +159,15 @@ class IoDicos : public boost::noncopyable {
    */
   static std::shared_ptr<IoDico> getIoDico(const std::string& dicoName);
 
+  /**
+   * @brief find a dictionary with the name @b dicoName, without throwing
+   *
+   * @param dicoName name of the dictionary to find
+   *
+   * @return the dictionary with the desired name, @b NULL if there is none
+   */
+  static const IoDico* findIoDico(const std::string& dicoName);
+
   /**
    * @brief try to find a opposite event dictionary with the name @b dicoName
    *
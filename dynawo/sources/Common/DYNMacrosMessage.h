@@ -43,13 +43,13 @@
 #define DYNTimeline(key, ...) (DYN::MessageTimeline(DYN::KeyTimeline_t::names(DYN::KeyTimeline_t::key)), ##__VA_ARGS__ )
 
 /**
- * @brief Macro to add a timeline event, only if timeline exists
+ * @brief Macro to add a timeline event, only if timeline exists and registers it
  * @param model the model to add the event to
  * @param name the name of the model
  * @param key key to find the message
  */
 #define DYNAddTimelineEvent(model, name, key, ...) \
-  if (model->hasTimeline()) model->addEvent(name, DYNTimeline(key, ##__VA_ARGS__))
+  if (model->acceptsTimelineEvent(DYN::KeyTimeline_t::names(DYN::KeyTimeline_t::key))) model->addEvent(name, DYNTimeline(key, ##__VA_ARGS__))
 
 /**
  * @brief Macro to define a constraint message
@@ -0,0 +1,80 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+/**
+ * @file  DYNMemoryUsage.cpp
+ *
+ * @brief Accounting of the memory allocated by the main structures of a simulation implementation
+ *
+ */
+#include "DYNMemoryUsage.h"
+
+namespace DYN {
+
+MemoryUsage::MemoryUsage() : bytes_() {}
+
+const char*
+MemoryUsage::getCategoryName(const Category category) {
+  switch (category) {
+    case SUB_MODEL_BUFFERS: return "subModelBuffers";
+    case VARIABLE_DEFINITIONS: return "variableDefinitions";
+    case SPARSE_MATRICES: return "sparseMatrices";
+    case LINEAR_SOLVER_FACTORS: return "linearSolverFactors";
+    case CURVES: return "curves";
+    case TIMELINE: return "timeline";
+    case DATA_INTERFACE: return "dataInterface";
+    case DELAY_BUFFERS: return "delayBuffers";
+    case NB_CATEGORIES: break;
+  }
+  return "";
+}
+
+void
+MemoryUsage::add(const Category category, const std::size_t bytes) {
+  bytes_[category] += bytes;
+}
+
+bool
+MemoryUsage::addShared(const void* object) {
+  return sharedObjects_.insert(object).second;
+}
+
+std::size_t
+MemoryUsage::get(const Category category) const {
+  return bytes_[category];
+}
+
+std::size_t
+MemoryUsage::getTotal() const {
+  std::size_t total = 0;
+  for (unsigned category = 0; category < NB_CATEGORIES; ++category)
+    total += bytes_[category];
+  return total;
+}
+
+std::size_t
+MemoryUsage::bytes(const std::string& string) {
+  // the short strings are stored in the string object itself
+  const std::size_t localCapacity = std::string().capacity();
+  return string.capacity() > localCapacity ? string.capacity() + 1 : 0;
+}
+
+std::size_t
+MemoryUsage::bytes(const std::vector<std::string>& strings) {
+  std::size_t total = bytes<std::string>(strings);
+  for (const auto& string : strings)
+    total += bytes(string);
+  return total;
+}
+
+}  // namespace DYN
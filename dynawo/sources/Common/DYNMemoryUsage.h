@@ -0,0 +1,168 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+/**
+ * @file  DYNMemoryUsage.h
+ *
+ * @brief Accounting of the memory allocated by the main structures of a simulation, by category
+ *
+ */
+#ifndef COMMON_DYNMEMORYUSAGE_H_
+#define COMMON_DYNMEMORYUSAGE_H_
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace DYN {
+
+/**
+ * @class MemoryUsage
+ * @brief bytes allocated by the main structures of a simulation, by category
+ *
+ * The structures add an estimate of the heap memory they own, computed from the capacity of their containers:
+ * the allocator overhead is not accounted. The structures shared by several owners (variable definitions of the
+ * sub models of the same type) are only accounted once, by the first owner calling addShared.
+ */
+class MemoryUsage {
+ public:
+  /**
+   * @brief categories of the accounted memory
+   */
+  typedef enum {
+    SUB_MODEL_BUFFERS = 0,     ///< buffers of the variables, residuals and roots of the sub models
+    VARIABLE_DEFINITIONS,      ///< definitions of the variables and parameters of the sub models
+    SPARSE_MATRICES,           ///< sparse matrices of the Jacobians
+    LINEAR_SOLVER_FACTORS,     ///< symbolic analyses and factors of the sparse linear solvers
+    CURVES,                    ///< points of the curves
+    TIMELINE,                  ///< events of the timeline
+    DATA_INTERFACE,            ///< components of the data interface
+    DELAY_BUFFERS,             ///< points of the delayed variables
+    NB_CATEGORIES              ///< number of categories
+  } Category;
+
+  /**
+   * @brief constructor, with no memory accounted
+   */
+  MemoryUsage();
+
+  /**
+   * @brief get the name of a category
+   *
+   * @param category category
+   * @return name of the category
+   */
+  static const char* getCategoryName(Category category);
+
+  /**
+   * @brief account bytes in a category
+   *
+   * @param category category
+   * @param bytes number of bytes allocated
+   */
+  void add(Category category, std::size_t bytes);
+
+  /**
+   * @brief mark a shared structure as accounted
+   *
+   * @param object address of the shared structure
+   * @return @b true if the structure was not accounted yet and has to be accounted by the caller
+   */
+  bool addShared(const void* object);
+
+  /**
+   * @brief get the bytes accounted in a category
+   *
+   * @param category category
+   * @return number of bytes accounted in the category
+   */
+  std::size_t get(Category category) const;
+
+  /**
+   * @brief get the bytes accounted in all the categories
+   *
+   * @return total number of bytes accounted
+   */
+  std::size_t getTotal() const;
+
+  /**
+   * @brief get the bytes allocated by a vector
+   *
+   * @param vector vector
+   * @return number of bytes allocated for the elements of the vector
+   */
+  template<typename T>
+  static std::size_t bytes(const std::vector<T>& vector) {
+    return vector.capacity() * sizeof(T);
+  }
+
+  /**
+   * @brief get the bytes allocated by a string, if it does not fit in the string itself
+   *
+   * @param string string
+   * @return number of bytes allocated for the characters of the string
+   */
+  static std::size_t bytes(const std::string& string);
+
+  /**
+   * @brief get the bytes allocated by a vector of strings
+   *
+   * @param strings vector of strings
+   * @return number of bytes allocated for the vector and the characters of the strings
+   */
+  static std::size_t bytes(const std::vector<std::string>& strings);
+
+  /**
+   * @brief get the bytes allocated by a hash map, without the memory owned by its elements
+   *
+   * @param map hash map
+   * @return number of bytes allocated for the buckets and the nodes of the hash map
+   */
+  template<typename K, typename V, typename H, typename E>
+  static std::size_t bytes(const std::unordered_map<K, V, H, E>& map) {
+    return map.bucket_count() * sizeof(void*) + map.size() * (sizeof(typename std::unordered_map<K, V, H, E>::value_type) + 2 * sizeof(void*));
+  }
+
+  /**
+   * @brief get the bytes allocated by a hash set, without the memory owned by its elements
+   *
+   * @param set hash set
+   * @return number of bytes allocated for the buckets and the nodes of the hash set
+   */
+  template<typename T, typename H, typename E>
+  static std::size_t bytes(const std::unordered_set<T, H, E>& set) {
+    return set.bucket_count() * sizeof(void*) + set.size() * (sizeof(T) + 2 * sizeof(void*));
+  }
+
+  /**
+   * @brief get the bytes allocated by an ordered map, without the memory owned by its elements
+   *
+   * @param map ordered map
+   * @return number of bytes allocated for the nodes of the map
+   */
+  template<typename K, typename V>
+  static std::size_t bytes(const std::map<K, V>& map) {
+    return map.size() * (sizeof(typename std::map<K, V>::value_type) + 4 * sizeof(void*));
+  }
+
+ private:
+  std::size_t bytes_[NB_CATEGORIES];  ///< bytes accounted by category
+  std::unordered_set<const void*> sharedObjects_;  ///< shared structures already accounted
+};
+
+}  // namespace DYN
+
+#endif  // COMMON_DYNMEMORYUSAGE_H_
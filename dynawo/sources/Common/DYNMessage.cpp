@@ -24,34 +24,39 @@
 #include <string>
 #include <sstream>
 #include "DYNMessage.hpp"
+#include "DYNMessageTemplate.h"
 #include "DYNIoDico.h"
 #include "DYNMacrosMessage.h"
 
 
-using std::stringstream;
 using std::string;
 
 namespace DYN {
 
 Message::Message(const dictionaryKey& dicoKey, const std::string& key) {
-  std::string dicoName;
+  static const std::string timelineDicoName = "TIMELINE";
+  static const std::string errorDicoName = "ERROR";
+  static const std::string constraintDicoName = "CONSTRAINT";
+  static const std::string logDicoName = "LOG";
+  static const std::string noDicoName;
+  const std::string* dicoName = &noDicoName;
   switch (dicoKey) {
     case TIMELINE_KEY:
-      dicoName = "TIMELINE";
+      dicoName = &timelineDicoName;
       break;
     case ERROR_KEY:
-      dicoName = "ERROR";
+      dicoName = &errorDicoName;
       break;
     case CONSTRAINT_KEY:
-      dicoName = "CONSTRAINT";
+      dicoName = &constraintDicoName;
       break;
     case LOG_KEY:
-      dicoName = "LOG";
+      dicoName = &logDicoName;
       break;
     default:
       break;
   }
-  initialize(dicoName, key);
+  initialize(*dicoName, key);
 }
 
 Message::Message(const std::string& dicoName, const std::string& key) {
@@ -63,45 +68,81 @@ Message::~Message() {}
 void
 Message::initialize(const std::string& dicoName, const std::string& key) {
   key_ = key;
-  fmt_.clear_binds();
-  hasFmt_ = false;
-  string fmt = "";
-  if (!dicoName.empty() && IoDicos::hasIoDico(dicoName)) {
-    try {
-      fmt = IoDicos::getIoDico(dicoName)->msg(key);
-      hasFmt_ = true;
-      fmt_ = boost::format(fmt.c_str());
-    } catch (const MessageError&) {
+  template_ = NULL;
+  const IoDico* dico = dicoName.empty() ? NULL : IoDicos::findIoDico(dicoName);
+  if (dico) {
+    const MessageTemplate* description = dico->find(key);
+    if (!description) {
       std::cerr << "Could not load the message associated to key " << key << std::endl;
+    } else if (description->isPrecompiled()) {
+      template_ = description;
+      argumentsEnds_.reserve(description->nbArguments());
+    } else {
+      fmt_.reset(new boost::format(description->description().c_str()));
     }
   } else {
-    hasFmt_ = false;
-    fmtss_ << key;
+    text_ = key;
   }
 }
 
 Message::Message(const Message& m) :
-fmt_(m.fmt_),
-hasFmt_(m.hasFmt_),
+template_(m.template_),
+arguments_(m.arguments_),
+argumentsEnds_(m.argumentsEnds_),
+fmt_(m.fmt_ ? new boost::format(*m.fmt_) : NULL),
+text_(m.text_),
 key_(m.key_) {
-  fmtss_ << m.fmtss_.str();
+}
+
+std::ostringstream&
+Message::argumentStream() {
+  static thread_local std::ostringstream stream;
+  stream.str(std::string());
+  stream.clear();
+  stream.flags(std::ios_base::dec | std::ios_base::skipws);
+  stream.precision(6);
+  stream.width(0);
+  stream.fill(' ');
+  return stream;
+}
+
+void
+Message::print(std::ostream& os) const {
+  if (template_) {
+    if (argumentsEnds_.size() < template_->nbArguments())
+      throw boost::io::too_few_args(argumentsEnds_.size(), template_->nbArguments());
+    // the message is written at once, as a stream may be shared between threads
+    static thread_local std::string message;
+    message.clear();
+    template_->format(arguments_, argumentsEnds_, message);
+    os << message;
+  } else if (fmt_) {
+    os << *fmt_;
+  } else {
+    os << text_;
+  }
 }
 
 std::string
 Message::str() const {
-  stringstream message;
-  if (hasFmt_) {
+  std::string message;
+  if (template_) {
+    if (argumentsEnds_.size() < template_->nbArguments())
+      std::cerr << boost::io::too_few_args(argumentsEnds_.size(), template_->nbArguments()).what() << " (key: " << key_ << ")" << std::endl;
+    else
+      template_->format(arguments_, argumentsEnds_, message);
+  } else if (fmt_) {
     try {
-      message << fmt_.str();
+      message = fmt_->str();
     }    catch (boost::io::too_many_args& exc) {
       std::cerr << exc.what() << " (key: " << key_ << ")" << std::endl;
     }    catch (boost::io::too_few_args& exc) {
       std::cerr << exc.what() << " (key: " << key_ << ")" << std::endl;
     }
   } else {
-    message << fmtss_.str();
+    message = text_;
   }
-  return message.str();
+  return message;
 }
 
 }  // namespace DYN
@@ -22,7 +22,10 @@
 
 #ifndef COMMON_DYNMESSAGE_H_
 #define COMMON_DYNMESSAGE_H_
+#include <memory>
 #include <sstream>
+#include <string>
+#include <vector>
 #include <boost/format.hpp>
 
 #ifdef __clang__
@@ -38,6 +41,7 @@
 #endif  // __clang__
 
 namespace DYN {
+class MessageTemplate;
 
 /**
  * @class Message
@@ -117,10 +121,7 @@ class Message {
    * a dictionnary)
    */
   friend std::ostream& operator<<(std::ostream& os, const Message& m) {
-    if (m.hasFmt_)
-      os << m.fmt_;
-    else
-      os << m.fmtss_.str();
+    m.print(os);
     return os;
   }
 
@@ -157,10 +158,57 @@ class Message {
    */
   void initialize(const std::string& dicoName, const std::string& key);
 
+  /**
+   * @brief add a parameter to the message
+   *
+   * @param x parameter to add
+   */
+  template <typename T> void addArgument(const T& x);
+
+  /**
+   * @brief append a parameter formatted as by a stream to a string
+   *
+   * @param output string where the parameter is appended
+   * @param x parameter to append
+   */
+  template <typename T> static void appendArgument(std::string& output, const T& x);
+
+  /**
+   * @brief append a string parameter to a string
+   *
+   * @param output string where the parameter is appended
+   * @param x parameter to append
+   */
+  static void appendArgument(std::string& output, const std::string& x) { output += x; }
+
+  /**
+   * @brief append a string parameter to a string
+   *
+   * @param output string where the parameter is appended
+   * @param x parameter to append
+   */
+  static void appendArgument(std::string& output, const char* x) { output += x; }
+
+  /**
+   * @brief get the stream formatting the parameters, reused by the messages of the thread
+   *
+   * @return stream formatting the parameters, empty
+   */
+  static std::ostringstream& argumentStream();
+
+  /**
+   * @brief write the message in a stream
+   *
+   * @param os stream where the message is written
+   */
+  void print(std::ostream& os) const;
+
  protected:
-  boost::format fmt_;  ///< log message with the boost format convention
-  std::stringstream fmtss_;  ///< log message when boost format message does not exist
-  bool hasFmt_;  ///< @b true is there is a log message in the dictionnary, @b false otherwise
+  const MessageTemplate* template_;  ///< precompiled message description in the dictionnary, @b NULL if there is none
+  std::string arguments_;  ///< formatted parameters of the precompiled message description, concatenated
+  std::vector<std::size_t> argumentsEnds_;  ///< end of each parameter in arguments_
+  std::unique_ptr<boost::format> fmt_;  ///< log message with the boost format convention, when it could not be precompiled
+  std::string text_;  ///< log message when there is no message description in the dictionnary
   std::string key_;  ///< Key to access to the log message in the dictionnary
 };
 }  // namespace DYN
@@ -23,27 +23,44 @@
 #include <stdio.h>
 #include <iostream>
 #include "DYNMessage.h"
+#include "DYNMessageTemplate.h"
 
 namespace DYN {
 
 template <typename T>
 Message& Message::operator,(T& x) {
-  if (hasFmt_)
-    fmt_ % x;
-  else
-    fmtss_ << " " << x;
+  addArgument(x);
   return *this;
 }
 
 template <typename T>
 Message& Message::operator,(const T& x) {
-  if (hasFmt_)
-    fmt_ % x;
-  else
-    fmtss_ << " " << x;
+  addArgument(x);
   return *this;
 }
 
+template <typename T>
+void Message::addArgument(const T& x) {
+  if (template_) {
+    if (argumentsEnds_.size() >= template_->nbArguments())
+      throw boost::io::too_many_args(argumentsEnds_.size(), template_->nbArguments());
+    appendArgument(arguments_, x);
+    argumentsEnds_.push_back(arguments_.size());
+  } else if (fmt_) {
+    *fmt_ % x;
+  } else {
+    text_ += ' ';
+    appendArgument(text_, x);
+  }
+}
+
+template <typename T>
+void Message::appendArgument(std::string& output, const T& x) {
+  std::ostringstream& stream = argumentStream();
+  stream << x;
+  output += stream.str();
+}
+
 }  // namespace DYN
 
 #endif  // COMMON_DYNMESSAGE_HPP_
@@ -0,0 +1,80 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+/**
+ * @file  DYNMessageTemplate.cpp
+ *
+ * @brief Message description of a dictionary parsed at load time implementation
+ *
+ */
+#include "DYNMessageTemplate.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace DYN {
+
+MessageTemplate::MessageTemplate(const std::string& description) :
+description_(description),
+nbArguments_(0),
+precompiled_(true) {
+  std::string text;
+  std::size_t i = 0;
+  while (i < description.size()) {
+    if (description[i] != '%') {
+      text += description[i++];
+      continue;
+    }
+    if (i + 1 < description.size() && description[i + 1] == '%') {
+      text += '%';
+      i += 2;
+      continue;
+    }
+    std::size_t end = i + 1;
+    unsigned int argument = 0;
+    while (end < description.size() && std::isdigit(static_cast<unsigned char>(description[end])) && argument < 1000)
+      argument = 10 * argument + static_cast<unsigned int>(description[end++] - '0');
+    if (end == i + 1 || end == description.size() || description[end] != '%' || argument == 0 || argument >= 1000) {
+      // other directive of the boost::format convention
+      parts_.clear();
+      nbArguments_ = 0;
+      precompiled_ = false;
+      return;
+    }
+    Part part;
+    part.text.swap(text);
+    part.argument = argument;
+    parts_.push_back(part);
+    nbArguments_ = std::max(nbArguments_, argument);
+    i = end + 1;
+  }
+  if (!text.empty()) {
+    Part part;
+    part.text.swap(text);
+    part.argument = 0;
+    parts_.push_back(part);
+  }
+}
+
+void
+MessageTemplate::format(const std::string& arguments, const std::vector<std::size_t>& argumentsEnds, std::string& message) const {
+  for (std::vector<Part>::const_iterator it = parts_.begin(); it != parts_.end(); ++it) {
+    message += it->text;
+    if (it->argument > 0) {
+      const std::size_t begin = it->argument > 1 ? argumentsEnds[it->argument - 2] : 0;
+      message.append(arguments, begin, argumentsEnds[it->argument - 1] - begin);
+    }
+  }
+}
+
+}  // namespace DYN
@@ -0,0 +1,94 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+/**
+ * @file  DYNMessageTemplate.h
+ *
+ * @brief Message description of a dictionary parsed at load time
+ *
+ */
+#ifndef COMMON_DYNMESSAGETEMPLATE_H_
+#define COMMON_DYNMESSAGETEMPLATE_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace DYN {
+
+/**
+ * @class MessageTemplate
+ * @brief Message description of a dictionary parsed once when the dictionary is read
+ *
+ * The descriptions only made of text and of positional directives @b %N% (and @b %% ) are precompiled into a list of
+ * text parts and argument indexes, so that a message is formatted by concatenating the parts and its arguments.
+ * The other descriptions, using the other directives of the boost::format convention, are not precompiled
+ * and are formatted with boost::format.
+ */
+class MessageTemplate {
+ public:
+  /**
+   * @brief constructor: parse the message description
+   *
+   * @param description message description with the boost::format convention
+   */
+  explicit MessageTemplate(const std::string& description);
+
+  /**
+   * @brief get the message description
+   *
+   * @return message description with the boost::format convention
+   */
+  const std::string& description() const { return description_; }
+
+  /**
+   * @brief whether the description was precompiled
+   *
+   * @return @b true if the description was precompiled, @b false if it has to be formatted with boost::format
+   */
+  bool isPrecompiled() const { return precompiled_; }
+
+  /**
+   * @brief get the number of arguments expected by the precompiled description
+   *
+   * @return highest argument index of the description
+   */
+  unsigned int nbArguments() const { return nbArguments_; }
+
+  /**
+   * @brief append the formatted message to a string, the description being precompiled
+   *
+   * @param arguments formatted arguments, concatenated
+   * @param argumentsEnds end of each argument in @b arguments, at least nbArguments() of them
+   * @param message string where the message is appended
+   */
+  void format(const std::string& arguments, const std::vector<std::size_t>& argumentsEnds, std::string& message) const;
+
+ private:
+  /**
+   * @brief part of a precompiled description: a text followed by an argument
+   */
+  struct Part {
+    std::string text;  ///< text of the part
+    unsigned int argument;  ///< index of the argument following the text, starting at 1, 0 if there is none
+  };
+
+  std::string description_;  ///< message description
+  std::vector<Part> parts_;  ///< parts of the precompiled description
+  unsigned int nbArguments_;  ///< number of arguments expected by the precompiled description
+  bool precompiled_;  ///< whether the description was precompiled
+};
+
+}  // namespace DYN
+
+#endif  // COMMON_DYNMESSAGETEMPLATE_H_
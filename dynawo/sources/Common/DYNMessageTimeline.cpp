@@ -43,16 +43,28 @@ void
 MessageTimeline::initialize(const string& key) {
   priority_ = boost::none;
   static const string dicoName = "TIMELINE_PRIORITY";
-  if (IoDicos::hasIoDico(dicoName)) {
-    try {
-      const string priority = IoDicos::getIoDico(dicoName)->msg(key);
-      priority_ = std::stoi(priority);
-    } catch (const MessageError&) {
+  const IoDico* dico = IoDicos::findIoDico(dicoName);
+  if (dico) {
+    const MessageTemplate* priority = dico->find(key);
+    if (priority)
+      priority_ = std::stoi(priority->description());
+    else
       std::cerr << "Could not load the message associated to key " << key << std::endl;
-    }
   }
 }
 
+boost::optional<int>
+MessageTimeline::priorityOf(const string& key) {
+  static const string dicoName = "TIMELINE_PRIORITY";
+  const IoDico* dico = IoDicos::findIoDico(dicoName);
+  if (!dico)
+    return boost::none;
+  const MessageTemplate* priority = dico->find(key);
+  if (!priority)
+    return boost::none;
+  return std::stoi(priority->description());
+}
+
 MessageTimeline::MessageTimeline(const MessageTimeline& m) :
 Message(m),
 priority_(m.priority_) { }
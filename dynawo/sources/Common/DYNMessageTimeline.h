@@ -109,6 +109,14 @@ class MessageTimeline : public Message {
    */
   inline const boost::optional<int>& priority() const { return priority_; }
 
+  /**
+   * @brief Priority of a timeline message, without creating the message
+   *
+   * @param key key of the message description
+   * @return Priority of the message, none if it has no priority
+   */
+  static boost::optional<int> priorityOf(const std::string& key);
+
  private:
   MessageTimeline();
 
@@ -0,0 +1,353 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+/**
+ * @file  DYNProfiler.cpp
+ *
+ * @brief Low overhead hierarchical profiler implementation
+ *
+ */
+#include "DYNProfiler.h"
+
+#include <cstring>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace DYN {
+
+/**
+ * @brief measured scope recorded in the trace
+ */
+struct TraceEvent {
+  Profiler::Scope scope;  ///< profiled scope
+  double start;  ///< time of entry in the scope in microseconds, since the last reset
+  double duration;  ///< time spent in the scope in microseconds
+};
+
+/**
+ * @brief statistics accumulated by a thread
+ */
+struct ThreadProfile {
+  unsigned int threadIndex = 0;  ///< index of the thread in the registry, used as the track of the trace
+  Profiler::Scope current = Profiler::NB_SCOPES;  ///< innermost measured scope, NB_SCOPES outside of any scope
+  unsigned int skippedDepth = 0;  ///< depth of the scopes entered in an outermost scope which is not sampled
+  std::uint64_t nbOutermostScopes = 0;  ///< number of outermost scopes entered, for the sampling
+  std::uint64_t nbCalls[Profiler::NB_SCOPES + 1][Profiler::NB_SCOPES] = {};  ///< number of calls by parent and scope
+  double time[Profiler::NB_SCOPES + 1][Profiler::NB_SCOPES] = {};  ///< time in seconds by parent and scope
+  std::uint64_t counters[Profiler::NB_SCOPES + 1][Profiler::NB_SCOPES][Profiler::NB_COUNTERS] = {};  ///< hardware counters by parent and scope
+  std::vector<TraceEvent> events;  ///< measured scopes recorded in the trace
+  bool countersOpened = false;  ///< whether the opening of the hardware counters was attempted
+  std::vector<int> counterFds;  ///< file descriptors of the hardware counters, the first one leading the group, empty if unavailable
+
+  /**
+   * @brief destructor, closing the hardware counters
+   */
+  ~ThreadProfile() {
+#ifdef __linux__
+    for (const int fd : counterFds)
+      close(fd);
+#endif
+  }
+};
+
+std::atomic<unsigned int> Profiler::samplingPeriod_(0);
+std::atomic<bool> Profiler::traceEnabled_(false);
+std::atomic<bool> Profiler::hardwareCountersEnabled_(false);
+
+/**
+ * @brief registry of the profiles of all the threads, kept after the end of the threads
+ */
+struct ProfileRegistry {
+  std::mutex mutex;  ///< mutex for the registration of the threads
+  std::vector<std::shared_ptr<ThreadProfile> > profiles;  ///< profiles of the threads
+  std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();  ///< origin of the trace, set at each reset
+  std::atomic<bool> hardwareCountersAvailable{false};  ///< whether a thread could open the hardware counters
+};
+
+/**
+ * @brief get the registry of the profiles
+ * @return registry of the profiles
+ */
+static ProfileRegistry&
+profileRegistry() {
+  static ProfileRegistry registry;
+  return registry;
+}
+
+/**
+ * @brief get the profile of the current thread, created at the first call
+ * @return profile of the current thread
+ */
+static ThreadProfile&
+threadProfile() {
+  static thread_local std::shared_ptr<ThreadProfile> profile;
+  if (!profile) {
+    profile = std::make_shared<ThreadProfile>();
+    ProfileRegistry& registry = profileRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    profile->threadIndex = static_cast<unsigned int>(registry.profiles.size());
+    registry.profiles.push_back(profile);
+  }
+  return *profile;
+}
+
+/**
+ * @brief open the hardware counters of the current thread as a group, so that they are read together
+ * @param profile profile of the current thread
+ */
+static void
+openHardwareCounters(ThreadProfile& profile) {
+  profile.countersOpened = true;
+#ifdef __linux__
+  static const std::uint64_t configs[Profiler::NB_COUNTERS] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                                               PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+  for (unsigned counter = 0; counter < Profiler::NB_COUNTERS; ++counter) {
+    perf_event_attr attributes;
+    memset(&attributes, 0, sizeof(attributes));
+    attributes.type = PERF_TYPE_HARDWARE;
+    attributes.size = sizeof(attributes);
+    attributes.config = configs[counter];
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+    attributes.read_format = PERF_FORMAT_GROUP;
+    const int groupFd = profile.counterFds.empty() ? -1 : profile.counterFds.front();
+    const int fd = static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, groupFd, 0));
+    if (fd < 0) {
+      // all the counters or none, to keep the ratios meaningful
+      for (const int openedFd : profile.counterFds)
+        close(openedFd);
+      profile.counterFds.clear();
+      return;
+    }
+    profile.counterFds.push_back(fd);
+  }
+  profileRegistry().hardwareCountersAvailable.store(true, std::memory_order_relaxed);
+#endif
+}
+
+/**
+ * @brief read the hardware counters of the current thread, opened at the first call
+ * @param profile profile of the current thread
+ * @param counters values of the counters, filled if the read succeeds
+ * @return @b true if the counters could be read
+ */
+static bool
+readHardwareCounters(ThreadProfile& profile, std::uint64_t* counters) {
+  if (!profile.countersOpened)
+    openHardwareCounters(profile);
+  if (profile.counterFds.empty())
+    return false;
+#ifdef __linux__
+  // PERF_FORMAT_GROUP: number of counters followed by their values
+  std::uint64_t values[Profiler::NB_COUNTERS + 1];
+  if (read(profile.counterFds.front(), values, sizeof(values)) != static_cast<ssize_t>(sizeof(values)))
+    return false;
+  memcpy(counters, values + 1, Profiler::NB_COUNTERS * sizeof(std::uint64_t));
+  return true;
+#else
+  return false;
+#endif
+}
+
+const char*
+Profiler::getScopeName(const Scope scope) {
+  switch (scope) {
+    case SOLVER_STEP: return "solverStep";
+    case EVAL_F: return "evalF";
+    case EVAL_G: return "evalG";
+    case EVAL_JT: return "evalJt";
+    case EVAL_Z: return "evalZ";
+    case EVAL_MODE: return "evalMode";
+    case CALCULATED_VARIABLES: return "calculatedVariables";
+    case NETWORK: return "network";
+    case FACTORIZATION: return "factorization";
+    case LINEAR_SOLVE: return "linearSolve";
+    case MODE_CHANGE: return "modeChange";
+    case CRITERIA: return "criteria";
+    case CURVES: return "curves";
+    case OUTPUTS: return "outputs";
+    case NB_SCOPES: break;
+  }
+  return "";
+}
+
+const char*
+Profiler::getCounterName(const Counter counter) {
+  switch (counter) {
+    case CYCLES: return "cycles";
+    case INSTRUCTIONS: return "instructions";
+    case CACHE_MISSES: return "cacheMisses";
+    case BRANCH_MISSES: return "branchMisses";
+    case NB_COUNTERS: break;
+  }
+  return "";
+}
+
+void
+Profiler::setHardwareCountersEnabled(const bool hardwareCountersEnabled) {
+  hardwareCountersEnabled_.store(hardwareCountersEnabled, std::memory_order_relaxed);
+}
+
+bool
+Profiler::areHardwareCountersAvailable() {
+  return profileRegistry().hardwareCountersAvailable.load(std::memory_order_relaxed);
+}
+
+void
+Profiler::setSamplingPeriod(const unsigned int samplingPeriod) {
+  samplingPeriod_.store(samplingPeriod, std::memory_order_relaxed);
+}
+
+std::vector<Profiler::Statistics>
+Profiler::getStatistics() {
+  std::uint64_t nbCalls[NB_SCOPES + 1][NB_SCOPES] = {};
+  double time[NB_SCOPES + 1][NB_SCOPES] = {};
+  std::uint64_t counters[NB_SCOPES + 1][NB_SCOPES][NB_COUNTERS] = {};
+  {
+    ProfileRegistry& registry = profileRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (const auto& profile : registry.profiles) {
+      for (unsigned parent = 0; parent <= NB_SCOPES; ++parent) {
+        for (unsigned scope = 0; scope < NB_SCOPES; ++scope) {
+          nbCalls[parent][scope] += profile->nbCalls[parent][scope];
+          time[parent][scope] += profile->time[parent][scope];
+          for (unsigned counter = 0; counter < NB_COUNTERS; ++counter)
+            counters[parent][scope][counter] += profile->counters[parent][scope][counter];
+        }
+      }
+    }
+  }
+
+  const unsigned int samplingPeriod = getSamplingPeriod() > 0 ? getSamplingPeriod() : 1;
+  std::vector<Statistics> statistics;
+  for (unsigned parent = 0; parent <= NB_SCOPES; ++parent) {
+    for (unsigned scope = 0; scope < NB_SCOPES; ++scope) {
+      if (nbCalls[parent][scope] == 0)
+        continue;
+      Statistics scopeStatistics;
+      scopeStatistics.parent = static_cast<Scope>(parent);
+      scopeStatistics.scope = static_cast<Scope>(scope);
+      scopeStatistics.nbCalls = nbCalls[parent][scope] * samplingPeriod;
+      scopeStatistics.time = time[parent][scope] * samplingPeriod;
+      for (unsigned counter = 0; counter < NB_COUNTERS; ++counter)
+        scopeStatistics.counters[counter] = counters[parent][scope][counter] * samplingPeriod;
+      statistics.push_back(scopeStatistics);
+    }
+  }
+  return statistics;
+}
+
+void
+Profiler::reset() {
+  ProfileRegistry& registry = profileRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (const auto& profile : registry.profiles) {
+    for (unsigned parent = 0; parent <= NB_SCOPES; ++parent) {
+      for (unsigned scope = 0; scope < NB_SCOPES; ++scope) {
+        profile->nbCalls[parent][scope] = 0;
+        profile->time[parent][scope] = 0.;
+        for (unsigned counter = 0; counter < NB_COUNTERS; ++counter)
+          profile->counters[parent][scope][counter] = 0;
+      }
+    }
+    profile->nbOutermostScopes = 0;
+    profile->events.clear();
+  }
+  registry.origin = std::chrono::steady_clock::now();
+}
+
+void
+Profiler::setTraceEnabled(const bool traceEnabled) {
+  traceEnabled_.store(traceEnabled, std::memory_order_relaxed);
+}
+
+void
+Profiler::exportTrace(std::ostream& stream) {
+  ProfileRegistry& registry = profileRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  const std::ios_base::fmtflags flags = stream.flags();
+  stream << std::fixed << std::setprecision(3);
+  stream << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+  bool first = true;
+  for (const auto& profile : registry.profiles) {
+    if (profile->events.empty())
+      continue;
+    stream << (first ? "\n" : ",\n");
+    first = false;
+    stream << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << profile->threadIndex
+           << ", \"args\": {\"name\": \"thread " << profile->threadIndex << "\"}}";
+    for (const auto& event : profile->events) {
+      stream << ",\n{\"name\": \"" << getScopeName(event.scope) << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << profile->threadIndex
+             << ", \"ts\": " << event.start << ", \"dur\": " << event.duration << "}";
+    }
+  }
+  stream << "\n]}\n";
+  stream.flags(flags);
+}
+
+void
+ProfilerScope::enter(const Profiler::Scope scope) {
+  const unsigned int samplingPeriod = Profiler::getSamplingPeriod();
+  if (samplingPeriod == 0)
+    return;  // disabled meanwhile
+  profile_ = &threadProfile();
+  if (profile_->skippedDepth > 0) {
+    ++profile_->skippedDepth;
+    return;
+  }
+  if (profile_->current == Profiler::NB_SCOPES && profile_->nbOutermostScopes++ % samplingPeriod != 0) {
+    profile_->skippedDepth = 1;
+    return;
+  }
+  measured_ = true;
+  scope_ = scope;
+  parent_ = profile_->current;
+  profile_->current = scope;
+  if (Profiler::isHardwareCountersEnabled())
+    countersRead_ = readHardwareCounters(*profile_, startCounters_);
+  start_ = std::chrono::steady_clock::now();
+}
+
+void
+ProfilerScope::leave() {
+  if (!measured_) {
+    --profile_->skippedDepth;
+    return;
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_;
+  std::uint64_t counters[Profiler::NB_COUNTERS];
+  if (countersRead_ && readHardwareCounters(*profile_, counters)) {
+    for (unsigned counter = 0; counter < Profiler::NB_COUNTERS; ++counter)
+      profile_->counters[parent_][scope_][counter] += counters[counter] - startCounters_[counter];
+  }
+  profile_->time[parent_][scope_] += elapsed.count();
+  ++profile_->nbCalls[parent_][scope_];
+  if (Profiler::isTraceEnabled()) {
+    const std::chrono::duration<double, std::micro> start = start_ - profileRegistry().origin;
+    TraceEvent event;
+    event.scope = scope_;
+    event.start = start.count();
+    event.duration = 1e6 * elapsed.count();
+    profile_->events.push_back(event);
+  }
+  profile_->current = parent_;
+}
+
+}  // namespace DYN
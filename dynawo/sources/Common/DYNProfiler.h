@@ -0,0 +1,252 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+/**
+ * @file  DYNProfiler.h
+ *
+ * @brief Low overhead hierarchical profiler header, available in release builds
+ *
+ */
+#ifndef COMMON_DYNPROFILER_H_
+#define COMMON_DYNPROFILER_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+namespace DYN {
+
+struct ThreadProfile;
+
+/**
+ * @class Profiler
+ * @brief Accumulation of the time spent in a fixed set of scopes, attributed to their parent scope
+ *
+ * Unlike Timer, the scopes are identified at compile time and the times are accumulated in thread local tables,
+ * so that the profiler can be enabled in production runs. When it is disabled, a scope only costs an atomic load.
+ * With a sampling period n, only one out of n outermost scopes of each thread (time steps, curves updates, outputs)
+ * is measured, with all its nested scopes, and the statistics are extrapolated.
+ */
+class Profiler : private boost::noncopyable {
+ public:
+  /**
+   * @brief profiled scopes
+   */
+  typedef enum {
+    SOLVER_STEP = 0,           ///< time step of the solver
+    EVAL_F,                    ///< evaluation of the residual functions
+    EVAL_G,                    ///< evaluation of the root functions
+    EVAL_JT,                   ///< evaluation of the Jacobian
+    EVAL_Z,                    ///< evaluation of the discrete variables
+    EVAL_MODE,                 ///< evaluation of the modes
+    CALCULATED_VARIABLES,      ///< evaluation of the calculated variables
+    NETWORK,                   ///< evaluation of the network model, nested in the evaluation calling it
+    FACTORIZATION,             ///< setup (factorization) of the linear solver
+    LINEAR_SOLVE,              ///< solve of the factorized linear system
+    MODE_CHANGE,               ///< reinitialization of the solver after a mode change
+    CRITERIA,                  ///< check of the criteria
+    CURVES,                    ///< update of the curves
+    OUTPUTS,                   ///< export and publication of the outputs
+    NB_SCOPES                  ///< number of scopes, also used as the parent of the outermost scopes
+  } Scope;
+
+  /**
+   * @brief hardware performance counters read around the measured scopes
+   */
+  typedef enum {
+    CYCLES = 0,                ///< CPU cycles
+    INSTRUCTIONS,              ///< retired instructions
+    CACHE_MISSES,              ///< last level cache misses
+    BRANCH_MISSES,             ///< mispredicted branches
+    NB_COUNTERS                ///< number of hardware counters
+  } Counter;
+
+  /**
+   * @brief statistics of a scope called from a given parent scope
+   */
+  struct Statistics {
+    Scope parent;           ///< parent scope, NB_SCOPES for an outermost scope
+    Scope scope;            ///< scope
+    std::uint64_t nbCalls;  ///< number of calls, extrapolated if sampled
+    double time;            ///< total time in seconds, nested scopes included, extrapolated if sampled
+    std::uint64_t counters[NB_COUNTERS];  ///< hardware counters, nested scopes included, extrapolated if sampled, 0 if not read
+  };
+
+  /**
+   * @brief get the name of a scope
+   *
+   * @param scope scope
+   * @return name of the scope
+   */
+  static const char* getScopeName(Scope scope);
+
+  /**
+   * @brief set the sampling period of the profiler
+   *
+   * @param samplingPeriod 0 to disable the profiler, n to measure one out of n outermost scopes
+   */
+  static void setSamplingPeriod(unsigned int samplingPeriod);
+
+  /**
+   * @brief get the sampling period of the profiler
+   *
+   * @return 0 if the profiler is disabled, n if one out of n outermost scopes is measured
+   */
+  static unsigned int getSamplingPeriod() {
+    return samplingPeriod_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief whether the profiler is enabled
+   *
+   * @return @b true if the scopes are measured
+   */
+  static bool isEnabled() {
+    return getSamplingPeriod() > 0;
+  }
+
+  /**
+   * @brief get the statistics accumulated by all the threads, to be called when the profiled threads are idle
+   *
+   * @return statistics of each (parent, scope) pair that was called at least once
+   */
+  static std::vector<Statistics> getStatistics();
+
+  /**
+   * @brief get the name of a hardware counter
+   *
+   * @param counter hardware counter
+   * @return name of the hardware counter
+   */
+  static const char* getCounterName(Counter counter);
+
+  /**
+   * @brief enable or disable the reading of the hardware performance counters around the measured scopes
+   *
+   * The counters are only read on Linux, through perf_event_open, for the user space of the calling threads.
+   * Each read costs a system call, so the sampling period should be increased accordingly.
+   *
+   * @param hardwareCountersEnabled @b true to read the hardware counters, in addition to the time
+   */
+  static void setHardwareCountersEnabled(bool hardwareCountersEnabled);
+
+  /**
+   * @brief whether the hardware performance counters are read around the measured scopes
+   *
+   * @return @b true if the hardware counters are read
+   */
+  static bool isHardwareCountersEnabled() {
+    return hardwareCountersEnabled_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief whether the hardware performance counters could be opened by at least one profiled thread
+   *
+   * They may be unavailable on other systems than Linux, in virtual machines or if perf_event_paranoid forbids them.
+   *
+   * @return @b true if the statistics contain hardware counters
+   */
+  static bool areHardwareCountersAvailable();
+
+  /**
+   * @brief reset the statistics of all the threads, to be called when the profiled threads are idle
+   */
+  static void reset();
+
+  /**
+   * @brief enable or disable the recording of each measured scope in a trace
+   *
+   * @param traceEnabled @b true to record the measured scopes, in addition to the statistics
+   */
+  static void setTraceEnabled(bool traceEnabled);
+
+  /**
+   * @brief whether the measured scopes are recorded in a trace
+   *
+   * @return @b true if the measured scopes are recorded
+   */
+  static bool isTraceEnabled() {
+    return traceEnabled_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief export the recorded scopes in the Chrome trace event format, with one track per thread,
+   * to be called when the profiled threads are idle
+   *
+   * @param stream stream where the trace should be written
+   */
+  static void exportTrace(std::ostream& stream);
+
+ private:
+  static std::atomic<unsigned int> samplingPeriod_;  ///< sampling period, 0 if the profiler is disabled
+  static std::atomic<bool> traceEnabled_;  ///< whether the measured scopes are recorded in a trace
+  static std::atomic<bool> hardwareCountersEnabled_;  ///< whether the hardware counters are read around the measured scopes
+};
+
+/**
+ * @class ProfilerScope
+ * @brief Measure the time spent between its creation and its destruction in a profiled scope
+ */
+class ProfilerScope : private boost::noncopyable {
+ public:
+  /**
+   * @brief constructor: enter the scope
+   *
+   * @param scope profiled scope
+   */
+  explicit ProfilerScope(const Profiler::Scope scope) :
+  profile_(NULL),
+  measured_(false),
+  countersRead_(false) {
+    if (Profiler::isEnabled())
+      enter(scope);
+  }
+
+  /**
+   * @brief destructor: leave the scope
+   */
+  ~ProfilerScope() {
+    if (profile_)
+      leave();
+  }
+
+ private:
+  /**
+   * @brief enter the scope, the profiler being enabled
+   *
+   * @param scope profiled scope
+   */
+  void enter(Profiler::Scope scope);
+
+  /**
+   * @brief leave the scope
+   */
+  void leave();
+
+ private:
+  ThreadProfile* profile_;  ///< profile of the current thread, null if the profiler was disabled when the scope was entered
+  bool measured_;  ///< @b false if the scope is nested in an outermost scope which is not sampled
+  bool countersRead_;  ///< @b true if the hardware counters were read at the entry in the scope
+  Profiler::Scope scope_;  ///< profiled scope
+  Profiler::Scope parent_;  ///< enclosing profiled scope
+  std::chrono::steady_clock::time_point start_;  ///< time of entry in the scope
+  std::uint64_t startCounters_[Profiler::NB_COUNTERS];  ///< hardware counters at the entry in the scope, if they are read
+};
+
+}  // namespace DYN
+
+#endif  // COMMON_DYNPROFILER_H_
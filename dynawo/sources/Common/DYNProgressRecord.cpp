@@ -0,0 +1,129 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNProgressRecord.cpp
+ *
+ * @brief Progress of a simulation published in a named shared memory segment implementation
+ *
+ */
+#include <cerrno>
+#include <cstring>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "DYNProgressRecord.h"
+#include "DYNMacrosMessage.h"
+
+namespace DYN {
+
+static const std::uint32_t PROGRESS_RECORD_MAGIC = 0x44594e50;  ///< "DYNP"
+static const std::uint32_t PROGRESS_RECORD_LAYOUT_VERSION = 1;  ///< version of the layout of the segment
+static const unsigned PROGRESS_RECORD_READ_ATTEMPTS = 100;  ///< number of attempts to read a record not being written
+
+ProgressRecord::ProgressRecord(const std::string& name) :
+name_(name),
+removed_(false),
+record_(NULL) {
+#ifndef _WIN32
+  shm_unlink(name.c_str());
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+  if (fd >= 0 && ftruncate(fd, static_cast<off_t>(sizeof(Record))) != 0) {
+    close(fd);
+    fd = -1;
+  }
+  if (fd < 0)
+    throw DYNError(Error::GENERAL, ProgressRecordOpenFailed, name, strerror(errno));
+
+  void* address = mmap(NULL, sizeof(Record), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (address == MAP_FAILED) {
+    shm_unlink(name.c_str());
+    throw DYNError(Error::GENERAL, ProgressRecordOpenFailed, name, strerror(errno));
+  }
+  // the segment is zero-filled by ftruncate, the magic number is written last to publish the layout
+  record_ = static_cast<Record*>(address);
+  record_->layoutVersion = PROGRESS_RECORD_LAYOUT_VERSION;
+  record_->sequence.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  record_->magic = PROGRESS_RECORD_MAGIC;
+#else
+  throw DYNError(Error::GENERAL, ProgressRecordOpenFailed, name, "shared memory not supported on this system");
+#endif
+}
+
+ProgressRecord::~ProgressRecord() {
+#ifndef _WIN32
+  munmap(record_, sizeof(Record));
+  remove();
+#endif
+}
+
+void
+ProgressRecord::update(const Progress& progress) {
+  const std::uint64_t sequence = record_->sequence.load(std::memory_order_relaxed);
+  record_->sequence.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  std::memcpy(&record_->progress, &progress, sizeof(Progress));
+  record_->sequence.store(sequence + 2, std::memory_order_release);
+}
+
+void
+ProgressRecord::remove() {
+  if (removed_)
+    return;
+#ifndef _WIN32
+  shm_unlink(name_.c_str());
+#endif
+  removed_ = true;
+}
+
+bool
+ProgressRecord::read(const std::string& name, Progress& progress) {
+#ifndef _WIN32
+  const int fd = shm_open(name.c_str(), O_RDONLY, 0);
+  if (fd < 0)
+    return false;
+  struct stat status;
+  const bool sizeOk = fstat(fd, &status) == 0 && static_cast<std::size_t>(status.st_size) == sizeof(Record);
+  void* address = sizeOk ? mmap(NULL, sizeof(Record), PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+  close(fd);
+  if (address == MAP_FAILED)
+    return false;
+
+  const Record* record = static_cast<const Record*>(address);
+  bool read = false;
+  if (record->magic == PROGRESS_RECORD_MAGIC && record->layoutVersion == PROGRESS_RECORD_LAYOUT_VERSION) {
+    for (unsigned attempt = 0; attempt < PROGRESS_RECORD_READ_ATTEMPTS && !read; ++attempt) {
+      const std::uint64_t sequence = record->sequence.load(std::memory_order_acquire);
+      if (sequence % 2 != 0)
+        continue;
+      std::memcpy(&progress, &record->progress, sizeof(Progress));
+      std::atomic_thread_fence(std::memory_order_acquire);
+      read = record->sequence.load(std::memory_order_relaxed) == sequence;
+    }
+  }
+  munmap(address, sizeof(Record));
+  return read;
+#else
+  static_cast<void>(name);
+  static_cast<void>(progress);
+  return false;
+#endif
+}
+
+}  // end namespace DYN
@@ -0,0 +1,113 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNProgressRecord.h
+ *
+ * @brief Progress of a simulation published in a named shared memory segment
+ *
+ */
+#ifndef COMMON_DYNPROGRESSRECORD_H_
+#define COMMON_DYNPROGRESSRECORD_H_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include <boost/core/noncopyable.hpp>
+
+namespace DYN {
+
+/**
+ * @class ProgressRecord
+ * @brief fixed-size record of the progress of a simulation, updated in place in a named shared memory segment
+ *
+ * Contrary to the timetable file, rewritten at each update, the record is created once and only written in memory, so
+ * that monitoring tools can poll it at no file system cost. The updates are published through a sequence number,
+ * odd while the record is written: a reader copies the record and keeps the copy if the sequence number was even and
+ * did not change meanwhile.
+ *
+ * Layout of the segment, in native byte order: magic number (uint32), layout version (uint32), sequence number (uint64),
+ * followed by the fields of Progress.
+ */
+class ProgressRecord : private boost::noncopyable {
+ public:
+  /**
+   * @brief progress of a simulation
+   */
+  struct Progress {
+    double time;  ///< current time of the simulation
+    double stopTime;  ///< stop time of the simulation
+    double wallTime;  ///< time spent since the beginning of the time loop in seconds
+    std::uint64_t iteration;  ///< number of time steps done
+    std::uint64_t nbSteps;  ///< number of steps of the solver
+    std::uint64_t nbResidualEvaluations;  ///< number of residual evaluations
+    std::uint64_t nbNonLinearIterations;  ///< number of nonlinear iterations
+    std::uint64_t nbErrorTestFailures;  ///< number of error test failures
+    std::uint64_t nbConvergenceFailures;  ///< number of nonlinear convergence failures
+    std::uint64_t nbRootEvaluations;  ///< number of root function evaluations
+  };
+
+  /**
+   * @brief Constructor: create the shared memory segment, an existing one being replaced
+   *
+   * @param name name of the segment, starting with '/'
+   * @throw ProgressRecordOpenFailed error if the segment cannot be created
+   */
+  explicit ProgressRecord(const std::string& name);
+
+  /**
+   * @brief Destructor: unmap the segment and remove it
+   */
+  ~ProgressRecord();
+
+  /**
+   * @brief publish a new progress
+   *
+   * @param progress progress of the simulation
+   */
+  void update(const Progress& progress);
+
+  /**
+   * @brief remove the segment, for instance once the simulation is over, the record being still updatable
+   */
+  void remove();
+
+  /**
+   * @brief read the last progress published in a segment
+   *
+   * @param name name of the segment
+   * @param progress progress read
+   * @return @b false if the segment does not exist, is not a progress record or was being written at each attempt
+   */
+  static bool read(const std::string& name, Progress& progress);
+
+ private:
+  /**
+   * @brief content of the segment
+   */
+  struct Record {
+    std::uint32_t magic;  ///< magic number of a dynawo progress record
+    std::uint32_t layoutVersion;  ///< version of the layout
+    std::atomic<std::uint64_t> sequence;  ///< incremented before and after each update
+    Progress progress;  ///< last progress published
+  };
+
+  std::string name_;  ///< name of the segment
+  bool removed_;  ///< @b true if the segment was already removed
+  Record* record_;  ///< mapped record
+};
+
+}  // end namespace DYN
+
+#endif  // COMMON_DYNPROGRESSRECORD_H_
@@ -17,6 +17,8 @@
  * @brief  Sparse Matrix class implementation
  *
  */
+#include <algorithm>
+#include <atomic>
 #include <map>
 #include <set>
 #include <sstream>
@@ -32,8 +34,10 @@
 #include "DYNCommon.h"
 #include "DYNMacrosMessage.h"
 #include "DYNFileSystemUtils.h"
+#include "DYNHugePages.h"
 #include "DYNSparseMatrix.h"
 #include "DYNTrace.h"
+#include "DYNVectorKernels.h"
 #include "DYNFileSystemUtils.h"
 
 using std::map;
@@ -46,6 +50,18 @@ namespace fs = boost::filesystem;
 namespace DYN {
 
 const int MATRIX_BLOCK_LENGTH = 1024;  ///< Number of block reallocated when maximum number of variables allocated is reached
+const uint64_t STRUCTURE_HASH_INIT = 14695981039346656037ULL;  ///< FNV-1a offset basis used as hash of an empty structure
+static std::atomic<uint64_t> lastStructureVersion(0);  ///< last structure version given to a matrix
+
+/**
+ * @brief add an element of a matrix structure to a structure hash
+ * @param hash hash to update
+ * @param value element to add
+ */
+static inline void
+hashStructure(uint64_t& hash, const uint64_t value) {
+  hash = (hash ^ value) * 1099511628211ULL;  // FNV-1a prime
+}
 
 SparseMatrix::SparseMatrix() :
 withoutNan_(true),
@@ -56,7 +72,12 @@ iAp_(0),
 iAi_(0),
 iAx_(0),
 nbTerm_(0),
-currentMaxTerm_(0) { }
+currentMaxTerm_(0),
+structureNbRow_(0),
+structureNbCol_(0),
+previousColumnEnd_(0),
+structureChanged_(false),
+structureVersion_(0) { }
 
 SparseMatrix::~SparseMatrix() {
   free();
@@ -64,8 +85,11 @@ SparseMatrix::~SparseMatrix() {
 
 void
 SparseMatrix::changeCol() {
+  closeColumn();
   ++iAp_;
   assert(iAp_ < nbCol_ + 1);
+  // the previous structure is overwritten as the new one is filled
+  previousColumnEnd_ = Ap_[iAp_];
   Ap_[iAp_] = Ap_[iAp_ - 1];
 }
 
@@ -76,6 +100,8 @@ SparseMatrix::addTerm(const int row, const double val) {
     // To deal with exploding matrix sizes
     if (nbTerm_ >= currentMaxTerm_) increaseReserve();
     ++Ap_[iAp_];
+    if (!structureChanged_ && Ai_[iAi_] != static_cast<unsigned>(row))
+      markStructureChanged();
     Ai_[iAi_] = row;
     Ax_[iAx_] = val;
     ++iAi_;
@@ -91,24 +117,51 @@ SparseMatrix::addTerm(const int row, const double val) {
   }
 }
 
+void
+SparseMatrix::appendColumns(const SparseMatrix& block) {
+  assert(iAp_ + block.iAp_ < nbCol_ + 1);
+  if (nbTerm_ + block.nbTerm_ > currentMaxTerm_) {
+    currentMaxTerm_ = ((nbTerm_ + block.nbTerm_) / MATRIX_BLOCK_LENGTH + 1) * MATRIX_BLOCK_LENGTH;
+    Ai_.resize(currentMaxTerm_);
+    Ax_.resize(currentMaxTerm_);
+    adviseHugePages();
+  }
+
+  const unsigned offset = Ap_[iAp_];
+  // same structure comparison as if the terms had been added one by one
+  for (int i = 1; i <= block.iAp_; ++i) {
+    if (Ap_[iAp_ + i - 1] != previousColumnEnd_)
+      markStructureChanged();
+    previousColumnEnd_ = Ap_[iAp_ + i];
+    Ap_[iAp_ + i] = offset + block.Ap_[i];
+  }
+  if (!structureChanged_ && !std::equal(block.Ai_.begin(), block.Ai_.begin() + block.nbTerm_, Ai_.begin() + iAi_))
+    markStructureChanged();
+  std::copy(block.Ai_.begin(), block.Ai_.begin() + block.nbTerm_, Ai_.begin() + iAi_);
+  std::copy(block.Ax_.begin(), block.Ax_.begin() + block.nbTerm_, Ax_.begin() + iAx_);
+
+  iAp_ += block.iAp_;
+  iAi_ += block.nbTerm_;
+  iAx_ += block.nbTerm_;
+  nbTerm_ += block.nbTerm_;
+  withoutNan_ = withoutNan_ && block.withoutNan_;
+  withoutInf_ = withoutInf_ && block.withoutInf_;
+}
+
 void
 SparseMatrix::init(const int nbRow, const int nbCol) {
-  free();
+  clearKeepCapacity();
 
-  if (nbRow == 0) return;
+  if (nbRow == 0) {
+    startStructure(0, 0);
+    return;
+  }
   nbRow_ = nbRow;
   nbCol_ = nbCol;
-  currentMaxTerm_ = MATRIX_BLOCK_LENGTH;
+  // the previous structure is kept in place to be compared with the new one
   Ap_.resize(nbCol_ + 1);
   Ap_[0] = 0;
-  // Allocation based on the Jacobian maximum size
-  Ai_.resize(currentMaxTerm_);
-  Ax_.resize(currentMaxTerm_);
-
-  iAp_ = 0;
-  iAi_ = 0;
-  iAx_ = 0;
-  nbTerm_ = 0;
+  startStructure(nbRow, nbCol);
 
   withoutNan_ = true;
   withoutInf_ = true;
@@ -116,23 +169,29 @@ SparseMatrix::init(const int nbRow, const int nbCol) {
 
 void
 SparseMatrix::reserve(const int nbCol) {
-  free();
+  clearKeepCapacity();
 
   if (nbCol == 0) return;
-  nbRow_ = 0;
-  nbCol_ = 0;
-  currentMaxTerm_ = MATRIX_BLOCK_LENGTH;
-
   Ap_.resize(nbCol + 1);
   Ap_[0] = 0;
-  // Allocation based on the Jacobian maximum size
-  Ai_.resize(currentMaxTerm_);
-  Ax_.resize(currentMaxTerm_);
+}
+
+void
+SparseMatrix::clearKeepCapacity() {
+  nbRow_ = 0;
+  nbCol_ = 0;
 
   iAp_ = 0;
   iAi_ = 0;
   iAx_ = 0;
   nbTerm_ = 0;
+
+  // the terms arrays keep the size reached by the largest matrix stored so far
+  if (Ai_.size() < static_cast<size_t>(MATRIX_BLOCK_LENGTH)) {
+    Ai_.resize(MATRIX_BLOCK_LENGTH);
+    Ax_.resize(MATRIX_BLOCK_LENGTH);
+  }
+  currentMaxTerm_ = static_cast<int>(Ai_.size());
 }
 
 void
@@ -140,6 +199,13 @@ SparseMatrix::increaseReserve() {
   currentMaxTerm_ += MATRIX_BLOCK_LENGTH;
   Ai_.resize(currentMaxTerm_);
   Ax_.resize(currentMaxTerm_);
+  adviseHugePages();
+}
+
+void
+SparseMatrix::adviseHugePages() const {
+  HugePages::advise(Ai_.data(), Ai_.capacity() * sizeof(unsigned));
+  HugePages::advise(Ax_.data(), Ax_.capacity() * sizeof(double));
 }
 
 void
@@ -155,6 +221,48 @@ SparseMatrix::free() {
   iAx_ = 0;
   nbTerm_ = 0;
   currentMaxTerm_ = 0;
+  // nothing is left to compare the next structure with
+  structureNbRow_ = -1;
+  structureNbCol_ = -1;
+}
+
+void
+SparseMatrix::startStructure(const int nbRow, const int nbCol) {
+  structureChanged_ = false;
+  previousColumnEnd_ = 0;
+  if (nbRow != structureNbRow_ || nbCol != structureNbCol_) {
+    structureNbRow_ = nbRow;
+    structureNbCol_ = nbCol;
+    markStructureChanged();
+  }
+}
+
+void
+SparseMatrix::markStructureChanged() const {
+  if (structureChanged_)
+    return;
+  structureChanged_ = true;
+  structureVersion_ = ++lastStructureVersion;
+}
+
+uint64_t
+SparseMatrix::structureVersion() const {
+  // the end of the last column is only known once the matrix is filled
+  if (!structureChanged_ && nbCol_ > 0 && (iAp_ != nbCol_ || Ap_[iAp_] != previousColumnEnd_))
+    markStructureChanged();
+  return structureVersion_;
+}
+
+uint64_t
+SparseMatrix::structureHash() const {
+  uint64_t hash = STRUCTURE_HASH_INIT;
+  for (int iCol = 1; iCol <= iAp_; ++iCol) {
+    // column boundaries are hashed with a flag bit so that they can not be confused with row indexes
+    hashStructure(hash, (static_cast<uint64_t>(1) << 63) | Ap_[iCol - 1]);
+    for (unsigned ind = Ap_[iCol - 1]; ind < Ap_[iCol]; ++ind)
+      hashStructure(hash, static_cast<uint64_t>(Ai_[ind]));
+  }
+  return hash;
 }
 
 void SparseMatrix::printToFile(bool sparse) const {
@@ -247,6 +355,7 @@ SparseMatrix::erase(const std::unordered_set<int>& rows, const std::unordered_se
   M.iAp_ = 0;
   M.iAi_ = 0;
   M.iAx_ = 0;
+  M.startStructure(M.nbRow_, M.nbCol_);
   auto itC = columns.end();
   auto itL = rows.end();
   for (int iCol = 0; iCol < nbCol_; ++iCol) {
@@ -268,22 +377,75 @@ SparseMatrix::erase(const std::unordered_set<int>& rows, const std::unordered_se
   }
 }
 
-double SparseMatrix::frobeniusNorm() const {
-  double squared_froNorm = 0.;
-  for (int i = 0; i < nbTerm_; ++i) {
-    squared_froNorm += Ax_[i] * Ax_[i];
+SparseMatrix::Extraction::Extraction() :
+nbRow_(0),
+nbCol_(0),
+upToDate_(false),
+sourceStructureVersion_(0),
+structureVersion_(0) { }
+
+void
+SparseMatrix::Extraction::setErased(const std::unordered_set<int>& rows, const std::unordered_set<int>& columns, const int nbRow, const int nbCol) {
+  rowsMap_.assign(nbRow, -1);
+  nbRow_ = 0;
+  for (int i = 0; i < nbRow; ++i) {
+    if (rows.find(i) == rows.end())
+      rowsMap_[i] = nbRow_++;
+  }
+  keptColumns_.assign(nbCol, false);
+  nbCol_ = 0;
+  for (int j = 0; j < nbCol; ++j) {
+    if (columns.find(j) == columns.end()) {
+      keptColumns_[j] = true;
+      ++nbCol_;
+    }
   }
-  return std::sqrt(squared_froNorm);
+  upToDate_ = false;
 }
 
-double SparseMatrix::norm1() const {
-  double norm1 = 0.;
-  double colSum = 0.;
+void
+SparseMatrix::extract(Extraction& extraction, SparseMatrix& M) const {
+  vector<unsigned>& positions = extraction.positions_;
+  if (extraction.upToDate_ && extraction.sourceStructureVersion_ == structureVersion() && extraction.structureVersion_ == M.structureVersion()
+      && static_cast<size_t>(M.nbTerm_) == positions.size()) {
+    for (size_t i = 0; i < positions.size(); ++i)
+      M.Ax_[i] = Ax_[positions[i]];
+    return;
+  }
+
+  assert(extraction.rowsMap_.size() == static_cast<size_t>(nbRow_) && extraction.keptColumns_.size() == static_cast<size_t>(nbCol_));
+  M.reserve(extraction.nbCol_);
+  M.nbRow_ = extraction.nbRow_;
+  M.nbCol_ = extraction.nbCol_;
+  M.startStructure(M.nbRow_, M.nbCol_);
+  positions.clear();
   for (int iCol = 0; iCol < nbCol_; ++iCol) {
-    colSum = 0.;
+    if (!extraction.keptColumns_[iCol])
+      continue;
+    M.changeCol();
     for (unsigned ind = Ap_[iCol]; ind < Ap_[iCol + 1]; ++ind) {
-      colSum += std::fabs(Ax_[ind]);
+      const int rowNum = extraction.rowsMap_[Ai_[ind]];
+      if (rowNum < 0)
+        continue;
+      const int nbTerm = M.nbTerm_;
+      M.addTerm(rowNum, Ax_[ind]);
+      if (M.nbTerm_ > nbTerm)
+        positions.push_back(ind);
     }
+  }
+  extraction.sourceStructureVersion_ = structureVersion();
+  extraction.structureVersion_ = M.structureVersion();
+  extraction.upToDate_ = true;
+}
+
+double SparseMatrix::frobeniusNorm() const {
+  return std::sqrt(VectorKernels::sumSquares(Ax_.data(), nbTerm_));
+}
+
+double SparseMatrix::norm1() const {
+  double norm1 = 0.;
+  for (int iCol = 0; iCol < nbCol_; ++iCol) {
+    const double colSum = VectorKernels::sumAbs(Ax_.data() + Ap_[iCol], Ap_[iCol + 1] - Ap_[iCol]);
     if (colSum > norm1) {
       norm1 = colSum;
     }
@@ -292,20 +454,12 @@ double SparseMatrix::norm1() const {
 }
 
 double SparseMatrix::infinityNorm() const {
-  double infNorm = 0.;
-  double rowSum = 0.;
-  for (int row = 0 ; row < nbRow_ ; ++row) {
-    rowSum = 0.;
-    for (int ind = 0; ind < nbTerm_ ; ++ind) {
-      if (Ai_[ind] == static_cast<unsigned>(row)) {
-        rowSum += std::fabs(Ax_[ind]);
-      }
-    }
-    if (rowSum > infNorm) {
-      infNorm = rowSum;
-    }
+  // sums of each row accumulated in one pass over the terms
+  std::vector<double> rowSums(nbRow_, 0.);
+  for (int ind = 0; ind < nbTerm_; ++ind) {
+    rowSums[Ai_[ind]] += std::fabs(Ax_[ind]);
   }
-  return infNorm;
+  return VectorKernels::maxAbs(rowSums.data(), rowSums.size());
 }
 
 void SparseMatrix::getRowColIndicesFromPosition(const unsigned int position, int& iRow, int& jCol) const {
@@ -319,7 +473,7 @@ SparseMatrix::CheckError
 SparseMatrix::check() const {
   // check all lines are not zeros
   for (unsigned int i = 0; i < static_cast<unsigned int>(nbRow_); i++) {
-    if (std::find(Ai_.begin(), Ai_.end(), i) == Ai_.end()) {
+    if (std::find(Ai_.begin(), Ai_.begin() + nbTerm_, i) == Ai_.begin() + nbTerm_) {
       return CheckError(CHECK_ZERO_ROW, i);
     }
   }
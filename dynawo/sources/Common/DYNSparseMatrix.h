@@ -20,6 +20,8 @@
 #ifndef COMMON_DYNSPARSEMATRIX_H_
 #define COMMON_DYNSPARSEMATRIX_H_
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <boost/shared_ptr.hpp>
 #include <unordered_set>
@@ -67,6 +69,41 @@ class SparseMatrix {
     unsigned int info;      ///<  relevant if not CHECK_OK: line / column index
   };
 
+  /**
+   * @brief rows and columns erased from a matrix, and positions of the terms kept from the last structure extracted
+   *
+   * As long as the structure of the matrix does not change, the submatrix is extracted again by a gather of the kept terms.
+   */
+  class Extraction {
+   public:
+    /**
+     * @brief default constructor
+     */
+    Extraction();
+
+    /**
+     * @brief set the rows and columns to erase
+     *
+     * @param rows rows to erase
+     * @param columns columns to erase
+     * @param nbRow number of rows of the matrix to extract from
+     * @param nbCol number of columns of the matrix to extract from
+     */
+    void setErased(const std::unordered_set<int>& rows, const std::unordered_set<int>& columns, int nbRow, int nbCol);
+
+   private:
+    friend class SparseMatrix;
+
+    std::vector<int> rowsMap_;  ///< row in the extracted matrix of each row, -1 if the row is erased
+    std::vector<bool> keptColumns_;  ///< whether each column is kept
+    int nbRow_;  ///< number of rows of the extracted matrix
+    int nbCol_;  ///< number of columns of the extracted matrix
+    std::vector<unsigned> positions_;  ///< position in the matrix of each term of the extracted matrix
+    bool upToDate_;  ///< whether the positions match the structures recorded
+    uint64_t sourceStructureVersion_;  ///< structure version of the matrix when the positions were computed
+    uint64_t structureVersion_;  ///< structure version of the extracted matrix when the positions were computed
+  };
+
 
  public:
   /**
@@ -94,6 +131,14 @@ class SparseMatrix {
    */
   void reserve(const int nbCol);
 
+  /**
+   * @brief remove all the terms of the matrix without releasing its memory
+   *
+   * The arrays of the terms keep the size reached by the largest matrix stored so far, so that filling again
+   * a matrix of the same size does not allocate memory.
+   */
+  void clearKeepCapacity();
+
   /**
    * @brief change the column currently used when filling the matrix
    *
@@ -108,6 +153,16 @@ class SparseMatrix {
    */
   void addTerm(const int row, const double val);
 
+  /**
+   * @brief append the columns filled in another matrix after the current column
+   *
+   * The result is the same as if the terms of the columns of the block had been added with changeCol and addTerm
+   * on this matrix. It allows to fill several column blocks independently before gathering them.
+   *
+   * @param block matrix whose filled columns are appended
+   */
+  void appendColumns(const SparseMatrix& block);
+
   /**
    * @brief print the Frobenius norm of the matrix
    *
@@ -153,6 +208,17 @@ class SparseMatrix {
    */
   void erase(const std::unordered_set<int>& rows, const std::unordered_set<int>& columns, SparseMatrix& M) const;
 
+  /**
+   * @brief extract the submatrix without the rows and columns erased by an extraction
+   *
+   * The positions of the kept terms are only computed again if the structure of the matrix or of the extracted matrix changed,
+   * the values being gathered otherwise.
+   *
+   * @param extraction rows and columns to erase, updated with the positions of the kept terms
+   * @param M extracted matrix
+   */
+  void extract(Extraction& extraction, SparseMatrix& M) const;
+
   /**
    * @brief Get the row and colum indices from a position in the data array
    *
@@ -191,6 +257,14 @@ class SparseMatrix {
     return (nbCol_ == 0 ? 0 : Ap_[nbCol_]);
   }
 
+  /**
+   * @brief getter of the number of rows of the matrix
+   * @return number of rows of the matrix
+   */
+  inline int nbRow() const {
+    return nbRow_;
+  }
+
   /**
    * @brief getter of the number of columns of the matrix
    * @return number of columns of the matrix
@@ -199,6 +273,34 @@ class SparseMatrix {
     return nbCol_;
   }
 
+  /**
+   * @brief getter of the version of the matrix structure
+   *
+   * The structure filled is compared on the fly with the one of the previous filling, still in place: the version only changes
+   * when a row index, a column boundary or the size differs. Versions are unique among all the matrices, so that a solver can
+   * check that the structure did not change since the last copy, and that only values have to be updated, by comparing a
+   * single number.
+   * @return version of the matrix structure, once the matrix is filled
+   */
+  uint64_t structureVersion() const;
+
+  /**
+   * @brief compute the hash of the matrix structure
+   *
+   * Two matrices filled with the same non-null terms positions have the same structure hash. The structure is read
+   * entirely: the hash is meant to be computed when the structure version changed.
+   * @return hash of the matrix structure
+   */
+  uint64_t structureHash() const;
+
+  /**
+   * @brief getter of the memory allocated for the structure and the values of the matrix
+   * @return number of bytes allocated, the capacity of the arrays included
+   */
+  inline std::size_t getMemoryUsage() const {
+    return Ap_.capacity() * sizeof(unsigned) + Ai_.capacity() * sizeof(unsigned) + Ax_.capacity() * sizeof(double);
+  }
+
   /**
    * @brief Check matrix validity
    *
@@ -224,6 +326,32 @@ class SparseMatrix {
    */
   void increaseReserve();
 
+  /**
+   * @brief ask for huge pages to back the terms arrays, once they grew
+   */
+  void adviseHugePages() const;
+
+  /**
+   * @brief start filling a structure, compared on the fly with the current one
+   *
+   * @param nbRow number of rows of the structure filled
+   * @param nbCol number of columns of the structure filled
+   */
+  void startStructure(int nbRow, int nbCol);
+
+  /**
+   * @brief close the column filled so far, checking its end against the one of the previous structure
+   */
+  inline void closeColumn() {
+    if (Ap_[iAp_] != previousColumnEnd_)
+      markStructureChanged();
+  }
+
+  /**
+   * @brief give a new version to the structure filled, once per filling
+   */
+  void markStructureChanged() const;
+
   /**
    * @brief equality operator
    *
@@ -259,6 +387,11 @@ class SparseMatrix {
   int iAx_;  ///< current index in the Ax_ array
   int nbTerm_;  ///< current number of values stored in the matrix
   int currentMaxTerm_;  ///< current maximum number of term that could be stored in the matrix without increasing the size of arrays
+  int structureNbRow_;  ///< number of rows of the structure compared with
+  int structureNbCol_;  ///< number of columns of the structure compared with
+  unsigned previousColumnEnd_;  ///< end of the column being filled in the previous structure
+  mutable bool structureChanged_;  ///< whether the structure filled differs from the previous one
+  mutable uint64_t structureVersion_;  ///< version of the structure
 };
 
 }  // end of namespace DYN
@@ -0,0 +1,68 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNStateBuffer.cpp
+ *
+ * @brief In-memory raw binary buffer used to snapshot and restore the state of a simulation
+ *
+ */
+#include <cstring>
+
+#include "DYNStateBuffer.h"
+#include "DYNMacrosMessage.h"
+
+namespace DYN {
+
+void
+StateBuffer::write(const std::string& value) {
+  write(value.data(), value.size());
+}
+
+void
+StateBuffer::writeBytes(const void* source, const std::size_t nbBytes) {
+  const std::size_t position = data_.size();
+  data_.resize(position + nbBytes);
+  std::memcpy(&data_[position], source, nbBytes);
+}
+
+StateBuffer::Reader::Reader(const StateBuffer& buffer) :
+buffer_(buffer),
+position_(0) {
+}
+
+void
+StateBuffer::Reader::read(std::string& value) {
+  std::size_t size = 0;
+  read(size);
+  if (size > buffer_.data_.size() - position_)
+    throw DYNError(Error::GENERAL, StateSnapshotTruncated);
+  value.assign(&buffer_.data_[position_], size);
+  position_ += size;
+}
+
+void
+StateBuffer::Reader::checkSize(const std::size_t expectedSize, const std::size_t storedSize) {
+  if (expectedSize != storedSize)
+    throw DYNError(Error::GENERAL, StateSnapshotMismatch, expectedSize, storedSize);
+}
+
+void
+StateBuffer::Reader::readBytes(void* destination, const std::size_t nbBytes) {
+  if (nbBytes > buffer_.data_.size() - position_)
+    throw DYNError(Error::GENERAL, StateSnapshotTruncated);
+  std::memcpy(destination, &buffer_.data_[position_], nbBytes);
+  position_ += nbBytes;
+}
+
+}  // end namespace DYN
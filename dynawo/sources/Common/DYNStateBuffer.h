@@ -0,0 +1,211 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNStateBuffer.h
+ *
+ * @brief In-memory raw binary buffer used to snapshot and restore the state of a simulation
+ *
+ */
+#ifndef COMMON_DYNSTATEBUFFER_H_
+#define COMMON_DYNSTATEBUFFER_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace DYN {
+
+/**
+ * @class StateBuffer
+ * @brief raw binary buffer holding a snapshot of the state of a simulation
+ *
+ * Values are copied byte by byte, without any conversion: a buffer can only be restored in the process that wrote it,
+ * on the same simulation. Arrays are written with their size, which is checked when they are read back.
+ */
+class StateBuffer {
+ public:
+  /**
+   * @class Reader
+   * @brief sequential reader of a state buffer
+   *
+   * Several readers can read the same buffer, so that a snapshot can be restored as many times as needed.
+   */
+  class Reader {
+   public:
+    /**
+     * @brief constructor
+     *
+     * @param buffer buffer to read, must outlive the reader
+     */
+    explicit Reader(const StateBuffer& buffer);
+
+    /**
+     * @brief read a value
+     *
+     * @param value value read
+     *
+     * @throw StateSnapshotTruncated error if the end of the buffer is reached
+     */
+    template<typename T> void read(T& value);
+
+    /**
+     * @brief read an array written by StateBuffer::write(const T*, std::size_t)
+     *
+     * @param values where to copy the values read
+     * @param size expected number of values
+     *
+     * @throw StateSnapshotMismatch error if the number of values stored is not @p size
+     */
+    template<typename T> void read(T* values, std::size_t size);
+
+    /**
+     * @brief read an array in a vector whose size is the expected number of values
+     *
+     * @param values where to copy the values read
+     */
+    template<typename T> void read(std::vector<T>& values) {
+      read(values.data(), values.size());
+    }
+
+    /**
+     * @brief read a string
+     *
+     * @param value string read
+     */
+    void read(std::string& value);
+
+    /**
+     * @brief indicate whether the whole buffer was read
+     *
+     * @return @b true if there is nothing left to read
+     */
+    bool atEnd() const {
+      return position_ == buffer_.data_.size();
+    }
+
+   private:
+    /**
+     * @brief check the number of values of an array read
+     *
+     * @param expectedSize number of values expected
+     * @param storedSize number of values stored in the buffer
+     *
+     * @throw StateSnapshotMismatch error if the sizes differ
+     */
+    static void checkSize(std::size_t expectedSize, std::size_t storedSize);
+
+    /**
+     * @brief copy bytes from the buffer and move forward
+     *
+     * @param destination where to copy the bytes
+     * @param nbBytes number of bytes to copy
+     */
+    void readBytes(void* destination, std::size_t nbBytes);
+
+    const StateBuffer& buffer_;  ///< buffer read
+    std::size_t position_;  ///< offset of the next byte to read
+  };
+
+  /**
+   * @brief remove all the values of the buffer, the memory being kept for the next snapshot
+   */
+  void clear() {
+    data_.clear();
+  }
+
+  /**
+   * @brief indicate whether the buffer holds a snapshot
+   *
+   * @return @b true if nothing was written
+   */
+  bool empty() const {
+    return data_.empty();
+  }
+
+  /**
+   * @brief get the size of the snapshot
+   *
+   * @return the number of bytes written
+   */
+  std::size_t size() const {
+    return data_.size();
+  }
+
+  /**
+   * @brief get the bytes of the snapshot, to hand it over to a process forked from the simulation that wrote it
+   *
+   * @return the first byte written
+   */
+  const char* data() const {
+    return data_.data();
+  }
+
+  /**
+   * @brief replace the snapshot by bytes got with data() in a process forked from the same simulation
+   *
+   * @param bytes first byte of the snapshot
+   * @param nbBytes number of bytes of the snapshot
+   */
+  void assign(const char* bytes, const std::size_t nbBytes) {
+    data_.assign(bytes, bytes + nbBytes);
+  }
+
+  /**
+   * @brief write a value
+   *
+   * @param value value to write, of a trivially copyable type
+   */
+  template<typename T> void write(const T& value);
+
+  /**
+   * @brief write an array preceded by its size
+   *
+   * @param values values to write, of a trivially copyable type
+   * @param size number of values
+   */
+  template<typename T> void write(const T* values, std::size_t size);
+
+  /**
+   * @brief write the values of a vector preceded by their number
+   *
+   * @param values values to write
+   */
+  template<typename T> void write(const std::vector<T>& values) {
+    write(values.data(), values.size());
+  }
+
+  /**
+   * @brief write a string
+   *
+   * @param value string to write
+   */
+  void write(const std::string& value);
+
+ private:
+  /**
+   * @brief append bytes to the buffer
+   *
+   * @param source bytes to append
+   * @param nbBytes number of bytes to append
+   */
+  void writeBytes(const void* source, std::size_t nbBytes);
+
+  std::vector<char> data_;  ///< bytes written
+};
+
+}  // end namespace DYN
+
+#include "DYNStateBuffer.hpp"
+
+#endif  // COMMON_DYNSTATEBUFFER_H_
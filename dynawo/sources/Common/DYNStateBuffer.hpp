@@ -0,0 +1,65 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNStateBuffer.hpp
+ *
+ * @brief State buffer header to implement the template read and write methods
+ *
+ */
+#ifndef COMMON_DYNSTATEBUFFER_HPP_
+#define COMMON_DYNSTATEBUFFER_HPP_
+
+#include <type_traits>
+
+#include "DYNStateBuffer.h"
+
+namespace DYN {
+
+template<typename T>
+void
+StateBuffer::write(const T& value) {
+  static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable values can be written in a state buffer");
+  writeBytes(&value, sizeof(T));
+}
+
+template<typename T>
+void
+StateBuffer::write(const T* values, const std::size_t size) {
+  static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable values can be written in a state buffer");
+  write(size);
+  if (size > 0)
+    writeBytes(values, size * sizeof(T));
+}
+
+template<typename T>
+void
+StateBuffer::Reader::read(T& value) {
+  static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable values can be read from a state buffer");
+  readBytes(&value, sizeof(T));
+}
+
+template<typename T>
+void
+StateBuffer::Reader::read(T* values, const std::size_t size) {
+  static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable values can be read from a state buffer");
+  std::size_t storedSize = 0;
+  read(storedSize);
+  checkSize(size, storedSize);
+  if (size > 0)
+    readBytes(values, size * sizeof(T));
+}
+
+}  // end namespace DYN
+
+#endif  // COMMON_DYNSTATEBUFFER_HPP_
@@ -0,0 +1,121 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNStateDumpDelta.cpp
+ *
+ * @brief Differences between two versions of an entry of a dump state file
+ *
+ */
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "DYNStateDumpDelta.h"
+#include "DYNMacrosMessage.h"
+
+namespace DYN {
+
+namespace {
+
+const char fullEntry = 'F';  ///< first byte of a delta holding the whole entry
+const char changedBlocks = 'D';  ///< first byte of a delta holding the changed blocks only
+
+/**
+ * @brief append a 64 bits integer to a delta
+ *
+ * @param value value to append
+ * @param delta delta to complete
+ */
+void
+appendSize(const std::uint64_t value, std::string& delta) {
+  delta.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+}  // namespace
+
+const std::size_t StateDumpDelta::blockSize;
+
+bool
+StateDumpDelta::encode(const std::string& previous, const std::string& current, std::string& delta) {
+  delta.clear();
+  if (previous.size() != current.size()) {
+    delta.reserve(current.size() + 1);
+    delta += fullEntry;
+    delta += current;
+    return true;
+  }
+
+  delta += changedBlocks;
+  const std::size_t size = current.size();
+  std::size_t offset = 0;
+  while (offset < size) {
+    std::size_t length = std::min(blockSize, size - offset);
+    if (std::memcmp(&previous[offset], &current[offset], length) == 0) {
+      offset += length;
+      continue;
+    }
+    // the consecutive changed blocks are gathered in a single run
+    std::size_t end = offset + length;
+    while (end < size) {
+      length = std::min(blockSize, size - end);
+      if (std::memcmp(&previous[end], &current[end], length) == 0)
+        break;
+      end += length;
+    }
+    appendSize(offset, delta);
+    appendSize(end - offset, delta);
+    delta.append(current, offset, end - offset);
+    offset = end;
+  }
+
+  if (delta.size() == 1) {
+    delta.clear();
+    return false;
+  }
+  if (delta.size() > size + 1) {
+    delta.assign(1, fullEntry);
+    delta += current;
+  }
+  return true;
+}
+
+void
+StateDumpDelta::apply(const std::string& name, const std::string& delta, std::string& value) {
+  if (delta.empty())
+    throw DYNError(Error::GENERAL, StateDumpDeltaMismatch, name);
+  if (delta[0] == fullEntry) {
+    value.assign(delta, 1, std::string::npos);
+    return;
+  }
+  if (delta[0] != changedBlocks)
+    throw DYNError(Error::GENERAL, StateDumpDeltaMismatch, name);
+
+  std::size_t position = 1;
+  while (position < delta.size()) {
+    std::uint64_t offset = 0;
+    std::uint64_t length = 0;
+    if (delta.size() - position < sizeof(offset) + sizeof(length))
+      throw DYNError(Error::GENERAL, StateDumpDeltaMismatch, name);
+    std::memcpy(&offset, &delta[position], sizeof(offset));
+    position += sizeof(offset);
+    std::memcpy(&length, &delta[position], sizeof(length));
+    position += sizeof(length);
+    if (length > delta.size() - position || offset > value.size() || length > value.size() - offset)
+      throw DYNError(Error::GENERAL, StateDumpDeltaMismatch, name);
+    value.replace(static_cast<std::size_t>(offset), static_cast<std::size_t>(length), delta, position, static_cast<std::size_t>(length));
+    position += static_cast<std::size_t>(length);
+  }
+}
+
+}  // end namespace DYN
@@ -0,0 +1,65 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNStateDumpDelta.h
+ *
+ * @brief Differences between two versions of an entry of a dump state file
+ *
+ */
+#ifndef COMMON_DYNSTATEDUMPDELTA_H_
+#define COMMON_DYNSTATEDUMPDELTA_H_
+
+#include <cstddef>
+#include <string>
+
+namespace DYN {
+
+/**
+ * @class StateDumpDelta
+ * @brief encoding of an entry of a dump state file as the blocks changed since the previous dump
+ *
+ * An entry whose size changed is stored as a whole. Otherwise the entry is compared block by block with its previous
+ * version and only the runs of changed blocks are stored, with their offset and their size. As the variables of a model
+ * are always serialized at the same place, only the blocks holding the variables that moved are kept.
+ */
+class StateDumpDelta {
+ public:
+  static const std::size_t blockSize = 64;  ///< number of bytes compared at once
+
+  /**
+   * @brief build the delta between two versions of an entry
+   *
+   * @param previous content of the entry in the previous dump
+   * @param current current content of the entry
+   * @param delta delta to apply on @p previous to get @p current
+   *
+   * @return @b false if the entry did not change, in which case @p delta is left empty
+   */
+  static bool encode(const std::string& previous, const std::string& current, std::string& delta);
+
+  /**
+   * @brief apply a delta built by encode on the previous version of an entry
+   *
+   * @param name name of the entry, for the error message
+   * @param delta delta to apply
+   * @param value previous content of the entry, replaced by its current content
+   *
+   * @throw StateDumpDeltaMismatch error if the delta does not fit the previous content
+   */
+  static void apply(const std::string& name, const std::string& delta, std::string& value);
+};
+
+}  // end namespace DYN
+
+#endif  // COMMON_DYNSTATEDUMPDELTA_H_
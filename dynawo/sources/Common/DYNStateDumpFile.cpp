@@ -0,0 +1,144 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNStateDumpFile.cpp
+ *
+ * @brief Uncompressed dump state file, written entry by entry
+ *
+ */
+#include <cstring>
+
+#include "DYNStateDumpFile.h"
+#include "DYNMacrosMessage.h"
+
+namespace DYN {
+
+namespace {
+
+const char magic[8] = {'D', 'Y', 'N', 'S', 'T', 'A', 'T', 'E'};  ///< first bytes of the file
+const std::size_t alignment = 8;  ///< alignment of the entries from the beginning of the file
+
+/**
+ * @brief read a 64 bits size
+ *
+ * @param stream stream to read
+ * @param fileName path of the file read, for the error message
+ *
+ * @return the size read
+ */
+std::uint64_t
+readSize(std::ifstream& stream, const std::string& fileName) {
+  std::uint64_t size = 0;
+  if (!stream.read(reinterpret_cast<char*>(&size), sizeof(size)))
+    throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName);
+  return size;
+}
+
+/**
+ * @brief read bytes followed by the padding up to the next alignment boundary
+ *
+ * @param stream stream to read
+ * @param size number of bytes to read
+ * @param fileName path of the file read, for the error message
+ * @param value bytes read
+ */
+void
+readPadded(std::ifstream& stream, const std::uint64_t size, const std::string& fileName, std::string& value) {
+  value.resize(static_cast<std::size_t>(size));
+  if (size > 0 && !stream.read(&value[0], static_cast<std::streamsize>(size)))
+    throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName);
+  const std::streamoff position = stream.tellg();
+  stream.seekg((alignment - static_cast<std::size_t>(position) % alignment) % alignment, std::ios::cur);
+}
+
+}  // namespace
+
+const std::uint32_t StateDumpFile::version;
+
+StateDumpFile::Writer::Writer(const std::string& fileName) :
+fileName_(fileName),
+stream_(fileName.c_str(), std::ios::binary | std::ios::trunc) {
+  if (!stream_.is_open())
+    throw DYNError(Error::GENERAL, OpenFileFailed, fileName);
+  const std::uint32_t fileVersion = version;
+  const std::uint32_t reserved = 0;
+  stream_.write(magic, sizeof(magic));
+  stream_.write(reinterpret_cast<const char*>(&fileVersion), sizeof(fileVersion));
+  stream_.write(reinterpret_cast<const char*>(&reserved), sizeof(reserved));
+}
+
+void
+StateDumpFile::Writer::addEntry(const std::string& name, const std::string& data) {
+  const std::uint64_t nameSize = name.size();
+  stream_.write(reinterpret_cast<const char*>(&nameSize), sizeof(nameSize));
+  stream_.write(name.data(), static_cast<std::streamsize>(name.size()));
+  pad();
+  const std::uint64_t dataSize = data.size();
+  stream_.write(reinterpret_cast<const char*>(&dataSize), sizeof(dataSize));
+  stream_.write(data.data(), static_cast<std::streamsize>(data.size()));
+  pad();
+}
+
+void
+StateDumpFile::Writer::addEntries(const std::map<std::string, std::string>& entries) {
+  for (const auto& entry : entries)
+    addEntry(entry.first, entry.second);
+}
+
+void
+StateDumpFile::Writer::close() {
+  stream_.close();
+  if (stream_.fail())
+    throw DYNError(Error::GENERAL, FileGenerationFailed, fileName_);
+}
+
+void
+StateDumpFile::Writer::pad() {
+  static const char zeros[alignment] = {};
+  const std::size_t position = static_cast<std::size_t>(stream_.tellp());
+  stream_.write(zeros, static_cast<std::streamsize>((alignment - position % alignment) % alignment));
+}
+
+bool
+StateDumpFile::isStateDumpFile(const std::string& fileName) {
+  std::ifstream stream(fileName.c_str(), std::ios::binary);
+  char header[sizeof(magic)];
+  return stream.read(header, sizeof(header)) && std::memcmp(header, magic, sizeof(magic)) == 0;
+}
+
+void
+StateDumpFile::read(const std::string& fileName, std::map<std::string, std::string>& entries) {
+  std::ifstream stream(fileName.c_str(), std::ios::binary);
+  if (!stream.is_open())
+    throw DYNError(Error::GENERAL, OpenFileFailed, fileName);
+
+  char header[sizeof(magic)];
+  std::uint32_t fileVersion = 0;
+  std::uint32_t reserved = 0;
+  if (!stream.read(header, sizeof(header)) || std::memcmp(header, magic, sizeof(magic)) != 0
+      || !stream.read(reinterpret_cast<char*>(&fileVersion), sizeof(fileVersion))
+      || !stream.read(reinterpret_cast<char*>(&reserved), sizeof(reserved)))
+    throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName);
+  if (fileVersion > version)
+    throw DYNError(Error::GENERAL, StateDumpVersionUnsupported, fileName, fileVersion, version);
+
+  while (stream.peek() != std::ifstream::traits_type::eof()) {
+    std::string name;
+    readPadded(stream, readSize(stream, fileName), fileName, name);
+    std::string& data = entries[name];
+    readPadded(stream, readSize(stream, fileName), fileName, data);
+  }
+}
+
+}  // end namespace DYN
@@ -0,0 +1,113 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNStateDumpFile.h
+ *
+ * @brief Uncompressed dump state file, written entry by entry
+ *
+ */
+#ifndef COMMON_DYNSTATEDUMPFILE_H_
+#define COMMON_DYNSTATEDUMPFILE_H_
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+
+namespace DYN {
+
+/**
+ * @class StateDumpFile
+ * @brief uncompressed alternative to the zip archive of the dump state files
+ *
+ * The file starts with a header made of a magic string and of a version number, followed by the entries. Each entry is made
+ * of the size of its name, its name, the size of its data and its data, the sizes being 64 bits integers and the data being
+ * aligned on 8 bytes from the beginning of the file, so that a mapped file can be read in place.
+ * The entries are written one after the other, without keeping the whole state in memory.
+ */
+class StateDumpFile {
+ public:
+  static const std::uint32_t version = 1;  ///< version of the format written
+
+  /**
+   * @class Writer
+   * @brief writer of a dump state file
+   */
+  class Writer {
+   public:
+    /**
+     * @brief constructor, that creates the file and writes its header
+     *
+     * @param fileName path of the file to create
+     *
+     * @throw OpenFileFailed error if the file cannot be created
+     */
+    explicit Writer(const std::string& fileName);
+
+    /**
+     * @brief append an entry to the file
+     *
+     * @param name name of the entry
+     * @param data content of the entry
+     */
+    void addEntry(const std::string& name, const std::string& data);
+
+    /**
+     * @brief append entries to the file
+     *
+     * @param entries map associating the name of each entry with its content
+     */
+    void addEntries(const std::map<std::string, std::string>& entries);
+
+    /**
+     * @brief flush and close the file
+     *
+     * @throw FileGenerationFailed error if the file could not be written
+     */
+    void close();
+
+   private:
+    /**
+     * @brief write zeros up to the next 8 bytes boundary
+     */
+    void pad();
+
+    std::string fileName_;  ///< path of the file written
+    std::ofstream stream_;  ///< stream of the file
+  };
+
+  /**
+   * @brief indicate whether a file is an uncompressed dump state file
+   *
+   * @param fileName path of the file
+   *
+   * @return @b true if the file starts with the header of the format, @b false for a zip archive for instance
+   */
+  static bool isStateDumpFile(const std::string& fileName);
+
+  /**
+   * @brief read all the entries of a dump state file
+   *
+   * @param fileName path of the file
+   * @param entries map associating the name of each entry with its content, to fill
+   *
+   * @throw StateDumpVersionUnsupported error if the file was written by a more recent format,
+   * StateDumpCorrupted error if the file is truncated
+   */
+  static void read(const std::string& fileName, std::map<std::string, std::string>& entries);
+};
+
+}  // end namespace DYN
+
+#endif  // COMMON_DYNSTATEDUMPFILE_H_
@@ -0,0 +1,124 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNThreadPool.cpp
+ *
+ * @brief Fixed-size pool of worker threads implementation
+ *
+ */
+#include "DYNThreadPool.h"
+
+namespace DYN {
+
+ThreadPool::ThreadPool(const unsigned nbThreads) :
+task_(nullptr),
+nbTasks_(0),
+nextTask_(0),
+nbTasksDone_(0),
+nbActiveWorkers_(0),
+generation_(0),
+stop_(false) {
+  for (unsigned i = 1; i < nbThreads; ++i)
+    workers_.emplace_back(&ThreadPool::workerLoop, this);
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  startCondition_.notify_all();
+  for (auto& worker : workers_)
+    worker.join();
+}
+
+void
+ThreadPool::parallelFor(const unsigned nbTasks, const std::function<void(unsigned)>& task) {
+  if (nbTasks == 0)
+    return;
+  if (workers_.empty() || nbTasks == 1) {
+    for (unsigned i = 0; i < nbTasks; ++i)
+      task(i);
+    return;
+  }
+
+  exceptions_.assign(nbTasks, std::exception_ptr());
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    task_ = &task;
+    nbTasks_ = nbTasks;
+    nextTask_ = 0;
+    nbTasksDone_ = 0;
+    ++generation_;
+  }
+  startCondition_.notify_all();
+
+  runTasks();
+
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    doneCondition_.wait(lock, [this]() { return nbTasksDone_ == nbTasks_ && nbActiveWorkers_ == 0; });
+    task_ = nullptr;
+  }
+
+  for (const auto& exception : exceptions_) {
+    if (exception)
+      std::rethrow_exception(exception);
+  }
+}
+
+void
+ThreadPool::runTasks() {
+  while (true) {
+    const unsigned i = nextTask_.fetch_add(1);
+    if (i >= nbTasks_)
+      return;
+    try {
+      (*task_)(i);
+    } catch (...) {
+      exceptions_[i] = std::current_exception();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++nbTasksDone_;
+    if (nbTasksDone_ == nbTasks_)
+      doneCondition_.notify_all();
+  }
+}
+
+void
+ThreadPool::workerLoop() {
+  unsigned long seenGeneration = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      startCondition_.wait(lock, [this, &seenGeneration]() { return stop_ || generation_ != seenGeneration; });
+      if (stop_)
+        return;
+      seenGeneration = generation_;
+      // the batch may already be over if this worker woke up late
+      if (task_ == nullptr)
+        continue;
+      ++nbActiveWorkers_;
+    }
+
+    runTasks();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    --nbActiveWorkers_;
+    if (nbActiveWorkers_ == 0)
+      doneCondition_.notify_all();
+  }
+}
+
+}  // namespace DYN
@@ -0,0 +1,105 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNThreadPool.h
+ *
+ * @brief Fixed-size pool of worker threads used to run independent tasks concurrently
+ *
+ */
+#ifndef COMMON_DYNTHREADPOOL_H_
+#define COMMON_DYNTHREADPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+namespace DYN {
+
+/**
+ * @class ThreadPool
+ * @brief Fixed-size pool of worker threads
+ *
+ * The calling thread takes part in the execution of the tasks so a pool built for n threads
+ * only creates n-1 workers. Workers are created once and wait between two calls to parallelFor,
+ * which avoids paying a thread creation at each evaluation.
+ */
+class ThreadPool : private boost::noncopyable {
+ public:
+  /**
+   * @brief constructor
+   *
+   * @param nbThreads total number of threads running the tasks, calling thread included
+   */
+  explicit ThreadPool(unsigned nbThreads);
+
+  /**
+   * @brief destructor: stops and joins the workers
+   */
+  ~ThreadPool();
+
+  /**
+   * @brief get the total number of threads running the tasks, calling thread included
+   *
+   * @return number of threads
+   */
+  unsigned nbThreads() const {
+    return static_cast<unsigned>(workers_.size()) + 1;
+  }
+
+  /**
+   * @brief run task(0) ... task(nbTasks - 1) concurrently and wait for all of them to complete
+   *
+   * If several tasks throw, the exception thrown by the task with the lowest index is rethrown
+   * once all tasks are over, so that the reported error does not depend on the scheduling.
+   *
+   * @param nbTasks number of tasks to run
+   * @param task function called with the index of the task to run
+   */
+  void parallelFor(unsigned nbTasks, const std::function<void(unsigned)>& task);
+
+ private:
+  /**
+   * @brief main loop of a worker thread
+   */
+  void workerLoop();
+
+  /**
+   * @brief take tasks of the current batch until there is none left
+   */
+  void runTasks();
+
+ private:
+  std::vector<std::thread> workers_;  ///< worker threads
+  std::mutex mutex_;  ///< mutex protecting the batch description
+  std::condition_variable startCondition_;  ///< condition notified when a new batch is available or when the pool stops
+  std::condition_variable doneCondition_;  ///< condition notified when the last task of a batch is over
+  const std::function<void(unsigned)>* task_;  ///< function of the current batch, nullptr if none
+  unsigned nbTasks_;  ///< number of tasks of the current batch
+  std::atomic<unsigned> nextTask_;  ///< index of the next task to run in the current batch
+  unsigned nbTasksDone_;  ///< number of tasks of the current batch already over
+  unsigned nbActiveWorkers_;  ///< number of workers currently working on the batch
+  unsigned long generation_;  ///< index of the current batch
+  bool stop_;  ///< @b true if the workers must exit
+  std::vector<std::exception_ptr> exceptions_;  ///< exception thrown by each task of the current batch
+};
+
+}  // namespace DYN
+
+#endif  // COMMON_DYNTHREADPOOL_H_
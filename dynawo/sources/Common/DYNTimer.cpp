@@ -21,6 +21,7 @@
 
 #include "DYNTimer.h"
 
+#include <mutex>
 #include <thread>
 #include <sstream>
 
@@ -28,6 +29,9 @@ namespace DYN {
 
 Timers::~Timers() {
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
+  // the timers are stored by thread: the worker threads of the parallel evaluations report theirs when they end, concurrently
+  static std::mutex reportMutex;
+  std::lock_guard<std::mutex> lock(reportMutex);
   for (const auto& timer : timers_)
     std::cout << "TIMER[" << timer.first << "] = " << timer.second << " seconds in " << nbAppels_[timer.first] << " calls" << std::endl;
 #endif
@@ -20,6 +20,7 @@
  * <A HREF="http://boost-log.sourceforge.net/libs/log/doc/html/index.html"> documentation</A>
  *
  */
+#include <atomic>
 #include <fstream>
 #include <ostream>
 #include <iomanip>
@@ -88,6 +89,21 @@ BOOST_LOG_ATTRIBUTE_KEYWORD(tag_attr, "Tag", std::string)
 BOOST_LOG_ATTRIBUTE_KEYWORD(thread_attr, "Thread", logging::attributes::current_thread_id::value_type)
 #pragma GCC diagnostic error "-Wmissing-field-initializers"
 
+/**
+ * @brief generation of the sinks configuration, incremented under the mutex of the traces once sinks have been added or removed
+ *
+ * A thread reading the new generation is then sure to find the new sinks: its cached results are not kept for the old sinks.
+ */
+static std::atomic<unsigned> sinksGeneration(1);
+
+/**
+ * @brief results of logExists for a thread, valid for a generation of the sinks configuration
+ */
+struct LogExistsCache {
+  unsigned generation = 0;  ///< generation of the sinks configuration the results are valid for
+  std::unordered_map<Trace::TagAndSeverityLevel, bool, Trace::TagAndSeverityLevelHash> results;  ///< whether a log is exported, by tag and severity level
+};
+
 TraceStream& Trace::endline(TraceStream& os) {
   return eol(os);
 }
@@ -156,6 +172,53 @@ void Trace::clearAndAddAppenders_(const std::vector<TraceAppender>& appenders) {
   logging::add_common_attributes();
 }
 
+/**
+ * @brief build the formatter of the logs of an appender
+ *
+ * @param appender appender containing the data to configure the sink
+ * @return formatter of the logs
+ */
+static logging::formatter
+buildFormatter(const Trace::TraceAppender& appender) {
+  // build format for each appenders depending on its attributes
+  const string& separator = appender.getSeparator();
+  const bool showTag = appender.getShowLevelTag();
+  const bool showTimeStamp = appender.getShowTimeStamp();
+  const string& dateFormat = appender.getTimeStampFormat();
+
+  logging::formatter fmt;
+
+  if (showTimeStamp && showTag) {
+    fmt = expr::stream << expr::format_date_time< boost::posix_time::ptime >("TimeStamp", dateFormat) << separator << severity << separator << expr::message;
+  } else if (showTimeStamp) {  // && ! showTag
+    fmt = expr::stream << expr::format_date_time< boost::posix_time::ptime >("TimeStamp", dateFormat) << separator << expr::message;
+  } else if (showTag) {  // && ! showTimeStamp
+    fmt = expr::stream << severity << separator << expr::message;
+  } else {  // ! showTimeStamp && ! showTag
+    fmt = expr::stream << expr::message;
+  }
+  return fmt;
+}
+
+/**
+ * @brief set the filter of an appender on a sink
+ *
+ * @param appender appender containing the data to configure the sink
+ * @param currentId thread whose logs are written by the sink
+ * @param sink sink to configure
+ */
+template<typename SinkType>
+static void
+setFilter(const Trace::TraceAppender& appender, const logging::attributes::current_thread_id::value_type& currentId, SinkType& sink) {
+  const string& appenderTag = appender.getTag();
+  const SeverityLevel severityLevel = appender.getLvlFilter();
+  if (appenderTag.empty()) {
+    sink.set_filter(severity >= severityLevel && !expr::has_attr(tag_attr) && thread_attr == currentId);
+  } else {
+    sink.set_filter(severity >= severityLevel && tag_attr == appenderTag && thread_attr == currentId);
+  }
+}
+
 void Trace::configureSink(const std::vector<TraceAppender>& appenders, bool eraseSinks) {
   logging::attributes::current_thread_id::value_type currentId =
     logging::attributes::current_thread_id().get_value().extract<logging::attributes::current_thread_id::value_type>().get();
@@ -167,37 +230,25 @@ void Trace::configureSink(const std::vector<TraceAppender>& appenders, bool eras
 
   // Add appender
   for (const auto& appender : appenders) {
-    boost::shared_ptr<FileSink> sink(new FileSink(
-      keywords::file_name = appender.getFilePath(),
-      keywords::open_mode = std::ios_base::out));
+    boost::shared_ptr<sinks::sink> sink;
+    if (appender.isAsynchronous()) {
+      // the records are formatted by the writer thread of the backend
+      boost::shared_ptr<AsynchronousFileBackend> backend = boost::make_shared<AsynchronousFileBackend>(appender.getFilePath());
+      backend->setFormatter(buildFormatter(appender));
+      boost::shared_ptr<AsynchronousFileSink> asynchronousSink(new AsynchronousFileSink(backend));
+      setFilter(appender, currentId, *asynchronousSink);
+      sink = asynchronousSink;
+    } else {
+      boost::shared_ptr<FileSink> fileSink(new FileSink(
+        keywords::file_name = appender.getFilePath(),
+        keywords::open_mode = std::ios_base::out));
+      fileSink->set_formatter(buildFormatter(appender));
+      setFilter(appender, currentId, *fileSink);
+      sink = fileSink;
+    }
 
-    // build format for each appenders depending on its attributes
     const string& appenderTag = appender.getTag();
     const SeverityLevel severityLevel = appender.getLvlFilter();
-    const string& separator = appender.getSeparator();
-    const bool showTag = appender.getShowLevelTag();
-    const bool showTimeStamp = appender.getShowTimeStamp();
-    const string& dateFormat = appender.getTimeStampFormat();
-
-    logging::formatter fmt;
-
-    if (showTimeStamp && showTag) {
-      fmt = expr::stream << expr::format_date_time< boost::posix_time::ptime >("TimeStamp", dateFormat) << separator << severity << separator << expr::message;
-    } else if (showTimeStamp) {  // && ! showTag
-      fmt = expr::stream << expr::format_date_time< boost::posix_time::ptime >("TimeStamp", dateFormat) << separator << expr::message;
-    } else if (showTag) {  // && ! showTimeStamp
-      fmt = expr::stream << severity << separator << expr::message;
-    } else {  // ! showTimeStamp && ! showTag
-      fmt = expr::stream << expr::message;
-    }
-
-    sink->set_formatter(fmt);
-
-    if (appenderTag.empty()) {
-      sink->set_filter(severity >= severityLevel && !expr::has_attr(tag_attr) && thread_attr == currentId);
-    } else {
-      sink->set_filter(severity >= severityLevel && tag_attr == appenderTag && thread_attr == currentId);
-    }
     logging::core::get()->add_sink(sink);
     TagAndSeverityLevel tagAndSeverityLevel = std::make_pair(appenderTag, severityLevel);
     if (appender.isPersistent()) {
@@ -215,6 +266,7 @@ void Trace::configureSink(const std::vector<TraceAppender>& appenders, bool eras
     } else {
       sinks_.insert(std::make_pair(currentId, traceSink));
     }
+    ++sinksGeneration;
   }
 }
 
@@ -235,6 +287,7 @@ void Trace::resetPersistentCustomAppenders_() {
     logging::core::get()->remove_sink(persistentSinkPair.second);
   }
   traceSink.persistentSinks.clear();
+  ++sinksGeneration;
 }
 
 
@@ -264,12 +317,17 @@ void Trace::resetPersistentCustomAppender_(const std::string& tag, const Severit
   }
   TagAndSeverityLevel tagAndSeverityLevel = std::make_pair(tag, slv);
   traceSink.persistentSinks.erase(tagAndSeverityLevel);
+  ++sinksGeneration;
 }
 
 void Trace::resetCustomAppenders() {
   instance().resetCustomAppenders_();
 }
 
+void Trace::flush() {
+  logging::core::get()->flush();
+}
+
 void Trace::resetCustomAppenders_() {
   boost::lock_guard<boost::mutex> lock(mutex_);
 
@@ -279,13 +337,13 @@ void Trace::resetCustomAppenders_() {
 
   const logging::attributes::current_thread_id::value_type currentId =
     logging::attributes::current_thread_id().get_value().extract<logging::attributes::current_thread_id::value_type>().get();
-  if (sinks_.find(currentId) == sinks_.end()) {
-    return;
+  if (sinks_.find(currentId) != sinks_.end()) {
+    TraceSinks& traceSink = sinks_.at(currentId);
+    for (const auto& sinkPair : traceSink.sinks)
+      logging::core::get()->remove_sink(sinkPair.second);
+    traceSink.sinks.clear();
   }
-  TraceSinks& traceSink = sinks_.at(currentId);
-  for (const auto& sinkPair : traceSink.sinks)
-    logging::core::get()->remove_sink(sinkPair.second);
-  traceSink.sinks.clear();
+  ++sinksGeneration;
 }
 
 void Trace::resetCustomAppender(const std::string& tag, SeverityLevel slv) {
@@ -314,6 +372,7 @@ void Trace::resetCustomAppender_(const std::string& tag, SeverityLevel slv) {
   }
   TagAndSeverityLevel tagAndSeverityLevel = std::make_pair(tag, slv);
   traceSink.sinks.erase(tagAndSeverityLevel);
+  ++sinksGeneration;
 }
 
 TraceStream
@@ -389,7 +448,20 @@ void Trace::log_(SeverityLevel slv, const std::string& tag, const std::string& m
 
 bool
 Trace::logExists(const std::string& tag, const SeverityLevel slv) {
-  return instance().logExists_(tag, slv);
+  // the sinks filter the logs by thread and only change when they are configured or reset: the answer is cached by thread
+  static thread_local LogExistsCache cache;
+  const unsigned generation = sinksGeneration.load(std::memory_order_acquire);
+  if (cache.generation != generation) {
+    cache.results.clear();
+    cache.generation = generation;
+  }
+  const TagAndSeverityLevel tagAndSeverityLevel = std::make_pair(tag, slv);
+  const auto result = cache.results.find(tagAndSeverityLevel);
+  if (result != cache.results.end())
+    return result->second;
+  const bool exists = instance().logExists_(tag, slv);
+  cache.results[tagAndSeverityLevel] = exists;
+  return exists;
 }
 
 bool
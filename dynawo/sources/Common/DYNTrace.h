@@ -28,6 +28,7 @@
 #include <vector>
 
 #include "DYNTraceStream.h"
+#include "DYNTraceAsynchronousBackend.h"
 
 #include <boost/log/sinks.hpp>
 #include <boost/shared_ptr.hpp>
@@ -36,6 +37,19 @@
 #include <boost/optional.hpp>
 #include <unordered_map>
 
+/**
+ * @brief Stream a log only if its severity level is exported for its tag
+ *
+ * Contrary to Trace::debug(tag) and the others, the expressions streamed after the macro, dictionary messages
+ * included, are neither evaluated nor formatted when the log is filtered out:
+ * @code DYNTraceIf(DYN::DEBUG, DYN::Trace::solver()) << DYNLog(SolverIDANumRootsFound, numRoots) << DYN::Trace::endline; @endcode
+ *
+ * @param slv severity level of the log
+ * @param tag tag of the log, "" for no tag
+ */
+#define DYNTraceIf(slv, tag) \
+  if (!DYN::Trace::isLogEnabled(tag, slv)) {} else DYN::TraceStream(slv, tag)  /* NOLINT */
+
 namespace DYN {
 
 /**
@@ -75,9 +89,9 @@ class Trace {
    * @brief Stucture defining traces for a specific thread
    */
   struct TraceSinks {
-    std::unordered_multimap<TagAndSeverityLevel, boost::shared_ptr<FileSink>,
+    std::unordered_multimap<TagAndSeverityLevel, boost::shared_ptr<boost::log::sinks::sink>,
                         TagAndSeverityLevelHash> sinks;  ///< multimap each appender tag-severitylevel pair to its corresponding file sink
-    std::unordered_multimap<TagAndSeverityLevel, boost::shared_ptr<FileSink>,
+    std::unordered_multimap<TagAndSeverityLevel, boost::shared_ptr<boost::log::sinks::sink>,
                         TagAndSeverityLevelHash> persistentSinks;  ///< multimap each appender tag-severitylevel pair to its corresponding persistent file sink
   };
 
@@ -121,7 +135,8 @@ class Trace {
       separator_(),
       showTimeStamp_(false),
       timeStampFormat_(),
-      persistent_(false) { }
+      persistent_(false),
+      asynchronous_(false) { }
 
     /**
      * @brief Tag attribute getter
@@ -187,6 +202,14 @@ class Trace {
       return persistent_;
     }
 
+    /**
+     * @brief Determines if the log is written to the file by a dedicated thread
+     * @returns whether the log is written to the file by a dedicated thread
+     */
+    bool isAsynchronous() const {
+      return asynchronous_;
+    }
+
     /**
      * @brief Tag attribute setter
      * @param tag Tag filtered by the appender
@@ -252,6 +275,15 @@ class Trace {
       persistent_ = persistent;
     }
 
+    /**
+     * @brief Set the asynchronous attribute
+     *
+     * @param asynchronous determines if the log is queued and written to the file by a dedicated thread
+     */
+    void setAsynchronous(bool asynchronous) {
+      asynchronous_ = asynchronous;
+    }
+
    private:
     std::string tag_;  ///< Tag filtered by the appender
     std::string filePath_;  ///< Output file path of the appender
@@ -261,6 +293,7 @@ class Trace {
     bool showTimeStamp_;  ///< @b true if the timestamp of the log should be printed
     std::string timeStampFormat_;  ///< format of the timestamp information , "" if no time to print
     bool persistent_;  ///< Do not remove this appender when resetting
+    bool asynchronous_;  ///< Queue the log and write it to the file from a dedicated thread
   };
 
   /**
@@ -303,6 +336,13 @@ class Trace {
    */
   static void resetCustomAppenders();
 
+  /**
+   * @brief Write the buffered logs of all the appenders to their files
+   *
+   * Needed before forking the process, otherwise the buffered logs would be written by both processes.
+   */
+  static void flush();
+
   /**
    * @brief Reset a specific non-persistent custom appender of trace system
    *
@@ -459,6 +499,17 @@ class Trace {
     return slv >= defaultLevel_;
   }
 
+  /**
+   * @brief Test if a log is exported by the standard output or by a file log
+   *
+   * @param tag : Tag added to the log, can be used as a filter in logging sinks.
+   * @param slv : Severity level.
+   * @return true if a log with this tag and this level is exported
+   */
+  static bool isLogEnabled(const std::string& tag, SeverityLevel slv) {
+    return standardLogExists(slv) || logExists(tag, slv);
+  }
+
   /**
    * @brief Print Dynawo log header in the log file corresponding to input tag
    *
@@ -0,0 +1,210 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+/**
+ * @file  DYNTraceAsynchronousBackend.cpp
+ *
+ * @brief Log sink backend formatting and writing the records to a file from a dedicated thread implementation
+ *
+ */
+#include "DYNTraceAsynchronousBackend.h"
+
+#include <algorithm>
+#include <chrono>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+namespace DYN {
+
+namespace {
+
+/**
+ * @brief backends alive in the process, stopped and written before a fork
+ *
+ * The registry is leaked on purpose, so that it is still available to the backends destroyed at exit.
+ */
+struct BackendRegistry {
+  std::mutex mutex;  ///< mutex of the registry, held during a fork
+  std::vector<AsynchronousFileBackend*> backends;  ///< backends alive
+};
+
+/**
+ * @brief get the registry of the backends
+ * @return registry of the backends
+ */
+BackendRegistry&
+registry() {
+  static BackendRegistry* instance = new BackendRegistry();
+  return *instance;
+}
+
+}  // namespace
+
+const std::size_t AsynchronousFileBackend::DEFAULT_CAPACITY;
+
+AsynchronousFileBackend::AsynchronousFileBackend(const std::string& filePath, const std::size_t capacity) :
+file_(filePath.c_str(), std::ios::out | std::ios::trunc),
+records_(std::max(capacity, static_cast<std::size_t>(1))),
+lineStream_(line_),
+head_(0),
+tail_(0),
+stopRequested_(false) {
+#ifndef _WIN32
+  static std::once_flag forkHandlersRegistered;
+  std::call_once(forkHandlersRegistered, [] {
+    pthread_atfork(&AsynchronousFileBackend::prepareForkHandler, &AsynchronousFileBackend::resumeAfterForkHandler,
+        &AsynchronousFileBackend::resumeAfterForkHandler);
+  });
+#endif
+  std::lock_guard<std::mutex> lock(registry().mutex);
+  registry().backends.push_back(this);
+  startWriter();
+}
+
+AsynchronousFileBackend::~AsynchronousFileBackend() {
+  {
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    std::vector<AsynchronousFileBackend*>& backends = registry().backends;
+    backends.erase(std::remove(backends.begin(), backends.end(), this), backends.end());
+  }
+  stopWriter();
+  flush();
+}
+
+void
+AsynchronousFileBackend::setFormatter(const boost::log::formatter& formatter) {
+  std::lock_guard<std::mutex> lock(writeMutex_);
+  formatter_ = formatter;
+}
+
+void
+AsynchronousFileBackend::consume(const boost::log::record_view& record) {
+  std::lock_guard<std::mutex> lock(producerMutex_);
+  const std::size_t head = head_.load(std::memory_order_relaxed);
+  // the buffer is full: wait for the writer thread rather than dropping the record
+  while (head - tail_.load(std::memory_order_acquire) >= records_.size())
+    std::this_thread::yield();
+  // the record only holds references to its attribute values: they are formatted by the writer thread
+  records_[head % records_.size()] = record;
+  head_.store(head + 1, std::memory_order_release);
+}
+
+void
+AsynchronousFileBackend::flush() {
+  std::lock_guard<std::mutex> lock(writeMutex_);
+  writeQueuedRecords();
+  file_.flush();
+}
+
+std::size_t
+AsynchronousFileBackend::nbQueuedRecords() const {
+  return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+}
+
+void
+AsynchronousFileBackend::startWriter() {
+  stopRequested_.store(false);
+  writer_ = std::thread(&AsynchronousFileBackend::writerLoop, this);
+}
+
+void
+AsynchronousFileBackend::stopWriter() {
+  stopRequested_.store(true);
+  if (writer_.joinable())
+    writer_.join();
+}
+
+void
+AsynchronousFileBackend::writerLoop() {
+  while (!stopRequested_.load()) {
+    bool written = false;
+    {
+      std::lock_guard<std::mutex> lock(writeMutex_);
+      written = writeQueuedRecords();
+      if (written && nbQueuedRecords() == 0)
+        file_.flush();
+    }
+    if (!written)
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
+
+bool
+AsynchronousFileBackend::writeQueuedRecords() {
+  const std::size_t head = head_.load(std::memory_order_acquire);
+  std::size_t tail = tail_.load(std::memory_order_relaxed);
+  if (tail == head)
+    return false;
+  for (; tail != head; ++tail) {
+    boost::log::record_view& slot = records_[tail % records_.size()];
+    line_.clear();
+    formatter_(slot, lineStream_);
+    lineStream_.flush();
+    line_.push_back('\n');
+    file_.write(line_.data(), static_cast<std::streamsize>(line_.size()));
+    slot = boost::log::record_view();
+    // the slot is released record by record so that a logging thread waiting for room is unblocked early
+    tail_.store(tail + 1, std::memory_order_release);
+  }
+  return true;
+}
+
+void
+AsynchronousFileBackend::prepareFork() {
+  stopWriter();
+  producerMutex_.lock();
+  writeMutex_.lock();
+  writeQueuedRecords();
+  file_.flush();
+}
+
+void
+AsynchronousFileBackend::resumeAfterFork() {
+  writeMutex_.unlock();
+  producerMutex_.unlock();
+  startWriter();
+}
+
+void
+AsynchronousFileBackend::prepareForkHandler() {
+  registry().mutex.lock();
+  std::vector<AsynchronousFileBackend*>& backends = registry().backends;
+  for (std::vector<AsynchronousFileBackend*>::iterator it = backends.begin(); it != backends.end(); ++it)
+    (*it)->prepareFork();
+}
+
+void
+AsynchronousFileBackend::resumeAfterForkHandler() {
+  std::vector<AsynchronousFileBackend*>& backends = registry().backends;
+  for (std::vector<AsynchronousFileBackend*>::iterator it = backends.begin(); it != backends.end(); ++it)
+    (*it)->resumeAfterFork();
+  registry().mutex.unlock();
+}
+
+AsynchronousFileSink::AsynchronousFileSink(const boost::shared_ptr<AsynchronousFileBackend>& backend) :
+boost::log::sinks::basic_sink_frontend(true),
+backend_(backend) {}
+
+void
+AsynchronousFileSink::consume(const boost::log::record_view& record) {
+  backend_->consume(record);
+}
+
+void
+AsynchronousFileSink::flush() {
+  backend_->flush();
+}
+
+}  // namespace DYN
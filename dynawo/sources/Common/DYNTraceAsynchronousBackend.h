@@ -0,0 +1,198 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+/**
+ * @file  DYNTraceAsynchronousBackend.h
+ *
+ * @brief Log sink backend formatting and writing the records to a file from a dedicated thread
+ *
+ */
+#ifndef COMMON_DYNTRACEASYNCHRONOUSBACKEND_H_
+#define COMMON_DYNTRACEASYNCHRONOUSBACKEND_H_
+
+#include <atomic>
+#include <cstddef>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/log/sinks/basic_sink_backend.hpp>
+#include <boost/log/sinks/basic_sink_frontend.hpp>
+#include <boost/log/sinks/frontend_requirements.hpp>
+#include <boost/log/core/record_view.hpp>
+#include <boost/log/expressions/formatter.hpp>
+#include <boost/log/utility/formatting_ostream.hpp>
+
+namespace DYN {
+
+/**
+ * @class AsynchronousFileBackend
+ * @brief Sink backend queuing the records, formatted and written to a file by a dedicated thread
+ *
+ * The records are queued in a bounded ring buffer without being formatted: the writer thread formats and writes them
+ * without blocking the logging threads, which only wait if the buffer is full, so that no record is lost and the
+ * memory stays bounded. The queued records are written when the backend is flushed or destroyed, and before the
+ * process is forked so that they are not written by both processes.
+ */
+class AsynchronousFileBackend :
+  public boost::log::sinks::basic_sink_backend<
+    boost::log::sinks::combine_requirements<boost::log::sinks::concurrent_feeding, boost::log::sinks::flushing>::type> {
+ public:
+  static const std::size_t DEFAULT_CAPACITY = 16384;  ///< default maximum number of queued records
+
+  /**
+   * @brief constructor: open the file and start the writer thread
+   *
+   * @param filePath path of the log file, truncated
+   * @param capacity maximum number of queued records
+   */
+  explicit AsynchronousFileBackend(const std::string& filePath, std::size_t capacity = DEFAULT_CAPACITY);
+
+  /**
+   * @brief destructor: stop the writer thread and write the queued records
+   */
+  ~AsynchronousFileBackend();
+
+  /**
+   * @brief set the formatter of the records, called by the writer thread
+   *
+   * @param formatter formatter of the records
+   */
+  void setFormatter(const boost::log::formatter& formatter);
+
+  /**
+   * @brief queue a record, formatted later by the writer thread
+   *
+   * @param record record
+   */
+  void consume(const boost::log::record_view& record);
+
+  /**
+   * @brief write the queued records and flush the file
+   */
+  void flush();
+
+  /**
+   * @brief get the number of records queued and not written yet
+   *
+   * @return number of queued records
+   */
+  std::size_t nbQueuedRecords() const;
+
+ private:
+  /**
+   * @brief start the writer thread
+   */
+  void startWriter();
+
+  /**
+   * @brief stop the writer thread, the queued records being kept
+   */
+  void stopWriter();
+
+  /**
+   * @brief loop of the writer thread
+   */
+  void writerLoop();
+
+  /**
+   * @brief write the queued records, the write mutex being locked
+   *
+   * @return @b true if at least one record was written
+   */
+  bool writeQueuedRecords();
+
+  /**
+   * @brief stop the writer thread, write the queued records and lock the backend before a fork
+   */
+  void prepareFork();
+
+  /**
+   * @brief unlock the backend and restart the writer thread after a fork, in the parent and in the child processes
+   */
+  void resumeAfterFork();
+
+  /**
+   * @brief fork handler called before a fork, for all the backends
+   */
+  static void prepareForkHandler();
+
+  /**
+   * @brief fork handler called after a fork, for all the backends
+   */
+  static void resumeAfterForkHandler();
+
+  /**
+   * @brief copy constructor
+   */
+  AsynchronousFileBackend(const AsynchronousFileBackend&);
+
+  /**
+   * @brief assignment operator
+   * @return this backend
+   */
+  AsynchronousFileBackend& operator=(const AsynchronousFileBackend&);
+
+ private:
+  std::ofstream file_;  ///< log file
+  std::vector<boost::log::record_view> records_;  ///< ring buffer of the records
+  boost::log::formatter formatter_;  ///< formatter of the records, only writing the message by default
+  std::string line_;  ///< buffer of the formatted record being written
+  boost::log::formatting_ostream lineStream_;  ///< stream formatting the records in the buffer
+  std::atomic<std::size_t> head_;  ///< number of records queued since the creation
+  std::atomic<std::size_t> tail_;  ///< number of records written since the creation
+  std::mutex producerMutex_;  ///< mutex of the logging threads, only contended if several threads share the sink
+  std::mutex writeMutex_;  ///< mutex of the writes in the file, between the writer thread and the flushes
+  std::atomic<bool> stopRequested_;  ///< whether the writer thread has to stop
+  std::thread writer_;  ///< writer thread
+};
+
+/**
+ * @class AsynchronousFileSink
+ * @brief Sink frontend passing the records to an asynchronous file backend
+ *
+ * Contrary to the frontends of Boost.Log without their own thread, the sink declares that it passes the records
+ * to another thread: the logging core detaches the thread-specific attribute values, such as the severity level,
+ * so that the writer thread formats the values of the logging thread.
+ */
+class AsynchronousFileSink : public boost::log::sinks::basic_sink_frontend {
+ public:
+  /**
+   * @brief constructor
+   *
+   * @param backend backend queuing and writing the records
+   */
+  explicit AsynchronousFileSink(const boost::shared_ptr<AsynchronousFileBackend>& backend);
+
+  /**
+   * @brief queue a record in the backend
+   *
+   * @param record record
+   */
+  void consume(const boost::log::record_view& record);
+
+  /**
+   * @brief write the records queued in the backend
+   */
+  void flush();
+
+ private:
+  boost::shared_ptr<AsynchronousFileBackend> backend_;  ///< backend queuing and writing the records
+};
+
+}  // namespace DYN
+
+#endif  // COMMON_DYNTRACEASYNCHRONOUSBACKEND_H_
@@ -0,0 +1,457 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNVectorKernels.cpp
+ *
+ * @brief Vectorized reductions on arrays of doubles implementation
+ *
+ */
+#include <cmath>
+
+#include "DYNVectorKernels.h"
+
+// the vector implementations are compiled with function-specific targets so that the library still runs on any x86 processor
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DYN_X86_VECTOR_KERNELS
+#include <immintrin.h>
+#define DYN_TARGET_AVX2 __attribute__((target("avx2")))
+#define DYN_TARGET_AVX512 __attribute__((target("avx512f")))
+#endif
+
+namespace DYN {
+
+namespace {
+
+/**
+ * @brief implementations of the reductions for one instruction set
+ */
+struct Kernels {
+  VectorKernels::instructionSet_t instructionSet;  ///< instruction set of the implementations
+  double (*maxAbsProduct)(const double*, const double*, std::size_t);  ///< max(|x[i] * w[i]|)
+  double (*sumSquaredProducts)(const double*, const double*, std::size_t);  ///< sum((x[i] * w[i])^2)
+  double (*maxAbsProductIndexed)(const double*, const int*, const double*, std::size_t);  ///< max(|x[index[i]] * w[i]|)
+  double (*sumSquaredProductsIndexed)(const double*, const int*, const double*, std::size_t);  ///< sum((x[index[i]] * w[i])^2)
+  double (*sumSquares)(const double*, std::size_t);  ///< sum(x[i]^2)
+  double (*sumAbs)(const double*, std::size_t);  ///< sum(|x[i]|)
+  double (*maxAbs)(const double*, std::size_t);  ///< max(|x[i]|)
+};
+
+// scalar implementations, also used for the remainders of the vector implementations
+
+double
+maxAbsProductScalar(const double* x, const double* w, std::size_t size) {
+  double norm = 0.;
+  for (std::size_t i = 0; i < size; ++i) {
+    const double product = std::fabs(x[i] * w[i]);
+    if (product > norm)
+      norm = product;
+  }
+  return norm;
+}
+
+double
+sumSquaredProductsScalar(const double* x, const double* w, std::size_t size) {
+  double sum = 0.;
+  for (std::size_t i = 0; i < size; ++i)
+    sum += (x[i] * w[i]) * (x[i] * w[i]);
+  return sum;
+}
+
+double
+maxAbsProductIndexedScalar(const double* x, const int* index, const double* w, std::size_t size) {
+  double norm = 0.;
+  for (std::size_t i = 0; i < size; ++i) {
+    const double product = std::fabs(x[index[i]] * w[i]);
+    if (product > norm)
+      norm = product;
+  }
+  return norm;
+}
+
+double
+sumSquaredProductsIndexedScalar(const double* x, const int* index, const double* w, std::size_t size) {
+  double sum = 0.;
+  for (std::size_t i = 0; i < size; ++i)
+    sum += (x[index[i]] * w[i]) * (x[index[i]] * w[i]);
+  return sum;
+}
+
+double
+sumSquaresScalar(const double* x, std::size_t size) {
+  double sum = 0.;
+  for (std::size_t i = 0; i < size; ++i)
+    sum += x[i] * x[i];
+  return sum;
+}
+
+double
+sumAbsScalar(const double* x, std::size_t size) {
+  double sum = 0.;
+  for (std::size_t i = 0; i < size; ++i)
+    sum += std::fabs(x[i]);
+  return sum;
+}
+
+double
+maxAbsScalar(const double* x, std::size_t size) {
+  double norm = 0.;
+  for (std::size_t i = 0; i < size; ++i) {
+    const double value = std::fabs(x[i]);
+    if (value > norm)
+      norm = value;
+  }
+  return norm;
+}
+
+const Kernels scalarKernels = {VectorKernels::SCALAR, maxAbsProductScalar, sumSquaredProductsScalar, maxAbsProductIndexedScalar,
+    sumSquaredProductsIndexedScalar, sumSquaresScalar, sumAbsScalar, maxAbsScalar};
+
+#ifdef DYN_X86_VECTOR_KERNELS
+// In the max reductions, the new terms are given as first operand of the max instructions: when a term is NaN the second operand
+// is returned, so that NaN values are ignored as in the scalar implementations.
+
+DYN_TARGET_AVX2 inline __m256d
+abs256(__m256d v) {
+  return _mm256_andnot_pd(_mm256_set1_pd(-0.), v);
+}
+
+DYN_TARGET_AVX2 inline double
+horizontalSum256(__m256d v) {
+  const __m128d pairs = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+  return _mm_cvtsd_f64(_mm_add_sd(pairs, _mm_unpackhi_pd(pairs, pairs)));
+}
+
+DYN_TARGET_AVX2 inline double
+horizontalMax256(__m256d v) {
+  const __m128d pairs = _mm_max_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+  return _mm_cvtsd_f64(_mm_max_sd(pairs, _mm_unpackhi_pd(pairs, pairs)));
+}
+
+DYN_TARGET_AVX2 double
+maxAbsProductAVX2(const double* x, const double* w, std::size_t size) {
+  __m256d max0 = _mm256_setzero_pd();
+  __m256d max1 = _mm256_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    max0 = _mm256_max_pd(abs256(_mm256_mul_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(w + i))), max0);
+    max1 = _mm256_max_pd(abs256(_mm256_mul_pd(_mm256_loadu_pd(x + i + 4), _mm256_loadu_pd(w + i + 4))), max1);
+  }
+  const double norm = horizontalMax256(_mm256_max_pd(max0, max1));
+  const double remainder = maxAbsProductScalar(x + i, w + i, size - i);
+  return remainder > norm ? remainder : norm;
+}
+
+DYN_TARGET_AVX2 double
+sumSquaredProductsAVX2(const double* x, const double* w, std::size_t size) {
+  __m256d sum0 = _mm256_setzero_pd();
+  __m256d sum1 = _mm256_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    const __m256d product0 = _mm256_mul_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(w + i));
+    const __m256d product1 = _mm256_mul_pd(_mm256_loadu_pd(x + i + 4), _mm256_loadu_pd(w + i + 4));
+    sum0 = _mm256_add_pd(sum0, _mm256_mul_pd(product0, product0));
+    sum1 = _mm256_add_pd(sum1, _mm256_mul_pd(product1, product1));
+  }
+  return horizontalSum256(_mm256_add_pd(sum0, sum1)) + sumSquaredProductsScalar(x + i, w + i, size - i);
+}
+
+DYN_TARGET_AVX2 double
+maxAbsProductIndexedAVX2(const double* x, const int* index, const double* w, std::size_t size) {
+  __m256d max = _mm256_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    const __m256d values = _mm256_i32gather_pd(x, _mm_loadu_si128(reinterpret_cast<const __m128i*>(index + i)), 8);
+    max = _mm256_max_pd(abs256(_mm256_mul_pd(values, _mm256_loadu_pd(w + i))), max);
+  }
+  const double norm = horizontalMax256(max);
+  const double remainder = maxAbsProductIndexedScalar(x, index + i, w + i, size - i);
+  return remainder > norm ? remainder : norm;
+}
+
+DYN_TARGET_AVX2 double
+sumSquaredProductsIndexedAVX2(const double* x, const int* index, const double* w, std::size_t size) {
+  __m256d sum = _mm256_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    const __m256d values = _mm256_i32gather_pd(x, _mm_loadu_si128(reinterpret_cast<const __m128i*>(index + i)), 8);
+    const __m256d product = _mm256_mul_pd(values, _mm256_loadu_pd(w + i));
+    sum = _mm256_add_pd(sum, _mm256_mul_pd(product, product));
+  }
+  return horizontalSum256(sum) + sumSquaredProductsIndexedScalar(x, index + i, w + i, size - i);
+}
+
+DYN_TARGET_AVX2 double
+sumSquaresAVX2(const double* x, std::size_t size) {
+  __m256d sum0 = _mm256_setzero_pd();
+  __m256d sum1 = _mm256_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    const __m256d values0 = _mm256_loadu_pd(x + i);
+    const __m256d values1 = _mm256_loadu_pd(x + i + 4);
+    sum0 = _mm256_add_pd(sum0, _mm256_mul_pd(values0, values0));
+    sum1 = _mm256_add_pd(sum1, _mm256_mul_pd(values1, values1));
+  }
+  return horizontalSum256(_mm256_add_pd(sum0, sum1)) + sumSquaresScalar(x + i, size - i);
+}
+
+DYN_TARGET_AVX2 double
+sumAbsAVX2(const double* x, std::size_t size) {
+  __m256d sum0 = _mm256_setzero_pd();
+  __m256d sum1 = _mm256_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    sum0 = _mm256_add_pd(sum0, abs256(_mm256_loadu_pd(x + i)));
+    sum1 = _mm256_add_pd(sum1, abs256(_mm256_loadu_pd(x + i + 4)));
+  }
+  return horizontalSum256(_mm256_add_pd(sum0, sum1)) + sumAbsScalar(x + i, size - i);
+}
+
+DYN_TARGET_AVX2 double
+maxAbsAVX2(const double* x, std::size_t size) {
+  __m256d max0 = _mm256_setzero_pd();
+  __m256d max1 = _mm256_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    max0 = _mm256_max_pd(abs256(_mm256_loadu_pd(x + i)), max0);
+    max1 = _mm256_max_pd(abs256(_mm256_loadu_pd(x + i + 4)), max1);
+  }
+  const double norm = horizontalMax256(_mm256_max_pd(max0, max1));
+  const double remainder = maxAbsScalar(x + i, size - i);
+  return remainder > norm ? remainder : norm;
+}
+
+DYN_TARGET_AVX512 double
+maxAbsProductAVX512(const double* x, const double* w, std::size_t size) {
+  __m512d max0 = _mm512_setzero_pd();
+  __m512d max1 = _mm512_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    max0 = _mm512_max_pd(_mm512_abs_pd(_mm512_mul_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(w + i))), max0);
+    max1 = _mm512_max_pd(_mm512_abs_pd(_mm512_mul_pd(_mm512_loadu_pd(x + i + 8), _mm512_loadu_pd(w + i + 8))), max1);
+  }
+  const double norm = _mm512_reduce_max_pd(_mm512_max_pd(max0, max1));
+  const double remainder = maxAbsProductScalar(x + i, w + i, size - i);
+  return remainder > norm ? remainder : norm;
+}
+
+DYN_TARGET_AVX512 double
+sumSquaredProductsAVX512(const double* x, const double* w, std::size_t size) {
+  __m512d sum0 = _mm512_setzero_pd();
+  __m512d sum1 = _mm512_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    const __m512d product0 = _mm512_mul_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(w + i));
+    const __m512d product1 = _mm512_mul_pd(_mm512_loadu_pd(x + i + 8), _mm512_loadu_pd(w + i + 8));
+    sum0 = _mm512_add_pd(sum0, _mm512_mul_pd(product0, product0));
+    sum1 = _mm512_add_pd(sum1, _mm512_mul_pd(product1, product1));
+  }
+  return _mm512_reduce_add_pd(_mm512_add_pd(sum0, sum1)) + sumSquaredProductsScalar(x + i, w + i, size - i);
+}
+
+DYN_TARGET_AVX512 double
+maxAbsProductIndexedAVX512(const double* x, const int* index, const double* w, std::size_t size) {
+  __m512d max = _mm512_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    const __m512d values = _mm512_i32gather_pd(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(index + i)), x, 8);
+    max = _mm512_max_pd(_mm512_abs_pd(_mm512_mul_pd(values, _mm512_loadu_pd(w + i))), max);
+  }
+  const double norm = _mm512_reduce_max_pd(max);
+  const double remainder = maxAbsProductIndexedScalar(x, index + i, w + i, size - i);
+  return remainder > norm ? remainder : norm;
+}
+
+DYN_TARGET_AVX512 double
+sumSquaredProductsIndexedAVX512(const double* x, const int* index, const double* w, std::size_t size) {
+  __m512d sum = _mm512_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    const __m512d values = _mm512_i32gather_pd(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(index + i)), x, 8);
+    const __m512d product = _mm512_mul_pd(values, _mm512_loadu_pd(w + i));
+    sum = _mm512_add_pd(sum, _mm512_mul_pd(product, product));
+  }
+  return _mm512_reduce_add_pd(sum) + sumSquaredProductsIndexedScalar(x, index + i, w + i, size - i);
+}
+
+DYN_TARGET_AVX512 double
+sumSquaresAVX512(const double* x, std::size_t size) {
+  __m512d sum0 = _mm512_setzero_pd();
+  __m512d sum1 = _mm512_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    const __m512d values0 = _mm512_loadu_pd(x + i);
+    const __m512d values1 = _mm512_loadu_pd(x + i + 8);
+    sum0 = _mm512_add_pd(sum0, _mm512_mul_pd(values0, values0));
+    sum1 = _mm512_add_pd(sum1, _mm512_mul_pd(values1, values1));
+  }
+  return _mm512_reduce_add_pd(_mm512_add_pd(sum0, sum1)) + sumSquaresScalar(x + i, size - i);
+}
+
+DYN_TARGET_AVX512 double
+sumAbsAVX512(const double* x, std::size_t size) {
+  __m512d sum0 = _mm512_setzero_pd();
+  __m512d sum1 = _mm512_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    sum0 = _mm512_add_pd(sum0, _mm512_abs_pd(_mm512_loadu_pd(x + i)));
+    sum1 = _mm512_add_pd(sum1, _mm512_abs_pd(_mm512_loadu_pd(x + i + 8)));
+  }
+  return _mm512_reduce_add_pd(_mm512_add_pd(sum0, sum1)) + sumAbsScalar(x + i, size - i);
+}
+
+DYN_TARGET_AVX512 double
+maxAbsAVX512(const double* x, std::size_t size) {
+  __m512d max0 = _mm512_setzero_pd();
+  __m512d max1 = _mm512_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    max0 = _mm512_max_pd(_mm512_abs_pd(_mm512_loadu_pd(x + i)), max0);
+    max1 = _mm512_max_pd(_mm512_abs_pd(_mm512_loadu_pd(x + i + 8)), max1);
+  }
+  const double norm = _mm512_reduce_max_pd(_mm512_max_pd(max0, max1));
+  const double remainder = maxAbsScalar(x + i, size - i);
+  return remainder > norm ? remainder : norm;
+}
+
+const Kernels avx2Kernels = {VectorKernels::AVX2, maxAbsProductAVX2, sumSquaredProductsAVX2, maxAbsProductIndexedAVX2,
+    sumSquaredProductsIndexedAVX2, sumSquaresAVX2, sumAbsAVX2, maxAbsAVX2};
+
+const Kernels avx512Kernels = {VectorKernels::AVX512, maxAbsProductAVX512, sumSquaredProductsAVX512, maxAbsProductIndexedAVX512,
+    sumSquaredProductsIndexedAVX512, sumSquaresAVX512, sumAbsAVX512, maxAbsAVX512};
+#endif
+
+/**
+ * @brief get the implementations of the reductions for an instruction set
+ * @param instructionSet instruction set, supported by the processor
+ * @return the implementations
+ */
+const Kernels*
+kernelsFor(VectorKernels::instructionSet_t instructionSet) {
+  switch (instructionSet) {
+    case VectorKernels::AVX512:
+#ifdef DYN_X86_VECTOR_KERNELS
+      return &avx512Kernels;
+#else
+      break;
+#endif
+    case VectorKernels::AVX2:
+#ifdef DYN_X86_VECTOR_KERNELS
+      return &avx2Kernels;
+#else
+      break;
+#endif
+    case VectorKernels::SCALAR:
+      break;
+  }
+  return &scalarKernels;
+}
+
+/**
+ * @brief get the implementations currently used, the most efficient ones by default
+ * @return the implementations used
+ */
+const Kernels*&
+currentKernels() {
+  static const Kernels* kernels = kernelsFor(VectorKernels::isSupported(VectorKernels::AVX512) ? VectorKernels::AVX512 :
+      VectorKernels::isSupported(VectorKernels::AVX2) ? VectorKernels::AVX2 : VectorKernels::SCALAR);
+  return kernels;
+}
+
+}  // namespace
+
+bool
+VectorKernels::isSupported(const instructionSet_t instructionSet) {
+  switch (instructionSet) {
+    case SCALAR:
+      return true;
+    case AVX2:
+#ifdef DYN_X86_VECTOR_KERNELS
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2");
+#else
+      return false;
+#endif
+    case AVX512:
+#ifdef DYN_X86_VECTOR_KERNELS
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx512f");
+#else
+      return false;
+#endif
+  }
+  return false;
+}
+
+VectorKernels::instructionSet_t
+VectorKernels::getInstructionSet() {
+  return currentKernels()->instructionSet;
+}
+
+bool
+VectorKernels::setInstructionSet(const instructionSet_t instructionSet) {
+  if (!isSupported(instructionSet))
+    return false;
+  currentKernels() = kernelsFor(instructionSet);
+  return true;
+}
+
+std::string
+VectorKernels::toString(const instructionSet_t instructionSet) {
+  switch (instructionSet) {
+    case SCALAR:
+      return "scalar";
+    case AVX2:
+      return "AVX2";
+    case AVX512:
+      return "AVX-512";
+  }
+  return "";
+}
+
+double
+VectorKernels::maxAbsProduct(const double* x, const double* w, const std::size_t size) {
+  return currentKernels()->maxAbsProduct(x, w, size);
+}
+
+double
+VectorKernels::sumSquaredProducts(const double* x, const double* w, const std::size_t size) {
+  return currentKernels()->sumSquaredProducts(x, w, size);
+}
+
+double
+VectorKernels::maxAbsProduct(const double* x, const int* index, const double* w, const std::size_t size) {
+  return currentKernels()->maxAbsProductIndexed(x, index, w, size);
+}
+
+double
+VectorKernels::sumSquaredProducts(const double* x, const int* index, const double* w, const std::size_t size) {
+  return currentKernels()->sumSquaredProductsIndexed(x, index, w, size);
+}
+
+double
+VectorKernels::sumSquares(const double* x, const std::size_t size) {
+  return currentKernels()->sumSquares(x, size);
+}
+
+double
+VectorKernels::sumAbs(const double* x, const std::size_t size) {
+  return currentKernels()->sumAbs(x, size);
+}
+
+double
+VectorKernels::maxAbs(const double* x, const std::size_t size) {
+  return currentKernels()->maxAbs(x, size);
+}
+
+}  // end namespace DYN
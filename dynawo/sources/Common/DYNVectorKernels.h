@@ -0,0 +1,161 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNVectorKernels.h
+ *
+ * @brief Vectorized reductions on arrays of doubles, used by the norms of the solvers and of the sparse matrices
+ *
+ */
+#ifndef COMMON_DYNVECTORKERNELS_H_
+#define COMMON_DYNVECTORKERNELS_H_
+
+#include <cstddef>
+#include <string>
+
+namespace DYN {
+
+/**
+ * @brief VectorKernels static class
+ *
+ * Each reduction has a scalar implementation and, on x86 processors, AVX2 and AVX-512 implementations.
+ * The most efficient implementation supported by the processor is selected at the first call.
+ * The results of the sums may differ from the scalar ones by rounding errors, as the terms are not added in the same order.
+ */
+class VectorKernels {
+ public:
+  /**
+   * @brief instruction sets the reductions can be implemented with
+   */
+  typedef enum {
+    SCALAR = 0,  ///< no vector instruction
+    AVX2 = 1,  ///< 256 bits vectors
+    AVX512 = 2  ///< 512 bits vectors
+  } instructionSet_t;
+
+  /**
+   * @brief indicate whether an instruction set is supported by the processor and by this build
+   *
+   * @param instructionSet instruction set
+   *
+   * @return @b true if the reductions can be run with this instruction set
+   */
+  static bool isSupported(instructionSet_t instructionSet);
+
+  /**
+   * @brief get the instruction set currently used by the reductions
+   *
+   * @return the instruction set used
+   */
+  static instructionSet_t getInstructionSet();
+
+  /**
+   * @brief force the instruction set used by the reductions, mainly for tests and benchmarks
+   *
+   * Must not be called while reductions are running in other threads.
+   *
+   * @param instructionSet instruction set to use
+   *
+   * @return @b false if the instruction set is not supported, in which case the current one is kept
+   */
+  static bool setInstructionSet(instructionSet_t instructionSet);
+
+  /**
+   * @brief get the name of an instruction set
+   *
+   * @param instructionSet instruction set
+   *
+   * @return the name of the instruction set
+   */
+  static std::string toString(instructionSet_t instructionSet);
+
+  /**
+   * @brief compute max(|x[i] * w[i]|)
+   *
+   * @param x values
+   * @param w weights
+   * @param size number of values
+   *
+   * @return the largest weighted absolute value, 0 if there is no value
+   */
+  static double maxAbsProduct(const double* x, const double* w, std::size_t size);
+
+  /**
+   * @brief compute sum((x[i] * w[i])^2)
+   *
+   * @param x values
+   * @param w weights
+   * @param size number of values
+   *
+   * @return the sum of the squared weighted values
+   */
+  static double sumSquaredProducts(const double* x, const double* w, std::size_t size);
+
+  /**
+   * @brief compute max(|x[index[i]] * w[i]|)
+   *
+   * @param x values
+   * @param index indexes of the values to consider
+   * @param w weights, one for each index
+   * @param size number of indexes
+   *
+   * @return the largest weighted absolute value, 0 if there is no index
+   */
+  static double maxAbsProduct(const double* x, const int* index, const double* w, std::size_t size);
+
+  /**
+   * @brief compute sum((x[index[i]] * w[i])^2)
+   *
+   * @param x values
+   * @param index indexes of the values to consider
+   * @param w weights, one for each index
+   * @param size number of indexes
+   *
+   * @return the sum of the squared weighted values
+   */
+  static double sumSquaredProducts(const double* x, const int* index, const double* w, std::size_t size);
+
+  /**
+   * @brief compute sum(x[i]^2)
+   *
+   * @param x values
+   * @param size number of values
+   *
+   * @return the sum of the squared values
+   */
+  static double sumSquares(const double* x, std::size_t size);
+
+  /**
+   * @brief compute sum(|x[i]|)
+   *
+   * @param x values
+   * @param size number of values
+   *
+   * @return the sum of the absolute values
+   */
+  static double sumAbs(const double* x, std::size_t size);
+
+  /**
+   * @brief compute max(|x[i]|)
+   *
+   * @param x values
+   * @param size number of values
+   *
+   * @return the largest absolute value, 0 if there is no value
+   */
+  static double maxAbs(const double* x, std::size_t size);
+};
+
+}  // end namespace DYN
+
+#endif  // COMMON_DYNVECTORKERNELS_H_
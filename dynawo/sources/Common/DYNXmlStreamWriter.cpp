@@ -0,0 +1,196 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNXmlStreamWriter.cpp
+ *
+ * @brief Buffered xml writer used by the output exporters
+ *
+ */
+#include "DYNXmlStreamWriter.h"
+
+#include <cstdio>
+
+#include "DYNCommon.h"
+
+namespace DYN {
+
+static const std::size_t BUFFER_SIZE = 1 << 16;  ///< size above which the buffer is written to the stream
+
+XmlStreamWriter::XmlStreamWriter(std::ostream& stream, const std::string& defaultNamespace) :
+stream_(stream),
+defaultNamespace_(defaultNamespace),
+startTagOpen_(false) {
+  buffer_.reserve(BUFFER_SIZE + 1024);
+}
+
+XmlStreamWriter::~XmlStreamWriter() {
+  flush();
+}
+
+void
+XmlStreamWriter::startDocument() {
+  buffer_ += "<?xml version=\"1.0\" encoding=\"ISO-8859-1\" standalone=\"no\"?>\n";
+}
+
+void
+XmlStreamWriter::endDocument() {
+  while (!openElements_.empty())
+    endElement();
+  flush();
+}
+
+void
+XmlStreamWriter::startElement(const char* name) {
+  closeStartTag();
+  indent();
+  buffer_ += '<';
+  buffer_ += name;
+  if (openElements_.empty() && !defaultNamespace_.empty())
+    addAttribute("xmlns", defaultNamespace_);
+  openElements_.push_back(name);
+  startTagOpen_ = true;
+}
+
+void
+XmlStreamWriter::endElement() {
+  if (openElements_.empty())
+    return;
+  const char* name = openElements_.back();
+  openElements_.pop_back();
+  if (startTagOpen_) {
+    buffer_ += "/>\n";
+    startTagOpen_ = false;
+  } else {
+    indent();
+    buffer_ += "</";
+    buffer_ += name;
+    buffer_ += ">\n";
+  }
+  flushIfFull();
+}
+
+void
+XmlStreamWriter::addAttribute(const char* name, const std::string& value) {
+  startAttribute(name);
+  appendEscaped(value);
+  buffer_ += '"';
+}
+
+void
+XmlStreamWriter::addAttribute(const char* name, const int value) {
+  char number[16];
+  const int length = snprintf(number, sizeof(number), "%d", value);
+  startAttribute(name);
+  buffer_.append(number, static_cast<std::size_t>(length));
+  buffer_ += '"';
+}
+
+void
+XmlStreamWriter::addAttribute(const char* name, const double value, const DoubleFormat_t format) {
+  if (format == DOUBLE_PRECISION) {
+    char number[64];
+    const std::size_t length = double2Chars(value, number, sizeof(number));
+    if (length >= sizeof(number)) {
+      addAttribute(name, double2String(value));
+      return;
+    }
+    startAttribute(name);
+    buffer_.append(number, length);
+  } else {
+    char number[32];
+    const int length = snprintf(number, sizeof(number), "%g", value);
+    startAttribute(name);
+    buffer_.append(number, static_cast<std::size_t>(length));
+  }
+  buffer_ += '"';
+}
+
+void
+XmlStreamWriter::flush() {
+  if (buffer_.empty())
+    return;
+  stream_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+  buffer_.clear();
+}
+
+void
+XmlStreamWriter::closeStartTag() {
+  if (startTagOpen_) {
+    buffer_ += ">\n";
+    startTagOpen_ = false;
+  }
+}
+
+void
+XmlStreamWriter::indent() {
+  buffer_.append(2 * openElements_.size(), ' ');
+}
+
+void
+XmlStreamWriter::startAttribute(const char* name) {
+  buffer_ += ' ';
+  buffer_ += name;
+  buffer_ += "=\"";
+}
+
+void
+XmlStreamWriter::appendEscaped(const std::string& value) {
+  for (std::size_t i = 0, iEnd = value.size(); i < iEnd; ++i) {
+    const unsigned char c = static_cast<unsigned char>(value[i]);
+    switch (c) {
+      case '&': buffer_ += "&amp;"; continue;
+      case '<': buffer_ += "&lt;"; continue;
+      case '>': buffer_ += "&gt;"; continue;
+      case '"': buffer_ += "&quot;"; continue;
+      case '\n': buffer_ += "&#10;"; continue;
+      case '\r': buffer_ += "&#13;"; continue;
+      case '\t': buffer_ += "&#9;"; continue;
+      default: break;
+    }
+    if (c < 0x80) {
+      buffer_ += static_cast<char>(c);
+      continue;
+    }
+    // UTF-8 sequence: characters of ISO-8859-1 are written as is, the other ones as character references
+    std::size_t nbContinuationBytes = (c >= 0xF0) ? 3 : (c >= 0xE0) ? 2 : (c >= 0xC0) ? 1 : 0;
+    unsigned long codePoint = (c >= 0xF0) ? (c & 0x07) : (c >= 0xE0) ? (c & 0x0F) : (c & 0x1F);
+    bool valid = nbContinuationBytes > 0 && i + nbContinuationBytes < iEnd;
+    for (std::size_t j = 1; valid && j <= nbContinuationBytes; ++j) {
+      const unsigned char next = static_cast<unsigned char>(value[i + j]);
+      valid = (next & 0xC0) == 0x80;
+      codePoint = (codePoint << 6) | (next & 0x3F);
+    }
+    if (!valid) {
+      // not UTF-8: the byte is assumed to be already ISO-8859-1
+      buffer_ += static_cast<char>(c);
+      continue;
+    }
+    i += nbContinuationBytes;
+    if (codePoint <= 0xFF) {
+      buffer_ += static_cast<char>(codePoint);
+    } else {
+      char reference[16];
+      const int length = snprintf(reference, sizeof(reference), "&#%lu;", codePoint);
+      buffer_.append(reference, static_cast<std::size_t>(length));
+    }
+  }
+}
+
+void
+XmlStreamWriter::flushIfFull() {
+  if (buffer_.size() >= BUFFER_SIZE)
+    flush();
+}
+
+}  // namespace DYN
@@ -0,0 +1,155 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNXmlStreamWriter.h
+ *
+ * @brief Buffered xml writer used by the output exporters
+ *
+ */
+#ifndef COMMON_DYNXMLSTREAMWRITER_H_
+#define COMMON_DYNXMLSTREAMWRITER_H_
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+namespace DYN {
+
+/**
+ * @class XmlStreamWriter
+ * @brief xml writer appending the document directly to a buffer flushed to the output stream
+ *
+ * The document is the one written by the sax formatter of the exporters: an ISO-8859-1 declaration,
+ * a default namespace on the root element, two spaces of indentation per level and empty elements
+ * closed in their start tag. Nothing is kept in memory but the names of the open elements, and
+ * numbers are formatted without building a stream.
+ */
+class XmlStreamWriter : private boost::noncopyable {
+ public:
+  /**
+   * @brief formats of the double attributes
+   */
+  typedef enum {
+    DOUBLE_DEFAULT,  ///< six significant digits, as written by a default stream
+    DOUBLE_PRECISION  ///< fixed or scientific notation with the simulation precision, as written by double2String
+  } DoubleFormat_t;
+
+  /**
+   * @brief constructor
+   *
+   * @param stream stream to write the document to
+   * @param defaultNamespace namespace declared on the root element, none if empty
+   */
+  XmlStreamWriter(std::ostream& stream, const std::string& defaultNamespace);
+
+  /**
+   * @brief destructor, flushing the buffer
+   */
+  ~XmlStreamWriter();
+
+  /**
+   * @brief write the xml declaration
+   */
+  void startDocument();
+
+  /**
+   * @brief close the open elements and flush the buffer
+   */
+  void endDocument();
+
+  /**
+   * @brief open an element, its attributes being added next
+   *
+   * @param name name of the element, which must remain valid until the element is closed
+   */
+  void startElement(const char* name);
+
+  /**
+   * @brief close the last open element
+   */
+  void endElement();
+
+  /**
+   * @brief add a string attribute to the element just opened
+   *
+   * @param name name of the attribute
+   * @param value value of the attribute, encoded in UTF-8
+   */
+  void addAttribute(const char* name, const std::string& value);
+
+  /**
+   * @brief add an integer attribute to the element just opened
+   *
+   * @param name name of the attribute
+   * @param value value of the attribute
+   */
+  void addAttribute(const char* name, int value);
+
+  /**
+   * @brief add a double attribute to the element just opened
+   *
+   * @param name name of the attribute
+   * @param value value of the attribute
+   * @param format format of the value
+   */
+  void addAttribute(const char* name, double value, DoubleFormat_t format = DOUBLE_DEFAULT);
+
+  /**
+   * @brief write the buffer to the output stream
+   */
+  void flush();
+
+ private:
+  /**
+   * @brief close the start tag of the last open element, before its first child
+   */
+  void closeStartTag();
+
+  /**
+   * @brief write an indentation matching the current depth
+   */
+  void indent();
+
+  /**
+   * @brief write the beginning of an attribute
+   *
+   * @param name name of the attribute
+   */
+  void startAttribute(const char* name);
+
+  /**
+   * @brief write an attribute value, escaping the special characters and transcoding UTF-8 to ISO-8859-1
+   *
+   * @param value value to write
+   */
+  void appendEscaped(const std::string& value);
+
+  /**
+   * @brief flush the buffer to the stream when it is full
+   */
+  void flushIfFull();
+
+ private:
+  std::ostream& stream_;  ///< stream the document is written to
+  std::string defaultNamespace_;  ///< namespace declared on the root element
+  std::string buffer_;  ///< part of the document not yet written to the stream
+  std::vector<const char*> openElements_;  ///< names of the open elements
+  bool startTagOpen_;  ///< whether the start tag of the last open element still accepts attributes
+};
+
+}  // namespace DYN
+
+#endif  // COMMON_DYNXMLSTREAMWRITER_H_
@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  BenchVectorKernels.cpp
+ *
+ * @brief Microbenchmark of the vectorized reductions, for each instruction set supported by the processor
+ *
+ * usage: COMMON_vectorKernels_benchmark [size] [repetitions]
+ */
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "DYNVectorKernels.h"
+
+using DYN::VectorKernels;
+
+namespace {
+
+/**
+ * @brief time a reduction
+ * @param name name of the reduction
+ * @param repetitions number of calls to average
+ * @param reduction reduction to run
+ */
+template<typename Reduction>
+void
+timeReduction(const std::string& name, const unsigned repetitions, Reduction reduction) {
+  double result = 0.;
+  const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < repetitions; ++i)
+    result += reduction();
+  const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+  std::cout << "  " << std::left << std::setw(28) << name << std::right << std::setw(12) << std::fixed << std::setprecision(2)
+            << elapsed.count() / repetitions << " us  (" << std::scientific << result / repetitions << ")" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t size = argc > 1 ? static_cast<std::size_t>(std::atol(argv[1])) : 200000;
+  const unsigned repetitions = argc > 2 ? static_cast<unsigned>(std::atol(argv[2])) : 1000;
+
+  std::vector<double> x(size);
+  std::vector<double> w(size);
+  std::vector<int> index(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    x[i] = (i % 3 == 0 ? -1. : 1.) * static_cast<double>(i % 1000) * 1e-3;
+    w[i] = 1. / (1. + static_cast<double>(i % 7));
+    // even indexes, as the algebraic equations of the restoration
+    index[i] = static_cast<int>((2 * i) % size);
+  }
+
+  const VectorKernels::instructionSet_t instructionSets[] = {VectorKernels::SCALAR, VectorKernels::AVX2, VectorKernels::AVX512};
+  for (const auto instructionSet : instructionSets) {
+    if (!VectorKernels::setInstructionSet(instructionSet))
+      continue;
+    std::cout << VectorKernels::toString(instructionSet) << " (" << size << " values, " << repetitions << " repetitions)" << std::endl;
+    timeReduction("maxAbsProduct", repetitions, [&]() { return VectorKernels::maxAbsProduct(x.data(), w.data(), size); });
+    timeReduction("sumSquaredProducts", repetitions, [&]() { return VectorKernels::sumSquaredProducts(x.data(), w.data(), size); });
+    timeReduction("maxAbsProduct (indexed)", repetitions,
+        [&]() { return VectorKernels::maxAbsProduct(x.data(), index.data(), w.data(), size); });
+    timeReduction("sumSquaredProducts (indexed)", repetitions,
+        [&]() { return VectorKernels::sumSquaredProducts(x.data(), index.data(), w.data(), size); });
+    timeReduction("sumSquares", repetitions, [&]() { return VectorKernels::sumSquares(x.data(), size); });
+    timeReduction("sumAbs", repetitions, [&]() { return VectorKernels::sumAbs(x.data(), size); });
+    timeReduction("maxAbs", repetitions, [&]() { return VectorKernels::maxAbs(x.data(), size); });
+  }
+  return 0;
+}
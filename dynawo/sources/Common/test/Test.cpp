@@ -27,6 +27,7 @@
 #include "DYNError.h"
 #include "DYNError_keys.h"
 #include "DYNTrace.h"
+#include "DYNTraceAsynchronousBackend.h"
 #include "DYNSparseMatrix.h"
 #include "DYNEnumUtils.h"
 #include "DYNTimer.h"
@@ -304,6 +305,100 @@ TEST(CommonTest, testTrace) {
     ASSERT_EQ(boost::filesystem::remove(fspath), true);
 }
 
+TEST(CommonTest, testTraceAsynchronous) {
+  Trace::init();
+
+  Trace::TraceAppender app;
+  app.setTag("MyAsynchronousTag");
+  app.setFilePath("res/myAsynchronousLogFile.log");
+  app.setLvlFilter(INFO);
+  app.setShowLevelTag(true);
+  app.setSeparator(" | ");
+  app.setAsynchronous(true);
+  ASSERT_TRUE(app.isAsynchronous());
+  std::vector<Trace::TraceAppender> appenders;
+  appenders.push_back(app);
+  Trace::clearAndAddAppenders(appenders);
+
+  // more messages than the buffer of the appender, so that the logging thread waits for the writer thread
+  const unsigned nbMessages = AsynchronousFileBackend::DEFAULT_CAPACITY + 100;
+  for (unsigned i = 0; i < nbMessages; ++i)
+    Trace::info("MyAsynchronousTag") << " MyInfoMessage" << i << Trace::endline;
+  Trace::debug("MyAsynchronousTag") << " MyDebugMessage" << Trace::endline;  // Filtered
+
+  // The queued logs are written when the appenders are reset
+  Trace::resetCustomAppenders();
+
+  std::string line;
+  std::ifstream myfile("res/myAsynchronousLogFile.log");
+  ASSERT_TRUE(myfile.is_open());
+  unsigned index = 0;
+  while (std::getline(myfile, line)) {
+    ASSERT_EQ(line, "INFO |  MyInfoMessage" + std::to_string(index));
+    ++index;
+  }
+  ASSERT_EQ(index, nbMessages);
+  myfile.close();
+  boost::filesystem::path fspath("res/myAsynchronousLogFile.log");
+  ASSERT_EQ(boost::filesystem::remove(fspath), true);
+}
+
+static unsigned nbEvaluations = 0;  ///< number of evaluations of the log argument below
+
+/**
+ * @brief log argument counting its evaluations
+ * @return argument to log
+ */
+static std::string
+countedArgument() {
+  ++nbEvaluations;
+  return "MyCountedMessage";
+}
+
+TEST(CommonTest, testTraceIf) {
+  Trace::init();
+
+  Trace::TraceAppender app;
+  app.setTag("MyFilteredTag");
+  app.setFilePath("res/myFilteredLogFile.log");
+  app.setLvlFilter(INFO);
+  std::vector<Trace::TraceAppender> appenders;
+  appenders.push_back(app);
+  Trace::clearAndAddAppenders(appenders);
+
+  ASSERT_FALSE(Trace::logExists("MyFilteredTag", DEBUG));
+  ASSERT_TRUE(Trace::logExists("MyFilteredTag", INFO));
+  ASSERT_TRUE(Trace::isLogEnabled("MyFilteredTag", ERROR));
+  ASSERT_EQ(Trace::isLogEnabled("MyFilteredTag", DEBUG), Trace::standardLogExists(DEBUG));
+
+  // the arguments of a filtered log are not evaluated, the debug logs being exported by the standard output in debug mode
+  unsigned nbExpectedEvaluations = Trace::standardLogExists(DEBUG) ? 1 : 0;
+  DYNTraceIf(DEBUG, "MyFilteredTag") << countedArgument() << Trace::endline;
+  ASSERT_EQ(nbEvaluations, nbExpectedEvaluations);
+  DYNTraceIf(WARN, "MyFilteredTag") << countedArgument() << Trace::endline;
+  ASSERT_EQ(nbEvaluations, ++nbExpectedEvaluations);
+
+  // the cached answer follows the configuration of the appenders
+  Trace::resetCustomAppenders();
+  ASSERT_FALSE(Trace::logExists("MyFilteredTag", WARN));
+  app.setLvlFilter(DEBUG);
+  appenders.assign(1, app);
+  Trace::clearAndAddAppenders(appenders);
+  ASSERT_TRUE(Trace::logExists("MyFilteredTag", DEBUG));
+  DYNTraceIf(DEBUG, "MyFilteredTag") << countedArgument() << Trace::endline;
+  ASSERT_EQ(nbEvaluations, ++nbExpectedEvaluations);
+  Trace::resetCustomAppenders();
+
+  std::string line;
+  std::ifstream myfile("res/myFilteredLogFile.log");
+  ASSERT_TRUE(myfile.is_open());
+  ASSERT_TRUE(std::getline(myfile, line));
+  ASSERT_EQ(line, "MyCountedMessage");
+  ASSERT_FALSE(std::getline(myfile, line));
+  myfile.close();
+  boost::filesystem::path fspath("res/myFilteredLogFile.log");
+  ASSERT_EQ(boost::filesystem::remove(fspath), true);
+}
 
 TEST(CommonTest, testSparseMatrix) {
   // withoutNan
@@ -417,6 +512,35 @@ TEST(CommonTest, testSparseMatrix) {
   ASSERT_EQ(M.Ax_[0], 1);
   ASSERT_EQ(M.Ax_[1], 4);
 
+  // extract
+  SparseMatrix::Extraction extraction;
+  extraction.setErased(rows, columns, 3, 3);
+  SparseMatrix M2;
+  smj3.extract(extraction, M2);
+  ASSERT_EQ(M2.nbCol(), 2);
+  ASSERT_EQ(M2.nbElem(), 2);
+  ASSERT_EQ(M2.Ap_[1], 1);
+  ASSERT_EQ(M2.Ap_[2], 2);
+  ASSERT_EQ(M2.Ai_[0], 0);
+  ASSERT_EQ(M2.Ai_[1], 0);
+  ASSERT_EQ(M2.Ax_[0], 1);
+  ASSERT_EQ(M2.Ax_[1], 4);
+  ASSERT_EQ(M2.structureHash(), M.structureHash());
+  // same structure: the kept values are gathered
+  for (int ind = 0; ind < smj3.nbElem(); ++ind) {
+    if (smj3.Ax_[ind] > 3.)
+      smj3.Ax_[ind] = 5.;
+  }
+  smj3.extract(extraction, M2);
+  ASSERT_EQ(M2.nbElem(), 2);
+  ASSERT_EQ(M2.Ax_[0], 1);
+  ASSERT_EQ(M2.Ax_[1], 5);
+  // the extracted matrix was modified: the positions are computed again
+  M2.init(2, 2);
+  smj3.extract(extraction, M2);
+  ASSERT_EQ(M2.nbElem(), 2);
+  ASSERT_EQ(M2.Ax_[1], 5);
+
   // reserve
   smj3.reserve(2);
   ASSERT_EQ(smj3.nbCol(), 0);
@@ -498,6 +622,178 @@ TEST(CommonTest, testSparseMatrix) {
   check_status = mat.check();
   ASSERT_EQ(SparseMatrix::CHECK_ZERO_ROW, check_status.code);
   ASSERT_EQ(1, check_status.info);
+
+  // appendColumns
+  SparseMatrix full;
+  full.init(2000, 4);
+  full.changeCol();
+  full.addTerm(0, 1.);
+  full.addTerm(1, 2.);
+  SparseMatrix block;
+  block.init(2000, 3);
+  block.changeCol();
+  block.addTerm(2, 3.);
+  block.changeCol();
+  block.changeCol();
+  for (unsigned i = 0; i < 2000; ++i)
+    block.addTerm(i, 1.);
+  full.appendColumns(block);
+  ASSERT_EQ(full.nbElem(), 2003);
+  ASSERT_EQ(full.Ap_[0], 0);
+  ASSERT_EQ(full.Ap_[1], 2);
+  ASSERT_EQ(full.Ap_[2], 3);
+  ASSERT_EQ(full.Ap_[3], 3);
+  ASSERT_EQ(full.Ap_[4], 2003);
+  ASSERT_EQ(full.Ai_[2], 2);
+  ASSERT_EQ(full.Ax_[2], 3.);
+  ASSERT_EQ(full.Ai_[2002], 1999);
+  ASSERT_EQ(full.withoutNan(), true);
+  block.init(2000, 1);
+  block.changeCol();
+  block.addTerm(0, nan(""));
+  full.init(2000, 1);
+  full.appendColumns(block);
+  ASSERT_EQ(full.nbElem(), 1);
+  ASSERT_EQ(full.withoutNan(), false);
+
+  // structureHash
+  SparseMatrix h1;
+  h1.init(3, 3);
+  const uint64_t emptyHash = h1.structureHash();
+  h1.changeCol();
+  h1.addTerm(0, 1.);
+  h1.changeCol();
+  h1.addTerm(1, 2.);
+  h1.addTerm(2, 3.);
+  h1.changeCol();
+  SparseMatrix h2;
+  h2.init(3, 3);
+  h2.changeCol();
+  h2.addTerm(0, 4.);
+  h2.changeCol();
+  h2.addTerm(1, 5.);
+  h2.addTerm(2, 6.);
+  h2.changeCol();
+  ASSERT_NE(h1.structureHash(), emptyHash);
+  ASSERT_EQ(h1.structureHash(), h2.structureHash());
+  // same rows but different columns
+  h2.init(3, 3);
+  h2.changeCol();
+  h2.addTerm(0, 4.);
+  h2.addTerm(1, 5.);
+  h2.changeCol();
+  h2.addTerm(2, 6.);
+  h2.changeCol();
+  ASSERT_NE(h1.structureHash(), h2.structureHash());
+  // same structure built by blocks
+  h2.init(3, 3);
+  h2.changeCol();
+  h2.addTerm(0, 4.);
+  SparseMatrix h3;
+  h3.init(3, 2);
+  h3.changeCol();
+  h3.addTerm(1, 5.);
+  h3.addTerm(2, 6.);
+  h3.changeCol();
+  h2.appendColumns(h3);
+  ASSERT_EQ(h1.structureHash(), h2.structureHash());
+  h1.init(3, 3);
+  ASSERT_EQ(h1.structureHash(), emptyHash);
+
+  // structureVersion
+  SparseMatrix v;
+  v.init(3, 3);
+  v.changeCol();
+  v.addTerm(0, 1.);
+  v.changeCol();
+  v.addTerm(1, 2.);
+  v.addTerm(2, 3.);
+  v.changeCol();
+  v.addTerm(2, 4.);
+  const uint64_t version = v.structureVersion();
+  // same structure, other values
+  v.init(3, 3);
+  v.changeCol();
+  v.addTerm(0, 5.);
+  v.changeCol();
+  v.addTerm(1, 6.);
+  v.addTerm(2, 7.);
+  v.changeCol();
+  v.addTerm(2, 8.);
+  ASSERT_EQ(v.structureVersion(), version);
+  // same row indexes but other column boundaries
+  v.init(3, 3);
+  v.changeCol();
+  v.addTerm(0, 5.);
+  v.addTerm(1, 6.);
+  v.changeCol();
+  v.addTerm(2, 7.);
+  v.changeCol();
+  v.addTerm(2, 8.);
+  const uint64_t otherColumnsVersion = v.structureVersion();
+  ASSERT_NE(otherColumnsVersion, version);
+  // the version is compared with the previous filling only
+  v.init(3, 3);
+  v.changeCol();
+  v.addTerm(0, 5.);
+  v.changeCol();
+  v.addTerm(1, 6.);
+  v.addTerm(2, 7.);
+  v.changeCol();
+  v.addTerm(2, 8.);
+  ASSERT_NE(v.structureVersion(), version);
+  ASSERT_NE(v.structureVersion(), otherColumnsVersion);
+  const uint64_t sameAsFirstVersion = v.structureVersion();
+  // fewer terms in the last column
+  v.init(3, 3);
+  v.changeCol();
+  v.addTerm(0, 5.);
+  v.changeCol();
+  v.addTerm(1, 6.);
+  v.addTerm(2, 7.);
+  v.changeCol();
+  ASSERT_NE(v.structureVersion(), sameAsFirstVersion);
+  // same structure built by blocks
+  const uint64_t fewerTermsVersion = v.structureVersion();
+  v.init(3, 3);
+  v.changeCol();
+  v.addTerm(0, 5.);
+  SparseMatrix vBlock;
+  vBlock.init(3, 2);
+  vBlock.changeCol();
+  vBlock.addTerm(1, 6.);
+  vBlock.addTerm(2, 7.);
+  vBlock.changeCol();
+  v.appendColumns(vBlock);
+  ASSERT_EQ(v.structureVersion(), fewerTermsVersion);
+  // the versions of different matrices differ
+  ASSERT_NE(vBlock.structureVersion(), v.structureVersion());
+
+  // memory is kept from one filling to the next
+  SparseMatrix reused;
+  reused.init(3000, 1);
+  reused.changeCol();
+  for (int i = 0; i < 3000; ++i)
+    reused.addTerm(i, 1.);
+  const double* values = reused.Ax_.data();
+  reused.init(2, 2);
+  reused.changeCol();
+  reused.addTerm(0, 1.);
+  reused.changeCol();
+  reused.addTerm(0, 2.);
+  ASSERT_EQ(reused.nbElem(), 2);
+  ASSERT_EQ(reused.Ax_.data(), values);
+  // the rows stored by the previous filling are not taken into account
+  ASSERT_EQ(reused.check().code, SparseMatrix::CHECK_ZERO_ROW);
+  ASSERT_EQ(reused.check().info, 1u);
+  reused.clearKeepCapacity();
+  ASSERT_EQ(reused.nbElem(), 0);
+  ASSERT_EQ(reused.structureHash(), emptyHash);
+  reused.init(3000, 1);
+  reused.changeCol();
+  for (int i = 0; i < 3000; ++i)
+    reused.addTerm(i, 1.);
+  ASSERT_EQ(reused.Ax_.data(), values);
 }
 
 
@@ -0,0 +1,75 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+#include <stdexcept>
+#include <vector>
+
+#include "gtest_dynawo.h"
+#include "DYNBackgroundCheck.h"
+
+namespace DYN {
+
+TEST(BackgroundCheckTest, testSubmitAndWait) {
+  std::vector<double> checkedTimes;
+  BackgroundCheck check([&checkedTimes](double t) {
+    checkedTimes.push_back(t);
+    return t < 3.;
+  });
+  ASSERT_FALSE(check.isPending());
+  // nothing to collect
+  ASSERT_TRUE(check.wait());
+
+  for (int i = 0; i < 5; ++i) {
+    check.submit(i);
+    ASSERT_TRUE(check.isPending());
+    ASSERT_EQ(check.getTime(), i);
+    ASSERT_EQ(check.wait(), i < 3);
+    ASSERT_FALSE(check.isPending());
+    ASSERT_TRUE(check.isDone());
+  }
+  ASSERT_EQ(checkedTimes.size(), 5);
+  for (unsigned i = 0; i < checkedTimes.size(); ++i)
+    ASSERT_EQ(checkedTimes[i], i);
+}
+
+TEST(BackgroundCheckTest, testException) {
+  BackgroundCheck check([](double t) -> bool {
+    if (t > 1.)
+      throw std::runtime_error("check failed");
+    return true;
+  });
+  check.submit(2.);
+  try {
+    check.wait();
+    FAIL() << "an exception should have been thrown";
+  } catch (const std::runtime_error& e) {
+    ASSERT_EQ(std::string(e.what()), "check failed");
+  }
+  // the worker is still usable after an exception
+  check.submit(0.);
+  ASSERT_TRUE(check.wait());
+}
+
+TEST(BackgroundCheckTest, testPendingCheckAtDestruction) {
+  bool checked = false;
+  {
+    BackgroundCheck check([&checked](double) {
+      checked = true;
+      return true;
+    });
+    check.submit(0.);
+  }
+  ASSERT_TRUE(checked);
+}
+
+}  // namespace DYN
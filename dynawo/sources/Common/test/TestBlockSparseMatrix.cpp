@@ -0,0 +1,107 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+#include <vector>
+
+#include "gtest_dynawo.h"
+#include "DYNCommon.h"
+#include "DYNBlockSparseMatrix.h"
+#include "DYNSparseMatrix.h"
+
+namespace DYN {
+
+TEST(BlockSparseMatrixTest, testBlockSparseMatrix) {
+  // blocks {0, 1, 2} full, {3, 4} diagonal and {5}, coupled by a few terms, with sorted rows in each column
+  SparseMatrix M;
+  M.init(6, 6);
+  M.changeCol();
+  M.addTerm(0, 4.);
+  M.addTerm(1, 1.);
+  M.addTerm(2, 2.);
+  M.addTerm(4, -1.);
+  M.changeCol();
+  M.addTerm(0, 1.);
+  M.addTerm(1, 5.);
+  M.addTerm(2, 1.);
+  M.changeCol();
+  M.addTerm(0, 3.);
+  M.addTerm(1, 2.);
+  M.addTerm(2, 6.);
+  M.addTerm(5, 1.);
+  M.changeCol();
+  M.addTerm(1, -2.);
+  M.addTerm(3, 7.);
+  M.changeCol();
+  M.addTerm(4, 8.);
+  M.changeCol();
+  M.addTerm(2, 1.);
+  M.addTerm(5, 9.);
+
+  BlockSparseMatrix blockMatrix;
+  std::vector<int> blockStarts;
+  blockStarts.push_back(0);
+  blockStarts.push_back(3);
+  blockStarts.push_back(5);
+  blockMatrix.build(M, blockStarts, 0.75);
+  ASSERT_EQ(blockMatrix.nbRow(), 6);
+  ASSERT_EQ(blockMatrix.nbCol(), 6);
+  ASSERT_EQ(blockMatrix.nbDenseBlocks(), 1U);
+  ASSERT_EQ(blockMatrix.denseBlockStart(0), 0);
+  ASSERT_EQ(blockMatrix.denseBlockSize(0), 3);
+  const double dense[] = {4., 1., 2., 1., 5., 1., 3., 2., 6.};
+  for (unsigned i = 0; i < 9; ++i)
+    ASSERT_DOUBLE_EQUALS_DYNAWO(blockMatrix.denseBlockValues(0)[i], dense[i]);
+  ASSERT_EQ(blockMatrix.sparsePart().nbElem(), M.nbElem() - 9);
+  ASSERT_LT(blockMatrix.getIndexMemoryUsage(), (M.nbCol() + 1 + M.nbElem()) * sizeof(unsigned));
+
+  // same terms in the same order once converted back
+  SparseMatrix converted;
+  blockMatrix.toSparseMatrix(converted);
+  ASSERT_EQ(converted.nbElem(), M.nbElem());
+  ASSERT_EQ(converted.structureHash(), M.structureHash());
+  for (int col = 0; col <= M.nbCol(); ++col)
+    ASSERT_EQ(converted.Ap_[col], M.Ap_[col]);
+  for (int ind = 0; ind < M.nbElem(); ++ind) {
+    ASSERT_EQ(converted.Ai_[ind], M.Ai_[ind]);
+    ASSERT_DOUBLE_EQUALS_DYNAWO(converted.Ax_[ind], M.Ax_[ind]);
+  }
+
+  std::vector<double> x;
+  for (int i = 0; i < 6; ++i)
+    x.push_back(1. + i);
+  std::vector<double> y;
+  blockMatrix.multiply(x, y);
+  std::vector<double> expected(6, 0.);
+  for (int col = 0; col < M.nbCol(); ++col) {
+    for (unsigned ind = M.Ap_[col]; ind < M.Ap_[col + 1]; ++ind)
+      expected[M.Ai_[ind]] += M.Ax_[ind] * x[col];
+  }
+  ASSERT_EQ(y.size(), 6U);
+  for (int i = 0; i < 6; ++i)
+    ASSERT_DOUBLE_EQUALS_DYNAWO(y[i], expected[i]);
+
+  // below the density threshold, every term stays sparse
+  blockMatrix.build(M, blockStarts, 1.1);
+  ASSERT_EQ(blockMatrix.nbDenseBlocks(), 0U);
+  ASSERT_EQ(blockMatrix.sparsePart().nbElem(), M.nbElem());
+  blockMatrix.toSparseMatrix(converted);
+  ASSERT_EQ(converted.structureHash(), M.structureHash());
+
+  SparseMatrix empty;
+  blockMatrix.build(empty, blockStarts, 0.75);
+  ASSERT_EQ(blockMatrix.nbRow(), 0);
+  ASSERT_EQ(blockMatrix.nbDenseBlocks(), 0U);
+  ASSERT_EQ(blockMatrix.getIndexMemoryUsage(), 0U);
+}
+
+}  // namespace DYN
@@ -0,0 +1,88 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+#include <cstdint>
+#include <vector>
+
+#include "gtest_dynawo.h"
+#include "DYNBufferArena.h"
+#include "DYNHugePages.h"
+
+namespace DYN {
+
+TEST(BufferArenaTest, testReserveAllocate) {
+  BufferArena arena;
+  ASSERT_EQ(arena.size(), 0);
+  const std::size_t offsetDoubles = arena.reserve<double>(3);
+  const std::size_t offsetBools = arena.reserve<bool>(5);
+  const std::size_t offsetEmpty = arena.reserve<int>(0);
+  const std::size_t offsetInts = arena.reserve<int>(20);
+  ASSERT_EQ(offsetDoubles, 0);
+  ASSERT_EQ(offsetBools, BufferArena::alignment);
+  ASSERT_EQ(offsetEmpty, 2 * BufferArena::alignment);
+  ASSERT_EQ(offsetInts, 2 * BufferArena::alignment);
+  ASSERT_EQ(arena.size(), 4 * BufferArena::alignment);
+
+  arena.allocate();
+  double* doubles = arena.get<double>(offsetDoubles);
+  bool* bools = arena.get<bool>(offsetBools);
+  int* ints = arena.get<int>(offsetInts);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(doubles) % BufferArena::alignment, 0);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(bools) % BufferArena::alignment, 0);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ints) % BufferArena::alignment, 0);
+  for (unsigned i = 0; i < 3; ++i)
+    ASSERT_DOUBLE_EQ(doubles[i], 0.);
+  for (unsigned i = 0; i < 5; ++i)
+    ASSERT_FALSE(bools[i]);
+
+  // writing an array does not modify the others
+  for (unsigned i = 0; i < 20; ++i)
+    ints[i] = -1;
+  for (unsigned i = 0; i < 3; ++i)
+    doubles[i] = 1.;
+  for (unsigned i = 0; i < 5; ++i)
+    ASSERT_FALSE(bools[i]);
+  ASSERT_EQ(ints[0], -1);
+
+  arena.clear();
+  ASSERT_EQ(arena.size(), 0);
+}
+
+TEST(BufferArenaTest, testHugePages) {
+  HugePages::setEnabled(true);
+  BufferArena arena;
+  const std::size_t offsetSmall = arena.reserve<double>(3);
+  const std::size_t offsetLarge = arena.reserve<double>(HugePages::pageSize);
+  arena.allocate();
+  // the block is aligned and zeroed whether huge pages are available or not
+  double* small = arena.get<double>(offsetSmall);
+  double* large = arena.get<double>(offsetLarge);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(small) % BufferArena::alignment, 0);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(large) % BufferArena::alignment, 0);
+  ASSERT_DOUBLE_EQ(small[0], 0.);
+  ASSERT_DOUBLE_EQ(large[HugePages::pageSize - 1], 0.);
+  large[HugePages::pageSize - 1] = 1.;
+  ASSERT_DOUBLE_EQ(small[2], 0.);
+
+  arena.allocate();
+  ASSERT_DOUBLE_EQ(arena.get<double>(offsetLarge)[HugePages::pageSize - 1], 0.);
+  arena.clear();
+  ASSERT_EQ(arena.size(), 0);
+
+  std::vector<double> values(HugePages::pageSize, 1.);
+  HugePages::advise(values.data(), values.size() * sizeof(double));
+  ASSERT_DOUBLE_EQ(values.back(), 1.);
+  HugePages::setEnabled(false);
+}
+
+}  // namespace DYN
@@ -0,0 +1,113 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+
+#include "gtest_dynawo.h"
+#include "DYNError.h"
+#include "DYNFileSystemUtils.h"
+#include "DYNCompressedStateDumpFile.h"
+#include "DYNStateDumpFile.h"
+
+namespace DYN {
+
+TEST(CompressedStateDumpFileTest, testWriteRead) {
+  const std::string fileName = "compressedStateDumpFile.dmp";
+  std::map<std::string, std::string> entries;
+  entries["time.bin"] = std::string("\0\1\2", 3);
+  entries["empty.bin"] = "";
+  // entries large enough to fill several blocks
+  for (unsigned i = 0; i < 5; ++i) {
+    std::string data(CompressedStateDumpFile::blockSize / 2 + i, '\0');
+    for (std::size_t j = 0; j < data.size(); ++j)
+      data[j] = static_cast<char>((j * (i + 7)) % 251);
+    entries["model" + std::to_string(i) + ".bin"] = data;
+  }
+  CompressedStateDumpFile::write(fileName, entries, 3);
+  ASSERT_TRUE(CompressedStateDumpFile::isCompressedStateDumpFile(fileName));
+  ASSERT_FALSE(StateDumpFile::isStateDumpFile(fileName));
+
+  std::map<std::string, std::string> entriesRead;
+  entriesRead["other.bin"] = "kept";
+  CompressedStateDumpFile::read(fileName, entriesRead, 4);
+  ASSERT_EQ(entriesRead.size(), entries.size() + 1);
+  entriesRead.erase("other.bin");
+  ASSERT_EQ(entriesRead, entries);
+
+  // the result does not depend on the number of threads
+  entriesRead.clear();
+  CompressedStateDumpFile::read(fileName, entriesRead, 1);
+  ASSERT_EQ(entriesRead, entries);
+
+  std::string data;
+  ASSERT_TRUE(CompressedStateDumpFile::readEntry(fileName, "model3.bin", data));
+  ASSERT_EQ(data, entries["model3.bin"]);
+  ASSERT_TRUE(CompressedStateDumpFile::readEntry(fileName, "time.bin", data));
+  ASSERT_EQ(data, entries["time.bin"]);
+  ASSERT_FALSE(CompressedStateDumpFile::readEntry(fileName, "missing.bin", data));
+
+  // truncated file
+  {
+    std::ifstream original(fileName.c_str(), std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(original)), std::istreambuf_iterator<char>());
+    std::ofstream stream("compressedStateDumpFileTruncated.dmp", std::ios::binary);
+    stream << content.substr(0, content.size() / 2);
+  }
+  ASSERT_TRUE(CompressedStateDumpFile::isCompressedStateDumpFile("compressedStateDumpFileTruncated.dmp"));
+  ASSERT_THROW_DYNAWO(CompressedStateDumpFile::read("compressedStateDumpFileTruncated.dmp", entriesRead, 2), Error::GENERAL,
+      KeyError_t::StateDumpCorrupted);
+
+  // corrupted block
+  {
+    std::fstream stream(fileName.c_str(), std::ios::binary | std::ios::in | std::ios::out);
+    stream.seekp(100);
+    stream.write("corrupted", 9);
+  }
+  ASSERT_THROW_DYNAWO(CompressedStateDumpFile::read(fileName, entriesRead, 2), Error::GENERAL, KeyError_t::StateDumpCorrupted);
+
+  remove(fileName);
+  remove("compressedStateDumpFileTruncated.dmp");
+}
+
+TEST(CompressedStateDumpFileTest, testEmptyAndOtherFormats) {
+  const std::string fileName = "compressedStateDumpFileEmpty.dmp";
+  std::map<std::string, std::string> entries;
+  CompressedStateDumpFile::write(fileName, entries, 2);
+  CompressedStateDumpFile::read(fileName, entries, 2);
+  ASSERT_TRUE(entries.empty());
+
+  {
+    std::ofstream stream(fileName.c_str(), std::ios::binary | std::ios::trunc);
+    stream << "PK\3\4 a zip archive";
+  }
+  ASSERT_FALSE(CompressedStateDumpFile::isCompressedStateDumpFile(fileName));
+  ASSERT_FALSE(CompressedStateDumpFile::isCompressedStateDumpFile("compressedStateDumpFileMissing.dmp"));
+
+  // file written by a more recent version of the format
+  {
+    std::ofstream stream(fileName.c_str(), std::ios::binary | std::ios::trunc);
+    const std::uint32_t version = CompressedStateDumpFile::version + 1;
+    const std::uint32_t reserved = 0;
+    stream << "DYNSTATZ";
+    stream.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    stream.write(reinterpret_cast<const char*>(&reserved), sizeof(reserved));
+  }
+  ASSERT_THROW_DYNAWO(CompressedStateDumpFile::read(fileName, entries, 2), Error::GENERAL, KeyError_t::StateDumpVersionUnsupported);
+  remove(fileName);
+}
+
+}  // namespace DYN
@@ -188,6 +188,46 @@ TEST(CommonTest, testComponentGraph) {
   ASSERT_NE(verticesComponent[0], verticesComponent[9]);
 }
 
+TEST(CommonTest, testEdgeIndexGraph) {
+  Graph graph = defineGraph();
+  graph.addVertex(10);
+  ASSERT_EQ(graph.getNbEdges(), 13);
+  ASSERT_EQ(graph.getEdgeIndex("0-1"), 0);
+  ASSERT_EQ(graph.getEdgeIndex("8-9"), 12);
+  ASSERT_THROW_DYNAWO(graph.getEdgeIndex("0-9"), DYN::Error::GENERAL, DYN::KeyError_t::UnknownEdge);
+  ASSERT_EQ(graph.addEdge(9, 10, "9-10"), 13);
+
+  // the edges are filtered until a weight is given
+  ASSERT_EQ(graph.pathExist(1, 5), false);
+  ASSERT_EQ(graph.calculateComponents().first, 11);
+  for (unsigned int i = 0; i < graph.getNbEdges(); ++i)
+    graph.setEdgeWeight(i, 1);
+  ASSERT_EQ(graph.pathExist(1, 10), true);
+  ASSERT_EQ(graph.calculateComponents().first, 1);
+
+  // open 3-5, 4-5 and 8-9: the components are numbered in the order of the vertices
+  graph.setEdgeWeight(graph.getEdgeIndex("3-5"), 0);
+  graph.setEdgeWeight(graph.getEdgeIndex("4-5"), 0);
+  graph.setEdgeWeight(graph.getEdgeIndex("8-9"), 0);
+  ASSERT_EQ(graph.pathExist(1, 10), false);
+  ASSERT_EQ(graph.pathExist(10, 5), true);
+  std::pair<unsigned int, std::vector<unsigned int> > components = graph.calculateComponents();
+  ASSERT_EQ(components.first, 2);
+  for (unsigned int i = 0; i < 11; ++i)
+    ASSERT_EQ(components.second[i], (i == 5 || i == 9 || i == 10) ? 1 : 0);
+
+  // the weights given by id are kept, and used by the shortest paths
+  std::unordered_map<string, float> weights;
+  weights["3-5"] = 1;
+  ASSERT_EQ(graph.calculateComponents(weights).first, 1);
+  ASSERT_EQ(graph.pathExist(1, 10), true);
+  vector<string> path;
+  graph.shortestPath(0, 10, weights, path);
+  ASSERT_EQ(path.size(), 4);
+  ASSERT_EQ(path[0], "0-3");
+  ASSERT_EQ(path[3], "9-10");
+}
+
 /*
  *          6
  *          |
@@ -239,4 +279,35 @@ TEST(CommonTest, testGraphWithLoop) {
   ASSERT_EQ(path[1], "0-1");
   ASSERT_EQ(path[2], "6-0");
 }
+
+TEST(CommonTest, testShortestPathsGraph) {
+  Graph graph = defineGraph();
+  graph.addVertex(10);
+  // parallel edge created after 0-3: 0-3 is still used
+  graph.addEdge(0, 3, "0-3bis");
+  std::unordered_map<string, float> weights = defineWeights();
+  weights["0-3bis"] = 1;
+
+  vector<unsigned> extremities = {5, 0, 10, 9, 3, 12};
+  vector<vector<string> > paths;
+  graph.shortestPaths(0, extremities, weights, paths);
+  ASSERT_EQ(paths.size(), extremities.size());
+  for (unsigned int i = 0; i < extremities.size(); ++i) {
+    vector<string> path;
+    graph.shortestPath(0, extremities[i], weights, path);
+    ASSERT_EQ(paths[i], path);
+  }
+  ASSERT_EQ(paths[0].size(), 2);
+  ASSERT_EQ(paths[0][0], "0-3");
+  ASSERT_EQ(paths[0][1], "3-5");
+  ASSERT_TRUE(paths[1].empty());
+  ASSERT_TRUE(paths[2].empty());
+  ASSERT_TRUE(paths[5].empty());
+
+  // the first edge between 0 and 3 is opened: the parallel one is used
+  weights["0-3"] = 0;
+  graph.shortestPaths(0, extremities, weights, paths);
+  ASSERT_EQ(paths[4].size(), 1);
+  ASSERT_EQ(paths[4][0], "0-3bis");
+}
 }  // namespace DYN
@@ -17,12 +17,16 @@
  *
  */
 
+#include <sstream>
+#include <vector>
+
 #include "gtest_dynawo.h"
 #include "make_unique.hpp"
 
 #include "DYNIoDico.h"
 #include "DYNMessage.h"
 #include "DYNMessageTimeline.h"
+#include "DYNMessageTemplate.h"
 #include "DYNMacrosMessage.h"
 #include "DYNTerminate.h"
 
@@ -69,6 +73,23 @@ TEST(CommonIoDicoTest, testCommonIoDicosTest) {
   Message mess2(mess);
   ASSERT_EQ(mess2.str(), "My Second Entry 4");
 
+  ASSERT_TRUE(dico->find("MyFifthEntry")->isPrecompiled());
+  ASSERT_FALSE(dico->find("MySecondEntry")->isPrecompiled());
+  ASSERT_TRUE(dico->find("MyDummyEntry") == NULL);
+  ASSERT_TRUE(IoDicos::findIoDico("MyIoDico") == dico.get());
+  ASSERT_TRUE(IoDicos::findIoDico("MyDummyDico") == NULL);
+  Message mess3("MyIoDico", "MyFifthEntry");
+  ASSERT_EQ(mess3.str(), "");
+  mess3, std::string("GEN1"), 2.5;
+  ASSERT_THROW((mess3, "extra"), boost::io::too_many_args);
+  ASSERT_EQ(mess3.str(), "Entry 2.5 of GEN1 (100%), after GEN1");
+  std::stringstream ss;
+  ss << Message(mess3);
+  ASSERT_EQ(ss.str(), "Entry 2.5 of GEN1 (100%), after GEN1");
+  Message mess4("MyDummyDico", "MyKey");
+  mess4, 1, "two";
+  ASSERT_EQ(mess4.str(), "MyKey 1 two");
+
   ASSERT_NO_THROW(dicos.addDico("TIMELINE", "TIMELINE", ""));
   ASSERT_NO_THROW(dicos.addDico("TIMELINE_PRIORITY", "TIMELINE_PRIORITY", ""));
   MessageTimeline tmess0("MyEntry");
@@ -99,6 +120,32 @@ TEST(CommonIoDicoTest, testCommonIoDicosTest) {
   ASSERT_EQ(std::string(t2.what()), "My Second Entry 4");
 }
 
+TEST(CommonIoDicoTest, testMessageTemplate) {
+  const MessageTemplate text("No argument, 100%%");
+  ASSERT_TRUE(text.isPrecompiled());
+  ASSERT_EQ(text.nbArguments(), 0);
+  std::string message;
+  text.format("", std::vector<std::size_t>(), message);
+  ASSERT_EQ(message, "No argument, 100%");
+
+  const MessageTemplate positional("%2%: %1% and %1%%2%");
+  ASSERT_TRUE(positional.isPrecompiled());
+  ASSERT_EQ(positional.nbArguments(), 2);
+  ASSERT_EQ(positional.description(), "%2%: %1% and %1%%2%");
+  std::vector<std::size_t> argumentsEnds;
+  argumentsEnds.push_back(3);
+  argumentsEnds.push_back(5);
+  message = ">";
+  positional.format("onetw", argumentsEnds, message);
+  ASSERT_EQ(message, ">tw: one and onetw");
+
+  ASSERT_FALSE(MessageTemplate("%u").isPrecompiled());
+  ASSERT_FALSE(MessageTemplate("%1$s").isPrecompiled());
+  ASSERT_FALSE(MessageTemplate("%0%").isPrecompiled());
+  ASSERT_FALSE(MessageTemplate("%1").isPrecompiled());
+  ASSERT_EQ(MessageTemplate("%u").nbArguments(), 0);
+}
+
 TEST(CommonIoDicoTest, testDuplicatedIoDicosTest) {
   IoDicos& dicos = IoDicos::instance();
   dicos.addPath("res2");
@@ -0,0 +1,62 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+#include <string>
+#include <vector>
+
+#include "gtest_dynawo.h"
+#include "DYNMemoryUsage.h"
+
+namespace DYN {
+
+TEST(MemoryUsageTest, testCategories) {
+  MemoryUsage usage;
+  ASSERT_EQ(usage.getTotal(), 0);
+  usage.add(MemoryUsage::SPARSE_MATRICES, 100);
+  usage.add(MemoryUsage::SPARSE_MATRICES, 20);
+  usage.add(MemoryUsage::CURVES, 8);
+  ASSERT_EQ(usage.get(MemoryUsage::SPARSE_MATRICES), 120);
+  ASSERT_EQ(usage.get(MemoryUsage::CURVES), 8);
+  ASSERT_EQ(usage.get(MemoryUsage::TIMELINE), 0);
+  ASSERT_EQ(usage.getTotal(), 128);
+}
+
+TEST(MemoryUsageTest, testShared) {
+  MemoryUsage usage;
+  const int object = 0;
+  const int otherObject = 0;
+  ASSERT_TRUE(usage.addShared(&object));
+  ASSERT_FALSE(usage.addShared(&object));
+  ASSERT_TRUE(usage.addShared(&otherObject));
+}
+
+TEST(MemoryUsageTest, testBytes) {
+  std::vector<double> values;
+  values.reserve(10);
+  ASSERT_EQ(MemoryUsage::bytes(values), 10 * sizeof(double));
+
+  ASSERT_EQ(MemoryUsage::bytes(std::string("short")), 0);
+  const std::string longString(100, 'a');
+  ASSERT_GE(MemoryUsage::bytes(longString), 101);
+
+  std::vector<std::string> strings(2, longString);
+  ASSERT_GE(MemoryUsage::bytes(strings), 2 * sizeof(std::string) + 2 * 101);
+}
+
+TEST(MemoryUsageTest, testCategoryNames) {
+  ASSERT_EQ(std::string(MemoryUsage::getCategoryName(MemoryUsage::LINEAR_SOLVER_FACTORS)), "linearSolverFactors");
+  ASSERT_EQ(std::string(MemoryUsage::getCategoryName(MemoryUsage::DELAY_BUFFERS)), "delayBuffers");
+  ASSERT_EQ(std::string(MemoryUsage::getCategoryName(MemoryUsage::NB_CATEGORIES)), "");
+}
+
+}  // namespace DYN
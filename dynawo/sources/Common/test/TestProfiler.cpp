@@ -0,0 +1,158 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest_dynawo.h"
+#include "DYNProfiler.h"
+
+namespace DYN {
+
+static std::uint64_t
+nbCalls(const std::vector<Profiler::Statistics>& statistics, const Profiler::Scope parent, const Profiler::Scope scope) {
+  for (const auto& scopeStatistics : statistics) {
+    if (scopeStatistics.parent == parent && scopeStatistics.scope == scope)
+      return scopeStatistics.nbCalls;
+  }
+  return 0;
+}
+
+TEST(ProfilerTest, testDisabled) {
+  Profiler::setSamplingPeriod(0);
+  Profiler::reset();
+  {
+    ProfilerScope scope(Profiler::SOLVER_STEP);
+    ProfilerScope nestedScope(Profiler::EVAL_F);
+  }
+  ASSERT_FALSE(Profiler::isEnabled());
+  ASSERT_TRUE(Profiler::getStatistics().empty());
+}
+
+TEST(ProfilerTest, testHierarchy) {
+  Profiler::setSamplingPeriod(1);
+  Profiler::reset();
+  {
+    ProfilerScope scope(Profiler::SOLVER_STEP);
+    for (int i = 0; i < 3; ++i) {
+      ProfilerScope evalScope(Profiler::EVAL_JT);
+      ProfilerScope factorizationScope(Profiler::FACTORIZATION);
+    }
+    ProfilerScope evalScope(Profiler::EVAL_F);
+  }
+  // the scopes of another thread are outermost scopes
+  std::thread thread([]() { ProfilerScope evalScope(Profiler::EVAL_JT); });
+  thread.join();
+
+  const std::vector<Profiler::Statistics> statistics = Profiler::getStatistics();
+  ASSERT_EQ(statistics.size(), 5);
+  ASSERT_EQ(nbCalls(statistics, Profiler::NB_SCOPES, Profiler::SOLVER_STEP), 1);
+  ASSERT_EQ(nbCalls(statistics, Profiler::SOLVER_STEP, Profiler::EVAL_JT), 3);
+  ASSERT_EQ(nbCalls(statistics, Profiler::EVAL_JT, Profiler::FACTORIZATION), 3);
+  ASSERT_EQ(nbCalls(statistics, Profiler::SOLVER_STEP, Profiler::EVAL_F), 1);
+  ASSERT_EQ(nbCalls(statistics, Profiler::NB_SCOPES, Profiler::EVAL_JT), 1);
+  for (const auto& scopeStatistics : statistics)
+    ASSERT_GE(scopeStatistics.time, 0.);
+  Profiler::setSamplingPeriod(0);
+}
+
+TEST(ProfilerTest, testSampling) {
+  Profiler::setSamplingPeriod(4);
+  Profiler::reset();
+  for (int i = 0; i < 8; ++i) {
+    ProfilerScope stepScope(Profiler::SOLVER_STEP);
+    ProfilerScope evalScope(Profiler::EVAL_G);
+  }
+  // two outermost scopes out of eight are measured with their nested scopes, then extrapolated
+  const std::vector<Profiler::Statistics> statistics = Profiler::getStatistics();
+  ASSERT_EQ(statistics.size(), 2);
+  ASSERT_EQ(nbCalls(statistics, Profiler::NB_SCOPES, Profiler::SOLVER_STEP), 8);
+  ASSERT_EQ(nbCalls(statistics, Profiler::SOLVER_STEP, Profiler::EVAL_G), 8);
+  Profiler::setSamplingPeriod(0);
+}
+
+static std::size_t
+nbOccurrences(const std::string& text, const std::string& pattern) {
+  std::size_t nbOccurrences = 0;
+  for (std::size_t position = text.find(pattern); position != std::string::npos; position = text.find(pattern, position + 1))
+    ++nbOccurrences;
+  return nbOccurrences;
+}
+
+TEST(ProfilerTest, testTrace) {
+  Profiler::setSamplingPeriod(2);
+  Profiler::setTraceEnabled(true);
+  Profiler::reset();
+  for (int i = 0; i < 4; ++i) {
+    ProfilerScope stepScope(Profiler::SOLVER_STEP);
+    ProfilerScope evalScope(Profiler::EVAL_F);
+  }
+  std::stringstream trace;
+  Profiler::exportTrace(trace);
+  const std::string traceString = trace.str();
+  ASSERT_EQ(traceString.find("{\"displayTimeUnit\": \"ms\", \"traceEvents\": ["), 0);
+  // only the sampled scopes are recorded
+  ASSERT_EQ(nbOccurrences(traceString, "\"name\": \"solverStep\", \"ph\": \"X\""), 2);
+  ASSERT_EQ(nbOccurrences(traceString, "\"name\": \"evalF\", \"ph\": \"X\""), 2);
+  ASSERT_EQ(nbOccurrences(traceString, "\"ph\": \"M\""), 1);
+
+  Profiler::reset();
+  std::stringstream emptyTrace;
+  Profiler::exportTrace(emptyTrace);
+  ASSERT_EQ(emptyTrace.str(), "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n]}\n");
+  Profiler::setTraceEnabled(false);
+  Profiler::setSamplingPeriod(0);
+}
+
+TEST(ProfilerTest, testHardwareCounters) {
+  Profiler::setSamplingPeriod(1);
+  Profiler::reset();
+  {
+    ProfilerScope scope(Profiler::EVAL_F);
+  }
+  // the counters are not read unless requested
+  std::vector<Profiler::Statistics> statistics = Profiler::getStatistics();
+  ASSERT_EQ(statistics.size(), 1);
+  for (unsigned counter = 0; counter < Profiler::NB_COUNTERS; ++counter)
+    ASSERT_EQ(statistics[0].counters[counter], 0);
+
+  Profiler::setHardwareCountersEnabled(true);
+  Profiler::reset();
+  volatile double sum = 0.;
+  {
+    ProfilerScope scope(Profiler::EVAL_F);
+    for (int i = 0; i < 100000; ++i)
+      sum = sum + i;
+  }
+  statistics = Profiler::getStatistics();
+  ASSERT_EQ(statistics.size(), 1);
+  // the counters may be forbidden in the test environment
+  if (Profiler::areHardwareCountersAvailable()) {
+    ASSERT_GT(statistics[0].counters[Profiler::INSTRUCTIONS], 0);
+  }
+  Profiler::setHardwareCountersEnabled(false);
+  Profiler::setSamplingPeriod(0);
+}
+
+TEST(ProfilerTest, testScopeNames) {
+  ASSERT_EQ(std::string(Profiler::getScopeName(Profiler::EVAL_JT)), "evalJt");
+  ASSERT_EQ(std::string(Profiler::getScopeName(Profiler::NETWORK)), "network");
+  ASSERT_EQ(std::string(Profiler::getScopeName(Profiler::FACTORIZATION)), "factorization");
+  ASSERT_EQ(std::string(Profiler::getScopeName(Profiler::NB_SCOPES)), "");
+  ASSERT_EQ(std::string(Profiler::getCounterName(Profiler::CACHE_MISSES)), "cacheMisses");
+  ASSERT_EQ(std::string(Profiler::getCounterName(Profiler::NB_COUNTERS)), "");
+}
+
+}  // namespace DYN
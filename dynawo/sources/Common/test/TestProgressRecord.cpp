@@ -0,0 +1,71 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+#include <string>
+
+#include "gtest_dynawo.h"
+#include "DYNProgressRecord.h"
+
+namespace DYN {
+
+#ifndef _WIN32
+TEST(ProgressRecordTest, testUpdateRead) {
+  const std::string name = "/dynawo-test-progress-record";
+  ProgressRecord::Progress progress;
+  {
+    ProgressRecord record(name);
+    ASSERT_TRUE(ProgressRecord::read(name, progress));
+    ASSERT_DOUBLE_EQ(progress.time, 0.);
+    ASSERT_EQ(progress.iteration, 0U);
+
+    ProgressRecord::Progress written = ProgressRecord::Progress();
+    written.time = 12.5;
+    written.stopTime = 100.;
+    written.wallTime = 0.25;
+    written.iteration = 40;
+    written.nbSteps = 42;
+    written.nbResidualEvaluations = 120;
+    written.nbNonLinearIterations = 80;
+    written.nbErrorTestFailures = 1;
+    written.nbConvergenceFailures = 2;
+    written.nbRootEvaluations = 50;
+    record.update(written);
+    ASSERT_TRUE(ProgressRecord::read(name, progress));
+    ASSERT_DOUBLE_EQ(progress.time, 12.5);
+    ASSERT_DOUBLE_EQ(progress.stopTime, 100.);
+    ASSERT_DOUBLE_EQ(progress.wallTime, 0.25);
+    ASSERT_EQ(progress.iteration, 40U);
+    ASSERT_EQ(progress.nbSteps, 42U);
+    ASSERT_EQ(progress.nbResidualEvaluations, 120U);
+    ASSERT_EQ(progress.nbNonLinearIterations, 80U);
+    ASSERT_EQ(progress.nbErrorTestFailures, 1U);
+    ASSERT_EQ(progress.nbConvergenceFailures, 2U);
+    ASSERT_EQ(progress.nbRootEvaluations, 50U);
+
+    // the record can still be updated once removed, but is no longer visible
+    record.remove();
+    ASSERT_FALSE(ProgressRecord::read(name, progress));
+    record.update(written);
+  }
+  ASSERT_FALSE(ProgressRecord::read(name, progress));
+
+  // the segment is removed by the destructor
+  {
+    ProgressRecord record(name);
+  }
+  ASSERT_FALSE(ProgressRecord::read(name, progress));
+  ASSERT_FALSE(ProgressRecord::read("/dynawo-test-progress-record-missing", progress));
+}
+#endif
+
+}  // namespace DYN
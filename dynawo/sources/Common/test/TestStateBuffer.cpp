@@ -0,0 +1,79 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+#include <string>
+#include <vector>
+
+#include "gtest_dynawo.h"
+#include "DYNBitMask.h"
+#include "DYNCommon.h"
+#include "DYNError.h"
+#include "DYNStateBuffer.h"
+
+namespace DYN {
+
+TEST(StateBufferTest, testWriteRead) {
+  StateBuffer buffer;
+  ASSERT_TRUE(buffer.empty());
+
+  BitMask mask;
+  mask.setFlags(0x05);
+  const std::vector<double> values = {1., -2.5, 3.e10};
+  const std::vector<int> noValue;
+  buffer.write(12.5);
+  buffer.write(mask);
+  buffer.write(values);
+  buffer.write(noValue);
+  buffer.write(std::string("state"));
+  ASSERT_FALSE(buffer.empty());
+
+  // the same buffer can be read several times
+  for (unsigned i = 0; i < 2; ++i) {
+    StateBuffer::Reader reader(buffer);
+    double value = 0.;
+    BitMask maskRead;
+    std::vector<double> valuesRead(3, 0.);
+    std::vector<int> noValueRead;
+    std::string stringRead;
+    reader.read(value);
+    reader.read(maskRead);
+    reader.read(valuesRead);
+    reader.read(noValueRead);
+    ASSERT_FALSE(reader.atEnd());
+    reader.read(stringRead);
+    ASSERT_TRUE(reader.atEnd());
+    ASSERT_DOUBLE_EQUALS_DYNAWO(value, 12.5);
+    ASSERT_TRUE(maskRead.getFlags(0x01));
+    ASSERT_FALSE(maskRead.getFlags(0x02));
+    ASSERT_TRUE(maskRead.getFlags(0x04));
+    ASSERT_EQ(valuesRead, values);
+    ASSERT_EQ(stringRead, "state");
+    ASSERT_THROW_DYNAWO(reader.read(value), Error::GENERAL, KeyError_t::StateSnapshotTruncated);
+  }
+
+  buffer.clear();
+  ASSERT_TRUE(buffer.empty());
+  ASSERT_EQ(buffer.size(), 0);
+}
+
+TEST(StateBufferTest, testMismatch) {
+  StateBuffer buffer;
+  const std::vector<double> values(4, 1.);
+  buffer.write(values);
+
+  StateBuffer::Reader reader(buffer);
+  std::vector<double> valuesRead(3, 0.);
+  ASSERT_THROW_DYNAWO(reader.read(valuesRead), Error::GENERAL, KeyError_t::StateSnapshotMismatch);
+}
+
+}  // namespace DYN
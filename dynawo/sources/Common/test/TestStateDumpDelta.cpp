@@ -0,0 +1,70 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+#include <string>
+
+#include "gtest_dynawo.h"
+#include "DYNError.h"
+#include "DYNStateDumpDelta.h"
+
+namespace DYN {
+
+TEST(StateDumpDeltaTest, testEncodeApply) {
+  const std::string previous(10 * StateDumpDelta::blockSize + 5, 'a');
+  std::string delta;
+  ASSERT_FALSE(StateDumpDelta::encode(previous, previous, delta));
+  ASSERT_TRUE(delta.empty());
+
+  // a few changed bytes, two of them in consecutive blocks and one in the last partial block
+  std::string current = previous;
+  current[3] = 'b';
+  current[2 * StateDumpDelta::blockSize - 1] = 'c';
+  current[2 * StateDumpDelta::blockSize] = 'd';
+  current[current.size() - 1] = 'e';
+  ASSERT_TRUE(StateDumpDelta::encode(previous, current, delta));
+  ASSERT_LT(delta.size(), current.size() / 2);
+  std::string value = previous;
+  StateDumpDelta::apply("entry", delta, value);
+  ASSERT_EQ(value, current);
+
+  // everything changed : the entry is stored as a whole
+  const std::string other(previous.size(), 'z');
+  ASSERT_TRUE(StateDumpDelta::encode(previous, other, delta));
+  ASSERT_EQ(delta.size(), other.size() + 1);
+  value = previous;
+  StateDumpDelta::apply("entry", delta, value);
+  ASSERT_EQ(value, other);
+
+  // different size
+  ASSERT_TRUE(StateDumpDelta::encode(previous, "short", delta));
+  value = previous;
+  StateDumpDelta::apply("entry", delta, value);
+  ASSERT_EQ(value, "short");
+}
+
+TEST(StateDumpDeltaTest, testApplyMismatch) {
+  const std::string previous(4 * StateDumpDelta::blockSize, 'a');
+  std::string current = previous;
+  current[current.size() - 1] = 'b';
+  std::string delta;
+  ASSERT_TRUE(StateDumpDelta::encode(previous, current, delta));
+
+  std::string value(StateDumpDelta::blockSize, 'a');
+  ASSERT_THROW_DYNAWO(StateDumpDelta::apply("entry", delta, value), Error::GENERAL, KeyError_t::StateDumpDeltaMismatch);
+  value = previous;
+  ASSERT_THROW_DYNAWO(StateDumpDelta::apply("entry", delta.substr(0, 10), value), Error::GENERAL, KeyError_t::StateDumpDeltaMismatch);
+  ASSERT_THROW_DYNAWO(StateDumpDelta::apply("entry", "", value), Error::GENERAL, KeyError_t::StateDumpDeltaMismatch);
+  ASSERT_THROW_DYNAWO(StateDumpDelta::apply("entry", "X", value), Error::GENERAL, KeyError_t::StateDumpDeltaMismatch);
+}
+
+}  // namespace DYN
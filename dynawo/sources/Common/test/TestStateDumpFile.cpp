@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+#include <fstream>
+#include <map>
+#include <string>
+
+#include "gtest_dynawo.h"
+#include "DYNError.h"
+#include "DYNFileSystemUtils.h"
+#include "DYNStateDumpFile.h"
+
+namespace DYN {
+
+TEST(StateDumpFileTest, testWriteRead) {
+  const std::string fileName = "stateDumpFile.dmp";
+  std::map<std::string, std::string> entries;
+  entries["time.bin"] = std::string("\0\1\2", 3);
+  entries["model.bin"] = std::string(1000, 'x');
+  entries["empty.bin"] = "";
+  {
+    StateDumpFile::Writer writer(fileName);
+    writer.addEntries(entries);
+    writer.addEntry("last", "odd");
+    writer.close();
+  }
+  std::ifstream written(fileName.c_str(), std::ios::binary | std::ios::ate);
+  ASSERT_EQ(written.tellg() % 8, 0);
+  ASSERT_TRUE(StateDumpFile::isStateDumpFile(fileName));
+
+  std::map<std::string, std::string> entriesRead;
+  StateDumpFile::read(fileName, entriesRead);
+  entries["last"] = "odd";
+  ASSERT_EQ(entriesRead, entries);
+
+  // truncated file
+  {
+    std::ofstream stream("stateDumpFileTruncated.dmp", std::ios::binary);
+    std::ifstream original(fileName.c_str(), std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(original)), std::istreambuf_iterator<char>());
+    stream << content.substr(0, 40);
+  }
+  ASSERT_TRUE(StateDumpFile::isStateDumpFile("stateDumpFileTruncated.dmp"));
+  ASSERT_THROW_DYNAWO(StateDumpFile::read("stateDumpFileTruncated.dmp", entriesRead), Error::GENERAL, KeyError_t::StateDumpCorrupted);
+
+  remove(fileName);
+  remove("stateDumpFileTruncated.dmp");
+}
+
+TEST(StateDumpFileTest, testOtherFormats) {
+  const std::string fileName = "stateDumpFileOther.dmp";
+  {
+    std::ofstream stream(fileName.c_str(), std::ios::binary);
+    stream << "PK\3\4 a zip archive";
+  }
+  ASSERT_FALSE(StateDumpFile::isStateDumpFile(fileName));
+  ASSERT_FALSE(StateDumpFile::isStateDumpFile("stateDumpFileMissing.dmp"));
+
+  // file written by a more recent version of the format
+  {
+    std::ofstream stream(fileName.c_str(), std::ios::binary | std::ios::trunc);
+    const std::uint32_t version = StateDumpFile::version + 1;
+    const std::uint32_t reserved = 0;
+    stream << "DYNSTATE";
+    stream.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    stream.write(reinterpret_cast<const char*>(&reserved), sizeof(reserved));
+  }
+  std::map<std::string, std::string> entries;
+  ASSERT_THROW_DYNAWO(StateDumpFile::read(fileName, entries), Error::GENERAL, KeyError_t::StateDumpVersionUnsupported);
+  remove(fileName);
+}
+
+}  // namespace DYN
@@ -0,0 +1,73 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+#include <stdexcept>
+#include <vector>
+
+#include "gtest_dynawo.h"
+#include "DYNThreadPool.h"
+
+namespace DYN {
+
+TEST(ThreadPoolTest, testParallelFor) {
+  ThreadPool pool(4);
+  ASSERT_EQ(pool.nbThreads(), 4);
+
+  std::vector<int> values(1000, 0);
+  // several batches in a row to check that the workers are correctly reused
+  for (int batch = 1; batch <= 10; ++batch) {
+    pool.parallelFor(static_cast<unsigned>(values.size()), [&values](unsigned i) { values[i] += static_cast<int>(i); });
+    for (unsigned i = 0; i < values.size(); ++i)
+      ASSERT_EQ(values[i], batch * static_cast<int>(i));
+  }
+
+  // no task
+  pool.parallelFor(0, [&values](unsigned i) { values[i] = -1; });
+  ASSERT_EQ(values[0], 0);
+}
+
+TEST(ThreadPoolTest, testSequentialPool) {
+  ThreadPool pool(1);
+  ASSERT_EQ(pool.nbThreads(), 1);
+  std::vector<unsigned> order;
+  pool.parallelFor(5, [&order](unsigned i) { order.push_back(i); });
+  ASSERT_EQ(order.size(), 5);
+  for (unsigned i = 0; i < order.size(); ++i)
+    ASSERT_EQ(order[i], i);
+}
+
+TEST(ThreadPoolTest, testException) {
+  ThreadPool pool(3);
+  std::vector<int> done(20, 0);
+  try {
+    pool.parallelFor(20, [&done](unsigned i) {
+      if (i == 7 || i == 13)
+        throw std::runtime_error(i == 7 ? "task7" : "task13");
+      done[i] = 1;
+    });
+    FAIL() << "an exception should have been thrown";
+  } catch (const std::runtime_error& e) {
+    ASSERT_EQ(std::string(e.what()), "task7");
+  }
+  // the other tasks are still performed
+  for (unsigned i = 0; i < done.size(); ++i)
+    ASSERT_EQ(done[i], (i == 7 || i == 13) ? 0 : 1);
+
+  // the pool is still usable after an exception
+  std::vector<int> values(10, 0);
+  pool.parallelFor(10, [&values](unsigned i) { values[i] = 1; });
+  for (const auto value : values)
+    ASSERT_EQ(value, 1);
+}
+
+}  // namespace DYN
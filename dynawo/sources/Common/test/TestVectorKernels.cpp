@@ -0,0 +1,109 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "gtest_dynawo.h"
+#include "DYNCommon.h"
+#include "DYNSparseMatrix.h"
+#include "DYNVectorKernels.h"
+
+namespace DYN {
+
+static const VectorKernels::instructionSet_t instructionSets[] = {VectorKernels::SCALAR, VectorKernels::AVX2, VectorKernels::AVX512};
+
+TEST(VectorKernelsTest, testReductions) {
+  const VectorKernels::instructionSet_t initialInstructionSet = VectorKernels::getInstructionSet();
+  ASSERT_TRUE(VectorKernels::isSupported(VectorKernels::SCALAR));
+  ASSERT_TRUE(VectorKernels::isSupported(initialInstructionSet));
+
+  for (const auto instructionSet : instructionSets) {
+    if (!VectorKernels::setInstructionSet(instructionSet)) {
+      ASSERT_FALSE(VectorKernels::isSupported(instructionSet));
+      continue;
+    }
+    ASSERT_EQ(VectorKernels::getInstructionSet(), instructionSet);
+    // sizes around the vector lengths to check the remainders
+    for (unsigned size = 0; size < 40; ++size) {
+      std::vector<double> x(size);
+      std::vector<double> w(size);
+      std::vector<int> index(size);
+      double maxAbs = 0.;
+      double maxAbsProduct = 0.;
+      double sumAbs = 0.;
+      double sumSquares = 0.;
+      double sumSquaredProducts = 0.;
+      double maxAbsProductIndexed = 0.;
+      double sumSquaredProductsIndexed = 0.;
+      for (unsigned i = 0; i < size; ++i) {
+        x[i] = (i % 3 == 0 ? -1. : 1.) * (0.5 + i);
+        w[i] = 1. / (1. + i % 5);
+        index[i] = static_cast<int>((7 * i) % size);
+        maxAbs = std::max(maxAbs, std::fabs(x[i]));
+        maxAbsProduct = std::max(maxAbsProduct, std::fabs(x[i] * w[i]));
+        sumAbs += std::fabs(x[i]);
+        sumSquares += x[i] * x[i];
+        sumSquaredProducts += x[i] * w[i] * x[i] * w[i];
+      }
+      for (unsigned i = 0; i < size; ++i) {
+        maxAbsProductIndexed = std::max(maxAbsProductIndexed, std::fabs(x[index[i]] * w[i]));
+        sumSquaredProductsIndexed += x[index[i]] * w[i] * x[index[i]] * w[i];
+      }
+      ASSERT_DOUBLE_EQUALS_DYNAWO(VectorKernels::maxAbs(x.data(), size), maxAbs);
+      ASSERT_DOUBLE_EQUALS_DYNAWO(VectorKernels::maxAbsProduct(x.data(), w.data(), size), maxAbsProduct);
+      ASSERT_DOUBLE_EQUALS_DYNAWO(VectorKernels::sumAbs(x.data(), size), sumAbs);
+      ASSERT_DOUBLE_EQUALS_DYNAWO(VectorKernels::sumSquares(x.data(), size), sumSquares);
+      ASSERT_DOUBLE_EQUALS_DYNAWO(VectorKernels::sumSquaredProducts(x.data(), w.data(), size), sumSquaredProducts);
+      ASSERT_DOUBLE_EQUALS_DYNAWO(VectorKernels::maxAbsProduct(x.data(), index.data(), w.data(), size), maxAbsProductIndexed);
+      ASSERT_DOUBLE_EQUALS_DYNAWO(VectorKernels::sumSquaredProducts(x.data(), index.data(), w.data(), size), sumSquaredProductsIndexed);
+    }
+
+    // NaN values are ignored by the max reductions, as in the scalar loops they replace
+    std::vector<double> x(20, 1.);
+    x[3] = std::numeric_limits<double>::quiet_NaN();
+    x[17] = -4.;
+    ASSERT_DOUBLE_EQUALS_DYNAWO(VectorKernels::maxAbs(x.data(), x.size()), 4.);
+  }
+  ASSERT_TRUE(VectorKernels::setInstructionSet(initialInstructionSet));
+}
+
+TEST(VectorKernelsTest, testSparseMatrixNorms) {
+  // | 1  0 -2 |
+  // | 0  3  0 |
+  // |-4  0  5 |
+  SparseMatrix smj;
+  smj.init(3, 3);
+  smj.changeCol();
+  smj.addTerm(0, 1.);
+  smj.addTerm(2, -4.);
+  smj.changeCol();
+  smj.addTerm(1, 3.);
+  smj.changeCol();
+  smj.addTerm(0, -2.);
+  smj.addTerm(2, 5.);
+
+  const VectorKernels::instructionSet_t initialInstructionSet = VectorKernels::getInstructionSet();
+  for (const auto instructionSet : instructionSets) {
+    if (!VectorKernels::setInstructionSet(instructionSet))
+      continue;
+    ASSERT_DOUBLE_EQUALS_DYNAWO(smj.frobeniusNorm(), std::sqrt(55.));
+    ASSERT_DOUBLE_EQUALS_DYNAWO(smj.norm1(), 7.);
+    ASSERT_DOUBLE_EQUALS_DYNAWO(smj.infinityNorm(), 9.);
+  }
+  ASSERT_TRUE(VectorKernels::setInstructionSet(initialInstructionSet));
+}
+
+}  // namespace DYN
@@ -0,0 +1,72 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+#include <sstream>
+#include <string>
+
+#include "gtest_dynawo.h"
+#include "DYNCommon.h"
+#include "DYNXmlStreamWriter.h"
+
+namespace DYN {
+
+TEST(XmlStreamWriterTest, testDocument) {
+  std::stringstream ss;
+  XmlStreamWriter writer(ss, "http://www.rte-france.com/dynawo");
+  writer.startDocument();
+  writer.startElement("curvesOutput");
+  writer.startElement("curve");
+  writer.addAttribute("model", std::string("model"));
+  writer.addAttribute("factor", 10.);
+  writer.startElement("point");
+  writer.addAttribute("time", 1.5, XmlStreamWriter::DOUBLE_PRECISION);
+  writer.addAttribute("value", 2.25);
+  writer.addAttribute("index", 3);
+  writer.endElement();
+  writer.endElement();
+  writer.startElement("curve");
+  writer.endDocument();
+  ASSERT_EQ(ss.str(), "<?xml version=\"1.0\" encoding=\"ISO-8859-1\" standalone=\"no\"?>\n"
+      "<curvesOutput xmlns=\"http://www.rte-france.com/dynawo\">\n"
+      "  <curve model=\"model\" factor=\"10\">\n"
+      "    <point time=\"" + double2String(1.5) + "\" value=\"2.25\" index=\"3\"/>\n"
+      "  </curve>\n"
+      "  <curve/>\n"
+      "</curvesOutput>\n");
+}
+
+TEST(XmlStreamWriterTest, testEscapedAttributes) {
+  std::stringstream ss;
+  {
+    XmlStreamWriter writer(ss, "");
+    writer.startElement("event");
+    // special characters are escaped, UTF-8 is written in ISO-8859-1 or as character references
+    writer.addAttribute("message", std::string("a<b & \"c\"\n\xC3\xA9t\xC3\xA9 \xE2\x82\xAC"));
+  }
+  ASSERT_EQ(ss.str(), "<event message=\"a&lt;b &amp; &quot;c&quot;&#10;\xE9t\xE9 &#8364;\"");
+}
+
+TEST(XmlStreamWriterTest, testDouble2Chars) {
+  char buffer[64];
+  for (double value : {0., -1.5, 123456.789, 1e7, -2e-8}) {
+    const std::size_t length = double2Chars(value, buffer, sizeof(buffer));
+    ASSERT_EQ(std::string(buffer, length), double2String(value));
+  }
+  const double precision = getCurrentPrecision();
+  setCurrentPrecision(1e-6);
+  ASSERT_EQ(double2String(1e7), "1.000000e+07");
+  ASSERT_EQ(double2String(-0.5), "-0.500000");
+  setCurrentPrecision(precision);
+}
+
+}  // namespace DYN
@@ -17,8 +17,10 @@
  * @brief main program of dynawo
  *
  */
+#include <algorithm>
 #include <string>
 #include <iostream>
+#include <thread>
 
 #include <boost/program_options.hpp>
 
@@ -61,6 +63,10 @@ static void usage(const po::options_description& desc) {
  */
 int main(int argc, char ** argv) {
   string jobsFileName = "";
+  unsigned nbParallelJobs = 1;
+  string contingenciesFileName = "";
+  string ensembleFileName = "";
+  string serviceSocketPath = "";
 
   // declarations of supported options
   // -----------------------------------
@@ -69,7 +75,18 @@ int main(int argc, char ** argv) {
   desc.add_options()
     ("help,h", "produce help message")
     ("version,v", "print dynawo version")
-    ("interactive,i", "experimental interactive simulator");
+    ("interactive,i", "experimental interactive simulator")
+    ("jobs-parallel,j", po::value<unsigned>(&nbParallelJobs), "run up to N jobs of the jobs file at the same time, each one in its own process"
+                                                              " (0 for the number of cores)")
+    ("contingencies,c", po::value<string>(&contingenciesFileName), "simulate the contingencies described in the file from the initialized state"
+                                                                    " of each job, up to N at the same time with --jobs-parallel")
+    ("ensemble,e", po::value<string>(&ensembleFileName), "simulate the parameter variants described in the file from the initialized state"
+                                                         " of each job, combined with the contingencies if any, up to N at the same time"
+                                                         " with --jobs-parallel")
+    ("contingencies-shared", "share the contingencies with the other processes simulating the same contingencies file in the same outputs"
+                             " directory, possibly on other hosts: each contingency is simulated by the first process claiming it")
+    ("service,s", po::value<string>(&serviceSocketPath), "run as a service simulating the jobs files whose path is sent on the local socket"
+                                                         " created at this path, up to N at the same time with --jobs-parallel");
 
   po::options_description hidden("Hidden options");
   hidden.add_options() ("jobs-file", po::value<string>(&jobsFileName), "set job file");
@@ -99,17 +116,30 @@ int main(int argc, char ** argv) {
     }
 
     // launch simulation
-    if (jobsFileName == "") {
+    if (jobsFileName == "" && serviceSocketPath.empty()) {
       cout << "Error: a jobs file name is required." << endl;
       usage(desc);
       return 1;
     }
 
-    if (!exists(jobsFileName)) {
+    if (serviceSocketPath.empty() && !exists(jobsFileName)) {
       cout << " failed to locate jobs file (" << jobsFileName << ")" << endl;
       usage(desc);
       return 1;
     }
+    if (!contingenciesFileName.empty() && !exists(contingenciesFileName)) {
+      cout << " failed to locate contingencies file (" << contingenciesFileName << ")" << endl;
+      usage(desc);
+      return 1;
+    }
+    if (!ensembleFileName.empty() && !exists(ensembleFileName)) {
+      cout << " failed to locate ensemble file (" << ensembleFileName << ")" << endl;
+      usage(desc);
+      return 1;
+    }
+    if (nbParallelJobs == 0)
+      nbParallelJobs = std::max(std::thread::hardware_concurrency(), 1U);
+
     DYN::InitXerces xerces;
     DYN::InitLibXml2 libxml2;
     DYN::IoDicos& dicos = DYN::IoDicos::instance();
@@ -118,11 +148,13 @@ int main(int argc, char ** argv) {
     if (getEnvVar("DYNAWO_USE_XSD_VALIDATION") != "true")
       cout << "[INFO] xsd validation will not be used" << endl;
 
-    if (vm.count("interactive")) {
+    if (!serviceSocketPath.empty()) {
+      serveSimu(serviceSocketPath, nbParallelJobs);
+    } else if (vm.count("interactive")) {
       cout << ".... <WARNING> Interactive experiment <WARNING>...." << endl;
-      launchSimu(jobsFileName, true);
+      launchSimu(jobsFileName, true, nbParallelJobs, contingenciesFileName, vm.count("contingencies-shared") > 0, ensembleFileName);
     } else {
-      launchSimu(jobsFileName, false);
+      launchSimu(jobsFileName, false, nbParallelJobs, contingenciesFileName, vm.count("contingencies-shared") > 0, ensembleFileName);
     }
   } catch (const DYN::Error& e) {
     std::cerr << "DYN Error: " << e.what() << std::endl;
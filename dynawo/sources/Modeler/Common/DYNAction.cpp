@@ -22,37 +22,41 @@
 
 namespace DYN {
 
-Action::Action(const boost::shared_ptr<SubModel>& subModel, std::vector<std::tuple<std::string, boost::any, DYN::typeVarC_t>>& parameterValueSet) :
+Action::Action(const boost::shared_ptr<SubModel>& subModel, ActionParameters& parameterValueSet) :
 subModel_(subModel),
 parameterValueSet_(parameterValueSet) { }
 
 void
 Action::apply() {
-  for (auto& parameterTuple : parameterValueSet_) {
-    switch (std::get<2>(parameterTuple)) {
+  for (const auto& actionParameter : parameterValueSet_) {
+    ParameterModeler& parameter = *actionParameter.parameter;
+    switch (parameter.getValueType()) {
       case VAR_TYPE_DOUBLE: {
-        subModel_->setParameterValue(std::get<0>(parameterTuple), DYN::FINAL, boost::any_cast<double>(std::get<1>(parameterTuple)), false);
+        parameter.setValue(boost::any_cast<double>(actionParameter.value), DYN::FINAL);
         break;
       }
       case VAR_TYPE_INT: {
-        subModel_->setParameterValue(std::get<0>(parameterTuple), DYN::FINAL, boost::any_cast<int>(std::get<1>(parameterTuple)), false);
+        parameter.setValue(boost::any_cast<int>(actionParameter.value), DYN::FINAL);
         break;
       }
       case VAR_TYPE_BOOL: {
-        subModel_->setParameterValue(std::get<0>(parameterTuple), DYN::FINAL, boost::any_cast<bool>(std::get<1>(parameterTuple)), false);
+        parameter.setValue(boost::any_cast<bool>(actionParameter.value), DYN::FINAL);
         break;
       }
       case VAR_TYPE_STRING: {
-        subModel_->setParameterValue(std::get<0>(parameterTuple), DYN::FINAL, boost::any_cast<std::string>(std::get<1>(parameterTuple)), false);
+        parameter.setValue(boost::any_cast<std::string>(actionParameter.value), DYN::FINAL);
         break;
       }
       default:
       {
-        throw DYNError(Error::MODELER, ParameterBadType, std::get<0>(parameterTuple));
+        throw DYNError(Error::MODELER, ParameterBadType, parameter.getName());
       }
     }
   }
   subModel_->setSubModelParameters();
+  subModel_->invalidateRootInputs();
+  subModel_->invalidateResidualInputs();
+  subModel_->requestDiscreteEvaluation();
 }
 
 void
@@ -35,11 +35,19 @@ namespace DYN {
  */
 class Action {
  public:
+  /**
+   * @brief parameter to modify, resolved when the action is registered, and its new value
+   */
+  struct ActionParameter {
+    ParameterModeler* parameter;  ///< dynamic parameter of the sub model
+    boost::any value;             ///< new value, of the type of the parameter
+  };
+
   /**
    * @typedef ActionParameters
-   * @brief Alias for a vector of tuples <parameter name, value, type>
+   * @brief Alias for a vector of parameters to modify
    */
-  typedef std::vector<std::tuple<std::string, boost::any, DYN::typeVarC_t> > ActionParameters;
+  typedef std::vector<ActionParameter> ActionParameters;
 
  /**
    * @brief constructor
@@ -49,7 +57,7 @@ class Action {
   Action(const boost::shared_ptr<SubModel>& subModel, ActionParameters& parameterValueSet);
 
   /**
-   * @brief apply the action
+   * @brief apply the action: set all the values, then reinitialize the sub model once
    */
   void apply();
 
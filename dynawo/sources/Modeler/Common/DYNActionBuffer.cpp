@@ -27,16 +27,32 @@ namespace DYN {
 
 void
 ActionBuffer::applyActions() {
-  std::lock_guard<std::mutex> actionLock(actionsMutex_);
-  for (auto& actionPair : actions_)
+  // the actions are applied outside of the lock so that new actions can be registered meanwhile
+  std::unordered_map<std::string, Action> actions;
+  {
+    std::lock_guard<std::mutex> actionLock(actionsMutex_);
+    actions.swap(actions_);
+  }
+  for (auto& actionPair : actions)
     actionPair.second.apply();
-  actions_.clear();
 }
 
 void
 ActionBuffer::addAction(const boost::shared_ptr<SubModel>& subModel, Action::ActionParameters& parameterValueSet) {
-  Action newAction = Action(subModel, parameterValueSet);
   std::lock_guard<std::mutex> actionLock(actionsMutex_);
+  insertAction(subModel, parameterValueSet);
+}
+
+void
+ActionBuffer::addActions(ActionBatch& batch) {
+  std::lock_guard<std::mutex> actionLock(actionsMutex_);
+  for (auto& actionItem : batch)
+    insertAction(actionItem.first, actionItem.second);
+}
+
+void
+ActionBuffer::insertAction(const boost::shared_ptr<SubModel>& subModel, Action::ActionParameters& parameterValueSet) {
+  Action newAction = Action(subModel, parameterValueSet);
   std::unordered_map<std::string, Action>::iterator actionIt = actions_.find(subModel->name());
   if (actionIt != actions_.end()) {
     if (subModel->name() == "NETWORK") {
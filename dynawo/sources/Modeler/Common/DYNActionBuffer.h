@@ -23,6 +23,8 @@
 #include <mutex>
 #include <unordered_map>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "DYNModel.h"
 #include "DYNAction.h"
@@ -38,6 +40,12 @@ namespace DYN {
  */
 class ActionBuffer {
  public:
+  /**
+   * @typedef ActionBatch
+   * @brief Alias for a vector of action items <subModel, set of parameter values>, one per sub model
+   */
+  typedef std::vector<std::pair<boost::shared_ptr<SubModel>, Action::ActionParameters> > ActionBatch;
+
   /**
    * @brief apply the list of action in the queue (empty the queue)
    */
@@ -50,6 +58,20 @@ class ActionBuffer {
    */
   void addAction(const boost::shared_ptr<SubModel>& subModel, Action::ActionParameters& parameterValueSet);
 
+  /**
+   * @brief register a batch of action items at once, each one merging with or replacing a previous item
+   * @param batch action items, one per sub model
+   */
+  void addActions(ActionBatch& batch);
+
+ private:
+  /**
+   * @brief register an action item, the mutex being locked
+   * @param subModel subModel of the action
+   * @param parameterValueSet set of parameter values
+   */
+  void insertAction(const boost::shared_ptr<SubModel>& subModel, Action::ActionParameters& parameterValueSet);
+
  private:
   std::unordered_map<std::string, Action> actions_;  ///< map of action ordered by model
   std::mutex actionsMutex_;                          ///< mutex for applying/registering a new action
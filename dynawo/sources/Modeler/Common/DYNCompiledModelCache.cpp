@@ -0,0 +1,122 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file DYNCompiledModelCache.cpp
+ * @brief cache of the libraries compiled from Modelica models, shared between jobs
+ *
+ */
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <boost/filesystem.hpp>
+
+#include "DYNCompiledModelCache.h"
+#include "DYNFileSystemUtils.h"
+#include "DYNMacrosMessage.h"
+#include "DYNTrace.h"
+
+namespace fs = boost::filesystem;
+
+namespace DYN {
+
+namespace {
+
+const std::uint64_t fnvOffsetBasis = 14695981039346656037ULL;  ///< initial value of a 64 bits FNV-1a hash
+const std::uint64_t fnvPrime = 1099511628211ULL;  ///< multiplier of a 64 bits FNV-1a hash
+
+}  // namespace
+
+CompiledModelCache::KeyBuilder::KeyBuilder() :
+hash_(fnvOffsetBasis),
+size_(0) {
+}
+
+void
+CompiledModelCache::KeyBuilder::add(const std::string& value) {
+  // the size is added first so that two different lists of values never give the same bytes
+  const std::uint64_t size = value.size();
+  hash(reinterpret_cast<const char*>(&size), sizeof(size));
+  hash(value.data(), value.size());
+}
+
+void
+CompiledModelCache::KeyBuilder::addFileContent(const std::string& path) {
+  std::ifstream file(path.c_str(), std::ios::binary);
+  if (!file.is_open()) {
+    add("");
+    add("missing");
+    return;
+  }
+  std::stringstream content;
+  content << file.rdbuf();
+  add(content.str());
+}
+
+std::string
+CompiledModelCache::KeyBuilder::getKey() const {
+  std::stringstream key;
+  key << std::hex << std::setfill('0') << std::setw(16) << hash_ << std::setw(16) << size_;
+  return key.str();
+}
+
+void
+CompiledModelCache::KeyBuilder::hash(const char* data, const std::size_t size) {
+  for (std::size_t i = 0; i < size; ++i) {
+    hash_ ^= static_cast<unsigned char>(data[i]);
+    hash_ *= fnvPrime;
+  }
+  size_ += size;
+}
+
+CompiledModelCache::CompiledModelCache(const std::string& directory) :
+directory_(directory) {
+  if (!isDirectory(directory_))
+    createDirectory(directory_);
+}
+
+bool
+CompiledModelCache::retrieve(const std::string& key, const std::string& lib) const {
+  const std::string libInCache = cachedLib(key, lib);
+  if (!exists(libInCache))
+    return false;
+  boost::system::error_code error;
+  fs::remove(lib, error);
+  fs::copy_file(libInCache, lib, error);
+  return !error;
+}
+
+void
+CompiledModelCache::store(const std::string& key, const std::string& lib) const {
+  const std::string libInCache = cachedLib(key, lib);
+  const fs::path temporaryLib = fs::path(directory_) / fs::unique_path("%%%%-%%%%-%%%%-%%%%.tmp");
+  boost::system::error_code error;
+  fs::copy_file(lib, temporaryLib, error);
+  if (!error)
+    fs::rename(temporaryLib, libInCache, error);
+  if (error) {
+    boost::system::error_code ignored;
+    fs::remove(temporaryLib, ignored);
+    Trace::warn(Trace::compile()) << DYNLog(CompiledModelCacheStoreFailed, lib, directory_, error.message()) << Trace::endline;
+    return;
+  }
+  Trace::info(Trace::compile()) << DYNLog(CompiledModelCacheStored, lib, libInCache) << Trace::endline;
+}
+
+std::string
+CompiledModelCache::cachedLib(const std::string& key, const std::string& lib) const {
+  return createAbsolutePath(key + "_" + fileNameFromPath(lib), directory_);
+}
+
+}  // namespace DYN
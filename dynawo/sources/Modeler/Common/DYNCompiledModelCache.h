@@ -0,0 +1,126 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file DYNCompiledModelCache.h
+ * @brief cache of the libraries compiled from Modelica models, shared between jobs
+ *
+ */
+#ifndef MODELER_COMMON_DYNCOMPILEDMODELCACHE_H_
+#define MODELER_COMMON_DYNCOMPILEDMODELCACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace DYN {
+
+/**
+ * @class CompiledModelCache
+ * @brief directory of compiled model libraries, indexed by a hash of everything their compilation depends on
+ *
+ * The key of a library is built from the content of the files given to the Modelica compiler and from the options
+ * of the compilation, so that two jobs compiling the same composite model share the same library.
+ */
+class CompiledModelCache {
+ public:
+  /**
+   * @class KeyBuilder
+   * @brief incremental builder of the key of a compiled model
+   */
+  class KeyBuilder {
+   public:
+    /**
+     * @brief constructor
+     */
+    KeyBuilder();
+
+    /**
+     * @brief add a value to the key
+     *
+     * @param value value to add
+     */
+    void add(const std::string& value);
+
+    /**
+     * @brief add the content of a file to the key, a missing file being different from an empty one
+     *
+     * @param path path of the file
+     */
+    void addFileContent(const std::string& path);
+
+    /**
+     * @brief get the key
+     *
+     * @return the hexadecimal representation of the hash of all the values added
+     */
+    std::string getKey() const;
+
+   private:
+    /**
+     * @brief add bytes to the hash
+     *
+     * @param data bytes to add
+     * @param size number of bytes
+     */
+    void hash(const char* data, std::size_t size);
+
+    std::uint64_t hash_;  ///< FNV-1a hash of the bytes added
+    std::uint64_t size_;  ///< number of bytes added
+  };
+
+  /**
+   * @brief constructor
+   *
+   * @param directory directory of the cache, created if needed
+   */
+  explicit CompiledModelCache(const std::string& directory);
+
+  /**
+   * @brief copy a library of the cache
+   *
+   * @param key key of the compiled model
+   * @param lib path where to copy the library
+   *
+   * @return @b true if the library was in the cache
+   */
+  bool retrieve(const std::string& key, const std::string& lib) const;
+
+  /**
+   * @brief add a library to the cache
+   *
+   * The library is first copied to a temporary file and then renamed, so that a job cannot read a library while
+   * another one is still writing it. A failure is traced but not thrown, the library being still usable by the job.
+   *
+   * @param key key of the compiled model
+   * @param lib path of the library compiled
+   */
+  void store(const std::string& key, const std::string& lib) const;
+
+ private:
+  /**
+   * @brief get the path of a library in the cache
+   *
+   * @param key key of the compiled model
+   * @param lib path of the library, whose name is kept to ease the reading of the cache
+   *
+   * @return the path of the library in the cache
+   */
+  std::string cachedLib(const std::string& key, const std::string& lib) const;
+
+  std::string directory_;  ///< directory of the cache
+};
+
+}  // namespace DYN
+
+#endif  // MODELER_COMMON_DYNCOMPILEDMODELCACHE_H_
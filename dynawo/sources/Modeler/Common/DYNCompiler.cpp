@@ -17,11 +17,14 @@
  *
  */
 
+#include <algorithm>
+#include <cstdlib>
 #include <iomanip>
 #include <fstream>
 #include <set>
 #include <memory>
 #include <unordered_set>
+#include <boost/algorithm/string/join.hpp>
 #include <boost/algorithm/string/replace.hpp>
 
 #include <boost/algorithm/string/predicate.hpp>
@@ -58,6 +61,10 @@
 #include "EXTVARVariable.h"
 
 #include "DYNCommon.h"
+#include "DYNCompiledModelCache.h"
+#include "DYNThreadPool.h"
+#include "config.h"
+#include "gitversion.h"
 
 using std::map;
 using std::string;
@@ -74,6 +81,9 @@ namespace DYN {
 void
 Compiler::compile() {
   getDDB();
+  initCompiledModelCache();
+  if (hasEnvVar("DYNAWO_NB_COMPILATION_JOBS"))
+    nbCompilationJobs_ = static_cast<unsigned>(std::max(std::atoi(getEnvVar("DYNAWO_NB_COMPILATION_JOBS").c_str()), 1));
 
   unitDynamicModelsMap_ = dyd_->getUnitDynamicModelsMap();
   for (const auto& blackBoxModelDescriptionPair : dyd_->getBlackBoxModelDescriptions())
@@ -81,6 +91,8 @@ Compiler::compile() {
 
   for (const auto& modelTemplateDescriptionPair : dyd_->getModelTemplateDescriptionsToBeCompiled())
     compileModelicaModelDescription(modelTemplateDescriptionPair.second);
+  // the libraries of the model templates are needed by their expansions
+  compilePendingModels();
 
   // compile model template expansion. compile model template expansion after all the model templates are compiled
   for (const auto& modelTemplateExpansionPair : dyd_->getModelTemplateExpansionDescriptions()) {
@@ -90,6 +102,7 @@ Compiler::compile() {
   // compile all the reference models from refLib
   for (const auto& referenceModelicaModel : dyd_->getReferenceModelicaModels())
     compileModelicaModelDescription(referenceModelicaModel);
+  compilePendingModels();
 
   // in map refMap, the key is the modelicamodel, the value is the reference model
   // for other modelica models, set their libs as their reference models lib; concat parameters; add to compiled lib
@@ -196,6 +209,55 @@ Compiler::getDDB() {
   Trace::debug(Trace::compile()) << "" << Trace::endline;
 }
 
+void
+Compiler::initCompiledModelCache() {
+  if (!hasEnvVar("DYNAWO_COMPILED_MODELS_CACHE_DIR"))
+    return;
+  compiledModelCache_ = std::make_shared<CompiledModelCache>(getEnvVar("DYNAWO_COMPILED_MODELS_CACHE_DIR"));
+
+  CompiledModelCache::KeyBuilder key;
+  key.add(DYNAWO_VERSION_STRING);
+  key.add(DYNAWO_GIT_HASH);
+  // the compilation flags are in the scripts generated when Dynawo was built
+  if (hasEnvVar("DYNAWO_SCRIPTS_DIR")) {
+    const string scriptsDir = getEnvVar("DYNAWO_SCRIPTS_DIR");
+    key.addFileContent(absolute("PreloadCache.cmake", scriptsDir));
+    key.addFileContent(absolute("compileCppModelicaModelInDynamicLib.cmake", scriptsDir));
+  }
+  // an invalid optimization level is ignored by the compilation script
+  if (hasEnvVar("DYNAWO_MODELS_OPTIMIZATION_LEVEL")) {
+    const string optimizationLevel = getEnvVar("DYNAWO_MODELS_OPTIMIZATION_LEVEL");
+    if (optimizationLevel.size() == 1 && string("0123sg").find(optimizationLevel[0]) != string::npos)
+      key.add(optimizationLevel);
+  }
+  for (const auto& additionalHeaderFile : additionalHeaderFiles_) {
+    key.add(additionalHeaderFile);
+    key.addFileContent(additionalHeaderFile);
+  }
+  // the paths of the models are not part of the key, so that the cache can be shared between installations
+  for (const auto& moFilePair : moFilesAll_) {
+    key.add(moFilePair.first);
+    key.addFileContent(moFilePair.second);
+  }
+  compiledModelCacheBaseKey_ = key.getKey();
+}
+
+string
+Compiler::compiledModelCacheKey(const string& compiledModelId, const string& libName, const bool useAliasing,
+    const bool genCalculatedVariables) const {
+  CompiledModelCache::KeyBuilder key;
+  key.add(compiledModelCacheBaseKey_);
+  key.add(compiledModelId);
+  key.add(libName);
+  key.add(useAliasing ? "true" : "false");
+  key.add(genCalculatedVariables ? "true" : "false");
+  key.addFileContent(modelConcatFile_);
+  if (!initConcatFile_.empty())
+    key.addFileContent(initConcatFile_);
+  key.addFileContent(absolute(compiledModelId + ".extvar", modelDirPath_));
+  return key.getKey();
+}
+
 void
 Compiler::compileModelTemplateExpansionDescription(const std::shared_ptr<ModelDescription>& modelTemplateExpansionDescription) {
   if (modelTemplateExpansionDescription->getType() != dynamicdata::Model::MODEL_TEMPLATE_EXPANSION) {
@@ -326,6 +388,25 @@ Compiler::compileModelicaModelDescription(const std::shared_ptr<ModelDescription
 
   throwIfAllModelicaFilesAreNotAvailable(unitDynamicModels);
 
+  ModelicaCompilation compilation;
+  compilation.modelDescription = modelicaModelDescription;
+  compilation.modelId = modelID;
+  compilation.compiledModelId = thisCompiledId;
+  compilation.libName = libName;
+  compilation.lib = absolute(libName, modelDirPath_);
+  compilation.modelConcatFile = modelConcatFile_;
+  compilation.initConcatFile = initConcatFile_;
+  compilation.isModelTemplate = isModelTemplate;
+
+  if (compiledModelCache_) {
+    compilation.cacheKey = compiledModelCacheKey(thisCompiledId, libName, useAliasing, genCalculatedVariables);
+    if (compiledModelCache_->retrieve(compilation.cacheKey, compilation.lib)) {
+      Trace::info(Trace::compile()) << DYNLog(CompiledModelCacheHit, thisCompiledId, compilation.cacheKey) << Trace::endline;
+      finalizeCompilation(compilation);
+      return;
+    }
+  }
+
   // Compilation and post-treatment on concatenated files
   string installDir = getMandatoryEnvVar("DYNAWO_INSTALL_DIR");
   string compileDirPath = createAbsolutePath(thisCompiledId, modelDirPath_);
@@ -352,42 +433,75 @@ Compiler::compileModelicaModelDescription(const std::shared_ptr<ModelDescription
   }
 
   Trace::info(Trace::compile()) << DYNLog(CompileCommmand, compileCommand) << Trace::endline;
+  compilation.command = compileCommand;
+  pendingCompilations_.push_back(compilation);
+}
 
-  stringstream ss;
-  executeCommand(compileCommand, ss);
-  Trace::info(Trace::compile()) << ss.str() << Trace::endline;
+void
+Compiler::compilePendingModels() {
+  if (pendingCompilations_.empty())
+    return;
+
+  // each model is compiled in its own directory, the commands can run concurrently
+  const unsigned nbCompilations = static_cast<unsigned>(pendingCompilations_.size());
+  vector<string> outputs(nbCompilations);
+  ThreadPool threadPool(std::min(nbCompilationJobs_, nbCompilations));
+  threadPool.parallelFor(nbCompilations, [this, &outputs](const unsigned i) {
+    stringstream ss;
+    executeCommand(pendingCompilations_[i].command, ss);
+    outputs[i] = ss.str();
+  });
+
+  vector<string> failedLibs;
+  for (unsigned i = 0; i < nbCompilations; ++i) {
+    const ModelicaCompilation& compilation = pendingCompilations_[i];
+    Trace::info(Trace::compile()) << outputs[i] << Trace::endline;
 
 #ifdef __linux__
-    bool hasUndefinedSymbol = (ss.str().find("undefined symbol") != string::npos);
+    bool hasUndefinedSymbol = (outputs[i].find("undefined symbol") != string::npos);
 #else
-  bool hasUndefinedSymbol = false;
+    bool hasUndefinedSymbol = false;
 #endif
 
-  // testing if the lib was successfully compiled (test if it exists, and if no undefined symbol was noticed)
-  string lib = absolute(libName, modelDirPath_);
-  if ((!exists(lib)) || hasUndefinedSymbol)
-    throw DYNError(Error::MODELER, CompilationFailed, libName);
+    // testing if the lib was successfully compiled (test if it exists, and if no undefined symbol was noticed)
+    if ((!exists(compilation.lib)) || hasUndefinedSymbol) {
+      Trace::error(Trace::compile()) << DYNLog(ModelCompilationError, compilation.compiledModelId, compilation.libName) << Trace::endline;
+      failedLibs.push_back(compilation.libName);
+      continue;
+    }
+
+    if (compiledModelCache_)
+      compiledModelCache_->store(compilation.cacheKey, compilation.lib);
+    finalizeCompilation(compilation);
+  }
+  pendingCompilations_.clear();
 
+  if (!failedLibs.empty())
+    throw DYNError(Error::MODELER, CompilationFailed, boost::algorithm::join(failedLibs, ", "));
+}
+
+void
+Compiler::finalizeCompilation(const ModelicaCompilation& compilation) {
 #ifdef _DEBUG_
   static_cast<void>(rmModels_);  // shut up clang -Wunused-private-field
 #else
   // remove .mo, -init.mo
   if (rmModels_) {
-    remove(modelConcatFile_);
-    remove(initConcatFile_);
+    remove(compilation.modelConcatFile);
+    remove(compilation.initConcatFile);
   }
 #endif
 
-  Trace::info(Trace::compile()) << DYNLog(SetLib, modelID, lib) << Trace::endline;
-  modelicaModelDescription->setLib(lib);
+  Trace::info(Trace::compile()) << DYNLog(SetLib, compilation.modelId, compilation.lib) << Trace::endline;
+  compilation.modelDescription->setLib(compilation.lib);
 
-  if (isModelTemplate)
-    modelTemplateDescriptions_[modelID] = modelicaModelDescription;
+  if (compilation.isModelTemplate)
+    modelTemplateDescriptions_[compilation.modelId] = compilation.modelDescription;
 
   // Everything is ok -> model added in already compiled models
-  compiledModelDescriptions_[modelicaModelDescriptionId] = modelicaModelDescription;
-  compiledLib_.push_back(lib);
-  Trace::info(Trace::compile()) << DYNLog(CompiledModelID, thisCompiledId) << Trace::endline;
+  compiledModelDescriptions_[compilation.modelDescription->getID()] = compilation.modelDescription;
+  compiledLib_.push_back(compilation.lib);
+  Trace::info(Trace::compile()) << DYNLog(CompiledModelID, compilation.compiledModelId) << Trace::endline;
 }
 
 void
@@ -861,20 +975,8 @@ Compiler::concatRefs() const {
       const string& macroStaticRefId = macroStaticRefPair.second->getId();
       const std::shared_ptr<dynamicdata::MacroStaticReference>& macroStaticReference =
         dyd_->getDynamicModelsCollection()->findMacroStaticReference(macroStaticRefId);
-      // retrieve the StaticRef elements contained in the MacroStaticRefenence
-      for (const auto& staticRefPair : macroStaticReference->getStaticReferences()) {
-        const auto& staticRef = staticRefPair.second;
-        const string& modelId = model->getID();
-        const string& modelVar = staticRef->getModelVar();
-        const string& staticVar = staticRef->getStaticVar();
-
-        shared_ptr<StaticRefInterface> newStaticRefInterface(new StaticRefInterface());
-        newStaticRefInterface->setModelID(modelId);
-        newStaticRefInterface->setModelVar(modelVar);
-        newStaticRefInterface->setStaticVar(staticVar);
-
-        model->addStaticRefInterface(newStaticRefInterface);
-      }
+      // the StaticRef elements contained in the MacroStaticReference are resolved when the model is instantiated
+      model->addMacroStaticReference(macroStaticReference);
     }
   }
 }
@@ -906,49 +1008,66 @@ Compiler::modelicaModelVariableName(const string& rawVariableName, const string&
 
 void
 Compiler::concatConnects() {
-  for (const auto& connector : dyd_->getSystemConnects()) {
-    std::unique_ptr<ConnectInterface> connect(new ConnectInterface());
-
-    assert(connector->getFirstModelId() != connector->getSecondModelId() && "fully internal connects should not be set with system dynamic connects");
-
-    bool model1Ok = false;
-    bool model2Ok = false;
-
-    const auto& connectorFirstModelId = connector->getFirstModelId();
-    const auto& connectorSecondModelId = connector->getSecondModelId();
-    const auto& connectorFirstVariableId = connector->getFirstVariableId();
-    const auto& connectorSecondVariableId = connector->getSecondVariableId();
-
-    if (connectorFirstModelId == "NETWORK") {
-      connect->setConnectedModel1("NETWORK");
-      connect->setModel1Var(connectorFirstVariableId);
-      model1Ok = true;
-    } else if (connectorSecondModelId == "NETWORK") {
-      connect->setConnectedModel2("NETWORK");
-      connect->setModel2Var(connectorSecondVariableId);
-      model2Ok = true;
-    }
+  for (const auto& connector : dyd_->getSystemConnects())
+    concatConnect(connector->getFirstModelId(), connector->getFirstVariableId(), connector->getSecondModelId(), connector->getSecondVariableId());
 
-    if (compiledModelDescriptions_.find(connectorFirstModelId) != compiledModelDescriptions_.end()) {
-      connect->setConnectedModel1(connectorFirstModelId);
-      connect->setModel1Var(connectVariableName(compiledModelDescriptions_[connectorFirstModelId], connectorFirstVariableId));
-      model1Ok = true;
+  // the macro connects are expanded here, without intermediate connectors
+  for (const auto& macroConnect : dyd_->getSystemMacroConnects()) {
+    const string& connector = macroConnect->getConnector();
+    const string& model1 = macroConnect->getFirstModelId();
+    const string& model2 = macroConnect->getSecondModelId();
+    const std::shared_ptr<dynamicdata::MacroConnector>& macroConnector = dyd_->getDynamicModelsCollection()->findMacroConnector(connector);
+    string var1;
+    string var2;
+    for (const auto& macroConnectionPair : macroConnector->getConnectors()) {
+      var1 = macroConnectionPair.second->getFirstVariableId();
+      var2 = macroConnectionPair.second->getSecondVariableId();
+      replaceMacroInVariableId(macroConnect->getIndex1(), macroConnect->getName1(), model1, model2, connector, var1);
+      replaceMacroInVariableId(macroConnect->getIndex2(), macroConnect->getName2(), model1, model2, connector, var2);
+      concatConnect(model1, var1, model2, var2);
     }
+  }
+}
 
-    if (compiledModelDescriptions_.find(connectorSecondModelId) != compiledModelDescriptions_.end()) {
-      connect->setConnectedModel2(connectorSecondModelId);
-      connect->setModel2Var(connectVariableName(compiledModelDescriptions_[connectorSecondModelId], connectorSecondVariableId));
-      model2Ok = true;
-    }
+void
+Compiler::concatConnect(const string& firstModelId, const string& firstVariableId, const string& secondModelId, const string& secondVariableId) {
+  std::unique_ptr<ConnectInterface> connect(new ConnectInterface());
+
+  assert(firstModelId != secondModelId && "fully internal connects should not be set with system dynamic connects");
+
+  bool model1Ok = false;
+  bool model2Ok = false;
+
+  if (firstModelId == "NETWORK") {
+    connect->setConnectedModel1("NETWORK");
+    connect->setModel1Var(firstVariableId);
+    model1Ok = true;
+  } else if (secondModelId == "NETWORK") {
+    connect->setConnectedModel2("NETWORK");
+    connect->setModel2Var(secondVariableId);
+    model2Ok = true;
+  }
 
-    if (!model1Ok || !model2Ok) {
-      const string unknownModel = !model1Ok ? connectorFirstModelId : connectorSecondModelId;
-      throw DYNError(Error::MODELER, InvalidDynamicConnect, connectorFirstModelId, connectorFirstVariableId,
-              connectorSecondModelId, connectorSecondVariableId, unknownModel);
-    }
+  const auto& itFirstModel = compiledModelDescriptions_.find(firstModelId);
+  if (itFirstModel != compiledModelDescriptions_.end()) {
+    connect->setConnectedModel1(firstModelId);
+    connect->setModel1Var(connectVariableName(itFirstModel->second, firstVariableId));
+    model1Ok = true;
+  }
 
-    dyd_->addConnectInterface(std::move(connect));
+  const auto& itSecondModel = compiledModelDescriptions_.find(secondModelId);
+  if (itSecondModel != compiledModelDescriptions_.end()) {
+    connect->setConnectedModel2(secondModelId);
+    connect->setModel2Var(connectVariableName(itSecondModel->second, secondVariableId));
+    model2Ok = true;
   }
+
+  if (!model1Ok || !model2Ok) {
+    const string unknownModel = !model1Ok ? firstModelId : secondModelId;
+    throw DYNError(Error::MODELER, InvalidDynamicConnect, firstModelId, firstVariableId, secondModelId, secondVariableId, unknownModel);
+  }
+
+  dyd_->addConnectInterface(std::move(connect));
 }
 
 }  // namespace DYN
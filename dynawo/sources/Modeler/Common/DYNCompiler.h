@@ -45,6 +45,7 @@ namespace DYN {
 class ModelDescription;
 class DynamicData;
 class DydAnalyser;
+class CompiledModelCache;
 
 /**
  * class Compiler
@@ -94,10 +95,14 @@ class Compiler {
   modelicaModelsExtension_(modelicaModelsExtension),
   modelDirPath_(outputDir),
   additionalHeaderFiles_(additionalHeaderFiles),
-  rmModels_(rmModels) { }
+  rmModels_(rmModels),
+  nbCompilationJobs_(1) { }
 
   /**
    * @brief Compile models in a dyd files.
+   *
+   * Independent Modelica models are compiled concurrently when the DYNAWO_NB_COMPILATION_JOBS environment
+   * variable is greater than 1.
    */
   void compile();
 
@@ -128,12 +133,46 @@ class Compiler {
    */
   void compileBlackBoxModelDescription(const std::shared_ptr<ModelDescription>& blackBoxModelDescription);
 
+  /**
+   * @brief state of the compilation of a modelica model
+   */
+  struct ModelicaCompilation {
+    std::shared_ptr<ModelDescription> modelDescription;  ///< model description compiled
+    std::string modelId;  ///< id of the modelica model
+    std::string compiledModelId;  ///< id of the compiled model
+    std::string libName;  ///< name of the library
+    std::string lib;  ///< path of the library
+    std::string modelConcatFile;  ///< concat model file
+    std::string initConcatFile;  ///< concat init file, empty if the model has no init model
+    std::string cacheKey;  ///< key of the model in the cache of compiled models, empty if there is no cache
+    std::string command;  ///< command compiling the library
+    bool isModelTemplate;  ///< whether the model is a model template
+  };
+
   /**
    * @brief compile a modelica Model 's model description.
+   *
+   * The model is concatenated at once, but its compilation is delayed until compilePendingModels is called.
+   *
    * @param modelicaModelDescription modelica Model Description to compile
    */
   void compileModelicaModelDescription(const std::shared_ptr<ModelDescription>& modelicaModelDescription);
 
+  /**
+   * @brief compile the modelica models waiting for their compilation, using up to nbCompilationJobs_ concurrent commands
+   *
+   * All the compilations are run before the failures are reported, each failed model being traced.
+   *
+   * @throw CompilationFailed error listing the libraries that could not be compiled
+   */
+  void compilePendingModels();
+
+  /**
+   * @brief set the library of a compiled modelica model and add it to the compiled models
+   * @param compilation compilation of the model
+   */
+  void finalizeCompilation(const ModelicaCompilation& compilation);
+
   /**
    * @brief compile a model template's model description.
    * @param modelTemplateExpansionDescription modelica Model Description to compile
@@ -151,6 +190,25 @@ class Compiler {
    */
   void getDDB();
 
+  /**
+   * @brief create the cache of compiled models if the DYNAWO_COMPILED_MODELS_CACHE_DIR environment variable is set
+   *
+   * The part of the key shared by all the models is computed here: version of Dynawo, scripts and optimization level of the compilation,
+   * additional headers and content of all the Modelica models available.
+   */
+  void initCompiledModelCache();
+
+  /**
+   * @brief compute the key of a Modelica model in the cache of compiled models, once its concatenated files are written
+   * @param compiledModelId id of the compiled model
+   * @param libName name of the library to compile
+   * @param useAliasing whether the variables are aliased
+   * @param genCalculatedVariables whether the calculated variables are generated
+   * @returns the key of the compiled model
+   */
+  std::string compiledModelCacheKey(const std::string& compiledModelId, const std::string& libName, bool useAliasing,
+      bool genCalculatedVariables) const;
+
   /**
    * @brief generate the full connect variable name (including alias variable name when relevant)
    * @param model the model to connect
@@ -159,6 +217,16 @@ class Compiler {
    */
   std::string connectVariableName(const std::shared_ptr<ModelDescription>& model, const std::string& rawVariableName) const;
 
+  /**
+   * @brief create the connect interface of a system-wide connect
+   * @param firstModelId id of the first model connected
+   * @param firstVariableId variable of the first model, as written in the .dyd file
+   * @param secondModelId id of the second model connected
+   * @param secondVariableId variable of the second model, as written in the .dyd file
+   */
+  void concatConnect(const std::string& firstModelId, const std::string& firstVariableId,
+      const std::string& secondModelId, const std::string& secondVariableId);
+
   /**
    * @brief compute a Modelica model variable name (based on possible model aliasing)
    * @param rawVariableName the variable name as written in the .dyd file
@@ -270,6 +338,12 @@ class Compiler {
 
   // if set to true the .mo input files will be deleted (default: false)
   bool rmModels_;  ///< enables to remove model file
+
+  std::shared_ptr<CompiledModelCache> compiledModelCache_;  ///< cache of compiled models shared between jobs, if enabled
+  std::string compiledModelCacheBaseKey_;  ///< part of the key of the compiled models shared by all the models
+
+  unsigned nbCompilationJobs_;  ///< maximum number of modelica models compiled concurrently
+  std::vector<ModelicaCompilation> pendingCompilations_;  ///< modelica models concatenated, waiting for their compilation
 };
 
 }  // namespace DYN
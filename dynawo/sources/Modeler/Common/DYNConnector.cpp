@@ -17,6 +17,7 @@
  * @brief Connector implementation
  */
 
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 #include <map>
@@ -40,6 +41,42 @@ using boost::shared_ptr;
 
 namespace DYN {
 
+namespace {
+
+/**
+ * @brief keep the connectors of a list that were not merged into another one
+ *
+ * Removing the merged connectors from the list at each merge would be linear in the number of connectors,
+ * they are therefore only filtered once all the connectors have been merged.
+ *
+ * @param connectorsList the list of connectors, in declaration order
+ * @param mergedConnectors the connectors merged into another one
+ * @param connectors the connectors kept
+ */
+void
+keepUnmergedConnectors(const list<shared_ptr<Connector> >& connectorsList,
+    const std::unordered_set<shared_ptr<Connector>, boost::hash<shared_ptr<Connector> > >& mergedConnectors, vector<shared_ptr<Connector> >& connectors) {
+  connectors.clear();
+  connectors.reserve(connectorsList.size() - std::min(connectorsList.size(), mergedConnectors.size()));
+  for (const auto& connector : connectorsList) {
+    if (mergedConnectors.find(connector) == mergedConnectors.end())
+      connectors.push_back(connector);
+  }
+}
+
+}  // namespace
+
+int
+connectedSubModel::variableIndexGlobal() const {
+  if (localIndex_ < 0) {
+    const int indexGlobal = subModel_->getVariableIndexGlobal(variable_);
+    localIndex_ = variable_->getIndex();
+    discrete_ = variable_->getType() == DISCRETE || variable_->getType() == BOOLEAN || variable_->getType() == INTEGER;
+    return indexGlobal;
+  }
+  return (discrete_ ? subModel_->zDeb() : subModel_->yDeb()) + localIndex_;
+}
+
 void
 Connector::addConnectedSubModel(const connectedSubModel& subModel) {
   connectedSubModels_.push_back(subModel);
@@ -109,13 +146,14 @@ ConnectorContainer::mergeYConnector() {
   yConnectors_.clear();
   yConnectorByVarNum_.clear();
   list<shared_ptr<Connector> > yConnectorsList;
+  std::unordered_set<shared_ptr<Connector>, boost::hash<shared_ptr<Connector> > > mergedConnectors;
   for (const auto& yConnectorDeclared : yConnectorsDeclared_) {
     auto yc = boost::make_shared<Connector>(*yConnectorDeclared);
     bool merged = false;
     for (const auto& connectedSubModel : yc->connectedSubModels()) {
-      const int numVar = connectedSubModel.subModel()->getVariableIndexGlobal(connectedSubModel.variable());
+      const int numVar = connectedSubModel.variableIndexGlobal();
       if (yConnectorByVarNum_.find(numVar) != yConnectorByVarNum_.end()) {
-        mergeConnectors(yc, yConnectorByVarNum_[numVar], yConnectorsList, yConnectorByVarNum_);
+        mergeConnectors(yc, yConnectorByVarNum_[numVar], mergedConnectors, yConnectorByVarNum_);
         merged = true;
         break;
       }
@@ -124,14 +162,14 @@ ConnectorContainer::mergeYConnector() {
     if (!merged) {
       yConnectorsList.push_back(yc);
       for (const auto& connectedSubModel : yc->connectedSubModels()) {
-        const int numVar = connectedSubModel.subModel()->getVariableIndexGlobal(connectedSubModel.variable());
+        const int numVar = connectedSubModel.variableIndexGlobal();
         yConnectorByVarNum_[numVar] = yc;
       }
     }
   }
 
   // Copy kept yConnectors in the vector
-  yConnectors_.assign(yConnectorsList.begin(), yConnectorsList.end());
+  keepUnmergedConnectors(yConnectorsList, mergedConnectors, yConnectors_);
 }
 
 
@@ -160,13 +198,14 @@ ConnectorContainer::mergeFlowConnector() {
   flowAliasNameToFictitiousVarNum_.clear();
   const bool flowConnector = true;
   list<shared_ptr<Connector> > flowConnectorsList;
+  std::unordered_set<shared_ptr<Connector>, boost::hash<shared_ptr<Connector> > > mergedConnectors;
   for (const auto& flowConnectorDeclared : flowConnectorsDeclared_) {
     auto flowc = boost::make_shared<Connector>(*flowConnectorDeclared);
     bool merged = false;
     for (const auto& connectedSubModel : flowc->connectedSubModels()) {
       const int numVar = getConnectorVarNum(connectedSubModel.subModel(), connectedSubModel.variable(), flowConnector);
       if (flowConnectorByVarNum_.find(numVar) != flowConnectorByVarNum_.end()) {
-        mergeConnectors(flowc, flowConnectorByVarNum_[numVar], flowConnectorsList, flowConnectorByVarNum_, flowConnector);
+        mergeConnectors(flowc, flowConnectorByVarNum_[numVar], mergedConnectors, flowConnectorByVarNum_, flowConnector);
         merged = true;
         break;
       }
@@ -182,7 +221,7 @@ ConnectorContainer::mergeFlowConnector() {
   }
 
   // Copy kept flowConnectors in the vector
-  flowConnectors_.assign(flowConnectorsList.begin(), flowConnectorsList.end());
+  keepUnmergedConnectors(flowConnectorsList, mergedConnectors, flowConnectors_);
 }
 
 void
@@ -191,13 +230,14 @@ ConnectorContainer::mergeZConnector() {
   zConnectors_.clear();
   zConnectorByVarNum_.clear();
   list<shared_ptr<Connector> > zConnectorsList;
+  std::unordered_set<shared_ptr<Connector>, boost::hash<shared_ptr<Connector> > > mergedConnectors;
   for (const auto& zConnectorDeclared : zConnectorsDeclared_) {
     auto zc = boost::make_shared<Connector>(*zConnectorDeclared);
     bool merged = false;
     for (const auto& connectedSubModel : zc->connectedSubModels()) {
-      const int numVar = connectedSubModel.subModel()->getVariableIndexGlobal(connectedSubModel.variable());
+      const int numVar = connectedSubModel.variableIndexGlobal();
       if (zConnectorByVarNum_.find(numVar) != zConnectorByVarNum_.end()) {
-        mergeConnectors(zc, zConnectorByVarNum_[numVar], zConnectorsList, zConnectorByVarNum_);
+        mergeConnectors(zc, zConnectorByVarNum_[numVar], mergedConnectors, zConnectorByVarNum_);
         merged = true;
         break;
       }
@@ -206,14 +246,14 @@ ConnectorContainer::mergeZConnector() {
     if (!merged) {
       zConnectorsList.push_back(zc);
       for (const auto& connectedSubModel : zc->connectedSubModels()) {
-        const int numVar = connectedSubModel.subModel()->getVariableIndexGlobal(connectedSubModel.variable());
+        const int numVar = connectedSubModel.variableIndexGlobal();
         zConnectorByVarNum_[numVar] = zc;
       }
     }
   }
 
   // Copy kept yConnectors in the vector
-  zConnectors_.assign(zConnectorsList.begin(), zConnectorsList.end());
+  keepUnmergedConnectors(zConnectorsList, mergedConnectors, zConnectors_);
 }
 
 void
@@ -226,7 +266,7 @@ ConnectorContainer::propagateZConnectionInfoToModel() const {
       throw DYNError(Error::MODELER, EmptyConnector);  // should not happen but who knows ...
     }
     for (const auto& connectedSubModel : zConnector->connectedSubModels()) {
-      const int numVar2 = connectedSubModel.subModel()->getVariableIndexGlobal(connectedSubModel.variable());
+      const int numVar2 = connectedSubModel.variableIndexGlobal();
       zConnectedLocal_[numVar2] = true;
     }
   }
@@ -234,16 +274,17 @@ ConnectorContainer::propagateZConnectionInfoToModel() const {
 
 void
 ConnectorContainer::mergeConnectors(shared_ptr<Connector> connector, shared_ptr<Connector>& reference,
-  list<shared_ptr<Connector> >& connectorsList, std::unordered_map<int, shared_ptr<Connector> >& connectorsByVarNum, const bool flowConnector) {
+  std::unordered_set<shared_ptr<Connector>, boost::hash<shared_ptr<Connector> > >& mergedConnectors,
+  std::unordered_map<int, shared_ptr<Connector> >& connectorsByVarNum, const bool flowConnector) {
   // Looking for common variable to test the negated attributes
   bool negatedMerge = false;
   for (const auto& connectedSubModel : connector->connectedSubModels()) {
-    const int numVar = connectedSubModel.subModel()->getVariableIndexGlobal(connectedSubModel.variable());
+    const int numVar = connectedSubModel.variableIndexGlobal();
     if (connectorsByVarNum.find(numVar) != connectorsByVarNum.end() && connectorsByVarNum[numVar] == reference) {
       // check whether the two connectors have at least one variable in common :
       // if so, the negated attribute of the merge is derived from the shared variable negated attribute comparison
       for (const auto& connectedSubModelRef : connector->connectedSubModels()) {
-        if (connectedSubModelRef.subModel()->getVariableIndexGlobal(connectedSubModelRef.variable()) == numVar) {  // found the two connectedSubModels
+        if (connectedSubModelRef.variableIndexGlobal() == numVar) {  // found the two connectedSubModels
           negatedMerge = connectedSubModelRef.negated() != connectedSubModel.negated();
           break;
         }
@@ -261,7 +302,7 @@ ConnectorContainer::mergeConnectors(shared_ptr<Connector> connector, shared_ptr<
       if (connectorsByVarNum[numVar] == reference) {
         continue;
       } else if (connectorsByVarNum[numVar] != connector) {
-        mergeConnectors(connectorsByVarNum[numVar], reference, connectorsList, connectorsByVarNum, flowConnector);
+        mergeConnectors(connectorsByVarNum[numVar], reference, mergedConnectors, connectorsByVarNum, flowConnector);
         continue;
       }
     }
@@ -270,7 +311,7 @@ ConnectorContainer::mergeConnectors(shared_ptr<Connector> connector, shared_ptr<
   }
 
   // When merging two connectors of the list, only keep reference
-  connectorsList.remove(connector);
+  mergedConnectors.insert(connector);
 }
 
 void
@@ -348,6 +389,7 @@ ConnectorContainer::printConnectors() const {
     return;
 
   Trace::debug(Trace::modeler()) << DYNLog(ModelConnectorsNB, nbContinuousConnectors()) << Trace::endline;
+  Trace::debug(Trace::modeler()) << DYNLog(ModelConnectorsAliasNB, nbYConnectors(), nbFlowConnectors()) << Trace::endline;
   Trace::debug(Trace::modeler()) << "         F : [" << std::setw(6) << offsetModel_ << " ; "
                           << std::setw(6) << offsetModel_ + nbContinuousConnectors() << "[" << Trace::endline;
   Trace::debug(Trace::modeler()) << Trace::endline;
@@ -407,10 +449,10 @@ ConnectorContainer::printYConnectors() const {
     auto it = yConnector->connectedSubModels().begin();
     // First is reference
     const connectedSubModel& reference = *it;
-    const int numVarReference = reference.subModel()->getVariableIndexGlobal(reference.variable());
+    const int numVarReference = reference.variableIndexGlobal();
     ++it;
     for (; it != yConnector->connectedSubModels().end(); ++it) {
-      const int numVar2 = it->subModel()->getVariableIndexGlobal(it->variable());
+      const int numVar2 = it->variableIndexGlobal();
       Trace::debug(Trace::modeler()) << "         Yconnector " << (it->negated() ? "-" : "") << "Y[" << std::setw(6) << numVar2 << "] = "
           << (reference.negated() ? "-" : "") << "Y[" << std::setw(6) << numVarReference << "]"
           << "      F = F[" << std::setw(6) << offsetModel_ + offset
@@ -428,7 +470,7 @@ ConnectorContainer::printFlowConnectors() const {
     ss << "         flowConnector : ";
     bool first = true;
     for (const auto& connectedSubModel : flowConnector->connectedSubModels()) {
-      const int numVar = connectedSubModel.subModel()->getVariableIndexGlobal(connectedSubModel.variable());
+      const int numVar = connectedSubModel.variableIndexGlobal();
       ss << (connectedSubModel.negated() ? "-" : (first ? "" : "+")) << "Y[" << std::setw(6) << numVar << "] ";
       first = false;
     }
@@ -450,10 +492,10 @@ ConnectorContainer::printZConnectors() const {
     auto it = zConnector->connectedSubModels().begin();
     // First is reference
     const connectedSubModel& reference = *it;
-    const int numVarReference = reference.subModel()->getVariableIndexGlobal(reference.variable());
+    const int numVarReference = reference.variableIndexGlobal();
     ++it;
     for (; it != zConnector->connectedSubModels().end(); ++it) {
-      const int numVar2 = it->subModel()->getVariableIndexGlobal(it->variable());
+      const int numVar2 = it->variableIndexGlobal();
       Trace::debug(Trace::modeler()) << "         Zconnector " << (it->negated() ? "-" : "") << "Z[" << std::setw(6) << numVar2 << "] = "
           << (reference.negated() ? "-" : "") << "Z[" << std::setw(6) << numVarReference << "] / "
           << DYNLog(ConnectedModels, it->subModel()->name(), reference.subModel()->name()) << Trace::endline;
@@ -484,83 +526,15 @@ ConnectorContainer::setBufferZ(double* z, bool* zConnected) {
 }
 
 void
-ConnectorContainer::evalFConnector(const double /*t*/) {
-#if defined(_DEBUG_) || defined(PRINT_TIMERS)
-  Timer timer("ConnectorContainer::evalF");
-#endif
-
-  if (index_.empty()) {
-    index_.resize(nbYConnectors() + nbFlowConnectors());
-    factor_.resize(nbYConnectors() + nbFlowConnectors());
-
-    int offset = 0;
-    for (const auto& yConnector : yConnectors_) {
-      if (yConnector->connectedSubModels().empty()) {
-        throw DYNError(Error::MODELER, EmptyConnector);  // should not happen but who knows ...
-      }
-
-      auto it = yConnector->connectedSubModels().begin();
-      // First is reference
-      const connectedSubModel& reference = *it;
-      const int numVarReference = reference.subModel()->getVariableIndexGlobal(reference.variable());
-      ++it;
-      for (; it != yConnector->connectedSubModels().end(); ++it) {
-        vector<unsigned int> index(2, 0);
-        vector<int> factor(2, 1);
-        // First is reference
-        index[0] = numVarReference;
-        // second the other variable
-        index[1] = it->subModel()->getVariableIndexGlobal(it->variable());
-        factor[1] = (reference.negated() == it->negated()) ? -1 : 1;
-        index_[offset] = index;
-        factor_[offset] = factor;
-        ++offset;
-      }
-    }
-
-    // for each flow connector, add a function F = Y0 + Y1;
-    for (const auto& flowConnector : flowConnectors_) {
-      const auto& connectedSubModels = flowConnector->connectedSubModels();
-      const auto connectedSubModelsSize = connectedSubModels.size();
-      vector<unsigned int> index(connectedSubModelsSize, 0);
-      vector<int> factor(connectedSubModelsSize, 1);
-
-      for (unsigned int j = 0; j < connectedSubModelsSize; ++j) {
-        const auto& connectedSubModel = connectedSubModels[j];
-        index[j] = connectedSubModel.subModel()->getVariableIndexGlobal(connectedSubModel.variable());
-        factor[j] = connectedSubModel.negated() ? -1 : 1;
-      }
-      index_[offset] = index;
-      factor_[offset] = factor;
-      ++offset;
-    }
-  }
-
-  for (unsigned int i = 0; i < index_.size(); ++i) {
-    fLocal_[i] = 0;
-    fLocal_[i] = multiplyAndAdd(index_[i], factor_[i]);
-  }
-}
-
-double
-ConnectorContainer::multiplyAndAdd(const vector<unsigned int>& index, const vector<int>& factor) const {
-  double sum = 0;
-  for (unsigned int i = 0; i < index.size(); ++i)
-    sum += factor[i] * yLocal_[index[i]];
-  return sum;
-}
-
-
-void
-ConnectorContainer::evalJtConnector(SparseMatrix& jt) const {
-#if defined(_DEBUG_) || defined(PRINT_TIMERS)
-  Timer timer("ConnectorContainer::evalJ");
-#endif
+ConnectorContainer::buildEquations() const {
+  const std::size_t nbEquations = nbYConnectors() + nbFlowConnectors();
+  equationsOffsets_.clear();
+  equationsIndexes_.clear();
+  equationsFactors_.clear();
+  equationsOffsets_.reserve(nbEquations + 1);
+  equationsOffsets_.push_back(0);
 
   // N equations of type 0 = Y0 - Y1
-  constexpr double dMOne(-1.);
-  constexpr double dPOne(+1.);
-
   for (const auto& yConnector : yConnectors_) {
     if (yConnector->connectedSubModels().empty()) {
       throw DYNError(Error::MODELER, EmptyConnector);  // should not happen but who knows ...
@@ -569,32 +543,64 @@ ConnectorContainer::evalJtConnector(SparseMatrix& jt) const {
     auto it = yConnector->connectedSubModels().begin();
     // First is reference
     const connectedSubModel& reference = *it;
-    const int numVarReference = reference.subModel()->getVariableIndexGlobal(reference.variable());
+    const unsigned int numVarReference = reference.variableIndexGlobal();
     ++it;
     for (; it != yConnector->connectedSubModels().end(); ++it) {
-      const int numVar2 = it->subModel()->getVariableIndexGlobal(it->variable());
-      jt.changeCol();
-      if (reference.negated() == it->negated()) {
-        jt.addTerm(numVarReference, dPOne);  // d(f)/d(Y0) = +1;
-        jt.addTerm(numVar2, dMOne);  // d(f)/d(Y1) = -1;
-      } else {
-        jt.addTerm(numVarReference, dPOne);  // d(f)/d(Y0) = +1;
-        jt.addTerm(numVar2, dPOne);  // d(f)/d(Y1) = +1;
-      }
+      // First is reference
+      equationsIndexes_.push_back(numVarReference);
+      equationsFactors_.push_back(1.);
+      // second the other variable
+      equationsIndexes_.push_back(it->variableIndexGlobal());
+      equationsFactors_.push_back((reference.negated() == it->negated()) ? -1. : 1.);
+      equationsOffsets_.push_back(static_cast<unsigned int>(equationsIndexes_.size()));
     }
   }
 
   // M equations of type 0 = sum(Y)
   for (const auto& flowConnector : flowConnectors_) {
-    jt.changeCol();
     for (const auto& connectedSubModel : flowConnector->connectedSubModels()) {
-      const int numVar = connectedSubModel.subModel()->getVariableIndexGlobal(connectedSubModel.variable());
-      if (connectedSubModel.negated()) {
-        jt.addTerm(numVar, dMOne);  // d(f)/d(Yi) = -1;
-      } else {
-        jt.addTerm(numVar, dPOne);  // d(f)/d(Yi) = +1;
-      }
+      equationsIndexes_.push_back(connectedSubModel.variableIndexGlobal());
+      equationsFactors_.push_back(connectedSubModel.negated() ? -1. : 1.);
     }
+    equationsOffsets_.push_back(static_cast<unsigned int>(equationsIndexes_.size()));
+  }
+}
+
+void
+ConnectorContainer::evalFConnector(const double /*t*/) {
+#if defined(_DEBUG_) || defined(PRINT_TIMERS)
+  Timer timer("ConnectorContainer::evalF");
+#endif
+
+  if (equationsOffsets_.empty())
+    buildEquations();
+
+  // each residual is the sum of the connected variables weighted by their factor
+  const unsigned int* offsets = equationsOffsets_.data();
+  const unsigned int* indexes = equationsIndexes_.data();
+  const double* factors = equationsFactors_.data();
+  for (std::size_t i = 0, iEnd = equationsOffsets_.size() - 1; i < iEnd; ++i) {
+    double sum = 0.;
+    for (unsigned int k = offsets[i]; k < offsets[i + 1]; ++k)
+      sum += factors[k] * yLocal_[indexes[k]];
+    fLocal_[i] = sum;
+  }
+}
+
+void
+ConnectorContainer::evalJtConnector(SparseMatrix& jt) const {
+#if defined(_DEBUG_) || defined(PRINT_TIMERS)
+  Timer timer("ConnectorContainer::evalJ");
+#endif
+
+  if (equationsOffsets_.empty())
+    buildEquations();
+
+  // the equations are linear: d(f)/d(Yi) is the factor of Yi in the equation
+  for (std::size_t i = 0, iEnd = equationsOffsets_.size() - 1; i < iEnd; ++i) {
+    jt.changeCol();
+    for (unsigned int k = equationsOffsets_[i]; k < equationsOffsets_[i + 1]; ++k)
+      jt.addTerm(equationsIndexes_[k], equationsFactors_[k]);
   }
 }
 
@@ -630,30 +636,16 @@ ConnectorContainer::getY0ConnectorForYConnector() const {
     }
 
     // Searching the initialization reference
-    const connectedSubModel* reference = nullptr;
-    bool referenceFound = false;
-    bool zNegated = false;
-    for (const auto& connectedSubModel : yConnector->connectedSubModels()) {
-      const propertyContinuousVar_t* yType = connectedSubModel.subModel()->getYType();
-
-      const unsigned int variableIndex = connectedSubModel.variable()->getIndex();
-      if (yType[variableIndex] != EXTERNAL && yType[variableIndex] != OPTIONAL_EXTERNAL) {  // non external variable
-        reference = &connectedSubModel;
-        referenceFound = true;
-        zNegated = connectedSubModel.negated();
-        break;
-      }
-    }
-
-    if (!referenceFound)
+    const connectedSubModel* reference = getY0Reference(yConnector);
+    if (reference == nullptr)
       continue;
+    const bool zNegated = reference->negated();
 
-    assert(reference != nullptr);
     // Propagating reference init value
-    const int numVarReference = reference->subModel()->getVariableIndexGlobal(reference->variable());
+    const int numVarReference = reference->variableIndexGlobal();
     for (const auto& connectedSubModel : yConnector->connectedSubModels()) {
       if (&connectedSubModel != reference) {
-        const int numVar2 = connectedSubModel.subModel()->getVariableIndexGlobal(connectedSubModel.variable());
+        const int numVar2 = connectedSubModel.variableIndexGlobal();
         if (connectedSubModel.negated() == zNegated) {
           yLocal_[numVar2] = yLocal_[numVarReference];
           ypLocal_[numVar2] = ypLocal_[numVarReference];
@@ -666,6 +658,41 @@ ConnectorContainer::getY0ConnectorForYConnector() const {
   }
 }
 
+const connectedSubModel*
+ConnectorContainer::getY0Reference(const shared_ptr<Connector>& yConnector) const {
+  for (const auto& connectedSubModel : yConnector->connectedSubModels()) {
+    const propertyContinuousVar_t* yType = connectedSubModel.subModel()->getYType();
+    const unsigned int variableIndex = connectedSubModel.variable()->getIndex();
+    if (yType[variableIndex] != EXTERNAL && yType[variableIndex] != OPTIONAL_EXTERNAL)  // non external variable
+      return &connectedSubModel;
+  }
+  return nullptr;
+}
+
+void
+ConnectorContainer::getAliases(vector<int>& keptVariables, vector<double>& signs) const {
+  keptVariables.resize(sizeY_);
+  for (int i = 0; i < sizeY_; ++i)
+    keptVariables[i] = i;
+  signs.assign(sizeY_, 1.);
+
+  for (const auto& yConnector : yConnectors_) {
+    if (yConnector->connectedSubModels().empty())
+      throw DYNError(Error::MODELER, EmptyConnector);  // should not happen but who knows ...
+
+    // the variable kept is the initialization reference, so that the initial values are the same with or without the elimination
+    const connectedSubModel* reference = getY0Reference(yConnector);
+    if (reference == nullptr)
+      reference = &yConnector->connectedSubModels().front();
+    const int numVarReference = reference->variableIndexGlobal();
+    for (const auto& connectedSubModel : yConnector->connectedSubModels()) {
+      const int numVar = connectedSubModel.variableIndexGlobal();
+      keptVariables[numVar] = numVarReference;
+      signs[numVar] = (connectedSubModel.negated() == reference->negated()) ? 1. : -1.;
+    }
+  }
+}
+
 void
 ConnectorContainer::getY0ConnectorForZConnector() const {
   // for each ZConnector, copy z0 from one pin to z0 of the other pin
@@ -680,7 +707,7 @@ ConnectorContainer::getY0ConnectorForZConnector() const {
     bool nonZeroVariableFound = false;
     bool zNegated = false;
     for (const auto& connectedSubModel : zConnector->connectedSubModels()) {
-      const int numVar = connectedSubModel.subModel()->getVariableIndexGlobal(connectedSubModel.variable());
+      const int numVar = connectedSubModel.variableIndexGlobal();
       if (doubleNotEquals(zLocal_[numVar], 0)) {  // non-zero variable
         reference = &connectedSubModel;
         zNegated = connectedSubModel.negated();
@@ -694,10 +721,10 @@ ConnectorContainer::getY0ConnectorForZConnector() const {
 
     assert(reference != nullptr);
     // Propagating reference init value
-    const int numVarReference = reference->subModel()->getVariableIndexGlobal(reference->variable());
+    const int numVarReference = reference->variableIndexGlobal();
     for (const auto& connectedSubModel : zConnector->connectedSubModels()) {
       if (&connectedSubModel != reference) {
-        const int numVar2 = connectedSubModel.subModel()->getVariableIndexGlobal(connectedSubModel.variable());
+        const int numVar2 = connectedSubModel.variableIndexGlobal();
         if (connectedSubModel.negated() == zNegated) {
           zLocal_[numVar2] = zLocal_[numVarReference];
         } else {
@@ -747,7 +774,7 @@ ConnectorContainer::initYUpdatableValues() {
         it != yc->connectedSubModels().end(); ++it) {
         if (it != itInput) {
           double sign = it->negated_ ? -1 : 1;
-          double value = yLocal_[it->subModel()->getVariableIndexGlobal(it->variable())];
+          double value = yLocal_[it->variableIndexGlobal()];
           itInput->subModel()->setParameterValue(UPDATABLE_INPUT_NAME, DYN::FINAL, sign * value, false);
           itInput->subModel()->setSubModelParameters();
         }
@@ -777,7 +804,7 @@ ConnectorContainer::initZUpdatableValues() {
           // Can connect only 1 input and 1 other variable
           throw DYNError(Error::MODELER, ErrorConnectedInputs, it->subModel()->name(), it->variable()->getName());
         }
-        const int numVar = it->subModel()->getVariableIndexGlobal(it->variable());
+        const int numVar = it->variableIndexGlobal();
 
         if (doubleNotEquals(zLocal_[numVar], 0)) {  // non-zero variable
           itInput = it;
@@ -794,7 +821,7 @@ ConnectorContainer::initZUpdatableValues() {
       it != zc->connectedSubModels().end(); ++it) {
       if (it != itInput) {
         double sign = it->negated_ ? -1 : 1;
-        double value = zLocal_[it->subModel()->getVariableIndexGlobal(it->variable())];
+        double value = zLocal_[it->variableIndexGlobal()];
         itInput->subModel()->setParameterValue(UPDATABLE_INPUT_NAME, DYN::FINAL, sign * value, false);
         itInput->subModel()->setSubModelParameters();
       }
@@ -823,7 +850,7 @@ ConnectorContainer::evalStaticFType() const {
 }
 
 void
-ConnectorContainer::propagateZDiff(const vector<int>& indicesDiff, double* z) {
+ConnectorContainer::propagateZDiff(const vector<int>& indicesDiff, double* z, vector<int>* writtenIndexes) {
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
   Timer timer("ConnectorContainer::propagateZDiff");
 #endif
@@ -838,7 +865,7 @@ ConnectorContainer::propagateZDiff(const vector<int>& indicesDiff, double* z) {
     bool zNegated = false;
     bool found = false;
     for (const auto& connectedSubModel : connect->connectedSubModels()) {
-      const int numVar = connectedSubModel.subModel()->getVariableIndexGlobal(connectedSubModel.variable());
+      const int numVar = connectedSubModel.variableIndexGlobal();
       if (numVar == index) {
         found = true;
         zNegated = connectedSubModel.negated();
@@ -849,12 +876,14 @@ ConnectorContainer::propagateZDiff(const vector<int>& indicesDiff, double* z) {
       continue;
 
     for (const auto& connectedSubModel : connect->connectedSubModels()) {
-      const int numVar = connectedSubModel.subModel()->getVariableIndexGlobal(connectedSubModel.variable());
+      const int numVar = connectedSubModel.variableIndexGlobal();
       if (connectedSubModel.negated() == zNegated) {
         z[numVar] = z[index];
       } else {
         z[numVar] = -z[index];
       }
+      if (writtenIndexes && numVar != index)
+        writtenIndexes->push_back(numVar);
     }
   }
 }
@@ -21,9 +21,11 @@
 #define MODELER_COMMON_DYNCONNECTOR_H_
 
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <list>
 #include <boost/shared_ptr.hpp>
+#include <boost/functional/hash.hpp>
 #include "DYNEnumUtils.h"
 #include "DYNVariable.h"
 
@@ -40,7 +42,9 @@ class connectedSubModel {
    * @brief default constructor
    */
   connectedSubModel() :
-  negated_(false) { }
+  negated_(false),
+  localIndex_(-1),
+  discrete_(false) { }
 
   /**
    * @brief constructor
@@ -52,7 +56,9 @@ class connectedSubModel {
   connectedSubModel(const boost::shared_ptr<SubModel>& subModel, const boost::shared_ptr<Variable>& variable, const bool negated) :
   subModel_(subModel),
   variable_(variable),
-  negated_(negated) { }
+  negated_(negated),
+  localIndex_(-1),
+  discrete_(false) { }
 
   /**
    * @brief getter of the submodel connected by the connector
@@ -66,10 +72,20 @@ class connectedSubModel {
    * @brief the variable connected by the connectord inside the sub model
    * @return the variable
    */
-  inline boost::shared_ptr<Variable> variable() const {
+  inline const boost::shared_ptr<Variable>& variable() const {
     return variable_;
   }
 
+  /**
+   * @brief global index of the connected variable, same as SubModel::getVariableIndexGlobal
+   *
+   * The local index and the kind of the variable (continuous or discrete) are resolved through the variable, and through its
+   * reference for an alias, on the first call only: the next calls only add the offset of the sub model.
+   *
+   * @return the variable index in the y or z vector of the whole model
+   */
+  int variableIndexGlobal() const;
+
   /**
    * @brief getter of the negated attribute
    * @return @b true if the opposite of the variable should be used in the connector's equations
@@ -82,6 +98,10 @@ class connectedSubModel {
   boost::shared_ptr<SubModel> subModel_;  ///< submodel connected by the connector
   boost::shared_ptr<Variable> variable_;  ///< the variable
   bool negated_;  ///< @b true if the opposite of the variable should be used in the connector's equations
+
+ private:
+  mutable int localIndex_;  ///< index of the variable in the y or z vector of the sub model, -1 until resolved
+  mutable bool discrete_;  ///< @b true if the variable is stored in the z vector
 };
 
 /**
@@ -170,8 +190,9 @@ class ConnectorContainer {
    *
    * @param indicesDiff index of each z variables which has changed
    * @param z vector of discrete values
+   * @param writtenIndexes if not null, the indexes of the variables written by the propagation are added to it
    */
-  void propagateZDiff(const std::vector<int>& indicesDiff, double* z);
+  void propagateZDiff(const std::vector<int>& indicesDiff, double* z, std::vector<int>* writtenIndexes = nullptr);
 
   /**
    * @brief add a flow connector to the container
@@ -247,17 +268,28 @@ class ConnectorContainer {
    */
   void mergeConnectors();
 
+  /**
+   * @brief get the variables of the Y connectors that can be eliminated as aliases of another one
+   *
+   * The variables connected by a Y connector are equal, or opposite for a negated connection: one of them is kept, the other ones
+   * are aliases of it and the equations of the connector are useless. The variable kept is the one the initial values are propagated from.
+   *
+   * @param keptVariables global index of the variable kept for each continuous variable, the variable itself if it is not an alias
+   * @param signs factor between each continuous variable and the variable kept: 1, or -1 for opposite variables
+   */
+  void getAliases(std::vector<int>& keptVariables, std::vector<double>& signs) const;
+
   /**
    * @brief merge the connectors : no need to declare two connectors when they represent the same connection
    *
    * @param connector the connector to merge (pointer need to be copied to ensure proper functioning of the algo)
    * @param reference the reference connector (to which to add the connector)
-   * @param connectorsList the list of connectors
+   * @param mergedConnectors the connectors merged into another one, to remove from the list of connectors
    * @param connectorsByVarNum the association between (global) variable index and connector
    * @param flowConnector true if the connector is a flow connector
    */
   void mergeConnectors(boost::shared_ptr<Connector> connector, boost::shared_ptr<Connector>& reference,
-                       std::list<boost::shared_ptr<Connector> >& connectorsList,
+                       std::unordered_set<boost::shared_ptr<Connector>, boost::hash<boost::shared_ptr<Connector> > >& mergedConnectors,
                        std::unordered_map<int, boost::shared_ptr<Connector> >& connectorsByVarNum, bool flowConnector = false);
 
   /**
@@ -394,12 +426,11 @@ class ConnectorContainer {
   }
 
   /**
-   * @brief compute the sum (using factor) of variables
-   * @param index index of variables to sum
-   * @param factor factor to use for each variables
-   * @return result of the operation
+   * @brief build the offsets, global indexes and factors of the variables of the equations of the connectors
+   *
+   * The equations are stored contiguously: the variables of the equation i are between the offsets i and i + 1.
    */
-  double multiplyAndAdd(const std::vector<unsigned int>& index, const std::vector<int>& factor) const;
+  void buildEquations() const;
 
   /**
    * @brief get connector's information
@@ -445,6 +476,13 @@ class ConnectorContainer {
    */
   void getY0ConnectorForYConnector() const;
 
+  /**
+   * @brief find the variable of a Y connector whose initial value is propagated to the other ones
+   * @param yConnector Y connector
+   * @return the first variable computed by its sub model, nullptr if all the variables are external
+   */
+  const connectedSubModel* getY0Reference(const boost::shared_ptr<Connector>& yConnector) const;
+
   /**
    * @brief evaluate the initial value of each variables connected to another one for z connector
    */
@@ -482,8 +520,9 @@ class ConnectorContainer {
   bool* zConnectedLocal_;  ///< local buffer to use for connection status of discrete variables
   propertyF_t* fType_;  ///< local buffer to use for properties of residual functions
 
-  std::vector< std::vector<unsigned int> > index_;  ///< global index of variables for evalF by connector;
-  std::vector< std::vector<int> > factor_;  ///< factor to use for evalF by variables by connector (should be 1 or -1)
+  mutable std::vector<unsigned int> equationsOffsets_;  ///< offset of the variables of each equation, then the number of variables
+  mutable std::vector<unsigned int> equationsIndexes_;  ///< global index of the variables of the equations
+  mutable std::vector<double> equationsFactors_;  ///< factor of the variables of the equations (should be 1 or -1)
 
   bool connectorsMerged_;  ///< indicates if the connectors are already merged or not
 };
@@ -67,4 +67,42 @@ Delay::saveTimepoint() {
   buffer_.add(*time_, *value_);
 }
 
+void
+Delay::snapshotState(StateBuffer& state) const {
+  state.write(delayTime_);
+  state.write(delayActivated_);
+  state.write(initialValue_.is_initialized());
+  state.write(initialValue_.value_or(0.));
+
+  std::vector<std::pair<double, double> > timepoints;
+  buffer_.points(timepoints);
+  state.write(timepoints.size());
+  for (const auto& timepoint : timepoints) {
+    state.write(timepoint.first);
+    state.write(timepoint.second);
+  }
+}
+
+void
+Delay::restoreState(StateBuffer::Reader& state) {
+  state.read(delayTime_);
+  state.read(delayActivated_);
+  bool hasInitialValue = false;
+  double initialValue = 0.;
+  state.read(hasInitialValue);
+  state.read(initialValue);
+  initialValue_ = boost::make_optional(hasInitialValue, initialValue);
+
+  std::size_t nbTimepoints = 0;
+  state.read(nbTimepoints);
+  buffer_ = RingBuffer(buffer_.maxDelay());
+  for (std::size_t i = 0; i < nbTimepoints; ++i) {
+    double time = 0.;
+    double value = 0.;
+    state.read(time);
+    state.read(value);
+    buffer_.addNoCheck(time, value);
+  }
+}
+
 }  // namespace DYN
@@ -22,6 +22,7 @@
 
 #include "DYNRingBuffer.h"
 #include "DYNCommon.h"
+#include "DYNStateBuffer.h"
 
 #include <boost/optional.hpp>
 #include <cstddef>
@@ -165,6 +166,31 @@ class Delay {
     return buffer_.getLastRegisteredPoint();
   }
 
+  /**
+   * @brief Retrieves the memory used by the records of the delay
+   *
+   * @returns the number of bytes used by the records
+   */
+  size_t getMemoryUsage() const {
+    return buffer_.getMemoryUsage();
+  }
+
+  /**
+   * @brief Write the timepoints and the activation state of the delay in a snapshot
+   *
+   * @param state snapshot to fill
+   */
+  void snapshotState(StateBuffer& state) const;
+
+  /**
+   * @brief Restore the timepoints and the activation state of the delay from a snapshot
+   *
+   * The references to the time and the value are kept
+   *
+   * @param state snapshot to read
+   */
+  void restoreState(StateBuffer::Reader& state);
+
  private:
   const double* time_;                    ///< pointer to time to use for timepoint and delay computation
   const double* value_;                   ///< pointer to value to use for timepoint
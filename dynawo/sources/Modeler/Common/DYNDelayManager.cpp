@@ -22,6 +22,7 @@
 
 #include "DYNCommon.h"
 #include "DYNMacrosMessage.h"
+#include "DYNMemoryUsage.h"
 
 #include <boost/optional.hpp>
 #include <cassert>
@@ -35,21 +36,28 @@ DelayManager::DelayManager() : delays_() {}
 
 void
 DelayManager::addDelay(size_t id, const double* time, const double* value, const double delayMax) {
-  Delay new_delay(time, value, delayMax);
-
-  if (delays_.count(id) > 0) {
+  const auto it = delayIndexById_.find(id);
+  if (it != delayIndexById_.end()) {
     // already present because of load parameters
-    Delay& delay = delays_.at(id);
-    delay.update(time, value, delayMax);
+    delays_[it->second].update(time, value, delayMax);
   } else {
-    delays_.insert(std::make_pair(id, new_delay));
+    insertDelay(id, Delay(time, value, delayMax));
   }
 }
 
+void
+DelayManager::insertDelay(const size_t id, const Delay& delay) {
+  if (delayIndexById_.count(id) > 0)
+    return;
+  delayIndexById_[id] = delays_.size();
+  delays_.push_back(delay);
+  delayIds_.push_back(id);
+}
+
 void
 DelayManager::saveTimepoint() {
-  for (auto& delayPair : delays_)
-    delayPair.second.saveTimepoint();
+  for (auto& delay : delays_)
+    delay.saveTimepoint();
 }
 
 double
@@ -71,13 +79,13 @@ DelayManager::dumpDelays() const {
   std::stringstream ss;
   std::vector<std::string> ret;
 
-  for (const auto& delayPair : delays_) {
-    const auto& delay = delayPair.second;
+  for (size_t i = 0; i < delays_.size(); ++i) {
+    const auto& delay = delays_[i];
     ss.str("");
     std::vector<std::pair<double, double> > values;
     delay.points(values);
 
-    ss << delayPair.first << ":";
+    ss << delayIds_[i] << ":";
     ss << double2String(delay.getDelayMax()) << ":";
     for (const auto& value : values) {
       ss << double2String(value.first) << "," << double2String(value.second) << ";";
@@ -155,19 +163,92 @@ DelayManager::loadDelays(const std::vector<std::string>& values, const double re
       }
     }
 
-    Delay new_delay(items, delayMax, restartTime);
-    delays_.insert(std::make_pair(id, new_delay));
+    insertDelay(id, Delay(items, delayMax, restartTime));
   }
 
   return true;
 }
 
+void
+DelayManager::dumpDelays(std::vector<double>& values) const {
+  std::vector<std::pair<double, double> > timepoints;
+  for (size_t i = 0; i < delays_.size(); ++i) {
+    timepoints.clear();
+    delays_[i].points(timepoints);
+    values.push_back(static_cast<double>(delayIds_[i]));
+    values.push_back(delays_[i].getDelayMax());
+    values.push_back(static_cast<double>(timepoints.size()));
+    for (const auto& timepoint : timepoints) {
+      values.push_back(timepoint.first);
+      values.push_back(timepoint.second);
+    }
+  }
+}
+
+bool
+DelayManager::loadDelays(const std::vector<double>& values, const double restartTime) {
+  std::vector<std::pair<double, double> > items;
+  size_t index = 0;
+  while (index < values.size()) {
+    if (values.size() - index < 3)
+      return false;
+    const size_t id = static_cast<size_t>(values[index]);
+    const double delayMax = values[index + 1];
+    const size_t nbTimepoints = static_cast<size_t>(values[index + 2]);
+    index += 3;
+    if ((values.size() - index) / 2 < nbTimepoints)
+      return false;
+
+    items.clear();
+    for (size_t i = 0; i < nbTimepoints; ++i, index += 2) {
+      const double time = values[index];
+      if (!items.empty()) {
+        if (doubleEquals(time, items.back().first))
+          continue;  // if with IDA we dump two times with the same time step we skip one
+        if (items.back().first > time)
+          return false;
+      }
+      items.emplace_back(time, values[index + 1]);
+    }
+    if (items.empty())
+      return false;
+
+    insertDelay(id, Delay(items, delayMax, restartTime));
+  }
+
+  return true;
+}
+
+void
+DelayManager::snapshotDelays(StateBuffer& state) const {
+  state.write(delays_.size());
+  for (size_t i = 0; i < delays_.size(); ++i) {
+    state.write(delayIds_[i]);
+    delays_[i].snapshotState(state);
+  }
+}
+
+void
+DelayManager::restoreDelays(StateBuffer::Reader& state) {
+  std::size_t nbDelays = 0;
+  state.read(nbDelays);
+  if (nbDelays != delays_.size())
+    throw DYNError(Error::GENERAL, StateSnapshotMismatch, delays_.size(), nbDelays);
+  for (std::size_t i = 0; i < nbDelays; ++i) {
+    std::size_t id = 0;
+    state.read(id);
+    const auto it = delayIndexById_.find(id);
+    if (it == delayIndexById_.end())
+      throw DYNError(Error::GENERAL, StateSnapshotMismatch, delays_.size(), nbDelays);
+    delays_[it->second].restoreState(state);
+  }
+}
+
 void
 DelayManager::setGomc(state_g* p_glocal, const size_t offset, const double time) const {
   size_t index = offset;
 
-  for (const auto& delayPair : delays_) {
-    const auto& delay = delayPair.second;
+  for (const auto& delay : delays_) {
     const double delayTime = delay.getDelayTime();
     if (!(time < delayTime || doubleEquals(time, delayTime)) && !delay.isTriggered()) {
       p_glocal[index] = ROOT_UP;
@@ -181,16 +262,24 @@ DelayManager::setGomc(state_g* p_glocal, const size_t offset, const double time)
 modeChangeType_t
 DelayManager::evalMode(const double time, const std::string& modelName) {
   modeChangeType_t delay_mode = NO_MODE;
-  for (auto& delayPair : delays_) {
-    auto& delay = delayPair.second;
+  for (size_t i = 0; i < delays_.size(); ++i) {
+    auto& delay = delays_[i];
     double delayTime = delay.getDelayTime();
     if (!(time < delayTime || doubleEquals(time, delayTime)) && !delay.isTriggered()) {
       delay.trigger();
-      Trace::debug() << DYNLog(DelayMode, modelName, delayPair.first, delayTime) << Trace::endline;
+      Trace::debug() << DYNLog(DelayMode, modelName, delayIds_[i], delayTime) << Trace::endline;
       delay_mode = ALGEBRAIC_J_UPDATE_MODE;
     }
   }
   return delay_mode;
 }
 
+size_t
+DelayManager::getMemoryUsage() const {
+  size_t memoryUsage = MemoryUsage::bytes(delays_) + MemoryUsage::bytes(delayIds_) + MemoryUsage::bytes(delayIndexById_);
+  for (const auto& delay : delays_)
+    memoryUsage += delay.getMemoryUsage();
+  return memoryUsage;
+}
+
 }  // namespace DYN
@@ -24,6 +24,7 @@
 #include "DYNEnumUtils.h"
 
 #include <unordered_map>
+#include <vector>
 
 
 namespace DYN {
@@ -81,7 +82,7 @@ class DelayManager {
    * @returns whether the id is allowed
    */
   bool isIdAcceptable(size_t id) const {
-    return delays_.count(id) > 0;
+    return delayIndexById_.count(id) > 0;
   }
 
   /**
@@ -107,6 +108,16 @@ class DelayManager {
    */
   std::vector<std::string> dumpDelays() const;
 
+  /**
+   * @brief Write the delays in binary form
+   *
+   * For each delay, the values are: id, maximum delay, number of timepoints, then the time and the value of each timepoint.
+   * Unlike dumpDelays, the timepoints are written without loss of precision.
+   *
+   * @param values the values to fill
+   */
+  void dumpDelays(std::vector<double>& values) const;
+
   /**
    * @brief Load delays from their formatted version
    *
@@ -117,6 +128,34 @@ class DelayManager {
    */
   bool loadDelays(const std::vector<std::string>& values, double restartTime);
 
+  /**
+   * @brief Load delays from their binary form
+   *
+   * @param values the delays definition, written by dumpDelays(std::vector<double>&)
+   * @param restartTime of the restart
+   *
+   * @returns false if the values are inconsistent, true if not
+   */
+  bool loadDelays(const std::vector<double>& values, double restartTime);
+
+  /**
+   * @brief Write the state of the delays in a snapshot
+   *
+   * Unlike dumpDelays, the values are written in raw binary, to be restored in the same simulation by restoreDelays
+   *
+   * @param state snapshot to fill
+   */
+  void snapshotDelays(StateBuffer& state) const;
+
+  /**
+   * @brief Restore the state of the delays from a snapshot written by snapshotDelays
+   *
+   * @param state snapshot to read
+   *
+   * @throw StateSnapshotMismatch error if the delays of the snapshot are not the registered ones
+   */
+  void restoreDelays(StateBuffer::Reader& state);
+
   /**
    * @brief calculates the roots of the model for delays
    *
@@ -144,7 +183,7 @@ class DelayManager {
    * @param id the delay id
    */
   void triggerDelay(const size_t id) {
-    delays_.at(id).trigger();
+    delays_[delayIndexById_.at(id)].trigger();
   }
 
   /**
@@ -156,7 +195,7 @@ class DelayManager {
   * @returns the corresponding delay
   */
   const Delay& getDelayById(size_t id) const {
-    return delays_.at(id);
+    return delays_[delayIndexById_.at(id)];
   }
 
   /**
@@ -166,11 +205,29 @@ class DelayManager {
    * @param delayTime the time of the delay
    */
   void setDelayTime(const size_t id, const double delayTime) {
-    delays_.at(id).setDelayTime(delayTime);
+    delays_[delayIndexById_.at(id)].setDelayTime(delayTime);
   }
 
+  /**
+   * @brief Retrieves the memory used by the registered delays
+   *
+   * @returns the number of bytes used by the delays and their records
+   */
+  size_t getMemoryUsage() const;
+
+ private:
+  /**
+   * @brief Add a delay loaded from a dump
+   *
+   * @param id the id of the delay
+   * @param delay the delay
+   */
+  void insertDelay(size_t id, const Delay& delay);
+
  private:
-  std::unordered_map<size_t, Delay> delays_;  ///< list of registered delayed values
+  std::vector<Delay> delays_;  ///< registered delayed values, stored contiguously in their order of registration
+  std::vector<size_t> delayIds_;  ///< id of each registered delay
+  std::unordered_map<size_t, size_t> delayIndexById_;  ///< index in delays_ of each delay id
 };
 }  // namespace DYN
 
@@ -18,6 +18,8 @@
 
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+#include <cstdlib>
 #include <memory>
 
 // files in API parameter
@@ -26,16 +28,16 @@
 #include "PARParametersSetCollection.h"
 #include "PARReference.h"
 #include "PARReferenceFactory.h"
-#include "PARXmlImporter.h"
+#include "PARParametersSetCollectionCache.h"
 
 #include "DYNMacrosMessage.h"
 #include "DYNTrace.h"
 #include "DYNErrorQueue.h"
 #include "DYNFileSystemUtils.h"
+#include "DYNExecUtils.h"
 #include "DYNModelDescription.h"
 #include "DYNDynamicData.h"
 #include "DYNDataInterface.h"
-#include "DYNCommonModeler.h"
 
 // files in API_DYD
 #include "DYDDynamicModelsCollection.h"
@@ -192,8 +194,53 @@ DynamicData::mappingModelicaModels() {
   }
 }
 
+void
+DynamicData::preloadParametersFiles() const {
+  unsigned int nbThreads = 1;
+  if (hasEnvVar("DYNAWO_NB_PARAMETERS_IMPORT_THREADS"))
+    nbThreads = static_cast<unsigned int>(std::max(std::atoi(getEnvVar("DYNAWO_NB_PARAMETERS_IMPORT_THREADS").c_str()), 1));
+  if (nbThreads <= 1)
+    return;
+
+  vector<string> parFiles;
+  for (const auto& modelDescriptionPair : modelDescriptions_) {
+    const std::shared_ptr<dynamicdata::Model> model = modelDescriptionPair.second->getModel();
+    switch (model->getType()) {
+      case Model::MODEL_TEMPLATE:
+        break;
+      case Model::MODELICA_MODEL: {
+        const std::shared_ptr<ModelicaModel> modelicaModel = std::dynamic_pointer_cast<ModelicaModel>(model);
+        for (const auto& unitDynamicModelPair : modelicaModel->getUnitDynamicModels())
+          parFiles.push_back(unitDynamicModelPair.second->getParFile());
+        break;
+      }
+      case Model::BLACK_BOX_MODEL:
+        parFiles.push_back(std::dynamic_pointer_cast<BlackBoxModel>(model)->getParFile());
+        break;
+      case Model::MODEL_TEMPLATE_EXPANSION:
+        parFiles.push_back(std::dynamic_pointer_cast<ModelTemplateExpansion>(model)->getParFile());
+        break;
+    }
+  }
+
+  // the files are found as in getParametersSet, the files that cannot be found are reported there
+  vector<string> canonicalParFilePaths;
+  for (const auto& parFile : parFiles) {
+    if (parFile.empty())
+      continue;
+    try {
+      const string canonicalParFilePath = canonical(parFile, rootDirectory_);
+      if (referenceParameters_.find(canonicalParFilePath) == referenceParameters_.end())
+        canonicalParFilePaths.push_back(canonicalParFilePath);
+    } catch (const boost::filesystem::filesystem_error&) {
+    }
+  }
+  parameters::ParametersSetCollectionCache::instance().preload(canonicalParFilePaths, nbThreads);
+}
+
 void
 DynamicData::associateParameters() {
+  preloadParametersFiles();
   for (const auto& modelDescriptionPair : modelDescriptions_) {
     const auto& modelDescription = modelDescriptionPair.second;
     std::shared_ptr<dynamicdata::Model> model = modelDescription->getModel();
@@ -263,9 +310,9 @@ DynamicData::getParametersSet(const string& modelId, const string& parFile, cons
   if (referenceParameters_.find(canonicalParFilePath) != referenceParameters_.end())
     return referenceParameters_[canonicalParFilePath]->getParametersSet(parId);
 
-  // Parameters file not already loaded
-  const parameters::XmlImporter parametersImporter;
-  const std::shared_ptr<ParametersSetCollection> parametersSetCollection = parametersImporter.importFromFile(canonicalParFilePath);
+  // Parameters file not already loaded in this simulation, only parsed if it was not parsed by a previous one
+  const std::shared_ptr<ParametersSetCollection> parametersSetCollection =
+      parameters::ParametersSetCollectionCache::instance().importFromFile(canonicalParFilePath);
   parametersSetCollection->propagateOriginData(canonicalParFilePath);
   referenceParameters_[canonicalParFilePath] = parametersSetCollection;
   parametersSetCollection->getParametersFromMacroParameter();
@@ -360,15 +407,10 @@ DynamicData::createModelDescriptions() {
     systemConnects_.push_back(connector);
   }
 
-  static const string indexLabel = "@INDEX@";
-  static const string nameLabel = "@NAME@";
-  // expand macro connects as connector
+  // macro connects are kept as is and expanded when the connect interfaces are created
   // for internal model macro connects, it's made before the compilation
   for (const auto& macroConnect : dynamicModelsCollection_->getMacroConnects()) {
     const string& connector = macroConnect->getConnector();
-    const string& model1 = macroConnect->getFirstModelId();
-    const string& model2 = macroConnect->getSecondModelId();
-
     const std::shared_ptr<dynamicdata::MacroConnector> macroConnector = dynamicModelsCollection_->findMacroConnector(connector);
 
     // check if macroConnector has no init connect
@@ -376,15 +418,7 @@ DynamicData::createModelDescriptions() {
     if (!initConnector.empty())
       throw DYNError(DYN::Error::MODELER, SystemInitConnectorForbidden, connector);
 
-    // for each connect, create a system connect
-    for (const auto& connectorPair : macroConnector->getConnectors()) {
-      string var1 = connectorPair.second->getFirstVariableId();
-      string var2 = connectorPair.second->getSecondVariableId();
-      replaceMacroInVariableId(macroConnect->getIndex1(), macroConnect->getName1(), model1, model2, connector, var1);
-      replaceMacroInVariableId(macroConnect->getIndex2(), macroConnect->getName2(), model1, model2, connector, var2);
-
-      systemConnects_.push_back(std::make_shared<dynamicdata::Connector>(model1, var1, model2, var2));
-    }
+    systemMacroConnects_.push_back(macroConnect);
   }
 }
 
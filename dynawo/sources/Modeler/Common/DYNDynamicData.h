@@ -41,6 +41,7 @@ class UnitDynamicModel;
 class Model;
 class Connector;
 class NetworkConnector;
+class MacroConnect;
 }  // namespace dynamicdata
 
 namespace DYN {
@@ -98,6 +99,14 @@ class DynamicData : public boost::noncopyable {
     referenceParameters_ = parametersRef;
   }
 
+  /**
+   * @brief get the parameter sets read, including the ones of the network
+   * @return filepath->parameter sets collection
+   */
+  inline const std::unordered_map<std::string, std::shared_ptr<parameters::ParametersSetCollection> >& getParametersReference() const {
+    return referenceParameters_;
+  }
+
   /**
    * @brief get all dynamic model descriptions
    * @return list of model descriptions
@@ -114,6 +123,14 @@ class DynamicData : public boost::noncopyable {
     return systemConnects_;
   }
 
+  /**
+   * @brief get all system-wide macro connects, expanded by the compiler when the connect interfaces are created
+   * @return list of macro connects
+   */
+  inline const std::vector<std::shared_ptr<dynamicdata::MacroConnect> >& getSystemMacroConnects() const {
+    return systemMacroConnects_;
+  }
+
   /**
    * @brief add a connect interface to the list of all connectors
    *
@@ -240,6 +257,13 @@ class DynamicData : public boost::noncopyable {
    */
   void associateParameters();
 
+  /**
+   * @brief parse concurrently the parameters files of the models not parsed yet in the process
+   *
+   * The number of threads is given by the environment variable DYNAWO_NB_PARAMETERS_IMPORT_THREADS (1 by default).
+   */
+  void preloadParametersFiles() const;
+
   /**
    * @brief analyse dynamic data
    */
@@ -268,6 +292,7 @@ class DynamicData : public boost::noncopyable {
   /// warning : keep map container to be sure that models are always sorted with the same order whatever is the order in input file to avoid mathematical issues
   std::map<std::string, std::shared_ptr<ModelDescription> > modelDescriptions_;  ///< map of model descriptions
   std::vector<std::shared_ptr<dynamicdata::Connector> > systemConnects_;  ///< connects which are not fully inside a model
+  std::vector<std::shared_ptr<dynamicdata::MacroConnect> > systemMacroConnects_;  ///< macro connects which are not fully inside a model
   std::map<std::string, std::unique_ptr<ConnectInterface> > connects_;  ///< connects interfaces
 
   // generate by classifyModelDescriptions in DydAnalyser
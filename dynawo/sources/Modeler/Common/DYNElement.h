@@ -80,7 +80,7 @@ class Element {
    * @brief get id
    * @return id
    */
-  inline std::string id() const {
+  inline const std::string& id() const {
     return id_;
   }
 
@@ -20,11 +20,13 @@
 #ifndef MODELER_COMMON_DYNMODEL_H_
 #define MODELER_COMMON_DYNMODEL_H_
 
+#include <functional>
 #include <vector>
 #include <map>
 #include <string>
 #include <boost/shared_ptr.hpp>
 #include "DYNEnumUtils.h"
+#include "DYNStateBuffer.h"
 #include "PARParametersSet.h"
 
 namespace timeline {
@@ -41,7 +43,9 @@ class CurvesCollection;
 }  // namespace curves
 
 namespace DYN {
+class MemoryUsage;
 class SparseMatrix;
+class ThreadPool;
 
 #ifdef __clang__
 #pragma clang diagnostic push
@@ -391,6 +395,18 @@ class Model {
    */
   virtual void evalCalculatedVariables(double t, const std::vector<double>& y, const std::vector<double>& yp, const std::vector<double>& z) = 0;
 
+  /**
+   * @brief evaluate only the calculated variables needed for curves
+   *
+   * To be preferred to evalCalculatedVariables when no other output (final state, criteria) reads the calculated variables.
+   *
+   * @param t current time
+   * @param y current values of continuous variables
+   * @param yp current values of the derivative of the continuous variables
+   * @param z values of the discrete variables
+   */
+  virtual void evalCalculatedVariablesForCurves(double t, const std::vector<double>& y, const std::vector<double>& yp, const std::vector<double>& z) = 0;
+
   /**
    * @brief update the subset of calculated variables needed for curves
    */
@@ -427,6 +443,14 @@ class Model {
    */
   virtual void dumpVariables(std::map< std::string, std::string>& mapVariables) = 0;
 
+  /**
+   * @brief export the parameters and the variables of the model for dump, one sub model after the other
+   *
+   * @param writeEntries function called with the map associating the file where parameters/variables should be dumped with
+   * the stream of values, for each sub model, so that the dump can be written without holding the whole state in memory
+   */
+  virtual void dumpParametersAndVariables(const std::function<void(const std::map< std::string, std::string>&)>& writeEntries) = 0;
+
   /**
    * @brief  load the variables values from a previous dump
    *
@@ -434,6 +458,20 @@ class Model {
    */
   virtual void loadVariables(const std::map< std::string, std::string>& mapVariables) = 0;
 
+  /**
+   * @brief write the current state of the model in a snapshot, to restore it in memory later on
+   *
+   * @param state snapshot to fill
+   */
+  virtual void snapshotState(StateBuffer& state) const = 0;
+
+  /**
+   * @brief restore the state of the model written by snapshotState
+   *
+   * @param state snapshot to read
+   */
+  virtual void restoreState(StateBuffer::Reader& state) = 0;
+
   /**
    * @brief copy current values in "pre" buffers (need for modelica sub models)
    *
@@ -528,6 +566,48 @@ class Model {
    */
   virtual void notifyTimeStep() = 0;
 
+  /**
+   * @brief enable or disable the observation of the activity of the sub models at each time step
+   *
+   * The observation compares all the continuous variables at each time step: it is disabled by default.
+   *
+   * @param enabled @b true to observe the activity of the sub models and print their latency partition
+   */
+  virtual void setLatencyPartitionEnabled(bool enabled) = 0;
+
+  /**
+   * @brief print the partition of the sub models into fast and slow groups observed during the simulation
+   *
+   * A sub model is slow when its continuous variables moved during only a small fraction of the time steps: it is a
+   * candidate to be integrated with larger steps than the rest of the model.
+   * Nothing is printed if the observation of the activity of the sub models is disabled.
+   */
+  virtual void printLatencyPartition() const = 0;
+
+  /**
+   * @brief print the evaluation costs accounted for each sub model and for each model type, sorted by decreasing time
+   *
+   * Nothing is printed if the accounting of the evaluation costs is disabled.
+   */
+  virtual void printSubModelCosts() const = 0;
+
+  /**
+   * @brief account the memory allocated by the global buffers of the model and by its sub models
+   *
+   * @param usage memory usage to complete
+   */
+  virtual void accountMemory(MemoryUsage& usage) const = 0;
+
+  /**
+   * @brief get the sub model owning each equation and each variable
+   *
+   * The connection equations do not belong to any sub model: their index is -1.
+   *
+   * @param fBlocks index of the sub model owning each equation
+   * @param yBlocks index of the sub model owning each variable
+   */
+  virtual void getSubModelPartition(std::vector<int>& fBlocks, std::vector<int>& yBlocks) const = 0;
+
   /**
    * @brief set the local initialization solver parameters of the model
    * @param localInitParameters local initialization solver parameters set
@@ -539,6 +619,117 @@ class Model {
    * @param actionString string containing the action properties
    */
   virtual void registerAction(const std::string& actionString) = 0;
+
+  /**
+   * @brief register a batch of actions at once
+   *
+   * The actions targeting the same sub model are merged, so that it is reinitialized once for the whole batch.
+   *
+   * @param actionStrings strings containing the actions properties, in order of reception
+   */
+  virtual void registerActions(const std::vector<std::string>& actionStrings) = 0;
+
+  /**
+   * @brief register a parameter of a sub model that actions will set through a handle, without parsing nor lookup
+   *
+   * Each call takes the next handle, starting from 0, even if the parameter cannot be used.
+   *
+   * @param subModelName name of the sub model
+   * @param parameterName name of the dynamic parameter, of type double, int or bool
+   * @return handle of the parameter, -1 if the parameter cannot be used in actions
+   */
+  virtual int registerActionHandle(const std::string& subModelName, const std::string& parameterName) = 0;
+
+  /**
+   * @brief register a batch of actions setting parameters through their handles
+   *
+   * @param values pairs <handle, value>, int and bool parameters being converted from the value
+   */
+  virtual void registerActionValues(const std::vector<std::pair<int, double> >& values) = 0;
+
+  /**
+   * @brief set the number of threads used to evaluate the sub models
+   * @param nbThreads number of threads, 1 for a sequential evaluation
+   */
+  virtual void setNbThreads(unsigned nbThreads) = 0;
+
+  /**
+   * @brief get the pool of threads evaluating the sub models, which the solvers may also use between two evaluations
+   * @return the pool of threads, nullptr if the sub models are evaluated sequentially
+   */
+  virtual ThreadPool* getThreadPool() const = 0;
+
+  /**
+   * @brief enable or disable the incremental evaluation of the root functions
+   *
+   * In incremental mode, the root functions of a sub model are only evaluated again if their inputs changed since the last evaluation.
+   *
+   * @param incremental @b true to skip the evaluation of the sub models whose root functions inputs did not change
+   */
+  virtual void setIncrementalRootEvaluation(bool incremental) = 0;
+
+  /**
+   * @brief enable or disable the incremental evaluation of the residual functions
+   *
+   * In incremental mode, the residual functions of a sub model are only evaluated again if their inputs changed since the last evaluation,
+   * the residuals of the last evaluation being used otherwise.
+   *
+   * @param incremental @b true to skip the evaluation of the sub models whose residual functions inputs did not change
+   */
+  virtual void setIncrementalResidualEvaluation(bool incremental) = 0;
+
+  /**
+   * @brief get the first scheduled time event strictly after a given time
+   *
+   * The scheduled time events are the times registered by the sub models at which their root functions change because of time only.
+   *
+   * @param t time after which the event is searched
+   * @return the time of the next scheduled event, or the largest double value if there is none
+   */
+  virtual double getNextTimeEvent(double t) const = 0;
+
+  /**
+   * @brief enable or disable the event-driven evaluation of the discrete variables and modes
+   *
+   * In event-driven mode, after notifyRootsChange, the discrete variables and modes are only evaluated for the sub models
+   * concerned by the event.
+   *
+   * @param eventDriven @b true to skip the sub models not concerned by the event
+   */
+  virtual void setEventDrivenDiscreteEvaluation(bool eventDriven) = 0;
+
+  /**
+   * @brief enable or disable the batched evaluation of the sub models sharing the same model
+   *
+   * In batched mode, the residual and root functions of the sub models sharing the same model are evaluated together,
+   * through a single entry point of the model looping over the instances.
+   *
+   * @param batch @b true to evaluate the sub models by batches
+   */
+  virtual void setBatchEvaluation(bool batch) = 0;
+
+  /**
+   * @brief enable or disable the elimination of the alias variables of the connections between continuous variables
+   *
+   * The continuous variables connected together are equal, or opposite: only one of them is solved, the other ones being set
+   * from it before each evaluation, and the equations of their connections are removed. The variables and residual functions
+   * exchanged with the solvers (sizes, types, values, Jacobian, indexes) are then the ones of this reduced system.
+   *
+   * @param eliminate @b true to eliminate the alias variables
+   */
+  virtual void setAliasElimination(bool eliminate) = 0;
+
+  /**
+   * @brief notify the model of the root functions changes leading to the next discrete variables evaluation
+   *
+   * In event-driven mode, the following evalZ and evalMode calls only evaluate the sub models owning one of the changed
+   * root functions, the sub models whose discrete variables changed since, directly or through a connection, and the sub
+   * models that cannot be skipped. The restriction ends with the next evalMode call.
+   *
+   * @param gBefore values of the root functions before the event
+   * @param gAfter values of the root functions after the event
+   */
+  virtual void notifyRootsChange(const std::vector<state_g>& gBefore, const std::vector<state_g>& gAfter) = 0;
 };  ///< Generic class for Model
 
 #ifdef __clang__
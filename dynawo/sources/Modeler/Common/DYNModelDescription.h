@@ -28,6 +28,9 @@
 #include "PARParametersSet.h"
 #include "PARParametersSetFactory.h"
 
+namespace dynamicdata {
+class MacroStaticReference;
+}  // namespace dynamicdata
 
 namespace DYN {
 class SubModel;
@@ -113,16 +116,36 @@ class ModelDescription {
    * @brief get all static references
    * @returns list of static references
    */
-  inline const std::vector<boost::shared_ptr<StaticRefInterface> > getStaticRefInterfaces() const {
+  inline const std::vector<boost::shared_ptr<StaticRefInterface> >& getStaticRefInterfaces() const {
     return staticRefInterfaces_;
   }
 
+  /**
+   * @brief add a macro static reference used by the model
+   *
+   * The static references of the macro are shared by all the models using it: they are resolved with the id of the model
+   * when the model is instantiated.
+   * @param macroStaticReference macro static reference
+   */
+  inline void addMacroStaticReference(const std::shared_ptr<dynamicdata::MacroStaticReference>& macroStaticReference) {
+    macroStaticReferences_.push_back(macroStaticReference);
+  }
+
+  /**
+   * @brief get the macro static references used by the model
+   * @returns list of macro static references
+   */
+  inline const std::vector<std::shared_ptr<dynamicdata::MacroStaticReference> >& getMacroStaticReferences() const {
+    return macroStaticReferences_;
+  }
+
   /**
    * @brief reset static references list
    *
    */
   inline void resetStaticRefInterfaces() {
     staticRefInterfaces_.clear();
+    macroStaticReferences_.clear();
   }
 
   /**
@@ -204,6 +227,7 @@ class ModelDescription {
   boost::weak_ptr<SubModel> subModel_;  ///< submodel associated to the model description
   std::shared_ptr<parameters::ParametersSet> parameters_;  ///< set of parameters associated to the model
   std::vector<boost::shared_ptr<StaticRefInterface> > staticRefInterfaces_;  ///< Static reference
+  std::vector<std::shared_ptr<dynamicdata::MacroStaticReference> > macroStaticReferences_;  ///< macro static references used by the model
   std::string compiledModelId_;  ///< Compiled Model ID
   std::string lib_;  ///< compiled lib .so
   bool hasCompiledModel_;  ///< @b true if the model has a compiled model, @b false else
@@ -18,11 +18,15 @@
  *
  */
 #include <cmath>
+#include <functional>
 #include <vector>
 #include <string>
 #include <map>
+#include <unordered_map>
 #include <fstream>
+#include <sstream>
 #include <algorithm>
+#include <limits>
 
 #include "TLTimeline.h"
 #include "CRVCurve.h"
@@ -30,6 +34,7 @@
 #include "CSTRConstraintsCollection.h"
 
 #include "DYNMacrosMessage.h"
+#include "DYNMemoryUsage.h"
 #include "DYNSparseMatrix.h"
 #include "DYNModelMulti.h"
 #include "DYNSubModel.h"
@@ -37,6 +42,8 @@
 #include "DYNTrace.h"
 #include "DYNElement.h"
 #include "DYNTimer.h"
+#include "DYNProfiler.h"
+#include "DYNThreadPool.h"
 #include "DYNConnectorCalculatedDiscreteVariable.h"
 #include "DYNConnectorCalculatedVariable.h"
 #include "DYNCommon.h"
@@ -59,6 +66,12 @@ using std::fstream;
 
 namespace DYN {
 
+static const double LATENCY_TOLERANCE = 1e-3;  ///< relative change of a variable above which its sub model is active at a time step
+static const double SLOW_ACTIVITY_RATIO = 0.1;  ///< maximum ratio of active time steps of a slow sub model
+static const size_t NB_PARTITIONS_BY_THREAD = 4;  ///< number of ranges of sub models by thread, taken dynamically by the threads
+static const unsigned NB_EVALF_BEFORE_MEASURED_COSTS = 100;  ///< evaluations between two checks for measured costs to balance the ranges
+static const unsigned int MAX_REPORTED_SUBMODEL_COSTS = 20;  ///< number of most expensive sub models reported at the info level
+
 ModelMulti::ModelMulti() :
 sizeF_(0),
 sizeZ_(0),
@@ -69,18 +82,30 @@ silentZChange_(NO_Z_CHANGE),
 modeChange_(false),
 modeChangeType_(NO_MODE),
 offsetFOptional_(0),
+fLocal_(nullptr),
+gLocal_(nullptr),
+yLocal_(nullptr),
+ypLocal_(nullptr),
+zLocal_(nullptr),
 zConnectedLocal_(nullptr),
 silentZInitialized_(false),
-updatablesInitialized_(false) {
+updatablesInitialized_(false),
+nbInitThreads_(1),
+partitionsWithMeasuredCosts_(false),
+nbEvalFSincePartitions_(0),
+latencyPartitionEnabled_(false),
+nbNotifiedSteps_(0),
+incrementalRootEvaluation_(false),
+incrementalResidualEvaluation_(false),
+batchEvaluation_(false),
+eventDrivenDiscreteEvaluation_(false),
+eventSubModelsKnown_(false),
+zSaveOutdated_(true),
+aliasElimination_(false) {
   connectorContainer_.reset(new ConnectorContainer());
 }
 
-ModelMulti::~ModelMulti() {
-  if (zConnectedLocal_ != nullptr) {
-    delete[] zConnectedLocal_;
-    zConnectedLocal_ = nullptr;
-  }
-}
+ModelMulti::~ModelMulti() = default;
 
 void
 ModelMulti::setTimeline(const boost::shared_ptr<Timeline>& timeline) {
@@ -107,9 +132,82 @@ ModelMulti::setActionBuffer(const std::shared_ptr<ActionBuffer> actionBuffer) {
 
 void
 ModelMulti::addSubModel(const shared_ptr<SubModel>& sub, const string& libName) {
-  sub->defineVariablesInit();
+  initSubModel(sub, findDefinitionsModel(sub, libName));
+  registerSubModel(sub, libName);
+}
+
+void
+ModelMulti::addSubModels(const vector<shared_ptr<SubModel> >& subs, const vector<string>& libNames, const unsigned nbThreads) {
+  assert(subs.size() == libNames.size());
+  // the definitions shared are the ones of the first instance of the library, as if the sub models were added one by one
+  vector<shared_ptr<SubModel> > definitionsModels(subs.size());
+  std::unordered_map<string, shared_ptr<SubModel> > firstSubModelByLib;
+  for (size_t i = 0; i < subs.size(); ++i) {
+    definitionsModels[i] = findDefinitionsModel(subs[i], libNames[i]);
+    if (libNames[i].empty() || subModelByLib_.find(libNames[i]) != subModelByLib_.end())
+      continue;
+    const auto iter = firstSubModelByLib.insert(std::make_pair(libNames[i], subs[i])).first;
+    if (iter->second != subs[i] && subs[i]->hasStaticDefinitions() && iter->second->hasStaticDefinitions())
+      definitionsModels[i] = iter->second;
+  }
+
+  // the sub models sharing a parameters set are initialized by the same task, as the parameters are marked as used
+  // the sub models defining their definitions are initialized before the ones sharing them
+  for (const bool sharingDefinitions : {false, true}) {
+    vector<vector<size_t> > tasks;
+    std::unordered_map<const parameters::ParametersSet*, size_t> taskByParametersSet;
+    for (size_t i = 0; i < subs.size(); ++i) {
+      if ((definitionsModels[i] != nullptr) != sharingDefinitions)
+        continue;
+      const parameters::ParametersSet* parametersSet = subs[i]->getPARParameters().get();
+      if (parametersSet == nullptr) {
+        tasks.push_back(vector<size_t>(1, i));
+        continue;
+      }
+      const auto iter = taskByParametersSet.insert(std::make_pair(parametersSet, tasks.size())).first;
+      if (iter->second == tasks.size())
+        tasks.push_back(vector<size_t>());
+      tasks[iter->second].push_back(i);
+    }
+
+    const std::function<void(unsigned)> initTask = [&subs, &definitionsModels, &tasks](const unsigned task) {
+      for (const size_t i : tasks[task])
+        initSubModel(subs[i], definitionsModels[i]);
+    };
+    const unsigned nbTasks = static_cast<unsigned>(tasks.size());
+    if (nbThreads > 1 && nbTasks > 1) {
+      ThreadPool threadPool(std::min(nbThreads, nbTasks));
+      threadPool.parallelFor(nbTasks, initTask);
+    } else {
+      for (unsigned task = 0; task < nbTasks; ++task)
+        initTask(task);
+    }
+  }
+
+  for (size_t i = 0; i < subs.size(); ++i)
+    registerSubModel(subs[i], libNames[i]);
+}
+
+shared_ptr<SubModel>
+ModelMulti::findDefinitionsModel(const shared_ptr<SubModel>& sub, const string& libName) const {
+  // the instances of a library whose definitions do not depend on their data share the ones of the first instance
+  if (!libName.empty() && sub->hasStaticDefinitions()) {
+    const auto iter = subModelByLib_.find(libName);
+    if (iter != subModelByLib_.end() && !iter->second.empty() && iter->second.front()->hasStaticDefinitions())
+      return iter->second.front();
+  }
+  return shared_ptr<SubModel>();
+}
+
+void
+ModelMulti::initSubModel(const shared_ptr<SubModel>& sub, const shared_ptr<SubModel>& definitionsModel) {
+  if (definitionsModel) {
+    sub->shareDefinitions(*definitionsModel);
+  } else {
+    sub->defineVariablesInit();
+    sub->defineNamesInit();
+  }
   sub->defineParametersInit();  // only for modelica models
-  sub->defineNamesInit();
   sub->setSharedParametersDefaultValuesInit();
 
   sub->defineParameters();
@@ -119,10 +217,15 @@ ModelMulti::addSubModel(const shared_ptr<SubModel>& sub, const string& libName)
 
   sub->initStaticData();
 
-  sub->defineVariables();
-  sub->defineNames();
-  sub->defineElements();
+  if (!definitionsModel) {
+    sub->defineVariables();
+    sub->defineNames();
+    sub->defineElements();
+  }
+}
 
+void
+ModelMulti::registerSubModel(const shared_ptr<SubModel>& sub, const string& libName) {
   subModelByName_[sub->name()] = subModels_.size();
   if (!libName.empty()) {
     subModelByLib_[libName].push_back(sub);
@@ -157,16 +260,28 @@ ModelMulti::initBuffers() {
   offsetFOptional_ = sizeF_;
   sizeF_ += numVarsOptional_.size();  /// fictitious equation will be added for unconnected optional external variables
   evalStaticFType();
+  partitions_.clear();
+  batchBoundaries_.clear();
 
   // (2) Initialize buffers that would be used during the simulation (avoid copy)
   // ----------------------------------------------------------------------------
-  fLocal_ = std::vector<double>(sizeF_);
-  gLocal_ = std::vector<state_g>(sizeG_, ROOT_DOWN);
-  yLocal_ = std::vector<double>(sizeY_);
-  ypLocal_ = std::vector<double>(sizeY_);
-  zLocal_ = std::vector<double>(sizeZ_);
-  zConnectedLocal_ = new bool[sizeZ_];
+  // the buffers are allocated in a single block, in the order in which they are used by the sub models in evalF and evalG
+  buffers_.clear();
+  const std::size_t offsetYBuffer = buffers_.reserve<double>(sizeY_);
+  const std::size_t offsetYpBuffer = buffers_.reserve<double>(sizeY_);
+  const std::size_t offsetZBuffer = buffers_.reserve<double>(sizeZ_);
+  const std::size_t offsetZConnectedBuffer = buffers_.reserve<bool>(sizeZ_);
+  const std::size_t offsetFBuffer = buffers_.reserve<double>(sizeF_);
+  const std::size_t offsetGBuffer = buffers_.reserve<state_g>(sizeG_);
+  buffers_.allocate();
+  yLocal_ = buffers_.get<double>(offsetYBuffer);
+  ypLocal_ = buffers_.get<double>(offsetYpBuffer);
+  zLocal_ = buffers_.get<double>(offsetZBuffer);
+  zConnectedLocal_ = buffers_.get<bool>(offsetZConnectedBuffer);
+  fLocal_ = buffers_.get<double>(offsetFBuffer);
+  gLocal_ = buffers_.get<state_g>(offsetGBuffer);
   std::fill_n(zConnectedLocal_, sizeZ_, false);
+  std::fill_n(gLocal_, sizeG_, ROOT_DOWN);
   silentZ_ = std::vector<BitMask>(sizeZ_);
   for (int i = 0; i < sizeZ_; ++i) {
     silentZ_[i].setFlags(NotSilent);
@@ -180,12 +295,12 @@ ModelMulti::initBuffers() {
     const auto& subModel = subModels_[i];
     const int sizeY = subModel->sizeY();
     if (sizeY > 0)
-      subModel->setBufferY(yLocal_.data(), ypLocal_.data(), offsetY);
+      subModel->setBufferY(yLocal_, ypLocal_, offsetY);
     offsetY += sizeY;
 
     const int sizeF = subModel->sizeF();
     if (sizeF > 0) {
-      subModel->setBufferF(fLocal_.data(), offsetF);
+      subModel->setBufferF(fLocal_, offsetF);
       for (int j = offsetF; j < offsetF + sizeF; ++j)
         mapAssociationF_[j] = i;
 
@@ -194,7 +309,7 @@ ModelMulti::initBuffers() {
 
     const int sizeG = subModel->sizeG();
     if (sizeG > 0) {
-      subModel->setBufferG(gLocal_.data(), offsetG);
+      subModel->setBufferG(gLocal_, offsetG);
       for (int j = offsetG; j < offsetG + sizeG; ++j)
         mapAssociationG_[j] = i;
 
@@ -202,15 +317,18 @@ ModelMulti::initBuffers() {
     }
 
     const int sizeZ = subModel->sizeZ();
-    if (sizeZ > 0)
-      subModels_[i]->setBufferZ(zLocal_.data(), zConnectedLocal_, offsetZ);
+    if (sizeZ > 0) {
+      subModels_[i]->setBufferZ(zLocal_, zConnectedLocal_, offsetZ);
+      for (int j = offsetZ; j < offsetZ + sizeZ; ++j)
+        mapAssociationZ_[j] = i;
+    }
     offsetZ += sizeZ;
   }
-  connectorContainer_->setBufferF(fLocal_.data(), offsetF);
-  connectorContainer_->setBufferY(yLocal_.data(), ypLocal_.data());  // connectors access to the whole y Buffer
-  connectorContainer_->setBufferZ(zLocal_.data(), zConnectedLocal_);  // connectors access to the whole z buffer
+  connectorContainer_->setBufferF(fLocal_, offsetF);
+  connectorContainer_->setBufferY(yLocal_, ypLocal_);  // connectors access to the whole y Buffer
+  connectorContainer_->setBufferZ(zLocal_, zConnectedLocal_);  // connectors access to the whole z buffer
   connectorContainer_->propagateZConnectionInfoToModel();
-  std::fill(fLocal_.begin() + offsetFOptional_, fLocal_.begin() + sizeF_, 0.);
+  std::fill(fLocal_ + offsetFOptional_, fLocal_ + sizeF_, 0.);
 
   // (3) init buffers of each sub-model (useful for the network model)
   // (4) release elements that were used and declared only for connections
@@ -218,6 +336,8 @@ ModelMulti::initBuffers() {
     subModel->initSubBuffers();
     subModel->releaseElements();
   }
+  if (aliasElimination_)
+    computeAliases();
 }
 
 void
@@ -226,12 +346,22 @@ ModelMulti::init(const double t0) {
   Timer timer1("ModelMulti::init");
 #endif
 
-  zSave_.assign(zLocal_.begin(), zLocal_.end());
+  zSave_.assign(zLocal_, zLocal_ + sizeZ_);
+  zSaveOutdated_ = true;
 
   // (1) initialising each sub-model
   //----------------------------------------
-  for (const auto& subModel : subModels_)
-    subModel->initSub(t0, localInitParameters_);
+  // the local initializations only use the buffers of their sub model, each one owning its Adept stack and solver context
+  const unsigned nbSubModels = static_cast<unsigned>(subModels_.size());
+  if (nbInitThreads_ > 1 && nbSubModels > 1) {
+    ThreadPool threadPool(std::min(nbInitThreads_, nbSubModels));
+    threadPool.parallelFor(nbSubModels, [this, t0](const unsigned i) {
+      subModels_[i]->initSub(t0, localInitParameters_);
+    });
+  } else {
+    for (const auto& subModel : subModels_)
+      subModel->initSub(t0, localInitParameters_);
+  }
 
   // Detect if some discrete variable were modified during the initialization (e.g. subnetwork detection)
   vector<int> indicesDiff;
@@ -256,9 +386,9 @@ ModelMulti::init(const double t0) {
       zLocal_[indicesDiff[i]] = valuesModified[i];
     }
 
-    connectorContainer_->propagateZDiff(indicesDiff, zLocal_.data());
+    connectorContainer_->propagateZDiff(indicesDiff, zLocal_);
 
-    zSave_.assign(zLocal_.begin(), zLocal_.end());
+    zSave_.assign(zLocal_, zLocal_ + sizeZ_);
     rotateBuffers();
 
     for (const auto& subModel : subModels_)
@@ -272,7 +402,16 @@ ModelMulti::init(const double t0) {
     }
     rotateBuffers();
   }
-  zSave_.assign(zLocal_.begin(), zLocal_.end());
+  zSave_.assign(zLocal_, zLocal_ + sizeZ_);
+
+  // (3) scheduling the time events of the sub models
+  //----------------------------------------------------
+  // an event made obsolete by a later parameter change only costs an extra solver stop, and a missing one is still found by root finding
+  timeEvents_.clear();
+  for (const auto& subModel : subModels_)
+    subModel->collectTimeEvents(timeEvents_);
+  std::sort(timeEvents_.begin(), timeEvents_.end());
+  timeEvents_.erase(std::unique(timeEvents_.begin(), timeEvents_.end()), timeEvents_.end());
 }
 
 void
@@ -330,21 +469,49 @@ ModelMulti::printInitModelValues(const string& directory, const string& dumpFile
 
 void
 ModelMulti::copyContinuousVariables(const double* y, const double* yp) {
-  yLocal_.assign(y, y + sizeY());
-  ypLocal_.assign(yp, yp + sizeY());
+  copySolverVariables(y, yp);
+  notifyValuesChanged();
+}
+
+void
+ModelMulti::copySolverVariables(const double* y, const double* yp) {
+  if (!aliasElimination_) {
+    std::copy(y, y + sizeY_, yLocal_);
+    std::copy(yp, yp + sizeY_, ypLocal_);
+    return;
+  }
+  for (int i = 0; i < sizeY_; ++i) {
+    const int reducedIndex = yFullToReduced_[i];
+    yLocal_[i] = yAliasSigns_[i] * y[reducedIndex];
+    ypLocal_[i] = yAliasSigns_[i] * yp[reducedIndex];
+  }
+}
+
+void
+ModelMulti::copySolverResiduals(double* f) const {
+  if (!aliasElimination_) {
+    std::copy(fLocal_, fLocal_ + sizeF_, f);
+    return;
+  }
+  // the equations of the aliases are satisfied by construction of the local buffers
+  for (size_t i = 0, iEnd = fReducedToFull_.size(); i < iEnd; ++i)
+    f[i] = fLocal_[fReducedToFull_[i]];
 }
 
 void ModelMulti::restoreResidual(const std::vector<double>& f) {
-  fLocal_.assign(f.begin(), f.end());
+  assert(f.size() == static_cast<size_t>(sizeF_));
+  std::copy(f.begin(), f.end(), fLocal_);
 }
 
 void ModelMulti::saveResidual(std::vector<double>& f) {
-  f.assign(fLocal_.begin(), fLocal_.end());
+  f.assign(fLocal_, fLocal_ + sizeF_);
 }
 
 void
 ModelMulti::copyDiscreteVariables(const double* z) {
-  yLocal_.assign(z, z + sizeZ());
+  std::copy(z, z + sizeZ(), zLocal_);
+  zSaveOutdated_ = true;
+  notifyValuesChanged();
 }
 
 void
@@ -352,14 +519,47 @@ ModelMulti::evalF(const double t, const double* y, const double* yp, double* f)
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
   Timer timer("ModelMulti::evalF");
 #endif
+  ProfilerScope profilerScope(Profiler::EVAL_F);
   copyContinuousVariables(y, yp);
 
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
   Timer* timer2 = new Timer("ModelMulti::evalF_subModels");
 #endif
-  for (const auto& subModel : subModels_) {
-    if (subModel->sizeF() != 0)
-      subModel->evalFSub(t);
+  if (threadPool_ && !incrementalResidualEvaluation_ && useBatches()) {
+    evalFBatchSlices(t, UNDEFINED_EQ);
+  } else if (threadPool_) {
+    // each sub model writes into its own part of fLocal_, the connectors are evaluated once all sub models are done
+    if (partitions_.empty() ||
+        (!partitionsWithMeasuredCosts_ && SubModel::isCostAccountingEnabled() && ++nbEvalFSincePartitions_ >= NB_EVALF_BEFORE_MEASURED_COSTS))
+      computePartitions();
+    void (SubModel::*evalFSub)(double) = incrementalResidualEvaluation_ ? &SubModel::evalFSubIncremental : &SubModel::evalFSub;
+    threadPool_->parallelFor(static_cast<unsigned>(partitions_.size() - 1), [this, t, evalFSub](unsigned partition) {
+      for (size_t i = partitions_[partition], iEnd = partitions_[partition + 1]; i < iEnd; ++i) {
+        if (subModels_[i]->sizeF() != 0)
+          (subModels_[i].get()->*evalFSub)(t);
+      }
+    });
+  } else if (incrementalResidualEvaluation_) {
+    for (const auto& subModel : subModels_)
+      subModel->evalFSubIncremental(t);
+  } else if (useBatches()) {
+    if (batchBoundaries_.empty())
+      computeBatches();
+    for (size_t b = 0, bEnd = batchBoundaries_.size() - 1; b < bEnd; ++b) {
+      SubModel* const* batch = &batchedSubModels_[batchBoundaries_[b]];
+      const unsigned int nbSubModels = static_cast<unsigned int>(batchBoundaries_[b + 1] - batchBoundaries_[b]);
+      if (batch[0]->sizeF() == 0)
+        continue;
+      if (nbSubModels == 1)
+        batch[0]->evalFSub(t);
+      else
+        batch[0]->evalFBatch(t, UNDEFINED_EQ, batch, nbSubModels);
+    }
+  } else {
+    for (const auto& subModel : subModels_) {
+      if (subModel->sizeF() != 0)
+        subModel->evalFSub(t);
+    }
   }
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
   delete timer2;
@@ -367,7 +567,297 @@ ModelMulti::evalF(const double t, const double* y, const double* yp, double* f)
 
   connectorContainer_->evalFConnector(t);
 
-  std::copy(fLocal_.begin(), fLocal_.end(), f);
+  copySolverResiduals(f);
+}
+
+void
+ModelMulti::setNbThreads(const unsigned nbThreads) {
+  partitions_.clear();
+  batchBoundaries_.clear();
+  if (nbThreads > 1)
+    threadPool_.reset(new ThreadPool(nbThreads));
+  else
+    threadPool_.reset();
+}
+
+void
+ModelMulti::setIncrementalRootEvaluation(const bool incremental) {
+  incrementalRootEvaluation_ = incremental;
+  for (const auto& subModel : subModels_)
+    subModel->invalidateRootInputs();
+}
+
+double
+ModelMulti::getNextTimeEvent(const double t) const {
+  const auto itEvent = std::upper_bound(timeEvents_.begin(), timeEvents_.end(), t);
+  return (itEvent != timeEvents_.end()) ? *itEvent : std::numeric_limits<double>::max();
+}
+
+void
+ModelMulti::setIncrementalResidualEvaluation(const bool incremental) {
+  incrementalResidualEvaluation_ = incremental;
+  for (const auto& subModel : subModels_)
+    subModel->invalidateResidualInputs();
+}
+
+void
+ModelMulti::setBatchEvaluation(const bool batch) {
+  batchEvaluation_ = batch;
+  batchBoundaries_.clear();
+}
+
+void
+ModelMulti::setAliasElimination(const bool eliminate) {
+  aliasElimination_ = eliminate;
+  if (eliminate)
+    computeAliases();
+}
+
+void
+ModelMulti::computeAliases() {
+  vector<int> keptVariables;
+  connectorContainer_->getAliases(keptVariables, yAliasSigns_);
+  yFullToReduced_.assign(sizeY_, -1);
+  yReducedToFull_.clear();
+  for (int i = 0; i < sizeY_; ++i) {
+    if (keptVariables[i] == i) {
+      yFullToReduced_[i] = static_cast<int>(yReducedToFull_.size());
+      yReducedToFull_.push_back(i);
+    }
+  }
+  for (int i = 0; i < sizeY_; ++i)
+    yFullToReduced_[i] = yFullToReduced_[keptVariables[i]];
+
+  // the equations of the Y connectors are the first ones of the connectors
+  const int yConnectorsBegin = connectorContainer_->getOffsetModel();
+  const int yConnectorsEnd = yConnectorsBegin + static_cast<int>(connectorContainer_->nbYConnectors());
+  fReducedToFull_.clear();
+  fReducedToFull_.reserve(sizeF_ - (yConnectorsEnd - yConnectorsBegin));
+  for (int i = 0; i < sizeF_; ++i) {
+    if (i < yConnectorsBegin || i >= yConnectorsEnd)
+      fReducedToFull_.push_back(i);
+  }
+  computeReducedTypes();
+
+  jtColumnPositions_.assign(yReducedToFull_.size(), -1);
+  if (!jtFull_)
+    jtFull_.reset(new SparseMatrix());
+  Trace::info() << DYNLog(AliasVariablesEliminated, sizeY_ - static_cast<int>(yReducedToFull_.size()), yReducedToFull_.size()) << Trace::endline;
+}
+
+void
+ModelMulti::computeReducedTypes() {
+  yTypeReduced_.resize(yReducedToFull_.size());
+  for (size_t i = 0; i < yReducedToFull_.size(); ++i)
+    yTypeReduced_[i] = yType_[yReducedToFull_[i]];
+  // the derivative of an alias is the one of its variable kept
+  for (int i = 0; i < sizeY_; ++i) {
+    if (yType_[i] == DIFFERENTIAL)
+      yTypeReduced_[yFullToReduced_[i]] = DIFFERENTIAL;
+  }
+  fTypeReduced_.resize(fReducedToFull_.size());
+  for (size_t i = 0; i < fReducedToFull_.size(); ++i)
+    fTypeReduced_[i] = fType_[fReducedToFull_[i]];
+}
+
+void
+ModelMulti::reduceJacobian(const SparseMatrix& jtFull, SparseMatrix& jt) {
+  for (const int fullColumn : fReducedToFull_) {
+    jt.changeCol();
+    // the terms of the aliases of a variable kept are gathered in a single term
+    for (unsigned k = jtFull.Ap_[fullColumn]; k < jtFull.Ap_[fullColumn + 1]; ++k) {
+      const int fullRow = static_cast<int>(jtFull.Ai_[k]);
+      const int row = yFullToReduced_[fullRow];
+      int& position = jtColumnPositions_[row];
+      if (position < 0) {
+        position = static_cast<int>(jtColumnRows_.size());
+        jtColumnRows_.push_back(row);
+        jtColumnValues_.push_back(0.);
+      }
+      jtColumnValues_[position] += yAliasSigns_[fullRow] * jtFull.Ax_[k];
+    }
+    for (size_t i = 0; i < jtColumnRows_.size(); ++i) {
+      jt.addTerm(jtColumnRows_[i], jtColumnValues_[i]);
+      jtColumnPositions_[jtColumnRows_[i]] = -1;
+    }
+    jtColumnRows_.clear();
+    jtColumnValues_.clear();
+  }
+}
+
+void
+ModelMulti::computeBatches() {
+  // the sub models of a batch keep their relative order, each batch starting at its first sub model
+  std::unordered_map<const void*, size_t> batchIndexByKey;
+  std::vector<std::vector<SubModel*> > batches;
+  for (const auto& subModel : subModels_) {
+    const void* key = subModel->getBatchKey();
+    const auto itKey = key ? batchIndexByKey.find(key) : batchIndexByKey.end();
+    if (itKey == batchIndexByKey.end()) {
+      if (key)
+        batchIndexByKey[key] = batches.size();
+      batches.push_back(std::vector<SubModel*>(1, subModel.get()));
+    } else {
+      batches[itKey->second].push_back(subModel.get());
+    }
+  }
+
+  batchedSubModels_.clear();
+  batchedSubModels_.reserve(subModels_.size());
+  batchBoundaries_.assign(1, 0);
+  for (const auto& batch : batches) {
+    batchedSubModels_.insert(batchedSubModels_.end(), batch.begin(), batch.end());
+    batchBoundaries_.push_back(batchedSubModels_.size());
+  }
+  computeBatchSlices();
+}
+
+void
+ModelMulti::computeBatchSlices() {
+  batchSlices_.clear();
+  if (!threadPool_)
+    return;
+  // a sub model without residual function is skipped by evalF
+  std::vector<size_t> costs(batchedSubModels_.size(), 0);
+  size_t totalCost = 0;
+  for (size_t i = 0; i < batchedSubModels_.size(); ++i) {
+    if (batchedSubModels_[i]->sizeF() != 0)
+      costs[i] = static_cast<size_t>(batchedSubModels_[i]->sizeF()) + 1;
+    totalCost += costs[i];
+  }
+  // the tasks are taken dynamically by the threads: a few slices by thread balance the load
+  const size_t nbSlicesByThread = 4;
+  const size_t sliceCost = std::max<size_t>(totalCost / (threadPool_->nbThreads() * nbSlicesByThread), 1);
+
+  BatchSlice aloneSlice = {0, 0, false};
+  size_t aloneCost = 0;
+  for (size_t b = 0, bEnd = batchBoundaries_.size() - 1; b < bEnd; ++b) {
+    const size_t begin = batchBoundaries_[b];
+    const size_t end = batchBoundaries_[b + 1];
+    if (end - begin == 1) {
+      if (aloneSlice.end != begin || aloneCost >= sliceCost) {
+        if (aloneCost > 0)
+          batchSlices_.push_back(aloneSlice);
+        aloneSlice.begin = begin;
+        aloneCost = 0;
+      }
+      aloneSlice.end = end;
+      aloneCost += costs[begin];
+      continue;
+    }
+    if (costs[begin] == 0)
+      continue;
+    // the instances of a batch have the same cost
+    const size_t batchCost = costs[begin] * (end - begin);
+    const size_t nbSlices = std::min((batchCost + sliceCost - 1) / sliceCost, end - begin);
+    for (size_t s = 0; s < nbSlices; ++s) {
+      const BatchSlice slice = {begin + (end - begin) * s / nbSlices, begin + (end - begin) * (s + 1) / nbSlices, true};
+      batchSlices_.push_back(slice);
+    }
+  }
+  if (aloneCost > 0)
+    batchSlices_.push_back(aloneSlice);
+}
+
+void
+ModelMulti::evalFBatchSlices(const double t, const propertyF_t type) {
+  if (batchBoundaries_.empty())
+    computeBatches();
+  // each sub model writes into its own part of fLocal_, the connectors are evaluated once all sub models are done
+  threadPool_->parallelFor(static_cast<unsigned>(batchSlices_.size()), [this, t, type](unsigned s) {
+    const BatchSlice& slice = batchSlices_[s];
+    SubModel* const* subModels = &batchedSubModels_[slice.begin];
+    const unsigned int nbSubModels = static_cast<unsigned int>(slice.end - slice.begin);
+    if (slice.batched && nbSubModels > 1) {
+      subModels[0]->evalFBatch(t, type, subModels, nbSubModels);
+      return;
+    }
+    for (unsigned int i = 0; i < nbSubModels; ++i) {
+      if (subModels[i]->sizeF() == 0)
+        continue;
+      if (type == DIFFERENTIAL_EQ)
+        subModels[i]->evalFDiffSub(t);
+      else
+        subModels[i]->evalFSub(t);
+    }
+  });
+}
+
+void
+ModelMulti::computePartitions() {
+  partitions_.assign(1, 0);
+  partitionsRowOffset_.assign(1, 0);
+  partitionsNbCols_.clear();
+  jtBlocks_.clear();
+  nbEvalFSincePartitions_ = 0;
+  partitionsWithMeasuredCosts_ = false;
+  if (!threadPool_)
+    return;
+  // the mean time of an evaluation measured by the cost accounting is the best estimate, once every sub model was evaluated;
+  // otherwise the number of residual functions is used. A sub model without residual function is skipped by evalF
+  partitionsWithMeasuredCosts_ = SubModel::isCostAccountingEnabled();
+  for (size_t i = 0; partitionsWithMeasuredCosts_ && i < subModels_.size(); ++i)
+    partitionsWithMeasuredCosts_ = subModels_[i]->sizeF() == 0 || subModels_[i]->getEvaluationCost(SubModel::COST_F).nbCalls > 0;
+  std::vector<double> costs(subModels_.size(), 0.);
+  double totalCost = 0.;
+  for (size_t i = 0; i < subModels_.size(); ++i) {
+    if (subModels_[i]->sizeF() == 0)
+      continue;
+    const SubModel::EvaluationCost& evaluationCost = subModels_[i]->getEvaluationCost(SubModel::COST_F);
+    if (partitionsWithMeasuredCosts_)
+      costs[i] = evaluationCost.time / static_cast<double>(evaluationCost.nbCalls);
+    else
+      costs[i] = subModels_[i]->sizeF() + 1.;
+    totalCost += costs[i];
+  }
+
+  // the ranges are taken dynamically by the threads: a few ranges by thread let the threads that end early take the remaining ones
+  const size_t nbPartitions = threadPool_->nbThreads() * NB_PARTITIONS_BY_THREAD;
+  double cost = 0.;
+  for (size_t i = 0; i < subModels_.size(); ++i) {
+    cost += costs[i];
+    if (costs[i] > 0. && partitions_.size() < nbPartitions && cost * nbPartitions >= totalCost * partitions_.size())
+      partitions_.push_back(i + 1);
+  }
+  if (partitions_.back() != subModels_.size())
+    partitions_.push_back(subModels_.size());
+
+  const size_t nbRanges = partitions_.size() - 1;
+  partitionsNbCols_.assign(nbRanges, 0);
+  int rowOffset = 0;
+  for (size_t p = 0; p < nbRanges; ++p) {
+    if (p > 0)
+      partitionsRowOffset_.push_back(rowOffset);
+    for (size_t i = partitions_[p]; i < partitions_[p + 1]; ++i) {
+      partitionsNbCols_[p] += subModels_[i]->sizeF();
+      rowOffset += subModels_[i]->sizeY();
+    }
+  }
+  for (size_t p = 1; p < nbRanges; ++p)
+    jtBlocks_.push_back(std::unique_ptr<SparseMatrix>(new SparseMatrix()));
+}
+
+void
+ModelMulti::evalJtSubModelsByPartitions(const double t, const double cj, void (SubModel::*evalJtSub)(double, double, int&, SparseMatrix&),
+    SparseMatrix& jt) {
+  if (partitions_.empty())
+    computePartitions();
+  // the first range is directly filled in jt, the other ones in their own block then appended in order
+  threadPool_->parallelFor(static_cast<unsigned>(partitions_.size() - 1), [this, t, cj, evalJtSub, &jt](unsigned partition) {
+    SparseMatrix& block = (partition == 0) ? jt : *jtBlocks_[partition - 1];
+    if (partition > 0)
+      block.init(sizeY_, partitionsNbCols_[partition]);
+    int rowOffset = partitionsRowOffset_[partition];
+    for (size_t i = partitions_[partition], iEnd = partitions_[partition + 1]; i < iEnd; ++i) {
+      const boost::shared_ptr<SubModel>& subModel = subModels_[i];
+      ((*subModel).*evalJtSub)(t, cj, rowOffset, block);
+      if (!block.withoutNan() || !block.withoutInf()) {
+        throw DYNError(Error::MODELER, SparseMatrixWithNanInf, subModel->modelType(), subModel->name());
+      }
+    }
+  });
+  for (const auto& block : jtBlocks_)
+    jt.appendColumns(*block);
 }
 
 void
@@ -377,10 +867,25 @@ ModelMulti::evalFDiff(const double t, const double* y, const double* yp, double*
 #endif
   copyContinuousVariables(y, yp);
 
-  for (const auto& subModel : subModels_)
-    subModel->evalFDiffSub(t);
+  if (threadPool_ && useBatches()) {
+    evalFBatchSlices(t, DIFFERENTIAL_EQ);
+  } else if (useBatches()) {
+    if (batchBoundaries_.empty())
+      computeBatches();
+    for (size_t b = 0, bEnd = batchBoundaries_.size() - 1; b < bEnd; ++b) {
+      SubModel* const* batch = &batchedSubModels_[batchBoundaries_[b]];
+      const unsigned int nbSubModels = static_cast<unsigned int>(batchBoundaries_[b + 1] - batchBoundaries_[b]);
+      if (nbSubModels == 1)
+        batch[0]->evalFDiffSub(t);
+      else
+        batch[0]->evalFBatch(t, DIFFERENTIAL_EQ, batch, nbSubModels);
+    }
+  } else {
+    for (const auto& subModel : subModels_)
+      subModel->evalFDiffSub(t);
+  }
 
-  std::copy(fLocal_.begin(), fLocal_.end(), f);
+  copySolverResiduals(f);
 }
 
 void
@@ -406,7 +911,7 @@ ModelMulti::evalFMode(const double t, const double* y, const double* yp, double*
 
   connectorContainer_->evalFConnector(t);
 
-  std::copy(fLocal_.begin(), fLocal_.end(), f);
+  copySolverResiduals(f);
 }
 
 void
@@ -414,22 +919,55 @@ ModelMulti::evalG(const double t, vector<state_g>& g) {
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
   Timer timer("ModelMulti::evalG");
 #endif
-  for (const auto& subModel : subModels_)
-    subModel->evalGSub(t);
+  ProfilerScope profilerScope(Profiler::EVAL_G);
+  if (incrementalRootEvaluation_) {
+    for (const auto& subModel : subModels_)
+      subModel->evalGSubIncremental(t);
+  } else if (useBatches()) {
+    if (batchBoundaries_.empty())
+      computeBatches();
+    for (size_t b = 0, bEnd = batchBoundaries_.size() - 1; b < bEnd; ++b) {
+      SubModel* const* batch = &batchedSubModels_[batchBoundaries_[b]];
+      const unsigned int nbSubModels = static_cast<unsigned int>(batchBoundaries_[b + 1] - batchBoundaries_[b]);
+      if (nbSubModels == 1)
+        batch[0]->evalGSub(t);
+      else
+        batch[0]->evalGBatch(t, batch, nbSubModels);
+    }
+  } else {
+    for (const auto& subModel : subModels_)
+      subModel->evalGSub(t);
+  }
 
-  std::copy(gLocal_.begin(), gLocal_.end(), g.begin());
+  std::copy(gLocal_, gLocal_ + sizeG(), g.begin());
 }
 
 void
 ModelMulti::evalJt(const double t, const double cj, SparseMatrix& jt) {
+  if (!aliasElimination_) {
+    evalJtFull(t, cj, jt);
+    return;
+  }
+  jtFull_->init(sizeY_, sizeF_);
+  evalJtFull(t, cj, *jtFull_);
+  reduceJacobian(*jtFull_, jt);
+}
+
+void
+ModelMulti::evalJtFull(const double t, const double cj, SparseMatrix& jt) {
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
   Timer timer("ModelMulti::evalJt");
 #endif
-  int rowOffset = 0;
-  for (const auto& subModel : subModels_) {
-    subModel->evalJtSub(t, cj, rowOffset, jt);
-    if (!jt.withoutNan() || !jt.withoutInf()) {
-      throw DYNError(Error::MODELER, SparseMatrixWithNanInf, subModel->modelType(), subModel->name());
+  ProfilerScope profilerScope(Profiler::EVAL_JT);
+  if (threadPool_) {
+    evalJtSubModelsByPartitions(t, cj, &SubModel::evalJtSub, jt);
+  } else {
+    int rowOffset = 0;
+    for (const auto& subModel : subModels_) {
+      subModel->evalJtSub(t, cj, rowOffset, jt);
+      if (!jt.withoutNan() || !jt.withoutInf()) {
+        throw DYNError(Error::MODELER, SparseMatrixWithNanInf, subModel->modelType(), subModel->name());
+      }
     }
   }
 
@@ -444,11 +982,26 @@ ModelMulti::evalJt(const double t, const double cj, SparseMatrix& jt) {
 
 void
 ModelMulti::evalJtPrim(const double t, const double cj, SparseMatrix& jtPrim) {
-  int rowOffset = 0;
-  for (const auto& subModel : subModels_) {
-    subModel->evalJtPrimSub(t, cj, rowOffset, jtPrim);
-    if (!jtPrim.withoutNan() || !jtPrim.withoutInf()) {
-      throw DYNError(Error::MODELER, SparseMatrixWithNanInf, subModel->modelType(), subModel->name());
+  if (!aliasElimination_) {
+    evalJtPrimFull(t, cj, jtPrim);
+    return;
+  }
+  jtFull_->init(sizeY_, sizeF_);
+  evalJtPrimFull(t, cj, *jtFull_);
+  reduceJacobian(*jtFull_, jtPrim);
+}
+
+void
+ModelMulti::evalJtPrimFull(const double t, const double cj, SparseMatrix& jtPrim) {
+  if (threadPool_) {
+    evalJtSubModelsByPartitions(t, cj, &SubModel::evalJtPrimSub, jtPrim);
+  } else {
+    int rowOffset = 0;
+    for (const auto& subModel : subModels_) {
+      subModel->evalJtPrimSub(t, cj, rowOffset, jtPrim);
+      if (!jtPrim.withoutNan() || !jtPrim.withoutInf()) {
+        throw DYNError(Error::MODELER, SparseMatrixWithNanInf, subModel->modelType(), subModel->name());
+      }
     }
   }
 
@@ -463,16 +1016,88 @@ ModelMulti::evalZ(const double t) {
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
   Timer timer("ModelMulti::evalZ");
 #endif
+  ProfilerScope profilerScope(Profiler::EVAL_Z);
   if (sizeZ() == 0) return;
+  if (eventSubModelsKnown_ && !zSaveOutdated_ && zSave_.size() == static_cast<size_t>(sizeZ())) {
+    // only the discrete variables of the sub models concerned by the event may have changed
+    zCandidates_.clear();
+    for (unsigned int i = 0; i < subModels_.size(); ++i) {
+      if (!isConcernedByEvent(i))
+        continue;
+      const auto& subModel = subModels_[i];
+      subModel->evalZSub(t);
+      for (int j = subModel->zDeb(), jEnd = subModel->zDeb() + static_cast<int>(subModel->sizeZ()); j < jEnd; ++j)
+        zCandidates_.push_back(j);
+    }
+    silentZChange_ = propagateZModif(zCandidates_, zChangedIndexes_);
+    notifyValuesChanged();
+    // the sub models whose discrete variables changed, directly or through a connection, are concerned by the event
+    for (const auto index : zChangedIndexes_)
+      eventSubModels_[mapAssociationZ_[index]] = true;
+    return;
+  }
+
   // calculate Z by model
-  for (const auto& subModel : subModels_)
-    subModel->evalZSub(t);
+  if (eventSubModelsKnown_) {
+    zBeforeEvalZ_.assign(zLocal_, zLocal_ + sizeZ_);
+    for (unsigned int i = 0; i < subModels_.size(); ++i) {
+      if (isConcernedByEvent(i))
+        subModels_[i]->evalZSub(t);
+    }
+  } else {
+    for (const auto& subModel : subModels_)
+      subModel->evalZSub(t);
+  }
 
   // propagation of z changes to connected variables
   if (zSave_.size() != static_cast<size_t>(sizeZ()))
     zSave_.assign(sizeZ(), 0.);
 
   silentZChange_ = propagateZModif();
+  zSaveOutdated_ = false;
+  notifyValuesChanged();
+
+  if (eventSubModelsKnown_) {
+    // the sub models whose discrete variables changed, directly or through a connection, are concerned by the event
+    for (int i = 0; i < sizeZ_; ++i) {
+      if (doubleNotEquals(zLocal_[i], zBeforeEvalZ_[i]))
+        eventSubModels_[mapAssociationZ_[i]] = true;
+    }
+  }
+}
+
+void
+ModelMulti::setEventDrivenDiscreteEvaluation(const bool eventDriven) {
+  eventDrivenDiscreteEvaluation_ = eventDriven;
+  eventSubModelsKnown_ = false;
+}
+
+void
+ModelMulti::notifyRootsChange(const vector<state_g>& gBefore, const vector<state_g>& gAfter) {
+  if (!eventDrivenDiscreteEvaluation_)
+    return;
+  if (!eventSubModelsKnown_) {
+    eventSubModels_.assign(subModels_.size(), false);
+    eventSubModelsKnown_ = true;
+  }
+  for (int i = 0; i < sizeG_; ++i) {
+    if (gBefore[i] != gAfter[i])
+      eventSubModels_[mapAssociationG_[i]] = true;
+  }
+}
+
+void
+ModelMulti::notifyValuesChanged() const {
+  for (const auto& subModel : subModels_)
+    subModel->notifyValuesChanged();
+}
+
+bool
+ModelMulti::isConcernedByEvent(const unsigned int subModelIndex) const {
+  if (!eventSubModelsKnown_ || eventSubModels_[subModelIndex])
+    return true;
+  const auto& subModel = subModels_[subModelIndex];
+  return !subModel->discreteChangesOnlyOnEvents() || subModel->discreteEvaluationRequested();
 }
 
 zChangeType_t
@@ -505,8 +1130,8 @@ ModelMulti::propagateZModif() {
   }
   if (!indicesDiff.empty()) {
     // if at least one discrete variable that is used in discrete equations has changed then we propagate the modification
-    connectorContainer_->propagateZDiff(indicesDiff, zLocal_.data());
-    std::copy(zLocal_.begin(), zLocal_.end(), zSave_.begin());
+    connectorContainer_->propagateZDiff(indicesDiff, zLocal_);
+    std::copy(zLocal_, zLocal_ + sizeZ_, zSave_.begin());
     return zChangeType;
   } else {
     // if only discrete variables that are used only in continuous equations then we just raise the NotUsedInDiscreteEquations flag
@@ -514,7 +1139,7 @@ ModelMulti::propagateZModif() {
     for (const auto notUsedInDiscreteEqSilentZIndex : notUsedInDiscreteEqSilentZIndexes_) {
       if (!std::isnan(zLocal_[notUsedInDiscreteEqSilentZIndex]) && !std::isnan(zSave_[notUsedInDiscreteEqSilentZIndex])) {
         if (doubleNotEquals(zLocal_[notUsedInDiscreteEqSilentZIndex], zSave_[notUsedInDiscreteEqSilentZIndex])) {
-          std::copy(zLocal_.begin(), zLocal_.end(), zSave_.begin());
+          std::copy(zLocal_, zLocal_ + sizeZ_, zSave_.begin());
           return NOT_USED_IN_DISCRETE_EQ_Z_CHANGE;
         }
       } else {
@@ -525,22 +1150,72 @@ ModelMulti::propagateZModif() {
   return NO_Z_CHANGE;
 }
 
+zChangeType_t
+ModelMulti::propagateZModif(const vector<int>& candidates, vector<int>& changedIndexes) {
+  if (zChangeTypes_.size() != static_cast<size_t>(sizeZ_)) {
+    zChangeTypes_.assign(sizeZ_, NO_Z_CHANGE);
+    for (const auto index : nonSilentZIndexes_)
+      zChangeTypes_[index] = NOT_SILENT_Z_CHANGE;
+    for (const auto index : notUsedInContinuousEqSilentZIndexes_)
+      zChangeTypes_[index] = NOT_USED_IN_CONTINUOUS_EQ_Z_CHANGE;
+    for (const auto index : notUsedInDiscreteEqSilentZIndexes_)
+      zChangeTypes_[index] = NOT_USED_IN_DISCRETE_EQ_Z_CHANGE;
+  }
+
+  // same rules as the full propagation, restricted to the candidates
+  vector<int> indicesDiff;
+  changedIndexes.clear();
+  zChangeType_t zChangeType = NO_Z_CHANGE;
+  for (const auto index : candidates) {
+    const zChangeType_t indexChangeType = zChangeTypes_[index];
+    if (indexChangeType == NO_Z_CHANGE)
+      continue;
+    if (std::isnan(zLocal_[index]) || std::isnan(zSave_[index]))
+      throw DYNError(Error::MODELER, ZValueIsNaN, index);
+    if (!doubleNotEquals(zLocal_[index], zSave_[index]))
+      continue;
+    changedIndexes.push_back(index);
+    if (indexChangeType == NOT_SILENT_Z_CHANGE) {
+      indicesDiff.push_back(index);
+      zChangeType = NOT_SILENT_Z_CHANGE;
+    } else if (indexChangeType == NOT_USED_IN_CONTINUOUS_EQ_Z_CHANGE) {
+      indicesDiff.push_back(index);
+      if (zChangeType != NOT_SILENT_Z_CHANGE)
+        zChangeType = NOT_USED_IN_CONTINUOUS_EQ_Z_CHANGE;
+    } else if (zChangeType == NO_Z_CHANGE) {
+      // only raised if no discrete variable used in discrete equations has changed
+      zChangeType = NOT_USED_IN_DISCRETE_EQ_Z_CHANGE;
+    }
+  }
+  if (!indicesDiff.empty())
+    connectorContainer_->propagateZDiff(indicesDiff, zLocal_, &changedIndexes);
+  if (!changedIndexes.empty()) {
+    for (const auto index : changedIndexes)
+      zSave_[index] = zLocal_[index];
+  }
+  return zChangeType;
+}
+
 void
 ModelMulti::evalMode(const double t) {
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
   Timer timer("ModelMulti::evalMode");
 #endif
+  ProfilerScope profilerScope(Profiler::EVAL_MODE);
   /* modeChange_ has to be set at each evalMode call
    *  -> it indicates if there has been a mode change for this call
    * modeChangeType_ is the worst mode change for a complete time step (possibly several evalMode calls)
    *   -> it is reinitialized by the solvers at the end of the time step
   */
 #ifdef _DEBUG_
-  const std::vector<double> z(zLocal_);
+  const std::vector<double> z(zLocal_, zLocal_ + sizeZ());
 #endif
   modeChange_ = false;
   modeChangeType_t modeChangeType = NO_MODE;
-  for (const auto& subModel : subModels_) {
+  for (unsigned int i = 0; i < subModels_.size(); ++i) {
+    if (!isConcernedByEvent(i))
+      continue;
+    const auto& subModel = subModels_[i];
     modeChangeType_t modeChangeTypeSub = subModel->evalModeSub(t);
     if (modeChangeTypeSub > modeChangeType)
       modeChangeType = modeChangeTypeSub;
@@ -548,6 +1223,8 @@ ModelMulti::evalMode(const double t) {
       modeChange_ = true;
     }
   }
+  // the mode evaluation ends the current event
+  eventSubModelsKnown_ = false;
   if (modeChange_) {
     modeChangeType_ = modeChangeType;
     Trace::info() << DYNLog(ModeChangeGeneric, modeChangeType2Str(modeChangeType), t) << Trace::endline;
@@ -573,6 +1250,175 @@ void
 ModelMulti::notifyTimeStep() {
   for (const auto& subModel : subModels_)
     subModel->notifyTimeStep();
+  updateLatency();
+}
+
+void
+ModelMulti::setLatencyPartitionEnabled(const bool enabled) {
+  latencyPartitionEnabled_ = enabled;
+  yLatencyReference_.clear();
+}
+
+void
+ModelMulti::updateLatency() {
+  if (!latencyPartitionEnabled_ || sizeY_ == 0)
+    return;
+  if (nbActiveSteps_.size() != subModels_.size())
+    nbActiveSteps_.assign(subModels_.size(), 0);
+  if (yLatencyReference_.empty()) {
+    // first notification, or after a state restoration: only the reference is set
+    yLatencyReference_.assign(yLocal_, yLocal_ + sizeY_);
+    return;
+  }
+
+  ++nbNotifiedSteps_;
+  for (unsigned int k = 0; k < subModels_.size(); ++k) {
+    const int yDeb = subModels_[k]->yDeb();
+    const int yEnd = yDeb + subModels_[k]->sizeY();
+    bool active = false;
+    for (int i = yDeb; i < yEnd && !active; ++i)
+      active = std::abs(yLocal_[i] - yLatencyReference_[i]) > LATENCY_TOLERANCE * std::max(1., std::abs(yLatencyReference_[i]));
+    if (active) {
+      ++nbActiveSteps_[k];
+      std::copy(yLocal_ + yDeb, yLocal_ + yEnd, yLatencyReference_.begin() + yDeb);
+    }
+  }
+}
+
+void
+ModelMulti::printLatencyPartition() const {
+  if (nbNotifiedSteps_ == 0)
+    return;
+  unsigned int nbFastSubModels = 0;
+  unsigned int nbSlowSubModels = 0;
+  int nbSlowVariables = 0;
+  for (unsigned int k = 0; k < subModels_.size(); ++k) {
+    if (subModels_[k]->sizeY() == 0)
+      continue;
+    if (nbActiveSteps_[k] < SLOW_ACTIVITY_RATIO * nbNotifiedSteps_) {
+      ++nbSlowSubModels;
+      nbSlowVariables += subModels_[k]->sizeY();
+      Trace::debug() << DYNLog(LatencySlowSubModel, subModels_[k]->name(), nbActiveSteps_[k], nbNotifiedSteps_) << Trace::endline;
+    } else {
+      ++nbFastSubModels;
+    }
+  }
+  Trace::info() << DYNLog(LatencyPartition, nbFastSubModels, nbSlowSubModels, nbSlowVariables, sizeY_) << Trace::endline;
+}
+
+/**
+ * @brief evaluation costs of a sub model or of a model type
+ */
+struct SubModelCosts {
+  string name;  ///< name of the sub model or of the model type
+  unsigned int nbSubModels = 0;  ///< number of sub models accounted
+  SubModel::EvaluationCost costs[SubModel::NB_COSTS] = {};  ///< cost of each evaluation
+  double time = 0.;  ///< cumulative time of all the evaluations
+
+  /**
+   * @brief add the costs of a sub model
+   * @param subModel sub model
+   */
+  void add(const SubModel& subModel) {
+    ++nbSubModels;
+    for (unsigned int i = 0; i < SubModel::NB_COSTS; ++i) {
+      const SubModel::EvaluationCost& cost = subModel.getEvaluationCost(static_cast<SubModel::evaluationCost_t>(i));
+      costs[i].nbCalls += cost.nbCalls;
+      costs[i].time += cost.time;
+      time += cost.time;
+    }
+  }
+
+  /**
+   * @brief build the log of the costs
+   * @return log of the costs
+   */
+  Message log() const {
+    return DYNLog(SubModelCost, name, nbSubModels, time,
+        costs[SubModel::COST_F].nbCalls, costs[SubModel::COST_F].time,
+        costs[SubModel::COST_G].nbCalls, costs[SubModel::COST_G].time,
+        costs[SubModel::COST_Z].nbCalls, costs[SubModel::COST_Z].time,
+        costs[SubModel::COST_JT].nbCalls, costs[SubModel::COST_JT].time,
+        costs[SubModel::COST_MODE].nbCalls, costs[SubModel::COST_MODE].time);
+  }
+};
+
+/**
+ * @brief sort the costs by decreasing time
+ * @param costs costs to sort
+ */
+static void
+sortByDecreasingTime(vector<SubModelCosts>& costs) {
+  std::stable_sort(costs.begin(), costs.end(), [](const SubModelCosts& lhs, const SubModelCosts& rhs) { return lhs.time > rhs.time; });
+}
+
+void
+ModelMulti::printSubModelCosts() const {
+  if (!SubModel::isCostAccountingEnabled())
+    return;
+  vector<SubModelCosts> subModelCosts(subModels_.size());
+  vector<SubModelCosts> modelTypeCosts;
+  std::unordered_map<string, size_t> modelTypeIndexes;
+  for (unsigned int k = 0; k < subModels_.size(); ++k) {
+    subModelCosts[k].name = subModels_[k]->name();
+    subModelCosts[k].add(*subModels_[k]);
+    const string& modelType = subModels_[k]->modelType();
+    const auto itModelType = modelTypeIndexes.insert(std::make_pair(modelType, modelTypeCosts.size()));
+    if (itModelType.second) {
+      modelTypeCosts.push_back(SubModelCosts());
+      modelTypeCosts.back().name = modelType;
+    }
+    modelTypeCosts[itModelType.first->second].add(*subModels_[k]);
+  }
+  sortByDecreasingTime(subModelCosts);
+  sortByDecreasingTime(modelTypeCosts);
+
+  Trace::info() << DYNLog(ModelTypeCostsHeader) << Trace::endline;
+  for (const auto& costs : modelTypeCosts)
+    Trace::info() << costs.log() << Trace::endline;
+  Trace::info() << DYNLog(SubModelCostsHeader, std::min<size_t>(MAX_REPORTED_SUBMODEL_COSTS, subModelCosts.size()), subModelCosts.size())
+                << Trace::endline;
+  for (unsigned int k = 0; k < subModelCosts.size(); ++k) {
+    if (k < MAX_REPORTED_SUBMODEL_COSTS)
+      Trace::info() << subModelCosts[k].log() << Trace::endline;
+    else
+      Trace::debug() << subModelCosts[k].log() << Trace::endline;
+  }
+}
+
+void
+ModelMulti::accountMemory(MemoryUsage& usage) const {
+  usage.add(MemoryUsage::SUB_MODEL_BUFFERS, buffers_.size() + MemoryUsage::bytes(zSave_) + MemoryUsage::bytes(fType_) + MemoryUsage::bytes(yType_)
+      + MemoryUsage::bytes(silentZ_) + MemoryUsage::bytes(notUsedInDiscreteEqSilentZIndexes_) + MemoryUsage::bytes(notUsedInContinuousEqSilentZIndexes_)
+      + MemoryUsage::bytes(nonSilentZIndexes_));
+  usage.add(MemoryUsage::VARIABLE_DEFINITIONS, MemoryUsage::bytes(yNames_) + MemoryUsage::bytes(mapAssociationF_) + MemoryUsage::bytes(mapAssociationG_)
+      + MemoryUsage::bytes(mapAssociationZ_) + MemoryUsage::bytes(subModelByName_) + MemoryUsage::bytes(yFullToReduced_) + MemoryUsage::bytes(yAliasSigns_)
+      + MemoryUsage::bytes(yReducedToFull_) + MemoryUsage::bytes(fReducedToFull_) + MemoryUsage::bytes(yTypeReduced_) + MemoryUsage::bytes(fTypeReduced_));
+  if (jtFull_)
+    usage.add(MemoryUsage::SPARSE_MATRICES, jtFull_->getMemoryUsage());
+  for (const auto& subModel : subModels_)
+    subModel->accountMemory(usage);
+}
+
+void
+ModelMulti::getSubModelPartition(vector<int>& fBlocks, vector<int>& yBlocks) const {
+  fBlocks.assign(sizeF_, -1);
+  yBlocks.assign(sizeY_, -1);
+  for (unsigned int k = 0; k < subModels_.size(); ++k) {
+    const int fDeb = subModels_[k]->fDeb();
+    std::fill(fBlocks.begin() + fDeb, fBlocks.begin() + fDeb + subModels_[k]->sizeF(), static_cast<int>(k));
+    const int yDeb = subModels_[k]->yDeb();
+    std::fill(yBlocks.begin() + yDeb, yBlocks.begin() + yDeb + subModels_[k]->sizeY(), static_cast<int>(k));
+  }
+  if (aliasElimination_) {
+    // the indexes kept are increasing: the blocks can be gathered in place
+    for (size_t i = 0; i < fReducedToFull_.size(); ++i)
+      fBlocks[i] = fBlocks[fReducedToFull_[i]];
+    fBlocks.resize(fReducedToFull_.size());
+    for (size_t i = 0; i < yReducedToFull_.size(); ++i)
+      yBlocks[i] = yBlocks[yReducedToFull_[i]];
+    yBlocks.resize(yReducedToFull_.size());
+  }
 }
 
 void
@@ -580,9 +1426,10 @@ ModelMulti::evalCalculatedVariables(const double t, const vector<double>& y, con
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
   Timer timer("ModelMulti::evalCalculatedVariables");
 #endif
-  yLocal_.assign(y.begin(), y.end());
-  ypLocal_.assign(yp.begin(), yp.end());
-  zLocal_.assign(z.begin(), z.end());
+  ProfilerScope profilerScope(Profiler::CALCULATED_VARIABLES);
+  copySolverVariables(y.data(), yp.data());
+  std::copy(z.begin(), z.end(), zLocal_);
+  zSaveOutdated_ = true;
 
   for (const auto& subModel : subModels_)
     subModel->evalCalculatedVariablesSub(t);
@@ -645,8 +1492,15 @@ ModelMulti::getY0(const double t0, vector<double>& y0, vector<double>& yp0) {
   }
   connectorContainer_->getY0Connector();
 
-  std::copy(yLocal_.begin(), yLocal_.end(), y0.begin());
-  std::copy(ypLocal_.begin(), ypLocal_.end(), yp0.begin());
+  if (aliasElimination_) {
+    for (size_t i = 0; i < yReducedToFull_.size(); ++i) {
+      y0[i] = yLocal_[yReducedToFull_[i]];
+      yp0[i] = ypLocal_[yReducedToFull_[i]];
+    }
+  } else {
+    std::copy(yLocal_, yLocal_ + sizeY_, y0.begin());
+    std::copy(ypLocal_, ypLocal_ + sizeY_, yp0.begin());
+  }
 }
 
 void
@@ -670,6 +1524,8 @@ ModelMulti::evalDynamicYType() {
     if (sizeYType > 0)
       subModel->evalDynamicYType();
   }
+  if (aliasElimination_)
+    computeReducedTypes();
 }
 
 void
@@ -697,6 +1553,8 @@ ModelMulti::evalDynamicFType() {
       subModel->evalDynamicFType();
   }
   // connectors equations (A = B) can't change during the simulation so we don't need to update them.
+  if (aliasElimination_)
+    computeReducedTypes();
 }
 
 void
@@ -711,6 +1569,17 @@ ModelMulti::dumpVariables(std::map< string, string >& mapVariables) {
     subModel->dumpVariables(mapVariables);
 }
 
+void
+ModelMulti::dumpParametersAndVariables(const std::function<void(const std::map< string, string >&)>& writeEntries) {
+  std::map< string, string > mapValues;
+  for (const auto& subModel : subModels_) {
+    mapValues.clear();
+    subModel->dumpParameters(mapValues);
+    subModel->dumpVariables(mapValues);
+    writeEntries(mapValues);
+  }
+}
+
 void
 ModelMulti::getModelParameterValue(const string& curveModelName, const string& curveVariable, double& value, bool& found) {
   const shared_ptr<SubModel>& subModel = findSubModelByName(curveModelName);
@@ -737,6 +1606,44 @@ ModelMulti::loadVariables(const std::map< string, string >& mapVariables) {
     subModel->loadVariables(mapVariables);
 }
 
+void
+ModelMulti::snapshotState(StateBuffer& state) const {
+  // the sub models point to these buffers for their variables and root functions
+  state.write(yLocal_, sizeY_);
+  state.write(ypLocal_, sizeY_);
+  state.write(zLocal_, sizeZ_);
+  state.write(gLocal_, sizeG_);
+  state.write(zSave_);
+  state.write(silentZChange_);
+  state.write(modeChange_);
+  state.write(modeChangeType_);
+
+  for (const auto& subModel : subModels_)
+    subModel->snapshotState(state);
+}
+
+void
+ModelMulti::restoreState(StateBuffer::Reader& state) {
+  state.read(yLocal_, sizeY_);
+  state.read(ypLocal_, sizeY_);
+  state.read(zLocal_, sizeZ_);
+  state.read(gLocal_, sizeG_);
+  state.read(zSave_);
+  zSaveOutdated_ = true;
+  state.read(silentZChange_);
+  state.read(modeChange_);
+  state.read(modeChangeType_);
+
+  for (const auto& subModel : subModels_) {
+    subModel->restoreState(state);
+    subModel->invalidateRootInputs();
+    subModel->invalidateResidualInputs();
+    subModel->requestDiscreteEvaluation();
+  }
+  // the latency is measured again from the restored values
+  yLatencyReference_.clear();
+}
+
 void
 ModelMulti::connectElements(const shared_ptr<SubModel>& subModel1, const string& name1, const shared_ptr<SubModel>& subModel2, const string& name2) {
   vector<std::pair<string, string> > variablesToConnect;
@@ -761,27 +1668,24 @@ ModelMulti::findVariablesConnectedBy(const boost::shared_ptr<SubModel>& subModel
     throw DYNError(Error::MODELER, MultiIncorrectConnection, msg.str());
   }
 
+  // index the elements of the second structure by the name of their sub-structure (id can be different),
+  // the first element being kept when several have the same name
+  std::unordered_map<string, size_t> elements2ByName;
+  elements2ByName.reserve(elements2.size());
+  for (size_t j = 0; j < elements2.size(); ++j) {
+    const string& id2 = elements2[j].id();
+    elements2ByName.emplace(id2.substr(std::min(name2.size(), id2.size())), j);
+  }
+
+  variables.reserve(variables.size() + elements1.size());
   for (const auto& element1 : elements1) {
-    Element element = element1;
-    string id1 = element.id();
-    string nameElt1 = id1.erase(0, name1.size());  // only keep name of sub-structure
-
-    // search for the element in element2 with the same name (id can be different)
-    unsigned int j = 0;
-    bool connectionOk = false;
-    for (; j < elements2.size(); ++j) {
-      string id2 = elements2[j].id();
-      string nameElt2 = id2.erase(0, name2.size());  // only keep name of sub-structure
-      if (nameElt2 == nameElt1) {
-        connectionOk = true;
-        break;
-      }
-    }
-    if (!connectionOk) {
-      msg << DYNLog(ImpossibleConnection, element.id(), name1, subModel2->name(), subModel2->modelType(), name2);
+    const string& id1 = element1.id();
+    const auto iter = elements2ByName.find(id1.substr(std::min(name1.size(), id1.size())));  // only keep name of sub-structure
+    if (iter == elements2ByName.end()) {
+      msg << DYNLog(ImpossibleConnection, id1, name1, subModel2->name(), subModel2->modelType(), name2);
       throw DYNError(Error::MODELER, MultiIncorrectConnection, msg.str());
     }
-    variables.emplace_back(element.id(), elements2[j].id());
+    variables.emplace_back(id1, elements2[iter->second].id());
   }
 }
 
@@ -921,7 +1825,8 @@ ModelMulti::checkConnects() {
 }
 
 void
-ModelMulti::getFInfos(const int globalFIndex, string& subModelName, int& localFIndex, string& fEquation) const {
+ModelMulti::getFInfos(const int reducedFIndex, string& subModelName, int& localFIndex, string& fEquation) const {
+  const int globalFIndex = aliasElimination_ ? fReducedToFull_[reducedFIndex] : reducedFIndex;
   if (globalFIndex >= connectorContainer_->getOffsetModel()) {
     connectorContainer_->getConnectorInfos(globalFIndex, subModelName, localFIndex, fEquation);
   } else {
@@ -1082,14 +1987,38 @@ ModelMulti::initCurves(const std::shared_ptr<curves::Curve>& curve) {
       }
     }
     // Register curve calculated var index in subModel, to optimize variable update during simulation
-    if (curve->getAvailable() && curve->getCurveType() == Curve::CALCULATED_VARIABLE)
-      curvesCalculatedVarIndexes_.push_back(std::make_pair(subModel, curve->getIndexCalculatedVarInSubModel()));
+    // a calculated variable requested by several curves is only registered once
+    if (curve->getAvailable() && curve->getCurveType() == Curve::CALCULATED_VARIABLE) {
+      const unsigned index = curve->getIndexCalculatedVarInSubModel();
+      std::vector<bool>& mask = curvesCalculatedVarMasks_[subModel.get()];
+      if (mask.size() <= index)
+        mask.resize(index + 1, false);
+      if (!mask[index]) {
+        mask[index] = true;
+        curvesCalculatedVarIndexes_.push_back(std::make_pair(subModel, index));
+      }
+    }
   }
   if (!curve->getAvailable())
     Trace::warn() << DYNLog(CurveNotAdded, modelName, variable) << Trace::endline;
   return curve->getAvailable();
 }
 
+void
+ModelMulti::evalCalculatedVariablesForCurves(const double t, const vector<double>& y, const vector<double>& yp, const vector<double>& z) {
+#if defined(_DEBUG_) || defined(PRINT_TIMERS)
+  Timer timer("ModelMulti::evalCalculatedVariablesForCurves");
+#endif
+  copySolverVariables(y.data(), yp.data());
+  std::copy(z.begin(), z.end(), zLocal_);
+  zSaveOutdated_ = true;
+  notifyValuesChanged();
+
+  for (const auto& subModelMask : curvesCalculatedVarMasks_)
+    subModelMask.first->setCurrentTime(t);
+  updateCalculatedVarForCurves();
+}
+
 void
 ModelMulti::updateCalculatedVarForCurves() const {
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
@@ -1250,7 +2179,8 @@ void ModelMulti::printLocalInitParametersValues() const {
     subModel->printLocalInitParametersValues();
 }
 
-std::string ModelMulti::getVariableName(const int index) {
+std::string ModelMulti::getVariableName(const int reducedIndex) {
+  const int index = aliasElimination_ ? yReducedToFull_[reducedIndex] : reducedIndex;
   // At the first call we construct the association
   if (yNames_.empty()) {
     for (const auto& subModel : subModels_) {
@@ -1265,37 +2195,32 @@ std::string ModelMulti::getVariableName(const int index) {
 }
 
 void ModelMulti::getCurrentZ(vector<double>& z) const {
-  z.assign(zLocal_.begin(), zLocal_.end());
+  z.assign(zLocal_, zLocal_ + sizeZ_);
 }
 
 void ModelMulti::setCurrentZ(const vector<double>& z) {
   assert(z.size() == static_cast<size_t>(sizeZ()));
-  std::copy(z.begin(), z.end(), zLocal_.begin());
+  std::copy(z.begin(), z.end(), zLocal_);
+  zSaveOutdated_ = true;
+  notifyValuesChanged();
 }
 
 void ModelMulti::setLocalInitParameters(const std::shared_ptr<parameters::ParametersSet>& localInitParameters) {
   localInitParameters_ = localInitParameters;
 }
 
-void ModelMulti::registerAction(const string& actionString) {
-  if (!actionBuffer_)
-    return;
-
-  // --- Parse the action string
-  std::istringstream stream(actionString);
+/**
+ * @brief parse the parameter-value pairs of an action and resolve its parameters
+ *
+ * @param subModel sub model targeted by the action
+ * @param stream stream positioned after the name of the sub model
+ * @param actionString whole action string, for the messages
+ * @param parameterValueSet set of parameter values to fill
+ * @return @b false if the action cannot be parsed or targets an unknown parameter
+ */
+static bool
+parseActionParameters(SubModel& subModel, std::istream& stream, const string& actionString, Action::ActionParameters& parameterValueSet) {
   string token;
-  string subModelName;
-
-  // Read the model name (first part before the first comma)
-  std::getline(stream, subModelName, ',');
-
-  const boost::shared_ptr<SubModel> subModel = findSubModelByName(subModelName);
-  if (!subModel) {
-    Trace::warn() << DYNLog(ActionUnknownSubModel, subModelName) << Trace::endline;
-    return;
-  }
-
-  Action::ActionParameters parameterValueSet;
   // Read the rest of the parameter-value pairs
   while (std::getline(stream, token, ',')) {
     string paramName = token;
@@ -1306,11 +2231,12 @@ void ModelMulti::registerAction(const string& actionString) {
     } else {
       string shortAction = (actionString.size() > 40) ? actionString.substr(0, 40) + "..." : actionString;
       Trace::warn() << DYNLog(ActionUnparsable, shortAction) << Trace::endline;
-      return;
+      return false;
     }
 
-    if (subModel->hasParameterDynamic(paramName)) {
-      const ParameterModeler& parameter = subModel->findParameterDynamic(paramName);
+    if (subModel.hasParameterDynamic(paramName)) {
+      // the parameter is resolved once here, its value is set without any lookup when the action is applied
+      ParameterModeler& parameter = subModel.findParameterDynamicReference(paramName);
       boost::any castedValue;
       switch (parameter.getValueType()) {
         case VAR_TYPE_DOUBLE: {
@@ -1336,14 +2262,129 @@ void ModelMulti::registerAction(const string& actionString) {
         }
       }
 
-      parameterValueSet.push_back(std::make_tuple(paramName, castedValue, parameter.getValueType()));
+      Action::ActionParameter actionParameter;
+      actionParameter.parameter = &parameter;
+      actionParameter.value = castedValue;
+      parameterValueSet.push_back(actionParameter);
     } else {
       Trace::warn() << DYNLog(ActionParameterNotFound, paramName) << Trace::endline;
-      return;
+      return false;
+    }
+  }
+  return true;
+}
+
+void ModelMulti::registerAction(const string& actionString) {
+  registerActions(vector<string>(1, actionString));
+}
+
+void ModelMulti::registerActions(const vector<string>& actionStrings) {
+  if (!actionBuffer_)
+    return;
+
+  // the actions targeting the same sub model are merged into one item, so that it is reinitialized once per batch
+  ActionBuffer::ActionBatch batch;
+  std::unordered_map<string, size_t> batchIndexBySubModel;
+  for (const auto& actionString : actionStrings) {
+    // --- Parse the action string
+    std::istringstream stream(actionString);
+    string subModelName;
+
+    // Read the model name (first part before the first comma)
+    std::getline(stream, subModelName, ',');
+
+    const auto batchIndex = batchIndexBySubModel.find(subModelName);
+    boost::shared_ptr<SubModel> subModel;
+    if (batchIndex != batchIndexBySubModel.end()) {
+      subModel = batch[batchIndex->second].first;
+    } else {
+      subModel = findSubModelByName(subModelName);
+      if (!subModel) {
+        Trace::warn() << DYNLog(ActionUnknownSubModel, subModelName) << Trace::endline;
+        continue;
+      }
+    }
+
+    Action::ActionParameters parameterValueSet;
+    if (!parseActionParameters(*subModel, stream, actionString, parameterValueSet))
+      continue;
+
+    if (batchIndex != batchIndexBySubModel.end()) {
+      Action::ActionParameters& batchParameterValueSet = batch[batchIndex->second].second;
+      batchParameterValueSet.insert(batchParameterValueSet.end(), parameterValueSet.begin(), parameterValueSet.end());
+    } else {
+      batchIndexBySubModel[subModelName] = batch.size();
+      batch.push_back(std::make_pair(subModel, parameterValueSet));
     }
   }
   // --- Add to buffer
-  actionBuffer_->addAction(subModel, parameterValueSet);
+  if (!batch.empty())
+    actionBuffer_->addActions(batch);
+}
+
+int ModelMulti::registerActionHandle(const string& subModelName, const string& parameterName) {
+  std::lock_guard<std::mutex> handlesLock(actionHandlesMutex_);
+  const int handle = static_cast<int>(actionHandles_.size());
+  // an unusable parameter takes a handle anyway, so that the following handles do not depend on the validity of this one
+  actionHandles_.push_back(std::make_pair(shared_ptr<SubModel>(), static_cast<ParameterModeler*>(NULL)));
+
+  const shared_ptr<SubModel> subModel = findSubModelByName(subModelName);
+  if (!subModel) {
+    Trace::warn() << DYNLog(ActionUnknownSubModel, subModelName) << Trace::endline;
+    return -1;
+  }
+  if (!subModel->hasParameterDynamic(parameterName)) {
+    Trace::warn() << DYNLog(ActionParameterNotFound, parameterName) << Trace::endline;
+    return -1;
+  }
+  ParameterModeler& parameter = subModel->findParameterDynamicReference(parameterName);
+  if (parameter.getValueType() == VAR_TYPE_STRING) {
+    Trace::warn() << DYNLog(ActionHandleBadType, subModelName, parameterName) << Trace::endline;
+    return -1;
+  }
+  actionHandles_.back() = std::make_pair(subModel, &parameter);
+  Trace::debug() << DYNLog(ActionHandleRegistered, handle, subModelName, parameterName) << Trace::endline;
+  return handle;
+}
+
+void ModelMulti::registerActionValues(const vector<pair<int, double> >& values) {
+  if (!actionBuffer_)
+    return;
+
+  // the values are merged by sub model, as for a batch of action strings
+  ActionBuffer::ActionBatch batch;
+  std::unordered_map<SubModel*, size_t> batchIndexBySubModel;
+  {
+    std::lock_guard<std::mutex> handlesLock(actionHandlesMutex_);
+    for (const auto& handleValue : values) {
+      const int handle = handleValue.first;
+      if (handle < 0 || static_cast<size_t>(handle) >= actionHandles_.size() || !actionHandles_[handle].second) {
+        Trace::warn() << DYNLog(ActionUnknownHandle, handle) << Trace::endline;
+        continue;
+      }
+      const shared_ptr<SubModel>& subModel = actionHandles_[handle].first;
+      Action::ActionParameter actionParameter;
+      actionParameter.parameter = actionHandles_[handle].second;
+      switch (actionParameter.parameter->getValueType()) {
+        case VAR_TYPE_INT:
+          actionParameter.value = static_cast<int>(std::lround(handleValue.second));
+          break;
+        case VAR_TYPE_BOOL:
+          actionParameter.value = doubleNotEquals(handleValue.second, 0.);
+          break;
+        default:
+          actionParameter.value = handleValue.second;
+          break;
+      }
+
+      const auto inserted = batchIndexBySubModel.insert(std::make_pair(subModel.get(), batch.size()));
+      if (inserted.second)
+        batch.push_back(std::make_pair(subModel, Action::ActionParameters()));
+      batch[inserted.first->second].second.push_back(actionParameter);
+    }
+  }
+  if (!batch.empty())
+    actionBuffer_->addActions(batch);
 }
 
 }  // namespace DYN
@@ -19,8 +19,11 @@
  */
 #ifndef MODELER_COMMON_DYNMODELMULTI_H_
 #define MODELER_COMMON_DYNMODELMULTI_H_
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 #include <boost/core/noncopyable.hpp>
 #include <unordered_map>
@@ -29,10 +32,12 @@
 #include "DYNVariable.h"
 #include "DYNBitMask.h"
 #include "DYNActionBuffer.h"
+#include "DYNBufferArena.h"
 
 namespace DYN {
 class SubModel;
 class ConnectorContainer;
+class ThreadPool;
 
 /**
  * @brief Model carrying multiple models
@@ -165,6 +170,31 @@ class ModelMulti : public Model, private boost::noncopyable {
    */
   void notifyTimeStep() override;
 
+  /**
+   * @copydoc Model::setLatencyPartitionEnabled(bool enabled)
+   */
+  void setLatencyPartitionEnabled(bool enabled) override;
+
+  /**
+   * @copydoc Model::printLatencyPartition() const
+   */
+  void printLatencyPartition() const override;
+
+  /**
+   * @copydoc Model::printSubModelCosts() const
+   */
+  void printSubModelCosts() const override;
+
+  /**
+   * @copydoc Model::accountMemory(MemoryUsage& usage) const
+   */
+  void accountMemory(MemoryUsage& usage) const override;
+
+  /**
+   * @copydoc Model::getSubModelPartition(std::vector<int>& fBlocks, std::vector<int>& yBlocks) const
+   */
+  void getSubModelPartition(std::vector<int>& fBlocks, std::vector<int>& yBlocks) const override;
+
   /**
    * @brief retrieve if at least one non-silent discrete variable has changed
    *
@@ -190,7 +220,7 @@ class ModelMulti : public Model, private boost::noncopyable {
    * @copydoc Model::getFType() const
    */
   inline const std::vector<propertyF_t>& getFType() const override {
-    return fType_;
+    return aliasElimination_ ? fTypeReduced_ : fType_;
   }
 
   /**
@@ -207,7 +237,7 @@ class ModelMulti : public Model, private boost::noncopyable {
    * @copydoc Model::getYType()
    */
   inline const std::vector<propertyContinuousVar_t>& getYType() const override {
-    return yType_;
+    return aliasElimination_ ? yTypeReduced_ : yType_;
   }
 
   /**
@@ -241,7 +271,7 @@ class ModelMulti : public Model, private boost::noncopyable {
    * @copydoc Model::sizeF() const
    */
   inline int sizeF() const override {
-    return sizeF_;
+    return aliasElimination_ ? static_cast<int>(fReducedToFull_.size()) : sizeF_;
   }
 
   /**
@@ -262,7 +292,7 @@ class ModelMulti : public Model, private boost::noncopyable {
    * @copydoc Model::sizeY() const
    */
   inline int sizeY() const override {
-    return sizeY_;
+    return aliasElimination_ ? static_cast<int>(yReducedToFull_.size()) : sizeY_;
   }
 
   /**
@@ -321,6 +351,11 @@ class ModelMulti : public Model, private boost::noncopyable {
    */
   void evalCalculatedVariables(double t, const std::vector<double>& y, const std::vector<double>& yp, const std::vector<double>& z) override;
 
+  /**
+   * @copydoc Model::evalCalculatedVariablesForCurves(const double t, const std::vector<double>& y, const std::vector<double>& yp,const std::vector<double>& z)
+   */
+  void evalCalculatedVariablesForCurves(double t, const std::vector<double>& y, const std::vector<double>& yp, const std::vector<double>& z) override;
+
   /**
   * @brief update the subset of calculated variables needed for curves
   */
@@ -346,11 +381,26 @@ class ModelMulti : public Model, private boost::noncopyable {
    */
   void dumpVariables(std::map< std::string, std::string>& mapVariables) override;
 
+  /**
+   * @copydoc Model::dumpParametersAndVariables(const std::function<void(const std::map< std::string, std::string>&)>& writeEntries)
+   */
+  void dumpParametersAndVariables(const std::function<void(const std::map< std::string, std::string>&)>& writeEntries) override;
+
   /**
    * @copydoc Model::loadVariables(const std::map< std::string, std::string> & mapVariables)
    */
   void loadVariables(const std::map< std::string, std::string>& mapVariables) override;
 
+  /**
+   * @copydoc Model::snapshotState(StateBuffer& state) const
+   */
+  void snapshotState(StateBuffer& state) const override;
+
+  /**
+   * @copydoc Model::restoreState(StateBuffer::Reader& state)
+   */
+  void restoreState(StateBuffer::Reader& state) override;
+
   /**
    * @copydoc Model::rotateBuffers()
    */
@@ -385,6 +435,31 @@ class ModelMulti : public Model, private boost::noncopyable {
    */
   void addSubModel(const boost::shared_ptr<SubModel>& sub, const std::string& libName);
 
+  /**
+   * @brief add sub models to the model multi container, their variables, parameters and static data being initialized concurrently
+   *
+   * The sub models are added in the same order and with the same definitions as with successive calls to addSubModel.
+   * The instances defining the definitions shared by their library are initialized first, then the other ones.
+   * The sub models sharing the same PAR parameters set are initialized by the same thread.
+   *
+   * @param subs sub models to add
+   * @param libNames name of the library used to create each sub model
+   * @param nbThreads number of threads initializing the sub models
+   */
+  void addSubModels(const std::vector<boost::shared_ptr<SubModel> >& subs, const std::vector<std::string>& libNames, unsigned nbThreads);
+
+  /**
+   * @brief set the number of threads running the local initialization of the sub models
+   *
+   * The local initializations, such as the Newton solves of the Modelica init models, are independent and run concurrently
+   * if several threads are used. If several of them fail, the error of the first sub model is reported.
+   *
+   * @param nbThreads number of threads initializing the sub models, 1 to initialize them sequentially
+   */
+  void setNbInitThreads(unsigned nbThreads) {
+    nbInitThreads_ = nbThreads;
+  }
+
   /**
    * @brief connect a variable of subModel1 to a variable of subModel2
    *
@@ -495,6 +570,68 @@ class ModelMulti : public Model, private boost::noncopyable {
    */
   void registerAction(const std::string& actionString) override;
 
+  /**
+   * @copydoc Model::registerActions(const std::vector<std::string>& actionStrings)
+   */
+  void registerActions(const std::vector<std::string>& actionStrings) override;
+
+  /**
+   * @copydoc Model::registerActionHandle(const std::string& subModelName, const std::string& parameterName)
+   */
+  int registerActionHandle(const std::string& subModelName, const std::string& parameterName) override;
+
+  /**
+   * @copydoc Model::registerActionValues(const std::vector<std::pair<int, double> >& values)
+   */
+  void registerActionValues(const std::vector<std::pair<int, double> >& values) override;
+
+  /**
+   * @copydoc Model::setNbThreads(unsigned nbThreads)
+   */
+  void setNbThreads(unsigned nbThreads) override;
+
+  /**
+   * @copydoc Model::getThreadPool() const
+   */
+  ThreadPool* getThreadPool() const override {
+    return threadPool_.get();
+  }
+
+  /**
+   * @copydoc Model::setIncrementalRootEvaluation(bool incremental)
+   */
+  void setIncrementalRootEvaluation(bool incremental) override;
+
+  /**
+   * @copydoc Model::setIncrementalResidualEvaluation(bool incremental)
+   */
+  void setIncrementalResidualEvaluation(bool incremental) override;
+
+  /**
+   * @copydoc Model::getNextTimeEvent(double t) const
+   */
+  double getNextTimeEvent(double t) const override;
+
+  /**
+   * @copydoc Model::setEventDrivenDiscreteEvaluation(bool eventDriven)
+   */
+  void setEventDrivenDiscreteEvaluation(bool eventDriven) override;
+
+  /**
+   * @copydoc Model::setBatchEvaluation(bool batch)
+   */
+  void setBatchEvaluation(bool batch) override;
+
+  /**
+   * @copydoc Model::setAliasElimination(bool eliminate)
+   */
+  void setAliasElimination(bool eliminate) override;
+
+  /**
+   * @copydoc Model::notifyRootsChange(const std::vector<state_g>& gBefore, const std::vector<state_g>& gAfter)
+   */
+  void notifyRootsChange(const std::vector<state_g>& gBefore, const std::vector<state_g>& gAfter) override;
+
  private:
   /**
    * @brief create a submodel for a calculated variable when connecting a state and a calculated variables
@@ -525,6 +662,17 @@ class ModelMulti : public Model, private boost::noncopyable {
    */
   zChangeType_t propagateZModif();
 
+  /**
+   * @brief copy the new values of some discrete variables to the variables connected to them
+   *
+   * The other discrete variables must not have changed since the last propagation.
+   *
+   * @param candidates indexes of the discrete variables that may have changed
+   * @param changedIndexes indexes of the discrete variables that changed or were written by the propagation
+   * @return the type of discrete variable that has changed
+   */
+  zChangeType_t propagateZModif(const std::vector<int>& candidates, std::vector<int>& changedIndexes);
+
   /**
    * @brief connect a variable of subModel1 to a variable of subModel2
    *
@@ -591,9 +739,164 @@ class ModelMulti : public Model, private boost::noncopyable {
    */
   void collectSilentZ();
 
+  /**
+   * @brief find the sub model whose definitions are shared by a sub model to add
+   *
+   * @param sub sub model to add
+   * @param libName name of the library used to create the sub model
+   * @return sub model whose definitions are shared, nullptr if the sub model defines its own ones
+   */
+  boost::shared_ptr<SubModel> findDefinitionsModel(const boost::shared_ptr<SubModel>& sub, const std::string& libName) const;
+
+  /**
+   * @brief define the variables, names, parameters and elements of a sub model and initialize its static data
+   *
+   * @param sub sub model to initialize
+   * @param definitionsModel sub model whose definitions are shared, nullptr if the sub model defines its own ones
+   */
+  static void initSubModel(const boost::shared_ptr<SubModel>& sub, const boost::shared_ptr<SubModel>& definitionsModel);
+
+  /**
+   * @brief register an initialized sub model in the container
+   *
+   * @param sub sub model to register
+   * @param libName name of the library used to create the sub model
+   */
+  void registerSubModel(const boost::shared_ptr<SubModel>& sub, const std::string& libName);
+
+  /**
+   * @brief split the sub models into contiguous ranges of balanced cost, several per thread
+   *
+   * The ranges are taken dynamically by the threads of the pool, so that a thread slowed down by an expensive sub model
+   * takes fewer ranges. The mean evaluation time of a sub model measured by the cost accounting is used as an estimate of its
+   * cost when available, its number of residual functions otherwise. The partition does not change the results: each sub
+   * model writes its own residuals and the Jacobian blocks of the ranges are appended in order.
+   */
+  void computePartitions();
+
+  /**
+   * @brief group the sub models sharing the same batch key, the other ones being alone in their batch
+   *
+   * With a thread pool, the batches are also cut into slices evaluated concurrently.
+   */
+  void computeBatches();
+
+  /**
+   * @brief cut the batches into slices of similar costs, several by thread so that the threads end together
+   *
+   * A large batch is shared between several slices, each one evaluated by the batch kernel. The consecutive sub models alone
+   * in their batch are gathered in the same slice.
+   */
+  void computeBatchSlices();
+
+  /**
+   * @brief evaluate the residual functions of the sub models by slices of batches, concurrently
+   *
+   * @param t Simulation instant
+   * @param type type of the residues to compute (all of them or the differential ones)
+   */
+  void evalFBatchSlices(double t, propertyF_t type);
+
+  /**
+   * @brief whether the sub models are currently evaluated by batches
+   *
+   * The batches are not used with the cost accounting of the sub models.
+   *
+   * @return @b true if the sub models are evaluated by batches
+   */
+  bool useBatches() const {
+    return batchEvaluation_ && !SubModel::isCostAccountingEnabled();
+  }
+
+  /**
+   * @brief evaluate the Jacobian part of the sub models, each range of sub models filling its own column block
+   *
+   * @param t time to use for the evaluation
+   * @param cj Jacobian prime coefficient
+   * @param evalJtSub sub model function filling the Jacobian part of this sub model
+   * @param jt sparse matrix to fill
+   */
+  void evalJtSubModelsByPartitions(double t, double cj, void (SubModel::*evalJtSub)(double, double, int&, SparseMatrix&), SparseMatrix& jt);
+
+  /**
+   * @brief build the correspondence between the variables and residual functions of the model and the ones of the system without aliases
+   */
+  void computeAliases();
+
+  /**
+   * @brief compute the types of the variables and residual functions of the system without aliases
+   *
+   * A variable kept is differential if one of its aliases is.
+   */
+  void computeReducedTypes();
+
+  /**
+   * @brief copy the continuous variables given by a solver in the local buffers, the aliases being set from the variables kept
+   *
+   * @param y values of the continuous variables given by the solver
+   * @param yp values of the derivatives of the continuous variables given by the solver
+   */
+  void copySolverVariables(const double* y, const double* yp);
+
+  /**
+   * @brief copy the residual functions to give to a solver, without the equations of the aliases
+   *
+   * @param f residual functions given to the solver
+   */
+  void copySolverResiduals(double* f) const;
+
+  /**
+   * @brief evaluate the Jacobian of the model with all its variables and residual functions
+   *
+   * @param t time to use for the evaluation
+   * @param cj Jacobian prime coefficient
+   * @param jt sparse matrix to fill
+   */
+  void evalJtFull(double t, double cj, SparseMatrix& jt);
+
+  /**
+   * @brief evaluate the derivative Jacobian of the model with all its variables and residual functions
+   *
+   * @param t time to use for the evaluation
+   * @param cj Jacobian prime coefficient
+   * @param jtPrim sparse matrix to fill
+   */
+  void evalJtPrimFull(double t, double cj, SparseMatrix& jtPrim);
+
+  /**
+   * @brief fill the Jacobian of the system without aliases: the terms of an alias are added to the ones of the variable kept
+   *
+   * @param jtFull Jacobian with all the variables and residual functions
+   * @param jt sparse matrix to fill
+   */
+  void reduceJacobian(const SparseMatrix& jtFull, SparseMatrix& jt);
+
+  /**
+   * @brief count the sub models whose continuous variables moved since their last activity
+   *
+   * A sub model is active at a time step when one of its variables moved by more than a relative tolerance since the
+   * last time step it was active.
+   */
+  void updateLatency();
+
+  /**
+   * @brief whether the discrete variables and modes of a sub model have to be evaluated during the current event
+   *
+   * @param subModelIndex index of the sub model in subModels_
+   *
+   * @return @b false if the evaluation can be skipped
+   */
+  bool isConcernedByEvent(unsigned int subModelIndex) const;
+
+  /**
+   * @brief notify all the sub models that the global buffers were modified outside of their evaluation
+   */
+  void notifyValuesChanged() const;
+
  private:
   std::unordered_map<int, int> mapAssociationF_;  ///< association between an index of f functions and a subModel
   std::unordered_map<int, int> mapAssociationG_;  ///< association between an index of g functions and a subModel
+  std::unordered_map<int, int> mapAssociationZ_;  ///< association between an index of discrete variables and a subModel
   std::vector<std::string> yNames_;  ///< names of all variables y
   std::vector<boost::shared_ptr<SubModel> > subModels_;  ///< list of each sub models
   std::unordered_map<std::string, size_t > subModelByName_;  ///< map associating a sub model name to its index in subModels_
@@ -617,11 +920,12 @@ class ModelMulti : public Model, private boost::noncopyable {
   unsigned int offsetFOptional_;  ///< offset in whole F buffer for optional equations
   std::set<int> numVarsOptional_;  ///< index of optional variables
 
-  std::vector<double> fLocal_;  ///< local buffer to fill with the residual values
-  std::vector<state_g> gLocal_;  ///< local buffer to fill with the roots values
-  std::vector<double> yLocal_;  ///< local buffer to use when accessing continuous variables
-  std::vector<double> ypLocal_;  ///< local buffer to use when accessing derivatives of continuous variables
-  std::vector<double> zLocal_;  ///< local buffer to use when accessing discrete variables
+  BufferArena buffers_;  ///< single memory block holding the local buffers below, shared by the sub models
+  double* fLocal_;  ///< local buffer to fill with the residual values
+  state_g* gLocal_;  ///< local buffer to fill with the roots values
+  double* yLocal_;  ///< local buffer to use when accessing continuous variables
+  double* ypLocal_;  ///< local buffer to use when accessing derivatives of continuous variables
+  double* zLocal_;  ///< local buffer to use when accessing discrete variables
   bool* zConnectedLocal_;  ///< local buffer to use when accessing discrete variables connection status
   std::vector<BitMask> silentZ_;  ///< local buffer indicating if the corresponding discrete variable is silent
   bool silentZInitialized_;  ///< true if silentZ were collected
@@ -631,9 +935,64 @@ class ModelMulti : public Model, private boost::noncopyable {
 
   std::shared_ptr<parameters::ParametersSet> localInitParameters_;  ///< local initialization solver parameters set
   std::vector<std::pair<boost::shared_ptr<SubModel>, unsigned>> curvesCalculatedVarIndexes_;  ///< curves calculated var locations in subModel
+  std::unordered_map<SubModel*, std::vector<bool> > curvesCalculatedVarMasks_;  ///< per sub model, calculated variables already registered for curves
 
   bool updatablesInitialized_;                  ///< true if updatable models have been initialized
   std::shared_ptr<ActionBuffer> actionBuffer_;  ///< action manager for interactive mode
+  std::vector<std::pair<boost::shared_ptr<SubModel>, ParameterModeler*> > actionHandles_;  ///< parameters registered for actions, by handle
+  std::mutex actionHandlesMutex_;  ///< mutex for registering/using the action handles
+
+  std::unique_ptr<ThreadPool> threadPool_;  ///< pool used to evaluate the sub models concurrently, nullptr if sequential
+  unsigned nbInitThreads_;  ///< number of threads running the local initialization of the sub models
+  std::vector<size_t> partitions_;  ///< boundaries in subModels_ of the ranges of sub models evaluated concurrently
+  std::vector<int> partitionsRowOffset_;  ///< offset of the first variable of each range of sub models
+  std::vector<int> partitionsNbCols_;  ///< number of Jacobian columns filled by each range of sub models
+  std::vector<std::unique_ptr<SparseMatrix> > jtBlocks_;  ///< column block filled by each range of sub models but the first one
+  bool partitionsWithMeasuredCosts_;  ///< whether the ranges of sub models are balanced with the costs measured by the cost accounting
+  unsigned nbEvalFSincePartitions_;  ///< number of concurrent evaluations of the residual functions since the ranges were computed
+
+  bool latencyPartitionEnabled_;  ///< whether the activity of the sub models is observed at each time step
+  std::vector<double> yLatencyReference_;  ///< values of y at the last time step each sub model was active
+  std::vector<unsigned int> nbActiveSteps_;  ///< number of time steps during which each sub model was active
+  unsigned int nbNotifiedSteps_;  ///< number of time steps notified since the beginning of the simulation
+
+  bool incrementalRootEvaluation_;  ///< whether the root functions of a sub model are only evaluated again when their inputs changed
+  bool incrementalResidualEvaluation_;  ///< whether the residual functions of a sub model are only evaluated again when their inputs changed
+  std::vector<double> timeEvents_;  ///< sorted times of the events scheduled by the sub models
+
+  bool batchEvaluation_;  ///< whether the sub models sharing the same model are evaluated by batches
+  std::vector<SubModel*> batchedSubModels_;  ///< sub models ordered by batch
+  std::vector<size_t> batchBoundaries_;  ///< boundaries in batchedSubModels_ of the batches
+  /**
+   * @brief range of batchedSubModels_ evaluated by one task of the thread pool
+   */
+  struct BatchSlice {
+    size_t begin;  ///< index of the first sub model of the slice
+    size_t end;  ///< index after the last sub model of the slice
+    bool batched;  ///< whether the sub models share a batch key and are evaluated by the batch kernel
+  };
+  std::vector<BatchSlice> batchSlices_;  ///< slices of the batches evaluated concurrently, with a thread pool
+
+  bool eventDrivenDiscreteEvaluation_;  ///< whether the discrete evaluation is restricted to the sub models concerned by an event
+  bool eventSubModelsKnown_;  ///< whether eventSubModels_ describes the current event
+  std::vector<bool> eventSubModels_;  ///< sub models concerned by the current event
+  std::vector<double> zBeforeEvalZ_;  ///< values of the discrete variables before the last evaluation
+  bool zSaveOutdated_;  ///< whether discrete variables may have changed outside of the discrete evaluation since the last propagation
+  std::vector<zChangeType_t> zChangeTypes_;  ///< type of change raised by each discrete variable, NO_Z_CHANGE if it is not checked
+  std::vector<int> zCandidates_;  ///< indexes of the discrete variables of the sub models evaluated by the last discrete evaluation
+  std::vector<int> zChangedIndexes_;  ///< indexes of the discrete variables changed by the last discrete evaluation
+
+  bool aliasElimination_;  ///< whether the solvers only see the continuous variables that are not aliases of another one
+  std::vector<int> yFullToReduced_;  ///< index in the system without aliases of each continuous variable, the one of its variable kept for an alias
+  std::vector<double> yAliasSigns_;  ///< factor between each continuous variable and its variable kept: 1, or -1 for opposite variables
+  std::vector<int> yReducedToFull_;  ///< index of each variable of the system without aliases
+  std::vector<int> fReducedToFull_;  ///< index of each residual function of the system without aliases
+  std::vector<propertyContinuousVar_t> yTypeReduced_;  ///< property of each variable of the system without aliases
+  std::vector<propertyF_t> fTypeReduced_;  ///< property of each residual function of the system without aliases
+  std::unique_ptr<SparseMatrix> jtFull_;  ///< Jacobian with all the variables and residual functions, before the elimination of the aliases
+  std::vector<int> jtColumnPositions_;  ///< position of each variable kept in jtColumnRows_, -1 if not in the current column
+  std::vector<int> jtColumnRows_;  ///< variables kept of the terms of the current column of the Jacobian without aliases
+  std::vector<double> jtColumnValues_;  ///< values of the terms of the current column of the Jacobian without aliases
 };  ///< Class for Multiple-Model
 
 
@@ -39,12 +39,6 @@ void printStructureToFile(Model& model, const SparseMatrix& matrix) {
   stringstream fileName;
   fileName << base.string() << nbPrintStruct << ".txt";
 
-  // If not in debug the infos on equations are not set.
-#ifndef _DEBUG_
-  if (nbPrintStruct == 0)
-    model.setFequationsModel();  ///< set formula for modelica models' equations and Network models' equations
-#endif
-
   if (!exists(folder.string())) {
     createDirectory(folder.string());
   }
@@ -18,6 +18,8 @@
  *
  */
 
+#include <algorithm>
+#include <cstdlib>
 #include <string>
 #include <vector>
 #include <cmath>
@@ -31,6 +33,8 @@
 #include "DYDMacroConnector.h"
 #include "DYDMacroConnect.h"
 #include "DYDMacroConnection.h"
+#include "DYDMacroStaticReference.h"
+#include "DYDStaticRef.h"
 #include "DYDDynamicModelsCollection.h"
 #include "DYDModel.h"
 #include "DYDModelicaModel.h"
@@ -66,9 +70,21 @@ using parameters::Reference;
 
 namespace DYN {
 
+/**
+ * @brief get the number of threads loading and initializing the models
+ * @return number of threads, given by the environment variable DYNAWO_NB_LOADING_THREADS, 1 by default
+ */
+static unsigned
+nbLoadingThreads() {
+  if (hasEnvVar("DYNAWO_NB_LOADING_THREADS"))
+    return static_cast<unsigned>(std::max(std::atoi(getEnvVar("DYNAWO_NB_LOADING_THREADS").c_str()), 1));
+  return 1;
+}
+
 void
 Modeler::initSystem() {
   model_ = std::make_shared<ModelMulti>();
+  model_->setNbInitThreads(nbLoadingThreads());
 
   if (data_ && data_->instantiateNetwork())
     initNetwork();
@@ -100,6 +116,19 @@ Modeler::initNetwork() {
 
 void
 Modeler::initModelDescription() {
+  // the libraries are all loaded first, so that they can be loaded concurrently
+  vector<string> libs;
+  for (const auto& modelDescriptionPair : dyd_->getModelDescriptions()) {
+    const auto& modelDescription = modelDescriptionPair.second;
+    if (modelDescription->getModel()->getType() != dynamicdata::Model::MODEL_TEMPLATE && modelDescription->hasCompiledModel())
+      libs.push_back(modelDescription->getLib());
+  }
+  const unsigned nbThreads = nbLoadingThreads();
+  SubModelFactory::loadLibs(libs, nbThreads);
+  libs.clear();
+
+  // the parameters, references and data are bound model by model, as the models may share a parameters set
+  vector<shared_ptr<SubModel> > models;
   for (const auto& modelDescriptionPair : dyd_->getModelDescriptions()) {
     const auto& modelDescription = modelDescriptionPair.second;
     if (modelDescription->getModel()->getType() == dynamicdata::Model::MODEL_TEMPLATE) {
@@ -116,8 +145,8 @@ Modeler::initModelDescription() {
 
       model->setPARParameters(params);
       model->initFromData(data_);
-      // add the submodel
-      model_->addSubModel(model, modelDescription->getLib());
+      models.push_back(model);
+      libs.push_back(modelDescription->getLib());
       subModels_[modelDescription->getID()] = model;
       modelDescription->setSubModel(model);
       // reference static
@@ -129,6 +158,30 @@ Modeler::initModelDescription() {
       throw DYNError(Error::MODELER, CompileModel, modelDescription->getID());
     }
   }
+  // the variables, parameters and static data of the models are then initialized concurrently, in the order of the descriptions
+  model_->addSubModels(models, libs, nbThreads);
+}
+
+/**
+ * @brief create the parameter of a reference from the value of the static parameter it refers to
+ * @param data data interface where the static parameter was found
+ * @param params parameters set where the parameter is created
+ * @param referenceName name of the reference
+ * @param refType type of the reference
+ * @param staticParameter static parameter the reference refers to
+ */
+static void
+createReferenceParameter(const DataInterface& data, const std::shared_ptr<ParametersSet>& params, const string& referenceName, const string& refType,
+    const StaticParameter& staticParameter) {
+  if (refType == "DOUBLE") {
+    params->createParameter(referenceName, data.getStaticParameterDoubleValue(staticParameter));
+  } else if (refType == "INT") {
+    params->createParameter(referenceName, data.getStaticParameterIntValue(staticParameter));
+  } else if (refType == "BOOL") {
+    params->createParameter(referenceName, data.getStaticParameterBoolValue(staticParameter));
+  } else {
+    throw DYNError(Error::MODELER, ParameterWrongTypeReference, referenceName);
+  }
 }
 
 void
@@ -138,29 +191,27 @@ Modeler::initParamDescription(const std::shared_ptr<ModelDescription>& modelDesc
   // params can be a nullptr if no parFile was given for the model
   if (params) {
     // if there are references in external parameters, retrieve the parameters' value from IIDM
+    // the references to the static model of the model are resolved together, so that it is only found once
+    const string& modelStaticID = modelDescription->getStaticId();
+    vector<std::pair<string, std::shared_ptr<Reference> > > staticModelReferences;
+    vector<string> staticModelRefOrigNames;
+    vector<const StaticParameter*> staticParameters;
     for (const auto& referenceName : params->getReferencesNames()) {
-      string refType = params->getReference(referenceName)->getType();
-      const Reference::OriginData refOrigData = params->getReference(referenceName)->getOrigData();
-      const string& refOrigName = params->getReference(referenceName)->getOrigName();
-      string staticID = modelDescription->getStaticId();
-      const string& componentID = params->getReference(referenceName)->getComponentId();
+      const std::shared_ptr<Reference>& reference = params->getReference(referenceName);
+      const Reference::OriginData refOrigData = reference->getOrigData();
+      const string& refOrigName = reference->getOrigName();
+      const string& componentID = reference->getComponentId();
       // if data_ origin is IIDM file, retrieve the value and add a parameter in the parameter set.
-      if (!componentID.empty())
-        staticID = componentID;  // when componentID exist, this id should be used to find the parameter value
       if (refOrigData == Reference::IIDM) {
-        if (staticID.empty())
-          throw DYNError(Error::MODELER, ParameterStaticIdNotFound, refOrigName, params->getReference(referenceName)->getName(), modelDescription->getID());
-        if (refType == "DOUBLE") {
-          const double value = data_->getStaticParameterDoubleValue(staticID, refOrigName);
-          params->createParameter(referenceName, value);
-        } else if (refType == "INT") {
-          const int value = data_->getStaticParameterIntValue(staticID, refOrigName);
-          params->createParameter(referenceName, value);
-        } else if (refType == "BOOL") {
-          const bool value = data_->getStaticParameterBoolValue(staticID, refOrigName);
-          params->createParameter(referenceName, value);
+        if (componentID.empty()) {
+          if (modelStaticID.empty())
+            throw DYNError(Error::MODELER, ParameterStaticIdNotFound, refOrigName, reference->getName(), modelDescription->getID());
+          staticModelReferences.emplace_back(referenceName, reference);
+          staticModelRefOrigNames.push_back(refOrigName);
         } else {
-          throw DYNError(Error::MODELER, ParameterWrongTypeReference, referenceName);
+          // when componentID exist, this id should be used to find the parameter value
+          data_->findStaticParameters(componentID, vector<string>(1, refOrigName), staticParameters);
+          createReferenceParameter(*data_, params, referenceName, reference->getType(), *staticParameters.front());
         }
       } else if (refOrigData == Reference::PAR) {
         continue;  // PAR reference already resolved in DynamicData => nothing to do
@@ -168,6 +219,12 @@ Modeler::initParamDescription(const std::shared_ptr<ModelDescription>& modelDesc
         throw DYNError(Error::MODELER, FunctionNotAvailable);
       }
     }
+
+    if (!staticModelReferences.empty()) {
+      data_->findStaticParameters(modelStaticID, staticModelRefOrigNames, staticParameters);
+      for (unsigned int i = 0; i < staticModelReferences.size(); ++i)
+        createReferenceParameter(*data_, params, staticModelReferences[i].first, staticModelReferences[i].second->getType(), *staticParameters[i]);
+    }
   }
 }
 
@@ -180,6 +237,12 @@ Modeler::initStaticRefs(const boost::shared_ptr<SubModel>& model, const std::sha
 
     data_->setReference(staticVar, model->staticId(), modelID, modelVar);
   }
+  for (const auto& macroStaticReference : modelDescription->getMacroStaticReferences()) {
+    for (const auto& staticRefPair : macroStaticReference->getStaticReferences()) {
+      const auto& staticRef = staticRefPair.second;
+      data_->setReference(staticRef->getStaticVar(), model->staticId(), modelDescription->getID(), staticRef->getModelVar());
+    }
+  }
 }
 
 
@@ -22,43 +22,94 @@
 #include "DYNMacrosMessage.h"
 
 #include <algorithm>
-#include <boost/bind.hpp>
 
 namespace DYN {
-RingBuffer::RingBuffer(const double maxDelay) : queue_(), maxDelay_(maxDelay) {}
+/**
+ * @brief initial capacity of the arrays, a power of two
+ */
+static const size_t INITIAL_CAPACITY = 16;
+
+RingBuffer::RingBuffer(const double maxDelay) :
+times_(INITIAL_CAPACITY),
+values_(INITIAL_CAPACITY),
+mask_(INITIAL_CAPACITY - 1),
+begin_(0),
+end_(0),
+lastFound_(0),
+maxDelay_(maxDelay) {}
 
 void
 RingBuffer::add(double time, double value) {
-  if (!queue_.empty() && doubleEquals(queue_.back().first, time)) {
+  if (end_ != begin_ && doubleEquals(times_[(end_ - 1) & mask_], time)) {
     // ignore if we add multiple time the same value
     return;
   }
 
 #if _DEBUG_
-  if (!queue_.empty()) {
-    assert(time > queue_.back().first);
+  if (end_ != begin_) {
+    assert(time > times_[(end_ - 1) & mask_]);
   }
 #endif
 
-  queue_.emplace_back(time, value);
+  addNoCheck(time, value);
 
   removeUseless();
 }
 
+void
+RingBuffer::grow() {
+  const size_t capacity = times_.size();
+  std::vector<double> times(2 * capacity);
+  std::vector<double> values(2 * capacity);
+  const size_t mask = 2 * capacity - 1;
+  for (size_t rank = begin_; rank != end_; ++rank) {
+    times[rank & mask] = times_[rank & mask_];
+    values[rank & mask] = values_[rank & mask_];
+  }
+  times_.swap(times);
+  values_.swap(values);
+  mask_ = mask;
+}
+
 void
 RingBuffer::removeUseless() {
-  const double last_time = queue_.back().first;
-  // By construction, the queue is sorted by "time" value so if the criteria is no longer passed,
+  const double last_time = times_[(end_ - 1) & mask_];
+  // By construction, the buffer is sorted by "time" value so if the criteria is no longer passed,
   // it will never be passed again
-  auto found =
-      std::lower_bound(queue_.begin(), queue_.end(), last_time - maxDelay_, boost::bind<bool>(&RingBuffer::comparePairTime, this, _1, _2));
+  size_t found = lowerBound(last_time - maxDelay_);
 
-  if (found != queue_.begin() && !queue_.empty()) {
+  if (found != begin_) {
     // we keep the first point which doesn't respect to enable interpolation
     --found;
   }
 
-  queue_.erase(queue_.begin(), found);
+  begin_ = found;
+}
+
+size_t
+RingBuffer::lowerBound(const double time_value) const {
+  // timed value cannot be too close to each other as these times are sent by the solvers
+  // the requested times mostly increase: the last element found, then the next one, are tried first
+  for (size_t rank = std::max(lastFound_, begin_), rankEnd = std::min(rank + 2, end_ + 1); rank < rankEnd; ++rank) {
+    if ((rank == begin_ || times_[(rank - 1) & mask_] < time_value) && (rank == end_ || !(times_[rank & mask_] < time_value))) {
+      lastFound_ = rank;
+      return rank;
+    }
+  }
+
+  size_t first = begin_;
+  size_t count = end_ - begin_;
+  while (count > 0) {
+    const size_t step = count / 2;
+    if (times_[(first + step) & mask_] < time_value) {
+      first += step + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+  lastFound_ = first;
+  return first;
 }
 
 double
@@ -69,49 +120,43 @@ RingBuffer::get(double time, double delay) const {
     throw DYNError(DYN::Error::SIMULATION, IncorrectDelay, delay, time, maxDelay_);
   }
 
-  const auto found =
-      std::lower_bound(queue_.begin(), queue_.end(), time_value, boost::bind<bool>(&RingBuffer::comparePairTime, this, _1, _2));
-  if (found == queue_.end()) {
-    // it means that the required time is greater than the last value in the queue
+  const size_t found = lowerBound(time_value);
+  if (found == end_) {
+    // it means that the required time is greater than the last value in the buffer
     // => we perform linear interpolation using the last two most recent if we can
-    if (queue_.size() > 1) {
-      auto it = queue_.rbegin();
-      ++it;
-      return interpol(*(queue_.rbegin()), *it, time_value);
+    if (size() > 1) {
+      return interpol(end_ - 1, end_ - 2, time_value);
     } else {
-      return queue_.back().second;
+      return values_[(end_ - 1) & mask_];
     }
-  } else if (doubleEquals(found->first, time_value)) {
-    return found->second;
-  } else if (found == queue_.begin()) {
+  } else if (doubleEquals(times_[found & mask_], time_value)) {
+    return values_[found & mask_];
+  } else if (found == begin_) {
     // case first element: it would mean that delay is greater than max delay
     // shouldn't happen by construction with function add
     throw DYNError(DYN::Error::SIMULATION, IncorrectDelay, delay, time, maxDelay_);
   } else {
-    const std::pair<double, double>& previous = *(found - 1);
     // linear interpolation
-    return interpol(previous, *found, time_value);
+    return interpol(found - 1, found, time_value);
   }
 }
 
-bool
-RingBuffer::comparePairTime(const std::pair<double, double>& pair, const double time_value) const {
-  // timed value cannot be too close to each other as these times are sent by the solvers
-  return pair.first < time_value;
-}
-
 double
-RingBuffer::interpol(const std::pair<double, double>& p1, const std::pair<double, double>& p2, const double time) {
-  const double a = (p2.second - p1.second) / (p2.first - p1.first);
-  const double b = (p2.first * p1.second - p1.first * p2.second) / (p2.first - p1.first);
+RingBuffer::interpol(const size_t rank1, const size_t rank2, const double time) const {
+  const double t1 = times_[rank1 & mask_];
+  const double v1 = values_[rank1 & mask_];
+  const double t2 = times_[rank2 & mask_];
+  const double v2 = values_[rank2 & mask_];
+  const double a = (v2 - v1) / (t2 - t1);
+  const double b = (t2 * v1 - t1 * v2) / (t2 - t1);
 
   return a * time + b;
 }
 
 void
 RingBuffer::points(std::vector<std::pair<double, double> >& vec) const {
-  for (const auto& point : queue_)
-    vec.push_back(point);
+  for (size_t rank = begin_; rank != end_; ++rank)
+    vec.push_back(std::make_pair(times_[rank & mask_], values_[rank & mask_]));
 }
 
 }  // namespace DYN
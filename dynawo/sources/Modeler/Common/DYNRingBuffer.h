@@ -21,7 +21,6 @@
 #define MODELER_COMMON_DYNRINGBUFFER_H_
 
 #include <cstddef>
-#include <deque>
 #include <utility>
 #include <vector>
 
@@ -35,6 +34,10 @@ namespace DYN {
  * When a variable value is added, the previous elements which timepoint that satisfies t - maxDelay < tmax (where tmax is the most recent timepoint added) are removed
  *
  * When a variable value is requested, if the requested timepoint does not correspond to an element, linear interpolation is performed to retrieve the value
+ *
+ * The times and the values are stored in two contiguous circular arrays whose capacity is a power of two. The elements are identified
+ * by their rank since the creation of the buffer, so that the removal of the oldest elements only moves the first rank. The rank of the
+ * last element found is kept, the requested timepoints being mostly increasing.
  */
 class RingBuffer {
  public:
@@ -62,7 +65,11 @@ class RingBuffer {
    * @param value value of the variable
    */
   void addNoCheck(double time, double value) {
-    queue_.push_back(std::make_pair(time, value));
+    if (end_ - begin_ == times_.size())
+      grow();
+    times_[end_ & mask_] = time;
+    values_[end_ & mask_] = value;
+    ++end_;
   }
 
   /**
@@ -94,7 +101,7 @@ class RingBuffer {
    * @returns the current size of the buffer
    */
   size_t size() const {
-    return queue_.size();
+    return end_ - begin_;
   }
 
   /**
@@ -120,20 +127,29 @@ class RingBuffer {
    * @return the last registered values (time, value) in the ring buffer
    */
   std::pair<double, double> getLastRegisteredPoint() const {
-    return queue_.back();
+    return std::make_pair(times_[(end_ - 1) & mask_], values_[(end_ - 1) & mask_]);
+  }
+
+  /**
+   * @brief Retrieves the memory used by the registered timed values
+   *
+   * @returns the number of bytes allocated for the timed values
+   */
+  size_t getMemoryUsage() const {
+    return times_.capacity() * sizeof(double) + values_.capacity() * sizeof(double);
   }
 
  private:
   /**
-   * @brief Performs linear interpolation between the two 2D points @p p1 and @p p2 in abcisse @p time
+   * @brief Performs linear interpolation between the points of rank @p rank1 and @p rank2 in abcisse @p time
    *
-   * @param p1 the first point of interpolation
-   * @param p2 the second point of interpolation
+   * @param rank1 rank of the first point of interpolation
+   * @param rank2 rank of the second point of interpolation
    * @param time the abcisse to compute the interpolation at
    *
    * @returns the interpolated value at @a time
    */
-  static double interpol(const std::pair<double, double>& p1, const std::pair<double, double>& p2, double time);
+  double interpol(size_t rank1, size_t rank2, double time) const;
 
  private:
   /**
@@ -142,18 +158,29 @@ class RingBuffer {
   void removeUseless();
 
   /**
-   * @brief Compare pair only using its first element (time)
+   * @brief Retrieve the rank of the first element whose time is not less than @p time_value
+   *
+   * The rank of the last element found is tried first, then the next one, before a binary search
    *
-   * @param pair the pair to test
-   * @param time_value the time_value to compare the pair to
+   * @param time_value the time to look for
    *
-   * @returns true if the time_value is the pair is less than the time_value
+   * @returns the rank of the first element whose time is not less than @p time_value, the end rank if there is none
+   */
+  size_t lowerBound(double time_value) const;
+
+  /**
+   * @brief Double the capacity of the arrays, the elements keeping their rank
    */
-  bool comparePairTime(const std::pair<double, double>& pair, double time_value) const;
+  void grow();
 
  private:
-  std::deque<std::pair<double, double> > queue_;  ///< queue of  (timestamp, value) pairs
-  double maxDelay_;                               ///< maximum delay allowed for this buffer
+  std::vector<double> times_;   ///< circular array of the timestamps
+  std::vector<double> values_;  ///< circular array of the values
+  size_t mask_;                 ///< capacity of the arrays minus one, the capacity being a power of two
+  size_t begin_;                ///< rank of the first element
+  size_t end_;                  ///< rank following the last element
+  mutable size_t lastFound_;    ///< rank of the last element found by lowerBound
+  double maxDelay_;             ///< maximum delay allowed for this buffer
 };
 }  // namespace DYN
 
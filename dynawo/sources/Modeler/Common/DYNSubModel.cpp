@@ -21,12 +21,14 @@
 #include <iostream>
 #include <fstream>
 #include <map>
-#include <algorithm>  // std::find, std::copy
+#include <algorithm>  // std::find, std::copy, std::equal
 #include <set>
+#include <chrono>
 #ifdef _DEBUG_
 #include <assert.h>
 #endif
 #include <boost/pointer_cast.hpp>
+#include <boost/make_shared.hpp>
 #include <boost/algorithm/string/split.hpp>
 #include <boost/algorithm/string.hpp>
 
@@ -43,6 +45,7 @@
 #include "DYNSubModelFactory.h"
 #include "DYNTrace.h"
 #include "DYNMacrosMessage.h"
+#include "DYNMemoryUsage.h"
 #include "DYNFileSystemUtils.h"
 #include "DYNTimer.h"
 #include "DYNDataInterface.h"
@@ -61,6 +64,39 @@ using curves::Curve;
 
 namespace DYN {
 
+std::atomic<bool> SubModel::costAccountingEnabled_(false);
+
+/**
+ * @brief Add the time spent between its creation and its destruction to the cost of an evaluation, if the
+ * accounting is enabled
+ */
+class EvaluationCostScope {
+ public:
+  /**
+   * @brief constructor
+   * @param cost cost of the evaluation
+   */
+  explicit EvaluationCostScope(SubModel::EvaluationCost& cost) :
+  cost_(SubModel::isCostAccountingEnabled() ? &cost : NULL) {
+    if (cost_)
+      start_ = std::chrono::steady_clock::now();
+  }
+
+  /**
+   * @brief destructor
+   */
+  ~EvaluationCostScope() {
+    if (cost_) {
+      ++cost_->nbCalls;
+      cost_->time += std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+    }
+  }
+
+ private:
+  SubModel::EvaluationCost* cost_;  ///< cost of the evaluation, null if the accounting is disabled
+  std::chrono::steady_clock::time_point start_;  ///< start of the evaluation
+};
+
 SubModel::SubModel() :
 sizeF_(0),
 sizeZ_(0),
@@ -98,15 +134,60 @@ offsetYSave_(-1),
 modeChange_(false),
 modeChangeType_(NO_MODE) ,
 initialized_(false),
+variableDefinitions_(boost::make_shared<VariableDefinitions>()),
+variableDefinitionsInit_(boost::make_shared<VariableDefinitions>()),
+elementDefinitions_(boost::make_shared<ElementDefinitions>()),
 currentTime_(0.),
+valuesVersion_(0),
 isInitProcess_(false),
-isUpdatable_(false) {
-  variables_.clear();
+isUpdatable_(false),
+fEquationsSet_(false),
+gEquationsSet_(false),
+rootInputsValid_(false),
+rootInputsTime_(0.),
+residualInputsValid_(false),
+residualInputsTime_(0.),
+jtColumnsValid_(false),
+jtColumnsCj_(0.),
+jtColumnsRowOffset_(0),
+discreteEvaluationRequested_(true),
+evaluationCosts_() {
   parametersDynamic_.clear();
-  variablesInit_.clear();
   parametersInit_.clear();
 }
 
+void
+SubModel::setCostAccountingEnabled(const bool enabled) {
+  costAccountingEnabled_.store(enabled, std::memory_order_relaxed);
+}
+
+/**
+ * @brief get the memory allocated by the variable definitions of a sub model, without the variables themselves
+ * @param definitions variable definitions
+ * @return number of bytes allocated
+ */
+static size_t
+variableDefinitionsMemoryUsage(const VariableDefinitions& definitions) {
+  return MemoryUsage::bytes(definitions.variables) + MemoryUsage::bytes(definitions.variablesByName)
+      + MemoryUsage::bytes(definitions.zNames) + MemoryUsage::bytes(definitions.xNames) + MemoryUsage::bytes(definitions.calculatedVarNames)
+      + MemoryUsage::bytes(definitions.xAliasesNames) + MemoryUsage::bytes(definitions.zAliasesNames);
+}
+
+void
+SubModel::accountMemory(MemoryUsage& usage) const {
+  usage.add(MemoryUsage::SUB_MODEL_BUFFERS, MemoryUsage::bytes(yLocalInit_) + MemoryUsage::bytes(ypLocalInit_) + MemoryUsage::bytes(zLocalInit_)
+      + MemoryUsage::bytes(fLocalInit_) + MemoryUsage::bytes(calculatedVars_) + MemoryUsage::bytes(calculatedVarsInit_));
+
+  size_t definitions = MemoryUsage::bytes(parametersDynamic_) + MemoryUsage::bytes(parametersInit_)
+      + MemoryUsage::bytes(fEquationIndex_) + MemoryUsage::bytes(gEquationIndex_)
+      + MemoryUsage::bytes(fEquationInitIndex_) + MemoryUsage::bytes(gEquationInitIndex_);
+  if (variableDefinitions_ && usage.addShared(variableDefinitions_.get()))
+    definitions += variableDefinitionsMemoryUsage(*variableDefinitions_);
+  if (variableDefinitionsInit_ && usage.addShared(variableDefinitionsInit_.get()))
+    definitions += variableDefinitionsMemoryUsage(*variableDefinitionsInit_);
+  usage.add(MemoryUsage::VARIABLE_DEFINITIONS, definitions);
+}
+
 void
 SubModel::initStaticData() {
   initializeStaticData();
@@ -127,6 +208,14 @@ SubModel::hasTimeline() const {
   return timeline_.use_count() > 0;
 }
 
+bool
+SubModel::acceptsTimelineEvent(const string& key) const {
+  if (!timeline_)
+    return false;
+  // the priority is only looked up in the dictionary when events are filtered
+  return !timeline_->hasEventFilter() || timeline_->acceptsEvent(MessageTimeline::priorityOf(key), key);
+}
+
 void
 SubModel::setConstraints(const std::shared_ptr<ConstraintsCollection>& constraints) {
   constraints_ = constraints;
@@ -167,11 +256,16 @@ SubModel::restoreData() {
   ypLocal_ = ypLocalSave_;
   zLocal_ = zLocalSave_;
   yDeb_ = offsetYSave_;
+  ++valuesVersion_;
 }
 
 void
 SubModel::initSub(const double t0, const std::shared_ptr<parameters::ParametersSet>& localInitParameters) {
   setCurrentTime(t0);
+  rootInputsValid_ = false;
+  residualInputsValid_ = false;
+  jtColumnsValid_ = false;
+  discreteEvaluationRequested_ = true;
 
   localInitParameters_ = localInitParameters;
 
@@ -218,14 +312,27 @@ SubModel::loadVariables(const map<string, string>& mapVariables) {
   }
 }
 
+void
+SubModel::snapshotState(StateBuffer& state) const {
+  state.write(currentTime_);
+  snapshotSpecificState(state);
+}
+
+void
+SubModel::restoreState(StateBuffer::Reader& state) {
+  state.read(currentTime_);
+  restoreSpecificState(state);
+  ++valuesVersion_;
+}
+
 void
 SubModel::initSize(int& sizeYGlob, int& sizeZGlob, int& sizeModeGlob, int& sizeFGlob, int& sizeGGlob) {
   getSize();
 
-  if (sizeY_ != xNames_.size())
-      throw DYNError(Error::MODELER, MismatchingVariableSizes, "Y", name(), sizeY_, xNames_.size());
-  if (sizeZ_ != zNames_.size())
-      throw DYNError(Error::MODELER, MismatchingVariableSizes, "Z", name(), sizeZ_, zNames_.size());
+  if (sizeY_ != variableDefinitions_->xNames.size())
+      throw DYNError(Error::MODELER, MismatchingVariableSizes, "Y", name(), sizeY_, variableDefinitions_->xNames.size());
+  if (sizeZ_ != variableDefinitions_->zNames.size())
+      throw DYNError(Error::MODELER, MismatchingVariableSizes, "Z", name(), sizeZ_, variableDefinitions_->zNames.size());
 
 
   yDeb_ = sizeYGlob;
@@ -243,26 +350,33 @@ SubModel::initSize(int& sizeYGlob, int& sizeZGlob, int& sizeModeGlob, int& sizeF
 
 void
 SubModel::defineElements() {
-  elements_.clear();
-  mapElement_.clear();
-  defineElements(elements_, mapElement_);
+  // a new table is allocated as the previous one may be shared with other instances
+  elementDefinitions_ = boost::make_shared<ElementDefinitions>();
+  defineElements(elementDefinitions_->elements, elementDefinitions_->mapElement);
 }
 
 void
 SubModel::releaseElements() {
-  vector<Element >().swap(elements_);  /// clear erase elements, but do not reduce size
-  mapElement_.clear();
+  // the elements are freed once the last instance sharing them has been connected
+  elementDefinitions_ = boost::make_shared<ElementDefinitions>();
+}
+
+void
+SubModel::shareDefinitions(const SubModel& model) {
+  variableDefinitionsInit_ = model.variableDefinitionsInit_;
+  variableDefinitions_ = model.variableDefinitions_;
+  elementDefinitions_ = model.elementDefinitions_;
 }
 
 vector<Element>
 SubModel::getElements(const string& nameElement) const {
-  const auto& iter = mapElement_.find(nameElement);
-  if (iter == mapElement_.end()) {
+  const auto& iter = elementDefinitions_->mapElement.find(nameElement);
+  if (iter == elementDefinitions_->mapElement.end()) {
     dumpUserReadableElementList(nameElement);
     throw DYNError(Error::MODELER, SubModelUnknownElement, nameElement, name(), modelType());
   } else {
     vector<Element> elements;
-    const Element& element = elements_[iter->second];
+    const Element& element = elementDefinitions_->elements[iter->second];
     if (element.getTypeElement() == Element::STRUCTURE) {
       vector<Element> subElements = getSubElements(element);
       elements.insert(elements.begin(), subElements.begin(), subElements.end());
@@ -277,7 +391,7 @@ vector<Element>
 SubModel::getSubElements(const Element& element) const {
   vector<Element> elements;
   for (const auto subElementsNum : element.subElementsNum()) {
-    Element sub = elements_[subElementsNum];
+    Element sub = elementDefinitions_->elements[subElementsNum];
     if (sub.getTypeElement() == Element::STRUCTURE) {
       vector<Element> subElements = getSubElements(sub);
       elements.insert(elements.begin(), subElements.begin(), subElements.end());
@@ -292,7 +406,7 @@ void
 SubModel::dumpUserReadableElementList(const std::string& nameElement) const {
   Trace::info() << DYNLog(ElementNames, name(), modelType()) << Trace::endline;
   vector< std::pair<size_t, string> > vec;
-  for (const auto& element : elements_) {
+  for (const auto& element : elementDefinitions_->elements) {
     if (element.getTypeElement() == Element::TERMINAL) {
       vec.push_back(std::make_pair(LevensteinDistance(element.id(), nameElement, 10, 1, 10), element.id()));
     }
@@ -305,18 +419,18 @@ SubModel::dumpUserReadableElementList(const std::string& nameElement) const {
 
 bool
 SubModel::hasVariable(const string& nameVariable) const {
-  return ( variablesByName_.find(nameVariable) != variablesByName_.end());
+  return (variableDefinitions_->variablesByName.find(nameVariable) != variableDefinitions_->variablesByName.end());
 }
 
 bool
 SubModel::hasVariableInit(const string& nameVariable) const {
-  return ( variablesByNameInit_.find(nameVariable) != variablesByNameInit_.end());
+  return (variableDefinitionsInit_->variablesByName.find(nameVariable) != variableDefinitionsInit_->variablesByName.end());
 }
 
 shared_ptr<Variable>
 SubModel::getVariable(const string& variableName) const {
-  const auto& iter = variablesByName_.find(variableName);
-  if (iter == variablesByName_.end()) {
+  const auto& iter = variableDefinitions_->variablesByName.find(variableName);
+  if (iter == variableDefinitions_->variablesByName.end()) {
     throw DYNError(Error::MODELER, SubModelUnknownElement, variableName, name(), modelType());
   }
   return iter->second;
@@ -411,28 +525,30 @@ SubModel::hasParameter(const string& nameParameter, const bool isInitParam) cons
 
 void
 SubModel::defineVariables() {
-  variables_.clear();
-  variablesByName_.clear();
-  defineVariables(variables_);
+  // a new table is allocated as the previous one may be shared with other instances
+  variableDefinitions_ = boost::make_shared<VariableDefinitions>();
+  vector<shared_ptr<Variable> >& variables = variableDefinitions_->variables;
+  std::unordered_map<string, shared_ptr<Variable> >& variablesByName = variableDefinitions_->variablesByName;
+  defineVariables(variables);
   // sort variable by name
-  for (const auto& variable : variables_) {
-    variablesByName_[variable->getName()] = variable;
+  for (const auto& variable : variables) {
+    variablesByName[variable->getName()] = variable;
   }
 
   // define alias
-  for (auto& variable : variables_) {
+  for (auto& variable : variables) {
     if (variable->isAlias()) {
       const shared_ptr<VariableAlias>& variableAlias = boost::dynamic_pointer_cast<VariableAlias>(variable);
       if (!variableAlias->referenceVariableSet()) {
-        std::unordered_map<string, shared_ptr<Variable> >::const_iterator iter = variablesByName_.find(variableAlias->getReferenceVariableName());
-        if (iter == variablesByName_.end()) {
+        std::unordered_map<string, shared_ptr<Variable> >::const_iterator iter = variablesByName.find(variableAlias->getReferenceVariableName());
+        if (iter == variablesByName.end()) {
           throw DYNError(Error::MODELER, AliasNotFound, name(), variableAlias->getReferenceVariableName());
         } else {
           variableAlias->setReferenceVariable(boost::dynamic_pointer_cast<VariableNative> (iter->second));
           if (iter->second->isState() && (iter->second->getType() == DISCRETE || iter->second->getType() == BOOLEAN))
-            zAliasesNames_.emplace_back(variableAlias->getName(), std::make_pair(iter->first, variableAlias->getNegated()));
+            variableDefinitions_->zAliasesNames.emplace_back(variableAlias->getName(), std::make_pair(iter->first, variableAlias->getNegated()));
           else if (iter->second->isState() && (iter->second->getType() == CONTINUOUS || iter->second->getType() == FLOW))
-            xAliasesNames_.emplace_back(variableAlias->getName(), std::make_pair(iter->first, variableAlias->getNegated()));
+            variableDefinitions_->xAliasesNames.emplace_back(variableAlias->getName(), std::make_pair(iter->first, variableAlias->getNegated()));
         }
       }
     }
@@ -483,34 +599,35 @@ SubModel::setParameterFromSet(const std::shared_ptr<parameters::ParametersSet>&
       throw DYNError(Error::MODELER, ParameterNotUnitary, parName);
 
      // Check if parameter is present in set
-    if (parametersSet->hasParameter(parName)) {
-      // Set the parameter value with the information given in PAR file
-      switch (parameter.getValueType()) {
-        case VAR_TYPE_BOOL: {
-          const bool value = parametersSet->getParameter(parName)->getBool();
-          parameter.setValue<bool>(value, origin);
-          break;
-        }
-        case VAR_TYPE_INT: {
-          const int value = parametersSet->getParameter(parName)->getInt();
-          parameter.setValue<int>(value, origin);
-          break;
-        }
-        case VAR_TYPE_DOUBLE: {
-          const double& value = parametersSet->getParameter(parName)->getDouble();
-          parameter.setValue<double>(value, origin);
-          break;
-        }
-        case VAR_TYPE_STRING: {
-          const string& value = parametersSet->getParameter(parName)->getString();
-          parameter.setValue<string>(value, origin);
-          break;
-        }
-        default:
-        {
-          throw DYNError(Error::MODELER, ParameterNoTypeDetected, parName);
-        }
-      }
+    const parameters::Parameter* value = parametersSet->findParameter(parName);
+    if (value)
+      setParameterValue(*value, origin, parameter);
+  }
+}
+
+void
+SubModel::setParameterValue(const parameters::Parameter& value, const parameterOrigin_t& origin, ParameterModeler& parameter) {
+  // Set the parameter value with the information given in PAR file
+  switch (parameter.getValueType()) {
+    case VAR_TYPE_BOOL: {
+      parameter.setValue<bool>(value.getBool(), origin);
+      break;
+    }
+    case VAR_TYPE_INT: {
+      parameter.setValue<int>(value.getInt(), origin);
+      break;
+    }
+    case VAR_TYPE_DOUBLE: {
+      parameter.setValue<double>(value.getDouble(), origin);
+      break;
+    }
+    case VAR_TYPE_STRING: {
+      parameter.setValue<string>(value.getString(), origin);
+      break;
+    }
+    default:
+    {
+      throw DYNError(Error::MODELER, ParameterNoTypeDetected, parameter.getName());
     }
   }
 }
@@ -520,13 +637,32 @@ SubModel::setParametersFromPARFile(const bool isInitParam) {
   std::unordered_map<string, ParameterModeler>& parameters = (isInitParam ? parametersInit_ : parametersDynamic_);
 
   std::map<string, ParameterModeler> nonUnitaryParameters;
+  for (const auto& parameter : parameters) {
+    if (!parameter.second.isUnitary())
+      nonUnitaryParameters.insert(std::make_pair(parameter.first, parameter.second));
+  }
+
   // Set values of parameters with unitary cardinality
-  for (auto& parameter : parameters) {
-    ParameterModeler& currentParameter = parameter.second;
-    if ((currentParameter.isUnitary()) && (!currentParameter.isFullyInternal())) {
-      setParameterFromPARFile(currentParameter);
-    } else if (!currentParameter.isUnitary()) {
-      nonUnitaryParameters.insert(std::make_pair(parameter.first, currentParameter));
+  // The smaller of the model parameters and the parameters set is iterated, each parameter being looked up once in the other one
+  if (readPARParameters_) {
+    const std::unordered_map<string, std::shared_ptr<parameters::Parameter> >& parametersRead = readPARParameters_->getParameters();
+    if (parametersRead.size() < parameters.size()) {
+      for (const auto& parameterRead : parametersRead) {
+        const auto itParameter = parameters.find(parameterRead.first);
+        if (itParameter == parameters.end() || !itParameter->second.isUnitary() || itParameter->second.isFullyInternal())
+          continue;
+        parameterRead.second->setUsed(true);
+        setParameterValue(*parameterRead.second, readPARParameters_->hasReference(parameterRead.first) ? IIDM : PAR, itParameter->second);
+      }
+    } else {
+      for (auto& parameter : parameters) {
+        ParameterModeler& currentParameter = parameter.second;
+        if (!currentParameter.isUnitary() || currentParameter.isFullyInternal())
+          continue;
+        const parameters::Parameter* parameterRead = readPARParameters_->findParameter(parameter.first);
+        if (parameterRead)
+          setParameterValue(*parameterRead, readPARParameters_->hasReference(parameter.first) ? IIDM : PAR, currentParameter);
+      }
     }
   }
 
@@ -624,20 +760,21 @@ SubModel::resetParameters(const bool isInitParam) {
 
 void
 SubModel::defineVariablesInit() {
-  variablesInit_.clear();
-  variablesByNameInit_.clear();
-  defineVariablesInit(variablesInit_);
+  variableDefinitionsInit_ = boost::make_shared<VariableDefinitions>();
+  vector<shared_ptr<Variable> >& variablesInit = variableDefinitionsInit_->variables;
+  std::unordered_map<string, shared_ptr<Variable> >& variablesByNameInit = variableDefinitionsInit_->variablesByName;
+  defineVariablesInit(variablesInit);
   // sort variable by name
-  for (const auto& variableInit : variablesInit_)
-    variablesByNameInit_[variableInit->getName()] = variableInit;
+  for (const auto& variableInit : variablesInit)
+    variablesByNameInit[variableInit->getName()] = variableInit;
 
   // define alias
-  for (const auto& variableInit : variablesInit_) {
+  for (const auto& variableInit : variablesInit) {
     if (variableInit->isAlias()) {
       const shared_ptr<VariableAlias> variableAliasInit = boost::dynamic_pointer_cast<VariableAlias>(variableInit);
       if (!variableAliasInit->referenceVariableSet()) {
-        const auto iter = variablesByNameInit_.find(variableAliasInit->getReferenceVariableName());
-        if (iter == variablesByNameInit_.end())
+        const auto iter = variablesByNameInit.find(variableAliasInit->getReferenceVariableName());
+        if (iter == variablesByNameInit.end())
           throw DYNError(Error::MODELER, AliasNotFound, name(), variableAliasInit->getReferenceVariableName());
         else
           variableAliasInit->setReferenceVariable(boost::dynamic_pointer_cast<VariableNative> (iter->second));
@@ -802,7 +939,11 @@ void SubModel::defineNamesImpl(vector<shared_ptr<Variable> >& variables, vector<
 
 void
 SubModel::evalZSub(const double t) {
+  EvaluationCostScope costScope(evaluationCosts_[COST_Z]);
   setCurrentTime(t);
+  // the discrete update may change the internal state used by the root and residual functions
+  rootInputsValid_ = false;
+  residualInputsValid_ = false;
   if (sizeZ() > 0) {
     // compute each sub-model Z
     evalZ(t);
@@ -845,6 +986,7 @@ SubModel::setBufferY(double* y, double* yp, const int offsetY) {
   ypLocal_ = static_cast<double*>(0);
   if (yp)
     ypLocal_ = &(yp[offsetY]);
+  ++valuesVersion_;
 }
 
 void
@@ -855,10 +997,12 @@ SubModel::setBufferZ(double* z, bool* zConnected, int offsetZ) {
   zLocalConnected_ = static_cast<bool*>(0);
   if (zConnected)
     zLocalConnected_ = &(zConnected[offsetZ]);
+  ++valuesVersion_;
 }
 
 void
 SubModel::evalFSub(const double t) {
+  EvaluationCostScope costScope(evaluationCosts_[COST_F]);
   setCurrentTime(t);
   // computing f for the sub-model
   evalF(t, UNDEFINED_EQ);
@@ -873,8 +1017,37 @@ SubModel::evalFSub(const double t) {
 #endif
 }
 
+void
+SubModel::evalFSubIncremental(const double t) {
+  const unsigned int nbF = sizeF();
+  if (nbF == 0)
+    return;
+
+  const unsigned int nbY = sizeY();
+  const unsigned int nbZ = sizeZ();
+  if (residualInputsValid_ && (!residualsDependOnTime() || t == residualInputsTime_)
+      && std::equal(yLocal_, yLocal_ + nbY, residualInputs_.begin())
+      && std::equal(ypLocal_, ypLocal_ + nbY, residualInputs_.begin() + nbY)
+      && std::equal(zLocal_, zLocal_ + nbZ, residualInputs_.begin() + 2 * nbY)) {
+    // the residuals buffer may have been overwritten by a partial evaluation since the last evaluation
+    std::copy(residuals_.begin(), residuals_.end(), fLocal_);
+    return;
+  }
+
+  evalFSub(t);
+
+  residualInputs_.resize(2 * nbY + nbZ);
+  std::copy(yLocal_, yLocal_ + nbY, residualInputs_.begin());
+  std::copy(ypLocal_, ypLocal_ + nbY, residualInputs_.begin() + nbY);
+  std::copy(zLocal_, zLocal_ + nbZ, residualInputs_.begin() + 2 * nbY);
+  residuals_.assign(fLocal_, fLocal_ + nbF);
+  residualInputsTime_ = t;
+  residualInputsValid_ = true;
+}
+
 void
 SubModel::evalFDiffSub(const double t) {
+  EvaluationCostScope costScope(evaluationCosts_[COST_F]);
   setCurrentTime(t);
   evalF(t, DIFFERENTIAL_EQ);
 
@@ -890,11 +1063,72 @@ SubModel::evalFDiffSub(const double t) {
 
 void
 SubModel::evalGSub(const double t) {
+  EvaluationCostScope costScope(evaluationCosts_[COST_G]);
   setCurrentTime(t);
   // evaluation of the submodel g functions
   evalG(t);
 }
 
+void
+SubModel::evalFBatch(const double t, const propertyF_t type, SubModel* const* subModels, const unsigned int nbSubModels) {
+  for (unsigned int i = 0; i < nbSubModels; ++i)
+    subModels[i]->setCurrentTime(t);
+  evalFBatchKernel(t, type, subModels, nbSubModels);
+
+#ifdef _DEBUG_
+  // test NAN
+  for (unsigned int i = 0; i < nbSubModels; ++i) {
+    for (unsigned int j = 0; j < subModels[i]->sizeF(); ++j) {
+      if (std::isnan(subModels[i]->fLocal_[j])) {
+        throw DYNError(Error::MODELER, NanValue, j, subModels[i]->name());
+      }
+    }
+  }
+#endif
+}
+
+void
+SubModel::evalFBatchKernel(const double t, const propertyF_t type, SubModel* const* subModels, const unsigned int nbSubModels) {
+  for (unsigned int i = 0; i < nbSubModels; ++i)
+    subModels[i]->evalF(t, type);
+}
+
+void
+SubModel::evalGBatch(const double t, SubModel* const* subModels, const unsigned int nbSubModels) {
+  for (unsigned int i = 0; i < nbSubModels; ++i)
+    subModels[i]->setCurrentTime(t);
+  evalGBatchKernel(t, subModels, nbSubModels);
+}
+
+void
+SubModel::evalGBatchKernel(const double t, SubModel* const* subModels, const unsigned int nbSubModels) {
+  for (unsigned int i = 0; i < nbSubModels; ++i)
+    subModels[i]->evalG(t);
+}
+
+void
+SubModel::evalGSubIncremental(const double t) {
+  if (sizeG() == 0)
+    return;
+
+  const unsigned int nbY = sizeY();
+  const unsigned int nbZ = sizeZ();
+  if (rootInputsValid_ && (!rootsDependOnTime() || t == rootInputsTime_)
+      && std::equal(yLocal_, yLocal_ + nbY, rootInputs_.begin())
+      && std::equal(ypLocal_, ypLocal_ + nbY, rootInputs_.begin() + nbY)
+      && std::equal(zLocal_, zLocal_ + nbZ, rootInputs_.begin() + 2 * nbY))
+    return;  // the root functions values in the buffer are still up to date
+
+  evalGSub(t);
+
+  rootInputs_.resize(2 * nbY + nbZ);
+  std::copy(yLocal_, yLocal_ + nbY, rootInputs_.begin());
+  std::copy(ypLocal_, ypLocal_ + nbY, rootInputs_.begin() + nbY);
+  std::copy(zLocal_, zLocal_ + nbZ, rootInputs_.begin() + 2 * nbY);
+  rootInputsTime_ = t;
+  rootInputsValid_ = true;
+}
+
 void
 SubModel::evalCalculatedVariablesSub(const double t) {
   setCurrentTime(t);
@@ -909,13 +1143,36 @@ SubModel::getCalculatedVar(const int indexCalculatedVar) const {
 
 void
 SubModel::evalJtSub(const double t, const double cj, int& rowOffset, SparseMatrix& jt) {
-  setCurrentTime(t);
-  evalJt(t, cj, rowOffset, jt);
+  if (!hasPiecewiseConstantJacobian()) {
+    EvaluationCostScope costScope(evaluationCosts_[COST_JT]);
+    setCurrentTime(t);
+    evalJt(t, cj, rowOffset, jt);
+    rowOffset += sizeY();
+    return;
+  }
+
+  // the columns kept are appended again to the matrix, they only change with the modes, the discrete variables and cj
+  const unsigned int nbZ = sizeZ();
+  if (!jtColumnsValid_ || cj != jtColumnsCj_ || rowOffset != jtColumnsRowOffset_
+      || !std::equal(zLocal_, zLocal_ + nbZ, jtColumnsZ_.begin())) {
+    EvaluationCostScope costScope(evaluationCosts_[COST_JT]);
+    setCurrentTime(t);
+    if (!jtColumns_)
+      jtColumns_ = std::make_shared<SparseMatrix>();
+    jtColumns_->init(jt.nbRow(), static_cast<int>(sizeF()));
+    evalJt(t, cj, rowOffset, *jtColumns_);
+    jtColumnsZ_.assign(zLocal_, zLocal_ + nbZ);
+    jtColumnsCj_ = cj;
+    jtColumnsRowOffset_ = rowOffset;
+    jtColumnsValid_ = true;
+  }
+  jt.appendColumns(*jtColumns_);
   rowOffset += sizeY();
 }
 
 void
 SubModel::evalJtPrimSub(const double t, const double cj, int& rowOffset, SparseMatrix& jtPrim) {
+  EvaluationCostScope costScope(evaluationCosts_[COST_JT]);
   setCurrentTime(t);
   evalJtPrim(t, cj,  rowOffset, jtPrim);
   rowOffset += sizeY();
@@ -923,10 +1180,18 @@ SubModel::evalJtPrimSub(const double t, const double cj, int& rowOffset, SparseM
 
 modeChangeType_t
 SubModel::evalModeSub(const double t) {
+  EvaluationCostScope costScope(evaluationCosts_[COST_MODE]);
   setCurrentTime(t);
   // evaluation of the submodel modes
+  rootInputsValid_ = false;
+  residualInputsValid_ = false;
+  // the mode evaluation ends the evaluation of an event
+  discreteEvaluationRequested_ = false;
   modeChange_ = false;
   modeChangeType_t modeChangeType = evalMode(t);
+  // any mode change may change the Jacobian, even when it is not worse than the previous one of the time step
+  if (modeChangeType != NO_MODE)
+    jtColumnsValid_ = false;
   if (modeChangeType > modeChangeType_) {
     modeChange_ = true;
     modeChangeType_ = modeChangeType;
@@ -952,14 +1217,20 @@ SubModel::checkDataCoherenceSub(const double t) {
 
 void
 SubModel::setFequationsSub() {
+  if (fEquationsSet_)
+    return;
   setFequations();
   setFequationsInit();
+  fEquationsSet_ = true;
 }
 
 void
 SubModel::setGequationsSub() {
+  if (gEquationsSet_)
+    return;
   setGequations();
   setGequationsInit();
+  gEquationsSet_ = true;
 }
 
 void
@@ -1247,7 +1518,7 @@ SubModel::addMessage(const string& message) {
 
 void
 SubModel::addEvent(const string& modelName, const MessageTimeline& messageTimeline) {
-  if (timeline_) {
+  if (timeline_ && timeline_->acceptsEvent(messageTimeline.priority(), messageTimeline.getKey())) {
     timeline_->addEvent(getCurrentTime(), modelName, messageTimeline.str(), messageTimeline.priority(), messageTimeline.getKey());
   }
 }
@@ -1268,6 +1539,9 @@ SubModel::hasConstraints() const {
 
 const string&
 SubModel::getFequationByLocalIndex(const int index) const {
+  // the formula are only read to trace an error or a debug log: they are generated on demand
+  if (!fEquationsSet_)
+    const_cast<SubModel*>(this)->setFequationsSub();
   const auto it = fEquationIndex().find(index);
   if (it != fEquationIndex().end()) {
     return it->second;
@@ -1280,6 +1554,8 @@ SubModel::getFequationByLocalIndex(const int index) const {
 
 const string&
 SubModel::getGequationByLocalIndex(const int index) const {
+  if (!gEquationsSet_)
+    const_cast<SubModel*>(this)->setGequationsSub();
   const auto it = gEquationIndex().find(index);
   if (it != gEquationIndex().end()) {
     return it->second;
@@ -20,6 +20,8 @@
 #ifndef MODELER_COMMON_DYNSUBMODEL_H_
 #define MODELER_COMMON_DYNSUBMODEL_H_
 
+#include <atomic>
+#include <memory>
 #include <vector>
 #include <map>
 #include <string>
@@ -37,6 +39,8 @@
 #include "CSTRConstraintsCollection.h"
 #include "DYNBitMask.h"
 #include "DYNElement.h"
+#include "DYNStateBuffer.h"
+#include "DYNSubModelDefinitions.h"
 
 
 namespace parameters {
@@ -52,6 +56,7 @@ class Curve;
 }  // namespace curves
 
 namespace DYN {
+class MemoryUsage;
 class Message;
 class MessageTimeline;
 class SparseMatrix;
@@ -126,6 +131,27 @@ class SubModel {
    */
   virtual void loadVariables(const std::string& variables) = 0;
 
+  /**
+   * @brief write in a snapshot the state of the sub model that is not held by the global buffers of the model
+   *
+   * The continuous, derivative and discrete variables and the root functions are saved by the model, in the buffers
+   * the sub model points to.
+   *
+   * @param state snapshot to fill
+   */
+  virtual void snapshotSpecificState(StateBuffer& /*state*/) const {
+    // nothing to save by default
+  }
+
+  /**
+   * @brief restore the state of the sub model written by snapshotSpecificState
+   *
+   * @param state snapshot to read
+   */
+  virtual void restoreSpecificState(StateBuffer::Reader& /*state*/) {
+    // nothing to restore by default
+  }
+
   /**
    * @brief set the silent flag for discrete variables
    * @param silentZTable flag table
@@ -444,6 +470,106 @@ class SubModel {
    */
   void evalGSub(double t);
 
+  /**
+   * @brief get the key shared by the sub models whose residual and root functions are evaluated by the same kernel
+   *
+   * The sub models sharing a key may be evaluated together by evalFBatch and evalGBatch.
+   *
+   * @return key of the evaluation kernel, NULL if the sub model is evaluated alone
+   */
+  virtual const void* getBatchKey() const {
+    return NULL;
+  }
+
+  /**
+   * @brief Model F(t,y,y') function evaluation of a batch of sub models sharing the batch key of this sub model
+   *
+   * @param t Simulation instant
+   * @param type type of the residues to compute (algebraic, differential or both)
+   * @param subModels sub models of the batch
+   * @param nbSubModels number of sub models of the batch
+   */
+  void evalFBatch(double t, propertyF_t type, SubModel* const* subModels, unsigned int nbSubModels);
+
+  /**
+   * @brief Model G(t,y,y') function evaluation of a batch of sub models sharing the batch key of this sub model
+   *
+   * @param t Simulation instant
+   * @param subModels sub models of the batch
+   * @param nbSubModels number of sub models of the batch
+   */
+  void evalGBatch(double t, SubModel* const* subModels, unsigned int nbSubModels);
+
+  /**
+   * @brief Model G(t,y,y') function evaluation, skipped if none of its inputs changed since the last evaluation
+   *
+   * The inputs of the root functions are the continuous variables, their derivatives, the discrete variables and,
+   * if the root functions depend explicitly on it, the time.
+   *
+   * @param t Simulation instant
+   */
+  void evalGSubIncremental(double t);
+
+  /**
+   * @brief Model F(t,y,y') function evaluation, skipped if none of its inputs changed since the last evaluation
+   *
+   * The residuals of a sub model only depend on its own continuous variables, their derivatives, its discrete variables
+   * and, if they depend explicitly on it, the time: the connected variables of the other sub models are only linked
+   * by the connectors equations. When the evaluation is skipped, the residuals of the last evaluation are written again.
+   *
+   * @param t Simulation instant
+   */
+  void evalFSubIncremental(double t);
+
+  /**
+   * @brief forget the inputs of the last residual functions evaluation, so that the next incremental evaluation is not skipped
+   *
+   * Must be called when the model state changes outside of its variables, e.g. when its parameters are updated.
+   * The Jacobian columns kept for a model with a piecewise constant Jacobian are forgotten as well.
+   */
+  inline void invalidateResidualInputs() {
+    residualInputsValid_ = false;
+    jtColumnsValid_ = false;
+  }
+
+  /**
+   * @brief whether the residual functions depend explicitly on time
+   *
+   * @return @b false if the residual functions only depend on the variables of the model
+   */
+  virtual bool residualsDependOnTime() const {
+    return true;
+  }
+
+  /**
+   * @brief append the absolute times at which the root functions of the model change because of time only
+   *
+   * The solvers may stop exactly at those times instead of locating the corresponding roots.
+   *
+   * @param timeEvents times of the scheduled events of the model
+   */
+  virtual void collectTimeEvents(std::vector<double>& /*timeEvents*/) const {
+    // no scheduled event by default
+  }
+
+  /**
+   * @brief forget the inputs of the last root functions evaluation, so that the next incremental evaluation is not skipped
+   *
+   * Must be called when the model state changes outside of its variables, e.g. when its parameters are updated.
+   */
+  inline void invalidateRootInputs() {
+    rootInputsValid_ = false;
+  }
+
+  /**
+   * @brief whether the root functions depend explicitly on time
+   *
+   * @return @b false if the root functions only depend on the variables of the model
+   */
+  virtual bool rootsDependOnTime() const {
+    return true;
+  }
+
   /**
    * @brief Model discrete variables evaluation
    * Get the discrete variables' value depending on current simulation instant and
@@ -462,7 +588,8 @@ class SubModel {
   /**
    * @brief Model transposed jacobian evaluation
    *
-   * Get the sparse transposed jacobian
+   * Get the sparse transposed jacobian. When the model has a piecewise constant Jacobian, its columns are kept and
+   * appended again to the matrix as long as its modes, its discrete variables and cj are unchanged.
    * @param t Simulation instant
    * @param cj Jacobian prime coefficient
    * @param rowOffset offset to use to identify the row where data should be added
@@ -492,6 +619,107 @@ class SubModel {
   //--------------------------------------------------------------------
   modeChangeType_t evalModeSub(double t);
 
+  /**
+   * @brief whether the discrete variables and the modes of the model can only change when one of its root functions
+   * or one of its discrete variables changes
+   *
+   * When it is the case, the evaluation of the discrete variables and modes of the model can be skipped after an event
+   * that does not involve it.
+   *
+   * @return @b true if the discrete evaluation of the model only depends on its roots and discrete variables
+   */
+  virtual bool discreteChangesOnlyOnEvents() const {
+    return false;
+  }
+
+  /**
+   * @brief whether the Jacobian of the residual functions only depends on cj, on the parameters, on the discrete variables
+   * and on the modes of the model
+   *
+   * When it is the case, the columns of the model in the transposed Jacobian are kept from one evaluation to the next
+   * one, and only computed again after a mode change, a change of its discrete variables or of cj, or an update of its
+   * parameters.
+   *
+   * @return @b true if the Jacobian of the model does not depend on its continuous variables nor on the time
+   */
+  virtual bool hasPiecewiseConstantJacobian() const {
+    return false;
+  }
+
+  /**
+   * @brief force the evaluation of the discrete variables and modes of the model at the next event
+   *
+   * Must be called when the model state changes outside of its variables, e.g. when its parameters are updated.
+   */
+  inline void requestDiscreteEvaluation() {
+    discreteEvaluationRequested_ = true;
+  }
+
+  /**
+   * @brief whether the evaluation of the discrete variables and modes of the model was forced
+   *
+   * @return @b true if the discrete variables and modes have to be evaluated at the next event
+   */
+  inline bool discreteEvaluationRequested() const {
+    return discreteEvaluationRequested_;
+  }
+
+  /**
+   * @brief evaluations whose cost is accounted for each sub model
+   */
+  typedef enum {
+    COST_F = 0,  ///< evaluation of the residual functions
+    COST_G,  ///< evaluation of the root functions
+    COST_Z,  ///< evaluation of the discrete variables
+    COST_JT,  ///< evaluation of the Jacobian and of its derivative part
+    COST_MODE,  ///< evaluation of the modes
+    NB_COSTS  ///< number of accounted evaluations
+  } evaluationCost_t;
+
+  /**
+   * @brief cost of an evaluation of the sub model
+   */
+  struct EvaluationCost {
+    unsigned long nbCalls;  ///< number of calls
+    double time;  ///< cumulative time in seconds
+  };
+
+  /**
+   * @brief enable or disable the accounting of the evaluation costs of all the sub models
+   *
+   * @param enabled @b true to record the number of calls and the time of each evaluation
+   */
+  static void setCostAccountingEnabled(bool enabled);
+
+  /**
+   * @brief whether the evaluation costs of the sub models are accounted
+   *
+   * @return @b true if the evaluation costs are accounted
+   */
+  static bool isCostAccountingEnabled() {
+    return costAccountingEnabled_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief get the accounted cost of an evaluation of the sub model
+   *
+   * @param evaluation evaluation
+   * @return number of calls and cumulative time of the evaluation
+   */
+  const EvaluationCost& getEvaluationCost(const evaluationCost_t evaluation) const {
+    return evaluationCosts_[evaluation];
+  }
+
+  /**
+   * @brief account the memory allocated by the sub model
+   *
+   * The local buffers of the dynamic model are parts of the global buffers of the model, accounted with them.
+   * The variable definitions shared by the instances of the same model type are accounted once.
+   *
+   * @param usage memory usage to complete
+   */
+  virtual void accountMemory(MemoryUsage& usage) const;
+
   /**
   * @brief Get the mode change value
   *
@@ -528,13 +756,13 @@ class SubModel {
 
   /**
    * @brief For calling setFequations() in SubModel
-   * add equations formula
+   * add equations formula, only once
    */
   void setFequationsSub();
 
   /**
    * @brief For calling setGequations() in SubModel
-   * add root equations formula
+   * add root equations formula, only once
    */
   void setGequationsSub();
 
@@ -577,7 +805,8 @@ class SubModel {
    *
    */
   inline void defineNames() {
-    defineNamesImpl(variables_, zNames_, xNames_, calculatedVarNames_);
+    defineNamesImpl(variableDefinitions_->variables, variableDefinitions_->zNames, variableDefinitions_->xNames,
+        variableDefinitions_->calculatedVarNames);
   }
 
   /**
@@ -585,7 +814,8 @@ class SubModel {
    *
    */
   inline void defineNamesInit() {
-    defineNamesImpl(variablesInit_, zNamesInit_, xNamesInit_, calculatedVarNamesInit_);
+    defineNamesImpl(variableDefinitionsInit_->variables, variableDefinitionsInit_->zNames, variableDefinitionsInit_->xNames,
+        variableDefinitionsInit_->calculatedVarNames);
   }
 
   /**
@@ -628,6 +858,20 @@ class SubModel {
    */
   void loadVariables(const std::map< std::string, std::string >& mapVariables);
 
+  /**
+   * @brief write the state of the sub model in a snapshot, to restore it in memory later on
+   *
+   * @param state snapshot to fill
+   */
+  void snapshotState(StateBuffer& state) const;
+
+  /**
+   * @brief restore the state of the sub model written by snapshotState
+   *
+   * @param state snapshot to read
+   */
+  void restoreState(StateBuffer::Reader& state);
+
   /**
    * @brief get the current values of discrete variables
    *
@@ -645,6 +889,24 @@ class SubModel {
    */
   void releaseElements();
 
+  /**
+   * @brief use the variables and elements already defined by another instance of the same model type
+   *
+   * Replaces the calls to defineVariablesInit, defineNamesInit, defineVariables, defineNames and defineElements:
+   * the definitions are shared and not copied, only the values and offsets stay specific to this instance.
+   *
+   * @param model instance whose definitions are complete
+   */
+  void shareDefinitions(const SubModel& model);
+
+  /**
+   * @brief Determines if the variables and elements of the sub model only depend on its type (and not on its data)
+   * @returns true if all the instances of the same library can share the same definitions, false if not
+   */
+  virtual bool hasStaticDefinitions() const {
+    return false;
+  }
+
   /**
    * @brief get the elements associating to a name of variable/structure
    *
@@ -803,6 +1065,14 @@ class SubModel {
    */
   bool hasTimeline() const;
 
+  /**
+   * @brief determines if the timeline registers an event, to check before creating its message
+   *
+   * @param key key of the timeline message
+   * @returns whether the model has a timeline registering the events of this key
+   */
+  bool acceptsTimelineEvent(const std::string& key) const;
+
   /**
    * @brief set the constraints collection to use during the simulation (where constraints should be added)
    *
@@ -828,7 +1098,7 @@ class SubModel {
    * @return a map associating one variable and its name
    */
   const std::unordered_map<std::string, boost::shared_ptr<Variable> >& getVariableByName() const {
-    return variablesByName_;
+    return variableDefinitions_->variablesByName;
   }
 
   /**
@@ -899,6 +1169,15 @@ class SubModel {
   static void setParameterFromSet(const std::shared_ptr<parameters::ParametersSet>& parametersSet, const parameterOrigin_t& origin,
    ParameterModeler& parameter);
 
+  /**
+   * @brief set a parameter value from a parameter of a parameters set
+   *
+   * @param value parameter of the set holding the value
+   * @param origin the origin of the set data (MO, PAR, INIT, ...)
+   * @param parameter parameter to be set
+   */
+  static void setParameterValue(const parameters::Parameter& value, const parameterOrigin_t& origin, ParameterModeler& parameter);
+
   /**
    * @brief set all parameters values from a parameters set (API PAR)
    */
@@ -939,6 +1218,16 @@ class SubModel {
     return findParameter(name, false);
   }
 
+  /**
+   * @brief search for a dynamic parameter with a given name, to modify it
+   *
+   * @param name name of the desired parameter
+   * @return desired dynamic parameter as a reference
+   */
+  inline ParameterModeler& findParameterDynamicReference(const std::string& name) {
+    return findParameterReference(name, false);
+  }
+
   /**
    * @brief set a given parameter value
    *
@@ -1156,7 +1445,7 @@ class SubModel {
    * @return names of all discrete variables
    */
   inline const std::vector<std::string>& zNames() {
-    return zNames_;
+    return variableDefinitions_->zNames;
   }
 
   /**
@@ -1165,7 +1454,7 @@ class SubModel {
    * @return names of all continuous variables
    */
   inline const std::vector<std::string>& xNames() {
-    return xNames_;
+    return variableDefinitions_->xNames;
   }
 
   /**
@@ -1174,7 +1463,7 @@ class SubModel {
    * @return names of all continuous aliases variables
    */
   inline const std::vector<std::pair<std::string, std::pair<std::string, bool> > >& xAliasesNames() {
-    return xAliasesNames_;
+    return variableDefinitions_->xAliasesNames;
   }
 
   /**
@@ -1183,7 +1472,7 @@ class SubModel {
    * @return names of all discrete aliases variables
    */
   inline const std::vector<std::pair<std::string, std::pair<std::string, bool> > >& zAliasesNames() {
-    return zAliasesNames_;
+    return variableDefinitions_->zAliasesNames;
   }
 
   /**
@@ -1192,7 +1481,7 @@ class SubModel {
    * @return map (name, variable)
    */
   inline const std::unordered_map<std::string, boost::shared_ptr<Variable> >& variablesByNameInit() {
-    return variablesByNameInit_;
+    return variableDefinitionsInit_->variablesByName;
   }
 
   /**
@@ -1201,7 +1490,7 @@ class SubModel {
    * @return names of all discrete variables
    */
   inline const std::vector<std::string>& zNamesInit() {
-    return zNamesInit_;
+    return variableDefinitionsInit_->zNames;
   }
 
   /**
@@ -1210,7 +1499,7 @@ class SubModel {
    * @return names of all continuous variables
    */
   inline const std::vector<std::string>& xNamesInit() {
-    return xNamesInit_;
+    return variableDefinitionsInit_->xNames;
   }
 
   /**
@@ -1220,7 +1509,7 @@ class SubModel {
    * @return names of all calculated variables
    */
   inline const std::vector<std::string>& getCalculatedVarNamesInit() {
-    return calculatedVarNamesInit_;
+    return variableDefinitionsInit_->calculatedVarNames;
   }
 
   /**
@@ -1230,7 +1519,7 @@ class SubModel {
    * @return names of all calculated variables
    */
   inline const std::vector<std::string>& getCalculatedVarNames() {
-    return calculatedVarNames_;
+    return variableDefinitions_->calculatedVarNames;
   }
 
   /**
@@ -1241,7 +1530,7 @@ class SubModel {
    */
 
   inline const std::string& getCalculatedVarName(const unsigned int index) {
-    return calculatedVarNames_[index];
+    return variableDefinitions_->calculatedVarNames[index];
   }
 
   /**
@@ -1319,10 +1608,33 @@ class SubModel {
   /**
    * @brief set the time to use for the equation's evaluation
    *
+   * Every evaluation of the sub-model goes through this method: the values version is bumped
+   * as the local buffers may have been modified since the previous evaluation
+   *
    * @param time time to use
    */
   inline void setCurrentTime(const double time) {
     currentTime_ = time;
+    ++valuesVersion_;
+  }
+
+  /**
+   * @brief notify that the values of the sub-model variables may have been modified outside of its evaluation
+   */
+  inline void notifyValuesChanged() {
+    ++valuesVersion_;
+  }
+
+  /**
+   * @brief get the version of the sub-model values
+   *
+   * The version changes each time the values of the sub-model variables may have changed,
+   * a reader can skip its update if the version is the same as the one of its previous read
+   *
+   * @return version of the sub-model values
+   */
+  inline unsigned long getValuesVersion() const {
+    return valuesVersion_;
   }
 
   /**
@@ -1341,6 +1653,11 @@ class SubModel {
    */
   inline void setIsInitProcess(const bool isInitProcess) {
     isInitProcess_ = isInitProcess;
+    rootInputsValid_ = false;
+    residualInputsValid_ = false;
+    jtColumnsValid_ = false;
+    discreteEvaluationRequested_ = true;
+    ++valuesVersion_;
   }
 
   /**
@@ -1374,6 +1691,8 @@ class SubModel {
   /**
    * @brief get equation string for debug log
    *
+   * The equations formula of the sub model are generated on the first call.
+   *
    * @param index WARNING index is local index in this submodel, not global index
    * @return string of equation
    */
@@ -1382,6 +1701,8 @@ class SubModel {
   /**
    * @brief get root equation string for debug log
    *
+   * The root equations formula of the sub model are generated on the first call.
+   *
    * @param index WARNING index is local index in this submodel, not global index
    * @return string of root equation
    */
@@ -1394,6 +1715,15 @@ class SubModel {
    */
   void setPARParameters(const std::shared_ptr<parameters::ParametersSet>& params);
 
+  /**
+   * @brief getter for the parameters set read from PAR file
+   *
+   * @return parameters set read from PAR file, nullptr if no PAR file was given for the model
+   */
+  inline const std::shared_ptr<parameters::ParametersSet>& getPARParameters() const {
+    return readPARParameters_;
+  }
+
   /**
    * @brief retrieve the value of a parameter
    *
@@ -1413,6 +1743,29 @@ class SubModel {
   virtual void getInitSubModelParameterValue(const std::string & nameParameter, std::string& value, bool& found) const;
 
  protected:
+  /**
+   * @brief evaluate the residual functions of a batch of sub models sharing the batch key of this sub model
+   *
+   * The current time of the sub models is already set. By default, the sub models are evaluated one by one.
+   *
+   * @param t Simulation instant
+   * @param type type of the residues to compute (algebraic, differential or both)
+   * @param subModels sub models of the batch
+   * @param nbSubModels number of sub models of the batch
+   */
+  virtual void evalFBatchKernel(double t, propertyF_t type, SubModel* const* subModels, unsigned int nbSubModels);
+
+  /**
+   * @brief evaluate the root functions of a batch of sub models sharing the batch key of this sub model
+   *
+   * The current time of the sub models is already set. By default, the sub models are evaluated one by one.
+   *
+   * @param t Simulation instant
+   * @param subModels sub models of the batch
+   * @param nbSubModels number of sub models of the batch
+   */
+  virtual void evalGBatchKernel(double t, SubModel* const* subModels, unsigned int nbSubModels);
+
   /**
    * @brief get the name of the file where parameters should be dumped
    *
@@ -1576,8 +1929,6 @@ class SubModel {
 
   std::vector<double> calculatedVars_;  ///< local buffer to fill when calculating calculated variables
   std::vector<double> calculatedVarsInit_;  ///< local buffer to fill when calculating calculated variables for init model
-  std::unordered_map<std::string, boost::shared_ptr<Variable> > variablesByName_;  ///< association between variables and its name for dynamic model
-  std::unordered_map<std::string, boost::shared_ptr<Variable> > variablesByNameInit_;  ///< association between variables and its name for init model
 
   propertyContinuousVar_t* yType_;  ///< local buffer to use when accessing each variable property (Algebraic / Differential / External)
   propertyF_t* fType_;  ///< local buffer to use when accessing each residual function property(Algebraic / Differential)
@@ -1626,27 +1977,16 @@ class SubModel {
   std::string name_;  ///< name of the model
   std::string staticId_;  ///< name of the model inside the IIDM data
 
-  std::vector<boost::shared_ptr<Variable> > variables_;  ///< vector of sub-model variables
-
-  std::vector<std::string> zNames_;  ///< vector of the discrete variables name
-  std::vector<std::string> xNames_;  ///< vector of the continuous variables names
-  std::vector<std::string> calculatedVarNames_;  ///< vector of sub-model calculated variables names
-  std::vector<std::pair<std::string, std::pair<std::string, bool> > > xAliasesNames_;  ///< vector of the continuous aliases variables names
-  std::vector<std::pair<std::string, std::pair<std::string, bool> > > zAliasesNames_;  ///< vector of the discrete aliases variables names
-
-  std::vector<std::string> zNamesInit_;  ///< name of the discrete variables of the init model
-  std::vector<std::string> xNamesInit_;  ///< name of the continuous variables of the init model
-  std::vector<std::string> calculatedVarNamesInit_;  ///< name of the calculated variables of the init model
-  std::vector<boost::shared_ptr<Variable> > variablesInit_;  ///< vector of sub-model variables
-
-  std::map<std::string, int > mapElement_;  ///< map between elements names and indexes
-  std::vector<Element > elements_;  ///< elements of the models
+  boost::shared_ptr<VariableDefinitions> variableDefinitions_;  ///< variables of the dynamic model, possibly shared with other instances
+  boost::shared_ptr<VariableDefinitions> variableDefinitionsInit_;  ///< variables of the init model, possibly shared with other instances
+  boost::shared_ptr<ElementDefinitions> elementDefinitions_;  ///< elements of the model, possibly shared with other instances
 
   std::vector<boost::shared_ptr<curves::Curve> > curves_;  ///< curves to store
 
   std::list<std::string> messages_;  ///< messages that appears during the simulation
 
   double currentTime_;  ///< current simulation time
+  unsigned long valuesVersion_;  ///< version of the variables values, bumped each time they may have changed
   boost::shared_ptr<timeline::Timeline> timeline_;  ///< timeline where event messages should be added
   std::shared_ptr<constraints::ConstraintsCollection> constraints_;  ///< constraints collection where constraints should be added
 
@@ -1655,6 +1995,27 @@ class SubModel {
   bool isInitProcess_;  ///< whether the init process (or the standard dynamic simulation) is running
 
   bool isUpdatable_;   ///< indicate if subModel is an updatable model (or connector to updatable model)
+
+  bool fEquationsSet_;  ///< whether the equations formula were generated
+  bool gEquationsSet_;  ///< whether the root equations formula were generated
+
+  bool rootInputsValid_;  ///< whether rootInputs_ holds the inputs of the current root functions values
+  double rootInputsTime_;  ///< time of the last root functions evaluation
+  std::vector<double> rootInputs_;  ///< continuous variables, derivatives and discrete variables at the last root functions evaluation
+  bool residualInputsValid_;  ///< whether residualInputs_ and residuals_ hold the inputs and values of the last residual functions evaluation
+  double residualInputsTime_;  ///< time of the last residual functions evaluation
+  std::vector<double> residualInputs_;  ///< continuous variables, derivatives and discrete variables at the last residual functions evaluation
+  std::vector<double> residuals_;  ///< residual functions values of the last evaluation
+  bool jtColumnsValid_;  ///< whether jtColumns_ holds the columns of the model for its current modes and parameters
+  double jtColumnsCj_;  ///< value of cj used to compute jtColumns_
+  int jtColumnsRowOffset_;  ///< row offset used to compute jtColumns_
+  std::vector<double> jtColumnsZ_;  ///< discrete variables used to compute jtColumns_
+  std::shared_ptr<SparseMatrix> jtColumns_;  ///< columns of the model in the transposed Jacobian, kept when the Jacobian is piecewise constant
+
+  bool discreteEvaluationRequested_;  ///< whether the discrete variables and modes have to be evaluated at the next event
+
+  EvaluationCost evaluationCosts_[NB_COSTS];  ///< accounted cost of each evaluation
+  static std::atomic<bool> costAccountingEnabled_;  ///< whether the evaluation costs are accounted
 };
 
 }  // namespace DYN
@@ -0,0 +1,62 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNSubModelDefinitions.h
+ *
+ * @brief definitions of the variables and elements of a sub-model, that may be shared by several instances
+ *
+ */
+#ifndef MODELER_COMMON_DYNSUBMODELDEFINITIONS_H_
+#define MODELER_COMMON_DYNSUBMODELDEFINITIONS_H_
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include "DYNElement.h"
+
+namespace DYN {
+class Variable;
+
+/**
+ * @brief variables of a sub-model, with their names sorted by type
+ *
+ * Once the names are defined, the table only depends on the type of the sub-model and is not modified anymore :
+ * the instances of the same model type can then share it, the values being stored in the buffers of each instance.
+ */
+struct VariableDefinitions {
+  std::vector<boost::shared_ptr<Variable> > variables;  ///< variables of the sub-model
+  std::unordered_map<std::string, boost::shared_ptr<Variable> > variablesByName;  ///< association between variables and their name
+  std::vector<std::string> zNames;  ///< names of the discrete variables
+  std::vector<std::string> xNames;  ///< names of the continuous variables
+  std::vector<std::string> calculatedVarNames;  ///< names of the calculated variables
+  std::vector<std::pair<std::string, std::pair<std::string, bool> > > xAliasesNames;  ///< names of the continuous aliases variables
+  std::vector<std::pair<std::string, std::pair<std::string, bool> > > zAliasesNames;  ///< names of the discrete aliases variables
+};
+
+/**
+ * @brief elements (terminals and structures) of a sub-model
+ */
+struct ElementDefinitions {
+  std::vector<Element> elements;  ///< elements of the sub-model
+  std::map<std::string, int> mapElement;  ///< map between elements names and indexes
+};
+
+}  // namespace DYN
+
+#endif  // MODELER_COMMON_DYNSUBMODELDEFINITIONS_H_
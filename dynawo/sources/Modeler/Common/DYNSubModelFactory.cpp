@@ -17,11 +17,14 @@
  * @brief sub-model factory implementation file
  *
  */
+#include <algorithm>
 #include <map>
+#include <set>
 #include "DYNSubModelFactory.h"
 #include "DYNTrace.h"
 #include "DYNSubModel.h"
 #include "DYNCommon.h"
+#include "DYNThreadPool.h"
 
 #include <boost/dll/import.hpp>
 #include <boost/make_shared.hpp>
@@ -70,58 +73,86 @@ void SubModelFactories::add(const std::string& lib, const boost::function<delete
   factoryMapDelete_.insert(std::make_pair(lib, deleteFactory));
 }
 
+std::vector<std::string>
+SubModelFactories::getLibs() const {
+  std::unique_lock<std::mutex> lock(factoriesMutex_);
+  std::vector<std::string> libs;
+  libs.reserve(factoryMap_.size());
+  for (const auto& factory : factoryMap_)
+    libs.push_back(factory.first);
+  return libs;
+}
+
 boost::shared_ptr<SubModel> SubModelFactory::createSubModelFromLib(const std::string& lib) {
   SubModelFactories::SubmodelFactoryIterator iter = SubModelFactories::getInstance().find(lib);
-  SubModel* subModel;
-  boost::shared_ptr<SubModel> subModelShared;
-  boost::shared_ptr<boost::dll::shared_library> sharedLib;
+  SubModelFactory* factory;
+  if (SubModelFactories::getInstance().end(iter))
+    factory = loadFactory(lib);
+  else
+    factory = iter->second;
+
+  SubModel* subModel = factory->create();
+  SubModelDelete deleteSubModel(factory);
+  return boost::shared_ptr<SubModel>(subModel, deleteSubModel);
+}
+
+void
+SubModelFactory::loadLibs(const std::vector<std::string>& libs, const unsigned nbThreads) {
+  std::vector<std::string> libsToLoad;
+  std::set<std::string> libsFound;
+  for (const auto& lib : libs) {
+    if (libsFound.insert(lib).second && SubModelFactories::getInstance().end(SubModelFactories::getInstance().find(lib)))
+      libsToLoad.push_back(lib);
+  }
+  if (libsToLoad.empty())
+    return;
+
+  const unsigned nbLibs = static_cast<unsigned>(libsToLoad.size());
+  ThreadPool threadPool(std::max(1U, std::min(nbThreads, nbLibs)));
+  threadPool.parallelFor(nbLibs, [&libsToLoad](const unsigned i) {
+    loadFactory(libsToLoad[i]);
+  });
+}
 
-  if (SubModelFactories::getInstance().end(iter)) {
-    std::string func;
-    boost::function<getSubModelFactory_t> getFactory;
-    boost::function<deleteSubModelFactory_t> deleteFactory;
+SubModelFactory* SubModelFactory::loadFactory(const std::string& lib) {
+  std::string func;
+  boost::function<getSubModelFactory_t> getFactory;
+  boost::function<deleteSubModelFactory_t> deleteFactory;
+  boost::shared_ptr<boost::dll::shared_library> sharedLib;
 
-    boost::optional<boost::filesystem::path> libPath = getLibraryPathFromName(lib);
-    if (!libPath.is_initialized()) {
-      throw DYNError(DYN::Error::GENERAL, LibraryLoadFailure, lib);
-    }
+  boost::optional<boost::filesystem::path> libPath = getLibraryPathFromName(lib);
+  if (!libPath.is_initialized()) {
+    throw DYNError(DYN::Error::GENERAL, LibraryLoadFailure, lib);
+  }
 
-    try {
-      sharedLib = boost::make_shared<boost::dll::shared_library>(libPath->generic_string());
-      func = "getFactory";
+  try {
+    sharedLib = boost::make_shared<boost::dll::shared_library>(libPath->generic_string());
+    func = "getFactory";
 #if (BOOST_VERSION >= 107600)
-      getFactory = boost::dll::import_symbol<getSubModelFactory_t>(*sharedLib, func.c_str());
+    getFactory = boost::dll::import_symbol<getSubModelFactory_t>(*sharedLib, func.c_str());
 #else
-      getFactory = boost::dll::import<getSubModelFactory_t>(*sharedLib, func.c_str());
+    getFactory = boost::dll::import<getSubModelFactory_t>(*sharedLib, func.c_str());
 #endif
-      func = "deleteFactory";
+    func = "deleteFactory";
 #if (BOOST_VERSION >= 107600)
-      deleteFactory = boost::dll::import_symbol<deleteSubModelFactory_t>(*sharedLib, func.c_str());
+    deleteFactory = boost::dll::import_symbol<deleteSubModelFactory_t>(*sharedLib, func.c_str());
 #else
-      deleteFactory = boost::dll::import<deleteSubModelFactory_t>(*sharedLib, func.c_str());
+    deleteFactory = boost::dll::import<deleteSubModelFactory_t>(*sharedLib, func.c_str());
 #endif
-    } catch (const boost::system::system_error& e) {
-      Trace::error() << "Load error :" << e.what() << Trace::endline;
-      if (func.empty()) {
-        throw DYNError(DYN::Error::GENERAL, LibraryLoadFailure, lib);
-      } else {
-        throw DYNError(DYN::Error::GENERAL, LibraryLoadFailure, lib + "::" + func);
-      }
+  } catch (const boost::system::system_error& e) {
+    Trace::error() << "Load error :" << e.what() << Trace::endline;
+    if (func.empty()) {
+      throw DYNError(DYN::Error::GENERAL, LibraryLoadFailure, lib);
+    } else {
+      throw DYNError(DYN::Error::GENERAL, LibraryLoadFailure, lib + "::" + func);
     }
-
-    SubModelFactory* factory = getFactory();
-    factory->lib_ = sharedLib;
-    SubModelFactories::getInstance().add(lib, factory);
-    SubModelFactories::getInstance().add(lib, deleteFactory);
-    subModel = factory->create();
-    SubModelDelete deleteSubModel(factory);
-    subModelShared.reset(subModel, deleteSubModel);
-  } else {
-    subModel = iter->second->create();
-    SubModelDelete deleteSubModel(iter->second);
-    subModelShared.reset(subModel, deleteSubModel);
   }
-  return subModelShared;
+
+  SubModelFactory* factory = getFactory();
+  factory->lib_ = sharedLib;
+  SubModelFactories::getInstance().add(lib, factory);
+  SubModelFactories::getInstance().add(lib, deleteFactory);
+  return factory;
 }
 
 SubModelDelete::SubModelDelete(SubModelFactory* factory) : factory_(factory) {
@@ -22,6 +22,7 @@
 #define MODELER_COMMON_DYNSUBMODELFACTORY_H_
 #include <map>
 #include <string>
+#include <vector>
 #include <boost/core/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/dll.hpp>
@@ -71,7 +72,27 @@ class SubModelFactory : private boost::noncopyable {
    */
   static boost::shared_ptr<SubModel> createSubModelFromLib(const std::string& lib);
 
+  /**
+   * @brief Load libraries and create their factories before any submodel is created
+   *
+   * Each library is loaded once, the libraries already loaded being skipped. The libraries are loaded concurrently,
+   * the submodels being then created from the factories by createSubModelFromLib.
+   *
+   * @param libs : Names of the submodel libraries to load, possibly with duplicates
+   * @param nbThreads : Maximum number of libraries loaded concurrently
+   */
+  static void loadLibs(const std::vector<std::string>& libs, unsigned nbThreads);
+
   boost::shared_ptr<boost::dll::shared_library> lib_;  ///< Library of the submodel
+
+ private:
+  /**
+   * @brief Load a library and register its factory
+   *
+   * @param lib : Name of the submodel library to load
+   * @return Pointer to the factory of the library
+   */
+  static SubModelFactory* loadFactory(const std::string& lib);
 };
 
 /**
@@ -145,6 +166,13 @@ class SubModelFactories : private boost::noncopyable {
    */
   void add(const std::string& lib, const boost::function<deleteSubModelFactory_t>& deleteFactory);
 
+  /**
+   * @brief Get the names of the libraries loaded
+   *
+   * @return names of the libraries whose factory is available
+   */
+  std::vector<std::string> getLibs() const;
+
  private:
   std::map<std::string, SubModelFactory*> factoryMap_;  ///< associate a library factory with the name of the library
   std::map<std::string, boost::function<deleteSubModelFactory_t> > factoryMapDelete_;  ///< associate a library factory with its destruction method
@@ -0,0 +1,35 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNSubModelLibraries.cpp
+ *
+ * @brief Sub model libraries loaded in the process: implementation
+ *
+ */
+#include "DYNSubModelLibraries.h"
+#include "DYNSubModelFactory.h"
+
+namespace DYN {
+
+std::vector<std::string>
+SubModelLibraries::getLoaded() {
+  return SubModelFactories::getInstance().getLibs();
+}
+
+void
+SubModelLibraries::load(const std::vector<std::string>& libs, const unsigned nbThreads) {
+  SubModelFactory::loadLibs(libs, nbThreads);
+}
+
+}  // namespace DYN
@@ -0,0 +1,54 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNSubModelLibraries.h
+ *
+ * @brief Sub model libraries loaded in the process
+ *
+ * These functions give access to the sub model factories from the code that cannot include DYNSubModelFactory.h,
+ * whose library entry points conflict with the ones of DYNSolverFactory.h.
+ *
+ */
+#ifndef MODELER_COMMON_DYNSUBMODELLIBRARIES_H_
+#define MODELER_COMMON_DYNSUBMODELLIBRARIES_H_
+
+#include <string>
+#include <vector>
+
+namespace DYN {
+
+/**
+ * @brief SubModelLibraries static class
+ */
+class SubModelLibraries {
+ public:
+  /**
+   * @brief get the names of the sub model libraries loaded in the process
+   *
+   * @return names of the libraries whose factory is available
+   */
+  static std::vector<std::string> getLoaded();
+
+  /**
+   * @brief load sub model libraries so that the next sub models created from them do not load them
+   *
+   * @param libs names of the sub model libraries to load, the ones already loaded being skipped
+   * @param nbThreads maximum number of libraries loaded concurrently
+   */
+  static void load(const std::vector<std::string>& libs, unsigned nbThreads);
+};
+
+}  // namespace DYN
+
+#endif  // MODELER_COMMON_DYNSUBMODELLIBRARIES_H_
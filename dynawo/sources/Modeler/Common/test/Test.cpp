@@ -45,6 +45,7 @@
 
 #include "DYNError.h"
 #include "DYNErrorQueue.h"
+#include "DYNSparseMatrix.h"
 #include "DYNStaticRefInterface.h"
 
 using boost::shared_ptr;
@@ -291,6 +292,105 @@ modeChangeType_t SubModelMode::evalMode(const double t) {
   return NO_MODE;
 }
 
+class SubModelModeOnEvents : public SubModelMode {
+ public:
+  bool discreteChangesOnlyOnEvents() const override {
+    return true;
+  }
+};
+
+class SubModelRoots : public SubModelMock {
+ public:
+  SubModelRoots() : SubModelMock(1, 1), nbEvalG_(0) {
+    sizeG_ = 1;
+  }
+
+  void evalG(const double) override {
+    ++nbEvalG_;
+    gLocal_[0] = (yLocal_[0] > 1.) ? ROOT_UP : ROOT_DOWN;
+  }
+
+  bool rootsDependOnTime() const override {
+    return false;
+  }
+
+  unsigned int nbEvalG_;
+};
+
+class SubModelResiduals : public SubModelMock {
+ public:
+  SubModelResiduals() : SubModelMock(1, 1), nbEvalF_(0) {
+    sizeF_ = 1;
+  }
+
+  void evalF(double, propertyF_t) override {
+    ++nbEvalF_;
+    fLocal_[0] = yLocal_[0] - 2.;
+  }
+
+  bool residualsDependOnTime() const override {
+    return false;
+  }
+
+  unsigned int nbEvalF_;
+};
+
+class SubModelConnected : public SubModelMock {
+ public:
+  /**
+   * @brief the connected variable is either computed by the equation y = 2,
+   * or external and used by the equation x = 3 * y of an internal variable
+   */
+  explicit SubModelConnected(bool external) : SubModelMock(external ? 2 : 1, 0), external_(external) {
+    sizeF_ = 1;
+  }
+
+  void defineVariables(std::vector<boost::shared_ptr<Variable> >& variables) override {
+    variables.push_back(VariableNativeFactory::createState("MyVar_value", CONTINUOUS));
+    variables.push_back(VariableAliasFactory::create("MyOppositeVar_value", "MyVar_value", CONTINUOUS, true));
+    if (external_)
+      variables.push_back(VariableNativeFactory::createState("MyInternalVar_value", CONTINUOUS));
+  }
+
+  void defineElements(std::vector<Element>& elements, std::map<std::string, int >& mapElement) override {
+    addElement("MyVar", Element::STRUCTURE, elements, mapElement);
+    addSubElement("value", "MyVar", Element::TERMINAL, name(), modelType(), elements, mapElement);
+    addElement("MyOppositeVar", Element::STRUCTURE, elements, mapElement);
+    addSubElement("value", "MyOppositeVar", Element::TERMINAL, name(), modelType(), elements, mapElement);
+  }
+
+  void evalStaticYType() override {
+    yType_[0] = external_ ? EXTERNAL : ALGEBRAIC;
+    if (external_)
+      yType_[1] = ALGEBRAIC;
+  }
+
+  void evalStaticFType() override {
+    fType_[0] = ALGEBRAIC_EQ;
+  }
+
+  void evalF(double, propertyF_t) override {
+    fLocal_[0] = external_ ? yLocal_[1] - 3. * yLocal_[0] : yLocal_[0] - 2.;
+  }
+
+  void evalJt(const double, const double, const int rowOffset, SparseMatrix& jt) override {
+    jt.changeCol();
+    if (external_) {
+      jt.addTerm(rowOffset, -3.);
+      jt.addTerm(rowOffset + 1, 1.);
+    } else {
+      jt.addTerm(rowOffset, 1.);
+    }
+  }
+
+  void evalJtPrim(const double, const double, const int, SparseMatrix& jtPrim) override {
+    jtPrim.changeCol();
+  }
+
+ private:
+  bool external_;  ///< whether the connected variable is computed by another sub model
+};
+
 //-----------------------------------------------------
 // TEST DYNParameter
 //-----------------------------------------------------
@@ -869,6 +969,31 @@ TEST(ModelerCommonTest, ConnectorsY) {
   ASSERT_EQ(connectorContainer->nbFlowConnectors(), 0);
 }
 
+TEST(ModelerCommonTest, ConnectedSubModelVariableIndexGlobal) {
+  boost::shared_ptr<SubModelMock> submodel = boost::shared_ptr<SubModelMock>(new SubModelMock(1, 1));
+  boost::dynamic_pointer_cast<SubModel>(submodel)->defineVariables();
+  submodel->defineNames();
+  int sizeYGlob = 3;
+  int sizeZGlob = 5;
+  int sizeModeGlob = 0;
+  int sizeFGlob = 0;
+  int sizeGGlob = 0;
+  ASSERT_NO_THROW(submodel->initSize(sizeYGlob, sizeZGlob, sizeModeGlob, sizeFGlob, sizeGGlob));
+
+  const boost::shared_ptr<SubModel> subModel = submodel;
+  const connectedSubModel continuous(subModel, subModel->getVariable("MyVar_value"), false);
+  const connectedSubModel alias(subModel, subModel->getVariable("MyAliasVar_value"), false);
+  const connectedSubModel discrete(subModel, subModel->getVariable("MyDiscreteVar_value"), false);
+  // the first call resolves the variable, the next ones reuse it
+  for (unsigned i = 0; i < 2; ++i) {
+    ASSERT_EQ(continuous.variableIndexGlobal(), 3);
+    ASSERT_EQ(alias.variableIndexGlobal(), 3);
+    ASSERT_EQ(discrete.variableIndexGlobal(), 5);
+  }
+  const connectedSubModel calculated(subModel, subModel->getVariable("MyDiscreteVarCalculated_value"), false);
+  ASSERT_THROW_DYNAWO(calculated.variableIndexGlobal(), Error::MODELER, KeyError_t::SubModelBadVariableTypeForVariableIndex);
+}
+
 
 //-----------------------------------------------------
 // TEST Modeler Common utilities
@@ -1042,6 +1167,179 @@ TEST(ModelerCommonTest, testModeHandling) {
   ASSERT_EQ(modelMulti->getModeChangeType(), DIFFERENTIAL_MODE);
 }
 
+TEST(ModelerCommonTest, EventDrivenModeHandling) {
+  boost::shared_ptr<ModelMulti> modelMulti(new ModelMulti());
+  boost::shared_ptr<SubModel> subModel(new SubModelModeOnEvents());
+  subModel->name("SubModelName");
+  modelMulti->addSubModel(subModel, "SubModelModeOnEvents");
+  modelMulti->setEventDrivenDiscreteEvaluation(true);
+  const std::vector<state_g> g;
+
+  // the first event always evaluates the sub model
+  modelMulti->notifyRootsChange(g, g);
+  modelMulti->evalMode(1);
+  ASSERT_EQ(modelMulti->modeChange(), true);
+  ASSERT_EQ(modelMulti->getModeChangeType(), DIFFERENTIAL_MODE);
+
+  // the sub model owns no changed root function, it is skipped
+  modelMulti->reinitMode();
+  modelMulti->notifyRootsChange(g, g);
+  modelMulti->evalMode(2);
+  ASSERT_EQ(modelMulti->modeChange(), false);
+  ASSERT_EQ(modelMulti->getModeChangeType(), NO_MODE);
+
+  // unless its evaluation is requested
+  subModel->requestDiscreteEvaluation();
+  modelMulti->notifyRootsChange(g, g);
+  modelMulti->evalMode(2);
+  ASSERT_EQ(modelMulti->modeChange(), true);
+  ASSERT_EQ(modelMulti->getModeChangeType(), ALGEBRAIC_MODE);
+
+  // without notification, every sub model is evaluated
+  modelMulti->reinitMode();
+  modelMulti->evalMode(4);
+  ASSERT_EQ(modelMulti->modeChange(), true);
+  ASSERT_EQ(modelMulti->getModeChangeType(), ALGEBRAIC_J_UPDATE_MODE);
+}
+
+TEST(ModelerCommonTest, BatchEvaluation) {
+  SubModelRoots subModel1;
+  SubModelRoots subModel2;
+  std::vector<double> y(2, 1.);
+  std::vector<double> yp(2, 0.);
+  std::vector<double> z(2, 0.);
+  std::vector<state_g> g(2, NO_ROOT);
+  bool zConnected[2] = {false, false};
+  subModel1.setBufferY(&y[0], &yp[0], 0);
+  subModel1.setBufferZ(&z[0], zConnected, 0);
+  subModel1.setBufferG(&g[0], 0);
+  subModel2.setBufferY(&y[0], &yp[0], 1);
+  subModel2.setBufferZ(&z[0], zConnected, 1);
+  subModel2.setBufferG(&g[0], 1);
+  ASSERT_TRUE(subModel1.getBatchKey() == NULL);
+
+  // by default, the sub models of a batch are evaluated one by one
+  y[1] = 2.;
+  SubModel* batch[2] = {&subModel1, &subModel2};
+  subModel1.evalGBatch(2., batch, 2);
+  ASSERT_EQ(subModel1.nbEvalG_, 1);
+  ASSERT_EQ(subModel2.nbEvalG_, 1);
+  ASSERT_EQ(g[0], ROOT_DOWN);
+  ASSERT_EQ(g[1], ROOT_UP);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(subModel1.getCurrentTime(), 2.);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(subModel2.getCurrentTime(), 2.);
+  subModel1.evalFBatch(3., UNDEFINED_EQ, batch, 2);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(subModel1.getCurrentTime(), 3.);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(subModel2.getCurrentTime(), 3.);
+}
+
+TEST(ModelerCommonTest, IncrementalRootEvaluation) {
+  SubModelRoots subModel;
+  std::vector<double> y(1, 1.);
+  std::vector<double> yp(1, 0.);
+  std::vector<double> z(1, 0.);
+  std::vector<state_g> g(1, NO_ROOT);
+  bool zConnected[1] = {false};
+  subModel.setBufferY(&y[0], &yp[0], 0);
+  subModel.setBufferZ(&z[0], zConnected, 0);
+  subModel.setBufferG(&g[0], 0);
+
+  subModel.evalGSubIncremental(0.);
+  ASSERT_EQ(subModel.nbEvalG_, 1);
+  ASSERT_EQ(g[0], ROOT_DOWN);
+  // the root functions do not depend on time
+  subModel.evalGSubIncremental(1.);
+  ASSERT_EQ(subModel.nbEvalG_, 1);
+  y[0] = 2.;
+  subModel.evalGSubIncremental(1.);
+  ASSERT_EQ(subModel.nbEvalG_, 2);
+  ASSERT_EQ(g[0], ROOT_UP);
+  yp[0] = 1.;
+  subModel.evalGSubIncremental(1.);
+  ASSERT_EQ(subModel.nbEvalG_, 3);
+  z[0] = 1.;
+  subModel.evalGSubIncremental(1.);
+  ASSERT_EQ(subModel.nbEvalG_, 4);
+  subModel.evalGSubIncremental(1.);
+  ASSERT_EQ(subModel.nbEvalG_, 4);
+  subModel.invalidateRootInputs();
+  subModel.evalGSubIncremental(1.);
+  ASSERT_EQ(subModel.nbEvalG_, 5);
+  // a discrete update may change the internal state of the model
+  subModel.evalZSub(1.);
+  subModel.evalGSubIncremental(1.);
+  ASSERT_EQ(subModel.nbEvalG_, 6);
+  // the non incremental evaluation is never skipped
+  subModel.evalGSub(1.);
+  ASSERT_EQ(subModel.nbEvalG_, 7);
+}
+
+TEST(ModelerCommonTest, IncrementalResidualEvaluation) {
+  SubModelResiduals subModel;
+  std::vector<double> y(1, 1.);
+  std::vector<double> yp(1, 0.);
+  std::vector<double> z(1, 0.);
+  std::vector<double> f(1, 0.);
+  bool zConnected[1] = {false};
+  subModel.setBufferY(&y[0], &yp[0], 0);
+  subModel.setBufferZ(&z[0], zConnected, 0);
+  subModel.setBufferF(&f[0], 0);
+
+  subModel.evalFSubIncremental(0.);
+  ASSERT_EQ(subModel.nbEvalF_, 1);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(f[0], -1.);
+  // the residual functions do not depend on time, the last residuals are written again
+  f[0] = 0.;
+  subModel.evalFSubIncremental(1.);
+  ASSERT_EQ(subModel.nbEvalF_, 1);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(f[0], -1.);
+  y[0] = 3.;
+  subModel.evalFSubIncremental(1.);
+  ASSERT_EQ(subModel.nbEvalF_, 2);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(f[0], 1.);
+  yp[0] = 1.;
+  subModel.evalFSubIncremental(1.);
+  ASSERT_EQ(subModel.nbEvalF_, 3);
+  z[0] = 1.;
+  subModel.evalFSubIncremental(1.);
+  ASSERT_EQ(subModel.nbEvalF_, 4);
+  subModel.evalFSubIncremental(1.);
+  ASSERT_EQ(subModel.nbEvalF_, 4);
+  subModel.invalidateResidualInputs();
+  subModel.evalFSubIncremental(1.);
+  ASSERT_EQ(subModel.nbEvalF_, 5);
+  // a discrete update may change the internal state of the model
+  subModel.evalZSub(1.);
+  subModel.evalFSubIncremental(1.);
+  ASSERT_EQ(subModel.nbEvalF_, 6);
+  // the non incremental evaluation is never skipped
+  subModel.evalFSub(1.);
+  ASSERT_EQ(subModel.nbEvalF_, 7);
+}
+
+TEST(ModelerCommonTest, ValuesVersion) {
+  SubModelRoots subModel;
+  std::vector<double> y(1, 1.);
+  std::vector<double> yp(1, 0.);
+  std::vector<double> z(1, 0.);
+  bool zConnected[1] = {false};
+  const unsigned long initialVersion = subModel.getValuesVersion();
+  subModel.setBufferY(&y[0], &yp[0], 0);
+  subModel.setBufferZ(&z[0], zConnected, 0);
+  unsigned long version = subModel.getValuesVersion();
+  ASSERT_NE(version, initialVersion);
+
+  // reading the values does not change the version
+  subModel.getCurrentTime();
+  ASSERT_EQ(subModel.getValuesVersion(), version);
+  // any evaluation does
+  subModel.evalZSub(1.);
+  ASSERT_NE(subModel.getValuesVersion(), version);
+  version = subModel.getValuesVersion();
+  subModel.notifyValuesChanged();
+  ASSERT_NE(subModel.getValuesVersion(), version);
+}
+
 TEST(ModelerCommonTest, SanityCheckOnSizeYZ) {
   // Create submodel
   boost::shared_ptr<SubModelMock> submodel = boost::shared_ptr<SubModelMock>(new SubModelMock(2, 1));
@@ -1176,4 +1474,61 @@ TEST(ModelerCommonTest, ConnectionCalculatedVars) {
   ASSERT_NO_THROW(modelMulti->findSubModelByName(name)->setGequations());
 }
 
+
+TEST(ModelerCommonTest, AliasElimination) {
+  ModelMulti modelMulti;
+  boost::shared_ptr<SubModel> computing(new SubModelConnected(false));
+  computing->name("computing");
+  modelMulti.addSubModel(computing, "");
+  boost::shared_ptr<SubModel> external(new SubModelConnected(true));
+  external->name("external");
+  modelMulti.addSubModel(external, "");
+  // the variable of the external sub model is the opposite of the computed one
+  modelMulti.connectElements(computing, "MyVar_value", external, "MyOppositeVar_value");
+  modelMulti.initBuffers();
+  ASSERT_EQ(modelMulti.sizeY(), 3);
+  ASSERT_EQ(modelMulti.sizeF(), 3);
+
+  // the external variable and the equation of the connector are eliminated
+  modelMulti.setAliasElimination(true);
+  ASSERT_EQ(modelMulti.sizeY(), 2);
+  ASSERT_EQ(modelMulti.sizeF(), 2);
+  ASSERT_EQ(modelMulti.getYType()[0], ALGEBRAIC);
+  ASSERT_EQ(modelMulti.getYType()[1], ALGEBRAIC);
+  ASSERT_EQ(modelMulti.getVariableName(1), "external_MyInternalVar_value");
+  std::string subModelName;
+  int localFIndex;
+  std::string fEquation;
+  modelMulti.getFInfos(1, subModelName, localFIndex, fEquation);
+  ASSERT_EQ(subModelName, "external");
+  ASSERT_EQ(localFIndex, 0);
+
+  // the aliases are expanded before the evaluation: x - 3 * (-y) = 1 + 3
+  std::vector<double> y(2, 1.);
+  std::vector<double> yp(2, 0.);
+  std::vector<double> f(2, 0.);
+  modelMulti.evalF(0., &y[0], &yp[0], &f[0]);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(f[0], -1.);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(f[1], 4.);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(external->getVariableValue("MyVar_value"), -1.);
+
+  // the terms of the alias are folded with the opposite sign in the row of the variable kept
+  SparseMatrix jt;
+  jt.init(modelMulti.sizeY(), modelMulti.sizeF());
+  modelMulti.evalJt(0., 0., jt);
+  ASSERT_EQ(jt.nbElem(), 3);
+  ASSERT_EQ(jt.Ap_[1], 1u);
+  ASSERT_EQ(jt.Ai_[0], 0u);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(jt.Ax_[0], 1.);
+  ASSERT_EQ(jt.Ai_[1], 0u);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(jt.Ax_[1], 3.);
+  ASSERT_EQ(jt.Ai_[2], 1u);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(jt.Ax_[2], 1.);
+
+  // without elimination, the connector equation is solved again
+  modelMulti.setAliasElimination(false);
+  ASSERT_EQ(modelMulti.sizeY(), 3);
+  ASSERT_EQ(modelMulti.sizeF(), 3);
+}
+
 }  // namespace DYN
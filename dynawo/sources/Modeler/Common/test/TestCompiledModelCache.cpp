@@ -0,0 +1,105 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file Modeler/Common/test/TestCompiledModelCache.cpp
+ * @brief Unit tests for the cache of compiled models
+ *
+ */
+
+#include <fstream>
+#include <string>
+
+#include "DYNCompiledModelCache.h"
+#include "DYNFileSystemUtils.h"
+#include "gtest_dynawo.h"
+
+namespace DYN {
+
+static void
+writeFile(const std::string& path, const std::string& content) {
+  std::ofstream file(path.c_str(), std::ios::binary);
+  file << content;
+}
+
+static std::string
+readFile(const std::string& path) {
+  std::ifstream file(path.c_str(), std::ios::binary);
+  return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+TEST(ModelerCommonTest, testCompiledModelCacheKey) {
+  CompiledModelCache::KeyBuilder key1;
+  key1.add("ab");
+  key1.add("c");
+  CompiledModelCache::KeyBuilder key2;
+  key2.add("ab");
+  key2.add("c");
+  CompiledModelCache::KeyBuilder key3;
+  key3.add("a");
+  key3.add("bc");
+  ASSERT_EQ(key1.getKey(), key2.getKey());
+  ASSERT_NE(key1.getKey(), key3.getKey());
+  ASSERT_EQ(key1.getKey().size(), 32);
+
+  writeFile("compiledModelCacheEmpty.mo", "");
+  CompiledModelCache::KeyBuilder keyEmptyFile;
+  keyEmptyFile.addFileContent("compiledModelCacheEmpty.mo");
+  CompiledModelCache::KeyBuilder keyMissingFile;
+  keyMissingFile.addFileContent("compiledModelCacheMissing.mo");
+  ASSERT_NE(keyEmptyFile.getKey(), keyMissingFile.getKey());
+
+  writeFile("compiledModelCacheModel.mo", "model A end A;");
+  CompiledModelCache::KeyBuilder keyFile;
+  keyFile.addFileContent("compiledModelCacheModel.mo");
+  writeFile("compiledModelCacheModel.mo", "model B end B;");
+  CompiledModelCache::KeyBuilder keyModifiedFile;
+  keyModifiedFile.addFileContent("compiledModelCacheModel.mo");
+  ASSERT_NE(keyFile.getKey(), keyModifiedFile.getKey());
+
+  remove("compiledModelCacheEmpty.mo");
+  remove("compiledModelCacheModel.mo");
+}
+
+TEST(ModelerCommonTest, testCompiledModelCacheStoreRetrieve) {
+  const std::string cacheDir = "compiledModelCache";
+  if (isDirectory(cacheDir))
+    removeAllInDirectory(cacheDir);
+  const CompiledModelCache cache(cacheDir);
+  ASSERT_TRUE(isDirectory(cacheDir));
+
+  const std::string lib = "compiledModelCacheLib.so";
+  ASSERT_FALSE(cache.retrieve("key", lib));
+  writeFile(lib, "compiled");
+  cache.store("key", lib);
+  ASSERT_EQ(listDirectory(cacheDir).size(), 1);
+
+  writeFile(lib, "stale");
+  ASSERT_TRUE(cache.retrieve("key", lib));
+  ASSERT_EQ(readFile(lib), "compiled");
+  ASSERT_FALSE(cache.retrieve("otherKey", lib));
+
+  // storing the same key again replaces the library
+  writeFile(lib, "recompiled");
+  cache.store("key", lib);
+  ASSERT_EQ(listDirectory(cacheDir).size(), 1);
+  remove(lib);
+  ASSERT_TRUE(cache.retrieve("key", lib));
+  ASSERT_EQ(readFile(lib), "recompiled");
+
+  remove(lib);
+  removeAllInDirectory(cacheDir);
+  remove(cacheDir);
+}
+
+}  // namespace DYN
@@ -342,3 +342,79 @@ TEST(CommonTest, testDelayManagerClassParameters) {
   ok = manager3.loadDelays(format3, 1.1);
   ASSERT_FALSE(ok);
 }
+
+TEST(CommonTest, testDelayManagerClassBinaryParameters) {
+  DYN::DelayManager manager;
+  double time = 0.;
+  double value = 0.;
+  manager.addDelay(10, &time, &value, 1.5);
+  manager.addDelay(20, &time, &value, 3.);
+  for (unsigned i = 1; i <= 5; ++i) {
+    time = i;
+    value = 1.1 * i + 1e-9;
+    manager.saveTimepoint();
+  }
+
+  std::vector<double> values;
+  manager.dumpDelays(values);
+  ASSERT_EQ(values.size(), 3 + 2 * 3 + 3 + 2 * 5);
+
+  // the timepoints are restored without loss of precision
+  DYN::DelayManager manager2;
+  ASSERT_TRUE(manager2.loadDelays(values, 5.5));
+  std::vector<double> values2;
+  manager2.dumpDelays(values2);
+  ASSERT_EQ(values2, values);
+  ASSERT_EQ(manager2.getDelayById(20).size(), 5);
+  ASSERT_TRUE(DYN::doubleEquals(*manager2.getInitialValue(20), 2.75));
+
+  // truncated values
+  values.pop_back();
+  DYN::DelayManager manager3;
+  ASSERT_FALSE(manager3.loadDelays(values, 5.5));
+}
+
+TEST(CommonTest, testDelayManagerClassSnapshot) {
+  DYN::DelayManager manager;
+
+  double time = 1;
+  double value = 1.;
+  size_t id = 10;
+  manager.addDelay(id, &time, &value, 2.);
+
+  for (unsigned i = 0; i < 3; ++i) {
+    time = 1. + i;
+    value = 1. + i;
+    manager.saveTimepoint();
+  }
+  DYN::StateBuffer snapshot;
+  manager.snapshotDelays(snapshot);
+
+  // the trajectory goes on after the snapshot
+  for (unsigned i = 3; i < 6; ++i) {
+    time = 1. + i;
+    value = 10. * (1. + i);
+    manager.saveTimepoint();
+  }
+  time = 6;
+  ASSERT_TRUE(DYN::doubleEquals(manager.getDelay(id, 1.), 50.));
+
+  // back to the snapshot, twice
+  for (unsigned i = 0; i < 2; ++i) {
+    DYN::StateBuffer::Reader reader(snapshot);
+    manager.restoreDelays(reader);
+    ASSERT_TRUE(reader.atEnd());
+    time = 3;
+    ASSERT_TRUE(DYN::doubleEquals(manager.getDelay(id, 1.), 2.));
+    ASSERT_TRUE(DYN::doubleEquals(*manager.getInitialValue(id), 1.));
+    // the delay still records the values it refers to
+    time = 4;
+    value = 4.;
+    manager.saveTimepoint();
+    ASSERT_TRUE(DYN::doubleEquals(manager.getDelay(id, 0.5), 3.5));
+  }
+
+  DYN::DelayManager otherManager;
+  DYN::StateBuffer::Reader reader(snapshot);
+  ASSERT_THROW_DYNAWO(otherManager.restoreDelays(reader), DYN::Error::GENERAL, DYN::KeyError_t::StateSnapshotMismatch);
+}
@@ -21,9 +21,12 @@
 #include "DYNSubModel.h"
 #include "DYNVariableNative.h"
 #include "DYNVariableNativeFactory.h"
+#include "DYNMacrosMessage.h"
 #include "gtest_dynawo.h"
 
 #include <boost/make_shared.hpp>
+#include <atomic>
+#include <string>
 #include <vector>
 
 namespace DYN {
@@ -263,6 +266,47 @@ void SubModelMock2::defineVariables(std::vector<boost::shared_ptr<Variable> >& v
   variables.push_back(VariableNativeFactory::create("VarF2", FLOW, true));
 }
 
+class SubModelMockStatic : public SubModelMock1 {
+ public:
+  SubModelMockStatic(unsigned nbY, unsigned nbZ) : SubModelMock1(nbY, nbZ) {
+  }
+
+  void defineVariables(std::vector<boost::shared_ptr<Variable> >& variables) override {
+    ++nbDefinitions;
+    SubModelMock1::defineVariables(variables);
+  }
+
+  bool hasStaticDefinitions() const override {
+    return true;
+  }
+
+  static std::atomic<unsigned> nbDefinitions;  ///< number of calls to defineVariables, possibly concurrent
+};
+
+std::atomic<unsigned> SubModelMockStatic::nbDefinitions(0);
+
+class SubModelMockInit : public SubModelMock1 {
+ public:
+  SubModelMockInit(unsigned nbY, unsigned nbZ, bool failing) : SubModelMock1(nbY, nbZ),
+  failing_(failing),
+  initialized_(false) {
+  }
+
+  void init(const double) override {
+    if (failing_)
+      throw DYNError(Error::MODELER, ErrorInit, modelType(), name());
+    initialized_ = true;
+  }
+
+  bool initialized() const {
+    return initialized_;
+  }
+
+ private:
+  bool failing_;  ///< whether the local initialization fails
+  bool initialized_;  ///< whether the local initialization was run
+};
+
 TEST(TestGetName, getVariableName) {
   ModelMulti model;
   boost::shared_ptr<DYN::SubModel> sub = boost::make_shared<DYN::SubModelMock1>(2, 1);
@@ -278,6 +322,95 @@ TEST(TestGetName, getVariableName) {
   ASSERT_EQ("_VarF2", model.getVariableName(2));
 }
 
+TEST(TestGetName, sharedDefinitions) {
+  ModelMulti model;
+  SubModelMockStatic::nbDefinitions = 0;
+  boost::shared_ptr<DYN::SubModel> sub1 = boost::make_shared<DYN::SubModelMockStatic>(2, 1);
+  sub1->name("MOCK1");
+  model.addSubModel(sub1, "libMock");
+  boost::shared_ptr<DYN::SubModel> sub2 = boost::make_shared<DYN::SubModelMockStatic>(2, 1);
+  sub2->name("MOCK2");
+  model.addSubModel(sub2, "libMock");
+  boost::shared_ptr<DYN::SubModel> sub3 = boost::make_shared<DYN::SubModelMockStatic>(2, 1);
+  sub3->name("MOCK3");
+  model.addSubModel(sub3, "otherLibMock");
+
+  ASSERT_EQ(2, SubModelMockStatic::nbDefinitions.load());
+  ASSERT_EQ(&sub1->getVariableByName(), &sub2->getVariableByName());
+  ASSERT_EQ(&sub1->xNames(), &sub2->xNames());
+  ASSERT_NE(&sub1->getVariableByName(), &sub3->getVariableByName());
+  ASSERT_TRUE(sub2->hasVariable("VarD"));
+
+  model.initBuffers();
+  ASSERT_EQ("MOCK1_VarC", model.getVariableName(0));
+  ASSERT_EQ("MOCK2_VarC", model.getVariableName(2));
+  ASSERT_EQ("MOCK2_VarF", model.getVariableName(3));
+  ASSERT_EQ(2, sub1->xNames().size());
+}
+
+TEST(TestGetName, addSubModelsConcurrently) {
+  ModelMulti model;
+  SubModelMockStatic::nbDefinitions = 0;
+  boost::shared_ptr<DYN::SubModel> sub0 = boost::make_shared<DYN::SubModelMock2>(1, 0);
+  sub0->name("MOCK0");
+  model.addSubModel(sub0, "");
+
+  std::vector<boost::shared_ptr<DYN::SubModel> > subs;
+  std::vector<std::string> libNames;
+  for (unsigned i = 1; i <= 4; ++i) {
+    subs.push_back(boost::make_shared<DYN::SubModelMockStatic>(2, 1));
+    subs.back()->name("MOCK" + std::to_string(i));
+    libNames.push_back(i == 3 ? "otherLibMock" : "libMock");
+  }
+  model.addSubModels(subs, libNames, 3);
+
+  // one definition per library, shared by the next instances whatever the thread initializing them
+  ASSERT_EQ(2, SubModelMockStatic::nbDefinitions.load());
+  ASSERT_EQ(&subs[0]->getVariableByName(), &subs[1]->getVariableByName());
+  ASSERT_EQ(&subs[0]->getVariableByName(), &subs[3]->getVariableByName());
+  ASSERT_NE(&subs[0]->getVariableByName(), &subs[2]->getVariableByName());
+
+  // the sub models are added in the order given
+  model.initBuffers();
+  ASSERT_EQ("MOCK0_VarF2", model.getVariableName(0));
+  ASSERT_EQ("MOCK1_VarC", model.getVariableName(1));
+  ASSERT_EQ("MOCK2_VarC", model.getVariableName(3));
+  ASSERT_EQ("MOCK3_VarC", model.getVariableName(5));
+  ASSERT_EQ("MOCK4_VarF", model.getVariableName(8));
+}
+
+TEST(TestGetName, initSubModelsConcurrently) {
+  ModelMulti model;
+  std::vector<boost::shared_ptr<SubModelMockInit> > subs;
+  for (unsigned i = 0; i < 6; ++i) {
+    subs.push_back(boost::make_shared<DYN::SubModelMockInit>(2, 1, false));
+    subs.back()->name("MOCK" + std::to_string(i));
+    model.addSubModel(subs.back(), "");
+  }
+  model.initBuffers();
+  model.setNbInitThreads(3);
+  ASSERT_NO_THROW(model.init(0.));
+  for (const auto& sub : subs)
+    ASSERT_TRUE(sub->initialized());
+
+  // the error reported is the one of the first sub model failing, whatever the thread initializing it
+  ModelMulti failingModel;
+  for (unsigned i = 0; i < 6; ++i) {
+    boost::shared_ptr<DYN::SubModel> sub = boost::make_shared<DYN::SubModelMockInit>(2, 1, i == 2 || i == 4);
+    sub->name("MOCK" + std::to_string(i));
+    failingModel.addSubModel(sub, "");
+  }
+  failingModel.initBuffers();
+  failingModel.setNbInitThreads(3);
+  try {
+    failingModel.init(0.);
+    FAIL();
+  } catch (const DYN::Error& e) {
+    ASSERT_EQ(DYN::KeyError_t::ErrorInit, e.key());
+    ASSERT_NE(std::string(e.what()).find("MOCK2"), std::string::npos);
+  }
+}
+
 TEST(TestGetName, getFInfos) {
   ModelMulti model;
   boost::shared_ptr<DYN::SubModel> sub = boost::make_shared<DYN::SubModelMock1>(2, 1);
@@ -310,4 +443,21 @@ TEST(TestGetName, getFInfos) {
   ASSERT_EQ("Eq2_1", eq);
 }
 
+TEST(TestGetName, getFInfosGeneratesEquationsOnDemand) {
+  ModelMulti model;
+  boost::shared_ptr<DYN::SubModel> sub = boost::make_shared<DYN::SubModelMock1>(2, 1);
+  sub->name("MOCK1");
+  model.addSubModel(sub, "");
+
+  model.initBuffers();
+
+  std::string name;
+  int index;
+  std::string eq;
+  model.getFInfos(1, name, index, eq);
+  ASSERT_EQ("MOCK1", name);
+  ASSERT_EQ(1, index);
+  ASSERT_EQ("Eq2", eq);
+}
+
 }  // namespace DYN
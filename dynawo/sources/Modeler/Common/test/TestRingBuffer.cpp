@@ -90,3 +90,30 @@ TEST(CommonTest, testRingBufferClassFloat) {
   double value = buffer.get(5, 1.5);
   ASSERT_EQ(value, 3.85);
 }
+
+TEST(CommonTest, testRingBufferClassWrapAround) {
+  DYN::RingBuffer buffer(2.5);
+
+  // the oldest points are removed while the buffer grows, the points being stored all around the arrays
+  for (unsigned int i = 0; i < 100; ++i) {
+    buffer.add(0.1 * i, 2. * i);
+    if (i > 30) {
+      ASSERT_TRUE(DYN::doubleEquals(buffer.get(0.1 * i, 2.45), 2. * (i - 24.5)));
+      ASSERT_TRUE(DYN::doubleEquals(buffer.get(0.1 * i, 1.), 2. * (i - 10)));
+      ASSERT_TRUE(DYN::doubleEquals(buffer.get(0.1 * i, 0.05), 2. * (i - 0.5)));
+    }
+  }
+  ASSERT_EQ(buffer.size(), 27);
+  ASSERT_TRUE(DYN::doubleEquals(buffer.getLastRegisteredPoint().second, 198.));
+
+  std::vector<std::pair<double, double> > vec;
+  buffer.points(vec);
+  ASSERT_EQ(vec.size(), 27);
+  for (unsigned int i = 0; i < vec.size(); ++i)
+    ASSERT_TRUE(DYN::doubleEquals(vec[i].second, 2. * (73 + i)));
+
+  // the requested times are not necessarily increasing
+  ASSERT_TRUE(DYN::doubleEquals(buffer.get(9.9, 0.2), 194.));
+  ASSERT_TRUE(DYN::doubleEquals(buffer.get(9.9, 2.), 158.));
+  ASSERT_TRUE(DYN::doubleEquals(buffer.get(9.9, 0.2), 194.));
+}
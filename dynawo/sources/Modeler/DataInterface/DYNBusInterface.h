@@ -73,6 +73,13 @@ class BusInterface : public ComponentInterface {
    */
   virtual double getAngle0() const = 0;
 
+  /**
+   * @brief Setter for the initial voltage of the bus, replacing the values read in the network file
+   * @param v0 The voltage magnitude of the bus in kV
+   * @param angle0 The voltage angle of the bus in degree
+   */
+  virtual void setInitialVoltage(double v0, double angle0) = 0;
+
   /**
    * @brief Getter for the nominal voltage of the bus
    * @return The nominal voltage of the bus in kV
@@ -22,6 +22,7 @@
 #include "DYNSubModel.h"
 #include "DYNVariable.h"
 #include "DYNTrace.h"
+#include "DYNMemoryUsage.h"
 
 using boost::shared_ptr;
 using std::string;
@@ -32,7 +33,12 @@ namespace DYN {
 ComponentInterface::ComponentInterface(bool hasInitialConditions) :
 type_(UNKNOWN),
 hasDynamicModel_(false),
-hasInitialConditions_(hasInitialConditions) {
+hasInitialConditions_(hasInitialConditions),
+valuesUpdated_(false),
+valuesVersion_(0),
+criteriaValuesUpdated_(false),
+criteriaValuesVersion_(0),
+connectionStateChanged_(false) {
 #ifdef _DEBUG_
   checkStateVariableAreUpdatedBeforeCriteriaCheck_ = false;
 #endif
@@ -66,6 +72,17 @@ ComponentInterface::hasInitialConditions() const {
 void
 ComponentInterface::setModelDyn(const shared_ptr<SubModel>& model) {
   modelDyn_ = model;
+  valuesUpdated_ = false;
+  criteriaValuesUpdated_ = false;
+}
+
+bool
+ComponentInterface::hasReferences() const {
+  for (const auto& stateVariable : stateVariables_) {
+    if (!stateVariable.getModelId().empty())
+      return true;
+  }
+  return false;
 }
 
 void
@@ -84,15 +101,45 @@ ComponentInterface::setReference(const string& componentVar, const string& model
 
 void
 ComponentInterface::updateFromModel(bool filterForCriteriaCheck) {
-  for (unsigned int i =0; i< stateVariables_.size(); ++i) {
-    StateVariable& var = stateVariables_[i];
-    if (!filterForCriteriaCheck || var.isNeededForCriteriaCheck())
+  // left out of the dynamic models
+  if (!modelDyn_)
+    return;
+  // the values are only read again if the model was evaluated since the previous update
+  const unsigned long version = modelDyn_->getValuesVersion();
+  if (filterForCriteriaCheck) {
+    if (criteriaValuesUpdated_ && criteriaValuesVersion_ == version)
+      return;
+    for (const unsigned int index : criteriaStateVariables_) {
+      StateVariable& var = stateVariables_[index];
       var.setValue(modelDyn_->getVariableValue(var.getVariable()));
+    }
+  } else {
+    if (valuesUpdated_ && valuesVersion_ == version)
+      return;
+    for (const unsigned int index : connectionStateVariables_) {
+      const StateVariable& var = stateVariables_[index];
+      if (var.valueAffected() && var.getValue<int>() != static_cast<int>(modelDyn_->getVariableValue(var.getVariable())))
+        connectionStateChanged_ = true;
+    }
+    for (auto& var : stateVariables_)
+      var.setValue(modelDyn_->getVariableValue(var.getVariable()));
+    valuesUpdated_ = true;
+    valuesVersion_ = version;
   }
+  criteriaValuesUpdated_ = true;
+  criteriaValuesVersion_ = version;
+}
+
+bool
+ComponentInterface::hasCriteriaStateVariables() const {
+  return !criteriaStateVariables_.empty();
 }
 
 void
 ComponentInterface::exportStateVariables() {
+  // left out of the dynamic models: the values of the network file are kept
+  if (!modelDyn_)
+    return;
   try {
     exportStateVariablesUnitComponent();
   } catch (const DYN::Error& e) {
@@ -106,7 +153,13 @@ ComponentInterface::exportStateVariables() {
 
 void
 ComponentInterface::getStateVariableReference() {
-  assert(modelDyn_);
+  criteriaStateVariables_.clear();
+  connectionStateVariables_.clear();
+  valuesUpdated_ = false;
+  criteriaValuesUpdated_ = false;
+  // left out of the dynamic models
+  if (!modelDyn_)
+    return;
   for (unsigned int i=0; i< stateVariables_.size(); ++i) {
     try {
       if (hasDynamicModel_)
@@ -116,9 +169,29 @@ ComponentInterface::getStateVariableReference() {
     } catch (const DYN::Error &) {
       throw DYNError(Error::MODELER, StateVariableNoReference, stateVariables_[i].getName(), getID());
     }
+    if (stateVariables_[i].isNeededForCriteriaCheck())
+      criteriaStateVariables_.push_back(i);
+    if (isConnectionStateVariable(stateVariables_[i]))
+      connectionStateVariables_.push_back(i);
   }
 }
 
+const StaticParameter&
+ComponentInterface::findStaticParameter(const string& name) const {
+  const auto iter = staticParameters_.find(name);
+  if (iter == staticParameters_.end())
+    throw DYNError(Error::MODELER, UnknownStaticParameter, name, getID());
+  if (!iter->second.valueAffected())
+    throw DYNError(Error::MODELER, UnaffectedStaticParameter, name, getID());
+  return iter->second;
+}
+
+bool
+ComponentInterface::isConnectionStateVariable(const StateVariable& stateVariable) {
+  // connection states are the integer state variables named state, state1, state2...
+  return stateVariable.getType() == StateVariable::INT && stateVariable.getName().compare(0, 5, "state") == 0;
+}
+
 bool
 ComponentInterface::isConnected() const {
   return false;  // default connection state
@@ -166,6 +239,16 @@ ComponentInterface::getTypeAsString() const {
   return stringTypes[type];
 }
 
+size_t
+ComponentInterface::getMemoryUsage() const {
+  size_t memoryUsage = MemoryUsage::bytes(stateVariables_) + MemoryUsage::bytes(criteriaStateVariables_)
+      + MemoryUsage::bytes(connectionStateVariables_) + MemoryUsage::bytes(staticParameters_);
+  for (const auto& stateVariable : stateVariables_)
+    memoryUsage += MemoryUsage::bytes(stateVariable.getName()) + MemoryUsage::bytes(stateVariable.getModelId())
+        + MemoryUsage::bytes(stateVariable.getVariableId());
+  return memoryUsage;
+}
+
 #ifdef _DEBUG_
 void
 ComponentInterface::enableCheckStateVariable() {
@@ -180,6 +263,8 @@ void ComponentInterface::setValue(const int index, const double value) {
   if (!stateVariables_[index].valueAffected()) {
     throw DYNError(Error::MODELER, UnaffectedStateVariable, stateVariables_[index].getName(), getID());
   } else {
+    if (isConnectionStateVariable(stateVariables_[index]) && stateVariables_[index].getValue<int>() != static_cast<int>(value))
+      connectionStateChanged_ = true;
     stateVariables_[index].setValue(value);
   }
 }
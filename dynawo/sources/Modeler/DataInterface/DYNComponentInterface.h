@@ -89,6 +89,15 @@ class ComponentInterface {
    */
   void setModelDyn(const boost::shared_ptr<SubModel>& model);
 
+  /**
+   * @brief check whether a model variable was declared as reference of a state variable
+   *
+   * A component left out of the network model, without dynamic model, has no reference: it keeps the values of the network file.
+   *
+   * @return @b true if at least one state variable has a reference, @b false else
+   */
+  bool hasReferences() const;
+
   /**
    * @brief associate a component variable with a model variable
    * @param componentVar component variable name
@@ -105,12 +114,46 @@ class ComponentInterface {
 
   /**
    * @brief update state variables with data from model (c++ or dynamic model)
+   *
+   * Nothing is done if the model was not evaluated since the previous update
+   *
    * @param filterForCriteriaCheck true if we only want to update the parameters used in criteria check
    */
   void updateFromModel(bool filterForCriteriaCheck);
 
+  /**
+   * @brief check whether some state variables are needed for criteria check
+   * @return @b true if at least one state variable is needed for criteria check, @b false else
+   */
+  bool hasCriteriaStateVariables() const;
+
+  /**
+   * @brief check whether a connection state variable changed since the last call to resetConnectionStateChanged
+   * @return @b true if the value of a connection state variable changed, @b false else
+   */
+  bool hasConnectionStateChanged() const {
+    return connectionStateChanged_;
+  }
+
+  /**
+   * @brief forget the connection state changes observed so far
+   */
+  void resetConnectionStateChanged() {
+    connectionStateChanged_ = false;
+  }
+
+  /**
+   * @brief get the memory allocated by the state variables and the static parameters of the component
+   *
+   * @return number of bytes allocated, the interface object itself excluded
+   */
+  size_t getMemoryUsage() const;
+
   /**
    * @brief get state variable reference in dynamic model
+   *
+   * The indexes of the state variables needed for criteria check are resolved here
+   * so that the criteria step only updates those ones
    */
   void getStateVariableReference();
 
@@ -216,6 +259,24 @@ class ComponentInterface {
    */
   template<typename T> T getStaticParameterValue(const std::string& name) const;
 
+  /**
+   * @brief find a static parameter whose value is affected thanks to its name
+   *
+   * @param name name of the static parameter
+   *
+   * @return the static parameter
+   */
+  const StaticParameter& findStaticParameter(const std::string& name) const;
+
+  /**
+   * @brief retrieve the value of a static parameter, converted to the requested type
+   *
+   * @param staticParameter static parameter found with findStaticParameter
+   *
+   * @return the value of the static parameter
+   */
+  template<typename T> static T getStaticParameterValue(const StaticParameter& staticParameter);
+
  protected:
   /**
    * @brief retrieve a state variable value thanks to its name
@@ -232,8 +293,17 @@ class ComponentInterface {
    */
   void hasInitialConditions(bool hasInitialConditions);
 
+  /**
+   * @brief check whether a state variable describes the connection state of the component
+   * @param stateVariable state variable to check
+   * @return @b true if the state variable is a connection state
+   */
+  static bool isConnectionStateVariable(const StateVariable& stateVariable);
+
  protected:
   std::vector<StateVariable> stateVariables_;  ///< state variable
+  std::vector<unsigned int> criteriaStateVariables_;  ///< indexes of the state variables needed for criteria check
+  std::vector<unsigned int> connectionStateVariables_;  ///< indexes of the connection state variables
   std::unordered_map<std::string, StaticParameter> staticParameters_;  ///< static parameter by name, from iidm data
   ComponentType_t type_;  ///< type of the interface
 
@@ -241,6 +311,11 @@ class ComponentInterface {
   bool hasDynamicModel_;  ///< @b true if component has a dynamic model (other than c++ one), @b false else
   boost::shared_ptr<SubModel> modelDyn_;  ///< dynamic model of the component
   bool hasInitialConditions_;  ///< @b true if component has initial conditions set, @b false else
+  bool valuesUpdated_;  ///< @b true if all the state variables were updated from the model at least once
+  unsigned long valuesVersion_;  ///< version of the model values used for the last update of all the state variables
+  bool criteriaValuesUpdated_;  ///< @b true if the state variables needed for criteria check were updated from the model at least once
+  unsigned long criteriaValuesVersion_;  ///< version of the model values used for the last update of the state variables needed for criteria check
+  bool connectionStateChanged_;  ///< @b true if the value of a connection state variable changed since the last reset
 #ifdef _DEBUG_
   bool checkStateVariableAreUpdatedBeforeCriteriaCheck_;  ///< true if we want to check that all state variable used in check criteria are properly updated
 #endif
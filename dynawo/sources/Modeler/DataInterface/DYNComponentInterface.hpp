@@ -31,31 +31,21 @@ namespace DYN {
 
 template <typename T>
 T ComponentInterface::getStaticParameterValue(const std::string& name) const {
-  std::unordered_map<std::string, StaticParameter>::const_iterator iter = staticParameters_.find(name);
-  if (iter != staticParameters_.end()) {
-    StaticParameter::StaticParameterType type = iter->second.getType();
-    if (!iter->second.valueAffected()) {
-      throw DYNError(Error::MODELER, UnaffectedStaticParameter, name, getID());
-    } else {
-      switch (type) {
-        case StaticParameter::INT:
-          return static_cast<T>(iter->second.getValue<int>());
-          break;
-        case StaticParameter::DOUBLE:
-          return static_cast<T>(iter->second.getValue<double>());
-          break;
-        case StaticParameter::BOOL:
-          return static_cast<T>(iter->second.getValue<bool>());
-          break;
-        default:
-          throw DYNError(Error::MODELER, StaticParameterWrongType, name);
-      }
-    }
-  } else {
-    throw DYNError(Error::MODELER, UnknownStaticParameter, name, getID());
-  }
+  return getStaticParameterValue<T>(findStaticParameter(name));
+}
 
-  return T();
+template <typename T>
+T ComponentInterface::getStaticParameterValue(const StaticParameter& staticParameter) {
+  switch (staticParameter.getType()) {
+    case StaticParameter::INT:
+      return static_cast<T>(staticParameter.getValue<int>());
+    case StaticParameter::DOUBLE:
+      return static_cast<T>(staticParameter.getValue<double>());
+    case StaticParameter::BOOL:
+      return static_cast<T>(staticParameter.getValue<bool>());
+    default:
+      throw DYNError(Error::MODELER, StaticParameterWrongType, staticParameter.getName());
+  }
 }
 
 template <typename T>
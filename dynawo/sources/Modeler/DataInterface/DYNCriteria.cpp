@@ -20,6 +20,8 @@
 
 #include "make_unique.hpp"
 
+#include <limits>
+
 namespace DYN {
 
 Criteria::Criteria(const std::shared_ptr<criteria::CriteriaParams>& params) :
@@ -66,9 +68,18 @@ BusCriteria::checkCriteria(double t, bool finalStep, const boost::shared_ptr<tim
   assert(params_->getType() != criteria::CriteriaParams::SUM);
   if (!finalStep && params_->getScope() == criteria::CriteriaParams::FINAL)
     return true;
+  // snapshot of the voltages, checked against the bounds computed when adding the buses
+  const std::size_t nbBuses = buses_.size();
+  for (std::size_t i = 0; i < nbBuses; ++i)
+    voltages_[i] = buses_[i]->getStateVarV();
+  if (!isAnyBoundCrossed())
+    return true;
+
+  // the failing criteria are only built if at least one bound is crossed
   std::multimap<double, std::unique_ptr<FailingCriteria> > distanceToBusFailingCriteriaMap;
-  for (const auto& bus : buses_) {
-    double v = bus->getStateVarV();
+  for (std::size_t i = 0; i < nbBuses; ++i) {
+    const std::shared_ptr<BusInterface>& bus = buses_[i];
+    double v = voltages_[i];
     if (doubleIsZero(v)) continue;
     assert(params_->hasVoltageLevels());
     assert(params_->getVoltageLevels().size() == 1);
@@ -132,6 +143,26 @@ BusCriteria::addBus(const std::shared_ptr<BusInterface>& bus) {
       bus->getVNom() > vl.getUNomMax()) return;
   if (doubleIsZero(bus->getV0())) return;
   buses_.push_back(bus);
+  voltages_.push_back(0.);
+  const double vNom = bus->getVNom();
+  vMax_.push_back(vl.hasUMaxPu() ? vl.getUMaxPu()*vNom : std::numeric_limits<double>::infinity());
+  vMin_.push_back(vl.hasUMinPu() ? vl.getUMinPu()*vNom : -std::numeric_limits<double>::infinity());
+}
+
+bool
+BusCriteria::isAnyBoundCrossed() const {
+  // branchless loop over contiguous arrays so that it can be vectorized
+  const double zeroThreshold = getCurrentPrecision() / 5.;
+  const std::size_t nbBuses = voltages_.size();
+  const double* voltages = voltages_.data();
+  const double* vMax = vMax_.data();
+  const double* vMin = vMin_.data();
+  bool crossed = false;
+  for (std::size_t i = 0; i < nbBuses; ++i) {
+    const double v = voltages[i];
+    crossed |= (std::fabs(v) > zeroThreshold) & ((v > vMax[i]) | (v < vMin[i]));
+  }
+  return crossed;
 }
 
 BusCriteria::BusFailingCriteria::BusFailingCriteria(Bound bound,
@@ -196,16 +227,22 @@ LoadCriteria::checkCriteria(double t, bool finalStep, const boost::shared_ptr<ti
   failingCriteria_.clear();
   if (!finalStep && params_->getScope() == criteria::CriteriaParams::FINAL)
     return true;
+  // snapshot of the active powers, the failing criteria are only built if at least one bound is crossed
+  const std::size_t nbLoads = loads_.size();
+  for (std::size_t i = 0; i < nbLoads; ++i)
+    activePowers_[i] = loads_[i]->getStateVarP() * SNREF;
+  if (params_->getType() == criteria::CriteriaParams::LOCAL_VALUE && !isAnyBoundCrossed())
+    return true;
+
   double sum = 0.;
   std::multimap<double, std::shared_ptr<LoadInterface> > loadToSourcesAddedIntoSumMap;
   bool atLeastOneEligibleLoadWasFound = false;
   std::unordered_set<std::string> alreadyChecked;
   bool isCriteriaOk = true;
   std::multimap<double, std::unique_ptr<FailingCriteria> > distanceToLoadFailingCriteriaMap;
-  for (std::vector<std::shared_ptr<LoadInterface> >::const_iterator loadIt = loads_.begin(), loadItEnd = loads_.end();
-      loadIt != loadItEnd; ++loadIt) {
-    std::shared_ptr<DYN::LoadInterface> load = *loadIt;
-    double p = load->getStateVarP() * SNREF;
+  for (std::size_t i = 0; i < nbLoads; ++i) {
+    const std::shared_ptr<DYN::LoadInterface>& load = loads_[i];
+    double p = activePowers_[i];
     if (!params_->getVoltageLevels().empty()) {
       if (alreadyChecked.find(load->getID()) != alreadyChecked.end()) continue;
       for (const auto& vl : params_->getVoltageLevels()) {
@@ -373,6 +410,7 @@ LoadCriteria::addLoad(const std::shared_ptr<LoadInterface>& load) {
         (doubleIsZero(load->getBusInterface()->getV0()))) return;
   if (params_->getVoltageLevels().empty()) {
     loads_.push_back(load);
+    activePowers_.push_back(0.);
   } else {
     for (const auto& vl : params_->getVoltageLevels()) {
       if (vl.hasUNomMin() &&
@@ -382,11 +420,27 @@ LoadCriteria::addLoad(const std::shared_ptr<LoadInterface>& load) {
           load->getBusInterface() &&
           load->getBusInterface()->getVNom() > vl.getUNomMax()) continue;
       loads_.push_back(load);
+      activePowers_.push_back(0.);
       break;
     }
   }
 }
 
+bool
+LoadCriteria::isAnyBoundCrossed() const {
+  // branchless loop over a contiguous array so that it can be vectorized
+  const double pMax = params_->hasPMax() ? params_->getPMax() : std::numeric_limits<double>::infinity();
+  const double pMin = params_->hasPMin() ? params_->getPMin() : -std::numeric_limits<double>::infinity();
+  const std::size_t nbLoads = activePowers_.size();
+  const double* activePowers = activePowers_.data();
+  bool crossed = false;
+  for (std::size_t i = 0; i < nbLoads; ++i) {
+    const double p = activePowers[i];
+    crossed |= (p > pMax) | (p < pMin);
+  }
+  return crossed;
+}
+
 LoadCriteria::LoadFailingCriteria::LoadFailingCriteria(Bound bound,
                                                         std::string loadId,
                                                         double p,
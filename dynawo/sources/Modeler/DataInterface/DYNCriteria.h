@@ -219,7 +219,16 @@ class BusCriteria : public Criteria {
   };
 
  private:
+  /**
+   * @brief check whether the voltage of a connected bus crosses one of its bounds
+   * @return true if at least one bound is crossed
+   */
+  bool isAnyBoundCrossed() const;
+
   std::vector<std::shared_ptr<BusInterface> > buses_;  ///< buses of this criteria
+  std::vector<double> voltages_;  ///< voltages of the buses in kV, snapshot of the last check
+  std::vector<double> vMax_;  ///< upper voltage bound of the buses in kV
+  std::vector<double> vMin_;  ///< lower voltage bound of the buses in kV
 };
 
 
@@ -330,7 +339,14 @@ class LoadCriteria : public Criteria {
                                           double& sum,
                                           bool& atLeastOneEligibleLoadWasFound);
 
+  /**
+   * @brief check whether the active power of a load crosses one of the bounds
+   * @return true if at least one bound is crossed
+   */
+  bool isAnyBoundCrossed() const;
+
   std::vector<std::shared_ptr<LoadInterface> > loads_;  ///< loads of this criteria
+  std::vector<double> activePowers_;  ///< active powers of the loads in MW, snapshot of the last check
 };
 
 
@@ -32,6 +32,7 @@
 namespace DYN {
 class NetworkInterface;
 class SubModel;
+class StaticParameter;
 
 #ifdef __clang__
 #pragma clang diagnostic push
@@ -179,6 +180,36 @@ class DataInterface {
    */
   virtual bool getStaticParameterBoolValue(const std::string& staticID, const std::string& refOrigName) = 0;
 
+  /**
+   * @brief find several static parameters of the same static model, the static model being found only once
+   * @param staticID id of static model
+   * @param refOrigNames parameters of static model
+   * @param staticParameters static parameters found, in the same order as refOrigNames
+   */
+  virtual void findStaticParameters(const std::string& staticID, const std::vector<std::string>& refOrigNames,
+                                    std::vector<const StaticParameter*>& staticParameters) = 0;
+
+  /**
+   * @brief get static parameter value without any lookup
+   * @param staticParameter static parameter found with findStaticParameters
+   * @return value
+   */
+  virtual double getStaticParameterDoubleValue(const StaticParameter& staticParameter) const = 0;
+
+  /**
+   * @brief get static parameter value without any lookup
+   * @param staticParameter static parameter found with findStaticParameters
+   * @return value
+   */
+  virtual int getStaticParameterIntValue(const StaticParameter& staticParameter) const = 0;
+
+  /**
+   * @brief get static parameter value without any lookup
+   * @param staticParameter static parameter found with findStaticParameters
+   * @return value
+   */
+  virtual bool getStaticParameterBoolValue(const StaticParameter& staticParameter) const = 0;
+
   /**
    * @brief get the name of the bus where a component is connected
    * @param staticID id of the component
@@ -227,6 +258,75 @@ class DataInterface {
    * @param timeline timeline output
    */
   virtual void setTimeline(const boost::shared_ptr<timeline::Timeline>& timeline) = 0;
+
+  /**
+   * @brief set the voltage levels whose passive part is replaced by an equivalent in the network model
+   * @param reducedVoltageLevels id of the reduced voltage levels
+   */
+  virtual void setReducedVoltageLevels(const std::vector<std::string>& reducedVoltageLevels) = 0;
+
+  /**
+   * @brief get the voltage levels whose passive part is replaced by an equivalent in the network model
+   * @return id of the reduced voltage levels
+   */
+  virtual const std::vector<std::string>& getReducedVoltageLevels() const = 0;
+
+  /**
+   * @brief set the voltage levels whose closed switches are removed from the network model, the buses they join being merged
+   * @param collapsedVoltageLevels id of the collapsed voltage levels
+   */
+  virtual void setCollapsedVoltageLevels(const std::vector<std::string>& collapsedVoltageLevels) = 0;
+
+  /**
+   * @brief get the voltage levels whose closed switches are removed from the network model, the buses they join being merged
+   * @return id of the collapsed voltage levels
+   */
+  virtual const std::vector<std::string>& getCollapsedVoltageLevels() const = 0;
+
+  /**
+   * @brief set whether the star buses of the static three windings transformers are eliminated from the network model
+   * @param eliminateStarBuses @b true to replace each static three windings transformer by an equivalent between its three buses
+   */
+  virtual void setEliminateStarBuses(bool eliminateStarBuses) = 0;
+
+  /**
+   * @brief get whether the star buses of the static three windings transformers are eliminated from the network model
+   * @return @b true if each static three windings transformer is replaced by an equivalent between its three buses
+   */
+  virtual bool getEliminateStarBuses() const = 0;
+
+  /**
+   * @brief set the voltage levels around which the network model is built, the rest of the network being left out
+   * @param studyVoltageLevels id of the study voltage levels, empty to model the whole network
+   */
+  virtual void setStudyVoltageLevels(const std::vector<std::string>& studyVoltageLevels) = 0;
+
+  /**
+   * @brief get the voltage levels around which the network model is built, the rest of the network being left out
+   * @return id of the study voltage levels, empty to model the whole network
+   */
+  virtual const std::vector<std::string>& getStudyVoltageLevels() const = 0;
+
+  /**
+   * @brief set the number of branches between the study voltage levels and the farthest voltage levels in the network model
+   * @param studyAreaDepth number of branches, 0 to model the study voltage levels only
+   */
+  virtual void setStudyAreaDepth(int studyAreaDepth) = 0;
+
+  /**
+   * @brief get the number of branches between the study voltage levels and the farthest voltage levels in the network model
+   * @return number of branches, 0 to model the study voltage levels only
+   */
+  virtual int getStudyAreaDepth() const = 0;
+
+  /**
+   * @brief get the memory allocated by the components of the data interface
+   *
+   * The memory of the underlying network data (e.g. the IIDM network) is not accounted.
+   *
+   * @return number of bytes allocated by the component interfaces and their indexes
+   */
+  virtual size_t getMemoryUsage() const = 0;
 };  ///< Class for data interface
 
 #ifdef __clang__
@@ -26,8 +26,38 @@ using std::string;
 using boost::shared_ptr;
 
 namespace DYN {
+std::mutex DataInterfaceFactory::preloadedMutex_;
+
+std::map<std::pair<DataInterfaceFactory::dataInterfaceType_t, string>, shared_ptr<DataInterface> >&
+DataInterfaceFactory::getPreloaded() {
+  static std::map<std::pair<dataInterfaceType_t, string>, shared_ptr<DataInterface> > preloaded;
+  return preloaded;
+}
+
+void
+DataInterfaceFactory::preload(dataInterfaceType_t type, const string& filepath) {
+  shared_ptr<DataInterface> data = build(type, filepath);
+  std::lock_guard<std::mutex> lock(preloadedMutex_);
+  getPreloaded()[std::make_pair(type, filepath)] = data;
+}
+
+void
+DataInterfaceFactory::clearPreloaded() {
+  std::lock_guard<std::mutex> lock(preloadedMutex_);
+  getPreloaded().clear();
+}
+
 shared_ptr<DataInterface>
 DataInterfaceFactory::build(dataInterfaceType_t type, const string& filepath, unsigned int nbVariants) {
+  if (nbVariants <= 1) {
+    std::lock_guard<std::mutex> lock(preloadedMutex_);
+    auto it = getPreloaded().find(std::make_pair(type, filepath));
+    if (it != getPreloaded().end()) {
+      shared_ptr<DataInterface> data = it->second;
+      getPreloaded().erase(it);
+      return data;
+    }
+  }
   switch (type) {
   case DATAINTERFACE_IIDM:
     return DataInterfaceIIDM::build(filepath, nbVariants);
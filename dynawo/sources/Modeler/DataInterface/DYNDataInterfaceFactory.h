@@ -16,6 +16,10 @@
 
 #include "DYNDataInterface.h"
 #include <boost/shared_ptr.hpp>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
 
 namespace DYN {
 
@@ -39,6 +43,33 @@ class DataInterfaceFactory {
    * @return The data interface built from the input file
    */
   static boost::shared_ptr<DataInterface> build(dataInterfaceType_t type, const std::string& filepath, unsigned int nbVariants = 1);
+
+  /**
+   * @brief Build an instance of a static network by reading a file and keep it for a later call to build
+   *
+   * The next call to build with the same file and a single variant returns this instance instead of reading the file again.
+   * The instance is returned only once as the simulation modifies it: a process preloads the files before forking
+   * so that each child process gets its own copy of the instance.
+   *
+   * @param type format of the file
+   * @param filepath input file path
+   */
+  static void preload(dataInterfaceType_t type, const std::string& filepath);
+
+  /**
+   * @brief Release the instances preloaded and not used yet
+   */
+  static void clearPreloaded();
+
+ private:
+  /**
+   * @brief Get the instances preloaded and not used yet
+   * @return the preloaded instances by format and file path
+   */
+  static std::map<std::pair<dataInterfaceType_t, std::string>, boost::shared_ptr<DataInterface> >& getPreloaded();
+
+ private:
+  static std::mutex preloadedMutex_;  ///< mutex to access the preloaded instances
 };
 }  // namespace DYN
 
@@ -32,6 +32,10 @@ using std::vector;
 
 namespace DYN {
 
+DataInterfaceImpl::DataInterfaceImpl() :
+eliminateStarBuses_(false),
+studyAreaDepth_(0) { }
+
 template <class ComponentType>
 static inline
 bool componentsHasDynamicModel(const vector<std::shared_ptr<ComponentType> >& components) {
@@ -82,4 +86,54 @@ DataInterfaceImpl::instantiateNetwork() const {
   return false;
 }
 
+void
+DataInterfaceImpl::setReducedVoltageLevels(const vector<std::string>& reducedVoltageLevels) {
+  reducedVoltageLevels_ = reducedVoltageLevels;
+}
+
+const vector<std::string>&
+DataInterfaceImpl::getReducedVoltageLevels() const {
+  return reducedVoltageLevels_;
+}
+
+void
+DataInterfaceImpl::setCollapsedVoltageLevels(const vector<std::string>& collapsedVoltageLevels) {
+  collapsedVoltageLevels_ = collapsedVoltageLevels;
+}
+
+const vector<std::string>&
+DataInterfaceImpl::getCollapsedVoltageLevels() const {
+  return collapsedVoltageLevels_;
+}
+
+void
+DataInterfaceImpl::setEliminateStarBuses(const bool eliminateStarBuses) {
+  eliminateStarBuses_ = eliminateStarBuses;
+}
+
+bool
+DataInterfaceImpl::getEliminateStarBuses() const {
+  return eliminateStarBuses_;
+}
+
+void
+DataInterfaceImpl::setStudyVoltageLevels(const vector<std::string>& studyVoltageLevels) {
+  studyVoltageLevels_ = studyVoltageLevels;
+}
+
+const vector<std::string>&
+DataInterfaceImpl::getStudyVoltageLevels() const {
+  return studyVoltageLevels_;
+}
+
+void
+DataInterfaceImpl::setStudyAreaDepth(const int studyAreaDepth) {
+  studyAreaDepth_ = studyAreaDepth;
+}
+
+int
+DataInterfaceImpl::getStudyAreaDepth() const {
+  return studyAreaDepth_;
+}
+
 }  // namespace DYN
@@ -20,6 +20,9 @@
 #ifndef MODELER_DATAINTERFACE_DYNDATAINTERFACEIMPL_H_
 #define MODELER_DATAINTERFACE_DYNDATAINTERFACEIMPL_H_
 
+#include <string>
+#include <vector>
+
 #include "DYNDataInterface.h"
 
 namespace DYN {
@@ -29,6 +32,11 @@ namespace DYN {
  */
 class DataInterfaceImpl : public DataInterface {
  public:
+  /**
+   * @brief constructor
+   */
+  DataInterfaceImpl();
+
   /**
   * @brief test if some network components does not have a dynamic model
   *
@@ -37,6 +45,63 @@ class DataInterfaceImpl : public DataInterface {
   * @return do we need to instantiate the network
   */
   bool instantiateNetwork() const override;
+
+  /**
+   * @copydoc DataInterface::setReducedVoltageLevels(const std::vector<std::string>& reducedVoltageLevels)
+   */
+  void setReducedVoltageLevels(const std::vector<std::string>& reducedVoltageLevels) override;
+
+  /**
+   * @copydoc DataInterface::getReducedVoltageLevels() const
+   */
+  const std::vector<std::string>& getReducedVoltageLevels() const override;
+
+  /**
+   * @copydoc DataInterface::setCollapsedVoltageLevels(const std::vector<std::string>& collapsedVoltageLevels)
+   */
+  void setCollapsedVoltageLevels(const std::vector<std::string>& collapsedVoltageLevels) override;
+
+  /**
+   * @copydoc DataInterface::getCollapsedVoltageLevels() const
+   */
+  const std::vector<std::string>& getCollapsedVoltageLevels() const override;
+
+  /**
+   * @copydoc DataInterface::setEliminateStarBuses(bool eliminateStarBuses)
+   */
+  void setEliminateStarBuses(bool eliminateStarBuses) override;
+
+  /**
+   * @copydoc DataInterface::getEliminateStarBuses() const
+   */
+  bool getEliminateStarBuses() const override;
+
+  /**
+   * @copydoc DataInterface::setStudyVoltageLevels(const std::vector<std::string>& studyVoltageLevels)
+   */
+  void setStudyVoltageLevels(const std::vector<std::string>& studyVoltageLevels) override;
+
+  /**
+   * @copydoc DataInterface::getStudyVoltageLevels() const
+   */
+  const std::vector<std::string>& getStudyVoltageLevels() const override;
+
+  /**
+   * @copydoc DataInterface::setStudyAreaDepth(int studyAreaDepth)
+   */
+  void setStudyAreaDepth(int studyAreaDepth) override;
+
+  /**
+   * @copydoc DataInterface::getStudyAreaDepth() const
+   */
+  int getStudyAreaDepth() const override;
+
+ private:
+  std::vector<std::string> reducedVoltageLevels_;  ///< voltage levels whose passive part is replaced by an equivalent
+  std::vector<std::string> collapsedVoltageLevels_;  ///< voltage levels whose closed switches are removed, the buses they join being merged
+  bool eliminateStarBuses_;  ///< whether the star buses of the static three windings transformers are eliminated
+  std::vector<std::string> studyVoltageLevels_;  ///< voltage levels around which the network model is built, empty for the whole network
+  int studyAreaDepth_;  ///< number of branches between the study voltage levels and the farthest voltage levels modelled
 };
 
 }  // namespace DYN
@@ -31,12 +31,18 @@ using std::string;
 namespace DYN {
 StateVariable::StateVariable() :
 type_(StateVariable::DOUBLE),  // most used type
+doubleValue_(0.),
+intValue_(0),
+boolValue_(false),
 valueAffected_(false),
 neededForCriteriaCheck_(false) {
 }
 
 StateVariable::StateVariable(const string& name, const StateVariableType& type, bool neededForCriteriaCheck) :
 type_(type),
+doubleValue_(0.),
+intValue_(0),
+boolValue_(false),
 name_(name),
 valueAffected_(false),
 neededForCriteriaCheck_(neededForCriteriaCheck) {
@@ -112,7 +118,7 @@ StateVariable::setVariable(const boost::shared_ptr<Variable>& variable) {
 #endif
 }
 
-boost::shared_ptr<Variable>
+const boost::shared_ptr<Variable>&
 StateVariable::getVariable() const {
   return variable_;
 }
@@ -144,10 +150,10 @@ StateVariable::setValue(const double& value) {
     if (!doubleEquals(value, 0.) && !doubleEquals(value, 1.) && !doubleEquals(value, -1.))
       throw DYNError(Error::MODELER, StateVariableWrongType, name_, typeAsString(type_), "bool");
 #endif
-    value_ = (value > 0);
+    boolValue_ = (value > 0);
     break;
   case DOUBLE :
-    value_ = value;
+    doubleValue_ = value;
     break;
   case INT :
 #ifdef _DEBUG_
@@ -155,7 +161,7 @@ StateVariable::setValue(const double& value) {
       throw DYNError(Error::MODELER, StateVariableWrongType, name_, typeAsString(type_), "double");
     }
 #endif
-    value_ = static_cast<int> (value);
+    intValue_ = static_cast<int> (value);
     break;
   }
   valueAffected_ = true;
@@ -21,8 +21,6 @@
 #define MODELER_DATAINTERFACE_DYNSTATEVARIABLE_H_
 
 #include <string>
-#include <boost/any.hpp>
-#include <boost/optional.hpp>
 #include <boost/shared_ptr.hpp>
 
 namespace DYN {
@@ -105,7 +103,7 @@ class StateVariable {
    * @brief get the variable that store the value of the stateVariable
    * @return variable storing the value of the stateVariable
    */
-  boost::shared_ptr<Variable> getVariable() const;
+  const boost::shared_ptr<Variable>& getVariable() const;
 
   /**
    * @brief get the value of a variable
@@ -140,7 +138,9 @@ class StateVariable {
 
  private:
   StateVariableType type_;  ///< type of the state variable
-  boost::optional<boost::any> value_;  ///< value of the state variable
+  double doubleValue_;  ///< value of the state variable if it is a double one
+  int intValue_;  ///< value of the state variable if it is an integer one
+  bool boolValue_;  ///< value of the state variable if it is a boolean one
   std::string name_;  ///< name of the state variable
   std::string modelId_;  ///< id of the model associated to the state variable
   std::string variableId_;  ///< id of the variable associated to the state variable
@@ -25,14 +25,28 @@ namespace DYN {
 
 template<typename T>
 T StateVariable::getValue() const {
-  T value;
-  try {
-    value = boost::any_cast<T>(*value_);
-  }
-  catch (boost::bad_any_cast&)  {
+  throw DYNError(Error::MODELER, StateVariableBadCast, name_, typeAsString(type_));
+}
+
+template<>
+inline double StateVariable::getValue<double>() const {
+  if (type_ != DOUBLE)
+    throw DYNError(Error::MODELER, StateVariableBadCast, name_, typeAsString(type_));
+  return doubleValue_;
+}
+
+template<>
+inline int StateVariable::getValue<int>() const {
+  if (type_ != INT)
+    throw DYNError(Error::MODELER, StateVariableBadCast, name_, typeAsString(type_));
+  return intValue_;
+}
+
+template<>
+inline bool StateVariable::getValue<bool>() const {
+  if (type_ != BOOL)
     throw DYNError(Error::MODELER, StateVariableBadCast, name_, typeAsString(type_));
-  }
-  return value;
+  return boolValue_;
 }
 
 }  // namespace DYN
@@ -93,6 +93,13 @@ BusInterfaceIIDM::getAngle0() const {
   return angle0_.value();
 }
 
+void
+BusInterfaceIIDM::setInitialVoltage(const double v0, const double angle0) {
+  hasInitialConditions(true);
+  U0_ = v0;
+  angle0_ = angle0;
+}
+
 double
 BusInterfaceIIDM::getVNom() const {
   return busIIDM_.getVoltageLevel().getNominalV();
@@ -111,6 +111,12 @@ CalculatedBusInterfaceIIDM::getAngle0() const {
   }
 }
 
+void
+CalculatedBusInterfaceIIDM::setInitialVoltage(const double v0, const double angle0) {
+  setU0(v0);
+  setAngle0(angle0);
+}
+
 double
 CalculatedBusInterfaceIIDM::getVNom() const {
   return voltageLevel_.getNominalV();
@@ -41,9 +41,11 @@
 #include "DYNVscConverterInterfaceIIDM.h"
 #include "DYNLccConverterInterfaceIIDM.h"
 #include "DYNMacrosMessage.h"
+#include "DYNMemoryUsage.h"
 #include "DYNSubModel.h"
 #include "DYNTimer.h"
 #include "DYNExecUtils.h"
+#include "DYNThreadPool.h"
 #include "DYNTrace.h"
 #include "DYNErrorQueue.h"
 #include "DYNCriteria.h"
@@ -63,6 +65,8 @@
 #include <powsybl/iidm/ExtensionProviders.hpp>
 #include <powsybl/iidm/converter/xml/ExtensionXmlSerializer.hpp>
 
+#include <algorithm>
+#include <cstdlib>
 #include <regex>
 #include <unordered_set>
 
@@ -86,7 +90,9 @@ std::mutex DataInterfaceIIDM::loadExtensionMutex_;
 
 DataInterfaceIIDM::DataInterfaceIIDM(const boost::shared_ptr<powsybl::iidm::Network>& networkIIDM) :
 networkIIDM_(networkIIDM),
-serviceManager_(boost::make_shared<ServiceManagerInterfaceIIDM>(this)) {
+hasNodeBreakerTopology_(false),
+serviceManager_(boost::make_shared<ServiceManagerInterfaceIIDM>(this)),
+initFromIIDMDeferred_(false) {
 }
 
 void
@@ -185,6 +191,7 @@ DataInterfaceIIDM::getNetworkIIDM() const {
 
 std::string
 DataInterfaceIIDM::getBusName(const std::string& componentName, const std::string& labelNode) {
+  initFromIIDMIfDeferred();
   std::unordered_map<string, std::shared_ptr<ComponentInterface> >::const_iterator iter = components_.find(componentName);
   string busName = "";
   if (iter != components_.end()) {
@@ -285,15 +292,52 @@ DataInterfaceIIDM::getBusName(const std::string& componentName, const std::strin
 
 void
 DataInterfaceIIDM::initFromIIDM() {
+  initFromIIDMDeferred_ = false;
+
   // create network interface
   network_.reset(new NetworkInterfaceIIDM(*networkIIDM_));
 
+  vector<std::pair<powsybl::iidm::VoltageLevel*, stdcxx::optional<powsybl::iidm::Country> > > voltageLevelsIIDM;
   for (auto& substation : networkIIDM_->getSubstations()) {
-    for (auto& voltageLevel : substation.getVoltageLevels()) {
-      std::shared_ptr<VoltageLevelInterfaceIIDM> vl = importVoltageLevel(voltageLevel, substation.getCountry());
-      network_->addVoltageLevel(vl);
-      voltageLevels_[vl->getID()] = vl;
-    }
+    for (auto& voltageLevel : substation.getVoltageLevels())
+      voltageLevelsIIDM.emplace_back(&voltageLevel, substation.getCountry());
+  }
+
+  // the voltage level interfaces and their node breaker topologies only read their own iidm voltage level:
+  // they are built concurrently, the other components are then imported sequentially
+  vector<std::shared_ptr<VoltageLevelInterfaceIIDM> > voltageLevelInterfaces(voltageLevelsIIDM.size());
+  const auto buildVoltageLevelInterface = [&voltageLevelsIIDM, &voltageLevelInterfaces](unsigned int i) {
+    powsybl::iidm::VoltageLevel& voltageLevelIIDM = *voltageLevelsIIDM[i].first;
+    voltageLevelInterfaces[i] = std::make_shared<VoltageLevelInterfaceIIDM>(voltageLevelIIDM);
+    if (voltageLevelIIDM.getTopologyKind() == powsybl::iidm::TopologyKind::NODE_BREAKER)
+      voltageLevelInterfaces[i]->calculateBusTopology();
+  };
+  unsigned int nbThreads = 1;
+  if (hasEnvVar("DYNAWO_NB_NETWORK_IMPORT_THREADS"))
+    nbThreads = static_cast<unsigned int>(std::max(std::atoi(getEnvVar("DYNAWO_NB_NETWORK_IMPORT_THREADS").c_str()), 1));
+  nbThreads = std::min(nbThreads, static_cast<unsigned int>(voltageLevelsIIDM.size()));
+  if (nbThreads > 1) {
+    auto& variantManager = networkIIDM_->getVariantManager();
+    const bool variantPerThread = variantManager.isVariantMultiThreadAccessAllowed();
+    const std::string workingVariantId = variantPerThread ? variantManager.getWorkingVariantId() : std::string();
+    ThreadPool threadPool(nbThreads);
+    threadPool.parallelFor(static_cast<unsigned int>(voltageLevelsIIDM.size()),
+      [&buildVoltageLevelInterface, &variantManager, variantPerThread, &workingVariantId](unsigned int i) {
+        // with multi-thread access, the working variant is set per thread
+        if (variantPerThread)
+          variantManager.setWorkingVariant(workingVariantId);
+        buildVoltageLevelInterface(i);
+      });
+  } else {
+    for (unsigned int i = 0; i < voltageLevelsIIDM.size(); ++i)
+      buildVoltageLevelInterface(i);
+  }
+
+  for (unsigned int i = 0; i < voltageLevelsIIDM.size(); ++i) {
+    const std::shared_ptr<VoltageLevelInterfaceIIDM>& vl = voltageLevelInterfaces[i];
+    importVoltageLevel(vl, *voltageLevelsIIDM[i].first, voltageLevelsIIDM[i].second);
+    network_->addVoltageLevel(vl);
+    voltageLevels_[vl->getID()] = vl;
   }
 
   //===========================
@@ -332,16 +376,16 @@ DataInterfaceIIDM::initFromIIDM() {
   DYNErrorQueue::instance().flush();
 }
 
-std::shared_ptr<VoltageLevelInterfaceIIDM>
-DataInterfaceIIDM::importVoltageLevel(powsybl::iidm::VoltageLevel& voltageLevelIIDM, const stdcxx::optional<powsybl::iidm::Country>& country) {
-  std::shared_ptr<VoltageLevelInterfaceIIDM> voltageLevel = std::make_shared<VoltageLevelInterfaceIIDM>(voltageLevelIIDM);
+void
+DataInterfaceIIDM::importVoltageLevel(const std::shared_ptr<VoltageLevelInterfaceIIDM>& voltageLevel,
+    powsybl::iidm::VoltageLevel& voltageLevelIIDM, const stdcxx::optional<powsybl::iidm::Country>& country) {
   string countryStr;
   if (country)
     countryStr = powsybl::iidm::getCountryName(country.get());
   voltageLevel->setCountry(countryStr);
 
   if (voltageLevelIIDM.getTopologyKind() == powsybl::iidm::TopologyKind::NODE_BREAKER) {
-    voltageLevel->calculateBusTopology();
+    voltageLevel->printCalculatedBus();
 
     //===========================
     //  ADD BUS INTERFACE
@@ -483,8 +527,6 @@ DataInterfaceIIDM::importVoltageLevel(powsybl::iidm::VoltageLevel& voltageLevelI
     components_[svc->getID()] = svc;
     svc->setVoltageLevelInterface(voltageLevel);
   }
-
-  return voltageLevel;
 }
 
 std::unique_ptr<SwitchInterfaceIIDM>
@@ -690,8 +732,7 @@ DataInterfaceIIDM::convertThreeWindingsTransformers(powsybl::iidm::ThreeWindings
   const double VNom1 = threeWindingTransformer.getRatedU0();
   const double ratedU1 = threeWindingTransformer.getRatedU0();
 
-  auto libPath = IIDMExtensions::findLibraryPath();
-  auto activeSeasonExtensionDef = IIDMExtensions::getExtension<ActiveSeasonIIDMExtension>(libPath.generic_string());
+  auto activeSeasonExtensionDef = IIDMExtensions::getExtension<ActiveSeasonIIDMExtension>();
   auto activeSeasonExtension = std::get<IIDMExtensions::CREATE_FUNCTION>(activeSeasonExtensionDef)(threeWindingTransformer);
   auto destroyActiveSeasonExtension = std::get<IIDMExtensions::DESTROY_FUNCTION>(activeSeasonExtensionDef);
   const string activeSeason = activeSeasonExtension ? activeSeasonExtension->getValue() : std::string("UNDEFINED");
@@ -854,11 +895,13 @@ DataInterfaceIIDM::importHvdcLine(powsybl::iidm::HvdcLine& hvdcLineIIDM) const {
 
 shared_ptr<NetworkInterface>
 DataInterfaceIIDM::getNetwork() const {
+  initFromIIDMIfDeferred();
   return network_;
 }
 
 std::shared_ptr<BusInterface>
 DataInterfaceIIDM::findBusInterface(const powsybl::iidm::Terminal& terminal) const {
+  initFromIIDMIfDeferred();
   if (terminal.getVoltageLevel().getTopologyKind() == powsybl::iidm::TopologyKind::NODE_BREAKER) {
     return findNodeBreakerBusInterface(terminal.getVoltageLevel(), static_cast<int>(terminal.getNodeBreakerView().getNode()));
   } else {
@@ -921,6 +964,7 @@ DataInterfaceIIDM::findCalculatedBusInterface(const string& voltageLevelId, cons
 
 const std::shared_ptr<ComponentInterface>&
 DataInterfaceIIDM::findComponent(const std::string& id) const {
+  initFromIIDMIfDeferred();
   const auto iter = components_.find(id);
   if (iter != components_.end())
     return iter->second;
@@ -930,6 +974,7 @@ DataInterfaceIIDM::findComponent(const std::string& id) const {
 
 std::shared_ptr<ComponentInterface>&
 DataInterfaceIIDM::findComponent(const std::string& id) {
+  initFromIIDMIfDeferred();
   const auto iter = components_.find(id);
   if (iter != components_.end())
     return iter->second;
@@ -957,12 +1002,17 @@ DataInterfaceIIDM::setDynamicModel(const string& componentId, const shared_ptr<S
 
 void
 DataInterfaceIIDM::setModelNetwork(const shared_ptr<SubModel>& model) {
-  for (const auto& componentPair : components_)
-    componentPair.second->setModelDyn(model);
+  initFromIIDMIfDeferred();
+  // the components left out of the network model declared no reference
+  for (const auto& componentPair : components_) {
+    if (componentPair.second->hasDynamicModel() || componentPair.second->hasReferences())
+      componentPair.second->setModelDyn(model);
+  }
 }
 
 void
 DataInterfaceIIDM::mapConnections() {
+  initFromIIDMIfDeferred();
   for (const auto& line : network_->getLines()) {
     if (line->hasDynamicModel()) {
       line->getBusInterface1()->hasConnection(true);
@@ -990,28 +1040,52 @@ DataInterfaceIIDM::mapConnections() {
 
 void
 DataInterfaceIIDM::importStaticParameters() {
+  initFromIIDMIfDeferred();
   for (const auto& componentPair : components_)
     componentPair.second->importStaticParameters();
 }
 
 void
 DataInterfaceIIDM::getStateVariableReference() {
-  for (const auto& componentPair : components_)
+  initFromIIDMIfDeferred();
+  criteriaComponents_.clear();
+  for (const auto& componentPair : components_) {
     componentPair.second->getStateVariableReference();
+    if (componentPair.second->hasCriteriaStateVariables())
+      criteriaComponents_.push_back(componentPair.second.get());
+  }
 }
 
 void
 DataInterfaceIIDM::updateFromModel(bool filterForCriteriaCheck) {
-  for (const auto& componentPair : components_)
-    componentPair.second->updateFromModel(filterForCriteriaCheck);
+  initFromIIDMIfDeferred();
+  if (filterForCriteriaCheck) {
+    for (ComponentInterface* component : criteriaComponents_)
+      component->updateFromModel(filterForCriteriaCheck);
+  } else {
+    for (const auto& componentPair : components_) {
+      componentPair.second->updateFromModel(filterForCriteriaCheck);
+      recordConnectionStateChange(*componentPair.second);
+    }
+  }
+}
+
+void
+DataInterfaceIIDM::recordConnectionStateChange(ComponentInterface& component) {
+  if (component.hasConnectionStateChanged()) {
+    connectionChangedComponents_.insert(&component);
+    component.resetConnectionStateChanged();
+  }
 }
 
 void
 DataInterfaceIIDM::exportStateVariables() {
+  initFromIIDMIfDeferred();
   const bool filterForCriteriaCheck = false;
   for (const auto& componentPair : components_) {
     const auto& component = componentPair.second;
     component->updateFromModel(filterForCriteriaCheck);
+    recordConnectionStateChange(*component);
     component->exportStateVariables();
   }
 
@@ -1024,9 +1098,12 @@ DataInterfaceIIDM::exportStateVariables() {
 
 #ifdef _DEBUG_
 void
-DataInterfaceIIDM::exportStateVariablesNoReadFromModel() const {
-  for (const auto& componentPair : components_)
+DataInterfaceIIDM::exportStateVariablesNoReadFromModel() {
+  initFromIIDMIfDeferred();
+  for (const auto& componentPair : components_) {
+    recordConnectionStateChange(*componentPair.second);
     componentPair.second->exportStateVariables();
+  }
 
   // loop to update switch state due to topology analysis
   // should be removed once a solution has been found to propagate switches (de)connection
@@ -1038,10 +1115,25 @@ DataInterfaceIIDM::exportStateVariablesNoReadFromModel() const {
 
 std::shared_ptr<vector<std::shared_ptr<ComponentInterface> > >
 DataInterfaceIIDM::findConnectedComponents() {
+  initFromIIDMIfDeferred();
   std::shared_ptr<vector<std::shared_ptr<ComponentInterface> > > connectedComponents(new vector<std::shared_ptr<ComponentInterface> >());
+  initiallyConnectedComponents_.clear();
   for (auto& component : components_) {
+    // connection changes are tracked from now on
+    component.second->resetConnectionStateChanged();
     if (component.second->isPartiallyConnected()) {
       connectedComponents->push_back(component.second);
+      initiallyConnectedComponents_.insert(component.second.get());
+    }
+  }
+  connectionChangedComponents_.clear();
+  connectedComponents_ = connectedComponents;
+
+  hasNodeBreakerTopology_ = false;
+  for (const auto& voltageLevelPair : voltageLevels_) {
+    if (voltageLevelPair.second->isNodeBreakerTopology()) {
+      hasNodeBreakerTopology_ = true;
+      break;
     }
   }
   return connectedComponents;
@@ -1050,29 +1142,52 @@ DataInterfaceIIDM::findConnectedComponents() {
 std::unique_ptr<lostEquipments::LostEquipmentsCollection>
 DataInterfaceIIDM::findLostEquipments(const std::shared_ptr<vector<std::shared_ptr<ComponentInterface> > >& connectedComponents) {
   std::unique_ptr<lostEquipments::LostEquipmentsCollection> lostEquipments = lostEquipments::LostEquipmentsCollectionFactory::newInstance();
-  if (connectedComponents) {
-    std::unordered_set<std::string> alreadyLost3wt;
-    for (const auto& component : *connectedComponents) {
-      auto lost = !component->isPartiallyConnected();  // from connected to not connected (not even partially)
-      if (lost) {
-        std::string componentID = component->getID();
-        if (component->getType() == ComponentInterface::ComponentType_t::TWO_WTFO &&
-            fict2wtIDto3wtID_.find(componentID) != fict2wtIDto3wtID_.end()) {
-          if (alreadyLost3wt.find(fict2wtIDto3wtID_[componentID]) == alreadyLost3wt.end()) {
-            lostEquipments->addLostEquipment(fict2wtIDto3wtID_[componentID], "THREE_WINDINGS_TRANSFORMER");
-            alreadyLost3wt.insert(fict2wtIDto3wtID_[componentID]);
-          }
-        } else {
-          lostEquipments->addLostEquipment(componentID, component->getTypeAsString());
-        }
+  if (!connectedComponents)
+    return lostEquipments;
+
+  std::unordered_set<std::string> alreadyLost3wt;
+  if (connectedComponents == connectedComponents_.lock()) {
+    // a component can only be lost if a connection state changed since the connected components were found
+    if (connectionChangedComponents_.empty())
+      return lostEquipments;
+
+    // in bus breaker topology, only the components whose connection state changed have to be checked
+    // in node breaker topology, a change can disconnect the other components of the voltage level
+    if (!hasNodeBreakerTopology_) {
+      for (const ComponentInterface* component : connectionChangedComponents_) {
+        if (initiallyConnectedComponents_.find(component) != initiallyConnectedComponents_.end() && !component->isPartiallyConnected())
+          addLostEquipment(*component, *lostEquipments, alreadyLost3wt);
       }
+      return lostEquipments;
     }
   }
+
+  for (const auto& component : *connectedComponents) {
+    if (!component->isPartiallyConnected())  // from connected to not connected (not even partially)
+      addLostEquipment(*component, *lostEquipments, alreadyLost3wt);
+  }
   return lostEquipments;
 }
 
+void
+DataInterfaceIIDM::addLostEquipment(const ComponentInterface& component, lostEquipments::LostEquipmentsCollection& lostEquipments,
+    std::unordered_set<std::string>& alreadyLost3wt) {
+  const std::string& componentID = component.getID();
+  if (component.getType() == ComponentInterface::ComponentType_t::TWO_WTFO &&
+      fict2wtIDto3wtID_.find(componentID) != fict2wtIDto3wtID_.end()) {
+    const std::string& threeWTransformerID = fict2wtIDto3wtID_[componentID];
+    if (alreadyLost3wt.find(threeWTransformerID) == alreadyLost3wt.end()) {
+      lostEquipments.addLostEquipment(threeWTransformerID, "THREE_WINDINGS_TRANSFORMER");
+      alreadyLost3wt.insert(threeWTransformerID);
+    }
+  } else {
+    lostEquipments.addLostEquipment(componentID, component.getTypeAsString());
+  }
+}
+
 void
 DataInterfaceIIDM::configureCriteria(const std::shared_ptr<CriteriaCollection>& criteria) {
+  initFromIIDMIfDeferred();
   configureBusCriteria(criteria);
   configureLoadCriteria(criteria);
   configureGeneratorCriteria(criteria);
@@ -1262,6 +1377,31 @@ DataInterfaceIIDM::getStaticParameterBoolValue(const std::string& staticID, cons
   return findComponent(staticID)->getStaticParameterValue<bool>(refOrigName);
 }
 
+void
+DataInterfaceIIDM::findStaticParameters(const std::string& staticID, const std::vector<std::string>& refOrigNames,
+                                        std::vector<const StaticParameter*>& staticParameters) {
+  const std::shared_ptr<ComponentInterface>& component = findComponent(staticID);
+  staticParameters.clear();
+  staticParameters.reserve(refOrigNames.size());
+  for (const auto& refOrigName : refOrigNames)
+    staticParameters.push_back(&component->findStaticParameter(refOrigName));
+}
+
+double
+DataInterfaceIIDM::getStaticParameterDoubleValue(const StaticParameter& staticParameter) const {
+  return ComponentInterface::getStaticParameterValue<double>(staticParameter);
+}
+
+int
+DataInterfaceIIDM::getStaticParameterIntValue(const StaticParameter& staticParameter) const {
+  return ComponentInterface::getStaticParameterValue<int>(staticParameter);
+}
+
+bool
+DataInterfaceIIDM::getStaticParameterBoolValue(const StaticParameter& staticParameter) const {
+  return ComponentInterface::getStaticParameterValue<bool>(staticParameter);
+}
+
 void
 DataInterfaceIIDM::setTimeline(const boost::shared_ptr<timeline::Timeline>& timeline) {
   timeline_ = timeline;
@@ -1270,10 +1410,27 @@ DataInterfaceIIDM::setTimeline(const boost::shared_ptr<timeline::Timeline>& time
 void
 DataInterfaceIIDM::copy(const DataInterfaceIIDM& other) {
   networkIIDM_  = other.networkIIDM_;  // No clone here because iidm network is not copyable
+  connectedComponents_.reset();
+  initiallyConnectedComponents_.clear();
+  connectionChangedComponents_.clear();
+  hasNodeBreakerTopology_ = false;
   // Criterias are not copied and must be initialized again
   serviceManager_ = boost::make_shared<ServiceManagerInterfaceIIDM>(this);
+  setReducedVoltageLevels(other.getReducedVoltageLevels());
+  setCollapsedVoltageLevels(other.getCollapsedVoltageLevels());
+  setEliminateStarBuses(other.getEliminateStarBuses());
+  setStudyVoltageLevels(other.getStudyVoltageLevels());
+  setStudyAreaDepth(other.getStudyAreaDepth());
+
+  // the interfaces are built from the shared iidm network on first use, so that cloning stays cheap
+  // and the interfaces of each clone are built by the thread running it, from its own variant
+  initFromIIDMDeferred_ = true;
+}
 
-  initFromIIDM();
+void
+DataInterfaceIIDM::initFromIIDMIfDeferred() const {
+  if (initFromIIDMDeferred_)
+    const_cast<DataInterfaceIIDM*>(this)->initFromIIDM();
 }
 
 DataInterfaceIIDM::DataInterfaceIIDM(const DataInterfaceIIDM& other) {
@@ -1290,4 +1447,18 @@ DataInterfaceIIDM::clone() const {
   return boost::shared_ptr<DataInterfaceIIDM>(new DataInterfaceIIDM(*this));
 }
 
+size_t
+DataInterfaceIIDM::getMemoryUsage() const {
+  size_t memoryUsage = MemoryUsage::bytes(components_) + MemoryUsage::bytes(criteriaComponents_) + MemoryUsage::bytes(initiallyConnectedComponents_)
+      + MemoryUsage::bytes(connectionChangedComponents_) + MemoryUsage::bytes(voltageLevels_) + MemoryUsage::bytes(busComponents_)
+      + MemoryUsage::bytes(loadComponents_) + MemoryUsage::bytes(generatorComponents_) + MemoryUsage::bytes(calculatedBusComponents_)
+      + MemoryUsage::bytes(fict2wtIDto3wtID_) + MemoryUsage::bytes(criteria_);
+  // the calculated buses are also indexed in components_
+  for (const auto& component : components_)
+    memoryUsage += MemoryUsage::bytes(component.first) + component.second->getMemoryUsage();
+  for (const auto& calculatedBuses : calculatedBusComponents_)
+    memoryUsage += MemoryUsage::bytes(calculatedBuses.second);
+  return memoryUsage;
+}
+
 }  // namespace DYN
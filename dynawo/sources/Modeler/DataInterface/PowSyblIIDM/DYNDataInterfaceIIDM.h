@@ -42,6 +42,7 @@
 #include <powsybl/iidm/Network.hpp>
 
 #include <mutex>
+#include <unordered_set>
 
 namespace DYN {
 
@@ -162,7 +163,7 @@ class DataInterfaceIIDM : public DataInterfaceImpl {
   /**
    * @brief export values from static variables directly into the IIDM model without updating them
    */
-  void exportStateVariablesNoReadFromModel() const;
+  void exportStateVariablesNoReadFromModel();
 #endif
 
   /**
@@ -207,6 +208,27 @@ class DataInterfaceIIDM : public DataInterfaceImpl {
    */
   bool getStaticParameterBoolValue(const std::string& staticID, const std::string& refOrigName) override;
 
+  /**
+   * @copydoc DataInterface::findStaticParameters()
+   */
+  void findStaticParameters(const std::string& staticID, const std::vector<std::string>& refOrigNames,
+                            std::vector<const StaticParameter*>& staticParameters) override;
+
+  /**
+   * @copydoc DataInterface::getStaticParameterDoubleValue(const StaticParameter& staticParameter) const
+   */
+  double getStaticParameterDoubleValue(const StaticParameter& staticParameter) const override;
+
+  /**
+   * @copydoc DataInterface::getStaticParameterIntValue(const StaticParameter& staticParameter) const
+   */
+  int getStaticParameterIntValue(const StaticParameter& staticParameter) const override;
+
+  /**
+   * @copydoc DataInterface::getStaticParameterBoolValue(const StaticParameter& staticParameter) const
+   */
+  bool getStaticParameterBoolValue(const StaticParameter& staticParameter) const override;
+
   /**
    * @copydoc DataInterface::getBusName(const std::string& staticID, const std::string& labelNode)
    */
@@ -244,6 +266,11 @@ class DataInterfaceIIDM : public DataInterfaceImpl {
    */
   boost::shared_ptr<DataInterface> clone() const final;
 
+  /**
+   * @copydoc DataInterface::getMemoryUsage() const
+   */
+  size_t getMemoryUsage() const override;
+
   /**
    * @brief find a bus interface thanks to the terminal (works for node_breaker and bus_breaker)
    * @param terminal terminal of the bus interface to find
@@ -253,6 +280,26 @@ class DataInterfaceIIDM : public DataInterfaceImpl {
   std::shared_ptr<BusInterface> findBusInterface(const powsybl::iidm::Terminal& terminal) const;
 
  private:
+  /**
+   * @brief record the component if its connection state changed since the last record
+   * @param component component to check
+   */
+  void recordConnectionStateChange(ComponentInterface& component);
+
+  /**
+   * @brief build the interfaces from the iidm network if it was deferred when cloning
+   */
+  void initFromIIDMIfDeferred() const;
+
+  /**
+   * @brief add a component to the lost equipments
+   * @param component component which lost its connection
+   * @param lostEquipments lost equipments collection to fill
+   * @param alreadyLost3wt three windings transformers already added to the collection
+   */
+  void addLostEquipment(const ComponentInterface& component, lostEquipments::LostEquipmentsCollection& lostEquipments,
+      std::unordered_set<std::string>& alreadyLost3wt);
+
   /**
    * @brief find a bus interface thanks to its iidm
    * @param bus bus interface to find
@@ -287,14 +334,16 @@ class DataInterfaceIIDM : public DataInterfaceImpl {
   std::shared_ptr<BusInterface> findCalculatedBusInterface(const std::string& voltageLevelId, const std::string& bbsId) const;
 
   /**
-   * @brief import and create a voltage level interface thanls to the IIDM instance
+   * @brief import the components of a voltage level interface thanks to the IIDM instance
+   *
+   * The voltage level interface and its bus topology are built beforehand, possibly concurrently
    *
-   * @param voltageLevelIIDM IIDM instance to use to create voltageLevelInterface
+   * @param voltageLevel voltage level interface built from the IIDM instance
+   * @param voltageLevelIIDM IIDM instance used to create voltageLevelInterface
    * @param country country of the parent substation
-   * @return the instance VoltageLevelInterface created
    */
-  std::shared_ptr<VoltageLevelInterfaceIIDM> importVoltageLevel(powsybl::iidm::VoltageLevel& voltageLevelIIDM,
-                                                                const stdcxx::optional<powsybl::iidm::Country>& country);
+  void importVoltageLevel(const std::shared_ptr<VoltageLevelInterfaceIIDM>& voltageLevel, powsybl::iidm::VoltageLevel& voltageLevelIIDM,
+                          const stdcxx::optional<powsybl::iidm::Country>& country);
 
   /**
    * @brief import and create a switch interface thanks to the IIDM instance
@@ -471,6 +520,11 @@ class DataInterfaceIIDM : public DataInterfaceImpl {
   boost::shared_ptr<powsybl::iidm::Network> networkIIDM_;                                          ///< instance of the IIDM network
   boost::shared_ptr<NetworkInterfaceIIDM> network_;                                                ///< instance of the network interface
   std::unordered_map<std::string, std::shared_ptr<ComponentInterface> > components_;           ///< map of components
+  std::vector<ComponentInterface*> criteriaComponents_;  ///< components with state variables needed for criteria check, resolved with references
+  std::weak_ptr<std::vector<std::shared_ptr<ComponentInterface> > > connectedComponents_;  ///< last connected components found, lost equipments are tracked from them
+  std::unordered_set<const ComponentInterface*> initiallyConnectedComponents_;  ///< components of connectedComponents_, for a quick lookup
+  std::unordered_set<ComponentInterface*> connectionChangedComponents_;  ///< components whose connection state changed since connectedComponents_ were found
+  bool hasNodeBreakerTopology_;  ///< @b true if a voltage level has a node breaker topology, the connection of a component then depends on its neighbours
   std::unordered_map<std::string, std::shared_ptr<VoltageLevelInterface> > voltageLevels_;     ///< map of voltageLevel by name
   std::unordered_map<std::string, std::shared_ptr<BusInterface> > busComponents_;              ///< map of bus by name
   std::unordered_map<std::string, std::shared_ptr<LoadInterfaceIIDM> > loadComponents_;        ///< map of loads by name
@@ -481,6 +535,7 @@ class DataInterfaceIIDM : public DataInterfaceImpl {
   boost::shared_ptr<ServiceManagerInterfaceIIDM> serviceManager_;  ///< Service manager
 
   std::unordered_map<std::string, std::string> fict2wtIDto3wtID_;                                  ///< map of fictitious 2WTs and their associated 3WT
+  bool initFromIIDMDeferred_;  ///< @b true if the interfaces of this clone were not built from the iidm network yet
 
   static std::mutex loadExtensionMutex_;  ///< Mutex to protect access to singleton for extension during build
 };  ///< Generic data interface for IIDM format files
@@ -57,6 +57,12 @@ FictBusInterfaceIIDM::getAngle0() const {
   return angle0_;
 }
 
+void
+FictBusInterfaceIIDM::setInitialVoltage(const double v0, const double angle0) {
+  U0_ = v0;
+  angle0_ = angle0;
+}
+
 double
 FictBusInterfaceIIDM::getVNom() const {
   return Vnom_;
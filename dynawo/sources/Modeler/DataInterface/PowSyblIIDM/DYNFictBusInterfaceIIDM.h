@@ -69,6 +69,11 @@ class FictBusInterfaceIIDM : public BusInterface {
    */
   double getAngle0() const override;
 
+  /**
+   * @copydoc BusInterface::setInitialVoltage(double v0, double angle0)
+   */
+  void setInitialVoltage(double v0, double angle0) override;
+
   /**
    * @copydoc BusInterface::getVNom() const
    */
@@ -49,9 +49,7 @@ generatorIIDM_(generator) {
   activePowerControl_ = generator.findExtension<powsybl::iidm::extensions::iidm::ActivePowerControl>();
   coordinatedReactiveControl_ = generator.findExtension<powsybl::iidm::extensions::iidm::CoordinatedReactiveControl>();
 
-  auto libPath = IIDMExtensions::findLibraryPath();
-
-  auto generatorActivePowerControlDef = IIDMExtensions::getExtension<GeneratorActivePowerControlIIDMExtension>(libPath.generic_string());
+  auto generatorActivePowerControlDef = IIDMExtensions::getExtension<GeneratorActivePowerControlIIDMExtension>();
   generatorActivePowerControl_ = std::get<IIDMExtensions::CREATE_FUNCTION>(generatorActivePowerControlDef)(generator);
   destroyGeneratorActivePowerControl_ = std::get<IIDMExtensions::DESTROY_FUNCTION>(generatorActivePowerControlDef);
 }
@@ -25,6 +25,7 @@
 namespace DYN {
 
 std::mutex IIDMExtensions::librariesMutex_;
+std::mutex IIDMExtensions::definitionsMutex_;
 
 boost::filesystem::path
 IIDMExtensions::findLibraryPath() {
@@ -131,6 +131,24 @@ class IIDMExtensions {
     return ExtensionDefinition<T>(createFunc, destroyFunc);
   }
 
+  /**
+   * @brief Retrieve the extension definition from the library given by the DYNAMO environment
+   *
+   * The definition is resolved once per library path and reused by the next calls
+   *
+   * @returns the extension definition
+   */
+  template<class T>
+  static ExtensionDefinition<T> getExtension() {
+    const std::string libPath = findLibraryPath().generic_string();
+    static std::unordered_map<LibraryPath, ExtensionDefinition<T> > definitions;
+    std::lock_guard<std::mutex> lock(definitionsMutex_);
+    auto it = definitions.find(libPath);
+    if (it == definitions.end())
+      it = definitions.emplace(libPath, getExtension<T>(libPath)).first;
+    return it->second;
+  }
+
  private:
   ///< Alias for library path in map
   using LibraryPath = std::string;
@@ -174,6 +192,7 @@ class IIDMExtensions {
 
  private:
   static std::mutex librariesMutex_;                               ///< Mutex to access libraries
+  static std::mutex definitionsMutex_;                             ///< Mutex to access resolved extension definitions
 };
 }  // namespace DYN
 
@@ -74,20 +74,21 @@ ServiceManagerInterfaceIIDM::getBusesConnectedBySwitch(const std::string& busId,
   Graph graph;
   buildGraph(graph, *vlIt);
 
-  // Change weight of edges
-  std::unordered_map<std::string, float> weights;
-  for (const auto& sw : (*vlIt)->getSwitches()) {
-    weights[sw->getID()] = sw->isOpen() ? 0 : 1;
-  }
+  // Change weight of edges: the edges are created in the order of the switches
+  const auto& switches = (*vlIt)->getSwitches();
+  for (unsigned int i = 0; i < switches.size(); ++i)
+    graph.setEdgeWeight(i, switches[i]->isOpen() ? 0 : 1);
 
   std::vector<std::string> ret;
 
+  // the vertices are the position of the buses: the buses connected are the ones in the same component
+  const std::vector<unsigned int> components = graph.calculateComponents().second;
   size_t busIndexFound = it - buses.begin();
   for (size_t busIndex = 0; busIndex < buses.size(); busIndex++) {
     if (busIndex == busIndexFound) {
       continue;
     }
-    if (graph.pathExist(static_cast<unsigned int>(busIndexFound), static_cast<unsigned int>(busIndex), weights)) {
+    if (components[busIndex] == components[busIndexFound]) {
       ret.push_back(buses.at(busIndex)->getID());
     }
   }
@@ -116,20 +117,21 @@ ServiceManagerInterfaceIIDM::isBusConnected(const std::string& busId, const std:
   Graph graph;
   buildGraph(graph, *vlIt);
 
-  // Change weight of edges
-  std::unordered_map<std::string, float> weights;
-  for (const auto& sw : (*vlIt)->getSwitches()) {
-    weights[sw->getID()] = sw->isOpen() ? 0 : 1;
-  }
+  // Change weight of edges: the edges are created in the order of the switches
+  const auto& switches = (*vlIt)->getSwitches();
+  for (unsigned int i = 0; i < switches.size(); ++i)
+    graph.setEdgeWeight(i, switches[i]->isOpen() ? 0 : 1);
 
   std::vector<std::string> ret;
 
+  // the vertices are the position of the buses: the buses connected are the ones in the same component
+  const std::vector<unsigned int> components = graph.calculateComponents().second;
   size_t busIndexFound = it - buses.begin();
   for (size_t busIndex = 0; busIndex < buses.size(); busIndex++) {
     if (busIndex == busIndexFound) {
       continue;
     }
-    if (graph.pathExist(static_cast<unsigned int>(busIndexFound), static_cast<unsigned int>(busIndex), weights) &&
+    if (components[busIndex] == components[busIndexFound] &&
         !buses[busIndex]->getBusBarSectionIdentifiers().empty()) {
       return true;
     }
@@ -49,8 +49,7 @@ staticVarCompensatorIIDM_(svc) {
 
   setType(ComponentInterface::SVC);
 
-  auto libPath = IIDMExtensions::findLibraryPath();
-  auto extensionDef = IIDMExtensions::getExtension<StaticVarCompensatorInterfaceIIDMExtension>(libPath.generic_string());
+  auto extensionDef = IIDMExtensions::getExtension<StaticVarCompensatorInterfaceIIDMExtension>();
 
   extension_ = std::get<IIDMExtensions::CREATE_FUNCTION>(extensionDef)(svc);
   destroy_extension_ = std::get<IIDMExtensions::DESTROY_FUNCTION>(extensionDef);
@@ -340,7 +340,10 @@ VoltageLevelInterfaceIIDM::calculateBusTopology() {
       }
     }
   }
+}
 
+void
+VoltageLevelInterfaceIIDM::printCalculatedBus() const {
   if (!calculatedBus_.empty()) {
     Trace::debug(Trace::network()) << "------------------------------" << Trace::endline;
     Trace::debug(Trace::network()) << "Calculated buses from " << getID() << Trace::endline;
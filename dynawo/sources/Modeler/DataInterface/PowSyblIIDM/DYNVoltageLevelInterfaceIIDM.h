@@ -173,9 +173,17 @@ class VoltageLevelInterfaceIIDM : public VoltageLevelInterface {
 
   /**
    *  @brief calculate bus topology from node topology if node topology is used in iidm network
+   *
+   *  Only the iidm voltage level of this interface is read, so that the topologies of several voltage levels
+   *  can be calculated concurrently
    */
   void calculateBusTopology();
 
+  /**
+   *  @brief print the calculated buses in the network logs
+   */
+  void printCalculatedBus() const;
+
   /**
    * @brief get the vector of calculated bus created from the node view
    * @return vector of calculated bus created from the node view
@@ -20,6 +20,7 @@
 
 #include "gtest_dynawo.h"
 #include "DYNDataInterfaceIIDM.h"
+#include "DYNDataInterfaceFactory.h"
 #include "DYNBatteryInterfaceIIDM.h"
 #include "DYNBusInterfaceIIDM.h"
 #include "DYNDanglingLineInterfaceIIDM.h"
@@ -761,6 +762,15 @@ TEST(DataInterfaceIIDMTest, testNodeBreakerBusIIDM) {
   ASSERT_DOUBLE_EQUALS_DYNAWO(data->getStaticParameterDoubleValue("calculatedBus_MyVoltageLevel_4", "Upu"), 220./190.);
   ASSERT_DOUBLE_EQUALS_DYNAWO(data->getStaticParameterDoubleValue("calculatedBus_MyVoltageLevel_4", "Theta_pu"), 3 * M_PI / 180);
 
+  std::vector<const StaticParameter*> staticParameters;
+  data->findStaticParameters("calculatedBus_MyVoltageLevel_3", {"U", "Theta", "Upu"}, staticParameters);
+  ASSERT_EQ(staticParameters.size(), 3);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(data->getStaticParameterDoubleValue(*staticParameters[0]), 110.);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(data->getStaticParameterDoubleValue(*staticParameters[1]), 1.5);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(data->getStaticParameterDoubleValue(*staticParameters[2]), 110./190.);
+  ASSERT_THROW_DYNAWO(data->findStaticParameters("calculatedBus_MyVoltageLevel_3", {"U", "NotAParameter"}, staticParameters),
+      Error::MODELER, KeyError_t::UnknownStaticParameter);
+
   ASSERT_EQ(data->getBusName("calculatedBus_MyVoltageLevel_0", ""), "calculatedBus_MyVoltageLevel_0");
   powsybl::iidm::Bus& busIIDM4 = network.getVoltageLevel("MyVoltageLevel").getBusBreakerView().getBus("MyVoltageLevel_4");
   ASSERT_DOUBLE_EQUALS_DYNAWO(busIIDM4.getV(), 220.);
@@ -2037,6 +2047,8 @@ TEST(DataInterfaceIIDMTest, testClone) {
   ASSERT_NE(data->getServiceManager(), data2->getServiceManager());
 
   ASSERT_EQ(data->getNetworkIIDM().getId(), data2->getNetworkIIDM().getId());
+  // the interfaces of the clone are built on first use
+  ASSERT_NO_THROW(data2->findComponent("MyLoad"));
 
   boost::shared_ptr<NetworkInterfaceIIDM> network_interface = boost::dynamic_pointer_cast<NetworkInterfaceIIDM>(data->getNetwork());
   boost::shared_ptr<NetworkInterfaceIIDM> network_interface2 = boost::dynamic_pointer_cast<NetworkInterfaceIIDM>(data2->getNetwork());
@@ -2135,6 +2147,65 @@ TEST(DataInterfaceIIDMTest, testMultiThreading) {
   ASSERT_EQ(load.getQ0(), 4.0);
 }
 
+TEST(DataInterfaceIIDMTest, testPreload) {
+  shared_ptr<DataInterfaceIIDM> dataOutput = createDataItfFromNetwork(createNodeBreakerNetworkIIDM());
+  ASSERT_NO_THROW(dataOutput->dumpToFile("networkPreload.xml"));
+
+  DataInterfaceFactory::preload(DataInterfaceFactory::DATAINTERFACE_IIDM, "networkPreload.xml");
+  shared_ptr<DataInterface> preloaded = DataInterfaceFactory::build(DataInterfaceFactory::DATAINTERFACE_IIDM, "networkPreload.xml");
+  ASSERT_TRUE(preloaded);
+  ASSERT_NO_THROW(preloaded->findComponent("MyLoad"));
+  // the preloaded instance is returned only once
+  shared_ptr<DataInterface> built = DataInterfaceFactory::build(DataInterfaceFactory::DATAINTERFACE_IIDM, "networkPreload.xml");
+  ASSERT_NE(built, preloaded);
+
+  DataInterfaceFactory::preload(DataInterfaceFactory::DATAINTERFACE_IIDM, "networkPreload.xml");
+  // not used with several variants
+  shared_ptr<DataInterface> withVariants = DataInterfaceFactory::build(DataInterfaceFactory::DATAINTERFACE_IIDM, "networkPreload.xml", 2);
+  ASSERT_TRUE(withVariants->canUseVariant());
+  DataInterfaceFactory::clearPreloaded();
+  built = DataInterfaceFactory::build(DataInterfaceFactory::DATAINTERFACE_IIDM, "networkPreload.xml");
+  ASSERT_FALSE(built->canUseVariant());
+}
+
+TEST(DataInterfaceIIDMTest, testParallelImport) {
+  const BusBreakerNetworkProperty properties = {
+      false /*instantiateCapacitorShuntCompensator*/,
+      false /*instantiateStaticVarCompensator*/,
+      false /*instantiateTwoWindingTransformer*/,
+      false /*instantiateRatioTapChanger*/,
+      false /*instantiatePhaseTapChanger*/,
+      false /*instantiateDanglingLine*/,
+      true /*instantiateGenerator*/,
+      false /*instantiateGeneratorWithExtensions*/,
+      false /*instantiateLccConverterWithConnectedHvdc*/,
+      false /*instantiateLccConverterWithDisconnectedHvdc*/,
+      true /*instantiateLine*/,
+      true /*instantiateLoad*/,
+      true /*instantiateSwitch*/,
+      false /*instantiateVscConverterWithConnectedHvdc*/,
+      false /*instantiateVscConverterWithDisconnectedHvdc*/,
+      false /*instantiateThreeWindingTransformer*/,
+      false /*instantiateBattery*/
+  };
+  shared_ptr<DataInterfaceIIDM> sequentialData = createDataItfFromNetwork(createBusBreakerNetwork(properties));
+  setenv("DYNAWO_NB_NETWORK_IMPORT_THREADS", "3", 1);
+  shared_ptr<DataInterfaceIIDM> parallelData = createDataItfFromNetwork(createBusBreakerNetwork(properties));
+  unsetenv("DYNAWO_NB_NETWORK_IMPORT_THREADS");
+
+  const auto& sequentialVoltageLevels = sequentialData->getNetwork()->getVoltageLevels();
+  const auto& parallelVoltageLevels = parallelData->getNetwork()->getVoltageLevels();
+  ASSERT_EQ(parallelVoltageLevels.size(), sequentialVoltageLevels.size());
+  for (unsigned int i = 0; i < sequentialVoltageLevels.size(); ++i) {
+    ASSERT_EQ(parallelVoltageLevels[i]->getID(), sequentialVoltageLevels[i]->getID());
+    ASSERT_EQ(parallelVoltageLevels[i]->getBuses().size(), sequentialVoltageLevels[i]->getBuses().size());
+    ASSERT_EQ(parallelVoltageLevels[i]->getLoads().size(), sequentialVoltageLevels[i]->getLoads().size());
+    ASSERT_EQ(parallelVoltageLevels[i]->getGenerators().size(), sequentialVoltageLevels[i]->getGenerators().size());
+  }
+  ASSERT_EQ(parallelData->getNetwork()->getLines().size(), sequentialData->getNetwork()->getLines().size());
+  ASSERT_NO_THROW(parallelData->findComponent("MyLoad"));
+}
+
 TEST(DataInterfaceIIDMTest, testFindLostEquipments) {
   const BusBreakerNetworkProperty properties = {
       false /*instantiateCapacitorShuntCompensator*/,
@@ -2175,7 +2246,23 @@ TEST(DataInterfaceIIDMTest, testFindLostEquipments) {
   ASSERT_TRUE(lostEquipments->cbegin() != lostEquipments->cend());
   lostEquipments::LostEquipmentsCollection::LostEquipmentsCollectionConstIterator itLostEquipment = lostEquipments->cbegin();
   ASSERT_TRUE(++itLostEquipment == lostEquipments->cend());
+  std::shared_ptr<std::vector<std::shared_ptr<ComponentInterface> > > previousConnectedComponents = connectedComponents;
   connectedComponents = data->findConnectedComponents();
   ASSERT_EQ(connectedComponents->size(), 2);
+
+  // lost equipments can still be found from previously connected components
+  lostEquipments = data->findLostEquipments(previousConnectedComponents);
+  itLostEquipment = lostEquipments->cbegin();
+  ASSERT_TRUE(itLostEquipment != lostEquipments->cend());
+  ASSERT_EQ((*itLostEquipment)->getId(), "MyGenerator");
+  ASSERT_TRUE(++itLostEquipment == lostEquipments->cend());
+
+  // the generator was not connected when the connected components were found
+  gen->setValue(GeneratorInterfaceIIDM::VAR_STATE, CLOSED);
+  data->exportStateVariablesNoReadFromModel();
+  gen->setValue(GeneratorInterfaceIIDM::VAR_STATE, OPEN);
+  data->exportStateVariablesNoReadFromModel();
+  lostEquipments = data->findLostEquipments(connectedComponents);
+  ASSERT_TRUE(lostEquipments->cbegin() == lostEquipments->cend());
 }
 }  // namespace DYN
@@ -16,10 +16,15 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
+#include <mutex>
+#include <typeinfo>
+#include <unordered_map>
 #include <vector>
 
 #include <boost/archive/binary_iarchive.hpp>
@@ -31,6 +36,7 @@
 
 #include "DYNCommon.h"
 #include "DYNMacrosMessage.h"
+#include "DYNMemoryUsage.h"
 #include "DYNElement.h"
 #include "DYNFileSystemUtils.h"
 #include "DYNModelManager.h"
@@ -58,6 +64,36 @@ using parameters::ParametersSetFactory;
 
 namespace DYN {
 
+namespace {
+
+/**
+ * @brief get the default values of the shared parameters of a class of Modelica model
+ *
+ * The default values only depend on the class of the model: they are built once, then shared by all the instances.
+ * The parameters are read without the parameters set, which marks the parameters it returns as used.
+ *
+ * @param model Modelica model
+ * @return default values of the shared parameters of the class of the model
+ */
+const vector<std::shared_ptr<parameters::Parameter> >&
+sharedParametersDefaultValues(ModelModelica* model) {
+  static std::mutex mutex;
+  static std::unordered_map<const std::type_info*, vector<std::shared_ptr<parameters::Parameter> > > defaultValuesByModelType;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  // the type_info objects are distinct for two libraries defining a class with the same name
+  const auto it = defaultValuesByModelType.find(&typeid(*model));
+  if (it != defaultValuesByModelType.end())
+    return it->second;
+  vector<std::shared_ptr<parameters::Parameter> >& defaultValues = defaultValuesByModelType[&typeid(*model)];
+  const std::shared_ptr<ParametersSet> sharedParametersInitialValues = model->setSharedParametersDefaultValues();
+  for (const auto& parameterPair : sharedParametersInitialValues->getParameters())
+    defaultValues.push_back(parameterPair.second);
+  return defaultValues;
+}
+
+}  // namespace
+
 ModelManager::ModelManager() :
 SubModel(),
 modelInit_(NULL),
@@ -251,6 +287,15 @@ ModelManager::hasDataCheckCoherence() const {
   return modelModelica()->hasCheckDataCoherence();
 }
 
+void
+ModelManager::accountMemory(MemoryUsage& usage) const {
+  SubModel::accountMemory(usage);
+  usage.add(MemoryUsage::DELAY_BUFFERS, delayManager_.getMemoryUsage());
+#ifdef _ADEPT_
+  usage.add(MemoryUsage::SPARSE_MATRICES, jacobianPatternInit_.getMemoryUsage() + jacobianPatternDyn_.getMemoryUsage());
+#endif
+}
+
 void
 ModelManager::checkDataCoherence(const double t) {
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
@@ -314,56 +359,106 @@ ModelManager::evalF(const double t, const vector<adept::adouble>& y,
 #endif
 }
 
+namespace {
+/**
+ * @brief deactivate an Adept stack when leaving the scope, even through an exception
+ */
+class AdeptStackDeactivator {
+ public:
+  /**
+   * @brief constructor
+   * @param stack stack to deactivate
+   */
+  explicit AdeptStackDeactivator(adept::Stack& stack) : stack_(stack) { }
+
+  /**
+   * @brief destructor
+   */
+  ~AdeptStackDeactivator() {
+    stack_.deactivate();
+  }
+
+ private:
+  adept::Stack& stack_;  ///< stack to deactivate
+};
+}  // namespace
+
+ModelManager::AdeptTape::~AdeptTape() {
+  if (!stack_)
+    return;
+  // Adept variables unregister themselves from the active stack when destroyed
+  stack_->activate();
+  x_.clear();
+  xp_.clear();
+  output_.clear();
+  stack_->deactivate();
+}
+
+ModelManager::AdeptTape&
+ModelManager::adeptTape() {
+  // one tape by thread, released when the thread exits
+  static thread_local AdeptTape tape;
+  if (!tape.stack_)
+    tape.stack_.reset(new adept::Stack(false));
+  return tape;
+}
+
 void
 ModelManager::evalJtAdept(const double t, double* y, double* yp, const double cj, SparseMatrix& Jt, const int rowOffset, const bool complete) {
   if (sizeY() == 0)
     return;
 
   try {
-    const int nbInput = sizeY() + sizeY();  // Y and Y '
-    const int nbOutput = sizeY();
-    const int coeff = complete ? 1: 0;  // complete => jacobian @F/@y + cj.@F/@Y' else @F/@Y'
-    vector<double> jac(nbInput * nbOutput);
+    const double coeff = complete ? 1. : 0.;  // complete => jacobian @F/@y + cj.@F/@Y' else @F/@Y'
 
-    adept::Stack stack;
+    AdeptTape& tape = adeptTape();
+    adept::Stack& stack = *tape.stack_;
     stack.activate();
-    vector<adept::adouble> x(sizeY());
+    AdeptStackDeactivator deactivator(stack);
+    vector<adept::adouble>& x = tape.x_;
+    vector<adept::adouble>& xp = tape.xp_;
+    vector<adept::adouble>& output = tape.output_;
+    // the sizes differ between the models evaluated by this thread
+    x.resize(sizeY());
+    xp.resize(sizeY());
+    output.resize(sizeF());
     adept::set_values(&x[0], sizeY(), y);
-
-    vector<adept::adouble> xp(sizeY());
     adept::set_values(&xp[0], sizeY(), yp);
 
     stack.new_recording();
-    vector<adept::adouble> output(nbOutput);
     evalF(t, x, xp, output);
-    stack.independent(&x[0], static_cast<adept::uIndex>(x.size()));
-    stack.independent(&xp[0], static_cast<adept::uIndex>(xp.size()));
-    stack.dependent(&output[0], nbOutput);
+
+    JacobianPattern& pattern = jacobianPattern();
+    if (!pattern.isValid_ || discreteStateChanged(pattern))
+      computeJacobianPattern(stack, x, xp, output, pattern);
+
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
     Timer* timer1 = new Timer("ModelManager::evalJtAdept reading");
 #endif
-    stack.jacobian(&jac[0]);
-    stack.pause_recording();
+    evalCompressedJacobian(stack, x, xp, output, coeff, cj, pattern);
+    if (!checkCompressedJacobian(stack, x, xp, output, coeff, cj, pattern)) {
+      Trace::debug() << DYNLog(JacobianPatternOutdated, name()) << Trace::endline;
+      computeJacobianPattern(stack, x, xp, output, pattern);
+      evalCompressedJacobian(stack, x, xp, output, coeff, cj, pattern);
+    }
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
     delete timer1;
 #endif
 
-    const int offsetJPrim = sizeY() * sizeY();
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
     Timer* timer3 = new Timer("ModelManager::evalJtAdept filling");
 #endif
-
     for (unsigned int i = 0; i < sizeF(); ++i) {
       Jt.changeCol();
-      for (unsigned int j = 0; j < sizeY(); ++j) {
-        const int indice = i + j * sizeY();
-        const double term = coeff * jac[indice] + cj * jac[indice + offsetJPrim];
+      for (unsigned int k = pattern.eqBegin_[i]; k < pattern.eqBegin_[i + 1]; ++k) {
+        const double term = pattern.values_[k];
 #ifdef _DEBUG_
         if (isnan(term) || isinf(term)) {
-          throw DYNError(Error::MODELER, JacobianWithNanInf, name(), modelType(), staticId(), i, getFequationByLocalIndex(i), j);   // i is local index
+          throw DYNError(Error::MODELER, JacobianWithNanInf, name(), modelType(), staticId(), i, getFequationByLocalIndex(i),
+              pattern.varIndexes_[k]);   // i is local index
         }
 #endif
-        Jt.addTerm(j + rowOffset, term);
+        Jt.addTerm(pattern.varIndexes_[k] + rowOffset, term);
       }
     }
 
@@ -378,6 +473,160 @@ ModelManager::evalJtAdept(const double t, double* y, double* yp, const double cj
     throw DYNError(DYN::Error::MODELER, AdeptFailure);
   }
 }
+
+void
+ModelManager::computeJacobianPattern(adept::Stack& stack, vector<adept::adouble>& x, vector<adept::adouble>& xp,
+    const vector<adept::adouble>& output, JacobianPattern& pattern) const {
+#if defined(_DEBUG_) || defined(PRINT_TIMERS)
+  Timer timer("ModelManager::computeJacobianPattern");
+#endif
+  const unsigned nbVars = sizeY();
+  const unsigned nbEqs = sizeF();
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+
+  vector<vector<unsigned> > varsByEq(nbEqs);
+  vector<vector<unsigned> > eqsByVar(nbVars);
+  for (unsigned j = 0; j < nbVars; ++j) {
+    x[j].set_gradient(nan);
+    xp[j].set_gradient(nan);
+    stack.compute_tangent_linear();
+    for (unsigned i = 0; i < nbEqs; ++i) {
+      if (std::isnan(output[i].get_gradient())) {
+        varsByEq[i].push_back(j);
+        eqsByVar[j].push_back(i);
+      }
+    }
+    x[j].set_gradient(0.);
+    xp[j].set_gradient(0.);
+  }
+
+  pattern.eqBegin_.assign(nbEqs + 1, 0);
+  pattern.varIndexes_.clear();
+  for (unsigned i = 0; i < nbEqs; ++i) {
+    pattern.varIndexes_.insert(pattern.varIndexes_.end(), varsByEq[i].begin(), varsByEq[i].end());
+    pattern.eqBegin_[i + 1] = static_cast<unsigned>(pattern.varIndexes_.size());
+  }
+  pattern.values_.assign(pattern.varIndexes_.size(), 0.);
+
+  pattern.termsByVar_.assign(nbVars, vector<std::pair<unsigned, unsigned> >());
+  for (unsigned i = 0; i < nbEqs; ++i) {
+    for (unsigned k = pattern.eqBegin_[i]; k < pattern.eqBegin_[i + 1]; ++k)
+      pattern.termsByVar_[pattern.varIndexes_[k]].push_back(std::make_pair(i, k));
+  }
+
+  // greedy coloring: two variables used by the same residual function can not share a color
+  pattern.colors_.clear();
+  vector<int> colorOfVar(nbVars, -1);
+  vector<unsigned> forbiddenFor;  // for each color, last variable for which it is forbidden (+1)
+  for (unsigned j = 0; j < nbVars; ++j) {
+    if (eqsByVar[j].empty())
+      continue;
+    for (const auto i : eqsByVar[j]) {
+      for (const auto k : varsByEq[i]) {
+        if (colorOfVar[k] >= 0)
+          forbiddenFor[colorOfVar[k]] = j + 1;
+      }
+    }
+    unsigned color = 0;
+    while (color < forbiddenFor.size() && forbiddenFor[color] == j + 1)
+      ++color;
+    if (color == forbiddenFor.size()) {
+      forbiddenFor.push_back(0);
+      pattern.colors_.push_back(vector<unsigned>());
+    }
+    colorOfVar[j] = static_cast<int>(color);
+    pattern.colors_[color].push_back(j);
+  }
+  if (sizeZ() > 0)
+    pattern.z_.assign(zLocal_, zLocal_ + sizeZ());
+  else
+    pattern.z_.clear();
+  if (sizeG() > 0)
+    pattern.g_.assign(gLocal_, gLocal_ + sizeG());
+  else
+    pattern.g_.clear();
+  pattern.isValid_ = true;
+
+  Trace::debug() << DYNLog(JacobianPatternComputed, name(), pattern.varIndexes_.size(), pattern.colors_.size(), nbVars) << Trace::endline;
+}
+
+bool
+ModelManager::discreteStateChanged(const JacobianPattern& pattern) const {
+  if (pattern.z_.size() != sizeZ() || pattern.g_.size() != sizeG())
+    return true;
+  return !std::equal(pattern.z_.begin(), pattern.z_.end(), zLocal_) || !std::equal(pattern.g_.begin(), pattern.g_.end(), gLocal_);
+}
+
+void
+ModelManager::evalCompressedJacobian(adept::Stack& stack, vector<adept::adouble>& x, vector<adept::adouble>& xp,
+    const vector<adept::adouble>& output, const double coeff, const double cj, JacobianPattern& pattern) {
+  // one tangent sweep per color: the direction coeff.dy + cj.dy' directly gives the combined derivative
+  for (const auto& color : pattern.colors_) {
+    for (const auto j : color) {
+      x[j].set_gradient(coeff);
+      xp[j].set_gradient(cj);
+    }
+    stack.compute_tangent_linear();
+    for (const auto j : color) {
+      for (const auto& term : pattern.termsByVar_[j])
+        pattern.values_[term.second] = output[term.first].get_gradient();
+      x[j].set_gradient(0.);
+      xp[j].set_gradient(0.);
+    }
+  }
+}
+
+namespace {
+/**
+ * @brief weight of a variable in the direction used to check the compressed Jacobian
+ * @param j index of the variable
+ * @return weight of the variable, distinct from the weights of its neighbours
+ */
+inline double
+checkWeight(const unsigned j) {
+  return 1. + static_cast<double>(j % 61) / 64.;
+}
+}  // namespace
+
+bool
+ModelManager::checkCompressedJacobian(adept::Stack& stack, vector<adept::adouble>& x, vector<adept::adouble>& xp,
+    const vector<adept::adouble>& output, const double coeff, const double cj, const JacobianPattern& pattern) {
+  const unsigned nbVars = static_cast<unsigned>(x.size());
+  for (unsigned j = 0; j < nbVars; ++j) {
+    x[j].set_gradient(coeff * checkWeight(j));
+    xp[j].set_gradient(cj * checkWeight(j));
+  }
+  stack.compute_tangent_linear();
+  bool consistent = true;
+  for (unsigned i = 0; i < output.size() && consistent; ++i) {
+    double expected = 0.;
+    double scale = 0.;
+    for (unsigned k = pattern.eqBegin_[i]; k < pattern.eqBegin_[i + 1]; ++k) {
+      const double term = pattern.values_[k] * checkWeight(pattern.varIndexes_[k]);
+      expected += term;
+      scale += std::abs(term);
+    }
+    const double actual = output[i].get_gradient();
+    // written so that a NaN value is not consistent
+    consistent = std::abs(actual - expected) <= 1e-10 * (scale + std::abs(actual)) + 1e-14;
+  }
+  for (unsigned j = 0; j < nbVars; ++j) {
+    x[j].set_gradient(0.);
+    xp[j].set_gradient(0.);
+  }
+  return consistent;
+}
+
+size_t
+ModelManager::JacobianPattern::getMemoryUsage() const {
+  size_t memoryUsage = MemoryUsage::bytes(eqBegin_) + MemoryUsage::bytes(varIndexes_) + MemoryUsage::bytes(values_)
+      + MemoryUsage::bytes(termsByVar_) + MemoryUsage::bytes(colors_) + MemoryUsage::bytes(z_) + MemoryUsage::bytes(g_);
+  for (const auto& terms : termsByVar_)
+    memoryUsage += MemoryUsage::bytes(terms);
+  for (const auto& color : colors_)
+    memoryUsage += MemoryUsage::bytes(color);
+  return memoryUsage;
+}
 #endif
 
 void
@@ -391,12 +640,61 @@ ModelManager::evalG(const double t) {
   delayManager_.setGomc(gLocal_, modelData()->nZeroCrossings, t);
 }
 
+void
+ModelManager::prepareBatch(const double t, SubModel* const* subModels, const unsigned int nbSubModels) {
+  batchInstances_.resize(nbSubModels);
+  for (unsigned int i = 0; i < nbSubModels; ++i) {
+    // the sub models of a batch share the class of their Modelica model, hence are model managers
+    ModelManager* subModel = static_cast<ModelManager*>(subModels[i]);
+    subModel->setManagerTime(t);
+    batchInstances_[i] = subModel->modelModelica();
+  }
+}
+
+const void*
+ModelManager::getBatchKey() const {
+  return &typeid(*modelModelica());
+}
+
+void
+ModelManager::evalFBatchKernel(const double t, const propertyF_t type, SubModel* const* subModels, const unsigned int nbSubModels) {
+#if defined(_DEBUG_) || defined(PRINT_TIMERS)
+  Timer timer("ModelManager::evalFBatch");
+#endif
+  prepareBatch(t, subModels, nbSubModels);
+  batchF_.resize(nbSubModels);
+  for (unsigned int i = 0; i < nbSubModels; ++i)
+    batchF_[i] = static_cast<ModelManager*>(subModels[i])->fLocal_;
+
+  modelModelica()->setFomcBatch(&batchInstances_[0], &batchF_[0], nbSubModels, type);
+}
+
+void
+ModelManager::evalGBatchKernel(const double t, SubModel* const* subModels, const unsigned int nbSubModels) {
+#if defined(_DEBUG_) || defined(PRINT_TIMERS)
+  Timer timer("ModelManager::evalGBatch");
+#endif
+  prepareBatch(t, subModels, nbSubModels);
+  batchG_.resize(nbSubModels);
+  for (unsigned int i = 0; i < nbSubModels; ++i)
+    batchG_[i] = static_cast<ModelManager*>(subModels[i])->gLocal_;
+
+  modelModelica()->setGomcBatch(&batchInstances_[0], &batchG_[0], nbSubModels);
+  for (unsigned int i = 0; i < nbSubModels; ++i) {
+    ModelManager* subModel = static_cast<ModelManager*>(subModels[i]);
+    subModel->delayManager_.setGomc(subModel->gLocal_, subModel->modelData()->nZeroCrossings, t);
+  }
+}
+
 void
 ModelManager::evalJt(const double t, const double cj, const int rowOffset, SparseMatrix& jt) {
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
   Timer timer("ModelManager::evalJ");
 #endif
 
+  setManagerTime(t);
+  if (modelModelica()->evalJt_omc(yLocal_, ypLocal_, cj, 1., rowOffset, jt))
+    return;
 #ifdef _ADEPT_
   evalJtAdept(t, yLocal_, ypLocal_, cj, jt, rowOffset, true);
 #else
@@ -411,6 +709,9 @@ ModelManager::evalJtPrim(const double t, const double cj, const int rowOffset, S
   Timer timer("ModelManager::evalJPrim");
 #endif
 
+  setManagerTime(t);
+  if (modelModelica()->evalJt_omc(yLocal_, ypLocal_, cj, 0., rowOffset, jtPrim))
+    return;
 #ifdef _ADEPT_
   evalJtAdept(t, yLocal_, ypLocal_, cj, jtPrim, rowOffset, false);
 #else
@@ -432,7 +733,13 @@ modeChangeType_t
 ModelManager::evalMode(const double t) {
   modeChangeType_t delay_mode = delayManager_.evalMode(t, name());
 
-  return std::max(delay_mode, modelModelica()->evalMode(t));
+  const modeChangeType_t modeChangeType = std::max(delay_mode, modelModelica()->evalMode(t));
+#ifdef _ADEPT_
+  // the equations structure may have changed, and so the recorded operations
+  if (modeChangeType != NO_MODE)
+    jacobianPattern().isValid_ = false;
+#endif
+  return modeChangeType;
 }
 
 void
@@ -477,36 +784,39 @@ ModelManager::collectSilentZ(BitMask* silentZTable) {
 void
 ModelManager::setSharedParametersDefaultValues(const bool isInit, const parameterOrigin_t& origin) {
   ModelModelica * model = isInit ? modelModelicaInit() : modelModelicaDynamic();
-  const std::shared_ptr<parameters::ParametersSet> sharedParametersInitialValues = model->setSharedParametersDefaultValues();
+  const vector<std::shared_ptr<parameters::Parameter> >& sharedParametersInitialValues = sharedParametersDefaultValues(model);
   const std::unordered_map<string, ParameterModeler>& parameters = isInit ? getParametersInit() : getParametersDynamic();
 
-  for (const auto& parameterPair : parameters) {
-    const ParameterModeler& currentParameter = parameterPair.second;
-    const string& paramName = currentParameter.getName();
+  for (const auto& sharedParameter : sharedParametersInitialValues) {
+    const string paramName = sharedParameter->getName();
+    const auto itParameter = parameters.find(paramName);
+    if (itParameter == parameters.end())
+      continue;
+    const ParameterModeler& currentParameter = itParameter->second;
 
-    if (currentParameter.isUnitary() && sharedParametersInitialValues->hasParameter(paramName)) {
+    if (currentParameter.isUnitary()) {
       switch (currentParameter.getValueType()) {
       case VAR_TYPE_BOOL:
       {
-        const bool value = sharedParametersInitialValues->getParameter(paramName)->getBool();
+        const bool value = sharedParameter->getBool();
         setParameterValue(paramName, origin, value, isInit);
         break;
       }
       case VAR_TYPE_INT:
       {
-        const int value = sharedParametersInitialValues->getParameter(paramName)->getInt();
+        const int value = sharedParameter->getInt();
         setParameterValue(paramName, origin, value, isInit);
         break;
       }
       case VAR_TYPE_DOUBLE:
       {
-        const double& value = sharedParametersInitialValues->getParameter(paramName)->getDouble();
+        const double& value = sharedParameter->getDouble();
         setParameterValue(paramName, origin, value, isInit);
         break;
       }
       case VAR_TYPE_STRING:
       {
-        const string& value = sharedParametersInitialValues->getParameter(paramName)->getString();
+        const string& value = sharedParameter->getString();
         setParameterValue(paramName, origin, value, isInit);
         break;
       }
@@ -593,10 +903,8 @@ ModelManager::dumpParameters(map< string, string >& mapParameters) {
   for (unsigned int i = 0; i < modelData()->nParametersString; ++i) {
     paramsString.push_back(simulationInfo()->stringParameter[i]);
   }
-  std::vector<std::string> delays = delayManager_.dumpDelays();
-  for (const auto& delay : delays) {
-    paramsString.push_back(delay);
-  }
+  vector<double> delays;
+  delayManager_.dumpDelays(delays);
 
   os << cSum;
   os << cSumInit;
@@ -604,6 +912,7 @@ ModelManager::dumpParameters(map< string, string >& mapParameters) {
   os << paramsBool;
   os << paramsInt;
   os << paramsString;
+  os << delays;
 
   mapParameters[ parametersFileName() ] = parameters.str();
 }
@@ -798,6 +1107,44 @@ ModelManager::loadVariables(const string& variables) {
   std::copy(valuesRelations.begin(), valuesRelations.end(), simulationInfo()->relations);
 }
 
+void
+ModelManager::snapshotSpecificState(StateBuffer& state) const {
+  // real, discrete and integer variables and their derivatives are stored in the buffers of the model
+  const unsigned int nbBoolean = static_cast<unsigned int>(modelData()->nVariablesBoolean);
+  const unsigned int nbRelations = static_cast<unsigned int>(modelData()->nRelations);
+  state.write(data()->localData[0]->booleanVars, nbBoolean);
+  state.write(simulationInfo()->relations, nbRelations);
+  state.write(data()->constCalcVars);
+
+  // values of the previous time step, used to detect the discrete changes
+  state.write(simulationInfo()->realVarsPre, static_cast<unsigned int>(modelData()->nVariablesReal));
+  state.write(simulationInfo()->booleanVarsPre, nbBoolean);
+  state.write(simulationInfo()->discreteVarsPre, static_cast<unsigned int>(data()->nbZ));
+  state.write(simulationInfo()->integerDoubleVarsPre, static_cast<unsigned int>(modelData()->nVariablesInteger));
+  state.write(simulationInfo()->relationsPre, nbRelations);
+
+  delayManager_.snapshotDelays(state);
+}
+
+void
+ModelManager::restoreSpecificState(StateBuffer::Reader& state) {
+  setManagerTime(getCurrentTime());
+
+  const unsigned int nbBoolean = static_cast<unsigned int>(modelData()->nVariablesBoolean);
+  const unsigned int nbRelations = static_cast<unsigned int>(modelData()->nRelations);
+  state.read(data()->localData[0]->booleanVars, nbBoolean);
+  state.read(simulationInfo()->relations, nbRelations);
+  state.read(data()->constCalcVars);
+
+  state.read(simulationInfo()->realVarsPre, static_cast<unsigned int>(modelData()->nVariablesReal));
+  state.read(simulationInfo()->booleanVarsPre, nbBoolean);
+  state.read(simulationInfo()->discreteVarsPre, static_cast<unsigned int>(data()->nbZ));
+  state.read(simulationInfo()->integerDoubleVarsPre, static_cast<unsigned int>(modelData()->nVariablesInteger));
+  state.read(simulationInfo()->relationsPre, nbRelations);
+
+  delayManager_.restoreDelays(state);
+}
+
 void
 ModelManager::loadParameters(const string& parameters) {
   stringstream params(parameters);
@@ -845,10 +1192,16 @@ ModelManager::loadParameters(const string& parameters) {
   for (unsigned int i = 0; i < static_cast<unsigned>(modelData()->nParametersString); ++i)
     simulationInfo()->stringParameter[i] = parameterStringValues[i].c_str();
 
-  std::vector<std::string> delay_def(parameterStringValues.begin() + static_cast<unsigned>(modelData()->nParametersString), parameterStringValues.end());
-
-  if (!delayManager_.loadDelays(delay_def, getCurrentTime())) {
-    throw DYNError(Error::MODELER, WrongDataNum, parametersFileName().c_str());
+  // the delays are written in binary after the parameters, the dumps of the previous versions formatting them as strings
+  if (parameterStringValues.size() > static_cast<unsigned>(modelData()->nParametersString)) {
+    std::vector<std::string> delay_def(parameterStringValues.begin() + static_cast<unsigned>(modelData()->nParametersString), parameterStringValues.end());
+    if (!delayManager_.loadDelays(delay_def, getCurrentTime()))
+      throw DYNError(Error::MODELER, WrongDataNum, parametersFileName().c_str());
+  } else if (params.rdbuf()->in_avail() > 0) {
+    vector<double> delays;
+    is >> delays;
+    if (!delayManager_.loadDelays(delays, getCurrentTime()))
+      throw DYNError(Error::MODELER, WrongDataNum, parametersFileName().c_str());
   }
 
   // To activate all delays
@@ -1027,7 +1380,6 @@ ModelManager::solveParameters() {
     Trace::warn() << DYNLog(SolveParametersError, name()) << Trace::endline;
 
 #ifdef _DEBUG_
-  setFequationsInit();
   double tolerance = 1e-4;
   const unsigned nbErr = 10;
 
@@ -1060,7 +1412,7 @@ void
 ModelManager::setCalculatedParameters(vector<double>& y, vector<double>& z, const vector<double>& calculatedVars) {
   // Creates reversed alias map
   map<string, vector<shared_ptr<VariableAlias> > > reversedAlias;
-  for (const auto& variableByNameInitPair : variablesByNameInit_) {
+  for (const auto& variableByNameInitPair : variablesByNameInit()) {
     // map of nativeVarName -> aliasNames
     if (variableByNameInitPair.second->isAlias()) {
       const shared_ptr<VariableAlias> variable = boost::dynamic_pointer_cast<VariableAlias>(variableByNameInitPair.second);
@@ -1416,8 +1768,10 @@ ModelManager::evalJCalculatedVarI(unsigned iCalculatedVar, std::vector<double>&
     assert(res.size() == size);
     size_t nbInput = size;
 
-    adept::Stack stack;
+    // the stack of the thread is reused, the active variables being released before it is deactivated
+    adept::Stack& stack = *adeptTape().stack_;
     stack.activate();
+    AdeptStackDeactivator deactivator(stack);
     vector<adept::adouble> x(nbInput);
     vector<adept::adouble> xp(nbInput);
     for (size_t i = 0; i < size; ++i) {
@@ -1432,7 +1786,6 @@ ModelManager::evalJCalculatedVarI(unsigned iCalculatedVar, std::vector<double>&
     for (size_t i = 0; i < size; ++i) {
       res[i] = x[i].get_gradient();
     }
-    stack.pause_recording();
   } catch (adept::stack_already_active & e) {
     std::cerr << "Error :" << e.what() << std::endl;
     throw DYNError(DYN::Error::MODELER, AdeptFailure);
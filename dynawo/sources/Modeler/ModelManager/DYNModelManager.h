@@ -20,6 +20,7 @@
 #ifndef MODELER_MODELMANAGER_DYNMODELMANAGER_H_
 #define MODELER_MODELMANAGER_DYNMODELMANAGER_H_
 
+#include <memory>
 #include <vector>
 #include <set>
 #include <map>
@@ -81,6 +82,13 @@ class ModelManager : public SubModel, private boost::noncopyable {
    */
   void evalG(double t) override;
 
+  /**
+   * @brief get the key of the batches of this sub model: the class of its current Modelica model
+   *
+   * @return key of the batches of this sub model
+   */
+  const void* getBatchKey() const override;
+
   /**
    * @copydoc SubModel::evalZ(const double t) override
    */
@@ -91,6 +99,15 @@ class ModelManager : public SubModel, private boost::noncopyable {
    */
   modeChangeType_t evalMode(double t) override;
 
+  /**
+   * @copydoc SubModel::discreteChangesOnlyOnEvents() const
+   *
+   * The when clauses, the relations and the delays of a Modelica model are all monitored by its root functions.
+   */
+  bool discreteChangesOnlyOnEvents() const override {
+    return true;
+  }
+
   /**
    * @copydoc SubModel::evalJt(double t, double cj, int rowOffset, SparseMatrix& jt)
    */
@@ -208,6 +225,16 @@ class ModelManager : public SubModel, private boost::noncopyable {
    */
   void loadVariables(const std::string& variables) override;
 
+  /**
+   * @copydoc SubModel::snapshotSpecificState(StateBuffer& state) const
+   */
+  void snapshotSpecificState(StateBuffer& state) const override;
+
+  /**
+   * @copydoc SubModel::restoreSpecificState(StateBuffer::Reader& state)
+   */
+  void restoreSpecificState(StateBuffer::Reader& state) override;
+
   /**
    * @copydoc SubModel::initParams() override;
    */
@@ -247,6 +274,15 @@ class ModelManager : public SubModel, private boost::noncopyable {
    */
   void defineElements(std::vector<Element>& elements, std::map<std::string, int>& mapElement) override;
 
+  /**
+   * @copydoc SubModel::hasStaticDefinitions() const
+   *
+   * The variables and elements of a Modelica model are generated with its library and never depend on its data.
+   */
+  bool hasStaticDefinitions() const override {
+    return true;
+  }
+
   /**
    * @brief evaluate the value of a calculated variable
    *
@@ -369,6 +405,11 @@ class ModelManager : public SubModel, private boost::noncopyable {
    */
   bool hasDataCheckCoherence() const override;
 
+  /**
+   * @copydoc SubModel::accountMemory(MemoryUsage& usage) const
+   */
+  void accountMemory(MemoryUsage& usage) const override;
+
  private:
 #ifdef _ADEPT_
 
@@ -394,6 +435,127 @@ class ModelManager : public SubModel, private boost::noncopyable {
    * @param complete @b true if \f$( J=@F/@x + cj * @F/@x')\f$ else \f$( J = @F/@x')\f$
    */
   void evalJtAdept(double t, double *y, double* yp, double cj, SparseMatrix& Jt, int rowOffset, bool complete = true);
+
+  /**
+   * @brief sparsity pattern of the Jacobian of the residual functions and associated compression of the variables
+   */
+  struct JacobianPattern {
+    /**
+     * @brief default constructor
+     */
+    JacobianPattern() : isValid_(false) { }
+
+    bool isValid_;  ///< @b false if the pattern has to be computed again
+    std::vector<unsigned> eqBegin_;  ///< for each residual function, index of its first term in varIndexes_ and values_
+    std::vector<unsigned> varIndexes_;  ///< variable index of each term, sorted by residual function then by variable
+    std::vector<double> values_;  ///< value of each term
+    std::vector<std::vector<std::pair<unsigned, unsigned> > > termsByVar_;  ///< for each variable, residual function and term index depending on it
+    std::vector<std::vector<unsigned> > colors_;  ///< groups of variables without any common residual function
+    std::vector<double> z_;  ///< discrete variables values when the pattern was computed
+    std::vector<state_g> g_;  ///< root functions states when the pattern was computed
+
+    /**
+     * @brief get the memory allocated by the pattern
+     *
+     * @return number of bytes allocated
+     */
+    size_t getMemoryUsage() const;
+  };
+
+  /**
+   * @brief compute the sparsity pattern of the Jacobian from the current Adept recording
+   *
+   * A NaN tangent is propagated from each variable: every residual function whose tangent becomes NaN depends
+   * on this variable on the tape, even through a null partial derivative. The variables are then greedily colored
+   * so that the variables of the same color do not appear in the same residual function.
+   *
+   * @param stack Adept stack containing the recording of the residual functions
+   * @param x active continuous variables
+   * @param xp active derivatives of the continuous variables
+   * @param output active residual functions
+   * @param pattern pattern to fill
+   */
+  void computeJacobianPattern(adept::Stack& stack, std::vector<adept::adouble>& x, std::vector<adept::adouble>& xp,
+      const std::vector<adept::adouble>& output, JacobianPattern& pattern) const;
+
+  /**
+   * @brief check whether the discrete state of the model changed since the computation of the Jacobian pattern
+   *
+   * The branches taken by the residual functions, and so their recorded operations, depend on the discrete variables
+   * and on the root functions states: the pattern is only reused as long as none of them changed.
+   *
+   * @param pattern Jacobian pattern to check
+   * @return @b true if a discrete variable or a root function state changed
+   */
+  bool discreteStateChanged(const JacobianPattern& pattern) const;
+
+  /**
+   * @brief evaluate the terms of the Jacobian with one tangent sweep per color of the pattern
+   *
+   * @param stack Adept stack containing the recording of the residual functions
+   * @param x active continuous variables
+   * @param xp active derivatives of the continuous variables
+   * @param output active residual functions
+   * @param coeff coefficient of the derivatives with respect to the variables
+   * @param cj coefficient of the derivatives with respect to the derivatives of the variables
+   * @param pattern pattern whose values are filled
+   */
+  static void evalCompressedJacobian(adept::Stack& stack, std::vector<adept::adouble>& x, std::vector<adept::adouble>& xp,
+      const std::vector<adept::adouble>& output, double coeff, double cj, JacobianPattern& pattern);
+
+  /**
+   * @brief check that the terms evaluated with the pattern match the current recording
+   *
+   * A branch switching without any discrete change (noEvent, min, max, abs...) may make a residual function depend
+   * on a variable missing from the pattern. A single tangent sweep along a direction mixing all the variables with
+   * distinct weights is compared with the same combination of the compressed terms: they only match if no dependency is missing.
+   *
+   * @param stack Adept stack containing the recording of the residual functions
+   * @param x active continuous variables
+   * @param xp active derivatives of the continuous variables
+   * @param output active residual functions
+   * @param coeff coefficient of the derivatives with respect to the variables
+   * @param cj coefficient of the derivatives with respect to the derivatives of the variables
+   * @param pattern pattern whose values were evaluated
+   * @return @b true if the compressed terms are consistent with the recording
+   */
+  static bool checkCompressedJacobian(adept::Stack& stack, std::vector<adept::adouble>& x, std::vector<adept::adouble>& xp,
+      const std::vector<adept::adouble>& output, double coeff, double cj, const JacobianPattern& pattern);
+
+  /**
+   * @brief Adept stack and active variables kept between two Jacobian evaluations
+   *
+   * Adept records the partial derivatives values so the recording itself can not be replayed at a new point,
+   * but keeping the stack and the active variables avoids to allocate them again at each evaluation.
+   * Adept allows one active stack per thread: each thread has its own tape, reused by all the models it evaluates,
+   * so that the models of the different partitions are evaluated concurrently without any stack allocation.
+   * The stack is only active during an evaluation so that other stacks may be used in between.
+   */
+  struct AdeptTape {
+    /**
+     * @brief destructor: the active variables have to be released while their stack is active
+     */
+    ~AdeptTape();
+
+    std::unique_ptr<adept::Stack> stack_;  ///< stack reused for each evaluation, nullptr before the first one
+    std::vector<adept::adouble> x_;  ///< active continuous variables
+    std::vector<adept::adouble> xp_;  ///< active derivatives of the continuous variables
+    std::vector<adept::adouble> output_;  ///< active residual functions
+  };
+
+  /**
+   * @brief get the Adept tape of the calling thread, its stack being allocated at the first call
+   * @return Adept tape of the calling thread
+   */
+  static AdeptTape& adeptTape();
+
+  /**
+   * @brief get the Jacobian pattern of the model currently used
+   * @return Jacobian pattern of the model currently used
+   */
+  JacobianPattern& jacobianPattern() {
+    return modelInitUsed_ ? jacobianPatternInit_ : jacobianPatternDyn_;
+  }
 #endif
 
   /**
@@ -533,6 +695,43 @@ class ModelManager : public SubModel, private boost::noncopyable {
    */
   virtual bool hasInit() const = 0;
 
+#ifdef _ADEPT_
+  /**
+   * @brief get the size of the Jacobian pattern of the model currently used
+   *
+   * @param nbTerms number of non zero terms of the pattern
+   * @param nbColors number of tangent sweeps needed to evaluate the pattern
+   * @return @b false if the pattern has to be computed again
+   */
+  bool getJacobianPatternSize(unsigned& nbTerms, unsigned& nbColors) {
+    const JacobianPattern& pattern = jacobianPattern();
+    nbTerms = static_cast<unsigned>(pattern.varIndexes_.size());
+    nbColors = static_cast<unsigned>(pattern.colors_.size());
+    return pattern.isValid_;
+  }
+#endif
+
+ protected:
+  /**
+   * @copydoc SubModel::evalFBatchKernel(double t, propertyF_t type, SubModel* const* subModels, unsigned int nbSubModels)
+   */
+  void evalFBatchKernel(double t, propertyF_t type, SubModel* const* subModels, unsigned int nbSubModels) override;
+
+  /**
+   * @copydoc SubModel::evalGBatchKernel(double t, SubModel* const* subModels, unsigned int nbSubModels)
+   */
+  void evalGBatchKernel(double t, SubModel* const* subModels, unsigned int nbSubModels) override;
+
+ private:
+  /**
+   * @brief set the time of the sub models of a batch and gather their Modelica models
+   *
+   * @param t Simulation instant
+   * @param subModels sub models of the batch, of the same class as this sub model
+   * @param nbSubModels number of sub models of the batch
+   */
+  void prepareBatch(double t, SubModel* const* subModels, unsigned int nbSubModels);
+
  protected:
   ModelModelica* modelInit_;  ///< dynamic init model
   ModelModelica* modelDyn_;  ///< dynamic model
@@ -541,6 +740,11 @@ class ModelManager : public SubModel, private boost::noncopyable {
   std::string modelType_;  ///< model type
   DelayManager delayManager_;  ///< manager of delayed values
 
+ private:
+  std::vector<ModelModelica*> batchInstances_;  ///< Modelica models of the batch being evaluated
+  std::vector<double*> batchF_;  ///< residual functions of the batch being evaluated
+  std::vector<state_g*> batchG_;  ///< root functions of the batch being evaluated
+
  private:
   /**
    * @brief returns the relevant instance of DYNDATA
@@ -628,6 +832,10 @@ class ModelManager : public SubModel, private boost::noncopyable {
 
  private:
   bool modelInitUsed_;  ///< whether init model is used
+#ifdef _ADEPT_
+  JacobianPattern jacobianPatternInit_;  ///< Jacobian pattern of the init model
+  JacobianPattern jacobianPatternDyn_;  ///< Jacobian pattern of the dynamic model
+#endif
 };
 
 }  // namespace DYN
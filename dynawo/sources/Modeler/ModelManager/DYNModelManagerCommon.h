@@ -326,15 +326,20 @@ inline modelica_boolean GreaterEq<double>(double a, double b) {
  */
 #define DYNTimelineFromModelica(key, ...) (DYN::MessageTimeline(DYN::KeyTimeline_t::names(DYN::KeyTimeline_t::value(key))), ##__VA_ARGS__ )
 
-#define addLogEvent1(key) if ((this)->getModelManager()->hasTimeline()) \
+#define addLogEvent1(key) \
+  if ((this)->getModelManager()->acceptsTimelineEvent(DYN::KeyTimeline_t::names(DYN::KeyTimeline_t::value(key)))) \
   addLogEvent_((this)->getModelManager(), DYNTimelineFromModelica(key))
-#define addLogEvent2(key, arg1) if ((this)->getModelManager()->hasTimeline()) \
+#define addLogEvent2(key, arg1) \
+  if ((this)->getModelManager()->acceptsTimelineEvent(DYN::KeyTimeline_t::names(DYN::KeyTimeline_t::value(key)))) \
   addLogEvent_((this)->getModelManager(), DYNTimelineFromModelica(key, arg1))
-#define addLogEvent3(key, arg1, arg2) if ((this)->getModelManager()->hasTimeline()) \
+#define addLogEvent3(key, arg1, arg2) \
+  if ((this)->getModelManager()->acceptsTimelineEvent(DYN::KeyTimeline_t::names(DYN::KeyTimeline_t::value(key)))) \
   addLogEvent_((this)->getModelManager(), DYNTimelineFromModelica(key, arg1, arg2))
-#define addLogEvent4(key, arg1, arg2, arg3) if ((this)->getModelManager()->hasTimeline()) \
+#define addLogEvent4(key, arg1, arg2, arg3) \
+  if ((this)->getModelManager()->acceptsTimelineEvent(DYN::KeyTimeline_t::names(DYN::KeyTimeline_t::value(key)))) \
   addLogEvent_((this)->getModelManager(), DYNTimelineFromModelica(key, arg1, arg2, arg3))
-#define addLogEvent5(key, arg1, arg2, arg3, arg4) if ((this)->getModelManager()->hasTimeline()) \
+#define addLogEvent5(key, arg1, arg2, arg3, arg4) \
+  if ((this)->getModelManager()->acceptsTimelineEvent(DYN::KeyTimeline_t::names(DYN::KeyTimeline_t::value(key)))) \
   addLogEvent_((this)->getModelManager(), DYNTimelineFromModelica(key, arg1, arg2, arg3, arg4))
 
 #define addLogEventRaw1(key) if ((this)->getModelManager()->hasTimeline()) \
@@ -40,6 +40,7 @@ namespace DYN {
 class ParameterModeler;
 class Element;
 class ModelManager;
+class SparseMatrix;
 class Variable;
 
 #ifdef __clang__
@@ -88,6 +89,35 @@ class ModelModelica {
    */
   virtual void setGomc(state_g* g) = 0;
 
+  /**
+   * @brief calculates the residual functions of several instances of the model
+   *
+   * The generated models evaluate all the instances in a single loop over their non-virtual kernel.
+   *
+   * @param instances instances of the model, of the same type as this model
+   * @param f local buffer to fill of each instance
+   * @param nbInstances number of instances
+   * @param type type of the residues to compute (algebraic, differential or both)
+   */
+  virtual void setFomcBatch(ModelModelica* const* instances, double* const* f, const unsigned int nbInstances, const propertyF_t type) {
+    for (unsigned int i = 0; i < nbInstances; ++i)
+      instances[i]->setFomc(f[i], type);
+  }
+
+  /**
+   * @brief calculates the roots of several instances of the model
+   *
+   * The generated models evaluate all the instances in a single loop over their non-virtual kernel.
+   *
+   * @param instances instances of the model, of the same type as this model
+   * @param g local buffer to fill of each instance
+   * @param nbInstances number of instances
+   */
+  virtual void setGomcBatch(ModelModelica* const* instances, state_g* const* g, const unsigned int nbInstances) {
+    for (unsigned int i = 0; i < nbInstances; ++i)
+      instances[i]->setGomc(g[i]);
+  }
+
   /**
    * @brief check whether a mode has been triggered
    *
@@ -160,6 +190,19 @@ class ModelModelica {
   virtual void evalFAdept(const std::vector<adept::adouble>& y, const std::vector<adept::adouble>& yp, std::vector<adept::adouble>& F) = 0;
 #endif
 
+  /**
+   * @brief compute the transposed jacobian with the analytic derivatives generated with the model
+   *
+   * @param y values of the continuous variables
+   * @param yp values of the derivatives of the continuous variables
+   * @param cj coefficient of the derivatives with respect to yp
+   * @param coeff coefficient of the derivatives with respect to y
+   * @param rowOffset offset to use to identify the row
+   * @param jt transposed jacobian to fill
+   * @return @b false if the equations of the model could not be differentiated when it was generated
+   */
+  virtual bool evalJt_omc(const double* y, const double* yp, double cj, double coeff, int rowOffset, SparseMatrix& jt) = 0;
+
   /**
    * @brief ensure data coherence (asserts, min/max, sanity checks...)
    *
@@ -197,6 +197,25 @@ static size_t findRowIndex(const double* table, size_t nRow, size_t nCol,
         return last;
     }
 
+    /* Interpolation guess, exact on uniformly spaced abscissae */
+    if (x >= TABLE_COL0(0) && x < TABLE_COL0(nRow - 1)) {
+        size_t i = (size_t)((x - TABLE_COL0(0))/(TABLE_COL0(nRow - 1) - TABLE_COL0(0))*(double)(nRow - 1));
+        if (i > nRow - 2) {
+            i = nRow - 2;
+        }
+        if (x < TABLE_COL0(i)) {
+            if (i < i1) {
+                i1 = i;
+            }
+        } else if (x >= TABLE_COL0(i + 1)) {
+            if (i + 1 > i0) {
+                i0 = i + 1;
+            }
+        } else {
+            return i;
+        }
+    }
+
     /* Binary search */
     while (i1 > i0 + 1) {
         const size_t i = (i0 + i1)/2;
@@ -221,6 +240,25 @@ static size_t findColIndex(const double* table, size_t nCol, size_t last,
         return last;
     }
 
+    /* Interpolation guess, exact on uniformly spaced abscissae */
+    if (x >= TABLE_ROW0(0) && x < TABLE_ROW0(nCol - 1)) {
+        size_t i = (size_t)((x - TABLE_ROW0(0))/(TABLE_ROW0(nCol - 1) - TABLE_ROW0(0))*(double)(nCol - 1));
+        if (i > nCol - 2) {
+            i = nCol - 2;
+        }
+        if (x < TABLE_ROW0(i)) {
+            if (i < i1) {
+                i1 = i;
+            }
+        } else if (x >= TABLE_ROW0(i + 1)) {
+            if (i + 1 > i0) {
+                i0 = i + 1;
+            }
+        } else {
+            return i;
+        }
+    }
+
     /* Binary search */
     while (i1 > i0 + 1) {
         const size_t i = (i0 + i1)/2;
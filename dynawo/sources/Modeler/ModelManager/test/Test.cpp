@@ -11,6 +11,7 @@
 // simulation tool for power systems.
 //
 
+#include <thread>
 
 #include "gtest_dynawo.h"
 #include "PARParametersSet.h"
@@ -41,7 +42,9 @@ class MyModelica: public ModelModelica {
     nbCallDynamicFType_(0),
     nbCallStaticYType_(0),
     nbCallDynamicYType_(0),
-    nbCallCheckDataCoherence_(0)  { }
+    nbCallCheckDataCoherence_(0),
+    analyticJacobian_(false),
+    branchingEquations_(false) { }
 
  public:
   /**
@@ -199,11 +202,50 @@ class MyModelica: public ModelModelica {
     ASSERT_EQ(y.size(), 2);
     ASSERT_EQ(yp.size(), 2);
     ASSERT_EQ(F.size(), 2);
+    if (branchingEquations_) {
+      // diagonal Jacobian as long as the branch is not taken, without any discrete variable to announce the switch
+      F[0] = 2*y[0];
+      F[1] = 0.5*y[1];
+      if (y[0] > 5.)
+        F[1] += y[0]*y[1];
+      return;
+    }
     F[0] = 2*y[0]+yp[1];
     F[1] = 0.5*y[1]-yp[0];
   }
 #endif
 
+  /**
+   * @brief compute the transposed jacobian with the analytic derivatives, if enabled
+   *
+   * @param y values of the continuous variables
+   * @param yp values of the derivatives of the continuous variables
+   * @param cj coefficient of the derivatives with respect to yp
+   * @param coeff coefficient of the derivatives with respect to y
+   * @param rowOffset offset to use to identify the row
+   * @param jt transposed jacobian to fill
+   * @return @b false if the analytic jacobian is not enabled
+   */
+  bool evalJt_omc(const double* /*y*/, const double* /*yp*/, const double cj, const double coeff, const int rowOffset, SparseMatrix& jt) override {
+    if (!analyticJacobian_)
+      return false;
+    jt.changeCol();
+    jt.addTerm(0 + rowOffset, 2. * coeff);
+    jt.addTerm(1 + rowOffset, cj);
+    jt.changeCol();
+    jt.addTerm(0 + rowOffset, -cj);
+    jt.addTerm(1 + rowOffset, 0.5 * coeff);
+    return true;
+  }
+
+  void setAnalyticJacobian(const bool analyticJacobian) {
+    analyticJacobian_ = analyticJacobian;
+  }
+
+  void setBranchingEquations(const bool branchingEquations) {
+    branchingEquations_ = branchingEquations;
+  }
+
   /**
    * @brief ensure data coherence (asserts, min/max, sanity checks...)
    *
@@ -335,6 +377,8 @@ class MyModelica: public ModelModelica {
   unsigned nbCallStaticYType_;
   unsigned nbCallDynamicYType_;
   unsigned nbCallCheckDataCoherence_;
+  bool analyticJacobian_;
+  bool branchingEquations_;
 };
 
 void MyModelica::defineVariables(std::vector<boost::shared_ptr<Variable> >& variables) {
@@ -516,6 +560,26 @@ class MyModelManager : public ModelManager {
     ASSERT_EQ(dynamic_cast<MyModelica*>(modelDyn_)->getNbCallCheckDataCoherence(), ref);
   }
 
+  void setAnalyticJacobian(const bool analyticJacobian) {
+    dynamic_cast<MyModelica*>(modelDyn_)->setAnalyticJacobian(analyticJacobian);
+  }
+
+  void setBranchingEquations(const bool branchingEquations) {
+    dynamic_cast<MyModelica*>(modelDyn_)->setBranchingEquations(branchingEquations);
+  }
+
+#ifdef _ADEPT_
+  void testJacobianPattern(const bool valid, const unsigned nbTermsRef, const unsigned nbColorsRef) {
+    unsigned nbTerms = 0;
+    unsigned nbColors = 0;
+    ASSERT_EQ(getJacobianPatternSize(nbTerms, nbColors), valid);
+    if (!valid)
+      return;
+    ASSERT_EQ(nbTerms, nbTermsRef);
+    ASSERT_EQ(nbColors, nbColorsRef);
+  }
+#endif
+
  protected:
   bool hasInit() const override {
     return true;
@@ -625,6 +689,22 @@ TEST(TestModelManager, TestModelManagerBasics) {
   ASSERT_EQ(smj2.Ap_[1], 1);
   ASSERT_EQ(smj2.Ap_[2], 2);
 
+  // the analytic jacobian generated with the model is used instead of Adept
+  mm->setAnalyticJacobian(true);
+  SparseMatrix smjAnalytic;
+  smjAnalytic.init(size, size);
+  mm->evalJt(0., 1., 0, smjAnalytic);
+  ASSERT_EQ(smjAnalytic.nbElem(), smj.nbElem());
+  for (int i = 0; i < smj.nbElem(); ++i)
+    ASSERT_DOUBLE_EQUALS_DYNAWO(smjAnalytic.Ax_[i], smj.Ax_[i]);
+  SparseMatrix smj2Analytic;
+  smj2Analytic.init(size, size);
+  mm->evalJtPrim(0., 1., 0, smj2Analytic);
+  ASSERT_EQ(smj2Analytic.nbElem(), smj2.nbElem());
+  for (int i = 0; i < smj2.nbElem(); ++i)
+    ASSERT_DOUBLE_EQUALS_DYNAWO(smj2Analytic.Ax_[i], smj2.Ax_[i]);
+  mm->setAnalyticJacobian(false);
+
   mm->setSharedParametersDefaultValues();
   mm->setSharedParametersDefaultValuesInit();
   for (std::unordered_map<std::string, ParameterModeler>::const_iterator it = mm->getParametersDynamic().begin(), itEnd = mm->getParametersDynamic().end();
@@ -683,9 +763,107 @@ TEST(TestModelManager, TestModelManagerBasics) {
   ASSERT_EQ(calcVarJRes[0], 2);
   ASSERT_EQ(calcVarJRes[1], 0);
 
+  // the Adept stack of the thread is shared with the Jacobian evaluations, each thread having its own stack
+  SparseMatrix smj3;
+  smj3.init(size, size);
+  mm->evalJt(0., 1., 0, smj3);
+  SparseMatrix smj4;
+  smj4.init(size, size);
+  std::thread worker([&mm, &smj4]() {
+    mm->evalJt(0., 1., 0, smj4);
+  });
+  worker.join();
+  ASSERT_EQ(smj3.nbElem(), 4);
+  ASSERT_EQ(smj4.nbElem(), 4);
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_DOUBLE_EQUALS_DYNAWO(smj3.Ax_[i], smj.Ax_[i]);
+    ASSERT_DOUBLE_EQUALS_DYNAWO(smj4.Ax_[i], smj.Ax_[i]);
+  }
+
   mm->setSubModelParameters();
   delete[] zConnected;
 }
 
 
+#ifdef _ADEPT_
+TEST(TestModelManager, TestModelManagerJacobianPattern) {
+  boost::shared_ptr<MyModelManager> mm = boost::shared_ptr<MyModelManager>(new MyModelManager());
+  mm->initializeStaticData();
+  boost::dynamic_pointer_cast<SubModel>(mm)->defineParameters();
+  boost::dynamic_pointer_cast<SubModel>(mm)->defineParametersInit();
+  boost::dynamic_pointer_cast<SubModel>(mm)->defineVariables();
+  boost::dynamic_pointer_cast<SubModel>(mm)->defineVariablesInit();
+  mm->init(0.);
+
+  std::vector<double> y(mm->sizeY(), 0.);
+  y[0] = 2;
+  y[1] = 4;
+  std::vector<double> yp(mm->sizeY(), 0.);
+  std::vector<double> f(mm->sizeF(), 0.);
+  std::vector<double> z(mm->sizeZ(), 0.);
+  bool* zConnected = new bool[mm->sizeZ()];
+  for (size_t i = 0; i < mm->sizeZ(); ++i)
+    zConnected[i] = true;
+  std::vector<state_g> g(mm->sizeG(), NO_ROOT);
+  mm->setBufferG(&g[0], 0);
+  mm->setBufferZ(&z[0], zConnected, 0);
+  mm->setBufferY(&y[0], &yp[0], 0);
+  mm->setBufferF(&f[0], 0);
+  mm->initSubBuffers();
+  mm->setBranchingEquations(true);
+  const int size = mm->sizeF();
+
+  // diagonal Jacobian: both variables share the same color, evaluated by a single tangent sweep
+  mm->testJacobianPattern(false, 0, 0);
+  SparseMatrix smj;
+  smj.init(size, size);
+  mm->evalJt(0., 1., 0, smj);
+  mm->testJacobianPattern(true, 2, 1);
+  ASSERT_EQ(smj.nbElem(), 2);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(smj.Ax_[0], 2.);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(smj.Ax_[1], .5);
+  ASSERT_EQ(smj.Ap_[1], 1);
+  ASSERT_EQ(smj.Ap_[2], 2);
+
+  // the branch switches without any discrete change: the compressed evaluation is detected as outdated and the pattern computed again
+  y[0] = 6;
+  SparseMatrix smj2;
+  smj2.init(size, size);
+  mm->evalJt(0., 1., 0, smj2);
+  mm->testJacobianPattern(true, 3, 2);
+  ASSERT_EQ(smj2.nbElem(), 3);
+  ASSERT_EQ(smj2.Ap_[1], 1);
+  ASSERT_EQ(smj2.Ap_[2], 3);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(smj2.Ax_[0], 2.);
+  ASSERT_EQ(smj2.Ai_[1], 0);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(smj2.Ax_[1], 4.);
+  ASSERT_EQ(smj2.Ai_[2], 1);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(smj2.Ax_[2], 6.5);
+
+  // the compressed evaluation with the same pattern gives the new values
+  y[1] = 1;
+  SparseMatrix smj3;
+  smj3.init(size, size);
+  mm->evalJt(0., 1., 0, smj3);
+  mm->testJacobianPattern(true, 3, 2);
+  ASSERT_EQ(smj3.nbElem(), 3);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(smj3.Ax_[0], 2.);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(smj3.Ax_[1], 1.);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(smj3.Ax_[2], 6.5);
+
+  // a discrete variable change: the pattern is computed again, the structure of the equations being the same
+  z[0] = 1.;
+  SparseMatrix smj4;
+  smj4.init(size, size);
+  mm->evalJt(0., 1., 0, smj4);
+  mm->testJacobianPattern(true, 3, 2);
+  ASSERT_EQ(smj4.nbElem(), 3);
+
+  // a mode change invalidates the pattern
+  ASSERT_EQ(mm->evalMode(0.), DIFFERENTIAL_MODE);
+  mm->testJacobianPattern(false, 0, 0);
+  delete[] zConnected;
+}
+#endif
+
 }  // namespace DYN
@@ -11,7 +11,9 @@
 // simulation tool for power systems.
 //
 
+#include <algorithm>
 #include <string>
+#include <thread>
 #include <vector>
 #include <iomanip>
 #include <iostream>
@@ -434,9 +436,16 @@ compileLib(const string& modelName, const string& compilationDir) {
 
   cmakeFile.close();
 
+#if __linux__
+  // the source files of the model are compiled concurrently, the variable being ignored by the versions of CMake older than 3.12
+  // a level given by the caller is kept, as it is when several models are built in parallel by the build of Dynawo
+  const string parallelLevel = hasEnvVar("CMAKE_BUILD_PARALLEL_LEVEL") && !getEnvVar("CMAKE_BUILD_PARALLEL_LEVEL").empty() ?
+    getEnvVar("CMAKE_BUILD_PARALLEL_LEVEL") : std::to_string(std::max(std::thread::hardware_concurrency(), 1u));
+  const string buildCommand = "CMAKE_BUILD_PARALLEL_LEVEL=" + parallelLevel + " cmake --build ";
+#endif
   string compileLibCommand = "cmake -B" + compilationDir + " -H" + compilationDir + " -C" + absolute("PreloadCache.cmake", scriptsDir)
 #if __linux__
-                           + " -DMODEL_NAME=" + modelName + " -DCMAKE_SKIP_BUILD_RPATH=True && { cmake --build " + compilationDir + " || cmake --build "
+                           + " -DMODEL_NAME=" + modelName + " -DCMAKE_SKIP_BUILD_RPATH=True && { " + buildCommand + compilationDir + " || " + buildCommand
                             + compilationDir + " > /dev/null; }";
 #else
                            + " -DMODEL_NAME=" + modelName + " && cmake --build " + compilationDir;
@@ -16,6 +16,8 @@ import itertools
 import re
 from dataContainer import *
 from utils import *
+from symbolicJacobian import build_evaljt_omc_body
+from subExpressions import SubExpressions
 
 ADEPT_SUFFIX= "_adept "
 ADEPT_DOUBLE= "adept::adouble"
@@ -269,6 +271,10 @@ class Factory:
         self.list_for_setupdatastruc = []
         ## List of equations to add in evalFAdept function
         self.list_for_evalfadept = []
+        ## List of equations to add in evalJt_omc function, None if the model can not be differentiated
+        self.list_for_evaljt_omc = None
+        ## Subexpressions factorized in setFomc, setGomc and evalCalculatedVars
+        self.sub_expressions = SubExpressions()
         ## List of external functions that should be redefined for adept
         self.list_for_evalfadept_external_call = []
         ## List of external functions that should be redefined for adept
@@ -2718,6 +2724,20 @@ class Factory:
                 self.list_for_evalfadept [index] = line_tmp
         return self.list_for_evalfadept
     ##
+    # prepare the lines that constitues the body of evalJt_omc, by differentiating the body of evalFAdept
+    # @param self : object pointer
+    # @return
+    def prepare_for_evaljt_omc(self):
+        self.list_for_evaljt_omc = build_evaljt_omc_body(self.get_list_for_evalfadept(), self.nb_eq_dyn)
+
+    ##
+    # returns the lines that constitues the body of evalJt_omc
+    # @param self : object pointer
+    # @return list of lines, None if the model can not be differentiated
+    def get_list_for_evaljt_omc(self):
+        return self.list_for_evaljt_omc
+
+    ##
     # returns the lines that contains a copy of the external functions for adept
     # @param self : object pointer
     # @return list of lines
@@ -3413,6 +3433,31 @@ class Factory:
                 self.list_for_evalcalculatedvars.append("  calculatedVars[" + str(calc_var_2_index[var.get_name()])+closing_bracket + var.get_name() + "*/ = " + expr+";\n")
 
 
+    ##
+    # hoist the subexpressions only depending on the parameters and factorize the repeated calls
+    # in the bodies of setFomc, setGomc and evalCalculatedVars
+    # @param self : object pointer
+    # @return
+    def prepare_for_sub_expressions(self):
+        self.list_for_setf = self.sub_expressions.factorize(self.list_for_setf)
+        self.list_for_setg = self.sub_expressions.factorize(self.list_for_setg)
+        self.list_for_evalcalculatedvars = self.sub_expressions.factorize( \
+            SubExpressions.reuse_calculated_vars(self.list_for_evalcalculatedvars))
+
+    ##
+    # returns the lines computing the subexpressions only depending on the parameters, at the end of initRpar
+    # @param self : object pointer
+    # @return list of lines
+    def get_list_for_initrpar_sub_expressions(self):
+        return self.sub_expressions.get_list_for_initrpar()
+
+    ##
+    # returns the lines that declares the members holding the subexpressions only depending on the parameters
+    # @param self : object pointer
+    # @return list of lines
+    def get_list_sub_expressions_for_h(self):
+        return self.sub_expressions.get_list_for_h()
+
     ##
     # return the list of lines that constitues the body of evalCalculatedVars
     # @param self : object pointer
@@ -3798,6 +3843,7 @@ class Factory:
         self.prepare_for_setsharedparamsdefaultvalue()
         self.prepare_for_setparams()
         self.prepare_for_evalfadept()
+        self.prepare_for_evaljt_omc()
         self.prepare_for_setvariables()
         self.prepare_for_defineparameters()
         self.prepare_for_literalconstants()
@@ -3805,3 +3851,5 @@ class Factory:
         self.prepare_for_evalcalculatedvari()
         self.prepare_for_evalcalculatedvariadept()
         self.prepare_for_getindexofvarusedforcalcvari()
+        # To do last, because modifies the bodies of setFomc, setGomc and evalCalculatedVars
+        self.prepare_for_sub_expressions()
@@ -59,6 +59,8 @@ class HeaderPatternDefine:
     void initRpar();
     void setFomc(double * f, propertyF_t type);
     void setGomc(state_g * g);
+    void setFomcBatch(ModelModelica* const* instances, double* const* f, const unsigned int nbInstances, const propertyF_t type);
+    void setGomcBatch(ModelModelica* const* instances, state_g* const* g, const unsigned int nbInstances);
     modeChangeType_t evalMode(const double t) const;
     void setZomc();
     void collectSilentZ(BitMask* silentZTable);
@@ -77,6 +79,7 @@ class HeaderPatternDefine:
     void evalCalculatedVars(std::vector<double>& calculatedVars);
     double evalCalculatedVarI(unsigned iCalculatedVar) const;
     void getIndexesOfVariablesUsedForCalculatedVarI(unsigned iCalculatedVar, std::vector<int>& indexes) const;
+    bool evalJt_omc(const double* y, const double* yp, double cj, double coeff, int rowOffset, SparseMatrix& jt);
 #ifdef _ADEPT_
     void evalFAdept(const std::vector<adept::adouble> &y, const std::vector<adept::adouble> &yp, std::vector<adept::adouble> &F);
     adept::adouble evalCalculatedVarIAdept(unsigned iCalculatedVar, unsigned indexOffset, const std::vector<adept::adouble> &y, const std::vector<adept::adouble> &yp) const;
@@ -105,6 +108,7 @@ class HeaderPatternDefine:
     void setupDataStruc();
     void initializeDataStruc();
     void deInitializeDataStruc();
+    template<propertyF_t type> void setFomcKernel(double * f);
 
     private:
     __fill_internal_functions__
@@ -149,6 +153,8 @@ namespace DYN {
     void initRpar();
     void setFomc(double * f, propertyF_t type);
     void setGomc(state_g * g);
+    void setFomcBatch(ModelModelica* const* instances, double* const* f, const unsigned int nbInstances, const propertyF_t type);
+    void setGomcBatch(ModelModelica* const* instances, state_g* const* g, const unsigned int nbInstances);
     modeChangeType_t evalMode(const double t) const;
     void setZomc();
     void collectSilentZ(BitMask* silentZTable);
@@ -166,6 +172,7 @@ namespace DYN {
     void evalCalculatedVars(std::vector<double>& calculatedVars);
     double evalCalculatedVarI(unsigned iCalculatedVar) const;
     void getIndexesOfVariablesUsedForCalculatedVarI(unsigned iCalculatedVar, std::vector<int>& indexes) const;
+    bool evalJt_omc(const double* y, const double* yp, double cj, double coeff, int rowOffset, SparseMatrix& jt);
 #ifdef _ADEPT_
     void evalFAdept( const std::vector<adept::adouble> &y, const std::vector<adept::adouble> &yp, std::vector<adept::adouble> &F);
     adept::adouble evalCalculatedVarIAdept(unsigned iCalculatedVar, unsigned indexOffset, const std::vector<adept::adouble> &y, const std::vector<adept::adouble> &yp) const;
@@ -194,6 +201,7 @@ namespace DYN {
     void setupDataStruc();
     void initializeDataStruc();
     void deInitializeDataStruc();
+    template<propertyF_t type> void setFomcKernel(double * f);
 
     private:
     __fill_internal_functions__
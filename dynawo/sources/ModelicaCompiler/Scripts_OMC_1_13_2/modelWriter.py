@@ -330,6 +330,7 @@ class ModelWriter(ModelWriterBase):
         self.file_content.append("#include <math.h>\n")
         self.file_content.append("\n")
         self.file_content.append("#include \"DYNElement.h\"\n")
+        self.file_content.append("#include \"DYNSparseMatrix.h\"\n")
         self.file_content.append("#include \"PARParametersSetFactory.h\"\n")
         self.file_content.append("\n")
         self.file_content.append(HASHTAG_INCLUDE + self.className + ".h\"\n")
@@ -363,17 +364,48 @@ class ModelWriter(ModelWriterBase):
 
     ##
     # Add the body of setFomc in the cpp file
+    # The residuals are computed by a kernel specialized for each type of equations,
+    # in which the tests on the type are resolved at compile time
     # @param self : object pointer
     # @return
     def fill_setFomc(self):
         self.addEmptyLine()
 
-        self.addLine(self.void_function_prefix+ self.className + "::setFomc(double * f, propertyF_t type)\n")
+        self.addLine("template<propertyF_t type>\n")
+        self.addLine(self.void_function_prefix+ self.className + "::setFomcKernel(double * f)\n")
         self.addLine("{\n")
 
         self.addBody(self.builder.get_list_for_setf())
         self.addLine("}\n")
 
+        self.addEmptyLine()
+        self.addLine(self.void_function_prefix+ self.className + "::setFomc(double * f, propertyF_t type)\n")
+        self.addLine("{\n")
+        self.addLine("  switch (type) {\n")
+        for eq_type in ["ALGEBRAIC_EQ", "DIFFERENTIAL_EQ"]:
+            self.addLine("    case " + eq_type + ":\n")
+            self.addLine("      setFomcKernel<" + eq_type + ">(f);\n")
+            self.addLine("      break;\n")
+        self.addLine("    default:\n")
+        self.addLine("      setFomcKernel<UNDEFINED_EQ>(f);\n")
+        self.addLine("      break;\n")
+        self.addLine("  }\n")
+        self.addLine("}\n")
+
+        # batch of instances, evaluated by the kernel without virtual call
+        self.addEmptyLine()
+        self.addLine(self.void_function_prefix+ self.className + "::setFomcBatch(ModelModelica* const* instances, double* const* f, " \
+                     + "const unsigned int nbInstances, const propertyF_t type)\n")
+        self.addLine("{\n")
+        self.addLine("  switch (type) {\n")
+        for eq_type in ["ALGEBRAIC_EQ", "DIFFERENTIAL_EQ", "UNDEFINED_EQ"]:
+            self.addLine(("    case " + eq_type + ":\n") if eq_type != "UNDEFINED_EQ" else "    default:\n")
+            self.addLine("      for (unsigned int i = 0; i < nbInstances; ++i)\n")
+            self.addLine("        static_cast<Model" + self.className + "*>(instances[i])->setFomcKernel<" + eq_type + ">(f[i]);\n")
+            self.addLine("      break;\n")
+        self.addLine("  }\n")
+        self.addLine("}\n")
+
     ##
     # Add the body of evalMode in the cpp file
     # @param self : object pointer
@@ -433,6 +465,15 @@ class ModelWriter(ModelWriterBase):
             self.addLine("  data->simulationInfo->discreteCall = 0;\n")
         self.addLine("}\n")
 
+        # batch of instances, evaluated without virtual call
+        self.addEmptyLine()
+        self.addLine(self.void_function_prefix+ self.className + "::setGomcBatch(ModelModelica* const* instances, state_g* const* g, " \
+                     + "const unsigned int nbInstances)\n")
+        self.addLine("{\n")
+        self.addLine("  for (unsigned int i = 0; i < nbInstances; ++i)\n")
+        self.addLine("    static_cast<Model" + self.className + "*>(instances[i])->Model" + self.className + "::setGomc(g[i]);\n")
+        self.addLine("}\n")
+
 
     ##
     # Add the body of setY0omc in the cpp file
@@ -491,6 +532,7 @@ class ModelWriter(ModelWriterBase):
         self.addLine("{\n")
 
         self.addBody(self.builder.get_list_for_initrpar())
+        self.addBody(self.builder.get_list_for_initrpar_sub_expressions())
 
         self.addEmptyLine()
         self.addLine("  return;\n")
@@ -641,6 +683,29 @@ class ModelWriter(ModelWriterBase):
         self.addLine("}\n")
         self.addLine("#endif\n")
 
+    ##
+    # Add the body of evalJt_omc in the cpp file
+    # @param self : object pointer
+    # @return
+    def fill_evalJt_omc(self):
+        body = self.builder.get_list_for_evaljt_omc()
+        # the parameters not used by the body are not named
+        params = []
+        for param_type, param_name in [("const double*", "x"), ("const double*", "xd"), ("const double", "cj"), ("const double", "coeff"), \
+                                       ("const int", "rowOffset"), ("SparseMatrix&", "jt")]:
+            used = body is not None and re.search(r'\b' + param_name + r'\b', "".join(body)) is not None
+            params.append(param_type + " " + (param_name if used else "/*" + param_name + "*/"))
+        self.addEmptyLine()
+        self.addLine("bool Model" + self.className + "::evalJt_omc(" + ", ".join(params[:4]) + ",\n")
+        self.addLine("                              " + ", ".join(params[4:]) + ")\n")
+        self.addLine("{\n")
+        if body is None:
+            self.addLine("  // the equations of the model could not be differentiated: the jacobian is computed with Adept\n")
+            self.addLine("  return false;\n")
+        else:
+            self.addBody(body)
+        self.addLine("}\n")
+
     ##
     # Add literal constants in .h file
     # @param self : object pointer
@@ -935,6 +1000,7 @@ class ModelWriter(ModelWriterBase):
                         variable_type = "std::string"
 
                     file_content_tmp.append("      " + variable_type + " " + to_compile_name(par.get_name() + "_") + ";\n")
+                file_content_tmp.extend(self.builder.get_list_sub_expressions_for_h())
 
                 self.file_content_h [n : n+1] = file_content_tmp
 
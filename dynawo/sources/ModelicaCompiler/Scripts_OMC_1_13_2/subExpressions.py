@@ -0,0 +1,605 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2026, RTE (http://www.rte-france.com)
+# See AUTHORS.txt
+# All rights reserved.
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, you can obtain one at http://mozilla.org/MPL/2.0/.
+# SPDX-License-Identifier: MPL-2.0
+#
+# This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+# simulation tool for power systems.
+
+# Factorization of the subexpressions of the generated bodies (setFomc, setGomc, evalCalculatedVars).
+#
+# - the real subexpressions only depending on the parameters are hoisted in members of the model,
+#   computed once at the end of initRpar, after which the parameters are not modified anymore;
+# - the calls to the mathematical functions repeated in a sequence of statements are computed once
+#   in a local constant, declared before the first statement using them;
+# - in evalCalculatedVars, the calculated variables already computed are read instead of being
+#   evaluated again.
+#
+# The statements are only rewritten when they are understood, the other ones being kept as is.
+
+import re
+
+## Mathematical functions without side effect
+PURE_FUNCTIONS = ["sin", "cos", "tan", "asin", "acos", "atan", "atan2", "sinh", "cosh", "tanh", \
+                  "exp", "log", "log10", "sqrt", "pow", "fabs"]
+
+## Casts keeping a real value
+REAL_CASTS = ["modelica_real", "double"]
+
+## Types that may be cast to
+CAST_TYPES = REAL_CASTS + ["modelica_integer", "modelica_boolean", "int", "bool", "long"]
+
+## Type of the local constants holding the common subexpressions
+CSE_TYPE = "const modelica_real"
+
+ptrn_token = re.compile(r'(?P<comment>/\*.*?\*/|//.*$)'
+                        r'|(?P<str>"(?:\\.|[^"\\])*"|\'(?:\\.|[^\'\\])*\')'
+                        r'|(?P<num>(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?)'
+                        r'|(?P<name>[A-Za-z_$][\w$]*(?:::[A-Za-z_$][\w$]*)*)'
+                        r'|(?P<op>->|<<=|>>=|<=|>=|==|!=|&&|\|\||\+\+|--|[-+*/%&|^]=|<<|>>|[-+*/%()\[\],.<>!?:=;&|^~{}])'
+                        r'|(?P<space>\s+)')
+ptrn_trailing_comments = re.compile(r'(?:\s*/\*.*?\*/)+')
+ptrn_parameter = re.compile(r'^data->simulationInfo->(?:realParameter|integerParameter|booleanParameter)\[\d+\]$')
+ptrn_calculated_var_call = re.compile(r'evalCalculatedVarI\((?P<index>\d+)\)')
+ptrn_calculated_var_assignment = re.compile(r'^\s*calculatedVars\[(?P<index>\d+)\]')
+ptrn_control = re.compile(r'^(?:\{|\}|else\b|if\b|for\b|while\b|switch\b|case\b|default\b|return\b|#)')
+
+
+##
+# Exception raised when a statement is not understood
+class NotParsable(Exception):
+    pass
+
+
+##
+# Token of a line
+class Token:
+    ##
+    # default constructor
+    # @param self : object pointer
+    # @param kind : kind of token (str, num, name, op)
+    # @param text : text of the token
+    # @param start : position of the first character in the line
+    # @param end : position after the last character in the line
+    def __init__(self, kind, text, start, end):
+        ## kind of token
+        self.kind = kind
+        ## text of the token
+        self.text = text
+        ## position of the first character in the line
+        self.start = start
+        ## position after the last character in the line
+        self.end = end
+
+
+##
+# Node of the expression tree of a statement
+class Node:
+    ##
+    # default constructor
+    # @param self : object pointer
+    # @param kind : kind of node (num, str, leaf, call, paren, cast, unary, binary, ternary)
+    # @param first : index of the first token of the node
+    # @param last : index of the last token of the node
+    # @param text : canonical text of a leaf, name of a function or of a cast, operator
+    # @param children : operands of the node
+    def __init__(self, kind, first, last, text = "", children = None):
+        ## kind of node
+        self.kind = kind
+        ## index of the first token
+        self.first = first
+        ## index of the last token
+        self.last = last
+        ## canonical text of a leaf, name of a function or of a cast, operator
+        self.text = text
+        ## operands
+        self.children = children if children is not None else []
+
+
+##
+# split a line in tokens, the comments and the spaces being dropped
+# @param line : line to split
+# @return the tokens
+def tokenize(line):
+    tokens = []
+    index = 0
+    while index < len(line):
+        match = ptrn_token.match(line, index)
+        if match is None or match.end() == index:
+            raise NotParsable(line)
+        kind = match.lastgroup
+        if kind not in ["comment", "space"]:
+            tokens.append(Token(kind, match.group(kind), match.start(), match.end()))
+        index = match.end()
+    return tokens
+
+##
+# canonical text of a range of tokens, independent of the comments and of the spaces
+# @param tokens : tokens of the line
+# @param first : index of the first token
+# @param last : index of the last token
+# @return the canonical text
+def canonical_text(tokens, first, last):
+    text = ""
+    for i in range(first, last + 1):
+        if text != "" and re.match(r'[\w$]', text[-1]) and re.match(r'^[\w$.]', tokens[i].text):
+            text += " "
+        text += tokens[i].text
+    return text
+
+
+##
+# Recursive descent parser of the C expressions of the generated bodies
+class ExpressionParser:
+    ## binary operators, by increasing precedence
+    BINARY_OPERATORS = [["||"], ["&&"], ["|"], ["^"], ["&"], ["==", "!="], ["<", ">", "<=", ">="], ["<<", ">>"], ["+", "-"], ["*", "/", "%"]]
+
+    ##
+    # default constructor
+    # @param self : object pointer
+    # @param tokens : tokens of the line
+    # @param first : index of the first token of the expression
+    # @param last : index of the last token of the expression
+    def __init__(self, tokens, first, last):
+        ## tokens of the line
+        self.tokens = tokens
+        ## index of the current token
+        self.pos = first
+        ## index after the last token of the expression
+        self.end = last + 1
+
+    ##
+    # parse the whole expression
+    # @param self : object pointer
+    # @return the expression tree
+    def parse(self):
+        node = self.parse_ternary()
+        if self.pos != self.end:
+            raise NotParsable(self.tokens[self.pos].text)
+        return node
+
+    ##
+    # get the text of the current token
+    # @param self : object pointer
+    # @param offset : offset from the current token
+    # @return the text of the token, None at the end
+    def peek(self, offset = 0):
+        return self.tokens[self.pos + offset].text if self.pos + offset < self.end else None
+
+    ##
+    # consume the current token, checking it
+    # @param self : object pointer
+    # @param expected : expected token
+    # @return
+    def expect(self, expected):
+        if self.peek() != expected:
+            raise NotParsable(expected)
+        self.pos += 1
+
+    ##
+    # parse a ternary expression
+    # @param self : object pointer
+    # @return the expression tree
+    def parse_ternary(self):
+        first = self.pos
+        node = self.parse_binary(0)
+        if self.peek() != "?":
+            return node
+        self.pos += 1
+        if_true = self.parse_ternary()
+        self.expect(":")
+        if_false = self.parse_ternary()
+        return Node("ternary", first, self.pos - 1, "?", [node, if_true, if_false])
+
+    ##
+    # parse a binary expression
+    # @param self : object pointer
+    # @param level : precedence level of the operators
+    # @return the expression tree
+    def parse_binary(self, level):
+        if level == len(ExpressionParser.BINARY_OPERATORS):
+            return self.parse_unary()
+        first = self.pos
+        node = self.parse_binary(level + 1)
+        while self.peek() in ExpressionParser.BINARY_OPERATORS[level] and self.tokens[self.pos].kind == "op":
+            operator = self.peek()
+            self.pos += 1
+            node = Node("binary", first, None, operator, [node, self.parse_binary(level + 1)])
+            node.last = self.pos - 1
+        return node
+
+    ##
+    # parse a unary expression
+    # @param self : object pointer
+    # @return the expression tree
+    def parse_unary(self):
+        first = self.pos
+        token = self.peek()
+        if token in ["-", "+", "!", "~"]:
+            self.pos += 1
+            child = self.parse_unary()
+            return Node("unary", first, self.pos - 1, token, [child])
+        if token in ["&", "*", "++", "--"]:
+            raise NotParsable(token)
+        if token == "(" and self.peek(1) in CAST_TYPES and self.peek(2) == ")":
+            self.pos += 3
+            child = self.parse_unary()
+            return Node("cast", first, self.pos - 1, self.tokens[first + 1].text, [child])
+        return self.parse_postfix()
+
+    ##
+    # parse a primary expression followed by accesses and calls
+    # @param self : object pointer
+    # @return the expression tree
+    def parse_postfix(self):
+        first = self.pos
+        token = self.peek()
+        if token is None:
+            raise NotParsable("")
+        kind = self.tokens[self.pos].kind
+        if token == "(":
+            self.pos += 1
+            child = self.parse_ternary()
+            self.expect(")")
+            return Node("paren", first, self.pos - 1, "", [child])
+        if kind in ["num", "str"]:
+            self.pos += 1
+            return Node(kind, first, first, token)
+        if kind != "name":
+            raise NotParsable(token)
+        self.pos += 1
+        if self.peek() == "(":
+            self.pos += 1
+            args = []
+            if self.peek() != ")":
+                args.append(self.parse_ternary())
+                while self.peek() == ",":
+                    self.pos += 1
+                    args.append(self.parse_ternary())
+            self.expect(")")
+            return Node("call", first, self.pos - 1, token, args)
+        children = []
+        while self.peek() in ["[", ".", "->"]:
+            if self.peek() == "[":
+                self.pos += 1
+                children.append(self.parse_ternary())
+                self.expect("]")
+            else:
+                self.pos += 2
+        if self.peek() in ["(", "++", "--"]:
+            raise NotParsable(token)
+        return Node("leaf", first, self.pos - 1, canonical_text(self.tokens, first, self.pos - 1), children)
+
+
+##
+# Statement of a body, parsed when it is an assignment
+class Statement:
+    ##
+    # default constructor
+    # @param self : object pointer
+    # @param line : text of the line, without the end of line
+    def __init__(self, line):
+        ## text of the line
+        self.line = line
+        ## tokens of the line, None if the line is not an assignment
+        self.tokens = None
+        ## canonical text of the assigned variable
+        self.lhs = None
+        ## tree of the assigned expression
+        self.rhs = None
+        ## whether the line may modify the variables in an unknown way
+        self.barrier = False
+        try:
+            tokens = tokenize(line)
+        except NotParsable:
+            self.barrier = True
+            return
+        if len(tokens) == 0:
+            return
+        if ptrn_control.match(tokens[0].text):
+            self.barrier = True
+            return
+        equals = [i for i, token in enumerate(tokens) if token.text == "="]
+        if len(equals) != 1 or tokens[-1].text != ";" or equals[0] == 0:
+            # declaration without value or call: only calls may modify the variables
+            self.barrier = any(token.text == "(" for token in tokens)
+            return
+        lhs_first = 0
+        while lhs_first < equals[0] - 1 and tokens[lhs_first].kind == "name" and tokens[lhs_first + 1].kind == "name":
+            # declaration with a value
+            lhs_first += 1
+        try:
+            lhs = ExpressionParser(tokens, lhs_first, equals[0] - 1).parse()
+            rhs = ExpressionParser(tokens, equals[0] + 1, len(tokens) - 2).parse()
+        except NotParsable:
+            self.barrier = True
+            return
+        if lhs.kind != "leaf" or any(child.kind != "num" for child in lhs.children) or any(token.text == "&" for token in tokens):
+            self.barrier = True
+            return
+        self.tokens = tokens
+        self.lhs = lhs.text
+        self.rhs = rhs
+
+    ##
+    # get the text of a node
+    # @param self : object pointer
+    # @param node : node of the expression
+    # @return the text of the node in the line
+    def text(self, node):
+        return self.line[self.tokens[node.first].start:self.end(node)]
+
+    ##
+    # get the end of a node, including the comments following it
+    # @param self : object pointer
+    # @param node : node of the expression
+    # @return the position after the node in the line
+    def end(self, node):
+        end = self.tokens[node.last].end
+        match = ptrn_trailing_comments.match(self.line, end)
+        return match.end() if match is not None else end
+
+    ##
+    # get the canonical text of a node
+    # @param self : object pointer
+    # @param node : node of the expression
+    # @return the canonical text of the node
+    def canonical(self, node):
+        return canonical_text(self.tokens, node.first, node.last)
+
+    ##
+    # replace the text of nodes in the line
+    # @param self : object pointer
+    # @param replacements : list of (node, text)
+    # @return the new line
+    def replace(self, replacements):
+        line = self.line
+        for node, text in sorted(replacements, key = lambda replacement: -replacement[0].first):
+            line = line[:self.tokens[node.first].start] + text + line[self.end(node):]
+        return line
+
+
+##
+# get the nodes of a tree, parents first
+# @param node : root of the tree
+# @return the nodes
+def nodes_of(node):
+    result = [node]
+    for child in node.children:
+        result.extend(nodes_of(child))
+    return result
+
+##
+# check whether an expression is a real expression only depending on the parameters
+# @param node : expression tree
+# @return (whether the expression only depends on the parameters, whether it is real, whether it uses a parameter)
+def parameter_expression(node):
+    if node.kind == "num":
+        return (True, re.search(r'[.eE]', node.text) is not None, False)
+    if node.kind == "leaf":
+        if ptrn_parameter.match(node.text) is None:
+            return (False, False, False)
+        return (True, "realParameter" in node.text, True)
+    if node.kind == "paren" or (node.kind == "unary" and node.text in ["-", "+"]) or (node.kind == "cast" and node.text in REAL_CASTS):
+        only, real, used = parameter_expression(node.children[0])
+        return (only, real or node.kind == "cast", used)
+    if (node.kind == "binary" and node.text in ["+", "-", "*", "/"]) or (node.kind == "call" and node.text in PURE_FUNCTIONS):
+        only, real, used = (True, node.kind == "call", False)
+        for child in node.children:
+            child_only, child_real, child_used = parameter_expression(child)
+            only, real, used = (only and child_only, real or child_real, used or child_used)
+        return (only, real, used)
+    return (False, False, False)
+
+##
+# check whether an expression only contains a leaf, possibly cast or negated
+# @param node : expression tree
+# @return whether the expression is a leaf
+def is_trivial(node):
+    if node.kind in ["paren", "cast"] or (node.kind == "unary" and node.text in ["-", "+"]):
+        return is_trivial(node.children[0])
+    return node.kind in ["num", "leaf", "str"]
+
+##
+# check whether a call only calls mathematical functions
+# @param node : expression tree
+# @return whether the expression has no side effect
+def is_pure(node):
+    if node.kind == "call" and node.text not in PURE_FUNCTIONS:
+        return False
+    return node.kind != "str" and all(is_pure(child) for child in node.children)
+
+##
+# get the variables read by an expression
+# @param node : expression tree
+# @return canonical texts of the leaves
+def leaves_of(node):
+    return set([child.text for child in nodes_of(node) if child.kind == "leaf"])
+
+
+##
+# check whether reading a variable reads an assigned variable
+# @param leaf : canonical text of the variable read
+# @param lhs : canonical text of the variable assigned
+# @return whether the variable read depends on the assigned variable
+def reads(leaf, lhs):
+    return leaf == lhs or any(leaf.startswith(lhs + separator) or lhs.startswith(leaf + separator) for separator in [".", "[", "->"])
+
+
+##
+# Factorization of the subexpressions of the bodies of a model
+class SubExpressions:
+    ##
+    # default constructor
+    # @param self : object pointer
+    def __init__(self):
+        ## expressions hoisted in members, in the order of their creation
+        self.hoisted_expressions = []
+        ## index of the hoisted expressions, by canonical text
+        self.hoisted_indexes = {}
+
+    ##
+    # name of the member holding a hoisted expression
+    # @param index : index of the hoisted expression
+    # @return the name of the member
+    @staticmethod
+    def member_name(index):
+        return "paramExpression" + str(index) + "_"
+
+    ##
+    # split a body in lines
+    # @param body : lines of the body, possibly containing several lines
+    # @return the lines, without the ends of lines
+    @staticmethod
+    def split_body(body):
+        text = "".join(body)
+        if text.endswith("\n"):
+            text = text[:-1]
+        return text.split("\n") if text != "" else []
+
+    ##
+    # hoist the parameter expressions and factorize the repeated calls of a body
+    # @param self : object pointer
+    # @param body : lines of the body
+    # @return the lines of the new body
+    def factorize(self, body):
+        lines = [self.hoist_parameter_expressions(line) for line in SubExpressions.split_body(body)]
+        lines = SubExpressions.eliminate_common_subexpressions(lines)
+        return [line + "\n" for line in lines]
+
+    ##
+    # replace the calculated variables already computed in the body of evalCalculatedVars
+    # @param body : lines of the body
+    # @return the lines of the new body
+    @staticmethod
+    def reuse_calculated_vars(body):
+        computed = set()
+        lines = []
+        for line in SubExpressions.split_body(body):
+            line = ptrn_calculated_var_call.sub(lambda match: "calculatedVars[" + match.group("index") + "]" \
+                                                if int(match.group("index")) in computed else match.group(0), line)
+            match = ptrn_calculated_var_assignment.match(line)
+            if match is not None:
+                computed.add(int(match.group("index")))
+            lines.append(line + "\n")
+        return lines
+
+    ##
+    # hoist the parameter expressions of a line in members
+    # @param self : object pointer
+    # @param line : line of the body
+    # @return the new line
+    def hoist_parameter_expressions(self, line):
+        statement = Statement(line)
+        if statement.rhs is None:
+            return line
+        replacements = []
+        to_visit = [statement.rhs]
+        while len(to_visit) > 0:
+            node = to_visit.pop()
+            only, real, used = parameter_expression(node)
+            if only and real and used and not is_trivial(node):
+                canonical = statement.canonical(node)
+                if canonical not in self.hoisted_indexes:
+                    self.hoisted_indexes[canonical] = len(self.hoisted_expressions)
+                    self.hoisted_expressions.append(statement.text(node))
+                replacements.append((node, SubExpressions.member_name(self.hoisted_indexes[canonical])))
+            else:
+                to_visit.extend(node.children)
+        return statement.replace(replacements) if len(replacements) > 0 else line
+
+    ##
+    # compute once the calls to the mathematical functions repeated in the sequences of statements of a body
+    # @param lines : lines of the body
+    # @return the new lines
+    @staticmethod
+    def eliminate_common_subexpressions(lines):
+        lines = list(lines)
+        nb_constants = 0
+        while True:
+            factorization = SubExpressions.find_common_subexpression(lines)
+            if factorization is None:
+                return lines
+            first_line, occurrences, _ = factorization
+            name = "cse" + str(nb_constants)
+            nb_constants += 1
+            statement = Statement(lines[first_line])
+            first_node = occurrences[0][1]
+            indent = lines[first_line][:len(lines[first_line]) - len(lines[first_line].lstrip())]
+            declaration = indent + CSE_TYPE + " " + name + " = " + statement.text(first_node) + ";"
+            by_line = {}
+            for index, node in occurrences:
+                by_line.setdefault(index, []).append(node)
+            for index, nodes in by_line.items():
+                lines[index] = Statement(lines[index]).replace([(node, name) for node in nodes])
+            lines.insert(first_line, declaration)
+
+    ##
+    # find the largest call to a mathematical function repeated in a sequence of statements
+    # @param lines : lines of the body
+    # @return (index of the first line using the call, list of (index of the line, node), length of the call), None if no call is repeated
+    @staticmethod
+    def find_common_subexpression(lines):
+        best = None
+        # occurrences of the calls in the current sequence of statements, by canonical text
+        occurrences = {}
+        for index, line in enumerate(lines):
+            statement = Statement(line)
+            if statement.barrier:
+                best = SubExpressions.best_occurrences(occurrences, best)
+                occurrences = {}
+                continue
+            if statement.rhs is None:
+                continue
+            for node in nodes_of(statement.rhs):
+                if node.kind != "call" or node.text not in PURE_FUNCTIONS or not is_pure(node):
+                    continue
+                canonical = statement.canonical(node)
+                occurrences.setdefault(canonical, ([], leaves_of(node)))[0].append((index, node, len(canonical)))
+            # the calls using the assigned variable are not available anymore
+            for canonical in [key for key, value in occurrences.items() if any(reads(leaf, statement.lhs) for leaf in value[1])]:
+                best = SubExpressions.best_occurrences({canonical: occurrences.pop(canonical)}, best)
+        return SubExpressions.best_occurrences(occurrences, best)
+
+    ##
+    # keep the largest call among the calls repeated in a sequence of statements
+    # @param occurrences : occurrences of the calls, by canonical text
+    # @param best : largest call found so far
+    # @return the largest call
+    @staticmethod
+    def best_occurrences(occurrences, best):
+        for canonical, (found, _) in occurrences.items():
+            if len(found) < 2:
+                continue
+            if best is None or len(canonical) > best[2] or (len(canonical) == best[2] and found[0][0] < best[0]):
+                best = (found[0][0], [(index, node) for index, node, _ in found], len(canonical))
+        return best
+
+    ##
+    # get the lines computing the hoisted expressions, at the end of initRpar
+    # @param self : object pointer
+    # @return list of lines
+    def get_list_for_initrpar(self):
+        if len(self.hoisted_expressions) == 0:
+            return []
+        lines = ["  // Setting the subexpressions only depending on the parameters\n"]
+        for index, expression in enumerate(self.hoisted_expressions):
+            lines.append("  " + SubExpressions.member_name(index) + " = " + expression + ";\n")
+        return lines
+
+    ##
+    # get the declarations of the members holding the hoisted expressions
+    # @param self : object pointer
+    # @return list of lines
+    def get_list_for_h(self):
+        if len(self.hoisted_expressions) == 0:
+            return []
+        lines = ["      // Subexpressions only depending on the parameters\n"]
+        for index in range(len(self.hoisted_expressions)):
+            lines.append("      double " + SubExpressions.member_name(index) + ";\n")
+        return lines
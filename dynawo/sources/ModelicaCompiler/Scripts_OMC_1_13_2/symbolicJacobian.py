@@ -0,0 +1,515 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2026, RTE (http://www.rte-france.com)
+# See AUTHORS.txt
+# All rights reserved.
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, you can obtain one at http://mozilla.org/MPL/2.0/.
+# SPDX-License-Identifier: MPL-2.0
+#
+# This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+# simulation tool for power systems.
+
+# Source transformation of the body of evalFAdept into an analytic sparse jacobian (evalJt_omc).
+#
+# The statements of evalFAdept are kept, evaluated with doubles, and each assignment of a real
+# variable is preceded by the assignments of its partial derivatives with respect to the
+# variables (x) and their derivatives (xd) it depends on. The dependencies are static: they
+# are the union of the dependencies of all the assignments of a variable, whatever the branches
+# taken, so that the sparsity pattern of the jacobian does not depend on the values.
+# Whenever a statement is not understood, no jacobian is generated and the model keeps using
+# Adept.
+
+import re
+
+## Type of the real variables in evalFAdept
+ADOUBLE = "adept::adouble"
+
+## Functions whose value is piecewise constant: their derivative is null
+PIECEWISE_CONSTANT_FUNCTIONS = ["Greater<double>", "Less<double>", "GreaterEq<double>", "LessEq<double>", \
+                                "toNativeBool", "floor", "ceil", "integer", "sign"]
+
+## Casts keeping a real value
+REAL_CASTS = ["modelica_real", "double"]
+
+## Casts to a discrete value: their derivative is null
+DISCRETE_CASTS = ["modelica_integer", "modelica_boolean", "int", "bool"]
+
+ptrn_comment = re.compile(r'/\*.*?\*/')
+ptrn_token = re.compile(r'\s*(?:(?P<num>(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?)'
+                        r'|(?P<name>[A-Za-z_$][\w$]*(?:<double>)?)'
+                        r'|(?P<op>->|<=|>=|==|!=|&&|\|\||[-+*/()\[\],.<>!?:]))')
+ptrn_declaration = re.compile(r'^\s*(?P<type>adept::adouble|double|modelica_boolean|modelica_integer)\s+(?P<name>[A-Za-z_$][\w$]*)\s*;\s*$')
+ptrn_assignment = re.compile(r'^\s*(?P<lhs>[A-Za-z_$][\w$]*(?:\[\d+\])?)\s*=(?!=)\s*(?P<rhs>.*);\s*$')
+ptrn_control = re.compile(r'^\s*(?:\{|\}|else|if\s*\(.*\)|else\s+if\s*\(.*\))\s*$')
+ptrn_residual = re.compile(r'^res\[(\d+)\]$')
+
+
+##
+# Exception raised when a statement can not be differentiated
+class NotDifferentiable(Exception):
+    pass
+
+
+##
+# Node of the expression tree of a real expression
+class Node:
+    ##
+    # default constructor
+    # @param self : object pointer
+    # @param kind : kind of node (num, x, xd, var, opaque, neg, +, -, *, /, call)
+    # @param text : text of the leaf, name of the function for a call
+    # @param children : operands of the node
+    def __init__(self, kind, text = "", children = None):
+        ## kind of node
+        self.kind = kind
+        ## text of the leaf, or name of the function
+        self.text = text
+        ## operands
+        self.children = children if children is not None else []
+
+    ##
+    # print the node as a C expression
+    # @param self : object pointer
+    # @return the expression
+    def to_c(self):
+        if self.kind in ["num", "x", "xd", "var", "opaque"]:
+            return self.text
+        if self.kind == "neg":
+            return "(-" + self.children[0].to_c() + ")"
+        if self.kind == "call":
+            return self.text + "(" + ", ".join([child.to_c() for child in self.children]) + ")"
+        return "(" + self.children[0].to_c() + " " + self.kind + " " + self.children[1].to_c() + ")"
+
+
+##
+# Recursive descent parser of the real expressions of evalFAdept
+class ExpressionParser:
+    ##
+    # default constructor
+    # @param self : object pointer
+    # @param text : expression to parse
+    # @param real_vars : names of the real variables
+    def __init__(self, text, real_vars):
+        ## tokens of the expression
+        self.tokens = []
+        ## index of the current token
+        self.pos = 0
+        ## names of the real variables
+        self.real_vars = real_vars
+        text = ptrn_comment.sub(" ", text).strip()
+        index = 0
+        while index < len(text):
+            match = ptrn_token.match(text, index)
+            if match is None or match.end() == index:
+                raise NotDifferentiable(text)
+            index = match.end()
+            self.tokens.append(match.group(match.lastgroup))
+
+    ##
+    # parse the whole expression
+    # @param self : object pointer
+    # @return the expression tree
+    def parse(self):
+        node = self.parse_sum()
+        if self.pos != len(self.tokens):
+            raise NotDifferentiable(" ".join(self.tokens))
+        return node
+
+    ##
+    # get the current token
+    # @param self : object pointer
+    # @return the current token, None at the end
+    def peek(self):
+        return self.tokens[self.pos] if self.pos < len(self.tokens) else None
+
+    ##
+    # consume the current token, checking it
+    # @param self : object pointer
+    # @param expected : expected token
+    # @return
+    def expect(self, expected):
+        if self.peek() != expected:
+            raise NotDifferentiable(" ".join(self.tokens))
+        self.pos += 1
+
+    ##
+    # parse a sum of products
+    # @param self : object pointer
+    # @return the expression tree
+    def parse_sum(self):
+        node = self.parse_product()
+        while self.peek() in ["+", "-"]:
+            operator = self.tokens[self.pos]
+            self.pos += 1
+            node = Node(operator, children = [node, self.parse_product()])
+        if self.peek() in ["<", ">", "<=", ">=", "==", "!=", "&&", "||", "?"]:
+            # logical expressions and ternaries are not differentiated
+            raise NotDifferentiable(" ".join(self.tokens))
+        return node
+
+    ##
+    # parse a product of unary expressions
+    # @param self : object pointer
+    # @return the expression tree
+    def parse_product(self):
+        node = self.parse_unary()
+        while self.peek() in ["*", "/"]:
+            operator = self.tokens[self.pos]
+            self.pos += 1
+            node = Node(operator, children = [node, self.parse_unary()])
+        return node
+
+    ##
+    # parse a unary expression
+    # @param self : object pointer
+    # @return the expression tree
+    def parse_unary(self):
+        token = self.peek()
+        if token == "-":
+            self.pos += 1
+            return Node("neg", children = [self.parse_unary()])
+        if token == "+":
+            self.pos += 1
+            return self.parse_unary()
+        if token == "(":
+            cast = self.tokens[self.pos + 1] if self.pos + 2 < len(self.tokens) and self.tokens[self.pos + 2] == ")" else None
+            if cast in REAL_CASTS:
+                self.pos += 3
+                return self.parse_unary()
+            if cast in DISCRETE_CASTS:
+                start = self.pos
+                self.pos += 3
+                self.parse_unary()
+                return Node("opaque", " ".join(self.tokens[start:self.pos]))
+            self.pos += 1
+            node = self.parse_sum()
+            self.expect(")")
+            return node
+        return self.parse_primary()
+
+    ##
+    # parse a leaf or a function call
+    # @param self : object pointer
+    # @return the expression tree
+    def parse_primary(self):
+        token = self.peek()
+        if token is None:
+            raise NotDifferentiable(" ".join(self.tokens))
+        if re.match(r'^[\d.]', token):
+            self.pos += 1
+            return Node("num", token)
+        if not re.match(r'^[A-Za-z_$]', token):
+            raise NotDifferentiable(" ".join(self.tokens))
+        self.pos += 1
+        if self.peek() == "(":
+            self.pos += 1
+            args = []
+            if self.peek() != ")":
+                args.append(self.parse_sum())
+                while self.peek() == ",":
+                    self.pos += 1
+                    args.append(self.parse_sum())
+            self.expect(")")
+            return Node("call", token, args)
+        if token in ["x", "xd"] and self.peek() == "[":
+            self.pos += 1
+            index = self.peek()
+            self.pos += 1
+            self.expect("]")
+            if not re.match(r'^\d+$', index):
+                raise NotDifferentiable(" ".join(self.tokens))
+            return Node(token, token + "[" + index + "]")
+        if token in self.real_vars and self.peek() not in ["[", ".", "->"]:
+            return Node("var", token)
+        # access to a parameter or to a discrete variable: constant with respect to the variables
+        text = token
+        while self.peek() in ["[", ".", "->"]:
+            if self.peek() == "[":
+                self.pos += 1
+                text += "[" + self.parse_sum().to_c() + "]"
+                self.expect("]")
+            else:
+                text += self.tokens[self.pos] + self.tokens[self.pos + 1]
+                self.pos += 2
+        if token in self.real_vars:
+            raise NotDifferentiable(text)
+        return Node("opaque", text)
+
+
+##
+# collect the directions (x[i] or xd[i]) an expression depends on
+# @param node : expression tree
+# @param deps : directions of the real variables
+# @return set of directions
+def dependencies(node, deps):
+    if node.kind in ["x", "xd"]:
+        return set([node.text])
+    if node.kind == "var":
+        return set(deps.get(node.text, set()))
+    result = set()
+    for child in node.children:
+        result |= dependencies(child, deps)
+    return result
+
+##
+# name of the variable holding the derivative of a real variable along a direction
+# @param name : name of the real variable
+# @param direction : x[i] or xd[i]
+# @return the name of the derivative
+def derivative_name(name, direction):
+    return "d_" + name + "_" + direction.replace("[", "").replace("]", "")
+
+##
+# product of two factors of a derivative, None standing for 0
+# @param factor : first factor
+# @param derivative : second factor, possibly None
+# @return the product
+def times(factor, derivative):
+    if derivative is None:
+        return None
+    if derivative == "1.0":
+        return factor
+    return "(" + factor + ") * (" + derivative + ")"
+
+##
+# sum of two derivatives, None standing for 0
+# @param first : first term
+# @param second : second term
+# @param operator : + or -
+# @return the sum
+def add(first, second, operator = "+"):
+    if second is None:
+        return first
+    if first is None:
+        return second if operator == "+" else "(-" + second + ")"
+    return "(" + first + " " + operator + " " + second + ")"
+
+##
+# derivative of an expression along a direction
+# @param node : expression tree
+# @param direction : x[i] or xd[i]
+# @param deps : directions of the real variables
+# @return the C expression of the derivative, None if it is null
+def differentiate(node, direction, deps):
+    if node.kind in ["num", "opaque"]:
+        return None
+    if node.kind in ["x", "xd"]:
+        return "1.0" if node.text == direction else None
+    if node.kind == "var":
+        return derivative_name(node.text, direction) if direction in deps.get(node.text, set()) else None
+    if node.kind == "neg":
+        derivative = differentiate(node.children[0], direction, deps)
+        return None if derivative is None else "(-" + derivative + ")"
+    if node.kind in ["+", "-"]:
+        return add(differentiate(node.children[0], direction, deps), differentiate(node.children[1], direction, deps), node.kind)
+    u = node.children[0].to_c() if len(node.children) > 0 else ""
+    du = differentiate(node.children[0], direction, deps) if len(node.children) > 0 else None
+    if node.kind in ["*", "/"]:
+        v = node.children[1].to_c()
+        dv = differentiate(node.children[1], direction, deps)
+        if node.kind == "*":
+            return add(times(v, du), times(u, dv))
+        if dv is None:
+            return None if du is None else "(" + du + ") / " + v
+        return add(None if du is None else "(" + du + ") / " + v, times(u + " / (" + v + " * " + v + ")", dv), "-")
+    # function call
+    name = node.text
+    if name in PIECEWISE_CONSTANT_FUNCTIONS:
+        return None
+    if all(differentiate(child, direction, deps) is None for child in node.children):
+        # function constant along the direction
+        return None
+    if len(node.children) == 1:
+        formulas = {
+            "sqrt": "1.0 / (2.0 * sqrt(%s))",
+            "sin": "cos(%s)",
+            "cos": "(-sin(%s))",
+            "tan": "1.0 / (cos(%s) * cos(%s))",
+            "exp": "exp(%s)",
+            "log": "1.0 / %s",
+            "log10": "1.0 / (%s * log(10.0))",
+            "asin": "1.0 / sqrt(1.0 - %s * %s)",
+            "acos": "(-1.0 / sqrt(1.0 - %s * %s))",
+            "atan": "1.0 / (1.0 + %s * %s)",
+            "sinh": "cosh(%s)",
+            "cosh": "sinh(%s)",
+            "tanh": "(1.0 - tanh(%s) * tanh(%s))",
+            "fabs": "(%s >= 0.0 ? 1.0 : -1.0)",
+            "abs": "(%s >= 0.0 ? 1.0 : -1.0)",
+        }
+        if name not in formulas:
+            raise NotDifferentiable(node.to_c())
+        formula = formulas[name]
+        return times(formula % tuple([u] * formula.count("%s")), du)
+    if len(node.children) == 2:
+        v = node.children[1].to_c()
+        dv = differentiate(node.children[1], direction, deps)
+        if name == "pow":
+            if dv is None:
+                return times("(" + v + ") * pow(" + u + ", " + v + " - 1.0)", du)
+            return add(times("(" + v + ") * pow(" + u + ", " + v + " - 1.0)", du), times("pow(" + u + ", " + v + ") * log(" + u + ")", dv))
+        if name == "atan2":
+            return add(times(v + " / (" + u + " * " + u + " + " + v + " * " + v + ")", du), \
+                       times(u + " / (" + u + " * " + u + " + " + v + " * " + v + ")", dv), "-")
+        if name in ["fmin", "min"]:
+            return "(" + u + " <= " + v + " ? " + (du if du is not None else "0.0") + " : " + (dv if dv is not None else "0.0") + ")"
+        if name in ["fmax", "max"]:
+            return "(" + u + " >= " + v + " ? " + (du if du is not None else "0.0") + " : " + (dv if dv is not None else "0.0") + ")"
+    raise NotDifferentiable(node.to_c())
+
+##
+# Build the body of evalJt_omc from the body of evalFAdept
+# @param evalfadept_body : lines of the body of evalFAdept
+# @param nb_residuals : number of residual functions
+# @return the lines of the body of evalJt_omc, None if a statement can not be differentiated
+def build_evaljt_omc_body(evalfadept_body, nb_residuals):
+    if nb_residuals == 0:
+        return None
+    # split the body in statements, dropping the comment blocks
+    lines = []
+    in_comment = False
+    for line in "".join(evalfadept_body).split("\n"):
+        stripped = line.strip()
+        if in_comment:
+            in_comment = "*/" not in stripped
+            continue
+        if stripped.startswith("/*") and "*/" not in stripped:
+            in_comment = True
+            continue
+        lines.append(line)
+
+    real_vars = set()
+    for line in lines:
+        match = ptrn_declaration.match(line)
+        if match is not None and match.group("type") == ADOUBLE:
+            real_vars.add(match.group("name"))
+
+    # parse the statements
+    statements = []
+    for line in lines:
+        line = line.replace(ADOUBLE, "double")
+        stripped = ptrn_comment.sub("", line).strip()
+        if stripped == "" or stripped.startswith("//") or stripped.startswith("#"):
+            statements.append(("text", line, None, None))
+            continue
+        if "adept" in stripped:
+            return None
+        if ptrn_declaration.match(line) is not None or ptrn_control.match(stripped) is not None:
+            statements.append(("text", line, None, None))
+            continue
+        if stripped.startswith("double ") or re.search(r'[-+*/]=|\+\+|--', stripped) is not None:
+            # initialized declarations and compound assignments are not differentiated
+            return None
+        match = ptrn_assignment.match(stripped)
+        if match is None:
+            if stripped.endswith(";"):
+                # call without effect on the variables (assertion, trace)
+                statements.append(("text", line, None, None))
+                continue
+            return None
+        lhs = match.group("lhs")
+        if lhs in real_vars or ptrn_residual.match(lhs) is not None:
+            try:
+                tree = ExpressionParser(match.group("rhs"), real_vars).parse()
+            except NotDifferentiable:
+                return None
+            statements.append(("real", line, lhs, tree))
+        elif "[" in lhs or lhs in ["x", "xd"]:
+            return None
+        else:
+            statements.append(("text", line, None, None))
+
+    # static dependencies of the real variables and of the residual functions
+    deps = {}
+    changed = True
+    while changed:
+        changed = False
+        for kind, _, lhs, tree in statements:
+            if kind != "real":
+                continue
+            new_deps = dependencies(tree, deps)
+            if not new_deps <= deps.get(lhs, set()):
+                deps[lhs] = deps.get(lhs, set()) | new_deps
+                changed = True
+
+    def var_index(direction):
+        return int(re.search(r'\d+', direction).group(0))
+
+    # sparsity pattern: variables used by each residual function, sorted
+    residuals_assigned = set()
+    pattern = []
+    for i in range(nb_residuals):
+        pattern.append(sorted(set([var_index(d) for d in deps.get("res[" + str(i) + "]", set())])))
+    for kind, _, lhs, _ in statements:
+        if kind == "real" and ptrn_residual.match(lhs) is not None:
+            residuals_assigned.add(int(ptrn_residual.match(lhs).group(1)))
+    if residuals_assigned != set(range(nb_residuals)):
+        return None
+    eq_begin = [0]
+    for vars_of_eq in pattern:
+        eq_begin.append(eq_begin[-1] + len(vars_of_eq))
+    nb_terms = eq_begin[-1]
+    if nb_terms == 0:
+        return None
+
+    try:
+        return write_evaljt_omc_body(statements, deps, pattern, eq_begin, real_vars, nb_residuals)
+    except NotDifferentiable:
+        return None
+
+##
+# Write the body of evalJt_omc
+# @param statements : statements of evalFAdept, the real assignments being parsed
+# @param deps : directions of the real variables and of the residual functions
+# @param pattern : variables used by each residual function
+# @param eq_begin : index of the first term of each residual function
+# @param real_vars : names of the real variables
+# @param nb_residuals : number of residual functions
+# @return the lines of the body of evalJt_omc
+def write_evaljt_omc_body(statements, deps, pattern, eq_begin, real_vars, nb_residuals):
+    def direction_key(direction):
+        return (int(re.search(r'\d+', direction).group(0)), direction.startswith("xd"))
+
+    nb_terms = eq_begin[-1]
+    body = []
+    body.append("  static const unsigned int jacEqBegin[] = {" + ", ".join([str(b) for b in eq_begin]) + "};\n")
+    body.append("  static const unsigned int jacVarIndexes[] = {" + \
+                ", ".join([str(k) for vars_of_eq in pattern for k in vars_of_eq]) + "};\n")
+    body.append("  double jacValues[" + str(nb_terms) + "];\n")
+    for kind, line, lhs, tree in statements:
+        if kind == "text":
+            body.append(line + "\n")
+            match = ptrn_declaration.match(line)
+            if match is not None and match.group("name") in real_vars:
+                indent = line[:len(line) - len(line.lstrip())]
+                for direction in sorted(deps.get(match.group("name"), set()), key = direction_key):
+                    body.append(indent + "double " + derivative_name(match.group("name"), direction) + ";\n")
+            continue
+        indent = line[:len(line) - len(line.lstrip())]
+        residual = ptrn_residual.match(lhs)
+        if residual is None:
+            # the derivatives are computed before the value, which may be used by the expression
+            for direction in sorted(deps.get(lhs, set()), key = direction_key):
+                derivative = differentiate(tree, direction, deps)
+                body.append(indent + derivative_name(lhs, direction) + " = " + (derivative if derivative is not None else "0.0") + ";\n")
+            body.append(line + "\n")
+            continue
+        i = int(residual.group(1))
+        for position, k in enumerate(pattern[i]):
+            dx = differentiate(tree, "x[" + str(k) + "]", deps)
+            dxd = differentiate(tree, "xd[" + str(k) + "]", deps)
+            term = add(times("coeff", dx), times("cj", dxd))
+            body.append(indent + "jacValues[" + str(eq_begin[i] + position) + "] = " + (term if term is not None else "0.0") + ";\n")
+
+    while body[-1].strip() == "":
+        body.pop()
+    body.append("\n")
+    body.append("  for (unsigned int i = 0; i < " + str(nb_residuals) + "; ++i) {\n")
+    body.append("    jt.changeCol();\n")
+    body.append("    for (unsigned int k = jacEqBegin[i]; k < jacEqBegin[i + 1]; ++k)\n")
+    body.append("      jt.addTerm(jacVarIndexes[k] + rowOffset, jacValues[k]);\n")
+    body.append("  }\n")
+    body.append("  return true;\n")
+    return body
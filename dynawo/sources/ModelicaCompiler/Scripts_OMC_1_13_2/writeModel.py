@@ -162,6 +162,7 @@ if __name__ == '__main__':
         writer_init_pb.fill_setVariables()
         writer_init_pb.fill_defineParameters()
         writer_init_pb.fill_evalFAdept()
+        writer_init_pb.fill_evalJt_omc()
         writer_init_pb.fill_warnings()
         writer_init_pb.fill_setFequations()
         writer_init_pb.fill_setGequations()
@@ -272,6 +273,7 @@ if __name__ == '__main__':
     writer.fill_defineParameters()
     writer.fill_defineElements()
     writer.fill_evalFAdept()
+    writer.fill_evalJt_omc()
     writer.fill_warnings()
     writer.fill_setFequations()
     writer.fill_setGequations()
@@ -7,6 +7,7 @@
 #include <math.h>
 
 #include "DYNElement.h"
+#include "DYNSparseMatrix.h"
 #include "PARParametersSetFactory.h"
 
 #include "GeneratorPQ_Dyn.h"
@@ -198,11 +199,17 @@ void ModelGeneratorPQ_Dyn::initRpar()
   data->simulationInfo->integerParameter[1] /* generator.State0 */ = generator_State0_;
 
   // Setting internal parameters 
+  // Setting the subexpressions only depending on the parameters
+  paramExpression0_ = 0.0001 + data->simulationInfo->realParameter[8] /* generator.UMaxPu PARAM */;
+  paramExpression1_ = -0.0001 + data->simulationInfo->realParameter[9] /* generator.UMinPu PARAM */;
+  paramExpression2_ = -0.0001 + data->simulationInfo->realParameter[8] /* generator.UMaxPu PARAM */;
+  paramExpression3_ = 0.0001 + data->simulationInfo->realParameter[9] /* generator.UMinPu PARAM */;
 
   return;
 }
 
-void ModelGeneratorPQ_Dyn::setFomc(double * f, propertyF_t type)
+template<propertyF_t type>
+void ModelGeneratorPQ_Dyn::setFomcKernel(double * f)
 {
   if (type != DIFFERENTIAL_EQ) {
   {
@@ -348,6 +355,39 @@ void ModelGeneratorPQ_Dyn::setFomc(double * f, propertyF_t type)
   }
 }
 
+void ModelGeneratorPQ_Dyn::setFomc(double * f, propertyF_t type)
+{
+  switch (type) {
+    case ALGEBRAIC_EQ:
+      setFomcKernel<ALGEBRAIC_EQ>(f);
+      break;
+    case DIFFERENTIAL_EQ:
+      setFomcKernel<DIFFERENTIAL_EQ>(f);
+      break;
+    default:
+      setFomcKernel<UNDEFINED_EQ>(f);
+      break;
+  }
+}
+
+void ModelGeneratorPQ_Dyn::setFomcBatch(ModelModelica* const* instances, double* const* f, const unsigned int nbInstances, const propertyF_t type)
+{
+  switch (type) {
+    case ALGEBRAIC_EQ:
+      for (unsigned int i = 0; i < nbInstances; ++i)
+        static_cast<ModelGeneratorPQ_Dyn*>(instances[i])->setFomcKernel<ALGEBRAIC_EQ>(f[i]);
+      break;
+    case DIFFERENTIAL_EQ:
+      for (unsigned int i = 0; i < nbInstances; ++i)
+        static_cast<ModelGeneratorPQ_Dyn*>(instances[i])->setFomcKernel<DIFFERENTIAL_EQ>(f[i]);
+      break;
+    default:
+      for (unsigned int i = 0; i < nbInstances; ++i)
+        static_cast<ModelGeneratorPQ_Dyn*>(instances[i])->setFomcKernel<UNDEFINED_EQ>(f[i]);
+      break;
+  }
+}
+
 modeChangeType_t ModelGeneratorPQ_Dyn::evalMode(const double t) const
 {
   modeChangeType_t modeChangeType = NO_MODE;
@@ -544,10 +584,10 @@ void ModelGeneratorPQ_Dyn::setGomc(state_g * gout)
   tmp_zc3 = LessEqZC(data->localData[0]->realVars[4] /* generator.PGenRawPu variable */, data->simulationInfo->realParameter[3] /* generator.PMinPu PARAM */, data->simulationInfo->storedRelations[2]);
   tmp_zc5 = GreaterZC(data->localData[0]->realVars[4] /* generator.PGenRawPu variable */, data->simulationInfo->realParameter[3] /* generator.PMinPu PARAM */, data->simulationInfo->storedRelations[3]);
   tmp_zc7 = LessZC(data->localData[0]->realVars[4] /* generator.PGenRawPu variable */, data->simulationInfo->realParameter[2] /* generator.PMaxPu PARAM */, data->simulationInfo->storedRelations[4]);
-  tmp_zc9 = GreaterEqZC(data->localData[0]->realVars[8] /* generator.UPu variable */, 0.0001 + data->simulationInfo->realParameter[8] /* generator.UMaxPu PARAM */, data->simulationInfo->storedRelations[5]);
-  tmp_zc11 = LessEqZC(data->localData[0]->realVars[8] /* generator.UPu variable */, -0.0001 + data->simulationInfo->realParameter[9] /* generator.UMinPu PARAM */, data->simulationInfo->storedRelations[6]);
-  tmp_zc13 = LessZC(data->localData[0]->realVars[8] /* generator.UPu variable */, -0.0001 + data->simulationInfo->realParameter[8] /* generator.UMaxPu PARAM */, data->simulationInfo->storedRelations[7]);
-  tmp_zc15 = GreaterZC(data->localData[0]->realVars[8] /* generator.UPu variable */, 0.0001 + data->simulationInfo->realParameter[9] /* generator.UMinPu PARAM */, data->simulationInfo->storedRelations[8]);
+  tmp_zc9 = GreaterEqZC(data->localData[0]->realVars[8] /* generator.UPu variable */, paramExpression0_, data->simulationInfo->storedRelations[5]);
+  tmp_zc11 = LessEqZC(data->localData[0]->realVars[8] /* generator.UPu variable */, paramExpression1_, data->simulationInfo->storedRelations[6]);
+  tmp_zc13 = LessZC(data->localData[0]->realVars[8] /* generator.UPu variable */, paramExpression2_, data->simulationInfo->storedRelations[7]);
+  tmp_zc15 = GreaterZC(data->localData[0]->realVars[8] /* generator.UPu variable */, paramExpression3_, data->simulationInfo->storedRelations[8]);
   
 
   gout[0] = ((tmp_zc1 && (data->simulationInfo->integerDoubleVarsPre[0] /* generator.pStatus DISCRETE */ != 3))) ? ROOT_UP : ROOT_DOWN;
@@ -562,6 +602,12 @@ void ModelGeneratorPQ_Dyn::setGomc(state_g * gout)
   data->simulationInfo->discreteCall = 0;
 }
 
+void ModelGeneratorPQ_Dyn::setGomcBatch(ModelModelica* const* instances, state_g* const* g, const unsigned int nbInstances)
+{
+  for (unsigned int i = 0; i < nbInstances; ++i)
+    static_cast<ModelGeneratorPQ_Dyn*>(instances[i])->ModelGeneratorPQ_Dyn::setGomc(g[i]);
+}
+
 void ModelGeneratorPQ_Dyn::setY0omc()
 {
   data->localData[0]->realVars[0] /* generator.omegaRefPu.value */ = 0.0;
@@ -978,6 +1024,211 @@ void ModelGeneratorPQ_Dyn::evalFAdept(const std::vector<adept::adouble> & x,
 }
 #endif
 
+bool ModelGeneratorPQ_Dyn::evalJt_omc(const double* x, const double* /*xd*/, const double /*cj*/, const double coeff,
+                              const int rowOffset, SparseMatrix& jt)
+{
+  static const unsigned int jacEqBegin[] = {0, 3, 5, 7, 9, 14, 15, 17, 22};
+  static const unsigned int jacVarIndexes[] = {1, 2, 8, 0, 4, 3, 4, 3, 7, 1, 2, 7, 9, 10, 5, 5, 6, 1, 2, 6, 9, 10};
+  double jacValues[22];
+  double $DAEres3;
+  double d_$DAEres3_x1;
+  double d_$DAEres3_x2;
+  double d_$DAEres3_x7;
+  double d_$DAEres3_x9;
+  double d_$DAEres3_x10;
+  double $DAEres4;
+  double d_$DAEres4_x1;
+  double d_$DAEres4_x2;
+  double d_$DAEres4_x6;
+  double d_$DAEres4_x9;
+  double d_$DAEres4_x10;
+  // ----- GeneratorPQ_eqFunction_63 -----
+  {
+  double tmp0;
+  double d_tmp0_x2;
+  double tmp1;
+  double d_tmp1_x1;
+  double tmp2;
+  d_tmp0_x2 = 1.0;
+  tmp0 = x[2];
+  d_tmp1_x1 = 1.0;
+  tmp1 = x[1];
+  jacValues[0] = (coeff) * ((-(1.0 / (2.0 * sqrt(((tmp0 * tmp0) + (tmp1 * tmp1))))) * (((tmp1) * (d_tmp1_x1) + (tmp1) * (d_tmp1_x1)))));
+  jacValues[1] = (coeff) * ((-(1.0 / (2.0 * sqrt(((tmp0 * tmp0) + (tmp1 * tmp1))))) * (((tmp0) * (d_tmp0_x2) + (tmp0) * (d_tmp0_x2)))));
+  jacValues[2] = coeff;
+
+  }
+
+
+  // ----- GeneratorPQ_eqFunction_81 -----
+  {
+  modelica_boolean tmp12;
+  double tmp13;
+  double d_tmp13_x0;
+  tmp12 = (modelica_boolean)(toNativeBool (data->localData[0]->discreteVars[0] /* generator.running.value DISCRETE */));
+  if(tmp12)
+  {
+    d_tmp13_x0 = (data->simulationInfo->realParameter[0]) * ((-1.0));
+    tmp13 = data->simulationInfo->realParameter[1] /* generator.PGen0Pu PARAM */ + (data->simulationInfo->realParameter[0] /* generator.AlphaPu PARAM */) * (1.0 - x[0]);
+  }
+  else
+  {
+    d_tmp13_x0 = 0.0;
+    tmp13 = 0.0;
+  }
+  jacValues[3] = (coeff) * ((-d_tmp13_x0));
+  jacValues[4] = coeff;
+
+  }
+
+
+  // ----- GeneratorPQ_eqFunction_90 -----
+  {
+  modelica_boolean tmp24;
+  double tmp25;
+  double d_tmp25_x4;
+  modelica_boolean tmp26;
+  double tmp27;
+  double d_tmp27_x4;
+  modelica_boolean tmp28;
+  double tmp29;
+  double d_tmp29_x4;
+  tmp28 = (modelica_boolean)(toNativeBool (data->localData[0]->discreteVars[0] /* generator.running.value DISCRETE */));
+  if(tmp28)
+  {
+    tmp26 = (modelica_boolean)((modelica_integer)data->localData[0]->integerDoubleVars[0] /* generator.pStatus DISCRETE */ == 3);
+    if(tmp26)
+    {
+      d_tmp27_x4 = 0.0;
+      tmp27 = data->simulationInfo->realParameter[2] /* generator.PMaxPu PARAM */;
+    }
+    else
+    {
+      tmp24 = (modelica_boolean)((modelica_integer)data->localData[0]->integerDoubleVars[0] /* generator.pStatus DISCRETE */ == 2);
+      if(tmp24)
+      {
+        d_tmp25_x4 = 0.0;
+        tmp25 = data->simulationInfo->realParameter[3] /* generator.PMinPu PARAM */;
+      }
+      else
+      {
+        d_tmp25_x4 = 1.0;
+        tmp25 = x[4];
+      }
+      d_tmp27_x4 = d_tmp25_x4;
+      tmp27 = tmp25;
+    }
+    d_tmp29_x4 = d_tmp27_x4;
+    tmp29 = tmp27;
+  }
+  else
+  {
+    d_tmp29_x4 = 0.0;
+    tmp29 = 0.0;
+  }
+  jacValues[5] = coeff;
+  jacValues[6] = (coeff) * ((-d_tmp29_x4));
+
+  }
+
+
+  // ----- GeneratorPQ_eqFunction_91 -----
+  {
+  jacValues[7] = (coeff) * ((-1.0));
+  jacValues[8] = coeff;
+
+  }
+
+
+  // ----- GeneratorPQ_eqFunction_92 -----
+  {
+  d_$DAEres3_x1 = (-x[9]);
+  d_$DAEres3_x2 = (x[10]) * ((-1.0));
+  d_$DAEres3_x7 = (-1.0);
+  d_$DAEres3_x9 = (-x[1]);
+  d_$DAEres3_x10 = (-x[2]);
+  $DAEres3 = ((-x[2])) * (x[10]) - x[7] - ((x[1]) * (x[9]));
+  jacValues[9] = (coeff) * (d_$DAEres3_x1);
+  jacValues[10] = (coeff) * (d_$DAEres3_x2);
+  jacValues[11] = (coeff) * (d_$DAEres3_x7);
+  jacValues[12] = (coeff) * (d_$DAEres3_x9);
+  jacValues[13] = (coeff) * (d_$DAEres3_x10);
+
+  }
+
+
+  // ----- GeneratorPQ_eqFunction_93 -----
+  {
+  modelica_boolean tmp32;
+  double tmp33;
+  modelica_boolean tmp34;
+  double tmp35;
+  modelica_boolean tmp36;
+  double tmp37;
+  tmp36 = (modelica_boolean)(toNativeBool (data->localData[0]->discreteVars[0] /* generator.running.value DISCRETE */));
+  if(tmp36)
+  {
+    tmp34 = (modelica_boolean)(data->simulationInfo->integerDoubleVarsPre[1] /* generator.qStatus DISCRETE */ == 2);
+    if(tmp34)
+    {
+      tmp35 = data->simulationInfo->realParameter[5] /* generator.QMaxPu PARAM */;
+    }
+    else
+    {
+      tmp32 = (modelica_boolean)(data->simulationInfo->integerDoubleVarsPre[1] /* generator.qStatus DISCRETE */ == 3);
+      if(tmp32)
+      {
+        tmp33 = data->simulationInfo->realParameter[6] /* generator.QMinPu PARAM */;
+      }
+      else
+      {
+        tmp33 = data->simulationInfo->realParameter[4] /* generator.QGen0Pu PARAM */;
+      }
+      tmp35 = tmp33;
+    }
+    tmp37 = tmp35;
+  }
+  else
+  {
+    tmp37 = 0.0;
+  }
+  jacValues[14] = coeff;
+
+  }
+
+
+  // ----- GeneratorPQ_eqFunction_94 -----
+  {
+  jacValues[15] = (coeff) * ((-1.0));
+  jacValues[16] = coeff;
+
+  }
+
+
+  // ----- GeneratorPQ_eqFunction_95 -----
+  {
+  d_$DAEres4_x1 = (x[10]) * ((-1.0));
+  d_$DAEres4_x2 = x[9];
+  d_$DAEres4_x6 = (-1.0);
+  d_$DAEres4_x9 = x[2];
+  d_$DAEres4_x10 = (-x[1]);
+  $DAEres4 = (x[2]) * (x[9]) + ((-x[1])) * (x[10]) - x[6];
+  jacValues[17] = (coeff) * (d_$DAEres4_x1);
+  jacValues[18] = (coeff) * (d_$DAEres4_x2);
+  jacValues[19] = (coeff) * (d_$DAEres4_x6);
+  jacValues[20] = (coeff) * (d_$DAEres4_x9);
+  jacValues[21] = (coeff) * (d_$DAEres4_x10);
+
+  }
+
+  for (unsigned int i = 0; i < 8; ++i) {
+    jt.changeCol();
+    for (unsigned int k = jacEqBegin[i]; k < jacEqBegin[i + 1]; ++k)
+      jt.addTerm(jacVarIndexes[k] + rowOffset, jacValues[k]);
+  }
+  return true;
+}
+
 void ModelGeneratorPQ_Dyn::checkDataCoherence()
 {
 }
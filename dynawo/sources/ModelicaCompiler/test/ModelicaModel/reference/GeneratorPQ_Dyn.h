@@ -31,6 +31,8 @@ namespace DYN {
     void initRpar();
     void setFomc(double * f, propertyF_t type);
     void setGomc(state_g * g);
+    void setFomcBatch(ModelModelica* const* instances, double* const* f, const unsigned int nbInstances, const propertyF_t type);
+    void setGomcBatch(ModelModelica* const* instances, state_g* const* g, const unsigned int nbInstances);
     modeChangeType_t evalMode(const double t) const;
     void setZomc();
     void collectSilentZ(BitMask* silentZTable);
@@ -49,6 +51,7 @@ namespace DYN {
     void evalCalculatedVars(std::vector<double>& calculatedVars);
     double evalCalculatedVarI(unsigned iCalculatedVar) const;
     void getIndexesOfVariablesUsedForCalculatedVarI(unsigned iCalculatedVar, std::vector<int>& indexes) const;
+    bool evalJt_omc(const double* y, const double* yp, double cj, double coeff, int rowOffset, SparseMatrix& jt);
 #ifdef _ADEPT_
     void evalFAdept(const std::vector<adept::adouble> &y, const std::vector<adept::adouble> &yp, std::vector<adept::adouble> &F);
     adept::adouble evalCalculatedVarIAdept(unsigned iCalculatedVar, unsigned indexOffset, const std::vector<adept::adouble> &y, const std::vector<adept::adouble> &yp) const;
@@ -62,7 +65,7 @@ namespace DYN {
     inline void setModelType(std::string modelType) { modelType_ = modelType; }
     inline ModelManager * getModelManager() const { return modelManager_; }
     inline void setModelManager (ModelManager * model) { modelManager_ = model; }
-    void checkSum(std::string & checkSum) { checkSum = std::string("d7c86145450ecd4b02384d08cd9ead69"); }
+    void checkSum(std::string & checkSum) { checkSum = std::string("93ce62694ff4db81d44ced1ff071a504"); }
     inline bool isDataStructInitialized() const { return dataStructInitialized_; }
 
     private:
@@ -77,6 +80,7 @@ namespace DYN {
     void setupDataStruc();
     void initializeDataStruc();
     void deInitializeDataStruc();
+    template<propertyF_t type> void setFomcKernel(double * f);
 
     private:
    //External Calls
@@ -145,6 +149,11 @@ namespace DYN {
       double generator_u0Pu_re_;
       int generator_NbSwitchOffSignals_;
       int generator_State0_;
+      // Subexpressions only depending on the parameters
+      double paramExpression0_;
+      double paramExpression1_;
+      double paramExpression2_;
+      double paramExpression3_;
 
   };
 }//end namespace DYN
@@ -7,6 +7,7 @@
 #include <math.h>
 
 #include "DYNElement.h"
+#include "DYNSparseMatrix.h"
 #include "PARParametersSetFactory.h"
 
 #include "GeneratorPQ_Init.h"
@@ -186,11 +187,15 @@ void ModelGeneratorPQ_Init::initRpar()
   data->simulationInfo->realParameter[3] /* generator.UPhase0 */ = generator_UPhase0_;
 
   // Setting internal parameters 
+  // Setting the subexpressions only depending on the parameters
+  paramExpression0_ = cos(data->simulationInfo->realParameter[3] /* generator.UPhase0 PARAM */);
+  paramExpression1_ = sin(data->simulationInfo->realParameter[3] /* generator.UPhase0 PARAM */);
 
   return;
 }
 
-void ModelGeneratorPQ_Init::setFomc(double * f, propertyF_t type)
+template<propertyF_t type>
+void ModelGeneratorPQ_Init::setFomcKernel(double * f)
 {
   if (type != DIFFERENTIAL_EQ) {
   {
@@ -209,7 +214,7 @@ void ModelGeneratorPQ_Init::setFomc(double * f, propertyF_t type)
 
   {
   // ----- GeneratorPQ_INIT_eqFunction_12 -----
-  $P$cse2 = cos(data->simulationInfo->realParameter[3] /* generator.UPhase0 PARAM */);
+  $P$cse2 = paramExpression0_;
 
   }
 
@@ -223,7 +228,7 @@ void ModelGeneratorPQ_Init::setFomc(double * f, propertyF_t type)
 
   {
   // ----- GeneratorPQ_INIT_eqFunction_14 -----
-  $P$cse1 = sin(data->simulationInfo->realParameter[3] /* generator.UPhase0 PARAM */);
+  $P$cse1 = paramExpression1_;
 
   }
 
@@ -254,6 +259,39 @@ void ModelGeneratorPQ_Init::setFomc(double * f, propertyF_t type)
   }
 }
 
+void ModelGeneratorPQ_Init::setFomc(double * f, propertyF_t type)
+{
+  switch (type) {
+    case ALGEBRAIC_EQ:
+      setFomcKernel<ALGEBRAIC_EQ>(f);
+      break;
+    case DIFFERENTIAL_EQ:
+      setFomcKernel<DIFFERENTIAL_EQ>(f);
+      break;
+    default:
+      setFomcKernel<UNDEFINED_EQ>(f);
+      break;
+  }
+}
+
+void ModelGeneratorPQ_Init::setFomcBatch(ModelModelica* const* instances, double* const* f, const unsigned int nbInstances, const propertyF_t type)
+{
+  switch (type) {
+    case ALGEBRAIC_EQ:
+      for (unsigned int i = 0; i < nbInstances; ++i)
+        static_cast<ModelGeneratorPQ_Init*>(instances[i])->setFomcKernel<ALGEBRAIC_EQ>(f[i]);
+      break;
+    case DIFFERENTIAL_EQ:
+      for (unsigned int i = 0; i < nbInstances; ++i)
+        static_cast<ModelGeneratorPQ_Init*>(instances[i])->setFomcKernel<DIFFERENTIAL_EQ>(f[i]);
+      break;
+    default:
+      for (unsigned int i = 0; i < nbInstances; ++i)
+        static_cast<ModelGeneratorPQ_Init*>(instances[i])->setFomcKernel<UNDEFINED_EQ>(f[i]);
+      break;
+  }
+}
+
 modeChangeType_t ModelGeneratorPQ_Init::evalMode(const double t) const
 {
   modeChangeType_t modeChangeType = NO_MODE;
@@ -272,6 +310,12 @@ void ModelGeneratorPQ_Init::setGomc(state_g * gout)
   data->simulationInfo->discreteCall = 0;
 }
 
+void ModelGeneratorPQ_Init::setGomcBatch(ModelModelica* const* instances, state_g* const* g, const unsigned int nbInstances)
+{
+  for (unsigned int i = 0; i < nbInstances; ++i)
+    static_cast<ModelGeneratorPQ_Init*>(instances[i])->ModelGeneratorPQ_Init::setGomc(g[i]);
+}
+
 void ModelGeneratorPQ_Init::setZomc()
 {
 }
@@ -426,6 +470,109 @@ void ModelGeneratorPQ_Init::evalFAdept(const std::vector<adept::adouble> & x,
 }
 #endif
 
+bool ModelGeneratorPQ_Init::evalJt_omc(const double* x, const double* /*xd*/, const double /*cj*/, const double coeff,
+                              const int rowOffset, SparseMatrix& jt)
+{
+  static const unsigned int jacEqBegin[] = {0, 1, 2, 3, 4, 9, 14};
+  static const unsigned int jacVarIndexes[] = {3, 2, 5, 4, 0, 1, 2, 4, 5, 0, 1, 3, 4, 5};
+  double jacValues[14];
+  double $cse1;
+  double $cse2;
+  double $DAEres0;
+  double d_$DAEres0_x0;
+  double d_$DAEres0_x1;
+  double d_$DAEres0_x2;
+  double d_$DAEres0_x4;
+  double d_$DAEres0_x5;
+  double $DAEres1;
+  double d_$DAEres1_x0;
+  double d_$DAEres1_x1;
+  double d_$DAEres1_x3;
+  double d_$DAEres1_x4;
+  double d_$DAEres1_x5;
+  // ----- GeneratorPQ_INIT_eqFunction_10 -----
+  {
+  jacValues[0] = coeff;
+
+  }
+
+
+  // ----- GeneratorPQ_INIT_eqFunction_11 -----
+  {
+  jacValues[1] = coeff;
+
+  }
+
+
+  // ----- GeneratorPQ_INIT_eqFunction_12 -----
+  {
+  $cse2 = cos(data->simulationInfo->realParameter[3] /* generator.UPhase0 PARAM */);
+
+  }
+
+
+  // ----- GeneratorPQ_INIT_eqFunction_13 -----
+  {
+  jacValues[2] = coeff;
+
+  }
+
+
+  // ----- GeneratorPQ_INIT_eqFunction_14 -----
+  {
+  $cse1 = sin(data->simulationInfo->realParameter[3] /* generator.UPhase0 PARAM */);
+
+  }
+
+
+  // ----- GeneratorPQ_INIT_eqFunction_15 -----
+  {
+  jacValues[3] = coeff;
+
+  }
+
+
+  // ----- GeneratorPQ_INIT_eqFunction_16 -----
+  {
+  d_$DAEres0_x0 = (-x[5]);
+  d_$DAEres0_x1 = x[4];
+  d_$DAEres0_x2 = (-1.0);
+  d_$DAEres0_x4 = x[1];
+  d_$DAEres0_x5 = (x[0]) * ((-1.0));
+  $DAEres0 = (x[4]) * (x[1]) + ((-x[5])) * (x[0]) - x[2];
+  jacValues[4] = (coeff) * (d_$DAEres0_x0);
+  jacValues[5] = (coeff) * (d_$DAEres0_x1);
+  jacValues[6] = (coeff) * (d_$DAEres0_x2);
+  jacValues[7] = (coeff) * (d_$DAEres0_x4);
+  jacValues[8] = (coeff) * (d_$DAEres0_x5);
+
+  }
+
+
+  // ----- GeneratorPQ_INIT_eqFunction_17 -----
+  {
+  d_$DAEres1_x0 = x[4];
+  d_$DAEres1_x1 = x[5];
+  d_$DAEres1_x3 = (-1.0);
+  d_$DAEres1_x4 = x[0];
+  d_$DAEres1_x5 = x[1];
+  $DAEres1 = (x[4]) * (x[0]) + (x[5]) * (x[1]) - x[3];
+  jacValues[9] = (coeff) * (d_$DAEres1_x0);
+  jacValues[10] = (coeff) * (d_$DAEres1_x1);
+  jacValues[11] = (coeff) * (d_$DAEres1_x3);
+  jacValues[12] = (coeff) * (d_$DAEres1_x4);
+  jacValues[13] = (coeff) * (d_$DAEres1_x5);
+
+  }
+
+  for (unsigned int i = 0; i < 6; ++i) {
+    jt.changeCol();
+    for (unsigned int k = jacEqBegin[i]; k < jacEqBegin[i + 1]; ++k)
+      jt.addTerm(jacVarIndexes[k] + rowOffset, jacValues[k]);
+  }
+  return true;
+}
+
 void ModelGeneratorPQ_Init::checkDataCoherence()
 {
 }
@@ -30,6 +30,8 @@ namespace DYN {
     void initRpar();
     void setFomc(double * f, propertyF_t type);
     void setGomc(state_g * g);
+    void setFomcBatch(ModelModelica* const* instances, double* const* f, const unsigned int nbInstances, const propertyF_t type);
+    void setGomcBatch(ModelModelica* const* instances, state_g* const* g, const unsigned int nbInstances);
     modeChangeType_t evalMode(const double t) const;
     void setZomc();
     void collectSilentZ(BitMask* silentZTable);
@@ -47,6 +49,7 @@ namespace DYN {
     void evalCalculatedVars(std::vector<double>& calculatedVars);
     double evalCalculatedVarI(unsigned iCalculatedVar) const;
     void getIndexesOfVariablesUsedForCalculatedVarI(unsigned iCalculatedVar, std::vector<int>& indexes) const;
+    bool evalJt_omc(const double* y, const double* yp, double cj, double coeff, int rowOffset, SparseMatrix& jt);
 #ifdef _ADEPT_
     void evalFAdept( const std::vector<adept::adouble> &y, const std::vector<adept::adouble> &yp, std::vector<adept::adouble> &F);
     adept::adouble evalCalculatedVarIAdept(unsigned iCalculatedVar, unsigned indexOffset, const std::vector<adept::adouble> &y, const std::vector<adept::adouble> &yp) const;
@@ -60,7 +63,7 @@ namespace DYN {
     inline void setModelType(std::string modelType) { modelType_ = modelType; }
     inline ModelManager * getModelManager() const { return modelManager_; }
     inline void setModelManager (ModelManager * model) { modelManager_ = model; }
-    void checkSum(std::string & checkSum) { checkSum = std::string("96944ff6f8df698d2b20d3bb7a28dbd5"); }
+    void checkSum(std::string & checkSum) { checkSum = std::string("3111adee3b0c647436d71086630829c8"); }
     inline bool isDataStructInitialized() const { return dataStructInitialized_; }
 
     private:
@@ -75,6 +78,7 @@ namespace DYN {
     void setupDataStruc();
     void initializeDataStruc();
     void deInitializeDataStruc();
+    template<propertyF_t type> void setFomcKernel(double * f);
 
     private:
    //External Calls
@@ -120,6 +124,9 @@ namespace DYN {
       double generator_Q0Pu_;
       double generator_U0Pu_;
       double generator_UPhase0_;
+      // Subexpressions only depending on the parameters
+      double paramExpression0_;
+      double paramExpression1_;
 
    };
 }//end namespace DYN
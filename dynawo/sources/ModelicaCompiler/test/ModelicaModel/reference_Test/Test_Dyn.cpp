@@ -7,6 +7,7 @@
 #include <math.h>
 
 #include "DYNElement.h"
+#include "DYNSparseMatrix.h"
 #include "PARParametersSetFactory.h"
 
 #include "Test_Dyn.h"
@@ -188,7 +189,8 @@ void ModelTest_Dyn::initRpar()
   return;
 }
 
-void ModelTest_Dyn::setFomc(double * f, propertyF_t type)
+template<propertyF_t type>
+void ModelTest_Dyn::setFomcKernel(double * f)
 {
   if (type != ALGEBRAIC_EQ) {
   {
@@ -202,6 +204,39 @@ void ModelTest_Dyn::setFomc(double * f, propertyF_t type)
   }
 }
 
+void ModelTest_Dyn::setFomc(double * f, propertyF_t type)
+{
+  switch (type) {
+    case ALGEBRAIC_EQ:
+      setFomcKernel<ALGEBRAIC_EQ>(f);
+      break;
+    case DIFFERENTIAL_EQ:
+      setFomcKernel<DIFFERENTIAL_EQ>(f);
+      break;
+    default:
+      setFomcKernel<UNDEFINED_EQ>(f);
+      break;
+  }
+}
+
+void ModelTest_Dyn::setFomcBatch(ModelModelica* const* instances, double* const* f, const unsigned int nbInstances, const propertyF_t type)
+{
+  switch (type) {
+    case ALGEBRAIC_EQ:
+      for (unsigned int i = 0; i < nbInstances; ++i)
+        static_cast<ModelTest_Dyn*>(instances[i])->setFomcKernel<ALGEBRAIC_EQ>(f[i]);
+      break;
+    case DIFFERENTIAL_EQ:
+      for (unsigned int i = 0; i < nbInstances; ++i)
+        static_cast<ModelTest_Dyn*>(instances[i])->setFomcKernel<DIFFERENTIAL_EQ>(f[i]);
+      break;
+    default:
+      for (unsigned int i = 0; i < nbInstances; ++i)
+        static_cast<ModelTest_Dyn*>(instances[i])->setFomcKernel<UNDEFINED_EQ>(f[i]);
+      break;
+  }
+}
+
 modeChangeType_t ModelTest_Dyn::evalMode(const double t) const
 {
   modeChangeType_t modeChangeType = NO_MODE;
@@ -228,6 +263,12 @@ void ModelTest_Dyn::setGomc(state_g * gout)
   data->simulationInfo->discreteCall = 0;
 }
 
+void ModelTest_Dyn::setGomcBatch(ModelModelica* const* instances, state_g* const* g, const unsigned int nbInstances)
+{
+  for (unsigned int i = 0; i < nbInstances; ++i)
+    static_cast<ModelTest_Dyn*>(instances[i])->ModelTest_Dyn::setGomc(g[i]);
+}
+
 void ModelTest_Dyn::setY0omc()
 {
   data->localData[0]->realVars[0] /* u */ = 1.0;
@@ -328,6 +369,32 @@ void ModelTest_Dyn::evalFAdept(const std::vector<adept::adouble> & x,
 }
 #endif
 
+bool ModelTest_Dyn::evalJt_omc(const double* x, const double* xd, const double cj, const double coeff,
+                              const int rowOffset, SparseMatrix& jt)
+{
+  static const unsigned int jacEqBegin[] = {0, 1};
+  static const unsigned int jacVarIndexes[] = {0};
+  double jacValues[1];
+  double $DAEres0;
+  double d_$DAEres0_x0;
+  double d_$DAEres0_xd0;
+  // ----- Test.Test_eqFunction_7 -----
+  {
+  d_$DAEres0_x0 = (-data->simulationInfo->realParameter[1]);
+  d_$DAEres0_xd0 = (-data->simulationInfo->realParameter[0]);
+  $DAEres0 = ((-data->simulationInfo->realParameter[1] /* b PARAM */)) * (x[0]) - ((data->simulationInfo->realParameter[0] /* a PARAM */) * (xd[0]));
+  jacValues[0] = ((coeff) * (d_$DAEres0_x0) + (cj) * (d_$DAEres0_xd0));
+
+  }
+
+  for (unsigned int i = 0; i < 1; ++i) {
+    jt.changeCol();
+    for (unsigned int k = jacEqBegin[i]; k < jacEqBegin[i + 1]; ++k)
+      jt.addTerm(jacVarIndexes[k] + rowOffset, jacValues[k]);
+  }
+  return true;
+}
+
 void ModelTest_Dyn::checkDataCoherence()
 {
 }
@@ -354,7 +421,7 @@ void ModelTest_Dyn::evalCalculatedVars(std::vector<double>& calculatedVars)
       calculatedVars[0] /* y*/ = (2.0) * (data->localData[0]->realVars[0] /* u STATE(1) */);
   }
   {
-      calculatedVars[1] /* z*/ = (4.0) * ((evalCalculatedVarI(0) /* y variable */) * (data->localData[0]->realVars[0] /* u STATE(1) */));
+      calculatedVars[1] /* z*/ = (4.0) * ((calculatedVars[0] /* y variable */) * (data->localData[0]->realVars[0] /* u STATE(1) */));
   }
 }
 
@@ -7,6 +7,7 @@
 #include <math.h>
 
 #include "DYNElement.h"
+#include "DYNSparseMatrix.h"
 #include "PARParametersSetFactory.h"
 
 #include "TestSilentZ_Dyn.h"
@@ -186,7 +187,8 @@ void ModelTestSilentZ_Dyn::initRpar()
   return;
 }
 
-void ModelTestSilentZ_Dyn::setFomc(double * f, propertyF_t type)
+template<propertyF_t type>
+void ModelTestSilentZ_Dyn::setFomcKernel(double * f)
 {
   if (type != ALGEBRAIC_EQ) {
   {
@@ -200,6 +202,39 @@ void ModelTestSilentZ_Dyn::setFomc(double * f, propertyF_t type)
   }
 }
 
+void ModelTestSilentZ_Dyn::setFomc(double * f, propertyF_t type)
+{
+  switch (type) {
+    case ALGEBRAIC_EQ:
+      setFomcKernel<ALGEBRAIC_EQ>(f);
+      break;
+    case DIFFERENTIAL_EQ:
+      setFomcKernel<DIFFERENTIAL_EQ>(f);
+      break;
+    default:
+      setFomcKernel<UNDEFINED_EQ>(f);
+      break;
+  }
+}
+
+void ModelTestSilentZ_Dyn::setFomcBatch(ModelModelica* const* instances, double* const* f, const unsigned int nbInstances, const propertyF_t type)
+{
+  switch (type) {
+    case ALGEBRAIC_EQ:
+      for (unsigned int i = 0; i < nbInstances; ++i)
+        static_cast<ModelTestSilentZ_Dyn*>(instances[i])->setFomcKernel<ALGEBRAIC_EQ>(f[i]);
+      break;
+    case DIFFERENTIAL_EQ:
+      for (unsigned int i = 0; i < nbInstances; ++i)
+        static_cast<ModelTestSilentZ_Dyn*>(instances[i])->setFomcKernel<DIFFERENTIAL_EQ>(f[i]);
+      break;
+    default:
+      for (unsigned int i = 0; i < nbInstances; ++i)
+        static_cast<ModelTestSilentZ_Dyn*>(instances[i])->setFomcKernel<UNDEFINED_EQ>(f[i]);
+      break;
+  }
+}
+
 modeChangeType_t ModelTestSilentZ_Dyn::evalMode(const double t) const
 {
   modeChangeType_t modeChangeType = NO_MODE;
@@ -279,6 +314,12 @@ void ModelTestSilentZ_Dyn::setGomc(state_g * gout)
   data->simulationInfo->discreteCall = 0;
 }
 
+void ModelTestSilentZ_Dyn::setGomcBatch(ModelModelica* const* instances, state_g* const* g, const unsigned int nbInstances)
+{
+  for (unsigned int i = 0; i < nbInstances; ++i)
+    static_cast<ModelTestSilentZ_Dyn*>(instances[i])->ModelTestSilentZ_Dyn::setGomc(g[i]);
+}
+
 void ModelTestSilentZ_Dyn::setY0omc()
 {
   data->localData[0]->realVars[0] /* u */ = 1.0;
@@ -380,6 +421,30 @@ void ModelTestSilentZ_Dyn::evalFAdept(const std::vector<adept::adouble> & x,
 }
 #endif
 
+bool ModelTestSilentZ_Dyn::evalJt_omc(const double* /*x*/, const double* xd, const double cj, const double /*coeff*/,
+                              const int rowOffset, SparseMatrix& jt)
+{
+  static const unsigned int jacEqBegin[] = {0, 1};
+  static const unsigned int jacVarIndexes[] = {0};
+  double jacValues[1];
+  double $DAEres0;
+  double d_$DAEres0_xd0;
+  // ----- TestSilentZ.TestSilentZ_eqFunction_11 -----
+  {
+  d_$DAEres0_xd0 = (-1.0);
+  $DAEres0 = 5.0 - xd[0];
+  jacValues[0] = (cj) * (d_$DAEres0_xd0);
+
+  }
+
+  for (unsigned int i = 0; i < 1; ++i) {
+    jt.changeCol();
+    for (unsigned int k = jacEqBegin[i]; k < jacEqBegin[i + 1]; ++k)
+      jt.addTerm(jacVarIndexes[k] + rowOffset, jacValues[k]);
+  }
+  return true;
+}
+
 void ModelTestSilentZ_Dyn::checkDataCoherence()
 {
 }
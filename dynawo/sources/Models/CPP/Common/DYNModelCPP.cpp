@@ -17,6 +17,7 @@
  * @brief
  *
  */
+#include <cassert>
 #include <sstream>
 
 #include <boost/archive/binary_iarchive.hpp>
@@ -24,6 +25,7 @@
 #include <boost/serialization/vector.hpp>
 
 #include "DYNModelCPP.h"
+#include "DYNSparseMatrix.h"
 #include "DYNTrace.h"
 #include "DYNMacrosMessage.h"
 #include "DYNVariableNative.h"
@@ -35,6 +37,36 @@ using std::vector;
 
 namespace DYN {
 
+void
+JacobianPattern::clear() {
+  equationsOffsets_.clear();
+  rows_.clear();
+}
+
+void
+JacobianPattern::addEquation() {
+  if (equationsOffsets_.empty())
+    equationsOffsets_.push_back(0);
+  equationsOffsets_.push_back(static_cast<unsigned int>(rows_.size()));
+}
+
+unsigned int
+JacobianPattern::addTerm(const int row) {
+  assert(!equationsOffsets_.empty() && "JacobianPattern: a term is declared before any equation");
+  rows_.push_back(row);
+  ++equationsOffsets_.back();
+  return static_cast<unsigned int>(rows_.size() - 1);
+}
+
+void
+JacobianPattern::fill(const int rowOffset, const double* values, SparseMatrix& jt) const {
+  for (std::size_t i = 1, iEnd = equationsOffsets_.size(); i < iEnd; ++i) {
+    jt.changeCol();
+    for (unsigned int k = equationsOffsets_[i - 1]; k < equationsOffsets_[i]; ++k)
+      jt.addTerm(rows_[k] + rowOffset, values[k]);
+  }
+}
+
 ModelCPP::ModelCPP() :
 isStartingFromDump_(false) {
 }
@@ -142,6 +174,26 @@ ModelCPP::loadInternalVariables(boost::archive::binary_iarchive& /*streamVariabl
   // no internal variables
 }
 
+void
+ModelCPP::snapshotSpecificState(StateBuffer& state) const {
+  // the internal variables are only serializable through an archive, which is kept in memory without header
+  stringstream values;
+  {
+    boost::archive::binary_oarchive os(values, boost::archive::no_header);
+    dumpInternalVariables(os);
+  }
+  state.write(values.str());
+}
+
+void
+ModelCPP::restoreSpecificState(StateBuffer::Reader& state) {
+  string internalVariables;
+  state.read(internalVariables);
+  stringstream values(internalVariables);
+  boost::archive::binary_iarchive is(values, boost::archive::no_header);
+  loadInternalVariables(is);
+}
+
 void
 ModelCPP::checkParametersCoherence() const {
   // not needed
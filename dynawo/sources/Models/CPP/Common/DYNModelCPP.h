@@ -31,6 +31,62 @@
 namespace DYN {
 class SparseMatrix;
 
+/**
+ * @brief sparsity pattern of the transposed Jacobian of a C++ model
+ *
+ * The model declares the terms of each equation once, each term getting a slot in an array of values: the Jacobian is
+ * then filled from the pattern and the values, without the model deriving its structure again at each evaluation.
+ */
+class JacobianPattern {
+ public:
+  /**
+   * @brief remove all the equations of the pattern
+   */
+  void clear();
+
+  /**
+   * @brief start the declaration of the terms of a new equation, i.e. a new column of the transposed Jacobian
+   */
+  void addEquation();
+
+  /**
+   * @brief declare a term of the current equation
+   *
+   * @param row local index of the variable of the term
+   * @return slot of the value of the term in the array of values
+   */
+  unsigned int addTerm(int row);
+
+  /**
+   * @brief get whether no equation is declared
+   * @return @b true if no equation is declared
+   */
+  inline bool empty() const {
+    return equationsOffsets_.size() <= 1;
+  }
+
+  /**
+   * @brief get the number of declared terms, i.e. the size of the array of values
+   * @return number of declared terms
+   */
+  inline unsigned int nbTerms() const {
+    return static_cast<unsigned int>(rows_.size());
+  }
+
+  /**
+   * @brief fill the transposed Jacobian with the declared equations
+   *
+   * @param rowOffset offset of the variables of the model in the matrix
+   * @param values values of the terms, indexed by their slot, may be null if no term is declared
+   * @param jt transposed Jacobian to fill
+   */
+  void fill(int rowOffset, const double* values, SparseMatrix& jt) const;
+
+ private:
+  std::vector<unsigned int> equationsOffsets_;  ///< slot of the first term of each equation, then the number of terms
+  std::vector<int> rows_;  ///< local index of the variable of each term
+};
+
 /**
  * @brief CPP model
  */
@@ -286,6 +342,20 @@ class ModelCPP : public SubModel {
    */
   void loadParameters(const std::string& parameters) override;
 
+  /**
+   * @brief write the internal variables in a snapshot
+   *
+   * @param state snapshot to fill
+   */
+  void snapshotSpecificState(StateBuffer& state) const override;
+
+  /**
+   * @brief restore the internal variables written by snapshotSpecificState
+   *
+   * @param state snapshot to read
+   */
+  void restoreSpecificState(StateBuffer::Reader& state) override;
+
   /**
    * @copydoc SubModel::checkParametersCoherence() const
    */
@@ -202,6 +202,13 @@ class ModelLoadRestorativeWithLimits : public ModelCPP {
   */
   void evalG(double t) override;
 
+  /**
+  * @copydoc SubModel::rootsDependOnTime() const
+  */
+  bool rootsDependOnTime() const override {
+    return false;
+  }
+
   /**
   * @copydoc ModelCPP::setGequations()
   */
@@ -21,6 +21,7 @@
 #include <sstream>
 #include <vector>
 #include <algorithm>
+#include <numeric>
 
 #include "PARParametersSet.h"
 
@@ -74,7 +75,8 @@ constexpr double ModelSecondaryVoltageControlSimplified::LEVEL_MIN;  ///< Minima
     UpRef0Pu_(0.),
     tSample_(10.),
     iTerm_(0.),
-    feedBackCorrection_(0.) {}
+    feedBackCorrection_(0.),
+    QrSum_(0.) {}
 
   void
   ModelSecondaryVoltageControlSimplified::defineParameters(std::vector<ParameterModeler>& parameters) {
@@ -107,6 +109,11 @@ constexpr double ModelSecondaryVoltageControlSimplified::LEVEL_MIN;  ///< Minima
       std::stringstream u0PuName;
       std::stringstream sNomName;
       std::stringstream xTfoPuName;
+      // the parameters may be set again, e.g. by an action
+      for (std::vector<double>* generatorsParameters : {&Qr_, &Q0Pu_, &P0Pu_, &U0Pu_, &SNom_, &XTfoPu_}) {
+        generatorsParameters->clear();
+        generatorsParameters->reserve(nbGenerators_);
+      }
       for (int s = 0; s < nbGenerators_; ++s) {
         qrName.str(std::string());
         qrName.clear();
@@ -141,6 +148,7 @@ constexpr double ModelSecondaryVoltageControlSimplified::LEVEL_MIN;  ///< Minima
         else
           XTfoPu_.push_back(0.);
       }
+      QrSum_ = std::accumulate(Qr_.begin(), Qr_.end(), 0.);
     } catch (const DYN::Error& e) {
       Trace::error() << e.what() << Trace::endline;
       throw DYNError(Error::MODELER, NetworkParameterNotFoundFor, name());
@@ -243,11 +251,7 @@ constexpr double ModelSecondaryVoltageControlSimplified::LEVEL_MIN;  ///< Minima
     for (int g = 0; g < nbGenerators_; g++) {
       zLocal_[levelValNum_] += yLocal_[g + 1];
      }
-    double qrSum = 0;
-    for (auto& qr : Qr_) {
-      qrSum += qr;
-    }
-    zLocal_[levelValNum_] = zLocal_[levelValNum_] / qrSum;
+    zLocal_[levelValNum_] = zLocal_[levelValNum_] / QrSum_;
     antiWindUpCorrection();
     iTerm_ = zLocal_[levelValNum_] + feedBackCorrection_;
   }
@@ -300,11 +304,7 @@ constexpr double ModelSecondaryVoltageControlSimplified::LEVEL_MIN;  ///< Minima
         QStator0Pu = Q0Pu_[g] - QTfo0Pu;
         zLocal_[levelValNum_] += (-1.0 * QStator0Pu * SNREF);
        }
-      double qrSum = 0;
-      for (auto& qr : Qr_) {
-        qrSum += qr;
-      }
-      zLocal_[levelValNum_] = zLocal_[levelValNum_] / qrSum;
+      zLocal_[levelValNum_] = zLocal_[levelValNum_] / QrSum_;
       antiWindUpCorrection();
       iTerm_ = zLocal_[levelValNum_] + feedBackCorrection_;
       for (int i = firstIndexBlockerNum_; i < firstIndexBlockerNum_ + nbGenerators_ ; i++) {
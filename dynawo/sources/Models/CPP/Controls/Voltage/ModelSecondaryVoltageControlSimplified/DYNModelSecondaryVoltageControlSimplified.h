@@ -315,6 +315,7 @@ class ModelSecondaryVoltageControlSimplified : public ModelCPP {
   double iTerm_;                  ///< integral tem
   double feedBackCorrection_;     ///< feedback correction
   std::vector<double> Qr_;        ///< participation factor of the generators to the secondary voltage control in Mvar
+  double QrSum_;                  ///< sum of the participation factors of the generators in Mvar
   std::vector<double> Q0Pu_;      ///< start value of reactive power in pu (receptor convention) (base SnRef) (for each generator connected to the SVC)
   std::vector<double> P0Pu_;      ///< start value of active power in pu (receptor convention) (base SnRef) (for each generator connected to the SVC)
   std::vector<double> SNom_;      ///< nominal apparent power in MVA (for each generator connected to the SVC)
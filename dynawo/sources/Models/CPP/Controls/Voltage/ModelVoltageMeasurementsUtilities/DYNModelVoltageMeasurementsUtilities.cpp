@@ -134,12 +134,7 @@ ModelVoltageMeasurementsUtilities::evalZ(const double t) {
   // Is it time for a new update?
   if (gLocal_[timeToUpdate_] == ROOT_UP) {
     // update EV-E-RY-THIIIING !!
-    for (size_t i = 0; i < nbConnectedInputs_; ++i) {
-      isActive_[i] = toNativeBool(zLocal_[i + nbDiscreteVars_]);
-    }
-    lastMin_ = computeMin(achievedMin_);
-    lastMax_ = computeMax(achievedMax_);
-    lastAverage_ = computeAverage(nbActive_);
+    updateMeasurements();
     zLocal_[tLastUpdate_] = t;
   }
 }
@@ -326,48 +321,35 @@ ModelVoltageMeasurementsUtilities::checkDataCoherence(const double /*t*/) {
   // Nothing to do in this case.
 }
 
-double
-ModelVoltageMeasurementsUtilities::computeMin(unsigned int& minIdx) const {
+void
+ModelVoltageMeasurementsUtilities::updateMeasurements() {
   double minSoFar = maxValueThreshold;
-  minIdx = nbConnectedInputs_;
-  for (unsigned i = 0; i < nbConnectedInputs_; i++) {
-    if (isRunning(i) && !doubleEquals(minSoFar, yLocal_[i]) && (minSoFar > yLocal_[i])) {
-      minSoFar = yLocal_[i];
-      minIdx = i;
-    }
-  }
-  return minSoFar;
-}
-
-double
-ModelVoltageMeasurementsUtilities::computeMax(unsigned int& maxIdx) const {
   double maxSoFar = -maxValueThreshold;
-  maxIdx = nbConnectedInputs_;
-  for (unsigned i = 0; i < nbConnectedInputs_; i++) {
-    if (isRunning(i) && !doubleEquals(maxSoFar, yLocal_[i]) && (yLocal_[i] > maxSoFar)) {
-      maxSoFar = yLocal_[i];
-      maxIdx = i;
+  double totSoFar = 0.;
+  achievedMin_ = nbConnectedInputs_;
+  achievedMax_ = nbConnectedInputs_;
+  nbActive_ = 0;
+  // a single pass over the inputs computes all the measurements
+  for (unsigned int i = 0; i < nbConnectedInputs_; ++i) {
+    const bool running = toNativeBool(zLocal_[i + nbDiscreteVars_]);
+    isActive_[i] = running;
+    if (!running)
+      continue;
+    const double value = yLocal_[i];
+    if (!doubleEquals(minSoFar, value) && (minSoFar > value)) {
+      minSoFar = value;
+      achievedMin_ = i;
     }
-  }
-  return maxSoFar;
-}
-
-double
-ModelVoltageMeasurementsUtilities::computeAverage(unsigned int& nbActive) const {
-  double totSoFar = 0;
-  nbActive = 0;
-  for (unsigned i = 0; i < nbConnectedInputs_; i++) {
-    if (isRunning(i)) {
-      totSoFar +=  yLocal_[i];
-      ++nbActive;
+    if (!doubleEquals(maxSoFar, value) && (value > maxSoFar)) {
+      maxSoFar = value;
+      achievedMax_ = i;
     }
+    totSoFar += value;
+    ++nbActive_;
   }
-  return nbActive == 0 ? 0. : totSoFar / nbActive;
-}
-
-bool
-ModelVoltageMeasurementsUtilities::isRunning(const unsigned int inputIdx) const {
-  return (inputIdx < nbConnectedInputs_)? isActive_[inputIdx] : false;
+  lastMin_ = minSoFar;
+  lastMax_ = maxSoFar;
+  lastAverage_ = nbActive_ == 0 ? 0. : totSoFar / nbActive_;
 }
 
 }  // namespace DYN
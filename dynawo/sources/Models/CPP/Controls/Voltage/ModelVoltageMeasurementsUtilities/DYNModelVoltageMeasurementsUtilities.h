@@ -316,33 +316,10 @@ class ModelVoltageMeasurementsUtilities : public ModelCPP {
   bool hasCheckDataCoherence() const { return true; }
 
  private:
-   /**
-    * @brief gets the minimum value of the (connected and active) input voltages
-    * @param minIdx (inout parameter) index achieving the minimum value
-    * @return the minimum voltage value among the running inputs
-    */
-  double computeMin(unsigned int& minIdx) const;
-
-  /**
-   * @brief gets the maximum value of the (connected and active) input voltages
-   * @param maxIdx (inout parameter) index achieving the maximum value
-   * @return the maximum voltage value among the running inputs
-   */
-  double computeMax(unsigned int& maxIdx) const;
-
-  /**
-   * @brief gets the average value of the (connected and active) input voltages
-   * @param nbActive (inout parameter) number of running variables
-   * @return the average voltage value among the running inputs
-   */
-  double computeAverage(unsigned int& nbActive) const;
-
   /**
-   * @brief returns whether or not an input is running
-   * @param inputIdx index of the voltage level being tested
-   * @return whether or not the given voltage level is running
+   * @brief update the running status of the inputs and the minimum, maximum and average values of the running input voltages
    */
-  bool isRunning(unsigned int inputIdx) const;
+  void updateMeasurements();
 
  private:
   unsigned int nbConnectedInputs_;  ///< Number of active inputs (external parameter)
@@ -104,6 +104,11 @@ class ModelAreaShedding : public ModelCPP {
    */
   void evalG(double t) override;
 
+  /**
+   * @copydoc SubModel::collectTimeEvents(std::vector<double>& timeEvents) const
+   */
+  void collectTimeEvents(std::vector<double>& timeEvents) const override;
+
   /**
    * @brief  ModelAreaShedding discrete variables evaluation
    *
@@ -267,6 +272,9 @@ class ModelAreaShedding : public ModelCPP {
   double QShed_;  ///< total amount of reactive power shedding (in MVAr)
   double deltaTime_;  ///< time at which occurs the delta
   int nbLoads_;  ///< number of loads
+  JacobianPattern jtPattern_;  ///< pattern of the transposed Jacobian
+  JacobianPattern jtPrimPattern_;  ///< pattern of the transposed Jacobian with respect to the derivatives
+  std::vector<double> jtValues_;  ///< values of the terms of the transposed Jacobian
   double started_;  ///< time when the mode change indicating the start of the shedding has been done
 
   /**
@@ -118,6 +118,16 @@ ModelVariationArea::getSize() {
   sizeMode_ = 2;  // activation/deactivation of load increase
 
   calculatedVars_.assign(nbCalculatedVars_, 0);
+
+  // whatever the state of the automaton, same Jacobian: each equation only depends on its own variable
+  jtPattern_.clear();
+  jtPrimPattern_.clear();
+  for (unsigned int i = 0; i < sizeF_; ++i) {
+    jtPattern_.addEquation();
+    jtPattern_.addTerm(static_cast<int>(i));
+    jtPrimPattern_.addEquation();  // no differential equations
+  }
+  jtValues_.assign(jtPattern_.nbTerms(), 1.);
 }
 
 // evaluation of F(t,y,y') function
@@ -153,6 +163,12 @@ ModelVariationArea::evalG(const double t) {
   gLocal_[1] = (t - stopTime_) >= 0 ? ROOT_UP : ROOT_DOWN;
 }
 
+void
+ModelVariationArea::collectTimeEvents(std::vector<double>& timeEvents) const {
+  timeEvents.push_back(startTime_);
+  timeEvents.push_back(stopTime_);
+}
+
 void
 ModelVariationArea::setFequations() {
   stringstream ss;
@@ -178,25 +194,14 @@ ModelVariationArea::setGequations() {
 
 void
 ModelVariationArea::evalJt(const double /*t*/, const double /*cj*/, const int rowOffset,  SparseMatrix& jt) {
-  static double dPOne = 1;
-  // whatever the state of the automaton, same Jacobian
-  for (int i = 0; i < nbLoads_; ++i) {  // 2 equations by loads
-    jt.changeCol();
-    jt.addTerm(i * 2 + rowOffset, dPOne);
-    jt.changeCol();
-    jt.addTerm(i * 2 + 1 + rowOffset, dPOne);
-  }
+  jtPattern_.fill(rowOffset, jtValues_.data(), jt);
 }
 
 // evaluation of the transpose Jacobian Jt - sparse matrix
 
 void
-ModelVariationArea::evalJtPrim(const double /*t*/, const double /*cj*/, const int /*rowOffset*/,  SparseMatrix& jtPrim) {
-  // no differential equations
-  for (int i = 0; i < nbLoads_; ++i) {  // 2 equations by loads
-    jtPrim.changeCol();
-    jtPrim.changeCol();
-  }
+ModelVariationArea::evalJtPrim(const double /*t*/, const double /*cj*/, const int rowOffset,  SparseMatrix& jtPrim) {
+  jtPrimPattern_.fill(rowOffset, nullptr, jtPrim);
 }
 
 // evaluation of discrete variables
@@ -106,6 +106,11 @@ class ModelVariationArea : public ModelCPP {
    */
   void evalG(double t) override;
 
+  /**
+   * @copydoc SubModel::collectTimeEvents(std::vector<double>& timeEvents) const
+   */
+  void collectTimeEvents(std::vector<double>& timeEvents) const override;
+
   /**
    * @brief  VariationArea discrete variables evaluation
    *
@@ -141,6 +146,14 @@ class ModelVariationArea : public ModelCPP {
    */
   void evalJt(double t, double cj, int rowOffset, SparseMatrix& jt) override;
 
+  /**
+   * @brief the Jacobian is the identity, whatever the state of the automaton
+   * @return @b true
+   */
+  bool hasPiecewiseConstantJacobian() const override {
+    return true;
+  }
+
   /**
    * @brief calculate jacobien prime matrix
    *
@@ -267,6 +280,9 @@ class ModelVariationArea : public ModelCPP {
   double startTime_;  ///< start time
   double stopTime_;  ///< stop time
   int nbLoads_;  ///< number of loads
+  JacobianPattern jtPattern_;  ///< pattern of the transposed Jacobian
+  JacobianPattern jtPrimPattern_;  ///< pattern of the transposed Jacobian with respect to the derivatives
+  std::vector<double> jtValues_;  ///< values of the terms of the transposed Jacobian
   double timeModeOnGoingRaised_;  ///< true if the mode change indicating the start of the slope has been done
   double timeModeFinishedRaised_;  ///< true if the mode change indicating the end of the slope has been done
 
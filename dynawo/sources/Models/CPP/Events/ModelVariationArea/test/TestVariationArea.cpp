@@ -303,6 +303,12 @@ TEST(ModelsModelVariationArea, ModelVariationAreaContinuousAndDiscreteMethods) {
   ASSERT_EQ(mode, DIFFERENTIAL_MODE);
   mode = modelVariationArea->evalMode(7);
   ASSERT_EQ(mode, NO_MODE);
+
+  std::vector<double> timeEvents;
+  modelVariationArea->collectTimeEvents(timeEvents);
+  ASSERT_EQ(timeEvents.size(), 2);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(timeEvents[0], 0.);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(timeEvents[1], 5.);
   delete[] zConnected;
 }
 
@@ -125,6 +125,12 @@ ModelVoltageSetPointChange::evalG(const double t) {
   gLocal_[1] = (t > stopTime_ || doubleEquals(t, stopTime_)) ? ROOT_UP : ROOT_DOWN;
 }
 
+void
+ModelVoltageSetPointChange::collectTimeEvents(std::vector<double>& timeEvents) const {
+  timeEvents.push_back(startTime_);
+  timeEvents.push_back(stopTime_);
+}
+
 void
 ModelVoltageSetPointChange::setFequations() {
   // not needed
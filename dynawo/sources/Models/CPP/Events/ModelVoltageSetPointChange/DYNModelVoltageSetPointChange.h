@@ -104,6 +104,11 @@ class ModelVoltageSetPointChange : public ModelCPP {
    */
   void evalG(double t) override;
 
+  /**
+   * @copydoc SubModel::collectTimeEvents(std::vector<double>& timeEvents) const
+   */
+  void collectTimeEvents(std::vector<double>& timeEvents) const override;
+
   /**
    * @brief  VoltageSetPointChange discrete variables evaluation
    *
@@ -39,7 +39,6 @@
 
 using std::vector;
 using std::string;
-using std::map;
 using std::stringstream;
 
 using boost::shared_ptr;
@@ -93,6 +92,7 @@ int ModelOmegaRef::col1stOmega_;
 ModelOmegaRef::ModelOmegaRef() :
 ModelCPP("omegaRef"),
 firstState_(true),
+ccOffsets_(nbMaxCC + 1, 0),
 nbGen_(0),
 nbCC_(0),
 nbOmega_(0),
@@ -154,19 +154,17 @@ ModelOmegaRef::evalF(double /*t*/, const propertyF_t type) {
 
   // I: for each connected component i, for generator k in this cc i:
   // 0 = sum_k (omega[k] * weight[k]) - omegaRef[i] * sum_k (weight[k])
+  const double* omega = yLocal_ + nbMaxCC;
   for (int i = 0; i < nbMaxCC; ++i) {
-    map<int, std::vector<int> >::const_iterator iterGen = genByCC_.find(i);
-    map<int, double>::const_iterator iterWeight = sumWeightByCC_.find(i);
-    if (iterGen == genByCC_.end() || iterWeight == sumWeightByCC_.end()) {
+    const unsigned int first = ccOffsets_[i];
+    const unsigned int last = ccOffsets_[i + 1];
+    if (first == last) {
       fLocal_[i] = 1 - yLocal_[i];
     } else {
-      fLocal_[i] = -yLocal_[i];
-      std::vector<int> numGen = iterGen->second;
-      for (unsigned int j = 0; j < numGen.size(); ++j) {
-        if (toNativeBool(runningGrp_[numGen[j]]) && weights_[numGen[j]] > 0) {
-          fLocal_[i] += yLocal_[nbMaxCC + indexOmega_[numGen[j]]] * weights_[numGen[j]] / iterWeight->second;
-        }
-      }
+      double sum = 0.;
+      for (unsigned int j = first; j < last; ++j)
+        sum += omega[ccOmega_[j]] * ccWeights_[j];
+      fLocal_[i] = sum - yLocal_[i];
     }
   }
 
@@ -204,21 +202,10 @@ ModelOmegaRef::evalJt(const double /*t*/, const double /*cj*/, const int rowOffs
 
   for (int i = 0; i < nbMaxCC; ++i) {
     jt.changeCol();
-    map<int, std::vector<int> >::const_iterator iterGen = genByCC_.find(i);
-    map<int, double>::const_iterator iterWeight = sumWeightByCC_.find(i);
-    if (iterGen == genByCC_.end() || iterWeight == sumWeightByCC_.end()) {
-      // f=1-omegaRef[i]
-      jt.addTerm(col1stOmegaRef_ + i + rowOffset, dMOne);   // d(f)/d(omegaRef[i]) = -1;
-    } else {
-      // f = sum(omega[]*weight[]) - omegaRef[i]
-      jt.addTerm(col1stOmegaRef_ + i + rowOffset, dMOne);   // d(f)/d(omegaRef[i]) = -1;
-      std::vector<int> numGen = iterGen->second;
-      for (unsigned int j = 0; j < numGen.size(); ++j) {
-        if (toNativeBool(runningGrp_[numGen[j]]) && weights_[numGen[j]] > 0) {
-          jt.addTerm(indexOmega_[numGen[j]] + col1stOmega_ + rowOffset, weights_[numGen[j]] / iterWeight->second);  // d(f0)/d(omega[i]) = weight[i]
-        }
-      }
-    }
+    // f = sum(omega[]*weight[]) - omegaRef[i], or f = 1 - omegaRef[i] if no generator participates
+    jt.addTerm(col1stOmegaRef_ + i + rowOffset, dMOne);   // d(f)/d(omegaRef[i]) = -1;
+    for (unsigned int j = ccOffsets_[i]; j < ccOffsets_[i + 1]; ++j)
+      jt.addTerm(ccOmega_[j] + col1stOmega_ + rowOffset, ccWeights_[j]);  // d(f0)/d(omega[j]) = weight[j]
   }
 
   for (int i = 0; i < nbGen_; ++i) {
@@ -293,19 +280,44 @@ ModelOmegaRef::evalMode(const double /*t*/) {
  */
 void
 ModelOmegaRef::sortGenByCC() {
-  genByCC_.clear();
-  sumWeightByCC_.clear();
-
-  for (int i = 0; i < nbGen_; ++i) {
-    if (toNativeBool(runningGrp_[i])) {
-      genByCC_[numCCNode_[i]].push_back(i);
-      if (weights_[i] > 0)
-        sumWeightByCC_[numCCNode_[i]] += weights_[i];
+  // count the running generators of each subNetwork, and the ones with a positive weight
+  vector<bool> hasGen(nbMaxCC, false);
+  vector<double> sumWeights(nbMaxCC, 0.);
+  ccOffsets_.assign(nbMaxCC + 1, 0);
+  nbCC_ = 0;
+  for (int k = 0; k < nbGen_; ++k) {
+    if (!toNativeBool(runningGrp_[k]))
+      continue;
+    const int numCC = numCCNode_[k];
+    // the subNetworks are numbered from 0: a greater index means that there are too many subNetworks
+    if (numCC >= nbMaxCC)
+      throw DYNError(Error::MODELER, TooMuchSubNetwork, numCC + 1, nbMaxCC);
+    if (!hasGen[numCC]) {
+      hasGen[numCC] = true;
+      ++nbCC_;
+    }
+    if (weights_[k] > 0) {
+      ++ccOffsets_[numCC + 1];
+      sumWeights[numCC] += weights_[k];
     }
   }
-  nbCC_ = static_cast<int>(genByCC_.size());
-  if (nbCC_ > nbMaxCC)
-    throw DYNError(Error::MODELER, TooMuchSubNetwork, nbCC_, nbMaxCC);
+  for (int i = 0; i < nbMaxCC; ++i)
+    ccOffsets_[i + 1] += ccOffsets_[i];
+
+  // store the weighted generators contiguously by subNetwork, in the order of their index
+  ccOmega_.resize(ccOffsets_[nbMaxCC]);
+  ccWeights_.resize(ccOffsets_[nbMaxCC]);
+  vector<unsigned int> next(ccOffsets_.begin(), ccOffsets_.end() - 1);
+  for (int k = 0; k < nbGen_; ++k) {
+    if (!toNativeBool(runningGrp_[k]) || weights_[k] <= 0)
+      continue;
+    const int numCC = numCCNode_[k];
+    ccOmega_[next[numCC]] = indexOmega_[k];
+    ccWeights_[next[numCC]] = weights_[k] / sumWeights[numCC];
+    ++next[numCC];
+  }
+  // the residual functions and the Jacobian depend on the weighted generators of each subNetwork
+  invalidateResidualInputs();
 }
 
 void
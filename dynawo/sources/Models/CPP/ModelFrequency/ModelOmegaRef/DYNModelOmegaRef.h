@@ -131,6 +131,14 @@ class ModelOmegaRef : public ModelCPP {
    */
   modeChangeType_t evalMode(double t) override;
 
+  /**
+   * @brief the Jacobian only depends on the subNetworks and on the status of the generators
+   * @return @b true
+   */
+  bool hasPiecewiseConstantJacobian() const override {
+    return true;
+  }
+
   /**
    * @brief Reference frequency transposed jacobian evaluation
    *
@@ -289,7 +297,8 @@ class ModelOmegaRef : public ModelCPP {
   /**
    * @brief Sort every generator by num of subNetwork
    *
-   *
+   * The weighted running generators are stored contiguously for each subNetwork, with their normalized weight,
+   * so that the residuals and the jacobian of a subNetwork read consecutive values.
    */
   void sortGenByCC();
 
@@ -310,8 +319,9 @@ class ModelOmegaRef : public ModelCPP {
   std::vector<int> numCCNode_;  ///< index of the network for each generators
   std::vector<double> runningGrp_;  ///< @b true if the generator is on
   std::vector<double> omegaRef0_;  ///< initial values for omegaref
-  std::map<int, double > sumWeightByCC_;  ///< sum of weight for each network
-  std::map<int, std::vector<int> >genByCC_;  ///< list of generators for each network
+  std::vector<unsigned int> ccOffsets_;  ///< the weighted running generators of network i are between ccOffsets_[i] and ccOffsets_[i + 1] in ccOmega_
+  std::vector<int> ccOmega_;  ///< index of omega inside the local buffer for each weighted running generator, grouped by network
+  std::vector<double> ccWeights_;  ///< weight of each weighted running generator divided by the sum of the weights of its network
   std::vector<int> numCCNodeOld_;  ///< save of the index of the network for each generators
   std::vector<double> runningGrpOld_;  ///< save of the states for each generators
 
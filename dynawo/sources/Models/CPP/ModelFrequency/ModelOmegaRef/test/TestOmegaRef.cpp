@@ -389,4 +389,102 @@ TEST(ModelsModelOmegaRef, ModelOmegaRefContinuousAndDiscreteMethods) {
   ASSERT_THROW_DYNAWO(modelOmegaRef->checkDataCoherence(0), Error::MODELER, KeyError_t::FrequencyCollapse);
 }
 
+TEST(ModelsModelOmegaRef, ModelOmegaRefJacobianColumnsKept) {
+  boost::shared_ptr<SubModel> modelOmegaRef = initModelOmegaRef(1);
+  ASSERT_TRUE(modelOmegaRef->hasPiecewiseConstantJacobian());
+  std::vector<double> y(modelOmegaRef->sizeY(), 0);
+  std::vector<double> yp(modelOmegaRef->sizeY(), 0);
+  modelOmegaRef->setBufferY(&y[0], &yp[0], 0.);
+  std::vector<double> z(modelOmegaRef->sizeZ(), 0);
+  bool* zConnected = new bool[modelOmegaRef->sizeZ()];
+  for (size_t i = 0; i < modelOmegaRef->sizeZ(); ++i)
+    zConnected[i] = true;
+  modelOmegaRef->setBufferZ(&z[0], zConnected, 0);
+  z[2] = 1;
+  z[3] = 1;
+  std::vector<double> f(modelOmegaRef->sizeF(), 0);
+  modelOmegaRef->setBufferF(&f[0], 0);
+  modelOmegaRef->init(0);
+  modelOmegaRef->getY0();
+  // the first evaluations of the modes record the subNetworks and the status of the generators
+  ASSERT_EQ(modelOmegaRef->evalModeSub(0), NO_MODE);
+  ASSERT_EQ(modelOmegaRef->evalModeSub(0), NO_MODE);
+
+  const int size = modelOmegaRef->sizeY();
+  const int nbCols = modelOmegaRef->sizeF();
+  SparseMatrix smj;
+  smj.init(size, nbCols);
+  int rowOffset = 0;
+  modelOmegaRef->evalJtSub(0, 0, rowOffset, smj);
+  ASSERT_EQ(rowOffset, size);
+  ASSERT_EQ(smj.nbElem(), 16);
+
+  // the columns kept are appended again while the generators and the subNetworks are unchanged
+  y[10] = 2.5;
+  SparseMatrix smj2;
+  smj2.init(size, nbCols);
+  rowOffset = 0;
+  modelOmegaRef->evalJtSub(1, 0, rowOffset, smj2);
+  ASSERT_EQ(smj2.nbElem(), 16);
+  for (int i = 0; i < 16; ++i) {
+    ASSERT_EQ(smj2.Ai_[i], smj.Ai_[i]);
+    ASSERT_DOUBLE_EQUALS_DYNAWO(smj2.Ax_[i], smj.Ax_[i]);
+  }
+
+  // a generator switched off changes the mode of the model and its columns
+  z[2] = 0;
+  modelOmegaRef->evalZ(2);
+  ASSERT_EQ(modelOmegaRef->evalModeSub(2), ALGEBRAIC_J_UPDATE_MODE);
+  SparseMatrix smj3;
+  smj3.init(size, nbCols);
+  rowOffset = 0;
+  modelOmegaRef->evalJtSub(2, 0, rowOffset, smj3);
+  ASSERT_EQ(smj3.nbElem(), 14);
+  delete[] zConnected;
+}
+
+TEST(ModelsModelOmegaRef, ModelOmegaRefSeveralSubNetworks) {
+  boost::shared_ptr<SubModel> modelOmegaRef = initModelOmegaRef(1);
+  std::vector<double> y(modelOmegaRef->sizeY(), 0);
+  std::vector<double> yp(modelOmegaRef->sizeY(), 0);
+  modelOmegaRef->setBufferY(&y[0], &yp[0], 0.);
+  std::vector<double> z(modelOmegaRef->sizeZ(), 0);
+  bool* zConnected = new bool[modelOmegaRef->sizeZ()];
+  for (size_t i = 0; i < modelOmegaRef->sizeZ(); ++i)
+    zConnected[i] = true;
+  modelOmegaRef->setBufferZ(&z[0], zConnected, 0);
+  z[1] = 1;  // gen1 in the second subNetwork
+  z[2] = 1;
+  z[3] = 1;
+  std::vector<double> f(modelOmegaRef->sizeF(), 0);
+  modelOmegaRef->setBufferF(&f[0], 0);
+  modelOmegaRef->init(0);
+  modelOmegaRef->getY0();
+
+  y[10] = 1.1;  // omega_grp_0
+  y[11] = 0.9;  // omega_grp_1
+  modelOmegaRef->evalF(0, UNDEFINED_EQ);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(f[0], 0.1);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(f[1], -0.1);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(f[2], 0);
+
+  SparseMatrix smj;
+  int size = modelOmegaRef->sizeY();
+  smj.init(size, size);
+  modelOmegaRef->evalJt(0, 0, 0, smj);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(smj.Ap_[1], 2);  // 2 elements non-zero for numCC_0
+  ASSERT_DOUBLE_EQUALS_DYNAWO(smj.Ap_[2], 4);  // 2 elements non-zero for numCC_1
+  ASSERT_DOUBLE_EQUALS_DYNAWO(smj.Ai_[1], 10);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(smj.Ax_[1], 1);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(smj.Ai_[3], 11);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(smj.Ax_[3], 1);
+
+  ASSERT_EQ(modelOmegaRef->evalMode(0), NO_MODE);
+  ASSERT_EQ(modelOmegaRef->evalMode(0), NO_MODE);
+  z[0] = 10;  // gen0 in a subNetwork that can not be handled
+  modelOmegaRef->evalZ(1);
+  ASSERT_THROW_DYNAWO(modelOmegaRef->evalMode(1), Error::MODELER, KeyError_t::TooMuchSubNetwork);
+  delete[] zConnected;
+}
+
 }  // namespace DYN
@@ -0,0 +1,281 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNBranchInjections.cpp
+ *
+ * @brief Node injections of the static branches of the network evaluated in one pass
+ *
+ */
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <map>
+#include <unordered_map>
+
+#include "DYNBranchInjections.h"
+#include "DYNModelBus.h"
+#include "DYNDerivative.h"
+
+namespace DYN {
+
+/**
+ * @brief block index of a side without bus
+ */
+static const unsigned int NO_BLOCK = std::numeric_limits<unsigned int>::max();
+
+const unsigned int BranchInjections::NB_SIDES;
+
+BranchInjections::BranchInjections() :
+useAdmittanceMatrix_(false),
+admittanceMatrixUpToDate_(false),
+derivativesCached_(false) {
+}
+
+unsigned int
+BranchInjections::addBranch(ModelBus* bus1, ModelBus* bus2) {
+  buses1_.push_back(bus1);
+  buses2_.push_back(bus2);
+  voltageBuses1_.push_back(nullptr);
+  voltageBuses2_.push_back(nullptr);
+  for (unsigned int i = 0; i < NB_CURRENTS; ++i) {
+    for (unsigned int j = 0; j < NB_VOLTAGES; ++j)
+      admittances_[i][j].push_back(0.);
+    currents_[i].push_back(0.);
+  }
+  for (unsigned int j = 0; j < NB_VOLTAGES; ++j)
+    voltages_[j].push_back(0.);
+  derivativesCached_ = false;
+  return size() - 1;
+}
+
+void
+BranchInjections::setAdmittances(const unsigned int branch, const double (&admittances)[NB_CURRENTS][NB_VOLTAGES],
+    const bool side1Connected, const bool side2Connected) {
+  assert(branch < size());
+  for (unsigned int i = 0; i < NB_CURRENTS; ++i) {
+    for (unsigned int j = 0; j < NB_VOLTAGES; ++j)
+      admittances_[i][j][branch] = admittances[i][j];
+  }
+  voltageBuses1_[branch] = side1Connected ? buses1_[branch] : nullptr;
+  voltageBuses2_[branch] = side2Connected ? buses2_[branch] : nullptr;
+  admittanceMatrixUpToDate_ = false;
+  derivativesCached_ = false;
+}
+
+void
+BranchInjections::evalNodeInjection() {
+  if (useAdmittanceMatrix_) {
+    if (!admittanceMatrixUpToDate_)
+      updateAdmittanceMatrix();
+    const unsigned int nbBuses = static_cast<unsigned int>(matrixBuses_.size());
+    for (unsigned int row = 0; row < nbBuses; ++row) {
+      busUr_[row] = matrixBuses_[row]->ur();
+      busUi_[row] = matrixBuses_[row]->ui();
+    }
+    const double* irUr = blocks_[IR_UR].data();
+    const double* irUi = blocks_[IR_UI].data();
+    const double* iiUr = blocks_[II_UR].data();
+    const double* iiUi = blocks_[II_UI].data();
+    for (unsigned int row = 0; row < nbBuses; ++row) {
+      double ir = 0.;
+      double ii = 0.;
+      for (unsigned int block = rowOffsets_[row]; block < rowOffsets_[row + 1]; ++block) {
+        const unsigned int column = columns_[block];
+        ir += irUr[block] * busUr_[column] + irUi[block] * busUi_[column];
+        ii += iiUr[block] * busUr_[column] + iiUi[block] * busUi_[column];
+      }
+      matrixBuses_[row]->irAdd(ir);
+      matrixBuses_[row]->iiAdd(ii);
+    }
+    return;
+  }
+
+  const unsigned int nbBranches = size();
+
+  // gather the voltages of the buses
+  for (unsigned int k = 0; k < nbBranches; ++k) {
+    const ModelBus* bus1 = voltageBuses1_[k];
+    const ModelBus* bus2 = voltageBuses2_[k];
+    voltages_[UR1][k] = bus1 ? bus1->ur() : 0.;
+    voltages_[UI1][k] = bus1 ? bus1->ui() : 0.;
+    voltages_[UR2][k] = bus2 ? bus2->ur() : 0.;
+    voltages_[UI2][k] = bus2 ? bus2->ui() : 0.;
+  }
+
+  // currents of all the branches, one loop over contiguous arrays per current so that the compiler can vectorize it
+  const double* ur1 = voltages_[UR1].data();
+  const double* ui1 = voltages_[UI1].data();
+  const double* ur2 = voltages_[UR2].data();
+  const double* ui2 = voltages_[UI2].data();
+  for (unsigned int i = 0; i < NB_CURRENTS; ++i) {
+    const double* dUr1 = admittances_[i][UR1].data();
+    const double* dUi1 = admittances_[i][UI1].data();
+    const double* dUr2 = admittances_[i][UR2].data();
+    const double* dUi2 = admittances_[i][UI2].data();
+    double* current = currents_[i].data();
+    for (unsigned int k = 0; k < nbBranches; ++k)
+      current[k] = dUr1[k] * ur1[k] + dUi1[k] * ui1[k] + dUr2[k] * ur2[k] + dUi2[k] * ui2[k];
+  }
+
+  // scatter the currents to the buses
+  for (unsigned int k = 0; k < nbBranches; ++k) {
+    ModelBus* bus1 = buses1_[k];
+    if (bus1) {
+      bus1->irAdd(currents_[IR1][k]);
+      bus1->iiAdd(currents_[II1][k]);
+    }
+    ModelBus* bus2 = buses2_[k];
+    if (bus2) {
+      bus2->irAdd(currents_[IR2][k]);
+      bus2->iiAdd(currents_[II2][k]);
+    }
+  }
+}
+
+void
+BranchInjections::assembleAdmittanceMatrix() {
+  const unsigned int nbBranches = size();
+  ModelBus* const* buses[NB_SIDES] = {buses1_.data(), buses2_.data()};
+
+  // one row per bus, and the columns of each row in increasing order
+  std::unordered_map<const ModelBus*, unsigned int> rows;
+  matrixBuses_.clear();
+  for (unsigned int k = 0; k < nbBranches; ++k) {
+    for (unsigned int side = 0; side < NB_SIDES; ++side) {
+      ModelBus* bus = buses[side][k];
+      if (bus && rows.find(bus) == rows.end()) {
+        rows[bus] = static_cast<unsigned int>(matrixBuses_.size());
+        matrixBuses_.push_back(bus);
+      }
+    }
+  }
+  std::vector<std::map<unsigned int, unsigned int> > pattern(matrixBuses_.size());
+  for (unsigned int k = 0; k < nbBranches; ++k) {
+    for (unsigned int currentSide = 0; currentSide < NB_SIDES; ++currentSide) {
+      for (unsigned int voltageSide = 0; voltageSide < NB_SIDES; ++voltageSide) {
+        if (buses[currentSide][k] && buses[voltageSide][k])
+          pattern[rows[buses[currentSide][k]]][rows[buses[voltageSide][k]]] = 0;
+      }
+    }
+  }
+  rowOffsets_.assign(1, 0);
+  columns_.clear();
+  for (auto& columns : pattern) {
+    for (auto& column : columns) {
+      column.second = static_cast<unsigned int>(columns_.size());
+      columns_.push_back(column.first);
+    }
+    rowOffsets_.push_back(static_cast<unsigned int>(columns_.size()));
+  }
+
+  for (unsigned int currentSide = 0; currentSide < NB_SIDES; ++currentSide) {
+    for (unsigned int voltageSide = 0; voltageSide < NB_SIDES; ++voltageSide) {
+      std::vector<unsigned int>& blockIndexes = blockIndexes_[currentSide][voltageSide];
+      blockIndexes.assign(nbBranches, NO_BLOCK);
+      for (unsigned int k = 0; k < nbBranches; ++k) {
+        if (buses[currentSide][k] && buses[voltageSide][k])
+          blockIndexes[k] = pattern[rows[buses[currentSide][k]]][rows[buses[voltageSide][k]]];
+      }
+    }
+  }
+  for (unsigned int term = 0; term < NB_BLOCK_TERMS; ++term)
+    blocks_[term].assign(columns_.size(), 0.);
+  busUr_.assign(matrixBuses_.size(), 0.);
+  busUi_.assign(matrixBuses_.size(), 0.);
+  useAdmittanceMatrix_ = true;
+  admittanceMatrixUpToDate_ = false;
+  derivativesCached_ = false;
+}
+
+void
+BranchInjections::updateAdmittanceMatrix() {
+  const unsigned int nbBranches = size();
+  ModelBus* const* voltageBuses[NB_SIDES] = {voltageBuses1_.data(), voltageBuses2_.data()};
+  for (unsigned int term = 0; term < NB_BLOCK_TERMS; ++term)
+    std::fill(blocks_[term].begin(), blocks_[term].end(), 0.);
+  for (unsigned int currentSide = 0; currentSide < NB_SIDES; ++currentSide) {
+    // the currents and voltages of a side are consecutive in current_t and voltage_t
+    const unsigned int ir = 2 * currentSide;
+    const unsigned int ii = ir + 1;
+    for (unsigned int voltageSide = 0; voltageSide < NB_SIDES; ++voltageSide) {
+      const unsigned int ur = 2 * voltageSide;
+      const unsigned int ui = ur + 1;
+      const std::vector<unsigned int>& blockIndexes = blockIndexes_[currentSide][voltageSide];
+      for (unsigned int k = 0; k < nbBranches; ++k) {
+        const unsigned int block = blockIndexes[k];
+        // the voltage of a side which is not connected is not used
+        if (block == NO_BLOCK || !voltageBuses[voltageSide][k])
+          continue;
+        blocks_[IR_UR][block] += admittances_[ir][ur][k];
+        blocks_[IR_UI][block] += admittances_[ir][ui][k];
+        blocks_[II_UR][block] += admittances_[ii][ur][k];
+        blocks_[II_UI][block] += admittances_[ii][ui][k];
+      }
+    }
+  }
+  admittanceMatrixUpToDate_ = true;
+}
+
+void
+BranchInjections::evalDerivatives() {
+  assert(useAdmittanceMatrix_);
+  if (!admittanceMatrixUpToDate_)
+    updateAdmittanceMatrix();
+  const unsigned int nbBuses = static_cast<unsigned int>(matrixBuses_.size());
+  for (unsigned int row = 0; row < nbBuses; ++row) {
+    BusDerivatives& derivatives = *matrixBuses_[row]->derivatives();
+    Derivatives& irDerivatives = derivatives.getDerivatives(IR_DERIVATIVE);
+    Derivatives& iiDerivatives = derivatives.getDerivatives(II_DERIVATIVE);
+    for (unsigned int block = rowOffsets_[row]; block < rowOffsets_[row + 1]; ++block) {
+      const ModelBus* column = matrixBuses_[columns_[block]];
+      const int urYNum = column->urYNum();
+      const int uiYNum = column->uiYNum();
+      irDerivatives.addValue(urYNum, blocks_[IR_UR][block]);
+      irDerivatives.addValue(uiYNum, blocks_[IR_UI][block]);
+      iiDerivatives.addValue(urYNum, blocks_[II_UR][block]);
+      iiDerivatives.addValue(uiYNum, blocks_[II_UI][block]);
+    }
+  }
+}
+
+void
+BranchInjections::clear() {
+  buses1_.clear();
+  buses2_.clear();
+  voltageBuses1_.clear();
+  voltageBuses2_.clear();
+  for (unsigned int i = 0; i < NB_CURRENTS; ++i) {
+    for (unsigned int j = 0; j < NB_VOLTAGES; ++j)
+      admittances_[i][j].clear();
+    currents_[i].clear();
+  }
+  for (unsigned int j = 0; j < NB_VOLTAGES; ++j)
+    voltages_[j].clear();
+  useAdmittanceMatrix_ = false;
+  admittanceMatrixUpToDate_ = false;
+  derivativesCached_ = false;
+  matrixBuses_.clear();
+  rowOffsets_.clear();
+  columns_.clear();
+  for (unsigned int term = 0; term < NB_BLOCK_TERMS; ++term)
+    blocks_[term].clear();
+  for (unsigned int currentSide = 0; currentSide < NB_SIDES; ++currentSide) {
+    for (unsigned int voltageSide = 0; voltageSide < NB_SIDES; ++voltageSide)
+      blockIndexes_[currentSide][voltageSide].clear();
+  }
+  busUr_.clear();
+  busUi_.clear();
+}
+
+}  // namespace DYN
@@ -0,0 +1,187 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNBranchInjections.h
+ *
+ * @brief Node injections of the static branches of the network evaluated in one pass
+ *
+ */
+#ifndef MODELS_CPP_MODELNETWORK_DYNBRANCHINJECTIONS_H_
+#define MODELS_CPP_MODELNETWORK_DYNBRANCHINJECTIONS_H_
+
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+namespace DYN {
+class ModelBus;
+
+/**
+ * @brief currents injected at the nodes of the static branches (lines and two windings transformers)
+ *
+ * The admittance terms of the branches are stored in structure of arrays, as well as their buses : the currents
+ * of all the branches are computed in one loop over contiguous arrays, without any virtual call, and the values
+ * are then added to the buses. The branches update their admittance terms each time they evaluate their Y matrix.
+ *
+ * The terms can also be assembled in the nodal admittance matrix of the buses of the branches (Ybus), stored in
+ * compressed rows of real 2x2 blocks: the currents are then one sparse matrix-vector product over the buses, and
+ * the Jacobian terms of all the branches are copied row by row from the matrix into the bus derivatives.
+ */
+class BranchInjections : private boost::noncopyable {
+ public:
+  /**
+   * @brief index of the currents in the admittance terms
+   */
+  typedef enum {
+    IR1 = 0,  ///< real part of the current at side 1
+    II1 = 1,  ///< imaginary part of the current at side 1
+    IR2 = 2,  ///< real part of the current at side 2
+    II2 = 3,  ///< imaginary part of the current at side 2
+    NB_CURRENTS = 4
+  } current_t;
+
+  /**
+   * @brief index of the voltages in the admittance terms
+   */
+  typedef enum {
+    UR1 = 0,  ///< real part of the voltage at side 1
+    UI1 = 1,  ///< imaginary part of the voltage at side 1
+    UR2 = 2,  ///< real part of the voltage at side 2
+    UI2 = 3,  ///< imaginary part of the voltage at side 2
+    NB_VOLTAGES = 4
+  } voltage_t;
+
+  /**
+   * @brief default constructor
+   */
+  BranchInjections();
+
+  /**
+   * @brief add a branch
+   *
+   * @param bus1 bus at side 1, nullptr if none
+   * @param bus2 bus at side 2, nullptr if none
+   *
+   * @return index of the branch
+   */
+  unsigned int addBranch(ModelBus* bus1, ModelBus* bus2);
+
+  /**
+   * @brief set the admittance terms of a branch
+   *
+   * @param branch index of the branch
+   * @param admittances derivatives of each current with respect to each voltage
+   * @param side1Connected whether the voltage of the side 1 is used
+   * @param side2Connected whether the voltage of the side 2 is used
+   */
+  void setAdmittances(unsigned int branch, const double (&admittances)[NB_CURRENTS][NB_VOLTAGES], bool side1Connected, bool side2Connected);
+
+  /**
+   * @brief compute the currents of all the branches and add them to their buses
+   */
+  void evalNodeInjection();
+
+  /**
+   * @brief build the admittance matrix of the buses of the branches and use it for the evaluations
+   *
+   * To be called once all the branches are added
+   */
+  void assembleAdmittanceMatrix();
+
+  /**
+   * @brief add the Jacobian terms of all the branches to the derivatives of their buses
+   *
+   * Only available once the admittance matrix is assembled
+   */
+  void evalDerivatives();
+
+  /**
+   * @brief remove all the branches
+   */
+  void clear();
+
+  /**
+   * @brief whether the admittance matrix is used for the evaluations
+   * @return @b true if the admittance matrix is assembled
+   */
+  inline bool useAdmittanceMatrix() const {
+    return useAdmittanceMatrix_;
+  }
+
+  /**
+   * @brief whether the Jacobian terms of the branches saved in the bus derivatives are still valid
+   * @return @b false if the admittance terms of a branch changed since the last call to setDerivativesCached
+   */
+  inline bool derivativesCached() const {
+    return derivativesCached_;
+  }
+
+  /**
+   * @brief record that the Jacobian terms of the branches are saved in the bus derivatives
+   */
+  inline void setDerivativesCached() {
+    derivativesCached_ = true;
+  }
+
+  /**
+   * @brief get the number of branches
+   * @return number of branches
+   */
+  inline unsigned int size() const {
+    return static_cast<unsigned int>(buses1_.size());
+  }
+
+ private:
+  /**
+   * @brief compute again the terms of the admittance matrix from the admittance terms of the branches
+   */
+  void updateAdmittanceMatrix();
+
+ private:
+  /**
+   * @brief index of the terms of a 2x2 block of the admittance matrix
+   */
+  typedef enum {
+    IR_UR = 0,  ///< derivative of the real part of the current with respect to the real part of the voltage
+    IR_UI = 1,  ///< derivative of the real part of the current with respect to the imaginary part of the voltage
+    II_UR = 2,  ///< derivative of the imaginary part of the current with respect to the real part of the voltage
+    II_UI = 3,  ///< derivative of the imaginary part of the current with respect to the imaginary part of the voltage
+    NB_BLOCK_TERMS = 4
+  } blockTerm_t;
+
+  static const unsigned int NB_SIDES = 2;  ///< number of sides of a branch
+
+  std::vector<ModelBus*> buses1_;  ///< bus at side 1 of each branch, nullptr if none
+  std::vector<ModelBus*> buses2_;  ///< bus at side 2 of each branch, nullptr if none
+  std::vector<ModelBus*> voltageBuses1_;  ///< bus giving the voltage at side 1, nullptr if the side is not connected
+  std::vector<ModelBus*> voltageBuses2_;  ///< bus giving the voltage at side 2, nullptr if the side is not connected
+  std::vector<double> admittances_[NB_CURRENTS][NB_VOLTAGES];  ///< admittance terms of each branch
+  std::vector<double> voltages_[NB_VOLTAGES];  ///< voltages of each branch during the evaluation
+  std::vector<double> currents_[NB_CURRENTS];  ///< currents of each branch during the evaluation
+
+  bool useAdmittanceMatrix_;  ///< whether the admittance matrix is used for the evaluations
+  bool admittanceMatrixUpToDate_;  ///< whether the terms of the admittance matrix match the admittance terms of the branches
+  bool derivativesCached_;  ///< whether the Jacobian terms saved in the bus derivatives match the admittance terms of the branches
+  std::vector<ModelBus*> matrixBuses_;  ///< bus of each row (and column) of the admittance matrix
+  std::vector<unsigned int> rowOffsets_;  ///< index of the first block of each row, plus the total number of blocks
+  std::vector<unsigned int> columns_;  ///< column of each block
+  std::vector<double> blocks_[NB_BLOCK_TERMS];  ///< terms of each block
+  std::vector<unsigned int> blockIndexes_[NB_SIDES][NB_SIDES];  ///< block of each (current side, voltage side) of each branch
+  std::vector<double> busUr_;  ///< real part of the voltage of each row during the evaluation
+  std::vector<double> busUi_;  ///< imaginary part of the voltage of each row during the evaluation
+};
+
+}  // namespace DYN
+
+#endif  // MODELS_CPP_MODELNETWORK_DYNBRANCHINJECTIONS_H_
@@ -17,6 +17,8 @@
  * @brief
  *
  */
+#include <algorithm>
+
 #include "DYNMacrosMessage.h"
 
 #include "DYNDerivative.h"
@@ -25,28 +27,60 @@ using std::map;
 
 namespace DYN {
 
-Derivatives::Derivatives() {
+Derivatives::Derivatives() :
+nbCalls_(0),
+nbSavedCalls_(0) {
   values_.reserve(50);
   indices_.reserve(50);
+  slots_.reserve(50);
 }
 
 void
 Derivatives::reset() {
-  for (auto& value : values_) {
-    value = 0.;
-  }
+  std::fill(values_.begin(), values_.end(), 0.);
+  nbCalls_ = 0;
 }
 
 void
 Derivatives::addValue(const int numVar, const double value) {
-  auto it = std::find(indices_.begin(), indices_.end(), numVar);
-  if (it == indices_.end()) {
-    indices_.push_back(numVar);
-    values_.push_back(value);
-  } else {
-    auto index = it - indices_.begin();
-    values_[index] += value;
+  if (nbCalls_ < slots_.size()) {
+    const unsigned int slot = slots_[nbCalls_];
+    if (indices_[slot] == numVar) {
+      values_[slot] += value;
+      ++nbCalls_;
+      return;
+    }
+    // the contributions do not come in the recorded order anymore: record the new sequence from this call
+    slots_.resize(nbCalls_);
   }
+  const unsigned int slot = findSlot(numVar);
+  values_[slot] += value;
+  slots_.push_back(slot);
+  ++nbCalls_;
+}
+
+void
+Derivatives::save() {
+  savedValues_ = values_;
+  nbSavedCalls_ = nbCalls_;
+}
+
+void
+Derivatives::restore() {
+  // the slots created after the save have no saved value
+  std::copy(savedValues_.begin(), savedValues_.end(), values_.begin());
+  std::fill(values_.begin() + savedValues_.size(), values_.end(), 0.);
+  nbCalls_ = nbSavedCalls_;
+}
+
+unsigned int
+Derivatives::findSlot(const int numVar) {
+  auto it = std::find(indices_.begin(), indices_.end(), numVar);
+  if (it != indices_.end())
+    return static_cast<unsigned int>(it - indices_.begin());
+  indices_.push_back(numVar);
+  values_.push_back(0.);
+  return static_cast<unsigned int>(indices_.size() - 1);
 }
 
 void
@@ -55,6 +89,18 @@ BusDerivatives::reset() {
   iiDerivatives_.reset();
 }
 
+void
+BusDerivatives::save() {
+  irDerivatives_.save();
+  iiDerivatives_.save();
+}
+
+void
+BusDerivatives::restore() {
+  irDerivatives_.restore();
+  iiDerivatives_.restore();
+}
+
 void
 BusDerivatives::addDerivative(typeDerivative_t type, const int numVar, const double value) {
   switch (type) {
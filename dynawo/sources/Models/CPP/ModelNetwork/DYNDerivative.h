@@ -22,6 +22,7 @@
 
 #include <map>
 #include <unordered_map>
+#include <vector>
 
 namespace DYN {
 // Structure dedicated to the network Jacobian filling
@@ -37,6 +38,12 @@ typedef enum {
 
 /**
  * class Derivatives
+ *
+ * The variables of the derivatives are kept when the values are reset, so that the pattern built during the first
+ * evaluation is reused by the next ones. The slot used by each contribution is also recorded in the order of the
+ * calls : as the components contribute in the same order at each evaluation, a contribution is accumulated into its
+ * slot without searching for its variable. The recorded sequence is rebuilt from the first call that does not match it,
+ * for instance after a topology change.
  */
 class Derivatives {
  public:
@@ -46,7 +53,7 @@ class Derivatives {
   Derivatives();
 
   /**
-   * @brief reset
+   * @brief reset the values, keeping the variables and the sequence of slots
    */
   void reset();
 
@@ -57,6 +64,16 @@ class Derivatives {
    */
   void addValue(int numVar, double value);
 
+  /**
+   * @brief keep the current values and calls, to restart from them at the next evaluations
+   */
+  void save();
+
+  /**
+   * @brief reset the values to the saved ones, as if the calls done before the save were made again
+   */
+  void restore();
+
   /**
    * @brief get values
    * @return variables' values
@@ -82,8 +99,19 @@ class Derivatives {
   }
 
  private:
+  /**
+   * @brief find the slot of a variable, creating it if needed
+   * @param numVar number of variable
+   * @return index of the slot of the variable in values_ and indices_
+   */
+  unsigned int findSlot(int numVar);
+
   std::vector<double> values_;  ///< value of the derivative
   std::vector<int> indices_;  ///< num of the variable
+  std::vector<unsigned int> slots_;  ///< slot used by each call to addValue since the last reset, in the order of the calls
+  unsigned int nbCalls_;  ///< number of calls to addValue since the last reset
+  std::vector<double> savedValues_;  ///< values at the last save
+  unsigned int nbSavedCalls_;  ///< number of calls to addValue at the last save
 };
 
 /**
@@ -105,6 +133,16 @@ class BusDerivatives {
    */
   void addDerivative(typeDerivative_t type, int numVar, double value);
 
+  /**
+   * @brief keep the current values, to restart from them at the next evaluations
+   */
+  void save();
+
+  /**
+   * @brief reset the values to the saved ones
+   */
+  void restore();
+
   /**
    * @brief get values
    * @param type type of derivatives
@@ -0,0 +1,160 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNHvdcInjections.cpp
+ *
+ * @brief Node injections of the hvdc links of the network evaluated in one pass
+ *
+ */
+#include <cassert>
+
+#include "DYNHvdcInjections.h"
+#include "DYNModelBus.h"
+#include "DYNDerivative.h"
+#include "DYNCommon.h"
+
+namespace DYN {
+
+HvdcInjections::HvdcInjections() {
+}
+
+unsigned int
+HvdcInjections::addLink(ModelBus* bus1, ModelBus* bus2) {
+  const unsigned int index = static_cast<unsigned int>(buses_.size() / 2);
+  buses_.push_back(bus1);
+  buses_.push_back(bus2);
+  for (unsigned int side = 0; side < 2; ++side) {
+    P_.push_back(0.);
+    Q_.push_back(0.);
+    connected_.push_back(false);
+    p_.push_back(0.);
+    q_.push_back(0.);
+    ur_.push_back(0.);
+    ui_.push_back(0.);
+    U2_.push_back(0.);
+  }
+  return index;
+}
+
+void
+HvdcInjections::setLink(const unsigned int index, const double P1, const double Q1, const double P2, const double Q2, const bool connected1,
+    const bool connected2) {
+  assert(2 * index + 1 < buses_.size());
+  P_[2 * index] = P1;
+  Q_[2 * index] = Q1;
+  P_[2 * index + 1] = P2;
+  Q_[2 * index + 1] = Q2;
+  connected_[2 * index] = connected1;
+  connected_[2 * index + 1] = connected2;
+}
+
+void
+HvdcInjections::gatherPowers() {
+  // same powers as ModelHvdcLink::getP1, getQ1, getP2 and getQ2
+  const unsigned int nbConverters = static_cast<unsigned int>(buses_.size());
+  for (unsigned int k = 0; k < nbConverters; k += 2) {
+    const bool running1 = connected_[k] && !buses_[k]->getSwitchOff();
+    const bool running2 = connected_[k + 1] && !buses_[k + 1]->getSwitchOff();
+    p_[k] = (running1 && running2) ? P_[k] : 0.;
+    p_[k + 1] = (running1 && running2) ? P_[k + 1] : 0.;
+    q_[k] = running1 ? Q_[k] : 0.;
+    q_[k + 1] = running2 ? Q_[k + 1] : 0.;
+  }
+}
+
+void
+HvdcInjections::evalNodeInjection() {
+  gatherPowers();
+  const unsigned int nbConverters = static_cast<unsigned int>(buses_.size());
+  for (unsigned int k = 0; k < nbConverters; ++k) {
+    ModelBus* bus = buses_[k];
+    ur_[k] = bus->ur();
+    ui_[k] = bus->ui();
+    U2_[k] = bus->getCurrentU(ModelBus::U2PuType_);
+  }
+
+  // same currents as ModelHvdcLink::evalNodeInjection
+  for (unsigned int k = 0; k < nbConverters; ++k) {
+    const double U2 = U2_[k];
+    if (doubleIsZero(U2))
+      continue;
+    const double ur = ur_[k];
+    const double ui = ui_[k];
+    buses_[k]->irAdd((-p_[k] * ur - q_[k] * ui) / U2);
+    buses_[k]->iiAdd((-p_[k] * ui + q_[k] * ur) / U2);
+  }
+}
+
+void
+HvdcInjections::evalDerivatives() {
+  gatherPowers();
+  const unsigned int nbConverters = static_cast<unsigned int>(buses_.size());
+  for (unsigned int k = 0; k < nbConverters; ++k) {
+    const ModelBus* bus = buses_[k];
+    const double ur = bus->ur();
+    const double ui = bus->ui();
+    ur_[k] = ur;
+    ui_[k] = ui;
+    U2_[k] = ur * ur + ui * ui;
+  }
+
+  // same Jacobian terms as ModelHvdcLink::evalDerivatives, the null terms included
+  for (unsigned int k = 0; k < nbConverters; ++k) {
+    if (!connected_[k])
+      continue;
+    const double U2 = U2_[k];
+    double ir_dUr = 0.;
+    double ir_dUi = 0.;
+    double ii_dUr = 0.;
+    double ii_dUi = 0.;
+    if (!doubleIsZero(U2)) {
+      const double ur = ur_[k];
+      const double ui = ui_[k];
+      const double p = p_[k];
+      const double q = q_[k];
+      ir_dUr = (-p - 2. * ur * (-p * ur - q * ui) / U2) / U2;
+      ir_dUi = (-q - 2. * ui * (-p * ur - q * ui) / U2) / U2;
+      ii_dUr = (q - 2. * ur * (-p * ui + q * ur) / U2) / U2;
+      ii_dUi = (-p - 2. * ui * (-p * ui + q * ur) / U2) / U2;
+    }
+    ModelBus* bus = buses_[k];
+    const int urYNum = bus->urYNum();
+    const int uiYNum = bus->uiYNum();
+    auto& derivatives = bus->derivatives();
+    derivatives->addDerivative(IR_DERIVATIVE, urYNum, ir_dUr);
+    derivatives->addDerivative(IR_DERIVATIVE, uiYNum, ir_dUi);
+    derivatives->addDerivative(II_DERIVATIVE, urYNum, ii_dUr);
+    derivatives->addDerivative(II_DERIVATIVE, uiYNum, ii_dUi);
+  }
+}
+
+void
+HvdcInjections::clear() {
+  buses_.clear();
+  P_.clear();
+  Q_.clear();
+  connected_.clear();
+  p_.clear();
+  q_.clear();
+  ur_.clear();
+  ui_.clear();
+  U2_.clear();
+}
+
+unsigned int
+HvdcInjections::size() const {
+  return static_cast<unsigned int>(buses_.size() / 2);
+}
+
+}  // namespace DYN
@@ -0,0 +1,108 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNHvdcInjections.h
+ *
+ * @brief Node injections of the hvdc links of the network evaluated in one pass
+ *
+ */
+#ifndef MODELS_CPP_MODELNETWORK_DYNHVDCINJECTIONS_H_
+#define MODELS_CPP_MODELNETWORK_DYNHVDCINJECTIONS_H_
+
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+namespace DYN {
+class ModelBus;
+
+/**
+ * @brief currents injected at the nodes of the hvdc links
+ *
+ * An hvdc link injects constant powers at its two points of common coupling. The active powers are only injected
+ * when both converters are connected to a bus that is not switched off, the reactive power of a converter when it is
+ * connected to a bus that is not switched off. The links are stored in structure of arrays, one entry per converter,
+ * so that their currents and Jacobian terms are computed in loops over contiguous arrays, without any virtual call.
+ */
+class HvdcInjections : private boost::noncopyable {
+ public:
+  /**
+   * @brief default constructor
+   */
+  HvdcInjections();
+
+  /**
+   * @brief add an hvdc link
+   *
+   * @param bus1 bus of the first converter
+   * @param bus2 bus of the second converter
+   * @return index of the link
+   */
+  unsigned int addLink(ModelBus* bus1, ModelBus* bus2);
+
+  /**
+   * @brief set the powers of an hvdc link
+   *
+   * @param index index of the link
+   * @param P1 active power injected by the first converter (p.u. base SNREF)
+   * @param Q1 reactive power injected by the first converter (p.u. base SNREF)
+   * @param P2 active power injected by the second converter (p.u. base SNREF)
+   * @param Q2 reactive power injected by the second converter (p.u. base SNREF)
+   * @param connected1 whether the first converter is connected
+   * @param connected2 whether the second converter is connected
+   */
+  void setLink(unsigned int index, double P1, double Q1, double P2, double Q2, bool connected1, bool connected2);
+
+  /**
+   * @brief compute the currents of all the hvdc links and add them to their buses
+   */
+  void evalNodeInjection();
+
+  /**
+   * @brief add the Jacobian terms of all the hvdc links to the derivatives of their buses
+   */
+  void evalDerivatives();
+
+  /**
+   * @brief remove all the links
+   */
+  void clear();
+
+  /**
+   * @brief get the number of hvdc links
+   * @return number of hvdc links
+   */
+  unsigned int size() const;
+
+ private:
+  /**
+   * @brief compute the powers injected by each converter, depending on the connection of the two sides of its link
+   */
+  void gatherPowers();
+
+ private:
+  std::vector<ModelBus*> buses_;  ///< bus of each converter, the two converters of link k being at 2k and 2k+1
+  std::vector<double> P_;  ///< active power of each converter
+  std::vector<double> Q_;  ///< reactive power of each converter
+  std::vector<bool> connected_;  ///< whether each converter is connected
+  std::vector<double> p_;  ///< active power injected by each converter during the evaluation
+  std::vector<double> q_;  ///< reactive power injected by each converter during the evaluation
+  std::vector<double> ur_;  ///< real part of the voltage of each converter during the evaluation
+  std::vector<double> ui_;  ///< imaginary part of the voltage of each converter during the evaluation
+  std::vector<double> U2_;  ///< square of the voltage module of each converter during the evaluation
+};
+
+}  // namespace DYN
+
+#endif  // MODELS_CPP_MODELNETWORK_DYNHVDCINJECTIONS_H_
@@ -0,0 +1,205 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNLoadInjections.cpp
+ *
+ * @brief Node injections of the static loads of the network evaluated in one pass
+ *
+ */
+#include <cassert>
+#include <cmath>
+
+#include "DYNLoadInjections.h"
+#include "DYNModelBus.h"
+#include "DYNDerivative.h"
+#include "DYNCommon.h"
+#include "DYNNumericalUtils.h"
+
+namespace DYN {
+
+LoadInjections::LoadInjections() {
+}
+
+void
+LoadInjections::addLoad(ModelBus* bus, const double alpha, const double beta, unsigned int& group, unsigned int& index) {
+  group = 0;
+  while (group < groups_.size() && !(groups_[group].alpha == alpha && groups_[group].beta == beta))
+    ++group;
+  if (group == groups_.size()) {
+    groups_.push_back(LoadGroup());
+    LoadGroup& newGroup = groups_.back();
+    newGroup.alpha = alpha;
+    newGroup.beta = beta;
+    newGroup.alphaType = getExponentType(alpha);
+    newGroup.betaType = getExponentType(beta);
+  }
+  LoadGroup& loadGroup = groups_[group];
+  index = static_cast<unsigned int>(loadGroup.buses.size());
+  loadGroup.buses.push_back(bus);
+  loadGroup.P0.push_back(0.);
+  loadGroup.Q0.push_back(0.);
+  loadGroup.kp.push_back(0.);
+  loadGroup.kq.push_back(0.);
+  loadGroup.connected.push_back(false);
+  loadGroup.ur.push_back(0.);
+  loadGroup.ui.push_back(0.);
+  loadGroup.U.push_back(0.);
+  loadGroup.U2.push_back(0.);
+  loadGroup.Ualpha.push_back(0.);
+  loadGroup.Ubeta.push_back(0.);
+}
+
+void
+LoadInjections::setLoad(const unsigned int group, const unsigned int index, const double P0, const double Q0, const double kp, const double kq,
+    const bool connected) {
+  assert(group < groups_.size() && index < groups_[group].buses.size());
+  LoadGroup& loadGroup = groups_[group];
+  loadGroup.P0[index] = P0;
+  loadGroup.Q0[index] = Q0;
+  loadGroup.kp[index] = kp;
+  loadGroup.kq[index] = kq;
+  loadGroup.connected[index] = connected;
+}
+
+LoadInjections::exponentType_t
+LoadInjections::getExponentType(const double exponent) {
+  // exact comparisons: the fast computations must give the same result as pow
+  if (exponent == 0.)
+    return EXPONENT_ZERO;
+  else if (exponent == 1.)
+    return EXPONENT_ONE;
+  else if (exponent == 2.)
+    return EXPONENT_TWO;
+  return EXPONENT_ANY;
+}
+
+void
+LoadInjections::evalPowers(const exponentType_t type, const double exponent, const std::vector<double>& U, std::vector<double>& powers) {
+  const unsigned int nbLoads = static_cast<unsigned int>(U.size());
+  switch (type) {
+    case EXPONENT_ZERO:
+      for (unsigned int k = 0; k < nbLoads; ++k)
+        powers[k] = 1.;
+      break;
+    case EXPONENT_ONE:
+      for (unsigned int k = 0; k < nbLoads; ++k)
+        powers[k] = U[k];
+      break;
+    case EXPONENT_TWO:
+      for (unsigned int k = 0; k < nbLoads; ++k)
+        powers[k] = U[k] * U[k];
+      break;
+    case EXPONENT_ANY:
+      for (unsigned int k = 0; k < nbLoads; ++k) {
+        if (!doubleIsZero(U[k]))
+          powers[k] = pow_dynawo(U[k], exponent);
+      }
+      break;
+  }
+}
+
+void
+LoadInjections::evalNodeInjection() {
+  for (auto& group : groups_) {
+    const unsigned int nbLoads = static_cast<unsigned int>(group.buses.size());
+
+    // gather the voltages of the running loads
+    for (unsigned int k = 0; k < nbLoads; ++k) {
+      ModelBus* bus = group.buses[k];
+      const double U = group.connected[k] ? bus->getCurrentU(ModelBus::UPuType_) : 0.;
+      group.U[k] = U;
+      group.U2[k] = U * U;
+      group.ur[k] = bus->ur();
+      group.ui[k] = bus->ui();
+    }
+
+    evalPowers(group.alphaType, group.alpha, group.U, group.Ualpha);
+    evalPowers(group.betaType, group.beta, group.U, group.Ubeta);
+
+    // same currents as ModelLoad::evalNodeInjection
+    for (unsigned int k = 0; k < nbLoads; ++k) {
+      if (doubleIsZero(group.U[k]))
+        continue;
+      const double ur = group.ur[k];
+      const double ui = group.ui[k];
+      const double U2 = group.U2[k];
+      const double p = group.P0[k] * group.Ualpha[k] * group.kp[k];
+      const double q = group.Q0[k] * group.Ubeta[k] * group.kq[k];
+      group.buses[k]->irAdd((p * ur + q * ui) / U2);
+      group.buses[k]->iiAdd((p * ui - q * ur) / U2);
+    }
+  }
+}
+
+void
+LoadInjections::evalDerivatives() {
+  for (auto& group : groups_) {
+    const unsigned int nbLoads = static_cast<unsigned int>(group.buses.size());
+
+    // gather the voltages of the running loads
+    for (unsigned int k = 0; k < nbLoads; ++k) {
+      const ModelBus* bus = group.buses[k];
+      const double ur = bus->ur();
+      const double ui = bus->ui();
+      const double U2 = (group.connected[k] && !bus->getSwitchOff()) ? ur * ur + ui * ui : 0.;
+      group.ur[k] = ur;
+      group.ui[k] = ui;
+      group.U2[k] = U2;
+      group.U[k] = sqrt(U2);
+    }
+
+    evalPowers(group.alphaType, group.alpha, group.U, group.Ualpha);
+    evalPowers(group.betaType, group.beta, group.U, group.Ubeta);
+
+    // same Jacobian terms as ModelLoad::evalDerivatives
+    const double alpha = group.alpha;
+    const double beta = group.beta;
+    for (unsigned int k = 0; k < nbLoads; ++k) {
+      const double U2 = group.U2[k];
+      if (doubleIsZero(U2))
+        continue;
+      const double ur = group.ur[k];
+      const double ui = group.ui[k];
+      const double p = group.P0[k] * group.Ualpha[k] * group.kp[k];
+      const double q = group.Q0[k] * group.Ubeta[k] * group.kq[k];
+      const double PdUr = 1. / U2 * group.P0[k] * group.kp[k] * alpha * ur * group.Ualpha[k];
+      const double PdUi = 1. / U2 * group.P0[k] * group.kp[k] * alpha * ui * group.Ualpha[k];
+      const double QdUr = 1. / U2 * group.Q0[k] * group.kq[k] * beta * ur * group.Ubeta[k];
+      const double QdUi = 1. / U2 * group.Q0[k] * group.kq[k] * beta * ui * group.Ubeta[k];
+      ModelBus* bus = group.buses[k];
+      const int urYNum = bus->urYNum();
+      const int uiYNum = bus->uiYNum();
+      auto& derivatives = bus->derivatives();
+      derivatives->addDerivative(IR_DERIVATIVE, urYNum, ((PdUr * ur + p) + (QdUr * ui) - 2. * ur * (p * ur + q * ui) / U2) / U2);
+      derivatives->addDerivative(IR_DERIVATIVE, uiYNum, ((PdUi * ur) + (QdUi * ui + q) - 2. * ui * (p * ur + q * ui) / U2) / U2);
+      derivatives->addDerivative(II_DERIVATIVE, urYNum, ((PdUr * ui) - (QdUr * ur + q) - 2. * ur * (p * ui - q * ur) / U2) / U2);
+      derivatives->addDerivative(II_DERIVATIVE, uiYNum, ((PdUi * ui + p) - (QdUi * ur) - 2. * ui * (p * ui - q * ur) / U2) / U2);
+    }
+  }
+}
+
+void
+LoadInjections::clear() {
+  groups_.clear();
+}
+
+unsigned int
+LoadInjections::size() const {
+  unsigned int nbLoads = 0;
+  for (const auto& group : groups_)
+    nbLoads += static_cast<unsigned int>(group.buses.size());
+  return nbLoads;
+}
+
+}  // namespace DYN
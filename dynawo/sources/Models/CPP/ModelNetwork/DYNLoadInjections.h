@@ -0,0 +1,146 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNLoadInjections.h
+ *
+ * @brief Node injections of the static loads of the network evaluated in one pass
+ *
+ */
+#ifndef MODELS_CPP_MODELNETWORK_DYNLOADINJECTIONS_H_
+#define MODELS_CPP_MODELNETWORK_DYNLOADINJECTIONS_H_
+
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+namespace DYN {
+class ModelBus;
+
+/**
+ * @brief currents injected at the nodes of the static loads
+ *
+ * A static load is a load that is neither restorative nor controllable: its powers only depend on the voltage of
+ * its bus, P = P0 * U^alpha * kp and Q = Q0 * U^beta * kq. The loads are grouped by pair of exponents, and each
+ * group is stored in structure of arrays: the currents and the Jacobian terms of a group are computed in loops
+ * over contiguous arrays, without any virtual call. The common exponents 0, 1 and 2 (constant power, current and
+ * impedance) are computed without calling pow.
+ */
+class LoadInjections : private boost::noncopyable {
+ public:
+  /**
+   * @brief default constructor
+   */
+  LoadInjections();
+
+  /**
+   * @brief add a static load
+   *
+   * @param bus bus of the load
+   * @param alpha active power exponential sensitivity to voltage
+   * @param beta reactive power exponential sensitivity to voltage
+   * @param group group of the load, filled by the method
+   * @param index index of the load in its group, filled by the method
+   */
+  void addLoad(ModelBus* bus, double alpha, double beta, unsigned int& group, unsigned int& index);
+
+  /**
+   * @brief set the powers of a static load
+   *
+   * @param group group of the load
+   * @param index index of the load in its group
+   * @param P0 initial active power (p.u. base SNREF)
+   * @param Q0 initial reactive power (p.u. base SNREF)
+   * @param kp gain kp
+   * @param kq gain kq
+   * @param connected whether the load is connected
+   */
+  void setLoad(unsigned int group, unsigned int index, double P0, double Q0, double kp, double kq, bool connected);
+
+  /**
+   * @brief compute the currents of all the static loads and add them to their buses
+   */
+  void evalNodeInjection();
+
+  /**
+   * @brief add the Jacobian terms of all the static loads to the derivatives of their buses
+   */
+  void evalDerivatives();
+
+  /**
+   * @brief remove all the loads
+   */
+  void clear();
+
+  /**
+   * @brief get the number of static loads
+   * @return number of static loads
+   */
+  unsigned int size() const;
+
+ private:
+  /**
+   * @brief type of exponent of a group, to use the fastest way to compute U^exponent
+   */
+  typedef enum {
+    EXPONENT_ZERO = 0,  ///< U^0 = 1
+    EXPONENT_ONE = 1,  ///< U^1 = U
+    EXPONENT_TWO = 2,  ///< U^2 = U * U
+    EXPONENT_ANY = 3  ///< U^exponent = pow(U, exponent)
+  } exponentType_t;
+
+  /**
+   * @brief static loads with the same exponents
+   */
+  struct LoadGroup {
+    double alpha;  ///< active power exponential sensitivity to voltage
+    double beta;  ///< reactive power exponential sensitivity to voltage
+    exponentType_t alphaType;  ///< type of alpha
+    exponentType_t betaType;  ///< type of beta
+    std::vector<ModelBus*> buses;  ///< bus of each load
+    std::vector<double> P0;  ///< initial active power of each load
+    std::vector<double> Q0;  ///< initial reactive power of each load
+    std::vector<double> kp;  ///< gain kp of each load
+    std::vector<double> kq;  ///< gain kq of each load
+    std::vector<bool> connected;  ///< whether each load is connected
+    std::vector<double> ur;  ///< real part of the voltage of each load during the evaluation
+    std::vector<double> ui;  ///< imaginary part of the voltage of each load during the evaluation
+    std::vector<double> U;  ///< voltage module of each load during the evaluation, 0 if the load is not running
+    std::vector<double> U2;  ///< square of the voltage module of each load during the evaluation
+    std::vector<double> Ualpha;  ///< U^alpha of each load during the evaluation
+    std::vector<double> Ubeta;  ///< U^beta of each load during the evaluation
+  };
+
+  /**
+   * @brief get the type of an exponent
+   * @param exponent exponential sensitivity to voltage
+   * @return type of the exponent
+   */
+  static exponentType_t getExponentType(double exponent);
+
+  /**
+   * @brief compute U^exponent for all the running loads of a group
+   * @param type type of the exponent
+   * @param exponent exponential sensitivity to voltage
+   * @param U voltage module of each load, 0 if the load is not running
+   * @param powers U^exponent of each running load, filled by the method
+   */
+  static void evalPowers(exponentType_t type, double exponent, const std::vector<double>& U, std::vector<double>& powers);
+
+ private:
+  std::vector<LoadGroup> groups_;  ///< groups of static loads, one per pair of exponents
+};
+
+}  // namespace DYN
+
+#endif  // MODELS_CPP_MODELNETWORK_DYNLOADINJECTIONS_H_
@@ -20,6 +20,7 @@
 #include <cmath>
 #include <iostream>
 #include <cassert>
+#include <unordered_map>
 
 #include <boost/algorithm/string/predicate.hpp>
 
@@ -126,6 +127,72 @@ ModelBusContainer::exploreNeighbors(const double t) {
   // Erase the last subNetwork which is empty
   subNetworks_.erase(subNetworks_.end() - 1);
 
+  printSubNetworks(t);
+}
+
+void
+ModelBusContainer::resetNeighbors() {
+  for (const auto& busModel : models_)
+    busModel->clearNeighbors();
+}
+
+void
+ModelBusContainer::updateSubNetworks(const double t) {
+  if (subNetworks_.empty()) {
+    for (const auto& busModel : models_)
+      busModel->clearNumSubNetwork();
+    exploreNeighbors(t);
+    return;
+  }
+
+  // a sub-network is kept if the neighbors of its buses did not change and if its buses still hold its number
+  std::unordered_map<const ModelBus*, shared_ptr<SubNetwork> > keptSubNetworksByFirstBus;
+  for (const auto& subNetwork : subNetworks_) {
+    bool modified = false;
+    for (unsigned int i = 0; i < subNetwork->nbBus() && !modified; ++i) {
+      const std::shared_ptr<ModelBus> busModel = subNetwork->bus(i);
+      modified = busModel->neighborsModified() || !busModel->numSubNetworkSet() || busModel->numSubNetwork() != subNetwork->getNum();
+    }
+    if (modified) {
+      for (unsigned int i = 0; i < subNetwork->nbBus(); ++i)
+        subNetwork->bus(i)->clearNumSubNetwork();
+    } else {
+      keptSubNetworksByFirstBus[subNetwork->bus(0).get()] = subNetwork;
+    }
+  }
+
+  // as in exploreNeighbors, a sub-network is numbered when its first bus is reached in the list of buses
+  vector<shared_ptr<SubNetwork> > subNetworks;
+  subNetworks.reserve(subNetworks_.size());
+  for (const auto& busModel : models_) {
+    const int numSubNetwork = static_cast<int>(subNetworks.size());
+    const auto itKept = keptSubNetworksByFirstBus.find(busModel.get());
+    if (itKept != keptSubNetworksByFirstBus.end()) {
+      const shared_ptr<SubNetwork>& subNetwork = itKept->second;
+      if (subNetwork->getNum() != numSubNetwork) {
+        subNetwork->setNum(numSubNetwork);
+        for (unsigned int i = 0; i < subNetwork->nbBus(); ++i)
+          subNetwork->bus(i)->numSubNetwork(numSubNetwork);
+      }
+      subNetworks.push_back(subNetwork);
+    } else if (!busModel->numSubNetworkSet()) {  // Bus of a modified sub-network not yet treated
+      shared_ptr<SubNetwork> subNetwork(new SubNetwork(numSubNetwork));
+      busModel->numSubNetwork(numSubNetwork);
+      subNetwork->addBus(busModel);
+      busModel->exploreNeighbors(numSubNetwork, subNetwork);
+      subNetworks.push_back(subNetwork);
+    }
+  }
+  subNetworks_.swap(subNetworks);
+
+  printSubNetworks(t);
+}
+
+void
+ModelBusContainer::printSubNetworks(const double t) const {
+  // called after each topology change: nothing is formatted if the network debug logs are filtered out
+  if (!Trace::isLogEnabled(Trace::network(), DEBUG))
+    return;
   Trace::debug(Trace::network()) << "------------------------------" << Trace::endline;
   Trace::debug(Trace::network()) << "SubNetworks at time " << t << Trace::endline;
   Trace::debug(Trace::network()) << "------------------------------" << Trace::endline;
@@ -151,6 +218,18 @@ ModelBusContainer::initDerivatives() {
     busModel->initDerivatives();
 }
 
+void
+ModelBusContainer::saveDerivatives() {
+  for (const auto& busModel : models_)
+    busModel->saveDerivatives();
+}
+
+void
+ModelBusContainer::restoreDerivatives() {
+  for (const auto& busModel : models_)
+    busModel->restoreDerivatives();
+}
+
 ModelBus::ModelBus(const std::shared_ptr<BusInterface>& bus, const bool isNodeBreaker) :
 NetworkComponent(bus->getID()),
 bus_(bus),
@@ -194,6 +273,17 @@ startingPointMode_(WARM) {
   }
 }
 
+bool
+ModelBus::neighborsModified() const {
+  if (neighbors_.size() != previousNeighbors_.size())
+    return true;
+  for (unsigned int i = 0; i < neighbors_.size(); ++i) {
+    if (neighbors_[i].owner_before(previousNeighbors_[i]) || previousNeighbors_[i].owner_before(neighbors_[i]))
+      return true;
+  }
+  return false;
+}
+
 bool
 ModelBus::numSubNetworkSet() const {
   assert(z_ != NULL);
@@ -360,6 +450,17 @@ ModelBus::initDerivatives() {
   derivativesPrim_->reset();
 }
 
+void
+ModelBus::saveDerivatives() {
+  derivatives_->save();
+}
+
+void
+ModelBus::restoreDerivatives() {
+  derivatives_->restore();
+  derivativesPrim_->reset();
+}
+
 void
 ModelBus::exploreNeighbors(const int numSubNetwork, const shared_ptr<SubNetwork>& subNetwork) {
   for (const auto& neighbor : neighbors_) {
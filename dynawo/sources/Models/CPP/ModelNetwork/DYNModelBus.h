@@ -105,12 +105,19 @@ class ModelBus : public NetworkComponent {  ///< Generic AC network bus
 
   /**
    * @brief clear neighbors
-   * reset the list of neighbors
+   * reset the list of neighbors, the previous list being kept to detect its modifications
    */
   void clearNeighbors() {
+    previousNeighbors_.swap(neighbors_);
     neighbors_.clear();
   }
 
+  /**
+   * @brief state whether the neighbors differ from the ones before the last clearNeighbors
+   * @return @b true if a neighbor was added or removed, or if their order changed
+   */
+  bool neighborsModified() const;
+
   /**
    * @brief define variables
    * @param variables variables
@@ -341,6 +348,16 @@ class ModelBus : public NetworkComponent {  ///< Generic AC network bus
    */
   void initDerivatives();
 
+  /**
+   * @brief keep the current derivatives, to restart from them at the next evaluations
+   */
+  void saveDerivatives();
+
+  /**
+   * @brief init derivatives from the saved ones
+   */
+  void restoreDerivatives();
+
   /**
    * @brief get derivatives for J
    * @return the derivatives associated to the bus model for J
@@ -613,6 +630,7 @@ class ModelBus : public NetworkComponent {  ///< Generic AC network bus
   double irConnection_;  ///< real current injected
   double iiConnection_;  ///< imaginary current injected
   int refIslands_;  ///< island reference (used to compute switch loops)
+  std::vector<std::weak_ptr<ModelBus> > previousNeighbors_;  ///< neighbors before the last clearNeighbors
   boost::shared_ptr<BusDerivatives> derivatives_;  ///< derivatives
   boost::shared_ptr<BusDerivatives> derivativesPrim_;  ///< derivatives for JPrim
   double ur0_{};  ///< initial real voltage
@@ -753,6 +771,21 @@ class ModelBusContainer {
    */
   void exploreNeighbors(double t);  // create a new-subnetwork, and scan the network to find all buses located within
 
+  /**
+   * @brief clear the neighbors of all the buses, keeping the sub-networks
+   */
+  void resetNeighbors();
+
+  /**
+   * @brief update the sub-networks after the neighbors of the buses were defined again
+   *
+   * Only the sub-networks containing a bus whose neighbors were modified are explored again, the other ones being
+   * kept. The sub-networks are then numbered in the same order as exploreNeighbors would do.
+   *
+   * @param t : time to use  (only used for log purpose)
+   */
+  void updateSubNetworks(double t);
+
   /**
    * @brief init reference islands
    *
@@ -765,6 +798,16 @@ class ModelBusContainer {
    */
   void initDerivatives();
 
+  /**
+   * @brief keep the current derivatives of all the buses, to restart from them at the next evaluations
+   */
+  void saveDerivatives();
+
+  /**
+   * @brief init the derivatives of all the buses from the saved ones
+   */
+  void restoreDerivatives();
+
   /**
    * @brief evaluate the residual functions for each bus
    * @param[in] type type of the residues to compute (algebraic, differential or both)
@@ -804,6 +847,13 @@ class ModelBusContainer {
    */
   void resetInjections();
 
+ private:
+  /**
+   * @brief print the sub-networks in the network traces
+   * @param t : time to use  (only used for log purpose)
+   */
+  void printSubNetworks(double t) const;
+
  private:
   std::vector<std::shared_ptr<ModelBus> > models_;  ///< model bus
   std::vector<boost::shared_ptr<SubNetwork> > subNetworks_;  ///< sub network
@@ -29,6 +29,7 @@
 #include "DYNVariableForModel.h"
 #include "DYNParameter.h"
 #include "DYNDerivative.h"
+#include "DYNHvdcInjections.h"
 #include "DYNBusInterface.h"
 #include "DYNModelConstants.h"
 #include "DYNModelNetwork.h"
@@ -64,7 +65,9 @@ ir01_(0.),
 ii01_(0.),
 ir02_(0.),
 ii02_(0.),
-startingPointMode_(WARM) {
+startingPointMode_(WARM),
+hvdcInjections_(nullptr),
+hvdcIndex_(0) {
   // retrieve data from VscConverterInterface and HvdcLineInterface (IIDM)
   setAttributes(dcLine);
 }
@@ -262,6 +265,7 @@ ModelHvdcLink::loadInternalVariables(boost::archive::binary_iarchive& streamVari
   streamVariables >> ir02_;
   streamVariables >> c;
   streamVariables >> ii02_;
+  updateHvdcInjections();
 }
 
 void
@@ -544,6 +548,36 @@ ModelHvdcLink::evalNodeInjection() {
   }
 }
 
+void
+ModelHvdcLink::setConnected1(const State state) {
+  connectionState1_ = state;
+  updateHvdcInjections();
+}
+
+void
+ModelHvdcLink::setConnected2(const State state) {
+  connectionState2_ = state;
+  updateHvdcInjections();
+}
+
+bool
+ModelHvdcLink::addToHvdcInjections(HvdcInjections& hvdcInjections) {
+  hvdcInjections_ = nullptr;
+  if (!modelBus1_ || !modelBus2_)
+    return false;
+  hvdcIndex_ = hvdcInjections.addLink(modelBus1_.get(), modelBus2_.get());
+  hvdcInjections_ = &hvdcInjections;
+  updateHvdcInjections();
+  return true;
+}
+
+void
+ModelHvdcLink::updateHvdcInjections() const {
+  if (!hvdcInjections_)
+    return;
+  hvdcInjections_->setLink(hvdcIndex_, P01_, Q01_, P02_, Q02_, isConnected1(), isConnected2());
+}
+
 void
 ModelHvdcLink::evalDerivatives(const double /*cj*/) {
   if (network_->isInitModel())
@@ -29,6 +29,7 @@
 #include "DYNHvdcLineInterface.h"
 
 namespace DYN {
+class HvdcInjections;
 class ModelBus;
 class VscConverterInterface;
 class LccConverterInterface;
@@ -186,6 +187,13 @@ class ModelHvdcLink : public NetworkComponent {
    */
   void evalNodeInjection() override;
 
+  /**
+   * @brief add the link to the node injections of the hvdc links, computed together by the network
+   * @param hvdcInjections node injections of the hvdc links
+   * @return @b true if the link was added, @b false if one of its converters has no bus
+   */
+  bool addToHvdcInjections(HvdcInjections& hvdcInjections);
+
   /**
    * @brief reset node injection
    */
@@ -279,17 +287,13 @@ class ModelHvdcLink : public NetworkComponent {
    * @brief set connection status
    * @param state connection status
    */
-  void setConnected1(const State state) {
-    connectionState1_ = state;
-  }
+  void setConnected1(State state);
 
   /**
    * @brief set connection status
    * @param state connection status
    */
-  void setConnected2(const State state) {
-    connectionState2_ = state;
-  }
+  void setConnected2(State state);
 
   /**
    * @brief set the bus to which the converter1 is connected
@@ -351,6 +355,11 @@ class ModelHvdcLink : public NetworkComponent {
   void loadInternalVariables(boost::archive::binary_iarchive& streamVariables) override;
 
  private:
+  /**
+   * @brief copy the powers and the connection status of the link in the node injections of the hvdc links, if it belongs to them
+   */
+  void updateHvdcInjections() const;
+
   /**
    * @brief set attributes for hvdc link
    * @param dcLine dc line interface used to represent the dc line of the hvdc link
@@ -531,6 +540,8 @@ class ModelHvdcLink : public NetworkComponent {
   double ir02_;  ///< initial current real part at point of common coupling 2
   double ii02_;  ///< initial current imaginary part at point of common coupling 2
   startingPointMode_t startingPointMode_;  ///< type of starting point for the model (FLAT,WARM)
+  HvdcInjections* hvdcInjections_;  ///< node injections of the hvdc links the link belongs to, nullptr if none
+  unsigned int hvdcIndex_;  ///< index of the link in hvdcInjections_
 };  ///< class for Hvdc link model in network
 
 }  // namespace DYN
@@ -38,6 +38,7 @@
 #include "DYNVariableForModel.h"
 #include "DYNParameter.h"
 #include "DYNDerivative.h"
+#include "DYNBranchInjections.h"
 #include "DYNLineInterface.h"
 #include "DYNCurrentLimitInterface.h"
 #include "DYNBusInterface.h"
@@ -81,6 +82,8 @@ IbImNum_(0.),
 omegaRefNum_(0.),
 omegaNom_(OMEGA_NOM),
 omegaRef_(1.),
+branchInjections_(nullptr),
+branchIndex_(0),
 modelType_("Line") {
   const double r = line->getR();
   const double x = line->getX();
@@ -283,24 +286,51 @@ ModelLine::init(int& yNum) {
 void
 ModelLine::evalYMat() {
   if (updateYMat_) {
-    ir1_dUr1_ = ir1_dUr1();
-    ir1_dUi1_ = ir1_dUi1();
-    ir1_dUr2_ = ir1_dUr2();
-    ir1_dUi2_ = ir1_dUi2();
-    ii1_dUr1_ = ii1_dUr1();
-    ii1_dUi1_ = ii1_dUi1();
-    ii1_dUr2_ = ii1_dUr2();
-    ii1_dUi2_ = ii1_dUi2();
-    ir2_dUr1_ = ir2_dUr1();
-    ir2_dUi1_ = ir2_dUi1();
-    ir2_dUr2_ = ir2_dUr2();
-    ir2_dUi2_ = ir2_dUi2();
-    ii2_dUr1_ = ii2_dUr1();
-    ii2_dUi1_ = ii2_dUi1();
-    ii2_dUr2_ = ii2_dUr2();
-    ii2_dUi2_ = ii2_dUi2();
+    // the terms of each connection state are computed by a dedicated kernel, the evaluations then only use the terms
+    switch (getConnectionState()) {
+      case CLOSED:
+        evalYMatClosed();
+        break;
+      case CLOSED_1:
+        evalYMatClosedSide1();
+        break;
+      case CLOSED_2:
+        evalYMatClosedSide2();
+        break;
+      default:
+        resetYMat();
+        break;
+    }
     updateYMat_ = false;
   }
+  updateBranchInjections();
+}
+
+bool
+ModelLine::addToBranchInjections(BranchInjections& branchInjections) {
+  branchInjections_ = nullptr;
+  if (isDynamic_)
+    return false;
+  branchIndex_ = branchInjections.addBranch(modelBus1_.get(), modelBus2_.get());
+  branchInjections_ = &branchInjections;
+  updateBranchInjections();
+  return true;
+}
+
+void
+ModelLine::updateBranchInjections() const {
+  if (!branchInjections_)
+    return;
+  const double admittances[BranchInjections::NB_CURRENTS][BranchInjections::NB_VOLTAGES] = {
+    {ir1_dUr1_, ir1_dUi1_, ir1_dUr2_, ir1_dUi2_},
+    {ii1_dUr1_, ii1_dUi1_, ii1_dUr2_, ii1_dUi2_},
+    {ir2_dUr1_, ir2_dUi1_, ir2_dUr2_, ir2_dUi2_},
+    {ii2_dUr1_, ii2_dUi1_, ii2_dUr2_, ii2_dUi2_}
+  };
+  // same voltages as the ones given by ur1(), ui1(), ur2() and ui2()
+  const bool side1Connected = getConnectionState() == CLOSED || getConnectionState() == CLOSED_1;
+  const bool side2Connected = getConnectionState() == CLOSED || getConnectionState() == CLOSED_2;
+  branchInjections_->setAdmittances(branchIndex_, admittances, side1Connected, side2Connected);
 }
 
 double
@@ -323,220 +353,91 @@ ModelLine::ii2(const double ur1, const double ui1, const double ur2, const doubl
   return ii2_dUr1_ * ur1 + ii2_dUi1_ * ui1 + ii2_dUr2_ * ur2 + ii2_dUi2_ * ui2;
 }
 
-double
-ModelLine::ir1_dUr1() const {
-  double ir1_dUr1 = 0.;
-  if (getConnectionState() == CLOSED) {
-    const double G1 = admittance_ * sin(lossAngle_) + conduct1_;
-    ir1_dUr1 = G1;
-  } else if (getConnectionState() == CLOSED_1) {
-    const double G = admittance_ * sin(lossAngle_) + conduct2_;
-    const double B = suscept2_ - admittance_ * cos(lossAngle_);
-    const double denom = G * G + B * B;
-
-    const double GT = conduct1_ + 1. / denom * (admittance_ * admittance_ * conduct2_
-      + admittance_ * sin(lossAngle_) * (conduct2_ * conduct2_ + suscept2_ * suscept2_));
-    ir1_dUr1 = GT;
-  }
-  return ir1_dUr1;
-}
-
-double
-ModelLine::ir1_dUi1() const {
-  double ir1_dUi1 = 0.;
-  if (getConnectionState() == CLOSED) {
-    const double B1 = suscept1_ - admittance_ * cos(lossAngle_);
-    ir1_dUi1 = -B1;
-  } else if (getConnectionState() == CLOSED_1) {
-    const double G = admittance_ * sin(lossAngle_) + conduct2_;
-    const double B = suscept2_ - admittance_ * cos(lossAngle_);
-    const double denom = G * G + B * B;
-
-    const double BT = suscept1_ + 1. / denom * (admittance_ * admittance_ * suscept2_
-      - admittance_ * cos(lossAngle_) * (conduct2_ * conduct2_ + suscept2_ * suscept2_));
-    ir1_dUi1 = -BT;
-  }
-  return ir1_dUi1;
-}
-
-double
-ModelLine::ir1_dUr2() const {
-  double ir1_dUr2 = 0.;
-  if (getConnectionState() == CLOSED) {
-    ir1_dUr2 = -admittance_ * sin(lossAngle_);
-  }
-  return ir1_dUr2;
-}
-
-double
-ModelLine::ir1_dUi2() const {
-  double ir1_dUi2 = 0.;
-  if (getConnectionState() == CLOSED) {
-    ir1_dUi2 = -admittance_ * cos(lossAngle_);
-  }
-  return ir1_dUi2;
-}
-
-double
-ModelLine::ii1_dUr1() const {
-  double ii1_dUr1 = 0.;
-  if (getConnectionState() == CLOSED) {
-    const double B1 = suscept1_ - admittance_ * cos(lossAngle_);
-    ii1_dUr1 = B1;
-  } else if (getConnectionState() == CLOSED_1) {
-    const double G = admittance_ * sin(lossAngle_) + conduct2_;
-    const double B = suscept2_ - admittance_ * cos(lossAngle_);
-    const double denom = G * G + B * B;
-
-    const double BT = suscept1_ + 1. / denom * (admittance_ * admittance_ * suscept2_
-      - admittance_ * cos(lossAngle_) * (conduct2_ * conduct2_ + suscept2_ * suscept2_));
-    ii1_dUr1 = BT;
-  }
-  return ii1_dUr1;
-}
-
-double
-ModelLine::ii1_dUi1() const {
-  double ii1_dUi1 = 0.;
-  if (getConnectionState() == CLOSED) {
-    const double G1 = admittance_ * sin(lossAngle_) + conduct1_;
-    ii1_dUi1 = G1;
-  } else if (getConnectionState() == CLOSED_1) {
-    const double G = admittance_ * sin(lossAngle_) + conduct2_;
-    const double B = suscept2_ - admittance_ * cos(lossAngle_);
-    const double denom = G * G + B * B;
-
-    const double GT = conduct1_ + 1. / denom * (admittance_ * admittance_ * conduct2_
-      + admittance_ * sin(lossAngle_) * (conduct2_ * conduct2_ + suscept2_ * suscept2_));
-    ii1_dUi1 = GT;
-  }
-  return ii1_dUi1;
-}
-
-double
-ModelLine::ii1_dUr2() const {
-  double ii1_dUr2 = 0.;
-  if (getConnectionState() == CLOSED) {
-    ii1_dUr2 = admittance_ * cos(lossAngle_);
-  }
-  return ii1_dUr2;
-}
-
-double
-ModelLine::ii1_dUi2() const {
-  double ii1_dUi2 = 0.;
-  if (getConnectionState() == CLOSED) {
-    ii1_dUi2 = -admittance_ * sin(lossAngle_);
-  }
-  return ii1_dUi2;
-}
-
-double
-ModelLine::ir2_dUr1() const {
-  double ir2_dUr1 = 0.;
-  if (getConnectionState() == CLOSED) {
-    ir2_dUr1 = -admittance_ * sin(lossAngle_);
-  }
-  return ir2_dUr1;
-}
-
-double
-ModelLine::ir2_dUi1() const {
-  double ir2_dUi1 = 0.;
-  if (getConnectionState() == CLOSED) {
-    ir2_dUi1 = -admittance_ * cos(lossAngle_);
-  }
-  return ir2_dUi1;
-}
-
-double
-ModelLine::ir2_dUr2() const {
-  double ir2_dUr2 = 0.;
-  if (getConnectionState() == CLOSED) {
-    const double G2 = conduct2_ + admittance_ * sin(lossAngle_);
-    ir2_dUr2 = G2;
-  } else if (getConnectionState() == CLOSED_2) {
-    const double G = admittance_ * sin(lossAngle_) + conduct1_;
-    const double B = suscept1_ - admittance_ * cos(lossAngle_);
-    const double denom = G * G + B * B;
-
-    const double GT = conduct2_ + 1. / denom * (admittance_ * admittance_ * conduct1_
-      + admittance_ * sin(lossAngle_) * (conduct1_ * conduct1_ + suscept1_ * suscept1_));
-    ir2_dUr2 = GT;
-  }
-  return ir2_dUr2;
-}
-
-double
-ModelLine::ir2_dUi2() const {
-  double ir2_dUi2 = 0.;
-  if (getConnectionState() == CLOSED) {
-    const double B2 = suscept2_ - admittance_ * cos(lossAngle_);
-    ir2_dUi2 = -B2;
-  } else if (getConnectionState() == CLOSED_2) {
-    const double G = admittance_ * sin(lossAngle_) + conduct1_;
-    const double B = suscept1_ - admittance_ * cos(lossAngle_);
-    const double denom = G * G + B * B;
-
-    const double BT = suscept2_ + 1. / denom * (admittance_ * admittance_ * suscept1_
-      - admittance_ * cos(lossAngle_) * (conduct1_ * conduct1_ + suscept1_ * suscept1_));
-    ir2_dUi2 = -BT;
-  }
-  return ir2_dUi2;
-}
-
-double
-ModelLine::ii2_dUr1() const {
-  double ii2_dUr1 = 0.;
-  if (getConnectionState() == CLOSED) {
-    ii2_dUr1 = admittance_ * cos(lossAngle_);
-  }
-  return ii2_dUr1;
+void
+ModelLine::evalYMatClosed() {
+  const double admittanceSin = admittance_ * sin(lossAngle_);
+  const double admittanceCos = admittance_ * cos(lossAngle_);
+  const double G1 = admittanceSin + conduct1_;
+  const double B1 = suscept1_ - admittanceCos;
+  const double G2 = conduct2_ + admittanceSin;
+  const double B2 = suscept2_ - admittanceCos;
+
+  ir1_dUr1_ = G1;
+  ir1_dUi1_ = -B1;
+  ir1_dUr2_ = -admittanceSin;
+  ir1_dUi2_ = -admittanceCos;
+  ii1_dUr1_ = B1;
+  ii1_dUi1_ = G1;
+  ii1_dUr2_ = admittanceCos;
+  ii1_dUi2_ = -admittanceSin;
+  ir2_dUr1_ = -admittanceSin;
+  ir2_dUi1_ = -admittanceCos;
+  ir2_dUr2_ = G2;
+  ir2_dUi2_ = -B2;
+  ii2_dUr1_ = admittanceCos;
+  ii2_dUi1_ = -admittanceSin;
+  ii2_dUr2_ = B2;
+  ii2_dUi2_ = G2;
 }
 
-double
-ModelLine::ii2_dUi1() const {
-  double ii2_dUi1 = 0.;
-  if (getConnectionState() == CLOSED) {
-    ii2_dUi1 = -admittance_ * sin(lossAngle_);
-  }
-  return ii2_dUi1;
+void
+ModelLine::evalYMatClosedSide1() {
+  resetYMat();
+  // the open side 2 is seen from side 1 as its shunt in series with the line impedance
+  const double admittanceSin = admittance_ * sin(lossAngle_);
+  const double admittanceCos = admittance_ * cos(lossAngle_);
+  const double G = admittanceSin + conduct2_;
+  const double B = suscept2_ - admittanceCos;
+  const double denom = G * G + B * B;
+
+  const double GT = conduct1_ + 1. / denom * (admittance_ * admittance_ * conduct2_
+    + admittanceSin * (conduct2_ * conduct2_ + suscept2_ * suscept2_));
+  const double BT = suscept1_ + 1. / denom * (admittance_ * admittance_ * suscept2_
+    - admittanceCos * (conduct2_ * conduct2_ + suscept2_ * suscept2_));
+  ir1_dUr1_ = GT;
+  ir1_dUi1_ = -BT;
+  ii1_dUr1_ = BT;
+  ii1_dUi1_ = GT;
 }
 
-double
-ModelLine::ii2_dUr2() const {
-  double ii2_dUr2 = 0.;
-  if (getConnectionState() == CLOSED) {
-    const double B2 = suscept2_ - admittance_ * cos(lossAngle_);
-    ii2_dUr2 = B2;
-  } else if (getConnectionState() == CLOSED_2) {
-    const double G = admittance_ * sin(lossAngle_) + conduct1_;
-    const double B = suscept1_ - admittance_ * cos(lossAngle_);
-    const double denom = G * G + B * B;
-
-    const double BT = suscept2_ + 1. / denom * (admittance_ * admittance_ * suscept1_
-      - admittance_ * cos(lossAngle_) * (conduct1_ * conduct1_ + suscept1_ * suscept1_));
-    ii2_dUr2 = BT;
-  }
-  return ii2_dUr2;
+void
+ModelLine::evalYMatClosedSide2() {
+  resetYMat();
+  // the open side 1 is seen from side 2 as its shunt in series with the line impedance
+  const double admittanceSin = admittance_ * sin(lossAngle_);
+  const double admittanceCos = admittance_ * cos(lossAngle_);
+  const double G = admittanceSin + conduct1_;
+  const double B = suscept1_ - admittanceCos;
+  const double denom = G * G + B * B;
+
+  const double GT = conduct2_ + 1. / denom * (admittance_ * admittance_ * conduct1_
+    + admittanceSin * (conduct1_ * conduct1_ + suscept1_ * suscept1_));
+  const double BT = suscept2_ + 1. / denom * (admittance_ * admittance_ * suscept1_
+    - admittanceCos * (conduct1_ * conduct1_ + suscept1_ * suscept1_));
+  ir2_dUr2_ = GT;
+  ir2_dUi2_ = -BT;
+  ii2_dUr2_ = BT;
+  ii2_dUi2_ = GT;
 }
 
-double
-ModelLine::ii2_dUi2() const {
-  double ii2_dUi2 = 0.;
-  if (getConnectionState() == CLOSED) {
-    const double G2 = conduct2_ + admittance_ * sin(lossAngle_);
-    ii2_dUi2 = G2;
-  } else if (getConnectionState() == CLOSED_2) {
-    const double G = admittance_ * sin(lossAngle_) + conduct1_;
-    const double B = suscept1_ - admittance_ * cos(lossAngle_);
-    const double denom = G * G + B * B;
-
-    const double GT = conduct2_ + 1. / denom * (admittance_ * admittance_ * conduct1_
-      + admittance_ * sin(lossAngle_)*(conduct1_ * conduct1_ + suscept1_ * suscept1_));
-    ii2_dUi2 = GT;
-  }
-  return ii2_dUi2;
+void
+ModelLine::resetYMat() {
+  ir1_dUr1_ = 0.;
+  ir1_dUi1_ = 0.;
+  ir1_dUr2_ = 0.;
+  ir1_dUi2_ = 0.;
+  ii1_dUr1_ = 0.;
+  ii1_dUi1_ = 0.;
+  ii1_dUr2_ = 0.;
+  ii1_dUi2_ = 0.;
+  ir2_dUr1_ = 0.;
+  ir2_dUi1_ = 0.;
+  ir2_dUr2_ = 0.;
+  ir2_dUi2_ = 0.;
+  ii2_dUr1_ = 0.;
+  ii2_dUi1_ = 0.;
+  ii2_dUr2_ = 0.;
+  ii2_dUi2_ = 0.;
 }
 
 void
@@ -27,6 +27,7 @@
 #include "DYNNetworkComponent.h"
 
 namespace DYN {
+class BranchInjections;
 class ModelBus;
 class LineInterface;
 class ModelCurrentLimits;
@@ -129,6 +130,13 @@ class ModelLine : public NetworkComponent {
    */
   void evalNodeInjection() override;
 
+  /**
+   * @brief add the line to the node injections of the static branches, computed together by the network
+   * @param branchInjections node injections of the static branches
+   * @return @b true if the line was added, @b false if its node injection has to be evaluated by evalNodeInjection
+   */
+  bool addToBranchInjections(BranchInjections& branchInjections);
+
   /**
    * @brief  add bus neighbors
    *
@@ -397,100 +405,24 @@ class ModelLine : public NetworkComponent {
   double i2(double ur1, double ui1, double ur2, double ui2) const;
 
   /**
-   * @brief get the partial derivative of ir1 with respect to Ur1
-   * @return the partial derivative of ir1 with respect to Ur1
-   */
-  double ir1_dUr1() const;
-
-  /**
-   * @brief get the partial derivative of ir1 with respect to Ui1
-   * @return the partial derivative of ir1 with respect to Ui1
-   */
-  double ir1_dUi1() const;
-
-  /**
-   * @brief get the partial derivative of ir1 with respect to Ur2
-   * @return the partial derivative of ir1 with respect to Ur2
-   */
-  double ir1_dUr2() const;
-
-  /**
-   * @brief get the partial derivative of ir1 with respect to Ui2
-   * @return the partial derivative of ir1 with respect to Ui2
-   */
-  double ir1_dUi2() const;
-
-  /**
-   * @brief get the partial derivative of ii1 with respect to Ur1
-   * @return the partial derivative of ii1 with respect to Ur1
-   */
-  double ii1_dUr1() const;
-
-  /**
-   * @brief get the partial derivative of ii1 with respect to Ui1
-   * @return the partial derivative of ii1 with respect to Ui1
-   */
-  double ii1_dUi1() const;
-
-  /**
-   * @brief get the partial derivative of ii1 with respect to Ur2
-   * @return the partial derivative of ii1 with respect to Ur2
+   * @brief compute the admittance terms of the line closed on both sides
    */
-  double ii1_dUr2() const;
+  void evalYMatClosed();
 
   /**
-   * @brief get the partial derivative of ii1 with respect to Ui2
-   * @return the partial derivative of ii1 with respect to Ui2
+   * @brief compute the admittance terms of the line only closed on side 1
    */
-  double ii1_dUi2() const;
+  void evalYMatClosedSide1();
 
   /**
-   * @brief get the partial derivative of ir2 with respect to Ur1
-   * @return the partial derivative of ir2 with respect to Ur1
+   * @brief compute the admittance terms of the line only closed on side 2
    */
-  double ir2_dUr1() const;
+  void evalYMatClosedSide2();
 
   /**
-   * @brief get the partial derivative of ir2 with respect to Ui1
-   * @return the partial derivative of ir2 with respect to Ui1
+   * @brief set all the admittance terms to zero
    */
-  double ir2_dUi1() const;
-
-  /**
-   * @brief get the partial derivative of ir2 with respect to Ur2
-   * @return the partial derivative of ir2 with respect to Ur2
-   */
-  double ir2_dUr2() const;
-
-  /**
-   * @brief get the partial derivative of ir2 with respect to Ui2
-   * @return the partial derivative of ir2 with respect to Ui2
-   */
-  double ir2_dUi2() const;
-
-  /**
-   * @brief get the partial derivative of ii2 with respect to Ur1
-   * @return the partial derivative of ii2 with respect to Ur1
-   */
-  double ii2_dUr1() const;
-
-  /**
-   * @brief get the partial derivative of ii2 with respect to Ui1
-   * @return the partial derivative of ii2 with respect to Ui1
-   */
-  double ii2_dUi1() const;
-
-  /**
-   * @brief get the partial derivative of ii2 with respect to Ur2
-   * @return the partial derivative of ii2 with respect to Ur2
-   */
-  double ii2_dUr2() const;
-
-  /**
-   * @brief get the partial derivative of ii2 with respect to Ui2
-   * @return the partial derivative of ii2 with respect to Ui2
-   */
-  double ii2_dUi2() const;
+  void resetYMat();
 
   /**
    * @brief get the real part of the voltage at side 1
@@ -540,6 +472,11 @@ class ModelLine : public NetworkComponent {
    */
   double uip2() const;
 
+  /**
+   * @brief copy the admittance terms of the line in the node injections of the static branches, if it belongs to them
+   */
+  void updateBranchInjections() const;
+
   /**
    * @brief compute the global Y index inside the Y matrix
    * @param localIndex the local variable index inside the model
@@ -596,6 +533,8 @@ class ModelLine : public NetworkComponent {
 
   double omegaNom_;  ///< nominal angular frequency
   double omegaRef_;  ///< reference angular frequency in pu
+  BranchInjections* branchInjections_;  ///< node injections of the static branches the line belongs to, nullptr if none
+  unsigned int branchIndex_;  ///< index of the line in the node injections of the static branches
   const std::string modelType_;  ///< model Type
 };
 }  // namespace DYN
@@ -32,6 +32,7 @@
 #include "DYNSparseMatrix.h"
 #include "DYNVariableForModel.h"
 #include "DYNDerivative.h"
+#include "DYNLoadInjections.h"
 #include "DYNLoadInterface.h"
 #include "DYNBusInterface.h"
 #include "DYNModelConstants.h"
@@ -85,7 +86,10 @@ DeltaPcYNum_(0),
 DeltaQcYNum_(0),
 zPYNum_(0),
 zQYNum_(0),
-startingPointMode_(WARM) {
+startingPointMode_(WARM),
+loadInjections_(nullptr),
+loadGroup_(0),
+loadIndex_(0) {
   connectionState_ = load->getInitialConnected() ? CLOSED : OPEN;
 }
 
@@ -246,6 +250,7 @@ ModelLoad::init(int& yNum) {
     ir0_ = 0.;
     ii0_ = 0.;
   }
+  updateLoadInjections();
   if (!network_->isInitModel()) {
     assert(yNum >= 0);
     yOffset_ = static_cast<unsigned int>(yNum);
@@ -520,6 +525,31 @@ ModelLoad::evalNodeInjection() {
   }
 }
 
+void
+ModelLoad::setConnected(const State state) {
+  connectionState_ = state;
+  updateLoadInjections();
+}
+
+bool
+ModelLoad::addToLoadInjections(LoadInjections& loadInjections) {
+  loadInjections_ = nullptr;
+  // the powers of the static loads only depend on the voltage of their bus
+  if (isRestorative_ || isPControllable_ || isQControllable_ || isControllable_)
+    return false;
+  loadInjections.addLoad(modelBus_.get(), alpha_, beta_, loadGroup_, loadIndex_);
+  loadInjections_ = &loadInjections;
+  updateLoadInjections();
+  return true;
+}
+
+void
+ModelLoad::updateLoadInjections() const {
+  if (!loadInjections_)
+    return;
+  loadInjections_->setLoad(loadGroup_, loadIndex_, P0_, Q0_, kp_, kq_, isConnected());
+}
+
 void
 ModelLoad::evalDerivatives(const double /*cj*/) {
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
@@ -29,6 +29,7 @@
 
 namespace DYN {
 class LoadInterface;
+class LoadInjections;
 
 /**
  * @brief Load component
@@ -58,15 +59,20 @@ class ModelLoad : public NetworkComponent {
    * @brief set the load connection status
    * @param state load connection status
    */
-  void setConnected(const State state) {
-    connectionState_ = state;
-  }  // set the load connection status
+  void setConnected(State state);
 
   /**
    * @brief evaluate node injection
    */
   void evalNodeInjection() override;
 
+  /**
+   * @brief add the load to the node injections of the static loads, computed together by the network
+   * @param loadInjections node injections of the static loads
+   * @return @b true if the load was added, @b false if its node injection has to be evaluated by evalNodeInjection
+   */
+  bool addToLoadInjections(LoadInjections& loadInjections);
+
   /**
    * @brief evaluate derivatives
    * @param cj Jacobian prime coefficient
@@ -392,6 +398,11 @@ class ModelLoad : public NetworkComponent {
    */
   void getI(double ur, double ui, double U, double U2, double& ir, double& ii) const;  // compute the real current
 
+  /**
+   * @brief copy the powers and the connection status of the load in the node injections of the static loads, if it belongs to them
+   */
+  void updateLoadInjections() const;
+
   /**
    * @brief compute value
    * @param ur real part of the voltage
@@ -547,6 +558,9 @@ class ModelLoad : public NetworkComponent {
   unsigned int zPYNum_;  ///< local Y index for zP
   unsigned int zQYNum_;  ///< local Y index for zQ
   startingPointMode_t startingPointMode_;  ///< type of starting point for the model (FLAT,WARM)
+  LoadInjections* loadInjections_;  ///< node injections of the static loads the load belongs to, nullptr if none
+  unsigned int loadGroup_;  ///< group of the load in loadInjections_
+  unsigned int loadIndex_;  ///< index of the load in its group of loadInjections_
 };  ///< class for Load model
 
 }  // namespace DYN
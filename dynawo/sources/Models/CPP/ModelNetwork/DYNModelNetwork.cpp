@@ -49,6 +49,15 @@
 #include "DYNModelPhaseTapChanger.h"
 #include "DYNModelHvdcLink.h"
 #include "DYNModelVoltageLevel.h"
+#include "DYNBranchInjections.h"
+#include "DYNLoadInjections.h"
+#include "DYNShuntInjections.h"
+#include "DYNHvdcInjections.h"
+#include "DYNNetworkReduction.h"
+#include "DYNSwitchCollapsing.h"
+#include "DYNStarBusElimination.h"
+#include "DYNStudyArea.h"
+#include "DYNModelNetworkEquivalent.h"
 
 #include "DYNNetworkInterface.h"
 #include "DYNDataInterface.h"
@@ -73,6 +82,7 @@
 #include "DYNMacrosMessage.h"
 #include "DYNTrace.h"
 #include "DYNTimer.h"
+#include "DYNProfiler.h"
 #include "DYNElement.h"
 #include "DYNSolverKINSubModel.h"
 
@@ -123,13 +133,31 @@ extern "C" void DYN::ModelNetworkFactory::destroy(DYN::SubModel* model) const {
 
 namespace DYN {
 
+/**
+ * @brief trace a branch left out of the network model by the study area
+ * @param studyArea study area
+ * @param id id of the branch
+ */
+static void
+traceBranchLeftOut(const StudyArea& studyArea, const string& id) {
+  if (studyArea.isBoundaryBranch(id))
+    Trace::debug(Trace::network()) << DYNLog(BranchOnStudyAreaBoundary, id) << Trace::endline;
+  else
+    Trace::debug(Trace::network()) << DYNLog(BranchOutsideStudyArea, id) << Trace::endline;
+}
+
 ModelNetwork::ModelNetwork() :
 ModelCPP("NETWORK"),
 calculatedVarBuffer_(NULL),
 isInit_(false) ,
 isInitModel_(false),
-withNodeBreakerTopology_(false) {
+withNodeBreakerTopology_(false),
+useAdmittanceMatrix_(false) {
   busContainer_.reset(new ModelBusContainer());
+  branchInjections_.reset(new BranchInjections());
+  loadInjections_.reset(new LoadInjections());
+  shuntInjections_.reset(new ShuntInjections());
+  hvdcInjections_.reset(new HvdcInjections());
 }
 
 ModelNetwork::~ModelNetwork() {
@@ -151,8 +179,29 @@ ModelNetwork::initializeFromData(const shared_ptr<DataInterface>& data) {
   map<string, std::shared_ptr<VscConverterInterface> > vscs;
   map<string, std::shared_ptr<LccConverterInterface> > lccs;
 
+  // passive part of the reduced voltage levels replaced by an equivalent
+  std::unique_ptr<NetworkReduction> reduction;
+  if (!data->getReducedVoltageLevels().empty())
+    reduction.reset(new NetworkReduction(network, data->getReducedVoltageLevels()));
+  // closed switches of the collapsed voltage levels removed, the buses they join being merged
+  std::unique_ptr<SwitchCollapsing> collapsing;
+  if (!data->getCollapsedVoltageLevels().empty())
+    collapsing.reset(new SwitchCollapsing(network, data->getCollapsedVoltageLevels()));
+  // star buses of the static three windings transformers replaced by an equivalent between their three buses
+  std::unique_ptr<StarBusElimination> starBusElimination;
+  if (data->getEliminateStarBuses())
+    starBusElimination.reset(new StarBusElimination(network));
+  // only the voltage levels around the study voltage levels modelled, the boundary branches replaced by their flows
+  std::unique_ptr<StudyArea> studyArea;
+  if (!data->getStudyVoltageLevels().empty())
+    studyArea.reset(new StudyArea(network, data->getStudyVoltageLevels(), data->getStudyAreaDepth()));
+
   for (const auto& voltageLevel : network->getVoltageLevels()) {
     const string& voltageLevelId = voltageLevel->getID();
+    if (studyArea && !studyArea->isInside(voltageLevelId)) {
+      Trace::debug(Trace::network()) << DYNLog(VoltageLevelOutsideStudyArea, voltageLevelId) << Trace::endline;
+      continue;
+    }
     Trace::debug(Trace::network()) << DYNLog(AddingVoltageLevelToNetwork, voltageLevelId) << Trace::endline;
     std::shared_ptr<ModelVoltageLevel> modelVoltageLevel(new ModelVoltageLevel(voltageLevel));
     std::shared_ptr<ModelVoltageLevel> modelVoltageLevelInit(new ModelVoltageLevel(voltageLevel));
@@ -170,8 +219,12 @@ ModelNetwork::initializeFromData(const shared_ptr<DataInterface>& data) {
     // ==============================
     for (const auto& bus : voltageLevel->getBuses()) {
       string id = bus->getID();
-      std::shared_ptr<ModelBus> modelBus(new ModelBus(bus, voltageLevel->isNodeBreakerTopology()));
       componentsById[id] = bus;
+      if (collapsing && collapsing->isMergedBus(id)) {
+        Trace::debug(Trace::network()) << DYNLog(BusMerged, id, collapsing->getRepresentative(id)) << Trace::endline;
+        continue;
+      }
+      std::shared_ptr<ModelBus> modelBus(new ModelBus(bus, voltageLevel->isNodeBreakerTopology()));
       modelBusById[id] = modelBus;
       // Add to containers
       modelVoltageLevelInit->addBus(modelBus);
@@ -181,6 +234,16 @@ ModelNetwork::initializeFromData(const shared_ptr<DataInterface>& data) {
         Trace::debug(Trace::network()) << DYNLog(BusExtDynModel, id) << Trace::endline;
         continue;
       }
+      if (reduction && reduction->isEliminatedBus(id)) {
+        Trace::debug(Trace::network()) << DYNLog(BusReduced, id) << Trace::endline;
+        reducedBuses_.push_back(modelBus);
+        continue;
+      }
+      if (starBusElimination && starBusElimination->isEliminatedBus(id)) {
+        Trace::debug(Trace::network()) << DYNLog(StarBusEliminated, id) << Trace::endline;
+        reducedBuses_.push_back(modelBus);
+        continue;
+      }
       Trace::debug(Trace::network()) << DYNLog(AddingBusToNetwork, id) << Trace::endline;
       modelVoltageLevel->addBus(modelBus);
       busContainer_->add(modelBus);
@@ -188,6 +251,18 @@ ModelNetwork::initializeFromData(const shared_ptr<DataInterface>& data) {
       data->setReference("v", id, id, "U_value");
       data->setReference("angle", id, id, "phi_value");
     }
+    if (collapsing) {
+      // the components of a merged bus are connected to the bus representing it
+      for (const auto& bus : voltageLevel->getBuses()) {
+        const string& id = bus->getID();
+        if (!collapsing->isMergedBus(id))
+          continue;
+        const string& representative = collapsing->getRepresentative(id);
+        modelBusById[id] = modelBusById[representative];
+        data->setReference("v", id, representative, "U_value");
+        data->setReference("angle", id, representative, "phi_value");
+      }
+    }
 
     // =============================
     //    CREATE SWITCH MODEL
@@ -195,6 +270,10 @@ ModelNetwork::initializeFromData(const shared_ptr<DataInterface>& data) {
     for (const auto& aSwitch : voltageLevel->getSwitches()) {
       string id = aSwitch->getID();
       componentsById[id] = aSwitch;
+      if (collapsing && collapsing->isCollapsedSwitch(id)) {
+        Trace::debug(Trace::network()) << DYNLog(SwitchCollapsed, id) << Trace::endline;
+        continue;
+      }
       std::shared_ptr<ModelSwitch> modelSwitch(new ModelSwitch(aSwitch));
 
       modelSwitch->setNetwork(this);
@@ -358,6 +437,10 @@ ModelNetwork::initializeFromData(const shared_ptr<DataInterface>& data) {
   // =============================
   for (const auto& line : network->getLines()) {
     string id = line->getID();
+    if (studyArea && !studyArea->isModelledBranch(id)) {
+      traceBranchLeftOut(*studyArea, id);
+      continue;
+    }
     componentsById[id] = line;
     std::shared_ptr<ModelLine> modelLine(new ModelLine(line));
     modelLine->setNetwork(this);
@@ -376,6 +459,10 @@ ModelNetwork::initializeFromData(const shared_ptr<DataInterface>& data) {
       Trace::debug(Trace::network()) << DYNLog(LineExtDynModel, id) << Trace::endline;
       continue;
     }
+    if (reduction && reduction->isEliminatedLine(id)) {
+      Trace::debug(Trace::network()) << DYNLog(LineReduced, id) << Trace::endline;
+      continue;
+    }
 
     Trace::debug(Trace::network()) << DYNLog(AddingLineToNetwork, id) << Trace::endline;
     // add to containers
@@ -388,12 +475,57 @@ ModelNetwork::initializeFromData(const shared_ptr<DataInterface>& data) {
     data->setReference("state", id, id, "state_value");
   }
 
+  if (collapsing && collapsing->nbCollapsedSwitches() > 0)
+    Trace::info(Trace::network()) << DYNLog(NetworkSwitchesCollapsed, collapsing->nbCollapsedSwitches(), collapsing->nbMergedBuses()) << Trace::endline;
+
+  // =================================
+  //    CREATE NETWORK EQUIVALENT MODEL
+  // =================================
+  if (reduction && reduction->nbEliminatedLines() > 0) {
+    vector<std::shared_ptr<ModelBus> > boundaryBuses;
+    for (const auto& id : reduction->getBoundaryBuses())
+      boundaryBuses.push_back(modelBusById[id]);
+    std::shared_ptr<ModelNetworkEquivalent> modelNetworkEquivalent(new ModelNetworkEquivalent(boundaryBuses, reduction->getAdmittances()));
+    modelNetworkEquivalent->setNetwork(this);
+    components_.push_back(modelNetworkEquivalent);
+    Trace::info(Trace::network()) << DYNLog(NetworkReduced, reduction->nbEliminatedBuses(), reduction->nbEliminatedLines(),
+        reduction->getBoundaryBuses().size()) << Trace::endline;
+  }
+  if (starBusElimination && starBusElimination->nbEliminatedBuses() > 0) {
+    vector<std::shared_ptr<ModelBus> > boundaryBuses;
+    for (const auto& id : starBusElimination->getBoundaryBuses())
+      boundaryBuses.push_back(modelBusById[id]);
+    std::shared_ptr<ModelNetworkEquivalent> modelNetworkEquivalent(new ModelNetworkEquivalent(boundaryBuses, starBusElimination->getAdmittances()));
+    modelNetworkEquivalent->setNetwork(this);
+    components_.push_back(modelNetworkEquivalent);
+    Trace::info(Trace::network()) << DYNLog(NetworkStarBusesEliminated, starBusElimination->nbEliminatedBuses(),
+        starBusElimination->getBoundaryBuses().size()) << Trace::endline;
+  }
+  if (studyArea) {
+    if (studyArea->nbBoundaryBranches() > 0) {
+      // the boundary flows are drawn in the initialization model too, the buses of the area being shared
+      vector<std::shared_ptr<ModelBus> > boundaryBuses;
+      for (const auto& id : studyArea->getBoundaryBuses())
+        boundaryBuses.push_back(modelBusById[id]);
+      std::shared_ptr<ModelNetworkEquivalent> modelNetworkEquivalent(new ModelNetworkEquivalent(boundaryBuses, studyArea->getAdmittances()));
+      modelNetworkEquivalent->setNetwork(this);
+      components_.push_back(modelNetworkEquivalent);
+      initComponents_.push_back(modelNetworkEquivalent);
+    }
+    Trace::info(Trace::network()) << DYNLog(NetworkStudyArea, studyArea->nbInsideVoltageLevels(), network->getVoltageLevels().size(),
+        studyArea->nbBoundaryBranches()) << Trace::endline;
+  }
+
   // =================================
   //    CREATE 2WTfo  MODEL
   // =================================
   vector<std::shared_ptr<ModelTwoWindingsTransformer> > modelsTfo;
   for (const auto& twoWTfo : network->getTwoWTransformers()) {
     string id = twoWTfo->getID();
+    if (studyArea && !studyArea->isModelledBranch(id)) {
+      traceBranchLeftOut(*studyArea, id);
+      continue;
+    }
     componentsById[id] = twoWTfo;
     std::shared_ptr<ModelTwoWindingsTransformer> modelTwoWindingsTransformer(new ModelTwoWindingsTransformer(twoWTfo));
     modelsTfo.push_back(modelTwoWindingsTransformer);
@@ -414,6 +546,10 @@ ModelNetwork::initializeFromData(const shared_ptr<DataInterface>& data) {
       Trace::debug(Trace::network()) << DYNLog(TwoWTfoExtDynModel, id) << Trace::endline;
       continue;
     }
+    if (starBusElimination && starBusElimination->isEliminatedTransformer(id)) {
+      Trace::debug(Trace::network()) << DYNLog(TwoWTfoStarBusEliminated, id) << Trace::endline;
+      continue;
+    }
     Trace::debug(Trace::network()) << DYNLog(AddingTwoWTfoToNetwork, id) << Trace::endline;
 
     // add to containers
@@ -437,6 +573,10 @@ ModelNetwork::initializeFromData(const shared_ptr<DataInterface>& data) {
   // =================================
   for (const auto& threeWTfo : network->getThreeWTransformers()) {
     string id = threeWTfo->getID();
+    if (studyArea && !studyArea->isModelledBranch(id)) {
+      traceBranchLeftOut(*studyArea, id);
+      continue;
+    }
     componentsById[id] = threeWTfo;
     std::shared_ptr<ModelThreeWindingsTransformer> modelThreeWindingsTransformer(new ModelThreeWindingsTransformer(threeWTfo));
     modelThreeWindingsTransformer->setNetwork(this);
@@ -493,8 +633,12 @@ ModelNetwork::initializeFromData(const shared_ptr<DataInterface>& data) {
         continue;
       string side = modelTfo->getSide();
       map<string, std::shared_ptr<ComponentInterface> >::const_iterator iComponent = componentsById.find(terminalRefId);
-      if (iComponent == componentsById.end())
+      if (iComponent == componentsById.end()) {
+        // the monitored terminal may be left out of the study area
+        if (studyArea)
+          continue;
         throw DYNError(Error::MODELER, UnknownComponent, terminalRefId);
+      }
 
       std::shared_ptr<BusInterface> busInterface;
       switch (iComponent->second->getType()) {
@@ -559,8 +703,9 @@ ModelNetwork::initializeFromData(const shared_ptr<DataInterface>& data) {
           break;
       }
       if (busInterface) {
-        std::shared_ptr<ModelBus> modelBus = modelBusById[busInterface->getID()];
-        modelTfo->setBusMonitored(modelBus);
+        map<string, std::shared_ptr<ModelBus> >::const_iterator iModelBus = modelBusById.find(busInterface->getID());
+        if (iModelBus != modelBusById.end())
+          modelTfo->setBusMonitored(iModelBus->second);
       }
     }
   }
@@ -570,6 +715,10 @@ ModelNetwork::initializeFromData(const shared_ptr<DataInterface>& data) {
   // =============================
   for (const auto&  hvdcLine : network->getHvdcLines()) {
     string id = hvdcLine->getID();
+    if (studyArea && !studyArea->isModelledBranch(id)) {
+      traceBranchLeftOut(*studyArea, id);
+      continue;
+    }
     string idVsc1 = hvdcLine->getIdConverter1();
     string idVsc2 = hvdcLine->getIdConverter2();
 
@@ -802,13 +951,13 @@ ModelNetwork::computeComponents(const double t) {
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
   Timer timer1("ModelNetwork::computeComponents");
 #endif
-  busContainer_->resetSubNetwork();
+  busContainer_->resetNeighbors();
 
   for (const auto& component : getComponents())
     component->addBusNeighbors();
 
-  // connectivity calculation
-  busContainer_->exploreNeighbors(t);
+  // connectivity calculation, only the sub-networks whose buses have different neighbors are explored again
+  busContainer_->updateSubNetworks(t);
 }
 
 void
@@ -964,16 +1113,35 @@ ModelNetwork::evalF(double /*t*/, const propertyF_t type) {
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
   Timer timer("ModelNetwork::evalF");
 #endif
+  ProfilerScope profilerScope(Profiler::NETWORK);
 
   if (type != DIFFERENTIAL_EQ) {
     // compute nodal current injections (convention: > 0 if the current goes out of the node)
     busContainer_->resetInjections();
+    if (isInitModel_) {
+      // the reduced buses are only in the init model
+      for (const auto& bus : reducedBuses_) {
+        bus->resetNodeInjection();
+        bus->resetCurrentUStatus();
+      }
+    }
 
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
     Timer* timer2 = new Timer("ModelNetwork::evalF_evalNodeInjection");
 #endif
-    for (const auto& component : getComponents())
-      component->evalNodeInjection();
+    if (isInitModel_) {
+      for (const auto& component : getComponents())
+        component->evalNodeInjection();
+    } else {
+      for (const auto& transformer : branchTransformers_)
+        transformer->applyStep();
+      branchInjections_->evalNodeInjection();
+      loadInjections_->evalNodeInjection();
+      shuntInjections_->evalNodeInjection();
+      hvdcInjections_->evalNodeInjection();
+      for (const auto& component : injectionComponents_)
+        component->evalNodeInjection();
+    }
 
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
     delete timer2;
@@ -996,8 +1164,11 @@ ModelNetwork::evalG(const double t) {
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
   Timer timer3("ModelNetwork::evalG");
 #endif
-  for (const auto& component : getComponents())
-    component->evalG(t);
+  ProfilerScope profilerScope(Profiler::NETWORK);
+  for (const auto& component : getComponents()) {
+    if (component->sizeG() > 0)
+      component->evalG(t);
+  }
 }
 
 void
@@ -1078,12 +1249,17 @@ ModelNetwork::evalJt(const double /*t*/, const double cj, const int rowOffset, S
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
   Timer timer("ModelNetwork::evalJ");
 #endif
+  ProfilerScope profilerScope(Profiler::NETWORK);
 
-  // init bus derivatives
+  // init bus derivatives, from the saved Jacobian terms of the static branches if they did not change since the last evaluation
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
   Timer* timer2 = new Timer("ModelNetwork::evalJt_initBusDerivatives");
 #endif
-  busContainer_->initDerivatives();
+  const bool branchDerivativesCached = !isInitModel_ && branchInjections_->derivativesCached();
+  if (branchDerivativesCached)
+    busContainer_->restoreDerivatives();
+  else
+    busContainer_->initDerivatives();
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
   delete timer2;
 #endif
@@ -1092,8 +1268,27 @@ ModelNetwork::evalJt(const double /*t*/, const double cj, const int rowOffset, S
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
   Timer* timer3 = new Timer("ModelNetwork::evalJt_evalDerivatives");
 #endif
-  for (const auto& component : getComponents())
-    component->evalDerivatives(cj);
+  if (isInitModel_) {
+    for (const auto& component : getComponents())
+      component->evalDerivatives(cj);
+  } else {
+    if (!branchDerivativesCached) {
+      // the Jacobian terms of the static branches only change with their admittances: they are added first and saved
+      if (branchInjections_->useAdmittanceMatrix()) {
+        branchInjections_->evalDerivatives();
+      } else {
+        for (const auto& component : branchComponents_)
+          component->evalDerivatives(cj);
+      }
+      busContainer_->saveDerivatives();
+      branchInjections_->setDerivativesCached();
+    }
+    loadInjections_->evalDerivatives();
+    shuntInjections_->evalDerivatives();
+    hvdcInjections_->evalDerivatives();
+    for (const auto& component : injectionComponents_)
+      component->evalDerivatives(cj);
+  }
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
   delete timer3;
 #endif
@@ -1147,6 +1342,8 @@ ModelNetwork::getY0() {
   isInit_ = true;
 
   busContainer_->resetNodeInjections();
+  for (const auto& bus : reducedBuses_)
+    bus->resetNodeInjection();
 
   for (const auto& component : getComponents())
     component->evalNodeInjection();
@@ -1156,6 +1353,8 @@ ModelNetwork::getY0() {
   }
 
   busContainer_->resetCurrentUStatus();
+  for (const auto& bus : reducedBuses_)
+    bus->resetCurrentUStatus();
   isInit_ = false;
 }
 
@@ -1165,6 +1364,7 @@ ModelNetwork::initParams() {
     isInitModel_ = false;
     vLevelInitComponents_.clear();
     initComponents_.clear();
+    reducedBuses_.clear();
     return;
   }
 
@@ -1194,6 +1394,7 @@ ModelNetwork::initParams() {
 
   vLevelInitComponents_.clear();
   initComponents_.clear();
+  reducedBuses_.clear();
   solver.clean();
   isInitModel_ = false;
 }
@@ -1226,6 +1427,7 @@ ModelNetwork::defineParameters(vector<ParameterModeler>& parameters) {
   ModelTwoWindingsTransformer::defineParameters(parameters);
   ModelHvdcLink::defineParameters(parameters);
   parameters.push_back(ParameterModeler("startingPointMode", VAR_TYPE_STRING, EXTERNAL_PARAMETER));
+  parameters.push_back(ParameterModeler("useAdmittanceMatrix", VAR_TYPE_BOOL, EXTERNAL_PARAMETER));
 
   for (const auto& component : getComponents()) {
     component->defineNonGenericParameters(parameters);
@@ -1294,6 +1496,8 @@ void
 ModelNetwork::setSubModelParameters() {
   for (const auto& component : getComponents())
     component->setSubModelParameters(parametersDynamic_);
+  const ParameterModeler& useAdmittanceMatrix = findParameterDynamic("useAdmittanceMatrix");
+  useAdmittanceMatrix_ = useAdmittanceMatrix.hasValue() && useAdmittanceMatrix.getValue<bool>();
 }
 
 void
@@ -1312,6 +1516,7 @@ ModelNetwork::init(const double t0) {
   computeComponents(t0);
   analyseComponents();
 
+  initBranchInjections();
   evalYMat();
   /*
    * Determine which switch can break a loop in a voltage level or a node
@@ -1320,6 +1525,43 @@ ModelNetwork::init(const double t0) {
   breakModelSwitchLoops();
 }
 
+void
+ModelNetwork::initBranchInjections() {
+  branchInjections_->clear();
+  loadInjections_->clear();
+  shuntInjections_->clear();
+  hvdcInjections_->clear();
+  branchTransformers_.clear();
+  branchComponents_.clear();
+  injectionComponents_.clear();
+  for (const auto& component : components_) {
+    bool isBranch = false;
+    bool isInjection = false;
+    if (const auto line = std::dynamic_pointer_cast<ModelLine>(component)) {
+      isBranch = line->addToBranchInjections(*branchInjections_);
+    } else if (const auto transformer = std::dynamic_pointer_cast<ModelTwoWindingsTransformer>(component)) {
+      isBranch = transformer->addToBranchInjections(*branchInjections_);
+      branchTransformers_.push_back(transformer);
+    } else if (const auto load = std::dynamic_pointer_cast<ModelLoad>(component)) {
+      isInjection = load->addToLoadInjections(*loadInjections_);
+    } else if (const auto shunt = std::dynamic_pointer_cast<ModelShuntCompensator>(component)) {
+      shunt->addToShuntInjections(*shuntInjections_);
+      isInjection = true;
+    } else if (const auto svc = std::dynamic_pointer_cast<ModelStaticVarCompensator>(component)) {
+      svc->addToShuntInjections(*shuntInjections_);
+      isInjection = true;
+    } else if (const auto hvdc = std::dynamic_pointer_cast<ModelHvdcLink>(component)) {
+      isInjection = hvdc->addToHvdcInjections(*hvdcInjections_);
+    }
+    if (isBranch)
+      branchComponents_.push_back(component);
+    else if (!isInjection)
+      injectionComponents_.push_back(component);
+  }
+  if (useAdmittanceMatrix_)
+    branchInjections_->assembleAdmittanceMatrix();
+}
+
 void
 ModelNetwork::breakModelSwitchLoops() {
   busContainer_->initRefIslands();
@@ -1397,8 +1639,10 @@ ModelNetwork::printInternalParameters(std::ofstream& fstream) const {
 }
 
 void
-ModelNetwork::dumpInternalVariables(boost::archive::binary_oarchive&) const {
-  // not needed
+ModelNetwork::dumpInternalVariables(boost::archive::binary_oarchive& streamVariables) const {
+  // only used by the in-memory snapshots: the dump writes the internal variables with the variables of each component
+  for (const auto& component : getComponents())
+    component->dumpInternalVariables(streamVariables);
 }
 
 void
@@ -1486,8 +1730,10 @@ ModelNetwork::loadVariables(const string& variables) {
 }
 
 void
-ModelNetwork::loadInternalVariables(boost::archive::binary_iarchive&) {
-  // not needed
+ModelNetwork::loadInternalVariables(boost::archive::binary_iarchive& streamVariables) {
+  // only used by the in-memory snapshots: the dump reads the internal variables with the variables of each component
+  for (const auto& component : getComponents())
+    component->loadInternalVariables(streamVariables);
 }
 
 }  // namespace DYN
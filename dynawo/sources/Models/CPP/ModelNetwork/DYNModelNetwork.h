@@ -30,8 +30,14 @@
 #include "DYNSubModelFactory.h"
 
 namespace DYN {
+class BranchInjections;
+class HvdcInjections;
+class LoadInjections;
+class ShuntInjections;
+class ModelBus;
 class ModelBusContainer;
 class ModelSwitch;
+class ModelTwoWindingsTransformer;
 class ModelVoltageLevel;
 class NetworkComponent;
 class DataInterface;
@@ -339,6 +345,11 @@ class ModelNetwork : public ModelCPP, private boost::noncopyable {
    */
   void breakModelSwitchLoops();
 
+  /**
+   * @brief gather the static branches, the static loads, the susceptances and the hvdc links whose node injections are computed together
+   */
+  void initBranchInjections();
+
   /**
    * @brief scan through the AC network to find AC-connected components
    * @param t : time to use (only used for log purpose)
@@ -399,12 +410,21 @@ class ModelNetwork : public ModelCPP, private boost::noncopyable {
   bool isInit_;  ///< whether the current process is the initialization process
   bool isInitModel_;  ///< whether the current model used is the init one
   bool withNodeBreakerTopology_;  ///< whether at least one voltageLevel has node breaker topology view
+  bool useAdmittanceMatrix_;  ///< whether the static branches are evaluated with the admittance matrix of their buses
 
   std::unique_ptr<ModelBusContainer> busContainer_;  ///< all network buses
+  std::vector<std::shared_ptr<ModelBus> > reducedBuses_;  ///< buses replaced by the network equivalent, only used by the init model
   std::vector<std::shared_ptr<ModelVoltageLevel> > vLevelComponents_;  ///< all voltage level components
   std::vector<std::shared_ptr<ModelVoltageLevel> > vLevelInitComponents_;  ///< all voltage level components  (used for init model)
   std::vector<std::shared_ptr<NetworkComponent> > components_;  ///< all network components without dynamic Model
   std::vector<std::shared_ptr<NetworkComponent> > initComponents_;  ///< all network components even components with dynamic model
+  std::unique_ptr<BranchInjections> branchInjections_;  ///< node injections of the static branches, computed together
+  std::vector<std::shared_ptr<ModelTwoWindingsTransformer> > branchTransformers_;  ///< transformers of branchInjections_
+  std::vector<std::shared_ptr<NetworkComponent> > branchComponents_;  ///< components whose node injection is in branchInjections_
+  std::unique_ptr<LoadInjections> loadInjections_;  ///< node injections of the static loads, computed together
+  std::unique_ptr<ShuntInjections> shuntInjections_;  ///< node injections of the shunt and static var compensators, computed together
+  std::unique_ptr<HvdcInjections> hvdcInjections_;  ///< node injections of the hvdc links, computed together
+  std::vector<std::shared_ptr<NetworkComponent> > injectionComponents_;  ///< components whose node injection is not computed together with others
   std::vector<int> componentIndexByCalculatedVar_;  ///< index of component for each calculated variable
 };
 
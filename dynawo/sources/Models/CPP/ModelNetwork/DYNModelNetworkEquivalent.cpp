@@ -0,0 +1,105 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNModelNetworkEquivalent.cpp
+ *
+ * @brief Equivalent admittance matrix of the reduced part of the network
+ *
+ */
+#include "DYNModelNetworkEquivalent.h"
+#include "DYNModelBus.h"
+#include "DYNDerivative.h"
+#include "DYNMacrosMessage.h"
+
+using std::vector;
+
+namespace DYN {
+
+ModelNetworkEquivalent::ModelNetworkEquivalent(const vector<std::shared_ptr<ModelBus> >& buses,
+    const vector<NetworkReduction::Admittance>& admittances) :
+NetworkComponent("NetworkEquivalent"),
+buses_(buses) {
+  rows_.reserve(admittances.size());
+  columns_.reserve(admittances.size());
+  conductances_.reserve(admittances.size());
+  susceptances_.reserve(admittances.size());
+  for (const auto& admittance : admittances) {
+    rows_.push_back(admittance.row);
+    columns_.push_back(admittance.column);
+    conductances_.push_back(admittance.value.real());
+    susceptances_.push_back(admittance.value.imag());
+  }
+}
+
+void
+ModelNetworkEquivalent::initSize() {
+  sizeF_ = 0;
+  sizeY_ = 0;
+  sizeZ_ = 0;
+  sizeG_ = 0;
+  sizeMode_ = 0;
+  sizeCalculatedVar_ = 0;
+}
+
+void
+ModelNetworkEquivalent::evalNodeInjection() {
+  // I_i = sum_j (G_ij + j.B_ij) * U_j
+  for (unsigned int k = 0; k < rows_.size(); ++k) {
+    const ModelBus& column = *buses_[columns_[k]];
+    ModelBus& row = *buses_[rows_[k]];
+    const double ur = column.ur();
+    const double ui = column.ui();
+    row.irAdd(conductances_[k] * ur - susceptances_[k] * ui);
+    row.iiAdd(susceptances_[k] * ur + conductances_[k] * ui);
+  }
+}
+
+void
+ModelNetworkEquivalent::evalDerivatives(const double /*cj*/) {
+  for (unsigned int k = 0; k < rows_.size(); ++k) {
+    const int urYNum = buses_[columns_[k]]->urYNum();
+    const int uiYNum = buses_[columns_[k]]->uiYNum();
+    auto& derivatives = buses_[rows_[k]]->derivatives();
+    derivatives->addDerivative(IR_DERIVATIVE, urYNum, conductances_[k]);
+    derivatives->addDerivative(IR_DERIVATIVE, uiYNum, -susceptances_[k]);
+    derivatives->addDerivative(II_DERIVATIVE, urYNum, susceptances_[k]);
+    derivatives->addDerivative(II_DERIVATIVE, uiYNum, conductances_[k]);
+  }
+}
+
+void
+ModelNetworkEquivalent::addBusNeighbors() {
+  // the matrix is symmetric: each coupling term gives one direction of the link
+  for (unsigned int k = 0; k < rows_.size(); ++k) {
+    if (rows_[k] != columns_[k])
+      buses_[rows_[k]]->addNeighbor(buses_[columns_[k]]);
+  }
+}
+
+void
+ModelNetworkEquivalent::getIndexesOfVariablesUsedForCalculatedVarI(unsigned numCalculatedVar, vector<int>& /*numVars*/) const {
+  throw DYNError(Error::MODELER, UndefJCalculatedVarI, numCalculatedVar);
+}
+
+void
+ModelNetworkEquivalent::evalJCalculatedVarI(unsigned numCalculatedVar, vector<double>& /*res*/) const {
+  throw DYNError(Error::MODELER, UndefJCalculatedVarI, numCalculatedVar);
+}
+
+double
+ModelNetworkEquivalent::evalCalculatedVarI(unsigned numCalculatedVar) const {
+  throw DYNError(Error::MODELER, UndefCalculatedVarI, numCalculatedVar);
+}
+
+}  // namespace DYN
@@ -0,0 +1,230 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNModelNetworkEquivalent.h
+ *
+ * @brief Equivalent admittance matrix of the reduced part of the network
+ *
+ */
+#ifndef MODELS_CPP_MODELNETWORK_DYNMODELNETWORKEQUIVALENT_H_
+#define MODELS_CPP_MODELNETWORK_DYNMODELNETWORKEQUIVALENT_H_
+
+#include <vector>
+
+#include "DYNNetworkComponent.h"
+#include "DYNNetworkReduction.h"
+
+namespace DYN {
+class ModelBus;
+
+/**
+ * @brief Network equivalent model
+ *
+ * Static admittance matrix between the boundary buses of a network reduction: it injects at each boundary bus the
+ * current that the eliminated buses and lines would have injected. It has no variable and no equation of its own.
+ */
+class ModelNetworkEquivalent : public NetworkComponent {
+ public:
+  /**
+   * @brief default constructor
+   * @param buses models of the boundary buses, in the order of their index in the admittances
+   * @param admittances terms of the equivalent admittance matrix
+   */
+  ModelNetworkEquivalent(const std::vector<std::shared_ptr<ModelBus> >& buses, const std::vector<NetworkReduction::Admittance>& admittances);
+
+  /**
+   * @brief get the number of boundary buses
+   * @return number of boundary buses
+   */
+  inline unsigned int nbBuses() const {
+    return static_cast<unsigned int>(buses_.size());
+  }
+
+  /**
+   * @brief evaluate node injection
+   */
+  void evalNodeInjection() override;
+
+  /**
+   * @brief evaluate derivatives
+   * @param cj Jacobian prime coefficient
+   */
+  void evalDerivatives(double cj) override;
+
+  /**
+   * @brief evaluate derivatives prim
+   */
+  void evalDerivativesPrim() override { /* not needed */ }
+
+  /**
+   * @copydoc NetworkComponent::evalF()
+   */
+  void evalF(propertyF_t /*type*/) override { /* not needed */ }
+
+  /**
+   * @copydoc NetworkComponent::evalJt(double cj, int rowOffset, SparseMatrix& jt)
+   */
+  void evalJt(double /*cj*/, int /*rowOffset*/, SparseMatrix& /*jt*/) override { /* not needed */ }
+
+  /**
+   * @copydoc NetworkComponent::evalJtPrim(int rowOffset, SparseMatrix& jtPrim)
+   */
+  void evalJtPrim(int /*rowOffset*/, SparseMatrix& /*jtPrim*/) override { /* not needed */ }
+
+  /**
+   * @brief instantiate variables
+   * @param variables variables
+   */
+  void instantiateVariables(std::vector<boost::shared_ptr<Variable> >& /*variables*/) override { /* not needed */ }
+
+  /**
+   * @brief define non generic parameters
+   * @param parameters vector to fill with the non generic parameters
+   */
+  void defineNonGenericParameters(std::vector<ParameterModeler>& /*parameters*/) override { /* not needed */ }
+
+  /**
+   * @brief define elements
+   * @param elements vector of elements
+   * @param mapElement map of elements
+   */
+  void defineElements(std::vector<Element>& /*elements*/, std::map<std::string, int>& /*mapElement*/) override { /* not needed */ }
+
+  /**
+   * @copydoc NetworkComponent::evalZ()
+   */
+  NetworkComponent::StateChange_t evalZ(double /*t*/) override {
+    return NetworkComponent::NO_CHANGE;
+  }
+
+  /**
+   * @copydoc NetworkComponent::collectSilentZ()
+   */
+  void collectSilentZ(BitMask* /*silentZTable*/) override { /* not needed */ }
+
+  /**
+   * @brief evaluation G
+   * @param t time
+   */
+  void evalG(double /*t*/) override { /* not needed */ }
+
+  /**
+   * @brief evaluation of the calculated variables (for outputs)
+   */
+  void evalCalculatedVars() override { /* not needed */ }
+
+  /**
+   * @brief get the index of variables used to define the jacobian associated to a calculated variable
+   * @param numCalculatedVar : index of the calculated variable
+   * @param numVars : index of variables used to define the jacobian associated to the calculated variable
+   */
+  void getIndexesOfVariablesUsedForCalculatedVarI(unsigned numCalculatedVar, std::vector<int>& numVars) const override;
+
+  /**
+   * @brief evaluate the jacobian associated to a calculated variable
+   *
+   * @param numCalculatedVar index of the calculated variable
+   * @param res values of the jacobian
+   */
+  void evalJCalculatedVarI(unsigned numCalculatedVar, std::vector<double>& res) const override;
+
+  /**
+   * @brief evaluate the value of a calculated variable
+   *
+   * @param numCalculatedVar index of the calculated variable
+   *
+   * @return value of the calculated variable
+   */
+  double evalCalculatedVarI(unsigned numCalculatedVar) const override;
+
+  /**
+   * @copydoc NetworkComponent::evalStaticYType()
+   */
+  void evalStaticYType() override { /* not needed */ }
+
+  /**
+   * @copydoc NetworkComponent::evalDynamicYType()
+   */
+  void evalDynamicYType() override { /* not needed */ }
+
+  /**
+   * @copydoc NetworkComponent::evalStaticFType()
+   */
+  void evalStaticFType() override { /* not needed */ }
+
+  /**
+   * @copydoc NetworkComponent::evalDynamicFType()
+   */
+  void evalDynamicFType() override { /* not needed */ }
+
+  /**
+   * @copydoc NetworkComponent::evalYMat()
+   */
+  void evalYMat() override { /* not needed */ }
+
+  /**
+   * @copydoc NetworkComponent::init(int& yNum)
+   */
+  void init(int& /*yNum*/) override { /* not needed */ }
+
+  /**
+   * @copydoc NetworkComponent::getY0()
+   */
+  void getY0() override { /* not needed */ }
+
+  /**
+   * @copydoc NetworkComponent::setSubModelParameters(const std::unordered_map<std::string, ParameterModeler>& params)
+   */
+  void setSubModelParameters(const std::unordered_map<std::string, ParameterModeler>& /*params*/) override { /* not needed */ }
+
+  /**
+   * @copydoc NetworkComponent::setFequations( std::map<int,std::string>& fEquationIndex )
+   */
+  void setFequations(std::map<int, std::string>& /*fEquationIndex*/) override { /* not needed */ }
+
+  /**
+   * @copydoc NetworkComponent::setGequations( std::map<int,std::string>& gEquationIndex )
+   */
+  void setGequations(std::map<int, std::string>& /*gEquationIndex*/) override { /* not needed */ }
+
+  /**
+   * @brief evaluate state
+   * @param time time
+   * @return state change type
+   */
+  NetworkComponent::StateChange_t evalState(double /*time*/) override {
+    return NetworkComponent::NO_CHANGE;
+  }
+
+  /**
+   * @brief addBusNeighbors
+   */
+  void addBusNeighbors() override;
+
+  /**
+   * @brief init size
+   */
+  void initSize() override;
+
+ private:
+  std::vector<std::shared_ptr<ModelBus> > buses_;  ///< models of the boundary buses
+  std::vector<unsigned int> rows_;  ///< index of the bus where the current of each term is injected
+  std::vector<unsigned int> columns_;  ///< index of the bus whose voltage is used by each term
+  std::vector<double> conductances_;  ///< real part of each term of the admittance matrix (p.u.)
+  std::vector<double> susceptances_;  ///< imaginary part of each term of the admittance matrix (p.u.)
+};
+
+}  // namespace DYN
+
+#endif  // MODELS_CPP_MODELNETWORK_DYNMODELNETWORKEQUIVALENT_H_
@@ -27,6 +27,7 @@
 #include "DYNVariableForModel.h"
 #include "DYNParameter.h"
 #include "DYNDerivative.h"
+#include "DYNShuntInjections.h"
 #include "DYNShuntCompensatorInterface.h"
 #include "DYNBusInterface.h"
 #include "DYNModelConstants.h"
@@ -51,7 +52,9 @@ noReclosingDelay_(0.),
 stateModified_(false),
 ir0_(0.),
 ii0_(0.),
-startingPointMode_(WARM) {
+startingPointMode_(WARM),
+shuntInjections_(nullptr),
+shuntIndex_(0) {
   // init data
   currentSection_ = shunt->getCurrentSection();
   maximumSection_ = shunt->getMaximumSection();
@@ -149,6 +152,26 @@ ModelShuntCompensator::evalNodeInjection() {
   }
 }
 
+void
+ModelShuntCompensator::setConnected(const State state) {
+  connectionState_ = state;
+  updateShuntInjections();
+}
+
+void
+ModelShuntCompensator::addToShuntInjections(ShuntInjections& shuntInjections) {
+  shuntIndex_ = shuntInjections.addShunt(modelBus_.get(), false);
+  shuntInjections_ = &shuntInjections;
+  updateShuntInjections();
+}
+
+void
+ModelShuntCompensator::updateShuntInjections() const {
+  if (!shuntInjections_)
+    return;
+  shuntInjections_->setShunt(shuntIndex_, suscepPu_, isConnected());
+}
+
 void
 ModelShuntCompensator::evalYMat() {
   /* not needed */
@@ -269,7 +292,7 @@ ModelShuntCompensator::getY0() {
       } else {
         throw DYNError(Error::MODELER, UnsupportedComponentState, id_);
       }
-      connectionState_ = shuntCurrState;
+      setConnected(shuntCurrState);
       currentSection_ = static_cast<int>(z_[currentSectionNum_]);
     }
   }
@@ -294,6 +317,7 @@ ModelShuntCompensator::loadInternalVariables(boost::archive::binary_iarchive& st
   streamVariables >> suscepPu_;
   streamVariables >> c;
   streamVariables >> tLastOpening_;
+  updateShuntInjections();
 }
 
 bool
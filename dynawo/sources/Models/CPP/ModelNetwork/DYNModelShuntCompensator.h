@@ -29,6 +29,7 @@
 namespace DYN {
 class ModelBus;
 class ShuntCompensatorInterface;
+class ShuntInjections;
 
 /**
  * @brief Shunt compensator model
@@ -71,9 +72,7 @@ class ModelShuntCompensator : public NetworkComponent {
    * @brief set connection status
    * @param state connection status
    */
-  void setConnected(const State state) {
-    connectionState_ = state;
-  }
+  void setConnected(State state);
 
   /**
    * @brief set the bus to which the shunt is connected
@@ -87,6 +86,12 @@ class ModelShuntCompensator : public NetworkComponent {
    */
   void evalNodeInjection() override;
 
+  /**
+   * @brief add the shunt to the node injections of the susceptances, computed together by the network
+   * @param shuntInjections node injections of the susceptances
+   */
+  void addToShuntInjections(ShuntInjections& shuntInjections);
+
   /**
    * @brief evaluate derivatives
    * @param cj Jacobian prime coefficient
@@ -312,6 +317,11 @@ class ModelShuntCompensator : public NetworkComponent {
   void loadInternalVariables(boost::archive::binary_iarchive& streamVariables) override;
 
  private:
+  /**
+   * @brief copy the susceptance and the connection status of the shunt in the node injections of the susceptances, if it belongs to them
+   */
+  void updateShuntInjections() const;
+
   /**
    * @brief compute value
    * @param ui imaginary part of the voltage
@@ -382,6 +392,8 @@ class ModelShuntCompensator : public NetworkComponent {
   double ii0_;  ///< initial imaginary part of the current
   startingPointMode_t startingPointMode_;  ///< type of starting point for the model (FLAT,WARM)
   bool cannotBeDisconnected_;  ///< true if this shunt cannot be disconnected (due to closed not retained switches in node breaker)
+  ShuntInjections* shuntInjections_;  ///< node injections of the susceptances the shunt belongs to, nullptr if none
+  unsigned int shuntIndex_;  ///< index of the shunt in shuntInjections_
 };  ///< Generic model for Shunt compensator in network
 }  // namespace DYN
 
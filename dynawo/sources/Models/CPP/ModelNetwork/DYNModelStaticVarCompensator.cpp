@@ -29,6 +29,7 @@
 #include "DYNVariableForModel.h"
 #include "DYNParameter.h"
 #include "DYNDerivative.h"
+#include "DYNShuntInjections.h"
 #include "DYNBusInterface.h"
 #include "DYNModelConstants.h"
 #include "DYNModelNetwork.h"
@@ -47,7 +48,9 @@ ModelStaticVarCompensator::ModelStaticVarCompensator(const std::shared_ptr<Stati
 NetworkComponent(svc->getID()),
 svc_(svc),
 stateModified_(false),
-startingPointMode_(WARM) {
+startingPointMode_(WARM),
+shuntInjections_(nullptr),
+shuntIndex_(0) {
   // init data
   connectionState_ = svc->getInitialConnected() ? CLOSED : OPEN;
   mode_ = svc->getRegulationMode();
@@ -141,6 +144,7 @@ ModelStaticVarCompensator::init(int& /*yNum*/) {
     }
     gSvc0_ = gTotal0;
     bSvc0_ = bTotal0;
+    updateShuntInjections();
   }
 }
 
@@ -266,6 +270,7 @@ ModelStaticVarCompensator::loadInternalVariables(boost::archive::binary_iarchive
   streamVariables >> gSvc0_;
   streamVariables >> c;
   streamVariables >> bSvc0_;
+  updateShuntInjections();
 }
 
 NetworkComponent::StateChange_t
@@ -293,6 +298,7 @@ ModelStaticVarCompensator::evalZ(const double /*t*/) {
 
 void
 ModelStaticVarCompensator::collectSilentZ(BitMask* silentZTable) {
+  silentZTable[modeNum_].setFlags(NotUsedInDiscreteEquations | NotUsedInContinuousEquations);  // only exported
   silentZTable[connectionStateNum_].setFlags(NotUsedInDiscreteEquations);
 }
 
@@ -394,6 +400,26 @@ ModelStaticVarCompensator::evalNodeInjection() {
   }
 }
 
+void
+ModelStaticVarCompensator::setConnected(const State state) {
+  connectionState_ = state;
+  updateShuntInjections();
+}
+
+void
+ModelStaticVarCompensator::addToShuntInjections(ShuntInjections& shuntInjections) {
+  shuntIndex_ = shuntInjections.addShunt(modelBus_.get(), true);
+  shuntInjections_ = &shuntInjections;
+  updateShuntInjections();
+}
+
+void
+ModelStaticVarCompensator::updateShuntInjections() const {
+  if (!shuntInjections_)
+    return;
+  shuntInjections_->setShunt(shuntIndex_, bSvc0_, isConnected());
+}
+
 void
 ModelStaticVarCompensator::evalYMat() {
   // not needed
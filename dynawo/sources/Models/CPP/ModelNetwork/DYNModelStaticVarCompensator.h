@@ -31,6 +31,7 @@
 
 namespace DYN {
 class ModelBus;
+class ShuntInjections;
 
 /**
  * @brief Static var compensator model
@@ -64,9 +65,7 @@ class ModelStaticVarCompensator : public NetworkComponent {
    * @brief set connection status
    * @param state connection status
    */
-  void setConnected(const State state) {
-    connectionState_ = state;
-  }
+  void setConnected(State state);
 
   /**
    * @brief set the bus to which the svc is connected
@@ -82,6 +81,12 @@ class ModelStaticVarCompensator : public NetworkComponent {
    */
   void evalNodeInjection() override;
 
+  /**
+   * @brief add the compensator to the node injections of the susceptances, computed together by the network
+   * @param shuntInjections node injections of the susceptances
+   */
+  void addToShuntInjections(ShuntInjections& shuntInjections);
+
   /**
    * @brief evaluate derivatives
    * @param cj Jacobian prime coefficient
@@ -298,6 +303,11 @@ class ModelStaticVarCompensator : public NetworkComponent {
   void loadInternalVariables(boost::archive::binary_iarchive& streamVariables) override;
 
  private:
+  /**
+   * @brief copy the susceptance and the connection status of the compensator in the node injections of the susceptances, if it belongs to them
+   */
+  void updateShuntInjections() const;
+
   /**
    * @brief compute value
    * @param ui imaginary part of the voltage
@@ -359,6 +369,8 @@ class ModelStaticVarCompensator : public NetworkComponent {
   bool stateModified_;  ///< true if the compensator connection state was modified
   std::shared_ptr<ModelBus> modelBus_;  ///< model bus
   startingPointMode_t startingPointMode_;  ///< type of starting point for the model (FLAT,WARM)
+  ShuntInjections* shuntInjections_;  ///< node injections of the susceptances the compensator belongs to, nullptr if none
+  unsigned int shuntIndex_;  ///< index of the compensator in shuntInjections_
 };  ///< class for Static Var Compensator model in network
 
 }  // namespace DYN
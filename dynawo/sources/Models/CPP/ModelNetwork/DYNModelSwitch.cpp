@@ -142,8 +142,8 @@ ModelSwitch::evalF(propertyF_t type) {
 }
 
 void
-ModelSwitch::collectSilentZ(BitMask* /*silentZTable*/) {
-  // no silent z
+ModelSwitch::collectSilentZ(BitMask* silentZTable) {
+  silentZTable[0].setFlags(NotUsedInDiscreteEquations);
 }
 
 void
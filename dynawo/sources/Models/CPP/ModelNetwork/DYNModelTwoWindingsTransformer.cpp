@@ -26,6 +26,7 @@
  *
  * b, g, r, x shall be specified at the side 2 voltage.
  */
+#include <algorithm>
 #include <cmath>
 #include <cassert>
 #include "PARParametersSet.h"
@@ -47,6 +48,7 @@
 #include "DYNVariableForModel.h"
 #include "DYNParameter.h"
 #include "DYNDerivative.h"
+#include "DYNBranchInjections.h"
 #include "DYNTwoWTransformerInterface.h"
 #include "DYNCurrentLimitInterface.h"
 #include "DYNStepInterface.h"
@@ -90,6 +92,8 @@ topologyModified_(false),
 stateIndexModified_(false),
 updateYMat_(true),
 tapChangerIndex_(0),
+branchInjections_(nullptr),
+branchIndex_(0),
 modelType_("TwoWindingsTransformer") {
   // init data
   // ---------
@@ -369,24 +373,46 @@ ModelTwoWindingsTransformer::initSize() {
 void
 ModelTwoWindingsTransformer::evalYMat() {
   if (updateYMat_) {
-    ir1_dUr1_ = ir1_dUr1();
-    ir1_dUi1_ = ir1_dUi1();
-    ir1_dUr2_ = ir1_dUr2();
-    ir1_dUi2_ = ir1_dUi2();
-    ii1_dUr1_ = ii1_dUr1();
-    ii1_dUi1_ = ii1_dUi1();
-    ii1_dUr2_ = ii1_dUr2();
-    ii1_dUi2_ = ii1_dUi2();
-    ir2_dUr1_ = ir2_dUr1();
-    ir2_dUi1_ = ir2_dUi1();
-    ir2_dUr2_ = ir2_dUr2();
-    ir2_dUi2_ = ir2_dUi2();
-    ii2_dUr1_ = ii2_dUr1();
-    ii2_dUi1_ = ii2_dUi1();
-    ii2_dUr2_ = ii2_dUr2();
-    ii2_dUi2_ = ii2_dUi2();
+    // the terms of each connection state are computed by a dedicated kernel, the evaluations then only use the terms
+    switch (getConnectionState()) {
+      case CLOSED:
+        evalYMatClosed();
+        break;
+      case CLOSED_1:
+        evalYMatClosedSide1();
+        break;
+      case CLOSED_2:
+        evalYMatClosedSide2();
+        break;
+      default:
+        resetYMat();
+        break;
+    }
     updateYMat_ = false;
   }
+  updateBranchInjections();
+}
+
+bool
+ModelTwoWindingsTransformer::addToBranchInjections(BranchInjections& branchInjections) {
+  branchIndex_ = branchInjections.addBranch(modelBus1_.get(), modelBus2_.get());
+  branchInjections_ = &branchInjections;
+  updateBranchInjections();
+  return true;
+}
+
+void
+ModelTwoWindingsTransformer::updateBranchInjections() const {
+  if (!branchInjections_)
+    return;
+  const double admittances[BranchInjections::NB_CURRENTS][BranchInjections::NB_VOLTAGES] = {
+    {ir1_dUr1_, ir1_dUi1_, ir1_dUr2_, ir1_dUi2_},
+    {ii1_dUr1_, ii1_dUi1_, ii1_dUr2_, ii1_dUi2_},
+    {ir2_dUr1_, ir2_dUi1_, ir2_dUr2_, ir2_dUi2_},
+    {ii2_dUr1_, ii2_dUi1_, ii2_dUr2_, ii2_dUi2_}
+  };
+  // same voltages as the ones given by ur1(), ui1(), ur2() and ui2()
+  branchInjections_->setAdmittances(branchIndex_, admittances, true, true);
 }
 
 void
@@ -598,316 +624,63 @@ ModelTwoWindingsTransformer::getG() const {
     return modelTapChanger_->getCurrentStep().getG();
 }
 
-double
-ModelTwoWindingsTransformer::ir1_dUr1() const {
-  double ir1_dUr1 = 0.;
-
-  // Get infos from current step
-  const double rho = getRho();
-  const double r = getR();
-  const double x = getX();
-  const double g = getG();
-
-  const double admittance = 1. / sqrt(r * r + x * x);
-  const double lossAngle = atan2(r, x);
-  if (getConnectionState() == CLOSED) {
-    const double G1 = admittance * sin(lossAngle) + g;
-    ir1_dUr1 = rho * rho * G1;
-  } else if (getConnectionState() == CLOSED_1) {
-    ir1_dUr1 = rho * rho * g;
-  }
-  return ir1_dUr1;
-}
-
-double
-ModelTwoWindingsTransformer::ir1_dUi1() const {
-  double ir1_dUi1 = 0.;
-
-  // Get infos from current step
-  const double rho = getRho();
-  const double r = getR();
-  const double x = getX();
-  const double b = getB();
-
-  const double admittance = 1. / sqrt(r * r + x * x);
-  const double lossAngle = atan2(r, x);
-  if (getConnectionState() == CLOSED) {
-    const double B1 = b - admittance * cos(lossAngle);
-    ir1_dUi1 = -rho * rho * B1;
-  } else if (getConnectionState() == CLOSED_1) {
-    ir1_dUi1 = -rho * rho*b;
-  }
-  return ir1_dUi1;
-}
-
-double
-ModelTwoWindingsTransformer::ir1_dUr2() const {
-  double ir1_dUr2 = 0.;
-
-  // Get infos from current step
-  const double rho = getRho();
-  const double alpha = getAlpha();
-  const double r = getR();
-  const double x = getX();
-
-  const double admittance = 1. / sqrt(r * r + x * x);
-  const double lossAngle = atan2(r, x);
-  if (getConnectionState() == CLOSED) {
-    ir1_dUr2 = -rho * admittance * sin(lossAngle - alpha);
-  }
-  return ir1_dUr2;
-}
-
-double
-ModelTwoWindingsTransformer::ir1_dUi2() const {
-  double ir1_dUi2 = 0.;
-
-  // Get infos from current step
-  const double rho = getRho();
-  const double alpha = getAlpha();
-  const double r = getR();
-  const double x = getX();
-
-  const double admittance = 1. / sqrt(r * r + x * x);
-  const double lossAngle = atan2(r, x);
-  if (getConnectionState() == CLOSED) {
-    ir1_dUi2 = -rho * admittance * cos(lossAngle - alpha);
-  }
-  return ir1_dUi2;
-}
-
-double
-ModelTwoWindingsTransformer::ii1_dUr1() const {
-  double ii1_dUr1 = 0.;
-
-  // Get infos from current step
-  const double rho = getRho();
-  const double r = getR();
-  const double x = getX();
-  const double b = getB();
-
-  const double admittance = 1. / sqrt(r * r + x * x);
-  const double lossAngle = atan2(r, x);
-  if (getConnectionState() == CLOSED) {
-    const double B1 = b - admittance * cos(lossAngle);
-    ii1_dUr1 = rho * rho * B1;
-  } else if (getConnectionState() == CLOSED_1) {
-    ii1_dUr1 = rho * rho * b;
-  }
-  return ii1_dUr1;
-}
-
-double
-ModelTwoWindingsTransformer::ii1_dUi1() const {
-  double ii1_dUi1 = 0.;
-
-  // Get infos from current step
-  const double rho = getRho();
-  const double r = getR();
-  const double x = getX();
-  const double g = getG();
-
-  const double admittance = 1. / sqrt(r * r + x * x);
-  const double lossAngle = atan2(r, x);
-  if (getConnectionState() == CLOSED) {
-    const double G1 = admittance * sin(lossAngle) + g;
-    ii1_dUi1 = rho * rho * G1;
-  } else if (getConnectionState() == CLOSED_1) {
-    ii1_dUi1 = rho * rho * g;
-  }
-
-  return ii1_dUi1;
-}
-
-double
-ModelTwoWindingsTransformer::ii1_dUr2() const {
-  double ii1_dUr2 = 0.;
-
-  // Get infos from current step
-  const double rho = getRho();
-  const double alpha = getAlpha();
-  const double r = getR();
-  const double x = getX();
-
-  const double admittance = 1. / sqrt(r * r + x * x);
-  const double lossAngle = atan2(r, x);
-  if (getConnectionState() == CLOSED) {
-    ii1_dUr2 = rho * admittance * cos(lossAngle - alpha);
-  }
-  return ii1_dUr2;
-}
-
-double
-ModelTwoWindingsTransformer::ii1_dUi2() const {
-  double ii1_dUi2 = 0.;
-
-  // Get infos from current step
-  const double rho = getRho();
-  const double alpha = getAlpha();
-  const double r = getR();
-  const double x = getX();
-
-  const double admittance = 1. / sqrt(r * r + x * x);
-  const double lossAngle = atan2(r, x);
-  if (getConnectionState() == CLOSED) {
-    ii1_dUi2 = -rho * admittance * sin(lossAngle - alpha);
-  }
-  return ii1_dUi2;
-}
-
-double
-ModelTwoWindingsTransformer::ir2_dUr1() const {
-  double ir2_dUr1 = 0.;
-
-  // Get infos from current step
-  const double rho = getRho();
-  const double alpha = getAlpha();
-  const double r = getR();
-  const double x = getX();
-
-  const double admittance = 1. / sqrt(r * r + x * x);
-  const double lossAngle = atan2(r, x);
-  if (getConnectionState() == CLOSED) {
-    ir2_dUr1 = -rho * admittance * sin(alpha + lossAngle);
-  }
-  return ir2_dUr1;
-}
-
-double
-ModelTwoWindingsTransformer::ir2_dUi1() const {
-  double ir2_dUi1 = 0.;
-
+void
+ModelTwoWindingsTransformer::evalYMatClosed() {
   // Get infos from current step
   const double rho = getRho();
   const double alpha = getAlpha();
   const double r = getR();
   const double x = getX();
-
-  const double admittance = 1. / sqrt(r * r + x * x);
-  const double lossAngle = atan2(r, x);
-  if (getConnectionState() == CLOSED) {
-    ir2_dUi1 = -rho * admittance * cos(alpha + lossAngle);
-  }
-  return ir2_dUi1;
-}
-
-double
-ModelTwoWindingsTransformer::ir2_dUr2() const {
-  double ir2_dUr2 = 0.;
-
-  // Get infos from current step
-  const double r = getR();
-  const double x = getX();
   const double g = getG();
   const double b = getB();
 
   const double admittance = 1. / sqrt(r * r + x * x);
   const double lossAngle = atan2(r, x);
-  if (getConnectionState() == CLOSED) {
-    ir2_dUr2 = admittance * sin(lossAngle);
-  } else if (getConnectionState() == CLOSED_2) {
-    const double G = admittance * sin(lossAngle) + g;
-    const double B = b - admittance * cos(lossAngle);
-    const double denom = G * G + B * B;
-
-    const double GT = 1. / denom * (admittance * admittance * g + (admittance * sin(lossAngle) * (g * g + b * b)));
-
-    ir2_dUr2 = GT;
-  }
-  return ir2_dUr2;
+  const double admittanceSin = admittance * sin(lossAngle);
+  const double admittanceCos = admittance * cos(lossAngle);
+  const double G1 = admittanceSin + g;
+  const double B1 = b - admittanceCos;
+  const double rhoAdmittance = rho * admittance;
+  const double sinLossMinusAlpha = sin(lossAngle - alpha);
+  const double cosLossMinusAlpha = cos(lossAngle - alpha);
+  const double sinLossPlusAlpha = sin(alpha + lossAngle);
+  const double cosLossPlusAlpha = cos(alpha + lossAngle);
+
+  ir1_dUr1_ = rho * rho * G1;
+  ir1_dUi1_ = -rho * rho * B1;
+  ir1_dUr2_ = -rhoAdmittance * sinLossMinusAlpha;
+  ir1_dUi2_ = -rhoAdmittance * cosLossMinusAlpha;
+  ii1_dUr1_ = rho * rho * B1;
+  ii1_dUi1_ = rho * rho * G1;
+  ii1_dUr2_ = rhoAdmittance * cosLossMinusAlpha;
+  ii1_dUi2_ = -rhoAdmittance * sinLossMinusAlpha;
+  ir2_dUr1_ = -rhoAdmittance * sinLossPlusAlpha;
+  ir2_dUi1_ = -rhoAdmittance * cosLossPlusAlpha;
+  ir2_dUr2_ = admittanceSin;
+  ir2_dUi2_ = admittanceCos;
+  ii2_dUr1_ = rhoAdmittance * cosLossPlusAlpha;
+  ii2_dUi1_ = -rhoAdmittance * sinLossPlusAlpha;
+  ii2_dUr2_ = -admittanceCos;
+  ii2_dUi2_ = admittanceSin;
 }
 
-double
-ModelTwoWindingsTransformer::ir2_dUi2() const {
-  double ir2_dUi2 = 0.;
-
-  // Get infos from current step
-  const double r = getR();
-  const double x = getX();
-  const double g = getG();
-  const double b = getB();
-
-  const double admittance = 1. / sqrt(r * r + x * x);
-  const double lossAngle = atan2(r, x);
-  if (getConnectionState() == CLOSED) {
-    ir2_dUi2 = admittance * cos(lossAngle);
-  } else if (getConnectionState() == CLOSED_2) {
-    const double G = admittance * sin(lossAngle) + g;
-    const double B = b - admittance * cos(lossAngle);
-    const double denom = G * G + B * B;
-
-    const double BT = 1. / denom * (admittance * admittance * b - admittance * cos(lossAngle) * (g * g + b * b));
-    ir2_dUi2 = -BT;
-  }
-  return ir2_dUi2;
-}
-
-double
-ModelTwoWindingsTransformer::ii2_dUr1() const {
-  double ii2_dUr1 = 0.;
-
-  // Get infos from current step
-  const double rho = getRho();
-  const double alpha = getAlpha();
-  const double r = getR();
-  const double x = getX();
-
-  const double admittance = 1. / sqrt(r * r + x * x);
-  const double lossAngle = atan2(r, x);
-  if (getConnectionState() == CLOSED) {
-    ii2_dUr1 = rho * admittance * cos(alpha + lossAngle);
-  }
-  return ii2_dUr1;
-}
-
-double
-ModelTwoWindingsTransformer::ii2_dUi1() const {
-  double ii2_dUi1 = 0.;
-
+void
+ModelTwoWindingsTransformer::evalYMatClosedSide1() {
+  resetYMat();
   // Get infos from current step
   const double rho = getRho();
-  const double alpha = getAlpha();
-  const double r = getR();
-  const double x = getX();
-
-  const double admittance = 1. / sqrt(r * r + x * x);
-  const double lossAngle = atan2(r, x);
-  if (getConnectionState() == CLOSED) {
-    ii2_dUi1 = -rho * admittance * sin(alpha + lossAngle);
-  }
-  return ii2_dUi1;
-}
-
-double
-ModelTwoWindingsTransformer::ii2_dUr2() const {
-  double ii2_dUr2 = 0.;
-
-  // Get infos from current step
-  const double r = getR();
-  const double x = getX();
   const double g = getG();
   const double b = getB();
 
-  const double admittance = 1. / sqrt(r * r + x * x);
-  const double lossAngle = atan2(r, x);
-  if (getConnectionState() == CLOSED) {
-    ii2_dUr2 = -admittance * cos(lossAngle);
-  } else if (getConnectionState() == CLOSED_2) {
-    const double G = admittance * sin(lossAngle) + g;
-    const double B = b - admittance * cos(lossAngle);
-    const double denom = G * G + B * B;
-
-    const double BT = 1. / denom * (admittance * admittance * b - admittance * cos(lossAngle) * (g * g + b * b));
-
-    ii2_dUr2 = BT;
-  }
-  return ii2_dUr2;
+  ir1_dUr1_ = rho * rho * g;
+  ir1_dUi1_ = -rho * rho * b;
+  ii1_dUr1_ = rho * rho * b;
+  ii1_dUi1_ = rho * rho * g;
 }
 
-double
-ModelTwoWindingsTransformer::ii2_dUi2() const {
-  double ii2_dUi2 = 0.;
-
+void
+ModelTwoWindingsTransformer::evalYMatClosedSide2() {
+  resetYMat();
   // Get infos from current step
   const double r = getR();
   const double x = getX();
@@ -916,19 +689,38 @@ ModelTwoWindingsTransformer::ii2_dUi2() const {
 
   const double admittance = 1. / sqrt(r * r + x * x);
   const double lossAngle = atan2(r, x);
-  if (getConnectionState() == CLOSED) {
-    ii2_dUi2 = admittance * sin(lossAngle);
-  } else if (getConnectionState() == CLOSED_2) {
-    const double G = admittance * sin(lossAngle) + g;
-    const double B = b - admittance * cos(lossAngle);
-    const double denom = G * G + B * B;
-
-    const double GT = 1. / denom * (admittance * admittance * g + admittance * sin(lossAngle) * (g * g + b * b));
+  const double admittanceSin = admittance * sin(lossAngle);
+  const double admittanceCos = admittance * cos(lossAngle);
+  const double G = admittanceSin + g;
+  const double B = b - admittanceCos;
+  const double denom = G * G + B * B;
 
-    ii2_dUi2 = GT;
-  }
+  const double GT = 1. / denom * (admittance * admittance * g + admittanceSin * (g * g + b * b));
+  const double BT = 1. / denom * (admittance * admittance * b - admittanceCos * (g * g + b * b));
+  ir2_dUr2_ = GT;
+  ir2_dUi2_ = -BT;
+  ii2_dUr2_ = BT;
+  ii2_dUi2_ = GT;
+}
 
-  return ii2_dUi2;
+void
+ModelTwoWindingsTransformer::resetYMat() {
+  ir1_dUr1_ = 0.;
+  ir1_dUi1_ = 0.;
+  ir1_dUr2_ = 0.;
+  ir1_dUi2_ = 0.;
+  ii1_dUr1_ = 0.;
+  ii1_dUi1_ = 0.;
+  ii1_dUr2_ = 0.;
+  ii1_dUi2_ = 0.;
+  ir2_dUr1_ = 0.;
+  ir2_dUi1_ = 0.;
+  ir2_dUr2_ = 0.;
+  ir2_dUi2_ = 0.;
+  ii2_dUr1_ = 0.;
+  ii2_dUi1_ = 0.;
+  ii2_dUr2_ = 0.;
+  ii2_dUi2_ = 0.;
 }
 
 void
@@ -1416,10 +1208,10 @@ ModelTwoWindingsTransformer::evalZ(const double t) {
   if (currStateIndex != internalStepIndex) {
     if (disableInternalTapChanger_ > 0.) {
       // external automaton
-      Trace::debug() << DYNLog(TfoTapChange, id_, internalStepIndex, z_[currentStepIndexNum_]) << Trace::endline;
+      DYNTraceIf(DEBUG, "") << DYNLog(TfoTapChange, id_, internalStepIndex, z_[currentStepIndexNum_]) << Trace::endline;
     } else {
       // internal automaton
-      Trace::debug() << DYNLog(TfoTapChange, id_, z_[currentStepIndexNum_], internalStepIndex) << Trace::endline;
+      DYNTraceIf(DEBUG, "") << DYNLog(TfoTapChange, id_, z_[currentStepIndexNum_], internalStepIndex) << Trace::endline;
       z_[currentStepIndexNum_] = internalStepIndex;
     }
     stateIndexModified_ = true;
@@ -1515,7 +1307,10 @@ ModelTwoWindingsTransformer::evalG(const double t) {
   double ui1Val = 0.;
   double ur2Val = 0.;
   double ui2Val = 0.;
-  if (currentLimits1_ || currentLimits2_ || modelPhaseChanger_) {
+  // a tap changer that does not regulate never moves, whatever its monitored value: its roots are useless
+  const bool ratioChangerRegulating = modelRatioChanger_ && modelRatioChanger_->getRegulating();
+  const bool phaseChangerRegulating = modelPhaseChanger_ && modelPhaseChanger_->getRegulating();
+  if (currentLimits1_ || currentLimits2_ || phaseChangerRegulating) {
     ur1Val = ur1();
     ui1Val = ui1();
     ur2Val = ur2();
@@ -1531,7 +1326,7 @@ ModelTwoWindingsTransformer::evalG(const double t) {
     offset += currentLimits2_->sizeG();
   }
 
-  if (modelRatioChanger_) {
+  if (ratioChangerRegulating) {
     double vValue = 0.;
     bool nodeOff = true;
     if (modelBusMonitored_) {
@@ -1540,11 +1335,16 @@ ModelTwoWindingsTransformer::evalG(const double t) {
     }
     modelRatioChanger_->evalG(t, vValue, nodeOff, disableInternalTapChanger_, tapChangerLocked_, getConnectionState() == CLOSED, z_[deltaUTarget], &g_[offset]);
     offset += modelRatioChanger_->sizeG();
+  } else if (modelRatioChanger_) {
+    std::fill(&g_[offset], &g_[offset] + modelRatioChanger_->sizeG(), ROOT_DOWN);
+    offset += modelRatioChanger_->sizeG();
   }
 
-  if (modelPhaseChanger_) {
+  if (phaseChangerRegulating) {
     const double iValue = i2(ur1Val, ui1Val, ur2Val, ui2Val) * factorPuToASide2_;
     modelPhaseChanger_->evalG(t, iValue, false, disableInternalTapChanger_, tapChangerLocked_, getConnectionState() == CLOSED, &g_[offset]);
+  } else if (modelPhaseChanger_) {
+    std::fill(&g_[offset], &g_[offset] + modelPhaseChanger_->sizeG(), ROOT_DOWN);
   }
 }
 
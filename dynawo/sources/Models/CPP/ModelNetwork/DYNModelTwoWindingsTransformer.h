@@ -35,6 +35,7 @@
 #include "DYNNetworkComponent.h"
 
 namespace DYN {
+class BranchInjections;
 class ModelBus;
 class ModelRatioTapChanger;
 class ModelPhaseTapChanger;
@@ -349,6 +350,13 @@ class ModelTwoWindingsTransformer : public NetworkComponent {
    */
   void evalYMat() override;
 
+  /**
+   * @brief add the transformer to the node injections of the static branches, computed together by the network
+   * @param branchInjections node injections of the static branches
+   * @return @b true if the transformer was added, @b false if its node injection has to be evaluated by evalNodeInjection
+   */
+  bool addToBranchInjections(BranchInjections& branchInjections);
+
   /**
    * @brief init
    * @param yNum yNum
@@ -444,6 +452,11 @@ class ModelTwoWindingsTransformer : public NetworkComponent {
    */
   void loadInternalVariables(boost::archive::binary_iarchive& streamVariables) override;
 
+  /**
+   * @brief replace the current step index by the next step index (if modified)
+   */
+  void applyStep();
+
  private:
   /**
    * @brief  get the current ratio of the transformer
@@ -493,11 +506,6 @@ class ModelTwoWindingsTransformer : public NetworkComponent {
    */
   int getNextStepIndex() const;
 
-  /**
-   * @brief replace the current step index by the next step index (if modified)
-   */
-  void applyStep();
-
   /**
    * @brief  set the index of the tap used
    * @param stepIndex index of the tap used
@@ -531,100 +539,24 @@ class ModelTwoWindingsTransformer : public NetworkComponent {
   double P2(double ur1, double ui1, double ur2, double ui2) const;
 
   /**
-   * @brief compute value
-   * @return value
+   * @brief compute the admittance terms of the transformer closed on both sides
    */
-  double ir1_dUr1() const;
+  void evalYMatClosed();
 
   /**
-   * @brief compute value
-   * @return value
+   * @brief compute the admittance terms of the transformer only closed on side 1
    */
-  double ir1_dUi1() const;
+  void evalYMatClosedSide1();
 
   /**
-   * @brief compute value
-   * @return value
+   * @brief compute the admittance terms of the transformer only closed on side 2
    */
-  double ir1_dUr2() const;
+  void evalYMatClosedSide2();
 
   /**
-   * @brief compute value
-   * @return value
+   * @brief set all the admittance terms to zero
    */
-  double ir1_dUi2() const;
-
-  /**
-   * @brief compute value
-   * @return value
-   */
-  double ii1_dUr1() const;
-
-  /**
-   * @brief compute value
-   * @return value
-   */
-  double ii1_dUi1() const;
-
-  /**
-   * @brief compute value
-   * @return value
-   */
-  double ii1_dUr2() const;
-
-  /**
-   * @brief compute value
-   * @return value
-   */
-  double ii1_dUi2() const;
-
-  /**
-   * @brief compute value
-   * @return value
-   */
-  double ir2_dUr1() const;
-
-  /**
-   * @brief compute value
-   * @return value
-   */
-  double ir2_dUi1() const;
-
-  /**
-   * @brief compute value
-   * @return value
-   */
-  double ir2_dUr2() const;
-
-  /**
-   * @brief compute value
-   * @return value
-   */
-  double ir2_dUi2() const;
-
-  /**
-   * @brief compute value
-   * @return value
-   */
-  double ii2_dUr1() const;
-
-  /**
-   * @brief compute value
-   * @return value
-   */
-  double ii2_dUi1() const;
-
-  /**
-   * @brief compute value
-   * @return value
-   */
-  double ii2_dUr2() const;
-
-  /**
-   * @brief compute value
-   * @return value
-   */
-  double ii2_dUi2() const;
+  void resetYMat();
 
   /**
    * @brief compute the real part of the current on side 1
@@ -710,6 +642,11 @@ class ModelTwoWindingsTransformer : public NetworkComponent {
    */
   double ui2() const;
 
+  /**
+   * @brief copy the admittance terms of the transformer in the node injections of the static branches, if it belongs to them
+   */
+  void updateBranchInjections() const;
+
  private:
   KnownBus_t knownBus_;  ///< bus known
 
@@ -764,6 +701,9 @@ class ModelTwoWindingsTransformer : public NetworkComponent {
   double vNom2_;  ///< nominal voltage on side 2
   int tapChangerIndex_;  ///< current tap index (for tap-changer)
 
+  BranchInjections* branchInjections_;  ///< node injections of the static branches the transformer belongs to, nullptr if none
+  unsigned int branchIndex_;  ///< index of the transformer in the node injections of the static branches
+
   const std::string modelType_;  ///< model Type
 };
 }  // namespace DYN
@@ -196,18 +196,25 @@ ModelVoltageLevel::findClosestBBS(const unsigned int node, vector<string>& short
     defineGraph();
   }
 
-  // find the shortest path between the node and the bus bar section
-  unsigned int nodeClosestBBS = std::numeric_limits<unsigned>::max();
+  vector<unsigned> nodesBBS;
+  nodesBBS.reserve(busesWithBBS_.size());
   for (const auto& busWithBBS : busesWithBBS_) {
     const unsigned int nodeBBS = busWithBBS->getBusIndex();
-    vector<string> ret;
     if (node == nodeBBS) {
-      shortestPath = ret;
+      shortestPath.clear();
       return node;
     }
-    graph_->shortestPath(node, nodeBBS, weights1_, ret);
+    nodesBBS.push_back(nodeBBS);
+  }
+
+  // find the shortest paths between the node and all the bus bar sections, the graph being explored once
+  vector<vector<string> > paths;
+  graph_->shortestPaths(node, nodesBBS, weights1_, paths);
+  unsigned int nodeClosestBBS = std::numeric_limits<unsigned>::max();
+  for (unsigned int i = 0; i < nodesBBS.size(); ++i) {
+    const vector<string>& ret = paths[i];
     if (!ret.empty() && (ret.size() < shortestPath.size() || shortestPath.empty())) {
-      nodeClosestBBS = nodeBBS;
+      nodeClosestBBS = nodesBBS[i];
       shortestPath = ret;
     }
   }
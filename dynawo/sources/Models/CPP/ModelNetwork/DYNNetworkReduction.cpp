@@ -0,0 +1,271 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNNetworkReduction.cpp
+ *
+ * @brief Reduction of the passive part of some voltage levels to an equivalent admittance matrix
+ *
+ */
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <utility>
+
+#include "DYNNetworkReduction.h"
+#include "DYNNetworkInterface.h"
+#include "DYNVoltageLevelInterface.h"
+#include "DYNBusInterface.h"
+#include "DYNSwitchInterface.h"
+#include "DYNLoadInterface.h"
+#include "DYNGeneratorInterface.h"
+#include "DYNShuntCompensatorInterface.h"
+#include "DYNStaticVarCompensatorInterface.h"
+#include "DYNDanglingLineInterface.h"
+#include "DYNVscConverterInterface.h"
+#include "DYNLccConverterInterface.h"
+#include "DYNLineInterface.h"
+#include "DYNTwoWTransformerInterface.h"
+#include "DYNThreeWTransformerInterface.h"
+#include "DYNRatioTapChangerInterface.h"
+#include "DYNModelConstants.h"
+#include "DYNCommon.h"
+#include "DYNTrace.h"
+#include "DYNMacrosMessage.h"
+
+using std::complex;
+using std::map;
+using std::set;
+using std::string;
+using std::unordered_map;
+using std::unordered_set;
+using std::vector;
+
+namespace DYN {
+
+/**
+ * @brief relative threshold under which a diagonal term is not used as a pivot
+ */
+static const double PIVOT_TOLERANCE = 1e-8;
+
+/**
+ * @brief record that a bus can not be eliminated
+ * @param bus bus interface, may be empty
+ * @param keptBuses id of the buses that can not be eliminated
+ */
+static void
+keepBus(const std::shared_ptr<BusInterface>& bus, unordered_set<string>& keptBuses) {
+  if (bus)
+    keptBuses.insert(bus->getID());
+}
+
+/**
+ * @brief get the index of a bus in the admittance matrix, adding it if needed
+ * @param id id of the bus
+ * @param indexes index of each bus already in the matrix
+ * @param ids id of the buses, by index
+ * @param matrix rows of the admittance matrix
+ * @return index of the bus
+ */
+static unsigned int
+getBusIndex(const string& id, unordered_map<string, unsigned int>& indexes, vector<string>& ids,
+    vector<map<unsigned int, complex<double> > >& matrix) {
+  unordered_map<string, unsigned int>::const_iterator itIndex = indexes.find(id);
+  if (itIndex != indexes.end())
+    return itIndex->second;
+  const unsigned int index = static_cast<unsigned int>(ids.size());
+  indexes[id] = index;
+  ids.push_back(id);
+  matrix.push_back(map<unsigned int, complex<double> >());
+  return index;
+}
+
+NetworkReduction::NetworkReduction(const boost::shared_ptr<NetworkInterface>& network, const vector<string>& reducedVoltageLevels) {
+  reduce(network, findPassiveBuses(network, reducedVoltageLevels));
+}
+
+unordered_set<string>
+NetworkReduction::findPassiveBuses(const boost::shared_ptr<NetworkInterface>& network, const vector<string>& reducedVoltageLevels) {
+  unordered_set<string> unknownVoltageLevels(reducedVoltageLevels.begin(), reducedVoltageLevels.end());
+  unordered_set<string> candidates;
+  unordered_set<string> keptBuses;
+
+  for (const auto& voltageLevel : network->getVoltageLevels()) {
+    if (unknownVoltageLevels.erase(voltageLevel->getID()) == 0)
+      continue;
+    if (voltageLevel->isNodeBreakerTopology()) {
+      Trace::warn() << DYNLog(NodeBreakerVoltageLevelNotReduced, voltageLevel->getID()) << Trace::endline;
+      continue;
+    }
+    for (const auto& bus : voltageLevel->getBuses()) {
+      if (!bus->hasDynamicModel() && !bus->hasConnection())
+        candidates.insert(bus->getID());
+    }
+    // the buses with an injection or a switch stay in the network
+    for (const auto& aSwitch : voltageLevel->getSwitches()) {
+      keepBus(aSwitch->getBusInterface1(), keptBuses);
+      keepBus(aSwitch->getBusInterface2(), keptBuses);
+    }
+    for (const auto& load : voltageLevel->getLoads())
+      keepBus(load->getBusInterface(), keptBuses);
+    for (const auto& generator : voltageLevel->getGenerators())
+      keepBus(generator->getBusInterface(), keptBuses);
+    for (const auto& shunt : voltageLevel->getShuntCompensators())
+      keepBus(shunt->getBusInterface(), keptBuses);
+    for (const auto& svc : voltageLevel->getStaticVarCompensators())
+      keepBus(svc->getBusInterface(), keptBuses);
+    for (const auto& danglingLine : voltageLevel->getDanglingLines())
+      keepBus(danglingLine->getBusInterface(), keptBuses);
+    for (const auto& vsc : voltageLevel->getVscConverters())
+      keepBus(vsc->getBusInterface(), keptBuses);
+    for (const auto& lcc : voltageLevel->getLccConverters())
+      keepBus(lcc->getBusInterface(), keptBuses);
+  }
+  for (const auto& voltageLevelId : unknownVoltageLevels)
+    Trace::warn() << DYNLog(UnknownReducedVoltageLevel, voltageLevelId) << Trace::endline;
+
+  // the buses of the transformers and the ones monitored by a tap changer stay in the network
+  unordered_set<string> terminalRefs;
+  for (const auto& twoWTfo : network->getTwoWTransformers()) {
+    keepBus(twoWTfo->getBusInterface1(), keptBuses);
+    keepBus(twoWTfo->getBusInterface2(), keptBuses);
+    const std::unique_ptr<RatioTapChangerInterface>& ratioTapChanger = twoWTfo->getRatioTapChanger();
+    if (ratioTapChanger && !ratioTapChanger->getTerminalRefId().empty())
+      terminalRefs.insert(ratioTapChanger->getTerminalRefId());
+  }
+  for (const auto& threeWTfo : network->getThreeWTransformers()) {
+    keepBus(threeWTfo->getBusInterface1(), keptBuses);
+    keepBus(threeWTfo->getBusInterface2(), keptBuses);
+    keepBus(threeWTfo->getBusInterface3(), keptBuses);
+  }
+  keptBuses.insert(terminalRefs.begin(), terminalRefs.end());
+
+  // only the static lines connected on both sides, with a non zero impedance, can be eliminated
+  for (const auto& line : network->getLines()) {
+    const std::shared_ptr<BusInterface> bus1 = line->getBusInterface1();
+    const std::shared_ptr<BusInterface> bus2 = line->getBusInterface2();
+    const bool isPassive = !line->hasDynamicModel() && bus1 && bus2 && line->getInitialConnected1() && line->getInitialConnected2()
+        && !bus1->hasDynamicModel() && !bus2->hasDynamicModel() && !(doubleIsZero(line->getR()) && doubleIsZero(line->getX()))
+        && terminalRefs.find(line->getID()) == terminalRefs.end();
+    if (!isPassive) {
+      keepBus(bus1, keptBuses);
+      keepBus(bus2, keptBuses);
+    }
+  }
+
+  unordered_set<string> passiveBuses;
+  for (const auto& id : candidates) {
+    if (keptBuses.find(id) == keptBuses.end())
+      passiveBuses.insert(id);
+  }
+  return passiveBuses;
+}
+
+void
+NetworkReduction::reduce(const boost::shared_ptr<NetworkInterface>& network, const unordered_set<string>& passiveBuses) {
+  if (passiveBuses.empty())
+    return;
+
+  // nodal admittance matrix of the lines connected to a passive bus
+  unordered_map<string, unsigned int> indexes;
+  vector<string> ids;
+  vector<map<unsigned int, complex<double> > > matrix;
+  for (const auto& line : network->getLines()) {
+    const std::shared_ptr<BusInterface> bus1 = line->getBusInterface1();
+    const std::shared_ptr<BusInterface> bus2 = line->getBusInterface2();
+    if (!bus1 || !bus2)
+      continue;
+    if (passiveBuses.find(bus1->getID()) == passiveBuses.end() && passiveBuses.find(bus2->getID()) == passiveBuses.end())
+      continue;
+    // same per unit conversion as ModelLine for a line closed on both sides
+    const double coeff = line->getVNom1() * line->getVNom1() / SNREF;
+    const complex<double> y = coeff / complex<double>(line->getR(), line->getX());
+    const unsigned int index1 = getBusIndex(bus1->getID(), indexes, ids, matrix);
+    const unsigned int index2 = getBusIndex(bus2->getID(), indexes, ids, matrix);
+    matrix[index1][index1] += y + coeff * complex<double>(line->getG1(), line->getB1());
+    matrix[index2][index2] += y + coeff * complex<double>(line->getG2(), line->getB2());
+    matrix[index1][index2] -= y;
+    matrix[index2][index1] -= y;
+    eliminatedLines_.insert(line->getID());
+  }
+
+  // eliminate the passive buses, the one with the fewest neighbors first to limit the fill-in
+  const unsigned int nbBuses = static_cast<unsigned int>(ids.size());
+  vector<bool> queued(nbBuses, false);
+  vector<bool> eliminated(nbBuses, false);
+  set<std::pair<std::size_t, unsigned int> > queue;
+  for (unsigned int k = 0; k < nbBuses; ++k) {
+    if (passiveBuses.find(ids[k]) != passiveBuses.end()) {
+      queue.insert(std::make_pair(matrix[k].size(), k));
+      queued[k] = true;
+    }
+  }
+  while (!queue.empty()) {
+    const unsigned int k = queue.begin()->second;
+    queue.erase(queue.begin());
+    queued[k] = false;
+    map<unsigned int, complex<double> >& rowK = matrix[k];
+    const complex<double> pivot = rowK[k];
+    double rowMax = 0.;
+    for (const auto& term : rowK)
+      rowMax = std::max(rowMax, std::abs(term.second));
+    // an (almost) floating bus can not be eliminated: it is kept as a boundary bus
+    if (std::abs(pivot) <= PIVOT_TOLERANCE * rowMax)
+      continue;
+
+    // Y_ij -= Y_ik * Y_kj / Y_kk for all the neighbors i and j of k
+    for (const auto& termI : rowK) {
+      const unsigned int i = termI.first;
+      if (i == k)
+        continue;
+      map<unsigned int, complex<double> >& rowI = matrix[i];
+      if (queued[i])
+        queue.erase(std::make_pair(rowI.size(), i));
+      const complex<double> factor = rowI[k] / pivot;
+      for (const auto& termJ : rowK) {
+        if (termJ.first != k)
+          rowI[termJ.first] -= factor * termJ.second;
+      }
+      rowI.erase(k);
+      if (queued[i])
+        queue.insert(std::make_pair(rowI.size(), i));
+    }
+    rowK.clear();
+    eliminated[k] = true;
+    eliminatedBuses_.insert(ids[k]);
+  }
+
+  // the remaining terms are the equivalent between the boundary buses
+  vector<unsigned int> boundaryIndexes(nbBuses, 0);
+  for (unsigned int k = 0; k < nbBuses; ++k) {
+    if (!eliminated[k]) {
+      boundaryIndexes[k] = static_cast<unsigned int>(boundaryBuses_.size());
+      boundaryBuses_.push_back(ids[k]);
+    }
+  }
+  for (unsigned int i = 0; i < nbBuses; ++i) {
+    for (const auto& term : matrix[i]) {
+      if (term.second == complex<double>(0., 0.))
+        continue;
+      Admittance admittance;
+      admittance.row = boundaryIndexes[i];
+      admittance.column = boundaryIndexes[term.first];
+      admittance.value = term.second;
+      admittances_.push_back(admittance);
+    }
+  }
+}
+
+}  // namespace DYN
@@ -0,0 +1,142 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNNetworkReduction.h
+ *
+ * @brief Reduction of the passive part of some voltage levels to an equivalent admittance matrix
+ *
+ */
+#ifndef MODELS_CPP_MODELNETWORK_DYNNETWORKREDUCTION_H_
+#define MODELS_CPP_MODELNETWORK_DYNNETWORKREDUCTION_H_
+
+#include <complex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace DYN {
+class NetworkInterface;
+
+/**
+ * @brief Kron reduction of the passive buses of the reduced voltage levels
+ *
+ * A bus of a reduced voltage level is passive if only static lines, connected on both sides, are connected to it:
+ * no injection, switch, transformer, dynamic model or tap changer regulation uses it. The passive buses are
+ * eliminated from the nodal admittance matrix of their lines, which gives an equivalent admittance matrix between
+ * the remaining buses, called boundary buses. As the lines are linear, the currents injected at the boundary
+ * buses by the equivalent are the ones that the eliminated buses and lines would have injected.
+ *
+ * Only the bus-breaker voltage levels are reduced.
+ */
+class NetworkReduction : private boost::noncopyable {
+ public:
+  /**
+   * @brief term of the equivalent admittance matrix
+   */
+  struct Admittance {
+    unsigned int row;  ///< index of the boundary bus where the current is injected
+    unsigned int column;  ///< index of the boundary bus whose voltage is used
+    std::complex<double> value;  ///< admittance in p.u. (base SNREF)
+  };
+
+  /**
+   * @brief constructor: select the buses and lines to eliminate and compute the equivalent
+   *
+   * @param network network data
+   * @param reducedVoltageLevels id of the voltage levels to reduce
+   */
+  NetworkReduction(const boost::shared_ptr<NetworkInterface>& network, const std::vector<std::string>& reducedVoltageLevels);
+
+  /**
+   * @brief whether a bus is eliminated
+   * @param id id of the bus
+   * @return @b true if the bus is replaced by the equivalent
+   */
+  inline bool isEliminatedBus(const std::string& id) const {
+    return eliminatedBuses_.find(id) != eliminatedBuses_.end();
+  }
+
+  /**
+   * @brief whether a line is eliminated
+   * @param id id of the line
+   * @return @b true if the line is replaced by the equivalent
+   */
+  inline bool isEliminatedLine(const std::string& id) const {
+    return eliminatedLines_.find(id) != eliminatedLines_.end();
+  }
+
+  /**
+   * @brief get the number of eliminated buses
+   * @return number of eliminated buses
+   */
+  inline unsigned int nbEliminatedBuses() const {
+    return static_cast<unsigned int>(eliminatedBuses_.size());
+  }
+
+  /**
+   * @brief get the number of eliminated lines
+   * @return number of eliminated lines
+   */
+  inline unsigned int nbEliminatedLines() const {
+    return static_cast<unsigned int>(eliminatedLines_.size());
+  }
+
+  /**
+   * @brief get the boundary buses of the equivalent
+   * @return id of the boundary buses, in the order of their index
+   */
+  inline const std::vector<std::string>& getBoundaryBuses() const {
+    return boundaryBuses_;
+  }
+
+  /**
+   * @brief get the terms of the equivalent admittance matrix
+   * @return non zero terms of the equivalent admittance matrix
+   */
+  inline const std::vector<Admittance>& getAdmittances() const {
+    return admittances_;
+  }
+
+ private:
+  /**
+   * @brief find the passive buses of the reduced voltage levels
+   *
+   * @param network network data
+   * @param reducedVoltageLevels id of the voltage levels to reduce
+   * @return id of the passive buses
+   */
+  static std::unordered_set<std::string> findPassiveBuses(const boost::shared_ptr<NetworkInterface>& network,
+      const std::vector<std::string>& reducedVoltageLevels);
+
+  /**
+   * @brief eliminate the passive buses from the admittance matrix of their lines
+   *
+   * @param network network data
+   * @param passiveBuses id of the passive buses
+   */
+  void reduce(const boost::shared_ptr<NetworkInterface>& network, const std::unordered_set<std::string>& passiveBuses);
+
+ private:
+  std::unordered_set<std::string> eliminatedBuses_;  ///< id of the buses replaced by the equivalent
+  std::unordered_set<std::string> eliminatedLines_;  ///< id of the lines replaced by the equivalent
+  std::vector<std::string> boundaryBuses_;  ///< id of the buses connected to the equivalent
+  std::vector<Admittance> admittances_;  ///< terms of the equivalent admittance matrix
+};
+
+}  // namespace DYN
+
+#endif  // MODELS_CPP_MODELNETWORK_DYNNETWORKREDUCTION_H_
@@ -0,0 +1,112 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNShuntInjections.cpp
+ *
+ * @brief Node injections of the shunt compensators and of the static var compensators of the network evaluated in one pass
+ *
+ */
+#include <cassert>
+
+#include "DYNShuntInjections.h"
+#include "DYNModelBus.h"
+#include "DYNDerivative.h"
+
+namespace DYN {
+
+ShuntInjections::ShuntInjections() {
+}
+
+unsigned int
+ShuntInjections::addShunt(ModelBus* bus, const bool checkSwitchOff) {
+  const unsigned int index = static_cast<unsigned int>(buses_.size());
+  buses_.push_back(bus);
+  b_.push_back(0.);
+  connected_.push_back(false);
+  checkSwitchOff_.push_back(checkSwitchOff);
+  return index;
+}
+
+void
+ShuntInjections::setShunt(const unsigned int index, const double b, const bool connected) {
+  assert(index < buses_.size());
+  b_[index] = b;
+  connected_[index] = connected;
+}
+
+void
+ShuntInjections::gatherSusceptances() {
+  running_.clear();
+  bRunning_.clear();
+  ur_.clear();
+  ui_.clear();
+  const unsigned int nbShunts = static_cast<unsigned int>(buses_.size());
+  for (unsigned int k = 0; k < nbShunts; ++k) {
+    if (!connected_[k])
+      continue;
+    const ModelBus* bus = buses_[k];
+    running_.push_back(k);
+    bRunning_.push_back((checkSwitchOff_[k] && bus->getSwitchOff()) ? 0. : b_[k]);
+    ur_.push_back(bus->ur());
+    ui_.push_back(bus->ui());
+  }
+}
+
+void
+ShuntInjections::evalNodeInjection() {
+  gatherSusceptances();
+  // same currents as ModelShuntCompensator and ModelStaticVarCompensator::evalNodeInjection
+  const unsigned int nbRunning = static_cast<unsigned int>(running_.size());
+  for (unsigned int k = 0; k < nbRunning; ++k) {
+    ModelBus* bus = buses_[running_[k]];
+    bus->irAdd(-bRunning_[k] * ui_[k]);
+    bus->iiAdd(bRunning_[k] * ur_[k]);
+  }
+}
+
+void
+ShuntInjections::evalDerivatives() {
+  gatherSusceptances();
+  // same Jacobian terms as ModelShuntCompensator and ModelStaticVarCompensator::evalDerivatives, the null terms included
+  const unsigned int nbRunning = static_cast<unsigned int>(running_.size());
+  for (unsigned int k = 0; k < nbRunning; ++k) {
+    ModelBus* bus = buses_[running_[k]];
+    const int urYNum = bus->urYNum();
+    const int uiYNum = bus->uiYNum();
+    auto& derivatives = bus->derivatives();
+    derivatives->addDerivative(IR_DERIVATIVE, urYNum, 0.);
+    derivatives->addDerivative(IR_DERIVATIVE, uiYNum, -bRunning_[k]);
+    derivatives->addDerivative(II_DERIVATIVE, urYNum, bRunning_[k]);
+    derivatives->addDerivative(II_DERIVATIVE, uiYNum, 0.);
+  }
+}
+
+void
+ShuntInjections::clear() {
+  buses_.clear();
+  b_.clear();
+  connected_.clear();
+  checkSwitchOff_.clear();
+  running_.clear();
+  bRunning_.clear();
+  ur_.clear();
+  ui_.clear();
+}
+
+unsigned int
+ShuntInjections::size() const {
+  return static_cast<unsigned int>(buses_.size());
+}
+
+}  // namespace DYN
@@ -0,0 +1,103 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNShuntInjections.h
+ *
+ * @brief Node injections of the shunt compensators and of the static var compensators of the network evaluated in one pass
+ *
+ */
+#ifndef MODELS_CPP_MODELNETWORK_DYNSHUNTINJECTIONS_H_
+#define MODELS_CPP_MODELNETWORK_DYNSHUNTINJECTIONS_H_
+
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+namespace DYN {
+class ModelBus;
+
+/**
+ * @brief currents injected at the nodes of the shunt compensators and of the static var compensators
+ *
+ * Both components inject the current of a susceptance b connected to their bus: ir = -b * ui and ii = b * ur.
+ * They are stored in structure of arrays, so that their currents and Jacobian terms are computed in loops over
+ * contiguous arrays, without any virtual call. A static var compensator also stops injecting current when its bus
+ * is switched off, which is checked during the evaluation as the switch off of a bus is not notified to its components.
+ */
+class ShuntInjections : private boost::noncopyable {
+ public:
+  /**
+   * @brief default constructor
+   */
+  ShuntInjections();
+
+  /**
+   * @brief add a susceptance
+   *
+   * @param bus bus of the susceptance
+   * @param checkSwitchOff whether the susceptance injects no current when its bus is switched off
+   * @return index of the susceptance
+   */
+  unsigned int addShunt(ModelBus* bus, bool checkSwitchOff);
+
+  /**
+   * @brief set the value of a susceptance
+   *
+   * @param index index of the susceptance
+   * @param b susceptance (p.u. base SNREF)
+   * @param connected whether the component is connected
+   */
+  void setShunt(unsigned int index, double b, bool connected);
+
+  /**
+   * @brief compute the currents of all the susceptances and add them to their buses
+   */
+  void evalNodeInjection();
+
+  /**
+   * @brief add the Jacobian terms of all the susceptances to the derivatives of their buses
+   */
+  void evalDerivatives();
+
+  /**
+   * @brief remove all the susceptances
+   */
+  void clear();
+
+  /**
+   * @brief get the number of susceptances
+   * @return number of susceptances
+   */
+  unsigned int size() const;
+
+ private:
+  /**
+   * @brief compute the susceptance of each connected component, 0 if it injects no current
+   */
+  void gatherSusceptances();
+
+ private:
+  std::vector<ModelBus*> buses_;  ///< bus of each susceptance
+  std::vector<double> b_;  ///< value of each susceptance
+  std::vector<bool> connected_;  ///< whether each component is connected
+  std::vector<bool> checkSwitchOff_;  ///< whether each susceptance injects no current when its bus is switched off
+  std::vector<unsigned int> running_;  ///< index of the connected susceptances during the evaluation
+  std::vector<double> bRunning_;  ///< susceptance of each connected component during the evaluation, 0 if its bus is switched off
+  std::vector<double> ur_;  ///< real part of the voltage of each connected component during the evaluation
+  std::vector<double> ui_;  ///< imaginary part of the voltage of each connected component during the evaluation
+};
+
+}  // namespace DYN
+
+#endif  // MODELS_CPP_MODELNETWORK_DYNSHUNTINJECTIONS_H_
@@ -0,0 +1,151 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNStarBusElimination.cpp
+ *
+ * @brief Elimination of the star buses of the static three windings transformers
+ *
+ */
+#include <algorithm>
+#include <complex>
+#include <map>
+#include <unordered_map>
+#include <utility>
+
+#include "DYNStarBusElimination.h"
+#include "DYNNetworkInterface.h"
+#include "DYNVoltageLevelInterface.h"
+#include "DYNBusInterface.h"
+#include "DYNTwoWTransformerInterface.h"
+#include "DYNRatioTapChangerInterface.h"
+#include "DYNModelConstants.h"
+#include "DYNCommon.h"
+
+using std::complex;
+using std::map;
+using std::string;
+using std::unordered_map;
+using std::unordered_set;
+using std::vector;
+
+namespace DYN {
+
+/**
+ * @brief number of legs of a three windings transformer
+ */
+static const unsigned int NB_LEGS = 3;
+
+/**
+ * @brief relative threshold under which the diagonal term of a star bus is not used as a pivot
+ */
+static const double PIVOT_TOLERANCE = 1e-8;
+
+/**
+ * @brief whether a leg of a three windings transformer can be replaced by the equivalent
+ * @param leg fictitious two windings transformer of the leg, the star bus being on side 1
+ * @param terminalRefs id of the components monitored by a tap changer
+ * @return @b true if the leg is static and linear
+ */
+static bool
+isStaticLeg(const std::shared_ptr<TwoWTransformerInterface>& leg, const unordered_set<string>& terminalRefs) {
+  const std::shared_ptr<BusInterface> bus = leg->getBusInterface2();
+  return !leg->hasDynamicModel() && bus && !bus->hasDynamicModel() && leg->getInitialConnected1() && leg->getInitialConnected2()
+      && !leg->getPhaseTapChanger() && !leg->getRatioTapChanger() && leg->getCurrentLimitInterfaces1().empty()
+      && leg->getCurrentLimitInterfaces2().empty() && !(doubleIsZero(leg->getR()) && doubleIsZero(leg->getX()))
+      && terminalRefs.find(leg->getID()) == terminalRefs.end();
+}
+
+StarBusElimination::StarBusElimination(const boost::shared_ptr<NetworkInterface>& network) {
+  // the legs of the three windings transformers are connected to their star bus on side 1
+  unordered_map<string, vector<std::shared_ptr<TwoWTransformerInterface> > > legsByStarBus;
+  unordered_set<string> terminalRefs;
+  for (const auto& twoWTfo : network->getTwoWTransformers()) {
+    const std::shared_ptr<BusInterface> bus1 = twoWTfo->getBusInterface1();
+    if (bus1 && bus1->isFictitious())
+      legsByStarBus[bus1->getID()].push_back(twoWTfo);
+    const std::unique_ptr<RatioTapChangerInterface>& ratioTapChanger = twoWTfo->getRatioTapChanger();
+    if (ratioTapChanger && !ratioTapChanger->getTerminalRefId().empty())
+      terminalRefs.insert(ratioTapChanger->getTerminalRefId());
+  }
+
+  unordered_map<string, unsigned int> indexes;
+  map<std::pair<unsigned int, unsigned int>, complex<double> > terms;
+  for (const auto& voltageLevel : network->getVoltageLevels()) {
+    for (const auto& starBus : voltageLevel->getBuses()) {
+      if (!starBus->isFictitious() || starBus->hasDynamicModel() || starBus->hasConnection())
+        continue;
+      const vector<std::shared_ptr<TwoWTransformerInterface> >& legs = legsByStarBus[starBus->getID()];
+      if (legs.size() != NB_LEGS || !std::all_of(legs.begin(), legs.end(),
+          [&terminalRefs](const std::shared_ptr<TwoWTransformerInterface>& leg) { return isStaticLeg(leg, terminalRefs); }))
+        continue;
+
+      // same per unit conversion as ModelTwoWindingsTransformer closed on both sides, without tap changer:
+      // I_star = rho^2 (y + ysh) U_star - rho y U_k and I_k = y U_k - rho y U_star
+      complex<double> pivot(0., 0.);
+      complex<double> couplings[NB_LEGS];
+      complex<double> seriesAdmittances[NB_LEGS];
+      for (unsigned int k = 0; k < NB_LEGS; ++k) {
+        const std::shared_ptr<TwoWTransformerInterface>& leg = legs[k];
+        const double coeff = leg->getVNom2() * leg->getVNom2() / SNREF;
+        const double rho = leg->getRatedU2() / leg->getRatedU1() * leg->getVNom1() / leg->getVNom2();
+        const complex<double> y = 1. / complex<double>(leg->getR() / coeff, leg->getX() / coeff);
+        const complex<double> ysh(leg->getG() * coeff, leg->getB() * coeff);
+        pivot += rho * rho * (y + ysh);
+        couplings[k] = -rho * y;
+        seriesAdmittances[k] = y;
+      }
+      double rowMax = std::abs(pivot);
+      for (unsigned int k = 0; k < NB_LEGS; ++k)
+        rowMax = std::max(rowMax, std::abs(couplings[k]));
+      // an (almost) floating star bus can not be eliminated
+      if (std::abs(pivot) <= PIVOT_TOLERANCE * rowMax)
+        continue;
+
+      // Y_kl = delta_kl y_k - Y_k,star * Y_star,l / Y_star,star
+      unsigned int boundaryIndexes[NB_LEGS];
+      for (unsigned int k = 0; k < NB_LEGS; ++k) {
+        const string& id = legs[k]->getBusInterface2()->getID();
+        unordered_map<string, unsigned int>::const_iterator itIndex = indexes.find(id);
+        if (itIndex == indexes.end()) {
+          itIndex = indexes.insert(std::make_pair(id, static_cast<unsigned int>(boundaryBuses_.size()))).first;
+          boundaryBuses_.push_back(id);
+        }
+        boundaryIndexes[k] = itIndex->second;
+      }
+      for (unsigned int k = 0; k < NB_LEGS; ++k) {
+        for (unsigned int l = 0; l < NB_LEGS; ++l) {
+          complex<double> value = -couplings[k] * couplings[l] / pivot;
+          if (k == l)
+            value += seriesAdmittances[k];
+          terms[std::make_pair(boundaryIndexes[k], boundaryIndexes[l])] += value;
+        }
+        eliminatedTransformers_.insert(legs[k]->getID());
+      }
+      eliminatedBuses_.insert(starBus->getID());
+    }
+  }
+
+  admittances_.reserve(terms.size());
+  for (const auto& term : terms) {
+    if (term.second == complex<double>(0., 0.))
+      continue;
+    NetworkReduction::Admittance admittance;
+    admittance.row = term.first.first;
+    admittance.column = term.first.second;
+    admittance.value = term.second;
+    admittances_.push_back(admittance);
+  }
+}
+
+}  // namespace DYN
@@ -0,0 +1,104 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNStarBusElimination.h
+ *
+ * @brief Elimination of the star buses of the static three windings transformers
+ *
+ */
+#ifndef MODELS_CPP_MODELNETWORK_DYNSTARBUSELIMINATION_H_
+#define MODELS_CPP_MODELNETWORK_DYNSTARBUSELIMINATION_H_
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "DYNNetworkReduction.h"
+
+namespace DYN {
+class NetworkInterface;
+
+/**
+ * @brief analytical elimination of the star buses of the static three windings transformers
+ *
+ * A three windings transformer is given to the network model as a fictitious star bus and three fictitious two windings
+ * transformers, one per leg. When the star bus has no dynamic model and its legs are static transformers without tap
+ * changer nor current limits, connected on both sides, the star bus is eliminated from the nodal admittance matrix of
+ * the legs. This gives an equivalent admittance matrix between the three buses of the transformer, which injects the
+ * same currents as the star bus and the legs would have injected, without their variables and equations.
+ */
+class StarBusElimination : private boost::noncopyable {
+ public:
+  /**
+   * @brief constructor: select the star buses to eliminate and compute the equivalent
+   *
+   * @param network network data
+   */
+  explicit StarBusElimination(const boost::shared_ptr<NetworkInterface>& network);
+
+  /**
+   * @brief whether a bus is eliminated
+   * @param id id of the bus
+   * @return @b true if the bus is the star bus of a transformer replaced by the equivalent
+   */
+  inline bool isEliminatedBus(const std::string& id) const {
+    return eliminatedBuses_.find(id) != eliminatedBuses_.end();
+  }
+
+  /**
+   * @brief whether a two windings transformer is eliminated
+   * @param id id of the two windings transformer
+   * @return @b true if the transformer is the leg of a transformer replaced by the equivalent
+   */
+  inline bool isEliminatedTransformer(const std::string& id) const {
+    return eliminatedTransformers_.find(id) != eliminatedTransformers_.end();
+  }
+
+  /**
+   * @brief get the number of eliminated star buses
+   * @return number of eliminated star buses
+   */
+  inline unsigned int nbEliminatedBuses() const {
+    return static_cast<unsigned int>(eliminatedBuses_.size());
+  }
+
+  /**
+   * @brief get the boundary buses of the equivalent
+   * @return id of the buses of the replaced transformers, in the order of their index
+   */
+  inline const std::vector<std::string>& getBoundaryBuses() const {
+    return boundaryBuses_;
+  }
+
+  /**
+   * @brief get the terms of the equivalent admittance matrix
+   * @return non zero terms of the equivalent admittance matrix
+   */
+  inline const std::vector<NetworkReduction::Admittance>& getAdmittances() const {
+    return admittances_;
+  }
+
+ private:
+  std::unordered_set<std::string> eliminatedBuses_;  ///< id of the star buses replaced by the equivalent
+  std::unordered_set<std::string> eliminatedTransformers_;  ///< id of the legs replaced by the equivalent
+  std::vector<std::string> boundaryBuses_;  ///< id of the buses connected to the equivalent
+  std::vector<NetworkReduction::Admittance> admittances_;  ///< terms of the equivalent admittance matrix
+};
+
+}  // namespace DYN
+
+#endif  // MODELS_CPP_MODELNETWORK_DYNSTARBUSELIMINATION_H_
@@ -0,0 +1,277 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNStudyArea.cpp
+ *
+ * @brief Selection of the part of the network modelled around some study voltage levels
+ *
+ */
+#include <complex>
+
+#include "DYNStudyArea.h"
+#include "DYNNetworkInterface.h"
+#include "DYNVoltageLevelInterface.h"
+#include "DYNBusInterface.h"
+#include "DYNSwitchInterface.h"
+#include "DYNLoadInterface.h"
+#include "DYNGeneratorInterface.h"
+#include "DYNShuntCompensatorInterface.h"
+#include "DYNStaticVarCompensatorInterface.h"
+#include "DYNDanglingLineInterface.h"
+#include "DYNVscConverterInterface.h"
+#include "DYNLccConverterInterface.h"
+#include "DYNLineInterface.h"
+#include "DYNTwoWTransformerInterface.h"
+#include "DYNThreeWTransformerInterface.h"
+#include "DYNHvdcLineInterface.h"
+#include "DYNModelConstants.h"
+#include "DYNCommon.h"
+#include "DYNTrace.h"
+#include "DYNMacrosMessage.h"
+
+using std::complex;
+using std::string;
+using std::unordered_map;
+using std::unordered_set;
+using std::vector;
+
+namespace DYN {
+
+/**
+ * @brief link the voltage levels of two buses in the adjacency of the voltage levels
+ * @param voltageLevelOfBus id of the voltage level of each bus
+ * @param bus1 first bus, may be empty
+ * @param bus2 second bus, may be empty
+ * @param neighbours neighbour voltage levels of each voltage level
+ */
+static void
+linkVoltageLevels(const unordered_map<string, string>& voltageLevelOfBus, const std::shared_ptr<BusInterface>& bus1,
+    const std::shared_ptr<BusInterface>& bus2, unordered_map<string, unordered_set<string> >& neighbours) {
+  if (!bus1 || !bus2)
+    return;
+  unordered_map<string, string>::const_iterator itVoltageLevel1 = voltageLevelOfBus.find(bus1->getID());
+  unordered_map<string, string>::const_iterator itVoltageLevel2 = voltageLevelOfBus.find(bus2->getID());
+  if (itVoltageLevel1 == voltageLevelOfBus.end() || itVoltageLevel2 == voltageLevelOfBus.end() || itVoltageLevel1->second == itVoltageLevel2->second)
+    return;
+  neighbours[itVoltageLevel1->second].insert(itVoltageLevel2->second);
+  neighbours[itVoltageLevel2->second].insert(itVoltageLevel1->second);
+}
+
+/**
+ * @brief throw if a component left out of the network model has a dynamic model
+ * @param component component interface, may be empty
+ */
+template<class T>
+static void
+checkNoDynamicModel(const std::shared_ptr<T>& component) {
+  if (component && component->hasDynamicModel())
+    throw DYNError(Error::MODELER, DynamicModelOutsideStudyArea, component->getID());
+}
+
+StudyArea::StudyArea(const boost::shared_ptr<NetworkInterface>& network, const vector<string>& studyVoltageLevels, const int depth) {
+  for (const auto& voltageLevel : network->getVoltageLevels()) {
+    for (const auto& bus : voltageLevel->getBuses())
+      voltageLevelOfBus_[bus->getID()] = voltageLevel->getID();
+  }
+  selectVoltageLevels(network, studyVoltageLevels, depth);
+  sortBranches(network);
+  checkDynamicModels(network);
+}
+
+void
+StudyArea::selectVoltageLevels(const boost::shared_ptr<NetworkInterface>& network, const vector<string>& studyVoltageLevels, const int depth) {
+  unordered_map<string, unordered_set<string> > neighbours;
+  for (const auto& line : network->getLines())
+    linkVoltageLevels(voltageLevelOfBus_, line->getBusInterface1(), line->getBusInterface2(), neighbours);
+  for (const auto& twoWTfo : network->getTwoWTransformers())
+    linkVoltageLevels(voltageLevelOfBus_, twoWTfo->getBusInterface1(), twoWTfo->getBusInterface2(), neighbours);
+  for (const auto& hvdcLine : network->getHvdcLines())
+    linkVoltageLevels(voltageLevelOfBus_, hvdcLine->getConverter1()->getBusInterface(), hvdcLine->getConverter2()->getBusInterface(), neighbours);
+
+  // breadth first search from the study voltage levels, one branch per level
+  unordered_set<string> knownVoltageLevels;
+  for (const auto& voltageLevel : network->getVoltageLevels())
+    knownVoltageLevels.insert(voltageLevel->getID());
+  vector<string> front;
+  for (const auto& id : studyVoltageLevels) {
+    if (knownVoltageLevels.find(id) == knownVoltageLevels.end()) {
+      Trace::warn() << DYNLog(UnknownStudyVoltageLevel, id) << Trace::endline;
+      continue;
+    }
+    if (insideVoltageLevels_.insert(id).second)
+      front.push_back(id);
+  }
+  for (int level = 0; level < depth && !front.empty(); ++level) {
+    vector<string> nextFront;
+    for (const auto& id : front) {
+      unordered_map<string, unordered_set<string> >::const_iterator itNeighbours = neighbours.find(id);
+      if (itNeighbours == neighbours.end())
+        continue;
+      for (const auto& neighbour : itNeighbours->second) {
+        if (insideVoltageLevels_.insert(neighbour).second)
+          nextFront.push_back(neighbour);
+      }
+    }
+    front.swap(nextFront);
+  }
+
+  // the flows of the three windings transformers are not in the network data: they are kept whole in the area
+  for (const auto& threeWTfo : network->getThreeWTransformers()) {
+    const std::shared_ptr<BusInterface> buses[3] = {threeWTfo->getBusInterface1(), threeWTfo->getBusInterface2(), threeWTfo->getBusInterface3()};
+    if (!isInsideBus(buses[0]) && !isInsideBus(buses[1]) && !isInsideBus(buses[2]))
+      continue;
+    for (const auto& bus : buses) {
+      if (isOutsideBus(bus))
+        insideVoltageLevels_.insert(voltageLevelOfBus_[bus->getID()]);
+    }
+  }
+}
+
+void
+StudyArea::sortBranches(const boost::shared_ptr<NetworkInterface>& network) {
+  for (const auto& line : network->getLines()) {
+    const std::shared_ptr<BusInterface> bus1 = line->getBusInterface1();
+    const std::shared_ptr<BusInterface> bus2 = line->getBusInterface2();
+    if (!isOutsideBus(bus1) && !isOutsideBus(bus2) && (isInsideBus(bus1) || isInsideBus(bus2)))
+      continue;
+    leftOutBranches_.insert(line->getID());
+    if (!isInsideBus(bus1) && !isInsideBus(bus2))
+      continue;
+    boundaryBranches_.insert(line->getID());
+    if (isInsideBus(bus1) && line->getInitialConnected1())
+      addBoundaryFlow(bus1, line->getP1(), line->getQ1());
+    if (isInsideBus(bus2) && line->getInitialConnected2())
+      addBoundaryFlow(bus2, line->getP2(), line->getQ2());
+  }
+
+  for (const auto& twoWTfo : network->getTwoWTransformers()) {
+    const std::shared_ptr<BusInterface> bus1 = twoWTfo->getBusInterface1();
+    const std::shared_ptr<BusInterface> bus2 = twoWTfo->getBusInterface2();
+    if (!isOutsideBus(bus1) && !isOutsideBus(bus2) && (isInsideBus(bus1) || isInsideBus(bus2)))
+      continue;
+    leftOutBranches_.insert(twoWTfo->getID());
+    if (!isInsideBus(bus1) && !isInsideBus(bus2))
+      continue;
+    boundaryBranches_.insert(twoWTfo->getID());
+    if (isInsideBus(bus1) && twoWTfo->getInitialConnected1())
+      addBoundaryFlow(bus1, twoWTfo->getP1(), twoWTfo->getQ1());
+    if (isInsideBus(bus2) && twoWTfo->getInitialConnected2())
+      addBoundaryFlow(bus2, twoWTfo->getP2(), twoWTfo->getQ2());
+  }
+
+  for (const auto& threeWTfo : network->getThreeWTransformers()) {
+    if (!isInsideBus(threeWTfo->getBusInterface1()) && !isInsideBus(threeWTfo->getBusInterface2()) && !isInsideBus(threeWTfo->getBusInterface3()))
+      leftOutBranches_.insert(threeWTfo->getID());
+  }
+
+  for (const auto& hvdcLine : network->getHvdcLines()) {
+    const std::shared_ptr<ConverterInterface>& converter1 = hvdcLine->getConverter1();
+    const std::shared_ptr<ConverterInterface>& converter2 = hvdcLine->getConverter2();
+    const std::shared_ptr<BusInterface> bus1 = converter1->getBusInterface();
+    const std::shared_ptr<BusInterface> bus2 = converter2->getBusInterface();
+    if (!isOutsideBus(bus1) && !isOutsideBus(bus2) && (isInsideBus(bus1) || isInsideBus(bus2)))
+      continue;
+    leftOutBranches_.insert(hvdcLine->getID());
+    if (!isInsideBus(bus1) && !isInsideBus(bus2))
+      continue;
+    // the power of a converter is the one it draws from its bus
+    boundaryBranches_.insert(hvdcLine->getID());
+    if (isInsideBus(bus1) && converter1->getInitialConnected())
+      addBoundaryFlow(bus1, converter1->getP(), converter1->getQ());
+    if (isInsideBus(bus2) && converter2->getInitialConnected())
+      addBoundaryFlow(bus2, converter2->getP(), converter2->getQ());
+  }
+}
+
+void
+StudyArea::checkDynamicModels(const boost::shared_ptr<NetworkInterface>& network) const {
+  for (const auto& voltageLevel : network->getVoltageLevels()) {
+    if (isInside(voltageLevel->getID()))
+      continue;
+    for (const auto& bus : voltageLevel->getBuses())
+      checkNoDynamicModel(bus);
+    for (const auto& aSwitch : voltageLevel->getSwitches())
+      checkNoDynamicModel(aSwitch);
+    for (const auto& load : voltageLevel->getLoads())
+      checkNoDynamicModel(load);
+    for (const auto& generator : voltageLevel->getGenerators())
+      checkNoDynamicModel(generator);
+    for (const auto& shunt : voltageLevel->getShuntCompensators())
+      checkNoDynamicModel(shunt);
+    for (const auto& svc : voltageLevel->getStaticVarCompensators())
+      checkNoDynamicModel(svc);
+    for (const auto& danglingLine : voltageLevel->getDanglingLines())
+      checkNoDynamicModel(danglingLine);
+  }
+  for (const auto& line : network->getLines()) {
+    if (!isModelledBranch(line->getID()))
+      checkNoDynamicModel(line);
+  }
+  for (const auto& twoWTfo : network->getTwoWTransformers()) {
+    if (!isModelledBranch(twoWTfo->getID()))
+      checkNoDynamicModel(twoWTfo);
+  }
+  for (const auto& threeWTfo : network->getThreeWTransformers()) {
+    if (!isModelledBranch(threeWTfo->getID()))
+      checkNoDynamicModel(threeWTfo);
+  }
+  for (const auto& hvdcLine : network->getHvdcLines()) {
+    if (!isModelledBranch(hvdcLine->getID()))
+      checkNoDynamicModel(hvdcLine);
+  }
+}
+
+bool
+StudyArea::isInsideBus(const std::shared_ptr<BusInterface>& bus) const {
+  if (!bus)
+    return false;
+  unordered_map<string, string>::const_iterator itVoltageLevel = voltageLevelOfBus_.find(bus->getID());
+  return itVoltageLevel != voltageLevelOfBus_.end() && isInside(itVoltageLevel->second);
+}
+
+bool
+StudyArea::isOutsideBus(const std::shared_ptr<BusInterface>& bus) const {
+  if (!bus)
+    return false;
+  unordered_map<string, string>::const_iterator itVoltageLevel = voltageLevelOfBus_.find(bus->getID());
+  return itVoltageLevel != voltageLevelOfBus_.end() && !isInside(itVoltageLevel->second);
+}
+
+void
+StudyArea::addBoundaryFlow(const std::shared_ptr<BusInterface>& bus, const double p, const double q) {
+  const double vNom = bus->getVNom();
+  if (doubleIsZero(vNom))
+    return;
+  const double u = bus->getV0() / vNom;
+  if (doubleIsZero(u))
+    return;
+  // S = U.conj(Y.U) = |U|^2 conj(Y) in p.u. (base SNREF)
+  const complex<double> y = std::conj(complex<double>(p, q)) / (SNREF * u * u);
+
+  unordered_map<string, unsigned int>::const_iterator itIndex = boundaryBusIndexes_.find(bus->getID());
+  if (itIndex != boundaryBusIndexes_.end()) {
+    admittances_[itIndex->second].value += y;
+    return;
+  }
+  const unsigned int index = static_cast<unsigned int>(boundaryBuses_.size());
+  boundaryBusIndexes_[bus->getID()] = index;
+  boundaryBuses_.push_back(bus->getID());
+  NetworkReduction::Admittance admittance;
+  admittance.row = index;
+  admittance.column = index;
+  admittance.value = y;
+  admittances_.push_back(admittance);
+}
+
+}  // namespace DYN
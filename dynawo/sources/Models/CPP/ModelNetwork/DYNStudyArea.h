@@ -0,0 +1,180 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNStudyArea.h
+ *
+ * @brief Selection of the part of the network modelled around some study voltage levels
+ *
+ */
+#ifndef MODELS_CPP_MODELNETWORK_DYNSTUDYAREA_H_
+#define MODELS_CPP_MODELNETWORK_DYNSTUDYAREA_H_
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "DYNNetworkReduction.h"
+
+namespace DYN {
+class NetworkInterface;
+class BusInterface;
+
+/**
+ * @brief voltage levels of a local study and boundary of the network model
+ *
+ * The study area gathers the study voltage levels and the voltage levels reached from them through at most a given number
+ * of lines, two windings transformers or HVDC links. A three windings transformer connected to the area brings all its
+ * voltage levels into it. Only the components of these voltage levels, and the branches between them, are modelled.
+ *
+ * A branch between the area and the rest of the network is replaced by the flow it carries in the network file, seen from
+ * each of its sides in the area. This flow is drawn at the bus by a constant admittance, so that the boundary adds no variable
+ * and the power flowing through it follows the square of the bus voltage. The components outside the area keep the values
+ * of the network file: none of them may have a dynamic model.
+ */
+class StudyArea : private boost::noncopyable {
+ public:
+  /**
+   * @brief constructor: select the voltage levels of the area and compute the boundary admittances
+   *
+   * @param network network data
+   * @param studyVoltageLevels id of the study voltage levels
+   * @param depth maximum number of branches between a study voltage level and a voltage level of the area
+   *
+   * @throw Error if a component outside the area has a dynamic model
+   */
+  StudyArea(const boost::shared_ptr<NetworkInterface>& network, const std::vector<std::string>& studyVoltageLevels, int depth);
+
+  /**
+   * @brief whether a voltage level is in the area
+   * @param id id of the voltage level
+   * @return @b true if the components of the voltage level are modelled
+   */
+  inline bool isInside(const std::string& id) const {
+    return insideVoltageLevels_.find(id) != insideVoltageLevels_.end();
+  }
+
+  /**
+   * @brief whether a branch is modelled
+   * @param id id of the line, transformer or HVDC link
+   * @return @b false if the branch is outside the area or on its boundary
+   */
+  inline bool isModelledBranch(const std::string& id) const {
+    return leftOutBranches_.find(id) == leftOutBranches_.end();
+  }
+
+  /**
+   * @brief whether a branch is replaced by its flows
+   * @param id id of the line, transformer or HVDC link
+   * @return @b true if the branch connects the area to the rest of the network
+   */
+  inline bool isBoundaryBranch(const std::string& id) const {
+    return boundaryBranches_.find(id) != boundaryBranches_.end();
+  }
+
+  /**
+   * @brief get the number of voltage levels in the area
+   * @return number of voltage levels in the area
+   */
+  inline unsigned int nbInsideVoltageLevels() const {
+    return static_cast<unsigned int>(insideVoltageLevels_.size());
+  }
+
+  /**
+   * @brief get the number of branches on the boundary
+   * @return number of branches replaced by their flows
+   */
+  inline unsigned int nbBoundaryBranches() const {
+    return static_cast<unsigned int>(boundaryBranches_.size());
+  }
+
+  /**
+   * @brief get the buses drawing the flows of the boundary branches
+   * @return id of the boundary buses, in the order of their index
+   */
+  inline const std::vector<std::string>& getBoundaryBuses() const {
+    return boundaryBuses_;
+  }
+
+  /**
+   * @brief get the admittances drawing the flows of the boundary branches
+   * @return diagonal terms of the admittance matrix between the boundary buses
+   */
+  inline const std::vector<NetworkReduction::Admittance>& getAdmittances() const {
+    return admittances_;
+  }
+
+ private:
+  /**
+   * @brief select the voltage levels of the area
+   *
+   * @param network network data
+   * @param studyVoltageLevels id of the study voltage levels
+   * @param depth maximum number of branches between a study voltage level and a voltage level of the area
+   */
+  void selectVoltageLevels(const boost::shared_ptr<NetworkInterface>& network, const std::vector<std::string>& studyVoltageLevels, int depth);
+
+  /**
+   * @brief sort the branches and compute the admittances replacing the boundary branches
+   *
+   * @param network network data
+   */
+  void sortBranches(const boost::shared_ptr<NetworkInterface>& network);
+
+  /**
+   * @brief check that no component left out of the network model has a dynamic model
+   *
+   * @param network network data
+   */
+  void checkDynamicModels(const boost::shared_ptr<NetworkInterface>& network) const;
+
+  /**
+   * @brief whether a bus is in the area
+   * @param bus bus interface, may be empty
+   * @return @b true if the bus exists and its voltage level is in the area
+   */
+  bool isInsideBus(const std::shared_ptr<BusInterface>& bus) const;
+
+  /**
+   * @brief whether a bus is outside the area
+   * @param bus bus interface, may be empty
+   * @return @b true if the bus exists and its voltage level is not in the area
+   */
+  bool isOutsideBus(const std::shared_ptr<BusInterface>& bus) const;
+
+  /**
+   * @brief draw the flow of a boundary branch at a bus of the area
+   *
+   * @param bus bus of the area
+   * @param p active power flowing from the bus into the branch in MW
+   * @param q reactive power flowing from the bus into the branch in Mvar
+   */
+  void addBoundaryFlow(const std::shared_ptr<BusInterface>& bus, double p, double q);
+
+ private:
+  std::unordered_map<std::string, std::string> voltageLevelOfBus_;  ///< id of the voltage level of each bus
+  std::unordered_set<std::string> insideVoltageLevels_;  ///< id of the voltage levels of the area
+  std::unordered_set<std::string> leftOutBranches_;  ///< id of the branches outside the area or on its boundary
+  std::unordered_set<std::string> boundaryBranches_;  ///< id of the branches between the area and the rest of the network
+  std::unordered_map<std::string, unsigned int> boundaryBusIndexes_;  ///< index of each boundary bus
+  std::vector<std::string> boundaryBuses_;  ///< id of the buses drawing the flows of the boundary branches
+  std::vector<NetworkReduction::Admittance> admittances_;  ///< admittance drawing the flows at each boundary bus
+};
+
+}  // namespace DYN
+
+#endif  // MODELS_CPP_MODELNETWORK_DYNSTUDYAREA_H_
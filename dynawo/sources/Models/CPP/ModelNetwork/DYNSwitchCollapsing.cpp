@@ -0,0 +1,112 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNSwitchCollapsing.cpp
+ *
+ * @brief Merging of the buses joined by closed switches into electrical buses
+ *
+ */
+#include "DYNSwitchCollapsing.h"
+#include "DYNNetworkInterface.h"
+#include "DYNVoltageLevelInterface.h"
+#include "DYNBusInterface.h"
+#include "DYNSwitchInterface.h"
+#include "DYNTrace.h"
+#include "DYNMacrosMessage.h"
+
+using std::string;
+using std::unordered_map;
+using std::unordered_set;
+using std::vector;
+
+namespace DYN {
+
+/**
+ * @brief find the root of the tree of a bus, compressing the path to it
+ * @param id id of the bus
+ * @param parents parent of each bus already joined to another one
+ * @return id of the root bus
+ */
+static string
+findRoot(const string& id, unordered_map<string, string>& parents) {
+  string root = id;
+  unordered_map<string, string>::const_iterator itParent = parents.find(root);
+  while (itParent != parents.end()) {
+    root = itParent->second;
+    itParent = parents.find(root);
+  }
+  string current = id;
+  while (current != root) {
+    string& parent = parents[current];
+    current = parent;
+    parent = root;
+  }
+  return root;
+}
+
+SwitchCollapsing::SwitchCollapsing(const boost::shared_ptr<NetworkInterface>& network, const vector<string>& collapsedVoltageLevels) {
+  unordered_set<string> unknownVoltageLevels(collapsedVoltageLevels.begin(), collapsedVoltageLevels.end());
+  unordered_map<string, string> parents;
+  // roots of the trees containing a bus whose variables are connected to other models
+  unordered_set<string> pinnedRoots;
+
+  for (const auto& voltageLevel : network->getVoltageLevels()) {
+    if (unknownVoltageLevels.erase(voltageLevel->getID()) == 0)
+      continue;
+    if (voltageLevel->isNodeBreakerTopology()) {
+      Trace::warn() << DYNLog(NodeBreakerVoltageLevelNotCollapsed, voltageLevel->getID()) << Trace::endline;
+      continue;
+    }
+    for (const auto& bus : voltageLevel->getBuses()) {
+      if (bus->hasConnection())
+        pinnedRoots.insert(bus->getID());
+    }
+    for (const auto& aSwitch : voltageLevel->getSwitches()) {
+      const std::shared_ptr<BusInterface> bus1 = aSwitch->getBusInterface1();
+      const std::shared_ptr<BusInterface> bus2 = aSwitch->getBusInterface2();
+      if (aSwitch->isOpen() || aSwitch->hasDynamicModel() || !bus1 || !bus2 || bus1->hasDynamicModel() || bus2->hasDynamicModel())
+        continue;
+      const string root1 = findRoot(bus1->getID(), parents);
+      const string root2 = findRoot(bus2->getID(), parents);
+      if (root1 != root2) {
+        const bool pinned1 = pinnedRoots.find(root1) != pinnedRoots.end();
+        const bool pinned2 = pinnedRoots.find(root2) != pinnedRoots.end();
+        if (pinned1 && pinned2)
+          continue;
+        // a bus whose variables are connected to other models keeps representing its electrical bus
+        if (pinned2)
+          parents[root1] = root2;
+        else
+          parents[root2] = root1;
+      }
+      // a closed switch between two buses already merged is useless
+      collapsedSwitches_.insert(aSwitch->getID());
+    }
+  }
+  for (const auto& voltageLevelId : unknownVoltageLevels)
+    Trace::warn() << DYNLog(UnknownCollapsedVoltageLevel, voltageLevelId) << Trace::endline;
+
+  for (const auto& parent : parents)
+    representatives_[parent.first] = findRoot(parent.first, parents);
+}
+
+const string&
+SwitchCollapsing::getRepresentative(const string& id) const {
+  unordered_map<string, string>::const_iterator itRepresentative = representatives_.find(id);
+  if (itRepresentative == representatives_.end())
+    return id;
+  return itRepresentative->second;
+}
+
+}  // namespace DYN
@@ -0,0 +1,104 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNSwitchCollapsing.h
+ *
+ * @brief Merging of the buses joined by closed switches into electrical buses
+ *
+ */
+#ifndef MODELS_CPP_MODELNETWORK_DYNSWITCHCOLLAPSING_H_
+#define MODELS_CPP_MODELNETWORK_DYNSWITCHCOLLAPSING_H_
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace DYN {
+class NetworkInterface;
+
+/**
+ * @brief collapsing of the closed switches of some voltage levels
+ *
+ * A closed switch of a collapsed voltage level is removed from the network, and the buses it joins are merged into
+ * a single electrical bus: the components of the merged buses are connected to the bus chosen to represent them.
+ * Each removed switch saves its two current variables, and each merged bus its two voltage variables.
+ * As the size of the model is fixed for the whole simulation, a removed switch can not be operated anymore.
+ *
+ * The switches with a dynamic model, or between buses with a dynamic model, are kept, as well as the switches
+ * that would merge two buses whose variables are connected to other models. Only the bus-breaker voltage levels
+ * are collapsed: the closed switches that are not retained are already merged by the node-breaker topology.
+ */
+class SwitchCollapsing : private boost::noncopyable {
+ public:
+  /**
+   * @brief constructor: select the switches to remove and the buses to merge
+   *
+   * @param network network data
+   * @param collapsedVoltageLevels id of the voltage levels whose switches are collapsed
+   */
+  SwitchCollapsing(const boost::shared_ptr<NetworkInterface>& network, const std::vector<std::string>& collapsedVoltageLevels);
+
+  /**
+   * @brief whether a switch is removed
+   * @param id id of the switch
+   * @return @b true if the buses of the switch are merged
+   */
+  inline bool isCollapsedSwitch(const std::string& id) const {
+    return collapsedSwitches_.find(id) != collapsedSwitches_.end();
+  }
+
+  /**
+   * @brief whether a bus is merged into another one
+   * @param id id of the bus
+   * @return @b true if the bus is represented by another bus
+   */
+  inline bool isMergedBus(const std::string& id) const {
+    return representatives_.find(id) != representatives_.end();
+  }
+
+  /**
+   * @brief get the bus representing the electrical bus of a bus
+   * @param id id of the bus
+   * @return id of the bus representing it, the bus itself if it is not merged
+   */
+  const std::string& getRepresentative(const std::string& id) const;
+
+  /**
+   * @brief get the number of removed switches
+   * @return number of removed switches
+   */
+  inline unsigned int nbCollapsedSwitches() const {
+    return static_cast<unsigned int>(collapsedSwitches_.size());
+  }
+
+  /**
+   * @brief get the number of merged buses
+   * @return number of buses represented by another bus
+   */
+  inline unsigned int nbMergedBuses() const {
+    return static_cast<unsigned int>(representatives_.size());
+  }
+
+ private:
+  std::unordered_set<std::string> collapsedSwitches_;  ///< id of the removed switches
+  std::unordered_map<std::string, std::string> representatives_;  ///< id of the bus representing each merged bus
+};
+
+}  // namespace DYN
+
+#endif  // MODELS_CPP_MODELNETWORK_DYNSWITCHCOLLAPSING_H_
@@ -22,6 +22,7 @@
 #include "DYNBusInterfaceIIDM.h"
 #include "DYNModelVoltageLevel.h"
 #include "DYNModelBus.h"
+#include "DYNBranchInjections.h"
 #include "DYNModelNetwork.h"
 #include "TLTimelineFactory.h"
 #include "DYNSparseMatrix.h"
@@ -902,6 +903,51 @@ TEST(ModelsModelNetwork, ModelNetworkBusContainer) {
   ASSERT_FALSE(bus3->numSubNetworkSet());
   ASSERT_EQ(container.getSubNetworks().size(), 0);
 
+  // incremental update of the sub-networks
+  container.resetNeighbors();
+  bus1->addNeighbor(bus2);
+  bus2->addNeighbor(bus1);
+  container.updateSubNetworks(0);
+  ASSERT_EQ(bus1->numSubNetwork(), 0);
+  ASSERT_EQ(bus2->numSubNetwork(), 0);
+  ASSERT_EQ(bus3->numSubNetwork(), 1);
+  ASSERT_EQ(container.getSubNetworks().size(), 2);
+
+  // the bus 3 is connected to the bus 2: the sub-networks are merged
+  container.resetNeighbors();
+  bus1->addNeighbor(bus2);
+  bus2->addNeighbor(bus1);
+  bus2->addNeighbor(bus3);
+  bus3->addNeighbor(bus2);
+  container.updateSubNetworks(0);
+  ASSERT_EQ(bus1->numSubNetwork(), 0);
+  ASSERT_EQ(bus2->numSubNetwork(), 0);
+  ASSERT_EQ(bus3->numSubNetwork(), 0);
+  ASSERT_EQ(container.getSubNetworks().size(), 1);
+  ASSERT_EQ(container.getSubNetworks()[0]->nbBus(), 3);
+
+  // the bus 1 is disconnected: the sub-network is split
+  container.resetNeighbors();
+  bus2->addNeighbor(bus3);
+  bus3->addNeighbor(bus2);
+  container.updateSubNetworks(0);
+  ASSERT_EQ(bus1->numSubNetwork(), 0);
+  ASSERT_EQ(bus2->numSubNetwork(), 1);
+  ASSERT_EQ(bus3->numSubNetwork(), 1);
+  ASSERT_EQ(container.getSubNetworks().size(), 2);
+
+  // same neighbors: the sub-networks are kept
+  const boost::shared_ptr<SubNetwork> subNetwork1 = container.getSubNetworks()[1];
+  container.resetNeighbors();
+  bus2->addNeighbor(bus3);
+  bus3->addNeighbor(bus2);
+  container.updateSubNetworks(0);
+  ASSERT_EQ(container.getSubNetworks().size(), 2);
+  ASSERT_EQ(container.getSubNetworks()[1], subNetwork1);
+  ASSERT_EQ(bus2->numSubNetwork(), 1);
+  ASSERT_EQ(bus3->numSubNetwork(), 1);
+  container.resetSubNetwork();
+
   container.evalF(UNDEFINED_EQ);
   ASSERT_DOUBLE_EQUALS_DYNAWO(f1[0], 0.1);
   ASSERT_DOUBLE_EQUALS_DYNAWO(f1[1], 0.01);
@@ -1005,4 +1051,73 @@ TEST(ModelsModelNetwork, ModelNetworkBusCurrentU) {
   bus->switchOff();
   ASSERT_EQ(bus->getCurrentU(ModelBus::UType_), 0);
 }
+
+TEST(ModelsModelNetwork, ModelNetworkBranchInjections) {
+  powsybl::iidm::Network networkIIDM1("test1", "test1");
+  powsybl::iidm::Network networkIIDM2("test2", "test2");
+  std::pair<std::shared_ptr<ModelBus>, std::shared_ptr<VoltageLevelInterfaceIIDM> > p1 = createModelBus(false, false, networkIIDM1, false);
+  std::pair<std::shared_ptr<ModelBus>, std::shared_ptr<VoltageLevelInterfaceIIDM> > p2 = createModelBus(false, false, networkIIDM2, false);
+  std::vector<std::shared_ptr<ModelBus> > buses = {p1.first, p2.first};
+  std::vector<std::vector<double> > y(2, std::vector<double>(4, 0.));
+  std::vector<std::vector<double> > yp(2, std::vector<double>(4, 0.));
+  std::vector<std::vector<double> > f(2, std::vector<double>(2, 0.));
+  std::vector<std::vector<double> > z(2);
+  std::vector<std::unique_ptr<bool[]> > zConnected(2);
+  y[0][ModelBus::urNum_] = 1.;
+  y[0][ModelBus::uiNum_] = 0.5;
+  y[1][ModelBus::urNum_] = 2.;
+  y[1][ModelBus::uiNum_] = 0.25;
+  for (unsigned int i = 0; i < 2; ++i) {
+    int offSet = 0;
+    buses[i]->init(offSet);
+    buses[i]->initSize();
+    z[i].assign(buses[i]->sizeZ(), 0.);
+    z[i][ModelBus::switchOffNum_] = -1;
+    zConnected[i].reset(new bool[buses[i]->sizeZ()]);
+    for (int j = 0; j < buses[i]->sizeZ(); ++j)
+      zConnected[i][j] = true;
+    buses[i]->setReferenceZ(&z[i][0], zConnected[i].get(), 0);
+    buses[i]->setReferenceY(&y[i][0], &yp[i][0], &f[i][0], 0, 0);
+  }
+
+  BranchInjections branchInjections;
+  ASSERT_EQ(branchInjections.size(), 0);
+  ASSERT_EQ(branchInjections.addBranch(buses[0].get(), buses[1].get()), 0);
+  ASSERT_EQ(branchInjections.addBranch(buses[0].get(), nullptr), 1);
+  ASSERT_EQ(branchInjections.size(), 2);
+  const double admittances[BranchInjections::NB_CURRENTS][BranchInjections::NB_VOLTAGES] = {
+    {1., 2., 3., 4.},
+    {5., 6., 7., 8.},
+    {-1., -2., -3., -4.},
+    {-5., -6., -7., -8.}
+  };
+  branchInjections.setAdmittances(0, admittances, true, true);
+  branchInjections.setAdmittances(1, admittances, true, false);
+
+  for (const auto& bus : buses)
+    bus->resetNodeInjection();
+  branchInjections.evalNodeInjection();
+  for (const auto& bus : buses)
+    bus->evalF(UNDEFINED_EQ);
+  // the bus 1 receives the side 1 currents of both branches, the bus 2 the side 2 current of the branch 0
+  ASSERT_DOUBLE_EQUALS_DYNAWO(f[0][0], 11.);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(f[0][1], 32.);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(f[1][0], -9.);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(f[1][1], -24.);
+
+  // the side 2 of the branch 0 is opened
+  branchInjections.setAdmittances(0, admittances, true, false);
+  for (const auto& bus : buses)
+    bus->resetNodeInjection();
+  branchInjections.evalNodeInjection();
+  for (const auto& bus : buses)
+    bus->evalF(UNDEFINED_EQ);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(f[0][0], 4.);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(f[0][1], 16.);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(f[1][0], -2.);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(f[1][1], -8.);
+
+  branchInjections.clear();
+  ASSERT_EQ(branchInjections.size(), 0);
+}
 }  // namespace DYN
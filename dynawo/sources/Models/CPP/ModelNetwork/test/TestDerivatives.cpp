@@ -54,6 +54,85 @@ TEST(ModelsModelNetwork, ModelNetworkDerivative) {
   ASSERT_EQ(derivatives.empty(), false);
 }
 
+TEST(ModelsModelNetwork, ModelNetworkDerivativeReplay) {
+  Derivatives derivatives;
+  derivatives.addValue(42, 5.);
+  derivatives.addValue(8, 42.);
+  derivatives.addValue(42, 8.);
+  const auto& values = derivatives.getValues();
+  const auto& indices = derivatives.getIndices();
+  ASSERT_EQ(indices.size(), 2);
+  ASSERT_EQ(indices[0], 42);
+  ASSERT_EQ(indices[1], 8);
+
+  // same sequence of contributions
+  derivatives.reset();
+  derivatives.addValue(42, 1.);
+  derivatives.addValue(8, 2.);
+  derivatives.addValue(42, 3.);
+  ASSERT_EQ(indices.size(), 2);
+  ASSERT_EQ(values[0], 4.);
+  ASSERT_EQ(values[1], 2.);
+
+  // the sequence changes: the variables already known keep their slot
+  derivatives.reset();
+  derivatives.addValue(42, 1.);
+  derivatives.addValue(4, 2.);
+  derivatives.addValue(8, 3.);
+  ASSERT_EQ(indices.size(), 3);
+  ASSERT_EQ(indices[2], 4);
+  ASSERT_EQ(values[0], 1.);
+  ASSERT_EQ(values[1], 3.);
+  ASSERT_EQ(values[2], 2.);
+
+  // shorter sequence after the change
+  derivatives.reset();
+  derivatives.addValue(42, 6.);
+  ASSERT_EQ(values[0], 6.);
+  ASSERT_EQ(values[1], 0.);
+  ASSERT_EQ(values[2], 0.);
+}
+
+TEST(ModelsModelNetwork, ModelNetworkDerivativeSaveRestore) {
+  Derivatives derivatives;
+  derivatives.addValue(42, 5.);
+  derivatives.addValue(8, 2.);
+  derivatives.save();
+  derivatives.addValue(8, 3.);
+  derivatives.addValue(4, 7.);
+  const auto& values = derivatives.getValues();
+  const auto& indices = derivatives.getIndices();
+  ASSERT_EQ(indices.size(), 3);
+  ASSERT_EQ(values[1], 5.);
+  ASSERT_EQ(values[2], 7.);
+
+  // the saved contributions are back, the slot created after the save is empty
+  derivatives.restore();
+  ASSERT_EQ(indices.size(), 3);
+  ASSERT_EQ(values[0], 5.);
+  ASSERT_EQ(values[1], 2.);
+  ASSERT_EQ(values[2], 0.);
+
+  // the next calls replay the sequence recorded after the save
+  derivatives.addValue(8, 1.);
+  derivatives.addValue(4, 6.);
+  ASSERT_EQ(indices.size(), 3);
+  ASSERT_EQ(values[0], 5.);
+  ASSERT_EQ(values[1], 3.);
+  ASSERT_EQ(values[2], 6.);
+
+  BusDerivatives busDerivatives;
+  busDerivatives.addDerivative(IR_DERIVATIVE, 42, 5.);
+  busDerivatives.addDerivative(II_DERIVATIVE, 42, 6.);
+  busDerivatives.save();
+  busDerivatives.addDerivative(IR_DERIVATIVE, 42, 1.);
+  busDerivatives.addDerivative(II_DERIVATIVE, 8, 2.);
+  busDerivatives.restore();
+  ASSERT_EQ(busDerivatives.getValues(IR_DERIVATIVE)[0], 5.);
+  ASSERT_EQ(busDerivatives.getValues(II_DERIVATIVE)[0], 6.);
+  ASSERT_EQ(busDerivatives.getValues(II_DERIVATIVE)[1], 0.);
+}
+
 TEST(ModelsModelNetwork, ModelNetworkBusDerivative) {
   BusDerivatives derivatives;
   ASSERT_EQ(derivatives.getValues(IR_DERIVATIVE).size(), 0);
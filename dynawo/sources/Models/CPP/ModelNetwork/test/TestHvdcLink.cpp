@@ -44,6 +44,8 @@
 #include "CSTRConstraint.h"
 
 #include "DYNModelHvdcLink.h"
+#include "DYNHvdcInjections.h"
+#include "DYNDerivative.h"
 #include "make_unique.hpp"
 #include "gtest_dynawo.h"
 
@@ -673,4 +675,86 @@ TEST(ModelsModelNetwork, ModelNetworkHvdcLinkJt) {
   hvdc->evalJtPrim(0, smjPrime);
   ASSERT_EQ(smjPrime.nbElem(), 0);
 }
+
+TEST(ModelsModelNetwork, ModelNetworkHvdcLinkInjections) {
+  powsybl::iidm::Network networkIIDM("MyNetwork", "MyNetwork");
+  std::tuple<std::shared_ptr<ModelHvdcLink>, std::shared_ptr<NetworkInterfaceIIDM>, std::shared_ptr<ModelVoltageLevel> > p
+      = createModelHvdcLink(false, VSC, networkIIDM);
+  std::shared_ptr<ModelHvdcLink> hvdc = std::get<0>(p);
+  std::string startingPoint = "warm";
+  fillParameters(hvdc, startingPoint);
+  hvdc->initSize();
+  int offSet = 0;
+  hvdc->init(offSet);
+
+  std::shared_ptr<ModelBus> bus = hvdc->getModelBus1();
+  std::shared_ptr<ModelBus> bus2 = hvdc->getModelBus2();
+  std::vector<double> yBus(bus->sizeY(), 0.);
+  std::vector<double> ypBus(bus->sizeY(), 0.);
+  std::vector<double> fBus(bus->sizeF(), 0.);
+  bus->setReferenceY(&yBus[0], &ypBus[0], &fBus[0], 0, 0);
+  yBus[ModelBus::urNum_] = 1.1;
+  yBus[ModelBus::uiNum_] = 0.2;
+  std::vector<double> yBus2(bus2->sizeY(), 0.);
+  std::vector<double> ypBus2(bus2->sizeY(), 0.);
+  std::vector<double> fBus2(bus2->sizeF(), 0.);
+  bus2->setReferenceY(&yBus2[0], &ypBus2[0], &fBus2[0], 0, 0);
+  yBus2[ModelBus::urNum_] = 0.9;
+  yBus2[ModelBus::uiNum_] = -0.1;
+
+  HvdcInjections hvdcInjections;
+  ASSERT_TRUE(hvdc->addToHvdcInjections(hvdcInjections));
+  ASSERT_EQ(hvdcInjections.size(), 1);
+
+  bus2->resetNodeInjection();
+  bus2->resetCurrentUStatus();
+  hvdc->evalNodeInjection();
+  bus2->evalF(UNDEFINED_EQ);
+  const double ir2 = fBus2[0];
+  const double ii2 = fBus2[1];
+  bus2->resetNodeInjection();
+
+  // the node injections computed together give the same currents and Jacobian terms as the component model
+  bus->resetNodeInjection();
+  bus->resetCurrentUStatus();
+  hvdc->evalNodeInjection();
+  bus->evalF(UNDEFINED_EQ);
+  const double ir = fBus[0];
+  const double ii = fBus[1];
+  ASSERT_NE(ir, 0.);
+  bus->resetNodeInjection();
+  hvdcInjections.evalNodeInjection();
+  bus->evalF(UNDEFINED_EQ);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(fBus[0], ir);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(fBus[1], ii);
+
+  bus->initDerivatives();
+  hvdc->evalDerivatives(0.);
+  const std::vector<double> irDerivatives = bus->derivatives()->getValues(IR_DERIVATIVE);
+  const std::vector<double> iiDerivatives = bus->derivatives()->getValues(II_DERIVATIVE);
+  bus->initDerivatives();
+  hvdcInjections.evalDerivatives();
+  ASSERT_EQ(bus->derivatives()->getValues(IR_DERIVATIVE).size(), irDerivatives.size());
+  ASSERT_EQ(bus->derivatives()->getValues(II_DERIVATIVE).size(), iiDerivatives.size());
+  for (unsigned int i = 0; i < irDerivatives.size(); ++i)
+    ASSERT_DOUBLE_EQUALS_DYNAWO(bus->derivatives()->getValues(IR_DERIVATIVE)[i], irDerivatives[i]);
+  for (unsigned int i = 0; i < iiDerivatives.size(); ++i)
+    ASSERT_DOUBLE_EQUALS_DYNAWO(bus->derivatives()->getValues(II_DERIVATIVE)[i], iiDerivatives[i]);
+  bus2->evalF(UNDEFINED_EQ);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(fBus2[0], ir2);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(fBus2[1], ii2);
+
+  // a link with a disconnected converter does not inject any active power
+  hvdc->setConnected2(OPEN);
+  bus->resetNodeInjection();
+  bus->resetCurrentUStatus();
+  hvdc->evalNodeInjection();
+  bus->evalF(UNDEFINED_EQ);
+  const double irDisconnected = fBus[0];
+  bus->resetNodeInjection();
+  hvdcInjections.evalNodeInjection();
+  bus->evalF(UNDEFINED_EQ);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(fBus[0], irDisconnected);
+  ASSERT_NE(fBus[0], ir);
+}
 }  // namespace DYN
@@ -33,6 +33,8 @@
 #include "DYNSparseMatrix.h"
 #include "DYNVariable.h"
 #include "DYNElement.h"
+#include "DYNDerivative.h"
+#include "DYNBranchInjections.h"
 
 #include "make_unique.hpp"
 #include "gtest_dynawo.h"
@@ -41,7 +43,7 @@ using boost::shared_ptr;
 
 namespace DYN {
 static std::pair<std::unique_ptr<ModelLine>, std::shared_ptr<ModelVoltageLevel> >  // need to return the voltage level so that it is not destroyed
-createModelLine(bool open, bool initModel, bool closed1 = true, bool closed2 = true) {
+createModelLine(bool open, bool initModel, bool closed1 = true, bool closed2 = true, std::vector<std::shared_ptr<ModelBus> >* buses = nullptr) {
   powsybl::iidm::Network networkIIDM("test", "test");
 
   powsybl::iidm::Substation& s = networkIIDM.newSubstation()
@@ -179,6 +181,8 @@ createModelLine(bool open, bool initModel, bool closed1 = true, bool closed2 = t
     if (!initModel)
       z1[ModelBus::switchOffNum_] = -1;
     bus1->init(offset);
+    if (buses)
+      buses->push_back(bus1);
   }
   if (closed2) {
     std::shared_ptr<ModelBus> bus2 = std::make_shared<ModelBus>(bus2ItfIIDM, false);
@@ -201,10 +205,54 @@ createModelLine(bool open, bool initModel, bool closed1 = true, bool closed2 = t
     if (!initModel)
       z2[ModelBus::switchOffNum_] = -1;
     bus2->init(offset);
+    if (buses)
+      buses->push_back(bus2);
   }
   return std::make_pair(std::move(dl), vl);
 }
 
+/**
+ * @brief get the derivative of the current of a bus with respect to a variable
+ * @param bus bus receiving the current
+ * @param type real or imaginary part of the current
+ * @param numVar index of the variable
+ * @return sum of the derivatives added for this variable
+ */
+static double
+getBusDerivative(ModelBus& bus, typeDerivative_t type, int numVar) {
+  const std::vector<int>& indices = bus.derivatives()->getIndices(type);
+  const std::vector<double>& values = bus.derivatives()->getValues(type);
+  double value = 0.;
+  for (size_t i = 0; i < indices.size(); ++i) {
+    if (indices[i] == numVar)
+      value += values[i];
+  }
+  return value;
+}
+
+/**
+ * @brief check the admittance terms of the line in a connection state, read from the derivatives added to its buses
+ * @param state connection state of the line
+ * @param expected derivatives of each current with respect to each voltage
+ */
+static void
+checkLineAdmittances(State state, const double (&expected)[BranchInjections::NB_CURRENTS][BranchInjections::NB_VOLTAGES]) {
+  std::vector<std::shared_ptr<ModelBus> > buses;
+  const std::unique_ptr<ModelLine> dl = createModelLine(false, false, true, true, &buses).first;
+  ASSERT_EQ(buses.size(), 2u);
+  dl->setConnectionState(state);
+  dl->evalYMat();
+  dl->evalDerivatives(0.);
+
+  const int voltages[BranchInjections::NB_VOLTAGES] = {buses[0]->urYNum(), buses[0]->uiYNum(), buses[1]->urYNum(), buses[1]->uiYNum()};
+  for (unsigned int j = 0; j < BranchInjections::NB_VOLTAGES; ++j) {
+    ASSERT_DOUBLE_EQUALS_DYNAWO(getBusDerivative(*buses[0], IR_DERIVATIVE, voltages[j]), expected[BranchInjections::IR1][j]);
+    ASSERT_DOUBLE_EQUALS_DYNAWO(getBusDerivative(*buses[0], II_DERIVATIVE, voltages[j]), expected[BranchInjections::II1][j]);
+    ASSERT_DOUBLE_EQUALS_DYNAWO(getBusDerivative(*buses[1], IR_DERIVATIVE, voltages[j]), expected[BranchInjections::IR2][j]);
+    ASSERT_DOUBLE_EQUALS_DYNAWO(getBusDerivative(*buses[1], II_DERIVATIVE, voltages[j]), expected[BranchInjections::II2][j]);
+  }
+}
+
 
 TEST(ModelsModelNetwork, ModelNetworkLineInitializationClosed) {
   const std::unique_ptr<ModelLine> dl = createModelLine(false, false).first;
@@ -1372,5 +1420,36 @@ TEST(ModelsModelNetwork, ModelNetworkLineJt) {
   ASSERT_EQ(smjInit.nbElem(), 0);
 }
 
+TEST(ModelsModelNetwork, ModelNetworkLineAdmittances) {
+  // rows: ir1, ii1, ir2, ii2, columns: ur1, ui1, ur2, ui2
+  const double closed[BranchInjections::NB_CURRENTS][BranchInjections::NB_VOLTAGES] = {
+    {0.79166666666666663, -0.70833333333333337, -0.041666666666666664, -0.041666666666666671},
+    {0.70833333333333337, 0.79166666666666663, 0.041666666666666671, -0.041666666666666664},
+    {-0.041666666666666664, -0.041666666666666671, 1.5416666666666667, -0.33333333333333331},
+    {0.041666666666666671, -0.041666666666666664, 0.33333333333333331, 1.5416666666666667}
+  };
+  checkLineAdmittances(CLOSED, closed);
+
+  // the open side is seen from the closed one as its shunt in series with the line impedance
+  const double closed1[BranchInjections::NB_CURRENTS][BranchInjections::NB_VOLTAGES] = {
+    {0.79213189113747384, -0.71048499651081642, 0., 0.},
+    {0.71048499651081642, 0.79213189113747384, 0., 0.},
+    {0., 0., 0., 0.},
+    {0., 0., 0., 0.}
+  };
+  checkLineAdmittances(CLOSED_1, closed1);
+
+  const double closed2[BranchInjections::NB_CURRENTS][BranchInjections::NB_VOLTAGES] = {
+    {0., 0., 0., 0.},
+    {0., 0., 0., 0.},
+    {0., 0., 1.5438461538461539, -0.33576923076923076},
+    {0., 0., 0.33576923076923076, 1.5438461538461539}
+  };
+  checkLineAdmittances(CLOSED_2, closed2);
+
+  const double opened[BranchInjections::NB_CURRENTS][BranchInjections::NB_VOLTAGES] = {};
+  checkLineAdmittances(OPEN, opened);
+}
+
 
 }  // namespace DYN
@@ -25,6 +25,8 @@
 #include "DYNCurrentLimitInterfaceIIDM.h"
 #include "DYNBusInterfaceIIDM.h"
 #include "DYNModelLoad.h"
+#include "DYNLoadInjections.h"
+#include "DYNDerivative.h"
 #include "DYNModelVoltageLevel.h"
 #include "DYNModelBus.h"
 #include "DYNModelNetwork.h"
@@ -706,4 +708,93 @@ TEST(ModelsModelNetwork, ModelNetworkLoadJt) {
   delete[] zConnected;
 }
 
+TEST(ModelsModelNetwork, ModelNetworkLoadInjections) {
+  powsybl::iidm::Network networkIIDM("MyNetwork", "MyNetwork");
+  std::tuple<std::shared_ptr<ModelLoad>,
+  std::shared_ptr<ModelVoltageLevel>, std::shared_ptr<ModelBus>, std::shared_ptr<BusInterfaceIIDM>,
+  std::shared_ptr<VoltageLevelInterfaceIIDM>> myTuple = createModelLoad(false, false, networkIIDM);
+  std::shared_ptr<ModelLoad> load = std::get<0>(myTuple);
+  std::shared_ptr<ModelBus> bus = std::get<2>(myTuple);
+  std::unordered_map<std::string, ParameterModeler> parametersModels;
+  {
+    ParameterModeler param = ParameterModeler("load_alpha", VAR_TYPE_DOUBLE, EXTERNAL_PARAMETER);
+    param.setValue<double>(1.5, PAR);
+    parametersModels.insert(std::make_pair(param.getName(), param));
+  }
+  {
+    ParameterModeler param = ParameterModeler("load_beta", VAR_TYPE_DOUBLE, EXTERNAL_PARAMETER);
+    param.setValue<double>(2., PAR);
+    parametersModels.insert(std::make_pair(param.getName(), param));
+  }
+  {
+    ParameterModeler param = ParameterModeler("load_isRestorative", VAR_TYPE_BOOL, EXTERNAL_PARAMETER);
+    param.setValue<bool>(false, PAR);
+    parametersModels.insert(std::make_pair(param.getName(), param));
+  }
+  {
+    ParameterModeler param = ParameterModeler("load_isControllable", VAR_TYPE_BOOL, EXTERNAL_PARAMETER);
+    param.setValue<bool>(false, PAR);
+    parametersModels.insert(std::make_pair(param.getName(), param));
+  }
+  load->setSubModelParameters(parametersModels);
+  load->initSize();
+  int yNum = 0;
+  load->init(yNum);
+  ASSERT_EQ(load->sizeY(), 0);
+
+  std::vector<double> yBus(bus->sizeY(), 0.);
+  std::vector<double> ypBus(bus->sizeY(), 0.);
+  std::vector<double> fBus(bus->sizeF(), 0.);
+  bus->setReferenceY(&yBus[0], &ypBus[0], &fBus[0], 0, 0);
+  yBus[ModelBus::urNum_] = 1.1;
+  yBus[ModelBus::uiNum_] = 0.2;
+
+  LoadInjections loadInjections;
+  ASSERT_TRUE(load->addToLoadInjections(loadInjections));
+  ASSERT_EQ(loadInjections.size(), 1);
+
+  // the static loads give the same currents and Jacobian terms as the load model
+  bus->resetNodeInjection();
+  bus->resetCurrentUStatus();
+  load->evalNodeInjection();
+  bus->evalF(UNDEFINED_EQ);
+  const double ir = fBus[0];
+  const double ii = fBus[1];
+  ASSERT_NE(ir, 0.);
+  bus->resetNodeInjection();
+  loadInjections.evalNodeInjection();
+  bus->evalF(UNDEFINED_EQ);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(fBus[0], ir);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(fBus[1], ii);
+
+  bus->initDerivatives();
+  load->evalDerivatives(0.);
+  const std::vector<double> irDerivatives = bus->derivatives()->getValues(IR_DERIVATIVE);
+  const std::vector<double> iiDerivatives = bus->derivatives()->getValues(II_DERIVATIVE);
+  bus->initDerivatives();
+  loadInjections.evalDerivatives();
+  ASSERT_EQ(bus->derivatives()->getValues(IR_DERIVATIVE).size(), irDerivatives.size());
+  ASSERT_EQ(bus->derivatives()->getValues(II_DERIVATIVE).size(), iiDerivatives.size());
+  for (unsigned int i = 0; i < irDerivatives.size(); ++i)
+    ASSERT_DOUBLE_EQUALS_DYNAWO(bus->derivatives()->getValues(IR_DERIVATIVE)[i], irDerivatives[i]);
+  for (unsigned int i = 0; i < iiDerivatives.size(); ++i)
+    ASSERT_DOUBLE_EQUALS_DYNAWO(bus->derivatives()->getValues(II_DERIVATIVE)[i], iiDerivatives[i]);
+
+  // a disconnected load does not inject any current
+  load->setConnected(OPEN);
+  bus->resetNodeInjection();
+  loadInjections.evalNodeInjection();
+  bus->evalF(UNDEFINED_EQ);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(fBus[0], 0.);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(fBus[1], 0.);
+
+  // the restorative loads are not static
+  powsybl::iidm::Network networkIIDM2("MyNetwork", "MyNetwork");
+  std::shared_ptr<ModelLoad> restorativeLoad = std::get<0>(createModelLoad(false, false, networkIIDM2));
+  std::string startingPoint = "warm";
+  fillParameters(restorativeLoad, startingPoint);
+  ASSERT_FALSE(restorativeLoad->addToLoadInjections(loadInjections));
+  ASSERT_EQ(loadInjections.size(), 1);
+}
+
 }  // namespace DYN
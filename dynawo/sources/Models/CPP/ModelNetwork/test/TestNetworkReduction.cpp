@@ -0,0 +1,136 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+#include <complex>
+#include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
+
+#include <powsybl/iidm/Bus.hpp>
+#include <powsybl/iidm/Substation.hpp>
+#include <powsybl/iidm/VoltageLevel.hpp>
+#include <powsybl/iidm/TopologyKind.hpp>
+#include <powsybl/iidm/LoadAdder.hpp>
+#include <powsybl/iidm/LineAdder.hpp>
+
+#include "DYNDataInterfaceIIDM.h"
+#include "DYNNetworkReduction.h"
+#include "DYNModelConstants.h"
+
+#include "gtest_dynawo.h"
+
+using boost::shared_ptr;
+
+namespace DYN {
+
+static void
+addBus(powsybl::iidm::VoltageLevel& vlIIDM, const std::string& id, bool withLoad) {
+  powsybl::iidm::Bus& iidmBus = vlIIDM.getBusBreakerView().newBus()
+      .setId(id)
+      .add();
+  iidmBus.setV(100.);
+  iidmBus.setAngle(0.);
+  if (withLoad) {
+    vlIIDM.newLoad()
+        .setId("Load" + id)
+        .setBus(id)
+        .setConnectableBus(id)
+        .setLoadType(powsybl::iidm::LoadType::UNDEFINED)
+        .setP0(10.)
+        .setQ0(5.)
+        .add();
+  }
+}
+
+static void
+addLine(powsybl::iidm::Network& network, const std::string& id, const std::string& bus1, const std::string& bus2, double r, double x) {
+  network.newLine()
+      .setId(id)
+      .setVoltageLevel1("VL")
+      .setBus1(bus1)
+      .setConnectableBus1(bus1)
+      .setVoltageLevel2("VL")
+      .setBus2(bus2)
+      .setConnectableBus2(bus2)
+      .setR(r)
+      .setX(x)
+      .setG1(0.)
+      .setB1(0.)
+      .setG2(0.)
+      .setB2(0.)
+      .add();
+}
+
+// A - M - B, with loads on A and B: M and the two lines are replaced by one series equivalent between A and B
+static shared_ptr<DataInterface>
+createDataInterface() {
+  auto network = boost::make_shared<powsybl::iidm::Network>("test", "test");
+  powsybl::iidm::Substation& s = network->newSubstation()
+      .setId("S")
+      .add();
+  powsybl::iidm::VoltageLevel& vlIIDM = s.newVoltageLevel()
+      .setId("VL")
+      .setNominalV(100.)
+      .setTopologyKind(powsybl::iidm::TopologyKind::BUS_BREAKER)
+      .setHighVoltageLimit(120.)
+      .setLowVoltageLimit(80.)
+      .add();
+  addBus(vlIIDM, "A", true);
+  addBus(vlIIDM, "M", false);
+  addBus(vlIIDM, "B", true);
+  addLine(*network, "LineAM", "A", "M", 1., 10.);
+  addLine(*network, "LineMB", "M", "B", 2., 20.);
+
+  shared_ptr<DataInterfaceIIDM> data;
+  DataInterfaceIIDM* ptr = new DataInterfaceIIDM(network);
+  ptr->initFromIIDM();
+  data.reset(ptr);
+  return data;
+}
+
+TEST(ModelsModelNetwork, NetworkReductionSeriesLines) {
+  shared_ptr<DataInterface> data = createDataInterface();
+  NetworkReduction reduction(data->getNetwork(), std::vector<std::string>(1, "VL"));
+
+  ASSERT_EQ(reduction.nbEliminatedBuses(), 1);
+  ASSERT_TRUE(reduction.isEliminatedBus("M"));
+  ASSERT_FALSE(reduction.isEliminatedBus("A"));
+  ASSERT_EQ(reduction.nbEliminatedLines(), 2);
+  ASSERT_TRUE(reduction.isEliminatedLine("LineAM"));
+  ASSERT_TRUE(reduction.isEliminatedLine("LineMB"));
+  ASSERT_EQ(reduction.getBoundaryBuses().size(), 2);
+
+  // the two lines in series: y = 1 / (z1 + z2) in p.u.
+  const double coeff = 100. * 100. / SNREF;
+  const std::complex<double> y = coeff / std::complex<double>(3., 30.);
+  ASSERT_EQ(reduction.getAdmittances().size(), 4);
+  for (const auto& admittance : reduction.getAdmittances()) {
+    const std::complex<double> expected = (admittance.row == admittance.column) ? y : -y;
+    ASSERT_DOUBLE_EQUALS_DYNAWO(admittance.value.real(), expected.real());
+    ASSERT_DOUBLE_EQUALS_DYNAWO(admittance.value.imag(), expected.imag());
+  }
+}
+
+TEST(ModelsModelNetwork, NetworkReductionUnknownVoltageLevel) {
+  shared_ptr<DataInterface> data = createDataInterface();
+  NetworkReduction reduction(data->getNetwork(), std::vector<std::string>(1, "UnknownVL"));
+
+  ASSERT_EQ(reduction.nbEliminatedBuses(), 0);
+  ASSERT_EQ(reduction.nbEliminatedLines(), 0);
+  ASSERT_TRUE(reduction.getBoundaryBuses().empty());
+  ASSERT_TRUE(reduction.getAdmittances().empty());
+}
+
+}  // namespace DYN
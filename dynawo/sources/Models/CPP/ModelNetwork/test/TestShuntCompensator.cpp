@@ -25,6 +25,8 @@
 #include "DYNCurrentLimitInterfaceIIDM.h"
 #include "DYNBusInterfaceIIDM.h"
 #include "DYNModelShuntCompensator.h"
+#include "DYNShuntInjections.h"
+#include "DYNDerivative.h"
 #include "DYNModelVoltageLevel.h"
 #include "DYNModelBus.h"
 #include "DYNModelNetwork.h"
@@ -39,7 +41,7 @@ using boost::shared_ptr;
 
 namespace DYN {
 static std::tuple<std::shared_ptr<ModelShuntCompensator>, std::shared_ptr<ModelVoltageLevel>,
-std::shared_ptr<VoltageLevelInterfaceIIDM> >  // need to return the voltage level so that it is not destroyed
+std::shared_ptr<VoltageLevelInterfaceIIDM>, std::shared_ptr<ModelBus> >  // need to return the voltage level so that it is not destroyed
 createModelShuntCompensator(bool open, bool capacitor, bool initModel, powsybl::iidm::Network& networkIIDM) {
   powsybl::iidm::Substation& s = networkIIDM.newSubstation()
       .setId("S")
@@ -113,7 +115,7 @@ createModelShuntCompensator(bool open, bool capacitor, bool initModel, powsybl::
     z1[ModelBus::switchOffNum_] = -1;
   int offset = 0;
   bus1->init(offset);
-  return std::make_tuple(sc, vl, vlItfIIDM);
+  return std::make_tuple(sc, vl, vlItfIIDM, bus1);
 }
 
 static const bool capacitance = true;
@@ -483,4 +485,64 @@ TEST(ModelsModelNetwork, ModelNetworkShuntCompensatorJt) {
   ASSERT_EQ(smjInit.nbElem(), 0);
 }
 
+TEST(ModelsModelNetwork, ModelNetworkShuntCompensatorInjections) {
+  powsybl::iidm::Network networkIIDM("test", "test");
+  auto tuple = createModelShuntCompensator(false, capacitance, false, networkIIDM);
+  std::shared_ptr<ModelShuntCompensator> capa = std::get<0>(tuple);
+  std::shared_ptr<ModelBus> bus = std::get<3>(tuple);
+  std::string startingPoint = "warm";
+  fillParameters(capa, startingPoint);
+  capa->initSize();
+  int yNum = 0;
+  capa->init(yNum);
+
+  std::vector<double> yBus(bus->sizeY(), 0.);
+  std::vector<double> ypBus(bus->sizeY(), 0.);
+  std::vector<double> fBus(bus->sizeF(), 0.);
+  bus->setReferenceY(&yBus[0], &ypBus[0], &fBus[0], 0, 0);
+  yBus[ModelBus::urNum_] = 1.1;
+  yBus[ModelBus::uiNum_] = 0.2;
+
+  ShuntInjections shuntInjections;
+  capa->addToShuntInjections(shuntInjections);
+  ASSERT_EQ(shuntInjections.size(), 1);
+
+  // the node injections computed together give the same currents and Jacobian terms as the component model
+  bus->resetNodeInjection();
+  bus->resetCurrentUStatus();
+  capa->evalNodeInjection();
+  bus->evalF(UNDEFINED_EQ);
+  const double ir = fBus[0];
+  const double ii = fBus[1];
+  ASSERT_NE(ir, 0.);
+  bus->resetNodeInjection();
+  shuntInjections.evalNodeInjection();
+  bus->evalF(UNDEFINED_EQ);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(fBus[0], ir);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(fBus[1], ii);
+
+  bus->initDerivatives();
+  capa->evalDerivatives(0.);
+  const std::vector<double> irDerivatives = bus->derivatives()->getValues(IR_DERIVATIVE);
+  const std::vector<double> iiDerivatives = bus->derivatives()->getValues(II_DERIVATIVE);
+  bus->initDerivatives();
+  shuntInjections.evalDerivatives();
+  ASSERT_EQ(bus->derivatives()->getValues(IR_DERIVATIVE).size(), irDerivatives.size());
+  ASSERT_EQ(bus->derivatives()->getValues(II_DERIVATIVE).size(), iiDerivatives.size());
+  for (unsigned int i = 0; i < irDerivatives.size(); ++i)
+    ASSERT_DOUBLE_EQUALS_DYNAWO(bus->derivatives()->getValues(IR_DERIVATIVE)[i], irDerivatives[i]);
+  for (unsigned int i = 0; i < iiDerivatives.size(); ++i)
+    ASSERT_DOUBLE_EQUALS_DYNAWO(bus->derivatives()->getValues(II_DERIVATIVE)[i], iiDerivatives[i]);
+
+  // a disconnected shunt does not inject any current
+  capa->setConnected(OPEN);
+  bus->resetNodeInjection();
+  shuntInjections.evalNodeInjection();
+  bus->evalF(UNDEFINED_EQ);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(fBus[0], 0.);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(fBus[1], 0.);
+  shuntInjections.clear();
+  ASSERT_EQ(shuntInjections.size(), 0);
+}
+
 }  // namespace DYN
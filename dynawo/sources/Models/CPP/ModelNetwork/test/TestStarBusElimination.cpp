@@ -0,0 +1,160 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+#include <complex>
+#include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
+
+#include <powsybl/iidm/Bus.hpp>
+#include <powsybl/iidm/Substation.hpp>
+#include <powsybl/iidm/VoltageLevel.hpp>
+#include <powsybl/iidm/TopologyKind.hpp>
+#include <powsybl/iidm/ThreeWindingsTransformerAdder.hpp>
+
+#include "DYNDataInterfaceIIDM.h"
+#include "DYNNetworkInterface.h"
+#include "DYNTwoWTransformerInterface.h"
+#include "DYNStarBusElimination.h"
+#include "DYNModelConstants.h"
+
+#include "gtest_dynawo.h"
+
+using boost::shared_ptr;
+
+namespace DYN {
+
+static void
+addBus(powsybl::iidm::VoltageLevel& vlIIDM, const std::string& id) {
+  powsybl::iidm::Bus& iidmBus = vlIIDM.getBusBreakerView().newBus()
+      .setId(id)
+      .add();
+  iidmBus.setV(100.);
+  iidmBus.setAngle(0.);
+}
+
+// three windings transformer between A, B and C, with purely reactive legs and no ratio
+static shared_ptr<DataInterface>
+createDataInterface() {
+  auto network = boost::make_shared<powsybl::iidm::Network>("test", "test");
+  powsybl::iidm::Substation& s = network->newSubstation()
+      .setId("S")
+      .add();
+  powsybl::iidm::VoltageLevel& vlIIDM = s.newVoltageLevel()
+      .setId("VL")
+      .setNominalV(100.)
+      .setTopologyKind(powsybl::iidm::TopologyKind::BUS_BREAKER)
+      .setHighVoltageLimit(120.)
+      .setLowVoltageLimit(80.)
+      .add();
+  addBus(vlIIDM, "A");
+  addBus(vlIIDM, "B");
+  addBus(vlIIDM, "C");
+  s.newThreeWindingsTransformer()
+      .setId("T3W")
+      .setRatedU0(100.)
+      .newLeg1()
+      .setR(0.)
+      .setX(10.)
+      .setG(0.)
+      .setB(0.)
+      .setRatedU(100.)
+      .setVoltageLevel("VL")
+      .setBus("A")
+      .setConnectableBus("A")
+      .add()
+      .newLeg2()
+      .setR(0.)
+      .setX(20.)
+      .setG(0.)
+      .setB(0.)
+      .setRatedU(100.)
+      .setVoltageLevel("VL")
+      .setBus("B")
+      .setConnectableBus("B")
+      .add()
+      .newLeg3()
+      .setR(0.)
+      .setX(30.)
+      .setG(0.)
+      .setB(0.)
+      .setRatedU(100.)
+      .setVoltageLevel("VL")
+      .setBus("C")
+      .setConnectableBus("C")
+      .add()
+      .add();
+
+  shared_ptr<DataInterfaceIIDM> data;
+  DataInterfaceIIDM* ptr = new DataInterfaceIIDM(network);
+  ptr->initFromIIDM();
+  data.reset(ptr);
+  return data;
+}
+
+TEST(ModelsModelNetwork, StarBusEliminationStaticTransformer) {
+  shared_ptr<DataInterface> data = createDataInterface();
+  StarBusElimination elimination(data->getNetwork());
+
+  ASSERT_EQ(elimination.nbEliminatedBuses(), 1);
+  ASSERT_TRUE(elimination.isEliminatedBus("T3W_FictBUS"));
+  ASSERT_FALSE(elimination.isEliminatedBus("A"));
+  ASSERT_TRUE(elimination.isEliminatedTransformer("T3W_1"));
+  ASSERT_TRUE(elimination.isEliminatedTransformer("T3W_2"));
+  ASSERT_TRUE(elimination.isEliminatedTransformer("T3W_3"));
+  const std::vector<std::string>& buses = elimination.getBoundaryBuses();
+  ASSERT_EQ(buses.size(), 3);
+
+  // Y_kl = delta_kl y_k - y_k y_l / (y_1 + y_2 + y_3)
+  const double coeff = 100. * 100. / SNREF;
+  std::vector<std::complex<double> > y(buses.size());
+  std::complex<double> sum(0., 0.);
+  for (unsigned int k = 0; k < buses.size(); ++k) {
+    const double x = (buses[k] == "A") ? 10. : (buses[k] == "B") ? 20. : 30.;
+    y[k] = coeff / std::complex<double>(0., x);
+    sum += y[k];
+  }
+  ASSERT_EQ(elimination.getAdmittances().size(), 9);
+  std::vector<std::complex<double> > rowSums(buses.size(), std::complex<double>(0., 0.));
+  for (const auto& admittance : elimination.getAdmittances()) {
+    std::complex<double> expected = -y[admittance.row] * y[admittance.column] / sum;
+    if (admittance.row == admittance.column)
+      expected += y[admittance.row];
+    ASSERT_DOUBLE_EQUALS_DYNAWO(admittance.value.real(), expected.real());
+    ASSERT_DOUBLE_EQUALS_DYNAWO(admittance.value.imag(), expected.imag());
+    rowSums[admittance.row] += admittance.value;
+  }
+  // without shunt, the equivalent does not inject any current when the three voltages are equal
+  for (const auto& rowSum : rowSums) {
+    ASSERT_DOUBLE_EQUALS_DYNAWO(rowSum.real(), 0.);
+    ASSERT_DOUBLE_EQUALS_DYNAWO(rowSum.imag(), 0.);
+  }
+}
+
+TEST(ModelsModelNetwork, StarBusEliminationDynamicLeg) {
+  shared_ptr<DataInterface> data = createDataInterface();
+  for (const auto& twoWTfo : data->getNetwork()->getTwoWTransformers()) {
+    if (twoWTfo->getID() == "T3W_2")
+      twoWTfo->hasDynamicModel(true);
+  }
+  StarBusElimination elimination(data->getNetwork());
+
+  ASSERT_EQ(elimination.nbEliminatedBuses(), 0);
+  ASSERT_FALSE(elimination.isEliminatedTransformer("T3W_1"));
+  ASSERT_TRUE(elimination.getBoundaryBuses().empty());
+  ASSERT_TRUE(elimination.getAdmittances().empty());
+}
+
+}  // namespace DYN
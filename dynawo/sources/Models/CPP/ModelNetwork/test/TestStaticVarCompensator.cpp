@@ -289,6 +289,12 @@ TEST(ModelsModelNetwork, ModelNetworkStaticVarCompensatorDiscreteVariables) {
   for (unsigned i = 0; i < nbG; ++i) {
     ASSERT_TRUE(gEquationIndex.find(i) != gEquationIndex.end());
   }
+
+  BitMask silentZ[2];
+  svc->collectSilentZ(silentZ);
+  ASSERT_TRUE(silentZ[ModelStaticVarCompensator::modeNum_].getFlags(NotUsedInDiscreteEquations | NotUsedInContinuousEquations));
+  ASSERT_TRUE(silentZ[ModelStaticVarCompensator::connectionStateNum_].getFlags(NotUsedInDiscreteEquations));
+  ASSERT_FALSE(silentZ[ModelStaticVarCompensator::connectionStateNum_].getFlags(NotUsedInContinuousEquations));
   delete[] zConnected;
 }
 
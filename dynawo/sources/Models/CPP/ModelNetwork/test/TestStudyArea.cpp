@@ -0,0 +1,152 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+#include <complex>
+#include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
+
+#include <powsybl/iidm/Bus.hpp>
+#include <powsybl/iidm/Line.hpp>
+#include <powsybl/iidm/Substation.hpp>
+#include <powsybl/iidm/VoltageLevel.hpp>
+#include <powsybl/iidm/TopologyKind.hpp>
+#include <powsybl/iidm/LoadAdder.hpp>
+#include <powsybl/iidm/LineAdder.hpp>
+
+#include "DYNDataInterfaceIIDM.h"
+#include "DYNStudyArea.h"
+#include "DYNModelConstants.h"
+
+#include "gtest_dynawo.h"
+
+using boost::shared_ptr;
+
+namespace DYN {
+
+static void
+addVoltageLevel(powsybl::iidm::Substation& s, const std::string& id) {
+  powsybl::iidm::VoltageLevel& vlIIDM = s.newVoltageLevel()
+      .setId(id)
+      .setNominalV(100.)
+      .setTopologyKind(powsybl::iidm::TopologyKind::BUS_BREAKER)
+      .setHighVoltageLimit(120.)
+      .setLowVoltageLimit(80.)
+      .add();
+  const std::string busId = "Bus" + id;
+  powsybl::iidm::Bus& iidmBus = vlIIDM.getBusBreakerView().newBus()
+      .setId(busId)
+      .add();
+  iidmBus.setV(100.);
+  iidmBus.setAngle(0.);
+  vlIIDM.newLoad()
+      .setId("Load" + id)
+      .setBus(busId)
+      .setConnectableBus(busId)
+      .setLoadType(powsybl::iidm::LoadType::UNDEFINED)
+      .setP0(10.)
+      .setQ0(5.)
+      .add();
+}
+
+static powsybl::iidm::Line&
+addLine(powsybl::iidm::Network& network, const std::string& id, const std::string& vl1, const std::string& vl2) {
+  return network.newLine()
+      .setId(id)
+      .setVoltageLevel1(vl1)
+      .setBus1("Bus" + vl1)
+      .setConnectableBus1("Bus" + vl1)
+      .setVoltageLevel2(vl2)
+      .setBus2("Bus" + vl2)
+      .setConnectableBus2("Bus" + vl2)
+      .setR(1.)
+      .setX(10.)
+      .setG1(0.)
+      .setB1(0.)
+      .setG2(0.)
+      .setB2(0.)
+      .add();
+}
+
+// VL1 - VL2 - VL3 - VL4 in a chain, 20 MW and 10 Mvar flowing from VL2 to VL3
+static shared_ptr<DataInterface>
+createDataInterface() {
+  auto network = boost::make_shared<powsybl::iidm::Network>("test", "test");
+  powsybl::iidm::Substation& s = network->newSubstation()
+      .setId("S")
+      .add();
+  addVoltageLevel(s, "VL1");
+  addVoltageLevel(s, "VL2");
+  addVoltageLevel(s, "VL3");
+  addVoltageLevel(s, "VL4");
+  addLine(*network, "Line12", "VL1", "VL2");
+  powsybl::iidm::Line& line23 = addLine(*network, "Line23", "VL2", "VL3");
+  line23.getTerminal1().setP(20.);
+  line23.getTerminal1().setQ(10.);
+  line23.getTerminal2().setP(-20.);
+  line23.getTerminal2().setQ(-10.);
+  addLine(*network, "Line34", "VL3", "VL4");
+
+  shared_ptr<DataInterfaceIIDM> data;
+  DataInterfaceIIDM* ptr = new DataInterfaceIIDM(network);
+  ptr->initFromIIDM();
+  data.reset(ptr);
+  return data;
+}
+
+TEST(ModelsModelNetwork, StudyAreaDepth) {
+  shared_ptr<DataInterface> data = createDataInterface();
+  StudyArea studyArea(data->getNetwork(), std::vector<std::string>(1, "VL1"), 1);
+
+  ASSERT_EQ(studyArea.nbInsideVoltageLevels(), 2);
+  ASSERT_TRUE(studyArea.isInside("VL1"));
+  ASSERT_TRUE(studyArea.isInside("VL2"));
+  ASSERT_FALSE(studyArea.isInside("VL3"));
+  ASSERT_FALSE(studyArea.isInside("VL4"));
+  ASSERT_TRUE(studyArea.isModelledBranch("Line12"));
+  ASSERT_FALSE(studyArea.isModelledBranch("Line23"));
+  ASSERT_TRUE(studyArea.isBoundaryBranch("Line23"));
+  ASSERT_FALSE(studyArea.isModelledBranch("Line34"));
+  ASSERT_FALSE(studyArea.isBoundaryBranch("Line34"));
+  ASSERT_EQ(studyArea.nbBoundaryBranches(), 1);
+
+  // the flow leaving VL2 drawn by a constant admittance: S = conj(Y) at nominal voltage
+  ASSERT_EQ(studyArea.getBoundaryBuses().size(), 1);
+  ASSERT_EQ(studyArea.getBoundaryBuses()[0], "BusVL2");
+  ASSERT_EQ(studyArea.getAdmittances().size(), 1);
+  const NetworkReduction::Admittance& admittance = studyArea.getAdmittances()[0];
+  ASSERT_EQ(admittance.row, 0);
+  ASSERT_EQ(admittance.column, 0);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(admittance.value.real(), 20. / SNREF);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(admittance.value.imag(), -10. / SNREF);
+}
+
+TEST(ModelsModelNetwork, StudyAreaWholeNetwork) {
+  shared_ptr<DataInterface> data = createDataInterface();
+  std::vector<std::string> studyVoltageLevels;
+  studyVoltageLevels.push_back("UnknownVL");
+  studyVoltageLevels.push_back("VL2");
+  StudyArea studyArea(data->getNetwork(), studyVoltageLevels, 2);
+
+  ASSERT_EQ(studyArea.nbInsideVoltageLevels(), 4);
+  ASSERT_TRUE(studyArea.isModelledBranch("Line12"));
+  ASSERT_TRUE(studyArea.isModelledBranch("Line23"));
+  ASSERT_TRUE(studyArea.isModelledBranch("Line34"));
+  ASSERT_EQ(studyArea.nbBoundaryBranches(), 0);
+  ASSERT_TRUE(studyArea.getBoundaryBuses().empty());
+  ASSERT_TRUE(studyArea.getAdmittances().empty());
+}
+
+}  // namespace DYN
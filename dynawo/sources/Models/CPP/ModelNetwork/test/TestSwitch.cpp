@@ -283,6 +283,11 @@ TEST(ModelsModelNetwork, ModelNetworkSwitchDiscreteVariables) {
   sw->setGequations(gEquationIndex);
   ASSERT_TRUE(gEquationIndex.empty());
   ASSERT_NO_THROW(sw->evalG(0.));  // Reference G was not defined on purpose
+
+  BitMask silentZ[1];
+  sw->collectSilentZ(silentZ);
+  ASSERT_TRUE(silentZ[0].getFlags(NotUsedInDiscreteEquations));
+  ASSERT_FALSE(silentZ[0].getFlags(NotUsedInContinuousEquations));
   delete[] zConnected;
 }
 
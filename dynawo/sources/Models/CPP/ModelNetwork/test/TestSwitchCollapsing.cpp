@@ -0,0 +1,107 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+#include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
+
+#include <powsybl/iidm/Bus.hpp>
+#include <powsybl/iidm/Substation.hpp>
+#include <powsybl/iidm/Switch.hpp>
+#include <powsybl/iidm/VoltageLevel.hpp>
+#include <powsybl/iidm/TopologyKind.hpp>
+
+#include "DYNDataInterfaceIIDM.h"
+#include "DYNSwitchCollapsing.h"
+
+#include "gtest_dynawo.h"
+
+using boost::shared_ptr;
+
+namespace DYN {
+
+static void
+addBus(powsybl::iidm::VoltageLevel& vlIIDM, const std::string& id) {
+  powsybl::iidm::Bus& iidmBus = vlIIDM.getBusBreakerView().newBus()
+      .setId(id)
+      .add();
+  iidmBus.setV(100.);
+  iidmBus.setAngle(0.);
+}
+
+static void
+addSwitch(powsybl::iidm::VoltageLevel& vlIIDM, const std::string& id, const std::string& bus1, const std::string& bus2, bool open) {
+  powsybl::iidm::Switch& swIIDM = vlIIDM.getBusBreakerView().newSwitch()
+      .setId(id)
+      .setFictitious(false)
+      .setBus1(bus1)
+      .setBus2(bus2)
+      .add();
+  swIIDM.setOpen(open);
+}
+
+// A = B - C, with the switch between A and B closed and the one between B and C open
+static shared_ptr<DataInterface>
+createDataInterface() {
+  auto network = boost::make_shared<powsybl::iidm::Network>("test", "test");
+  powsybl::iidm::Substation& s = network->newSubstation()
+      .setId("S")
+      .add();
+  powsybl::iidm::VoltageLevel& vlIIDM = s.newVoltageLevel()
+      .setId("VL")
+      .setNominalV(100.)
+      .setTopologyKind(powsybl::iidm::TopologyKind::BUS_BREAKER)
+      .setHighVoltageLimit(120.)
+      .setLowVoltageLimit(80.)
+      .add();
+  addBus(vlIIDM, "A");
+  addBus(vlIIDM, "B");
+  addBus(vlIIDM, "C");
+  addSwitch(vlIIDM, "SwitchAB", "A", "B", false);
+  addSwitch(vlIIDM, "SwitchBC", "B", "C", true);
+
+  shared_ptr<DataInterfaceIIDM> data;
+  DataInterfaceIIDM* ptr = new DataInterfaceIIDM(network);
+  ptr->initFromIIDM();
+  data.reset(ptr);
+  return data;
+}
+
+TEST(ModelsModelNetwork, SwitchCollapsingClosedSwitch) {
+  shared_ptr<DataInterface> data = createDataInterface();
+  SwitchCollapsing collapsing(data->getNetwork(), std::vector<std::string>(1, "VL"));
+
+  ASSERT_EQ(collapsing.nbCollapsedSwitches(), 1);
+  ASSERT_TRUE(collapsing.isCollapsedSwitch("SwitchAB"));
+  ASSERT_FALSE(collapsing.isCollapsedSwitch("SwitchBC"));
+  ASSERT_EQ(collapsing.nbMergedBuses(), 1);
+  ASSERT_TRUE(collapsing.isMergedBus("B"));
+  ASSERT_FALSE(collapsing.isMergedBus("A"));
+  ASSERT_FALSE(collapsing.isMergedBus("C"));
+  ASSERT_EQ(collapsing.getRepresentative("B"), "A");
+  ASSERT_EQ(collapsing.getRepresentative("A"), "A");
+  ASSERT_EQ(collapsing.getRepresentative("C"), "C");
+}
+
+TEST(ModelsModelNetwork, SwitchCollapsingUnknownVoltageLevel) {
+  shared_ptr<DataInterface> data = createDataInterface();
+  SwitchCollapsing collapsing(data->getNetwork(), std::vector<std::string>(1, "Unknown"));
+
+  ASSERT_EQ(collapsing.nbCollapsedSwitches(), 0);
+  ASSERT_EQ(collapsing.nbMergedBuses(), 0);
+  ASSERT_EQ(collapsing.getRepresentative("B"), "B");
+}
+
+}  // namespace DYN
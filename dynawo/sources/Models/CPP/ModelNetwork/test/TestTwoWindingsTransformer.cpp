@@ -36,6 +36,8 @@
 #include "TLTimelineFactory.h"
 #include "DYNSparseMatrix.h"
 #include "DYNVariable.h"
+#include "DYNDerivative.h"
+#include "DYNBranchInjections.h"
 
 #include "make_unique.hpp"
 #include "gtest_dynawo.h"
@@ -46,7 +48,8 @@ namespace DYN {
 static std::pair<std::unique_ptr<ModelTwoWindingsTransformer>,
 std::shared_ptr<ModelVoltageLevel> >  // need to return the voltage level so that it is not destroyed
 createModelTwoWindingsTransformer(bool open, bool initModel, bool ratioTapChanger, bool phaseTapChanger,
-                                  bool loadTapChangingCapabilities = true, bool closed1 = true, bool closed2 = true) {
+                                  bool loadTapChangingCapabilities = true, bool closed1 = true, bool closed2 = true,
+                                  std::vector<std::shared_ptr<ModelBus> >* buses = nullptr) {
   powsybl::iidm::Network networkIIDM("test", "test");
 
   powsybl::iidm::Substation& s = networkIIDM.newSubstation()
@@ -240,7 +243,7 @@ createModelTwoWindingsTransformer(bool open, bool initModel, bool ratioTapChange
   std::shared_ptr<ModelVoltageLevel> vl = std::make_shared<ModelVoltageLevel>(vlItfIIDM);
   int offset = 0;
   if (closed1) {
-    std::unique_ptr<ModelBus> bus1 = DYN::make_unique<ModelBus>(bus1ItfIIDM, false);
+    std::shared_ptr<ModelBus> bus1 = std::make_shared<ModelBus>(bus1ItfIIDM, false);
     bus1->setNetwork(network);
     bus1->setVoltageLevel(vl);
     bus1->initSize();
@@ -259,10 +262,12 @@ createModelTwoWindingsTransformer(bool open, bool initModel, bool ratioTapChange
     if (!initModel)
       z1[ModelBus::switchOffNum_] = -1;
     bus1->init(offset);
-    t2w->setModelBus1(std::move(bus1));
+    if (buses)
+      buses->push_back(bus1);
+    t2w->setModelBus1(bus1);
   }
   if (closed2) {
-    std::unique_ptr<ModelBus> bus2 = DYN::make_unique<ModelBus>(bus2ItfIIDM, false);
+    std::shared_ptr<ModelBus> bus2 = std::make_shared<ModelBus>(bus2ItfIIDM, false);
     bus2->setNetwork(network);
     bus2->setVoltageLevel(vl);
     bus2->initSize();
@@ -281,11 +286,58 @@ createModelTwoWindingsTransformer(bool open, bool initModel, bool ratioTapChange
     if (!initModel)
       z2[ModelBus::switchOffNum_] = -1;
     bus2->init(offset);
-    t2w->setModelBus2(std::move(bus2));
+    if (buses)
+      buses->push_back(bus2);
+    t2w->setModelBus2(bus2);
   }
   return std::make_pair(std::move(t2w), vl);
 }
 
+/**
+ * @brief get the derivative of the current of a bus with respect to a variable
+ * @param bus bus receiving the current
+ * @param type real or imaginary part of the current
+ * @param numVar index of the variable
+ * @return sum of the derivatives added for this variable
+ */
+static double
+getBusDerivative(ModelBus& bus, typeDerivative_t type, int numVar) {
+  const std::vector<int>& indices = bus.derivatives()->getIndices(type);
+  const std::vector<double>& values = bus.derivatives()->getValues(type);
+  double value = 0.;
+  for (size_t i = 0; i < indices.size(); ++i) {
+    if (indices[i] == numVar)
+      value += values[i];
+  }
+  return value;
+}
+
+/**
+ * @brief check the admittance terms of the phase shifter in a connection state, read from the derivatives added to its buses
+ *
+ * The current step of the phase tap changer gives a ratio of 5/3 and a phase shift of 1 degree
+ *
+ * @param state connection state of the transformer
+ * @param expected derivatives of each current with respect to each voltage
+ */
+static void
+checkTwoWindingsTransformerAdmittances(State state, const double (&expected)[BranchInjections::NB_CURRENTS][BranchInjections::NB_VOLTAGES]) {
+  std::vector<std::shared_ptr<ModelBus> > buses;
+  const std::unique_ptr<ModelTwoWindingsTransformer> t2w = createModelTwoWindingsTransformer(false, false, false, true, true, true, true, &buses).first;
+  ASSERT_EQ(buses.size(), 2u);
+  t2w->setConnectionState(state);
+  t2w->evalYMat();
+  t2w->evalDerivatives(0.);
+
+  const int voltages[BranchInjections::NB_VOLTAGES] = {buses[0]->urYNum(), buses[0]->uiYNum(), buses[1]->urYNum(), buses[1]->uiYNum()};
+  for (unsigned int j = 0; j < BranchInjections::NB_VOLTAGES; ++j) {
+    ASSERT_DOUBLE_EQUALS_DYNAWO(getBusDerivative(*buses[0], IR_DERIVATIVE, voltages[j]), expected[BranchInjections::IR1][j]);
+    ASSERT_DOUBLE_EQUALS_DYNAWO(getBusDerivative(*buses[0], II_DERIVATIVE, voltages[j]), expected[BranchInjections::II1][j]);
+    ASSERT_DOUBLE_EQUALS_DYNAWO(getBusDerivative(*buses[1], IR_DERIVATIVE, voltages[j]), expected[BranchInjections::IR2][j]);
+    ASSERT_DOUBLE_EQUALS_DYNAWO(getBusDerivative(*buses[1], II_DERIVATIVE, voltages[j]), expected[BranchInjections::II2][j]);
+  }
+}
+
 
 TEST(ModelsModelNetwork, ModelNetworkTwoWindingsTransformerInitialization) {
   const std::unique_ptr<ModelTwoWindingsTransformer> t2w = createModelTwoWindingsTransformer(false, false, true, false).first;
@@ -996,4 +1048,36 @@ TEST(ModelsModelNetwork, ModelNetworkTwoWindingsTransformerJt) {
   ASSERT_EQ(smjPrime.nbElem(), 0);
 }
 
+TEST(ModelsModelNetwork, ModelNetworkTwoWindingsTransformerAdmittances) {
+  // rows: ir1, ii1, ir2, ii2, columns: ur1, ui1, ur2, ui2
+  const double closed[BranchInjections::NB_CURRENTS][BranchInjections::NB_VOLTAGES] = {
+    {3.5417254228826693, -4.9817887607328029, -0.020151138513276688, -0.041284717282235539},
+    {4.9817887607328029, 3.5417254228826693, 0.041284717282235539, -0.020151138513276688},
+    {-0.021579678838815005, -0.040556303155847191, 0.012521152237760879, 0.024556046136191237},
+    {0.040556303155847191, -0.021579678838815005, -0.024556046136191237, 0.012521152237760879}
+  };
+  checkTwoWindingsTransformerAdmittances(CLOSED, closed);
+
+  // only the magnetizing branch is left on side 1
+  const double closed1[BranchInjections::NB_CURRENTS][BranchInjections::NB_VOLTAGES] = {
+    {3.5069444444444446, -5.0500000000000007, 0., 0.},
+    {5.0500000000000007, 3.5069444444444446, 0., 0.},
+    {0., 0., 0., 0.},
+    {0., 0., 0., 0.}
+  };
+  checkTwoWindingsTransformerAdmittances(CLOSED_1, closed1);
+
+  // the magnetizing branch is seen from side 2 in series with the transformer impedance
+  const double closed2[BranchInjections::NB_CURRENTS][BranchInjections::NB_VOLTAGES] = {
+    {0., 0., 0., 0.},
+    {0., 0., 0., 0.},
+    {0., 0., 0.012866414327711189, 0.024559393707056881},
+    {0., 0., -0.024559393707056881, 0.012866414327711189}
+  };
+  checkTwoWindingsTransformerAdmittances(CLOSED_2, closed2);
+
+  const double opened[BranchInjections::NB_CURRENTS][BranchInjections::NB_VOLTAGES] = {};
+  checkTwoWindingsTransformerAdmittances(OPEN, opened);
+}
+
 }  // namespace DYN
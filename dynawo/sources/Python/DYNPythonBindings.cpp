@@ -0,0 +1,233 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNPythonBindings.cpp
+ *
+ * @brief Python module driving a simulation in the Python process, the results being exposed as NumPy arrays
+ *
+ */
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+
+#include "DYNMacrosMessage.h"
+#include "DYNIoDico.h"
+#include "DYNInitXml.h"
+#include "DYNTrace.h"
+#include "DYNExecUtils.h"
+#include "DYNFileSystemUtils.h"
+#include "DYNSimulation.h"
+#include "DYNSimulationContext.h"
+#include "DYNStateBuffer.h"
+#include "JOBXmlImporter.h"
+#include "JOBJobsCollection.h"
+#include "JOBJobEntry.h"
+#include "CRVCurvesCollection.h"
+#include "CRVCurve.h"
+#include "TLTimeline.h"
+#include "TLEvent.h"
+
+namespace py = pybind11;
+
+namespace DYN {
+
+/**
+ * @brief copy an array owned by a simulation in a NumPy array
+ *
+ * The arrays of a simulation are reallocated as it advances and released when it is terminated: they are never exposed directly.
+ *
+ * @param data first value of the array
+ * @param size number of values
+ *
+ * @return the copy
+ */
+static py::array_t<double>
+makeArray(const double* data, const std::size_t size) {
+  return py::array_t<double>(static_cast<py::ssize_t>(size), data);
+}
+
+/**
+ * @brief simulation of a job driven from Python
+ *
+ * The simulation is initialized at construction, then advanced step by step or up to its stop time. The outputs files
+ * of the job are written by terminate only, the results being available in memory all along.
+ */
+class PythonSimulation {
+ public:
+  /**
+   * @brief constructor: create and initialize the simulation of a job
+   *
+   * @param jobsFileName jobs file describing the job
+   * @param jobName name of the job to simulate, the first one of the file if empty
+   */
+  PythonSimulation(const std::string& jobsFileName, const std::string& jobName) :
+  terminated_(false) {
+    job::XmlImporter importer;
+    const std::shared_ptr<job::JobsCollection> jobsCollection = importer.importFromFile(jobsFileName);
+    std::shared_ptr<job::JobEntry> job;
+    for (const auto& jobEntry : jobsCollection->getJobs()) {
+      if (jobName.empty() || jobEntry->getName() == jobName) {
+        job = jobEntry;
+        break;
+      }
+    }
+    if (!job)
+      throw DYNError(Error::SIMULATION, NoJobDefined);
+
+    const std::string prefixJobFile = absolute(removeFileName(jobsFileName));
+    const auto context = std::make_shared<SimulationContext>();
+    context->setResourcesDirectory(getMandatoryEnvVar("DYNAWO_RESOURCES_DIR"));
+    context->setLocale(getMandatoryEnvVar("DYNAWO_LOCALE"));
+    context->setInputDirectory(prefixJobFile);
+    context->setWorkingDirectory(prefixJobFile);
+    simulation_ = std::make_shared<Simulation>(job, context);
+    simulation_->init();
+  }
+
+  /**
+   * @brief destructor: write the outputs if terminate was not called
+   */
+  ~PythonSimulation() {
+    try {
+      terminate();
+    } catch (...) {
+      // an error at destruction cannot be reported to Python
+    }
+  }
+
+  /**
+   * @brief write the outputs files of the job and release the simulation
+   */
+  void terminate() {
+    if (terminated_)
+      return;
+    terminated_ = true;
+    simulation_->terminate();
+    simulation_->clean();
+  }
+
+  /**
+   * @brief get the simulation, checking that it was not terminated
+   *
+   * @return the simulation
+   */
+  Simulation& simulation() {
+    if (terminated_)
+      throw py::value_error("the simulation is terminated");
+    return *simulation_;
+  }
+
+ private:
+  std::shared_ptr<Simulation> simulation_;  ///< simulation of the job
+  bool terminated_;  ///< whether terminate was called
+};
+
+}  // end of namespace DYN
+
+PYBIND11_MODULE(pydynawo, m) {
+  using DYN::PythonSimulation;
+  using DYN::Simulation;
+  using DYN::StateBuffer;
+  m.doc() = "Dynawo simulations driven in the Python process";
+
+  // the xml libraries and the dictionaries stay loaded as long as the module is
+  static DYN::InitXerces xerces;
+  static DYN::InitLibXml2 libxml2;
+  DYN::IoDicos& dicos = DYN::IoDicos::instance();
+  dicos.addPath(getMandatoryEnvVar("DYNAWO_RESOURCES_DIR"));
+  dicos.addDicos(getMandatoryEnvVar("DYNAWO_DICTIONARIES"));
+  DYN::Trace::init();
+
+  py::class_<StateBuffer>(m, "State", "snapshot of the state of a simulation, restorable in the same simulation only")
+      .def_property_readonly("size", &StateBuffer::size, "number of bytes of the snapshot");
+
+  py::class_<PythonSimulation>(m, "Simulation")
+      .def(py::init<const std::string&, const std::string&>(), py::arg("jobs_file"), py::arg("job") = "",
+          "create and initialize the simulation of a job of a jobs file, the first one if no name is given")
+      .def_property_readonly("time", [](PythonSimulation& self) { return self.simulation().getCurrentTime(); },
+          "current time of the simulation")
+      .def_property_readonly("start_time", [](PythonSimulation& self) { return self.simulation().getStartTime(); },
+          "start time of the simulation")
+      .def("advance", [](PythonSimulation& self, const double t) {
+            py::gil_scoped_release release;
+            self.simulation().advance(t);
+          }, py::arg("t"), "simulate up to a time, bounded by the stop time of the job")
+      .def("set_stop_time", [](PythonSimulation& self, const double t) { self.simulation().setStopTime(t); }, py::arg("t"),
+          "change the stop time of the simulation")
+      .def("set_parameters", [](PythonSimulation& self, const std::vector<std::string>& actions) {
+            self.simulation().applyActions(actions);
+          }, py::arg("actions"),
+          "change parameters at the current time, each action being 'model,parameter,value[,parameter,value...]'")
+      .def("set_parameter", [](PythonSimulation& self, const std::string& model, const std::string& parameter, const std::string& value) {
+            self.simulation().applyActions(std::vector<std::string>(1, model + "," + parameter + "," + value));
+          }, py::arg("model"), py::arg("parameter"), py::arg("value"), "change a parameter of a model at the current time")
+      .def("get_parameter", [](PythonSimulation& self, const std::string& model, const std::string& parameter) {
+            std::string value;
+            if (!self.simulation().getParameterValue(model, parameter, value))
+              throw py::key_error(model + "," + parameter);
+            return value;
+          }, py::arg("model"), py::arg("parameter"), "current value of a parameter of a model, as a string")
+      .def_property_readonly("y", [](PythonSimulation& self) {
+            const std::vector<double>& y = self.simulation().getCurrentY();
+            return makeArray(y.data(), y.size());
+          }, "copy of the current continuous variables")
+      .def_property_readonly("yp", [](PythonSimulation& self) {
+            const std::vector<double>& yp = self.simulation().getCurrentYP();
+            return makeArray(yp.data(), yp.size());
+          }, "copy of the current derivatives of the continuous variables")
+      .def("curves", [](PythonSimulation& self) {
+            py::dict curves;
+            for (const auto& curve : self.simulation().getCurvesCollection()->getCurves()) {
+              if (!curve->getAvailable())
+                continue;
+              curves[py::str(curve->getUniqueName())] = py::make_tuple(
+                  makeArray(curve->getTimesData(), curve->getNbPoints()),
+                  makeArray(curve->getValues().data(), curve->getNbPoints()));
+            }
+            return curves;
+          }, "copies (times, values) of the points of each curve by name")
+      .def("final_state_values", [](PythonSimulation& self) {
+            py::dict values;
+            for (const auto& curve : self.simulation().getCurvesCollection()->getCurves()) {
+              const bool isFinalStateValue = curve->getExportType() == curves::Curve::EXPORT_AS_FINAL_STATE_VALUE ||
+                  curve->getExportType() == curves::Curve::EXPORT_AS_BOTH;
+              if (curve->getAvailable() && isFinalStateValue && curve->getNbPoints() > 0)
+                values[py::str(curve->getModelName() + "_" + curve->getVariable())] = curve->getLastValue();
+            }
+            return values;
+          }, "last value of each final state value by name")
+      .def("timeline", [](PythonSimulation& self) {
+            py::list events;
+            const boost::shared_ptr<timeline::Timeline>& timeline = self.simulation().getTimeline();
+            if (!timeline)
+              return events;
+            for (const timeline::Event* event : timeline->getEvents()) {
+              events.append(py::make_tuple(event->getTime(), event->getModelName(), event->getMessage(),
+                  event->hasPriority() ? py::object(py::int_(event->getPriority())) : py::object(py::none())));
+            }
+            return events;
+          }, "events of the timeline as (time, model, message, priority) tuples")
+      .def("snapshot", [](PythonSimulation& self) {
+            StateBuffer state;
+            self.simulation().snapshotState(state);
+            return state;
+          }, "capture the current state in memory")
+      .def("restore", [](PythonSimulation& self, const StateBuffer& state) { self.simulation().restoreState(state); },
+          py::arg("state"), "restore a state captured by snapshot")
+      .def("terminate", &PythonSimulation::terminate, "write the outputs files of the job and release the simulation");
+}
@@ -0,0 +1,80 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2026, RTE (http://www.rte-france.com)
+# See AUTHORS.txt
+# All rights reserved.
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, you can obtain one at http://mozilla.org/MPL/2.0/.
+# SPDX-License-Identifier: MPL-2.0
+#
+# This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+# simulation tool for power systems.
+
+import os
+import shutil
+import tempfile
+import unittest
+
+import pydynawo
+
+# the case is copied as its outputs are written next to its jobs file
+case_dir = os.environ["DYNAWO_PYTHON_BINDINGS_CASE"]
+
+class TestPythonBindings(unittest.TestCase):
+    def setUp(self):
+        self.work_dir = tempfile.mkdtemp()
+        shutil.copytree(case_dir, os.path.join(self.work_dir, "case"))
+        self.jobs_file = os.path.join(self.work_dir, "case", "SMIB.jobs")
+
+    def tearDown(self):
+        shutil.rmtree(self.work_dir)
+
+    def test_advance_and_curves(self):
+        simulation = pydynawo.Simulation(self.jobs_file)
+        self.assertEqual(simulation.time, simulation.start_time)
+        y = simulation.y
+        initial_y = list(y)
+        self.assertGreater(len(y), 0)
+
+        simulation.advance(1.)
+        self.assertAlmostEqual(simulation.time, 1.)
+        curves = simulation.curves()
+        self.assertGreater(len(curves), 0)
+        for (times, values) in curves.values():
+            self.assertEqual(len(times), len(values))
+            self.assertAlmostEqual(times[-1], 1.)
+        name = next(iter(curves))
+        (times, values) = curves[name]
+        nb_points = len(times)
+
+        # the arrays are copies: they are left as they are once the simulation advanced and even once it is terminated
+        simulation.advance(2.)
+        self.assertGreater(len(simulation.curves()[name][0]), nb_points)
+        simulation.terminate()
+        self.assertEqual(len(times), nb_points)
+        self.assertEqual(len(values), nb_points)
+        self.assertAlmostEqual(times[-1], 1.)
+        self.assertEqual(list(y), initial_y)
+        with self.assertRaises(ValueError):
+            simulation.advance(3.)
+
+    def test_snapshot_and_restore(self):
+        simulation = pydynawo.Simulation(self.jobs_file)
+        simulation.advance(1.)
+        state = simulation.snapshot()
+        self.assertGreater(state.size, 0)
+        y = list(simulation.y)
+
+        simulation.advance(2.)
+        simulation.restore(state)
+        self.assertAlmostEqual(simulation.time, 1.)
+        self.assertEqual(list(simulation.y), y)
+
+        # the restored simulation goes on from there
+        simulation.advance(2.)
+        self.assertAlmostEqual(simulation.time, 2.)
+        simulation.terminate()
+
+if __name__ == '__main__':
+    unittest.main()
@@ -25,6 +25,8 @@ InputMessage::~InputMessage() {}
 
 ActionMessage::~ActionMessage() {}
 
+ActionValuesMessage::~ActionValuesMessage() {}
+
 StepTriggerMessage::~StepTriggerMessage() {}
 
 StopMessage::~StopMessage() {}
@@ -21,6 +21,8 @@
 #define RT_COMMON_DYNRTINPUTCOMMON_H_
 #include <string>
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace DYN {
 
@@ -50,9 +52,10 @@ inline MessageFilter operator|(MessageFilter a, MessageFilter b) {
  * @brief Defines the types of input messages.
  */
 enum class MessageType {
-  Action,       ///< Action message
-  StepTrigger,  ///< Step trigger message
-  Stop          ///< Stop message
+  Action,        ///< Action message
+  ActionValues,  ///< Values of pre-registered action handles message
+  StepTrigger,   ///< Step trigger message
+  Stop           ///< Stop message
 };
 
 /**
@@ -99,6 +102,26 @@ class ActionMessage : public InputMessage {
   MessageType getType() const override { return MessageType::Action; }
 };
 
+/**
+ * @class ActionValuesMessage
+ * @brief Message carrying new values of parameters identified by handles obtained at registration.
+ */
+class ActionValuesMessage : public InputMessage {
+ public:
+  std::vector<std::pair<int, double> > values;  ///< pairs <handle, value>
+
+  /**
+   * @brief Destructor.
+   */
+  ~ActionValuesMessage() override;
+
+  /**
+   * @brief Get the message type.
+   * @return MessageType::ActionValues
+   */
+  MessageType getType() const override { return MessageType::ActionValues; }
+};
+
 /**
  * @class StepTriggerMessage
  * @brief Message used to trigger a simulation step.
@@ -0,0 +1,142 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+/**
+ * @file  DYNRTMessageQueue.h
+ *
+ * @brief Bounded lock-free message queue header
+ *
+ */
+#ifndef RT_COMMON_DYNRTMESSAGEQUEUE_H_
+#define RT_COMMON_DYNRTMESSAGEQUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace DYN {
+
+/**
+ * @class MessageQueue
+ * @brief Bounded lock-free queue with preallocated slots, for several producers and consumers
+ *
+ * Each slot carries a sequence number telling whether it is free for the producer of a given position
+ * or filled for the consumer of this position, so that push and pop only need one compare-and-swap.
+ */
+template<typename T>
+class MessageQueue {
+ public:
+  /**
+   * @brief Constructor
+   * @param capacity maximum number of messages in the queue, rounded up to a power of two
+   */
+  explicit MessageQueue(std::size_t capacity) :
+  mask_(roundUpToPowerOfTwo(capacity) - 1),
+  slots_(mask_ + 1),
+  pushPosition_(0),
+  popPosition_(0) {
+    for (std::size_t i = 0; i < slots_.size(); ++i)
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief append a message to the queue, without blocking
+   * @param value message to move into the queue, left untouched if the queue is full
+   * @return @b false if the queue is full
+   */
+  bool tryPush(T& value) {
+    std::size_t position = pushPosition_.load(std::memory_order_relaxed);
+    while (true) {
+      Slot& slot = slots_[position & mask_];
+      const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+      const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+      if (difference == 0) {
+        if (pushPosition_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+          slot.value = std::move(value);
+          slot.sequence.store(position + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (difference < 0) {
+        return false;
+      } else {
+        position = pushPosition_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * @brief take the oldest message of the queue, without blocking
+   * @param value message moved out of the queue
+   * @return @b false if the queue is empty
+   */
+  bool tryPop(T& value) {
+    std::size_t position = popPosition_.load(std::memory_order_relaxed);
+    while (true) {
+      Slot& slot = slots_[position & mask_];
+      const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+      const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+      if (difference == 0) {
+        if (popPosition_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+          value = std::move(slot.value);
+          slot.value = T();
+          slot.sequence.store(position + mask_ + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (difference < 0) {
+        return false;
+      } else {
+        position = popPosition_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * @brief whether the queue looks empty, the answer may be outdated as soon as it is returned
+   * @return @b true if no message was waiting in the queue
+   */
+  bool empty() const {
+    return pushPosition_.load(std::memory_order_acquire) == popPosition_.load(std::memory_order_acquire);
+  }
+
+ private:
+  /**
+   * @brief slot of the queue
+   */
+  struct Slot {
+    std::atomic<std::size_t> sequence;  ///< position for which the slot is free (position) or filled (position + 1)
+    T value;  ///< message stored in the slot
+  };
+
+  /**
+   * @brief round a capacity up to a power of two
+   * @param capacity capacity to round
+   * @return smallest power of two greater or equal to capacity, at least 2
+   */
+  static std::size_t roundUpToPowerOfTwo(std::size_t capacity) {
+    std::size_t rounded = 2;
+    while (rounded < capacity)
+      rounded <<= 1;
+    return rounded;
+  }
+
+ private:
+  const std::size_t mask_;  ///< capacity - 1, to compute the slot of a position
+  std::vector<Slot> slots_;  ///< preallocated slots
+  std::atomic<std::size_t> pushPosition_;  ///< position of the next push
+  std::atomic<std::size_t> popPosition_;  ///< position of the next pop
+};
+
+}  // end of namespace DYN
+
+#endif  // RT_COMMON_DYNRTMESSAGEQUEUE_H_
@@ -21,6 +21,7 @@
 #define RT_COMMON_DYNRTOUTPUTCOMMON_H_
 #include <string>
 #include <memory>
+#include <cstdint>
 
 namespace DYN {
 
@@ -29,10 +30,49 @@ namespace DYN {
  * @brief Supported formats for curve outputs.
  */
 enum class CurvesStreamFormat {
-  BYTES,  ///< Raw bytes
-  CSV,    ///< CSV format
-  JSON,   ///< JSON format
-  XML     ///< XML format
+  BYTES,        ///< Raw bytes
+  CSV,          ///< CSV format
+  JSON,         ///< JSON format
+  XML,          ///< XML format
+  FRAME,        ///< Binary frame of doubles
+  FRAME_FLOAT   ///< Binary frame of floats
+};
+
+/**
+ * @struct CurvesFrameHeader
+ * @brief Header of a binary curves frame, followed by the packed values (time first) in native byte order
+ */
+struct CurvesFrameHeader {
+  std::uint32_t curvesSetVersion;  ///< version of the curves names, incremented each time they are published
+  std::uint32_t nbValues;          ///< number of values following the header, time included
+  std::uint32_t valueSize;         ///< size of a value in bytes: 8 for doubles, 4 for floats
+};
+
+/**
+ * @struct PublicationPolicy
+ * @brief Filtering of the curves publications of a stream
+ */
+struct PublicationPolicy {
+  double deadband = 0.;                 ///< minimum variation of a value since its last publication for it to be published again
+  double minPeriod = 0.;                ///< minimum simulation time between two publications
+  unsigned int keyframeInterval = 0;    ///< number of publications between two publications of all the values, 0 for the first one only
+
+  /**
+   * @brief whether every value is published at each coupling time step
+   * @return @b true if the policy filters nothing
+   */
+  bool publishesEverything() const {
+    return deadband <= 0. && minPeriod <= 0.;
+  }
+};
+
+/**
+ * @enum OutputQueuePolicy
+ * @brief Behaviour of the publication queue when the output writer thread is late
+ */
+enum class OutputQueuePolicy {
+  BLOCK,        ///< The simulation thread waits for a free slot
+  DROP_OLDEST   ///< The oldest pending curves and telemetry publications are dropped
 };
 
 /**
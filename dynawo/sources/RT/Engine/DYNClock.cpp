@@ -26,11 +26,19 @@
 #include <sstream>
 #include <fstream>
 #include <thread>
+#include <cstdint>
 #ifdef _MSC_VER
 #include <process.h>
 #endif
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <cstring>
+#endif
 
 #include "DYNSignalHandler.h"
+#include "DYNTrace.h"
+#include "DYNMacrosMessage.h"
 
 #include "DYNClock.h"
 
@@ -46,6 +54,9 @@ running_(false),
 stopMessageReceived_(false),
 speedup_(1.),
 referenceSimuTime_(0.),
+spinGuard_(0),
+cpuAffinity_(-1),
+realTimePriority_(0),
 triggeredStepCnt_(0) {}
 
 
@@ -57,8 +68,45 @@ Clock::setSpeedup(double speedup) {
   speedup_ = speedup;
 }
 
+void
+Clock::setSpinGuard(double spinGuard) {
+  spinGuard_ = microseconds(spinGuard > 0 ? static_cast<std::int64_t>(spinGuard) : 0);
+}
+
+void
+Clock::setThreadScheduling(int cpuAffinity, int realTimePriority) {
+  cpuAffinity_ = cpuAffinity;
+  realTimePriority_ = realTimePriority;
+}
+
+void
+Clock::applyThreadScheduling() const {
+  if (cpuAffinity_ < 0 && realTimePriority_ <= 0)
+    return;
+#ifdef __linux__
+  if (cpuAffinity_ >= 0) {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpuAffinity_, &cpuSet);
+    const int error = pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+    if (error != 0)
+      Trace::warn() << DYNLog(RTThreadSchedulingFailed, "cpu affinity", strerror(error)) << Trace::endline;
+  }
+  if (realTimePriority_ > 0) {
+    sched_param parameters;
+    parameters.sched_priority = realTimePriority_;
+    const int error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &parameters);
+    if (error != 0)
+      Trace::warn() << DYNLog(RTThreadSchedulingFailed, "real-time priority", strerror(error)) << Trace::endline;
+  }
+#else
+  Trace::warn() << DYNLog(RTThreadSchedulingFailed, "cpu affinity and real-time priority", "not supported") << Trace::endline;
+#endif
+}
+
 void
 Clock::start(double simulationTime) {
+  applyThreadScheduling();
   referenceSimuTime_ = simulationTime;
   referenceClockTime_ = steady_clock::now();
   running_ = true;
@@ -88,8 +136,18 @@ Clock::handleMessage(StopMessage& /*stopMessage*/) {
 void
 Clock::wait(double simulationTime) {
   if (!useTrigger_) {
-    if (running_ && speedup_ > 0)
-      std::this_thread::sleep_until(referenceClockTime_ + microseconds(static_cast<int>(1000000*(simulationTime-referenceSimuTime_)/speedup_)));
+    if (running_ && speedup_ > 0) {
+      const steady_clock::time_point target =
+          referenceClockTime_ + microseconds(static_cast<std::int64_t>(1000000*(simulationTime-referenceSimuTime_)/speedup_));
+      if (spinGuard_.count() == 0) {
+        std::this_thread::sleep_until(target);
+      } else {
+        // sleep until the guard, then spin: waking up from a sleep may take much longer than the step alignment needed
+        std::this_thread::sleep_until(target - spinGuard_);
+        while (steady_clock::now() < target && running_) {
+        }
+      }
+    }
     return;
   } else {
     while (running_ && !SignalHandler::gotExitSignal()) {
@@ -103,6 +161,17 @@ Clock::wait(double simulationTime) {
   }
 }
 
+double
+Clock::getLateness(double simulationTime) const {
+  if (useTrigger_)
+    return triggeredStepCnt_ > 0 ? 0. : -1.;
+  if (!running_ || speedup_ <= 0)
+    return -1.;
+  const steady_clock::time_point deadline = referenceClockTime_
+      + microseconds(static_cast<int>(1000000*(simulationTime-referenceSimuTime_)/speedup_));
+  return (1./1000)*duration_cast<microseconds>(steady_clock::now() - deadline).count();
+}
+
 bool
 Clock::getStopMessageReceived() const {
   return stopMessageReceived_;
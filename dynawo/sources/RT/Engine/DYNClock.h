@@ -64,12 +64,40 @@ class Clock {
    */
   void wait(double simulationTime);
 
+  /**
+   * @brief time elapsed since the wall clock deadline of a simulation time
+   *
+   * With a trigger, the deadline is the reception of the next trigger and its time is unknown:
+   * the lateness is 0 if a trigger is already pending, negative otherwise.
+   *
+   * @param simulationTime current time of the simulation
+   * @return lateness in milliseconds, positive or null if the deadline is missed
+   */
+  double getLateness(double simulationTime) const;
+
   /**
    * @brief set speedup value if
    * @param speedup speedup value
    */
   void setSpeedup(double speedup);
 
+  /**
+   * @brief set the spin guard of the wait
+   *
+   * The clock sleeps until the guard before the wait target, then spins on the monotonic clock up to the target,
+   * to avoid the wake up latency of the scheduler.
+   *
+   * @param spinGuard spin guard in microseconds, 0 to only sleep
+   */
+  void setSpinGuard(double spinGuard);
+
+  /**
+   * @brief set the scheduling of the simulation thread, applied when the clock starts by the thread starting it
+   * @param cpuAffinity cpu the thread is pinned to, -1 if it is not pinned
+   * @param realTimePriority real-time (FIFO) scheduling priority of the thread, 0 for the default scheduling
+   */
+  void setThreadScheduling(int cpuAffinity, int realTimePriority);
+
   /**
    * @brief handle a received Trigger message
    * @param triggerMessage trigger message
@@ -100,6 +128,12 @@ class Clock {
    */
   bool getStopMessageReceived() const;
 
+ private:
+  /**
+   * @brief apply the cpu affinity and the real-time priority to the calling thread
+   */
+  void applyThreadScheduling() const;
+
  private:
   bool useTrigger_;                   ///< true if wait needs a trigger from an input channel
   bool running_;                      ///< running status of clock
@@ -109,6 +143,9 @@ class Clock {
   double speedup_;                    ///< acceleration factor clockTime/simulationTime
   std::chrono::steady_clock::time_point referenceClockTime_;  ///< clock reference correponding to referenceSimuTime
   double referenceSimuTime_;          ///< simulation time ("tCurrent") reference correponding to referenceSimuTime
+  std::chrono::microseconds spinGuard_;  ///< time before the wait target spent spinning instead of sleeping
+  int cpuAffinity_;                   ///< cpu the simulation thread is pinned to, -1 if not pinned
+  int realTimePriority_;              ///< real-time scheduling priority of the simulation thread, 0 if not real-time
 
   // External time sync
   std::atomic<int> triggeredStepCnt_;    ///< number of triggered steps
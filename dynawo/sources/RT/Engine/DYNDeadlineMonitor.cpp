@@ -0,0 +1,135 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+
+/**
+ * @file  DYNDeadlineMonitor.cpp
+ *
+ * @brief Deadline monitoring of the real-time coupling periods implementation
+ *
+ */
+#include "DYNDeadlineMonitor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+namespace DYN {
+
+static const double SMALLEST_BUCKET_MS = 0.01;  ///< upper bound of the first bucket in milliseconds
+static const char* PHASES_NAMES[DeadlineMonitor::NB_PHASES] = {"solve", "io", "wait"};  ///< names of the phases in the statistics
+
+LatencyHistogram::LatencyHistogram() {
+  reset();
+}
+
+void
+LatencyHistogram::add(const double durationMs) {
+  unsigned int bucket = 0;
+  if (durationMs > SMALLEST_BUCKET_MS)
+    bucket = std::min(static_cast<unsigned int>(std::ceil(4 * std::log2(durationMs / SMALLEST_BUCKET_MS))), NB_BUCKETS - 1);
+  ++buckets_[bucket];
+  ++count_;
+  max_ = std::max(max_, durationMs);
+}
+
+void
+LatencyHistogram::reset() {
+  buckets_.fill(0);
+  count_ = 0;
+  max_ = 0.;
+}
+
+double
+LatencyHistogram::getPercentile(const double percentile) const {
+  if (count_ == 0)
+    return 0.;
+  const std::uint64_t rank = std::max<std::uint64_t>(static_cast<std::uint64_t>(std::ceil(percentile / 100. * count_)), 1);
+  std::uint64_t cumulatedCount = 0;
+  for (unsigned int i = 0; i < NB_BUCKETS - 1; ++i) {
+    cumulatedCount += buckets_[i];
+    if (cumulatedCount >= rank)
+      return std::min(SMALLEST_BUCKET_MS * std::exp2(i / 4.), max_);
+  }
+  return max_;
+}
+
+DeadlineMonitor::DeadlineMonitor(const unsigned int sustainedOverrunCount) :
+periods_(0),
+overruns_(0),
+totalOverruns_(0),
+consecutiveOverruns_(0),
+consecutivePeriodsWithMargin_(0),
+sustainedOverrunCount_(sustainedOverrunCount) {
+  periodDurations_.fill(0.);
+}
+
+void
+DeadlineMonitor::addPhaseDuration(const Phase phase, const double durationMs) {
+  periodDurations_[phase] += durationMs;
+}
+
+bool
+DeadlineMonitor::endPeriod(const double latenessMs, const bool overrun) {
+  const bool margin = !overrun && periodDurations_[WAIT] >= periodDurations_[SOLVE] + periodDurations_[IO];
+  consecutivePeriodsWithMargin_ = margin ? consecutivePeriodsWithMargin_ + 1 : 0;
+  for (unsigned int i = 0; i < NB_PHASES; ++i)
+    phases_[i].add(periodDurations_[i]);
+  periodDurations_.fill(0.);
+  ++periods_;
+  if (!overrun) {
+    consecutiveOverruns_ = 0;
+    return false;
+  }
+  ++overruns_;
+  ++totalOverruns_;
+  lateness_.add(std::max(latenessMs, 0.));
+  ++consecutiveOverruns_;
+  return consecutiveOverruns_ == sustainedOverrunCount_;
+}
+
+/**
+ * @brief write the statistics of a histogram as a JSON object
+ * @param stream stream to write into
+ * @param histogram histogram
+ */
+static void histogramToJson(std::ostream& stream, const LatencyHistogram& histogram) {
+  stream << "{\"p50\":" << histogram.getPercentile(50) << ",\"p99\":" << histogram.getPercentile(99)
+      << ",\"max\":" << histogram.getMax() << "}";
+}
+
+std::string
+DeadlineMonitor::toJson(const double time) const {
+  std::stringstream stream;
+  stream << "{\"time\":" << time << ",\"periods\":" << periods_ << ",\"overruns\":" << overruns_
+      << ",\"totalOverruns\":" << totalOverruns_ << ",\"consecutiveOverruns\":" << consecutiveOverruns_;
+  for (unsigned int i = 0; i < NB_PHASES; ++i) {
+    stream << ",\"" << PHASES_NAMES[i] << "Ms\":";
+    histogramToJson(stream, phases_[i]);
+  }
+  stream << ",\"latenessMs\":";
+  histogramToJson(stream, lateness_);
+  stream << "}";
+  return stream.str();
+}
+
+void
+DeadlineMonitor::resetWindow() {
+  for (unsigned int i = 0; i < NB_PHASES; ++i)
+    phases_[i].reset();
+  lateness_.reset();
+  periods_ = 0;
+  overruns_ = 0;
+}
+
+}  // end of namespace DYN
@@ -0,0 +1,185 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+
+/**
+ * @file  DYNDeadlineMonitor.h
+ *
+ * @brief Deadline monitoring of the real-time coupling periods header
+ *
+ */
+#ifndef RT_ENGINE_DYNDEADLINEMONITOR_H_
+#define RT_ENGINE_DYNDEADLINEMONITOR_H_
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace DYN {
+
+/**
+ * @class LatencyHistogram
+ * @brief Histogram of durations with logarithmic buckets, giving approximate percentiles in constant memory
+ *
+ * Bucket i holds the durations up to 0.01 ms * 2^(i/4), so that a percentile is known within 19%.
+ */
+class LatencyHistogram {
+ public:
+  /**
+   * @brief constructor
+   */
+  LatencyHistogram();
+
+  /**
+   * @brief add a duration
+   * @param durationMs duration in milliseconds
+   */
+  void add(double durationMs);
+
+  /**
+   * @brief forget the durations added so far
+   */
+  void reset();
+
+  /**
+   * @brief number of durations added since the last reset
+   * @return number of durations
+   */
+  std::uint64_t getCount() const {
+    return count_;
+  }
+
+  /**
+   * @brief longest duration added since the last reset
+   * @return duration in milliseconds
+   */
+  double getMax() const {
+    return max_;
+  }
+
+  /**
+   * @brief approximate percentile of the durations added since the last reset
+   * @param percentile percentile between 0 and 100
+   * @return upper bound of the bucket holding the percentile, capped by the maximum, in milliseconds
+   */
+  double getPercentile(double percentile) const;
+
+ private:
+  static const unsigned int NB_BUCKETS = 96;    ///< number of buckets, the last one holding the durations above 1.7 h
+  std::array<std::uint64_t, NB_BUCKETS> buckets_;  ///< number of durations per bucket
+  std::uint64_t count_;                         ///< number of durations
+  double max_;                                  ///< longest duration in milliseconds
+};
+
+/**
+ * @class DeadlineMonitor
+ * @brief Statistics of the real-time coupling periods: time spent solving, publishing and waiting, and deadline overruns
+ *
+ * A coupling period overruns its deadline when the simulation reaches the clock wait after the wall clock
+ * time corresponding to the simulation time, or after the next trigger was received.
+ */
+class DeadlineMonitor {
+ public:
+  /**
+   * @brief phases of a coupling period
+   */
+  enum Phase {
+    SOLVE = 0,  ///< time steps computation
+    IO,         ///< application of the actions and publication of the outputs
+    WAIT,       ///< wait for the clock
+    NB_PHASES   ///< number of phases (this is not a valid phase)
+  };
+
+  /**
+   * @brief constructor
+   * @param sustainedOverrunCount number of consecutive overruns making a sustained overrun
+   */
+  explicit DeadlineMonitor(unsigned int sustainedOverrunCount = 10);
+
+  /**
+   * @brief add the time spent in a phase during the current coupling period
+   * @param phase phase
+   * @param durationMs duration in milliseconds
+   */
+  void addPhaseDuration(Phase phase, double durationMs);
+
+  /**
+   * @brief close the current coupling period
+   * @param latenessMs time elapsed since the deadline of the period when the clock wait started, in milliseconds, negative or null if the deadline was met
+   * @param overrun @b true if the deadline was missed, even if the lateness is unknown
+   * @return @b true if this period starts a sustained overrun, that is reached the configured number of consecutive overruns
+   */
+  bool endPeriod(double latenessMs, bool overrun);
+
+  /**
+   * @brief statistics since the last reset as a JSON object
+   * @param time current simulation time
+   * @return JSON object with the number of periods and overruns, and p50/p99/max of each phase and of the lateness
+   */
+  std::string toJson(double time) const;
+
+  /**
+   * @brief forget the statistics, the total number of overruns and the current run of consecutive overruns excepted
+   */
+  void resetWindow();
+
+  /**
+   * @brief total number of overruns
+   * @return number of overruns since the monitor creation
+   */
+  std::uint64_t getTotalOverruns() const {
+    return totalOverruns_;
+  }
+
+  /**
+   * @brief number of consecutive overruns up to the last period
+   * @return number of consecutive overruns
+   */
+  unsigned int getConsecutiveOverruns() const {
+    return consecutiveOverruns_;
+  }
+
+  /**
+   * @brief number of consecutive periods with a margin up to the last period
+   *
+   * A period has a margin when it meets its deadline and spends at least as much time waiting as solving and publishing.
+   *
+   * @return number of consecutive periods with a margin
+   */
+  unsigned int getConsecutivePeriodsWithMargin() const {
+    return consecutivePeriodsWithMargin_;
+  }
+
+  /**
+   * @brief number of consecutive overruns making a sustained overrun
+   * @return number of consecutive overruns
+   */
+  unsigned int getSustainedOverrunCount() const {
+    return sustainedOverrunCount_;
+  }
+
+ private:
+  std::array<double, NB_PHASES> periodDurations_;      ///< time spent in each phase during the current period
+  std::array<LatencyHistogram, NB_PHASES> phases_;     ///< durations of each phase per period
+  LatencyHistogram lateness_;                          ///< lateness of the overrunning periods
+  std::uint64_t periods_;                              ///< number of periods since the last reset
+  std::uint64_t overruns_;                             ///< number of overruns since the last reset
+  std::uint64_t totalOverruns_;                        ///< number of overruns since the creation
+  unsigned int consecutiveOverruns_;                   ///< number of consecutive overruns up to the last period
+  unsigned int consecutivePeriodsWithMargin_;          ///< number of consecutive periods with a margin up to the last period
+  unsigned int sustainedOverrunCount_;                 ///< number of consecutive overruns making a sustained overrun
+};
+
+}  // end of namespace DYN
+
+#endif  // RT_ENGINE_DYNDEADLINEMONITOR_H_
@@ -18,12 +18,21 @@
 #include <functional>
 #include <iostream>
 #include <atomic>
+#include <string>
+#include <utility>
 
 namespace DYN {
 
+/**
+ * @brief maximum number of messages waiting to be handled
+ */
+static const std::size_t MESSAGE_QUEUE_CAPACITY = 1024;
+
 InputDispatcherAsync::InputDispatcherAsync(std::shared_ptr<Clock>& clock) :
   clock_(clock),
   loopWaitInMs_(50),
+  messageQueue_(MESSAGE_QUEUE_CAPACITY),
+  processorWaiting_(false),
   running_(false) {}
 
 InputDispatcherAsync::~InputDispatcherAsync() {
@@ -48,6 +57,12 @@ InputDispatcherAsync::start() {
     useTrigger |= channel->supports(MessageFilter::Trigger);
   clock_->setUseTrigger(useTrigger);
 
+  for (auto channel : channels_) {
+    channel->setHandleResolver([this](const std::string& subModelName, const std::string& parameterName) {
+      return model_->registerActionHandle(subModelName, parameterName);
+    });
+  }
+
   for (auto channel : channels_)
     channel->startReceiving([this](std::shared_ptr<InputMessage> msg){ this->dispatchMessage(std::move(msg)); }, true);
   processorThread_ = std::thread([this](){ processLoop(); });
@@ -57,6 +72,9 @@ InputDispatcherAsync::start() {
 void
 InputDispatcherAsync::stop() {
   running_ = false;
+  {
+    std::lock_guard<std::mutex> lock(queueMutex_);
+  }
   queueCond_.notify_all();
   for (auto channel : channels_)
     channel->stop();
@@ -66,40 +84,101 @@ InputDispatcherAsync::stop() {
 
 void
 InputDispatcherAsync::dispatchMessage(std::shared_ptr<InputMessage> msg) {
-    if (msg) {
-      {
-        std::lock_guard<std::mutex> lock(queueMutex_);
-        messageQueue_.push(std::move(msg));
+  if (!msg)
+    return;
+  // the queue is only full if the messages are not handled anymore: wait for a free slot rather than losing a trigger
+  while (!messageQueue_.tryPush(msg)) {
+    if (!running_)
+      return;
+    std::this_thread::yield();
+  }
+  // the mutex is only taken when the processing thread may be waiting, so that the notification is not lost
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (processorWaiting_) {
+    {
+      std::lock_guard<std::mutex> lock(queueMutex_);
+    }
+    queueCond_.notify_one();
+  }
+}
+
+unsigned int
+InputDispatcherAsync::processPendingMessages() {
+  unsigned int nbMessages = 0;
+  std::shared_ptr<InputMessage> msg;
+  // consecutive actions are registered as one batch, before any following trigger or stop message
+  std::vector<std::string> actionStrings;
+  std::vector<std::pair<int, double> > actionValues;
+  while (messageQueue_.tryPop(msg)) {
+    switch (msg->getType()) {
+      case MessageType::Action:
+        registerActionValues(actionValues);
+        actionStrings.push_back(std::move(static_cast<ActionMessage &>(*msg).payload));
+        break;
+      case MessageType::ActionValues: {
+        registerActions(actionStrings);
+        const std::vector<std::pair<int, double> >& values = static_cast<ActionValuesMessage &>(*msg).values;
+        actionValues.insert(actionValues.end(), values.begin(), values.end());
+        break;
       }
-      queueCond_.notify_one();
+      case MessageType::StepTrigger:
+      case MessageType::Stop:
+        registerActions(actionStrings);
+        registerActionValues(actionValues);
+        processMessage(*msg);
+        break;
     }
+    ++nbMessages;
+  }
+  registerActions(actionStrings);
+  registerActionValues(actionValues);
+  return nbMessages;
+}
+
+void
+InputDispatcherAsync::registerActions(std::vector<std::string>& actionStrings) {
+  if (actionStrings.empty())
+    return;
+  model_->registerActions(actionStrings);
+  actionStrings.clear();
+}
+
+void
+InputDispatcherAsync::registerActionValues(std::vector<std::pair<int, double> >& actionValues) {
+  if (actionValues.empty())
+    return;
+  model_->registerActionValues(actionValues);
+  actionValues.clear();
+}
+
+void
+InputDispatcherAsync::processMessage(InputMessage& msg) {
+  switch (msg.getType()) {
+    case MessageType::Action:
+      model_->registerAction(static_cast<ActionMessage &>(msg).payload);
+      break;
+    case MessageType::ActionValues:
+      model_->registerActionValues(static_cast<ActionValuesMessage &>(msg).values);
+      break;
+    case MessageType::StepTrigger:
+      clock_->handleMessage(static_cast<StepTriggerMessage &>(msg));
+      break;
+    case MessageType::Stop:
+      clock_->handleMessage(static_cast<StopMessage &>(msg));
+      break;
+  }
 }
 
 void
 InputDispatcherAsync::processLoop() {
   while (running_) {
+    if (processPendingMessages() > 0)
+      continue;
     std::unique_lock<std::mutex> lock(queueMutex_);
+    processorWaiting_ = true;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
     queueCond_.wait_for(lock, std::chrono::milliseconds(loopWaitInMs_), [this]() { return !messageQueue_.empty() || !running_; });
-
-    while (!messageQueue_.empty()) {
-      auto msg = messageQueue_.front();
-      messageQueue_.pop();
-      lock.unlock();
-
-      switch (msg->getType()) {
-        case MessageType::Action:
-          model_->registerAction(static_cast<ActionMessage &>(*msg).payload);
-          break;
-        case MessageType::StepTrigger:
-          clock_->handleMessage(static_cast<StepTriggerMessage &>(*msg));
-          break;
-        case MessageType::Stop:
-          clock_->handleMessage(static_cast<StopMessage &>(*msg));
-          break;
-      }
-
-      lock.lock();
-    }
+    processorWaiting_ = false;
   }
 }
 
@@ -21,14 +21,16 @@
 #define RT_ENGINE_DYNINPUTDISPATCHERASYNC_H_
 
 #include <memory>
-#include <queue>
 #include <mutex>
 #include <condition_variable>
 #include <thread>
 #include <atomic>
 #include <vector>
+#include <string>
+#include <utility>
 
 #include "DYNRTInputCommon.h"
+#include "DYNRTMessageQueue.h"
 #include "DYNModel.h"
 #include "DYNClock.h"
 #include "DYNInputChannel.h"
@@ -81,20 +83,48 @@ class InputDispatcherAsync {
    */
   void dispatchMessage(std::shared_ptr<InputMessage> msg);
 
+  /**
+   * @brief handle the messages waiting in the queue, without blocking
+   *
+   * Can be called from the simulation loop as well as from the processing thread.
+   *
+   * @return number of messages handled
+   */
+  unsigned int processPendingMessages();
+
  private:
   /**
    * @brief loop for message reception
    */
   void processLoop();
 
+  /**
+   * @brief register a batch of actions in the model, then clear it
+   * @param actionStrings actions received consecutively
+   */
+  void registerActions(std::vector<std::string>& actionStrings);
+
+  /**
+   * @brief register a batch of values of action handles in the model, then clear it
+   * @param actionValues pairs <handle, value> received consecutively
+   */
+  void registerActionValues(std::vector<std::pair<int, double> >& actionValues);
+
+  /**
+   * @brief handle one message
+   * @param msg message to handle
+   */
+  void processMessage(InputMessage& msg);
+
  private:
   std::shared_ptr<Model> model_;                             ///< Model, handles action registration
   std::shared_ptr<Clock> clock_;                             ///< Clock, handles trigger
   std::vector<std::shared_ptr<InputChannel> > channels_;     ///< Receivers for inputs and trigger
 
   int loopWaitInMs_;                                         ///< loop wait for periodic lock release
-  std::queue<std::shared_ptr<InputMessage> > messageQueue_;  ///< queue of received messages
-  std::mutex queueMutex_;                                    ///< mutex for message push/pop in the queue
+  MessageQueue<std::shared_ptr<InputMessage> > messageQueue_;  ///< bounded lock-free queue of received messages
+  std::atomic<bool> processorWaiting_;                       ///< whether the processing thread may be waiting for a message
+  std::mutex queueMutex_;                                    ///< mutex used only to wake up the waiting processing thread
   std::condition_variable queueCond_;                        ///< condition for lock release
   std::thread processorThread_;                              ///< thread for message handling loop
   std::atomic<bool> running_;                                ///< running flag
@@ -30,14 +30,132 @@
 #include <iostream>
 #include <sstream>
 #include <atomic>
+#include <cstring>
+#include <iterator>
+#include <cmath>
 
 namespace DYN {
 
 OutputDispatcher::OutputDispatcher() :
-      running_(false) {}
+      curvesSetVersion_(0),
+      running_(false),
+      maxQueueSize_(1),
+      queuePolicy_(OutputQueuePolicy::BLOCK),
+      frameOpen_(false),
+      nbDroppedFrames_(0) {}
+
+OutputDispatcher::~OutputDispatcher() {
+  stopAsync();
+}
+
+void
+OutputDispatcher::startAsync(const size_t maxQueueSize, const OutputQueuePolicy policy) {
+  if (running_)
+    return;
+  maxQueueSize_ = maxQueueSize > 0 ? maxQueueSize : 1;
+  queuePolicy_ = policy;
+  running_ = true;
+  writerThread_ = std::thread([this](){ writerLoop(); });
+}
+
+void
+OutputDispatcher::stopAsync() {
+  if (frameOpen_)
+    endFrame();
+  {
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    running_ = false;
+  }
+  queueCond_.notify_all();
+  if (writerThread_.joinable())
+    writerThread_.join();
+}
+
+void
+OutputDispatcher::beginFrame() {
+  frameOpen_ = true;
+}
 
 void
-OutputDispatcher::addCurvesPublisher(std::shared_ptr<OutputChannel>& publisher, const std::string formatStr) {
+OutputDispatcher::endFrame() {
+  frameOpen_ = false;
+  if (currentFrame_.empty())
+    return;
+  Frame frame;
+  frame.swap(currentFrame_);
+  pushFrame(std::move(frame));
+}
+
+void
+OutputDispatcher::post(std::function<void()>&& task, const bool droppable) {
+  if (!running_) {
+    task();
+    return;
+  }
+  PublicationTask publicationTask;
+  publicationTask.run = std::move(task);
+  publicationTask.droppable = droppable;
+  if (frameOpen_) {
+    currentFrame_.push_back(std::move(publicationTask));
+    return;
+  }
+  Frame frame;
+  frame.push_back(std::move(publicationTask));
+  pushFrame(std::move(frame));
+}
+
+void
+OutputDispatcher::pushFrame(Frame&& frame) {
+  std::unique_lock<std::mutex> lock(queueMutex_);
+  if (queuePolicy_ == OutputQueuePolicy::BLOCK) {
+    queueNotFullCond_.wait(lock, [this]() { return frames_.size() < maxQueueSize_; });
+  } else {
+    while (frames_.size() >= maxQueueSize_) {
+      // the publications that cannot be dropped (timeline, constraints, curves names) are moved to the next frame
+      Frame oldest = std::move(frames_.front());
+      frames_.pop_front();
+      Frame& next = frames_.empty() ? frame : frames_.front();
+      Frame kept;
+      for (auto& task : oldest) {
+        if (!task.droppable)
+          kept.push_back(std::move(task));
+      }
+      if (kept.size() < oldest.size())
+        ++nbDroppedFrames_;
+      next.insert(next.begin(), std::make_move_iterator(kept.begin()), std::make_move_iterator(kept.end()));
+    }
+  }
+  frames_.push_back(std::move(frame));
+  lock.unlock();
+  queueCond_.notify_one();
+}
+
+void
+OutputDispatcher::writerLoop() {
+  std::unique_lock<std::mutex> lock(queueMutex_);
+  while (true) {
+    queueCond_.wait(lock, [this]() { return !frames_.empty() || !running_; });
+    if (frames_.empty())
+      break;  // stopped and drained
+    Frame frame = std::move(frames_.front());
+    frames_.pop_front();
+    lock.unlock();
+    queueNotFullCond_.notify_one();
+    for (auto& task : frame) {
+      try {
+        task.run();
+      } catch (const Error& e) {
+        Trace::error() << e.what() << Trace::endline;
+      } catch (const std::exception& e) {
+        Trace::error() << e.what() << Trace::endline;
+      }
+    }
+    lock.lock();
+  }
+}
+
+void
+OutputDispatcher::addCurvesPublisher(std::shared_ptr<OutputChannel>& publisher, const std::string formatStr, const PublicationPolicy& policy) {
   CurvesStreamFormat format;
   if (formatStr == "BYTES") {
     format = CurvesStreamFormat::BYTES;
@@ -47,10 +165,26 @@ OutputDispatcher::addCurvesPublisher(std::shared_ptr<OutputChannel>& publisher,
     format = CurvesStreamFormat::JSON;
   } else if (formatStr == "XML") {
     format = CurvesStreamFormat::XML;
+  } else if (formatStr == "FRAME") {
+    format = CurvesStreamFormat::FRAME;
+  } else if (formatStr == "FRAME_FLOAT") {
+    format = CurvesStreamFormat::FRAME_FLOAT;
   } else {
     throw DYNError(Error::GENERAL, UnknownCurvesStreamFormat, formatStr);
   }
 
+  // the XML export formats the whole collection: it is not filtered
+  if (!policy.publishesEverything() && format != CurvesStreamFormat::XML) {
+    std::shared_ptr<FilteredCurvesPublisher> filteredPublisher = std::make_shared<FilteredCurvesPublisher>();
+    filteredPublisher->channel = publisher;
+    filteredPublisher->format = format;
+    filteredPublisher->policy = policy;
+    filteredPublisher->lastPublicationTime = 0.;
+    filteredPublisher->nbPublicationsSinceKeyframe = 0;
+    filteredCurvesPublishers_.push_back(filteredPublisher);
+    return;
+  }
+
   if (curvesPublishers_.find(format) == curvesPublishers_.end()) {
     curvesPublishers_.emplace(format, std::vector<std::shared_ptr<OutputChannel> >());
   }
@@ -95,6 +229,13 @@ OutputDispatcher::addConstraintsPublisher(std::shared_ptr<OutputChannel>& publis
   constraintsPublishers_.find(format)->second.push_back(publisher);
 }
 
+void
+OutputDispatcher::addTelemetryPublisher(std::shared_ptr<OutputChannel>& publisher, const std::string formatStr) {
+  if (formatStr != "JSON")
+    throw DYNError(Error::GENERAL, UnknownTelemetryStreamFormat, formatStr);
+  telemetryPublishers_.push_back(publisher);
+}
+
 void
 OutputDispatcher::addLogsPublisher(std::shared_ptr<OutputChannel>& /*publisher*/, const std::string /*formatStr*/) {
   Trace::error() << DYNError(Error::GENERAL, LogStreamNotImplemented) << Trace::endline;
@@ -104,50 +245,118 @@ void
 OutputDispatcher::publishCurvesNames(std::shared_ptr<curves::CurvesCollection>& curvesCollection) {
   if (!curvesCollection)
     return;
+  std::vector<std::string> curvesNames;
+  for (const auto& curve : curvesCollection->getCurves())
+    if (curve->getAvailable())
+      curvesNames.push_back(curve->getUniqueName());
+  // the names are only published when they change
+  if (curvesSetVersion_ > 0 && curvesNames == curvesNames_)
+    return;
+  curvesNames_.swap(curvesNames);
+  ++curvesSetVersion_;
   if (curvesPublishers_.find(CurvesStreamFormat::BYTES) != curvesPublishers_.end()) {
-    size_t nbAvailableCurves = 0;
-    for (auto &curve : curvesCollection->getCurves())
-      if (curve->getAvailable())
-        nbAvailableCurves++;
-    curvesValues_.reserve((nbAvailableCurves + 1) * sizeof(double));
-    std::string formatedCurvesNames = curvesNamesToString(curvesCollection);
-    for (auto &publisher : curvesPublishers_.find(CurvesStreamFormat::BYTES)->second)
-      publisher->sendMessage(formatedCurvesNames, "curves_names");
+    std::string formatedCurvesNames = curvesNamesToString();
+    const size_t nbValues = curvesNames_.size() + 1;
+    post([this, formatedCurvesNames, nbValues]() {
+      curvesValues_.reserve(nbValues * sizeof(double));
+      for (auto &publisher : curvesPublishers_.find(CurvesStreamFormat::BYTES)->second)
+        publisher->sendMessage(formatedCurvesNames, "curves_names");
+    });
+  }
+  for (const auto& filteredPublisher : filteredCurvesPublishers_) {
+    if (filteredPublisher->format == CurvesStreamFormat::BYTES) {
+      std::string formatedCurvesNames = curvesNamesToString();
+      post([formatedCurvesNames, filteredPublisher]() {
+        filteredPublisher->channel->sendMessage(formatedCurvesNames, "curves_names");
+      });
+    } else if (filteredPublisher->format == CurvesStreamFormat::FRAME || filteredPublisher->format == CurvesStreamFormat::FRAME_FLOAT) {
+      const std::string formatedCurvesNames = std::to_string(curvesSetVersion_) + "\n" + curvesNamesToString();
+      post([formatedCurvesNames, filteredPublisher]() {
+        filteredPublisher->channel->sendMessage(formatedCurvesNames, "curves_frame_names");
+      });
+    }
+    // all the values are published again with the new names
+    post([filteredPublisher]() {
+      filteredPublisher->publishedValues.clear();
+    });
+  }
+  for (auto &curvePublishersPair : curvesPublishers_) {
+    if (curvePublishersPair.first != CurvesStreamFormat::FRAME && curvePublishersPair.first != CurvesStreamFormat::FRAME_FLOAT)
+      continue;
+    // the frames refer to the names through their version
+    const std::string formatedCurvesNames = std::to_string(curvesSetVersion_) + "\n" + curvesNamesToString();
+    const std::vector<std::shared_ptr<OutputChannel> >& publishers = curvePublishersPair.second;
+    post([formatedCurvesNames, &publishers]() {
+      for (auto &publisher : publishers)
+        publisher->sendMessage(formatedCurvesNames, "curves_frame_names");
+    });
   }
 }
 
 void
 OutputDispatcher::publishCurves(std::shared_ptr<curves::CurvesCollection>& curvesCollection) {
-  if (!curvesCollection)
+  if (!curvesCollection || (curvesPublishers_.empty() && filteredCurvesPublishers_.empty()))
     return;
+  std::shared_ptr<std::vector<double> > snapshot = std::make_shared<std::vector<double> >();
+  takeCurvesSnapshot(curvesCollection, *snapshot);
+  // the state of the filtered publishers is only used by the publication tasks
+  const std::uint32_t curvesSetVersion = curvesSetVersion_;
+  for (const auto& filteredPublisher : filteredCurvesPublishers_) {
+    post([this, snapshot, filteredPublisher, curvesSetVersion]() {
+      publishFilteredCurves(*filteredPublisher, *snapshot, curvesSetVersion);
+    }, true);
+  }
   for (auto &curvePublishersPair : curvesPublishers_) {
+    const std::vector<std::shared_ptr<OutputChannel> >& publishers = curvePublishersPair.second;
     switch (curvePublishersPair.first) {
     case CurvesStreamFormat::BYTES: {
-      updateCurvesValues(curvesCollection);
-      for (auto &publisher : curvePublishersPair.second)
-        publisher->sendMessage(curvesValues_, "curves_values");
+      post([this, snapshot, &publishers]() {
+        updateCurvesValues(*snapshot);
+        for (auto &publisher : publishers)
+          publisher->sendMessage(curvesValues_, "curves_values");
+      }, true);
+      break;
+    }
+    case CurvesStreamFormat::FRAME:
+    case CurvesStreamFormat::FRAME_FLOAT: {
+      const bool useFloat = curvePublishersPair.first == CurvesStreamFormat::FRAME_FLOAT;
+      const std::uint32_t curvesSetVersion = curvesSetVersion_;
+      post([this, snapshot, curvesSetVersion, useFloat, &publishers]() {
+        std::shared_ptr<OutputBuffer> buffer = getCurvesFrameBuffer();
+        fillCurvesFrame(*snapshot, curvesSetVersion, useFloat, *buffer);
+        for (auto &publisher : publishers)
+          publisher->sendMessage(buffer, "curves_frame");
+      }, true);
       break;
     }
     case CurvesStreamFormat::JSON: {
-      std::string outputSring = curvesToJson(curvesCollection);
-      for (auto &publisher : curvePublishersPair.second)
-        publisher->sendMessage(outputSring, "curves");
+      post([this, snapshot, &publishers]() {
+        std::string outputSring = curvesToJson(*snapshot);
+        for (auto &publisher : publishers)
+          publisher->sendMessage(outputSring, "curves");
+      }, true);
       break;
     }
     case CurvesStreamFormat::CSV: {
-      std::string outputSring = curvesToCsv(curvesCollection);
-      for (auto &publisher : curvePublishersPair.second)
-        publisher->sendMessage(outputSring, "curves");
+      post([this, snapshot, &publishers]() {
+        std::string outputSring = curvesToCsv(*snapshot);
+        for (auto &publisher : publishers)
+          publisher->sendMessage(outputSring, "curves");
+      }, true);
+      break;
+    }
+    case CurvesStreamFormat::XML: {
+      // the XML export reads the whole collection: it is formatted before the collection changes
+      std::stringstream stream;
+      curves::XmlExporter exporter;
+      exporter.exportToStream(curvesCollection, stream);
+      std::string outputSring = stream.str();
+      post([outputSring, &publishers]() {
+        for (auto &publisher : publishers)
+          publisher->sendMessage(outputSring, "curves");
+      }, true);
       break;
     }
-    case CurvesStreamFormat::XML:
-            std::stringstream stream;
-    curves::XmlExporter exporter;
-    exporter.exportToStream(curvesCollection, stream);
-    std::string outputSring = stream.str();
-    for (auto &publisher : curvePublishersPair.second)
-      publisher->sendMessage(outputSring, "curves");
-    break;
     }
   }
 }
@@ -157,15 +366,19 @@ OutputDispatcher::publishTimeline(boost::shared_ptr<timeline::Timeline>& timelin
   if (!timeline)
     return;
 
+  // the timeline is cleared after the publication: it is formatted by the simulation thread
   for (auto &timelinePublishersPair : timelinePublishers_) {
+    const std::vector<std::shared_ptr<OutputChannel> >& publishers = timelinePublishersPair.second;
     switch (timelinePublishersPair.first) {
     case TimelineStreamFormat::JSON: {
       std::stringstream stream;
       timeline::JsonExporter exporter;
       exporter.exportToStream(timeline, stream);
       std::string strTimeline = stream.str();
-      for (auto &publisher : timelinePublishersPair.second)
-        publisher->sendMessage(strTimeline, "timeline");
+      post([strTimeline, &publishers]() {
+        for (auto &publisher : publishers)
+          publisher->sendMessage(strTimeline, "timeline");
+      });
       break;
     }
     case TimelineStreamFormat::CSV: {
@@ -173,8 +386,10 @@ OutputDispatcher::publishTimeline(boost::shared_ptr<timeline::Timeline>& timelin
       timeline::CsvExporter exporter;
       exporter.exportToStream(timeline, stream);
       std::string strTimeline = stream.str();
-      for (auto &publisher : timelinePublishersPair.second)
-        publisher->sendMessage(strTimeline, "timeline");
+      post([strTimeline, &publishers]() {
+        for (auto &publisher : publishers)
+          publisher->sendMessage(strTimeline, "timeline");
+      });
       break;
     }
     case TimelineStreamFormat::TXT: {
@@ -182,8 +397,10 @@ OutputDispatcher::publishTimeline(boost::shared_ptr<timeline::Timeline>& timelin
       timeline::TxtExporter exporter;
       exporter.exportToStream(timeline, stream);
       std::string strTimeline = stream.str();
-      for (auto &publisher : timelinePublishersPair.second)
-        publisher->sendMessage(strTimeline, "timeline");
+      post([strTimeline, &publishers]() {
+        for (auto &publisher : publishers)
+          publisher->sendMessage(strTimeline, "timeline");
+      });
       break;
     }
     case TimelineStreamFormat::XML: {
@@ -191,8 +408,10 @@ OutputDispatcher::publishTimeline(boost::shared_ptr<timeline::Timeline>& timelin
       timeline::XmlExporter exporter;
       exporter.exportToStream(timeline, stream);
       std::string strTimeline = stream.str();
-      for (auto &publisher : timelinePublishersPair.second)
-        publisher->sendMessage(strTimeline, "timeline");
+      post([strTimeline, &publishers]() {
+        for (auto &publisher : publishers)
+          publisher->sendMessage(strTimeline, "timeline");
+      });
       break;
     }
     }
@@ -204,15 +423,19 @@ OutputDispatcher::publishConstraints(std::shared_ptr<constraints::ConstraintsCol
   if (!constraintsCollection)
     return;
 
+  // the constraints are cleared after the publication: they are formatted by the simulation thread
   for (auto &constraintsPublishersPair : constraintsPublishers_) {
+    const std::vector<std::shared_ptr<OutputChannel> >& publishers = constraintsPublishersPair.second;
     switch (constraintsPublishersPair.first) {
     case ConstraintsStreamFormat::JSON: {
       std::stringstream stream;
       constraints::JsonExporter exporter;
       exporter.exportToStream(constraintsCollection, stream);
       std::string strConstraints = stream.str();
-      for (auto &publisher : constraintsPublishersPair.second)
-        publisher->sendMessage(strConstraints, "constraints");
+      post([strConstraints, &publishers]() {
+        for (auto &publisher : publishers)
+          publisher->sendMessage(strConstraints, "constraints");
+      });
       break;
     }
     case ConstraintsStreamFormat::TXT: {
@@ -220,8 +443,10 @@ OutputDispatcher::publishConstraints(std::shared_ptr<constraints::ConstraintsCol
       constraints::TxtExporter exporter;
       exporter.exportToStream(constraintsCollection, stream);
       std::string strConstraints = stream.str();
-      for (auto &publisher : constraintsPublishersPair.second)
-        publisher->sendMessage(strConstraints, "constraints");
+      post([strConstraints, &publishers]() {
+        for (auto &publisher : publishers)
+          publisher->sendMessage(strConstraints, "constraints");
+      });
       break;
     }
     case ConstraintsStreamFormat::XML: {
@@ -229,35 +454,55 @@ OutputDispatcher::publishConstraints(std::shared_ptr<constraints::ConstraintsCol
       constraints::XmlExporter exporter;
       exporter.exportToStream(constraintsCollection, stream);
       std::string strConstraints = stream.str();
-      for (auto &publisher : constraintsPublishersPair.second)
-        publisher->sendMessage(strConstraints, "constraints");
+      post([strConstraints, &publishers]() {
+        for (auto &publisher : publishers)
+          publisher->sendMessage(strConstraints, "constraints");
+      });
       break;
     }
     }
   }
 }
 
+void
+OutputDispatcher::publishTelemetry(const std::string& telemetry) {
+  if (telemetryPublishers_.empty())
+    return;
+  post([this, telemetry]() {
+    for (auto &publisher : telemetryPublishers_)
+      publisher->sendMessage(telemetry, "telemetry");
+  }, true);
+}
+
+void
+OutputDispatcher::takeCurvesSnapshot(const std::shared_ptr<curves::CurvesCollection>& curvesCollection, std::vector<double>& snapshot) {
+  const bool namesKnown = !curvesNames_.empty();
+  snapshot.clear();
+  snapshot.reserve(curvesNames_.size() + 1);
+  for (const auto& curve : curvesCollection->getCurves()) {
+    if (curve->getAvailable()) {
+      if (snapshot.empty())
+        snapshot.push_back(curve->getLastTime());
+      snapshot.push_back(curve->getLastValue());
+      if (!namesKnown)
+        curvesNames_.push_back(curve->getUniqueName());
+    }
+  }
+}
 
 std::string
-OutputDispatcher::curvesToJson(std::shared_ptr<curves::CurvesCollection> curvesCollection) const {
+OutputDispatcher::curvesToJson(const std::vector<double>& snapshot, const std::vector<size_t>* indexes) const {
   std::stringstream stream;
-  double time = -1;
   stream << "{\n\t\"curves\": {\n";
   stream << "\t\t" << "\"values\": {\n";
-  for (auto &curve : curvesCollection->getCurves()) {
-    if (curve->getAvailable()) {
-      if (time < 0) {
-        time = curve->getLastTime();
-        stream << "\n";
-      } else {
-        stream << ",\n";
-      }
-      std::string curveName = curve->getUniqueName();
-      stream << "\t\t\t" << "\"" << curveName << "\": " << curve->getLastValue();
-    }
+  const size_t nbValues = indexes ? indexes->size() + 1 : snapshot.size();
+  for (size_t j = 1; j < nbValues; ++j) {
+    const size_t i = indexes ? (*indexes)[j - 1] : j;
+    stream << ((j == 1) ? "\n" : ",\n");
+    stream << "\t\t\t" << "\"" << curvesNames_[i - 1] << "\": " << snapshot[i];
   }
   stream << "\n\t\t" << "},\n";
-  stream << "\t\t" << "\"time\": " << time << "\n";
+  stream << "\t\t" << "\"time\": " << (snapshot.empty() ? -1. : snapshot[0]) << "\n";
   stream << "\t}\n}";
 
   return stream.str();
@@ -265,50 +510,120 @@ OutputDispatcher::curvesToJson(std::shared_ptr<curves::CurvesCollection> curvesC
 
 
 std::string
-OutputDispatcher::curvesToCsv(std::shared_ptr<curves::CurvesCollection> curvesCollection) const {
+OutputDispatcher::curvesToCsv(const std::vector<double>& snapshot, const std::vector<size_t>* indexes) const {
   std::stringstream stream;
-  double time = -1;
-  for (auto &curve : curvesCollection->getCurves()) {
-    if (curve->getAvailable()) {
-      if (time < 0) {
-        time = curve->getLastTime();
-        stream << "time," << time << "\n";
-      }
-      std::string curveName = curve->getUniqueName();
-      stream << curveName << "," << curve->getLastValue() << "\n";
-    }
+  if (!snapshot.empty())
+    stream << "time," << snapshot[0] << "\n";
+  const size_t nbValues = indexes ? indexes->size() + 1 : snapshot.size();
+  for (size_t j = 1; j < nbValues; ++j) {
+    const size_t i = indexes ? (*indexes)[j - 1] : j;
+    stream << curvesNames_[i - 1] << "," << snapshot[i] << "\n";
   }
   return stream.str();
 }
 
+void
+OutputDispatcher::publishFilteredCurves(FilteredCurvesPublisher& publisher, const std::vector<double>& snapshot,
+    const std::uint32_t curvesSetVersion) {
+  if (snapshot.empty())
+    return;
+  const PublicationPolicy& policy = publisher.policy;
+  const bool firstPublication = publisher.publishedValues.size() != snapshot.size();
+  if (!firstPublication && policy.minPeriod > 0. && snapshot[0] - publisher.lastPublicationTime < policy.minPeriod)
+    return;
+  const bool keyframe = firstPublication || (policy.keyframeInterval > 0 && publisher.nbPublicationsSinceKeyframe >= policy.keyframeInterval);
+
+  std::vector<size_t> changedIndexes;
+  for (size_t i = 1; i < snapshot.size(); ++i) {
+    // a value that becomes or stops being NaN is a change too
+    if (keyframe || !(std::fabs(snapshot[i] - publisher.publishedValues[i]) <= policy.deadband))
+      changedIndexes.push_back(i);
+  }
+  if (!keyframe && changedIndexes.empty())
+    return;
+
+  switch (publisher.format) {
+  case CurvesStreamFormat::JSON:
+    publisher.channel->sendMessage(curvesToJson(snapshot, &changedIndexes), "curves");
+    break;
+  case CurvesStreamFormat::CSV:
+    publisher.channel->sendMessage(curvesToCsv(snapshot, &changedIndexes), "curves");
+    break;
+  case CurvesStreamFormat::BYTES:
+    // the values are identified by their position: they are all sent
+    changedIndexes.resize(snapshot.size() - 1);
+    for (size_t i = 1; i < snapshot.size(); ++i)
+      changedIndexes[i - 1] = i;
+    updateCurvesValues(snapshot);
+    publisher.channel->sendMessage(curvesValues_, "curves_values");
+    break;
+  case CurvesStreamFormat::FRAME:
+  case CurvesStreamFormat::FRAME_FLOAT: {
+    changedIndexes.resize(snapshot.size() - 1);
+    for (size_t i = 1; i < snapshot.size(); ++i)
+      changedIndexes[i - 1] = i;
+    std::shared_ptr<OutputBuffer> buffer = getCurvesFrameBuffer();
+    fillCurvesFrame(snapshot, curvesSetVersion, publisher.format == CurvesStreamFormat::FRAME_FLOAT, *buffer);
+    publisher.channel->sendMessage(buffer, "curves_frame");
+    break;
+  }
+  case CurvesStreamFormat::XML:
+    break;
+  }
+
+  // the deadband is measured from the last published value of each curve
+  if (firstPublication)
+    publisher.publishedValues = snapshot;
+  publisher.publishedValues[0] = snapshot[0];
+  for (size_t i : changedIndexes)
+    publisher.publishedValues[i] = snapshot[i];
+  publisher.lastPublicationTime = snapshot[0];
+  publisher.nbPublicationsSinceKeyframe = keyframe ? 1 : publisher.nbPublicationsSinceKeyframe + 1;
+}
+
 std::string
-OutputDispatcher::curvesNamesToString(std::shared_ptr<curves::CurvesCollection> curvesCollection) const {
+OutputDispatcher::curvesNamesToString() const {
   std::stringstream stream;
   stream << "time" << "\n";
-  for (auto &curve : curvesCollection->getCurves()) {
-    if (curve->getAvailable()) {
-      std::string curveName = curve->getUniqueName();
-      stream << curveName << "\n";
-    }
-  }
+  for (const auto& curveName : curvesNames_)
+    stream << curveName << "\n";
   return stream.str();
 }
 
 void
-OutputDispatcher::updateCurvesValues(std::shared_ptr<curves::CurvesCollection> curvesCollection) {
-  curvesValues_.clear();
-  double time = -1;
-  for (auto &curve : curvesCollection->getCurves()) {
-    if (curve->getAvailable()) {
-      if (time < 0) {
-        time = curve->getLastTime();
-        std::uint8_t* rawBytes = reinterpret_cast<std::uint8_t*>(&time);
-        curvesValues_.insert(curvesValues_.end(), rawBytes, rawBytes + sizeof(double));
-      }
-      double value = curve->getLastValue();
-      std::uint8_t* rawBytes = reinterpret_cast<std::uint8_t*>(&value);
-      curvesValues_.insert(curvesValues_.end(), rawBytes, rawBytes + sizeof(double));
+OutputDispatcher::updateCurvesValues(const std::vector<double>& snapshot) {
+  const std::uint8_t* rawBytes = reinterpret_cast<const std::uint8_t*>(snapshot.data());
+  curvesValues_.assign(rawBytes, rawBytes + snapshot.size() * sizeof(double));
+}
+
+std::shared_ptr<OutputBuffer>
+OutputDispatcher::getCurvesFrameBuffer() {
+  for (const auto& buffer : curvesFrameBuffers_)
+    if (!buffer->isSending())
+      return buffer;
+  curvesFrameBuffers_.push_back(std::make_shared<OutputBuffer>());
+  return curvesFrameBuffers_.back();
+}
+
+void
+OutputDispatcher::fillCurvesFrame(const std::vector<double>& snapshot, const std::uint32_t curvesSetVersion, const bool useFloat,
+    OutputBuffer& buffer) {
+  CurvesFrameHeader header;
+  header.curvesSetVersion = curvesSetVersion;
+  header.nbValues = static_cast<std::uint32_t>(snapshot.size());
+  header.valueSize = useFloat ? sizeof(float) : sizeof(double);
+  // the buffer keeps its capacity from one frame to the next
+  std::vector<std::uint8_t>& bytes = buffer.getBytes();
+  bytes.resize(sizeof(header) + snapshot.size() * header.valueSize);
+  std::memcpy(bytes.data(), &header, sizeof(header));
+  std::uint8_t* values = bytes.data() + sizeof(header);
+  if (useFloat) {
+    for (size_t i = 0; i < snapshot.size(); ++i) {
+      const float value = static_cast<float>(snapshot[i]);
+      std::memcpy(values + i * sizeof(float), &value, sizeof(float));
     }
+  } else if (!snapshot.empty()) {
+    std::memcpy(values, snapshot.data(), snapshot.size() * sizeof(double));
   }
 }
 
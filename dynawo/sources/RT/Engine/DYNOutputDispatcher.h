@@ -23,6 +23,12 @@
 #include <memory>
 #include <vector>
 #include <map>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
 
 #include "DYNRTOutputCommon.h"
 #include "DYNActionBuffer.h"
@@ -46,12 +52,54 @@ class OutputDispatcher {
    */
   OutputDispatcher();
 
+  /**
+   * @brief destructor, waiting for the pending publications
+   */
+  ~OutputDispatcher();
+
+  /**
+   * @brief send the publications from a writer thread from now on
+   *
+   * The simulation thread only takes a snapshot of the published data, the formatting of the curves and
+   * the sending to the channels being done by the writer thread.
+   * The publications are queued by frames, a frame holding all the publications of a coupling period.
+   *
+   * @param maxQueueSize maximum number of pending frames
+   * @param policy behaviour when the maximum number of pending frames is reached
+   */
+  void startAsync(size_t maxQueueSize, OutputQueuePolicy policy = OutputQueuePolicy::BLOCK);
+
+  /**
+   * @brief wait for the pending publications and stop the writer thread
+   */
+  void stopAsync();
+
+  /**
+   * @brief start a frame: the following publications are queued together, until endFrame is called
+   */
+  void beginFrame();
+
+  /**
+   * @brief end a frame and queue its publications
+   */
+  void endFrame();
+
+  /**
+   * @brief get the number of frames whose curves and telemetry publications were dropped
+   * @return number of dropped frames
+   */
+  size_t getNbDroppedFrames() const {
+    return nbDroppedFrames_;
+  }
+
   /**
    * @brief add a curves output channel
    * @param publisher channel for publication
    * @param formatStr string of the format
+   * @param policy filtering of the publications, ignored for the XML format
    */
-  void addCurvesPublisher(std::shared_ptr<OutputChannel>& publisher, const std::string formatStr);
+  void addCurvesPublisher(std::shared_ptr<OutputChannel>& publisher, const std::string formatStr,
+      const PublicationPolicy& policy = PublicationPolicy());
 
   /**
    * @brief add a timeline output channel
@@ -74,6 +122,21 @@ class OutputDispatcher {
    */
   void addLogsPublisher(std::shared_ptr<OutputChannel>& publisher, const std::string formatStr);
 
+  /**
+   * @brief add a telemetry output channel
+   * @param publisher channel for publication
+   * @param formatStr string of the format, only JSON is supported
+   */
+  void addTelemetryPublisher(std::shared_ptr<OutputChannel>& publisher, const std::string formatStr);
+
+  /**
+   * @brief whether a telemetry output channel was added
+   * @return @b true if the telemetry is published
+   */
+  bool hasTelemetryPublishers() const {
+    return !telemetryPublishers_.empty();
+  }
+
   /**
    * @brief publish curves names
    * @param curvesCollection curves collection to publish
@@ -98,41 +161,138 @@ class OutputDispatcher {
    */
   void publishConstraints(std::shared_ptr<constraints::ConstraintsCollection>& constraintsCollection);
 
+  /**
+   * @brief publish real-time telemetry
+   * @param telemetry telemetry as a JSON object
+   */
+  void publishTelemetry(const std::string& telemetry);
+
  private:
   /**
-   * @brief format last curves point in JSON
-   * @param curvesCollection curves collection to serialize
+   * @brief publication task
+   */
+  struct PublicationTask {
+    std::function<void()> run;  ///< function sending the publication
+    bool droppable;             ///< @b true if the publication may be dropped when the writer thread is late
+  };
+
+  /**
+   * @typedef Frame
+   * @brief Alias for the publication tasks of a coupling period
+   */
+  typedef std::vector<PublicationTask> Frame;
+
+  /**
+   * @brief run a publication task, in the writer thread if it is started
+   * @param task task to run
+   * @param droppable @b true if the publication only holds the last values (curves, telemetry) and may be dropped
+   */
+  void post(std::function<void()>&& task, bool droppable = false);
+
+  /**
+   * @brief queue a frame for the writer thread, according to the queue policy
+   * @param frame frame to queue
+   */
+  void pushFrame(Frame&& frame);
+
+  /**
+   * @brief loop of the writer thread
+   */
+  void writerLoop();
+
+  /**
+   * @brief copy the time and the last values of the available curves
+   * @param curvesCollection curves collection to copy
+   * @param snapshot time followed by the last value of each available curve
+   */
+  void takeCurvesSnapshot(const std::shared_ptr<curves::CurvesCollection>& curvesCollection, std::vector<double>& snapshot);
+
+  /**
+   * @brief format a curves snapshot in JSON
+   * @param snapshot time followed by the last value of each available curve
+   * @param indexes indexes in the snapshot of the values to format, all the values if null
    * @return formated curves
    */
-  std::string curvesToJson(std::shared_ptr<curves::CurvesCollection> curvesCollection) const;
+  std::string curvesToJson(const std::vector<double>& snapshot, const std::vector<size_t>* indexes = NULL) const;
 
   /**
-   * @brief format last curves point in CSV
-   * @param curvesCollection curves collection to serialize
+   * @brief format a curves snapshot in CSV
+   * @param snapshot time followed by the last value of each available curve
+   * @param indexes indexes in the snapshot of the values to format, all the values if null
    * @return formated curves
    */
-  std::string curvesToCsv(std::shared_ptr<curves::CurvesCollection> curvesCollection) const;
+  std::string curvesToCsv(const std::vector<double>& snapshot, const std::vector<size_t>* indexes = NULL) const;
 
   /**
   * @brief format curves names in CSV
-  * @param curvesCollection curves collection to serialize
   * @return formated curve names
   */
-  std::string curvesNamesToString(std::shared_ptr<curves::CurvesCollection> curvesCollection) const;
+  std::string curvesNamesToString() const;
+
+  /**
+  * @brief update the bytes buffer of the curves values
+  * @param snapshot time followed by the last value of each available curve
+  */
+  void updateCurvesValues(const std::vector<double>& snapshot);
+
+  /**
+   * @brief curves output channel whose publications are filtered
+   */
+  struct FilteredCurvesPublisher {
+    std::shared_ptr<OutputChannel> channel;  ///< channel for publication
+    CurvesStreamFormat format;               ///< format of the publications
+    PublicationPolicy policy;                ///< filtering of the publications
+    std::vector<double> publishedValues;     ///< last published value of each curve, time first
+    double lastPublicationTime;              ///< simulation time of the last publication
+    unsigned int nbPublicationsSinceKeyframe;  ///< number of publications since the last publication of all the values
+  };
+
+  /**
+  * @brief publish a curves snapshot to a filtered channel, if the policy lets it
+  * @param publisher filtered channel
+  * @param snapshot time followed by the last value of each available curve
+  * @param curvesSetVersion version of the curves names
+  */
+  void publishFilteredCurves(FilteredCurvesPublisher& publisher, const std::vector<double>& snapshot, std::uint32_t curvesSetVersion);
 
   /**
-  * @brief update the value of curves in a collection
-  * @param curvesCollection curves collection to update
+  * @brief get a frame buffer that no channel is sending anymore, a new one being created if they are all in use
+  * @return frame buffer
   */
-  void updateCurvesValues(std::shared_ptr<curves::CurvesCollection> curvesCollection);
+  std::shared_ptr<OutputBuffer> getCurvesFrameBuffer();
+
+  /**
+  * @brief write a binary curves frame
+  * @param snapshot time followed by the last value of each available curve
+  * @param curvesSetVersion version of the curves names
+  * @param useFloat @b true to write the values as floats, @b false as doubles
+  * @param buffer buffer to write the frame to
+  */
+  static void fillCurvesFrame(const std::vector<double>& snapshot, std::uint32_t curvesSetVersion, bool useFloat, OutputBuffer& buffer);
 
  private:
   std::map<CurvesStreamFormat, std::vector<std::shared_ptr<OutputChannel> > > curvesPublishers_;            ///< curves publishers
+  std::vector<std::shared_ptr<FilteredCurvesPublisher> > filteredCurvesPublishers_;                        ///< curves publishers with a policy
   std::map<TimelineStreamFormat, std::vector<std::shared_ptr<OutputChannel> > > timelinePublishers_;        ///< timeline publishers
   std::map<ConstraintsStreamFormat, std::vector<std::shared_ptr<OutputChannel> > > constraintsPublishers_;  ///< constraints publishers
+  std::vector<std::shared_ptr<OutputChannel> > telemetryPublishers_;                                        ///< telemetry publishers
 
+  std::vector<std::string> curvesNames_;    ///< unique names of the available curves
   std::vector<std::uint8_t> curvesValues_;  ///< curves values buffer for BYTES export optimization
-  std::atomic<bool> running_;               ///< running flag
+  std::uint32_t curvesSetVersion_;          ///< version of the published curves names
+  std::vector<std::shared_ptr<OutputBuffer> > curvesFrameBuffers_;  ///< reusable curves frame buffers, only used by the publication tasks
+  std::atomic<bool> running_;               ///< running flag of the writer thread
+
+  size_t maxQueueSize_;                           ///< maximum number of pending frames
+  OutputQueuePolicy queuePolicy_;                 ///< behaviour when the maximum number of pending frames is reached
+  std::deque<Frame> frames_;                      ///< pending frames
+  Frame currentFrame_;                            ///< publications of the frame being built by the simulation thread
+  bool frameOpen_;                                ///< @b true between beginFrame and endFrame
+  size_t nbDroppedFrames_;                        ///< number of frames whose droppable publications were dropped
+  std::mutex queueMutex_;                         ///< mutex for task push/pop in the queue
+  std::condition_variable queueCond_;             ///< condition for a task pushed or the writer stopped
+  std::condition_variable queueNotFullCond_;      ///< condition for a task popped
+  std::thread writerThread_;                      ///< writer thread
 };
 
 }  // end of namespace DYN
@@ -22,12 +22,63 @@
 
 #include "DYNRTInputCommon.h"
 
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+
 namespace DYN {
 
+static const char HANDLE_REGISTRATION_OPCODE = 'R';  ///< opcode of a handle registration message
+static const char HANDLE_VALUES_OPCODE = 'V';  ///< opcode of a handle values message
+static const std::size_t HANDLE_VALUE_RECORD_SIZE = sizeof(std::int32_t) + sizeof(double);  ///< size of a (handle, value) record
+
 InputChannel::InputChannel(const std::string& id, MessageFilter supportedMessages):
   id_(id),
   supportedMessages_(supportedMessages) { }
 
 InputChannel::~InputChannel() = default;
 
+bool
+InputChannel::isHandleMessage(const char* data, const std::size_t size) {
+  return size >= 2 && data[0] == '\0';
+}
+
+std::shared_ptr<InputMessage>
+InputChannel::decodeHandleMessage(const char* data, const std::size_t size, std::string& reply) {
+  if (!supports(MessageFilter::Actions)) {
+    reply = "action received but not supported";
+    return std::shared_ptr<InputMessage>();
+  }
+
+  const char opcode = data[1];
+  data += 2;
+  const std::size_t dataSize = size - 2;
+  if (opcode == HANDLE_REGISTRATION_OPCODE) {
+    std::istringstream stream(std::string(data, dataSize));
+    std::ostringstream handles;
+    handles << "handles";
+    std::string subModelName;
+    std::string parameterName;
+    while (std::getline(stream, subModelName, ',') && std::getline(stream, parameterName, ','))
+      handles << "," << (handleResolver_ ? handleResolver_(subModelName, parameterName) : -1);
+    reply = handles.str();
+    return std::shared_ptr<InputMessage>();
+  }
+  if (opcode == HANDLE_VALUES_OPCODE && dataSize % HANDLE_VALUE_RECORD_SIZE == 0) {
+    std::shared_ptr<ActionValuesMessage> message = std::make_shared<ActionValuesMessage>();
+    message->values.reserve(dataSize / HANDLE_VALUE_RECORD_SIZE);
+    for (std::size_t offset = 0; offset < dataSize; offset += HANDLE_VALUE_RECORD_SIZE) {
+      std::int32_t handle;
+      double value;
+      std::memcpy(&handle, data + offset, sizeof(handle));
+      std::memcpy(&value, data + offset + sizeof(handle), sizeof(value));
+      message->values.push_back(std::make_pair(static_cast<int>(handle), value));
+    }
+    reply = "values received";
+    return message;
+  }
+  reply = "handle message unparsable";
+  return std::shared_ptr<InputMessage>();
+}
+
 }  // end of namespace DYN
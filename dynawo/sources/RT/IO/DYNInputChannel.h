@@ -20,8 +20,10 @@
 #ifndef RT_IO_DYNINPUTCHANNEL_H_
 #define RT_IO_DYNINPUTCHANNEL_H_
 
+#include <cstddef>
 #include <memory>
 #include <functional>
+#include <string>
 
 #include "DYNRTInputCommon.h"
 
@@ -61,6 +63,20 @@ class InputChannel {
    */
   virtual void stop() = 0;
 
+  /**
+   * @typedef HandleResolver
+   * @brief function returning the handle of a parameter of a sub model, or -1 if it cannot be used in actions
+   */
+  typedef std::function<int(const std::string& subModelName, const std::string& parameterName)> HandleResolver;
+
+  /**
+   * @brief Set the function used to register action handles.
+   * @param resolver function returning the handle of a parameter
+   */
+  inline void setHandleResolver(const HandleResolver& resolver) {
+    handleResolver_ = resolver;
+  }
+
   /**
    * @brief Check if this channel supports a given message type.
    * @param value Message filter to test
@@ -70,9 +86,34 @@ class InputChannel {
     return (static_cast<int>(supportedMessages_) & static_cast<int>(value)) != 0;
   }
 
+ protected:
+  /**
+   * @brief Check if a payload is a binary handle message rather than a text message.
+   * @param data payload
+   * @param size size of the payload
+   * @return true if the payload starts with a null byte
+   */
+  static bool isHandleMessage(const char* data, std::size_t size);
+
+  /**
+   * @brief Decode a binary handle message.
+   *
+   * A handle message starts with a null byte followed by an opcode:
+   * - 'R': registration of the comma-separated list 'model,parameter,model,parameter...', answered by 'handles,h1,h2...'
+   * (-1 for a parameter which cannot be used in actions). Each registered pair takes the next handle, starting from 0;
+   * - 'V': new values, as a sequence of (int32 handle, float64 value) in native byte order, without padding.
+   *
+   * @param data payload
+   * @param size size of the payload
+   * @param reply reply to send to the client
+   * @return message to dispatch, null for a registration or an invalid message
+   */
+  std::shared_ptr<InputMessage> decodeHandleMessage(const char* data, std::size_t size, std::string& reply);
+
  protected:
   std::string id_;                   ///< Identifier of the input channel
   MessageFilter supportedMessages_;  ///< Supported message types
+  HandleResolver handleResolver_;    ///< Function registering action handles
 };
 
 }  // end of namespace DYN
@@ -20,12 +20,58 @@
 #ifndef RT_IO_DYNOUTPUTCHANNEL_H_
 #define RT_IO_DYNOUTPUTCHANNEL_H_
 
+#include <atomic>
 #include <memory>
+#include <string>
 #include <vector>
 #include <cstdint>
 
 namespace DYN {
 
+/**
+ * @class OutputBuffer
+ * @brief Reusable bytes buffer, that a channel may keep while it sends it without copying
+ */
+class OutputBuffer {
+ public:
+  /**
+   * @brief Constructor.
+   */
+  OutputBuffer() : pendingSends_(0) { }
+
+  /**
+   * @brief Get the bytes of the buffer, to be modified only when the buffer is not sent anymore
+   * @return bytes of the buffer
+   */
+  std::vector<std::uint8_t>& getBytes() { return bytes_; }
+
+  /**
+   * @brief Get the bytes of the buffer
+   * @return bytes of the buffer
+   */
+  const std::vector<std::uint8_t>& getBytes() const { return bytes_; }
+
+  /**
+   * @brief Whether a channel is still sending the buffer
+   * @return @b true if the buffer must not be modified
+   */
+  bool isSending() const { return pendingSends_.load(std::memory_order_acquire) > 0; }
+
+  /**
+   * @brief Declare that a channel starts sending the buffer
+   */
+  void beginSend() { pendingSends_.fetch_add(1, std::memory_order_relaxed); }
+
+  /**
+   * @brief Declare that a channel is done with the buffer, possibly from another thread
+   */
+  void endSend() { pendingSends_.fetch_sub(1, std::memory_order_release); }
+
+ private:
+  std::vector<std::uint8_t> bytes_;  ///< bytes of the buffer
+  std::atomic<int> pendingSends_;    ///< number of channels still sending the buffer
+};
+
 /**
  * @class OutputChannel
  * @brief Abstract base class for real-time simulation output channels.
@@ -54,6 +100,19 @@ class OutputChannel {
    * @param topic Message topic
    */
   virtual void sendMessage(const std::vector<std::uint8_t>& data, const std::string& topic) = 0;
+
+  /**
+   * @brief Send a buffer with a topic, without copying it if the channel supports it.
+   *
+   * The buffer is kept until the channel is done with it, see OutputBuffer::isSending.
+   * The default implementation sends a copy of the bytes.
+   *
+   * @param buffer Message content
+   * @param topic Message topic
+   */
+  virtual void sendMessage(const std::shared_ptr<OutputBuffer>& buffer, const std::string& topic) {
+    sendMessage(buffer->getBytes(), topic);
+  }
 };
 
 }  // end of namespace DYN
@@ -0,0 +1,92 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+
+/**
+ * @file  DYNShmInputChannel.cpp
+ *
+ * @brief Input channel reading a shared memory ring implementation
+ *
+ */
+#include "DYNShmInputChannel.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+namespace DYN {
+
+static const char STOP_KEY[] = "stop";  ///< Key used to signal stop
+static const std::size_t INPUT_RING_CAPACITY = 1 << 20;  ///< Capacity of the input ring in bytes
+
+ShmInputChannel::ShmInputChannel(const std::string& id, MessageFilter messageFilter, const std::string& name) :
+InputChannel(id, messageFilter),
+ring_(name, INPUT_RING_CAPACITY, true),
+stopFlag_(false),
+pollTimeoutMs_(10),
+stepTriggerMessage_(std::make_shared<StepTriggerMessage>()),
+stopMessage_(std::make_shared<StopMessage>()) {
+}
+
+ShmInputChannel::~ShmInputChannel() {
+  stop();
+}
+
+void
+ShmInputChannel::startReceiving(const std::function<void(std::shared_ptr<InputMessage>)>& callback, bool useThread) {
+  callback_ = callback;
+  if (useThread) {
+    thread_ = std::thread([this]() { receiveLoop(); });
+  }
+}
+
+void
+ShmInputChannel::stop() {
+  if (!stopFlag_) {
+    stopFlag_ = true;
+    if (thread_.joinable())
+      thread_.join();
+  }
+}
+
+void
+ShmInputChannel::receiveLoop() {
+  std::string topic;
+  std::vector<std::uint8_t> data;
+  while (!stopFlag_) {
+    if (!ring_.tryRead(topic, data)) {
+      ring_.waitForMessage(pollTimeoutMs_);
+      continue;
+    }
+
+    std::shared_ptr<InputMessage> inputMsg;
+    const char* payload = reinterpret_cast<const char*>(data.data());
+    if (isHandleMessage(payload, data.size())) {
+      // the reply to a registration cannot be sent: the client numbers the handles in the order of registration
+      std::string reply;
+      inputMsg = decodeHandleMessage(payload, data.size(), reply);
+    } else if (data.empty()) {
+      if (supports(MessageFilter::Trigger))
+        inputMsg = stepTriggerMessage_;
+    } else if (data.size() == sizeof(STOP_KEY) - 1 && std::equal(data.begin(), data.end(), STOP_KEY)) {
+      if (supports(MessageFilter::TimeManagement))
+        inputMsg = stopMessage_;
+    } else if (supports(MessageFilter::Actions)) {
+      inputMsg = std::make_shared<ActionMessage>(std::string(data.begin(), data.end()));
+    }
+
+    if (callback_) callback_(std::move(inputMsg));
+  }
+}
+
+}  // end of namespace DYN
@@ -0,0 +1,87 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+
+/**
+ * @file  DYNShmInputChannel.h
+ *
+ * @brief Input channel reading a shared memory ring header
+ *
+ */
+#ifndef RT_IO_DYNSHMINPUTCHANNEL_H_
+#define RT_IO_DYNSHMINPUTCHANNEL_H_
+
+#include "DYNInputChannel.h"
+#include "DYNShmRing.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace DYN {
+
+/**
+ * @class ShmInputChannel
+ * @brief Input channel implementation using a shared memory ring, for clients running on the same host.
+ *
+ * The channel creates the ring, the client opens it by name and writes messages into it.
+ * Messages follow the ZeroMQ input protocol: an empty message is a step trigger, "stop" stops the simulation
+ * and any other message is an action. No reply is sent back.
+ */
+class ShmInputChannel: public InputChannel {
+ public:
+  /**
+   * @brief Constructor.
+   * @param id Identifier of the channel
+   * @param messageFilter Filter applied on incoming messages
+   * @param name Name of the shared memory segment to create
+   */
+  ShmInputChannel(const std::string& id, MessageFilter messageFilter, const std::string& name = "/dynawo_input");
+
+  /**
+   * @brief Destructor: stop the reception and remove the segment
+   */
+  ~ShmInputChannel();
+
+  /**
+   * @brief Start receiving messages.
+   * @param callback Function called for each received message
+   * @param useThread Whether to run reception in a separate thread (default: true)
+   */
+  void startReceiving(const std::function<void(std::shared_ptr<InputMessage>)>& callback, bool useThread = true) override;
+
+  /**
+   * @brief Stop receiving messages.
+   */
+  void stop() override;
+
+ private:
+  /**
+   * @brief Reception loop executed in a thread when enabled.
+   */
+  void receiveLoop();
+
+ private:
+  ShmRing ring_;                        ///< Ring written by the client
+  std::atomic<bool> stopFlag_;          ///< Flag to signal stopping reception
+  long pollTimeoutMs_;                  ///< Maximum wait for a message before checking the stop flag, in milliseconds
+  std::function<void(std::shared_ptr<InputMessage>)> callback_;  ///< Callback for received messages
+  std::shared_ptr<StepTriggerMessage> stepTriggerMessage_;  ///< Trigger message, preallocated and sent for each trigger as it holds no data
+  std::shared_ptr<StopMessage> stopMessage_;  ///< Stop message, preallocated and sent for each stop as it holds no data
+  std::thread thread_;                  ///< Thread for message reception
+};
+
+}  // end of namespace DYN
+
+#endif  // RT_IO_DYNSHMINPUTCHANNEL_H_
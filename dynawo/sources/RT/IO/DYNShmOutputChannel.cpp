@@ -0,0 +1,57 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+
+/**
+ * @file  DYNShmOutputChannel.cpp
+ *
+ * @brief Output channel writing a shared memory ring implementation
+ *
+ */
+
+#include "DYNShmOutputChannel.h"
+#include "DYNMacrosMessage.h"
+#include "DYNTrace.h"
+
+namespace DYN {
+
+static const std::size_t OUTPUT_RING_CAPACITY = 1 << 24;  ///< Capacity of the output ring in bytes
+
+ShmOutputChannel::ShmOutputChannel(const std::string& name) :
+ring_(name, OUTPUT_RING_CAPACITY, true) {
+}
+
+void
+ShmOutputChannel::sendMessage(const std::string& data) {
+  sendMessage(data, "");
+}
+
+void
+ShmOutputChannel::sendMessage(const std::string& data, const std::string& topic) {
+  write(data.data(), data.size(), topic);
+}
+
+void
+ShmOutputChannel::sendMessage(const std::vector<std::uint8_t>& data, const std::string& topic) {
+  write(data.data(), data.size(), topic);
+}
+
+void
+ShmOutputChannel::write(const void* data, const std::size_t size, const std::string& topic) {
+  if (ring_.tryWrite(topic, data, size))
+    Trace::debug() << DYNLog(ShmDataSent, topic) << Trace::endline;
+  else
+    Trace::debug() << DYNLog(ShmDataDropped, topic) << Trace::endline;
+}
+
+}  // end of namespace DYN
@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+
+/**
+ * @file  DYNShmOutputChannel.h
+ *
+ * @brief Output channel writing a shared memory ring header
+ *
+ */
+#ifndef RT_IO_DYNSHMOUTPUTCHANNEL_H_
+#define RT_IO_DYNSHMOUTPUTCHANNEL_H_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "DYNOutputChannel.h"
+#include "DYNShmRing.h"
+
+namespace DYN {
+
+/**
+ * @class ShmOutputChannel
+ * @brief Output channel implementation using a shared memory ring, for clients running on the same host.
+ *
+ * The channel creates the ring, the client opens it by name and reads the messages with their topic.
+ * As with a ZeroMQ PUB socket, a message is dropped if the client is too slow and the ring is full.
+ */
+class ShmOutputChannel : public OutputChannel {
+ public:
+  /**
+   * @brief Constructor.
+   * @param name Name of the shared memory segment to create
+   */
+  explicit ShmOutputChannel(const std::string& name = "/dynawo_output");
+
+  /**
+   * @brief Send a message as a string.
+   * @param data Message content
+   */
+  void sendMessage(const std::string& data) override;
+
+  /**
+   * @brief Send a message as a string with a topic.
+   * @param data Message content
+   * @param topic Message topic
+   */
+  void sendMessage(const std::string& data, const std::string& topic) override;
+
+  /**
+   * @brief Send a message as raw bytes with a topic.
+   * @param data Message content as a byte vector
+   * @param topic Message topic
+   */
+  void sendMessage(const std::vector<std::uint8_t>& data, const std::string& topic) override;
+
+ private:
+  /**
+   * @brief Write a message into the ring
+   * @param data Message content
+   * @param size Size of the message content
+   * @param topic Message topic
+   */
+  void write(const void* data, std::size_t size, const std::string& topic);
+
+ private:
+  ShmRing ring_;  ///< Ring read by the client
+};
+
+}  // end of namespace DYN
+
+#endif  // RT_IO_DYNSHMOUTPUTCHANNEL_H_
@@ -0,0 +1,205 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+/**
+ * @file  DYNShmRing.cpp
+ *
+ * @brief Ring buffer of messages in a named shared memory segment implementation
+ *
+ */
+#include "DYNShmRing.h"
+#include "DYNMacrosMessage.h"
+#include "DYNTrace.h"
+
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+namespace DYN {
+
+static const std::uint32_t SHM_RING_MAGIC = 0x44594e52;  ///< "DYNR"
+static const std::uint32_t SHM_RING_LAYOUT_VERSION = 1;  ///< version of the layout of the segment
+static const std::uint32_t PADDING_RECORD = 0xffffffff;  ///< topic size of a padding record, up to the end of the data area
+static const std::size_t RECORD_HEADER_SIZE = 2 * sizeof(std::uint32_t);  ///< topic size and data size of a record
+
+/**
+ * @brief size of a record, padded to 8 bytes
+ * @param topicSize size of the topic
+ * @param dataSize size of the data
+ * @return size of the record
+ */
+static std::uint64_t recordSize(const std::size_t topicSize, const std::size_t dataSize) {
+  return (RECORD_HEADER_SIZE + topicSize + dataSize + 7) & ~static_cast<std::uint64_t>(7);
+}
+
+ShmRing::ShmRing(const std::string& name, std::size_t capacity, const bool create) :
+name_(name),
+owner_(create),
+mappedSize_(0),
+header_(NULL),
+data_(NULL) {
+  std::size_t roundedCapacity = 64;
+  while (roundedCapacity < capacity)
+    roundedCapacity <<= 1;
+
+  int fd = -1;
+  if (create) {
+    shm_unlink(name.c_str());
+    fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    mappedSize_ = sizeof(Header) + roundedCapacity;
+    if (fd >= 0 && ftruncate(fd, static_cast<off_t>(mappedSize_)) != 0) {
+      close(fd);
+      fd = -1;
+    }
+  } else {
+    fd = shm_open(name.c_str(), O_RDWR, 0);
+    struct stat status;
+    if (fd >= 0 && fstat(fd, &status) == 0)
+      mappedSize_ = static_cast<std::size_t>(status.st_size);
+  }
+  if (fd < 0 || mappedSize_ <= sizeof(Header))
+    throw DYNError(Error::GENERAL, ShmChannelOpenFailed, name, strerror(errno));
+
+  void* address = mmap(NULL, mappedSize_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (address == MAP_FAILED)
+    throw DYNError(Error::GENERAL, ShmChannelOpenFailed, name, strerror(errno));
+  header_ = static_cast<Header*>(address);
+  data_ = static_cast<std::uint8_t*>(address) + sizeof(Header);
+
+  if (create) {
+    // the segment is zero-filled by ftruncate, the positions are written before the magic number which publishes them
+    header_->capacity = roundedCapacity;
+    header_->layoutVersion = SHM_RING_LAYOUT_VERSION;
+    header_->writePosition.store(0, std::memory_order_relaxed);
+    header_->readPosition.store(0, std::memory_order_relaxed);
+    header_->futexWord.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    header_->magic = SHM_RING_MAGIC;
+  } else if (header_->magic != SHM_RING_MAGIC || header_->layoutVersion != SHM_RING_LAYOUT_VERSION
+      || sizeof(Header) + header_->capacity != mappedSize_) {
+    munmap(address, mappedSize_);
+    throw DYNError(Error::GENERAL, ShmChannelOpenFailed, name, "not a dynawo ring");
+  }
+}
+
+ShmRing::~ShmRing() {
+  munmap(header_, mappedSize_);
+  if (owner_)
+    shm_unlink(name_.c_str());
+}
+
+bool
+ShmRing::tryWrite(const std::string& topic, const void* data, const std::size_t size) {
+  const std::uint64_t capacity = header_->capacity;
+  const std::uint64_t writePosition = header_->writePosition.load(std::memory_order_relaxed);
+  const std::uint64_t readPosition = header_->readPosition.load(std::memory_order_acquire);
+  const std::uint64_t size_ = recordSize(topic.size(), size);
+  const std::uint64_t offset = writePosition & (capacity - 1);
+  // a record is never split: the end of the data area is skipped if it is too small
+  const std::uint64_t padding = (capacity - offset < size_) ? capacity - offset : 0;
+  if (padding + size_ > capacity - (writePosition - readPosition))
+    return false;
+
+  if (padding > 0) {
+    // there is always room for a record header as the records are padded to 8 bytes
+    std::memcpy(data_ + offset, &PADDING_RECORD, sizeof(PADDING_RECORD));
+  }
+  std::uint8_t* record = data_ + ((writePosition + padding) & (capacity - 1));
+  const std::uint32_t topicSize = static_cast<std::uint32_t>(topic.size());
+  const std::uint32_t dataSize = static_cast<std::uint32_t>(size);
+  std::memcpy(record, &topicSize, sizeof(topicSize));
+  std::memcpy(record + sizeof(topicSize), &dataSize, sizeof(dataSize));
+  std::memcpy(record + RECORD_HEADER_SIZE, topic.data(), topic.size());
+  if (size > 0)
+    std::memcpy(record + RECORD_HEADER_SIZE + topic.size(), data, size);
+  header_->writePosition.store(writePosition + padding + size_, std::memory_order_release);
+  notify();
+  return true;
+}
+
+bool
+ShmRing::tryRead(std::string& topic, std::vector<std::uint8_t>& data) {
+  const std::uint64_t capacity = header_->capacity;
+  std::uint64_t readPosition = header_->readPosition.load(std::memory_order_relaxed);
+  const std::uint64_t writePosition = header_->writePosition.load(std::memory_order_acquire);
+  if (readPosition == writePosition)
+    return false;
+
+  std::uint64_t offset = readPosition & (capacity - 1);
+  std::uint32_t topicSize;
+  std::memcpy(&topicSize, data_ + offset, sizeof(topicSize));
+  if (topicSize == PADDING_RECORD) {
+    readPosition += capacity - offset;
+    offset = 0;
+    if (readPosition >= writePosition) {
+      resetReadPosition(writePosition);
+      return false;
+    }
+    std::memcpy(&topicSize, data_, sizeof(topicSize));
+  }
+  std::uint32_t dataSize;
+  std::memcpy(&dataSize, data_ + offset + sizeof(topicSize), sizeof(dataSize));
+  // the record must lie in what was written before the end of the data area: the segment is shared, its content is not trusted
+  const std::uint64_t size = recordSize(topicSize, dataSize);
+  if (topicSize == PADDING_RECORD || size > capacity - offset || size > writePosition - readPosition) {
+    resetReadPosition(writePosition);
+    return false;
+  }
+  const std::uint8_t* record = data_ + offset + RECORD_HEADER_SIZE;
+  topic.assign(reinterpret_cast<const char*>(record), topicSize);
+  data.assign(record + topicSize, record + topicSize + dataSize);
+  header_->readPosition.store(readPosition + size, std::memory_order_release);
+  return true;
+}
+
+void
+ShmRing::resetReadPosition(const std::uint64_t writePosition) {
+  Trace::warn() << DYNLog(ShmRingReset, name_, writePosition - header_->readPosition.load(std::memory_order_relaxed)) << Trace::endline;
+  header_->readPosition.store(writePosition, std::memory_order_release);
+}
+
+void
+ShmRing::notify() {
+  header_->futexWord.fetch_add(1, std::memory_order_release);
+#ifdef __linux__
+  syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&header_->futexWord), FUTEX_WAKE, 1, NULL, NULL, 0);
+#endif
+}
+
+void
+ShmRing::waitForMessage(const long timeoutMs) {
+  const std::uint32_t futexWord = header_->futexWord.load(std::memory_order_acquire);
+  if (header_->readPosition.load(std::memory_order_relaxed) != header_->writePosition.load(std::memory_order_acquire))
+    return;
+  struct timespec timeout;
+  timeout.tv_sec = timeoutMs / 1000;
+  timeout.tv_nsec = (timeoutMs % 1000) * 1000000;
+#ifdef __linux__
+  // returns at once if a message was written since futexWord was read
+  syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&header_->futexWord), FUTEX_WAIT, futexWord, &timeout, NULL, 0);
+#else
+  static_cast<void>(futexWord);
+  nanosleep(&timeout, NULL);
+#endif
+}
+
+}  // end of namespace DYN
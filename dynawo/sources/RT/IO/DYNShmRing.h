@@ -0,0 +1,126 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+/**
+ * @file  DYNShmRing.h
+ *
+ * @brief Ring buffer of messages in a named shared memory segment header
+ *
+ */
+#ifndef RT_IO_DYNSHMRING_H_
+#define RT_IO_DYNSHMRING_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+namespace DYN {
+
+/**
+ * @class ShmRing
+ * @brief Lock-free ring buffer of messages in a named shared memory segment, for one writer and one reader
+ *
+ * The segment starts with a header holding the write and read positions, followed by the data area.
+ * Each message is stored as its topic size, its data size, its topic and its data, padded to 8 bytes.
+ * A message that does not fit before the end of the data area is preceded by a padding record
+ * and written at the beginning of the area.
+ * The reader waits for messages on a futex word of the header, incremented by each write (Linux only,
+ * the reader polls on other systems).
+ *
+ * Layout of the header, in native byte order: magic number (uint32), layout version (uint32),
+ * capacity of the data area in bytes (uint64), write position (uint64), read position (uint64),
+ * futex word (uint32), each field on its own 64 bytes cache line.
+ */
+class ShmRing : private boost::noncopyable {
+ public:
+  /**
+   * @brief Constructor: create or open a shared memory segment
+   *
+   * @param name name of the segment, starting with '/'
+   * @param capacity capacity of the data area in bytes, rounded up to a power of two, used only if the segment is created
+   * @param create @b true to create the segment (an existing one being replaced), @b false to open an existing one
+   * @throw ShmChannelOpenFailed error if the segment cannot be created or opened
+   */
+  ShmRing(const std::string& name, std::size_t capacity, bool create);
+
+  /**
+   * @brief Destructor: unmap the segment, and remove it if it was created by this instance
+   */
+  ~ShmRing();
+
+  /**
+   * @brief append a message, without blocking
+   *
+   * @param topic topic of the message
+   * @param data data of the message
+   * @param size size of the data
+   * @return @b false if there is not enough room for the message
+   */
+  bool tryWrite(const std::string& topic, const void* data, std::size_t size);
+
+  /**
+   * @brief take the oldest message, without blocking
+   *
+   * @param topic topic of the message
+   * @param data data of the message
+   * @return @b false if there is no message, or if the ring is corrupted: its unread messages are then dropped
+   */
+  bool tryRead(std::string& topic, std::vector<std::uint8_t>& data);
+
+  /**
+   * @brief wait until a message may be available
+   *
+   * @param timeoutMs maximum time to wait in milliseconds
+   */
+  void waitForMessage(long timeoutMs);
+
+ private:
+  /**
+   * @brief header of the segment
+   */
+  struct Header {
+    std::uint32_t magic;  ///< magic number of a dynawo ring
+    std::uint32_t layoutVersion;  ///< version of the layout
+    std::uint64_t capacity;  ///< capacity of the data area in bytes
+    alignas(64) std::atomic<std::uint64_t> writePosition;  ///< total number of bytes written
+    alignas(64) std::atomic<std::uint64_t> readPosition;  ///< total number of bytes read
+    alignas(64) std::atomic<std::uint32_t> futexWord;  ///< incremented by each write, to wake up the reader
+  };
+
+  /**
+   * @brief drop the unread messages of a corrupted ring, the writer going on after them
+   *
+   * @param writePosition write position read with the corrupted record
+   */
+  void resetReadPosition(std::uint64_t writePosition);
+
+  /**
+   * @brief wake up the reader after a write
+   */
+  void notify();
+
+ private:
+  std::string name_;  ///< name of the segment
+  bool owner_;  ///< @b true if the segment was created by this instance
+  std::size_t mappedSize_;  ///< size of the mapping
+  Header* header_;  ///< header of the segment
+  std::uint8_t* data_;  ///< data area of the segment
+};
+
+}  // end of namespace DYN
+
+#endif  // RT_IO_DYNSHMRING_H_
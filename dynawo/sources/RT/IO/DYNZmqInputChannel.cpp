@@ -37,7 +37,9 @@ context_(1),
 socket_(context_, zmq::socket_type::rep),
 useThread_(false),
 stopFlag_(false),
-pollTimeoutMs_(10) {
+pollTimeoutMs_(10),
+stepTriggerMessage_(std::make_shared<StepTriggerMessage>()),
+stopMessage_(std::make_shared<StopMessage>()) {
   try {
     socket_.bind(endpoint);
   } catch (const zmq::error_t& e) {
@@ -82,19 +84,21 @@ ZmqInputChannel::receiveLoop() {
         std::string replyStr;
         std::shared_ptr<InputMessage> inputMsg;
 
-        if (payload.empty()) {
+        if (isHandleMessage(payload.data(), payload.size())) {
+          inputMsg = decodeHandleMessage(payload.data(), payload.size(), replyStr);
+        } else if (payload.empty()) {
           if (!supports(MessageFilter::Trigger)) {
             replyStr = "trigger received but not supported";
           } else {
             replyStr = "trigger received";
-            inputMsg = std::make_shared<StepTriggerMessage>();
+            inputMsg = stepTriggerMessage_;
           }
         } else if (payload == STOP_KEY) {
           if (!supports(MessageFilter::TimeManagement)) {
             replyStr = "stop received but not supported";
           } else {
             replyStr = "stop received";
-            inputMsg = std::make_shared<StopMessage>();
+            inputMsg = stopMessage_;
           }
         } else {
           if (!supports(MessageFilter::Actions)) {
@@ -76,6 +76,8 @@ class ZmqInputChannel: public InputChannel {
   std::atomic<bool> stopFlag_;          ///< Flag to signal stopping reception
   long pollTimeoutMs_;                  ///< Polling timeout in milliseconds
   std::function<void(std::shared_ptr<InputMessage>)> callback_;  ///< Callback for received messages
+  std::shared_ptr<StepTriggerMessage> stepTriggerMessage_;  ///< Trigger message, preallocated and sent for each trigger as it holds no data
+  std::shared_ptr<StopMessage> stopMessage_;  ///< Stop message, preallocated and sent for each stop as it holds no data
   std::thread thread_;                  ///< Thread for message reception
 };
 
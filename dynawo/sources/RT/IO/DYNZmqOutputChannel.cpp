@@ -61,4 +61,28 @@ ZmqOutputChannel::sendMessage(const std::vector<std::uint8_t>& data, const std::
   Trace::debug() << DYNLog(ZmqDataSent, " (topic: " + topic + ")") << Trace::endline;
 }
 
+/**
+ * @brief release a buffer sent without copy, called by ZeroMQ once the message is sent
+ * @param data bytes of the buffer
+ * @param hint pointer to the shared pointer keeping the buffer alive
+ */
+static void releaseOutputBuffer(void* /*data*/, void* hint) {
+  std::shared_ptr<OutputBuffer>* buffer = static_cast<std::shared_ptr<OutputBuffer>*>(hint);
+  (*buffer)->endSend();
+  delete buffer;
+}
+
+void
+ZmqOutputChannel::sendMessage(const std::shared_ptr<OutputBuffer>& buffer, const std::string& topic) {
+  zmq::message_t topic_msg(topic.data(), topic.size());
+  std::vector<std::uint8_t>& bytes = buffer->getBytes();
+  buffer->beginSend();
+  zmq::message_t data_msg(bytes.data(), bytes.size(), releaseOutputBuffer, new std::shared_ptr<OutputBuffer>(buffer));
+
+  socket_.send(topic_msg, zmq::send_flags::sndmore);
+  socket_.send(data_msg, zmq::send_flags::none);
+
+  Trace::debug() << DYNLog(ZmqDataSent, " (topic: " + topic + ")") << Trace::endline;
+}
+
 }  // end of namespace DYN
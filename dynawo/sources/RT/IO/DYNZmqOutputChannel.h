@@ -64,6 +64,13 @@ class ZmqOutputChannel : public OutputChannel {
    */
   void sendMessage(const std::vector<std::uint8_t>& data, const std::string& topic) override;
 
+  /**
+   * @brief Send a buffer with a topic, ZeroMQ reading it in place until the message is sent.
+   * @param buffer Message content
+   * @param topic Message topic
+   */
+  void sendMessage(const std::shared_ptr<OutputBuffer>& buffer, const std::string& topic) override;
+
  private:
   zmq::context_t context_;  ///< ZeroMQ context
   zmq::socket_t socket_;    ///< ZeroMQ PUB socket
@@ -0,0 +1,164 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+/**
+ * @file RT/IO/TestShmRing.cpp
+ * @brief Unit tests of the shared memory ring
+ *
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "gtest_dynawo.h"
+#include "DYNShmRing.h"
+
+namespace DYN {
+
+/**
+ * @brief name of a segment unique to the test process
+ *
+ * @param suffix suffix of the name
+ *
+ * @return the name of the segment
+ */
+static std::string
+segmentName(const std::string& suffix) {
+  std::stringstream name;
+  name << "/dynawoTestShmRing" << getpid() << suffix;
+  return name.str();
+}
+
+/**
+ * @brief write a message whose record takes 24 bytes: 8 bytes of header, 1 byte of topic and 12 bytes of data padded to 8 bytes
+ *
+ * @param ring ring to write in
+ * @param value first byte of the data
+ *
+ * @return @b false if the ring is full
+ */
+static bool
+writeMessage(ShmRing& ring, const std::uint8_t value) {
+  std::vector<std::uint8_t> data(12, value);
+  return ring.tryWrite("t", &data[0], data.size());
+}
+
+/**
+ * @brief read a message written by writeMessage
+ *
+ * @param ring ring to read
+ * @param value expected first byte of the data
+ */
+static void
+readMessage(ShmRing& ring, const std::uint8_t value) {
+  std::string topic;
+  std::vector<std::uint8_t> data;
+  ASSERT_TRUE(ring.tryRead(topic, data));
+  ASSERT_EQ(topic, "t");
+  ASSERT_EQ(data.size(), 12U);
+  ASSERT_EQ(data[0], value);
+  ASSERT_EQ(data[11], value);
+}
+
+TEST(RTIOTest, testShmRingWrapAround) {
+  ShmRing ring(segmentName("wrap"), 64, true);
+  std::string topic;
+  std::vector<std::uint8_t> data;
+  ASSERT_FALSE(ring.tryRead(topic, data));
+
+  ASSERT_TRUE(writeMessage(ring, 1));
+  ASSERT_TRUE(writeMessage(ring, 2));
+  readMessage(ring, 1);
+  readMessage(ring, 2);
+  // 16 bytes are left before the end of the data area: the record is written at its beginning after a padding record
+  ASSERT_TRUE(writeMessage(ring, 3));
+  readMessage(ring, 3);
+  ASSERT_FALSE(ring.tryRead(topic, data));
+
+  // an empty message
+  ASSERT_TRUE(ring.tryWrite("empty", NULL, 0));
+  ASSERT_TRUE(ring.tryRead(topic, data));
+  ASSERT_EQ(topic, "empty");
+  ASSERT_TRUE(data.empty());
+}
+
+TEST(RTIOTest, testShmRingFull) {
+  ShmRing ring(segmentName("full"), 64, true);
+  ASSERT_TRUE(writeMessage(ring, 1));
+  ASSERT_TRUE(writeMessage(ring, 2));
+  // 16 bytes are free at the end of the data area, the beginning is still used
+  ASSERT_FALSE(writeMessage(ring, 3));
+  readMessage(ring, 1);
+  ASSERT_TRUE(writeMessage(ring, 3));
+  ASSERT_FALSE(writeMessage(ring, 4));
+  readMessage(ring, 2);
+  readMessage(ring, 3);
+  std::vector<std::uint8_t> large(100, 0);
+  ASSERT_FALSE(ring.tryWrite("large", &large[0], large.size()));
+}
+
+TEST(RTIOTest, testShmRingSharedSegment) {
+  const std::string name = segmentName("shared");
+  ASSERT_THROW_DYNAWO(ShmRing(name, 64, false), Error::GENERAL, KeyError_t::ShmChannelOpenFailed);
+  ShmRing writer(name, 100, true);
+  // the capacity is the one of the segment created
+  ShmRing reader(name, 0, false);
+  for (std::uint8_t i = 0; i < 10; ++i) {
+    ASSERT_TRUE(writeMessage(writer, i));
+    ASSERT_TRUE(writeMessage(writer, i + 100));
+    readMessage(reader, i);
+    readMessage(reader, i + 100);
+  }
+  std::string topic;
+  std::vector<std::uint8_t> data;
+  ASSERT_FALSE(reader.tryRead(topic, data));
+  ASSERT_FALSE(writer.tryRead(topic, data));
+}
+
+TEST(RTIOTest, testShmRingCorrupted) {
+  const std::string name = segmentName("corrupted");
+  ShmRing ring(name, 64, true);
+  ASSERT_TRUE(writeMessage(ring, 1));
+  ASSERT_TRUE(writeMessage(ring, 2));
+
+  // the data area is at the end of the segment: the topic size of the first record is overwritten
+  const int fd = shm_open(name.c_str(), O_RDWR, 0);
+  ASSERT_GE(fd, 0);
+  struct stat status;
+  ASSERT_EQ(fstat(fd, &status), 0);
+  const std::size_t size = static_cast<std::size_t>(status.st_size);
+  void* address = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  ASSERT_NE(address, MAP_FAILED);
+  const std::uint32_t topicSize = 1000;
+  std::memcpy(static_cast<std::uint8_t*>(address) + size - 64, &topicSize, sizeof(topicSize));
+  munmap(address, size);
+
+  // the unread messages are dropped, the next ones are read
+  std::string topic;
+  std::vector<std::uint8_t> data;
+  ASSERT_FALSE(ring.tryRead(topic, data));
+  ASSERT_FALSE(ring.tryRead(topic, data));
+  ASSERT_TRUE(writeMessage(ring, 3));
+  readMessage(ring, 3);
+}
+
+}  // namespace DYN
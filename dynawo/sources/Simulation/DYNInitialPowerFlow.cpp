@@ -0,0 +1,256 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNInitialPowerFlow.cpp
+ *
+ * @brief Power flow on the static network implementation
+ *
+ */
+#include <complex>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "DYNInitialPowerFlow.h"
+#include "DYNPowerFlowSolver.h"
+#include "DYNNetworkInterface.h"
+#include "DYNVoltageLevelInterface.h"
+#include "DYNBusInterface.h"
+#include "DYNSwitchInterface.h"
+#include "DYNLineInterface.h"
+#include "DYNTwoWTransformerInterface.h"
+#include "DYNRatioTapChangerInterface.h"
+#include "DYNPhaseTapChangerInterface.h"
+#include "DYNShuntCompensatorInterface.h"
+#include "DYNLoadInterface.h"
+#include "DYNGeneratorInterface.h"
+#include "DYNDanglingLineInterface.h"
+#include "DYNVscConverterInterface.h"
+#include "DYNLccConverterInterface.h"
+#include "DYNStaticVarCompensatorInterface.h"
+#include "DYNCommon.h"
+#include "DYNModelConstants.h"
+#include "DYNMacrosMessage.h"
+#include "DYNTrace.h"
+#include "DYNTimer.h"
+
+using std::complex;
+using std::vector;
+
+namespace {
+
+static const double POWER_FLOW_TOLERANCE = 1e-4;  ///< largest power mismatch accepted on a bus, in per unit
+static const unsigned POWER_FLOW_MAX_ITERATIONS = 20;  ///< maximum number of Newton-Raphson iterations
+
+/**
+ * @brief find the bus a bus of the network is merged into, compressing the path on the way
+ * @param parents bus each bus is merged into
+ * @param bus index of the bus
+ * @return index of the bus it is merged into
+ */
+unsigned
+findMergedBus(vector<unsigned>& parents, unsigned bus) {
+  while (parents[bus] != bus) {
+    parents[bus] = parents[parents[bus]];
+    bus = parents[bus];
+  }
+  return bus;
+}
+
+}  // namespace
+
+namespace DYN {
+
+bool
+InitialPowerFlow::run(const boost::shared_ptr<NetworkInterface>& network) {
+#if defined(_DEBUG_) || defined(PRINT_TIMERS)
+  Timer timer("InitialPowerFlow::run");
+#endif
+  vector<std::shared_ptr<BusInterface> > buses;
+  std::unordered_map<const BusInterface*, unsigned> indexes;
+  for (const auto& voltageLevel : network->getVoltageLevels()) {
+    for (const auto& bus : voltageLevel->getBuses()) {
+      indexes[bus.get()] = static_cast<unsigned>(buses.size());
+      buses.push_back(bus);
+    }
+  }
+  const auto indexOf = [&indexes](const std::shared_ptr<BusInterface>& bus) {
+    return indexes.find(bus.get())->second;
+  };
+  const auto isKnown = [&indexes](const std::shared_ptr<BusInterface>& bus) {
+    return bus && indexes.find(bus.get()) != indexes.end();
+  };
+
+  // the closed switches and the lines without impedance merge the buses they join
+  vector<unsigned> parents(buses.size());
+  for (unsigned bus = 0; bus < parents.size(); ++bus)
+    parents[bus] = bus;
+  const auto merge = [&parents](unsigned bus1, unsigned bus2) {
+    parents[findMergedBus(parents, bus1)] = findMergedBus(parents, bus2);
+  };
+  for (const auto& voltageLevel : network->getVoltageLevels()) {
+    for (const auto& sw : voltageLevel->getSwitches()) {
+      if (!sw->isOpen() && isKnown(sw->getBusInterface1()) && isKnown(sw->getBusInterface2()))
+        merge(indexOf(sw->getBusInterface1()), indexOf(sw->getBusInterface2()));
+    }
+  }
+  for (const auto& line : network->getLines()) {
+    if (line->getInitialConnected1() && line->getInitialConnected2() && isKnown(line->getBusInterface1()) && isKnown(line->getBusInterface2())
+        && doubleIsZero(line->getR()) && doubleIsZero(line->getX()))
+      merge(indexOf(line->getBusInterface1()), indexOf(line->getBusInterface2()));
+  }
+
+  PowerFlowSolver powerFlow;
+  vector<unsigned> powerFlowBuses(buses.size());
+  std::unordered_map<unsigned, unsigned> powerFlowBusByMergedBus;
+  for (unsigned bus = 0; bus < buses.size(); ++bus) {
+    const unsigned mergedBus = findMergedBus(parents, bus);
+    const auto it = powerFlowBusByMergedBus.find(mergedBus);
+    if (it != powerFlowBusByMergedBus.end()) {
+      powerFlowBuses[bus] = it->second;
+      continue;
+    }
+    const std::shared_ptr<BusInterface>& busInterface = buses[mergedBus];
+    const double v0 = busInterface->hasInitialConditions() ? busInterface->getV0() / busInterface->getVNom() : 1.;
+    const double angle0 = busInterface->hasInitialConditions() ? busInterface->getAngle0() * DEG_TO_RAD : 0.;
+    powerFlowBuses[bus] = powerFlow.addBus(v0, angle0);
+    powerFlowBusByMergedBus[mergedBus] = powerFlowBuses[bus];
+  }
+  const auto powerFlowBusOf = [&powerFlowBuses, &indexOf](const std::shared_ptr<BusInterface>& bus) {
+    return powerFlowBuses[indexOf(bus)];
+  };
+
+  for (const auto& line : network->getLines()) {
+    if (!line->getInitialConnected1() || !line->getInitialConnected2() || !isKnown(line->getBusInterface1()) || !isKnown(line->getBusInterface2()))
+      continue;
+    const unsigned bus1 = powerFlowBusOf(line->getBusInterface1());
+    const unsigned bus2 = powerFlowBusOf(line->getBusInterface2());
+    if (bus1 == bus2)
+      continue;
+    const double vNom = line->getVNom1();
+    const double coeff = vNom * vNom / SNREF;
+    const complex<double> admittance = 1. / complex<double>(line->getR() / coeff, line->getX() / coeff);
+    powerFlow.addBranch(bus1, bus2, admittance + complex<double>(line->getG1(), line->getB1()) * coeff, -admittance, -admittance,
+        admittance + complex<double>(line->getG2(), line->getB2()) * coeff);
+  }
+
+  // same per unit and tap conventions as the network model
+  for (const auto& tfo : network->getTwoWTransformers()) {
+    if (!tfo->getInitialConnected1() || !tfo->getInitialConnected2() || !isKnown(tfo->getBusInterface1()) || !isKnown(tfo->getBusInterface2()))
+      continue;
+    const unsigned bus1 = powerFlowBusOf(tfo->getBusInterface1());
+    const unsigned bus2 = powerFlowBusOf(tfo->getBusInterface2());
+    if (bus1 == bus2)
+      continue;
+    const double vNom1 = tfo->getVNom1();
+    const double vNom2 = tfo->getVNom2();
+    const double coeff = vNom2 * vNom2 / SNREF;
+    double rho = tfo->getRatedU2() / tfo->getRatedU1() * vNom1 / vNom2;
+    double alpha = 0.;
+    double rDeviation = 1.;
+    double xDeviation = 1.;
+    double gDeviation = 1.;
+    double bDeviation = 1.;
+    const std::unique_ptr<RatioTapChangerInterface>& ratioTapChanger = tfo->getRatioTapChanger();
+    const std::unique_ptr<PhaseTapChangerInterface>& phaseTapChanger = tfo->getPhaseTapChanger();
+    if (ratioTapChanger) {
+      rho *= ratioTapChanger->getCurrentRho();
+      rDeviation += ratioTapChanger->getCurrentR() / 100.;
+      xDeviation += ratioTapChanger->getCurrentX() / 100.;
+      gDeviation += ratioTapChanger->getCurrentG() / 100.;
+      bDeviation += ratioTapChanger->getCurrentB() / 100.;
+    }
+    if (phaseTapChanger) {
+      rho *= phaseTapChanger->getCurrentRho();
+      alpha = phaseTapChanger->getCurrentAlpha() * DEG_TO_RAD;
+      rDeviation += phaseTapChanger->getCurrentR() / 100.;
+      xDeviation += phaseTapChanger->getCurrentX() / 100.;
+      gDeviation += phaseTapChanger->getCurrentG() / 100.;
+      bDeviation += phaseTapChanger->getCurrentB() / 100.;
+    }
+    const complex<double> admittance = 1. / complex<double>(tfo->getR() / coeff * rDeviation, tfo->getX() / coeff * xDeviation);
+    const complex<double> shunt(tfo->getG() * coeff * gDeviation, tfo->getB() * coeff * bDeviation);
+    powerFlow.addBranch(bus1, bus2, rho * rho * (admittance + shunt), -rho * admittance * std::polar(1., -alpha),
+        -rho * admittance * std::polar(1., alpha), admittance);
+  }
+
+  for (const auto& voltageLevel : network->getVoltageLevels()) {
+    for (const auto& shunt : voltageLevel->getShuntCompensators()) {
+      if (!shunt->getInitialConnected() || !isKnown(shunt->getBusInterface()))
+        continue;
+      const double vNom = shunt->getVNom();
+      powerFlow.addShunt(powerFlowBusOf(shunt->getBusInterface()), complex<double>(0., shunt->getB(shunt->getCurrentSection()) * vNom * vNom / SNREF));
+    }
+    for (const auto& load : voltageLevel->getLoads()) {
+      if (load->getInitialConnected() && isKnown(load->getBusInterface()))
+        powerFlow.addInjection(powerFlowBusOf(load->getBusInterface()), -load->getP0() / SNREF, -load->getQ0() / SNREF);
+    }
+    for (const auto& danglingLine : voltageLevel->getDanglingLines()) {
+      if (danglingLine->getInitialConnected() && isKnown(danglingLine->getBusInterface()))
+        powerFlow.addInjection(powerFlowBusOf(danglingLine->getBusInterface()), -danglingLine->getP0() / SNREF, -danglingLine->getQ0() / SNREF);
+    }
+    for (const auto& svc : voltageLevel->getStaticVarCompensators()) {
+      if (svc->getInitialConnected() && isKnown(svc->getBusInterface()))
+        powerFlow.addInjection(powerFlowBusOf(svc->getBusInterface()), -svc->getP() / SNREF, -svc->getQ() / SNREF);
+    }
+    for (const auto& lcc : voltageLevel->getLccConverters()) {
+      if (lcc->getInitialConnected() && isKnown(lcc->getBusInterface()))
+        powerFlow.addInjection(powerFlowBusOf(lcc->getBusInterface()), -lcc->getP() / SNREF, -lcc->getQ() / SNREF);
+    }
+    for (const auto& vsc : voltageLevel->getVscConverters()) {
+      if (!vsc->getInitialConnected() || !isKnown(vsc->getBusInterface()))
+        continue;
+      const unsigned bus = powerFlowBusOf(vsc->getBusInterface());
+      powerFlow.addInjection(bus, -vsc->getP() / SNREF, -vsc->getQ() / SNREF);
+      if (vsc->getVoltageRegulatorOn())
+        powerFlow.setTargetV(bus, vsc->getVoltageSetpoint() / vsc->getBusInterface()->getVNom());
+    }
+    // the regulated voltage of a generator is applied to its own bus
+    for (const auto& generator : voltageLevel->getGenerators()) {
+      if (!generator->getInitialConnected() || !isKnown(generator->getBusInterface()))
+        continue;
+      const unsigned bus = powerFlowBusOf(generator->getBusInterface());
+      powerFlow.addInjection(bus, -generator->getTargetP() / SNREF, -generator->getTargetQ() / SNREF);
+      if (generator->isVoltageRegulationOn())
+        powerFlow.setTargetV(bus, generator->getTargetV() / generator->getBusInterface()->getVNom());
+    }
+  }
+
+  const boost::optional<std::string> slackBusId = network->getSlackNodeBusId();
+  if (slackBusId) {
+    for (unsigned bus = 0; bus < buses.size(); ++bus) {
+      if (buses[bus]->getID() == slackBusId.value())
+        powerFlow.setSlack(powerFlowBuses[bus]);
+    }
+  }
+
+  if (!powerFlow.solve(POWER_FLOW_TOLERANCE, POWER_FLOW_MAX_ITERATIONS)) {
+    Trace::warn() << DYNLog(InitialPowerFlowDivergence, powerFlow.getNbIterations(), powerFlow.getMaxMismatch() * SNREF) << Trace::endline;
+    return false;
+  }
+
+  // the buses without voltage in the network file are not energized, they are left unchanged
+  unsigned nbUpdatedBuses = 0;
+  for (unsigned bus = 0; bus < buses.size(); ++bus) {
+    if (!buses[bus]->hasInitialConditions())
+      continue;
+    const double vNom = buses[bus]->getVNom();
+    buses[bus]->setInitialVoltage(powerFlow.getV(powerFlowBuses[bus]) * vNom, powerFlow.getAngle(powerFlowBuses[bus]) * RAD_TO_DEG);
+    ++nbUpdatedBuses;
+  }
+  Trace::info() << DYNLog(InitialPowerFlowConverged, powerFlow.getNbIterations(), nbUpdatedBuses, powerFlow.getMaxMismatch() * SNREF) << Trace::endline;
+  return true;
+}
+
+}  // end namespace DYN
@@ -0,0 +1,54 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNInitialPowerFlow.h
+ *
+ * @brief Power flow on the static network, giving the initialization a converged starting point
+ *
+ */
+#ifndef SIMULATION_DYNINITIALPOWERFLOW_H_
+#define SIMULATION_DYNINITIALPOWERFLOW_H_
+
+#include <boost/shared_ptr.hpp>
+
+namespace DYN {
+class NetworkInterface;
+
+/**
+ * @brief InitialPowerFlow static class: power flow on the static network before the initialization
+ *
+ * The network file may come from a power flow that did not fully converge, or from a modified case: the global
+ * initialization then needs many iterations on the whole model to find the network voltages. The power flow only solves the
+ * network equations, built from the same data as the network model: lines, two windings transformers at their current tap
+ * and shunts as admittances, closed switches merging their buses. The generators regulating their voltage give PV buses, the
+ * other injections keep the powers of the network file.
+ *
+ * When the power flow converges, the voltages of the buses energized in the network file are replaced by its solution, before
+ * the models read their static parameters. Otherwise the network file is left unchanged.
+ */
+class InitialPowerFlow {
+ public:
+  /**
+   * @brief run the power flow and update the initial voltages of the buses
+   *
+   * @param network network interface
+   *
+   * @return @b true if the power flow converged
+   */
+  static bool run(const boost::shared_ptr<NetworkInterface>& network);
+};
+
+}  // end namespace DYN
+
+#endif  // SIMULATION_DYNINITIALPOWERFLOW_H_
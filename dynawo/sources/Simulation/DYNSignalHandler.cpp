@@ -26,6 +26,7 @@
 namespace DYN {
 
 bool SignalHandler::gotExitSignal_ = false;
+volatile std::sig_atomic_t SignalHandler::gotReportSignal_ = 0;
 
 bool
 SignalHandler::gotExitSignal() {
@@ -37,6 +38,19 @@ SignalHandler::setExitSignal(const bool exitSignal) {
   gotExitSignal_ = exitSignal;
 }
 
+bool
+SignalHandler::gotReportSignal() {
+  if (!gotReportSignal_)
+    return false;
+  gotReportSignal_ = 0;
+  return true;
+}
+
+void
+SignalHandler::reportSignalHandler(const int /*signal*/) {
+  gotReportSignal_ = 1;
+}
+
 void
 SignalHandler::exitSignalHandler(const int signal) {
   switch (signal) {
@@ -69,6 +83,9 @@ SignalHandler::setSignalHandlers() {
 #ifdef SIGQUIT
   signal(SIGQUIT, SignalHandler::exitSignalHandler);
 #endif
+#ifdef SIGUSR1
+  signal(SIGUSR1, SignalHandler::reportSignalHandler);
+#endif
 }
 
 }  // namespace DYN
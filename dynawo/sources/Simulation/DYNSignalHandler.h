@@ -20,6 +20,7 @@
 #ifndef SIMULATION_DYNSIGNALHANDLER_H_
 #define SIMULATION_DYNSIGNALHANDLER_H_
 
+#include <csignal>
 #include <stdexcept>
 
 namespace DYN {
@@ -43,6 +44,12 @@ class SignalHandler {
    */
   static void setExitSignal(bool exitSignal);
 
+  /**
+   * @brief getter to check if a report was requested by a signal since the last call, and reset the request
+   * @return @b true if a report was requested
+   */
+  static bool gotReportSignal();
+
   /**
    * @brief declare the signal to intercept
    */
@@ -54,8 +61,15 @@ class SignalHandler {
    */
   static void exitSignalHandler(int signal);
 
+  /**
+   * @brief handler to intercept the signal requesting a report
+   * @param signal num of the signal intercepted
+   */
+  static void reportSignalHandler(int signal);
+
  protected:
   static bool gotExitSignal_;  ///< one signal was intercepted
+  static volatile std::sig_atomic_t gotReportSignal_;  ///< a report was requested by a signal
 };
 }  // namespace DYN
 #endif  // SIMULATION_DYNSIGNALHANDLER_H_
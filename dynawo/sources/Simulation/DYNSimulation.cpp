@@ -18,16 +18,32 @@
  *
  */
 
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <utility>
 #include <vector>
 #include <map>
+#include <set>
+#include <unordered_set>
 #include <cstdlib>
 #include <sstream>
 #include <fstream>
 #include <chrono>
+#include <future>
+#include <iostream>
+#include <limits>
+#include <thread>
+#include <cstdio>
 #ifdef _MSC_VER
 #include <process.h>
+#else
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #endif
 
 
@@ -49,6 +65,7 @@
 #include "TLTxtExporter.h"
 #include "TLXmlExporter.h"
 #include "TLCsvExporter.h"
+#include "TLStreamExporter.h"
 
 #include "CRVCurvesCollectionFactory.h"
 #include "CRVCurvesCollection.h"
@@ -57,6 +74,8 @@
 #include "CRVCurve.h"
 #include "CRVXmlExporter.h"
 #include "CRVCsvExporter.h"
+#include "CRVBinaryExporter.h"
+#include "CRVStreamExporter.h"
 
 #include "FSVFinalStateValuesCollectionFactory.h"
 #include "FSVFinalStateValuesCollection.h"
@@ -77,11 +96,14 @@
 
 #include "PARParametersSet.h"
 #include "PARParametersSetFactory.h"
-#include "PARXmlImporter.h"
+#include "PARParametersSetCollectionCache.h"
 
 #include "CRTXmlImporter.h"
 #include "CRTCriteriaCollection.h"
 
+#include "DYDDynamicModelsCollection.h"
+#include "DYDXmlImporter.h"
+
 #include "JOBJobEntry.h"
 #include "JOBSolverEntry.h"
 #include "JOBModelerEntry.h"
@@ -101,6 +123,9 @@
 #include "JOBDynModelsEntry.h"
 
 #include "DYNCompiler.h"
+#include "DYNCompiledModelCache.h"
+#include "config.h"
+#include "gitversion.h"
 #include "DYNDynamicData.h"
 #include "DYNModel.h"
 #include "DYNSimulation.h"
@@ -109,15 +134,26 @@
 #include "DYNMacrosMessage.h"
 #include "DYNSolver.h"
 #include "DYNTimer.h"
+#include "DYNProfiler.h"
+#include "DYNMemoryUsage.h"
+#include "DYNConvergenceDiagnostics.h"
 #include "DYNModelMulti.h"
+#include "DYNSubModel.h"
 #include "DYNFileSystemUtils.h"
 #include "DYNTerminate.h"
 #include "DYNDataInterface.h"
 #include "DYNDataInterfaceFactory.h"
+#include "DYNInitialPowerFlow.h"
 #include "DYNExecUtils.h"
 #include "DYNSignalHandler.h"
 #include "DYNIoDico.h"
+#include "DYNBackgroundCheck.h"
 #include "DYNBitMask.h"
+#include "DYNHugePages.h"
+#include "DYNProgressRecord.h"
+#include "DYNCompressedStateDumpFile.h"
+#include "DYNStateDumpDelta.h"
+#include "DYNStateDumpFile.h"
 
 #include "make_unique.hpp"
 
@@ -148,6 +184,12 @@ using parameters::ParametersSetFactory;
 using parameters::ParametersSetCollection;
 
 static const char TIME_FILENAME[] = "time.bin";  ///< name of the file to dump time at the end of the simulation
+static const char PREVIOUS_DUMP_FILENAME[] = "previousDump";  ///< name of the entry of a delta dump referring to the dump it is based on
+static const size_t CURVES_STREAM_CHUNK_SIZE = 1000;  ///< number of curves points kept in memory before being written in streaming modes
+static const size_t TIMELINE_STREAM_CHUNK_SIZE = 100;  ///< number of timeline events kept in memory before being written in streaming modes
+static const char CONTINGENCY_STATUS_FILENAME[] = "contingencyStatus.csv";  ///< name of the status file in the outputs directory of a contingency
+static const char CONTINGENCIES_SUMMARY_FILENAME[] = "summary.csv";  ///< name of the summary file in the contingencies directory
+static const char CONTINGENCY_RUN_TIMES_FILENAME[] = "contingencyRunTimes.csv";  ///< name of the file keeping the run times of the contingencies
 
 
 /**
@@ -176,11 +218,14 @@ context_(context),
 jobEntry_(jobEntry),
 data_(std::move(data)),
 timeline_(),
+outputsStreamed_(true),
 constraintsCollection_(),
 iidmFile_(""),
 networkParFile_(""),
 networkParSet_(""),
 initialStateFile_(""),
+initialConditionsCacheFile_(""),
+initialConditionsFromCache_(false),
 exportCurvesMode_(EXPORT_CURVES_NONE),
 curvesInputFile_(""),
 curvesOutputFile_(""),
@@ -197,17 +242,30 @@ constraintsOutputFile_(""),
 exportLostEquipmentsMode_(EXPORT_LOSTEQUIPMENTS_NONE),
 lostEquipmentsOutputFile_(""),
 finalState_(std::numeric_limits<double>::max()),
+nbDeltaDumpsSinceKeyframe_(0),
+deltaDumpKeyframePeriod_(10),
 tStart_(0.),
 tCurrent_(0.),
 tStop_(0.),
 activateCriteria_(false),
 criteriaStep_(0.),
+criteriaMaxLag_(0),
+coherenceCheckStep_(1),
+criteriaCheckIteration_(0),
 dumpLocalInitValues_(false),
 dumpGlobalInitValues_(false),
 dumpInitModelValues_(false),
 dumpFinalValues_(false),
 enableRealTimeTracking_(false),
 realTimeTrackingFile_(""),
+steadyStateThreshold_(0.),
+steadyStateDuration_(0.),
+tSteadyStateStart_(0.),
+tPreviousStep_(0.),
+steadyStateReached_(false),
+memoryAccounting_(false),
+memoryReportInterval_(0.),
+tNextMemoryReport_(0.),
 wasLoggingEnabled_(false) {
   SignalHandler::setSignalHandlers();
 
@@ -225,8 +283,22 @@ wasLoggingEnabled_(false) {
   setStopTime(jobEntry_->getSimulationEntry()->getStopTime());
   setActivateCriteria(!jobEntry_->getSimulationEntry()->getCriteriaFiles().empty());
   setCriteriaStep(jobEntry_->getSimulationEntry()->getCriteriaStep());
+  setCriteriaMaxLag(jobEntry_->getSimulationEntry()->getCriteriaMaxLag());
+  setCoherenceCheckStep(jobEntry_->getSimulationEntry()->getCoherenceCheckStep());
   setCurrentPrecision(jobEntry_->getSimulationEntry()->getPrecision());
   enableRealTimeTracking_ = jobEntry_->getSimulationEntry()->getEnableRealTimeTracking();
+  steadyStateThreshold_ = jobEntry_->getSimulationEntry()->getSteadyStateThreshold();
+  steadyStateDuration_ = jobEntry_->getSimulationEntry()->getSteadyStateDuration();
+  Profiler::setSamplingPeriod(jobEntry_->getSimulationEntry()->getProfilingSamplingPeriod());
+  Profiler::setTraceEnabled(jobEntry_->getSimulationEntry()->getExportProfilingTrace());
+  Profiler::setHardwareCountersEnabled(jobEntry_->getSimulationEntry()->getProfilingHardwareCounters());
+  if ((Profiler::isTraceEnabled() || Profiler::isHardwareCountersEnabled()) && !Profiler::isEnabled())
+    Profiler::setSamplingPeriod(1);
+  Profiler::reset();
+  SubModel::setCostAccountingEnabled(jobEntry_->getSimulationEntry()->getSubModelCostAccounting());
+  HugePages::setEnabled(jobEntry_->getSimulationEntry()->getHugePages());
+  memoryAccounting_ = jobEntry_->getSimulationEntry()->getMemoryAccounting();
+  memoryReportInterval_ = jobEntry_->getSimulationEntry()->getMemoryReportInterval();
 
   outputsDirectory_ = context_->getWorkingDirectory();
   if (jobEntry_->getOutputsEntry()) {
@@ -236,9 +308,10 @@ wasLoggingEnabled_(false) {
   }
 
   configureLogs();
+  // the network file starts being read here, in the background of the parsing of the other inputs
+  configureSimulationInputs();
   configureSimulationOutputs();
   setSolver();
-  configureSimulationInputs();
   configureCriteria();
 }
 
@@ -259,6 +332,12 @@ Simulation::configureSimulationInputs() {
 
     if (!data_ && !exists(iidmFile_))  // no need to check iidm file if data interface is provided
       throw DYNError(Error::GENERAL, UnknownIidmFile, iidmFile_);
+    if (!data_) {
+      const std::string iidmFile = iidmFile_;
+      pendingNetworkImport_ = std::async(std::launch::async, [iidmFile]() {
+        return DataInterfaceFactory::build(DataInterfaceFactory::DATAINTERFACE_IIDM, iidmFile);
+      });
+    }
   }
   if (jobEntry_->getModelerEntry()->getInitialStateEntry()) {
     initialStateFile_ = createAbsolutePath(jobEntry_->getModelerEntry()->getInitialStateEntry()->getInitialStateFile(), context_->getInputDirectory());
@@ -282,12 +361,968 @@ Simulation::configureCriteria() {
 
 void
 Simulation::clean() {
+  waitForIIDMDump();
   model_.reset();
   solver_.reset();
   data_.reset();
   dyd_.reset();
 }
 
+/**
+ * @brief move an output path from an outputs directory to another one, creating its parent directory if needed
+ *
+ * @param path output path, possibly empty
+ * @param oldDirectory previous outputs directory
+ * @param newDirectory new outputs directory
+ *
+ * @return the moved path, or the path itself if it is not in the previous outputs directory
+ */
+static string
+rebaseOutputPath(const string& path, const string& oldDirectory, const string& newDirectory) {
+  if (path.empty() || path.compare(0, oldDirectory.size(), oldDirectory) != 0)
+    return path;
+  const string newPath = newDirectory + path.substr(oldDirectory.size());
+  const string directory = removeFileName(newPath);
+  if (!directory.empty() && !isDirectory(directory))
+    createDirectory(directory);
+  return newPath;
+}
+
+/**
+ * @brief status of a contingency once simulated
+ */
+struct ContingencyStatus {
+  int exitCode;  ///< exit code of the process of the contingency, 0 if the simulation succeeded
+  double runTime;  ///< wall time of the contingency (s)
+  string host;  ///< host where the contingency was simulated
+  string error;  ///< error reported by the contingency, empty if none
+};
+
+/**
+ * @brief get the name of the host running the process
+ *
+ * @return name of the host, empty if unknown
+ */
+static string
+hostName() {
+#ifdef _MSC_VER
+  return getEnvVar("COMPUTERNAME");
+#else
+  char name[256] = {0};
+  if (gethostname(name, sizeof(name) - 1) != 0)
+    return "";
+  return name;
+#endif
+}
+
+/**
+ * @brief write a file through a temporary file renamed once complete, so that a concurrent reader never sees it partially written
+ *
+ * @param path path of the file to write
+ * @param content content of the file
+ */
+static void
+writeFileAtomically(const string& path, const string& content) {
+  stringstream temporaryPath;
+  temporaryPath << path << ".tmp" << getpid();
+  {
+    ofstream file(temporaryPath.str().c_str());
+    if (!file.is_open())
+      throw DYNError(Error::GENERAL, OpenFileFailed, temporaryPath.str());
+    file << content;
+  }
+  if (std::rename(temporaryPath.str().c_str(), path.c_str()) != 0) {
+    ::remove(temporaryPath.str());
+    throw DYNError(Error::GENERAL, OpenFileFailed, path);
+  }
+}
+
+/**
+ * @brief write the status of a contingency in its outputs directory
+ *
+ * @param outputsDirectory outputs directory of the contingency
+ * @param status status of the contingency
+ */
+static void
+writeContingencyStatus(const string& outputsDirectory, const ContingencyStatus& status) {
+  string error = status.error;
+  std::replace(error.begin(), error.end(), '\n', ' ');
+  std::replace(error.begin(), error.end(), ';', ',');
+  stringstream content;
+  content << status.exitCode << ";" << status.runTime << ";" << status.host << ";" << error << "\n";
+  writeFileAtomically(createAbsolutePath(CONTINGENCY_STATUS_FILENAME, outputsDirectory), content.str());
+}
+
+/**
+ * @brief read the status of a contingency from its outputs directory
+ *
+ * @param outputsDirectory outputs directory of the contingency
+ * @param status status of the contingency, to fill
+ *
+ * @return @b false if the contingency has no status, because it was not simulated or is still running
+ */
+static bool
+readContingencyStatus(const string& outputsDirectory, ContingencyStatus& status) {
+  std::ifstream file(createAbsolutePath(CONTINGENCY_STATUS_FILENAME, outputsDirectory).c_str());
+  string line;
+  if (!file.is_open() || !std::getline(file, line))
+    return false;
+  vector<string> fields;
+  boost::algorithm::split(fields, line, boost::is_any_of(";"));
+  if (fields.size() < 4)
+    return false;
+  status.exitCode = std::atoi(fields[0].c_str());
+  status.runTime = std::atof(fields[1].c_str());
+  status.host = fields[2];
+  status.error = fields[3];
+  return true;
+}
+
+/**
+ * @brief read the run times of the contingencies simulated by the previous batches
+ *
+ * @param fileName file of the run times, one "id;runTime" line by contingency
+ *
+ * @return run time (s) by contingency id, empty if the file does not exist
+ */
+static map<string, double>
+readContingencyRunTimes(const string& fileName) {
+  map<string, double> runTimes;
+  std::ifstream file(fileName.c_str());
+  string line;
+  while (std::getline(file, line)) {
+    const size_t separator = line.find(';');
+    if (separator != string::npos)
+      runTimes[line.substr(0, separator)] = std::atof(line.c_str() + separator + 1);
+  }
+  return runTimes;
+}
+
+/**
+ * @brief order the contingencies of a batch: longest run times first, the contingencies never simulated being assumed the longest
+ *
+ * Starting with the longest contingencies avoids ending the batch with a long contingency running alone.
+ *
+ * @param contingencies contingencies of the batch
+ * @param runTimes run times observed by the previous batches
+ *
+ * @return indexes of the contingencies in the order they must be simulated
+ */
+static vector<size_t>
+orderContingencies(const vector<Simulation::Contingency>& contingencies, const map<string, double>& runTimes) {
+  vector<double> expectedRunTimes(contingencies.size(), std::numeric_limits<double>::max());
+  for (size_t i = 0; i < contingencies.size(); ++i) {
+    const auto it = runTimes.find(contingencies[i].id_);
+    if (it != runTimes.end())
+      expectedRunTimes[i] = it->second;
+  }
+  vector<size_t> order(contingencies.size());
+  for (size_t i = 0; i < order.size(); ++i)
+    order[i] = i;
+  std::stable_sort(order.begin(), order.end(), [&expectedRunTimes](const size_t a, const size_t b) {
+    return expectedRunTimes[a] > expectedRunTimes[b];
+  });
+  return order;
+}
+
+/**
+ * @brief write the summary of the contingencies simulated in a contingencies directory and record their run times
+ *
+ * The summary gathers the status of the contingencies simulated by all the processes sharing the directory.
+ *
+ * @param contingencies contingencies of the batch
+ * @param contingenciesDirectory directory of the outputs of the contingencies
+ * @param runTimesFile file of the run times, updated with the run times of the contingencies simulated
+ */
+static void
+writeContingenciesSummary(const vector<Simulation::Contingency>& contingencies, const string& contingenciesDirectory, const string& runTimesFile) {
+  map<string, double> runTimes = readContingencyRunTimes(runTimesFile);
+  stringstream summary;
+  summary << "id;status;exitCode;runTime;host;error;actions\n";
+  for (const auto& contingency : contingencies) {
+    const string outputsDirectory = createAbsolutePath(contingency.id_, contingenciesDirectory);
+    ContingencyStatus status;
+    if (readContingencyStatus(outputsDirectory, status)) {
+      summary << contingency.id_ << ";" << (status.exitCode == 0 ? "success" : "failure") << ";" << status.exitCode << ";" << status.runTime << ";"
+          << status.host << ";" << status.error << ";";
+      runTimes[contingency.id_] = status.runTime;
+    } else {
+      summary << contingency.id_ << ";" << (isDirectory(outputsDirectory) ? "incomplete" : "notSimulated") << ";;;;;";
+    }
+    // the actions identify the parameters of the variants of an ensemble
+    for (size_t i = 0; i < contingency.actions_.size(); ++i)
+      summary << (i > 0 ? " " : "") << contingency.actions_[i];
+    summary << "\n";
+  }
+  writeFileAtomically(createAbsolutePath(CONTINGENCIES_SUMMARY_FILENAME, contingenciesDirectory), summary.str());
+
+  stringstream runTimesContent;
+  for (const auto& runTime : runTimes)
+    runTimesContent << runTime.first << ";" << runTime.second << "\n";
+  writeFileAtomically(runTimesFile, runTimesContent.str());
+}
+
+#ifndef _MSC_VER
+/**
+ * @brief write a state snapshot in a pipe, preceded by its size
+ *
+ * @param fd file descriptor of the write end of the pipe
+ * @param state snapshot to write
+ *
+ * @return @b false if the pipe was closed or failed
+ */
+static bool
+writeStateToPipe(const int fd, const StateBuffer& state) {
+  const std::size_t size = state.size();
+  const char* chunks[2] = {reinterpret_cast<const char*>(&size), state.data()};
+  const std::size_t chunkSizes[2] = {sizeof(size), size};
+  for (unsigned i = 0; i < 2; ++i) {
+    std::size_t written = 0;
+    while (written < chunkSizes[i]) {
+      const ssize_t nbBytes = write(fd, chunks[i] + written, chunkSizes[i] - written);
+      if (nbBytes < 0 && errno == EINTR)
+        continue;
+      if (nbBytes <= 0)
+        return false;
+      written += static_cast<std::size_t>(nbBytes);
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief read bytes from a pipe until the expected number is reached
+ *
+ * @param fd file descriptor of the read end of the pipe
+ * @param destination where to copy the bytes
+ * @param nbBytes number of bytes expected
+ *
+ * @return @b false if the pipe was closed before all the bytes were read
+ */
+static bool
+readFromPipe(const int fd, char* destination, const std::size_t nbBytes) {
+  std::size_t nbBytesRead = 0;
+  while (nbBytesRead < nbBytes) {
+    const ssize_t nbBytesChunk = read(fd, destination + nbBytesRead, nbBytes - nbBytesRead);
+    if (nbBytesChunk < 0 && errno == EINTR)
+      continue;
+    if (nbBytesChunk <= 0)
+      return false;
+    nbBytesRead += static_cast<std::size_t>(nbBytesChunk);
+  }
+  return true;
+}
+
+/**
+ * @brief read a state snapshot written in a pipe by writeStateToPipe
+ *
+ * @param fd file descriptor of the read end of the pipe
+ * @param state snapshot to fill
+ *
+ * @return @b false if the pipe was closed before the whole snapshot was read
+ */
+static bool
+readStateFromPipe(const int fd, StateBuffer& state) {
+  std::size_t size = 0;
+  if (!readFromPipe(fd, reinterpret_cast<char*>(&size), sizeof(size)))
+    return false;
+  vector<char> bytes(size);
+  if (size > 0 && !readFromPipe(fd, &bytes[0], size))
+    return false;
+  state.assign(bytes.data(), size);
+  return true;
+}
+
+/**
+ * @brief stop the processes of the fine propagations already started, once another one could not be, and release their pipes
+ *
+ * @param processes identifier of each process and read end of its pipe
+ */
+static void
+stopFineProcesses(const vector<std::pair<pid_t, int> >& processes) {
+  for (const auto& process : processes) {
+    close(process.second);
+    kill(process.first, SIGKILL);
+    int status = 0;
+    while (waitpid(process.first, &status, 0) < 0 && errno == EINTR) {}
+  }
+}
+#endif
+
+/**
+ * @brief get the number of threads compressing or decompressing a dump state file
+ *
+ * @return number of hardware threads, 1 if unknown
+ */
+static unsigned
+nbStateDumpThreads() {
+  return std::max(1U, std::thread::hardware_concurrency());
+}
+
+/**
+ * @brief read an uncompressed dump state file, replaying the delta dumps onto the keyframe they are based on
+ *
+ * @param fileName path of the dump state file
+ * @param mapValues map associating the name of each entry with its content, to fill
+ * @param filesRead paths of the files already read, to detect a loop between the delta dumps
+ */
+static void
+readStateDumpFile(const fs::path& fileName, map<string, string>& mapValues, std::set<string>& filesRead) {
+  if (!filesRead.insert(fileName.generic_string()).second)
+    throw DYNError(Error::GENERAL, StateDumpCorrupted, fileName.generic_string());
+
+  map<string, string> entries;
+  StateDumpFile::read(fileName.generic_string(), entries);
+  auto previous = entries.find(PREVIOUS_DUMP_FILENAME);
+  if (previous == entries.end()) {
+    mapValues.swap(entries);
+    return;
+  }
+
+  readStateDumpFile(fileName.parent_path() / previous->second, mapValues, filesRead);
+  entries.erase(previous);
+  for (const auto& entry : entries) {
+    if (entry.first == TIME_FILENAME)
+      mapValues[entry.first] = entry.second;
+    else
+      StateDumpDelta::apply(entry.first, entry.second, mapValues[entry.first]);
+  }
+}
+
+void
+Simulation::changeOutputsDirectory(const std::string& outputsDirectory) {
+  const string oldDirectory = outputsDirectory_;
+  outputsDirectory_ = outputsDirectory;
+  if (!isDirectory(outputsDirectory_))
+    createDirectory(outputsDirectory_);
+
+  curvesOutputFile_ = rebaseOutputPath(curvesOutputFile_, oldDirectory, outputsDirectory_);
+  finalStateValuesOutputFile_ = rebaseOutputPath(finalStateValuesOutputFile_, oldDirectory, outputsDirectory_);
+  timelineOutputFile_ = rebaseOutputPath(timelineOutputFile_, oldDirectory, outputsDirectory_);
+  timetableOutputFile_ = rebaseOutputPath(timetableOutputFile_, oldDirectory, outputsDirectory_);
+  constraintsOutputFile_ = rebaseOutputPath(constraintsOutputFile_, oldDirectory, outputsDirectory_);
+  lostEquipmentsOutputFile_ = rebaseOutputPath(lostEquipmentsOutputFile_, oldDirectory, outputsDirectory_);
+  solverStatisticsOutputFile_ = rebaseOutputPath(solverStatisticsOutputFile_, oldDirectory, outputsDirectory_);
+  convergenceDiagnosticsOutputFile_ = rebaseOutputPath(convergenceDiagnosticsOutputFile_, oldDirectory, outputsDirectory_);
+  realTimeTrackingFile_ = rebaseOutputPath(realTimeTrackingFile_, oldDirectory, outputsDirectory_);
+
+  std::queue<ExportStateDefinition> intermediateStates;
+  for (; !intermediateStates_.empty(); intermediateStates_.pop()) {
+    ExportStateDefinition state = intermediateStates_.front();
+    if (state.dumpFile_)
+      state.dumpFile_ = rebaseOutputPath(state.dumpFile_->string(), oldDirectory, outputsDirectory_);
+    if (state.iidmFile_)
+      state.iidmFile_ = rebaseOutputPath(state.iidmFile_->string(), oldDirectory, outputsDirectory_);
+    intermediateStates.push(state);
+  }
+  intermediateStates_.swap(intermediateStates);
+  if (finalState_.dumpFile_)
+    finalState_.dumpFile_ = rebaseOutputPath(finalState_.dumpFile_->string(), oldDirectory, outputsDirectory_);
+  if (finalState_.iidmFile_)
+    finalState_.iidmFile_ = rebaseOutputPath(finalState_.iidmFile_->string(), oldDirectory, outputsDirectory_);
+
+  // the log files are in the outputs directory too
+  if (jobEntry_->getOutputsEntry())
+    configureLogs();
+}
+
+void
+Simulation::simulateContingencies(const std::vector<Contingency>& contingencies, const unsigned nbParallelContingencies, const bool shared) {
+  // the forked processes must not inherit a running dump
+  waitForIIDMDump();
+  runContingencies(contingencies, nbParallelContingencies, shared, outputsDirectory_,
+      [this](const Contingency& contingency, const std::string& outputsDirectory, std::string& error) {
+        return runContingency(contingency, outputsDirectory, error);
+      });
+}
+
+#ifndef _MSC_VER
+/**
+ * @brief run a contingency in the current process and write its status
+ *
+ * @param runContingency function running the contingency
+ * @param contingency contingency to run
+ * @param outputsDirectory outputs directory of the contingency
+ *
+ * @return the exit code of the process of the contingency, 0 if it succeeded
+ */
+static int
+simulateContingency(const Simulation::ContingencyRunner& runContingency, const Simulation::Contingency& contingency, const string& outputsDirectory) {
+  const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  ContingencyStatus status;
+  try {
+    status.exitCode = runContingency(contingency, outputsDirectory, status.error);
+  } catch (const std::exception& e) {
+    status.exitCode = 1;
+    status.error = e.what();
+    Trace::error() << status.error << Trace::endline;
+  }
+  status.runTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  status.host = hostName();
+  try {
+    writeContingencyStatus(outputsDirectory, status);
+  } catch (const Error& e) {
+    Trace::error() << e.what() << Trace::endline;
+    return std::max(status.exitCode, 1);
+  }
+  return status.exitCode;
+}
+#endif
+
+void
+Simulation::runContingencies(const std::vector<Contingency>& contingencies, const unsigned nbParallelContingencies, const bool shared,
+    const std::string& outputsDirectory, const ContingencyRunner& runContingency) {
+#ifdef _MSC_VER
+  static_cast<void>(contingencies);
+  static_cast<void>(nbParallelContingencies);
+  static_cast<void>(shared);
+  static_cast<void>(outputsDirectory);
+  static_cast<void>(runContingency);
+  throw DYNError(Error::SIMULATION, ContingencyBatchUnavailable);
+#else
+  const string contingenciesDirectory = createAbsolutePath("contingencies", outputsDirectory);
+  const string runTimesFile = createAbsolutePath(CONTINGENCY_RUN_TIMES_FILENAME, outputsDirectory);
+  if (!isDirectory(contingenciesDirectory))
+    createDirectory(contingenciesDirectory);
+  const string host = hostName();
+
+  struct RunningContingency {
+    string id;  ///< id of the contingency
+    std::chrono::steady_clock::time_point start;  ///< launch time of the contingency
+  };
+  std::map<pid_t, RunningContingency> runningContingencies;
+  unsigned nbFailedContingencies = 0;
+  unsigned nbSimulatedContingencies = 0;
+  // wait for the end of one of the running contingencies
+  auto waitForOneContingency = [&runningContingencies, &nbFailedContingencies, &contingenciesDirectory, &host]() {
+    int status = 0;
+    const pid_t pid = waitpid(-1, &status, 0);
+    if (pid < 0)
+      throw DYNError(Error::SIMULATION, ContingencyWaitError, strerror(errno));
+    const auto it = runningContingencies.find(pid);
+    if (it == runningContingencies.end())
+      return;
+    if (WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+      Trace::info() << DYNLog(ContingencySuccess, it->second.id) << Trace::endline;
+    } else {
+      ++nbFailedContingencies;
+      const int exitCode = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+      Trace::error() << DYNLog(ContingencyFailure, it->second.id, exitCode) << Trace::endline;
+      // a process killed by a signal did not write its status
+      const string contingencyDirectory = createAbsolutePath(it->second.id, contingenciesDirectory);
+      ContingencyStatus contingencyStatus;
+      if (!readContingencyStatus(contingencyDirectory, contingencyStatus)) {
+        contingencyStatus.exitCode = exitCode;
+        contingencyStatus.runTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - it->second.start).count();
+        contingencyStatus.host = host;
+        contingencyStatus.error = WIFSIGNALED(status) ? strsignal(WTERMSIG(status)) : "";
+        writeContingencyStatus(contingencyDirectory, contingencyStatus);
+      }
+    }
+    runningContingencies.erase(it);
+  };
+
+  for (const size_t index : orderContingencies(contingencies, readContingencyRunTimes(runTimesFile))) {
+    const Contingency& contingency = contingencies[index];
+    while (runningContingencies.size() >= std::max(nbParallelContingencies, 1U))
+      waitForOneContingency();
+
+    const string contingencyDirectory = createAbsolutePath(contingency.id_, contingenciesDirectory);
+    // the creation of the directory is atomic, even on a network file system: only one process succeeds in claiming the contingency
+    if (shared && !boost::filesystem::create_directory(contingencyDirectory)) {
+      Trace::info() << DYNLog(ContingencyClaimedElsewhere, contingency.id_) << Trace::endline;
+      continue;
+    }
+
+    // the buffered outputs must not be written by both processes
+    Trace::flush();
+    std::cout.flush();
+    std::clog.flush();
+    const pid_t pid = fork();
+    if (pid < 0)
+      throw DYNError(Error::SIMULATION, ContingencyForkError, contingency.id_, strerror(errno));
+    if (pid == 0) {
+      const int exitCode = simulateContingency(runContingency, contingency, contingencyDirectory);
+      Trace::flush();
+      std::cout.flush();
+      std::clog.flush();
+      // the resources shared with the parent process are released by the parent only
+      _exit(exitCode);
+    }
+    Trace::info() << DYNLog(ContingencyLaunched, contingency.id_, pid) << Trace::endline;
+    RunningContingency running;
+    running.id = contingency.id_;
+    running.start = std::chrono::steady_clock::now();
+    runningContingencies[pid] = running;
+    ++nbSimulatedContingencies;
+  }
+  while (!runningContingencies.empty())
+    waitForOneContingency();
+
+  // the contingencies of the other processes may be still running: each process writes the summary of what is done when it ends
+  writeContingenciesSummary(contingencies, contingenciesDirectory, runTimesFile);
+  Trace::info() << DYNLog(ContingenciesSummaryWritten, nbSimulatedContingencies, contingencies.size(),
+      createAbsolutePath(CONTINGENCIES_SUMMARY_FILENAME, contingenciesDirectory)) << Trace::endline;
+
+  if (nbFailedContingencies > 0)
+    throw DYNError(Error::SIMULATION, ContingenciesFailure, nbFailedContingencies, nbSimulatedContingencies);
+#endif
+}
+
+int
+Simulation::runContingency(const Contingency& contingency, const std::string& outputsDirectory, std::string& error) {
+  try {
+    changeOutputsDirectory(outputsDirectory);
+
+    applyActions(contingency.actions_);
+    Trace::info() << DYNLog(ContingencyApplied, contingency.id_, contingency.actions_.size()) << Trace::endline;
+  } catch (const Error& e) {
+    error = e.what();
+    Trace::error() << error << Trace::endline;
+    return std::max(static_cast<int>(e.type()), 1);
+  } catch (const std::exception& e) {
+    error = e.what();
+    Trace::error() << error << Trace::endline;
+    return 1;
+  }
+
+  try {
+    simulate();
+    terminate();
+  } catch (const Error& e) {
+    error = e.what();
+    Trace::error() << error << Trace::endline;
+    // as in the launcher, otherwise terminate might crash due to missing staticRef variables
+    if (e.key() == KeyError_t::StateVariableNoReference) {
+      disableExportIIDM();
+      setLostEquipmentsExportMode(EXPORT_LOSTEQUIPMENTS_NONE);
+    }
+    try {
+      terminate();
+    } catch (...) {
+      // the error of the simulation is the one reported
+    }
+    return std::max(static_cast<int>(e.type()), 1);
+  } catch (const Terminate& e) {
+    error = e.what();
+    Trace::error() << error << Trace::endline;
+    try {
+      terminate();
+    } catch (...) {
+      // the interruption is the one reported
+    }
+    return 1;
+  } catch (const std::exception& e) {
+    error = e.what();
+    Trace::error() << error << Trace::endline;
+    try {
+      terminate();
+    } catch (...) {
+      // the error of the simulation is the one reported
+    }
+    return 1;
+  }
+  return 0;
+}
+
+/**
+ * @brief the simulation as the system propagated by the parareal algorithm: the coarse propagator is the solver with its cheaper
+ * settings, the fine propagator the solver with its nominal settings
+ */
+class Simulation::SimulationPropagator : public Simulation::PararealPropagator {
+ public:
+  /**
+   * @brief constructor
+   *
+   * @param simulation simulation to propagate
+   */
+  explicit SimulationPropagator(Simulation& simulation) :
+  simulation_(simulation) {
+  }
+
+  void snapshotState(StateBuffer& state) const override {
+    simulation_.snapshotState(state);
+  }
+
+  void restoreState(const StateBuffer& state) override {
+    simulation_.restoreState(state);
+  }
+
+  void propagate(const double tEnd, const bool coarse) override {
+    simulation_.propagateSlice(tEnd, coarse);
+  }
+
+  const vector<double>& getCurrentY() const override {
+    return simulation_.solver_->getCurrentY();
+  }
+
+  const vector<double>& getCurrentYP() const override {
+    return simulation_.solver_->getCurrentYP();
+  }
+
+  void setContinuousVariables(const vector<double>& y, const vector<double>& yp) override {
+    simulation_.solver_->setContinuousVariables(y, yp);
+  }
+
+  void startOutputsRecording() override {
+    simulation_.startSliceOutputsRecording();
+  }
+
+  void snapshotOutputs(StateBuffer& outputs) const override {
+    simulation_.snapshotSliceOutputs(outputs);
+  }
+
+  void appendOutputs(const StateBuffer& outputs) override {
+    simulation_.appendSliceOutputs(outputs);
+  }
+
+ private:
+  Simulation& simulation_;  ///< simulation propagated
+};
+
+void
+Simulation::simulateParareal(const unsigned nbSlices, const unsigned maxIterations, const double tolerance) {
+  // the coarse propagator is the solver with its cheaper settings
+  if (!solver_->setDegradedMode(true))
+    throw DYNError(Error::SIMULATION, PararealNoCoarseSettings, solver_->solverType());
+  solver_->setDegradedMode(false);
+  // the forked processes must not inherit a running dump
+  waitForIIDMDump();
+  SimulationPropagator propagator(*this);
+  runParareal(tCurrent_, tStop_, nbSlices, maxIterations, tolerance, propagator);
+}
+
+bool
+Simulation::runParareal(const double tStart, const double tStop, const unsigned nbSlices, const unsigned maxIterations, const double tolerance,
+    PararealPropagator& propagator) {
+#ifdef _MSC_VER
+  static_cast<void>(tStart);
+  static_cast<void>(tStop);
+  static_cast<void>(nbSlices);
+  static_cast<void>(maxIterations);
+  static_cast<void>(tolerance);
+  static_cast<void>(propagator);
+  throw DYNError(Error::SIMULATION, PararealUnavailable);
+#else
+  const unsigned nbTimeSlices = std::max(nbSlices, 1U);
+  vector<double> sliceEnds(nbTimeSlices);
+  for (unsigned n = 0; n < nbTimeSlices; ++n)
+    sliceEnds[n] = (n + 1 == nbTimeSlices) ? tStop : tStart + (tStop - tStart) * (n + 1) / nbTimeSlices;
+  Trace::info() << DYNLog(PararealStart, nbTimeSlices, tStart, tStop) << Trace::endline;
+
+  // states[n] is the state at the start of the slice n, states[nbTimeSlices] the final state
+  vector<StateBuffer> states(nbTimeSlices + 1);
+  // continuous variables at the end of each slice: propagated by the coarse solver at the previous iteration, and of states[n + 1]
+  vector<vector<double> > coarseY(nbTimeSlices);
+  vector<vector<double> > coarseYp(nbTimeSlices);
+  vector<vector<double> > endY(nbTimeSlices);
+  // outputs of the last fine propagation of each slice
+  vector<StateBuffer> fineOutputs(nbTimeSlices);
+  propagator.snapshotState(states[0]);
+  for (unsigned n = 0; n < nbTimeSlices; ++n) {
+    propagator.propagate(sliceEnds[n], true);
+    coarseY[n] = propagator.getCurrentY();
+    coarseYp[n] = propagator.getCurrentYP();
+    endY[n] = coarseY[n];
+    propagator.snapshotState(states[n + 1]);
+  }
+
+  // after k iterations, the first k slices start from the state propagated by the fine solver from the initial state
+  bool converged = false;
+  unsigned iteration = 0;
+  while (!converged && iteration < std::min(maxIterations, nbTimeSlices)) {
+    const unsigned firstSlice = iteration++;
+    vector<StateBuffer> fineStates(nbTimeSlices);
+    propagateFineSlices(propagator, states, sliceEnds, firstSlice, fineStates, fineOutputs);
+
+    double maxCorrection = 0.;
+    for (unsigned n = firstSlice; n < nbTimeSlices; ++n) {
+      vector<double> newCoarseY;
+      vector<double> newCoarseYp;
+      if (n > firstSlice) {
+        propagator.restoreState(states[n]);
+        propagator.propagate(sliceEnds[n], true);
+        newCoarseY = propagator.getCurrentY();
+        newCoarseYp = propagator.getCurrentYP();
+      }
+      // the discrete variables and the history of the solver come from the fine propagation, the continuous variables are corrected
+      // by the difference between the coarse propagations from the new and from the previous start state
+      propagator.restoreState(fineStates[n]);
+      if (n > firstSlice) {
+        vector<double> y = propagator.getCurrentY();
+        vector<double> yp = propagator.getCurrentYP();
+        for (size_t i = 0, iEnd = y.size(); i < iEnd; ++i) {
+          y[i] += newCoarseY[i] - coarseY[n][i];
+          yp[i] += newCoarseYp[i] - coarseYp[n][i];
+        }
+        propagator.setContinuousVariables(y, yp);
+        coarseY[n].swap(newCoarseY);
+        coarseYp[n].swap(newCoarseYp);
+      }
+      const vector<double>& y = propagator.getCurrentY();
+      for (size_t i = 0, iEnd = y.size(); i < iEnd; ++i)
+        maxCorrection = std::max(maxCorrection, std::abs(y[i] - endY[n][i]) / std::max(std::abs(y[i]), 1.));
+      endY[n].assign(y.begin(), y.end());
+      propagator.snapshotState(states[n + 1]);
+    }
+    // once every slice started from an exact state, the last fine propagation is the sequential one
+    converged = maxCorrection <= tolerance || iteration == nbTimeSlices;
+    Trace::info() << DYNLog(PararealIteration, iteration, maxCorrection) << Trace::endline;
+  }
+
+  propagator.restoreState(states[nbTimeSlices]);
+  for (unsigned n = 0; n < nbTimeSlices; ++n) {
+    if (fineOutputs[n].size() > 0)
+      propagator.appendOutputs(fineOutputs[n]);
+  }
+  if (converged)
+    Trace::info() << DYNLog(PararealConverged, iteration) << Trace::endline;
+  else
+    Trace::warn() << DYNLog(PararealNotConverged, iteration, tolerance) << Trace::endline;
+  return converged;
+#endif
+}
+
+void
+Simulation::propagateSlice(const double tEnd, const bool coarse) {
+  solver_->setDegradedMode(coarse);
+  integrateUntil(tEnd, !coarse);
+  solver_->setDegradedMode(false);
+}
+
+void
+Simulation::startSliceOutputsRecording() {
+  // the parent process streams the outputs once they are appended, the points kept before the slice are already its own
+  outputsStreamed_ = false;
+  curvesCollection_->keepLastPoints(0);
+  if (timeline_)
+    timeline_->clear();
+}
+
+void
+Simulation::snapshotSliceOutputs(StateBuffer& outputs) const {
+  outputs.clear();
+  const vector<double>& times = curvesCollection_->getTimes();
+  outputs.write(times.size());
+  outputs.write(times);
+  const vector<std::shared_ptr<curves::Curve> >& curves = curvesCollection_->getCurves();
+  outputs.write(curves.size());
+  for (const auto& curve : curves) {
+    outputs.write(curve->getValues().size());
+    outputs.write(curve->getValues());
+  }
+  const std::size_t nbEvents = timeline_ ? timeline_->getEvents().size() : 0;
+  outputs.write(nbEvents);
+  for (std::size_t i = 0; i < nbEvents; ++i) {
+    const timeline::Event& event = *timeline_->getEvents()[i];
+    outputs.write(event.getTime());
+    outputs.write(event.getModelName());
+    outputs.write(event.getMessage());
+    outputs.write(event.hasPriority());
+    outputs.write(event.hasPriority() ? event.getPriority() : 0);
+    outputs.write(event.getKey());
+  }
+}
+
+void
+Simulation::appendSliceOutputs(const StateBuffer& outputs) {
+  StateBuffer::Reader reader(outputs);
+  std::size_t nbTimes = 0;
+  reader.read(nbTimes);
+  vector<double> times(nbTimes);
+  reader.read(times);
+  std::size_t nbCurves = 0;
+  reader.read(nbCurves);
+  vector<vector<double> > values(nbCurves);
+  for (auto& curveValues : values) {
+    std::size_t nbValues = 0;
+    reader.read(nbValues);
+    curveValues.resize(nbValues);
+    reader.read(curveValues);
+  }
+  curvesCollection_->appendPoints(times, values);
+  if (curvesStreamExporter_) {
+    // the exporter counts the points stored since its last flush
+    for (std::size_t i = 0; i < nbTimes; ++i)
+      curvesStreamExporter_->update();
+  }
+
+  std::size_t nbEvents = 0;
+  reader.read(nbEvents);
+  for (std::size_t i = 0; i < nbEvents; ++i) {
+    double time = 0.;
+    string modelName;
+    string message;
+    bool hasPriority = false;
+    int priority = 0;
+    string key;
+    reader.read(time);
+    reader.read(modelName);
+    reader.read(message);
+    reader.read(hasPriority);
+    reader.read(priority);
+    reader.read(key);
+    if (timeline_)
+      timeline_->addEvent(time, modelName, message, hasPriority ? boost::optional<int>(priority) : boost::none, key);
+  }
+  if (timelineStreamExporter_)
+    timelineStreamExporter_->update();
+  if (!reader.atEnd())
+    throw DYNError(Error::GENERAL, DumpStateError);
+}
+
+void
+Simulation::advance(const double tAim) {
+  // the initial point is recorded by the first call, as by simulate
+  const std::vector<std::shared_ptr<curves::Curve> >& curves = curvesCollection_->getCurves();
+  if (!curves.empty() && curves.front()->getNbPoints() == 0) {
+    if (exportCurvesMode_ != EXPORT_CURVES_NONE)
+      model_->evalCalculatedVariablesForCurves(tCurrent_, solver_->getCurrentY(), solver_->getCurrentYP(), zCurrent_);
+    updateCurves(false);
+  }
+  integrateUntil(std::min(tAim, tStop_), true);
+  if (exportCurvesMode_ != EXPORT_CURVES_NONE)
+    model_->evalCalculatedVariablesForCurves(tCurrent_, solver_->getCurrentY(), solver_->getCurrentYP(), zCurrent_);
+}
+
+void
+Simulation::integrateUntil(const double tEnd, const bool updateOutputs) {
+  while (tCurrent_ < tEnd && !doubleEquals(tCurrent_, tEnd)) {
+    solver_->solve(tEnd, tCurrent_);
+    const BitMask solverState = solver_->getState();
+    if (solverState.getFlags(ModeChange)) {
+      if (updateOutputs)
+        updateCurves(true);
+      model_->notifyTimeStep();
+      solver_->reinit();
+      model_->getCurrentZ(zCurrent_);
+    } else if (!solverState.noFlagSet()) {
+      if (updateOutputs)
+        updateCurves(true);
+      model_->getCurrentZ(zCurrent_);
+    }
+    if (updateOutputs) {
+      updateCurves(true);
+      model_->printMessages();
+      if (timelineStreamExporter_ && outputsStreamed_)
+        timelineStreamExporter_->update();
+    }
+    model_->notifyTimeStep();
+  }
+}
+
+void
+Simulation::applyActions(const std::vector<std::string>& actions) {
+  // the actions are registered and applied as in the interactive mode
+  const std::shared_ptr<ModelMulti> modelMulti = std::dynamic_pointer_cast<ModelMulti>(model_);
+  if (!modelMulti)
+    throw DYNError(Error::SIMULATION, ActionsUnsupported);
+  const std::shared_ptr<ActionBuffer> actionBuffer = std::make_shared<ActionBuffer>();
+  modelMulti->setActionBuffer(actionBuffer);
+  model_->registerActions(actions);
+  actionBuffer->applyActions();
+  modelMulti->setActionBuffer(std::shared_ptr<ActionBuffer>());
+}
+
+bool
+Simulation::getParameterValue(const std::string& modelName, const std::string& parameterName, std::string& value) const {
+  const std::shared_ptr<ModelMulti> modelMulti = std::dynamic_pointer_cast<ModelMulti>(model_);
+  if (!modelMulti)
+    return false;
+  const boost::shared_ptr<SubModel> subModel = modelMulti->findSubModelByName(modelName);
+  if (!subModel)
+    return false;
+  bool found = false;
+  subModel->getSubModelParameterValue(parameterName, value, found);
+  return found;
+}
+
+void
+Simulation::propagateFineSlices(PararealPropagator& propagator, const vector<StateBuffer>& states, const vector<double>& sliceEnds,
+    const unsigned firstSlice, vector<StateBuffer>& fineStates, vector<StateBuffer>& fineOutputs) {
+#ifdef _MSC_VER
+  static_cast<void>(propagator);
+  static_cast<void>(states);
+  static_cast<void>(sliceEnds);
+  static_cast<void>(firstSlice);
+  static_cast<void>(fineStates);
+  static_cast<void>(fineOutputs);
+  throw DYNError(Error::SIMULATION, PararealUnavailable);
+#else
+  // one process per slice, forked from the simulation that wrote the snapshots so that they can be restored there
+  vector<std::pair<pid_t, int> > processes;
+  for (unsigned n = firstSlice; n < sliceEnds.size(); ++n) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+      const int error = errno;
+      stopFineProcesses(processes);
+      throw DYNError(Error::SIMULATION, PararealForkError, n, strerror(error));
+    }
+    // the buffered outputs must not be written by both processes
+    Trace::flush();
+    std::cout.flush();
+    std::clog.flush();
+    const pid_t pid = fork();
+    if (pid < 0) {
+      const int error = errno;
+      close(fds[0]);
+      close(fds[1]);
+      stopFineProcesses(processes);
+      throw DYNError(Error::SIMULATION, PararealForkError, n, strerror(error));
+    }
+    if (pid == 0) {
+      close(fds[0]);
+      int exitCode = 0;
+      try {
+        propagator.restoreState(states[n]);
+        propagator.startOutputsRecording();
+        propagator.propagate(sliceEnds[n], false);
+        StateBuffer endState;
+        propagator.snapshotState(endState);
+        StateBuffer outputs;
+        propagator.snapshotOutputs(outputs);
+        if (!writeStateToPipe(fds[1], endState) || !writeStateToPipe(fds[1], outputs))
+          exitCode = 1;
+      } catch (const Error& e) {
+        Trace::error() << e.what() << Trace::endline;
+        exitCode = std::max(static_cast<int>(e.type()), 1);
+      } catch (const std::exception& e) {
+        Trace::error() << e.what() << Trace::endline;
+        exitCode = 1;
+      }
+      close(fds[1]);
+      Trace::flush();
+      std::cout.flush();
+      std::clog.flush();
+      // the resources shared with the parent process are released by the parent only
+      _exit(exitCode);
+    }
+    close(fds[1]);
+    processes.push_back(std::make_pair(pid, fds[0]));
+  }
+
+  // every process is waited for, even after a failure, so that none is left behind
+  unsigned failedSlice = 0;
+  int failedExitCode = 0;
+  bool failed = false;
+  for (unsigned n = firstSlice; n < sliceEnds.size(); ++n) {
+    const std::pair<pid_t, int>& process = processes[n - firstSlice];
+    const bool stateRead = readStateFromPipe(process.second, fineStates[n]) && readStateFromPipe(process.second, fineOutputs[n]);
+    close(process.second);
+    int status = 0;
+    while (waitpid(process.first, &status, 0) < 0 && errno == EINTR) {}
+    const int exitCode = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+    if ((!stateRead || exitCode != 0) && !failed) {
+      failed = true;
+      failedSlice = n;
+      failedExitCode = exitCode;
+    }
+  }
+  if (failed)
+    throw DYNError(Error::SIMULATION, PararealSliceFailure, failedSlice, failedExitCode);
+#endif
+}
+
 void
 Simulation::configureSimulationOutputs() {
   if (jobEntry_->getOutputsEntry() != nullptr) {
@@ -307,6 +1342,7 @@ Simulation::configureSimulationOutputs() {
     configureFinalStateValueOutputs();
     configureFinalStateOutputs();
     configureLostEquipmentsOutputs();
+    configureSolverStatisticsOutputs();
   }
 
   // Configure real time tracking file path
@@ -373,6 +1409,15 @@ Simulation::configureTimelineOutputs() {
     } else if (exportMode == "XML") {
       exportModeFlag = Simulation::EXPORT_TIMELINE_XML;
       outputFile = createAbsolutePath("timeline.xml", timeLineDir);
+    } else if (exportMode == "TXT_STREAM") {
+      exportModeFlag = Simulation::EXPORT_TIMELINE_TXT_STREAM;
+      outputFile = createAbsolutePath("timeline.log", timeLineDir);
+    } else if (exportMode == "CSV_STREAM") {
+      exportModeFlag = Simulation::EXPORT_TIMELINE_CSV_STREAM;
+      outputFile = createAbsolutePath("timeline.csv", timeLineDir);
+    } else if (exportMode == "XML_STREAM") {
+      exportModeFlag = Simulation::EXPORT_TIMELINE_XML_STREAM;
+      outputFile = createAbsolutePath("timeline.xml", timeLineDir);
     } else {
       throw DYNError(Error::MODELER, UnknownTimelineExport, exportMode);
     }
@@ -380,6 +1425,13 @@ Simulation::configureTimelineOutputs() {
     exportTimelineWithTime_ = jobEntry_->getOutputsEntry()->getTimelineEntry()->getExportWithTime();
     exportTimelineMaxPriority_ = jobEntry_->getOutputsEntry()->getTimelineEntry()->getMaxPriority();
     filterTimeline_ = jobEntry_->getOutputsEntry()->getTimelineEntry()->isFilter();
+    // the events never exported are rejected before their message is formatted, except those which may cancel an opposite event
+    const vector<string>& allowedKeys = jobEntry_->getOutputsEntry()->getTimelineEntry()->getAllowedKeys();
+    const vector<string>& deniedKeys = jobEntry_->getOutputsEntry()->getTimelineEntry()->getDeniedKeys();
+    if (exportTimelineMaxPriority_ || !allowedKeys.empty() || !deniedKeys.empty())
+      timeline_->setEventFilter(exportTimelineMaxPriority_, std::unordered_set<string>(allowedKeys.begin(), allowedKeys.end()),
+          std::unordered_set<string>(deniedKeys.begin(), deniedKeys.end()),
+          filterTimeline_ ? DYN::IoDicos::instance().mergeOppositeEventsDicos() : std::unordered_map<string, std::unordered_set<string> >());
     setTimelineOutputFile(outputFile);
   } else {
     setTimelineExportMode(Simulation::EXPORT_TIMELINE_NONE);
@@ -393,11 +1445,22 @@ Simulation::configureTimetableOutputs() {
     if (!isDirectory(outputsDirectory_))
       createDirectory(outputsDirectory_);
 
-    stringstream fileName;
-    fileName << outputsDirectory_ << "/.dynawoexec-" << pid_;
-    timetableOutputFile_ = fileName.str();
-
     timetableSteps_ = jobEntry_->getOutputsEntry()->getTimetableEntry()->getStep();
+
+    const string& exportMode = jobEntry_->getOutputsEntry()->getTimetableEntry()->getExportMode();
+    if (exportMode == "FILE") {
+      stringstream fileName;
+      fileName << outputsDirectory_ << "/.dynawoexec-" << pid_;
+      timetableOutputFile_ = fileName.str();
+    } else if (exportMode == "SHARED_MEMORY") {
+      // the record is only written in memory, monitoring tools polling it at no file system cost
+      stringstream name;
+      name << "/dynawo-progress-" << pid_;
+      progressRecord_ = std::make_shared<ProgressRecord>(name.str());
+      Trace::info() << DYNLog(ProgressRecordCreated, name.str()) << Trace::endline;
+    } else {
+      throw DYNError(Error::MODELER, UnknownTimetableExport, exportMode);
+    }
   }
 }
 
@@ -429,6 +1492,15 @@ Simulation::configureCurveOutputs() {
     } else if (exportMode == "XML") {
       exportModeFlag = Simulation::EXPORT_CURVES_XML;
       outputFile = createAbsolutePath("curves.xml", curvesDir);
+    } else if (exportMode == "BINARY") {
+      exportModeFlag = Simulation::EXPORT_CURVES_BINARY;
+      outputFile = createAbsolutePath("curves.bin", curvesDir);
+    } else if (exportMode == "CSV_STREAM") {
+      exportModeFlag = Simulation::EXPORT_CURVES_CSV_STREAM;
+      outputFile = createAbsolutePath("curves.csv", curvesDir);
+    } else if (exportMode == "BINARY_STREAM") {
+      exportModeFlag = Simulation::EXPORT_CURVES_BINARY_STREAM;
+      outputFile = createAbsolutePath("curves.bin", curvesDir);
     } else {
       throw DYNError(Error::MODELER, UnknownCurvesExport, exportMode);
     }
@@ -492,12 +1564,20 @@ Simulation::configureFinalStateOutputs() {
   std::map<double, ExportStateDefinition> dumpStateDefinitionsMap;
   for (const auto& finalStateEntry : finalStateEntries) {
     boost::optional<double> timestamp = finalStateEntry->getTimestamp();
+    dumpFormat_t dumpFormat = DUMP_FORMAT_ZIP;
+    if (finalStateEntry->getDumpFormat() == "RAW")
+      dumpFormat = DUMP_FORMAT_RAW;
+    else if (finalStateEntry->getDumpFormat() == "DELTA")
+      dumpFormat = DUMP_FORMAT_DELTA;
+    else if (finalStateEntry->getDumpFormat() == "COMPRESSED")
+      dumpFormat = DUMP_FORMAT_COMPRESSED;
 
     if (!timestamp) {
       // case no timestamp given, meaning final state
       // ---- exportDumpFile ----
       if (finalStateEntry->getExportDumpFile()) {
         finalState_.dumpFile_ = createAbsolutePath("outputState.dmp", finalStateDir);
+        finalState_.dumpFormat_ = dumpFormat;
       }
 
       // --- exportIIDMFile ----
@@ -514,6 +1594,7 @@ Simulation::configureFinalStateOutputs() {
         std::stringstream ss;
         ss << *timestamp << "_outputState.dmp";
         dumpStateDefinition.dumpFile_ = createAbsolutePath(ss.str(), finalStateDir);
+        dumpStateDefinition.dumpFormat_ = dumpFormat;
       }
       if (finalStateEntry->getExportIIDMFile()) {
         std::stringstream ss;
@@ -543,6 +1624,28 @@ Simulation::configureLostEquipmentsOutputs() {
   }
 }
 
+void
+Simulation::configureSolverStatisticsOutputs() {
+  // Solver statistics settings
+  if (jobEntry_->getOutputsEntry()->getSolverStatisticsEntry()) {
+    const string solverStatisticsDir = createAbsolutePath("solverStatistics", outputsDirectory_);
+    if (!isDirectory(solverStatisticsDir))
+      createDirectory(solverStatisticsDir);
+
+    //---- exportMode ----
+    const string& exportMode = jobEntry_->getOutputsEntry()->getSolverStatisticsEntry()->getExportMode();
+    if (exportMode == "CSV")
+      solverStatisticsOutputFile_ = createAbsolutePath("solverStatistics.csv", solverStatisticsDir);
+    else
+      throw DYNError(Error::MODELER, UnknownSolverStatisticsExport, exportMode);
+
+    //---- convergenceDiagnosticsDepth ----
+    convergenceDiagnosticsDepth_ = jobEntry_->getOutputsEntry()->getSolverStatisticsEntry()->getConvergenceDiagnosticsDepth();
+    if (convergenceDiagnosticsDepth_ > 0)
+      convergenceDiagnosticsOutputFile_ = createAbsolutePath("convergenceDiagnostics.csv", solverStatisticsDir);
+  }
+}
+
 void
 Simulation::compileModels() const {
   // ModelsDirEntry: Precompiled models
@@ -629,8 +1732,14 @@ Simulation::loadDynamicData() {
   dyd_->setRootDirectory(context_->getInputDirectory());
   dyd_->setParametersReference(referenceParameters_);
 
+  boost::shared_ptr<dynamicdata::DynamicModelsCollection> dynamicModelsCollection;
   if (!data_) {
-    if (!iidmFile_.empty()) {
+    if (pendingNetworkImport_.valid()) {
+      // the dyd files do not depend on the network: they are parsed while the network is still being read
+      const dynamicdata::XmlImporter importer;
+      dynamicModelsCollection = importer.importFromDydFiles(dydFiles_);
+      data_ = pendingNetworkImport_.get();
+    } else if (!iidmFile_.empty()) {
       data_ = DataInterfaceFactory::build(DataInterfaceFactory::DATAINTERFACE_IIDM, iidmFile_);
     } else {
       dyd_->initFromDydFiles(dydFiles_);
@@ -643,13 +1752,20 @@ Simulation::loadDynamicData() {
   if (criteriaCollection_)
     data_->configureCriteria(criteriaCollection_);
 
+  // the models read the bus voltages in their static parameters: the power flow must update them beforehand
+  if (jobEntry_->getModelerEntry()->getNetworkEntry() && jobEntry_->getModelerEntry()->getNetworkEntry()->getInitialPowerFlow())
+    InitialPowerFlow::run(data_->getNetwork());
+
   data_->importStaticParameters();  // Import static model's parameters' values into DataInterface, these values are useful for referece parameters.
 
   data_->setTimeline(timeline_);
 
   dyd_->setDataInterface(data_);
 
-  dyd_->initFromDydFiles(dydFiles_);
+  if (dynamicModelsCollection)
+    dyd_->setDynamicModelsCollection(dynamicModelsCollection);
+  else
+    dyd_->initFromDydFiles(dydFiles_);
   data_->mapConnections();
 
   if (data_->instantiateNetwork()) {
@@ -664,6 +1780,11 @@ Simulation::loadDynamicData() {
       networkParFile_ = jobEntry_->getModelerEntry()->getNetworkEntry()->getNetworkParFile();
       networkParSet_ = jobEntry_->getModelerEntry()->getNetworkEntry()->getNetworkParId();
     }
+    data_->setReducedVoltageLevels(jobEntry_->getModelerEntry()->getNetworkEntry()->getReducedVoltageLevels());
+    data_->setCollapsedVoltageLevels(jobEntry_->getModelerEntry()->getNetworkEntry()->getCollapsedVoltageLevels());
+    data_->setEliminateStarBuses(jobEntry_->getModelerEntry()->getNetworkEntry()->getEliminateStarBuses());
+    data_->setStudyVoltageLevels(jobEntry_->getModelerEntry()->getNetworkEntry()->getStudyVoltageLevels());
+    data_->setStudyAreaDepth(jobEntry_->getModelerEntry()->getNetworkEntry()->getStudyAreaDepth());
   }
 
   // the Network parameter file path is considered to be relative to the jobs file directory
@@ -676,8 +1797,7 @@ Simulation::setSolver() {
   string solverParFile = createAbsolutePath(jobEntry_->getSolverEntry()->getParametersFile(), context_->getInputDirectory());
   solver_ = SolverFactory::createSolverFromLib(jobEntry_->getSolverEntry()->getLib() + sharedLibraryExtension());
 
-  parameters::XmlImporter importer;
-  std::shared_ptr<ParametersSetCollection> parameters = importer.importFromFile(solverParFile);
+  std::shared_ptr<ParametersSetCollection> parameters = parameters::ParametersSetCollectionCache::instance().importFromFile(solverParFile);
   parameters->propagateOriginData(solverParFile);
   referenceParameters_[solverParFile] = parameters;
   string parId = jobEntry_->getSolverEntry()->getParametersId();
@@ -723,6 +1843,7 @@ Simulation::configureLogs() {
         app.setSeparator(appenderEntry->getSeparator());
         app.setShowTimeStamp(!appenderEntry->getTimeStampFormat().empty());
         app.setTimeStampFormat(appenderEntry->getTimeStampFormat());
+        app.setAsynchronous(appenderEntry->isAsynchronous());
         appenders.push_back(app);
       }
       Trace::clearAndAddAppenders(appenders);
@@ -794,6 +1915,7 @@ Simulation::initFromData(const shared_ptr<DataInterface>& data, const shared_ptr
 
   model_ = modeler->getModel();
   model_->setWorkingDirectory(context_->getWorkingDirectory());
+  model_->setLatencyPartitionEnabled(jobEntry_->getSimulationEntry()->getLatencyPartition());
   model_->setTimeline(timeline_);
 
   if (jobEntry_->getOutputsEntry() && jobEntry_->getOutputsEntry()->getConstraintsEntry() &&
@@ -803,8 +1925,7 @@ Simulation::initFromData(const shared_ptr<DataInterface>& data, const shared_ptr
   if (jobEntry_->getLocalInitEntry() != nullptr) {
     const std::string initParFile = createAbsolutePath(jobEntry_->getLocalInitEntry()->getParFile(), context_->getInputDirectory());
     const std::string parId = jobEntry_->getLocalInitEntry()->getParId();
-    parameters::XmlImporter parametersImporter;
-    std::shared_ptr<ParametersSetCollection> localInitSetCollection = parametersImporter.importFromFile(initParFile);
+    std::shared_ptr<ParametersSetCollection> localInitSetCollection = parameters::ParametersSetCollectionCache::instance().importFromFile(initParFile);
     std::shared_ptr<ParametersSet> localInitParameters = localInitSetCollection->getParametersSet(parId);
 
     model_->setLocalInitParameters(localInitParameters);
@@ -857,10 +1978,6 @@ Simulation::init() {
     model_->setGequationsModel();  ///< set formula for modelica models' root equations and Network models' equations
     model_->printEquations();
   }
-#ifdef _DEBUG_
-  model_->setFequationsModel();  ///< set formula for modelica models' equations and Network models' equations
-  model_->setGequationsModel();  ///< set formula for modelica models' root equations and Network models' equations
-#endif
 
   tCurrent_ = tStart_;
 
@@ -876,6 +1993,10 @@ Simulation::init() {
     t0 = loadState(initialStateFile_);  // loadState and return initial time
     Trace::info() << DYNLog(ModelInitialStateLoadEnd) << Trace::endline;
     Trace::info() << "-----------------------------------------------------------------------" << Trace::endline<< Trace::endline;
+  } else if (findInitialConditionsInCache()) {
+    // the local initializations are skipped, the global initialization checking the residuals of the cached values
+    t0 = loadState(initialConditionsCacheFile_);
+    initialConditionsFromCache_ = true;
   }
   // if no dump to load t0 should be equal to zero
   // if dump loaded, t0 should be equal to the current time loaded
@@ -890,7 +2011,15 @@ Simulation::init() {
   // like number of parameters, number of variables, type of models etc.,
   // therefore a calculateIC() is always necessary.
   zCurrent_.assign(model_->sizeZ(), 0.);
-  calculateIC();
+  try {
+    calculateIC();
+  } catch (const Error&) {
+    // an entry whose values do not satisfy the model any more is removed, so that the next job initializes again
+    if (initialConditionsFromCache_)
+      remove(initialConditionsCacheFile_);
+    throw;
+  }
+  storeInitialConditionsInCache();
 
   if (Trace::logExists(Trace::variables(), DEBUG)) {
     const bool withVariableType = true;  // We rewrite the file with types this time
@@ -913,16 +2042,24 @@ Simulation::init() {
       curve->setBuffer(&(y[curve->getGlobalIndex()]));
     }
   }
+  // the final state values are only read at the end of the simulation
+  curvesCollection_->setFinalStateValuesAtEnd(exportFinalStateValuesMode_ != EXPORT_FINAL_STATE_VALUES_NONE);
+  curvesCollection_->compileUpdatePlan();
   stringstream ss;
   ss << nbCurves;
   Trace::info() << DYNLog(CurveInitEnd, ss.str()) << Trace::endline;
   Trace::info() << "-----------------------------------------------------------------------" << Trace::endline<< Trace::endline;
 
   solver_->setTimeline(timeline_);
+  // the events of a time step are filtered as soon as the simulation leaves it
+  if (timeline_ && filterTimeline_)
+    timeline_->setOnlineFilter(DYN::IoDicos::instance().mergeOppositeEventsDicos());
   // no constraint registered during initialization
   if (jobEntry_->getOutputsEntry() && jobEntry_->getOutputsEntry()->getConstraintsEntry() &&
         jobEntry_->getOutputsEntry()->getConstraintsEntry()->getFilterType() == CONSTRAINTS_DYNAFLOW)
       model_->setConstraints(constraintsCollection_);
+  printMemoryUsage();
+  tNextMemoryReport_ = tCurrent_ + memoryReportInterval_;
 }
 
 void
@@ -994,10 +2131,13 @@ Simulation::simulate() {
   solver_->printSolve();
   if (exportCurvesMode_ != EXPORT_CURVES_NONE) {
     // This is a workaround to update the calculated variables with initial values of y and yp as they are not accessible at this level
-    model_->evalCalculatedVariables(tCurrent_, solver_->getCurrentY(), solver_->getCurrentYP(), zCurrent_);
+    model_->evalCalculatedVariablesForCurves(tCurrent_, solver_->getCurrentY(), solver_->getCurrentYP(), zCurrent_);
   }
   constexpr bool updateCalculatedVariable = false;
   updateCurves(updateCalculatedVariable);  // initial curves
+  openCurvesStream();
+  openTimelineStream();
+  openSolverStatisticsStream();
 
   bool criteriaChecked = true;
   try {
@@ -1022,12 +2162,20 @@ Simulation::simulate() {
     int currentIterNb = 0;
     double nextTimeStep = 0;
 
-    // Initialize simulation start time for accumulated timing (excluding initialization)
-    if (enableRealTimeTracking_) {
-      simulationStartTime_ = std::chrono::high_resolution_clock::now();
-    }
+    // Initialize simulation start time for accumulated timing and progress record (excluding initialization)
+    simulationStartTime_ = std::chrono::high_resolution_clock::now();
+
+    tSteadyStateStart_ = tCurrent_;
+    tPreviousStep_ = tCurrent_;
+    yPreviousStep_.clear();
+    steadyStateReached_ = false;
+    // the parareal algorithm simulates the whole time window, its processes being forked before the criteria thread is started
+    const std::shared_ptr<job::SimulationEntry> simulationEntry = jobEntry_->getSimulationEntry();
+    if (simulationEntry->getPararealSlices() > 0)
+      simulateParareal(simulationEntry->getPararealSlices(), simulationEntry->getPararealMaxIterations(), simulationEntry->getPararealTolerance());
+    startCriteriaWorker();
 
-    while (!end() && !SignalHandler::gotExitSignal() && criteriaChecked) {
+    while (!end() && !steadyStateReached_ && !SignalHandler::gotExitSignal() && criteriaChecked) {
       double elapsed = timer.elapsed();
       double timeout = jobEntry_->getSimulationEntry()->getTimeout();
       if (elapsed > timeout) {
@@ -1047,11 +2195,14 @@ Simulation::simulate() {
         printHighestDerivativesValues();
 
       BitMask solverState = solver_->getState();
+      const bool eventOccurred = !solverState.noFlagSet();
+      const modeChangeType_t modeChangeType = model_->getModeChangeType();
       bool modifZ = false;
       if (solverState.getFlags(ModeChange)) {
         updateCurves(true);
         model_->notifyTimeStep();
         Trace::info() << DYNLog(NewStartPoint) << Trace::endline;
+        ProfilerScope profilerScope(Profiler::MODE_CHANGE);
         solver_->reinit();
         model_->getCurrentZ(zCurrent_);
         solver_->printSolve();
@@ -1063,6 +2214,10 @@ Simulation::simulate() {
         model_->getCurrentZ(zCurrent_);
         modifZ = true;
       }
+      if (solverStatisticsStream_.is_open()) {
+        const std::chrono::duration<double> stepDuration = std::chrono::high_resolution_clock::now() - stepStartTime;
+        updateSolverStatistics(modeChangeType, stepDuration.count());
+      }
 
       if (isCheckCriteriaIter)
         model_->evalCalculatedVariables(tCurrent_, solver_->getCurrentY(), solver_->getCurrentYP(), zCurrent_);
@@ -1080,17 +2235,38 @@ Simulation::simulate() {
         updateCurves(!isCheckCriteriaIter && !modifZ);
       }
 
-      model_->checkDataCoherence(tCurrent_);
+      // the anomalies found by the data coherence checks are durable: checking them periodically, after each mode change
+      // and at the end of the simulation is enough to stop the simulation on them
+      if (solverState.getFlags(ModeChange) || end() || (coherenceCheckStep_ > 0 && currentIterNb % coherenceCheckStep_ == 0))
+        model_->checkDataCoherence(tCurrent_);
       model_->printMessages();
+      if (timelineStreamExporter_)
+        timelineStreamExporter_->update();
       if (!timetableOutputFile_.empty() && currentIterNb % timetableSteps_ == 0)
         printCurrentTime(timetableOutputFile_);
-
-      if (isCheckCriteriaIter) {
+      if (progressRecord_ && currentIterNb % timetableSteps_ == 0)
+        updateProgressRecord(currentIterNb);
+
+      if (criteriaWorker_) {
+        // the run is cancelled as soon as the check running in the background reports a failing criteria
+        const bool lagReached = isCheckCriteriaIter || currentIterNb - criteriaCheckIteration_ >= criteriaMaxLag_;
+        criteriaChecked = collectCriteriaCheck(lagReached);
+        if (criteriaChecked && isCheckCriteriaIter)
+          submitCriteriaCheck(currentIterNb);
+      } else if (isCheckCriteriaIter) {
         criteriaChecked = checkCriteria(tCurrent_, false);
       }
       ++currentIterNb;
 
       model_->notifyTimeStep();
+      printIntermediateReports();
+
+      if (steadyStateThreshold_ > 0. && isSteadyStateReached(eventOccurred)) {
+        steadyStateReached_ = true;
+        Trace::info() << DYNLog(SteadyStateReached, tCurrent_, steadyStateDuration_) << Trace::endline;
+        if (timeline_)
+          addEvent(DYNTimeline(SteadyStateReached, steadyStateDuration_));
+      }
 
       // End timing measurement and store data if enabled
       if (enableRealTimeTracking_) {
@@ -1105,6 +2281,8 @@ Simulation::simulate() {
         timingData_.emplace_back(tCurrent_, stepTimeMs, accumulatedTimeS);
       }
 
+      if (hasIntermediateStateToDump())
+        criteriaChecked &= collectCriteriaCheck(true);  // the dump updates the state variables read by the check
       if (hasIntermediateStateToDump() && !isCheckCriteriaIter) {
         // In case it was not already done beause of check criteria and intermediate state dump will be done at least one for current
         // iteration
@@ -1112,20 +2290,26 @@ Simulation::simulate() {
       }
       while (hasIntermediateStateToDump()) {
         const ExportStateDefinition& dumpDefinition = intermediateStates_.front();
+        // the previous dump reads the network written here
+        waitForIIDMDump();
         data_->exportStateVariables();
-        if (dumpDefinition.dumpFile_) {
-          dumpState(*dumpDefinition.dumpFile_);
-        }
         if (dumpDefinition.iidmFile_) {
-          dumpIIDMFile(*dumpDefinition.iidmFile_);
+          startIIDMDump(*dumpDefinition.iidmFile_);
+        }
+        if (dumpDefinition.dumpFile_) {
+          dumpState(*dumpDefinition.dumpFile_, dumpDefinition.dumpFormat_);
         }
         intermediateStates_.pop();
       }
     }
+    criteriaChecked &= collectCriteriaCheck(true);
 
     // If we haven't evaluated the calculated variables for the last iteration before, we must do it here if it might be used in the post process
-    if (finalState_.iidmFile_ || exportCurvesMode_ != EXPORT_CURVES_NONE || activateCriteria_)
+    // The curves only need the calculated variables they are plotting
+    if (finalState_.iidmFile_ || activateCriteria_)
       model_->evalCalculatedVariables(tCurrent_, solver_->getCurrentY(), solver_->getCurrentYP(), zCurrent_);
+    else if (exportCurvesMode_ != EXPORT_CURVES_NONE)
+      model_->evalCalculatedVariablesForCurves(tCurrent_, solver_->getCurrentY(), solver_->getCurrentYP(), zCurrent_);
 
     if (SignalHandler::gotExitSignal() && !end()) {
       if (timeline_) {
@@ -1137,7 +2321,7 @@ Simulation::simulate() {
         addEvent(DYNTimeline(CriteriaNotChecked));
       }
       throw DYNError(Error::SIMULATION, CriteriaNotChecked);
-    } else if (end() && data_ && activateCriteria_) {
+    } else if ((end() || steadyStateReached_) && data_ && activateCriteria_) {
       criteriaChecked = checkCriteria(tCurrent_, true);
       if (!criteriaChecked) {
         if (timeline_) {
@@ -1148,6 +2332,8 @@ Simulation::simulate() {
     }
     if (!timetableOutputFile_.empty())
         remove(timetableOutputFile_);
+    if (progressRecord_)
+      progressRecord_->remove();
   } catch (const Terminate& t) {
     Trace::warn() << t.what() << Trace::endline;
     model_->printMessages();
@@ -1178,12 +2364,45 @@ Simulation::hasIntermediateStateToDump() const {
         (doubleEquals(tCurrent_, intermediateStates_.front().timestamp_) || tCurrent_ > intermediateStates_.front().timestamp_);
 }
 
+bool
+Simulation::isSteadyStateReached(const bool eventOccurred) {
+  const vector<double>& y = solver_->getCurrentY();
+  const double h = tCurrent_ - tPreviousStep_;
+  bool steady = !eventOccurred && h > 0. && yPreviousStep_.size() == y.size();
+  for (size_t i = 0, iEnd = y.size(); steady && i < iEnd; ++i)
+    steady = std::abs(y[i] - yPreviousStep_[i]) <= steadyStateThreshold_ * h * std::max(std::abs(y[i]), 1.);
+  yPreviousStep_.assign(y.begin(), y.end());
+  tPreviousStep_ = tCurrent_;
+
+  if (!steady) {
+    tSteadyStateStart_ = tCurrent_;
+    return false;
+  }
+  if (tCurrent_ - tSteadyStateStart_ < steadyStateDuration_)
+    return false;
+  return !hasPendingEvent();
+}
+
+bool
+Simulation::hasPendingEvent() const {
+  // once steady, the roots may only change with time (timers, scheduled events)
+  vector<state_g> gCurrent(model_->sizeG(), ROOT_DOWN);
+  vector<state_g> gStop(model_->sizeG(), ROOT_DOWN);
+  model_->evalG(tCurrent_, gCurrent);
+  model_->evalG(tStop_, gStop);
+  return !std::equal(gCurrent.begin(), gCurrent.end(), gStop.begin());
+}
+
 void
 Simulation::endSimulationWithError(const bool criteria, const bool isSimulationDiverging) const {
   if (!timetableOutputFile_.empty())
     remove(timetableOutputFile_);
+  if (progressRecord_)
+    progressRecord_->remove();
+  // the check running in the background has to be over before the state variables are updated again
+  const bool backgroundCriteriaChecked = collectCriteriaCheck(true);
   if (criteria && data_ && activateCriteria_) {
-    const bool criteriaChecked = checkCriteria(tCurrent_, true);
+    const bool criteriaChecked = backgroundCriteriaChecked && checkCriteria(tCurrent_, true);
     if (!criteriaChecked) {
       if (timeline_) {
         addEvent(DYNTimeline(CriteriaNotChecked));
@@ -1200,6 +2419,7 @@ Simulation::checkCriteria(const double t, const bool finalStep) const {
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
   Timer timer("Simulation::checkCriteria()");
 #endif
+  ProfilerScope profilerScope(Profiler::CRITERIA);
   constexpr bool filterForCriteriaCheck = true;
   data_->updateFromModel(filterForCriteriaCheck);
   const bool criteriaChecked = data_->checkCriteria(t, finalStep);
@@ -1207,6 +2427,51 @@ Simulation::checkCriteria(const double t, const bool finalStep) const {
 }
 
 
+void
+Simulation::startCriteriaWorker() {
+  criteriaWorker_.reset();
+  if (!data_ || !activateCriteria_ || criteriaMaxLag_ == 0)
+    return;
+  const boost::shared_ptr<DataInterface> data = data_;
+  criteriaWorker_ = std::make_shared<BackgroundCheck>([data](double t) {
+    ProfilerScope profilerScope(Profiler::CRITERIA);
+    constexpr bool finalStep = false;
+    return data->checkCriteria(t, finalStep);
+  });
+}
+
+void
+Simulation::submitCriteriaCheck(const int iteration) {
+  constexpr bool filterForCriteriaCheck = true;
+  data_->updateFromModel(filterForCriteriaCheck);
+  // the timeline is used by the simulation thread in the meantime
+  data_->setTimeline(boost::shared_ptr<timeline::Timeline>());
+  criteriaCheckIteration_ = iteration;
+  criteriaWorker_->submit(tCurrent_);
+}
+
+bool
+Simulation::collectCriteriaCheck(const bool wait) const {
+  if (!criteriaWorker_ || !criteriaWorker_->isPending())
+    return true;
+  if (!wait && !criteriaWorker_->isDone())
+    return true;
+  const double t = criteriaWorker_->getTime();
+  bool criteriaChecked = true;
+  try {
+    criteriaChecked = criteriaWorker_->wait();
+  } catch (...) {
+    data_->setTimeline(timeline_);
+    throw;
+  }
+  data_->setTimeline(timeline_);
+  if (criteriaChecked)
+    return true;
+  // the logs and the timeline are only written by the simulation thread
+  constexpr bool finalStep = false;
+  return data_->checkCriteria(t, finalStep);
+}
+
 void
 Simulation::getFailingCriteria(std::vector<std::pair<double, std::string> >& failingCriteria) const {
   if (data_)
@@ -1239,13 +2504,68 @@ Simulation::updateCurves(const bool updateCalculatedVariable) const {
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
   Timer timer("Simulation::updateCurves()");
 #endif
-  if (exportCurvesMode_ == EXPORT_CURVES_NONE && exportFinalStateValuesMode_ == EXPORT_FINAL_STATE_VALUES_NONE)
+  ProfilerScope profilerScope(Profiler::CURVES);
+  if (exportCurvesMode_ == EXPORT_CURVES_NONE &&
+      (exportFinalStateValuesMode_ == EXPORT_FINAL_STATE_VALUES_NONE || curvesCollection_->getFinalStateValuesAtEnd()))
     return;
 
   if (updateCalculatedVariable)
     model_->updateCalculatedVarForCurves();
 
   curvesCollection_->updateCurves(tCurrent_);
+  if (curvesStreamExporter_ && outputsStreamed_)
+    curvesStreamExporter_->update();
+}
+
+void
+Simulation::updateFinalStateValues() const {
+  if (exportFinalStateValuesMode_ == EXPORT_FINAL_STATE_VALUES_NONE || !curvesCollection_->getFinalStateValuesAtEnd())
+    return;
+
+  model_->updateCalculatedVarForCurves();
+  // without curves export, the curves exported as both have not been updated during the simulation either
+  if (exportCurvesMode_ == EXPORT_CURVES_NONE)
+    curvesCollection_->updateCurves(tCurrent_);
+  curvesCollection_->updateFinalStateValues(tCurrent_);
+}
+
+void
+Simulation::openCurvesStream() {
+  if (curvesOutputFile_.empty() ||
+      (exportCurvesMode_ != EXPORT_CURVES_CSV_STREAM && exportCurvesMode_ != EXPORT_CURVES_BINARY_STREAM))
+    return;
+
+  // parameter values are constant: set them now as the points are written before the end of the simulation
+  updateParametersValues();
+  const curves::StreamExporter::Format_t format =
+      (exportCurvesMode_ == EXPORT_CURVES_CSV_STREAM) ? curves::StreamExporter::CSV : curves::StreamExporter::BINARY;
+  curvesStreamExporter_ = std::make_shared<curves::StreamExporter>(format, CURVES_STREAM_CHUNK_SIZE);
+  curvesStreamExporter_->open(curvesCollection_, curvesOutputFile_);
+}
+
+void
+Simulation::openTimelineStream() {
+  timeline::StreamExporter::Format_t format;
+  switch (exportTimelineMode_) {
+    case EXPORT_TIMELINE_TXT_STREAM:
+      format = timeline::StreamExporter::TXT;
+      break;
+    case EXPORT_TIMELINE_CSV_STREAM:
+      format = timeline::StreamExporter::CSV;
+      break;
+    case EXPORT_TIMELINE_XML_STREAM:
+      format = timeline::StreamExporter::XML;
+      break;
+    default:
+      return;
+  }
+  if (!timeline_ || timelineOutputFile_.empty())
+    return;
+
+  timelineStreamExporter_ = std::make_shared<timeline::StreamExporter>(format, TIMELINE_STREAM_CHUNK_SIZE);
+  timelineStreamExporter_->setExportWithTime(exportTimelineWithTime_);
+  timelineStreamExporter_->setMaxPriority(exportTimelineMaxPriority_);
+  timelineStreamExporter_->open(timeline_, timelineOutputFile_);
 }
 
 void
@@ -1258,7 +2578,7 @@ Simulation::printSolverHeader() const {
 
 void
 Simulation::addEvent(const MessageTimeline& messageTimeline) const {
-  if (timeline_) {
+  if (timeline_ && timeline_->acceptsEvent(messageTimeline.priority(), messageTimeline.getKey())) {
     const string name = "Simulation";
     timeline_->addEvent(getCurrentTime(), name, messageTimeline.str(), messageTimeline.priority(), messageTimeline.getKey());
   }
@@ -1285,6 +2605,66 @@ Simulation::printHighestDerivativesValues() const {
 void
 Simulation::printEnd() const {
   solver_->printEnd();
+  model_->printLatencyPartition();
+  model_->printSubModelCosts();
+  printProfilingStatistics();
+  printMemoryUsage();
+}
+
+void
+Simulation::printProfilingStatistics() const {
+  if (!Profiler::isEnabled())
+    return;
+  Trace::info() << DYNLog(ProfilerStatisticsHeader, Profiler::getSamplingPeriod()) << Trace::endline;
+  const bool hardwareCounters = Profiler::isHardwareCountersEnabled() && Profiler::areHardwareCountersAvailable();
+  if (Profiler::isHardwareCountersEnabled() && !hardwareCounters)
+    Trace::warn() << DYNLog(ProfilerCountersUnavailable) << Trace::endline;
+  for (const auto& statistics : Profiler::getStatistics()) {
+    const string parent = (statistics.parent == Profiler::NB_SCOPES) ? "-" : Profiler::getScopeName(statistics.parent);
+    Trace::info() << DYNLog(ProfilerStatistics, parent, Profiler::getScopeName(statistics.scope), statistics.nbCalls, statistics.time)
+                  << Trace::endline;
+    if (hardwareCounters) {
+      const std::uint64_t* counters = statistics.counters;
+      const double ipc = counters[Profiler::CYCLES] > 0 ? static_cast<double>(counters[Profiler::INSTRUCTIONS]) / counters[Profiler::CYCLES] : 0.;
+      Trace::info() << DYNLog(ProfilerHardwareCounters, counters[Profiler::CYCLES], counters[Profiler::INSTRUCTIONS], ipc,
+                              counters[Profiler::CACHE_MISSES], counters[Profiler::BRANCH_MISSES]) << Trace::endline;
+    }
+  }
+}
+
+void
+Simulation::printIntermediateReports() {
+  const bool reportRequested = SignalHandler::gotReportSignal();
+  if (reportRequested) {
+    model_->printSubModelCosts();
+    solver_->getConvergenceDiagnostics().dump(*model_, "request", false);
+  }
+  if (reportRequested || (memoryReportInterval_ > 0. && tCurrent_ >= tNextMemoryReport_)) {
+    printMemoryUsage();
+    while (memoryReportInterval_ > 0. && tNextMemoryReport_ <= tCurrent_)
+      tNextMemoryReport_ += memoryReportInterval_;
+  }
+}
+
+void
+Simulation::printMemoryUsage() const {
+  if (!memoryAccounting_)
+    return;
+  MemoryUsage usage;
+  model_->accountMemory(usage);
+  if (solver_)
+    solver_->accountMemory(usage);
+  usage.add(MemoryUsage::CURVES, curvesCollection_->getMemoryUsage());
+  if (timeline_)
+    usage.add(MemoryUsage::TIMELINE, timeline_->getMemoryUsage());
+  if (data_)
+    usage.add(MemoryUsage::DATA_INTERFACE, data_->getMemoryUsage());
+
+  Trace::info() << DYNLog(MemoryUsageHeader, tCurrent_, usage.getTotal()) << Trace::endline;
+  for (unsigned category = 0; category < MemoryUsage::NB_CATEGORIES; ++category) {
+    const MemoryUsage::Category cat = static_cast<MemoryUsage::Category>(category);
+    Trace::info() << DYNLog(MemoryUsageCategory, MemoryUsage::getCategoryName(cat), usage.get(cat)) << Trace::endline;
+  }
 }
 
 void
@@ -1294,72 +2674,110 @@ Simulation::setCriteriaStep(const int step) {
   criteriaStep_ = step;
 }
 
+void
+Simulation::setCriteriaMaxLag(const int maxLag) {
+  if (maxLag < 0)
+    throw DYNError(Error::API, CriteriaMaxLagError, maxLag);
+  criteriaMaxLag_ = maxLag;
+}
+
+void
+Simulation::setCoherenceCheckStep(const int step) {
+  if (step < 0)
+    throw DYNError(Error::API, CoherenceCheckStepError, step);
+  coherenceCheckStep_ = step;
+}
+
 void
 Simulation::terminate() {
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
   Timer timer("Simulation::terminate()");
 #endif
-  updateParametersValues();   // update parameter curves' value
-
-  if (!curvesOutputFile_.empty()) {
-    ofstream fileCurves;
-    openFileStream(fileCurves, curvesOutputFile_);
-    printCurves(fileCurves);
-    fileCurves.close();
-  }
+  {
+    ProfilerScope profilerScope(Profiler::OUTPUTS);
+    updateParametersValues();   // update parameter curves' value
+    updateFinalStateValues();
+
+    // the network is written once and for all before the other outputs, so that its dump overlaps with them
+    waitForIIDMDump();
+    if (data_ && (finalState_.iidmFile_ || isLostEquipmentsExported())) {
+  #if defined(_DEBUG_) || defined(PRINT_TIMERS)
+      Timer timer2("DataInterfaceIIDM::exportStateVariables");
+  #endif
+      data_->exportStateVariables();
+    }
+    if (finalState_.iidmFile_)
+      startIIDMDump(*finalState_.iidmFile_);
+
+    if (curvesStreamExporter_) {
+      curvesStreamExporter_->close();
+    } else if (!curvesOutputFile_.empty()) {
+      ofstream fileCurves;
+      openFileStream(fileCurves, curvesOutputFile_, (exportCurvesMode_ == EXPORT_CURVES_BINARY) ? ofstream::out | ofstream::binary : ofstream::out);
+      printCurves(fileCurves);
+      fileCurves.close();
+    }
 
-  if (!finalStateValuesOutputFile_.empty()) {
-    ofstream fileFinalStateValues;
-    openFileStream(fileFinalStateValues, finalStateValuesOutputFile_);
-    printFinalStateValues(fileFinalStateValues);
-    fileFinalStateValues.close();
-  }
+    if (!finalStateValuesOutputFile_.empty()) {
+      ofstream fileFinalStateValues;
+      openFileStream(fileFinalStateValues, finalStateValuesOutputFile_);
+      printFinalStateValues(fileFinalStateValues);
+      fileFinalStateValues.close();
+    }
 
-  if (!timelineOutputFile_.empty()) {
-    ofstream fileTimeline;
-    openFileStream(fileTimeline, timelineOutputFile_);
-    printTimeline(fileTimeline);
-    fileTimeline.close();
-  }
+    if (timelineStreamExporter_) {
+      // only the events of the last time step may still be filtered
+      if (filterTimeline_)
+        timeline_->filter(DYN::IoDicos::instance().mergeOppositeEventsDicos());
+      timelineStreamExporter_->close();
+    } else if (!timelineOutputFile_.empty()) {
+      ofstream fileTimeline;
+      openFileStream(fileTimeline, timelineOutputFile_);
+      printTimeline(fileTimeline);
+      fileTimeline.close();
+    }
 
-  if (!constraintsOutputFile_.empty()) {
-    ofstream fileConstraints;
-    openFileStream(fileConstraints, constraintsOutputFile_);
-    printConstraints(fileConstraints);
-    fileConstraints.close();
-  }
+    if (solverStatisticsStream_.is_open())
+      solverStatisticsStream_.close();
+    if (convergenceDiagnosticsStream_.is_open()) {
+      solver_->getConvergenceDiagnostics().enable(0, NULL);
+      convergenceDiagnosticsStream_.close();
+    }
 
-  if (dumpFinalValues_) {
-    string finalValuesDir = createAbsolutePath("finalValues", outputsDirectory_);
-    if (!exists(finalValuesDir))
-      createDirectory(finalValuesDir);
-    model_->printModelValues(finalValuesDir, "dumpFinalValues");
-  }
+    if (!constraintsOutputFile_.empty()) {
+      ofstream fileConstraints;
+      openFileStream(fileConstraints, constraintsOutputFile_);
+      printConstraints(fileConstraints);
+      fileConstraints.close();
+    }
 
-  if (data_ && (finalState_.iidmFile_ || isLostEquipmentsExported())) {
-#if defined(_DEBUG_) || defined(PRINT_TIMERS)
-    Timer timer2("DataInterfaceIIDM::exportStateVariables");
-#endif
-    data_->exportStateVariables();
-  }
+    if (dumpFinalValues_) {
+      string finalValuesDir = createAbsolutePath("finalValues", outputsDirectory_);
+      if (!exists(finalValuesDir))
+        createDirectory(finalValuesDir);
+      model_->printModelValues(finalValuesDir, "dumpFinalValues");
+    }
 
-  // Write real time tracking file if enabled
-  writeRealTimeTrackingFile();
+    // Write real time tracking file if enabled
+    writeRealTimeTrackingFile();
+    writeProfilingTraceFile();
 
-  if (data_ && isLostEquipmentsExported() && !lostEquipmentsOutputFile_.empty()) {
-    ofstream fileLostEquipments;
-    openFileStream(fileLostEquipments, lostEquipmentsOutputFile_);
-    printLostEquipments(fileLostEquipments);
-    fileLostEquipments.close();
-  }
+    if (data_ && isLostEquipmentsExported() && !lostEquipmentsOutputFile_.empty()) {
+      ofstream fileLostEquipments;
+      openFileStream(fileLostEquipments, lostEquipmentsOutputFile_);
+      printLostEquipments(fileLostEquipments);
+      fileLostEquipments.close();
+    }
 
-  if (finalState_.dumpFile_)
-    dumpState();
+    if (finalState_.dumpFile_)
+      dumpState();
 
-  if (finalState_.iidmFile_)
-    dumpIIDMFile();
+    waitForIIDMDump();
+  }
 
   printEnd();
+  // the logs queued by the asynchronous appenders are written even if the job fails afterwards
+  Trace::flush();
   if (wasLoggingEnabled_ && !Trace::isLoggingEnabled()) {
     // re-enable logging for upper project
     Trace::enableLogging();
@@ -1367,8 +2785,8 @@ Simulation::terminate() {
 }
 
 void
-Simulation::openFileStream(ofstream& stream, const std::string& path) const {
-  stream.open(path.c_str(), ofstream::out);
+Simulation::openFileStream(ofstream& stream, const std::string& path, const std::ios_base::openmode mode) const {
+  stream.open(path.c_str(), mode);
   if (!stream.is_open()) {
     throw DYNError(Error::SIMULATION, OpenFileFailed, path);
   }
@@ -1389,6 +2807,15 @@ Simulation::printCurves(std::ostream& stream) const {
       csvExporter.exportToStream(curvesCollection_, stream);
       break;
     }
+    case EXPORT_CURVES_BINARY: {
+      curves::BinaryExporter binaryExporter;
+      binaryExporter.exportToStream(curvesCollection_, stream);
+      break;
+    }
+    case EXPORT_CURVES_CSV_STREAM:
+    case EXPORT_CURVES_BINARY_STREAM:
+      // points are written to the output file during the simulation
+      break;
   }
 }
 
@@ -1405,11 +2832,10 @@ void Simulation::printFinalStateValues(std::ostream& stream) const {
         curve->getExportType() == curves::Curve::EXPORT_AS_FINAL_STATE_VALUE ||
         curve->getExportType() == curves::Curve::EXPORT_AS_BOTH;
       if (curve->getAvailable() && isFinalStateValue) {
-        const auto& lastPoint = curve->getPoints().back();
         std::unique_ptr<finalStateValues::FinalStateValue> finalStateValue = finalStateValues::FinalStateValueFactory::newFinalStateValue();
         finalStateValue->setModelName(curve->getModelName());
         finalStateValue->setVariable(curve->getVariable());
-        finalStateValue->setValue(lastPoint->getValue());
+        finalStateValue->setValue(curve->getLastValue());
         finalStateValuesCollection->add(std::move(finalStateValue));
       }
     }
@@ -1445,6 +2871,9 @@ Simulation::printTimeline(std::ostream& stream) const {
   }
   switch (exportTimelineMode_) {
     case EXPORT_TIMELINE_NONE:
+    case EXPORT_TIMELINE_TXT_STREAM:
+    case EXPORT_TIMELINE_CSV_STREAM:
+    case EXPORT_TIMELINE_XML_STREAM:
       break;
     case EXPORT_TIMELINE_CSV: {
       timeline::CsvExporter exporter;
@@ -1510,6 +2939,29 @@ Simulation::dumpIIDMFile(const boost::filesystem::path& iidmFile) const {
     data_->dumpToFile(iidmFile.generic_string());
 }
 
+void
+Simulation::startIIDMDump(const boost::filesystem::path& iidmFile) {
+  waitForIIDMDump();
+  if (!data_)
+    return;
+  // with variants, the working variant is selected per thread
+  if (data_->canUseVariant()) {
+    dumpIIDMFile(iidmFile);
+    return;
+  }
+  const boost::shared_ptr<DataInterface> data = data_;
+  const std::string iidmFilePath = iidmFile.generic_string();
+  pendingIIDMDump_ = std::async(std::launch::async, [data, iidmFilePath]() {
+    data->dumpToFile(iidmFilePath);
+  });
+}
+
+void
+Simulation::waitForIIDMDump() {
+  if (pendingIIDMDump_.valid())
+    pendingIIDMDump_.get();
+}
+
 void
 Simulation::dumpIIDMFile(std::stringstream& stream) const {
   if (data_ && finalState_.iidmFile_)
@@ -1525,11 +2977,11 @@ Simulation::dumpIIDMFile() {
 void
 Simulation::dumpState() {
   if (finalState_.dumpFile_)
-    dumpState(*finalState_.dumpFile_);
+    dumpState(*finalState_.dumpFile_, finalState_.dumpFormat_);
 }
 
 void
-Simulation::dumpState(const boost::filesystem::path& dumpFile) const {
+Simulation::dumpState(const boost::filesystem::path& dumpFile, const dumpFormat_t dumpFormat) {
   if (!model_) return;
   stringstream state;
   boost::archive::binary_oarchive os(state);
@@ -1538,12 +2990,30 @@ Simulation::dumpState(const boost::filesystem::path& dumpFile) const {
   os << solver_->getName();
   os << solver_->getTimeStep();
 
+  if (dumpFormat == DUMP_FORMAT_DELTA) {
+    dumpDeltaState(dumpFile, state.str());
+    return;
+  }
+  if (dumpFormat == DUMP_FORMAT_RAW) {
+    // entries are written as soon as they are built, one sub model at a time
+    StateDumpFile::Writer writer(dumpFile.generic_string());
+    writer.addEntry(TIME_FILENAME, state.str());
+    model_->dumpParametersAndVariables([&writer](const map<string, string>& entries) { writer.addEntries(entries); });
+    writer.close();
+    return;
+  }
+
   map<string, string> mapValues;  // map associating file name with parameters/variables to dump
   mapValues[TIME_FILENAME] = state.str();
 
   model_->dumpParameters(mapValues);
   model_->dumpVariables(mapValues);
 
+  if (dumpFormat == DUMP_FORMAT_COMPRESSED) {
+    CompressedStateDumpFile::write(dumpFile.generic_string(), mapValues, nbStateDumpThreads());
+    return;
+  }
+
   boost::shared_ptr<zip::ZipFile> archive = zip::ZipFileFactory::newInstance();
 
   for (const auto& mapValue : mapValues) {
@@ -1552,14 +3022,143 @@ Simulation::dumpState(const boost::filesystem::path& dumpFile) const {
   zip::ZipOutputStream::write(dumpFile.generic_string(), archive);
 }
 
+bool
+Simulation::findInitialConditionsInCache() {
+  initialConditionsCacheFile_.clear();
+  if (!hasEnvVar("DYNAWO_INITIAL_CONDITIONS_CACHE_DIR") || iidmFile_.empty())
+    return false;
+  const string cacheDirectory = getEnvVar("DYNAWO_INITIAL_CONDITIONS_CACHE_DIR");
+  if (!isDirectory(cacheDirectory))
+    createDirectory(cacheDirectory);
+
+  CompiledModelCache::KeyBuilder key;
+  key.add(DYNAWO_VERSION_STRING);
+  key.add(DYNAWO_GIT_HASH);
+  std::stringstream startTime;
+  startTime << std::setprecision(17) << tStart_;
+  key.add(startTime.str());
+  key.addFileContent(iidmFile_);
+  for (const auto& dydFile : dydFiles_)
+    key.addFileContent(dydFile);
+  // the parameters files are sorted, as they are not read in a stable order
+  vector<string> parFiles;
+  for (const auto& referenceParametersPair : dyd_->getParametersReference())
+    parFiles.push_back(referenceParametersPair.first);
+  std::sort(parFiles.begin(), parFiles.end());
+  for (const auto& parFile : parFiles) {
+    key.add(parFile);
+    key.addFileContent(parFile);
+  }
+  key.add(jobEntry_->getSolverEntry()->getLib());
+  key.add(jobEntry_->getSolverEntry()->getParametersId());
+  key.addFileContent(createAbsolutePath(jobEntry_->getSolverEntry()->getParametersFile(), context_->getInputDirectory()));
+  if (jobEntry_->getLocalInitEntry() != nullptr) {
+    key.add(jobEntry_->getLocalInitEntry()->getParId());
+    key.addFileContent(createAbsolutePath(jobEntry_->getLocalInitEntry()->getParFile(), context_->getInputDirectory()));
+  }
+
+  initialConditionsCacheFile_ = createAbsolutePath(key.getKey() + ".dmp", cacheDirectory);
+  if (!exists(initialConditionsCacheFile_))
+    return false;
+  Trace::info() << DYNLog(InitialConditionsCacheHit, key.getKey()) << Trace::endline;
+  return true;
+}
+
+void
+Simulation::storeInitialConditionsInCache() {
+  if (initialConditionsCacheFile_.empty() || initialConditionsFromCache_)
+    return;
+  const fs::path cacheFile(initialConditionsCacheFile_);
+  const fs::path temporaryFile = cacheFile.parent_path() / fs::unique_path("%%%%-%%%%-%%%%-%%%%.tmp");
+  boost::system::error_code error;
+  try {
+    dumpState(temporaryFile, DUMP_FORMAT_RAW);
+    fs::rename(temporaryFile, cacheFile, error);
+  } catch (const std::exception& e) {
+    error = boost::system::errc::make_error_code(boost::system::errc::io_error);
+    Trace::debug() << e.what() << Trace::endline;
+  }
+  if (error) {
+    boost::system::error_code ignored;
+    fs::remove(temporaryFile, ignored);
+    Trace::warn() << DYNLog(InitialConditionsCacheStoreFailed, cacheFile.parent_path().string(), error.message()) << Trace::endline;
+    return;
+  }
+  Trace::info() << DYNLog(InitialConditionsCacheStored, cacheFile.filename().string()) << Trace::endline;
+}
+
+void
+Simulation::dumpDeltaState(const boost::filesystem::path& dumpFile, const string& timeEntry) {
+  // a delta dump refers to the previous one by its name only, hence a keyframe when the directory changes
+  const bool keyframe = lastDumpEntries_.empty() || nbDeltaDumpsSinceKeyframe_ >= deltaDumpKeyframePeriod_
+      || dumpFile.parent_path() != lastDumpFile_.parent_path();
+
+  StateDumpFile::Writer writer(dumpFile.generic_string());
+  writer.addEntry(TIME_FILENAME, timeEntry);
+  if (!keyframe)
+    writer.addEntry(PREVIOUS_DUMP_FILENAME, lastDumpFile_.filename().generic_string());
+
+  string delta;
+  model_->dumpParametersAndVariables([this, keyframe, &writer, &delta](const map<string, string>& entries) {
+    for (const auto& entry : entries) {
+      string& previous = lastDumpEntries_[entry.first];
+      if (keyframe)
+        writer.addEntry(entry.first, entry.second);
+      else if (StateDumpDelta::encode(previous, entry.second, delta))
+        writer.addEntry(entry.first, delta);
+      previous = entry.second;
+    }
+  });
+  writer.close();
+
+  lastDumpFile_ = dumpFile;
+  nbDeltaDumpsSinceKeyframe_ = keyframe ? 0 : nbDeltaDumpsSinceKeyframe_ + 1;
+}
+
+void
+Simulation::snapshotState(StateBuffer& snapshot) const {
+#if defined(_DEBUG_) || defined(PRINT_TIMERS)
+  Timer timer("Simulation::snapshotState()");
+#endif
+  snapshot.clear();
+  if (!model_) return;
+  snapshot.write(tCurrent_);
+  snapshot.write(zCurrent_);
+  model_->snapshotState(snapshot);
+  solver_->snapshotState(snapshot);
+}
+
+void
+Simulation::restoreState(const StateBuffer& snapshot) {
+#if defined(_DEBUG_) || defined(PRINT_TIMERS)
+  Timer timer("Simulation::restoreState()");
+#endif
+  if (!model_) return;
+  StateBuffer::Reader reader(snapshot);
+  reader.read(tCurrent_);
+  reader.read(zCurrent_);
+  // the model is restored first, as the solver may reinitialize itself from its variables
+  model_->restoreState(reader);
+  solver_->restoreState(reader);
+  if (!reader.atEnd())
+    throw DYNError(Error::GENERAL, DumpStateError);
+}
+
 double
 Simulation::loadState(const string& fileName) {
-  boost::shared_ptr<zip::ZipFile> archive = zip::ZipInputStream::read(fileName);
   map<string, string> mapValues;  // map associating file name with parameters/variables to dumpe
-  for (const auto& entryPair : archive->getEntries()) {
-    string name = entryPair.first;
-    string data(entryPair.second->getData());
-    mapValues[name] = data;
+  if (StateDumpFile::isStateDumpFile(fileName)) {
+    std::set<string> filesRead;
+    readStateDumpFile(fileName, mapValues, filesRead);
+  } else if (CompressedStateDumpFile::isCompressedStateDumpFile(fileName)) {
+    CompressedStateDumpFile::read(fileName, mapValues, nbStateDumpThreads());
+  } else {
+    boost::shared_ptr<zip::ZipFile> archive = zip::ZipInputStream::read(fileName);
+    for (const auto& entryPair : archive->getEntries()) {
+      string name = entryPair.first;
+      string data(entryPair.second->getData());
+      mapValues[name] = data;
+    }
   }
 
   auto iter = mapValues.find(TIME_FILENAME);
@@ -1591,6 +3190,40 @@ Simulation::loadState(const string& fileName) {
   return tCurrent_;
 }
 
+void
+Simulation::openSolverStatisticsStream() {
+  if (solverStatisticsOutputFile_.empty())
+    return;
+  openFileStream(solverStatisticsStream_, solverStatisticsOutputFile_);
+  solverStatisticsStream_ << "time;stepSize;newtonIterations;residualEvaluations;jacobianEvaluations;errorTestFailures;convergenceFailures;"
+                          << "rootFunctionEvaluations;rootFound;rootChanges;modeChange;wallTime" << std::endl;
+  solverStatisticsStream_ << std::setprecision(10);
+  solver_->getStatistics(lastSolverStatistics_);
+
+  if (convergenceDiagnosticsOutputFile_.empty())
+    return;
+  openFileStream(convergenceDiagnosticsStream_, convergenceDiagnosticsOutputFile_);
+  convergenceDiagnosticsStream_ << std::setprecision(10);
+  solver_->getConvergenceDiagnostics().enable(convergenceDiagnosticsDepth_, &convergenceDiagnosticsStream_);
+}
+
+void
+Simulation::updateSolverStatistics(const modeChangeType_t modeChangeType, const double wallTime) {
+  stat_t statistics;
+  solver_->getStatistics(statistics);
+  // a discrete variable evaluation is only triggered by a root of the time step
+  const bool rootFound = statistics.nze_ > lastSolverStatistics_.nze_;
+  solverStatisticsStream_ << tCurrent_ << ";" << solver_->getTimeStep() << ";"
+                          << statistics.nni_ - lastSolverStatistics_.nni_ << ";"
+                          << statistics.nre_ - lastSolverStatistics_.nre_ << ";"
+                          << statistics.nje_ - lastSolverStatistics_.nje_ << ";"
+                          << statistics.netf_ - lastSolverStatistics_.netf_ << ";"
+                          << statistics.ncfn_ - lastSolverStatistics_.ncfn_ << ";"
+                          << statistics.nge_ - lastSolverStatistics_.nge_ << ";"
+                          << rootFound << ";" << statistics.nrc_ - lastSolverStatistics_.nrc_ << ";" << modeChangeType << ";" << wallTime << "\n";
+  lastSolverStatistics_ = statistics;
+}
+
 void
 Simulation::printCurrentTime(const string& fileName) const {
   ofstream out(fileName.c_str());
@@ -1599,6 +3232,24 @@ Simulation::printCurrentTime(const string& fileName) const {
   fs::permissions(fileName, fs::group_read | fs::group_write | fs::owner_write | fs::others_write | fs::owner_read | fs::others_read);
 }
 
+void
+Simulation::updateProgressRecord(const int iteration) const {
+  stat_t statistics;
+  solver_->getStatistics(statistics);
+  ProgressRecord::Progress progress;
+  progress.time = tCurrent_;
+  progress.stopTime = tStop_;
+  progress.wallTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - simulationStartTime_).count();
+  progress.iteration = static_cast<std::uint64_t>(iteration);
+  progress.nbSteps = static_cast<std::uint64_t>(statistics.nst_);
+  progress.nbResidualEvaluations = static_cast<std::uint64_t>(statistics.nre_);
+  progress.nbNonLinearIterations = static_cast<std::uint64_t>(statistics.nni_);
+  progress.nbErrorTestFailures = static_cast<std::uint64_t>(statistics.netf_);
+  progress.nbConvergenceFailures = static_cast<std::uint64_t>(statistics.ncfn_);
+  progress.nbRootEvaluations = static_cast<std::uint64_t>(statistics.nge_);
+  progressRecord_->update(progress);
+}
+
 void
 Simulation::writeRealTimeTrackingFile() const {
   // Early return if timing disabled or no data collected
@@ -1631,12 +3282,26 @@ Simulation::writeRealTimeTrackingFile() const {
   fs::permissions(realTimeTrackingFile_, fs::group_read | fs::group_write | fs::owner_write | fs::others_write | fs::owner_read | fs::others_read);
 }
 
+void
+Simulation::writeProfilingTraceFile() const {
+  if (!Profiler::isTraceEnabled())
+    return;
+
+  const string traceFile = createAbsolutePath("profilingTrace.json", outputsDirectory_);
+  ofstream out;
+  openFileStream(out, traceFile);
+  Profiler::exportTrace(out);
+  out.close();
+}
+
 Simulation::ExportStateDefinition::ExportStateDefinition(const double timestamp,
       boost::optional<boost::filesystem::path> dumpFile,
-      boost::optional<boost::filesystem::path> iidmFile):
+      boost::optional<boost::filesystem::path> iidmFile,
+      const dumpFormat_t dumpFormat):
   timestamp_(timestamp),
   dumpFile_(std::move(dumpFile)),
-  iidmFile_(std::move(iidmFile)) {
+  iidmFile_(std::move(iidmFile)),
+  dumpFormat_(dumpFormat) {
 }
 
 }  // end of namespace DYN
@@ -20,12 +20,17 @@
 #ifndef SIMULATION_DYNSIMULATION_H_
 #define SIMULATION_DYNSIMULATION_H_
 
+#include <fstream>
 #include <vector>
+#include <map>
+#include <string>
 #include <queue>
 #include <unordered_map>
 #include <memory>
 #include <chrono>
 #include <tuple>
+#include <future>
+#include <functional>
 #include <boost/shared_ptr.hpp>
 #include <boost/optional.hpp>
 #include <boost/filesystem.hpp>
@@ -38,14 +43,18 @@
 #include "PARParametersSetCollection.h"
 #include "DYNDataInterface.h"
 #include "DYNSolverFactory.h"
+#include "DYNSolver.h"
 #include "DYNModeler.h"
+#include "DYNStateBuffer.h"
 
 namespace timeline {
 class Timeline;
+class StreamExporter;
 }
 
 namespace curves {
 class CurvesCollection;
+class StreamExporter;
 }
 
 namespace constraints {
@@ -61,9 +70,11 @@ class CriteriaCollection;
 }
 
 namespace DYN {
+class BackgroundCheck;
 class Message;
 class MessageTimeline;
 class Model;
+class ProgressRecord;
 class Solver;
 class DynamicData;
 class DataInterface;
@@ -85,7 +96,10 @@ class Simulation {
   typedef enum {
     EXPORT_CURVES_NONE,  ///< Export zero curves
     EXPORT_CURVES_XML,  ///< Export curves selected in input file in XML mode in output file
-    EXPORT_CURVES_CSV  ///< Export curves selected in input file in CSV mode in output file
+    EXPORT_CURVES_CSV,  ///< Export curves selected in input file in CSV mode in output file
+    EXPORT_CURVES_BINARY,  ///< Export curves selected in input file in binary columnar mode in output file
+    EXPORT_CURVES_CSV_STREAM,  ///< Stream curves selected in input file in CSV mode in output file during the simulation
+    EXPORT_CURVES_BINARY_STREAM  ///< Stream curves selected in input file in binary mode in output file during the simulation
   } exportCurvesMode_t;
 
   /**
@@ -107,7 +121,10 @@ class Simulation {
     EXPORT_TIMELINE_NONE,  ///< No export timeline
     EXPORT_TIMELINE_TXT,  ///< Export timeline in txt mode in output file
     EXPORT_TIMELINE_CSV,  ///< Export timeline in csv mode in output file
-    EXPORT_TIMELINE_XML  ///< Export timeline in xml mode in output file
+    EXPORT_TIMELINE_XML,  ///< Export timeline in xml mode in output file
+    EXPORT_TIMELINE_TXT_STREAM,  ///< Stream timeline in txt mode in output file during the simulation
+    EXPORT_TIMELINE_CSV_STREAM,  ///< Stream timeline in csv mode in output file during the simulation
+    EXPORT_TIMELINE_XML_STREAM  ///< Stream timeline in xml mode in output file during the simulation
   } exportTimelineMode_t;
 
   /**
@@ -129,6 +146,16 @@ class Simulation {
     EXPORT_LOSTEQUIPMENTS_XML  ///< Export lost equipments found in XML mode in output file
   } exportLostEquipmentsMode_t;
 
+  /**
+   * @brief Format of the dump state files
+   */
+  typedef enum {
+    DUMP_FORMAT_ZIP,  ///< Zip archive, built in memory before being written
+    DUMP_FORMAT_RAW,  ///< Uncompressed file streamed entry by entry, see StateDumpFile
+    DUMP_FORMAT_DELTA,  ///< Uncompressed file holding only what changed since the previous delta dump, with periodic full keyframes
+    DUMP_FORMAT_COMPRESSED  ///< File made of blocks compressed and decompressed in parallel, see CompressedStateDumpFile
+  } dumpFormat_t;
+
   /**
    * @brief definition of dump to export
    *
@@ -140,14 +167,111 @@ class Simulation {
      * @param timestamp Timestamp of the export
      * @param dumpFile Path of the dump
      * @param iidmFile Path of the IIDM
+     * @param dumpFormat Format of the dump
      */
     explicit ExportStateDefinition(double timestamp,
       boost::optional<boost::filesystem::path> dumpFile = boost::none,
-      boost::optional<boost::filesystem::path> iidmFile = boost::none);
+      boost::optional<boost::filesystem::path> iidmFile = boost::none,
+      dumpFormat_t dumpFormat = DUMP_FORMAT_ZIP);
 
     double timestamp_;                                   ///< Timestamp of the export (can be max for final state)
     boost::optional<boost::filesystem::path> dumpFile_;  ///< Path of the dump state file, if requested
     boost::optional<boost::filesystem::path> iidmFile_;  ///< Path of the IIDM export file, if requested
+    dumpFormat_t dumpFormat_;                            ///< Format of the dump state file
+  };
+
+  /**
+   * @brief contingency simulated from the initialized state of the simulation
+   *
+   * The contingency is described by actions with the syntax of the interactive mode: "model,parameter,value[,parameter,value...]".
+   * They are applied at the start of the simulation, for instance to set the time of the events of the contingency.
+   */
+  struct Contingency {
+    std::string id_;  ///< id of the contingency, used to name its outputs directory
+    std::vector<std::string> actions_;  ///< actions to apply before simulating
+  };
+
+  /**
+   * @brief function simulating a contingency in the process forked for it
+   *
+   * Its arguments are the contingency, its outputs directory and the message of the error that stopped it, to fill.
+   * It returns the exit code of the process, 0 if the contingency succeeded.
+   */
+  typedef std::function<int(const Contingency&, const std::string&, std::string&)> ContingencyRunner;
+
+  /**
+   * @class PararealPropagator
+   * @brief system propagated through the time slices of the parareal algorithm (see runParareal)
+   */
+  class PararealPropagator {
+   public:
+    /**
+     * @brief destructor
+     */
+    virtual ~PararealPropagator() = default;
+
+    /**
+     * @brief capture the current state of the system
+     *
+     * @param state buffer where the state is written
+     */
+    virtual void snapshotState(StateBuffer& state) const = 0;
+
+    /**
+     * @brief restore a state captured by snapshotState, in this process or in a process forked from it
+     *
+     * @param state buffer holding the state
+     */
+    virtual void restoreState(const StateBuffer& state) = 0;
+
+    /**
+     * @brief propagate the current state up to the end of a time slice
+     *
+     * @param tEnd end of the time slice
+     * @param coarse @b true for the coarse propagator, @b false for the fine one
+     */
+    virtual void propagate(double tEnd, bool coarse) = 0;
+
+    /**
+     * @brief get the current values of the continuous variables
+     *
+     * @return the values of the continuous variables
+     */
+    virtual const std::vector<double>& getCurrentY() const = 0;
+
+    /**
+     * @brief get the current values of the derivatives of the continuous variables
+     *
+     * @return the values of the derivatives
+     */
+    virtual const std::vector<double>& getCurrentYP() const = 0;
+
+    /**
+     * @brief replace the continuous variables and their derivatives of the current state
+     *
+     * @param y new values of the continuous variables
+     * @param yp new values of the derivatives
+     */
+    virtual void setContinuousVariables(const std::vector<double>& y, const std::vector<double>& yp) = 0;
+
+    /**
+     * @brief drop the outputs recorded so far, in a process forked for a fine propagation, so that only the ones of this propagation are kept
+     */
+    virtual void startOutputsRecording() = 0;
+
+    /**
+     * @brief capture the outputs recorded since startOutputsRecording
+     *
+     * @param outputs buffer where the outputs are written
+     */
+    virtual void snapshotOutputs(StateBuffer& outputs) const = 0;
+
+    /**
+     * @brief append outputs captured by snapshotOutputs in a forked process to the outputs of the system
+     *
+     * @param outputs buffer holding the outputs
+     */
+    virtual void appendOutputs(const StateBuffer& outputs) = 0;
   };
 
  public:
@@ -194,6 +318,118 @@ class Simulation {
    */
   virtual void simulate();
 
+  /**
+   * @brief simulate a batch of contingencies from the initialized state of the simulation
+   *
+   * The simulation must have been initialized (see init) but not simulated. Each contingency runs in a process forked from the
+   * current one, so that the models, the initial conditions and the solver state are shared copy-on-write and not computed again.
+   * The outputs of each contingency are written in the directory contingencies/<id> of the outputs directory, with its status in
+   * contingencyStatus.csv. A failing contingency does not stop the other ones.
+   *
+   * The contingencies are launched by decreasing run time, as observed by the previous batches on the same outputs directory
+   * (contingencyRunTimes.csv), the ones never simulated first. Once the batch is over, the status of all the contingencies is
+   * gathered in contingencies/summary.csv.
+   *
+   * In shared mode, several processes, possibly on several hosts, may run the same batch on the same outputs directory: each
+   * contingency is claimed by creating its outputs directory and the contingencies claimed by another process are skipped, so that
+   * the processes that are the fastest take more contingencies.
+   *
+   * @param contingencies contingencies to simulate
+   * @param nbParallelContingencies maximum number of contingencies simulated at the same time
+   * @param shared @b true if the contingencies directory is shared with other processes running the same batch
+   *
+   * @throw DYNError if a contingency simulated by this process failed, once all of them are simulated
+   */
+  void simulateContingencies(const std::vector<Contingency>& contingencies, unsigned nbParallelContingencies, bool shared = false);
+
+  /**
+   * @brief run a batch of contingencies, each one in a process forked from the current one
+   *
+   * This is the scheduling of simulateContingencies, independent of the simulation: the outputs of each contingency are in the
+   * directory contingencies/<id> of the outputs directory, with its status, and the summary of the batch in contingencies/summary.csv.
+   *
+   * @param contingencies contingencies to run
+   * @param nbParallelContingencies maximum number of contingencies run at the same time
+   * @param shared @b true if the contingencies directory is shared with other processes running the same batch
+   * @param outputsDirectory outputs directory of the batch
+   * @param runContingency function running a contingency in its forked process
+   *
+   * @throw DYNError if a contingency run by this process failed, once all of them are run
+   */
+  static void runContingencies(const std::vector<Contingency>& contingencies, unsigned nbParallelContingencies, bool shared,
+      const std::string& outputsDirectory, const ContingencyRunner& runContingency);
+
+  /**
+   * @brief simulate the time window of the job with the parareal algorithm, from the current state
+   *
+   * The time window is cut into slices of the same length. The coarse propagator, the solver with its cheaper settings (see
+   * Solver::setDegradedMode), runs through the slices sequentially, then at each iteration the fine propagator, the solver with its
+   * nominal settings, simulates all the slices concurrently in forked processes from the start states of the previous iteration.
+   * The end state of each slice is the one of the fine propagation, with its continuous variables corrected by the difference
+   * between the coarse propagations from the new and from the previous start state. The iterations stop once the largest relative
+   * correction of the continuous variables is below the tolerance, or once each slice was simulated by the fine propagator from an
+   * exact start state.
+   *
+   * The simulation is left at the end of the time window. The curves and the timeline are those recorded by the last fine propagation
+   * of each slice, appended in the order of the slices.
+   *
+   * @param nbSlices number of time slices, which is also the number of processes of the fine propagation
+   * @param maxIterations maximum number of iterations
+   * @param tolerance largest relative change of the continuous variables at the end of the slices for the iterations to stop
+   *
+   * @throw DYNError if the solver has no cheaper settings or if the fine propagation of a slice failed
+   */
+  void simulateParareal(unsigned nbSlices, unsigned maxIterations, double tolerance);
+
+  /**
+   * @brief run the parareal algorithm on a system, the fine propagations being done in processes forked from the current one
+   *
+   * This is the iteration of simulateParareal, independent of the simulation. The system is left in the final state, with the outputs
+   * of the last fine propagation of each slice appended.
+   *
+   * @param tStart start of the time window, time of the current state of the system
+   * @param tStop end of the time window
+   * @param nbSlices number of time slices, which is also the number of processes of the fine propagation
+   * @param maxIterations maximum number of iterations
+   * @param tolerance largest relative change of the continuous variables at the end of the slices for the iterations to stop
+   * @param propagator system to propagate
+   *
+   * @return @b true if the iterations stopped on the tolerance or on exact start states, @b false if maxIterations was reached before
+   *
+   * @throw DYNError if the fine propagation of a slice failed
+   */
+  static bool runParareal(double tStart, double tStop, unsigned nbSlices, unsigned maxIterations, double tolerance,
+      PararealPropagator& propagator);
+
+  /**
+   * @brief integrate the model up to a time in the current process, recording the curves and the timeline as simulate does
+   *
+   * The simulation can be driven step by step this way, the outputs being written by terminate at the end.
+   *
+   * @param tAim time to reach, bounded by the stop time of the simulation
+   */
+  void advance(double tAim);
+
+  /**
+   * @brief apply actions to the model at the current time, as in the interactive mode
+   *
+   * @param actions actions with the syntax "model,parameter,value[,parameter,value...]"
+   *
+   * @throw DYNError if the model does not support actions or if an action is invalid
+   */
+  void applyActions(const std::vector<std::string>& actions);
+
+  /**
+   * @brief get the current value of a parameter of a sub model
+   *
+   * @param modelName name of the sub model
+   * @param parameterName name of the parameter
+   * @param value value of the parameter, to fill
+   *
+   * @return @b true if the parameter was found
+   */
+  bool getParameterValue(const std::string& modelName, const std::string& parameterName, std::string& value) const;
+
   /**
    * @brief destroy all allocated objected during the simulation
    */
@@ -216,6 +452,21 @@ class Simulation {
    */
   void printEnd() const;
 
+  /**
+   * @brief print the statistics of the profiler, if it is enabled
+   */
+  void printProfilingStatistics() const;
+
+  /**
+   * @brief print the memory allocated by the main structures of the simulation, by category, if it is enabled
+   */
+  void printMemoryUsage() const;
+
+  /**
+   * @brief print the reports requested by the SIGUSR1 signal and the intermediate memory reports that are due
+   */
+  void printIntermediateReports();
+
   /**
    * @brief load a previous state
    * @param fileName name of file where the dump is stored
@@ -236,8 +487,29 @@ class Simulation {
   /**
    * @brief store a simulation state in a file
    * @param dumpFile the dump file to export to
+   * @param dumpFormat format of the dump file
+   */
+  void dumpState(const boost::filesystem::path& dumpFile, dumpFormat_t dumpFormat = DUMP_FORMAT_ZIP);
+
+  /**
+   * @brief capture the current state of the simulation in memory, without any file
+   *
+   * The snapshot holds the variables of the model, the state of its sub models (internal variables, delays) and the
+   * state of the solver, in raw binary. The outputs (curves, timeline, constraints) are not part of it.
+   *
+   * @param snapshot buffer where the state is written, its previous content being discarded
    */
-  void dumpState(const boost::filesystem::path& dumpFile) const;
+  void snapshotState(StateBuffer& snapshot) const;
+
+  /**
+   * @brief restore a state captured by snapshotState on this simulation, to roll back or to branch from it
+   *
+   * The same snapshot can be restored several times.
+   *
+   * @param snapshot buffer holding the state
+   * @throw DumpStateError error if the snapshot was not taken on this simulation
+   */
+  void restoreState(const StateBuffer& snapshot);
 
   /**
    * @brief dump the final state of the network in a IIDM file
@@ -464,6 +736,18 @@ class Simulation {
    */
   void setCriteriaStep(int step);
 
+  /**
+   * @brief setter for the maximum lag of the criteria checks
+   * @param maxLag maximum number of iterations the simulation can run ahead of a criteria check, 0 to check them synchronously
+   */
+  void setCriteriaMaxLag(int maxLag);
+
+  /**
+   * @brief setter for the data coherence check step
+   * @param step number of iterations between 2 data coherence checks, 0 to check only after the mode changes
+   */
+  void setCoherenceCheckStep(int step);
+
   /**
    * @brief getter for the start time of the simulation
    * @return the start time of the simulation
@@ -480,6 +764,14 @@ class Simulation {
     return tCurrent_;
   }
 
+  /**
+   * @brief setter for the number of delta dumps written between two full keyframes
+   * @param period number of delta dumps between two keyframes, 0 to write only keyframes
+   */
+  inline void setDeltaDumpKeyframePeriod(const unsigned int period) {
+    deltaDumpKeyframePeriod_ = period;
+  }
+
   /**
    * @brief setter for the final state dump output file
    * @param file final state dump output file
@@ -584,13 +876,50 @@ class Simulation {
     return model_;
   }
 
+  /**
+   * @brief get the current values of the continuous variables
+   *
+   * @return continuous variables of the solver, valid until the next call to the solver
+   */
+  const std::vector<double>& getCurrentY() const {
+    return solver_->getCurrentY();
+  }
+
+  /**
+   * @brief get the current values of the derivatives of the continuous variables
+   *
+   * @return derivatives of the continuous variables of the solver, valid until the next call to the solver
+   */
+  const std::vector<double>& getCurrentYP() const {
+    return solver_->getCurrentYP();
+  }
+
+  /**
+   * @brief get the curves recorded so far
+   *
+   * @return curves collection of the simulation
+   */
+  const std::shared_ptr<curves::CurvesCollection>& getCurvesCollection() const {
+    return curvesCollection_;
+  }
+
+  /**
+   * @brief get the timeline recorded so far
+   *
+   * @return timeline of the simulation, null if the timeline is not exported
+   */
+  const boost::shared_ptr<timeline::Timeline>& getTimeline() const {
+    return timeline_;
+  }
+
  protected:
   /**
    * @brief open a file stream
    * @param stream file stream stream to open
    * @param path path of the file
+   * @param mode opening mode of the file
    */
-  void openFileStream(std::ofstream& stream, const std::string& path) const;
+  void openFileStream(std::ofstream& stream, const std::string& path, std::ios_base::openmode mode = std::ios_base::out) const;
 
   /**
    * @brief check if criteria are fullfilled
@@ -601,6 +930,74 @@ class Simulation {
    */
   bool checkCriteria(double t, bool finalStep) const;
 
+  /**
+   * @brief start dumping the network in a IIDM file
+   *
+   * The dump runs on a background thread when the network is not accessed through variants, the state variables
+   * being already exported in the network: the network must not be modified until waitForIIDMDump is called.
+   *
+   * @param iidmFile the iidm to export to
+   */
+  void startIIDMDump(const boost::filesystem::path& iidmFile);
+
+  /**
+   * @brief wait for the end of the IIDM dump started by startIIDMDump, if any, and rethrow its error
+   */
+  void waitForIIDMDump();
+
+  /**
+   * @brief start the worker checking the criteria in the background, if a maximum lag is set
+   */
+  void startCriteriaWorker();
+
+  /**
+   * @brief update the state variables needed for criteria check and submit their check to the worker
+   *
+   * @param iteration current iteration of the simulation
+   */
+  void submitCriteriaCheck(int iteration);
+
+  /**
+   * @brief collect the result of the criteria check running in the background
+   *
+   * If the check failed, it is run again on the simulation thread to report the failing criteria
+   * in the logs and in the timeline. The state variables were not updated since the check was submitted.
+   *
+   * @param wait @b true to wait for the check to be over, @b false to only collect it if it is already over
+   * @return @b false if the check running in the background found a failing criteria
+   */
+  bool collectCriteriaCheck(bool wait) const;
+
+  /**
+   * @brief store a simulation state in a file holding only the entries changed since the previous delta dump
+   *
+   * The first delta dump, every deltaDumpKeyframePeriod_ delta dumps and the first dump in a new directory are full
+   * keyframes. The other ones refer to the previous dump, that must stay in the same directory to be loaded.
+   *
+   * @param dumpFile the dump file to export to
+   * @param timeEntry content of the entry holding the time of the dump
+   */
+  void dumpDeltaState(const boost::filesystem::path& dumpFile, const std::string& timeEntry);
+
+  /**
+   * @brief find the entry of the simulation in the initial conditions cache, if the cache is used
+   *
+   * The cache is used if the environment variable DYNAWO_INITIAL_CONDITIONS_CACHE_DIR gives its directory, the network
+   * being read from an IIDM file and no initial state file being given. The key of an entry is built from the content of
+   * the IIDM, DYD, PAR and solver parameters files, from the start time and from the version of Dynawo.
+   *
+   * @return @b true if the initial conditions of the simulation are in the cache
+   */
+  bool findInitialConditionsInCache();
+
+  /**
+   * @brief store the initial conditions calculated in the cache, if the cache is used and they were not loaded from it
+   *
+   * The state is first dumped to a temporary file and then renamed, so that a job cannot read an entry while another one
+   * is still writing it. A failure is traced but not thrown.
+   */
+  void storeInitialConditionsInCache();
+
   /**
    * @brief configure and create all appenders of the simulation
    */
@@ -648,12 +1045,49 @@ class Simulation {
    */
   virtual void updateCurves(bool updateCalculatedVariable = true) const;
 
+  /**
+   * @brief set the value of the final state values at the end of the simulation
+   *
+   * The curves exported only as final state values are not updated at each time step but only once here, along with the
+   * curves exported as both when the curves are not exported.
+   */
+  void updateFinalStateValues() const;
+
+  /**
+   * @brief open the curves output file in streaming modes, the points being then written during the simulation
+   */
+  void openCurvesStream();
+
+  /**
+   * @brief open the timeline output file in streaming modes, the events being then written during the simulation
+   */
+  void openTimelineStream();
+
+  /**
+   * @brief open the solver statistics output file, the statistics of each time step being then written during the simulation
+   */
+  void openSolverStatisticsStream();
+
+  /**
+   * @brief write the statistics of the solver over the last time step in the solver statistics output file
+   *
+   * @param modeChangeType mode change of the time step
+   * @param wallTime time spent on the time step in seconds
+   */
+  void updateSolverStatistics(modeChangeType_t modeChangeType, double wallTime);
+
   /**
    * @brief dump the current time of the simulation in a file
    * @param fileName file where the current time is dumped
    */
   void printCurrentTime(const std::string& fileName) const;
 
+  /**
+   * @brief publish the progress of the simulation in the progress record
+   * @param iteration number of time steps done
+   */
+  void updateProgressRecord(int iteration) const;
+
   /**
    * @brief add an event to the timeline
    * @param messageTimeline message to add in the timeline
@@ -672,6 +1106,24 @@ class Simulation {
    */
   bool hasIntermediateStateToDump() const;
 
+  /**
+   * @brief Determines whether the system stayed steady long enough to stop the simulation
+   *
+   * The variations of the continuous variables since the previous time step, weighted by their magnitude,
+   * have to stay below the steady state threshold during the steady state duration.
+   *
+   * @param eventOccurred @b true if a discrete event occurred during the last time step
+   * @return true if the simulation can be stopped, false if not
+   */
+  bool isSteadyStateReached(bool eventOccurred);
+
+  /**
+   * @brief Determines whether a root change is scheduled before the stop time with the current values of the variables
+   *
+   * @return true if a discrete event is still pending, false if not
+   */
+  bool hasPendingEvent() const;
+
   /**
    * @brief instanciate a Modeler
    * @return Modeler object pointer
@@ -687,6 +1139,9 @@ class Simulation {
   boost::shared_ptr<DynamicData> dyd_;  ///< Dynamic data container associated to the job
   boost::shared_ptr<timeline::Timeline> timeline_;  ///< instance of the timeline where events are stored
   std::shared_ptr<curves::CurvesCollection> curvesCollection_;  ///< instance of curves collection where curves are stored
+  std::shared_ptr<curves::StreamExporter> curvesStreamExporter_;  ///< exporter writing the curves during the simulation in streaming modes
+  std::shared_ptr<timeline::StreamExporter> timelineStreamExporter_;  ///< exporter writing the timeline during the simulation in streaming modes
+  bool outputsStreamed_;  ///< @b false in the processes of the parareal fine propagations, whose outputs are streamed by the parent process
   std::shared_ptr<constraints::ConstraintsCollection> constraintsCollection_;  ///< instance of constraints collection where constraints are stored
   std::shared_ptr<criteria::CriteriaCollection> criteriaCollection_;  ///< instance of criteria collection where criteria are stored
   std::shared_ptr<std::vector<
@@ -697,6 +1152,8 @@ class Simulation {
   std::string networkParFile_;  ///< file containing all parameters for the network
   std::string networkParSet_;  ///< id of the set of parameters to use for the network
   std::string initialStateFile_;  ///< dump to load for each state variable
+  std::string initialConditionsCacheFile_;  ///< entry of the simulation in the initial conditions cache, empty if the cache is not used
+  bool initialConditionsFromCache_;  ///< whether the initial conditions were loaded from the cache
   std::unordered_map<std::string,
           std::shared_ptr<parameters::ParametersSetCollection> > referenceParameters_;  ///< association between file name and parameters collection
 
@@ -718,6 +1175,7 @@ class Simulation {
 
   std::string timetableOutputFile_;  ///< timetable export file
   int timetableSteps_{};  ///< timetable' steps
+  std::shared_ptr<ProgressRecord> progressRecord_;  ///< progress record updated in place of the timetable file, null if not used
 
   exportConstraintsMode_t exportConstraintsMode_;  ///< contstraints' export mode
   std::string constraintsOutputFile_;  ///< constraints' export file
@@ -725,16 +1183,31 @@ class Simulation {
   exportLostEquipmentsMode_t exportLostEquipmentsMode_;  ///< lostEquipments' export mode
   std::string lostEquipmentsOutputFile_;  ///< lost equipments' export file
 
+  std::string solverStatisticsOutputFile_;  ///< solver statistics' export file, empty if the statistics are not exported
+  std::ofstream solverStatisticsStream_;  ///< stream of the solver statistics, written at each time step
+  std::string convergenceDiagnosticsOutputFile_;  ///< convergence diagnostics' export file, empty if the diagnostics are disabled
+  unsigned int convergenceDiagnosticsDepth_{};  ///< number of Newton iterations kept in the convergence diagnostics
+  std::ofstream convergenceDiagnosticsStream_;  ///< stream of the convergence diagnostics, written at each Newton failure
+  stat_t lastSolverStatistics_{};  ///< statistics of the solver at the previous time step
+
   pid_t pid_;  ///< pid of the current simulation
 
   ExportStateDefinition finalState_;  ///< Final state definition
   std::queue<ExportStateDefinition> intermediateStates_;  ///< Queue of intermediate dump states to perform, sorted by timestamp
+  std::map<std::string, std::string> lastDumpEntries_;  ///< entries of the previous delta dump, the base of the next one
+  boost::filesystem::path lastDumpFile_;  ///< path of the previous delta dump
+  unsigned int nbDeltaDumpsSinceKeyframe_;  ///< number of delta dumps written since the last keyframe
+  unsigned int deltaDumpKeyframePeriod_;  ///< number of delta dumps between two keyframes
 
   double tStart_{};  ///< start time of the simulation
   double tCurrent_{};  ///< current time of the simulation
   double tStop_{};  ///< stop time of the simulation
   bool activateCriteria_{};  ///< whether to activate the verification if criteria are fullfilled
   int  criteriaStep_{};  ///< if activated, this number will be the number of iterations between two criteria checks
+  int criteriaMaxLag_{};  ///< maximum number of iterations between a criteria check and its result, 0 if checked synchronously
+  int coherenceCheckStep_{};  ///< number of iterations between 2 data coherence checks, 0 if only checked after the mode changes
+  std::shared_ptr<BackgroundCheck> criteriaWorker_;  ///< worker checking the criteria in the background, null if checked synchronously
+  int criteriaCheckIteration_{};  ///< iteration of the criteria check submitted to the worker
   bool dumpLocalInitValues_;  ///< whether to export the results from the local initialisation
   bool dumpGlobalInitValues_;  ///< whether to export the results from the global initialisation
   bool dumpInitModelValues_;  ///< whether to export the results from the initialisation model
@@ -744,8 +1217,19 @@ class Simulation {
   std::string realTimeTrackingFile_;  ///< CSV file path for real time tracking output
   std::vector<std::tuple<double, double, double>> timingData_;  ///< timing data triples (simulation_time, computation_time_ms, accumulated_computation_time_s)
   std::chrono::high_resolution_clock::time_point simulationStartTime_;  ///< start time of the main simulation loop
+  double steadyStateThreshold_;  ///< weighted norm of the variations of y below which the system is steady, 0 to disable the early termination
+  double steadyStateDuration_;  ///< duration during which the system has to stay steady before the simulation is stopped
+  double tSteadyStateStart_;  ///< time since which the system is steady
+  double tPreviousStep_;  ///< time of the previous time step, used to measure the variations of y
+  std::vector<double> yPreviousStep_;  ///< values of y at the previous time step
+  bool steadyStateReached_;  ///< whether the simulation was stopped because the system reached a steady state
+  bool memoryAccounting_;  ///< whether the memory allocated by the main structures is reported
+  double memoryReportInterval_;  ///< simulated time between two intermediate memory reports, 0 to disable them
+  double tNextMemoryReport_;  ///< time of the next intermediate memory report
 
   bool wasLoggingEnabled_;  ///< true if logging was enabled by an upper project
+  std::future<boost::shared_ptr<DataInterface> > pendingNetworkImport_;  ///< network file read in the background until loadDynamicData needs it
+  std::future<void> pendingIIDMDump_;  ///< IIDM dump running in the background, declared last to be waited for before the other members are destroyed
 
  protected:
   /**
@@ -753,6 +1237,80 @@ class Simulation {
    */
   void configureConstraintsOutputs();
 
+  /**
+   * @brief move all the outputs that are not yet written to another outputs directory
+   *
+   * @param outputsDirectory new outputs directory
+   */
+  void changeOutputsDirectory(const std::string& outputsDirectory);
+
+  /**
+   * @brief integrate the model up to the end of a time slice, the outputs being recorded by the fine propagation only
+   *
+   * @param tEnd end of the time slice
+   * @param coarse @b true to use the cheaper settings of the solver
+   */
+  void propagateSlice(double tEnd, bool coarse);
+
+  /**
+   * @brief drop the curves points and the timeline events recorded so far and stop streaming them, in a process forked for the fine
+   * propagation of a time slice
+   */
+  void startSliceOutputsRecording();
+
+  /**
+   * @brief capture the curves points and the timeline events recorded since startSliceOutputsRecording
+   *
+   * @param outputs buffer where the outputs are written
+   */
+  void snapshotSliceOutputs(StateBuffer& outputs) const;
+
+  /**
+   * @brief append the curves points and the timeline events captured by snapshotSliceOutputs in a forked process
+   *
+   * @param outputs buffer holding the outputs
+   */
+  void appendSliceOutputs(const StateBuffer& outputs);
+
+  /**
+   * @brief integrate the model up to a time, handling the mode changes as simulate does
+   *
+   * @param tEnd time to reach
+   * @param updateOutputs @b true to record the curves and the timeline at each time step
+   */
+  void integrateUntil(double tEnd, bool updateOutputs);
+
+  /**
+   * @brief propagate the time slices from their start state with the fine propagator, each one in a forked process
+   *
+   * @param propagator system to propagate
+   * @param states start state of each slice
+   * @param sliceEnds end time of each slice
+   * @param firstSlice first slice to propagate, the next ones being propagated too
+   * @param fineStates end state of each slice propagated, to fill
+   * @param fineOutputs outputs recorded by the propagation of each slice propagated, to fill
+   *
+   * @throw DYNError if a process could not be started or if the propagation of a slice failed, once the started processes are over
+   */
+  static void propagateFineSlices(PararealPropagator& propagator, const std::vector<StateBuffer>& states, const std::vector<double>& sliceEnds,
+      unsigned firstSlice, std::vector<StateBuffer>& fineStates, std::vector<StateBuffer>& fineOutputs);
+
+  /**
+   * @brief the simulation as the system propagated by the parareal algorithm
+   */
+  class SimulationPropagator;
+
+  /**
+   * @brief apply the actions of a contingency and simulate it in the current process
+   *
+   * @param contingency contingency to simulate
+   * @param outputsDirectory outputs directory of the contingency
+   * @param error message of the error that stopped the contingency, to fill
+   *
+   * @return the exit code of the process of the contingency, 0 if the simulation succeeded
+   */
+  int runContingency(const Contingency& contingency, const std::string& outputsDirectory, std::string& error);
+
   /**
    * @brief configure the timeline outputs
    */
@@ -783,10 +1341,20 @@ class Simulation {
    */
   void configureLostEquipmentsOutputs();
 
+  /**
+   * @brief configure the solver statistics outputs
+   */
+  void configureSolverStatisticsOutputs();
+
   /**
    * @brief write real time tracking file with timestep timing data
    */
   void writeRealTimeTrackingFile() const;
+
+  /**
+   * @brief write the scopes recorded by the profiler in a Chrome trace event file, if the trace is enabled
+   */
+  void writeProfilingTraceFile() const;
 };
 
 }  // end of namespace DYN
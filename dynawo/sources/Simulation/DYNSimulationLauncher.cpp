@@ -28,13 +28,39 @@
 #include "DYNFileSystemUtils.h"
 #include "DYNTimer.h"
 #include "DYNExecUtils.h"
+#include "DYNDataInterfaceFactory.h"
+#include "DYNSubModelLibraries.h"
+#include "DYNSolverFactory.h"
+#include "PARParametersSetCollectionCache.h"
 #include "JOBXmlImporter.h"
 #include "JOBJobsCollection.h"
 #include "JOBJobEntry.h"
+#include "JOBModelerEntry.h"
+#include "JOBNetworkEntry.h"
 #include "JOBOutputsEntry.h"
 
+#include <algorithm>
 #include <string>
+#include <map>
 #include <memory>
+#include <set>
+#include <vector>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#ifndef _WIN32
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 namespace parser = xml::sax::parser;
 
@@ -70,52 +96,61 @@ static void print(const T& output, const DYN::SeverityLevel level = DYN::INFO) {
   }
 }
 
-void launchSimu(const std::string& jobsFileName, bool isInteractive) {
-#if defined(_DEBUG_) || defined(PRINT_TIMERS)
-  DYN::Timer timer("Main::LaunchSimu");
-#endif
+/**
+ * @brief run one job of the jobs collection
+ *
+ * @param job job to run
+ * @param prefixJobFile absolute path of the directory of the jobs file
+ * @param isInteractive true if simulation in interactive or real-time mode
+ * @param contingencies contingencies to simulate from the initialized state of the job, empty to simulate the job itself
+ * @param nbParallelContingencies maximum number of contingencies simulated at the same time
+ * @param sharedContingencies true if the contingencies outputs directories are shared with other processes
+ */
+static void runJob(const std::shared_ptr<job::JobEntry>& job, const std::string& prefixJobFile, bool isInteractive,
+    const std::vector<Simulation::Contingency>& contingencies = std::vector<Simulation::Contingency>(), unsigned nbParallelContingencies = 1,
+    bool sharedContingencies = false) {
+  print(DYNLog(LaunchingJob, job->getName()));
 
-  job::XmlImporter importer;
-  const std::shared_ptr<job::JobsCollection>& jobsCollection = importer.importFromFile(jobsFileName);
-  const std::string prefixJobFile = absolute(removeFileName(jobsFileName));
-  if (jobsCollection->getJobs().empty())
-    throw DYNError(DYN::Error::SIMULATION, NoJobDefined);
-  Trace::init();
+  const auto context = std::make_shared<SimulationContext>();
+  context->setResourcesDirectory(getMandatoryEnvVar("DYNAWO_RESOURCES_DIR"));
+  context->setLocale(getMandatoryEnvVar("DYNAWO_LOCALE"));
+  context->setInputDirectory(prefixJobFile);
+  context->setWorkingDirectory(prefixJobFile);
 
-  for (const auto& job : jobsCollection->getJobs()) {
-    print(DYNLog(LaunchingJob, job->getName()));
+  std::shared_ptr<Simulation> simulation;
+  try {
+    if (isInteractive)
+      simulation = std::unique_ptr<SimulationRT>(new SimulationRT(job, context));
+    else
+      simulation = std::unique_ptr<Simulation>(new Simulation(job, context));
 
-    const auto context = std::make_shared<SimulationContext>();
-    context->setResourcesDirectory(getMandatoryEnvVar("DYNAWO_RESOURCES_DIR"));
-    context->setLocale(getMandatoryEnvVar("DYNAWO_LOCALE"));
-    context->setInputDirectory(prefixJobFile);
-    context->setWorkingDirectory(prefixJobFile);
+    simulation->init();
+  } catch (const DYN::Error& err) {
+    print(err.what(), DYN::ERROR);
+    throw;
+  } catch (const DYN::MessageError& e) {
+    print(e.what(), DYN::ERROR);
+    throw;
+  } catch (const char* s) {
+    print(s, DYN::ERROR);
+    throw;
+  } catch (const std::string& Msg) {
+    print(Msg, DYN::ERROR);
+    throw;
+  } catch (const std::exception& exc) {
+    print(exc.what(), DYN::ERROR);
+    throw;
+  }
 
-    std::shared_ptr<Simulation> simulation;
+  if (!contingencies.empty()) {
+    // the outputs are written by the contingencies only
     try {
-      if (isInteractive)
-        simulation = std::unique_ptr<SimulationRT>(new SimulationRT(job, context));
-      else
-        simulation = std::unique_ptr<Simulation>(new Simulation(job, context));
-
-      simulation->init();
+      simulation->simulateContingencies(contingencies, nbParallelContingencies, sharedContingencies);
     } catch (const DYN::Error& err) {
       print(err.what(), DYN::ERROR);
       throw;
-    } catch (const DYN::MessageError& e) {
-      print(e.what(), DYN::ERROR);
-      throw;
-    } catch (const char* s) {
-      print(s, DYN::ERROR);
-      throw;
-    } catch (const std::string& Msg) {
-      print(Msg, DYN::ERROR);
-      throw;
-    } catch (const std::exception& exc) {
-      print(exc.what(), DYN::ERROR);
-      throw;
     }
-
+  } else {
     try {
       simulation->simulate();
       simulation->terminate();
@@ -149,14 +184,568 @@ void launchSimu(const std::string& jobsFileName, bool isInteractive) {
       simulation->terminate();
       throw;
     }
-    simulation->clean();
-    print(DYNLog(EndOfJob, job->getName()));
-    Trace::resetCustomAppenders();
-    Trace::init();
-    print(DYNLog(JobSuccess, job->getName()));
-    if (job->getOutputsEntry()) {
-      std::string outputsDirectory = createAbsolutePath(job->getOutputsEntry()->getOutputsDirectory(), context->getWorkingDirectory());
-      print(DYNLog(ResultFolder, outputsDirectory));
+  }
+  simulation->clean();
+  print(DYNLog(EndOfJob, job->getName()));
+  Trace::resetCustomAppenders();
+  Trace::init();
+  print(DYNLog(JobSuccess, job->getName()));
+  if (job->getOutputsEntry()) {
+    std::string outputsDirectory = createAbsolutePath(job->getOutputsEntry()->getOutputsDirectory(), context->getWorkingDirectory());
+    print(DYNLog(ResultFolder, outputsDirectory));
+  }
+}
+
+#ifndef _WIN32
+/**
+ * @brief prepare the launcher process for a fork
+ *
+ * No thread of the launcher may run through a fork. The networks shared by the jobs are read beforehand by the launcher
+ * thread, and the simulations reading or dumping their network in the background are only built by the forked processes.
+ * The writer threads of the asynchronous appenders are stopped by their fork handlers once their queued records are written.
+ * The buffered outputs are flushed here so that they are not written by both processes.
+ */
+static void prepareFork() {
+  Trace::flush();
+  std::cout.flush();
+  std::clog.flush();
+}
+
+/**
+ * @brief run the jobs of the jobs collection in parallel, each one in its own process
+ *
+ * The processes are forked once the jobs file is read, each job writing its own logs and outputs as in a sequential run.
+ * A failing job does not stop the others.
+ * The network files shared by several jobs are read once before forking: each process gets its own copy of the network.
+ *
+ * @param jobs jobs to run
+ * @param prefixJobFile absolute path of the directory of the jobs file
+ * @param isInteractive true if simulation in interactive or real-time mode
+ * @param nbParallelJobs maximum number of jobs running at the same time
+ */
+static void runJobsInParallel(const std::vector<std::shared_ptr<job::JobEntry> >& jobs, const std::string& prefixJobFile, bool isInteractive,
+    unsigned nbParallelJobs) {
+  std::map<pid_t, std::string> runningJobs;
+  unsigned nbFailedJobs = 0;
+  // wait for the end of one of the running jobs
+  auto waitForOneJob = [&runningJobs, &nbFailedJobs]() {
+    int status = 0;
+    const pid_t pid = waitpid(-1, &status, 0);
+    if (pid < 0)
+      throw DYNError(DYN::Error::GENERAL, ParallelJobsWaitError, strerror(errno));
+    const auto it = runningJobs.find(pid);
+    if (it == runningJobs.end())
+      return;
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      ++nbFailedJobs;
+      print(DYNLog(JobFailure, it->second, WIFEXITED(status) ? WEXITSTATUS(status) : -1), DYN::ERROR);
+    }
+    runningJobs.erase(it);
+  };
+
+  std::map<std::string, unsigned> nbJobsByIidmFile;
+  for (const auto& job : jobs) {
+    if (job->getModelerEntry() && job->getModelerEntry()->getNetworkEntry())
+      ++nbJobsByIidmFile[createAbsolutePath(job->getModelerEntry()->getNetworkEntry()->getIidmFile(), prefixJobFile)];
+  }
+  for (const auto& iidmFile : nbJobsByIidmFile) {
+    if (iidmFile.second < 2 || !exists(iidmFile.first))
+      continue;
+    try {
+      // read synchronously: no reading thread may run through the forks
+      DYN::DataInterfaceFactory::preload(DYN::DataInterfaceFactory::DATAINTERFACE_IIDM, iidmFile.first);
+    } catch (const DYN::Error&) {
+      // the error is reported by each job reading the file
+    }
+  }
+
+  for (const auto& job : jobs) {
+    while (runningJobs.size() >= nbParallelJobs)
+      waitForOneJob();
+
+    prepareFork();
+    const pid_t pid = fork();
+    if (pid < 0)
+      throw DYNError(DYN::Error::GENERAL, ParallelJobsForkError, job->getName(), strerror(errno));
+    if (pid == 0) {
+      int exitCode = 0;
+      try {
+        runJob(job, prefixJobFile, isInteractive);
+      } catch (const DYN::Error& err) {
+        exitCode = std::max(static_cast<int>(err.type()), 1);
+      } catch (...) {
+        // already printed by runJob
+        exitCode = 1;
+      }
+      Trace::flush();
+      std::cout.flush();
+      std::clog.flush();
+      // the resources of the parent process (static objects, xml libraries) are released by the parent only
+      _exit(exitCode);
+    }
+    runningJobs[pid] = job->getName();
+  }
+  while (!runningJobs.empty())
+    waitForOneJob();
+  DYN::DataInterfaceFactory::clearPreloaded();
+
+  if (nbFailedJobs > 0)
+    throw DYNError(DYN::Error::SIMULATION, ParallelJobsFailure, nbFailedJobs, jobs.size());
+}
+#endif
+
+/**
+ * @brief read a contingencies file
+ *
+ * Each line describes a contingency: its id followed by its actions separated by blanks, each action having the syntax
+ * "model,parameter,value[,parameter,value...]". Empty lines and lines starting with # are ignored.
+ *
+ * @param contingenciesFileName contingencies file
+ *
+ * @return the contingencies of the file
+ */
+static std::vector<Simulation::Contingency> importContingencies(const std::string& contingenciesFileName) {
+  std::ifstream file(contingenciesFileName.c_str());
+  if (!file.is_open())
+    throw DYNError(DYN::Error::GENERAL, UnknownContingenciesFile, contingenciesFileName);
+
+  std::vector<Simulation::Contingency> contingencies;
+  std::set<std::string> ids;
+  std::string line;
+  for (unsigned lineNumber = 1; std::getline(file, line); ++lineNumber) {
+    std::istringstream lineStream(line);
+    Simulation::Contingency contingency;
+    if (!(lineStream >> contingency.id_) || contingency.id_[0] == '#')
+      continue;
+    // the id is used as the name of the outputs directory of the contingency
+    if (contingency.id_.find_first_of("/\\") != std::string::npos || contingency.id_ == "." || contingency.id_ == ".."
+        || !ids.insert(contingency.id_).second)
+      throw DYNError(DYN::Error::GENERAL, ContingencyParsingError, contingenciesFileName, lineNumber, contingency.id_);
+    std::string action;
+    while (lineStream >> action)
+      contingency.actions_.push_back(action);
+    contingencies.push_back(contingency);
+  }
+  return contingencies;
+}
+
+/**
+ * @brief read an ensemble file and build its parameter variants
+ *
+ * Each line gives the values taken by a parameter: "model,parameter" followed by its values separated by blanks. The variants are
+ * all the combinations of these values, named variant_0, variant_1... in the order of the lines, the last line varying first.
+ * Empty lines and lines starting with # are ignored.
+ *
+ * @param ensembleFileName ensemble file
+ * @param contingencies contingencies simulated in each variant, empty to simulate the variants alone
+ *
+ * @return a contingency for each variant and each contingency, setting the parameters of the variant before the actions of the contingency
+ */
+static std::vector<Simulation::Contingency> importEnsemble(const std::string& ensembleFileName, const std::vector<Simulation::Contingency>& contingencies) {
+  std::ifstream file(ensembleFileName.c_str());
+  if (!file.is_open())
+    throw DYNError(DYN::Error::GENERAL, UnknownEnsembleFile, ensembleFileName);
+
+  // actions setting each value of each parameter
+  std::vector<std::vector<std::string> > parameterActions;
+  std::string line;
+  for (unsigned lineNumber = 1; std::getline(file, line); ++lineNumber) {
+    std::istringstream lineStream(line);
+    std::string parameter;
+    if (!(lineStream >> parameter) || parameter[0] == '#')
+      continue;
+    if (parameter.find(',') == std::string::npos)
+      throw DYNError(DYN::Error::GENERAL, EnsembleParsingError, ensembleFileName, lineNumber);
+    std::vector<std::string> actions;
+    std::string value;
+    while (lineStream >> value)
+      actions.push_back(parameter + "," + value);
+    if (actions.empty())
+      throw DYNError(DYN::Error::GENERAL, EnsembleParsingError, ensembleFileName, lineNumber);
+    parameterActions.push_back(actions);
+  }
+
+  std::vector<Simulation::Contingency> variants(1);
+  for (const auto& actions : parameterActions) {
+    std::vector<Simulation::Contingency> combinedVariants;
+    for (const auto& variant : variants) {
+      for (const auto& action : actions) {
+        Simulation::Contingency combinedVariant(variant);
+        combinedVariant.actions_.push_back(action);
+        combinedVariants.push_back(combinedVariant);
+      }
+    }
+    variants.swap(combinedVariants);
+  }
+  for (size_t i = 0; i < variants.size(); ++i) {
+    std::stringstream id;
+    id << "variant_" << i;
+    variants[i].id_ = id.str();
+  }
+  if (contingencies.empty())
+    return variants;
+
+  std::vector<Simulation::Contingency> variantContingencies;
+  for (const auto& variant : variants) {
+    for (const auto& contingency : contingencies) {
+      Simulation::Contingency variantContingency(variant);
+      variantContingency.id_ = variant.id_ + "_" + contingency.id_;
+      variantContingency.actions_.insert(variantContingency.actions_.end(), contingency.actions_.begin(), contingency.actions_.end());
+      variantContingencies.push_back(variantContingency);
+    }
+  }
+  return variantContingencies;
+}
+
+void launchSimu(const std::string& jobsFileName, bool isInteractive, unsigned nbParallelJobs, const std::string& contingenciesFileName,
+    bool sharedContingencies, const std::string& ensembleFileName) {
+#if defined(_DEBUG_) || defined(PRINT_TIMERS)
+  DYN::Timer timer("Main::LaunchSimu");
+#endif
+
+  job::XmlImporter importer;
+  const std::shared_ptr<job::JobsCollection>& jobsCollection = importer.importFromFile(jobsFileName);
+  const std::string prefixJobFile = absolute(removeFileName(jobsFileName));
+  if (jobsCollection->getJobs().empty())
+    throw DYNError(DYN::Error::SIMULATION, NoJobDefined);
+  Trace::init();
+
+  if (!contingenciesFileName.empty() || !ensembleFileName.empty()) {
+    // the jobs are run one after the other, the contingencies of each job in parallel
+    std::vector<Simulation::Contingency> contingencies;
+    if (!contingenciesFileName.empty())
+      contingencies = importContingencies(contingenciesFileName);
+    if (!ensembleFileName.empty())
+      contingencies = importEnsemble(ensembleFileName, contingencies);
+    for (const auto& job : jobsCollection->getJobs())
+      runJob(job, prefixJobFile, isInteractive, contingencies, nbParallelJobs, sharedContingencies);
+    return;
+  }
+
+  if (nbParallelJobs > 1 && jobsCollection->getJobs().size() > 1) {
+#ifndef _WIN32
+    runJobsInParallel(jobsCollection->getJobs(), prefixJobFile, isInteractive, nbParallelJobs);
+    return;
+#else
+    print(DYNLog(ParallelJobsUnavailable), DYN::WARN);
+#endif
+  }
+
+  for (const auto& job : jobsCollection->getJobs())
+    runJob(job, prefixJobFile, isInteractive);
+}
+
+#ifndef _WIN32
+static volatile sig_atomic_t serviceStopRequested = 0;  ///< set when the service receives SIGINT or SIGTERM
+
+/**
+ * @brief signal handler stopping the service once the running jobs files are over
+ */
+static void requestServiceStop(int) {
+  serviceStopRequested = 1;
+}
+
+/**
+ * @brief write a whole buffer to a file descriptor
+ *
+ * @param fd file descriptor
+ * @param data buffer to write
+ *
+ * @return @b false if the buffer could not be written entirely
+ */
+static bool writeAll(const int fd, const std::string& data) {
+  std::size_t written = 0;
+  while (written < data.size()) {
+    const ssize_t n = write(fd, data.data() + written, data.size() - written);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    written += static_cast<std::size_t>(n);
+  }
+  return true;
+}
+
+/**
+ * @brief read the request of a client of the service: the path of a jobs file, ended by a new line
+ *
+ * @param clientSocket socket connected to the client
+ * @param requestTimeout maximum time in seconds between two bytes of the request
+ * @param jobsFileName path of the jobs file read
+ *
+ * @return @b false if the client sent nothing during requestTimeout seconds
+ */
+static bool readServiceRequest(const int clientSocket, const unsigned requestTimeout, std::string& jobsFileName) {
+  // a client that never ends its request must not keep a worker forever
+  timeval timeout;
+  timeout.tv_sec = static_cast<time_t>(requestTimeout);
+  timeout.tv_usec = 0;
+  setsockopt(clientSocket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  char c = 0;
+  for (;;) {
+    const ssize_t n = read(clientSocket, &c, 1);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+      return false;
+    if (n != 1 || c == '\n')
+      break;
+    jobsFileName += c;
+  }
+  if (!jobsFileName.empty() && jobsFileName[jobsFileName.size() - 1] == '\r')
+    jobsFileName.erase(jobsFileName.size() - 1);
+  return true;
+}
+
+/**
+ * @brief run the jobs file requested by a client of the service, in the worker process forked for the client
+ *
+ * The request is the path of the jobs file, ended by a new line. Once the jobs file is run, its exit code is sent back
+ * to the client as a line, and the libraries and parameters files loaded by the jobs are reported to the service.
+ *
+ * @param clientSocket socket connected to the client
+ * @param reportPipe pipe where the libraries and parameters files to keep warm are reported
+ * @param requestTimeout maximum time in seconds between two bytes of the request
+ *
+ * @return exit code of the jobs file, as the one of a dynawo process running it
+ */
+static int runServiceRequest(const int clientSocket, const int reportPipe, const unsigned requestTimeout) {
+  std::string jobsFileName;
+  const bool requestRead = readServiceRequest(clientSocket, requestTimeout, jobsFileName);
+
+  int exitCode = 0;
+  try {
+    if (!requestRead)
+      throw DYNError(DYN::Error::GENERAL, ServiceRequestTimeout, requestTimeout);
+    if (!exists(jobsFileName))
+      throw DYNError(DYN::Error::GENERAL, UnknownServiceJobsFile, jobsFileName);
+    launchSimu(jobsFileName);
+  } catch (const DYN::Error& err) {
+    print(err.what(), DYN::ERROR);
+    exitCode = std::max(static_cast<int>(err.type()), 1);
+  } catch (const std::exception& exc) {
+    print(exc.what(), DYN::ERROR);
+    exitCode = 1;
+  } catch (...) {
+    // already printed by runJob
+    exitCode = 1;
+  }
+  print(DYNLog(ServiceRequestEnd, jobsFileName, exitCode));
+
+  std::ostringstream report;
+  for (const auto& lib : DYN::SubModelLibraries::getLoaded())
+    report << "model " << lib << '\n';
+  for (const auto& lib : DYN::SolverFactories::getInstance().getLibs())
+    report << "solver " << lib << '\n';
+  for (const auto& fileName : parameters::ParametersSetCollectionCache::instance().getFileNames())
+    report << "par " << fileName << '\n';
+  writeAll(reportPipe, report.str());
+  // the client may have disconnected: the jobs file was run anyway
+  writeAll(clientSocket, std::to_string(exitCode) + "\n");
+  return exitCode;
+}
+
+/**
+ * @brief load in the service the libraries and parse the parameters files reported by a worker, for the next workers
+ *
+ * The libraries and files already loaded are skipped. The errors are ignored: they are reported by the jobs using them.
+ *
+ * @param report report of the worker, one "model|solver|par <name>" line by library or file
+ * @param nbThreads number of threads loading the libraries and parsing the files
+ */
+static void warmServiceCaches(const std::string& report, const unsigned nbThreads) {
+  std::vector<std::string> modelLibs;
+  std::vector<std::string> solverLibs;
+  std::vector<std::string> parFiles;
+  std::istringstream lines(report);
+  std::string line;
+  while (std::getline(lines, line)) {
+    const std::size_t separator = line.find(' ');
+    if (separator == std::string::npos)
+      continue;
+    const std::string kind = line.substr(0, separator);
+    const std::string name = line.substr(separator + 1);
+    if (kind == "model")
+      modelLibs.push_back(name);
+    else if (kind == "solver")
+      solverLibs.push_back(name);
+    else if (kind == "par")
+      parFiles.push_back(name);
+  }
+
+  try {
+    DYN::SubModelLibraries::load(modelLibs, nbThreads);
+  } catch (const DYN::Error&) {
+    // reported by the jobs using the library
+  }
+  DYN::SolverFactories& solverFactories = DYN::SolverFactories::getInstance();
+  for (const auto& lib : solverLibs) {
+    DYN::SolverFactories::SolverFactoryIterator it = solverFactories.find(lib);
+    if (!solverFactories.end(it))
+      continue;
+    try {
+      // the factory is kept by the service, the solver itself is not needed
+      DYN::SolverFactory::createSolverFromLib(lib);
+    } catch (const DYN::Error&) {
+      // reported by the jobs using the library
+    }
+  }
+  parameters::ParametersSetCollectionCache::instance().preload(parFiles, nbThreads);
+}
+#endif
+
+void serveSimu(const std::string& socketPath, unsigned nbParallelJobs, unsigned requestTimeout) {
+#ifdef _WIN32
+  static_cast<void>(socketPath);
+  static_cast<void>(nbParallelJobs);
+  static_cast<void>(requestTimeout);
+  throw DYNError(DYN::Error::GENERAL, ServiceUnavailable);
+#else
+  nbParallelJobs = std::max(nbParallelJobs, 1U);
+  Trace::init();
+
+  sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  if (socketPath.empty() || socketPath.size() >= sizeof(address.sun_path))
+    throw DYNError(DYN::Error::GENERAL, ServiceSocketError, socketPath, strerror(ENAMETOOLONG));
+  strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+  // the socket left by a previous service is replaced, any other file is kept
+  struct stat socketStat;
+  if (stat(socketPath.c_str(), &socketStat) == 0 && S_ISSOCK(socketStat.st_mode))
+    unlink(socketPath.c_str());
+
+  const int listenSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listenSocket < 0)
+    throw DYNError(DYN::Error::GENERAL, ServiceSocketError, socketPath, strerror(errno));
+  // only the user of the service may connect: the socket is created with the 0600 permissions
+  const mode_t previousUmask = umask(S_IXUSR | S_IRWXG | S_IRWXO);
+  const bool bound = bind(listenSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+  const int bindError = errno;
+  umask(previousUmask);
+  if (!bound || listen(listenSocket, SOMAXCONN) != 0) {
+    const int error = bound ? errno : bindError;
+    close(listenSocket);
+    throw DYNError(DYN::Error::GENERAL, ServiceSocketError, socketPath, strerror(error));
+  }
+
+  struct sigaction stopAction;
+  memset(&stopAction, 0, sizeof(stopAction));
+  stopAction.sa_handler = requestServiceStop;
+  sigemptyset(&stopAction.sa_mask);
+  struct sigaction previousIntAction;
+  struct sigaction previousTermAction;
+  sigaction(SIGINT, &stopAction, &previousIntAction);
+  sigaction(SIGTERM, &stopAction, &previousTermAction);
+  // a client disconnecting before the end of its jobs file must not kill the worker
+  struct sigaction ignoreAction;
+  memset(&ignoreAction, 0, sizeof(ignoreAction));
+  ignoreAction.sa_handler = SIG_IGN;
+  sigemptyset(&ignoreAction.sa_mask);
+  struct sigaction previousPipeAction;
+  sigaction(SIGPIPE, &ignoreAction, &previousPipeAction);
+  serviceStopRequested = 0;
+  print(DYNLog(ServiceStarted, socketPath, nbParallelJobs));
+
+  /**
+   * @brief worker process running the jobs file of a client
+   */
+  struct Worker {
+    pid_t pid;  ///< process of the worker
+    int reportPipe;  ///< read end of the pipe where the worker reports the libraries and files it loaded
+    std::string report;  ///< report received so far
+  };
+  std::vector<Worker> workers;
+  while (!serviceStopRequested || !workers.empty()) {
+    const bool accepting = !serviceStopRequested && workers.size() < nbParallelJobs;
+    std::vector<pollfd> fds;
+    if (accepting)
+      fds.push_back(pollfd{listenSocket, POLLIN, 0});
+    for (const auto& worker : workers)
+      fds.push_back(pollfd{worker.reportPipe, POLLIN, 0});
+    // the timeout lets a stop request received before poll be taken into account
+    if (poll(fds.data(), fds.size(), 1000) < 0) {
+      if (errno == EINTR)
+        continue;
+      const int error = errno;
+      close(listenSocket);
+      throw DYNError(DYN::Error::GENERAL, ServiceSocketError, socketPath, strerror(error));
     }
+
+    const std::size_t firstWorkerFd = accepting ? 1 : 0;
+    for (std::size_t i = workers.size(); i-- > 0;) {
+      if ((fds[firstWorkerFd + i].revents & (POLLIN | POLLHUP | POLLERR)) == 0)
+        continue;
+      char buffer[4096];
+      const ssize_t n = read(workers[i].reportPipe, buffer, sizeof(buffer));
+      if (n > 0) {
+        workers[i].report.append(buffer, static_cast<std::size_t>(n));
+        continue;
+      }
+      if (n < 0 && errno == EINTR)
+        continue;
+      // end of the report: the worker is over
+      close(workers[i].reportPipe);
+      int status = 0;
+      while (waitpid(workers[i].pid, &status, 0) < 0 && errno == EINTR) {}
+      warmServiceCaches(workers[i].report, nbParallelJobs);
+      workers.erase(workers.begin() + static_cast<std::ptrdiff_t>(i));
+    }
+
+    if (!accepting || (fds[0].revents & POLLIN) == 0)
+      continue;
+    const int clientSocket = accept(listenSocket, NULL, NULL);
+    if (clientSocket < 0)
+      continue;
+    // the permissions of the socket file may be changed or ignored: the user of the client is checked too
+    ucred credentials;
+    socklen_t credentialsSize = sizeof(credentials);
+    const bool credentialsRead = getsockopt(clientSocket, SOL_SOCKET, SO_PEERCRED, &credentials, &credentialsSize) == 0;
+    if (!credentialsRead || credentials.uid != getuid()) {
+      const long clientUid = credentialsRead ? static_cast<long>(credentials.uid) : -1;
+      print(DYNLog(ServiceClientRejected, clientUid, static_cast<long>(getuid())), DYN::WARN);
+      close(clientSocket);
+      continue;
+    }
+    int reportPipe[2];
+    if (pipe(reportPipe) != 0) {
+      close(clientSocket);
+      continue;
+    }
+    prepareFork();
+    const pid_t pid = fork();
+    if (pid < 0) {
+      close(clientSocket);
+      close(reportPipe[0]);
+      close(reportPipe[1]);
+      print(DYNError(DYN::Error::GENERAL, ServiceSocketError, socketPath, strerror(errno)).what(), DYN::ERROR);
+      continue;
+    }
+    if (pid == 0) {
+      close(listenSocket);
+      close(reportPipe[0]);
+      for (const auto& worker : workers)
+        close(worker.reportPipe);
+      sigaction(SIGINT, &previousIntAction, NULL);
+      sigaction(SIGTERM, &previousTermAction, NULL);
+      const int exitCode = runServiceRequest(clientSocket, reportPipe[1], requestTimeout);
+      Trace::flush();
+      std::cout.flush();
+      std::clog.flush();
+      // the resources of the service (static objects, xml libraries) are released by the service only
+      _exit(exitCode);
+    }
+    close(clientSocket);
+    close(reportPipe[1]);
+    workers.push_back(Worker{pid, reportPipe[0], std::string()});
   }
+
+  close(listenSocket);
+  unlink(socketPath.c_str());
+  sigaction(SIGINT, &previousIntAction, NULL);
+  sigaction(SIGTERM, &previousTermAction, NULL);
+  sigaction(SIGPIPE, &previousPipeAction, NULL);
+  print(DYNLog(ServiceStopped));
+#endif
 }
@@ -29,7 +29,32 @@
  *
  * @param jobsFileName file describing the job(s) to launch
  * @param isInteractive true if simulation in interactive or real-time mode
+ * @param nbParallelJobs maximum number of jobs run at the same time, each one in its own process (1 to run them sequentially)
+ * @param contingenciesFileName file describing contingencies to simulate from the initialized state of each job, empty to simulate the jobs
+ * themselves. With contingencies, the jobs are run sequentially and nbParallelJobs contingencies are simulated at the same time.
+ * @param sharedContingencies true if the contingencies outputs directories are shared with other processes, possibly on other hosts,
+ * simulating the same contingencies file: each contingency is then simulated by the first process claiming it
+ * @param ensembleFileName file describing the values of the parameters of an ensemble of variants, empty if none. Each variant is
+ * simulated from the initialized state of each job like a contingency, along with each contingency of contingenciesFileName if any.
  */
-void launchSimu(const std::string& jobsFileName, bool isInteractive = false);
+void launchSimu(const std::string& jobsFileName, bool isInteractive = false, unsigned nbParallelJobs = 1, const std::string& contingenciesFileName = "",
+    bool sharedContingencies = false, const std::string& ensembleFileName = "");
+
+/**
+ * @brief serve the jobs files sent over a local socket until SIGINT or SIGTERM is received
+ *
+ * Each client connects to the Unix domain socket, sends the path of a jobs file ended by a new line and receives
+ * the exit code of the jobs file as a line once it is over. Each jobs file is run in a process forked from the service,
+ * so that the dictionaries, the xml libraries, the solver and model libraries and the parameters files loaded
+ * by the service are ready when the jobs start. The libraries and parameters files loaded by a jobs file are loaded
+ * by the service once it is over, for the next jobs files. Relative paths are resolved from the working directory
+ * of the service.
+ *
+ * @param socketPath path of the Unix domain socket to create
+ * @param nbParallelJobs maximum number of jobs files run at the same time
+ * @param requestTimeout maximum time in seconds between two bytes of a request: a client silent for longer is answered
+ * with an error, so that it does not keep a worker forever
+ */
+void serveSimu(const std::string& socketPath, unsigned nbParallelJobs = 1, unsigned requestTimeout = 10);
 
 #endif  // SIMULATION_DYNSIMULATIONLAUNCHER_H_
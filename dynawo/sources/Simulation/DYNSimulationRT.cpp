@@ -59,6 +59,7 @@
 #include "DYNTrace.h"
 #include "DYNSolver.h"
 #include "DYNTimer.h"
+#include "DYNProfiler.h"
 #include "DYNModelMulti.h"
 #include "DYNSubModel.h"
 #include "DYNRTInputCommon.h"
@@ -67,6 +68,10 @@
 #include "DYNZmqInputChannel.h"
 #include "DYNZmqOutputChannel.h"
 #endif
+#ifndef _WIN32
+#include "DYNShmInputChannel.h"
+#include "DYNShmOutputChannel.h"
+#endif
 
 #include "make_unique.hpp"
 
@@ -102,10 +107,14 @@ using std::chrono::steady_clock;
 using std::chrono::microseconds;
 using std::chrono::duration_cast;
 
+static const double TELEMETRY_PERIOD_MS = 1000.;  ///< minimum clock time between two telemetry publications in ms
+
 namespace DYN {
 
 SimulationRT::SimulationRT(const std::shared_ptr<job::JobEntry>& jobEntry, const std::shared_ptr<SimulationContext>& context, shared_ptr<DataInterface> data) :
-Simulation(jobEntry, context, data) {
+Simulation(jobEntry, context, data),
+degradeAfterOverruns_(0),
+degradedMode_(false) {
   configureRT();
 }
 
@@ -124,9 +133,16 @@ SimulationRT::configureRT() {
   inputDispatcherAsync_ = std::make_shared<InputDispatcherAsync>(clock_);
 
   couplingTimeStep_ = jobEntry_->getInteractiveSettingsEntry()->getCouplingTimeStep() < 0 ? 0 : jobEntry_->getInteractiveSettingsEntry()->getCouplingTimeStep();
+  degradeAfterOverruns_ = jobEntry_->getInteractiveSettingsEntry()->getDegradeAfterOverruns();
 
   configureClock();
   configureOutputsRT();
+  // publications are sent by a writer thread so that a slow channel does not delay the time steps
+  const std::string& outputQueuePolicy = jobEntry_->getInteractiveSettingsEntry()->getOutputQueuePolicy();
+  if (outputQueuePolicy != "BLOCK" && outputQueuePolicy != "DROP_OLDEST")
+    throw DYNError(Error::GENERAL, UnknownOutputQueuePolicy, outputQueuePolicy);
+  outputDispatcher_->startAsync(jobEntry_->getInteractiveSettingsEntry()->getOutputQueueSize(),
+      outputQueuePolicy == "DROP_OLDEST" ? OutputQueuePolicy::DROP_OLDEST : OutputQueuePolicy::BLOCK);
   configureInputsRT();
   configureCurvesRT();
 }
@@ -142,12 +158,14 @@ SimulationRT::configureClock() {
     clock_->setUseTrigger(false);
     if (clockEntry->getSpeedup())
       clock_->setSpeedup(clockEntry->getSpeedup().get());
+    clock_->setSpinGuard(clockEntry->getSpinGuard());
   } else {
     clock_->setUseTrigger(true);
     std::shared_ptr<job::ChannelEntry> triggerChannelEntry = channelsEntry->getChannelEntryById(clockEntry->getTriggerChannel());
     if (!triggerChannelEntry)
       throw DYNError(Error::API, UnknownChannelId, clockEntry->getTriggerChannel());
   }
+  clock_->setThreadScheduling(clockEntry->getCpuAffinity(), clockEntry->getRealTimePriority());
 }
 
 void
@@ -171,6 +189,17 @@ SimulationRT::configureOutputsRT() {
         Trace::debug() << DYNLog(ZmqChannelCreated, channelEntry->getId()) << Trace::endline;
 #else
         throw DYNError(Error::GENERAL, UnavailableLib, "ZMQ");
+#endif
+      } else if (channelEntry->getType() == "SHM") {
+#ifndef _WIN32
+        if (channelEntry->getEndpoint() == "")
+          outputChannel = std::make_shared<ShmOutputChannel>();
+        else
+          outputChannel = std::make_shared<ShmOutputChannel>(channelEntry->getEndpoint());
+        channelInterfaceMap.emplace(channelEntry->getId(), outputChannel);
+        Trace::debug() << DYNLog(ShmChannelCreated, channelEntry->getId()) << Trace::endline;
+#else
+        throw DYNError(Error::GENERAL, UnavailableLib, "SHM");
 #endif
       } else {
         Trace::warn() << DYNLog(UnsopportedOutputChannel, channelEntry->getType()) << Trace::endline;
@@ -182,11 +211,17 @@ SimulationRT::configureOutputsRT() {
 
     // Connect the output stream to the output channel
     if (streamEntry->getData() == "CURVES") {
-      outputDispatcher_->addCurvesPublisher(outputChannel, streamEntry->getFormat());
+      PublicationPolicy policy;
+      policy.deadband = streamEntry->getDeadband();
+      policy.minPeriod = streamEntry->getMinPeriod();
+      policy.keyframeInterval = streamEntry->getKeyframeInterval();
+      outputDispatcher_->addCurvesPublisher(outputChannel, streamEntry->getFormat(), policy);
     } else if (streamEntry->getData() == "TIMELINE") {
       outputDispatcher_->addTimelinePublisher(outputChannel, streamEntry->getFormat());
     } else if (streamEntry->getData() == "CONSTRAINTS") {
       outputDispatcher_->addConstraintsPublisher(outputChannel, streamEntry->getFormat());
+    } else if (streamEntry->getData() == "TELEMETRY") {
+      outputDispatcher_->addTelemetryPublisher(outputChannel, streamEntry->getFormat());
     } else {
       Trace::warn() << DYNLog(StreamDataNotManaged, streamEntry->getData()) << Trace::endline;
     }
@@ -217,6 +252,21 @@ SimulationRT::configureInputsRT() {
         inputDispatcherAsync_->addInputChannel(zmqServer);
 #else
         throw DYNError(Error::GENERAL, UnavailableLib, "ZMQ");
+#endif
+      } else if (channelEntry->getType() == "SHM") {
+#ifndef _WIN32
+        MessageFilter filter = MessageFilter::Actions | MessageFilter::TimeManagement;
+        if (clockEntry->getType() == "EXTERNAL" && clockEntry->getTriggerChannel() == channelEntry->getId())  // is trigger channel
+          filter = filter | MessageFilter::Trigger;
+        std::shared_ptr<InputChannel> shmServer;
+        if (channelEntry->getEndpoint() == "")
+          shmServer = std::make_shared<ShmInputChannel>("shm", filter);
+        else
+          shmServer = std::make_shared<ShmInputChannel>("shm", filter, channelEntry->getEndpoint());
+        inputDispatcherAsync_->addInputChannel(shmServer);
+        Trace::debug() << DYNLog(ShmChannelCreated, channelEntry->getId()) << Trace::endline;
+#else
+        throw DYNError(Error::GENERAL, UnavailableLib, "SHM");
 #endif
       } else {
         Trace::warn() << DYNLog(UnknownChannelType, channelEntry->getType()) << Trace::endline;
@@ -236,6 +286,8 @@ SimulationRT::configureCurvesRT() {
   }
   exportCurvesMode_ = EXPORT_CURVES_NONE;
   exportFinalStateValuesMode_ = EXPORT_FINAL_STATE_VALUES_NONE;
+  // the last values are read at each time step by the output dispatcher
+  curvesCollection_->setFinalStateValuesAtEnd(false);
   // Add simulation time to curves
   bool sendSimulationMetrics_ = true;
   if (sendSimulationMetrics_)
@@ -272,7 +324,7 @@ SimulationRT::simulate() {
   solver_->printSolve();
   if (exportCurvesMode_ != EXPORT_CURVES_NONE) {
     // This is a workaround to update the calculated variables with initial values of y and yp as they are not accessible at this level
-    model_->evalCalculatedVariables(tCurrent_, solver_->getCurrentY(), solver_->getCurrentYP(), zCurrent_);
+    model_->evalCalculatedVariablesForCurves(tCurrent_, solver_->getCurrentY(), solver_->getCurrentYP(), zCurrent_);
   }
   const bool updateCalculatedVariable = false;
   initComputationTimeCurve();
@@ -280,6 +332,7 @@ SimulationRT::simulate() {
 
   if (outputDispatcher_)
     outputDispatcher_->publishCurvesNames(curvesCollection_);
+  openSolverStatisticsStream();
 
   bool criteriaChecked = true;
   try {
@@ -299,6 +352,7 @@ SimulationRT::simulate() {
     inputDispatcherAsync_->start();
 
     clock_->start(tCurrent_);
+    lastTelemetry_ = steady_clock::now();
 
     double nextOutputT = tCurrent_;  // Publish first time step
     bool isPublicationTime = false;
@@ -311,9 +365,13 @@ SimulationRT::simulate() {
       }
 
       if (isWaitTime) {
+        endCouplingPeriod();
+        const steady_clock::time_point waitStart = steady_clock::now();
         clock_->wait(tCurrent_);
         updateStepStart();
+        deadlineMonitor_.addPhaseDuration(DeadlineMonitor::WAIT, (1./1000)*duration_cast<microseconds>(stepStart_ - waitStart).count());
         actionBuffer_->applyActions();
+        deadlineMonitor_.addPhaseDuration(DeadlineMonitor::IO, (1./1000)*duration_cast<microseconds>(steady_clock::now() - stepStart_).count());
         isWaitTime = false;
       }
 
@@ -325,12 +383,14 @@ SimulationRT::simulate() {
         return;
       }
 
+      const steady_clock::time_point solveStart = steady_clock::now();
       solver_->solve(tStop_, tCurrent_);
       solver_->printSolve();
       if (currentIterNb == 0)
         printHighestDerivativesValues();
 
       BitMask solverState = solver_->getState();
+      const modeChangeType_t modeChangeType = model_->getModeChangeType();
       if (solverState.getFlags(ModeChange)) {
         model_->notifyTimeStep();  // check if needed
         Trace::info() << DYNLog(NewStartPoint) << Trace::endline;
@@ -343,23 +403,32 @@ SimulationRT::simulate() {
           || solverState.getFlags(SilentZNotUsedInContinuousEqChange)) {
         model_->getCurrentZ(zCurrent_);
       }
+      if (solverStatisticsStream_.is_open())
+        updateSolverStatistics(modeChangeType, std::chrono::duration<double>(steady_clock::now() - solveStart).count());
 
       model_->checkDataCoherence(tCurrent_);  // check if needed
       ++currentIterNb;
 
       model_->notifyTimeStep();  // check if needed
+      printIntermediateReports();
 
       // Set up step times
       updateStepComputationTime();
+      deadlineMonitor_.addPhaseDuration(DeadlineMonitor::SOLVE, (1./1000)*duration_cast<microseconds>(steady_clock::now() - solveStart).count());
       updateCurves(true);
 
       // Publish values
       if (isPublicationTime) {
+        const steady_clock::time_point publicationStart = steady_clock::now();
+        ProfilerScope profilerScope(Profiler::OUTPUTS);
+        outputDispatcher_->beginFrame();
         outputDispatcher_->publishCurves(curvesCollection_);
         outputDispatcher_->publishTimeline(timeline_);
         outputDispatcher_->publishConstraints(constraintsCollection_);
+        outputDispatcher_->endFrame();
         timeline_->clear();
         constraintsCollection_->clear();
+        deadlineMonitor_.addPhaseDuration(DeadlineMonitor::IO, (1./1000)*duration_cast<microseconds>(steady_clock::now() - publicationStart).count());
         isPublicationTime = false;
         isWaitTime = true;
       }
@@ -370,6 +439,10 @@ SimulationRT::simulate() {
         throw DYNError(Error::GENERAL, SignalReceived);
       }
     }
+    if (deadlineMonitor_.getTotalOverruns() > 0)
+      Trace::info() << DYNLog(RTDeadlineOverruns, deadlineMonitor_.getTotalOverruns()) << Trace::endline;
+    if (outputDispatcher_->getNbDroppedFrames() > 0)
+      Trace::info() << DYNLog(RTOutputFramesDropped, outputDispatcher_->getNbDroppedFrames()) << Trace::endline;
   } catch (const Terminate& t) {
     Trace::warn() << t.what() << Trace::endline;
     model_->printMessages();
@@ -403,6 +476,45 @@ SimulationRT::updateStepComputationTime() {
   stepComputationTime_ = (1./1000)*(duration_cast<microseconds>(steady_clock::now() - stepStart_)).count();
 }
 
+void
+SimulationRT::endCouplingPeriod() {
+  // the lateness is measured before the wait: a period that ends after its deadline does not wait
+  const double lateness = clock_->getLateness(tCurrent_);
+  const bool overrun = lateness >= 0;
+  if (deadlineMonitor_.endPeriod(lateness, overrun) && timeline_)
+    addEvent(DYNTimeline(RTSustainedOverrun, deadlineMonitor_.getSustainedOverrunCount()));
+  updateDegradedMode();
+
+  const steady_clock::time_point now = steady_clock::now();
+  if (outputDispatcher_->hasTelemetryPublishers()
+      && (1./1000)*duration_cast<microseconds>(now - lastTelemetry_).count() >= TELEMETRY_PERIOD_MS) {
+    outputDispatcher_->publishTelemetry(deadlineMonitor_.toJson(tCurrent_));
+    deadlineMonitor_.resetWindow();
+    lastTelemetry_ = now;
+  }
+}
+
+void
+SimulationRT::updateDegradedMode() {
+  if (degradeAfterOverruns_ == 0)
+    return;
+  if (!degradedMode_ && deadlineMonitor_.getConsecutiveOverruns() >= degradeAfterOverruns_) {
+    if (!solver_->setDegradedMode(true)) {
+      Trace::warn() << DYNLog(RTDegradedModeNotSupported, solver_->solverType()) << Trace::endline;
+      degradeAfterOverruns_ = 0;
+      return;
+    }
+    degradedMode_ = true;
+    if (timeline_)
+      addEvent(DYNTimeline(RTDegradedModeStarted, degradeAfterOverruns_));
+  } else if (degradedMode_ && deadlineMonitor_.getConsecutivePeriodsWithMargin() >= degradeAfterOverruns_) {
+    solver_->setDegradedMode(false);
+    degradedMode_ = false;
+    if (timeline_)
+      addEvent(DYNTimeline(RTDegradedModeEnded, degradeAfterOverruns_));
+  }
+}
+
 void
 SimulationRT::initComputationTimeCurve() {
   std::shared_ptr<curves::Curve> curve = curves::CurveFactory::newCurve();
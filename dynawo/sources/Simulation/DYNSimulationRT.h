@@ -31,6 +31,7 @@
 
 #include "DYNSimulation.h"
 #include "DYNClock.h"
+#include "DYNDeadlineMonitor.h"
 #include "DYNActionBuffer.h"
 #include "DYNInputDispatcherAsync.h"
 #include "DYNOutputDispatcher.h"
@@ -144,6 +145,16 @@ class SimulationRT: public Simulation {
    */
   void initComputationTimeCurve();
 
+  /**
+   * @brief close the current coupling period before waiting for the clock: check its deadline and publish the telemetry
+   */
+  void endCouplingPeriod();
+
+  /**
+   * @brief switch the solver to cheaper settings after consecutive overruns, and back once the margin is recovered
+   */
+  void updateDegradedMode();
+
  protected:
   std::chrono::steady_clock::time_point stepStart_;             ///< Clock time before step (after sleep)
   double stepComputationTime_;                                  ///< Step computation time in ms
@@ -153,6 +164,10 @@ class SimulationRT: public Simulation {
   std::shared_ptr<ActionBuffer> actionBuffer_;                  ///< Action buffer
   std::shared_ptr<InputDispatcherAsync> inputDispatcherAsync_;  ///< Input dispatcher
   std::shared_ptr<OutputDispatcher> outputDispatcher_;          ///< Output dispatcher
+  DeadlineMonitor deadlineMonitor_;                             ///< Deadline and latency statistics of the coupling periods
+  std::chrono::steady_clock::time_point lastTelemetry_;         ///< Clock time of the last telemetry publication
+  unsigned int degradeAfterOverruns_;                           ///< Consecutive overruns (or periods with margin) before switching the solver settings, 0 to disable
+  bool degradedMode_;                                           ///< The solver uses its cheaper settings
 };
 
 }  // end of namespace DYN
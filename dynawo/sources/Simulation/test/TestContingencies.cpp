@@ -0,0 +1,151 @@
+//
+// Copyright (c) 2015-2019, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file Simulation/TestContingencies.cpp
+ * @brief Unit tests of the batch of contingencies
+ *
+ */
+
+#include <csignal>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/string/split.hpp>
+#include <boost/algorithm/string/classification.hpp>
+
+#include "gtest_dynawo.h"
+#include "DYNSimulation.h"
+#include "DYNFileSystemUtils.h"
+
+namespace DYN {
+
+/**
+ * @brief create a contingency without action
+ *
+ * @param id id of the contingency
+ *
+ * @return the contingency
+ */
+static Simulation::Contingency
+contingency(const std::string& id) {
+  Simulation::Contingency contingency;
+  contingency.id_ = id;
+  return contingency;
+}
+
+/**
+ * @brief read the fields of the lines of a csv file
+ *
+ * @param fileName file to read
+ *
+ * @return the fields of each line
+ */
+static std::vector<std::vector<std::string> >
+readCsv(const std::string& fileName) {
+  std::vector<std::vector<std::string> > lines;
+  std::ifstream file(fileName.c_str());
+  std::string line;
+  while (std::getline(file, line)) {
+    std::vector<std::string> fields;
+    boost::algorithm::split(fields, line, boost::is_any_of(";"));
+    lines.push_back(fields);
+  }
+  return lines;
+}
+
+/**
+ * @brief simulate a contingency in a forked process: its id is its outcome
+ */
+static int
+runTestContingency(const Simulation::Contingency& contingency, const std::string& outputsDirectory, std::string& error) {
+  if (!isDirectory(outputsDirectory))
+    createDirectory(outputsDirectory);
+  if (contingency.id_ == "failing") {
+    error = "simulation failed";
+    return 2;
+  }
+  if (contingency.id_ == "crashing")
+    std::raise(SIGKILL);
+  return 0;
+}
+
+TEST(SimulationTest, testContingenciesWithFailure) {
+  const std::string outputsDirectory = createAbsolutePath("contingenciesWithFailure", currentPath());
+  if (exists(outputsDirectory))
+    boost::filesystem::remove_all(outputsDirectory);
+  createDirectory(outputsDirectory);
+
+  std::vector<Simulation::Contingency> contingencies;
+  contingencies.push_back(contingency("ok"));
+  contingencies.push_back(contingency("failing"));
+  contingencies.push_back(contingency("crashing"));
+  contingencies.push_back(contingency("ok2"));
+  contingencies.back().actions_.push_back("action");
+
+  // the failures do not stop the batch, they are reported once all the contingencies are simulated
+  ASSERT_THROW_DYNAWO(Simulation::runContingencies(contingencies, 2, false, outputsDirectory, runTestContingency),
+      Error::SIMULATION, KeyError_t::ContingenciesFailure);
+
+  const std::string contingenciesDirectory = createAbsolutePath("contingencies", outputsDirectory);
+  std::map<std::string, std::vector<std::string> > statuses;
+  for (const auto& c : contingencies) {
+    const std::vector<std::vector<std::string> > status = readCsv(createAbsolutePath("contingencyStatus.csv",
+        createAbsolutePath(c.id_, contingenciesDirectory)));
+    ASSERT_EQ(status.size(), 1U);
+    ASSERT_EQ(status[0].size(), 4U);
+    statuses[c.id_] = status[0];
+  }
+  ASSERT_EQ(statuses["ok"][0], "0");
+  ASSERT_EQ(statuses["ok"][3], "");
+  ASSERT_EQ(statuses["ok2"][0], "0");
+  ASSERT_EQ(statuses["failing"][0], "2");
+  ASSERT_EQ(statuses["failing"][3], "simulation failed");
+  // the process killed did not write its status: the parent did
+  ASSERT_EQ(statuses["crashing"][0], "-1");
+  ASSERT_FALSE(statuses["crashing"][3].empty());
+
+  const std::vector<std::vector<std::string> > summary = readCsv(createAbsolutePath("summary.csv", contingenciesDirectory));
+  ASSERT_EQ(summary.size(), contingencies.size() + 1);
+  ASSERT_EQ(summary[0].size(), 7U);
+  ASSERT_EQ(summary[0][0], "id");
+  ASSERT_EQ(summary[0][1], "status");
+  // the summary follows the order of the batch
+  for (size_t i = 0; i < contingencies.size(); ++i) {
+    const std::vector<std::string>& line = summary[i + 1];
+    ASSERT_EQ(line.size(), 7U);
+    ASSERT_EQ(line[0], contingencies[i].id_);
+    ASSERT_EQ(line[1], statuses[contingencies[i].id_][0] == "0" ? "success" : "failure");
+    ASSERT_EQ(line[2], statuses[contingencies[i].id_][0]);
+  }
+  ASSERT_EQ(summary[4][6], "action");
+
+  // the run times of the batch order the next one
+  ASSERT_EQ(readCsv(createAbsolutePath("contingencyRunTimes.csv", outputsDirectory)).size(), contingencies.size());
+
+  // a batch shared with another process only simulates the contingencies not claimed yet: the ones whose directory is removed
+  boost::filesystem::remove_all(createAbsolutePath("failing", contingenciesDirectory));
+  boost::filesystem::remove_all(createAbsolutePath("crashing", contingenciesDirectory));
+  ASSERT_NO_THROW(Simulation::runContingencies(contingencies, 1, true, outputsDirectory,
+      [](const Simulation::Contingency& c, const std::string&, std::string&) {
+        return (c.id_ == "failing" || c.id_ == "crashing") ? 0 : 3;
+      }));
+  const std::vector<std::vector<std::string> > sharedSummary = readCsv(createAbsolutePath("summary.csv", contingenciesDirectory));
+  ASSERT_EQ(sharedSummary.size(), contingencies.size() + 1);
+  for (size_t i = 1; i < sharedSummary.size(); ++i)
+    ASSERT_EQ(sharedSummary[i][1], "success");
+}
+
+}  // namespace DYN
@@ -0,0 +1,114 @@
+//
+// Copyright (c) 2015-2019, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file Simulation/TestParallelJobs.cpp
+ * @brief Unit tests of the jobs run in parallel by the launcher
+ *
+ */
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "gtest_dynawo.h"
+#include "DYNSimulationLauncher.h"
+#include "DYNFileSystemUtils.h"
+#include "DYNTrace.h"
+
+namespace DYN {
+
+/**
+ * @brief count the lines of a file containing a text
+ *
+ * @param fileName file to read
+ * @param text text to look for
+ *
+ * @return number of lines containing the text
+ */
+static unsigned
+countLines(const std::string& fileName, const std::string& text) {
+  std::ifstream file(fileName.c_str());
+  std::string line;
+  unsigned nbLines = 0;
+  while (std::getline(file, line)) {
+    if (line.find(text) != std::string::npos)
+      ++nbLines;
+  }
+  return nbLines;
+}
+
+/**
+ * @brief write the description of a job failing on its missing dyd file once its logs are configured
+ *
+ * @param stream stream to write in
+ * @param name name of the job
+ */
+static void
+writeFailingJob(std::ofstream& stream, const std::string& name) {
+  stream << "  <dyn:job name=\"" << name << "\">\n"
+         << "    <dyn:solver lib=\"dynawo_SolverIDA\" parFile=\"solvers.par\" parId=\"1\"/>\n"
+         << "    <dyn:modeler compileDir=\"compilation\">\n"
+         << "      <dyn:dynModels dydFile=\"missing_" << name << ".dyd\"/>\n"
+         << "    </dyn:modeler>\n"
+         << "    <dyn:simulation startTime=\"0\" stopTime=\"1\"/>\n"
+         << "    <dyn:outputs directory=\"outputs_" << name << "\">\n"
+         << "      <dyn:logs>\n"
+         << "        <dyn:appender tag=\"\" file=\"dynawo.log\" lvlFilter=\"INFO\" asynchronous=\"true\"/>\n"
+         << "      </dyn:logs>\n"
+         << "    </dyn:outputs>\n"
+         << "  </dyn:job>\n";
+}
+
+TEST(SimulationTest, testJobsInParallel) {
+  setenv("DYNAWO_LOCALE", "en_GB", 0);
+  const std::string directory = "parallelJobs";
+  if (isDirectory(directory))
+    removeAllInDirectory(directory);
+  else
+    createDirectory(directory);
+  const std::string jobsFile = directory + "/parallel.jobs";
+  {
+    std::ofstream stream(jobsFile.c_str());
+    stream << "<?xml version='1.0' encoding='UTF-8'?>\n<dyn:jobs xmlns:dyn=\"http://www.rte-france.com/dynawo\">\n";
+    writeFailingJob(stream, "first");
+    writeFailingJob(stream, "second");
+    stream << "</dyn:jobs>\n";
+  }
+
+  // a record still queued in an asynchronous appender of the launcher when it forks must be written once
+  Trace::init();
+  Trace::TraceAppender app;
+  app.setTag("ParallelJobsTest");
+  app.setFilePath(directory + "/launcher.log");
+  app.setLvlFilter(INFO);
+  app.setAsynchronous(true);
+  std::vector<Trace::TraceAppender> appenders;
+  appenders.push_back(app);
+  Trace::clearAndAddAppenders(appenders);
+  Trace::info("ParallelJobsTest") << "jobs launched" << Trace::endline;
+
+  // both jobs run in their own process up to their failure, the launcher reporting them once both are over
+  ASSERT_THROW_DYNAWO(launchSimu(jobsFile, false, 2), Error::SIMULATION, KeyError_t::ParallelJobsFailure);
+  Trace::resetCustomAppenders();
+
+  ASSERT_EQ(countLines(directory + "/launcher.log", "jobs launched"), 1);
+  ASSERT_EQ(countLines(directory + "/outputs_first/logs/dynawo.log", "missing_first.dyd"), 1);
+  ASSERT_EQ(countLines(directory + "/outputs_second/logs/dynawo.log", "missing_second.dyd"), 1);
+  ASSERT_EQ(countLines(directory + "/outputs_first/logs/dynawo.log", "missing_second.dyd"), 0);
+  removeAllInDirectory(directory);
+  remove(directory);
+}
+
+}  // namespace DYN
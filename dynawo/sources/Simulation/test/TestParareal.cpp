@@ -0,0 +1,219 @@
+//
+// Copyright (c) 2015-2019, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file Simulation/TestParareal.cpp
+ * @brief Unit tests of the parareal algorithm
+ *
+ */
+
+#include <cmath>
+#include <vector>
+
+#include "gtest_dynawo.h"
+#include "DYNSimulation.h"
+#include "DYNStateBuffer.h"
+
+namespace DYN {
+
+/**
+ * @brief damped oscillator x' = v, v' = -x - 0.1 v: the coarse propagator is the explicit Euler method with ten steps by slice,
+ * the fine one the classical Runge-Kutta method with a small step, recording the position at each step as outputs
+ */
+class OscillatorPropagator : public Simulation::PararealPropagator {
+ public:
+  /**
+   * @brief constructor
+   */
+  OscillatorPropagator() :
+  t_(0.),
+  y_(2),
+  yp_(2) {
+    y_[0] = 1.;
+    y_[1] = 0.;
+    updateDerivatives();
+  }
+
+  void snapshotState(StateBuffer& state) const override {
+    state.clear();
+    state.write(t_);
+    state.write(y_);
+  }
+
+  void restoreState(const StateBuffer& state) override {
+    StateBuffer::Reader reader(state);
+    reader.read(t_);
+    reader.read(y_);
+    updateDerivatives();
+  }
+
+  void propagate(const double tEnd, const bool coarse) override {
+    if (coarse) {
+      const double h = (tEnd - t_) / 10;
+      for (unsigned i = 0; i < 10; ++i) {
+        const std::vector<double> yp = f(y_);
+        y_ = shift(y_, yp, h);
+      }
+    } else {
+      const unsigned nbSteps = static_cast<unsigned>(std::ceil((tEnd - t_) / 1.e-3));
+      const double h = (tEnd - t_) / nbSteps;
+      for (unsigned i = 0; i < nbSteps; ++i) {
+        const std::vector<double> k1 = f(y_);
+        const std::vector<double> k2 = f(shift(y_, k1, h / 2));
+        const std::vector<double> k3 = f(shift(y_, k2, h / 2));
+        const std::vector<double> k4 = f(shift(y_, k3, h));
+        for (unsigned j = 0; j < 2; ++j)
+          y_[j] += h / 6 * (k1[j] + 2 * k2[j] + 2 * k3[j] + k4[j]);
+        recordedPoints_.push_back((i + 1 == nbSteps) ? tEnd : t_ + (i + 1) * h);
+        recordedPoints_.push_back(y_[0]);
+      }
+    }
+    t_ = tEnd;
+    updateDerivatives();
+  }
+
+  const std::vector<double>& getCurrentY() const override {
+    return y_;
+  }
+
+  const std::vector<double>& getCurrentYP() const override {
+    return yp_;
+  }
+
+  void setContinuousVariables(const std::vector<double>& y, const std::vector<double>& yp) override {
+    y_ = y;
+    yp_ = yp;
+  }
+
+  void startOutputsRecording() override {
+    recordedPoints_.clear();
+  }
+
+  void snapshotOutputs(StateBuffer& outputs) const override {
+    outputs.clear();
+    outputs.write(recordedPoints_.size());
+    outputs.write(recordedPoints_);
+  }
+
+  void appendOutputs(const StateBuffer& outputs) override {
+    StateBuffer::Reader reader(outputs);
+    std::size_t nbValues = 0;
+    reader.read(nbValues);
+    std::vector<double> points(nbValues);
+    reader.read(points);
+    points_.insert(points_.end(), points.begin(), points.end());
+  }
+
+  /**
+   * @brief get the points appended as outputs
+   *
+   * @return time and position of each point
+   */
+  const std::vector<double>& getPoints() const {
+    return points_;
+  }
+
+  /**
+   * @brief get the time of the current state
+   *
+   * @return the time of the current state
+   */
+  double getTime() const {
+    return t_;
+  }
+
+ private:
+  /**
+   * @brief evaluate the derivatives of the oscillator
+   *
+   * @param y position and speed
+   *
+   * @return the derivatives of y
+   */
+  static std::vector<double> f(const std::vector<double>& y) {
+    std::vector<double> yp(2);
+    yp[0] = y[1];
+    yp[1] = -y[0] - 0.1 * y[1];
+    return yp;
+  }
+
+  /**
+   * @brief move a state along a direction
+   *
+   * @param y state to move
+   * @param direction direction of the move
+   * @param step length of the move
+   *
+   * @return the moved state
+   */
+  static std::vector<double> shift(const std::vector<double>& y, const std::vector<double>& direction, const double step) {
+    std::vector<double> shifted(y);
+    for (unsigned j = 0; j < shifted.size(); ++j)
+      shifted[j] += step * direction[j];
+    return shifted;
+  }
+
+  /**
+   * @brief update the derivatives from the current state
+   */
+  void updateDerivatives() {
+    yp_ = f(y_);
+  }
+
+  double t_;  ///< time of the current state
+  std::vector<double> y_;  ///< position and speed
+  std::vector<double> yp_;  ///< derivatives of the position and of the speed
+  std::vector<double> recordedPoints_;  ///< time and position at each step of the fine propagations since the recording started
+  std::vector<double> points_;  ///< time and position of the points appended as outputs
+};
+
+TEST(SimulationTest, testPararealConvergesToSequentialRun) {
+  const unsigned nbSlices = 8;
+  const double tStop = 4.;
+  OscillatorPropagator sequential;
+  for (unsigned n = 1; n <= nbSlices; ++n)
+    sequential.propagate(tStop * n / nbSlices, false);
+  OscillatorPropagator coarse;
+  for (unsigned n = 1; n <= nbSlices; ++n)
+    coarse.propagate(tStop * n / nbSlices, true);
+  const double coarseError = std::abs(coarse.getCurrentY()[0] - sequential.getCurrentY()[0]);
+  ASSERT_GT(coarseError, 1.e-2);
+
+  // the corrections fall below the tolerance well before every slice starts from an exact state
+  OscillatorPropagator parareal;
+  ASSERT_TRUE(Simulation::runParareal(0., tStop, nbSlices, 5, 1.e-6, parareal));
+  ASSERT_DOUBLE_EQUALS_DYNAWO(parareal.getTime(), tStop);
+  for (unsigned j = 0; j < 2; ++j)
+    ASSERT_NEAR(parareal.getCurrentY()[j], sequential.getCurrentY()[j], 1.e-6);
+
+  // once every slice started from an exact state, the final state is the sequential one
+  OscillatorPropagator exact;
+  ASSERT_TRUE(Simulation::runParareal(0., tStop, nbSlices, nbSlices, 0., exact));
+  for (unsigned j = 0; j < 2; ++j)
+    ASSERT_DOUBLE_EQUALS_DYNAWO(exact.getCurrentY()[j], sequential.getCurrentY()[j]);
+  // and the outputs are the points of the fine propagation of each slice, in the order of the slices
+  const std::vector<double>& points = exact.getPoints();
+  ASSERT_GE(points.size(), 2 * nbSlices * 500);
+  for (std::size_t i = 2; i < points.size(); i += 2)
+    ASSERT_GT(points[i], points[i - 2]);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(points[points.size() - 2], tStop);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(points.back(), sequential.getCurrentY()[0]);
+
+  // a single iteration corrects the coarse propagation without converging
+  OscillatorPropagator oneIteration;
+  ASSERT_FALSE(Simulation::runParareal(0., tStop, nbSlices, 1, 1.e-6, oneIteration));
+  ASSERT_DOUBLE_EQUALS_DYNAWO(oneIteration.getTime(), tStop);
+  ASSERT_LT(std::abs(oneIteration.getCurrentY()[0] - sequential.getCurrentY()[0]), coarseError / 10);
+}
+
+}  // namespace DYN
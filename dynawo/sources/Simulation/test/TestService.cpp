@@ -0,0 +1,134 @@
+//
+// Copyright (c) 2015-2019, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file Simulation/TestService.cpp
+ * @brief Unit tests of the simulation service
+ *
+ */
+
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <string>
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "gtest_dynawo.h"
+#include "DYNSimulationLauncher.h"
+#include "DYNFileSystemUtils.h"
+
+namespace DYN {
+
+/**
+ * @brief connect a client to the service, waiting for the service to listen
+ *
+ * @param socketPath path of the socket of the service
+ *
+ * @return socket connected to the service, -1 if the service did not listen in time
+ */
+static int
+connectToService(const std::string& socketPath) {
+  sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+  for (unsigned attempt = 0; attempt < 100; ++attempt) {
+    const int clientSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (clientSocket < 0)
+      return -1;
+    if (connect(clientSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0) {
+      // a broken service must fail the test, not block it
+      timeval timeout;
+      timeout.tv_sec = 30;
+      timeout.tv_usec = 0;
+      setsockopt(clientSocket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+      return clientSocket;
+    }
+    close(clientSocket);
+    usleep(100000);
+  }
+  return -1;
+}
+
+/**
+ * @brief read the response of the service to a client
+ *
+ * @param clientSocket socket connected to the service
+ *
+ * @return line sent by the service, without its new line
+ */
+static std::string
+readServiceResponse(const int clientSocket) {
+  std::string response;
+  char c = 0;
+  while (read(clientSocket, &c, 1) == 1 && c != '\n')
+    response += c;
+  return response;
+}
+
+TEST(SimulationTest, testServiceRequests) {
+  // relative path: the socket path length is limited
+  const std::string socketPath = "service.sock";
+  const pid_t service = fork();
+  ASSERT_GE(service, 0);
+  if (service == 0) {
+    int exitCode = 0;
+    try {
+      // a single worker: the silent client must not keep it from the next request
+      serveSimu(socketPath, 1, 1);
+    } catch (...) {
+      exitCode = 1;
+    }
+    _exit(exitCode);
+  }
+
+  const int silentClient = connectToService(socketPath);
+  const int client = connectToService(socketPath);
+  // only the user of the service may connect
+  struct stat socketStat;
+  const bool socketFound = stat(socketPath.c_str(), &socketStat) == 0;
+  bool requestSent = false;
+  if (silentClient >= 0 && client >= 0) {
+    const std::string request = "unknownJobs.jobs\n";
+    requestSent = write(client, request.data(), request.size()) == static_cast<ssize_t>(request.size());
+  }
+  const std::string silentResponse = silentClient >= 0 ? readServiceResponse(silentClient) : "";
+  const std::string response = client >= 0 ? readServiceResponse(client) : "";
+  if (silentClient >= 0)
+    close(silentClient);
+  if (client >= 0)
+    close(client);
+
+  kill(service, SIGTERM);
+  int status = 0;
+  while (waitpid(service, &status, 0) < 0 && errno == EINTR) {}
+  ASSERT_GE(silentClient, 0);
+  ASSERT_GE(client, 0);
+  ASSERT_TRUE(socketFound);
+  ASSERT_EQ(socketStat.st_mode & 0777, 0600);
+  ASSERT_TRUE(requestSent);
+  // the silent client and the unknown jobs file are general errors
+  ASSERT_EQ(silentResponse, "4");
+  ASSERT_EQ(response, "4");
+  ASSERT_TRUE(WIFEXITED(status));
+  ASSERT_EQ(WEXITSTATUS(status), 0);
+  ASSERT_FALSE(exists(socketPath));
+}
+
+}  // namespace DYN
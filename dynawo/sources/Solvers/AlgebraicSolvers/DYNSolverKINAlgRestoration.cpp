@@ -22,6 +22,7 @@
 #include <sundials/sundials_types.h>
 #include <nvector/nvector_serial.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <cmath>
@@ -29,6 +30,7 @@
 #include "DYNSolverKINAlgRestoration.h"
 #include "DYNModel.h"
 #include "DYNSolverCommon.h"
+#include "DYNParallelVector.h"
 #include "DYNSparseMatrix.h"
 
 #include "DYNTrace.h"
@@ -46,6 +48,8 @@ SolverKINAlgRestoration::stringFromMode(const modeKin_t mode) {
       return "algebraic";
     case KIN_DERIVATIVES:
       return "derivatives";
+    case KIN_EQUILIBRIUM:
+      return "equilibrium";
     default:
       throw DYNError(Error::GENERAL, InvalidAlgebraicMode, static_cast<int>(mode));
   }
@@ -54,6 +58,15 @@ SolverKINAlgRestoration::stringFromMode(const modeKin_t mode) {
 SolverKINAlgRestoration::SolverKINAlgRestoration(const bool printReinitResiduals) :
 SolverKINCommon(),
 mode_(KIN_ALGEBRAIC),
+localRestoration_(false),
+jacobianToEvaluate_(false),
+fnormtol_(0.),
+initialaddtol_(0.),
+scsteptol_(0.),
+mxnewtstep_(0.),
+msbset_(0),
+mxiter_(0),
+printfl_(0),
 printReinitResiduals_(printReinitResiduals) {
 #if _DEBUG_
   checkJacobian_ = false;
@@ -67,7 +80,7 @@ SolverKINAlgRestoration::~SolverKINAlgRestoration() {
 void
 SolverKINAlgRestoration::cleanAlgebraicVectors() {
   if (sundialsVectorY_ != NULL) {
-    N_VDestroy_Serial(sundialsVectorY_);
+    N_VDestroy(sundialsVectorY_);
     sundialsVectorY_ = NULL;
   }
 }
@@ -135,9 +148,19 @@ SolverKINAlgRestoration::initVarAndEqTypes() {
       }
       break;
     }
+    case KIN_EQUILIBRIUM: {
+      for (int i = 0; i < model_->sizeF(); ++i) {
+        indexF_.push_back(i);
+        indexY_.push_back(i);
+        ++numF;
+      }
+      break;
+    }
   }
 
   assert(numF == indexY_.size());
+  // the Jacobian is transposed: its rows are the variables and its columns the equations
+  jacobianExtraction_.setErased(ignoreY_, ignoreF_, model_->sizeY(), model_->sizeF());
 
   if (ignoreF_.size() != ignoreY_.size() || indexF_.size() != indexY_.size()) {
 #ifdef _DEBUG_
@@ -161,36 +184,52 @@ SolverKINAlgRestoration::initVarAndEqTypes() {
 void
 SolverKINAlgRestoration::setupNewAlgebraicRestoration(const double fnormtol, const double initialaddtol, const double scsteptol,
   const double mxnewtstep, const int msbset, const int mxiter, int const printfl) {
+  fnormtol_ = fnormtol;
+  initialaddtol_ = initialaddtol;
+  scsteptol_ = scsteptol;
+  mxnewtstep_ = mxnewtstep;
+  msbset_ = msbset;
+  mxiter_ = mxiter;
+  printfl_ = printfl;
+
   const unsigned int numFPrevious = numF_;
   numF_ = initVarAndEqTypes();
   if (numF_ == 0)
     return;
-  const bool initKinsol = numFPrevious != numF_;
-  if (initKinsol) {
-    // warning: model_->sizeF() != numF_
-    // model_->sizeF() is fixed during the whole simulation
-    // numF_ could vary
-    vectorF_.resize(model_->sizeF());
-
-    vectorYOrYpSolution_.assign(numF_, 0.);
-    cleanAlgebraicVectors();
-    sundialsVectorY_ = N_VMake_Serial(numF_, &(vectorYOrYpSolution_[0]), sundialsContext_);
-
-    if (sundialsVectorY_ == NULL)
-      throw DYNError(Error::SUNDIALS_ERROR, SolverCreateYY);
-
-    clean();
-    switch (mode_) {
-      case KIN_ALGEBRAIC:
-        initCommon(fnormtol, initialaddtol, scsteptol, mxnewtstep, msbset, mxiter, printfl, evalF_KIN, evalJ_KIN, sundialsVectorY_);
-        break;
-      case KIN_DERIVATIVES:
-        initCommon(fnormtol, initialaddtol, scsteptol, mxnewtstep, msbset, mxiter, printfl, evalF_KIN, evalJPrim_KIN, sundialsVectorY_);
-        break;
-    }
-  } else {
+  if (numFPrevious != numF_)
+    initKINSOL();
+  else
     updateKINSOLSettings(fnormtol, initialaddtol, scsteptol, mxnewtstep, msbset, mxiter, printfl);
+}
+
+void
+SolverKINAlgRestoration::initKINSOL() {
+  // warning: model_->sizeF() != numF_
+  // model_->sizeF() is fixed during the whole simulation
+  // numF_ could vary
+  vectorF_.resize(model_->sizeF());
+
+  vectorYOrYpSolution_.assign(numF_, 0.);
+  cleanAlgebraicVectors();
+  sundialsVectorY_ = ParallelVector::make(numF_, &(vectorYOrYpSolution_[0]), vectorThreadPool_, sundialsContext_);
+
+  if (sundialsVectorY_ == NULL)
+    throw DYNError(Error::SUNDIALS_ERROR, SolverCreateYY);
+
+  clean();
+  switch (mode_) {
+    case KIN_ALGEBRAIC:
+      initCommon(fnormtol_, initialaddtol_, scsteptol_, mxnewtstep_, msbset_, mxiter_, printfl_, evalF_KIN, evalJ_KIN, sundialsVectorY_);
+      break;
+    case KIN_DERIVATIVES:
+      initCommon(fnormtol_, initialaddtol_, scsteptol_, mxnewtstep_, msbset_, mxiter_, printfl_, evalF_KIN, evalJPrim_KIN, sundialsVectorY_);
+      break;
+    case KIN_EQUILIBRIUM:
+      initCommon(fnormtol_, initialaddtol_, scsteptol_, mxnewtstep_, msbset_, mxiter_, printfl_, evalF_KIN, evalJEquilibrium_KIN, sundialsVectorY_);
+      break;
   }
+  // a new KINSOL memory has no Jacobian to reuse
+  jacobianToEvaluate_ = true;
 }
 
 void
@@ -244,8 +283,8 @@ SolverKINAlgRestoration::evalF_KIN(N_Vector yy, N_Vector rr, void *data) {
     solver->setFirstIteration(false);
   } else {
     try {
-      if (solver->mode_ == KIN_ALGEBRAIC) {
-        // add current values of algebraic variables
+      if (solver->mode_ == KIN_ALGEBRAIC || solver->mode_ == KIN_EQUILIBRIUM) {
+        // add current values of algebraic variables (or of all variables for the equilibrium)
         for (unsigned int i = 0; i < solver->indexY_.size(); ++i) {
           solver->vectorYForRestoration_[solver->indexY_[i]] = iyy[i];
         }
@@ -318,21 +357,21 @@ SolverKINAlgRestoration::evalJ_KIN(N_Vector /*yy*/, N_Vector /*rr*/,
   Model& model = solver->getModel();
 
   constexpr double cj = 1.;
-  SparseMatrix smj;
+  SparseMatrix& smj = solver->smjFull_;
   smj.init(model.sizeY(), model.sizeY());
   model.evalJt(solver->t0_, cj, smj);
 
-  // Erase useless values in the jacobian
-  SparseMatrix smjKin;
+  // Erase useless values in the jacobian, by a gather of the kept terms while the structure does not change
+  SparseMatrix& smjKin = solver->smj_;
   const int size = static_cast<int>(solver->indexY_.size());
-  smjKin.reserve(size);
-  smj.erase(solver->ignoreY_, solver->ignoreF_, smjKin);
+  smj.extract(solver->jacobianExtraction_, smjKin);
 #if _DEBUG_
   if (solver->checkJacobian_) {
     checkJacobian(smjKin, model);
   }
 #endif
-  SolverCommon::propagateMatrixStructureChangeToKINSOL(smjKin, JJ, size, &solver->lastRowVals_, solver->linearSolver_, true);
+  SolverCommon::propagateMatrixStructureChangeToKINSOL(smjKin, JJ, size, &solver->lastRowVals_, solver->lastStructureVersion_, solver->lastStructureHash_,
+      solver->linearSolver_, true, solver->symbolicAnalysisCache_.get());
 
   return 0;
 }
@@ -345,16 +384,34 @@ SolverKINAlgRestoration::evalJPrim_KIN(N_Vector /*yy*/, N_Vector /*rr*/,
 
   constexpr double cj = 1.;
 
-  SparseMatrix smj;
+  SparseMatrix& smj = solver->smjFull_;
   smj.init(model.sizeY(), model.sizeY());
   model.evalJtPrim(solver->t0_, cj, smj);
 
-  // Erase useless values in the jacobian
-  SparseMatrix smjKin;
+  // Erase useless values in the jacobian, by a gather of the kept terms while the structure does not change
+  SparseMatrix& smjKin = solver->smj_;
   const int size = static_cast<int>(solver->indexY_.size());
-  smjKin.reserve(size);
-  smj.erase(solver->ignoreY_, solver->ignoreF_, smjKin);
-  SolverCommon::propagateMatrixStructureChangeToKINSOL(smjKin, JJ, size, &solver->lastRowVals_, solver->linearSolver_, true);
+  smj.extract(solver->jacobianExtraction_, smjKin);
+  SolverCommon::propagateMatrixStructureChangeToKINSOL(smjKin, JJ, size, &solver->lastRowVals_, solver->lastStructureVersion_, solver->lastStructureHash_,
+      solver->linearSolver_, true, solver->symbolicAnalysisCache_.get());
+
+  return 0;
+}
+
+int
+SolverKINAlgRestoration::evalJEquilibrium_KIN(N_Vector /*yy*/, N_Vector /*rr*/,
+        SUNMatrix JJ, void* data, N_Vector /*tmp1*/, N_Vector /*tmp2*/) {
+  SolverKINAlgRestoration* solver = reinterpret_cast<SolverKINAlgRestoration*> (data);
+  Model& model = solver->getModel();
+
+  // derivatives are fixed to zero so only @F/@y is kept
+  constexpr double cj = 0.;
+  const int size = model.sizeY();
+  SparseMatrix& smjKin = solver->smj_;
+  smjKin.init(size, size);
+  model.evalJt(solver->t0_, cj, smjKin);
+  SolverCommon::propagateMatrixStructureChangeToKINSOL(smjKin, JJ, size, &solver->lastRowVals_, solver->lastStructureVersion_, solver->lastStructureHash_,
+      solver->linearSolver_, true, solver->symbolicAnalysisCache_.get());
 
   return 0;
 }
@@ -376,9 +433,10 @@ void SolverKINAlgRestoration::restoreState() {
 
 int SolverKINAlgRestoration::solveStrategy(const bool noInitSetup, const bool evaluateOnlyModeAtFirstIter, const int kinsolStategy,
   const bool multipleStrategiesForAlgebraicRestoration) {
-  int flag = KINSetNoInitSetup(KINMem_, noInitSetup);
+  int flag = KINSetNoInitSetup(KINMem_, noInitSetup && !jacobianToEvaluate_);
   if (flag < 0)
     throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorKINSOL, "KINSetNoInitSetup");
+  jacobianToEvaluate_ = false;
 
   // first evaluation of F in order to fill the scaling vector
   firstIteration_ = true;
@@ -416,6 +474,12 @@ SolverKINAlgRestoration::solve(const bool noInitSetup, const bool evaluateOnlyMo
   if (numF_ == 0)
     return KIN_SUCCESS;
 
+  if (localRestoration_ && mode_ == KIN_ALGEBRAIC) {
+    int flag = 0;
+    if (solveCoupledBlock(evaluateOnlyModeAtFirstIter, flag))
+      return flag;
+  }
+
   if (multipleStrategiesForAlgebraicRestoration)
     saveState();
 
@@ -434,6 +498,138 @@ SolverKINAlgRestoration::solve(const bool noInitSetup, const bool evaluateOnlyMo
   return flag;
 }
 
+void
+SolverKINAlgRestoration::findCoupledBlock(vector<int>& blockF, vector<int>& blockY) const {
+  blockF.clear();
+  blockY.clear();
+  // the Jacobian is transposed: its columns are the equations and its rows the variables
+  const int size = model_->sizeF();
+  if (smjFull_.nbCol() != size)
+    return;
+  const vector<unsigned>& Ap = smjFull_.Ap_;
+  const vector<unsigned>& Ai = smjFull_.Ai_;
+  const unsigned nbElem = static_cast<unsigned>(smjFull_.nbElem());
+
+  // equations depending on each variable
+  vector<unsigned> equationsAp(size + 1, 0);
+  for (unsigned ind = 0; ind < nbElem; ++ind)
+    ++equationsAp[Ai[ind] + 1];
+  for (int i = 0; i < size; ++i)
+    equationsAp[i + 1] += equationsAp[i];
+  vector<unsigned> equationsAi(nbElem);
+  vector<unsigned> next(equationsAp.begin(), equationsAp.end() - 1);
+  for (int iCol = 0; iCol < size; ++iCol) {
+    for (unsigned ind = Ap[iCol]; ind < Ap[iCol + 1]; ++ind)
+      equationsAi[next[Ai[ind]]++] = iCol;
+  }
+
+  // only the algebraic equations and variables are solved, the other ones cut the coupling
+  vector<bool> freeF(size, false);
+  vector<bool> freeY(size, false);
+  for (unsigned int i = 0; i < indexF_.size(); ++i)
+    freeF[indexF_[i]] = true;
+  for (unsigned int i = 0; i < indexY_.size(); ++i)
+    freeY[indexY_[i]] = true;
+
+  // breadth-first search from the equations whose residual is above the tolerance
+  vector<int> queue;
+  for (unsigned int i = 0; i < indexF_.size(); ++i) {
+    if (std::abs(vectorF_[indexF_[i]]) > fnormtol_) {
+      freeF[indexF_[i]] = false;
+      queue.push_back(indexF_[i]);
+    }
+  }
+  for (unsigned int iQueue = 0; iQueue < queue.size(); ++iQueue) {
+    const int iF = queue[iQueue];
+    blockF.push_back(iF);
+    for (unsigned ind = Ap[iF]; ind < Ap[iF + 1]; ++ind) {
+      const unsigned iY = Ai[ind];
+      if (!freeY[iY])
+        continue;
+      freeY[iY] = false;
+      blockY.push_back(static_cast<int>(iY));
+      for (unsigned indF = equationsAp[iY]; indF < equationsAp[iY + 1]; ++indF) {
+        if (freeF[equationsAi[indF]]) {
+          freeF[equationsAi[indF]] = false;
+          queue.push_back(static_cast<int>(equationsAi[indF]));
+        }
+      }
+    }
+  }
+  std::sort(blockF.begin(), blockF.end());
+  std::sort(blockY.begin(), blockY.end());
+}
+
+bool
+SolverKINAlgRestoration::solveCoupledBlock(const bool evaluateOnlyModeAtFirstIter, int& flag) {
+  if (evaluateOnlyModeAtFirstIter)
+    model_->evalFMode(t0_, &vectorYForRestoration_[0], &vectorYpForRestoration_[0], &vectorF_[0]);
+  else
+    model_->evalF(t0_, &vectorYForRestoration_[0], &vectorYpForRestoration_[0], &vectorF_[0]);
+
+  vector<int> blockF;
+  vector<int> blockY;
+  findCoupledBlock(blockF, blockY);
+  // a structurally nonsingular system has as many equations as variables in each connected component
+  if (blockF.empty() || blockF.size() != blockY.size() || blockF.size() == indexF_.size())
+    return false;
+
+  const vector<double> yInitial(vectorYForRestoration_);
+  const std::unordered_set<int> ignoreFAll(ignoreF_);
+  const std::unordered_set<int> ignoreYAll(ignoreY_);
+  for (unsigned int i = 0; i < indexF_.size(); ++i)
+    ignoreF_.insert(indexF_[i]);
+  for (unsigned int i = 0; i < indexY_.size(); ++i)
+    ignoreY_.insert(indexY_[i]);
+  for (unsigned int i = 0; i < blockF.size(); ++i) {
+    ignoreF_.erase(blockF[i]);
+    ignoreY_.erase(blockY[i]);
+  }
+  indexF_.swap(blockF);
+  indexY_.swap(blockY);
+  jacobianExtraction_.setErased(ignoreY_, ignoreF_, model_->sizeY(), model_->sizeF());
+  numF_ = static_cast<unsigned int>(indexF_.size());
+  initKINSOL();
+  for (unsigned int i = 0; i < indexY_.size(); ++i)
+    vectorYOrYpSolution_[i] = vectorYForRestoration_[indexY_[i]];
+
+  try {
+    // the residuals of the whole model have just been evaluated: only the ones of the models with mode change may be outdated
+    flag = solveStrategy(false, true, KIN_NONE);
+  } catch (const Error& e) {
+    if (e.type() != Error::SUNDIALS_ERROR)
+      throw;
+    flag = KIN_LINESEARCH_NONCONV;
+  }
+
+  bool solved = flag >= 0;
+  if (solved) {
+    for (unsigned int i = 0; i < indexY_.size(); ++i)
+      vectorYForRestoration_[indexY_[i]] = vectorYOrYpSolution_[i];
+    // the coupling graph comes from the last Jacobian, whose structure may have changed with the modes
+    model_->evalF(t0_, &vectorYForRestoration_[0], &vectorYpForRestoration_[0], &vectorF_[0]);
+    for (unsigned int i = 0; i < blockF.size() && solved; ++i) {
+      if (ignoreF_.find(blockF[i]) != ignoreF_.end())
+        solved = std::abs(vectorF_[blockF[i]]) <= fnormtol_;
+    }
+  }
+  if (solved)
+    return true;
+
+  // the whole system is solved from the initial point
+  indexF_.swap(blockF);
+  indexY_.swap(blockY);
+  ignoreF_ = ignoreFAll;
+  ignoreY_ = ignoreYAll;
+  jacobianExtraction_.setErased(ignoreY_, ignoreF_, model_->sizeY(), model_->sizeF());
+  numF_ = static_cast<unsigned int>(indexF_.size());
+  initKINSOL();
+  vectorYForRestoration_.assign(yInitial.begin(), yInitial.end());
+  for (unsigned int i = 0; i < indexY_.size(); ++i)
+    vectorYOrYpSolution_[i] = vectorYForRestoration_[indexY_[i]];
+  return false;
+}
+
 void
 SolverKINAlgRestoration::setInitialValues(const double t, const vector<double>& y, const vector<double>& yp) {
   t0_ = t;
@@ -453,6 +649,13 @@ SolverKINAlgRestoration::setInitialValues(const double t, const vector<double>&
       }
       break;
     }
+    case KIN_EQUILIBRIUM: {
+      std::fill(vectorYpForRestoration_.begin(), vectorYpForRestoration_.end(), 0.);
+      for (unsigned int i = 0; i < indexY_.size(); ++i) {
+        vectorYOrYpSolution_[i] = y[indexY_[i]];
+      }
+      break;
+    }
   }
 }
 
@@ -471,6 +674,13 @@ SolverKINAlgRestoration::getValues(vector<double>& y, vector<double>& yp) const
       }
       break;
     }
+    case KIN_EQUILIBRIUM: {
+      for (unsigned int i = 0; i < indexY_.size(); ++i) {
+        y[indexY_[i]] = vectorYOrYpSolution_[i];
+      }
+      std::fill(yp.begin(), yp.end(), 0.);
+      break;
+    }
   }
 }
 
@@ -52,12 +52,14 @@ class SolverKINAlgRestoration : public SolverKINCommon, private boost::noncopyab
   ~SolverKINAlgRestoration();
 
   /**
-   * @brief define the type of the problem to solve : only algebraic equations
-   * or only solve the new value of the derivative of differential variables
+   * @brief define the type of the problem to solve : only algebraic equations,
+   * only solve the new value of the derivative of differential variables
+   * or solve all the equations with null derivatives
    */
   typedef enum {
     KIN_ALGEBRAIC,  ///< solve only algebraic equations
-    KIN_DERIVATIVES  ///< solve the new value of the derivative of differential variables
+    KIN_DERIVATIVES,  ///< solve the new value of the derivative of differential variables
+    KIN_EQUILIBRIUM  ///< solve all the variables of the equilibrium point (derivatives equal to zero)
   } modeKin_t;
 
   /**
@@ -153,6 +155,19 @@ class SolverKINAlgRestoration : public SolverKINCommon, private boost::noncopyab
   */
   void resetAlgebraicRestoration();
 
+  /**
+   * @brief restrict the algebraic restorations to the block of equations coupled to the ones not satisfied at the initial point
+   *
+   * The block is the union of the connected components of the coupling graph given by the last evaluated Jacobian
+   * that contain an equation whose residual is above the tolerance. The whole system is solved if the residuals
+   * are not all below the tolerance once the block is solved.
+   *
+   * @param localRestoration @b true to restrict the restorations to the block
+   */
+  inline void setLocalRestoration(const bool localRestoration) {
+    localRestoration_ = localRestoration;
+  }
+
  private:
   /**
    * @brief compute F(y) for a given value of y
@@ -198,6 +213,23 @@ class SolverKINAlgRestoration : public SolverKINCommon, private boost::noncopyab
   static int evalJPrim_KIN(N_Vector yy, N_Vector rr,
           SUNMatrix JJ, void* data, N_Vector tmp1, N_Vector tmp2);
 
+  /**
+   * @brief calculate the Jacobian associate to F(u): \f$( J=@F/@u)\f$
+   * This method is used in case of resolution of F(u) = 0 for all variables
+   * with derivatives equal to zero
+   *
+   * @param yy current value of the variables to find
+   * @param rr current value of the residual function F
+   * @param JJ output Jacobian
+   * @param data pointer to user data (instance of solver)
+   * @param tmp1 unused
+   * @param tmp2 unused
+   *
+   * @return 0 is successful, positive value otherwise
+   */
+  static int evalJEquilibrium_KIN(N_Vector yy, N_Vector rr,
+          SUNMatrix JJ, void* data, N_Vector tmp1, N_Vector tmp2);
+
   /**
    * @brief computes and collects the equations and variables' types
    *
@@ -231,6 +263,32 @@ class SolverKINAlgRestoration : public SolverKINCommon, private boost::noncopyab
   static void checkJacobian(const SparseMatrix& smj, Model& model);
 #endif
 
+  /**
+   * @brief allocate the sundials vector of the solution and initialize KINSOL for the current number of equations
+   */
+  void initKINSOL();
+
+  /**
+   * @brief find the equations and variables coupled to the equations whose residual is above the tolerance
+   *
+   * @param blockF equations of the block
+   * @param blockY variables of the block
+   */
+  void findCoupledBlock(std::vector<int>& blockF, std::vector<int>& blockY) const;
+
+  /**
+   * @brief solve only the block of equations coupled to the ones not satisfied at the initial point
+   *
+   * The equations and variables are restricted to the block until the next setup if the block is solved
+   * and all the residuals are below the tolerance, otherwise the whole system is restored.
+   *
+   * @param evaluateOnlyModeAtFirstIter indicates if only residuals of models with mode change should be evaluated
+   * @param flag the flag value of the resolution of the block
+   *
+   * @return @b true if the solution of the block satisfies all the equations
+   */
+  bool solveCoupledBlock(bool evaluateOnlyModeAtFirstIter, int& flag);
+
   /**
   * @brief save state before performing algebraic restoration
   */
@@ -275,7 +333,18 @@ class SolverKINAlgRestoration : public SolverKINCommon, private boost::noncopyab
   std::unordered_set<int> ignoreY_;  ///< variables to erase form the initial set of variables
   std::vector<int> indexF_;  ///< equations to keep from the initial set of equations
   std::vector<int> indexY_;  ///< variables to keep form the initial set of variables
+  SparseMatrix smjFull_;  ///< Jacobian of the whole model, from which the Jacobian of the restored equations is extracted
+  SparseMatrix::Extraction jacobianExtraction_;  ///< variables and equations erased from the Jacobian of the whole model
   modeKin_t mode_;  ///< mode of the solver (i.e. algebraic equations or derivative)
+  bool localRestoration_;  ///< restrict the algebraic restorations to the equations coupled to the ones not satisfied
+  bool jacobianToEvaluate_;  ///< @b true if KINSOL was initialized since the last resolution and has no Jacobian yet
+  double fnormtol_;  ///< stopping tolerance on the norm of the residuals
+  double initialaddtol_;  ///< stopping tolerance at initialization
+  double scsteptol_;  ///< scaled step length tolerance
+  double mxnewtstep_;  ///< maximum allowable scaled step length
+  int msbset_;  ///< maximum number of nonlinear iterations between calls to the linear solver setup routine
+  int mxiter_;  ///< maximum number of nonlinear iterations
+  int printfl_;  ///< level of verbosity of output
 
 #if _DEBUG_
   bool checkJacobian_;  ///< Check jacobian
@@ -21,15 +21,19 @@
 #include <kinsol/kinsol.h>
 #include <sundials/sundials_linearsolver.h>
 #include <sundials/sundials_matrix.h>
-#include <sunlinsol/sunlinsol_klu.h>
 #include <sunmatrix/sunmatrix_sparse.h>
+#include <sunlinsol/sunlinsol_spgmr.h>
 #include <nvector/nvector_serial.h>
 
+#include <cmath>
 #include <sstream>
 
 #include "DYNSolverKINCommon.h"
+#include "DYNSolverCommon.h"
+#include "DYNParallelVector.h"
 #include "DYNTrace.h"
 #include "DYNMacrosMessage.h"
+#include "DYNMemoryUsage.h"
 
 using std::stringstream;
 
@@ -38,14 +42,23 @@ namespace DYN {
 SolverKINCommon::SolverKINCommon() :
 KINMem_(NULL),
 linearSolver_(NULL),
+linearSolverType_(LinearSolver::KLU),
+linearSolverNbThreads_(1),
+vectorThreadPool_(nullptr),
 sundialsMatrix_(NULL),
 sundialsVectorY_(NULL),
 lastRowVals_(NULL),
+lastStructureVersion_(0),
+lastStructureHash_(0),
 numF_(0),
 t0_(0.),
 firstIteration_(false),
 sundialsVectorFScale_(NULL),
-sundialsVectorYScale_(NULL) {
+sundialsVectorYScale_(NULL),
+jacobianFree_(false),
+evalJ_(NULL),
+krylovSolver_(NULL),
+precVectorTmp_(NULL) {
   if (SUNContext_Create(NULL, &sundialsContext_) != 0)
     throw DYNError(Error::SUNDIALS_ERROR, SolverContextCreationError);
 }
@@ -58,8 +71,34 @@ SolverKINCommon::~SolverKINCommon() {
   SUNContext_Free(&sundialsContext_);
 }
 
+void
+SolverKINCommon::setLinearSolver(const LinearSolver::linearSolverType_t type, const unsigned nbThreads,
+    const std::shared_ptr<SymbolicAnalysisCache>& symbolicAnalysisCache) {
+  linearSolverType_ = type;
+  linearSolverNbThreads_ = nbThreads;
+  symbolicAnalysisCache_ = symbolicAnalysisCache;
+}
+
+void
+SolverKINCommon::setJacobianFree(const std::vector<int>& fBlocks, const std::vector<int>& yBlocks) {
+  jacobianFree_ = true;
+  fBlocks_ = fBlocks;
+  yBlocks_ = yBlocks;
+}
+
+void
+SolverKINCommon::setMaxIterations(const int mxiter) {
+  const int flag = KINSetNumMaxIters(KINMem_, mxiter);
+  if (flag < 0)
+    throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorKINSOL, "KINSetNumMaxIters");
+}
+
 void SolverKINCommon::clean() {
+  if (symbolicAnalysisCache_ && sundialsMatrix_ != NULL && linearSolver_ != NULL && lastRowVals_ != NULL)
+    symbolicAnalysisCache_->store(linearSolver_, lastStructureHash_, SM_NP_S(sundialsMatrix_), SM_NNZ_S(sundialsMatrix_), lastRowVals_,
+                                  lastRowVals_ + SM_NNZ_S(sundialsMatrix_));
   if (sundialsMatrix_ != NULL) {
+    SolverCommon::detachSparseValues(sundialsMatrix_, false);
     SUNMatDestroy(sundialsMatrix_);
     sundialsMatrix_ = NULL;
   }
@@ -67,6 +106,15 @@ void SolverKINCommon::clean() {
     SUNLinSolFree(linearSolver_);
     linearSolver_ = NULL;
   }
+  if (krylovSolver_ != NULL) {
+    SUNLinSolFree(krylovSolver_);
+    krylovSolver_ = NULL;
+  }
+  if (precVectorTmp_ != NULL) {
+    N_VDestroy(precVectorTmp_);
+    precVectorTmp_ = NULL;
+  }
+  offBlockEntries_.clear();
   if (KINMem_ != NULL) {
     KINFree(&KINMem_);
     KINMem_ = NULL;
@@ -77,11 +125,11 @@ void SolverKINCommon::clean() {
   }
 
   if (sundialsVectorFScale_ != NULL) {
-    N_VDestroy_Serial(sundialsVectorFScale_);
+    N_VDestroy(sundialsVectorFScale_);
     sundialsVectorFScale_ = NULL;
   }
   if (sundialsVectorYScale_ != NULL) {
-    N_VDestroy_Serial(sundialsVectorYScale_);
+    N_VDestroy(sundialsVectorYScale_);
     sundialsVectorYScale_ = NULL;
   }
 }
@@ -137,12 +185,26 @@ SolverKINCommon::initCommon(const double fnormtol, const double initialaddtol, c
   sundialsMatrix_ = SUNSparseMatrix(numF_, numF_, nnz, CSR_MAT, sundialsContext_);
   if (sundialsMatrix_ == NULL)
       throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorKINSOL, "SUNSparseMatrix");
-  linearSolver_ = SUNLinSol_KLU(sundialsVectorY_, sundialsMatrix_, sundialsContext_);
-  if (linearSolver_ == NULL)
-      throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorKINSOL, "SUNLinSol_KLU");
-  flag = KINSetLinearSolver(KINMem_, linearSolver_, sundialsMatrix_);
-  if (flag < 0)
-      throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorKINSOL, "KINKLU");
+  SolverCommon::detachSparseValues(sundialsMatrix_, true);
+  linearSolver_ = LinearSolver::create(linearSolverType_, linearSolverNbThreads_, sundialsVectorY_, sundialsMatrix_, sundialsContext_);
+  if (jacobianFree_) {
+    // The sparse direct solver only factorizes the preconditioner, GMRES solves the Newton steps
+    evalJ_ = evalJ;
+    precVectorTmp_ = N_VClone(sundialsVectorY_);
+    krylovSolver_ = SUNLinSol_SPGMR(sundialsVectorY_, SUN_PREC_RIGHT, 0, sundialsContext_);
+    if (krylovSolver_ == NULL)
+      throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorKINSOL, "SUNLinSol_SPGMR");
+    flag = KINSetLinearSolver(KINMem_, krylovSolver_, NULL);
+    if (flag < 0)
+      throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorKINSOL, "KINSetLinearSolver");
+    flag = KINSetPreconditioner(KINMem_, precSetup, precSolve);
+    if (flag < 0)
+      throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorKINSOL, "KINSetPreconditioner");
+  } else {
+    flag = KINSetLinearSolver(KINMem_, linearSolver_, sundialsMatrix_);
+    if (flag < 0)
+        throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorKINSOL, "KINKLU");
+  }
 
   // Specify method to use to print error message
   flag = KINSetErrHandlerFn(KINMem_, errHandlerFn, NULL);
@@ -166,10 +228,12 @@ SolverKINCommon::initCommon(const double fnormtol, const double initialaddtol, c
   if (flag < 0)
     throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorKINSOL, "KINSetMaxNewtonStep");
 
-  // Specify the jacobian function to use
-  flag = KINSetJacFn(KINMem_, evalJ);
-  if (flag < 0)
-    throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorKINSOL, "KINSlsSetSparseJacFn");
+  // Specify the jacobian function to use, the Jacobian-vector products are approximated by difference quotients in Jacobian-free mode
+  if (!jacobianFree_) {
+    flag = KINSetJacFn(KINMem_, evalJ);
+    if (flag < 0)
+      throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorKINSOL, "KINSlsSetSparseJacFn");
+  }
 
   // Options for error/infos messages
   flag = KINSetPrintLevel(KINMem_, printfl);
@@ -178,8 +242,8 @@ SolverKINCommon::initCommon(const double fnormtol, const double initialaddtol, c
 
   vectorFScale_.resize(numF_);
   vectorYScale_.resize(numF_);
-  sundialsVectorFScale_ = N_VMake_Serial(numF_, &vectorFScale_[0], sundialsContext_);
-  sundialsVectorYScale_ = N_VMake_Serial(numF_, &vectorYScale_[0], sundialsContext_);
+  sundialsVectorFScale_ = ParallelVector::make(numF_, &vectorFScale_[0], vectorThreadPool_, sundialsContext_);
+  sundialsVectorYScale_ = ParallelVector::make(numF_, &vectorYScale_[0], vectorThreadPool_, sundialsContext_);
 }
 
 int
@@ -190,6 +254,72 @@ SolverKINCommon::solveCommon(const int strategy) {
   return flag;
 }
 
+int
+SolverKINCommon::precSetup(N_Vector uu, N_Vector /*uscale*/, N_Vector fval, N_Vector /*fscale*/, void* user_data) {
+  SolverKINCommon* solver = reinterpret_cast<SolverKINCommon*> (user_data);
+
+  const int flag = solver->evalJ_(uu, fval, solver->sundialsMatrix_, user_data, NULL, NULL);
+  if (flag != 0)
+    return flag;
+
+  solver->dropOffBlockEntries();
+  if (SUNLinSolSetup(solver->linearSolver_, solver->sundialsMatrix_) == SUNLS_SUCCESS)
+    return 0;
+
+  // The block-diagonal part is singular: the full Jacobian is factorized instead
+  Trace::debug() << DYNLog(SolverKINBlockPreconditionerSingular) << Trace::endline;
+  solver->restoreOffBlockEntries();
+  if (SUNLinSolSetup(solver->linearSolver_, solver->sundialsMatrix_) != SUNLS_SUCCESS)
+    return 1;
+  return 0;
+}
+
+int
+SolverKINCommon::precSolve(N_Vector /*uu*/, N_Vector /*uscale*/, N_Vector /*fval*/, N_Vector /*fscale*/, N_Vector vv, void* user_data) {
+  SolverKINCommon* solver = reinterpret_cast<SolverKINCommon*> (user_data);
+  if (SUNLinSolSolve(solver->linearSolver_, solver->sundialsMatrix_, solver->precVectorTmp_, vv, 0.) != SUNLS_SUCCESS)
+    return 1;
+  N_VScale(1., solver->precVectorTmp_, vv);
+  return 0;
+}
+
+void
+SolverKINCommon::dropOffBlockEntries() {
+  // The matrix stores the transposed Jacobian: each row is an equation, each column index a variable
+  const sunindextype* indexPtrs = SM_INDEXPTRS_S(sundialsMatrix_);
+  const sunindextype* indexVals = SM_INDEXVALS_S(sundialsMatrix_);
+  realtype* data = SM_DATA_S(sundialsMatrix_);
+  offBlockEntries_.clear();
+  for (unsigned int iF = 0; iF < numF_; ++iF) {
+    int block = fBlocks_[iF];
+    if (block < 0) {
+      // a connection equation belongs to the block of its largest derivative
+      double maxValue = -1.;
+      for (sunindextype k = indexPtrs[iF]; k < indexPtrs[iF + 1]; ++k) {
+        if (std::abs(data[k]) > maxValue) {
+          maxValue = std::abs(data[k]);
+          block = yBlocks_[indexVals[k]];
+        }
+      }
+    }
+    for (sunindextype k = indexPtrs[iF]; k < indexPtrs[iF + 1]; ++k) {
+      const sunindextype iY = indexVals[k];
+      if (yBlocks_[iY] != block && iY != static_cast<sunindextype>(iF) && data[k] != 0.) {
+        offBlockEntries_.push_back(std::make_pair(static_cast<unsigned int>(k), data[k]));
+        data[k] = 0.;
+      }
+    }
+  }
+}
+
+void
+SolverKINCommon::restoreOffBlockEntries() {
+  realtype* data = SM_DATA_S(sundialsMatrix_);
+  for (std::vector<std::pair<unsigned int, double> >::const_iterator it = offBlockEntries_.begin(); it != offBlockEntries_.end(); ++it)
+    data[it->first] = it->second;
+  offBlockEntries_.clear();
+}
+
 void
 SolverKINCommon::analyseFlag(const int flag) {
   stringstream msg;
@@ -274,6 +404,12 @@ SolverKINCommon::infoHandlerFn(const char* module, const char* function,
   Trace::info() << module << " " << function << " :" << msg << Trace::endline;
 }
 
+void
+SolverKINCommon::accountMemory(MemoryUsage& usage) const {
+  usage.add(MemoryUsage::SPARSE_MATRICES, smj_.getMemoryUsage() + SolverCommon::getSharedSparseMemoryUsage(sundialsMatrix_, lastRowVals_));
+  usage.add(MemoryUsage::LINEAR_SOLVER_FACTORS, LinearSolver::getMemoryUsage(linearSolver_));
+}
+
 void
 SolverKINCommon::updateStatistics(long int& nni, long int& nre, long int& nje) const {
   if (KINMem_ == NULL)
@@ -287,7 +423,11 @@ SolverKINCommon::updateStatistics(long int& nni, long int& nre, long int& nje) c
   if (flag < 0)
     throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorKINSOL, "KINGetNumFuncEvals");
 
-  flag = KINGetNumJacEvals(KINMem_, &nje);
+  // in Jacobian-free mode, the Jacobian is only evaluated to build the preconditioner
+  if (jacobianFree_)
+    flag = KINGetNumPrecEvals(KINMem_, &nje);
+  else
+    flag = KINGetNumJacEvals(KINMem_, &nje);
   if (flag < 0)
     throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorKINSOL, "KINGetNumJacEvals");
 }
@@ -32,10 +32,19 @@
 #pragma clang diagnostic pop
 #endif  // __clang__
 
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "DYNLinearSolver.h"
+#include "DYNSparseMatrix.h"
+#include "DYNSymbolicAnalysisCache.h"
+
 namespace DYN {
+class MemoryUsage;
+class ThreadPool;
 
 /**
  * @brief class SolverKINCommon: common part of all the KINSOL-based solvers
@@ -53,6 +62,36 @@ class SolverKINCommon {
    */
   ~SolverKINCommon();
 
+  /**
+   * @brief choose the sparse direct linear solver, to be called before initCommon
+   *
+   * @param type linear solver to use (KLU by default)
+   * @param nbThreads number of threads used by a multithreaded linear solver
+   * @param symbolicAnalysisCache cache of symbolic analyses to use, none by default
+   */
+  void setLinearSolver(LinearSolver::linearSolverType_t type, unsigned nbThreads, const std::shared_ptr<SymbolicAnalysisCache>& symbolicAnalysisCache);
+
+  /**
+   * @brief run the operations on the vectors created by the solver with a pool of threads, to be called before initCommon
+   *
+   * @param threadPool pool of threads, nullptr to run the operations sequentially (default)
+   */
+  void setVectorThreadPool(ThreadPool* threadPool) {
+    vectorThreadPool_ = threadPool;
+  }
+
+  /**
+   * @brief solve the Newton steps with a Jacobian-free Krylov method instead of a sparse direct solver
+   *
+   * The products of the Jacobian with a vector are approximated by difference quotients of the residual function.
+   * GMRES is right-preconditioned by the factorization of the block-diagonal part of the Jacobian, one block by sub model.
+   * Must be called before initCommon.
+   *
+   * @param fBlocks index of the block of each equation, -1 for the equations shared between blocks
+   * @param yBlocks index of the block of each variable
+   */
+  void setJacobianFree(const std::vector<int>& fBlocks, const std::vector<int>& yBlocks);
+
   /**
    * @brief initialize KINSOL memory and parameters
    *
@@ -70,6 +109,13 @@ class SolverKINCommon {
   void initCommon(double fnormtol, double initialaddtol, double scsteptol,
             double mxnewtstep, int msbset, int mxiter, int printfl, KINSysFn evalF, KINLsJacFn evalJ, N_Vector sundialsVectorY);
 
+  /**
+   * @brief change the maximum number of nonlinear iterations after the initialization
+   *
+   * @param mxiter maximum number of nonlinear iterations
+   */
+  void setMaxIterations(int mxiter);
+
   /**
    * @brief delete all internal structure allocated by init method
    */
@@ -112,6 +158,13 @@ class SolverKINCommon {
    */
   static void analyseFlag(int flag);
 
+  /**
+   * @brief account the memory allocated by the Jacobian and the linear solver
+   *
+   * @param usage memory usage to complete
+   */
+  void accountMemory(MemoryUsage& usage) const;
+
   /**
    * @brief set if solver is in first iteration step or not
    * @return @b true if first iteration, @b false otherwise
@@ -137,13 +190,60 @@ class SolverKINCommon {
    */
   void updateStatistics(long int& nni, long int& nre, long int& nje) const;
 
+ private:
+  /**
+   * @brief evaluate and factorize the block-diagonal preconditioner
+   *
+   * @param uu current variables values
+   * @param uscale scaling vector of the variables
+   * @param fval current residual values
+   * @param fscale scaling vector of the residuals
+   * @param user_data solver instance
+   *
+   * @return 0 if successful, a positive value if a recoverable error occurred
+   */
+  static int precSetup(N_Vector uu, N_Vector uscale, N_Vector fval, N_Vector fscale, void* user_data);
+
+  /**
+   * @brief apply the block-diagonal preconditioner
+   *
+   * @param uu current variables values
+   * @param uscale scaling vector of the variables
+   * @param fval current residual values
+   * @param fscale scaling vector of the residuals
+   * @param vv right-hand side on input, solution on output
+   * @param user_data solver instance
+   *
+   * @return 0 if successful, a positive value if a recoverable error occurred
+   */
+  static int precSolve(N_Vector uu, N_Vector uscale, N_Vector fval, N_Vector fscale, N_Vector vv, void* user_data);
+
+  /**
+   * @brief set to zero the Jacobian entries coupling two different blocks
+   *
+   * The removed values are saved so that the full Jacobian can be restored if the block-diagonal part is singular.
+   */
+  void dropOffBlockEntries();
+
+  /**
+   * @brief restore the Jacobian entries removed by dropOffBlockEntries
+   */
+  void restoreOffBlockEntries();
+
  protected:
   SUNContext sundialsContext_;  ///< context of sundials structure
   void* KINMem_;  ///< KINSOL internal memory structure
   SUNLinearSolver linearSolver_;  ///< Linear Solver pointer
-  SUNMatrix sundialsMatrix_;  ///< sparse SUNMatrix
+  LinearSolver::linearSolverType_t linearSolverType_;  ///< sparse direct linear solver to create
+  unsigned linearSolverNbThreads_;  ///< number of threads used by a multithreaded linear solver
+  std::shared_ptr<SymbolicAnalysisCache> symbolicAnalysisCache_;  ///< cache of symbolic analyses, may be shared with other solvers
+  ThreadPool* vectorThreadPool_;  ///< pool of threads running the operations on the vectors created by the solver, nullptr if sequential
+  SUNMatrix sundialsMatrix_;  ///< sparse SUNMatrix, sharing the values of smj_
+  SparseMatrix smj_;  ///< last evaluated Jacobian, whose values are used by the linear solver until the next evaluation
   N_Vector sundialsVectorY_;  ///< variables values stored in Sundials structure
   sunindextype* lastRowVals_;  ///< save of last Jacobian structure, to force symbolic factorization if structure change
+  uint64_t lastStructureVersion_;  ///< structure version of the last Jacobian, to copy only values if structure did not change
+  uint64_t lastStructureHash_;  ///< structure hash of the last Jacobian, to find its symbolic analysis in the cache
 
   unsigned int numF_;  ///< number of equations to solve
   double t0_;  ///< initial time to use
@@ -154,6 +254,14 @@ class SolverKINCommon {
   std::vector<double> vectorYScale_;  ///< Scaling vector for variables
   N_Vector sundialsVectorFScale_;  ///< Scaling vector for residual functions in Sundials structure
   N_Vector sundialsVectorYScale_;  ///< Scaling vector for variables in Sundials structure
+
+  bool jacobianFree_;  ///< @b true if the Newton steps are solved by a preconditioned Krylov method
+  std::vector<int> fBlocks_;  ///< block of each equation, -1 for the equations shared between blocks
+  std::vector<int> yBlocks_;  ///< block of each variable
+  KINLsJacFn evalJ_;  ///< Jacobian function, used to build the preconditioner in Jacobian-free mode
+  SUNLinearSolver krylovSolver_;  ///< GMRES solver used in Jacobian-free mode
+  N_Vector precVectorTmp_;  ///< work vector of the preconditioner solve
+  std::vector<std::pair<unsigned int, double> > offBlockEntries_;  ///< index and value of the Jacobian entries removed from the preconditioner
 };
 
 }  // end of namespace DYN
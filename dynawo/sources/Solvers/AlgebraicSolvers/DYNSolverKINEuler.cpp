@@ -36,6 +36,8 @@
 #include "DYNTimer.h"
 #include "DYNSolverCommon.h"
 #include "DYNSolver.h"
+#include "DYNConvergenceDiagnostics.h"
+#include "DYNCommon.h"
 
 using std::vector;
 
@@ -44,7 +46,8 @@ namespace DYN {
 SolverKINEuler::SolverKINEuler() :
 SolverKINCommon(),
 timeSchemeSolver_(NULL),
-printResiduals_(false) { }
+printResiduals_(false),
+initialFuncNorm_(0.) { }
 
 SolverKINEuler::~SolverKINEuler() {
   timeSchemeSolver_ = NULL;
@@ -102,6 +105,13 @@ SolverKINEuler::evalF_KIN(N_Vector yy, N_Vector rr, void* data) {
     }
   }
 
+  ConvergenceDiagnostics& convergenceDiagnostics = timeSchemeSolver.getConvergenceDiagnostics();
+  if (convergenceDiagnostics.isEnabled()) {
+    long int nni = 0;
+    KINGetNumNonlinSolvIters(solver->KINMem_, &nni);
+    convergenceDiagnostics.addIteration(solver->t0_ + timeSchemeSolver.getTimeStep(), timeSchemeSolver.getTimeStep(), nni, irr, solver->numF_);
+  }
+
   if (solver->printResiduals()) {
     // Print the current residual norms, the first one is used as a stopping criterion
     if (!solver->getFirstIteration()) {
@@ -140,11 +150,12 @@ SolverKINEuler::evalJ_KIN(N_Vector /*yy*/, N_Vector /*rr*/,
 
   // Sparse matrix version
   // ----------------------
-  SparseMatrix smj;
+  SparseMatrix& smj = solver->smj_;
   const int size = model.sizeY();
   smj.init(size, size);
   model.evalJt(solver->t0_ + h0, cj, smj);
-  SolverCommon::propagateMatrixStructureChangeToKINSOL(smj, JJ, size, &solver->lastRowVals_, solver->linearSolver_, true);
+  SolverCommon::propagateMatrixStructureChangeToKINSOL(smj, JJ, size, &solver->lastRowVals_, solver->lastStructureVersion_, solver->lastStructureHash_,
+      solver->linearSolver_, true, solver->symbolicAnalysisCache_.get());
 
   return 0;
 }
@@ -180,10 +191,27 @@ SolverKINEuler::solve(const bool noInitSetup, const bool skipAlgebraicResidualsE
     if (std::abs(currentY[i]) > RCONST(1.))
       vectorYScale_[i] = 1. / std::abs(currentY[i]);
   }
+  initialFuncNorm_ = SolverCommon::weightedL2Norm(vectorF_, vectorFScale_);
 
   flag = solveCommon(KIN_NONE);
 
   return flag;
 }
 
+double
+SolverKINEuler::getConvergenceRate() const {
+  long int nni = 0;
+  int flag = KINGetNumNonlinSolvIters(KINMem_, &nni);
+  if (flag < 0)
+    throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorKINSOL, "KINGetNumNonlinSolvIters");
+  if (nni == 0 || doubleIsZero(initialFuncNorm_))
+    return 0.;
+
+  realtype fnorm = 0.;
+  flag = KINGetFuncNorm(KINMem_, &fnorm);
+  if (flag < 0)
+    throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorKINSOL, "KINGetFuncNorm");
+  return std::pow(fnorm / initialFuncNorm_, 1. / static_cast<double>(nni));
+}
+
 }  // namespace DYN
@@ -80,6 +80,16 @@ class SolverKINEuler : public SolverKINCommon, private boost::noncopyable {
    */
   int solve(bool noInitSetup, bool skipAlgebraicResidualsEvaluation);
 
+  /**
+   * @brief get the mean convergence rate of the last resolution
+   *
+   * The rate is the geometric mean of the ratio between two successive scaled residual norms: a Jacobian close to the
+   * current point gives a rate far below 1, a stale one a rate close to 1.
+   *
+   * @return mean convergence rate of the last resolution, 0 if no Newton iteration was done
+   */
+  double getConvergenceRate() const;
+
   /**
    * @brief calculated F(u) for a given value of u
    *
@@ -139,6 +149,7 @@ class SolverKINEuler : public SolverKINCommon, private boost::noncopyable {
   std::shared_ptr<Model> model_;  ///< instance of model to interact with
   Solver* timeSchemeSolver_;  ///< instance of time-scheme solver to interact with
   bool printResiduals_;  ///< true to print residuals values
+  double initialFuncNorm_;  ///< scaled L2-norm of the residuals at the beginning of the last resolution
 };
 
 }  // namespace DYN
@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <cstring>
 #include <cmath>
+#include <memory>
 
 #include "DYNSolverKINSubModel.h"
 #include "DYNSolverCommon.h"
@@ -34,6 +35,20 @@
 
 namespace DYN {
 
+/**
+ * @brief get the cache of symbolic analyses shared by all the local initializations
+ *
+ * The instances of a model type have the same local system structure: its symbolic analysis is computed by the first
+ * instance initialized only, the others performing the numerical factorization only, whatever the thread they run in.
+ *
+ * @return the cache
+ */
+static const std::shared_ptr<SymbolicAnalysisCache>&
+sharedSymbolicAnalysisCache() {
+  static const std::shared_ptr<SymbolicAnalysisCache> cache = std::make_shared<SymbolicAnalysisCache>();
+  return cache;
+}
+
 SolverKINSubModel::SolverKINSubModel() :
 SolverKINCommon(),
 subModel_(NULL),
@@ -104,6 +119,7 @@ SolverKINSubModel::init(SubModel* subModel,
     if (localInitParameters->hasParameter("printfl"))
       printfl = localInitParameters->getParameter("printfl")->getInt();
   }
+  symbolicAnalysisCache_ = sharedSymbolicAnalysisCache();
   initCommon(fnormtol, initialaddtol, scsteptol, mxnewtstep, msbset, mxiter, printfl, evalFInit_KIN, evalJInit_KIN, sundialsVectorY_);
 
   vectorYSubModel_.assign(yBuffer, yBuffer + numF_);
@@ -143,14 +159,15 @@ SolverKINSubModel::evalJInit_KIN(N_Vector yy, N_Vector /*rr*/,
 
   // Sparse matrix
   // -------------
-  SparseMatrix smj;
+  SparseMatrix& smj = solver->smj_;
   const int size = subModel->sizeY();
   smj.init(size, size);
 
   // Arbitrary value for cj
   constexpr double cj = 1.;
   subModel->evalJt(solver->t0_, cj, 0,  smj);
-  SolverCommon::propagateMatrixStructureChangeToKINSOL(smj, JJ, size, &solver->lastRowVals_, solver->linearSolver_, false);
+  SolverCommon::propagateMatrixStructureChangeToKINSOL(smj, JJ, size, &solver->lastRowVals_, solver->lastStructureVersion_, solver->lastStructureHash_,
+      solver->linearSolver_, false, solver->symbolicAnalysisCache_.get());
 
   return 0;
 }
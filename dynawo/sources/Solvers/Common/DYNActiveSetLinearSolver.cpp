@@ -0,0 +1,516 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNActiveSetLinearSolver.cpp
+ *
+ * @brief Active set linear solver implementation
+ *
+ */
+#include <algorithm>
+#include <vector>
+#include <boost/core/noncopyable.hpp>
+#include <nvector/nvector_serial.h>
+#include <sunmatrix/sunmatrix_sparse.h>
+#include <sunlinsol/sunlinsol_klu.h>
+
+#include "DYNActiveSetLinearSolver.h"
+#include "DYNProfiler.h"
+#include "DYNMacrosMessage.h"
+#include "DYNTrace.h"
+
+namespace {
+
+/**
+ * @brief content of the active set linear solver
+ */
+struct ActiveSetContent : private boost::noncopyable {
+  /**
+   * @brief constructor
+   * @param fullSolver KLU linear solver of the whole matrix, used when no unknown is frozen
+   * @param context sundials context
+   */
+  ActiveSetContent(SUNLinearSolver fullSolver, SUNContext context) :
+  context(context),
+  fullSolver(fullSolver),
+  activeSolver(NULL),
+  activeMatrix(NULL),
+  activeX(NULL),
+  activeB(NULL),
+  analyzed(false),
+  n(0),
+  nbElements(0),
+  lastFlag(0) { }
+
+  /**
+   * @brief destructor
+   */
+  ~ActiveSetContent() {
+    releaseActiveSystem();
+    SUNLinSolFree(fullSolver);
+  }
+
+  /**
+   * @brief release the linear solver of the active system and its matrix and vectors
+   */
+  void releaseActiveSystem() {
+    if (activeSolver != NULL)
+      SUNLinSolFree(activeSolver);
+    if (activeMatrix != NULL)
+      SUNMatDestroy(activeMatrix);
+    if (activeX != NULL)
+      N_VDestroy(activeX);
+    if (activeB != NULL)
+      N_VDestroy(activeB);
+    activeSolver = NULL;
+    activeMatrix = NULL;
+    activeX = NULL;
+    activeB = NULL;
+  }
+
+  SUNContext context;  ///< sundials context, to create the active system
+  SUNLinearSolver fullSolver;  ///< KLU linear solver of the whole matrix
+  SUNLinearSolver activeSolver;  ///< KLU linear solver of the active system, NULL if no unknown is frozen or if all of them are
+  SUNMatrix activeMatrix;  ///< matrix of the active system, stored as the whole matrix
+  N_Vector activeX;  ///< solution of the active system
+  N_Vector activeB;  ///< right-hand side of the active system
+  bool analyzed;  ///< whether the frozen unknowns match the structure of the matrix
+  sunindextype n;  ///< size of the matrix
+  sunindextype nbElements;  ///< number of elements of the matrix
+  std::vector<sunindextype> frozen;  ///< frozen unknowns, in elimination order
+  std::vector<sunindextype> diagonalPositions;  ///< position in the matrix of the diagonal element of each frozen unknown
+  std::vector<sunindextype> activeUnknowns;  ///< unknown of each index of the active system
+  std::vector<sunindextype> couplingPtrs;  ///< index of the first coupling term of each equation
+  std::vector<sunindextype> couplingUnknowns;  ///< frozen unknown of each coupling term
+  std::vector<sunindextype> couplingPositions;  ///< position in the matrix of each coupling term
+  std::vector<sunindextype> activePositions;  ///< position in the matrix of each element of the active matrix
+  std::vector<double> values;  ///< values of the frozen unknowns during a solve
+  sunindextype lastFlag;  ///< status of the last setup or solve
+};
+
+/**
+ * @brief get the content of an active set linear solver
+ * @param LS linear solver
+ * @return content of the linear solver
+ */
+ActiveSetContent*
+content(SUNLinearSolver LS) {
+  return reinterpret_cast<ActiveSetContent*>(LS->content);
+}
+
+/**
+ * @brief transpose the structure of a sparse matrix
+ * @param n number of rows and of columns
+ * @param indexPtrs index of the first element of each compressed row or column
+ * @param indexVals index of each element in its compressed row or column
+ * @param ptrs index of the first element of each row or column of the transpose, to fill
+ * @param vals index of each element of the transpose in its row or column, to fill
+ * @param positions position in the matrix of each element of the transpose, to fill
+ */
+void
+transpose(const sunindextype n, const sunindextype* indexPtrs, const sunindextype* indexVals, std::vector<sunindextype>& ptrs,
+    std::vector<sunindextype>& vals, std::vector<sunindextype>& positions) {
+  const sunindextype nbElements = indexPtrs[n];
+  ptrs.assign(n + 1, 0);
+  vals.resize(nbElements);
+  positions.resize(nbElements);
+  for (sunindextype p = 0; p < nbElements; ++p)
+    ++ptrs[indexVals[p] + 1];
+  for (sunindextype i = 0; i < n; ++i)
+    ptrs[i + 1] += ptrs[i];
+  std::vector<sunindextype> next(ptrs.begin(), ptrs.end() - 1);
+  for (sunindextype i = 0; i < n; ++i) {
+    for (sunindextype p = indexPtrs[i]; p < indexPtrs[i + 1]; ++p) {
+      const sunindextype position = next[indexVals[p]]++;
+      vals[position] = i;
+      positions[position] = p;
+    }
+  }
+}
+
+/**
+ * @brief get the position of the only element of an equation on an unknown that is not frozen yet
+ * @param row equation
+ * @param rowPtrs index of the first element of each row
+ * @param colIdx column of each element stored by rows
+ * @param isFrozen whether each unknown is frozen
+ * @return index in the rows of the element if it is the diagonal one, -1 otherwise
+ */
+sunindextype
+trivialElement(const sunindextype row, const std::vector<sunindextype>& rowPtrs, const std::vector<sunindextype>& colIdx,
+    const std::vector<bool>& isFrozen) {
+  sunindextype element = -1;
+  for (sunindextype p = rowPtrs[row]; p < rowPtrs[row + 1]; ++p) {
+    if (isFrozen[colIdx[p]])
+      continue;
+    if (element >= 0)
+      return -1;
+    element = p;
+  }
+  return (element >= 0 && colIdx[element] == row) ? element : -1;
+}
+
+/**
+ * @brief search the frozen unknowns and build the active system
+ * @param solverContent content of the linear solver
+ * @param A sparse matrix
+ * @return @b false if the active system could not be allocated
+ */
+bool
+analyze(ActiveSetContent& solverContent, SUNMatrix A) {
+  const sunindextype n = SM_COLUMNS_S(A);
+  const sunindextype nbElements = SM_INDEXPTRS_S(A)[SM_NP_S(A)];
+  const bool byRows = SM_SPARSETYPE_S(A) == CSR_MAT;
+  std::vector<sunindextype> rowPtrs;
+  std::vector<sunindextype> colIdx;
+  std::vector<sunindextype> rowPositions;
+  std::vector<sunindextype> colPtrs;
+  std::vector<sunindextype> rowIdx;
+  std::vector<sunindextype> colPositions;
+  if (byRows) {
+    rowPtrs.assign(SM_INDEXPTRS_S(A), SM_INDEXPTRS_S(A) + n + 1);
+    colIdx.assign(SM_INDEXVALS_S(A), SM_INDEXVALS_S(A) + nbElements);
+    rowPositions.resize(nbElements);
+    for (sunindextype p = 0; p < nbElements; ++p)
+      rowPositions[p] = p;
+    transpose(n, SM_INDEXPTRS_S(A), SM_INDEXVALS_S(A), colPtrs, rowIdx, colPositions);
+  } else {
+    colPtrs.assign(SM_INDEXPTRS_S(A), SM_INDEXPTRS_S(A) + n + 1);
+    rowIdx.assign(SM_INDEXVALS_S(A), SM_INDEXVALS_S(A) + nbElements);
+    colPositions.resize(nbElements);
+    for (sunindextype p = 0; p < nbElements; ++p)
+      colPositions[p] = p;
+    transpose(n, SM_INDEXPTRS_S(A), SM_INDEXVALS_S(A), rowPtrs, colIdx, rowPositions);
+  }
+
+  // an equation whose only element on the unknowns not frozen yet is the diagonal one freezes its unknown,
+  // which may in turn leave a single element in the equations using it
+  const std::size_t previousNbFrozen = solverContent.frozen.size();
+  std::vector<bool> isFrozen(n, false);
+  std::vector<sunindextype> nbRemaining(n);
+  std::vector<sunindextype> candidates;
+  solverContent.frozen.clear();
+  solverContent.diagonalPositions.clear();
+  for (sunindextype row = 0; row < n; ++row) {
+    nbRemaining[row] = rowPtrs[row + 1] - rowPtrs[row];
+    if (nbRemaining[row] == 1)
+      candidates.push_back(row);
+  }
+  while (!candidates.empty()) {
+    const sunindextype row = candidates.back();
+    candidates.pop_back();
+    if (isFrozen[row])
+      continue;
+    const sunindextype element = trivialElement(row, rowPtrs, colIdx, isFrozen);
+    if (element < 0)
+      continue;
+    isFrozen[row] = true;
+    solverContent.frozen.push_back(row);
+    solverContent.diagonalPositions.push_back(rowPositions[element]);
+    for (sunindextype p = colPtrs[row]; p < colPtrs[row + 1]; ++p) {
+      const sunindextype otherRow = rowIdx[p];
+      if (otherRow != row && !isFrozen[otherRow] && --nbRemaining[otherRow] == 1)
+        candidates.push_back(otherRow);
+    }
+  }
+
+  std::vector<sunindextype> activeIndex(n, -1);
+  solverContent.activeUnknowns.clear();
+  for (sunindextype i = 0; i < n; ++i) {
+    if (!isFrozen[i]) {
+      activeIndex[i] = static_cast<sunindextype>(solverContent.activeUnknowns.size());
+      solverContent.activeUnknowns.push_back(i);
+    }
+  }
+  solverContent.couplingPtrs.assign(1, 0);
+  solverContent.couplingUnknowns.clear();
+  solverContent.couplingPositions.clear();
+  for (sunindextype row = 0; row < n; ++row) {
+    for (sunindextype p = rowPtrs[row]; p < rowPtrs[row + 1]; ++p) {
+      const sunindextype col = colIdx[p];
+      if (isFrozen[col] && col != row) {
+        solverContent.couplingUnknowns.push_back(col);
+        solverContent.couplingPositions.push_back(rowPositions[p]);
+      }
+    }
+    solverContent.couplingPtrs.push_back(static_cast<sunindextype>(solverContent.couplingUnknowns.size()));
+  }
+  solverContent.n = n;
+  solverContent.nbElements = nbElements;
+  solverContent.values.assign(n, 0.);
+  solverContent.activePositions.clear();
+  solverContent.releaseActiveSystem();
+  if (solverContent.frozen.size() != previousNbFrozen)
+    DYN::Trace::debug() << DYNLog(ActiveSetCompaction, solverContent.frozen.size(), n) << DYN::Trace::endline;
+  const sunindextype nbActive = static_cast<sunindextype>(solverContent.activeUnknowns.size());
+  if (solverContent.frozen.empty() || nbActive == 0)
+    return true;
+
+  // the active matrix is stored as the whole matrix, by rows or by columns, its values being read through the positions
+  const std::vector<sunindextype>& ptrs = byRows ? rowPtrs : colPtrs;
+  const std::vector<sunindextype>& vals = byRows ? colIdx : rowIdx;
+  const std::vector<sunindextype>& positions = byRows ? rowPositions : colPositions;
+  std::vector<sunindextype> activePtrs(1, 0);
+  std::vector<sunindextype> activeVals;
+  for (sunindextype k = 0; k < nbActive; ++k) {
+    const sunindextype i = solverContent.activeUnknowns[k];
+    for (sunindextype p = ptrs[i]; p < ptrs[i + 1]; ++p) {
+      if (!isFrozen[vals[p]]) {
+        activeVals.push_back(activeIndex[vals[p]]);
+        solverContent.activePositions.push_back(positions[p]);
+      }
+    }
+    activePtrs.push_back(static_cast<sunindextype>(activeVals.size()));
+  }
+  const sunindextype nbActiveElements = std::max<sunindextype>(static_cast<sunindextype>(activeVals.size()), 1);
+  solverContent.activeMatrix = SUNSparseMatrix(nbActive, nbActive, nbActiveElements, SM_SPARSETYPE_S(A), solverContent.context);
+  solverContent.activeX = N_VNew_Serial(nbActive, solverContent.context);
+  solverContent.activeB = N_VNew_Serial(nbActive, solverContent.context);
+  if (solverContent.activeMatrix == NULL || solverContent.activeX == NULL || solverContent.activeB == NULL) {
+    solverContent.releaseActiveSystem();
+    return false;
+  }
+  std::copy(activePtrs.begin(), activePtrs.end(), SM_INDEXPTRS_S(solverContent.activeMatrix));
+  std::copy(activeVals.begin(), activeVals.end(), SM_INDEXVALS_S(solverContent.activeMatrix));
+  solverContent.activeSolver = SUNLinSol_KLU(solverContent.activeX, solverContent.activeMatrix, solverContent.context);
+  if (solverContent.activeSolver == NULL) {
+    solverContent.releaseActiveSystem();
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief type of the linear solver
+ * @return direct linear solver
+ */
+SUNLinearSolver_Type
+getTypeActiveSet(SUNLinearSolver) {
+  return SUNLINEARSOLVER_DIRECT;
+}
+
+/**
+ * @brief identifier of the linear solver
+ * @return custom linear solver
+ */
+SUNLinearSolver_ID
+getIdActiveSet(SUNLinearSolver) {
+  return SUNLINEARSOLVER_CUSTOM;
+}
+
+/**
+ * @brief initialization of the linear solver
+ * @param LS linear solver
+ * @return status of the initialization
+ */
+int
+initializeActiveSet(SUNLinearSolver LS) {
+  content(LS)->lastFlag = SUNLS_SUCCESS;
+  return SUNLinSolInitialize(content(LS)->fullSolver);
+}
+
+/**
+ * @brief setup (factorization) of the linear solver
+ * @param LS linear solver
+ * @param A matrix to factorize
+ * @return status of the setup
+ */
+int
+setupActiveSet(SUNLinearSolver LS, SUNMatrix A) {
+  DYN::ProfilerScope profilerScope(DYN::Profiler::FACTORIZATION);
+  ActiveSetContent& solverContent = *content(LS);
+  // a structure change is normally notified through reinit, the number of elements is checked all the same
+  if (!solverContent.analyzed || solverContent.nbElements != SM_INDEXPTRS_S(A)[SM_NP_S(A)]) {
+    if (!analyze(solverContent, A)) {
+      solverContent.lastFlag = SUNLS_MEM_FAIL;
+      return SUNLS_MEM_FAIL;
+    }
+    solverContent.analyzed = true;
+  }
+  if (solverContent.frozen.empty()) {
+    solverContent.lastFlag = SUNLinSolSetup(solverContent.fullSolver, A);
+    return static_cast<int>(solverContent.lastFlag);
+  }
+
+  const realtype* data = SM_DATA_S(A);
+  for (std::size_t k = 0; k < solverContent.diagonalPositions.size(); ++k) {
+    if (data[solverContent.diagonalPositions[k]] == 0.) {
+      // singular matrix, recoverable as for KLU
+      solverContent.lastFlag = SUNLS_PACKAGE_FAIL_REC;
+      return SUNLS_PACKAGE_FAIL_REC;
+    }
+  }
+  if (solverContent.activeSolver == NULL) {
+    solverContent.lastFlag = SUNLS_SUCCESS;
+    return SUNLS_SUCCESS;
+  }
+  realtype* activeData = SM_DATA_S(solverContent.activeMatrix);
+  for (std::size_t q = 0; q < solverContent.activePositions.size(); ++q)
+    activeData[q] = data[solverContent.activePositions[q]];
+  solverContent.lastFlag = SUNLinSolSetup(solverContent.activeSolver, solverContent.activeMatrix);
+  return static_cast<int>(solverContent.lastFlag);
+}
+
+/**
+ * @brief solve of the linear solver
+ * @param LS linear solver
+ * @param A factorized matrix
+ * @param x solution
+ * @param b right-hand side
+ * @param tol tolerance, ignored by the direct solvers
+ * @return status of the solve
+ */
+int
+solveActiveSet(SUNLinearSolver LS, SUNMatrix A, N_Vector x, N_Vector b, realtype tol) {
+  DYN::ProfilerScope profilerScope(DYN::Profiler::LINEAR_SOLVE);
+  ActiveSetContent& solverContent = *content(LS);
+  if (solverContent.frozen.empty()) {
+    solverContent.lastFlag = SUNLinSolSolve(solverContent.fullSolver, A, x, b, tol);
+    return static_cast<int>(solverContent.lastFlag);
+  }
+
+  const realtype* data = SM_DATA_S(A);
+  const realtype* bData = N_VGetArrayPointer(b);
+  realtype* xData = N_VGetArrayPointer(x);
+  std::vector<double>& values = solverContent.values;
+  // the frozen unknowns only depend on the ones frozen before them
+  for (std::size_t k = 0; k < solverContent.frozen.size(); ++k) {
+    const sunindextype i = solverContent.frozen[k];
+    double value = bData[i];
+    for (sunindextype c = solverContent.couplingPtrs[i]; c < solverContent.couplingPtrs[i + 1]; ++c)
+      value -= data[solverContent.couplingPositions[c]] * values[solverContent.couplingUnknowns[c]];
+    values[i] = value / data[solverContent.diagonalPositions[k]];
+  }
+  if (solverContent.activeSolver != NULL) {
+    realtype* activeB = N_VGetArrayPointer(solverContent.activeB);
+    for (std::size_t k = 0; k < solverContent.activeUnknowns.size(); ++k) {
+      const sunindextype i = solverContent.activeUnknowns[k];
+      double value = bData[i];
+      for (sunindextype c = solverContent.couplingPtrs[i]; c < solverContent.couplingPtrs[i + 1]; ++c)
+        value -= data[solverContent.couplingPositions[c]] * values[solverContent.couplingUnknowns[c]];
+      activeB[k] = value;
+    }
+    solverContent.lastFlag = SUNLinSolSolve(solverContent.activeSolver, solverContent.activeMatrix, solverContent.activeX, solverContent.activeB, tol);
+    if (solverContent.lastFlag != SUNLS_SUCCESS)
+      return static_cast<int>(solverContent.lastFlag);
+    // b may be x: it is only overwritten once completely read
+    const realtype* activeX = N_VGetArrayPointer(solverContent.activeX);
+    for (std::size_t k = 0; k < solverContent.activeUnknowns.size(); ++k)
+      xData[solverContent.activeUnknowns[k]] = activeX[k];
+  }
+  for (std::size_t k = 0; k < solverContent.frozen.size(); ++k)
+    xData[solverContent.frozen[k]] = values[solverContent.frozen[k]];
+  solverContent.lastFlag = SUNLS_SUCCESS;
+  return SUNLS_SUCCESS;
+}
+
+/**
+ * @brief status of the last setup or solve
+ * @param LS linear solver
+ * @return status
+ */
+sunindextype
+lastFlagActiveSet(SUNLinearSolver LS) {
+  return content(LS)->lastFlag;
+}
+
+/**
+ * @brief memory used by the linear solver, not reported
+ * @param lenrwLS number of reals, to fill
+ * @param leniwLS number of integers, to fill
+ * @return status
+ */
+int
+spaceActiveSet(SUNLinearSolver, long int* lenrwLS, long int* leniwLS) {
+  *lenrwLS = 0;
+  *leniwLS = 0;
+  return SUNLS_SUCCESS;
+}
+
+/**
+ * @brief release the linear solver
+ * @param LS linear solver
+ * @return status
+ */
+int
+freeActiveSet(SUNLinearSolver LS) {
+  if (LS == NULL)
+    return SUNLS_SUCCESS;
+  delete content(LS);
+  LS->content = NULL;
+  SUNLinSolFreeEmpty(LS);
+  return SUNLS_SUCCESS;
+}
+
+}  // namespace
+
+namespace DYN {
+
+SUNLinearSolver
+ActiveSetLinearSolver::create(N_Vector y, SUNMatrix JJ, SUNContext context) {
+  if (JJ == NULL || SM_ROWS_S(JJ) != SM_COLUMNS_S(JJ))
+    return NULL;
+  SUNLinearSolver fullSolver = SUNLinSol_KLU(y, JJ, context);
+  if (fullSolver == NULL)
+    return NULL;
+  SUNLinearSolver LS = SUNLinSolNewEmpty(context);
+  if (LS == NULL) {
+    SUNLinSolFree(fullSolver);
+    return NULL;
+  }
+  LS->ops->gettype = getTypeActiveSet;
+  LS->ops->getid = getIdActiveSet;
+  LS->ops->initialize = initializeActiveSet;
+  LS->ops->setup = setupActiveSet;
+  LS->ops->solve = solveActiveSet;
+  LS->ops->lastflag = lastFlagActiveSet;
+  LS->ops->space = spaceActiveSet;
+  LS->ops->free = freeActiveSet;
+  LS->content = new ActiveSetContent(fullSolver, context);
+  return LS;
+}
+
+bool
+ActiveSetLinearSolver::isActiveSet(SUNLinearSolver LS) {
+  return LS != NULL && LS->ops != NULL && LS->ops->setup == setupActiveSet;
+}
+
+void
+ActiveSetLinearSolver::reinit(SUNLinearSolver LS, SUNMatrix JJ) {
+  if (!isActiveSet(LS))
+    return;
+  ActiveSetContent& solverContent = *content(LS);
+  solverContent.analyzed = false;
+  SUNLinSol_KLUReInit(solverContent.fullSolver, JJ, SM_NNZ_S(JJ), SUNKLU_REINIT_PARTIAL);
+}
+
+unsigned
+ActiveSetLinearSolver::getNbFrozen(SUNLinearSolver LS) {
+  if (!isActiveSet(LS))
+    return 0;
+  return static_cast<unsigned>(content(LS)->frozen.size());
+}
+
+std::size_t
+ActiveSetLinearSolver::getMemoryUsage(SUNLinearSolver LS) {
+  if (!isActiveSet(LS))
+    return 0;
+  const ActiveSetContent& solverContent = *content(LS);
+  if (solverContent.activeSolver != NULL)
+    return SUNLinSol_KLUGetCommon(solverContent.activeSolver)->memusage;
+  if (solverContent.frozen.empty())
+    return SUNLinSol_KLUGetCommon(solverContent.fullSolver)->memusage;
+  return 0;
+}
+
+}  // end namespace DYN
@@ -0,0 +1,93 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNActiveSetLinearSolver.h
+ *
+ * @brief Sparse direct linear solver factorizing only the active part of the system, the frozen unknowns being eliminated beforehand
+ *
+ */
+#ifndef SOLVERS_COMMON_DYNACTIVESETLINEARSOLVER_H_
+#define SOLVERS_COMMON_DYNACTIVESETLINEARSOLVER_H_
+
+#include <cstddef>
+#include <sundials/sundials_linearsolver.h>
+#include <sundials/sundials_matrix.h>
+#include <sundials/sundials_nvector.h>
+
+namespace DYN {
+
+/**
+ * @brief ActiveSetLinearSolver static class: creation of the active set linear solver
+ *
+ * A disconnected equipment keeps its variables in the system, with trivial equations: the voltage of a switched off bus
+ * is for instance forced to zero by an equation whose Jacobian row only has its diagonal term. Such an unknown is frozen:
+ * it is computed directly from its equation, and its column only contributes to the right-hand side of the other equations.
+ * The frozen unknowns are found again by elimination, an equation becoming trivial once the unknowns it depends on are frozen,
+ * so that a whole dead island is removed at once.
+ *
+ * The remaining active system is compacted and factorized by KLU. The frozen unknowns are searched again at each structure
+ * change of the matrix, which happens when equipments are disconnected or reconnected: they then go back to the active system.
+ */
+class ActiveSetLinearSolver {
+ public:
+  /**
+   * @brief create an active set linear solver
+   *
+   * @param y template vector
+   * @param JJ sparse matrix the linear solver works on
+   * @param context sundials context
+   *
+   * @return the linear solver, to be released with SUNLinSolFree, NULL if the allocation failed
+   */
+  static SUNLinearSolver create(N_Vector y, SUNMatrix JJ, SUNContext context);
+
+  /**
+   * @brief indicate whether a linear solver is an active set linear solver
+   *
+   * @param LS linear solver
+   *
+   * @return @b true if LS was created by this class
+   */
+  static bool isActiveSet(SUNLinearSolver LS);
+
+  /**
+   * @brief force the search of the frozen unknowns and a new symbolic analysis at the next factorization, after a structure change of the matrix
+   *
+   * @param LS active set linear solver
+   * @param JJ sparse matrix the linear solver works on, with its new structure
+   */
+  static void reinit(SUNLinearSolver LS, SUNMatrix JJ);
+
+  /**
+   * @brief get the number of frozen unknowns, removed from the factorized system
+   *
+   * @param LS active set linear solver
+   *
+   * @return number of frozen unknowns found at the last structure change
+   */
+  static unsigned getNbFrozen(SUNLinearSolver LS);
+
+  /**
+   * @brief get the memory allocated by KLU for the active system
+   *
+   * @param LS active set linear solver
+   *
+   * @return number of bytes allocated by KLU
+   */
+  static std::size_t getMemoryUsage(SUNLinearSolver LS);
+};
+
+}  // end namespace DYN
+
+#endif  // SOLVERS_COMMON_DYNACTIVESETLINEARSOLVER_H_
@@ -0,0 +1,123 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+/**
+ * @file  DYNConvergenceDiagnostics.cpp
+ *
+ * @brief Ring buffer of the last Newton iterations implementation
+ *
+ */
+#include "DYNConvergenceDiagnostics.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "DYNModel.h"
+
+namespace DYN {
+
+/**
+ * @brief replace the separators of the CSV format in a field
+ * @param field field to write
+ * @return field without separator
+ */
+static std::string
+csvField(std::string field) {
+  std::replace(field.begin(), field.end(), ';', ',');
+  std::replace(field.begin(), field.end(), '\n', ' ');
+  return field;
+}
+
+const unsigned int ConvergenceDiagnostics::NB_LARGEST_RESIDUALS;
+
+ConvergenceDiagnostics::ConvergenceDiagnostics() :
+first_(0),
+size_(0),
+stream_(NULL),
+nbDumps_(0) {}
+
+void
+ConvergenceDiagnostics::enable(const unsigned int depth, std::ostream* stream) {
+  iterations_.assign(depth, Iteration());
+  first_ = 0;
+  size_ = 0;
+  stream_ = depth > 0 ? stream : NULL;
+  if (stream_)
+    *stream_ << "dump;trigger;time;stepSize;iteration;maxResidual;rank;equation;residual;subModel;subModelEquation;equationDescription" << std::endl;
+}
+
+void
+ConvergenceDiagnostics::addIteration(const double time, const double stepSize, const long int iteration, const double* residuals,
+    const std::size_t size) {
+  if (!isEnabled())
+    return;
+  Iteration& record = iterations_[(first_ + size_) % iterations_.size()];
+  if (size_ < iterations_.size())
+    ++size_;
+  else
+    first_ = (first_ + 1) % iterations_.size();
+
+  record.time = time;
+  record.stepSize = stepSize;
+  record.iteration = iteration;
+  record.maxResidual = 0.;
+  record.nbResiduals = 0;
+  // insertion in the few largest residuals, only reached by the residuals larger than the smallest one kept
+  for (std::size_t i = 0; i < size; ++i) {
+    const double absValue = std::abs(residuals[i]);
+    if (absValue > record.maxResidual)
+      record.maxResidual = absValue;
+    if (record.nbResiduals == NB_LARGEST_RESIDUALS && absValue <= std::abs(record.largestResiduals[NB_LARGEST_RESIDUALS - 1].value))
+      continue;
+    unsigned int position = record.nbResiduals < NB_LARGEST_RESIDUALS ? record.nbResiduals++ : NB_LARGEST_RESIDUALS - 1;
+    for (; position > 0 && std::abs(record.largestResiduals[position - 1].value) < absValue; --position)
+      record.largestResiduals[position] = record.largestResiduals[position - 1];
+    record.largestResiduals[position].index = static_cast<int>(i);
+    record.largestResiduals[position].value = residuals[i];
+  }
+}
+
+const ConvergenceDiagnostics::Iteration&
+ConvergenceDiagnostics::getIteration(const std::size_t index) const {
+  assert(index < size_ && "Iteration index out of the buffer");
+  return iterations_[(first_ + index) % iterations_.size()];
+}
+
+void
+ConvergenceDiagnostics::dump(const Model& model, const std::string& trigger, const bool clear) {
+  if (!isEnabled())
+    return;
+  ++nbDumps_;
+  const std::string triggerField = csvField(trigger);
+  for (std::size_t i = 0; i < size_; ++i) {
+    const Iteration& record = getIteration(i);
+    for (unsigned int rank = 0; rank < record.nbResiduals; ++rank) {
+      const Residual& residual = record.largestResiduals[rank];
+      std::string subModelName;
+      int subModelIndex = 0;
+      std::string equation;
+      model.getFInfos(residual.index, subModelName, subModelIndex, equation);
+      *stream_ << nbDumps_ << ";" << triggerField << ";" << record.time << ";" << record.stepSize << ";" << record.iteration << ";"
+               << record.maxResidual << ";" << rank + 1 << ";" << residual.index << ";" << residual.value << ";"
+               << csvField(subModelName) << ";" << subModelIndex << ";" << csvField(equation) << "\n";
+    }
+  }
+  stream_->flush();
+  if (clear) {
+    first_ = 0;
+    size_ = 0;
+  }
+}
+
+}  // namespace DYN
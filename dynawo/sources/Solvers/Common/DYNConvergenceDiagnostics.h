@@ -0,0 +1,133 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite of simulation tools
+// for power systems.
+//
+
+/**
+ * @file  DYNConvergenceDiagnostics.h
+ *
+ * @brief Ring buffer of the last Newton iterations, dumped when the Newton resolution fails
+ *
+ */
+#ifndef SOLVERS_COMMON_DYNCONVERGENCEDIAGNOSTICS_H_
+#define SOLVERS_COMMON_DYNCONVERGENCEDIAGNOSTICS_H_
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <boost/core/noncopyable.hpp>
+
+namespace DYN {
+class Model;
+
+/**
+ * @class ConvergenceDiagnostics
+ * @brief Machine readable diagnostics of the last Newton iterations
+ *
+ * For each of the last iterations, the time, the step size and the largest residuals are kept in a ring buffer.
+ * Only the indexes of the equations are recorded during the iterations: the sub models and the equations are
+ * resolved when the buffer is dumped, as CSV lines, after a convergence failure or on request.
+ */
+class ConvergenceDiagnostics : private boost::noncopyable {
+ public:
+  static const unsigned int NB_LARGEST_RESIDUALS = 5;  ///< number of residuals kept for each iteration
+
+  /**
+   * @brief residual of an equation
+   */
+  struct Residual {
+    int index;     ///< global index of the equation
+    double value;  ///< value of the residual
+  };
+
+  /**
+   * @brief diagnostics of a Newton iteration
+   */
+  struct Iteration {
+    double time;          ///< time of the step being solved
+    double stepSize;      ///< size of the step being solved
+    long int iteration;   ///< index of the Newton iteration in the resolution of the step
+    double maxResidual;   ///< infinity norm of the residuals
+    unsigned int nbResiduals;  ///< number of residuals kept
+    Residual largestResiduals[NB_LARGEST_RESIDUALS];  ///< largest residuals in absolute value, by decreasing order
+  };
+
+  /**
+   * @brief constructor, with the diagnostics disabled
+   */
+  ConvergenceDiagnostics();
+
+  /**
+   * @brief enable the diagnostics
+   *
+   * @param depth number of iterations kept, 0 to disable the diagnostics
+   * @param stream stream where the buffer is dumped, whose header is written here
+   */
+  void enable(unsigned int depth, std::ostream* stream);
+
+  /**
+   * @brief whether the diagnostics are enabled
+   *
+   * @return @b true if the iterations are recorded
+   */
+  inline bool isEnabled() const {
+    return stream_ != NULL;
+  }
+
+  /**
+   * @brief record a Newton iteration, the oldest one being dropped if the buffer is full
+   *
+   * @param time time of the step being solved
+   * @param stepSize size of the step being solved
+   * @param iteration index of the Newton iteration
+   * @param residuals values of the residuals
+   * @param size number of residuals
+   */
+  void addIteration(double time, double stepSize, long int iteration, const double* residuals, std::size_t size);
+
+  /**
+   * @brief dump the recorded iterations in the stream
+   *
+   * @param model model giving the sub models and the equations of the residuals
+   * @param trigger reason of the dump, failure reason of the Newton resolution or request
+   * @param clear @b true to empty the buffer after the dump, so that the next dump only holds new iterations
+   */
+  void dump(const Model& model, const std::string& trigger, bool clear);
+
+  /**
+   * @brief get the number of iterations in the buffer
+   *
+   * @return number of iterations recorded
+   */
+  inline std::size_t size() const {
+    return size_;
+  }
+
+  /**
+   * @brief get an iteration of the buffer
+   *
+   * @param index index of the iteration, 0 for the oldest one
+   * @return iteration
+   */
+  const Iteration& getIteration(std::size_t index) const;
+
+ private:
+  std::vector<Iteration> iterations_;  ///< ring buffer of the iterations
+  std::size_t first_;  ///< index of the oldest iteration in the buffer
+  std::size_t size_;  ///< number of iterations in the buffer
+  std::ostream* stream_;  ///< stream where the buffer is dumped, NULL if the diagnostics are disabled
+  unsigned int nbDumps_;  ///< number of dumps written, used to identify their lines
+};
+
+}  // namespace DYN
+
+#endif  // SOLVERS_COMMON_DYNCONVERGENCEDIAGNOSTICS_H_
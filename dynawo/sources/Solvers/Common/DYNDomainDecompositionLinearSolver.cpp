@@ -0,0 +1,763 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNDomainDecompositionLinearSolver.cpp
+ *
+ * @brief Domain decomposition linear solver implementation
+ *
+ */
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <boost/core/noncopyable.hpp>
+#include <sunmatrix/sunmatrix_sparse.h>
+#include <sunlinsol/sunlinsol_klu.h>
+
+#include "DYNDomainDecompositionLinearSolver.h"
+#include "DYNKLUFactorization.h"
+#include "DYNThreadPool.h"
+#include "DYNProfiler.h"
+#include "DYNMacrosMessage.h"
+#include "DYNTrace.h"
+
+namespace {
+
+const sunindextype SCHUR_COLUMNS_CHUNK_SIZE = 32;  ///< number of interface columns of the Schur complement solved at once by an area
+
+/**
+ * @brief sparse block of the matrix, stored by columns
+ */
+struct SparseBlock {
+  SparseBlock() : nbRows(0), nbCols(0) { }
+
+  sunindextype nbRows;  ///< number of rows
+  sunindextype nbCols;  ///< number of columns
+  std::vector<sunindextype> colPtrs;  ///< index of the first element of each column, and number of elements
+  std::vector<sunindextype> rowIdx;  ///< row of each element
+  std::vector<realtype> values;  ///< value of each element
+};
+
+/**
+ * @brief element of a block, before the block is built
+ */
+struct BlockElement {
+  sunindextype col;  ///< column in the block
+  sunindextype row;  ///< row in the block
+  sunindextype source;  ///< index of the element in the matrix
+
+  /**
+   * @brief order by columns then by rows
+   * @param other element to compare to
+   * @return @b true if this element comes first
+   */
+  bool operator<(const BlockElement& other) const {
+    return col < other.col || (col == other.col && row < other.row);
+  }
+};
+
+/**
+ * @brief block of the partitioned matrix an element of the matrix belongs to
+ */
+typedef enum {
+  INTERIOR = 0,  ///< interior block of an area
+  INTERIOR_INTERFACE = 1,  ///< rows of the interior of an area, columns of the interface
+  INTERFACE_INTERIOR = 2,  ///< rows of the interface, columns of the interior of an area
+  INTERFACE = 3  ///< rows and columns of the interface, element of the Schur complement
+} blockKind_t;
+
+/**
+ * @brief location of an element of the matrix in the blocks of the partition
+ */
+struct Destination {
+  blockKind_t kind;  ///< block of the element
+  unsigned area;  ///< area of the block, unused for the interface
+  sunindextype position;  ///< index of the element in the values of the block
+};
+
+/**
+ * @brief area of the partition
+ */
+struct Area : private boost::noncopyable {
+  std::vector<sunindextype> interior;  ///< unknowns of the area that are not on the interface
+  std::vector<sunindextype> couplingRows;  ///< interface unknowns whose equations depend on the interior of the area, sorted
+  std::vector<sunindextype> couplingCols;  ///< interface unknowns the equations of the interior of the area depend on, sorted
+  SparseBlock interiorBlock;  ///< interior block
+  SparseBlock interiorInterface;  ///< block of the interior rows and of the coupling columns
+  SparseBlock interfaceInterior;  ///< block of the coupling rows and of the interior columns
+  std::vector<sunindextype> schurPositions;  ///< position in the Schur complement of each coupling row and column pair, by rows
+  std::vector<realtype> contribution;  ///< contribution of the area to the Schur complement, by rows
+  std::vector<realtype> work;  ///< right-hand sides of the interior solves
+  std::vector<realtype> interfaceWork;  ///< contribution of the area to the right-hand side of the interface, by coupling rows
+  DYN::KLUFactorization factorization;  ///< factors of the interior block
+};
+
+/**
+ * @brief content of the domain decomposition linear solver
+ */
+struct DomainDecompositionContent : private boost::noncopyable {
+  /**
+   * @brief constructor
+   * @param nbAreas number of areas of the partition
+   */
+  explicit DomainDecompositionContent(const unsigned nbAreas) :
+  nbAreas(nbAreas),
+  threadPool(new DYN::ThreadPool(nbAreas)),
+  analyzed(false),
+  wholeMatrix(false),
+  lastFlag(0) { }
+
+  unsigned nbAreas;  ///< number of areas of the partition
+  std::unique_ptr<DYN::ThreadPool> threadPool;  ///< threads factorizing and solving the areas
+  bool analyzed;  ///< whether the partition matches the structure of the matrix
+  bool wholeMatrix;  ///< whether the whole matrix is factorized, the partition having a singular interior block
+  std::vector<std::unique_ptr<Area> > areas;  ///< areas of the partition
+  std::vector<sunindextype> interface;  ///< interface unknowns
+  std::vector<Destination> destinations;  ///< location of each element of the matrix in the blocks
+  SparseBlock schur;  ///< Schur complement of the interface
+  DYN::KLUFactorization schurFactorization;  ///< factors of the Schur complement
+  std::vector<realtype> interfaceWork;  ///< right-hand side and solution of the interface
+  DYN::KLUFactorization wholeFactorization;  ///< factors of the whole matrix, when the partition cannot be used
+  sunindextype lastFlag;  ///< status of the last setup or solve
+};
+
+/**
+ * @brief get the content of a domain decomposition linear solver
+ * @param LS linear solver
+ * @return content of the linear solver
+ */
+DomainDecompositionContent*
+content(SUNLinearSolver LS) {
+  return reinterpret_cast<DomainDecompositionContent*>(LS->content);
+}
+
+/**
+ * @brief call a function for each element of a sparse matrix, whatever its storage
+ * @param JJ sparse matrix
+ * @param function function called with the row, the column and the index of each element
+ */
+template<typename Function>
+void
+forEachElement(SUNMatrix JJ, const Function& function) {
+  const bool byRows = SM_SPARSETYPE_S(JJ) == CSR_MAT;
+  const sunindextype* indexPtrs = SM_INDEXPTRS_S(JJ);
+  const sunindextype* indexVals = SM_INDEXVALS_S(JJ);
+  for (sunindextype major = 0; major < SM_NP_S(JJ); ++major) {
+    for (sunindextype p = indexPtrs[major]; p < indexPtrs[major + 1]; ++p) {
+      if (byRows)
+        function(major, indexVals[p], p);
+      else
+        function(indexVals[p], major, p);
+    }
+  }
+}
+
+/**
+ * @brief partition the unknowns of a matrix into areas of connected unknowns
+ *
+ * The unknowns are ordered by a breadth-first search of the symmetrized graph of the matrix, started from a peripheral unknown of
+ * each connected component, and this order is cut into areas of the same size: the edges then only join consecutive levels of
+ * the search, which keeps the interface small. The unknowns connected to an unknown of a previous area are on the interface.
+ *
+ * @param JJ sparse matrix
+ * @param nbAreas number of areas
+ * @param areaOf area of each unknown, to fill
+ * @param onInterface whether each unknown is on the interface, to fill
+ */
+void
+partition(SUNMatrix JJ, const unsigned nbAreas, std::vector<unsigned>& areaOf, std::vector<bool>& onInterface) {
+  const sunindextype n = SM_COLUMNS_S(JJ);
+  // symmetrized graph of the matrix, stored by rows
+  std::vector<sunindextype> neighborPtrs(n + 1, 0);
+  forEachElement(JJ, [&neighborPtrs](const sunindextype row, const sunindextype col, sunindextype) {
+    if (row != col) {
+      ++neighborPtrs[row + 1];
+      ++neighborPtrs[col + 1];
+    }
+  });
+  for (sunindextype i = 0; i < n; ++i)
+    neighborPtrs[i + 1] += neighborPtrs[i];
+  std::vector<sunindextype> neighbors(neighborPtrs[n]);
+  std::vector<sunindextype> nextNeighbor(neighborPtrs.begin(), neighborPtrs.end() - 1);
+  forEachElement(JJ, [&neighbors, &nextNeighbor](const sunindextype row, const sunindextype col, sunindextype) {
+    if (row != col) {
+      neighbors[nextNeighbor[row]++] = col;
+      neighbors[nextNeighbor[col]++] = row;
+    }
+  });
+
+  // breadth-first search appending the unvisited unknowns reachable from start to the order
+  auto search = [&neighborPtrs, &neighbors](const sunindextype start, std::vector<bool>& visited, std::vector<sunindextype>& order) {
+    size_t next = order.size();
+    order.push_back(start);
+    visited[start] = true;
+    while (next < order.size()) {
+      const sunindextype i = order[next++];
+      for (sunindextype p = neighborPtrs[i]; p < neighborPtrs[i + 1]; ++p) {
+        if (!visited[neighbors[p]]) {
+          visited[neighbors[p]] = true;
+          order.push_back(neighbors[p]);
+        }
+      }
+    }
+  };
+
+  std::vector<sunindextype> order;
+  order.reserve(n);
+  std::vector<bool> inComponent(n, false);
+  std::vector<bool> ordered(n, false);
+  std::vector<sunindextype> component;
+  for (sunindextype seed = 0; seed < n; ++seed) {
+    if (ordered[seed])
+      continue;
+    // the last unknown reached from any unknown of the component is a peripheral one
+    component.clear();
+    search(seed, inComponent, component);
+    search(component.back(), ordered, order);
+  }
+
+  areaOf.assign(n, 0);
+  for (size_t position = 0; position < order.size(); ++position)
+    areaOf[order[position]] = static_cast<unsigned>(position * nbAreas / order.size());
+  onInterface.assign(n, false);
+  forEachElement(JJ, [&areaOf, &onInterface](const sunindextype row, const sunindextype col, sunindextype) {
+    if (areaOf[row] < areaOf[col])
+      onInterface[col] = true;
+    else if (areaOf[col] < areaOf[row])
+      onInterface[row] = true;
+  });
+}
+
+/**
+ * @brief build a block from its elements and record where the elements of the matrix are stored
+ * @param elements elements of the block
+ * @param nbRows number of rows of the block
+ * @param nbCols number of columns of the block
+ * @param block block to build
+ * @param destinations location of each element of the matrix, updated with the positions in the block
+ */
+void
+buildBlock(std::vector<BlockElement>& elements, const sunindextype nbRows, const sunindextype nbCols, SparseBlock& block,
+    std::vector<Destination>& destinations) {
+  std::sort(elements.begin(), elements.end());
+  block.nbRows = nbRows;
+  block.nbCols = nbCols;
+  block.colPtrs.assign(nbCols + 1, 0);
+  block.rowIdx.resize(elements.size());
+  block.values.assign(elements.size(), 0.);
+  for (size_t p = 0; p < elements.size(); ++p) {
+    ++block.colPtrs[elements[p].col + 1];
+    block.rowIdx[p] = elements[p].row;
+    destinations[elements[p].source].position = static_cast<sunindextype>(p);
+  }
+  for (sunindextype col = 0; col < nbCols; ++col)
+    block.colPtrs[col + 1] += block.colPtrs[col];
+}
+
+/**
+ * @brief find an element in a block
+ * @param block block, with sorted rows in each column
+ * @param row row of the element
+ * @param col column of the element
+ * @return position of the element in the values of the block
+ */
+sunindextype
+findElement(const SparseBlock& block, const sunindextype row, const sunindextype col) {
+  const auto first = block.rowIdx.begin() + block.colPtrs[col];
+  const auto last = block.rowIdx.begin() + block.colPtrs[col + 1];
+  return static_cast<sunindextype>(std::lower_bound(first, last, row) - block.rowIdx.begin());
+}
+
+/**
+ * @brief get the position of a value in a sorted vector
+ * @param values sorted vector containing the value
+ * @param value value to find
+ * @return position of the value
+ */
+sunindextype
+indexOf(const std::vector<sunindextype>& values, const sunindextype value) {
+  return static_cast<sunindextype>(std::lower_bound(values.begin(), values.end(), value) - values.begin());
+}
+
+/**
+ * @brief partition a matrix and compute the symbolic analyses of its blocks
+ * @param content content of the linear solver
+ * @param JJ sparse matrix
+ */
+void
+analyze(DomainDecompositionContent& content, SUNMatrix JJ) {
+  const sunindextype n = SM_COLUMNS_S(JJ);
+  content.wholeFactorization.clear();
+  content.schurFactorization.clear();
+  content.wholeMatrix = false;
+  content.areas.clear();
+  for (unsigned k = 0; k < content.nbAreas; ++k)
+    content.areas.push_back(std::unique_ptr<Area>(new Area()));
+  content.interface.clear();
+
+  std::vector<unsigned> areaOf;
+  std::vector<bool> onInterface;
+  partition(JJ, content.nbAreas, areaOf, onInterface);
+
+  // index of each unknown in its area or in the interface
+  std::vector<sunindextype> localIndex(n);
+  for (sunindextype i = 0; i < n; ++i) {
+    std::vector<sunindextype>& unknowns = onInterface[i] ? content.interface : content.areas[areaOf[i]]->interior;
+    localIndex[i] = static_cast<sunindextype>(unknowns.size());
+    unknowns.push_back(i);
+  }
+  const sunindextype nbInterface = static_cast<sunindextype>(content.interface.size());
+
+  forEachElement(JJ, [&content, &areaOf, &onInterface, &localIndex](const sunindextype row, const sunindextype col, sunindextype) {
+    if (!onInterface[row] && onInterface[col])
+      content.areas[areaOf[row]]->couplingCols.push_back(localIndex[col]);
+    else if (onInterface[row] && !onInterface[col])
+      content.areas[areaOf[col]]->couplingRows.push_back(localIndex[row]);
+  });
+  for (const auto& area : content.areas) {
+    std::sort(area->couplingCols.begin(), area->couplingCols.end());
+    area->couplingCols.erase(std::unique(area->couplingCols.begin(), area->couplingCols.end()), area->couplingCols.end());
+    std::sort(area->couplingRows.begin(), area->couplingRows.end());
+    area->couplingRows.erase(std::unique(area->couplingRows.begin(), area->couplingRows.end()), area->couplingRows.end());
+  }
+
+  // distribution of the elements of the matrix in the blocks
+  std::vector<std::vector<BlockElement> > interiorElements(content.nbAreas);
+  std::vector<std::vector<BlockElement> > interiorInterfaceElements(content.nbAreas);
+  std::vector<std::vector<BlockElement> > interfaceInteriorElements(content.nbAreas);
+  std::vector<BlockElement> interfaceElements;
+  content.destinations.resize(SM_INDEXPTRS_S(JJ)[SM_NP_S(JJ)]);
+  forEachElement(JJ, [&](const sunindextype row, const sunindextype col, const sunindextype p) {
+    Destination& destination = content.destinations[p];
+    BlockElement element;
+    element.source = p;
+    if (onInterface[row] && onInterface[col]) {
+      destination.kind = INTERFACE;
+      destination.area = 0;
+      element.row = localIndex[row];
+      element.col = localIndex[col];
+      interfaceElements.push_back(element);
+    } else if (onInterface[col]) {
+      const Area& area = *content.areas[areaOf[row]];
+      destination.kind = INTERIOR_INTERFACE;
+      destination.area = areaOf[row];
+      element.row = localIndex[row];
+      element.col = indexOf(area.couplingCols, localIndex[col]);
+      interiorInterfaceElements[destination.area].push_back(element);
+    } else if (onInterface[row]) {
+      const Area& area = *content.areas[areaOf[col]];
+      destination.kind = INTERFACE_INTERIOR;
+      destination.area = areaOf[col];
+      element.row = indexOf(area.couplingRows, localIndex[row]);
+      element.col = localIndex[col];
+      interfaceInteriorElements[destination.area].push_back(element);
+    } else {
+      // the interior unknowns of two different areas are never connected
+      destination.kind = INTERIOR;
+      destination.area = areaOf[row];
+      element.row = localIndex[row];
+      element.col = localIndex[col];
+      interiorElements[destination.area].push_back(element);
+    }
+  });
+  for (unsigned k = 0; k < content.nbAreas; ++k) {
+    Area& area = *content.areas[k];
+    const sunindextype nbInterior = static_cast<sunindextype>(area.interior.size());
+    const sunindextype nbCouplingRows = static_cast<sunindextype>(area.couplingRows.size());
+    const sunindextype nbCouplingCols = static_cast<sunindextype>(area.couplingCols.size());
+    buildBlock(interiorElements[k], nbInterior, nbInterior, area.interiorBlock, content.destinations);
+    buildBlock(interiorInterfaceElements[k], nbInterior, nbCouplingCols, area.interiorInterface, content.destinations);
+    buildBlock(interfaceInteriorElements[k], nbCouplingRows, nbInterior, area.interfaceInterior, content.destinations);
+  }
+
+  // the Schur complement is filled by the interface block and by the coupling rows and columns of each area
+  std::vector<BlockElement> schurElements(interfaceElements);
+  for (const auto& area : content.areas) {
+    for (const sunindextype row : area->couplingRows) {
+      for (const sunindextype col : area->couplingCols) {
+        BlockElement element;
+        element.row = row;
+        element.col = col;
+        element.source = -1;
+        schurElements.push_back(element);
+      }
+    }
+  }
+  std::sort(schurElements.begin(), schurElements.end());
+  schurElements.erase(std::unique(schurElements.begin(), schurElements.end(), [](const BlockElement& a, const BlockElement& b) {
+    return a.col == b.col && a.row == b.row;
+  }), schurElements.end());
+  content.schur.nbRows = nbInterface;
+  content.schur.nbCols = nbInterface;
+  content.schur.colPtrs.assign(nbInterface + 1, 0);
+  content.schur.rowIdx.resize(schurElements.size());
+  content.schur.values.assign(schurElements.size(), 0.);
+  for (size_t p = 0; p < schurElements.size(); ++p) {
+    ++content.schur.colPtrs[schurElements[p].col + 1];
+    content.schur.rowIdx[p] = schurElements[p].row;
+  }
+  for (sunindextype col = 0; col < nbInterface; ++col)
+    content.schur.colPtrs[col + 1] += content.schur.colPtrs[col];
+  for (const BlockElement& element : interfaceElements)
+    content.destinations[element.source].position = findElement(content.schur, element.row, element.col);
+  for (const auto& area : content.areas) {
+    area->schurPositions.clear();
+    for (const sunindextype row : area->couplingRows) {
+      for (const sunindextype col : area->couplingCols)
+        area->schurPositions.push_back(findElement(content.schur, row, col));
+    }
+  }
+  content.interfaceWork.assign(nbInterface, 0.);
+
+  std::vector<char> analyzed(content.nbAreas, 1);
+  content.threadPool->parallelFor(content.nbAreas, [&content, &analyzed](const unsigned k) {
+    SparseBlock& block = content.areas[k]->interiorBlock;
+    if (block.nbCols > 0)
+      analyzed[k] = content.areas[k]->factorization.analyze(block.nbCols, block.colPtrs.data(), block.rowIdx.data());
+  });
+  if (nbInterface > 0 && !content.schurFactorization.analyze(nbInterface, content.schur.colPtrs.data(), content.schur.rowIdx.data()))
+    analyzed.push_back(0);
+  if (std::find(analyzed.begin(), analyzed.end(), 0) != analyzed.end()) {
+    DYN::Trace::debug() << DYNLog(DomainDecompositionFallback) << DYN::Trace::endline;
+    content.wholeMatrix = true;
+  }
+  DYN::Trace::debug() << DYNLog(DomainDecompositionPartition, content.nbAreas, nbInterface, n) << DYN::Trace::endline;
+}
+
+/**
+ * @brief factorize the interior block of an area and compute its contribution to the Schur complement
+ * @param area area
+ * @return @b false if the interior block is singular
+ */
+bool
+factorizeArea(Area& area) {
+  const sunindextype nbInterior = area.interiorBlock.nbCols;
+  if (nbInterior == 0)
+    return true;
+  if (!area.factorization.factorize(area.interiorBlock.colPtrs.data(), area.interiorBlock.rowIdx.data(), area.interiorBlock.values.data()))
+    return false;
+
+  // contribution = interfaceInterior * interior^-1 * interiorInterface, computed by chunks of columns
+  const sunindextype nbCouplingRows = area.interfaceInterior.nbRows;
+  const sunindextype nbCouplingCols = area.interiorInterface.nbCols;
+  const SparseBlock& interiorInterface = area.interiorInterface;
+  const SparseBlock& interfaceInterior = area.interfaceInterior;
+  area.contribution.assign(nbCouplingRows * nbCouplingCols, 0.);
+  for (sunindextype firstCol = 0; firstCol < nbCouplingCols; firstCol += SCHUR_COLUMNS_CHUNK_SIZE) {
+    const sunindextype nbCols = std::min(SCHUR_COLUMNS_CHUNK_SIZE, nbCouplingCols - firstCol);
+    area.work.assign(nbInterior * nbCols, 0.);
+    for (sunindextype c = 0; c < nbCols; ++c) {
+      for (sunindextype p = interiorInterface.colPtrs[firstCol + c]; p < interiorInterface.colPtrs[firstCol + c + 1]; ++p)
+        area.work[c * nbInterior + interiorInterface.rowIdx[p]] = interiorInterface.values[p];
+    }
+    if (!area.factorization.solve(nbInterior, nbCols, area.work.data(), false))
+      return false;
+    for (sunindextype j = 0; j < nbInterior; ++j) {
+      for (sunindextype p = interfaceInterior.colPtrs[j]; p < interfaceInterior.colPtrs[j + 1]; ++p) {
+        realtype* contributionRow = &area.contribution[interfaceInterior.rowIdx[p] * nbCouplingCols + firstCol];
+        const realtype value = interfaceInterior.values[p];
+        for (sunindextype c = 0; c < nbCols; ++c)
+          contributionRow[c] += value * area.work[c * nbInterior + j];
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief factorize the whole matrix, when the partition cannot be used
+ * @param content content of the linear solver
+ * @param JJ sparse matrix
+ * @return status of the setup
+ */
+int
+factorizeWholeMatrix(DomainDecompositionContent& content, SUNMatrix JJ) {
+  if (!content.wholeFactorization.isAnalyzed() && !content.wholeFactorization.analyze(SM_NP_S(JJ), SM_INDEXPTRS_S(JJ), SM_INDEXVALS_S(JJ))) {
+    content.lastFlag = SUNLS_PACKAGE_FAIL_UNREC;
+    return SUNLS_PACKAGE_FAIL_UNREC;
+  }
+  if (!content.wholeFactorization.factorize(SM_INDEXPTRS_S(JJ), SM_INDEXVALS_S(JJ), SM_DATA_S(JJ))) {
+    content.lastFlag = SUNLS_LUFACT_FAIL;
+    return SUNLS_LUFACT_FAIL;
+  }
+  content.lastFlag = SUNLS_SUCCESS;
+  return SUNLS_SUCCESS;
+}
+
+/**
+ * @brief type of the linear solver
+ * @return direct linear solver
+ */
+SUNLinearSolver_Type
+getTypeDomainDecomposition(SUNLinearSolver) {
+  return SUNLINEARSOLVER_DIRECT;
+}
+
+/**
+ * @brief identifier of the linear solver
+ * @return custom linear solver
+ */
+SUNLinearSolver_ID
+getIdDomainDecomposition(SUNLinearSolver) {
+  return SUNLINEARSOLVER_CUSTOM;
+}
+
+/**
+ * @brief initialization of the linear solver
+ * @param LS linear solver
+ * @return status of the initialization
+ */
+int
+initializeDomainDecomposition(SUNLinearSolver LS) {
+  content(LS)->lastFlag = SUNLS_SUCCESS;
+  return SUNLS_SUCCESS;
+}
+
+/**
+ * @brief setup (factorization) of the linear solver
+ * @param LS linear solver
+ * @param A matrix to factorize
+ * @return status of the setup
+ */
+int
+setupDomainDecomposition(SUNLinearSolver LS, SUNMatrix A) {
+  DYN::ProfilerScope profilerScope(DYN::Profiler::FACTORIZATION);
+  DomainDecompositionContent& solverContent = *content(LS);
+  // a structure change is normally notified through reinit, the number of elements is checked all the same
+  if (!solverContent.analyzed || static_cast<sunindextype>(solverContent.destinations.size()) != SM_INDEXPTRS_S(A)[SM_NP_S(A)]) {
+    analyze(solverContent, A);
+    solverContent.analyzed = true;
+  }
+  if (solverContent.wholeMatrix)
+    return factorizeWholeMatrix(solverContent, A);
+
+  const realtype* data = SM_DATA_S(A);
+  std::fill(solverContent.schur.values.begin(), solverContent.schur.values.end(), 0.);
+  for (size_t p = 0; p < solverContent.destinations.size(); ++p) {
+    const Destination& destination = solverContent.destinations[p];
+    switch (destination.kind) {
+      case INTERIOR:
+        solverContent.areas[destination.area]->interiorBlock.values[destination.position] = data[p];
+        break;
+      case INTERIOR_INTERFACE:
+        solverContent.areas[destination.area]->interiorInterface.values[destination.position] = data[p];
+        break;
+      case INTERFACE_INTERIOR:
+        solverContent.areas[destination.area]->interfaceInterior.values[destination.position] = data[p];
+        break;
+      case INTERFACE:
+        solverContent.schur.values[destination.position] = data[p];
+        break;
+    }
+  }
+
+  std::vector<char> factorized(solverContent.nbAreas, 0);
+  solverContent.threadPool->parallelFor(solverContent.nbAreas, [&solverContent, &factorized](const unsigned k) {
+    factorized[k] = factorizeArea(*solverContent.areas[k]);
+  });
+  if (std::find(factorized.begin(), factorized.end(), 0) != factorized.end()) {
+    DYN::Trace::debug() << DYNLog(DomainDecompositionFallback) << DYN::Trace::endline;
+    solverContent.wholeMatrix = true;
+    for (const auto& area : solverContent.areas)
+      area->factorization.clear();
+    solverContent.schurFactorization.clear();
+    return factorizeWholeMatrix(solverContent, A);
+  }
+
+  for (const auto& area : solverContent.areas) {
+    for (size_t p = 0; p < area->schurPositions.size(); ++p)
+      solverContent.schur.values[area->schurPositions[p]] -= area->contribution[p];
+  }
+  if (solverContent.schur.nbCols > 0
+      && !solverContent.schurFactorization.factorize(solverContent.schur.colPtrs.data(), solverContent.schur.rowIdx.data(),
+      solverContent.schur.values.data())) {
+    solverContent.lastFlag = SUNLS_LUFACT_FAIL;
+    return SUNLS_LUFACT_FAIL;
+  }
+  solverContent.lastFlag = SUNLS_SUCCESS;
+  return SUNLS_SUCCESS;
+}
+
+/**
+ * @brief solve of the linear solver
+ * @param LS linear solver
+ * @param A factorized matrix
+ * @param x solution
+ * @param b right-hand side
+ * @return status of the solve
+ */
+int
+solveDomainDecomposition(SUNLinearSolver LS, SUNMatrix A, N_Vector x, N_Vector b, realtype) {
+  DYN::ProfilerScope profilerScope(DYN::Profiler::LINEAR_SOLVE);
+  DomainDecompositionContent& solverContent = *content(LS);
+  realtype* xData = N_VGetArrayPointer(x);
+  const realtype* bData = N_VGetArrayPointer(b);
+  solverContent.lastFlag = SUNLS_PACKAGE_FAIL_UNREC;
+
+  if (solverContent.wholeMatrix) {
+    if (xData != bData)
+      std::copy(bData, bData + SM_COLUMNS_S(A), xData);
+    // a matrix stored by rows is seen by KLU as its transpose stored by columns
+    if (!solverContent.wholeFactorization.solve(SM_COLUMNS_S(A), 1, xData, SM_SPARSETYPE_S(A) == CSR_MAT))
+      return SUNLS_PACKAGE_FAIL_UNREC;
+    solverContent.lastFlag = SUNLS_SUCCESS;
+    return SUNLS_SUCCESS;
+  }
+
+  // forward substitution of the areas: interfaceWork = interfaceInterior * interior^-1 * b_interior
+  std::vector<char> solved(solverContent.nbAreas, 1);
+  solverContent.threadPool->parallelFor(solverContent.nbAreas, [&solverContent, &solved, bData](const unsigned k) {
+    Area& area = *solverContent.areas[k];
+    const sunindextype nbInterior = area.interiorBlock.nbCols;
+    area.interfaceWork.assign(area.couplingRows.size(), 0.);
+    if (nbInterior == 0)
+      return;
+    area.work.resize(nbInterior);
+    for (sunindextype j = 0; j < nbInterior; ++j)
+      area.work[j] = bData[area.interior[j]];
+    if (!area.factorization.solve(nbInterior, 1, area.work.data(), false)) {
+      solved[k] = 0;
+      return;
+    }
+    const SparseBlock& interfaceInterior = area.interfaceInterior;
+    for (sunindextype j = 0; j < nbInterior; ++j) {
+      for (sunindextype p = interfaceInterior.colPtrs[j]; p < interfaceInterior.colPtrs[j + 1]; ++p)
+        area.interfaceWork[interfaceInterior.rowIdx[p]] += interfaceInterior.values[p] * area.work[j];
+    }
+  });
+  if (std::find(solved.begin(), solved.end(), 0) != solved.end())
+    return SUNLS_PACKAGE_FAIL_UNREC;
+
+  // solve on the interface
+  const sunindextype nbInterface = static_cast<sunindextype>(solverContent.interface.size());
+  std::vector<realtype>& interfaceWork = solverContent.interfaceWork;
+  for (sunindextype i = 0; i < nbInterface; ++i)
+    interfaceWork[i] = bData[solverContent.interface[i]];
+  for (const auto& area : solverContent.areas) {
+    for (size_t r = 0; r < area->couplingRows.size(); ++r)
+      interfaceWork[area->couplingRows[r]] -= area->interfaceWork[r];
+  }
+  if (nbInterface > 0 && !solverContent.schurFactorization.solve(nbInterface, 1, interfaceWork.data(), false))
+    return SUNLS_PACKAGE_FAIL_UNREC;
+
+  // backward substitution of the areas: x_interior = interior^-1 * (b_interior - interiorInterface * x_interface)
+  solverContent.threadPool->parallelFor(solverContent.nbAreas, [&solverContent, &solved, &interfaceWork, bData, xData](const unsigned k) {
+    Area& area = *solverContent.areas[k];
+    const sunindextype nbInterior = area.interiorBlock.nbCols;
+    if (nbInterior == 0)
+      return;
+    for (sunindextype j = 0; j < nbInterior; ++j)
+      area.work[j] = bData[area.interior[j]];
+    const SparseBlock& interiorInterface = area.interiorInterface;
+    for (sunindextype c = 0; c < interiorInterface.nbCols; ++c) {
+      const realtype xInterface = interfaceWork[area.couplingCols[c]];
+      for (sunindextype p = interiorInterface.colPtrs[c]; p < interiorInterface.colPtrs[c + 1]; ++p)
+        area.work[interiorInterface.rowIdx[p]] -= interiorInterface.values[p] * xInterface;
+    }
+    if (!area.factorization.solve(nbInterior, 1, area.work.data(), false)) {
+      solved[k] = 0;
+      return;
+    }
+    // b may be x: the area only overwrites its own interior unknowns, once read
+    for (sunindextype j = 0; j < nbInterior; ++j)
+      xData[area.interior[j]] = area.work[j];
+  });
+  if (std::find(solved.begin(), solved.end(), 0) != solved.end())
+    return SUNLS_PACKAGE_FAIL_UNREC;
+  for (sunindextype i = 0; i < nbInterface; ++i)
+    xData[solverContent.interface[i]] = interfaceWork[i];
+  solverContent.lastFlag = SUNLS_SUCCESS;
+  return SUNLS_SUCCESS;
+}
+
+/**
+ * @brief status of the last setup or solve
+ * @param LS linear solver
+ * @return status
+ */
+sunindextype
+lastFlagDomainDecomposition(SUNLinearSolver LS) {
+  return content(LS)->lastFlag;
+}
+
+/**
+ * @brief memory used by the linear solver, not reported
+ * @param lenrwLS number of reals, to fill
+ * @param leniwLS number of integers, to fill
+ * @return status
+ */
+int
+spaceDomainDecomposition(SUNLinearSolver, long int* lenrwLS, long int* leniwLS) {
+  *lenrwLS = 0;
+  *leniwLS = 0;
+  return SUNLS_SUCCESS;
+}
+
+/**
+ * @brief release the linear solver
+ * @param LS linear solver
+ * @return status
+ */
+int
+freeDomainDecomposition(SUNLinearSolver LS) {
+  if (LS == NULL)
+    return SUNLS_SUCCESS;
+  delete content(LS);
+  LS->content = NULL;
+  SUNLinSolFreeEmpty(LS);
+  return SUNLS_SUCCESS;
+}
+
+}  // namespace
+
+namespace DYN {
+
+SUNLinearSolver
+DomainDecompositionLinearSolver::create(const unsigned nbAreas, SUNMatrix JJ, SUNContext context) {
+  if (JJ == NULL || SM_ROWS_S(JJ) != SM_COLUMNS_S(JJ))
+    return NULL;
+  SUNLinearSolver LS = SUNLinSolNewEmpty(context);
+  if (LS == NULL)
+    return NULL;
+  LS->ops->gettype = getTypeDomainDecomposition;
+  LS->ops->getid = getIdDomainDecomposition;
+  LS->ops->initialize = initializeDomainDecomposition;
+  LS->ops->setup = setupDomainDecomposition;
+  LS->ops->solve = solveDomainDecomposition;
+  LS->ops->lastflag = lastFlagDomainDecomposition;
+  LS->ops->space = spaceDomainDecomposition;
+  LS->ops->free = freeDomainDecomposition;
+  LS->content = new DomainDecompositionContent(std::max(nbAreas, 1U));
+  return LS;
+}
+
+bool
+DomainDecompositionLinearSolver::isDomainDecomposition(SUNLinearSolver LS) {
+  return LS != NULL && LS->ops != NULL && LS->ops->setup == setupDomainDecomposition;
+}
+
+void
+DomainDecompositionLinearSolver::reinit(SUNLinearSolver LS) {
+  if (isDomainDecomposition(LS))
+    content(LS)->analyzed = false;
+}
+
+long
+DomainDecompositionLinearSolver::getNbInterfaceUnknowns(SUNLinearSolver LS) {
+  if (!isDomainDecomposition(LS))
+    return 0;
+  return static_cast<long>(content(LS)->interface.size());
+}
+
+}  // end namespace DYN
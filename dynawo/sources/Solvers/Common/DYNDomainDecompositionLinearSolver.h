@@ -0,0 +1,85 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNDomainDecompositionLinearSolver.h
+ *
+ * @brief Sparse direct linear solver factorizing the areas of a partition of the system in parallel
+ *
+ */
+#ifndef SOLVERS_COMMON_DYNDOMAINDECOMPOSITIONLINEARSOLVER_H_
+#define SOLVERS_COMMON_DYNDOMAINDECOMPOSITIONLINEARSOLVER_H_
+
+#include <sundials/sundials_linearsolver.h>
+#include <sundials/sundials_matrix.h>
+#include <sundials/sundials_nvector.h>
+
+namespace DYN {
+
+/**
+ * @brief DomainDecompositionLinearSolver static class: creation of the domain decomposition linear solver
+ *
+ * At the first factorization after a structure change, the unknowns are partitioned into areas following the graph of the
+ * matrix, so that the dynamic models stay with the part of the network they are connected to: the unknowns are ordered by
+ * breadth-first search from a peripheral unknown and the order is cut into areas of the same size. The unknowns connected
+ * to an unknown of a previous area form the interface.
+ *
+ * The interior block of each area is factorized with KLU by the threads of the solver, along with its contribution to the
+ * Schur complement of the interface, which is then factorized with KLU too. A solve runs the forward and the backward
+ * substitutions of the areas in parallel around the solve on the interface.
+ *
+ * The factorization of an interior block only pivots inside the block: if one of them is singular although the system
+ * is not, the solver falls back to the factorization of the whole matrix until the next structure change.
+ */
+class DomainDecompositionLinearSolver {
+ public:
+  /**
+   * @brief create a domain decomposition linear solver
+   *
+   * @param nbAreas number of areas of the partition, which is also the number of threads of the solver
+   * @param JJ sparse matrix the linear solver works on
+   * @param context sundials context
+   *
+   * @return the linear solver, to be released with SUNLinSolFree, NULL if the allocation failed
+   */
+  static SUNLinearSolver create(unsigned nbAreas, SUNMatrix JJ, SUNContext context);
+
+  /**
+   * @brief indicate whether a linear solver is a domain decomposition linear solver
+   *
+   * @param LS linear solver
+   *
+   * @return @b true if LS was created by this class
+   */
+  static bool isDomainDecomposition(SUNLinearSolver LS);
+
+  /**
+   * @brief force a new partition and new symbolic analyses at the next factorization, after a structure change of the matrix
+   *
+   * @param LS domain decomposition linear solver
+   */
+  static void reinit(SUNLinearSolver LS);
+
+  /**
+   * @brief get the number of interface unknowns of the current partition
+   *
+   * @param LS domain decomposition linear solver
+   *
+   * @return number of unknowns of the Schur complement, 0 before the first factorization
+   */
+  static long getNbInterfaceUnknowns(SUNLinearSolver LS);
+};
+
+}  // end namespace DYN
+
+#endif  // SOLVERS_COMMON_DYNDOMAINDECOMPOSITIONLINEARSOLVER_H_
@@ -0,0 +1,394 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNIslandsLinearSolver.cpp
+ *
+ * @brief Islands linear solver implementation
+ *
+ */
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <boost/core/noncopyable.hpp>
+#include <sunmatrix/sunmatrix_sparse.h>
+
+#include "DYNIslandsLinearSolver.h"
+#include "DYNKLUFactorization.h"
+#include "DYNThreadPool.h"
+#include "DYNProfiler.h"
+#include "DYNMacrosMessage.h"
+#include "DYNTrace.h"
+
+namespace {
+
+/**
+ * @brief islands factorized by one thread, forming a block diagonal matrix
+ */
+struct IslandsGroup : private boost::noncopyable {
+  IslandsGroup() : nbElements(0) { }
+
+  std::vector<sunindextype> unknowns;  ///< unknowns of the islands of the group, sorted
+  std::vector<sunindextype> ptrs;  ///< index of the first element of each compressed row or column, stored as the matrix
+  std::vector<sunindextype> vals;  ///< index of each element in its compressed row or column
+  std::vector<sunindextype> positions;  ///< position in the matrix of each element
+  std::vector<realtype> values;  ///< value of each element
+  std::vector<realtype> work;  ///< right-hand side and solution of the group
+  sunindextype nbElements;  ///< number of elements, to balance the groups
+  DYN::KLUFactorization factorization;  ///< factors of the group
+};
+
+/**
+ * @brief content of the islands linear solver
+ */
+struct IslandsContent : private boost::noncopyable {
+  /**
+   * @brief constructor
+   * @param nbThreads number of threads factorizing the islands
+   */
+  explicit IslandsContent(const unsigned nbThreads) :
+  threadPool(new DYN::ThreadPool(nbThreads)),
+  analyzed(false),
+  nbIslands(0),
+  nbElements(0),
+  lastFlag(0) { }
+
+  std::unique_ptr<DYN::ThreadPool> threadPool;  ///< threads factorizing and solving the groups
+  bool analyzed;  ///< whether the islands match the structure of the matrix
+  unsigned nbIslands;  ///< number of independent islands
+  sunindextype nbElements;  ///< number of elements of the matrix
+  std::vector<std::unique_ptr<IslandsGroup> > groups;  ///< islands of each thread
+  sunindextype lastFlag;  ///< status of the last setup or solve
+};
+
+/**
+ * @brief get the content of an islands linear solver
+ * @param LS linear solver
+ * @return content of the linear solver
+ */
+IslandsContent*
+content(SUNLinearSolver LS) {
+  return reinterpret_cast<IslandsContent*>(LS->content);
+}
+
+/**
+ * @brief find the representative of the island of an unknown, compressing the path to it
+ * @param parents parent of each unknown in the union-find forest
+ * @param i unknown
+ * @return representative of the island of i
+ */
+sunindextype
+findRoot(std::vector<sunindextype>& parents, sunindextype i) {
+  sunindextype root = i;
+  while (parents[root] != root)
+    root = parents[root];
+  while (parents[i] != root) {
+    const sunindextype next = parents[i];
+    parents[i] = root;
+    i = next;
+  }
+  return root;
+}
+
+/**
+ * @brief find the islands of the matrix and distribute them among the groups
+ * @param solverContent content of the linear solver
+ * @param A sparse matrix
+ * @return @b false if the symbolic analysis of a group failed
+ */
+bool
+analyze(IslandsContent& solverContent, SUNMatrix A) {
+  const sunindextype n = SM_NP_S(A);
+  const sunindextype* indexPtrs = SM_INDEXPTRS_S(A);
+  const sunindextype* indexVals = SM_INDEXVALS_S(A);
+
+  // the islands are the connected components of the graph of the matrix, whatever its storage
+  std::vector<sunindextype> parents(n);
+  for (sunindextype i = 0; i < n; ++i)
+    parents[i] = i;
+  for (sunindextype i = 0; i < n; ++i) {
+    for (sunindextype p = indexPtrs[i]; p < indexPtrs[i + 1]; ++p) {
+      const sunindextype root1 = findRoot(parents, i);
+      const sunindextype root2 = findRoot(parents, indexVals[p]);
+      if (root1 != root2)
+        parents[std::max(root1, root2)] = std::min(root1, root2);
+    }
+  }
+  std::vector<sunindextype> islandOf(n, -1);
+  std::vector<sunindextype> islandSizes;
+  for (sunindextype i = 0; i < n; ++i) {
+    const sunindextype root = findRoot(parents, i);
+    if (islandOf[root] < 0) {
+      islandOf[root] = static_cast<sunindextype>(islandSizes.size());
+      islandSizes.push_back(0);
+    }
+    islandOf[i] = islandOf[root];
+    islandSizes[islandOf[i]] += indexPtrs[i + 1] - indexPtrs[i];
+  }
+  const unsigned nbIslands = static_cast<unsigned>(islandSizes.size());
+
+  // largest island first, to the group with the fewest elements so far
+  const unsigned nbGroups = std::max(std::min(solverContent.threadPool->nbThreads(), nbIslands), 1U);
+  std::vector<unsigned> islands(nbIslands);
+  for (unsigned k = 0; k < nbIslands; ++k)
+    islands[k] = k;
+  std::stable_sort(islands.begin(), islands.end(), [&islandSizes](const unsigned k1, const unsigned k2) {
+    return islandSizes[k1] > islandSizes[k2];
+  });
+  solverContent.groups.clear();
+  for (unsigned g = 0; g < nbGroups; ++g)
+    solverContent.groups.push_back(std::unique_ptr<IslandsGroup>(new IslandsGroup()));
+  std::vector<unsigned> groupOf(nbIslands, 0);
+  for (unsigned k = 0; k < nbIslands; ++k) {
+    unsigned lightest = 0;
+    for (unsigned g = 1; g < nbGroups; ++g) {
+      if (solverContent.groups[g]->nbElements < solverContent.groups[lightest]->nbElements)
+        lightest = g;
+    }
+    groupOf[islands[k]] = lightest;
+    solverContent.groups[lightest]->nbElements += islandSizes[islands[k]];
+  }
+
+  // the block of a group is compressed as the matrix, all the elements of a row or column belonging to the same island
+  std::vector<sunindextype> localIndex(n);
+  for (sunindextype i = 0; i < n; ++i) {
+    IslandsGroup& group = *solverContent.groups[groupOf[islandOf[i]]];
+    localIndex[i] = static_cast<sunindextype>(group.unknowns.size());
+    group.unknowns.push_back(i);
+  }
+  for (const auto& group : solverContent.groups) {
+    group->ptrs.assign(1, 0);
+    group->vals.clear();
+    group->positions.clear();
+    for (std::size_t j = 0; j < group->unknowns.size(); ++j) {
+      const sunindextype i = group->unknowns[j];
+      for (sunindextype p = indexPtrs[i]; p < indexPtrs[i + 1]; ++p) {
+        group->vals.push_back(localIndex[indexVals[p]]);
+        group->positions.push_back(p);
+      }
+      group->ptrs.push_back(static_cast<sunindextype>(group->vals.size()));
+    }
+    group->values.resize(group->vals.size());
+    group->work.resize(group->unknowns.size());
+  }
+
+  std::vector<char> analyzed(nbGroups, 1);
+  solverContent.threadPool->parallelFor(nbGroups, [&solverContent, &analyzed](const unsigned g) {
+    IslandsGroup& group = *solverContent.groups[g];
+    if (!group.unknowns.empty())
+      analyzed[g] = group.factorization.analyze(static_cast<sunindextype>(group.unknowns.size()), group.ptrs.data(), group.vals.data());
+  });
+  solverContent.nbIslands = nbIslands;
+  solverContent.nbElements = indexPtrs[n];
+  DYN::Trace::debug() << DYNLog(IslandsPartition, nbIslands, nbGroups) << DYN::Trace::endline;
+  return std::find(analyzed.begin(), analyzed.end(), 0) == analyzed.end();
+}
+
+/**
+ * @brief type of the linear solver
+ * @return direct linear solver
+ */
+SUNLinearSolver_Type
+getTypeIslands(SUNLinearSolver) {
+  return SUNLINEARSOLVER_DIRECT;
+}
+
+/**
+ * @brief identifier of the linear solver
+ * @return custom linear solver
+ */
+SUNLinearSolver_ID
+getIdIslands(SUNLinearSolver) {
+  return SUNLINEARSOLVER_CUSTOM;
+}
+
+/**
+ * @brief initialization of the linear solver
+ * @param LS linear solver
+ * @return status of the initialization
+ */
+int
+initializeIslands(SUNLinearSolver LS) {
+  content(LS)->lastFlag = SUNLS_SUCCESS;
+  return SUNLS_SUCCESS;
+}
+
+/**
+ * @brief setup (factorization) of the linear solver
+ * @param LS linear solver
+ * @param A matrix to factorize
+ * @return status of the setup
+ */
+int
+setupIslands(SUNLinearSolver LS, SUNMatrix A) {
+  DYN::ProfilerScope profilerScope(DYN::Profiler::FACTORIZATION);
+  IslandsContent& solverContent = *content(LS);
+  // a structure change is normally notified through reinit, the number of elements is checked all the same
+  if (!solverContent.analyzed || solverContent.nbElements != SM_INDEXPTRS_S(A)[SM_NP_S(A)]) {
+    solverContent.analyzed = analyze(solverContent, A);
+    if (!solverContent.analyzed) {
+      solverContent.lastFlag = SUNLS_PACKAGE_FAIL_UNREC;
+      return SUNLS_PACKAGE_FAIL_UNREC;
+    }
+  }
+
+  const realtype* data = SM_DATA_S(A);
+  const unsigned nbGroups = static_cast<unsigned>(solverContent.groups.size());
+  std::vector<char> factorized(nbGroups, 1);
+  solverContent.threadPool->parallelFor(nbGroups, [&solverContent, &factorized, data](const unsigned g) {
+    IslandsGroup& group = *solverContent.groups[g];
+    if (group.unknowns.empty())
+      return;
+    for (std::size_t p = 0; p < group.positions.size(); ++p)
+      group.values[p] = data[group.positions[p]];
+    factorized[g] = group.factorization.factorize(group.ptrs.data(), group.vals.data(), group.values.data());
+  });
+  if (std::find(factorized.begin(), factorized.end(), 0) != factorized.end()) {
+    solverContent.lastFlag = SUNLS_LUFACT_FAIL;
+    return SUNLS_LUFACT_FAIL;
+  }
+  solverContent.lastFlag = SUNLS_SUCCESS;
+  return SUNLS_SUCCESS;
+}
+
+/**
+ * @brief solve of the linear solver
+ * @param LS linear solver
+ * @param A factorized matrix
+ * @param x solution
+ * @param b right-hand side
+ * @return status of the solve
+ */
+int
+solveIslands(SUNLinearSolver LS, SUNMatrix A, N_Vector x, N_Vector b, realtype) {
+  DYN::ProfilerScope profilerScope(DYN::Profiler::LINEAR_SOLVE);
+  IslandsContent& solverContent = *content(LS);
+  realtype* xData = N_VGetArrayPointer(x);
+  const realtype* bData = N_VGetArrayPointer(b);
+  // a matrix stored by rows is seen by KLU as its transpose stored by columns
+  const bool transpose = SM_SPARSETYPE_S(A) == CSR_MAT;
+  const unsigned nbGroups = static_cast<unsigned>(solverContent.groups.size());
+  std::vector<char> solved(nbGroups, 1);
+  solverContent.threadPool->parallelFor(nbGroups, [&solverContent, &solved, bData, xData, transpose](const unsigned g) {
+    IslandsGroup& group = *solverContent.groups[g];
+    const sunindextype size = static_cast<sunindextype>(group.unknowns.size());
+    if (size == 0)
+      return;
+    for (sunindextype j = 0; j < size; ++j)
+      group.work[j] = bData[group.unknowns[j]];
+    if (!group.factorization.solve(size, 1, group.work.data(), transpose)) {
+      solved[g] = 0;
+      return;
+    }
+    // b may be x: the group only overwrites its own unknowns, once read
+    for (sunindextype j = 0; j < size; ++j)
+      xData[group.unknowns[j]] = group.work[j];
+  });
+  if (std::find(solved.begin(), solved.end(), 0) != solved.end()) {
+    solverContent.lastFlag = SUNLS_PACKAGE_FAIL_UNREC;
+    return SUNLS_PACKAGE_FAIL_UNREC;
+  }
+  solverContent.lastFlag = SUNLS_SUCCESS;
+  return SUNLS_SUCCESS;
+}
+
+/**
+ * @brief status of the last setup or solve
+ * @param LS linear solver
+ * @return status
+ */
+sunindextype
+lastFlagIslands(SUNLinearSolver LS) {
+  return content(LS)->lastFlag;
+}
+
+/**
+ * @brief memory used by the linear solver, not reported
+ * @param lenrwLS number of reals, to fill
+ * @param leniwLS number of integers, to fill
+ * @return status
+ */
+int
+spaceIslands(SUNLinearSolver, long int* lenrwLS, long int* leniwLS) {
+  *lenrwLS = 0;
+  *leniwLS = 0;
+  return SUNLS_SUCCESS;
+}
+
+/**
+ * @brief release the linear solver
+ * @param LS linear solver
+ * @return status
+ */
+int
+freeIslands(SUNLinearSolver LS) {
+  if (LS == NULL)
+    return SUNLS_SUCCESS;
+  delete content(LS);
+  LS->content = NULL;
+  SUNLinSolFreeEmpty(LS);
+  return SUNLS_SUCCESS;
+}
+
+}  // namespace
+
+namespace DYN {
+
+SUNLinearSolver
+IslandsLinearSolver::create(const unsigned nbThreads, SUNMatrix JJ, SUNContext context) {
+  if (JJ == NULL || SM_ROWS_S(JJ) != SM_COLUMNS_S(JJ))
+    return NULL;
+  SUNLinearSolver LS = SUNLinSolNewEmpty(context);
+  if (LS == NULL)
+    return NULL;
+  LS->ops->gettype = getTypeIslands;
+  LS->ops->getid = getIdIslands;
+  LS->ops->initialize = initializeIslands;
+  LS->ops->setup = setupIslands;
+  LS->ops->solve = solveIslands;
+  LS->ops->lastflag = lastFlagIslands;
+  LS->ops->space = spaceIslands;
+  LS->ops->free = freeIslands;
+  LS->content = new IslandsContent(std::max(nbThreads, 1U));
+  return LS;
+}
+
+bool
+IslandsLinearSolver::isIslands(SUNLinearSolver LS) {
+  return LS != NULL && LS->ops != NULL && LS->ops->setup == setupIslands;
+}
+
+void
+IslandsLinearSolver::reinit(SUNLinearSolver LS) {
+  if (isIslands(LS))
+    content(LS)->analyzed = false;
+}
+
+unsigned
+IslandsLinearSolver::getNbIslands(SUNLinearSolver LS) {
+  if (!isIslands(LS))
+    return 0;
+  return content(LS)->nbIslands;
+}
+
+std::size_t
+IslandsLinearSolver::getMemoryUsage(SUNLinearSolver LS) {
+  if (!isIslands(LS))
+    return 0;
+  std::size_t memoryUsage = 0;
+  for (const auto& group : content(LS)->groups)
+    memoryUsage += group->factorization.getMemoryUsage();
+  return memoryUsage;
+}
+
+}  // end namespace DYN
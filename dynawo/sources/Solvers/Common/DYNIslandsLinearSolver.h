@@ -0,0 +1,91 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNIslandsLinearSolver.h
+ *
+ * @brief Sparse direct linear solver factorizing the independent islands of the system concurrently
+ *
+ */
+#ifndef SOLVERS_COMMON_DYNISLANDSLINEARSOLVER_H_
+#define SOLVERS_COMMON_DYNISLANDSLINEARSOLVER_H_
+
+#include <cstddef>
+#include <sundials/sundials_linearsolver.h>
+#include <sundials/sundials_matrix.h>
+#include <sundials/sundials_nvector.h>
+
+namespace DYN {
+
+/**
+ * @brief IslandsLinearSolver static class: creation of the islands linear solver
+ *
+ * After a network separation, the system decouples into independent islands: the connected components of the graph of the
+ * matrix, with no element between two of them. At the first factorization after a structure change, the islands are
+ * distributed among the threads of the solver, the largest first, each one to the thread with the fewest elements so far.
+ * The islands of a thread form a block diagonal matrix, factorized and solved by KLU concurrently with the other threads.
+ *
+ * Unlike the domain decomposition, there is no interface: the solver is exact whatever the number of threads, and it comes
+ * down to a single KLU factorization as long as the network is not separated.
+ */
+class IslandsLinearSolver {
+ public:
+  /**
+   * @brief create an islands linear solver
+   *
+   * @param nbThreads number of threads factorizing the islands
+   * @param JJ sparse matrix the linear solver works on
+   * @param context sundials context
+   *
+   * @return the linear solver, to be released with SUNLinSolFree, NULL if the allocation failed
+   */
+  static SUNLinearSolver create(unsigned nbThreads, SUNMatrix JJ, SUNContext context);
+
+  /**
+   * @brief indicate whether a linear solver is an islands linear solver
+   *
+   * @param LS linear solver
+   *
+   * @return @b true if LS was created by this class
+   */
+  static bool isIslands(SUNLinearSolver LS);
+
+  /**
+   * @brief force the search of the islands and new symbolic analyses at the next factorization, after a structure change of the matrix
+   *
+   * @param LS islands linear solver
+   */
+  static void reinit(SUNLinearSolver LS);
+
+  /**
+   * @brief get the number of independent islands of the system
+   *
+   * @param LS islands linear solver
+   *
+   * @return number of islands found at the last structure change, 0 before the first factorization
+   */
+  static unsigned getNbIslands(SUNLinearSolver LS);
+
+  /**
+   * @brief get the memory allocated by KLU for the islands
+   *
+   * @param LS islands linear solver
+   *
+   * @return number of bytes allocated by KLU for all the threads
+   */
+  static std::size_t getMemoryUsage(SUNLinearSolver LS);
+};
+
+}  // end namespace DYN
+
+#endif  // SOLVERS_COMMON_DYNISLANDSLINEARSOLVER_H_
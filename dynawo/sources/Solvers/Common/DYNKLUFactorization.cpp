@@ -0,0 +1,79 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNKLUFactorization.cpp
+ *
+ * @brief KLU factors of a square sparse block implementation
+ *
+ */
+#include <cmath>
+#include <limits>
+
+#include "DYNKLUFactorization.h"
+
+#if defined(SUNDIALS_INT64_T)
+#define sun_klu_solve klu_l_solve
+#define sun_klu_tsolve klu_l_tsolve
+#else
+#define sun_klu_solve klu_solve
+#define sun_klu_tsolve klu_tsolve
+#endif
+
+namespace DYN {
+
+KLUFactorization::KLUFactorization() : symbolic_(NULL), numeric_(NULL) {
+  sun_klu_defaults(&common_);
+}
+
+KLUFactorization::~KLUFactorization() {
+  clear();
+}
+
+void
+KLUFactorization::clear() {
+  if (numeric_ != NULL)
+    sun_klu_free_numeric(&numeric_, &common_);
+  if (symbolic_ != NULL)
+    sun_klu_free_symbolic(&symbolic_, &common_);
+}
+
+bool
+KLUFactorization::analyze(const sunindextype n, sunindextype* colPtrs, sunindextype* rowIdx) {
+  clear();
+  symbolic_ = sun_klu_analyze(n, colPtrs, rowIdx, &common_);
+  return symbolic_ != NULL;
+}
+
+bool
+KLUFactorization::factorize(sunindextype* colPtrs, sunindextype* rowIdx, realtype* values) {
+  // same criterion as the Sundials KLU linear solver to choose between a refactorization and a new factorization
+  static const double rcondThreshold = std::pow(std::numeric_limits<double>::epsilon(), 2. / 3.);
+  if (numeric_ != NULL) {
+    if (sun_klu_refactor(colPtrs, rowIdx, values, symbolic_, numeric_, &common_) && sun_klu_rcond(symbolic_, numeric_, &common_)
+        && common_.rcond > rcondThreshold)
+      return true;
+    sun_klu_free_numeric(&numeric_, &common_);
+  }
+  numeric_ = sun_klu_factor(colPtrs, rowIdx, values, symbolic_, &common_);
+  return numeric_ != NULL;
+}
+
+bool
+KLUFactorization::solve(const sunindextype n, const sunindextype nbRhs, realtype* b, const bool transpose) {
+  if (transpose)
+    return sun_klu_tsolve(symbolic_, numeric_, n, nbRhs, b, &common_) != 0;
+  return sun_klu_solve(symbolic_, numeric_, n, nbRhs, b, &common_) != 0;
+}
+
+}  // end namespace DYN
@@ -0,0 +1,103 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNKLUFactorization.h
+ *
+ * @brief KLU factors of a square sparse block, for the linear solvers factorizing several blocks concurrently
+ *
+ */
+#ifndef SOLVERS_COMMON_DYNKLUFACTORIZATION_H_
+#define SOLVERS_COMMON_DYNKLUFACTORIZATION_H_
+
+#include <cstddef>
+#include <boost/core/noncopyable.hpp>
+#include <sunlinsol/sunlinsol_klu.h>
+
+namespace DYN {
+
+/**
+ * @brief KLU factors of a square block stored by columns
+ *
+ * Each block has its own KLU parameters and statistics, so that several blocks are factorized and solved concurrently.
+ */
+class KLUFactorization : private boost::noncopyable {
+ public:
+  /**
+   * @brief constructor
+   */
+  KLUFactorization();
+
+  /**
+   * @brief destructor
+   */
+  ~KLUFactorization();
+
+  /**
+   * @brief release the analysis and the factors
+   */
+  void clear();
+
+  /**
+   * @brief indicate whether the symbolic analysis is done
+   * @return @b true if the block was analyzed
+   */
+  bool isAnalyzed() const {
+    return symbolic_ != NULL;
+  }
+
+  /**
+   * @brief compute the symbolic analysis of a block
+   * @param n size of the block
+   * @param colPtrs column pointers of the block
+   * @param rowIdx row indexes of the block
+   * @return @b false if the analysis failed
+   */
+  bool analyze(sunindextype n, sunindextype* colPtrs, sunindextype* rowIdx);
+
+  /**
+   * @brief compute the numerical factorization of a block, reusing the pivots of the previous one when they are still accurate
+   * @param colPtrs column pointers of the block
+   * @param rowIdx row indexes of the block
+   * @param values values of the block
+   * @return @b false if the block is singular
+   */
+  bool factorize(sunindextype* colPtrs, sunindextype* rowIdx, realtype* values);
+
+  /**
+   * @brief solve systems with the factorized block
+   * @param n size of the block
+   * @param nbRhs number of right-hand sides, stored one after the other
+   * @param b right-hand sides, replaced by the solutions
+   * @param transpose @b true to solve with the transpose of the block
+   * @return @b false if the solve failed
+   */
+  bool solve(sunindextype n, sunindextype nbRhs, realtype* b, bool transpose);
+
+  /**
+   * @brief get the memory allocated by KLU for the block
+   * @return number of bytes allocated by KLU
+   */
+  std::size_t getMemoryUsage() const {
+    return common_.memusage;
+  }
+
+ private:
+  sun_klu_common common_;  ///< KLU parameters and statistics
+  sun_klu_symbolic* symbolic_;  ///< symbolic analysis
+  sun_klu_numeric* numeric_;  ///< numerical factors
+};
+
+}  // end namespace DYN
+
+#endif  // SOLVERS_COMMON_DYNKLUFACTORIZATION_H_
@@ -0,0 +1,233 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNLinearSolver.cpp
+ *
+ * @brief Sparse direct linear solvers implementation
+ *
+ */
+#include <sunmatrix/sunmatrix_sparse.h>
+#include <sunlinsol/sunlinsol_klu.h>
+#ifdef WITH_SUPERLUMT
+#include <sunlinsol/sunlinsol_superlumt.h>
+#endif
+
+#include "DYNLinearSolver.h"
+#include "DYNActiveSetLinearSolver.h"
+#include "DYNIslandsLinearSolver.h"
+#include "DYNDomainDecompositionLinearSolver.h"
+#include "DYNMixedPrecisionLinearSolver.h"
+#include "DYNMacrosMessage.h"
+#include "DYNProfiler.h"
+
+namespace {
+
+/**
+ * @brief setup (factorization) of the KLU linear solver, profiled
+ * @param LS linear solver
+ * @param A matrix to factorize
+ * @return status of the setup
+ */
+int
+profiledSetupKLU(SUNLinearSolver LS, SUNMatrix A) {
+  DYN::ProfilerScope profilerScope(DYN::Profiler::FACTORIZATION);
+  return SUNLinSolSetup_KLU(LS, A);
+}
+
+/**
+ * @brief solve of the KLU linear solver, profiled
+ * @param LS linear solver
+ * @param A factorized matrix
+ * @param x solution
+ * @param b right-hand side
+ * @param tol tolerance, ignored by the direct solvers
+ * @return status of the solve
+ */
+int
+profiledSolveKLU(SUNLinearSolver LS, SUNMatrix A, N_Vector x, N_Vector b, realtype tol) {
+  DYN::ProfilerScope profilerScope(DYN::Profiler::LINEAR_SOLVE);
+  return SUNLinSolSolve_KLU(LS, A, x, b, tol);
+}
+
+#ifdef WITH_SUPERLUMT
+/**
+ * @copydoc profiledSetupKLU
+ */
+int
+profiledSetupSuperLUMT(SUNLinearSolver LS, SUNMatrix A) {
+  DYN::ProfilerScope profilerScope(DYN::Profiler::FACTORIZATION);
+  return SUNLinSolSetup_SuperLUMT(LS, A);
+}
+
+/**
+ * @copydoc profiledSolveKLU
+ */
+int
+profiledSolveSuperLUMT(SUNLinearSolver LS, SUNMatrix A, N_Vector x, N_Vector b, realtype tol) {
+  DYN::ProfilerScope profilerScope(DYN::Profiler::LINEAR_SOLVE);
+  return SUNLinSolSolve_SuperLUMT(LS, A, x, b, tol);
+}
+#endif
+
+}  // namespace
+
+namespace DYN {
+
+LinearSolver::linearSolverType_t
+LinearSolver::fromString(const std::string& name) {
+  if (name == "KLU")
+    return KLU;
+  if (name == "SuperLU_MT")
+    return SUPERLU_MT;
+  if (name == "DomainDecomposition")
+    return DOMAIN_DECOMPOSITION;
+  if (name == "MixedPrecision")
+    return MIXED_PRECISION;
+  if (name == "ActiveSet")
+    return ACTIVE_SET;
+  if (name == "Islands")
+    return ISLANDS;
+  throw DYNError(Error::GENERAL, WrongLinearSolverChoice);
+}
+
+std::string
+LinearSolver::toString(const linearSolverType_t type) {
+  switch (type) {
+    case KLU:
+      return "KLU";
+    case SUPERLU_MT:
+      return "SuperLU_MT";
+    case DOMAIN_DECOMPOSITION:
+      return "DomainDecomposition";
+    case MIXED_PRECISION:
+      return "MixedPrecision";
+    case ACTIVE_SET:
+      return "ActiveSet";
+    case ISLANDS:
+      return "Islands";
+  }
+  return "";
+}
+
+bool
+LinearSolver::isAvailable(const linearSolverType_t type) {
+  switch (type) {
+    case KLU:
+    case DOMAIN_DECOMPOSITION:
+    case MIXED_PRECISION:
+    case ACTIVE_SET:
+    case ISLANDS:
+      return true;
+    case SUPERLU_MT:
+#ifdef WITH_SUPERLUMT
+      return true;
+#else
+      return false;
+#endif
+  }
+  return false;
+}
+
+SUNLinearSolver
+LinearSolver::create(const linearSolverType_t type, const unsigned nbThreads, N_Vector y, SUNMatrix JJ, SUNContext context) {
+  if (!isAvailable(type))
+    throw DYNError(Error::GENERAL, UnavailableLinearSolver, toString(type));
+
+  SUNLinearSolver LS = NULL;
+  switch (type) {
+    case KLU:
+      LS = SUNLinSol_KLU(y, JJ, context);
+      break;
+    case SUPERLU_MT:
+#ifdef WITH_SUPERLUMT
+      LS = SUNLinSol_SuperLUMT(y, JJ, static_cast<int>(nbThreads), context);
+#else
+      static_cast<void>(nbThreads);
+#endif
+      break;
+    case DOMAIN_DECOMPOSITION:
+      // the areas are factorized by the threads of the linear solver, which profiles its setup and solve itself
+      LS = DomainDecompositionLinearSolver::create(nbThreads, JJ, context);
+      break;
+    case MIXED_PRECISION:
+      // the refinement runs in the solve of the linear solver, which profiles its setup and solve itself
+      LS = MixedPrecisionLinearSolver::create(y, JJ, context);
+      break;
+    case ACTIVE_SET:
+      // the active system is factorized by a nested KLU, the linear solver profiles its setup and solve itself
+      LS = ActiveSetLinearSolver::create(y, JJ, context);
+      break;
+    case ISLANDS:
+      // the islands are factorized by the threads of the linear solver, which profiles its setup and solve itself
+      LS = IslandsLinearSolver::create(nbThreads, JJ, context);
+      break;
+  }
+  if (LS == NULL)
+    throw DYNError(Error::SUNDIALS_ERROR, LinearSolverCreationError, toString(type));
+  // the operations table belongs to this solver: the setup and solve are profiled whatever the calling integrator
+  switch (type) {
+    case KLU:
+      LS->ops->setup = profiledSetupKLU;
+      LS->ops->solve = profiledSolveKLU;
+      break;
+    case SUPERLU_MT:
+#ifdef WITH_SUPERLUMT
+      LS->ops->setup = profiledSetupSuperLUMT;
+      LS->ops->solve = profiledSolveSuperLUMT;
+#endif
+      break;
+    case DOMAIN_DECOMPOSITION:
+    case MIXED_PRECISION:
+    case ACTIVE_SET:
+    case ISLANDS:
+      break;
+  }
+  return LS;
+}
+
+void
+LinearSolver::reinitSymbolicFactorization(SUNLinearSolver LS, SUNMatrix JJ) {
+  switch (SUNLinSolGetID(LS)) {
+    case SUNLINEARSOLVER_KLU:
+      SUNLinSol_KLUReInit(LS, JJ, SM_NNZ_S(JJ), SUNKLU_REINIT_PARTIAL);
+      break;
+#ifdef WITH_SUPERLUMT
+    case SUNLINEARSOLVER_SUPERLUMT:
+      // the ordering is computed again and the previous factors are not reused at the next setup
+      reinterpret_cast<SUNLinearSolverContent_SuperLUMT>(LS->content)->first_factorize = 1;
+      break;
+#endif
+    default:
+      DomainDecompositionLinearSolver::reinit(LS);
+      MixedPrecisionLinearSolver::reinit(LS, JJ);
+      ActiveSetLinearSolver::reinit(LS, JJ);
+      IslandsLinearSolver::reinit(LS);
+      break;
+  }
+}
+
+std::size_t
+LinearSolver::getMemoryUsage(SUNLinearSolver LS) {
+  if (MixedPrecisionLinearSolver::isMixedPrecision(LS))
+    return MixedPrecisionLinearSolver::getMemoryUsage(LS);
+  if (ActiveSetLinearSolver::isActiveSet(LS))
+    return ActiveSetLinearSolver::getMemoryUsage(LS);
+  if (IslandsLinearSolver::isIslands(LS))
+    return IslandsLinearSolver::getMemoryUsage(LS);
+  if (LS == NULL || SUNLinSolGetID(LS) != SUNLINEARSOLVER_KLU)
+    return 0;
+  return SUNLinSol_KLUGetCommon(LS)->memusage;
+}
+
+}  // end namespace DYN
@@ -0,0 +1,114 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNLinearSolver.h
+ *
+ * @brief Sparse direct linear solvers used by the Newton iterations of the solvers
+ *
+ */
+#ifndef SOLVERS_COMMON_DYNLINEARSOLVER_H_
+#define SOLVERS_COMMON_DYNLINEARSOLVER_H_
+
+#include <cstddef>
+#include <string>
+#include <sundials/sundials_linearsolver.h>
+#include <sundials/sundials_matrix.h>
+#include <sundials/sundials_nvector.h>
+
+namespace DYN {
+
+/**
+ * @brief LinearSolver static class: creation and re-initialization of the sparse direct linear solvers
+ *
+ * All the solvers work on the same sparse SUNMatrix, so that the Jacobian evaluation does not depend on the chosen linear solver.
+ */
+class LinearSolver {
+ public:
+  /**
+   * @brief available sparse direct linear solvers
+   */
+  typedef enum {
+    KLU = 0,  ///< SuiteSparse KLU, sequential
+    SUPERLU_MT = 1,  ///< SuperLU_MT, multithreaded (only if Sundials was built with it)
+    DOMAIN_DECOMPOSITION = 2,  ///< KLU on the areas of a partition of the system and on the Schur complement of their interface, multithreaded
+    MIXED_PRECISION = 3,  ///< factors in single precision and iterative refinement in double precision, KLU if the refinement stalls
+    ACTIVE_SET = 4,  ///< KLU on the active system, the unknowns frozen by trivial equations (disconnected equipments) being eliminated beforehand
+    ISLANDS = 5  ///< KLU on the independent islands of the system, multithreaded
+  } linearSolverType_t;
+
+  /**
+   * @brief get the linear solver from its name in the solver parameters
+   *
+   * @param name name of the linear solver ("KLU", "SuperLU_MT", "DomainDecomposition", "MixedPrecision", "ActiveSet" or "Islands")
+   *
+   * @return the corresponding linear solver
+   * @throw DYNError if the name does not match any linear solver
+   */
+  static linearSolverType_t fromString(const std::string& name);
+
+  /**
+   * @brief get the name of a linear solver
+   *
+   * @param type linear solver
+   *
+   * @return the name of the linear solver
+   */
+  static std::string toString(linearSolverType_t type);
+
+  /**
+   * @brief indicate whether a linear solver is available in this build
+   *
+   * @param type linear solver
+   *
+   * @return @b true if the linear solver can be created
+   */
+  static bool isAvailable(linearSolverType_t type);
+
+  /**
+   * @brief create a linear solver
+   *
+   * @param type linear solver to create
+   * @param nbThreads number of threads used by the factorization, ignored by the sequential solvers, and number of areas of the domain decomposition
+   * @param y template vector
+   * @param JJ sparse matrix the linear solver works on
+   * @param context sundials context
+   *
+   * @return the linear solver, to be released with SUNLinSolFree
+   * @throw DYNError if the linear solver is not available or its creation fails
+   */
+  static SUNLinearSolver create(linearSolverType_t type, unsigned nbThreads, N_Vector y, SUNMatrix JJ, SUNContext context);
+
+  /**
+   * @brief force a new symbolic analysis at the next factorization, after a structure change of the matrix
+   *
+   * @param LS linear solver
+   * @param JJ sparse matrix the linear solver works on, with its new structure
+   */
+  static void reinitSymbolicFactorization(SUNLinearSolver LS, SUNMatrix JJ);
+
+  /**
+   * @brief get the memory allocated by a linear solver for its symbolic analysis and its factors
+   *
+   * Only KLU, the mixed precision, the active set and the islands solvers report the memory they allocate: 0 is returned for the other solvers.
+   *
+   * @param LS linear solver
+   *
+   * @return number of bytes allocated by the linear solver
+   */
+  static std::size_t getMemoryUsage(SUNLinearSolver LS);
+};
+
+}  // end namespace DYN
+
+#endif  // SOLVERS_COMMON_DYNLINEARSOLVER_H_
@@ -0,0 +1,617 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNMixedPrecisionLinearSolver.cpp
+ *
+ * @brief Mixed precision linear solver implementation
+ *
+ */
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <boost/core/noncopyable.hpp>
+#include <sunmatrix/sunmatrix_sparse.h>
+#include <sunlinsol/sunlinsol_klu.h>
+
+#include "DYNMixedPrecisionLinearSolver.h"
+#include "DYNProfiler.h"
+#include "DYNMacrosMessage.h"
+#include "DYNTrace.h"
+
+namespace {
+
+const double PIVOT_TOLERANCE = 0.001;  ///< the preferred pivot is kept if it is not smaller than this ratio of the largest one, as in KLU
+const unsigned MAX_REFINEMENT_ITERATIONS = 10;  ///< maximum number of corrections computed with the single precision factors
+const double STALL_RATIO = 0.5;  ///< the refinement stalls when a correction does not divide the residual by at least 2
+
+/**
+ * @brief content of the mixed precision linear solver
+ */
+struct MixedPrecisionContent : private boost::noncopyable {
+  /**
+   * @brief constructor
+   * @param doubleSolver KLU linear solver used when the single precision factors are not accurate enough
+   */
+  explicit MixedPrecisionContent(SUNLinearSolver doubleSolver) :
+  doubleSolver(doubleSolver),
+  analyzed(false),
+  doublePrecision(false),
+  n(0),
+  normA(0.),
+  lastFlag(0) { }
+
+  /**
+   * @brief destructor
+   */
+  ~MixedPrecisionContent() {
+    SUNLinSolFree(doubleSolver);
+  }
+
+  SUNLinearSolver doubleSolver;  ///< KLU linear solver, factorizing the matrix in double precision
+  bool analyzed;  ///< whether the ordering matches the structure of the matrix
+  bool doublePrecision;  ///< whether the matrix is factorized in double precision until the next structure change
+  sunindextype n;  ///< size of the matrix
+  std::vector<sunindextype> colPtrs;  ///< index of the first element of each column of the matrix stored by columns
+  std::vector<sunindextype> rowIdx;  ///< row of each element of the matrix stored by columns
+  std::vector<sunindextype> positions;  ///< index in the sparse matrix of each element of the matrix stored by columns
+  std::vector<sunindextype> rowOrder;  ///< preferred pivot row of each step of the factorization, from the KLU analysis
+  std::vector<sunindextype> colOrder;  ///< column factorized at each step, from the KLU analysis
+  std::vector<sunindextype> pivotOf;  ///< step at which each row is the pivot, -1 if it is not pivotal yet
+  std::vector<sunindextype> Lp;  ///< index of the first element of each column of L
+  std::vector<int> Li;  ///< row of each element of L, the unit diagonal first, on 32 bits as the values
+  std::vector<float> Lx;  ///< value of each element of L
+  std::vector<sunindextype> Up;  ///< index of the first element of each column of U
+  std::vector<int> Ui;  ///< row of each element of U, the diagonal last, on 32 bits as the values
+  std::vector<float> Ux;  ///< value of each element of U
+  std::vector<sunindextype> marks;  ///< last step at which each row was reached by the depth-first search
+  std::vector<sunindextype> reached;  ///< rows reached by the depth-first search, in topological order from top
+  std::vector<sunindextype> nodeStack;  ///< rows on the stack of the depth-first search
+  std::vector<sunindextype> positionStack;  ///< next element of L to visit for each row on the stack
+  std::vector<double> work;  ///< dense column or right-hand side, in double precision
+  std::vector<double> rhs;  ///< right-hand side of the current solve, kept as the solution may overwrite it
+  std::vector<double> solution;  ///< refined solution
+  std::vector<double> residual;  ///< residual of the refined solution, in double precision
+  double normA;  ///< infinity norm of the factorized matrix
+  sunindextype lastFlag;  ///< status of the last setup or solve
+};
+
+/**
+ * @brief get the content of a mixed precision linear solver
+ * @param LS linear solver
+ * @return content of the linear solver
+ */
+MixedPrecisionContent*
+content(SUNLinearSolver LS) {
+  return reinterpret_cast<MixedPrecisionContent*>(LS->content);
+}
+
+/**
+ * @brief store the structure of the matrix by columns and compute its ordering with the KLU symbolic analysis
+ * @param solverContent content of the linear solver
+ * @param A sparse matrix
+ * @return @b false if the analysis failed
+ */
+bool
+analyze(MixedPrecisionContent& solverContent, SUNMatrix A) {
+  const sunindextype n = SM_COLUMNS_S(A);
+  const sunindextype nbElements = SM_INDEXPTRS_S(A)[SM_NP_S(A)];
+  const sunindextype* indexPtrs = SM_INDEXPTRS_S(A);
+  const sunindextype* indexVals = SM_INDEXVALS_S(A);
+  solverContent.n = n;
+  solverContent.colPtrs.assign(n + 1, 0);
+  solverContent.rowIdx.resize(nbElements);
+  solverContent.positions.resize(nbElements);
+  if (SM_SPARSETYPE_S(A) == CSC_MAT) {
+    std::copy(indexPtrs, indexPtrs + n + 1, solverContent.colPtrs.begin());
+    std::copy(indexVals, indexVals + nbElements, solverContent.rowIdx.begin());
+    for (sunindextype p = 0; p < nbElements; ++p)
+      solverContent.positions[p] = p;
+  } else {
+    // a matrix stored by rows is transposed once, its values are then read through the positions
+    for (sunindextype p = 0; p < nbElements; ++p)
+      ++solverContent.colPtrs[indexVals[p] + 1];
+    for (sunindextype col = 0; col < n; ++col)
+      solverContent.colPtrs[col + 1] += solverContent.colPtrs[col];
+    std::vector<sunindextype> next(solverContent.colPtrs.begin(), solverContent.colPtrs.end() - 1);
+    for (sunindextype row = 0; row < n; ++row) {
+      for (sunindextype p = indexPtrs[row]; p < indexPtrs[row + 1]; ++p) {
+        const sunindextype position = next[indexVals[p]]++;
+        solverContent.rowIdx[position] = row;
+        solverContent.positions[position] = p;
+      }
+    }
+  }
+
+  sun_klu_common common;
+  sun_klu_defaults(&common);
+  sun_klu_symbolic* symbolic = sun_klu_analyze(n, solverContent.colPtrs.data(), solverContent.rowIdx.data(), &common);
+  if (symbolic == NULL)
+    return false;
+  solverContent.rowOrder.assign(symbolic->P, symbolic->P + n);
+  solverContent.colOrder.assign(symbolic->Q, symbolic->Q + n);
+  sun_klu_free_symbolic(&symbolic, &common);
+
+  solverContent.marks.assign(n, -1);
+  solverContent.reached.resize(n);
+  solverContent.nodeStack.resize(n);
+  solverContent.positionStack.resize(n);
+  solverContent.work.assign(n, 0.);
+  return true;
+}
+
+/**
+ * @brief find the rows of L^-1 * A(:, col) that may be non zero, by a depth-first search in the graph of L
+ * @param solverContent content of the linear solver
+ * @param col column of the matrix
+ * @param step current step of the factorization
+ * @return index in reached of the first row found, the rows being in topological order from there
+ */
+sunindextype
+reach(MixedPrecisionContent& solverContent, const sunindextype col, const sunindextype step) {
+  std::vector<sunindextype>& marks = solverContent.marks;
+  std::vector<sunindextype>& nodeStack = solverContent.nodeStack;
+  std::vector<sunindextype>& positionStack = solverContent.positionStack;
+  sunindextype top = solverContent.n;
+  for (sunindextype p = solverContent.colPtrs[col]; p < solverContent.colPtrs[col + 1]; ++p) {
+    if (marks[solverContent.rowIdx[p]] == step)
+      continue;
+    sunindextype head = 0;
+    nodeStack[0] = solverContent.rowIdx[p];
+    while (head >= 0) {
+      const sunindextype row = nodeStack[head];
+      const sunindextype pivot = solverContent.pivotOf[row];
+      if (marks[row] != step) {
+        marks[row] = step;
+        positionStack[head] = (pivot < 0) ? 0 : solverContent.Lp[pivot] + 1;
+      }
+      const sunindextype end = (pivot < 0) ? 0 : solverContent.Lp[pivot + 1];
+      bool done = true;
+      for (sunindextype q = positionStack[head]; q < end; ++q) {
+        const sunindextype child = solverContent.Li[q];
+        if (marks[child] == step)
+          continue;
+        positionStack[head] = q + 1;
+        nodeStack[++head] = child;
+        done = false;
+        break;
+      }
+      if (done) {
+        --head;
+        solverContent.reached[--top] = row;
+      }
+    }
+  }
+  return top;
+}
+
+/**
+ * @brief factorize the matrix in single precision
+ *
+ * Left-looking LU with threshold partial pivoting: each column of U and L is computed by a sparse triangular solve with the
+ * previous columns of L, the updates being accumulated in double precision before the values are stored in single precision.
+ *
+ * @param solverContent content of the linear solver
+ * @param A sparse matrix
+ * @return @b false if a pivot is null or a value does not fit in single precision
+ */
+bool
+factorize(MixedPrecisionContent& solverContent, SUNMatrix A) {
+  const sunindextype n = solverContent.n;
+  const realtype* data = SM_DATA_S(A);
+  std::vector<double>& work = solverContent.work;
+  const size_t nbL = solverContent.Li.size();
+  const size_t nbU = solverContent.Ui.size();
+  solverContent.Lp.assign(n + 1, 0);
+  solverContent.Up.assign(n + 1, 0);
+  solverContent.Li.clear();
+  solverContent.Lx.clear();
+  solverContent.Ui.clear();
+  solverContent.Ux.clear();
+  solverContent.Li.reserve(nbL);
+  solverContent.Lx.reserve(nbL);
+  solverContent.Ui.reserve(nbU);
+  solverContent.Ux.reserve(nbU);
+  solverContent.pivotOf.assign(n, -1);
+  std::fill(solverContent.marks.begin(), solverContent.marks.end(), -1);
+
+  const double maxFloat = std::numeric_limits<float>::max();
+  bool representable = true;
+  for (sunindextype step = 0; step < n; ++step) {
+    solverContent.Lp[step] = static_cast<sunindextype>(solverContent.Li.size());
+    solverContent.Up[step] = static_cast<sunindextype>(solverContent.Ui.size());
+    const sunindextype col = solverContent.colOrder[step];
+    const sunindextype top = reach(solverContent, col, step);
+
+    // sparse triangular solve: work = L^-1 * A(:, col)
+    for (sunindextype p = solverContent.colPtrs[col]; p < solverContent.colPtrs[col + 1]; ++p)
+      work[solverContent.rowIdx[p]] = data[solverContent.positions[p]];
+    for (sunindextype r = top; r < n; ++r) {
+      const sunindextype row = solverContent.reached[r];
+      const sunindextype pivot = solverContent.pivotOf[row];
+      if (pivot < 0)
+        continue;
+      const double value = work[row];
+      for (sunindextype p = solverContent.Lp[pivot] + 1; p < solverContent.Lp[pivot + 1]; ++p)
+        work[solverContent.Li[p]] -= solverContent.Lx[p] * value;
+    }
+
+    // the elements of the pivotal rows go to U, the largest element of the other rows is the pivot
+    sunindextype pivotRow = -1;
+    double largest = -1.;
+    for (sunindextype r = top; r < n; ++r) {
+      const sunindextype row = solverContent.reached[r];
+      if (solverContent.pivotOf[row] < 0) {
+        if (std::fabs(work[row]) > largest) {
+          largest = std::fabs(work[row]);
+          pivotRow = row;
+        }
+      } else {
+        representable = representable && std::fabs(work[row]) <= maxFloat;
+        solverContent.Ui.push_back(static_cast<int>(solverContent.pivotOf[row]));
+        solverContent.Ux.push_back(static_cast<float>(work[row]));
+      }
+    }
+    if (pivotRow < 0 || !(largest > 0.) || largest > maxFloat || !representable) {
+      for (sunindextype r = top; r < n; ++r)
+        work[solverContent.reached[r]] = 0.;
+      return false;
+    }
+    // the row of the ordering is kept when its pivot is large enough, which preserves the sparsity of the factors
+    const sunindextype preferredRow = solverContent.rowOrder[step];
+    if (solverContent.pivotOf[preferredRow] < 0 && solverContent.marks[preferredRow] == step
+        && std::fabs(work[preferredRow]) >= PIVOT_TOLERANCE * largest)
+      pivotRow = preferredRow;
+    const double pivotValue = work[pivotRow];
+    solverContent.Ui.push_back(static_cast<int>(step));
+    solverContent.Ux.push_back(static_cast<float>(pivotValue));
+    solverContent.pivotOf[pivotRow] = step;
+    solverContent.Li.push_back(static_cast<int>(pivotRow));
+    solverContent.Lx.push_back(1.F);
+    for (sunindextype r = top; r < n; ++r) {
+      const sunindextype row = solverContent.reached[r];
+      if (solverContent.pivotOf[row] < 0) {
+        solverContent.Li.push_back(static_cast<int>(row));
+        solverContent.Lx.push_back(static_cast<float>(work[row] / pivotValue));
+      }
+      work[row] = 0.;
+    }
+  }
+  solverContent.Lp[n] = static_cast<sunindextype>(solverContent.Li.size());
+  solverContent.Up[n] = static_cast<sunindextype>(solverContent.Ui.size());
+  // the rows of L are numbered by pivot step, as the ones of U
+  for (auto& row : solverContent.Li)
+    row = static_cast<int>(solverContent.pivotOf[row]);
+  return true;
+}
+
+/**
+ * @brief solve a system with the single precision factors, the substitutions being computed in double precision
+ * @param solverContent content of the linear solver
+ * @param b right-hand side
+ * @param x solution, to fill
+ */
+void
+solveFactors(MixedPrecisionContent& solverContent, const double* b, double* x) {
+  const sunindextype n = solverContent.n;
+  std::vector<double>& work = solverContent.work;
+  for (sunindextype row = 0; row < n; ++row)
+    work[solverContent.pivotOf[row]] = b[row];
+  for (sunindextype step = 0; step < n; ++step) {
+    const double value = work[step];
+    for (sunindextype p = solverContent.Lp[step] + 1; p < solverContent.Lp[step + 1]; ++p)
+      work[solverContent.Li[p]] -= solverContent.Lx[p] * value;
+  }
+  for (sunindextype step = n - 1; step >= 0; --step) {
+    const sunindextype diagonal = solverContent.Up[step + 1] - 1;
+    const double value = work[step] / solverContent.Ux[diagonal];
+    work[step] = value;
+    for (sunindextype p = solverContent.Up[step]; p < diagonal; ++p)
+      work[solverContent.Ui[p]] -= solverContent.Ux[p] * value;
+  }
+  for (sunindextype step = 0; step < n; ++step) {
+    x[solverContent.colOrder[step]] = work[step];
+    work[step] = 0.;
+  }
+}
+
+/**
+ * @brief compute the residual b - A * x in double precision
+ * @param A sparse matrix
+ * @param b right-hand side
+ * @param x solution
+ * @param residual residual, to fill
+ */
+void
+computeResidual(SUNMatrix A, const std::vector<double>& b, const std::vector<double>& x, std::vector<double>& residual) {
+  const sunindextype* indexPtrs = SM_INDEXPTRS_S(A);
+  const sunindextype* indexVals = SM_INDEXVALS_S(A);
+  const realtype* data = SM_DATA_S(A);
+  residual = b;
+  if (SM_SPARSETYPE_S(A) == CSR_MAT) {
+    for (sunindextype row = 0; row < SM_NP_S(A); ++row) {
+      double sum = 0.;
+      for (sunindextype p = indexPtrs[row]; p < indexPtrs[row + 1]; ++p)
+        sum += data[p] * x[indexVals[p]];
+      residual[row] -= sum;
+    }
+  } else {
+    for (sunindextype col = 0; col < SM_NP_S(A); ++col) {
+      for (sunindextype p = indexPtrs[col]; p < indexPtrs[col + 1]; ++p)
+        residual[indexVals[p]] -= data[p] * x[col];
+    }
+  }
+}
+
+/**
+ * @brief compute the infinity norm of a matrix
+ * @param solverContent content of the linear solver
+ * @param A sparse matrix
+ * @return largest sum of the absolute values of a row
+ */
+double
+infinityNorm(MixedPrecisionContent& solverContent, SUNMatrix A) {
+  const realtype* data = SM_DATA_S(A);
+  std::vector<double>& rowSums = solverContent.work;
+  for (size_t p = 0; p < solverContent.rowIdx.size(); ++p)
+    rowSums[solverContent.rowIdx[p]] += std::fabs(data[solverContent.positions[p]]);
+  const double norm = rowSums.empty() ? 0. : *std::max_element(rowSums.begin(), rowSums.end());
+  std::fill(rowSums.begin(), rowSums.end(), 0.);
+  return norm;
+}
+
+/**
+ * @brief factorize the matrix in double precision until the next structure change
+ * @param solverContent content of the linear solver
+ * @param A sparse matrix
+ * @return status of the KLU setup
+ */
+int
+fallBackToDoublePrecision(MixedPrecisionContent& solverContent, SUNMatrix A) {
+  DYN::Trace::debug() << DYNLog(MixedPrecisionFallback) << DYN::Trace::endline;
+  solverContent.doublePrecision = true;
+  solverContent.Lp.clear();
+  solverContent.Li = std::vector<int>();
+  solverContent.Lx = std::vector<float>();
+  solverContent.Up.clear();
+  solverContent.Ui = std::vector<int>();
+  solverContent.Ux = std::vector<float>();
+  solverContent.lastFlag = SUNLinSolSetup(solverContent.doubleSolver, A);
+  return static_cast<int>(solverContent.lastFlag);
+}
+
+/**
+ * @brief type of the linear solver
+ * @return direct linear solver
+ */
+SUNLinearSolver_Type
+getTypeMixedPrecision(SUNLinearSolver) {
+  return SUNLINEARSOLVER_DIRECT;
+}
+
+/**
+ * @brief identifier of the linear solver
+ * @return custom linear solver
+ */
+SUNLinearSolver_ID
+getIdMixedPrecision(SUNLinearSolver) {
+  return SUNLINEARSOLVER_CUSTOM;
+}
+
+/**
+ * @brief initialization of the linear solver
+ * @param LS linear solver
+ * @return status of the initialization
+ */
+int
+initializeMixedPrecision(SUNLinearSolver LS) {
+  content(LS)->lastFlag = SUNLS_SUCCESS;
+  return SUNLinSolInitialize(content(LS)->doubleSolver);
+}
+
+/**
+ * @brief setup (factorization) of the linear solver
+ * @param LS linear solver
+ * @param A matrix to factorize
+ * @return status of the setup
+ */
+int
+setupMixedPrecision(SUNLinearSolver LS, SUNMatrix A) {
+  DYN::ProfilerScope profilerScope(DYN::Profiler::FACTORIZATION);
+  MixedPrecisionContent& solverContent = *content(LS);
+  // a structure change is normally notified through reinit, the number of elements is checked all the same
+  if (!solverContent.analyzed || static_cast<sunindextype>(solverContent.positions.size()) != SM_INDEXPTRS_S(A)[SM_NP_S(A)]) {
+    if (!analyze(solverContent, A)) {
+      solverContent.lastFlag = SUNLS_PACKAGE_FAIL_UNREC;
+      return SUNLS_PACKAGE_FAIL_UNREC;
+    }
+    solverContent.analyzed = true;
+  }
+  if (solverContent.doublePrecision) {
+    solverContent.lastFlag = SUNLinSolSetup(solverContent.doubleSolver, A);
+    return static_cast<int>(solverContent.lastFlag);
+  }
+
+  solverContent.normA = infinityNorm(solverContent, A);
+  if (!factorize(solverContent, A))
+    return fallBackToDoublePrecision(solverContent, A);
+  solverContent.lastFlag = SUNLS_SUCCESS;
+  return SUNLS_SUCCESS;
+}
+
+/**
+ * @brief solve of the linear solver
+ *
+ * The solution of the single precision factors is refined until its residual computed in double precision satisfies the
+ * stopping criterion of the LAPACK mixed precision solvers: ||b - A x|| <= ||x|| * ||A|| * eps * sqrt(n).
+ *
+ * @param LS linear solver
+ * @param A factorized matrix
+ * @param x solution
+ * @param b right-hand side
+ * @param tol tolerance, ignored as the solution is refined up to the double precision
+ * @return status of the solve
+ */
+int
+solveMixedPrecision(SUNLinearSolver LS, SUNMatrix A, N_Vector x, N_Vector b, realtype tol) {
+  DYN::ProfilerScope profilerScope(DYN::Profiler::LINEAR_SOLVE);
+  MixedPrecisionContent& solverContent = *content(LS);
+  if (solverContent.doublePrecision) {
+    solverContent.lastFlag = SUNLinSolSolve(solverContent.doubleSolver, A, x, b, tol);
+    return static_cast<int>(solverContent.lastFlag);
+  }
+
+  const sunindextype n = solverContent.n;
+  realtype* xData = N_VGetArrayPointer(x);
+  const realtype* bData = N_VGetArrayPointer(b);
+  // b may be x: the right-hand side is kept for the residuals
+  solverContent.rhs.assign(bData, bData + n);
+  solverContent.solution.assign(n, 0.);
+  solverContent.residual.resize(n);
+  const double threshold = solverContent.normA * std::numeric_limits<double>::epsilon() * std::sqrt(static_cast<double>(n));
+  double previousNorm = std::numeric_limits<double>::max();
+  for (unsigned iteration = 0; iteration <= MAX_REFINEMENT_ITERATIONS; ++iteration) {
+    if (iteration == 0)
+      solverContent.residual = solverContent.rhs;
+    else
+      computeResidual(A, solverContent.rhs, solverContent.solution, solverContent.residual);
+    double residualNorm = 0.;
+    double solutionNorm = 0.;
+    for (sunindextype i = 0; i < n; ++i) {
+      residualNorm = std::max(residualNorm, std::fabs(solverContent.residual[i]));
+      solutionNorm = std::max(solutionNorm, std::fabs(solverContent.solution[i]));
+    }
+    if (!std::isfinite(residualNorm))
+      break;
+    if (residualNorm <= solutionNorm * threshold) {
+      std::copy(solverContent.solution.begin(), solverContent.solution.end(), xData);
+      solverContent.lastFlag = SUNLS_SUCCESS;
+      return SUNLS_SUCCESS;
+    }
+    if (iteration > 0 && residualNorm > STALL_RATIO * previousNorm)
+      break;
+    previousNorm = residualNorm;
+    // the correction overwrites the residual, which is computed again from the updated solution
+    solveFactors(solverContent, solverContent.residual.data(), solverContent.residual.data());
+    for (sunindextype i = 0; i < n; ++i)
+      solverContent.solution[i] += solverContent.residual[i];
+  }
+
+  // the single precision factors are too inaccurate for this matrix: b is kept in rhs if it is overwritten by x
+  const int setupFlag = fallBackToDoublePrecision(solverContent, A);
+  if (setupFlag != SUNLS_SUCCESS)
+    return setupFlag;
+  std::copy(solverContent.rhs.begin(), solverContent.rhs.end(), xData);
+  solverContent.lastFlag = SUNLinSolSolve(solverContent.doubleSolver, A, x, x, tol);
+  return static_cast<int>(solverContent.lastFlag);
+}
+
+/**
+ * @brief status of the last setup or solve
+ * @param LS linear solver
+ * @return status
+ */
+sunindextype
+lastFlagMixedPrecision(SUNLinearSolver LS) {
+  return content(LS)->lastFlag;
+}
+
+/**
+ * @brief memory used by the linear solver, not reported
+ * @param lenrwLS number of reals, to fill
+ * @param leniwLS number of integers, to fill
+ * @return status
+ */
+int
+spaceMixedPrecision(SUNLinearSolver, long int* lenrwLS, long int* leniwLS) {
+  *lenrwLS = 0;
+  *leniwLS = 0;
+  return SUNLS_SUCCESS;
+}
+
+/**
+ * @brief release the linear solver
+ * @param LS linear solver
+ * @return status
+ */
+int
+freeMixedPrecision(SUNLinearSolver LS) {
+  if (LS == NULL)
+    return SUNLS_SUCCESS;
+  delete content(LS);
+  LS->content = NULL;
+  SUNLinSolFreeEmpty(LS);
+  return SUNLS_SUCCESS;
+}
+
+}  // namespace
+
+namespace DYN {
+
+SUNLinearSolver
+MixedPrecisionLinearSolver::create(N_Vector y, SUNMatrix JJ, SUNContext context) {
+  if (JJ == NULL || SM_ROWS_S(JJ) != SM_COLUMNS_S(JJ))
+    return NULL;
+  SUNLinearSolver doubleSolver = SUNLinSol_KLU(y, JJ, context);
+  if (doubleSolver == NULL)
+    return NULL;
+  SUNLinearSolver LS = SUNLinSolNewEmpty(context);
+  if (LS == NULL) {
+    SUNLinSolFree(doubleSolver);
+    return NULL;
+  }
+  LS->ops->gettype = getTypeMixedPrecision;
+  LS->ops->getid = getIdMixedPrecision;
+  LS->ops->initialize = initializeMixedPrecision;
+  LS->ops->setup = setupMixedPrecision;
+  LS->ops->solve = solveMixedPrecision;
+  LS->ops->lastflag = lastFlagMixedPrecision;
+  LS->ops->space = spaceMixedPrecision;
+  LS->ops->free = freeMixedPrecision;
+  LS->content = new MixedPrecisionContent(doubleSolver);
+  return LS;
+}
+
+bool
+MixedPrecisionLinearSolver::isMixedPrecision(SUNLinearSolver LS) {
+  return LS != NULL && LS->ops != NULL && LS->ops->setup == setupMixedPrecision;
+}
+
+void
+MixedPrecisionLinearSolver::reinit(SUNLinearSolver LS, SUNMatrix JJ) {
+  if (!isMixedPrecision(LS))
+    return;
+  MixedPrecisionContent& solverContent = *content(LS);
+  solverContent.analyzed = false;
+  solverContent.doublePrecision = false;
+  SUNLinSol_KLUReInit(solverContent.doubleSolver, JJ, SM_NNZ_S(JJ), SUNKLU_REINIT_PARTIAL);
+}
+
+bool
+MixedPrecisionLinearSolver::isDoublePrecision(SUNLinearSolver LS) {
+  return isMixedPrecision(LS) && content(LS)->doublePrecision;
+}
+
+std::size_t
+MixedPrecisionLinearSolver::getMemoryUsage(SUNLinearSolver LS) {
+  if (!isMixedPrecision(LS))
+    return 0;
+  const MixedPrecisionContent& solverContent = *content(LS);
+  if (solverContent.doublePrecision)
+    return SUNLinSol_KLUGetCommon(solverContent.doubleSolver)->memusage;
+  return (solverContent.Lp.size() + solverContent.Up.size()) * sizeof(sunindextype)
+      + (solverContent.Li.size() + solverContent.Ui.size()) * sizeof(int) + (solverContent.Lx.size() + solverContent.Ux.size()) * sizeof(float);
+}
+
+}  // end namespace DYN
@@ -0,0 +1,95 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNMixedPrecisionLinearSolver.h
+ *
+ * @brief Sparse direct linear solver storing its factors in single precision, with an iterative refinement in double precision
+ *
+ */
+#ifndef SOLVERS_COMMON_DYNMIXEDPRECISIONLINEARSOLVER_H_
+#define SOLVERS_COMMON_DYNMIXEDPRECISIONLINEARSOLVER_H_
+
+#include <cstddef>
+#include <sundials/sundials_linearsolver.h>
+#include <sundials/sundials_matrix.h>
+#include <sundials/sundials_nvector.h>
+
+namespace DYN {
+
+/**
+ * @brief MixedPrecisionLinearSolver static class: creation of the mixed precision linear solver
+ *
+ * The matrix is factorized by a left-looking sparse LU with threshold partial pivoting, following the fill-reducing ordering
+ * of the KLU symbolic analysis, and its factors are stored in single precision with 32 bits row indexes: they take half the
+ * memory of the KLU factors and the triangular solves read half as many bytes. A solve starts from the solution given by
+ * these factors and refines it with the residual computed in double precision on the matrix itself, until the backward error
+ * reaches the double precision.
+ *
+ * When the single precision factorization fails or the refinement stalls, the matrix is too badly conditioned for the single
+ * precision factors: it is then factorized in double precision with KLU until the next structure change.
+ */
+class MixedPrecisionLinearSolver {
+ public:
+  /**
+   * @brief create a mixed precision linear solver
+   *
+   * @param y template vector
+   * @param JJ sparse matrix the linear solver works on
+   * @param context sundials context
+   *
+   * @return the linear solver, to be released with SUNLinSolFree, NULL if the allocation failed
+   */
+  static SUNLinearSolver create(N_Vector y, SUNMatrix JJ, SUNContext context);
+
+  /**
+   * @brief indicate whether a linear solver is a mixed precision linear solver
+   *
+   * @param LS linear solver
+   *
+   * @return @b true if LS was created by this class
+   */
+  static bool isMixedPrecision(SUNLinearSolver LS);
+
+  /**
+   * @brief force a new symbolic analysis at the next factorization, after a structure change of the matrix
+   *
+   * The factorization in single precision is tried again on the new structure.
+   *
+   * @param LS mixed precision linear solver
+   * @param JJ sparse matrix the linear solver works on, with its new structure
+   */
+  static void reinit(SUNLinearSolver LS, SUNMatrix JJ);
+
+  /**
+   * @brief indicate whether the matrix is currently factorized in double precision
+   *
+   * @param LS mixed precision linear solver
+   *
+   * @return @b true if the solver fell back to the double precision factorization
+   */
+  static bool isDoublePrecision(SUNLinearSolver LS);
+
+  /**
+   * @brief get the memory allocated for the factors
+   *
+   * @param LS mixed precision linear solver
+   *
+   * @return number of bytes allocated for the single precision factors, and for the KLU factors after a fall back
+   */
+  static std::size_t getMemoryUsage(SUNLinearSolver LS);
+};
+
+}  // end namespace DYN
+
+#endif  // SOLVERS_COMMON_DYNMIXEDPRECISIONLINEARSOLVER_H_
@@ -0,0 +1,526 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNParallelVector.cpp
+ *
+ * @brief Sundials vectors whose operations are run by the thread pool of the model: implementation
+ *
+ */
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include <nvector/nvector_serial.h>
+
+#include "DYNParallelVector.h"
+#include "DYNThreadPool.h"
+#include "DYNVectorKernels.h"
+
+namespace {
+
+/**
+ * @brief content of a parallel vector
+ */
+struct ParallelContent {
+  struct _N_VectorContent_Serial serial;  ///< serial content, first member so that the serial accessors remain valid
+  DYN::ThreadPool* threadPool;  ///< pool running the operations
+};
+
+/**
+ * @brief get the thread pool of a parallel vector
+ * @param v parallel vector
+ * @return the thread pool running the operations of the vector
+ */
+DYN::ThreadPool*
+getThreadPool(const N_Vector v) {
+  return static_cast<ParallelContent*>(v->content)->threadPool;
+}
+
+/**
+ * @brief get the number of chunks the operations on a vector are split in
+ * @param v parallel vector
+ * @return number of chunks, 1 if the operations must be run by the calling thread only
+ */
+unsigned
+nbChunks(const N_Vector v) {
+  const sunindextype nbMaxChunks = NV_LENGTH_S(v) / DYN::ParallelVector::MIN_CHUNK_SIZE;
+  return static_cast<unsigned>(std::max<sunindextype>(1, std::min<sunindextype>(getThreadPool(v)->nbThreads(), nbMaxChunks)));
+}
+
+/**
+ * @brief get the index of the first element of a chunk
+ * @param length number of elements of the vector
+ * @param nbChunks number of chunks
+ * @param chunk index of the chunk, nbChunks to get the end of the last chunk
+ * @return index of the first element of the chunk
+ */
+sunindextype
+chunkBegin(const sunindextype length, const unsigned nbChunks, const unsigned chunk) {
+  return static_cast<sunindextype>(static_cast<long long>(length) * chunk / nbChunks);
+}
+
+/**
+ * @brief run an element-wise operation chunk by chunk
+ * @param v vector whose operation is called
+ * @param operation function called with the first and the last (excluded) indexes of a chunk
+ */
+template<typename Operation>
+void
+forEachChunk(const N_Vector v, const Operation& operation) {
+  const sunindextype length = NV_LENGTH_S(v);
+  const unsigned nbTasks = nbChunks(v);
+  if (nbTasks == 1) {
+    operation(0, length);
+    return;
+  }
+  getThreadPool(v)->parallelFor(nbTasks, [&operation, length, nbTasks](const unsigned chunk) {
+    operation(chunkBegin(length, nbTasks, chunk), chunkBegin(length, nbTasks, chunk + 1));
+  });
+}
+
+/**
+ * @brief run a reduction chunk by chunk and combine the results of the chunks in their order
+ * @param v vector whose operation is called
+ * @param partial function computing the reduction of a chunk from its first and last (excluded) indexes
+ * @param combine function combining two partial results
+ * @return result of the reduction
+ */
+template<typename Partial, typename Combine>
+realtype
+reduce(const N_Vector v, const Partial& partial, const Combine& combine) {
+  const sunindextype length = NV_LENGTH_S(v);
+  const unsigned nbTasks = nbChunks(v);
+  if (nbTasks == 1)
+    return partial(0, length);
+  std::vector<realtype> results(nbTasks);
+  getThreadPool(v)->parallelFor(nbTasks, [&partial, &results, length, nbTasks](const unsigned chunk) {
+    results[chunk] = partial(chunkBegin(length, nbTasks, chunk), chunkBegin(length, nbTasks, chunk + 1));
+  });
+  realtype result = results[0];
+  for (unsigned chunk = 1; chunk < nbTasks; ++chunk)
+    result = combine(result, results[chunk]);
+  return result;
+}
+
+/**
+ * @brief add two partial results
+ * @param a first result
+ * @param b second result
+ * @return a + b
+ */
+realtype
+add(const realtype a, const realtype b) {
+  return a + b;
+}
+
+/**
+ * @brief keep the largest of two partial results
+ * @param a first result
+ * @param b second result
+ * @return max(a, b)
+ */
+realtype
+maximum(const realtype a, const realtype b) {
+  return std::max(a, b);
+}
+
+/**
+ * @brief keep the smallest of two partial results
+ * @param a first result
+ * @param b second result
+ * @return min(a, b)
+ */
+realtype
+minimum(const realtype a, const realtype b) {
+  return std::min(a, b);
+}
+
+N_Vector cloneEmptyParallel(N_Vector w);
+
+/**
+ * @brief destroy a parallel vector
+ * @param v vector to destroy
+ */
+void
+destroyParallel(N_Vector v) {
+  if (v == NULL)
+    return;
+  if (v->content != NULL) {
+    ParallelContent* content = static_cast<ParallelContent*>(v->content);
+    if (content->serial.own_data && content->serial.data != NULL)
+      free(content->serial.data);
+    free(content);
+    v->content = NULL;
+  }
+  N_VFreeEmpty(v);
+}
+
+/**
+ * @brief clone a parallel vector, allocating the elements of the clone
+ * @param w vector to clone
+ * @return the clone, NULL if the allocation failed
+ */
+N_Vector
+cloneParallel(N_Vector w) {
+  N_Vector v = cloneEmptyParallel(w);
+  if (v == NULL)
+    return NULL;
+  ParallelContent* content = static_cast<ParallelContent*>(v->content);
+  if (content->serial.length > 0) {
+    content->serial.data = static_cast<realtype*>(malloc(content->serial.length * sizeof(realtype)));
+    if (content->serial.data == NULL) {
+      destroyParallel(v);
+      return NULL;
+    }
+    content->serial.own_data = SUNTRUE;
+  }
+  return v;
+}
+
+/**
+ * @brief clone a parallel vector without allocating the elements of the clone
+ * @param w vector to clone
+ * @return the clone, NULL if the allocation failed
+ */
+N_Vector
+cloneEmptyParallel(N_Vector w) {
+  N_Vector v = N_VNewEmpty(w->sunctx);
+  if (v == NULL)
+    return NULL;
+  if (N_VCopyOps(w, v) != 0) {
+    N_VFreeEmpty(v);
+    return NULL;
+  }
+  ParallelContent* content = static_cast<ParallelContent*>(malloc(sizeof(ParallelContent)));
+  if (content == NULL) {
+    N_VFreeEmpty(v);
+    return NULL;
+  }
+  content->serial.length = NV_LENGTH_S(w);
+  content->serial.own_data = SUNFALSE;
+  content->serial.data = NULL;
+  content->threadPool = getThreadPool(w);
+  v->content = content;
+  return v;
+}
+
+/**
+ * @brief z = a x + b y
+ * @param a coefficient of x
+ * @param x first vector
+ * @param b coefficient of y
+ * @param y second vector
+ * @param z result
+ */
+void
+linearSumParallel(const realtype a, N_Vector x, const realtype b, N_Vector y, N_Vector z) {
+  const realtype* xd = NV_DATA_S(x);
+  const realtype* yd = NV_DATA_S(y);
+  realtype* zd = NV_DATA_S(z);
+  forEachChunk(x, [a, b, xd, yd, zd](const sunindextype begin, const sunindextype end) {
+    for (sunindextype i = begin; i < end; ++i)
+      zd[i] = a * xd[i] + b * yd[i];
+  });
+}
+
+/**
+ * @brief z = c
+ * @param c value of the elements
+ * @param z result
+ */
+void
+constParallel(const realtype c, N_Vector z) {
+  realtype* zd = NV_DATA_S(z);
+  forEachChunk(z, [c, zd](const sunindextype begin, const sunindextype end) {
+    std::fill(zd + begin, zd + end, c);
+  });
+}
+
+/**
+ * @brief z = x .* y
+ * @param x first vector
+ * @param y second vector
+ * @param z result
+ */
+void
+prodParallel(N_Vector x, N_Vector y, N_Vector z) {
+  const realtype* xd = NV_DATA_S(x);
+  const realtype* yd = NV_DATA_S(y);
+  realtype* zd = NV_DATA_S(z);
+  forEachChunk(x, [xd, yd, zd](const sunindextype begin, const sunindextype end) {
+    for (sunindextype i = begin; i < end; ++i)
+      zd[i] = xd[i] * yd[i];
+  });
+}
+
+/**
+ * @brief z = x ./ y
+ * @param x first vector
+ * @param y second vector
+ * @param z result
+ */
+void
+divParallel(N_Vector x, N_Vector y, N_Vector z) {
+  const realtype* xd = NV_DATA_S(x);
+  const realtype* yd = NV_DATA_S(y);
+  realtype* zd = NV_DATA_S(z);
+  forEachChunk(x, [xd, yd, zd](const sunindextype begin, const sunindextype end) {
+    for (sunindextype i = begin; i < end; ++i)
+      zd[i] = xd[i] / yd[i];
+  });
+}
+
+/**
+ * @brief z = c x
+ * @param c coefficient
+ * @param x vector
+ * @param z result
+ */
+void
+scaleParallel(const realtype c, N_Vector x, N_Vector z) {
+  const realtype* xd = NV_DATA_S(x);
+  realtype* zd = NV_DATA_S(z);
+  forEachChunk(x, [c, xd, zd](const sunindextype begin, const sunindextype end) {
+    for (sunindextype i = begin; i < end; ++i)
+      zd[i] = c * xd[i];
+  });
+}
+
+/**
+ * @brief z = |x|
+ * @param x vector
+ * @param z result
+ */
+void
+absParallel(N_Vector x, N_Vector z) {
+  const realtype* xd = NV_DATA_S(x);
+  realtype* zd = NV_DATA_S(z);
+  forEachChunk(x, [xd, zd](const sunindextype begin, const sunindextype end) {
+    for (sunindextype i = begin; i < end; ++i)
+      zd[i] = std::fabs(xd[i]);
+  });
+}
+
+/**
+ * @brief z = 1 ./ x
+ * @param x vector
+ * @param z result
+ */
+void
+invParallel(N_Vector x, N_Vector z) {
+  const realtype* xd = NV_DATA_S(x);
+  realtype* zd = NV_DATA_S(z);
+  forEachChunk(x, [xd, zd](const sunindextype begin, const sunindextype end) {
+    for (sunindextype i = begin; i < end; ++i)
+      zd[i] = 1. / xd[i];
+  });
+}
+
+/**
+ * @brief z = x + b
+ * @param x vector
+ * @param b value added to each element
+ * @param z result
+ */
+void
+addConstParallel(N_Vector x, const realtype b, N_Vector z) {
+  const realtype* xd = NV_DATA_S(x);
+  realtype* zd = NV_DATA_S(z);
+  forEachChunk(x, [b, xd, zd](const sunindextype begin, const sunindextype end) {
+    for (sunindextype i = begin; i < end; ++i)
+      zd[i] = xd[i] + b;
+  });
+}
+
+/**
+ * @brief compute sum(x[i] * y[i])
+ * @param x first vector
+ * @param y second vector
+ * @return the dot product
+ */
+realtype
+dotProdParallel(N_Vector x, N_Vector y) {
+  const realtype* xd = NV_DATA_S(x);
+  const realtype* yd = NV_DATA_S(y);
+  return reduce(x, [xd, yd](const sunindextype begin, const sunindextype end) {
+    realtype sum = 0.;
+    for (sunindextype i = begin; i < end; ++i)
+      sum += xd[i] * yd[i];
+    return sum;
+  }, add);
+}
+
+/**
+ * @brief compute max(|x[i]|)
+ * @param x vector
+ * @return the max norm
+ */
+realtype
+maxNormParallel(N_Vector x) {
+  const realtype* xd = NV_DATA_S(x);
+  return reduce(x, [xd](const sunindextype begin, const sunindextype end) {
+    return DYN::VectorKernels::maxAbs(xd + begin, static_cast<std::size_t>(end - begin));
+  }, maximum);
+}
+
+/**
+ * @brief compute sqrt(sum((x[i] * w[i])^2) / n)
+ * @param x vector
+ * @param w weights
+ * @return the weighted root mean square norm
+ */
+realtype
+wrmsNormParallel(N_Vector x, N_Vector w) {
+  const realtype* xd = NV_DATA_S(x);
+  const realtype* wd = NV_DATA_S(w);
+  const realtype sum = reduce(x, [xd, wd](const sunindextype begin, const sunindextype end) {
+    return DYN::VectorKernels::sumSquaredProducts(xd + begin, wd + begin, static_cast<std::size_t>(end - begin));
+  }, add);
+  return std::sqrt(sum / NV_LENGTH_S(x));
+}
+
+/**
+ * @brief compute sqrt(sum((x[i] * w[i])^2 for id[i] > 0) / n)
+ * @param x vector
+ * @param w weights
+ * @param id mask
+ * @return the masked weighted root mean square norm
+ */
+realtype
+wrmsNormMaskParallel(N_Vector x, N_Vector w, N_Vector id) {
+  const realtype* xd = NV_DATA_S(x);
+  const realtype* wd = NV_DATA_S(w);
+  const realtype* idd = NV_DATA_S(id);
+  const realtype sum = reduce(x, [xd, wd, idd](const sunindextype begin, const sunindextype end) {
+    realtype partialSum = 0.;
+    for (sunindextype i = begin; i < end; ++i) {
+      if (idd[i] > 0.) {
+        const realtype product = xd[i] * wd[i];
+        partialSum += product * product;
+      }
+    }
+    return partialSum;
+  }, add);
+  return std::sqrt(sum / NV_LENGTH_S(x));
+}
+
+/**
+ * @brief compute min(x[i])
+ * @param x vector
+ * @return the smallest element
+ */
+realtype
+minParallel(N_Vector x) {
+  const realtype* xd = NV_DATA_S(x);
+  return reduce(x, [xd](const sunindextype begin, const sunindextype end) {
+    return begin < end ? *std::min_element(xd + begin, xd + end) : BIG_REAL;
+  }, minimum);
+}
+
+/**
+ * @brief compute sqrt(sum((x[i] * w[i])^2))
+ * @param x vector
+ * @param w weights
+ * @return the weighted euclidean norm
+ */
+realtype
+wl2NormParallel(N_Vector x, N_Vector w) {
+  const realtype* xd = NV_DATA_S(x);
+  const realtype* wd = NV_DATA_S(w);
+  return std::sqrt(reduce(x, [xd, wd](const sunindextype begin, const sunindextype end) {
+    return DYN::VectorKernels::sumSquaredProducts(xd + begin, wd + begin, static_cast<std::size_t>(end - begin));
+  }, add));
+}
+
+/**
+ * @brief compute sum(|x[i]|)
+ * @param x vector
+ * @return the L1 norm
+ */
+realtype
+l1NormParallel(N_Vector x) {
+  const realtype* xd = NV_DATA_S(x);
+  return reduce(x, [xd](const sunindextype begin, const sunindextype end) {
+    return DYN::VectorKernels::sumAbs(xd + begin, static_cast<std::size_t>(end - begin));
+  }, add);
+}
+
+/**
+ * @brief turn a serial vector into a parallel vector
+ * @param v serial vector, destroyed if the conversion fails
+ * @param threadPool pool running the operations
+ * @return the parallel vector, NULL if the allocation failed
+ */
+N_Vector
+makeParallel(N_Vector v, DYN::ThreadPool* threadPool) {
+  ParallelContent* content = static_cast<ParallelContent*>(malloc(sizeof(ParallelContent)));
+  if (content == NULL) {
+    N_VDestroy_Serial(v);
+    return NULL;
+  }
+  content->serial = *NV_CONTENT_S(v);
+  content->threadPool = threadPool;
+  free(v->content);
+  v->content = content;
+
+  v->ops->nvclone = cloneParallel;
+  v->ops->nvcloneempty = cloneEmptyParallel;
+  v->ops->nvdestroy = destroyParallel;
+  v->ops->nvlinearsum = linearSumParallel;
+  v->ops->nvconst = constParallel;
+  v->ops->nvprod = prodParallel;
+  v->ops->nvdiv = divParallel;
+  v->ops->nvscale = scaleParallel;
+  v->ops->nvabs = absParallel;
+  v->ops->nvinv = invParallel;
+  v->ops->nvaddconst = addConstParallel;
+  v->ops->nvdotprod = dotProdParallel;
+  v->ops->nvmaxnorm = maxNormParallel;
+  v->ops->nvwrmsnorm = wrmsNormParallel;
+  v->ops->nvwrmsnormmask = wrmsNormMaskParallel;
+  v->ops->nvmin = minParallel;
+  v->ops->nvwl2norm = wl2NormParallel;
+  v->ops->nvl1norm = l1NormParallel;
+  return v;
+}
+
+}  // namespace
+
+namespace DYN {
+
+const sunindextype ParallelVector::MIN_CHUNK_SIZE;
+
+N_Vector
+ParallelVector::make(const sunindextype length, realtype* data, ThreadPool* threadPool, SUNContext context) {
+  N_Vector v = N_VMake_Serial(length, data, context);
+  if (v == NULL || threadPool == nullptr || threadPool->nbThreads() <= 1)
+    return v;
+  return makeParallel(v, threadPool);
+}
+
+N_Vector
+ParallelVector::create(const sunindextype length, ThreadPool* threadPool, SUNContext context) {
+  N_Vector v = N_VNew_Serial(length, context);
+  if (v == NULL || threadPool == nullptr || threadPool->nbThreads() <= 1)
+    return v;
+  return makeParallel(v, threadPool);
+}
+
+bool
+ParallelVector::isParallel(N_Vector v) {
+  return v != NULL && v->ops != NULL && v->ops->nvclone == cloneParallel;
+}
+
+}  // end namespace DYN
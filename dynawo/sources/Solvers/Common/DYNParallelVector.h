@@ -0,0 +1,84 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNParallelVector.h
+ *
+ * @brief Sundials vectors whose operations are run by the thread pool of the model
+ *
+ */
+#ifndef SOLVERS_COMMON_DYNPARALLELVECTOR_H_
+#define SOLVERS_COMMON_DYNPARALLELVECTOR_H_
+
+#include <sundials/sundials_nvector.h>
+
+namespace DYN {
+class ThreadPool;
+
+/**
+ * @brief ParallelVector static class: creation of the N_Vector used by the solvers
+ *
+ * A parallel vector keeps the content layout and the identifier of a serial vector, so that it can be accessed with the
+ * NV_DATA_S macros and given to the KLU linear solver, and so that it can be mixed with serial vectors in the operations.
+ * Its element-wise operations and its reductions are split in contiguous chunks run by the threads of the pool,
+ * the other operations being the serial ones. Vectors cloned from a parallel vector are parallel.
+ *
+ * Chunks have a minimal size, so that the operations on small vectors are run by the calling thread only.
+ * The chunks of a reduction are combined in a fixed order: results are reproducible for a given number of threads,
+ * but the sums may differ from the serial ones by rounding errors.
+ *
+ * The pool is shared with the model: the vector operations must not be run while the model is evaluated.
+ */
+class ParallelVector {
+ public:
+  /**
+   * @brief create a vector using an existing array
+   *
+   * @param length number of elements
+   * @param data array of the elements, not owned by the vector
+   * @param threadPool pool running the operations, nullptr to create a serial vector
+   * @param context sundials context
+   *
+   * @return the vector, to be released with N_VDestroy, NULL if the allocation failed
+   */
+  static N_Vector make(sunindextype length, realtype* data, ThreadPool* threadPool, SUNContext context);
+
+  /**
+   * @brief create a vector owning its elements
+   *
+   * @param length number of elements
+   * @param threadPool pool running the operations, nullptr to create a serial vector
+   * @param context sundials context
+   *
+   * @return the vector, to be released with N_VDestroy, NULL if the allocation failed
+   */
+  static N_Vector create(sunindextype length, ThreadPool* threadPool, SUNContext context);
+
+  /**
+   * @brief indicate whether the operations of a vector are run by a thread pool
+   *
+   * @param v vector
+   *
+   * @return @b true if v was created with a thread pool or cloned from such a vector
+   */
+  static bool isParallel(N_Vector v);
+
+  /**
+   * @brief minimal number of elements of a chunk: operations on vectors shorter than twice this size are not split
+   */
+  static const sunindextype MIN_CHUNK_SIZE = 16384;
+};
+
+}  // end namespace DYN
+
+#endif  // SOLVERS_COMMON_DYNPARALLELVECTOR_H_
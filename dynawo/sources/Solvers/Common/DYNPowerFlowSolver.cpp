@@ -0,0 +1,300 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNPowerFlowSolver.cpp
+ *
+ * @brief Newton-Raphson power flow implementation
+ *
+ */
+#include <algorithm>
+#include <cmath>
+
+#include "DYNPowerFlowSolver.h"
+#include "DYNKLUFactorization.h"
+
+using std::complex;
+using std::vector;
+
+namespace {
+
+/**
+ * @brief find the root of the island of a bus, compressing the path on the way
+ * @param parents parent of each bus in the islands forest
+ * @param bus index of the bus
+ * @return index of the root bus
+ */
+unsigned
+findRoot(vector<unsigned>& parents, unsigned bus) {
+  while (parents[bus] != bus) {
+    parents[bus] = parents[parents[bus]];
+    bus = parents[bus];
+  }
+  return bus;
+}
+
+}  // namespace
+
+namespace DYN {
+
+PowerFlowSolver::PowerFlowSolver() :
+nbIterations_(0),
+maxMismatch_(0.) { }
+
+unsigned
+PowerFlowSolver::addBus(const double v0, const double angle0) {
+  const unsigned bus = static_cast<unsigned>(v_.size());
+  v_.push_back(v0 > 0. && std::isfinite(v0) ? v0 : 1.);
+  angle_.push_back(std::isfinite(angle0) ? angle0 : 0.);
+  pInjected_.push_back(0.);
+  qInjected_.push_back(0.);
+  types_.push_back(PQ);
+  // the diagonal term is always stored, even for a bus without any branch
+  columns_.push_back(vector<std::pair<unsigned, complex<double> > >(1, std::make_pair(bus, complex<double>(0., 0.))));
+  return bus;
+}
+
+void
+PowerFlowSolver::addAdmittance(const unsigned row, const unsigned col, const complex<double> y) {
+  vector<std::pair<unsigned, complex<double> > >& column = columns_[col];
+  vector<std::pair<unsigned, complex<double> > >::iterator it = column.begin();
+  while (it != column.end() && it->first < row)
+    ++it;
+  if (it != column.end() && it->first == row)
+    it->second += y;
+  else
+    column.insert(it, std::make_pair(row, y));
+}
+
+void
+PowerFlowSolver::addBranch(const unsigned bus1, const unsigned bus2, const complex<double> y11, const complex<double> y12,
+    const complex<double> y21, const complex<double> y22) {
+  addAdmittance(bus1, bus1, y11);
+  addAdmittance(bus1, bus2, y12);
+  addAdmittance(bus2, bus1, y21);
+  addAdmittance(bus2, bus2, y22);
+}
+
+void
+PowerFlowSolver::addShunt(const unsigned bus, const complex<double> y) {
+  addAdmittance(bus, bus, y);
+}
+
+void
+PowerFlowSolver::addInjection(const unsigned bus, const double p, const double q) {
+  pInjected_[bus] += p;
+  qInjected_[bus] += q;
+}
+
+void
+PowerFlowSolver::setTargetV(const unsigned bus, const double targetV) {
+  if (!(targetV > 0.) || !std::isfinite(targetV))
+    return;
+  v_[bus] = targetV;
+  if (types_[bus] == PQ)
+    types_[bus] = PV;
+}
+
+void
+PowerFlowSolver::setSlack(const unsigned bus) {
+  types_[bus] = SLACK;
+}
+
+void
+PowerFlowSolver::chooseSlacks(vector<bool>& frozen) {
+  const unsigned nbBuses = static_cast<unsigned>(v_.size());
+  vector<unsigned> parents(nbBuses);
+  for (unsigned bus = 0; bus < nbBuses; ++bus)
+    parents[bus] = bus;
+  for (unsigned col = 0; col < nbBuses; ++col) {
+    for (const auto& term : columns_[col]) {
+      const unsigned root1 = findRoot(parents, term.first);
+      const unsigned root2 = findRoot(parents, col);
+      if (root1 != root2)
+        parents[root1] = root2;
+    }
+  }
+
+  // slack of each island, the first slack given being kept, and otherwise the controlled bus with the largest active injection
+  const unsigned noBus = nbBuses;
+  vector<unsigned> slacks(nbBuses, noBus);
+  for (unsigned bus = 0; bus < nbBuses; ++bus) {
+    if (types_[bus] != SLACK)
+      continue;
+    const unsigned root = findRoot(parents, bus);
+    if (slacks[root] == noBus)
+      slacks[root] = bus;
+    else
+      types_[bus] = PV;
+  }
+  vector<unsigned> candidates(nbBuses, noBus);
+  for (unsigned bus = 0; bus < nbBuses; ++bus) {
+    if (types_[bus] != PV)
+      continue;
+    const unsigned root = findRoot(parents, bus);
+    if (candidates[root] == noBus || pInjected_[bus] > pInjected_[candidates[root]])
+      candidates[root] = bus;
+  }
+  for (unsigned root = 0; root < nbBuses; ++root) {
+    if (slacks[root] == noBus && candidates[root] != noBus)
+      types_[candidates[root]] = SLACK;
+  }
+
+  frozen.assign(nbBuses, false);
+  for (unsigned bus = 0; bus < nbBuses; ++bus) {
+    const unsigned root = findRoot(parents, bus);
+    frozen[bus] = slacks[root] == noBus && candidates[root] == noBus;
+  }
+}
+
+void
+PowerFlowSolver::computePowers(vector<double>& p, vector<double>& q) const {
+  const unsigned nbBuses = static_cast<unsigned>(v_.size());
+  vector<complex<double> > currents(nbBuses, complex<double>(0., 0.));
+  for (unsigned col = 0; col < nbBuses; ++col) {
+    const complex<double> u = std::polar(v_[col], angle_[col]);
+    for (const auto& term : columns_[col])
+      currents[term.first] += term.second * u;
+  }
+  p.resize(nbBuses);
+  q.resize(nbBuses);
+  for (unsigned bus = 0; bus < nbBuses; ++bus) {
+    const complex<double> s = std::polar(v_[bus], angle_[bus]) * std::conj(currents[bus]);
+    p[bus] = s.real();
+    q[bus] = s.imag();
+  }
+}
+
+bool
+PowerFlowSolver::solve(const double tolerance, const unsigned maxIterations) {
+  nbIterations_ = 0;
+  maxMismatch_ = 0.;
+  vector<bool> frozen;
+  chooseSlacks(frozen);
+
+  // the active power equation of a bus and its angle share the same index, as do its reactive power equation and its magnitude
+  const unsigned nbBuses = static_cast<unsigned>(v_.size());
+  vector<int> indexP(nbBuses, -1);
+  vector<int> indexQ(nbBuses, -1);
+  sunindextype size = 0;
+  for (unsigned bus = 0; bus < nbBuses; ++bus) {
+    if (frozen[bus] || types_[bus] == SLACK)
+      continue;
+    indexP[bus] = static_cast<int>(size++);
+    if (types_[bus] == PQ)
+      indexQ[bus] = static_cast<int>(size++);
+  }
+  if (size == 0)
+    return true;
+
+  // the columns are created in the order of their indexes, with sorted rows
+  vector<sunindextype> colPtrs(1, 0);
+  vector<sunindextype> rowIdx;
+  for (unsigned col = 0; col < nbBuses; ++col) {
+    const int indexes[2] = {indexP[col], indexQ[col]};
+    for (const int index : indexes) {
+      if (index < 0)
+        continue;
+      for (const auto& term : columns_[col]) {
+        if (indexP[term.first] >= 0)
+          rowIdx.push_back(indexP[term.first]);
+        if (indexQ[term.first] >= 0)
+          rowIdx.push_back(indexQ[term.first]);
+      }
+      colPtrs.push_back(static_cast<sunindextype>(rowIdx.size()));
+    }
+  }
+  vector<realtype> values(rowIdx.size());
+  vector<realtype> mismatches(size);
+  KLUFactorization factorization;
+  if (!factorization.analyze(size, &colPtrs[0], &rowIdx[0]))
+    return false;
+
+  const vector<double> v0 = v_;
+  const vector<double> angle0 = angle_;
+  vector<double> p;
+  vector<double> q;
+  bool converged = false;
+  while (true) {
+    computePowers(p, q);
+    maxMismatch_ = 0.;
+    for (unsigned bus = 0; bus < nbBuses; ++bus) {
+      if (indexP[bus] >= 0)
+        mismatches[indexP[bus]] = p[bus] - pInjected_[bus];
+      if (indexQ[bus] >= 0)
+        mismatches[indexQ[bus]] = q[bus] - qInjected_[bus];
+    }
+    for (const double mismatch : mismatches)
+      maxMismatch_ = std::max(maxMismatch_, std::abs(mismatch));
+    if (!std::isfinite(maxMismatch_))
+      break;
+    if (maxMismatch_ < tolerance) {
+      converged = true;
+      break;
+    }
+    if (nbIterations_ >= maxIterations)
+      break;
+    ++nbIterations_;
+
+    // derivatives of the powers injected into the row buses with respect to the angle and the magnitude of the column bus
+    unsigned position = 0;
+    for (unsigned col = 0; col < nbBuses; ++col) {
+      for (unsigned derivative = 0; derivative < 2; ++derivative) {
+        const bool isAngle = derivative == 0;
+        if ((isAngle && indexP[col] < 0) || (!isAngle && indexQ[col] < 0))
+          continue;
+        for (const auto& term : columns_[col]) {
+          const unsigned row = term.first;
+          const double g = term.second.real();
+          const double b = term.second.imag();
+          double dP;
+          double dQ;
+          if (row == col) {
+            dP = isAngle ? -q[row] - b * v_[row] * v_[row] : p[row] / v_[row] + g * v_[row];
+            dQ = isAngle ? p[row] - g * v_[row] * v_[row] : q[row] / v_[row] - b * v_[row];
+          } else {
+            const double cosAngle = std::cos(angle_[row] - angle_[col]);
+            const double sinAngle = std::sin(angle_[row] - angle_[col]);
+            dP = isAngle ? v_[row] * v_[col] * (g * sinAngle - b * cosAngle) : v_[row] * (g * cosAngle + b * sinAngle);
+            dQ = isAngle ? -v_[row] * v_[col] * (g * cosAngle + b * sinAngle) : v_[row] * (g * sinAngle - b * cosAngle);
+          }
+          if (indexP[row] >= 0)
+            values[position++] = dP;
+          if (indexQ[row] >= 0)
+            values[position++] = dQ;
+        }
+      }
+    }
+    if (!factorization.factorize(&colPtrs[0], &rowIdx[0], &values[0]) || !factorization.solve(size, 1, &mismatches[0], false))
+      break;
+    bool collapsed = false;
+    for (unsigned bus = 0; bus < nbBuses; ++bus) {
+      if (indexP[bus] >= 0)
+        angle_[bus] -= mismatches[indexP[bus]];
+      if (indexQ[bus] >= 0) {
+        v_[bus] -= mismatches[indexQ[bus]];
+        collapsed = collapsed || !(v_[bus] > 0.);
+      }
+    }
+    if (collapsed)
+      break;
+  }
+
+  if (!converged) {
+    v_ = v0;
+    angle_ = angle0;
+  }
+  return converged;
+}
+
+}  // end namespace DYN
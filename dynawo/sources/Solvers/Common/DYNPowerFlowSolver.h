@@ -0,0 +1,181 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNPowerFlowSolver.h
+ *
+ * @brief Newton-Raphson power flow on the static network, computing the bus voltages before the initialization
+ *
+ */
+#ifndef SOLVERS_COMMON_DYNPOWERFLOWSOLVER_H_
+#define SOLVERS_COMMON_DYNPOWERFLOWSOLVER_H_
+
+#include <complex>
+#include <vector>
+#include <boost/core/noncopyable.hpp>
+
+namespace DYN {
+
+/**
+ * @brief Newton-Raphson power flow in polar coordinates
+ *
+ * The network is described by its buses, the two-port admittances of its branches, its shunt admittances and its
+ * injections, in per unit. A bus is PQ by default: its active and reactive injections are given. It becomes PV when its
+ * voltage magnitude is controlled, and one bus of each island is the slack, whose voltage magnitude and angle are kept. An
+ * island without slack takes as slack its controlled bus with the largest active injection, and an island without any
+ * controlled bus is left unchanged.
+ *
+ * The Jacobian keeps the structure of the admittance matrix: it is analyzed once by KLU and only factorized again at
+ * each iteration.
+ */
+class PowerFlowSolver : private boost::noncopyable {
+ public:
+  /**
+   * @brief constructor
+   */
+  PowerFlowSolver();
+
+  /**
+   * @brief add a bus
+   * @param v0 initial voltage magnitude in per unit, the flat start value being used when it is not strictly positive
+   * @param angle0 initial voltage angle in radian
+   * @return index of the bus
+   */
+  unsigned addBus(double v0, double angle0);
+
+  /**
+   * @brief add a branch between two buses, with the currents I1 = y11 U1 + y12 U2 and I2 = y21 U1 + y22 U2
+   * @param bus1 index of the first bus
+   * @param bus2 index of the second bus
+   * @param y11 admittance seen from the first bus
+   * @param y12 transfer admittance from the second bus to the first one
+   * @param y21 transfer admittance from the first bus to the second one
+   * @param y22 admittance seen from the second bus
+   */
+  void addBranch(unsigned bus1, unsigned bus2, std::complex<double> y11, std::complex<double> y12,
+      std::complex<double> y21, std::complex<double> y22);
+
+  /**
+   * @brief add an admittance between a bus and the ground
+   * @param bus index of the bus
+   * @param y admittance
+   */
+  void addShunt(unsigned bus, std::complex<double> y);
+
+  /**
+   * @brief add a power injected into a bus
+   * @param bus index of the bus
+   * @param p active power injected, in per unit
+   * @param q reactive power injected, in per unit, ignored once the voltage magnitude of the bus is controlled
+   */
+  void addInjection(unsigned bus, double p, double q);
+
+  /**
+   * @brief control the voltage magnitude of a bus, which becomes PV
+   * @param bus index of the bus
+   * @param targetV voltage magnitude in per unit
+   */
+  void setTargetV(unsigned bus, double targetV);
+
+  /**
+   * @brief choose the slack bus of an island
+   * @param bus index of the bus
+   */
+  void setSlack(unsigned bus);
+
+  /**
+   * @brief solve the power flow
+   * @param tolerance largest power mismatch accepted on a bus, in per unit
+   * @param maxIterations maximum number of Newton-Raphson iterations
+   * @return @b true if the power flow converged, the bus voltages being then updated
+   */
+  bool solve(double tolerance, unsigned maxIterations);
+
+  /**
+   * @brief get the number of Newton-Raphson iterations of the last solve
+   * @return number of iterations
+   */
+  unsigned getNbIterations() const {
+    return nbIterations_;
+  }
+
+  /**
+   * @brief get the largest power mismatch at the end of the last solve
+   * @return largest power mismatch, in per unit
+   */
+  double getMaxMismatch() const {
+    return maxMismatch_;
+  }
+
+  /**
+   * @brief get the voltage magnitude of a bus
+   * @param bus index of the bus
+   * @return voltage magnitude in per unit
+   */
+  double getV(unsigned bus) const {
+    return v_[bus];
+  }
+
+  /**
+   * @brief get the voltage angle of a bus
+   * @param bus index of the bus
+   * @return voltage angle in radian
+   */
+  double getAngle(unsigned bus) const {
+    return angle_[bus];
+  }
+
+ private:
+  /**
+   * @brief type of a bus
+   */
+  typedef enum {
+    PQ = 0,  ///< active and reactive injections given
+    PV = 1,  ///< active injection and voltage magnitude given
+    SLACK = 2  ///< voltage magnitude and angle given
+  } BusType_t;
+
+  /**
+   * @brief add a term to the admittance matrix
+   * @param row row of the term
+   * @param col column of the term
+   * @param y admittance added
+   */
+  void addAdmittance(unsigned row, unsigned col, std::complex<double> y);
+
+  /**
+   * @brief choose a slack bus in each island without one, and leave unchanged the islands without any controlled bus
+   * @param frozen set to @b true for the buses of the islands left unchanged
+   */
+  void chooseSlacks(std::vector<bool>& frozen);
+
+  /**
+   * @brief compute the powers injected into the buses by the network
+   * @param p active powers
+   * @param q reactive powers
+   */
+  void computePowers(std::vector<double>& p, std::vector<double>& q) const;
+
+  std::vector<double> v_;  ///< voltage magnitudes
+  std::vector<double> angle_;  ///< voltage angles
+  std::vector<double> pInjected_;  ///< active injections
+  std::vector<double> qInjected_;  ///< reactive injections
+  std::vector<BusType_t> types_;  ///< types of the buses
+  std::vector<std::vector<std::pair<unsigned, std::complex<double> > > > columns_;  ///< admittance matrix stored by columns, with sorted rows
+  unsigned nbIterations_;  ///< number of iterations of the last solve
+  double maxMismatch_;  ///< largest power mismatch at the end of the last solve
+};
+
+}  // end namespace DYN
+
+#endif  // SOLVERS_COMMON_DYNPOWERFLOWSOLVER_H_
@@ -0,0 +1,97 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNRestorationCache.cpp
+ *
+ * @brief Cache of the corrections computed by the algebraic restorations implementation
+ *
+ */
+#include <cstring>
+#include <utility>
+
+#include "DYNRestorationCache.h"
+
+namespace {
+
+const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;  ///< initial value of the FNV-1a hash
+const uint64_t FNV_PRIME = 1099511628211ULL;  ///< multiplier of the FNV-1a hash
+
+/**
+ * @brief add the bit patterns of values to a FNV-1a hash
+ * @param hash hash to update
+ * @param values values to add
+ */
+void
+hashValues(uint64_t& hash, const std::vector<double>& values) {
+  for (std::vector<double>::const_iterator it = values.begin(); it != values.end(); ++it) {
+    // -0. and 0. are the same discrete value
+    const double value = (*it == 0.) ? 0. : *it;
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (unsigned int i = 0; i < sizeof(bits); ++i) {
+      hash ^= (bits >> (8 * i)) & 0xff;
+      hash *= FNV_PRIME;
+    }
+  }
+}
+
+}  // namespace
+
+namespace DYN {
+
+RestorationCache::RestorationCache(const size_t maxSize) :
+maxSize_(maxSize),
+nbHits_(0) {
+}
+
+uint64_t
+RestorationCache::signature(const std::vector<double>& zBefore, const std::vector<double>& zAfter) {
+  uint64_t hash = FNV_OFFSET_BASIS;
+  hashValues(hash, zBefore);
+  hashValues(hash, zAfter);
+  return hash;
+}
+
+bool
+RestorationCache::apply(const uint64_t signature, std::vector<double>& y) {
+  std::unordered_map<uint64_t, std::vector<double> >::const_iterator it = corrections_.find(signature);
+  if (it == corrections_.end() || it->second.size() != y.size())
+    return false;
+  const std::vector<double>& correction = it->second;
+  for (size_t i = 0; i < y.size(); ++i)
+    y[i] += correction[i];
+  ++nbHits_;
+  return true;
+}
+
+void
+RestorationCache::store(const uint64_t signature, const std::vector<double>& yBefore, const std::vector<double>& yAfter) {
+  if (maxSize_ == 0 || yBefore.size() != yAfter.size())
+    return;
+  std::unordered_map<uint64_t, std::vector<double> >::iterator it = corrections_.find(signature);
+  if (it == corrections_.end()) {
+    if (corrections_.size() >= maxSize_) {
+      corrections_.erase(insertionOrder_.front());
+      insertionOrder_.pop_front();
+    }
+    it = corrections_.insert(std::make_pair(signature, std::vector<double>())).first;
+    insertionOrder_.push_back(signature);
+  }
+  std::vector<double>& correction = it->second;
+  correction.resize(yAfter.size());
+  for (size_t i = 0; i < yAfter.size(); ++i)
+    correction[i] = yAfter[i] - yBefore[i];
+}
+
+}  // end namespace DYN
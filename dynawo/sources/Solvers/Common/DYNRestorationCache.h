@@ -0,0 +1,106 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNRestorationCache.h
+ *
+ * @brief Cache of the corrections computed by the algebraic restorations, indexed by mode transition
+ *
+ */
+#ifndef SOLVERS_COMMON_DYNRESTORATIONCACHE_H_
+#define SOLVERS_COMMON_DYNRESTORATIONCACHE_H_
+
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+#include <boost/core/noncopyable.hpp>
+
+namespace DYN {
+
+/**
+ * @class RestorationCache
+ * @brief Cache of the corrections of the variables computed by the algebraic restorations
+ *
+ * A correction is the difference between the variables after and before a restoration. It is indexed by the signature
+ * of the mode transition, computed from the discrete variables before and after the transition. When the same
+ * transition occurs again (tap changer stepping, shunt switching), the correction is added to the variables to give
+ * a closer initial guess to the Newton resolution.
+ * The cache keeps at most a given number of corrections, the oldest one being dropped first.
+ */
+class RestorationCache : private boost::noncopyable {
+ public:
+  /**
+   * @brief constructor
+   *
+   * @param maxSize maximum number of corrections kept
+   */
+  explicit RestorationCache(size_t maxSize);
+
+  /**
+   * @brief compute the signature of a mode transition
+   *
+   * @param zBefore values of the discrete variables before the transition
+   * @param zAfter values of the discrete variables after the transition
+   *
+   * @return signature of the transition
+   */
+  static uint64_t signature(const std::vector<double>& zBefore, const std::vector<double>& zAfter);
+
+  /**
+   * @brief add the correction saved for a transition to the variables
+   *
+   * @param signature signature of the transition
+   * @param y values of the variables, modified only if a correction is known
+   *
+   * @return @b true if a correction was applied, @b false otherwise
+   */
+  bool apply(uint64_t signature, std::vector<double>& y);
+
+  /**
+   * @brief save the correction computed by a restoration, replacing the previous one for the same transition
+   *
+   * @param signature signature of the transition
+   * @param yBefore values of the variables before the restoration
+   * @param yAfter values of the variables after the restoration
+   */
+  void store(uint64_t signature, const std::vector<double>& yBefore, const std::vector<double>& yAfter);
+
+  /**
+   * @brief get the number of corrections in the cache
+   *
+   * @return number of corrections
+   */
+  size_t size() const {
+    return corrections_.size();
+  }
+
+  /**
+   * @brief get the number of corrections applied since the creation of the cache
+   *
+   * @return number of corrections applied
+   */
+  long int nbHits() const {
+    return nbHits_;
+  }
+
+ private:
+  size_t maxSize_;  ///< maximum number of corrections kept
+  std::unordered_map<uint64_t, std::vector<double> > corrections_;  ///< corrections by transition signature
+  std::deque<uint64_t> insertionOrder_;  ///< signatures of the corrections, from the oldest to the newest
+  long int nbHits_;  ///< number of corrections applied
+};
+
+}  // end namespace DYN
+
+#endif  // SOLVERS_COMMON_DYNRESTORATIONCACHE_H_
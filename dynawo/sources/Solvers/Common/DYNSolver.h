@@ -27,6 +27,7 @@
 
 #include "DYNBitMask.h"
 #include "DYNEnumUtils.h"
+#include "DYNStateBuffer.h"
 
 namespace parameters {
 class ParametersSet;
@@ -59,6 +60,26 @@ typedef enum {
   SolverSundials2 = 2
 } SolverType;
 
+/**
+ * @brief Structure for storing solver statistics
+ */
+typedef struct {
+  long int nst_;  ///< number of steps
+  long int nre_;  ///< number of residual evaluations
+  long int nni_;  ///< number of nonlinear iterations
+  long int nje_;  ///< number of Jacobian evaluations
+  long int netf_;  ///< number of error test failures
+  long int ncfn_;  ///< number of nonlinear convergence failures
+  long int nge_;  ///< number of root function evaluations
+  long int nze_;  ///< number of discrete variable evaluations
+  long int nme_;  ///< number of mode evaluations
+  long int nrb_;  ///< number of root batches, i.e. of discrete propagations triggered by the roots changed in a time step
+  long int nrc_;  ///< number of root changes handled by the root batches
+  long int nrbMax_;  ///< largest number of root changes handled by a single root batch
+} stat_t;
+
+class ConvergenceDiagnostics;
+class MemoryUsage;
 class Model;
 class ParameterSolver;
 
@@ -290,6 +311,27 @@ class Solver {
    */
   virtual void updateStatistics() = 0;
 
+  /**
+   * @brief get the statistics of execution of the solver since the beginning of the simulation, up to date at the last step
+   *
+   * @param statistics statistics to fill
+   */
+  virtual void getStatistics(stat_t& statistics) const = 0;
+
+  /**
+   * @brief account the memory allocated by the Jacobians and the linear solvers of the solver
+   *
+   * @param usage memory usage to complete
+   */
+  virtual void accountMemory(MemoryUsage& usage) const = 0;
+
+  /**
+   * @brief get the diagnostics of the last Newton iterations of the time scheme, disabled by default
+   *
+   * @return convergence diagnostics of the solver
+   */
+  virtual ConvergenceDiagnostics& getConvergenceDiagnostics() = 0;
+
   /**
    * @brief whether the silentZ optimization is activated
    *
@@ -318,6 +360,36 @@ class Solver {
   */
   virtual bool startFromDump() const = 0;
 
+  /**
+  * @brief write the current state of the solver in a snapshot, to restore it in memory later on
+  *
+  * @param state snapshot to fill
+  */
+  virtual void snapshotState(StateBuffer& state) const = 0;
+
+  /**
+  * @brief restore the state of the solver written by snapshotState, the model being restored beforehand
+  *
+  * @param state snapshot to read
+  */
+  virtual void restoreState(StateBuffer::Reader& state) = 0;
+
+  /**
+  * @brief replace the continuous variables of the current state and restart the integration from them
+  *
+  * @param y new values of the continuous variables
+  * @param yp new values of the derivatives of the continuous variables
+  */
+  virtual void setContinuousVariables(const std::vector<double>& y, const std::vector<double>& yp) = 0;
+
+  /**
+  * @brief switch to cheaper settings to keep up with a real-time clock, or back to the nominal settings
+  *
+  * @param degraded @b true for the cheaper settings, @b false for the nominal ones
+  * @return @b false if the solver has no cheaper settings
+  */
+  virtual bool setDegradedMode(bool degraded) = 0;
+
   class Impl;
 };
 
@@ -17,16 +17,21 @@
  * @brief Common utility method shared between all solvers
  *
  */
+#include <algorithm>
+#include <cassert>
 #include <string>
 #include <cmath>
 #include <sunmatrix/sunmatrix_sparse.h>
-#include <sunlinsol/sunlinsol_klu.h>
 
+#include "DYNLinearSolver.h"
 #include "DYNMacrosMessage.h"
 #include "DYNModel.h"
 #include "DYNSolverCommon.h"
+#include "DYNHugePages.h"
 #include "DYNSparseMatrix.h"
+#include "DYNSymbolicAnalysisCache.h"
 #include "DYNTrace.h"
+#include "DYNVectorKernels.h"
 
 namespace DYN {
 
@@ -41,6 +46,8 @@ SolverCommon::copySparseToKINSOL(const SparseMatrix& smj, SUNMatrix& JJ, const i
     SM_INDEXPTRS_S(JJ) = reinterpret_cast<sunindextype*> (malloc((size + 1) * sizeof (sunindextype)));
     SM_INDEXVALS_S(JJ) = reinterpret_cast<sunindextype*> (malloc(SM_NNZ_S(JJ) * sizeof (sunindextype)));
     SM_DATA_S(JJ) = reinterpret_cast<realtype*> (malloc(SM_NNZ_S(JJ) * sizeof (realtype)));
+    HugePages::advise(SM_INDEXVALS_S(JJ), SM_NNZ_S(JJ) * sizeof (sunindextype));
+    HugePages::advise(SM_DATA_S(JJ), SM_NNZ_S(JJ) * sizeof (realtype));
     matrixStructChange = true;
   }
 
@@ -66,20 +73,109 @@ SolverCommon::copySparseToKINSOL(const SparseMatrix& smj, SUNMatrix& JJ, const i
   return matrixStructChange;
 }
 
-void SolverCommon::propagateMatrixStructureChangeToKINSOL(const SparseMatrix& smj, SUNMatrix& JJ, const int& size, sunindextype** lastRowVals,
-                                                          SUNLinearSolver& LS, bool log) {
-  bool matrixStructChange = copySparseToKINSOL(smj, JJ, size, *lastRowVals);
+bool
+SolverCommon::shareSparseWithKINSOL(SparseMatrix& smj, SUNMatrix& JJ, const int& size, const sunindextype* lastRowVals) {
+  bool matrixStructChange = false;
+  if (SM_NNZ_S(JJ) < smj.nbElem()) {
+    // only the indexes are owned by the KINSOL structure
+    free(SM_INDEXPTRS_S(JJ));
+    free(SM_INDEXVALS_S(JJ));
+    SM_NNZ_S(JJ) = smj.nbElem();
+    SM_INDEXPTRS_S(JJ) = reinterpret_cast<sunindextype*> (malloc((size + 1) * sizeof (sunindextype)));
+    SM_INDEXVALS_S(JJ) = reinterpret_cast<sunindextype*> (malloc(SM_NNZ_S(JJ) * sizeof (sunindextype)));
+    HugePages::advise(SM_INDEXVALS_S(JJ), SM_NNZ_S(JJ) * sizeof (sunindextype));
+    matrixStructChange = true;
+  }
+
+  // NNZ has to be actualized anyway
+  SM_NNZ_S(JJ) = smj.nbElem();
+
+  for (unsigned i = 0, iEnd = size + 1; i < iEnd; ++i) {
+    SM_INDEXPTRS_S(JJ)[i] = smj.Ap_[i];  //!!! implicit conversion from unsigned to sunindextype
+  }
+  for (unsigned i = 0, iEnd = smj.nbElem(); i < iEnd; ++i) {
+    SM_INDEXVALS_S(JJ)[i] = smj.Ai_[i];  //!!! implicit conversion from unsigned to sunindextype
+  }
+  SM_DATA_S(JJ) = smj.Ax_.data();
 
-  if (matrixStructChange) {
-    SUNLinSol_KLUReInit(LS, JJ, SM_NNZ_S(JJ), 2);  // reinit symbolic factorisation
-    if (*lastRowVals != NULL) {
-      free(*lastRowVals);
+  if (lastRowVals != NULL) {
+    if (memcmp(lastRowVals, SM_INDEXVALS_S(JJ), sizeof (sunindextype)*SM_NNZ_S(JJ)) != 0) {
+      matrixStructChange = true;
     }
-    *lastRowVals = reinterpret_cast<sunindextype*> (malloc(sizeof (sunindextype)*SM_NNZ_S(JJ)));
-    memcpy(*lastRowVals, SM_INDEXVALS_S(JJ), sizeof (sunindextype)*SM_NNZ_S(JJ));
-    if (log)
-      Trace::debug() << DYNLog(MatrixStructureChange) << Trace::endline;
+  } else {  // first time or size change
+    matrixStructChange = true;
   }
+
+  return matrixStructChange;
+}
+
+void
+SolverCommon::shareSparseValuesWithKINSOL(SparseMatrix& smj, SUNMatrix& JJ, const int& size, const sunindextype* lastRowVals) {
+  assert(SM_NNZ_S(JJ) == smj.nbElem());
+  // SUNDIALS zeroes the whole matrix, structure included, before asking for a new Jacobian: the structure still has to be restored
+  for (unsigned i = 0, iEnd = size + 1; i < iEnd; ++i) {
+    SM_INDEXPTRS_S(JJ)[i] = smj.Ap_[i];
+  }
+  memcpy(SM_INDEXVALS_S(JJ), lastRowVals, sizeof (sunindextype)*SM_NNZ_S(JJ));
+  // the values array of the sparse matrix may have been reallocated while it was filled
+  SM_DATA_S(JJ) = smj.Ax_.data();
+}
+
+void
+SolverCommon::detachSparseValues(SUNMatrix& JJ, const bool owned) {
+  if (owned)
+    free(SM_DATA_S(JJ));
+  SM_DATA_S(JJ) = NULL;
+  // the indexes are reallocated when the first matrix is shared
+  SM_NNZ_S(JJ) = 0;
+}
+
+std::size_t
+SolverCommon::getSharedSparseMemoryUsage(const SUNMatrix& JJ, const sunindextype* lastRowVals) {
+  if (JJ == NULL)
+    return 0;
+  std::size_t memoryUsage = (SM_NP_S(JJ) + 1 + SM_NNZ_S(JJ)) * sizeof(sunindextype);
+  if (lastRowVals != NULL)
+    memoryUsage += (SM_NNZ_S(JJ) + SM_NP_S(JJ) + 1) * sizeof(sunindextype);
+  return memoryUsage;
+}
+
+void SolverCommon::propagateMatrixStructureChangeToKINSOL(SparseMatrix& smj, SUNMatrix& JJ, const int& size, sunindextype** lastRowVals,
+                                                          uint64_t& lastStructureVersion, uint64_t& lastStructureHash, SUNLinearSolver& LS,
+                                                          bool log, SymbolicAnalysisCache* symbolicAnalysisCache) {
+  // the matrix compared its structure with the previous one while it was filled
+  const uint64_t structureVersion = smj.structureVersion();
+  if (*lastRowVals != NULL && structureVersion == lastStructureVersion && SM_NNZ_S(JJ) == smj.nbElem()) {
+    shareSparseValuesWithKINSOL(smj, JJ, size, *lastRowVals);
+    return;
+  }
+  const uint64_t previousStructureHash = lastStructureHash;
+  const sunindextype previousNnz = SM_NNZ_S(JJ);
+  lastStructureVersion = structureVersion;
+  // only needed to find the symbolic analysis in the cache, which compares the structure exactly
+  lastStructureHash = symbolicAnalysisCache != NULL ? smj.structureHash() : 0;
+
+  shareSparseWithKINSOL(smj, JJ, size, *lastRowVals);
+
+  bool symbolicAnalysisReused = false;
+  if (symbolicAnalysisCache != NULL) {
+    symbolicAnalysisCache->store(LS, previousStructureHash, size, previousNnz, *lastRowVals,
+                                 *lastRowVals != NULL ? *lastRowVals + previousNnz : NULL);
+    symbolicAnalysisReused = symbolicAnalysisCache->restore(LS, JJ, lastStructureHash);
+  }
+  if (!symbolicAnalysisReused)
+    LinearSolver::reinitSymbolicFactorization(LS, JJ);
+  if (*lastRowVals != NULL) {
+    free(*lastRowVals);
+  }
+  // the row indexes are saved followed by the column pointers, which describe the structure left to the symbolic analyses cache
+  *lastRowVals = reinterpret_cast<sunindextype*> (malloc(sizeof (sunindextype)*(SM_NNZ_S(JJ) + size + 1)));
+  memcpy(*lastRowVals, SM_INDEXVALS_S(JJ), sizeof (sunindextype)*SM_NNZ_S(JJ));
+  memcpy(*lastRowVals + SM_NNZ_S(JJ), SM_INDEXPTRS_S(JJ), sizeof (sunindextype)*(size + 1));
+  if (log && symbolicAnalysisReused)
+    Trace::debug() << DYNLog(SymbolicAnalysisReused) << Trace::endline;
+  else if (log)
+    Trace::debug() << DYNLog(MatrixStructureChange) << Trace::endline;
 }
 
 void
@@ -104,46 +200,22 @@ SolverCommon::printLargestErrors(std::vector<std::pair<double, size_t> >& fErr,
 
 double SolverCommon::weightedInfinityNorm(const std::vector<double>& vec, const std::vector<double>& weights) {
   assert(vec.size() == weights.size() && "Vectors must have same length.");
-  double norm = 0.;
-  double product = 0.;
-  for (unsigned int i = 0; i < vec.size(); ++i) {
-    product = std::fabs(vec[i] * weights[i]);
-    if (product > norm) {
-      norm = product;
-    }
-  }
-  return norm;
+  return VectorKernels::maxAbsProduct(vec.data(), weights.data(), vec.size());
 }
 
 double SolverCommon::weightedL2Norm(const std::vector<double>& vec, const std::vector<double>& weights) {
   assert(vec.size() == weights.size() && "Vectors must have same length.");
-  double squared_norm = 0.;
-  for (unsigned int i = 0; i < vec.size(); ++i) {
-    squared_norm += (vec[i] * weights[i]) * (vec[i] * weights[i]);
-  }
-  return std::sqrt(squared_norm);
+  return std::sqrt(VectorKernels::sumSquaredProducts(vec.data(), weights.data(), vec.size()));
 }
 
 double SolverCommon::weightedInfinityNorm(const std::vector<double>& vec, const std::vector<int>& vec_index, const std::vector<double>& weights) {
   assert(vec_index.size() == weights.size() && "Weights and indices must have same length.");
-  double norm = 0.;
-  double product = 0.;
-  for (unsigned int i = 0; i < vec_index.size(); ++i) {
-    product = std::fabs(vec[vec_index[i]] * weights[i]);
-    if (product > norm) {
-      norm = product;
-    }
-  }
-  return norm;
+  return VectorKernels::maxAbsProduct(vec.data(), vec_index.data(), weights.data(), vec_index.size());
 }
 
 double SolverCommon::weightedL2Norm(const std::vector<double>& vec, const std::vector<int>& vec_index, const std::vector<double>& weights) {
   assert(vec_index.size() == weights.size() && "Weights and indices must have same length.");
-  double squared_norm = 0.;
-  for (unsigned int i = 0; i < vec_index.size(); ++i) {
-    squared_norm += (vec[vec_index[i]] * weights[i]) * (vec[vec_index[i]] * weights[i]);
-  }
-  return std::sqrt(squared_norm);
+  return std::sqrt(VectorKernels::sumSquaredProducts(vec.data(), vec_index.data(), weights.data(), vec_index.size()));
 }
 
 }  // namespace DYN
@@ -24,9 +24,12 @@
 #include <sunmatrix/sunmatrix_band.h>
 #include <sunmatrix/sunmatrix_sparse.h>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 
 namespace DYN {
 class SparseMatrix;
+class SymbolicAnalysisCache;
 class Model;
 
 /**
@@ -47,18 +50,78 @@ class SolverCommon {
   static bool copySparseToKINSOL(const SparseMatrix& smj, SUNMatrix& JJ, const int& size, sunindextype * lastRowVals);
 
   /**
+   * @brief Share one sparse matrix with the KINSOL structure
    *
-   * @brief propagate the matrix structure change to KINSOL structure
+   * The indexes are copied in the KINSOL structure whereas the values are not: the KINSOL structure points directly
+   * to the values of the sparse matrix, which must hence outlive their use by the linear solver.
+   * The KINSOL structure must have been prepared with detachSparseValues.
    *
-   * @param smj Sparse matrix to copy to the KINSOL structure
-   * @param JJ KINSOL structure where to copy the matrix
+   * @param smj Sparse matrix to share with the KINSOL structure
+   * @param JJ KINSOL structure sharing the values of the matrix
    * @param size size of the square matrix (nb columns)
    * @param lastRowVals pointer to the latest value of the previous matrix
+   *
+   * @return @b true if the matrix structure has changed, @b false else
+   */
+  static bool shareSparseWithKINSOL(SparseMatrix& smj, SUNMatrix& JJ, const int& size, const sunindextype* lastRowVals);
+
+  /**
+   * @brief Share one sparse matrix whose structure is the same as the previous one with the KINSOL structure
+   *
+   * The row indexes are restored from the ones saved at the last structure change, without comparing them again.
+   *
+   * @param smj Sparse matrix to share with the KINSOL structure
+   * @param JJ KINSOL structure sharing the values of the matrix
+   * @param size size of the square matrix (nb columns)
+   * @param lastRowVals row indexes of the previous matrix
+   */
+  static void shareSparseValuesWithKINSOL(SparseMatrix& smj, SUNMatrix& JJ, const int& size, const sunindextype* lastRowVals);
+
+  /**
+   * @brief Release the values array of a KINSOL structure so that it can share the values of a sparse matrix
+   *
+   * Must be called right after the creation of the KINSOL structure, to free the values allocated by SUNDIALS,
+   * and right before its destruction, to prevent SUNDIALS from freeing values it does not own.
+   *
+   * @param JJ KINSOL structure
+   * @param owned @b true if the values array was allocated by SUNDIALS and must be freed
+   */
+  static void detachSparseValues(SUNMatrix& JJ, bool owned);
+
+  /**
+   * @brief get the memory allocated by a KINSOL structure sharing the values of a sparse matrix
+   *
+   * The shared values are accounted with the sparse matrix: only the structure arrays are accounted.
+   *
+   * @param JJ KINSOL structure, NULL if not created yet
+   * @param lastRowVals saved structure of the previous matrix, NULL if none
+   *
+   * @return number of bytes allocated for the structure of the KINSOL structure and its saved copy
+   */
+  static std::size_t getSharedSparseMemoryUsage(const SUNMatrix& JJ, const sunindextype* lastRowVals);
+
+  /**
+   *
+   * @brief propagate the matrix structure change to KINSOL structure
+   *
+   * The values of the matrix are shared with the KINSOL structure (see shareSparseWithKINSOL).
+   * When the structure version of the matrix is the one of the previous matrix, only the values are shared.
+   * When the structure changes, the symbolic analysis of the previous structure is saved in the cache and the one of the new
+   * structure is taken from the cache if it is known.
+   *
+   * @param smj Sparse matrix to share with the KINSOL structure
+   * @param JJ KINSOL structure sharing the values of the matrix
+   * @param size size of the square matrix (nb columns)
+   * @param lastRowVals saved row indexes of the previous matrix followed by its column pointers
+   * @param lastStructureVersion structure version of the previous matrix (see SparseMatrix::structureVersion)
+   * @param lastStructureHash structure hash of the previous matrix, computed only when a cache is used
    * @param LS linear solver pointer
    * @param log @b true if a log should be added if a complete re-initialization is done
+   * @param symbolicAnalysisCache cache of symbolic analyses, NULL if no cache is used
    */
-  static void propagateMatrixStructureChangeToKINSOL(const SparseMatrix& smj, SUNMatrix& JJ, const int& size,
-                                                     sunindextype** lastRowVals, SUNLinearSolver& LS, bool log);
+  static void propagateMatrixStructureChangeToKINSOL(SparseMatrix& smj, SUNMatrix& JJ, const int& size,
+                                                     sunindextype** lastRowVals, uint64_t& lastStructureVersion, uint64_t& lastStructureHash,
+                                                     SUNLinearSolver& LS, bool log, SymbolicAnalysisCache* symbolicAnalysisCache);
 
   /**
    * @brief Print the largest residuals errors
@@ -64,6 +64,15 @@ void SolverFactories::add(const std::string& lib, const boost::function<deleteSo
   factoryMapDelete_.insert(std::make_pair(lib, deleteFactory));
 }
 
+std::vector<std::string>
+SolverFactories::getLibs() const {
+  std::vector<std::string> libs;
+  libs.reserve(factoryMap_.size());
+  for (const auto& factory : factoryMap_)
+    libs.push_back(factory.first);
+  return libs;
+}
+
 SolverFactory::~SolverFactory() {}
 
 SolverFactory::SolverPtr
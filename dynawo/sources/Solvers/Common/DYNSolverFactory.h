@@ -22,6 +22,8 @@
 
 #include <map>
 #include <memory>
+#include <string>
+#include <vector>
 #include <boost/core/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/dll.hpp>
@@ -145,6 +147,13 @@ class SolverFactories : private boost::noncopyable {
    */
   void add(const std::string& lib, const boost::function<deleteSolverFactory_t>& deleteFactory);
 
+  /**
+   * @brief Get the names of the libraries loaded
+   *
+   * @return names of the libraries whose factory is available
+   */
+  std::vector<std::string> getLibs() const;
+
  private:
   std::map<std::string, SolverFactory* > factoryMap_;  ///< associate a library factory with the name of the library
   std::map<std::string, boost::function<deleteSolverFactory_t> > factoryMapDelete_;  ///< associate a library factory with its destruction method
@@ -17,6 +17,7 @@
  * @brief Dynawo solvers : implementation file
  *
  */
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
 #include <nvector/nvector_serial.h>
@@ -26,7 +27,9 @@
 #include "DYNMacrosMessage.h"
 #include "DYNMessage.h"
 #include "DYNModel.h"
+#include "DYNParallelVector.h"
 #include "DYNTimer.h"
+#include "DYNProfiler.h"
 #include "DYNTrace.h"
 
 #include "PARParametersSet.h"
@@ -91,6 +94,17 @@ printUnstableRoot_(false),
 printReinitResiduals_(false),
 printResiduals_(false),
 multipleStrategiesForAlgebraicRestoration_(false),
+nbThreads_(1),
+parallelVectorOperations_(false),
+incrementalRootEvaluation_(false),
+incrementalResidualEvaluation_(false),
+eventDrivenDiscreteEvaluation_(false),
+batchEvaluation_(false),
+aliasElimination_(false),
+timeEventScheduling_(false),
+localAlgebraicRestoration_(false),
+linearSolverType_(LinearSolver::KLU),
+symbolicAnalysisCache_(new SymbolicAnalysisCache()),
 tSolve_(0.),
 startFromDump_(false) {
   if (SUNContext_Create(NULL, &sundialsContext_) != 0)
@@ -99,17 +113,24 @@ startFromDump_(false) {
 
 Solver::Impl::~Impl() {
   clean();
+  if (!symbolicAnalysisCacheFile_.empty()) {
+    try {
+      symbolicAnalysisCache_->save(symbolicAnalysisCacheFile_);
+    } catch (...) {
+      // the cache is only an optimization of the next runs: its loss must not interrupt the destruction
+    }
+  }
   SUNContext_Free(&sundialsContext_);
 }
 
 void
 Solver::Impl::clean() {
   if (sundialsVectorY_ != NULL) {
-    N_VDestroy_Serial(sundialsVectorY_);
+    N_VDestroy(sundialsVectorY_);
     sundialsVectorY_ = NULL;
   }
   if (sundialsVectorYp_ != NULL) {
-    N_VDestroy_Serial(sundialsVectorYp_);
+    N_VDestroy(sundialsVectorYp_);
     sundialsVectorYp_ = NULL;
   }
 }
@@ -117,6 +138,12 @@ Solver::Impl::clean() {
 void
 Solver::Impl::init(const double t0, const std::shared_ptr<Model>& model) {
   model_ = model;
+  model_->setNbThreads(static_cast<unsigned>(nbThreads_));
+  model_->setIncrementalRootEvaluation(incrementalRootEvaluation_);
+  model_->setIncrementalResidualEvaluation(incrementalResidualEvaluation_);
+  model_->setEventDrivenDiscreteEvaluation(eventDrivenDiscreteEvaluation_);
+  model_->setBatchEvaluation(batchEvaluation_);
+  model_->setAliasElimination(aliasElimination_);
 
   // Problem size
   // ---------------------------
@@ -126,27 +153,24 @@ Solver::Impl::init(const double t0, const std::shared_ptr<Model>& model) {
     throw DYNError(Error::SUNDIALS_ERROR, SolverYvsF, nbEq, model->sizeF());
 
   vectorY_.resize(nbEq);
-  sundialsVectorY_ = N_VMake_Serial(nbEq, &(vectorY_[0]), sundialsContext_);
+  sundialsVectorY_ = ParallelVector::make(nbEq, &(vectorY_[0]), getVectorThreadPool(), sundialsContext_);
   if (sundialsVectorY_ == NULL)
     throw DYNError(Error::SUNDIALS_ERROR, SolverCreateYY);
 
   // Derivatives
   vectorYp_.assign(nbEq, 0.);
-  sundialsVectorYp_ = N_VMake_Serial(nbEq, &(vectorYp_[0]), sundialsContext_);
+  sundialsVectorYp_ = ParallelVector::make(nbEq, &(vectorYp_[0]), getVectorThreadPool(), sundialsContext_);
   if (sundialsVectorYp_ == NULL)
     throw DYNError(Error::SUNDIALS_ERROR, SolverCreateYP);
 
   // Initial values
   // -----------------
   model_->getY0(t0, vectorY_, vectorYp_);
+}
 
-  if (printResiduals_ || printReinitResiduals_) {
-    model_->setFequationsModel();  ///< set formula for modelica models' equations and Network models' equations
-  }
-
-  if (printUnstableRoot_) {
-    model_->setGequationsModel();  ///< set formula for modelica models' equations and Network models' discrete equations
-  }
+ThreadPool*
+Solver::Impl::getVectorThreadPool() const {
+  return parallelVectorOperations_ ? model_->getThreadPool() : nullptr;
 }
 
 void
@@ -231,10 +255,14 @@ Solver::Impl::resetStats() {
   stats_.nge_ = 0;
   stats_.nze_ = 0;
   stats_.nme_ = 0;
+  stats_.nrb_ = 0;
+  stats_.nrc_ = 0;
+  stats_.nrbMax_ = 0;
 }
 
 void
 Solver::Impl::solve(const double tAim, double& tNxt) {
+  ProfilerScope profilerScope(Profiler::SOLVER_STEP);
   // Solving
   state_.reset();
   model_->reinitMode();
@@ -252,11 +280,24 @@ Solver::Impl::evalZMode(vector<state_g>& G0, vector<state_g>& G1, const double t
 #endif
   bool change = false;
 
+  // all the roots changed during the time step are propagated together by a single discrete fixed point
+  long int nbRootChanges = 0;
+  for (size_t i = 0; i < G0.size(); ++i) {
+    if (G0[i] != G1[i])
+      ++nbRootChanges;
+  }
+  if (nbRootChanges > 0) {
+    ++stats_.nrb_;
+    stats_.nrc_ += nbRootChanges;
+    stats_.nrbMax_ = std::max(stats_.nrbMax_, nbRootChanges);
+  }
+
   // evalZ part
   bool nonSilentZChange;
   int i = 0;
   do {
     nonSilentZChange = false;
+    model_->notifyRootsChange(G0, G1);
     model_->evalZ(time);
     ++stats_.nze_;
 
@@ -371,6 +412,17 @@ Solver::Impl::defineCommonParameters() {
   parameters_.insert(make_pair("printReinitResiduals", ParameterSolver("printReinitResiduals", VAR_TYPE_BOOL, optional)));
   parameters_.insert(make_pair("multipleStrategiesForAlgebraicRestoration",
       ParameterSolver("multipleStrategiesForAlgebraicRestoration", VAR_TYPE_BOOL, optional)));
+  parameters_.insert(make_pair("nbThreads", ParameterSolver("nbThreads", VAR_TYPE_INT, optional)));
+  parameters_.insert(make_pair("parallelVectorOperations", ParameterSolver("parallelVectorOperations", VAR_TYPE_BOOL, optional)));
+  parameters_.insert(make_pair("incrementalRootEvaluation", ParameterSolver("incrementalRootEvaluation", VAR_TYPE_BOOL, optional)));
+  parameters_.insert(make_pair("incrementalResidualEvaluation", ParameterSolver("incrementalResidualEvaluation", VAR_TYPE_BOOL, optional)));
+  parameters_.insert(make_pair("eventDrivenDiscreteEvaluation", ParameterSolver("eventDrivenDiscreteEvaluation", VAR_TYPE_BOOL, optional)));
+  parameters_.insert(make_pair("batchEvaluation", ParameterSolver("batchEvaluation", VAR_TYPE_BOOL, optional)));
+  parameters_.insert(make_pair("aliasElimination", ParameterSolver("aliasElimination", VAR_TYPE_BOOL, optional)));
+  parameters_.insert(make_pair("timeEventScheduling", ParameterSolver("timeEventScheduling", VAR_TYPE_BOOL, optional)));
+  parameters_.insert(make_pair("localAlgebraicRestoration", ParameterSolver("localAlgebraicRestoration", VAR_TYPE_BOOL, optional)));
+  parameters_.insert(make_pair("linearSolverName", ParameterSolver("linearSolverName", VAR_TYPE_STRING, optional)));
+  parameters_.insert(make_pair("symbolicAnalysisCacheFile", ParameterSolver("symbolicAnalysisCacheFile", VAR_TYPE_STRING, optional)));
 }
 
 bool
@@ -549,6 +601,42 @@ void Solver::Impl::setSolverCommonParameters() {
   const ParameterSolver& multipleStrategiesForAlgebraicRestoration = findParameter("multipleStrategiesForAlgebraicRestoration");
   if (multipleStrategiesForAlgebraicRestoration.hasValue())
     multipleStrategiesForAlgebraicRestoration_ = multipleStrategiesForAlgebraicRestoration.getValue<bool>();
+  const ParameterSolver& nbThreads = findParameter("nbThreads");
+  if (nbThreads.hasValue())
+    nbThreads_ = std::max(nbThreads.getValue<int>(), 1);
+  const ParameterSolver& parallelVectorOperations = findParameter("parallelVectorOperations");
+  if (parallelVectorOperations.hasValue())
+    parallelVectorOperations_ = parallelVectorOperations.getValue<bool>();
+  const ParameterSolver& incrementalRootEvaluation = findParameter("incrementalRootEvaluation");
+  if (incrementalRootEvaluation.hasValue())
+    incrementalRootEvaluation_ = incrementalRootEvaluation.getValue<bool>();
+  const ParameterSolver& incrementalResidualEvaluation = findParameter("incrementalResidualEvaluation");
+  if (incrementalResidualEvaluation.hasValue())
+    incrementalResidualEvaluation_ = incrementalResidualEvaluation.getValue<bool>();
+  const ParameterSolver& eventDrivenDiscreteEvaluation = findParameter("eventDrivenDiscreteEvaluation");
+  if (eventDrivenDiscreteEvaluation.hasValue())
+    eventDrivenDiscreteEvaluation_ = eventDrivenDiscreteEvaluation.getValue<bool>();
+  const ParameterSolver& batchEvaluation = findParameter("batchEvaluation");
+  if (batchEvaluation.hasValue())
+    batchEvaluation_ = batchEvaluation.getValue<bool>();
+  const ParameterSolver& aliasElimination = findParameter("aliasElimination");
+  if (aliasElimination.hasValue())
+    aliasElimination_ = aliasElimination.getValue<bool>();
+  const ParameterSolver& timeEventScheduling = findParameter("timeEventScheduling");
+  if (timeEventScheduling.hasValue())
+    timeEventScheduling_ = timeEventScheduling.getValue<bool>();
+  const ParameterSolver& localAlgebraicRestoration = findParameter("localAlgebraicRestoration");
+  if (localAlgebraicRestoration.hasValue())
+    localAlgebraicRestoration_ = localAlgebraicRestoration.getValue<bool>();
+
+  const ParameterSolver& linearSolverName = findParameter("linearSolverName");
+  if (linearSolverName.hasValue())
+    linearSolverType_ = LinearSolver::fromString(linearSolverName.getValue<string>());
+  const ParameterSolver& symbolicAnalysisCacheFile = findParameter("symbolicAnalysisCacheFile");
+  if (symbolicAnalysisCacheFile.hasValue() && symbolicAnalysisCacheFile.getValue<string>() != symbolicAnalysisCacheFile_) {
+    symbolicAnalysisCacheFile_ = symbolicAnalysisCacheFile.getValue<string>();
+    symbolicAnalysisCache_->load(symbolicAnalysisCacheFile_);
+  }
 }
 
 void
@@ -571,6 +659,56 @@ Solver::Impl::setTimeline(const boost::shared_ptr<Timeline>& timeline) {
   timeline_ = timeline;
 }
 
+void
+Solver::Impl::snapshotState(StateBuffer& state) const {
+  state.write(tSolve_);
+  state.write(vectorY_);
+  state.write(vectorYp_);
+  state.write(g0_);
+  state.write(g1_);
+  state.write(state_);
+  state.write(stats_);
+}
+
+void
+Solver::Impl::restoreState(StateBuffer::Reader& state) {
+  // the sundials vectors share the memory of vectorY_ and vectorYp_
+  state.read(tSolve_);
+  state.read(vectorY_);
+  state.read(vectorYp_);
+  state.read(g0_);
+  state.read(g1_);
+  state.read(state_);
+  state.read(stats_);
+}
+
+void
+Solver::Impl::setContinuousVariables(const std::vector<double>& y, const std::vector<double>& yp) {
+  if (y.size() != vectorY_.size())
+    throw DYNError(Error::GENERAL, StateSnapshotMismatch, vectorY_.size(), y.size());
+  if (yp.size() != vectorYp_.size())
+    throw DYNError(Error::GENERAL, StateSnapshotMismatch, vectorYp_.size(), yp.size());
+  // the sundials vectors share the memory of vectorY_ and vectorYp_
+  std::copy(y.begin(), y.end(), vectorY_.begin());
+  std::copy(yp.begin(), yp.end(), vectorYp_.begin());
+  model_->copyContinuousVariables(vectorY_.data(), vectorYp_.data());
+
+  // restoring the solver from its own snapshot restarts the integration from the new values, as for any restored state
+  StateBuffer state;
+  snapshotState(state);
+  StateBuffer::Reader reader(state);
+  restoreState(reader);
+}
+
+void
+Solver::Impl::getStatistics(stat_t& statistics) const {
+  statistics = stats_;
+}
+
+void
+Solver::Impl::accountMemory(MemoryUsage& /*usage*/) const {
+}
+
 void
 Solver::Impl::printEnd() const {
   // (1) Print on the standard output
@@ -579,15 +717,18 @@ Solver::Impl::printEnd() const {
   Trace::info() << DYNLog(SolverExecutionStats) << Trace::endline;
   Trace::info() << Trace::endline;
 
-  Trace::info() << DYNLog(SolverNbIter, stats_.nst_) << Trace::endline;
-  Trace::info() << DYNLog(SolverNbResEval, stats_.nre_) << Trace::endline;
-  Trace::info() << DYNLog(SolverNbJacEval, stats_.nje_) << Trace::endline;
-  Trace::info() << DYNLog(SolverNbNonLinIter, stats_.nni_) << Trace::endline;
-  Trace::info() << DYNLog(SolverNbErrorTestFail, stats_.netf_) << Trace::endline;
-  Trace::info() << DYNLog(SolverNbNonLinConvFail, stats_.ncfn_) << Trace::endline;
-  Trace::info() << DYNLog(SolverNbRootFuncEval, stats_.nge_) << Trace::endline;
-  Trace::info() << DYNLog(SolverNbDiscreteVarsEval, stats_.nze_) << Trace::endline;
-  Trace::info() << DYNLog(SolverNbModeEval, stats_.nme_) << Trace::endline;
+  stat_t stats;
+  getStatistics(stats);
+  Trace::info() << DYNLog(SolverNbIter, stats.nst_) << Trace::endline;
+  Trace::info() << DYNLog(SolverNbResEval, stats.nre_) << Trace::endline;
+  Trace::info() << DYNLog(SolverNbJacEval, stats.nje_) << Trace::endline;
+  Trace::info() << DYNLog(SolverNbNonLinIter, stats.nni_) << Trace::endline;
+  Trace::info() << DYNLog(SolverNbErrorTestFail, stats.netf_) << Trace::endline;
+  Trace::info() << DYNLog(SolverNbNonLinConvFail, stats.ncfn_) << Trace::endline;
+  Trace::info() << DYNLog(SolverNbRootFuncEval, stats.nge_) << Trace::endline;
+  Trace::info() << DYNLog(SolverNbDiscreteVarsEval, stats.nze_) << Trace::endline;
+  Trace::info() << DYNLog(SolverNbModeEval, stats.nme_) << Trace::endline;
+  Trace::info() << DYNLog(SolverNbRootBatches, stats.nrb_, stats.nrc_, stats.nrbMax_) << Trace::endline;
 }
 
 }  // end namespace DYN
@@ -23,11 +23,15 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <memory>
 #include <boost/core/noncopyable.hpp>
 #include <sundials/sundials_nvector.h>
 
 #include "DYNSolver.h"
 #include "DYNEnumUtils.h"
+#include "DYNLinearSolver.h"
+#include "DYNSymbolicAnalysisCache.h"
+#include "DYNConvergenceDiagnostics.h"
 #include "DYNParameterSolver.h"
 
 namespace parameters {
@@ -40,26 +44,11 @@ class Timeline;
 
 namespace DYN {
 
-
-/**
- * @brief Structure for storing solver statistics
- */
-typedef struct {
-  long int nst_;  ///< number of steps
-  long int nre_;  ///< number of residual evaluations
-  long int nni_;  ///< number of nonlinear iterations
-  long int nje_;  ///< number of Jacobian evaluations
-  long int netf_;  ///< number of error test failures
-  long int ncfn_;  ///< number of nonlinear convergence failures
-  long int nge_;  ///< number of root function evaluations
-  long int nze_;  ///< number of discrete variable evaluations
-  long int nme_;  ///< number of mode evaluations
-} stat_t;
-
 class Message;
 class MessageTimeline;
 class Model;
 class ParameterSolver;
+class ThreadPool;
 
 /**
  * @class Solver::Impl
@@ -204,6 +193,25 @@ class Solver::Impl : public Solver, private boost::noncopyable {
    */
   void printEnd() const override;
 
+  /**
+   * @copydoc Solver::getStatistics(stat_t& statistics) const
+   */
+  void getStatistics(stat_t& statistics) const override;
+
+  /**
+   * @copydoc Solver::accountMemory(MemoryUsage& usage) const
+   *
+   * Nothing is accounted by default: the solvers owning a Jacobian and a linear solver override it.
+   */
+  void accountMemory(MemoryUsage& usage) const override;
+
+  /**
+   * @copydoc Solver::getConvergenceDiagnostics()
+   */
+  ConvergenceDiagnostics& getConvergenceDiagnostics() override {
+    return convergenceDiagnostics_;
+  }
+
   /**
    * @copydoc Solver::printParameterValues()
    */
@@ -235,6 +243,21 @@ class Solver::Impl : public Solver, private boost::noncopyable {
    */
   void setTimeline(const boost::shared_ptr<timeline::Timeline>& timeline) override;
 
+  /**
+   * @copydoc Solver::snapshotState(StateBuffer& state) const
+   */
+  void snapshotState(StateBuffer& state) const override;
+
+  /**
+   * @copydoc Solver::restoreState(StateBuffer::Reader& state)
+   */
+  void restoreState(StateBuffer::Reader& state) override;
+
+  /**
+   * @copydoc Solver::setContinuousVariables(const std::vector<double>& y, const std::vector<double>& yp)
+   */
+  void setContinuousVariables(const std::vector<double>& y, const std::vector<double>& yp) override;
+
  protected:
   /**
    * @brief set a given parameter value
@@ -316,6 +339,13 @@ class Solver::Impl : public Solver, private boost::noncopyable {
     return startFromDump_;
   }
 
+  /**
+  * @copydoc Solver::setDegradedMode(bool degraded)
+  */
+  bool setDegradedMode(bool /*degraded*/) override {
+    return false;
+  }
+
   /**
   * @brief printResiduals getter
   *
@@ -334,6 +364,13 @@ class Solver::Impl : public Solver, private boost::noncopyable {
    */
   virtual void solveStep(double tAim, double& tNxt) = 0;
 
+  /**
+   * @brief get the pool of threads running the operations on the sundials vectors
+   *
+   * @return the pool of threads of the model if the parallel vector operations are enabled, nullptr otherwise
+   */
+  ThreadPool* getVectorThreadPool() const;
+
   /**
    * @copydoc Solver::setupNewAlgRestoration(modeChangeType_t modeChangeType)
    */
@@ -391,8 +428,21 @@ class Solver::Impl : public Solver, private boost::noncopyable {
   bool printReinitResiduals_;  ///< print reinit residuals in logs
   bool printResiduals_;  ///< print residuals during newton resolution
   bool multipleStrategiesForAlgebraicRestoration_;  ///< parameter to activate multi strategy for algebraic restoration
+  int nbThreads_;  ///< number of threads used to evaluate the residual functions of the model and by the multithreaded linear solvers
+  bool parallelVectorOperations_;  ///< run the operations on the sundials vectors with the threads evaluating the model
+  bool incrementalRootEvaluation_;  ///< only evaluate again the root functions of the sub models whose inputs changed
+  bool incrementalResidualEvaluation_;  ///< only evaluate again the residual functions of the sub models whose inputs changed
+  bool eventDrivenDiscreteEvaluation_;  ///< only evaluate the discrete variables and modes of the sub models concerned by an event
+  bool batchEvaluation_;  ///< evaluate the sub models sharing the same model by batches
+  bool aliasElimination_;  ///< only solve one of the continuous variables connected together, the other ones being aliases of it
+  bool timeEventScheduling_;  ///< stop the time integration exactly at the time events scheduled by the model
+  bool localAlgebraicRestoration_;  ///< only solve the algebraic equations coupled to the ones not satisfied after a mode change
+  LinearSolver::linearSolverType_t linearSolverType_;  ///< sparse direct linear solver used by the Newton iterations
+  std::shared_ptr<SymbolicAnalysisCache> symbolicAnalysisCache_;  ///< symbolic analyses of the Jacobian structures met, shared with the Newton solvers
+  std::string symbolicAnalysisCacheFile_;  ///< file where the symbolic analyses are loaded from and saved, empty if none
 
   stat_t stats_;  ///< execution statistics of the solver
+  ConvergenceDiagnostics convergenceDiagnostics_;  ///< diagnostics of the last Newton iterations of the time scheme
   double tSolve_;  ///< current internal time of the solver
   BitMask state_;  ///< current state value of the solver
 
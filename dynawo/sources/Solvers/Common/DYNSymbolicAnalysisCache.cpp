@@ -0,0 +1,329 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNSymbolicAnalysisCache.cpp
+ *
+ * @brief Cache of the symbolic analyses of the sparse linear solver implementation
+ *
+ */
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <utility>
+#include <boost/filesystem.hpp>
+#include <sunmatrix/sunmatrix_sparse.h>
+#include <sunlinsol/sunlinsol_klu.h>
+
+#include "DYNSymbolicAnalysisCache.h"
+#include "DYNMacrosMessage.h"
+#include "DYNTrace.h"
+
+#if defined(SUNDIALS_INT64_T)
+#define sun_klu_malloc klu_l_malloc
+#else
+#define sun_klu_malloc klu_malloc
+#endif
+
+namespace fs = boost::filesystem;
+
+namespace {
+
+const char FILE_SIGNATURE[] = "DYNSYMB2";  ///< first bytes of a symbolic analyses file
+
+/**
+ * @brief write a value in a binary stream
+ * @param stream stream to write in
+ * @param value value to write
+ */
+template<typename T>
+void
+writeValue(std::ostream& stream, const T& value) {
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/**
+ * @brief read a value from a binary stream
+ * @param stream stream to read from
+ * @param value value read
+ */
+template<typename T>
+void
+readValue(std::istream& stream, T& value) {
+  stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+}
+
+/**
+ * @brief write a vector in a binary stream
+ * @param stream stream to write in
+ * @param values vector to write
+ */
+template<typename T>
+void
+writeVector(std::ostream& stream, const std::vector<T>& values) {
+  writeValue(stream, static_cast<uint64_t>(values.size()));
+  if (!values.empty())
+    stream.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+
+/**
+ * @brief read a vector from a binary stream
+ * @param stream stream to read from
+ * @param values vector read
+ * @param maxSize maximum size accepted for the vector, to avoid huge allocations with a corrupted file
+ */
+template<typename T>
+void
+readVector(std::istream& stream, std::vector<T>& values, const uint64_t maxSize) {
+  uint64_t size = 0;
+  readValue(stream, size);
+  if (!stream || size > maxSize) {
+    stream.setstate(std::ios::failbit);
+    return;
+  }
+  values.resize(static_cast<size_t>(size));
+  if (size > 0)
+    stream.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(size * sizeof(T)));
+}
+
+/**
+ * @brief get the KLU content of a linear solver
+ * @param LS linear solver
+ * @return the KLU content, NULL if the linear solver is not KLU
+ */
+SUNLinearSolverContent_KLU
+kluContent(SUNLinearSolver LS) {
+  if (LS == NULL || SUNLinSolGetID(LS) != SUNLINEARSOLVER_KLU)
+    return NULL;
+  return reinterpret_cast<SUNLinearSolverContent_KLU>(LS->content);
+}
+
+}  // namespace
+
+namespace DYN {
+
+void
+SymbolicAnalysisCache::store(SUNLinearSolver LS, const uint64_t structureHash, const sunindextype nbCols, const sunindextype nnz,
+    const sunindextype* rowVals, const sunindextype* colPtrs) {
+  SUNLinearSolverContent_KLU content = kluContent(LS);
+  // nothing to save if no analysis was performed since the last structure change
+  if (content == NULL || content->first_factorize != 0 || content->symbolic == NULL || rowVals == NULL || colPtrs == NULL)
+    return;
+  const sun_klu_symbolic& symbolic = *content->symbolic;
+  if (symbolic.n != nbCols || symbolic.nz != nnz)
+    return;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (analyses_.find(structureHash) != analyses_.end())
+      return;
+  }
+
+  // the analysis is built before being inserted, as the other solvers sharing the cache may read it as soon as it is
+  const size_t n = static_cast<size_t>(symbolic.n);
+  Analysis analysis;
+  analysis.nbCols_ = nbCols;
+  analysis.rowVals_.assign(rowVals, rowVals + nnz);
+  analysis.colPtrs_.assign(colPtrs, colPtrs + n + 1);
+  analysis.symmetry_ = symbolic.symmetry;
+  analysis.estFlops_ = symbolic.est_flops;
+  analysis.lnz_ = symbolic.lnz;
+  analysis.unz_ = symbolic.unz;
+  analysis.Lnz_.assign(symbolic.Lnz, symbolic.Lnz + n);
+  analysis.nz_ = symbolic.nz;
+  analysis.P_.assign(symbolic.P, symbolic.P + n);
+  analysis.Q_.assign(symbolic.Q, symbolic.Q + n);
+  analysis.R_.assign(symbolic.R, symbolic.R + n + 1);
+  analysis.nzoff_ = symbolic.nzoff;
+  analysis.nblocks_ = symbolic.nblocks;
+  analysis.maxblock_ = symbolic.maxblock;
+  analysis.ordering_ = symbolic.ordering;
+  analysis.doBtf_ = symbolic.do_btf;
+  analysis.structuralRank_ = symbolic.structural_rank;
+  std::lock_guard<std::mutex> lock(mutex_);
+  analyses_.emplace(structureHash, std::move(analysis));
+}
+
+bool
+SymbolicAnalysisCache::restore(SUNLinearSolver LS, SUNMatrix JJ, const uint64_t structureHash) const {
+  SUNLinearSolverContent_KLU content = kluContent(LS);
+  if (content == NULL)
+    return false;
+  const Analysis* analysisFound = nullptr;
+  {
+    // an analysis is never modified once inserted, and stays at the same address when the table grows
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = analyses_.find(structureHash);
+    if (it == analyses_.end())
+      return false;
+    analysisFound = &it->second;
+  }
+  const Analysis& analysis = *analysisFound;
+  // the same row indexes may be split differently between the columns: both arrays are compared
+  if (analysis.nbCols_ != SM_NP_S(JJ) || static_cast<sunindextype>(analysis.rowVals_.size()) != SM_NNZ_S(JJ)
+      || memcmp(analysis.rowVals_.data(), SM_INDEXVALS_S(JJ), sizeof(sunindextype) * analysis.rowVals_.size()) != 0
+      || memcmp(analysis.colPtrs_.data(), SM_INDEXPTRS_S(JJ), sizeof(sunindextype) * analysis.colPtrs_.size()) != 0)
+    return false;
+
+  sun_klu_common* common = &content->common;
+  const size_t n = static_cast<size_t>(analysis.nbCols_);
+  // allocated with the KLU allocator so that KLU can release it as one of its own analyses
+  sun_klu_symbolic* symbolic = reinterpret_cast<sun_klu_symbolic*>(sun_klu_malloc(1, sizeof(sun_klu_symbolic), common));
+  if (symbolic == NULL)
+    return false;
+  symbolic->n = analysis.nbCols_;
+  symbolic->Lnz = reinterpret_cast<double*>(sun_klu_malloc(n, sizeof(double), common));
+  symbolic->P = reinterpret_cast<decltype(symbolic->P)>(sun_klu_malloc(n, sizeof(sunindextype), common));
+  symbolic->Q = reinterpret_cast<decltype(symbolic->Q)>(sun_klu_malloc(n, sizeof(sunindextype), common));
+  symbolic->R = reinterpret_cast<decltype(symbolic->R)>(sun_klu_malloc(n + 1, sizeof(sunindextype), common));
+  if (symbolic->Lnz == NULL || symbolic->P == NULL || symbolic->Q == NULL || symbolic->R == NULL) {
+    sun_klu_free_symbolic(&symbolic, common);
+    return false;
+  }
+  symbolic->symmetry = analysis.symmetry_;
+  symbolic->est_flops = analysis.estFlops_;
+  symbolic->lnz = analysis.lnz_;
+  symbolic->unz = analysis.unz_;
+  std::copy(analysis.Lnz_.begin(), analysis.Lnz_.end(), symbolic->Lnz);
+  symbolic->nz = analysis.nz_;
+  std::copy(analysis.P_.begin(), analysis.P_.end(), symbolic->P);
+  std::copy(analysis.Q_.begin(), analysis.Q_.end(), symbolic->Q);
+  std::copy(analysis.R_.begin(), analysis.R_.end(), symbolic->R);
+  symbolic->nzoff = analysis.nzoff_;
+  symbolic->nblocks = analysis.nblocks_;
+  symbolic->maxblock = analysis.maxblock_;
+  symbolic->ordering = analysis.ordering_;
+  symbolic->do_btf = analysis.doBtf_;
+  symbolic->structural_rank = analysis.structuralRank_;
+
+  sun_klu_numeric* numeric = sun_klu_factor(SM_INDEXPTRS_S(JJ), SM_INDEXVALS_S(JJ), SM_DATA_S(JJ), symbolic, common);
+  if (numeric == NULL) {
+    sun_klu_free_symbolic(&symbolic, common);
+    return false;
+  }
+
+  // the next setup of the linear solver only refactorizes the matrix
+  if (content->symbolic != NULL)
+    sun_klu_free_symbolic(&content->symbolic, common);
+  if (content->numeric != NULL)
+    sun_klu_free_numeric(&content->numeric, common);
+  content->symbolic = symbolic;
+  content->numeric = numeric;
+  content->first_factorize = 0;
+  return true;
+}
+
+void
+SymbolicAnalysisCache::load(const std::string& filePath) {
+  std::ifstream file(filePath.c_str(), std::ios::binary);
+  if (!file.is_open())
+    return;
+
+  char signature[sizeof(FILE_SIGNATURE)] = {};
+  file.read(signature, sizeof(FILE_SIGNATURE));
+  uint32_t indexSize = 0;
+  readValue(file, indexSize);
+  uint64_t nbAnalyses = 0;
+  readValue(file, nbAnalyses);
+  if (!file || memcmp(signature, FILE_SIGNATURE, sizeof(FILE_SIGNATURE)) != 0 || indexSize != sizeof(sunindextype)) {
+    Trace::warn() << DYNLog(SymbolicAnalysisCacheReadError, filePath) << Trace::endline;
+    return;
+  }
+
+  std::unordered_map<uint64_t, Analysis> analyses;
+  for (uint64_t i = 0; i < nbAnalyses && file; ++i) {
+    uint64_t structureHash = 0;
+    readValue(file, structureHash);
+    Analysis analysis;
+    readValue(file, analysis.nbCols_);
+    const uint64_t n = static_cast<uint64_t>(std::max<sunindextype>(analysis.nbCols_, 0));
+    readVector(file, analysis.rowVals_, n * n);
+    readVector(file, analysis.colPtrs_, n + 1);
+    readValue(file, analysis.symmetry_);
+    readValue(file, analysis.estFlops_);
+    readValue(file, analysis.lnz_);
+    readValue(file, analysis.unz_);
+    readVector(file, analysis.Lnz_, n);
+    readValue(file, analysis.nz_);
+    readVector(file, analysis.P_, n);
+    readVector(file, analysis.Q_, n);
+    readVector(file, analysis.R_, n + 1);
+    readValue(file, analysis.nzoff_);
+    readValue(file, analysis.nblocks_);
+    readValue(file, analysis.maxblock_);
+    readValue(file, analysis.ordering_);
+    readValue(file, analysis.doBtf_);
+    readValue(file, analysis.structuralRank_);
+    if (analysis.colPtrs_.size() != n + 1 || analysis.Lnz_.size() != n || analysis.P_.size() != n || analysis.Q_.size() != n || analysis.R_.size() != n + 1)
+      file.setstate(std::ios::failbit);
+    if (file)
+      analyses[structureHash] = analysis;
+  }
+  if (!file) {
+    Trace::warn() << DYNLog(SymbolicAnalysisCacheReadError, filePath) << Trace::endline;
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    analyses_.insert(analyses.begin(), analyses.end());
+  }
+  Trace::debug() << DYNLog(SymbolicAnalysisCacheLoaded, analyses.size(), filePath) << Trace::endline;
+}
+
+void
+SymbolicAnalysisCache::save(const std::string& filePath) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  // written aside then renamed, so that the file read by the next runs is never partially written
+  const fs::path cacheFile(filePath);
+  const fs::path temporaryFile = cacheFile.parent_path() / fs::unique_path("%%%%-%%%%-%%%%-%%%%.tmp");
+  std::ofstream file(temporaryFile.string().c_str(), std::ios::binary | std::ios::trunc);
+  if (file.is_open()) {
+    file.write(FILE_SIGNATURE, sizeof(FILE_SIGNATURE));
+    writeValue(file, static_cast<uint32_t>(sizeof(sunindextype)));
+    writeValue(file, static_cast<uint64_t>(analyses_.size()));
+    for (const auto& analysisByHash : analyses_) {
+      const Analysis& analysis = analysisByHash.second;
+      writeValue(file, analysisByHash.first);
+      writeValue(file, analysis.nbCols_);
+      writeVector(file, analysis.rowVals_);
+      writeVector(file, analysis.colPtrs_);
+      writeValue(file, analysis.symmetry_);
+      writeValue(file, analysis.estFlops_);
+      writeValue(file, analysis.lnz_);
+      writeValue(file, analysis.unz_);
+      writeVector(file, analysis.Lnz_);
+      writeValue(file, analysis.nz_);
+      writeVector(file, analysis.P_);
+      writeVector(file, analysis.Q_);
+      writeVector(file, analysis.R_);
+      writeValue(file, analysis.nzoff_);
+      writeValue(file, analysis.nblocks_);
+      writeValue(file, analysis.maxblock_);
+      writeValue(file, analysis.ordering_);
+      writeValue(file, analysis.doBtf_);
+      writeValue(file, analysis.structuralRank_);
+    }
+  }
+  file.close();
+  boost::system::error_code error;
+  if (file)
+    fs::rename(temporaryFile, cacheFile, error);
+  if (!file || error) {
+    boost::system::error_code ignored;
+    fs::remove(temporaryFile, ignored);
+    Trace::warn() << DYNLog(SymbolicAnalysisCacheWriteError, filePath) << Trace::endline;
+    return;
+  }
+  Trace::debug() << DYNLog(SymbolicAnalysisCacheSaved, analyses_.size(), filePath) << Trace::endline;
+}
+
+}  // end namespace DYN
@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2026, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+// simulation tool for power systems.
+//
+
+/**
+ * @file  DYNSymbolicAnalysisCache.h
+ *
+ * @brief Cache of the symbolic analyses of the sparse linear solver, indexed by Jacobian structure
+ *
+ */
+#ifndef SOLVERS_COMMON_DYNSYMBOLICANALYSISCACHE_H_
+#define SOLVERS_COMMON_DYNSYMBOLICANALYSISCACHE_H_
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <boost/core/noncopyable.hpp>
+#include <sundials/sundials_linearsolver.h>
+#include <sundials/sundials_matrix.h>
+
+namespace DYN {
+
+/**
+ * @class SymbolicAnalysisCache
+ * @brief Cache of the symbolic analyses (fill-reducing ordering and block triangular form) computed by KLU
+ *
+ * The analyses are indexed by the structure hash of the Jacobian (see SparseMatrix::structureHash), the row indexes and
+ * column pointers being kept to discard hash collisions. When the Jacobian gets back to a known structure, the saved analysis is handed over to
+ * KLU which then only performs a numerical factorization. The cache can be saved in a file and loaded by a later run
+ * on the same network and models.
+ * Only KLU is supported: the other linear solvers are left untouched.
+ * The cache can be shared by solvers running in different threads.
+ */
+class SymbolicAnalysisCache : private boost::noncopyable {
+ public:
+  /**
+   * @brief save the symbolic analysis currently held by a linear solver, if it is not already known
+   *
+   * @param LS linear solver
+   * @param structureHash structure hash of the matrix analysed by the linear solver
+   * @param nbCols number of columns of the matrix
+   * @param nnz number of non zero terms of the matrix
+   * @param rowVals row indexes of the matrix
+   * @param colPtrs column pointers of the matrix
+   */
+  void store(SUNLinearSolver LS, uint64_t structureHash, sunindextype nbCols, sunindextype nnz, const sunindextype* rowVals,
+      const sunindextype* colPtrs);
+
+  /**
+   * @brief hand a saved symbolic analysis over to a linear solver and perform the numerical factorization of the matrix
+   *
+   * @param LS linear solver
+   * @param JJ matrix to factorize, with its values
+   * @param structureHash structure hash of the matrix
+   *
+   * @return @b true if a symbolic analysis was found for the exact structure of the matrix, @b false if a new one must be computed
+   */
+  bool restore(SUNLinearSolver LS, SUNMatrix JJ, uint64_t structureHash) const;
+
+  /**
+   * @brief add the symbolic analyses saved in a file to the cache
+   *
+   * A missing file is not an error. An unreadable file is ignored with a warning.
+   *
+   * @param filePath path of the file
+   */
+  void load(const std::string& filePath);
+
+  /**
+   * @brief save all the symbolic analyses of the cache in a file
+   *
+   * The analyses are written in a temporary file of the same directory, renamed once complete: a failed write leaves
+   * the previous file untouched and is only reported by a warning.
+   *
+   * @param filePath path of the file
+   */
+  void save(const std::string& filePath) const;
+
+  /**
+   * @brief get the number of symbolic analyses in the cache
+   *
+   * @return number of symbolic analyses
+   */
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return analyses_.size();
+  }
+
+ private:
+  /**
+   * @brief symbolic analysis of a matrix structure
+   */
+  struct Analysis {
+    sunindextype nbCols_;  ///< number of columns of the matrix
+    std::vector<sunindextype> rowVals_;  ///< row indexes of the matrix
+    std::vector<sunindextype> colPtrs_;  ///< column pointers of the matrix
+    double symmetry_;  ///< symmetry of largest block
+    double estFlops_;  ///< estimated factorization flop count
+    double lnz_;  ///< estimated non zero terms in L, including diagonals
+    double unz_;  ///< estimated non zero terms in U, including diagonals
+    std::vector<double> Lnz_;  ///< estimated number of non zero terms in L of each column
+    sunindextype nz_;  ///< number of non zero terms in the matrix
+    std::vector<sunindextype> P_;  ///< row permutation
+    std::vector<sunindextype> Q_;  ///< column permutation
+    std::vector<sunindextype> R_;  ///< block boundaries of the block triangular form
+    sunindextype nzoff_;  ///< number of non zero terms in the off-diagonal blocks
+    sunindextype nblocks_;  ///< number of blocks
+    sunindextype maxblock_;  ///< size of the largest block
+    sunindextype ordering_;  ///< ordering used
+    sunindextype doBtf_;  ///< whether a block triangular form was computed
+    sunindextype structuralRank_;  ///< structural rank of the matrix
+  };
+
+  std::unordered_map<uint64_t, Analysis> analyses_;  ///< symbolic analyses by structure hash
+  mutable std::mutex mutex_;  ///< mutex protecting the table of the analyses, shared by several solvers
+};
+
+}  // end namespace DYN
+
+#endif  // SOLVERS_COMMON_DYNSYMBOLICANALYSISCACHE_H_
@@ -17,17 +17,35 @@
  *
  */
 
+#include <algorithm>
+#include <cmath>
+#include <complex>
 #include <fstream>
+#include <sstream>
+#include <vector>
 
 #include <boost/filesystem.hpp>
 #include <sunmatrix/sunmatrix_sparse.h>
+#include <nvector/nvector_serial.h>
+#include <sunlinsol/sunlinsol_klu.h>
 
 #include "gtest_dynawo.h"
 #include "DYNParameterSolver.h"
 #include "DYNSparseMatrix.h"
 #include "DYNTrace.h"
 #include "DYNSolverCommon.h"
+#include "DYNLinearSolver.h"
+#include "DYNDomainDecompositionLinearSolver.h"
+#include "DYNMixedPrecisionLinearSolver.h"
+#include "DYNActiveSetLinearSolver.h"
+#include "DYNIslandsLinearSolver.h"
+#include "DYNPowerFlowSolver.h"
+#include "DYNSymbolicAnalysisCache.h"
+#include "DYNRestorationCache.h"
+#include "DYNConvergenceDiagnostics.h"
 #include "DYNFileSystemUtils.h"
+#include "DYNParallelVector.h"
+#include "DYNThreadPool.h"
 
 namespace DYN {
 
@@ -125,6 +143,584 @@ TEST(SimulationCommonTest, testSolverCommon) {
   SUNContext_Free(&sundialsContext);
 }
 
+TEST(SimulationCommonTest, testSolverCommonSharedValues) {
+  SUNContext sundialsContext;
+  if (SUNContext_Create(NULL, &sundialsContext) != 0)
+    throw DYNError(Error::SUNDIALS_ERROR, SolverContextCreationError);
+  SparseMatrix smj;
+  smj.init(3, 3);
+  smj.changeCol();
+  smj.addTerm(1, 1.);
+  smj.changeCol();
+  smj.addTerm(0, 2.);
+  smj.addTerm(2, 3.);
+  smj.changeCol();
+  smj.addTerm(1, 4.);
+  SUNMatrix JJ = SUNSparseMatrix(3, 3, 2, CSC_MAT, sundialsContext);
+  assert(JJ != NULL);
+  SolverCommon::detachSparseValues(JJ, true);
+  ASSERT_TRUE(SM_DATA_S(JJ) == NULL);
+  ASSERT_EQ(SM_NNZ_S(JJ), 0);
+
+  ASSERT_EQ(SolverCommon::shareSparseWithKINSOL(smj, JJ, 3, NULL), true);
+  ASSERT_EQ(SM_NNZ_S(JJ), 4);
+  ASSERT_TRUE(SM_DATA_S(JJ) == smj.Ax_.data());
+  ASSERT_EQ(SM_INDEXPTRS_S(JJ)[0], 0);
+  ASSERT_EQ(SM_INDEXPTRS_S(JJ)[1], 1);
+  ASSERT_EQ(SM_INDEXPTRS_S(JJ)[2], 3);
+  ASSERT_EQ(SM_INDEXPTRS_S(JJ)[3], 4);
+  ASSERT_EQ(SM_INDEXVALS_S(JJ)[0], 1);
+  ASSERT_EQ(SM_INDEXVALS_S(JJ)[1], 0);
+  ASSERT_EQ(SM_INDEXVALS_S(JJ)[2], 2);
+  ASSERT_EQ(SM_INDEXVALS_S(JJ)[3], 1);
+  ASSERT_EQ(SM_DATA_S(JJ)[2], 3);
+
+  std::vector<sunindextype> lastRowVals(SM_INDEXVALS_S(JJ), SM_INDEXVALS_S(JJ) + SM_NNZ_S(JJ));
+  // same structure, new values: the values are seen without any copy
+  SUNMatZero(JJ);
+  smj.init(3, 3);
+  smj.changeCol();
+  smj.addTerm(1, 5.);
+  smj.changeCol();
+  smj.addTerm(0, 6.);
+  smj.addTerm(2, 7.);
+  smj.changeCol();
+  smj.addTerm(1, 8.);
+  ASSERT_EQ(SolverCommon::shareSparseWithKINSOL(smj, JJ, 3, &lastRowVals[0]), false);
+  SolverCommon::shareSparseValuesWithKINSOL(smj, JJ, 3, &lastRowVals[0]);
+  ASSERT_EQ(SM_INDEXPTRS_S(JJ)[2], 3);
+  ASSERT_EQ(SM_INDEXVALS_S(JJ)[2], 2);
+  ASSERT_EQ(SM_DATA_S(JJ)[0], 5);
+  ASSERT_EQ(SM_DATA_S(JJ)[3], 8);
+
+  SolverCommon::detachSparseValues(JJ, false);
+  SUNMatDestroy_Sparse(JJ);
+  SUNContext_Free(&sundialsContext);
+}
+
+TEST(SimulationCommonTest, testPropagateMatrixStructureChange) {
+  SUNContext sundialsContext;
+  if (SUNContext_Create(NULL, &sundialsContext) != 0)
+    throw DYNError(Error::SUNDIALS_ERROR, SolverContextCreationError);
+  N_Vector x = N_VNew_Serial(3, sundialsContext);
+  SUNMatrix JJ = SUNSparseMatrix(3, 3, 4, CSC_MAT, sundialsContext);
+  SUNLinearSolver LS = LinearSolver::create(LinearSolver::KLU, 1, x, JJ, sundialsContext);
+  SolverCommon::detachSparseValues(JJ, true);
+  sunindextype* lastRowVals = NULL;
+  uint64_t lastStructureVersion = 0;
+  uint64_t lastStructureHash = 0;
+
+  SparseMatrix smj;
+  smj.init(3, 3);
+  smj.changeCol();
+  smj.addTerm(0, 1.);
+  smj.changeCol();
+  smj.addTerm(1, 2.);
+  smj.addTerm(2, 3.);
+  smj.changeCol();
+  smj.addTerm(2, 4.);
+  SolverCommon::propagateMatrixStructureChangeToKINSOL(smj, JJ, 3, &lastRowVals, lastStructureVersion, lastStructureHash, LS, false, NULL);
+  ASSERT_TRUE(lastRowVals != NULL);
+  ASSERT_EQ(lastStructureVersion, smj.structureVersion());
+  // row indexes then column pointers
+  ASSERT_EQ(lastRowVals[2], 2);
+  ASSERT_EQ(lastRowVals[4], 0);
+  ASSERT_EQ(lastRowVals[5], 1);
+  ASSERT_EQ(lastRowVals[6], 3);
+  ASSERT_EQ(lastRowVals[7], 4);
+  SUNLinearSolverContent_KLU content = reinterpret_cast<SUNLinearSolverContent_KLU>(LS->content);
+  ASSERT_EQ(content->first_factorize, 1);
+
+  // same structure: the analysis is kept
+  content->first_factorize = 0;
+  SUNMatZero(JJ);
+  smj.init(3, 3);
+  smj.changeCol();
+  smj.addTerm(0, 5.);
+  smj.changeCol();
+  smj.addTerm(1, 6.);
+  smj.addTerm(2, 7.);
+  smj.changeCol();
+  smj.addTerm(2, 8.);
+  SolverCommon::propagateMatrixStructureChangeToKINSOL(smj, JJ, 3, &lastRowVals, lastStructureVersion, lastStructureHash, LS, false, NULL);
+  ASSERT_EQ(content->first_factorize, 0);
+  ASSERT_EQ(SM_INDEXPTRS_S(JJ)[1], 1);
+  ASSERT_EQ(SM_DATA_S(JJ)[3], 8);
+
+  // same row indexes but other column pointers: the structure changed
+  smj.init(3, 3);
+  smj.changeCol();
+  smj.addTerm(0, 1.);
+  smj.addTerm(1, 2.);
+  smj.changeCol();
+  smj.addTerm(2, 3.);
+  smj.changeCol();
+  smj.addTerm(2, 4.);
+  SolverCommon::propagateMatrixStructureChangeToKINSOL(smj, JJ, 3, &lastRowVals, lastStructureVersion, lastStructureHash, LS, false, NULL);
+  ASSERT_EQ(content->first_factorize, 1);
+  ASSERT_EQ(SM_INDEXPTRS_S(JJ)[1], 2);
+  ASSERT_EQ(lastRowVals[5], 2);
+  ASSERT_EQ(lastStructureVersion, smj.structureVersion());
+
+  free(lastRowVals);
+  SolverCommon::detachSparseValues(JJ, false);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(JJ);
+  N_VDestroy_Serial(x);
+  SUNContext_Free(&sundialsContext);
+}
+
+TEST(SimulationCommonTest, testLinearSolver) {
+  ASSERT_EQ(LinearSolver::fromString("KLU"), LinearSolver::KLU);
+  ASSERT_EQ(LinearSolver::fromString("SuperLU_MT"), LinearSolver::SUPERLU_MT);
+  ASSERT_THROW_DYNAWO(LinearSolver::fromString("LU"), Error::GENERAL, KeyError_t::WrongLinearSolverChoice);
+  ASSERT_EQ(LinearSolver::toString(LinearSolver::KLU), "KLU");
+  ASSERT_EQ(LinearSolver::toString(LinearSolver::SUPERLU_MT), "SuperLU_MT");
+  ASSERT_EQ(LinearSolver::fromString("DomainDecomposition"), LinearSolver::DOMAIN_DECOMPOSITION);
+  ASSERT_EQ(LinearSolver::toString(LinearSolver::DOMAIN_DECOMPOSITION), "DomainDecomposition");
+  ASSERT_EQ(LinearSolver::fromString("MixedPrecision"), LinearSolver::MIXED_PRECISION);
+  ASSERT_EQ(LinearSolver::toString(LinearSolver::MIXED_PRECISION), "MixedPrecision");
+  ASSERT_EQ(LinearSolver::fromString("ActiveSet"), LinearSolver::ACTIVE_SET);
+  ASSERT_EQ(LinearSolver::toString(LinearSolver::ACTIVE_SET), "ActiveSet");
+  ASSERT_EQ(LinearSolver::fromString("Islands"), LinearSolver::ISLANDS);
+  ASSERT_EQ(LinearSolver::toString(LinearSolver::ISLANDS), "Islands");
+  ASSERT_TRUE(LinearSolver::isAvailable(LinearSolver::KLU));
+  ASSERT_TRUE(LinearSolver::isAvailable(LinearSolver::DOMAIN_DECOMPOSITION));
+  ASSERT_TRUE(LinearSolver::isAvailable(LinearSolver::MIXED_PRECISION));
+  ASSERT_TRUE(LinearSolver::isAvailable(LinearSolver::ACTIVE_SET));
+  ASSERT_TRUE(LinearSolver::isAvailable(LinearSolver::ISLANDS));
+
+  SUNContext sundialsContext;
+  if (SUNContext_Create(NULL, &sundialsContext) != 0)
+    throw DYNError(Error::SUNDIALS_ERROR, SolverContextCreationError);
+  N_Vector y = N_VNew_Serial(3, sundialsContext);
+  SUNMatrix JJ = SUNSparseMatrix(3, 3, 4, CSR_MAT, sundialsContext);
+  SUNLinearSolver LS = LinearSolver::create(LinearSolver::KLU, 1, y, JJ, sundialsContext);
+  ASSERT_TRUE(LS != NULL);
+  ASSERT_EQ(SUNLinSolGetID(LS), SUNLINEARSOLVER_KLU);
+  ASSERT_NO_THROW(LinearSolver::reinitSymbolicFactorization(LS, JJ));
+  SUNLinSolFree(LS);
+  if (!LinearSolver::isAvailable(LinearSolver::SUPERLU_MT)) {
+    ASSERT_THROW_DYNAWO(LinearSolver::create(LinearSolver::SUPERLU_MT, 2, y, JJ, sundialsContext), Error::GENERAL, KeyError_t::UnavailableLinearSolver);
+  }
+  SUNMatDestroy(JJ);
+  N_VDestroy_Serial(y);
+  SUNContext_Free(&sundialsContext);
+}
+
+static void
+fillTestMatrix(SUNMatrix JJ) {
+  // [[4, 1, 0], [1, 4, 1], [0, 1, 4]]
+  const sunindextype indexPtrs[] = {0, 2, 5, 7};
+  const sunindextype indexVals[] = {0, 1, 0, 1, 2, 1, 2};
+  const realtype data[] = {4., 1., 1., 4., 1., 1., 4.};
+  std::copy(indexPtrs, indexPtrs + 4, SM_INDEXPTRS_S(JJ));
+  std::copy(indexVals, indexVals + 7, SM_INDEXVALS_S(JJ));
+  std::copy(data, data + 7, SM_DATA_S(JJ));
+}
+
+TEST(SimulationCommonTest, testSymbolicAnalysisCache) {
+  SUNContext sundialsContext;
+  if (SUNContext_Create(NULL, &sundialsContext) != 0)
+    throw DYNError(Error::SUNDIALS_ERROR, SolverContextCreationError);
+  N_Vector x = N_VNew_Serial(3, sundialsContext);
+  N_Vector b = N_VNew_Serial(3, sundialsContext);
+  SUNMatrix JJ = SUNSparseMatrix(3, 3, 7, CSC_MAT, sundialsContext);
+  fillTestMatrix(JJ);
+  const uint64_t structureHash = 42;
+
+  SymbolicAnalysisCache cache;
+  SUNLinearSolver LS = LinearSolver::create(LinearSolver::KLU, 1, x, JJ, sundialsContext);
+  // nothing is saved as long as no analysis was performed
+  cache.store(LS, structureHash, 3, 7, SM_INDEXVALS_S(JJ), SM_INDEXPTRS_S(JJ));
+  ASSERT_EQ(cache.size(), 0);
+  ASSERT_FALSE(cache.restore(LS, JJ, structureHash));
+  ASSERT_EQ(SUNLinSolSetup(LS, JJ), 0);
+  cache.store(LS, structureHash, 3, 7, SM_INDEXVALS_S(JJ), SM_INDEXPTRS_S(JJ));
+  ASSERT_EQ(cache.size(), 1);
+  SUNLinSolFree(LS);
+
+  const std::string filePath = "symbolicAnalyses.bin";
+  cache.save(filePath);
+  ASSERT_TRUE(exists(filePath));
+  SymbolicAnalysisCache loadedCache;
+  loadedCache.load(filePath);
+  ASSERT_EQ(loadedCache.size(), 1);
+  // an existing file is replaced
+  loadedCache.save(filePath);
+  ASSERT_TRUE(exists(filePath));
+  SymbolicAnalysisCache reloadedCache;
+  reloadedCache.load(filePath);
+  ASSERT_EQ(reloadedCache.size(), 1);
+  DYN::remove(filePath);
+  // a missing file is not an error
+  loadedCache.load(filePath);
+  ASSERT_EQ(loadedCache.size(), 1);
+  // neither is a file that can not be written
+  const std::string unwritablePath = "missingDirectory/symbolicAnalyses.bin";
+  ASSERT_NO_THROW(loadedCache.save(unwritablePath));
+  ASSERT_FALSE(exists(unwritablePath));
+
+  // a new solver reuses the analysis and solves the system without any new ordering
+  LS = LinearSolver::create(LinearSolver::KLU, 1, x, JJ, sundialsContext);
+  ASSERT_FALSE(loadedCache.restore(LS, JJ, structureHash + 1));
+  ASSERT_TRUE(loadedCache.restore(LS, JJ, structureHash));
+  ASSERT_EQ(reinterpret_cast<SUNLinearSolverContent_KLU>(LS->content)->first_factorize, 0);
+  ASSERT_EQ(SUNLinSolSetup(LS, JJ), 0);
+  NV_Ith_S(b, 0) = 5.;
+  NV_Ith_S(b, 1) = 6.;
+  NV_Ith_S(b, 2) = 5.;
+  ASSERT_EQ(SUNLinSolSolve(LS, JJ, x, b, 0.), 0);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(NV_Ith_S(x, 0), 1.);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(NV_Ith_S(x, 1), 1.);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(NV_Ith_S(x, 2), 1.);
+
+  // same hash and row indexes but other column boundaries: the analysis is not used
+  SM_INDEXPTRS_S(JJ)[1] = 3;
+  ASSERT_FALSE(loadedCache.restore(LS, JJ, structureHash));
+  SM_INDEXPTRS_S(JJ)[1] = 2;
+  // same hash but another structure: the analysis is not used
+  SM_INDEXVALS_S(JJ)[1] = 2;
+  ASSERT_FALSE(loadedCache.restore(LS, JJ, structureHash));
+
+  SUNLinSolFree(LS);
+  SUNMatDestroy(JJ);
+  N_VDestroy_Serial(x);
+  N_VDestroy_Serial(b);
+  SUNContext_Free(&sundialsContext);
+}
+
+TEST(SimulationCommonTest, testSymbolicAnalysisCacheSharedByThreads) {
+  // each task analyses or reuses the analysis of the same structure with its own solver, as the local initializations do
+  SymbolicAnalysisCache cache;
+  const uint64_t structureHash = 42;
+  const unsigned nbTasks = 16;
+  std::vector<int> solved(nbTasks, 0);
+  ThreadPool threadPool(4);
+  threadPool.parallelFor(nbTasks, [&cache, &solved, structureHash](const unsigned task) {
+    SUNContext sundialsContext;
+    if (SUNContext_Create(NULL, &sundialsContext) != 0)
+      return;
+    N_Vector x = N_VNew_Serial(3, sundialsContext);
+    N_Vector b = N_VNew_Serial(3, sundialsContext);
+    SUNMatrix JJ = SUNSparseMatrix(3, 3, 7, CSC_MAT, sundialsContext);
+    fillTestMatrix(JJ);
+    SUNLinearSolver LS = LinearSolver::create(LinearSolver::KLU, 1, x, JJ, sundialsContext);
+    if (!cache.restore(LS, JJ, structureHash)) {
+      SUNLinSolSetup(LS, JJ);
+      cache.store(LS, structureHash, 3, 7, SM_INDEXVALS_S(JJ), SM_INDEXPTRS_S(JJ));
+    }
+    for (sunindextype i = 0; i < 3; ++i)
+      NV_Ith_S(b, i) = (i == 1) ? 6. : 5.;
+    if (SUNLinSolSetup(LS, JJ) == 0 && SUNLinSolSolve(LS, JJ, x, b, 0.) == 0
+        && std::abs(NV_Ith_S(x, 0) - 1.) < 1e-12 && std::abs(NV_Ith_S(x, 1) - 1.) < 1e-12 && std::abs(NV_Ith_S(x, 2) - 1.) < 1e-12)
+      solved[task] = 1;
+    SUNLinSolFree(LS);
+    SUNMatDestroy(JJ);
+    N_VDestroy_Serial(x);
+    N_VDestroy_Serial(b);
+    SUNContext_Free(&sundialsContext);
+  });
+  ASSERT_EQ(cache.size(), 1);
+  ASSERT_EQ(std::count(solved.begin(), solved.end(), 1), nbTasks);
+}
+
+TEST(SimulationCommonTest, testDomainDecompositionLinearSolver) {
+  SUNContext sundialsContext;
+  if (SUNContext_Create(NULL, &sundialsContext) != 0)
+    throw DYNError(Error::SUNDIALS_ERROR, SolverContextCreationError);
+  const sunindextype size = 6;
+  N_Vector x = N_VNew_Serial(size, sundialsContext);
+  N_Vector b = N_VNew_Serial(size, sundialsContext);
+  // tridiagonal matrix with 4 on the diagonal and 1 on both sides, stored by rows
+  SUNMatrix JJ = SUNSparseMatrix(size, size, 3 * size - 2, CSR_MAT, sundialsContext);
+  sunindextype nbElements = 0;
+  for (sunindextype row = 0; row < size; ++row) {
+    SM_INDEXPTRS_S(JJ)[row] = nbElements;
+    for (sunindextype col = std::max<sunindextype>(row - 1, 0); col <= std::min<sunindextype>(row + 1, size - 1); ++col) {
+      SM_INDEXVALS_S(JJ)[nbElements] = col;
+      SM_DATA_S(JJ)[nbElements] = (col == row) ? 4. : 1.;
+      ++nbElements;
+    }
+    NV_Ith_S(b, row) = (row == 0 || row == size - 1) ? 5. : 6.;
+  }
+  SM_INDEXPTRS_S(JJ)[size] = nbElements;
+
+  SUNLinearSolver LS = LinearSolver::create(LinearSolver::DOMAIN_DECOMPOSITION, 2, x, JJ, sundialsContext);
+  ASSERT_TRUE(DomainDecompositionLinearSolver::isDomainDecomposition(LS));
+  ASSERT_EQ(DomainDecompositionLinearSolver::getNbInterfaceUnknowns(LS), 0);
+  ASSERT_EQ(SUNLinSolSetup(LS, JJ), 0);
+  // the chain is cut in two areas of three unknowns, the first unknown of the second area being on the interface
+  ASSERT_EQ(DomainDecompositionLinearSolver::getNbInterfaceUnknowns(LS), 1);
+  ASSERT_EQ(SUNLinSolSolve(LS, JJ, x, b, 0.), 0);
+  for (sunindextype i = 0; i < size; ++i)
+    ASSERT_DOUBLE_EQUALS_DYNAWO(NV_Ith_S(x, i), 1.);
+
+  // new values: only a numerical factorization
+  for (sunindextype p = 0; p < nbElements; ++p)
+    SM_DATA_S(JJ)[p] *= 2.;
+  ASSERT_EQ(SUNLinSolSetup(LS, JJ), 0);
+  ASSERT_EQ(SUNLinSolSolve(LS, JJ, x, b, 0.), 0);
+  for (sunindextype i = 0; i < size; ++i)
+    ASSERT_DOUBLE_EQUALS_DYNAWO(NV_Ith_S(x, i), 0.5);
+
+  // a new partition after a structure change gives the same solution
+  ASSERT_NO_THROW(LinearSolver::reinitSymbolicFactorization(LS, JJ));
+  ASSERT_EQ(SUNLinSolSetup(LS, JJ), 0);
+  ASSERT_EQ(SUNLinSolSolve(LS, JJ, b, b, 0.), 0);
+  for (sunindextype i = 0; i < size; ++i)
+    ASSERT_DOUBLE_EQUALS_DYNAWO(NV_Ith_S(b, i), 0.5);
+
+  SUNLinSolFree(LS);
+  SUNMatDestroy(JJ);
+  N_VDestroy_Serial(x);
+  N_VDestroy_Serial(b);
+  SUNContext_Free(&sundialsContext);
+}
+
+TEST(SimulationCommonTest, testMixedPrecisionLinearSolver) {
+  SUNContext sundialsContext;
+  if (SUNContext_Create(NULL, &sundialsContext) != 0)
+    throw DYNError(Error::SUNDIALS_ERROR, SolverContextCreationError);
+  const sunindextype size = 6;
+  N_Vector x = N_VNew_Serial(size, sundialsContext);
+  N_Vector b = N_VNew_Serial(size, sundialsContext);
+  // tridiagonal matrix with 4 on the diagonal and 1/3 on both sides, stored by rows: 1/3 is not exact in single precision
+  SUNMatrix JJ = SUNSparseMatrix(size, size, 3 * size - 2, CSR_MAT, sundialsContext);
+  sunindextype nbElements = 0;
+  for (sunindextype row = 0; row < size; ++row) {
+    SM_INDEXPTRS_S(JJ)[row] = nbElements;
+    for (sunindextype col = std::max<sunindextype>(row - 1, 0); col <= std::min<sunindextype>(row + 1, size - 1); ++col) {
+      SM_INDEXVALS_S(JJ)[nbElements] = col;
+      SM_DATA_S(JJ)[nbElements] = (col == row) ? 4. : 1. / 3.;
+      ++nbElements;
+    }
+    NV_Ith_S(b, row) = (row == 0 || row == size - 1) ? 4. + 1. / 3. : 4. + 2. / 3.;
+  }
+  SM_INDEXPTRS_S(JJ)[size] = nbElements;
+
+  SUNLinearSolver LS = LinearSolver::create(LinearSolver::MIXED_PRECISION, 1, x, JJ, sundialsContext);
+  ASSERT_TRUE(MixedPrecisionLinearSolver::isMixedPrecision(LS));
+  ASSERT_EQ(SUNLinSolSetup(LS, JJ), 0);
+  ASSERT_FALSE(MixedPrecisionLinearSolver::isDoublePrecision(LS));
+  ASSERT_GT(LinearSolver::getMemoryUsage(LS), 0U);
+  // the refinement recovers the double precision solution
+  ASSERT_EQ(SUNLinSolSolve(LS, JJ, x, b, 0.), 0);
+  for (sunindextype i = 0; i < size; ++i)
+    ASSERT_NEAR(NV_Ith_S(x, i), 1., 1e-14);
+  ASSERT_EQ(SUNLinSolSolve(LS, JJ, b, b, 0.), 0);
+  for (sunindextype i = 0; i < size; ++i)
+    ASSERT_NEAR(NV_Ith_S(b, i), 1., 1e-14);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(JJ);
+
+  // badly conditioned matrix stored by columns: the single precision factors do not allow the refinement to converge
+  const double a = 1.1;
+  const double c = 1.3;
+  const double d = c * c / a + 1e-9;
+  JJ = SUNSparseMatrix(2, 2, 4, CSC_MAT, sundialsContext);
+  N_Vector x2 = N_VNew_Serial(2, sundialsContext);
+  N_Vector b2 = N_VNew_Serial(2, sundialsContext);
+  const sunindextype colPtrs[] = {0, 2, 4};
+  const sunindextype rowIdx[] = {0, 1, 0, 1};
+  const double values[] = {a, c, c, d};
+  std::copy(colPtrs, colPtrs + 3, SM_INDEXPTRS_S(JJ));
+  std::copy(rowIdx, rowIdx + 4, SM_INDEXVALS_S(JJ));
+  std::copy(values, values + 4, SM_DATA_S(JJ));
+  NV_Ith_S(b2, 0) = a + c;
+  NV_Ith_S(b2, 1) = c + d;
+  LS = LinearSolver::create(LinearSolver::MIXED_PRECISION, 1, x2, JJ, sundialsContext);
+  ASSERT_EQ(SUNLinSolSetup(LS, JJ), 0);
+  ASSERT_EQ(SUNLinSolSolve(LS, JJ, x2, b2, 0.), 0);
+  ASSERT_TRUE(MixedPrecisionLinearSolver::isDoublePrecision(LS));
+  ASSERT_NEAR(NV_Ith_S(x2, 0), 1., 1e-5);
+  ASSERT_NEAR(NV_Ith_S(x2, 1), 1., 1e-5);
+
+  // a structure change gives the single precision factors another chance
+  ASSERT_NO_THROW(LinearSolver::reinitSymbolicFactorization(LS, JJ));
+  ASSERT_FALSE(MixedPrecisionLinearSolver::isDoublePrecision(LS));
+
+  SUNLinSolFree(LS);
+  SUNMatDestroy(JJ);
+  N_VDestroy_Serial(x);
+  N_VDestroy_Serial(b);
+  N_VDestroy_Serial(x2);
+  N_VDestroy_Serial(b2);
+  SUNContext_Free(&sundialsContext);
+}
+
+TEST(SimulationCommonTest, testActiveSetLinearSolver) {
+  SUNContext sundialsContext;
+  if (SUNContext_Create(NULL, &sundialsContext) != 0)
+    throw DYNError(Error::SUNDIALS_ERROR, SolverContextCreationError);
+  const sunindextype size = 5;
+  N_Vector x = N_VNew_Serial(size, sundialsContext);
+  N_Vector b = N_VNew_Serial(size, sundialsContext);
+  // unknown 3 is frozen by its trivial equation, as the voltage of a switched off bus, then unknown 4 which only depends on it
+  SUNMatrix JJ = SUNSparseMatrix(size, size, 12, CSR_MAT, sundialsContext);
+  const sunindextype rowPtrs[] = {0, 2, 6, 8, 9, 11};
+  const sunindextype colIdx[] = {0, 1, 0, 1, 2, 3, 1, 2, 3, 3, 4};
+  const double values[] = {4., 1., 1., 4., 1., 2., 1., 4., 1., 3., 2.};
+  std::copy(rowPtrs, rowPtrs + size + 1, SM_INDEXPTRS_S(JJ));
+  std::copy(colIdx, colIdx + 11, SM_INDEXVALS_S(JJ));
+  std::copy(values, values + 11, SM_DATA_S(JJ));
+  const double rhs[] = {5., 8., 5., 1., 5.};
+  std::copy(rhs, rhs + size, N_VGetArrayPointer(b));
+
+  SUNLinearSolver LS = LinearSolver::create(LinearSolver::ACTIVE_SET, 1, x, JJ, sundialsContext);
+  ASSERT_TRUE(ActiveSetLinearSolver::isActiveSet(LS));
+  ASSERT_EQ(SUNLinSolSetup(LS, JJ), 0);
+  ASSERT_EQ(ActiveSetLinearSolver::getNbFrozen(LS), 2U);
+  ASSERT_GT(LinearSolver::getMemoryUsage(LS), 0U);
+  ASSERT_EQ(SUNLinSolSolve(LS, JJ, x, b, 0.), 0);
+  for (sunindextype i = 0; i < size; ++i)
+    ASSERT_NEAR(NV_Ith_S(x, i), 1., 1e-14);
+  ASSERT_EQ(SUNLinSolSolve(LS, JJ, b, b, 0.), 0);
+  for (sunindextype i = 0; i < size; ++i)
+    ASSERT_NEAR(NV_Ith_S(b, i), 1., 1e-14);
+
+  // once reconnected, the unknown 3 goes back to the active system, and the unknown 4 with it
+  const sunindextype newRowPtrs[] = {0, 2, 6, 8, 10, 12};
+  const sunindextype newColIdx[] = {0, 1, 0, 1, 2, 3, 1, 2, 1, 3, 3, 4};
+  const double newValues[] = {4., 1., 1., 4., 1., 2., 1., 4., 1., 4., 3., 2.};
+  std::copy(newRowPtrs, newRowPtrs + size + 1, SM_INDEXPTRS_S(JJ));
+  std::copy(newColIdx, newColIdx + 12, SM_INDEXVALS_S(JJ));
+  std::copy(newValues, newValues + 12, SM_DATA_S(JJ));
+  const double newRhs[] = {5., 8., 5., 5., 5.};
+  std::copy(newRhs, newRhs + size, N_VGetArrayPointer(b));
+  ASSERT_NO_THROW(LinearSolver::reinitSymbolicFactorization(LS, JJ));
+  ASSERT_EQ(SUNLinSolSetup(LS, JJ), 0);
+  ASSERT_EQ(ActiveSetLinearSolver::getNbFrozen(LS), 0U);
+  ASSERT_EQ(SUNLinSolSolve(LS, JJ, x, b, 0.), 0);
+  for (sunindextype i = 0; i < size; ++i)
+    ASSERT_NEAR(NV_Ith_S(x, i), 1., 1e-14);
+
+  SUNLinSolFree(LS);
+  SUNMatDestroy(JJ);
+  N_VDestroy_Serial(x);
+  N_VDestroy_Serial(b);
+  SUNContext_Free(&sundialsContext);
+}
+
+TEST(SimulationCommonTest, testIslandsLinearSolver) {
+  SUNContext sundialsContext;
+  if (SUNContext_Create(NULL, &sundialsContext) != 0)
+    throw DYNError(Error::SUNDIALS_ERROR, SolverContextCreationError);
+  // three islands stored by rows, interleaved: {0, 2, 4} tridiagonal, {1, 5} and {3}
+  const sunindextype size = 6;
+  N_Vector x = N_VNew_Serial(size, sundialsContext);
+  N_Vector b = N_VNew_Serial(size, sundialsContext);
+  SUNMatrix JJ = SUNSparseMatrix(size, size, 12, CSR_MAT, sundialsContext);
+  const sunindextype rowPtrs[] = {0, 2, 4, 7, 8, 10, 12};
+  const sunindextype colIdx[] = {0, 2, 1, 5, 0, 2, 4, 3, 2, 4, 1, 5};
+  const double values[] = {4., 1., 3., 2., 1., 4., 1., 5., 1., 4., 1., 3.};
+  std::copy(rowPtrs, rowPtrs + size + 1, SM_INDEXPTRS_S(JJ));
+  std::copy(colIdx, colIdx + 12, SM_INDEXVALS_S(JJ));
+  std::copy(values, values + 12, SM_DATA_S(JJ));
+  const double rhs[] = {5., 5., 6., 5., 5., 4.};
+  std::copy(rhs, rhs + size, N_VGetArrayPointer(b));
+
+  SUNLinearSolver LS = LinearSolver::create(LinearSolver::ISLANDS, 2, x, JJ, sundialsContext);
+  ASSERT_TRUE(IslandsLinearSolver::isIslands(LS));
+  ASSERT_EQ(IslandsLinearSolver::getNbIslands(LS), 0U);
+  ASSERT_EQ(SUNLinSolSetup(LS, JJ), 0);
+  ASSERT_EQ(IslandsLinearSolver::getNbIslands(LS), 3U);
+  ASSERT_GT(LinearSolver::getMemoryUsage(LS), 0U);
+  ASSERT_EQ(SUNLinSolSolve(LS, JJ, x, b, 0.), 0);
+  for (sunindextype i = 0; i < size; ++i)
+    ASSERT_NEAR(NV_Ith_S(x, i), 1., 1e-14);
+  ASSERT_EQ(SUNLinSolSolve(LS, JJ, b, b, 0.), 0);
+  for (sunindextype i = 0; i < size; ++i)
+    ASSERT_NEAR(NV_Ith_S(b, i), 1., 1e-14);
+  // the values change without structure change
+  for (sunindextype p = 0; p < 12; ++p)
+    SM_DATA_S(JJ)[p] *= 2.;
+  std::copy(rhs, rhs + size, N_VGetArrayPointer(b));
+  ASSERT_EQ(SUNLinSolSetup(LS, JJ), 0);
+  ASSERT_EQ(SUNLinSolSolve(LS, JJ, x, b, 0.), 0);
+  for (sunindextype i = 0; i < size; ++i)
+    ASSERT_NEAR(NV_Ith_S(x, i), 0.5, 1e-14);
+
+  // once reconnected through an element between the unknowns 3 and 5, two islands are left
+  const sunindextype newRowPtrs[] = {0, 2, 4, 7, 9, 11, 14};
+  const sunindextype newColIdx[] = {0, 2, 1, 5, 0, 2, 4, 3, 5, 2, 4, 1, 3, 5};
+  const double newValues[] = {4., 1., 3., 2., 1., 4., 1., 5., 1., 1., 4., 1., 1., 3.};
+  SUNMatDestroy(JJ);
+  JJ = SUNSparseMatrix(size, size, 14, CSR_MAT, sundialsContext);
+  std::copy(newRowPtrs, newRowPtrs + size + 1, SM_INDEXPTRS_S(JJ));
+  std::copy(newColIdx, newColIdx + 14, SM_INDEXVALS_S(JJ));
+  std::copy(newValues, newValues + 14, SM_DATA_S(JJ));
+  const double newRhs[] = {5., 5., 6., 6., 5., 5.};
+  std::copy(newRhs, newRhs + size, N_VGetArrayPointer(b));
+  ASSERT_NO_THROW(LinearSolver::reinitSymbolicFactorization(LS, JJ));
+  ASSERT_EQ(SUNLinSolSetup(LS, JJ), 0);
+  ASSERT_EQ(IslandsLinearSolver::getNbIslands(LS), 2U);
+  ASSERT_EQ(SUNLinSolSolve(LS, JJ, x, b, 0.), 0);
+  for (sunindextype i = 0; i < size; ++i)
+    ASSERT_NEAR(NV_Ith_S(x, i), 1., 1e-14);
+
+  SUNLinSolFree(LS);
+  SUNMatDestroy(JJ);
+  N_VDestroy_Serial(x);
+  N_VDestroy_Serial(b);
+  SUNContext_Free(&sundialsContext);
+}
+
+TEST(SimulationCommonTest, testPowerFlowSolver) {
+  // three buses meshed by identical lines, and an isolated bus without any controlled voltage
+  PowerFlowSolver powerFlow;
+  ASSERT_EQ(powerFlow.addBus(1., 0.), 0U);
+  ASSERT_EQ(powerFlow.addBus(0.9, 0.), 1U);
+  ASSERT_EQ(powerFlow.addBus(0., 0.), 2U);
+  ASSERT_EQ(powerFlow.addBus(0.95, 0.1), 3U);
+  const std::complex<double> admittance = 1. / std::complex<double>(0.01, 0.1);
+  const std::complex<double> shunt(0., 0.01);
+  const unsigned ends[3][2] = {{0, 1}, {1, 2}, {0, 2}};
+  for (const auto& end : ends)
+    powerFlow.addBranch(end[0], end[1], admittance + shunt, -admittance, -admittance, admittance + shunt);
+  powerFlow.addInjection(0, 0.3, 0.);
+  powerFlow.addInjection(1, -0.5, -0.2);
+  powerFlow.addInjection(2, 0.1, 0.);
+  powerFlow.addInjection(3, -0.1, 0.);
+  powerFlow.setTargetV(0, 1.);
+  powerFlow.setTargetV(2, 1.02);
+  ASSERT_EQ(powerFlow.getV(2), 1.02);
+
+  // the controlled bus with the largest active injection is the slack of the island
+  ASSERT_TRUE(powerFlow.solve(1e-10, 10));
+  ASSERT_GT(powerFlow.getNbIterations(), 0U);
+  ASSERT_LT(powerFlow.getNbIterations(), 6U);
+  ASSERT_LT(powerFlow.getMaxMismatch(), 1e-10);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(powerFlow.getV(0), 1.);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(powerFlow.getAngle(0), 0.);
+  ASSERT_NEAR(powerFlow.getV(2), 1.02, 1e-12);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(powerFlow.getV(3), 0.95);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(powerFlow.getAngle(3), 0.1);
+  std::complex<double> u[3];
+  for (unsigned bus = 0; bus < 3; ++bus)
+    u[bus] = std::polar(powerFlow.getV(bus), powerFlow.getAngle(bus));
+  std::complex<double> currents[3];
+  for (const auto& end : ends) {
+    currents[end[0]] += (admittance + shunt) * u[end[0]] - admittance * u[end[1]];
+    currents[end[1]] += (admittance + shunt) * u[end[1]] - admittance * u[end[0]];
+  }
+  const std::complex<double> s1 = u[1] * std::conj(currents[1]);
+  ASSERT_NEAR(s1.real(), -0.5, 1e-9);
+  ASSERT_NEAR(s1.imag(), -0.2, 1e-9);
+  ASSERT_NEAR((u[2] * std::conj(currents[2])).real(), 0.1, 1e-9);
+
+  // a load the network cannot supply: the initial voltages are kept
+  PowerFlowSolver collapse;
+  collapse.addBus(1., 0.);
+  collapse.addBus(0.98, -0.1);
+  collapse.addBranch(0, 1, admittance, -admittance, -admittance, admittance);
+  collapse.addInjection(1, -50., -20.);
+  collapse.setSlack(0);
+  ASSERT_FALSE(collapse.solve(1e-8, 10));
+  ASSERT_DOUBLE_EQUALS_DYNAWO(collapse.getV(1), 0.98);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(collapse.getAngle(1), -0.1);
+}
+
 TEST(SimulationCommonTest, testNormVectors) {
   std::vector<double> vec;
   vec.push_back(1.);
@@ -151,4 +747,144 @@ TEST(SimulationCommonTest, testNormVectors) {
   ASSERT_DOUBLE_EQ(SolverCommon::weightedL2Norm(vec, indices, sub_weights), 16.52271164185830443216);
 }
 
+TEST(SimulationCommonTest, testRestorationCache) {
+  const std::vector<double> z0 = {0., 1.};
+  const std::vector<double> z1 = {1., 1.};
+  const uint64_t upSignature = RestorationCache::signature(z0, z1);
+  const uint64_t downSignature = RestorationCache::signature(z1, z0);
+  ASSERT_NE(upSignature, downSignature);
+  ASSERT_EQ(RestorationCache::signature({-0., 1.}, z1), upSignature);
+
+  RestorationCache cache(2);
+  std::vector<double> y = {1., 2.};
+  ASSERT_FALSE(cache.apply(upSignature, y));
+  cache.store(upSignature, {1., 2.}, {1.5, 1.});
+  ASSERT_EQ(cache.size(), 1);
+  ASSERT_TRUE(cache.apply(upSignature, y));
+  ASSERT_DOUBLE_EQ(y[0], 1.5);
+  ASSERT_DOUBLE_EQ(y[1], 1.);
+  ASSERT_EQ(cache.nbHits(), 1);
+  // a correction of another size is not applied
+  std::vector<double> yOtherSize = {1.};
+  ASSERT_FALSE(cache.apply(upSignature, yOtherSize));
+
+  // the oldest correction is dropped first
+  cache.store(downSignature, {1.5, 1.}, {1., 2.});
+  cache.store(42, {0., 0.}, {1., 1.});
+  ASSERT_EQ(cache.size(), 2);
+  ASSERT_FALSE(cache.apply(upSignature, y));
+  ASSERT_TRUE(cache.apply(downSignature, y));
+  ASSERT_DOUBLE_EQ(y[0], 1.);
+  ASSERT_DOUBLE_EQ(y[1], 2.);
+
+  // an empty cache keeps nothing
+  RestorationCache emptyCache(0);
+  emptyCache.store(upSignature, {1., 2.}, {1.5, 1.});
+  ASSERT_EQ(emptyCache.size(), 0);
+}
+
+TEST(SimulationCommonTest, testConvergenceDiagnostics) {
+  ConvergenceDiagnostics diagnostics;
+  const std::vector<double> residuals = {0.1, -3., 0., 2., -0.5, 1., 4., -0.2};
+  // nothing is recorded while disabled
+  diagnostics.addIteration(0., 1e-3, 1, residuals.data(), residuals.size());
+  ASSERT_FALSE(diagnostics.isEnabled());
+  ASSERT_EQ(diagnostics.size(), 0);
+
+  std::stringstream stream;
+  diagnostics.enable(2, &stream);
+  ASSERT_TRUE(diagnostics.isEnabled());
+  ASSERT_EQ(stream.str().find("dump;trigger;time;stepSize;iteration;maxResidual"), 0);
+  diagnostics.addIteration(1., 1e-3, 1, residuals.data(), residuals.size());
+  const ConvergenceDiagnostics::Iteration& iteration = diagnostics.getIteration(0);
+  ASSERT_DOUBLE_EQ(iteration.maxResidual, 4.);
+  ASSERT_EQ(iteration.nbResiduals, ConvergenceDiagnostics::NB_LARGEST_RESIDUALS);
+  const int expectedIndexes[] = {6, 1, 3, 5, 4};
+  for (unsigned int rank = 0; rank < iteration.nbResiduals; ++rank)
+    ASSERT_EQ(iteration.largestResiduals[rank].index, expectedIndexes[rank]);
+  ASSERT_DOUBLE_EQ(iteration.largestResiduals[1].value, -3.);
+
+  // the oldest iteration is dropped first
+  diagnostics.addIteration(1., 1e-3, 2, residuals.data(), 2);
+  diagnostics.addIteration(1., 1e-3, 3, residuals.data(), 2);
+  ASSERT_EQ(diagnostics.size(), 2);
+  ASSERT_EQ(diagnostics.getIteration(0).iteration, 2);
+  ASSERT_EQ(diagnostics.getIteration(1).iteration, 3);
+  ASSERT_EQ(diagnostics.getIteration(1).nbResiduals, 2);
+  ASSERT_EQ(diagnostics.getIteration(1).largestResiduals[0].index, 1);
+
+  diagnostics.enable(0, &stream);
+  ASSERT_FALSE(diagnostics.isEnabled());
+}
+
+TEST(SimulationCommonTest, testParallelVector) {
+  SUNContext sundialsContext;
+  if (SUNContext_Create(NULL, &sundialsContext) != 0)
+    throw DYNError(Error::SUNDIALS_ERROR, SolverContextCreationError);
+  ThreadPool threadPool(4);
+  const sunindextype size = 4 * ParallelVector::MIN_CHUNK_SIZE + 3;
+  std::vector<double> xData(size);
+  for (sunindextype i = 0; i < size; ++i)
+    xData[i] = (i % 7 == 0) ? -1. - i % 5 : 0.5 + i % 3;
+
+  // no pool or a single thread: serial vectors
+  N_Vector serial = ParallelVector::make(size, &xData[0], nullptr, sundialsContext);
+  ASSERT_FALSE(ParallelVector::isParallel(serial));
+  ThreadPool singleThread(1);
+  N_Vector sequential = ParallelVector::create(size, &singleThread, sundialsContext);
+  ASSERT_FALSE(ParallelVector::isParallel(sequential));
+  N_VDestroy(sequential);
+
+  N_Vector x = ParallelVector::make(size, &xData[0], &threadPool, sundialsContext);
+  ASSERT_TRUE(ParallelVector::isParallel(x));
+  ASSERT_EQ(N_VGetVectorID(x), SUNDIALS_NVEC_SERIAL);
+  ASSERT_EQ(N_VGetLength(x), size);
+  ASSERT_EQ(NV_DATA_S(x), &xData[0]);
+  N_Vector w = N_VClone(x);
+  ASSERT_TRUE(ParallelVector::isParallel(w));
+  N_Vector z = ParallelVector::create(size, &threadPool, sundialsContext);
+  N_Vector zSerial = N_VClone(serial);
+  N_VConst(0.25, w);
+  for (sunindextype i = 0; i < size; ++i)
+    ASSERT_DOUBLE_EQUALS_DYNAWO(NV_Ith_S(w, i), 0.25);
+
+  // element-wise operations, mixing parallel and serial vectors
+  N_VLinearSum(2., x, -1., w, z);
+  N_VLinearSum(2., serial, -1., w, zSerial);
+  for (sunindextype i = 0; i < size; ++i)
+    ASSERT_DOUBLE_EQUALS_DYNAWO(NV_Ith_S(z, i), NV_Ith_S(zSerial, i));
+  N_VProd(x, x, z);
+  N_VAbs(z, z);
+  N_VInv(z, z);
+  N_VScale(3., z, z);
+  N_VAddConst(z, 1., z);
+  N_VDiv(z, w, z);
+  for (sunindextype i = 0; i < size; ++i)
+    ASSERT_DOUBLE_EQUALS_DYNAWO(NV_Ith_S(z, i), (3. / (xData[i] * xData[i]) + 1.) / 0.25);
+
+  // reductions
+  ASSERT_DOUBLE_EQUALS_DYNAWO(N_VDotProd(x, w), N_VDotProd(serial, w));
+  ASSERT_DOUBLE_EQUALS_DYNAWO(N_VMaxNorm(x), N_VMaxNorm(serial));
+  ASSERT_DOUBLE_EQUALS_DYNAWO(N_VMin(x), N_VMin(serial));
+  ASSERT_DOUBLE_EQUALS_DYNAWO(N_VL1Norm(x), N_VL1Norm(serial));
+  ASSERT_DOUBLE_EQUALS_DYNAWO(N_VWrmsNorm(x, w), N_VWrmsNorm(serial, w));
+  ASSERT_DOUBLE_EQUALS_DYNAWO(N_VWL2Norm(x, w), N_VWL2Norm(serial, w));
+  N_VConst(1., z);
+  NV_Ith_S(z, 0) = 0.;
+  ASSERT_DOUBLE_EQUALS_DYNAWO(N_VWrmsNormMask(x, w, z), N_VWrmsNormMask(serial, w, z));
+
+  // short vectors are handled by the calling thread
+  N_Vector shortVector = ParallelVector::create(10, &threadPool, sundialsContext);
+  N_VConst(-2., shortVector);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(N_VMaxNorm(shortVector), 2.);
+
+  N_VDestroy(shortVector);
+  N_VDestroy(zSerial);
+  N_VDestroy(z);
+  N_VDestroy(w);
+  N_VDestroy(x);
+  N_VDestroy(serial);
+  SUNContext_Free(&sundialsContext);
+}
+
 }  // namespace DYN
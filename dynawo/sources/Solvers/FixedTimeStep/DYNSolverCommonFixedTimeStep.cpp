@@ -23,19 +23,25 @@
 
 #include "DYNSolverCommonFixedTimeStep.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdlib>
 #include <iostream>
 #include <iomanip>
 #include <vector>
 
 #include <boost/shared_ptr.hpp>
+#include <kinsol/kinsol.h>
+#include <nvector/nvector_serial.h>
 
 #include "PARParametersSet.h"
 #include "PARParameter.h"
 
 #include "DYNMacrosMessage.h"
+#include "DYNMemoryUsage.h"
 #include "DYNSolverKINEuler.h"
 #include "DYNSolverKINAlgRestoration.h"
+#include "DYNRestorationCache.h"
 #include "DYNTrace.h"
 #include "DYNModel.h"
 
@@ -58,6 +64,11 @@ using timeline::Timeline;
 
 namespace DYN {
 
+static const double stepControllerIntegralGain = 0.3;  ///< exponent of the integral term of the PI step controller
+static const double stepControllerProportionalGain = 0.4;  ///< exponent of the proportional term of the PI step controller
+static const double minimumStepDifficulty = 1e-2;  ///< lower bound of the step difficulty used by the PI step controller
+static const int maximumExtrapolationOrder = 3;  ///< maximum order of the extrapolation of the Newton initial guess
+
 SolverCommonFixedTimeStep::SolverCommonFixedTimeStep() :
 hMin_(0),
 hMax_(0),
@@ -76,11 +87,41 @@ mxnewtstep_(100000),
 msbset_(0),
 mxiter_(15),
 printfl_(0),
+maxJacobianAgeSteps_(0),
+maxJacobianAgeIterations_(0),
+maxJacobianConvergenceRate_(0.),
+jacobianAgeSteps_(0),
+jacobianAgeIterations_(0),
+slowConvergence_(false),
+nJacobianReuses_(0),
+nSetupsForcedByAge_(0),
+nSetupsForcedByRate_(0),
 skipNextNR_(false),
+checkpointDerivatives_(false),
+staleContinuousVariables_(false),
 skipAlgebraicResidualsEvaluation_(false),
 optimizeAlgebraicResidualsEvaluations_(true),
 skipNRIfInitialGuessOK_(true),
-nbLastTimeSimulated_(0) {
+nbLastTimeSimulated_(0),
+enableStepController_(false),
+stepControllerTargetNewtonIter_(3),
+stepControllerTargetRate_(0.1),
+stepControllerMaxGrowth_(2.),
+stepDifficulty_(0.),
+previousStepDifficulty_(0.),
+extrapolationOrder_(0),
+enableQSS_(false),
+qssDerivativeThreshold_(1e-4),
+qssMaxJump_(0.),
+quasiSteadyState_(false),
+nQSSJumps_(0),
+qssJumpedTime_(0.),
+restorationCacheSize_(0),
+jacobianFreeNewton_(false),
+degradedMode_(false),
+degradedMxiter_(5),
+degradedHMax_(0.),
+nominalHMax_(0.) {
   minimalAcceptableStep_ = 0.1;
 }
 
@@ -104,6 +145,35 @@ SolverCommonFixedTimeStep::defineSpecificParametersCommon() {
   parameters_.insert(make_pair("printfl", ParameterSolver("printfl", VAR_TYPE_INT, optional)));
   parameters_.insert(make_pair("optimizeAlgebraicResidualsEvaluations", ParameterSolver("optimizeAlgebraicResidualsEvaluations", VAR_TYPE_BOOL, optional)));
   parameters_.insert(make_pair("skipNRIfInitialGuessOK", ParameterSolver("skipNRIfInitialGuessOK", VAR_TYPE_BOOL, optional)));
+
+  // Parameters for the reuse of the Jacobian across time steps
+  parameters_.insert(make_pair("maxJacobianAgeSteps", ParameterSolver("maxJacobianAgeSteps", VAR_TYPE_INT, optional)));
+  parameters_.insert(make_pair("maxJacobianAgeIterations", ParameterSolver("maxJacobianAgeIterations", VAR_TYPE_INT, optional)));
+  parameters_.insert(make_pair("maxJacobianConvergenceRate", ParameterSolver("maxJacobianConvergenceRate", VAR_TYPE_DOUBLE, optional)));
+
+  // Parameters of the predictive time step controller
+  parameters_.insert(make_pair("enableStepController", ParameterSolver("enableStepController", VAR_TYPE_BOOL, optional)));
+  parameters_.insert(make_pair("stepControllerTargetNewtonIter", ParameterSolver("stepControllerTargetNewtonIter", VAR_TYPE_INT, optional)));
+  parameters_.insert(make_pair("stepControllerTargetRate", ParameterSolver("stepControllerTargetRate", VAR_TYPE_DOUBLE, optional)));
+  parameters_.insert(make_pair("stepControllerMaxGrowth", ParameterSolver("stepControllerMaxGrowth", VAR_TYPE_DOUBLE, optional)));
+
+  // Parameter of the extrapolation of the Newton initial guess
+  parameters_.insert(make_pair("extrapolationOrder", ParameterSolver("extrapolationOrder", VAR_TYPE_INT, optional)));
+
+  // Parameters of the quasi-steady state mode
+  parameters_.insert(make_pair("enableQSS", ParameterSolver("enableQSS", VAR_TYPE_BOOL, optional)));
+  parameters_.insert(make_pair("qssDerivativeThreshold", ParameterSolver("qssDerivativeThreshold", VAR_TYPE_DOUBLE, optional)));
+  parameters_.insert(make_pair("qssMaxJump", ParameterSolver("qssMaxJump", VAR_TYPE_DOUBLE, optional)));
+
+  // Parameter of the warm start of the algebraic restorations
+  parameters_.insert(make_pair("restorationCacheSize", ParameterSolver("restorationCacheSize", VAR_TYPE_INT, optional)));
+
+  // Parameter of the Jacobian-free Newton-Krylov time step solve
+  parameters_.insert(make_pair("jacobianFreeNewton", ParameterSolver("jacobianFreeNewton", VAR_TYPE_BOOL, optional)));
+
+  // Parameters of the degraded mode used to keep up with a real-time clock
+  parameters_.insert(make_pair("degradedMxiter", ParameterSolver("degradedMxiter", VAR_TYPE_INT, optional)));
+  parameters_.insert(make_pair("degradedHMax", ParameterSolver("degradedHMax", VAR_TYPE_DOUBLE, optional)));
 }
 
 void
@@ -140,6 +210,57 @@ SolverCommonFixedTimeStep::setSolverSpecificParametersCommon() {
   const ParameterSolver& skipNRIfInitialGuessOK = findParameter("skipNRIfInitialGuessOK");
   if (skipNRIfInitialGuessOK.hasValue())
     skipNRIfInitialGuessOK_ = skipNRIfInitialGuessOK.getValue<bool>();
+  const ParameterSolver& maxJacobianAgeSteps = findParameter("maxJacobianAgeSteps");
+  if (maxJacobianAgeSteps.hasValue())
+    maxJacobianAgeSteps_ = maxJacobianAgeSteps.getValue<int>();
+  const ParameterSolver& maxJacobianAgeIterations = findParameter("maxJacobianAgeIterations");
+  if (maxJacobianAgeIterations.hasValue())
+    maxJacobianAgeIterations_ = maxJacobianAgeIterations.getValue<int>();
+  const ParameterSolver& maxJacobianConvergenceRate = findParameter("maxJacobianConvergenceRate");
+  if (maxJacobianConvergenceRate.hasValue())
+    maxJacobianConvergenceRate_ = maxJacobianConvergenceRate.getValue<double>();
+  const ParameterSolver& enableStepController = findParameter("enableStepController");
+  if (enableStepController.hasValue())
+    enableStepController_ = enableStepController.getValue<bool>();
+  const ParameterSolver& stepControllerTargetNewtonIter = findParameter("stepControllerTargetNewtonIter");
+  if (stepControllerTargetNewtonIter.hasValue())
+    stepControllerTargetNewtonIter_ = stepControllerTargetNewtonIter.getValue<int>();
+  const ParameterSolver& stepControllerTargetRate = findParameter("stepControllerTargetRate");
+  if (stepControllerTargetRate.hasValue())
+    stepControllerTargetRate_ = stepControllerTargetRate.getValue<double>();
+  const ParameterSolver& stepControllerMaxGrowth = findParameter("stepControllerMaxGrowth");
+  if (stepControllerMaxGrowth.hasValue())
+    stepControllerMaxGrowth_ = stepControllerMaxGrowth.getValue<double>();
+  const ParameterSolver& extrapolationOrder = findParameter("extrapolationOrder");
+  if (extrapolationOrder.hasValue()) {
+    const int value = extrapolationOrder.getValue<int>();
+    if (value >= 0 && value <= maximumExtrapolationOrder)
+      extrapolationOrder_ = value;
+    else
+      Trace::warn() << DYNLog(IncoherentParamExtrapolationOrder, value, maximumExtrapolationOrder) << Trace::endline;
+  }
+  const ParameterSolver& enableQSS = findParameter("enableQSS");
+  if (enableQSS.hasValue())
+    enableQSS_ = enableQSS.getValue<bool>();
+  const ParameterSolver& qssDerivativeThreshold = findParameter("qssDerivativeThreshold");
+  if (qssDerivativeThreshold.hasValue())
+    qssDerivativeThreshold_ = qssDerivativeThreshold.getValue<double>();
+  const ParameterSolver& qssMaxJump = findParameter("qssMaxJump");
+  if (qssMaxJump.hasValue())
+    qssMaxJump_ = qssMaxJump.getValue<double>();
+  const ParameterSolver& restorationCacheSize = findParameter("restorationCacheSize");
+  if (restorationCacheSize.hasValue())
+    restorationCacheSize_ = restorationCacheSize.getValue<int>();
+  const ParameterSolver& jacobianFreeNewton = findParameter("jacobianFreeNewton");
+  if (jacobianFreeNewton.hasValue())
+    jacobianFreeNewton_ = jacobianFreeNewton.getValue<bool>();
+  const ParameterSolver& degradedMxiter = findParameter("degradedMxiter");
+  if (degradedMxiter.hasValue())
+    degradedMxiter_ = degradedMxiter.getValue<int>();
+  const ParameterSolver& degradedHMax = findParameter("degradedHMax");
+  if (degradedHMax.hasValue())
+    degradedHMax_ = degradedHMax.getValue<double>();
+  nominalHMax_ = hMax_;
 }
 
 void
@@ -151,6 +272,23 @@ SolverCommonFixedTimeStep::initCommon(const std::shared_ptr<Model> &model, const
   nNewt_ = 0;
   countRestart_ = 0;
   factorizationForced_ = false;
+  jacobianAgeSteps_ = 0;
+  jacobianAgeIterations_ = 0;
+  slowConvergence_ = false;
+  nJacobianReuses_ = 0;
+  nSetupsForcedByAge_ = 0;
+  nSetupsForcedByRate_ = 0;
+  stepDifficulty_ = 0.;
+  previousStepDifficulty_ = 0.;
+  resetExtrapolation();
+  quasiSteadyState_ = false;
+  nQSSJumps_ = 0;
+  qssJumpedTime_ = 0.;
+  zBeforeTransition_.clear();
+  if (restorationCacheSize_ > 0)
+    restorationCache_.reset(new RestorationCache(static_cast<size_t>(restorationCacheSize_)));
+  else
+    restorationCache_.reset();
 
   Solver::Impl::init(t0, model);
   Solver::Impl::resetStats();
@@ -159,15 +297,34 @@ SolverCommonFixedTimeStep::initCommon(const std::shared_ptr<Model> &model, const
 
   if (model->sizeY() != 0) {
     solverKINEuler_.reset(new SolverKINEuler());
+    solverKINEuler_->setLinearSolver(linearSolverType_, static_cast<unsigned>(nbThreads_), symbolicAnalysisCache_);
+    solverKINEuler_->setVectorThreadPool(getVectorThreadPool());
+    if (jacobianFreeNewton_) {
+      vector<int> fBlocks;
+      vector<int> yBlocks;
+      model->getSubModelPartition(fBlocks, yBlocks);
+      solverKINEuler_->setJacobianFree(fBlocks, yBlocks);
+    }
     solverKINEuler_->init(model, this, fnormtol_, initialaddtol_, scsteptol_, mxnewtstep_, msbset_, mxiter_, printfl_, sundialsVectorY_, printResiduals_);
   }
 
   solverKINAlgRestoration_.reset(new SolverKINAlgRestoration(printReinitResiduals_));
+  solverKINAlgRestoration_->setLinearSolver(linearSolverType_, static_cast<unsigned>(nbThreads_), symbolicAnalysisCache_);
+  solverKINAlgRestoration_->setVectorThreadPool(getVectorThreadPool());
   solverKINAlgRestoration_->init(model_, SolverKINAlgRestoration::KIN_ALGEBRAIC);
+  solverKINAlgRestoration_->setLocalRestoration(localAlgebraicRestoration_);
   if (hasPrediction()) {
     solverKINYPrim_.reset(new SolverKINAlgRestoration(printReinitResiduals_));
+    solverKINYPrim_->setLinearSolver(linearSolverType_, static_cast<unsigned>(nbThreads_), symbolicAnalysisCache_);
+    solverKINYPrim_->setVectorThreadPool(getVectorThreadPool());
     getSolverKINYPrim().init(model_, SolverKINAlgRestoration::KIN_DERIVATIVES);
   }
+  if (enableQSS_) {
+    solverKINEquilibrium_.reset(new SolverKINAlgRestoration(printReinitResiduals_));
+    solverKINEquilibrium_->setLinearSolver(linearSolverType_, static_cast<unsigned>(nbThreads_), symbolicAnalysisCache_);
+    solverKINEquilibrium_->setVectorThreadPool(getVectorThreadPool());
+    solverKINEquilibrium_->init(model_, SolverKINAlgRestoration::KIN_EQUILIBRIUM);
+  }
 
   setDifferentialVariablesIndices();
 
@@ -175,6 +332,12 @@ SolverCommonFixedTimeStep::initCommon(const std::shared_ptr<Model> &model, const
 }
 
 void SolverCommonFixedTimeStep::solveStepCommon(double /*tAim*/, double& tNxt) {
+  if (quasiSteadyState_) {
+    quasiSteadyState_ = false;
+    if (jumpToNextEvent(tNxt))
+      return;
+  }
+
   int counter = 0;
   bool redoStep = false;
 
@@ -235,7 +398,9 @@ void SolverCommonFixedTimeStep::solveStepCommon(double /*tAim*/, double& tNxt) {
     }
   } while (redoStep);
   updateTimeStep(tNxt);
+  saveExtrapolationPoint(tNxt);
   ++stats_.nst_;
+  quasiSteadyState_ = enableQSS_ && isQuasiSteadyState();
 }
 
 void
@@ -244,6 +409,7 @@ SolverCommonFixedTimeStep::calculateICCommon() {
   // Root evaluation before the initialization
   // --------------------------------
   vectorYSave_.assign(vectorY_.begin(), vectorY_.end());
+  staleContinuousVariables_ = false;
 
   // Updating discrete variable values and mode
   model_->copyContinuousVariables(&vectorY_[0], &vectorYp_[0]);
@@ -297,6 +463,11 @@ SolverCommonFixedTimeStep::SolverStatus_t SolverCommonFixedTimeStep::analyzeResu
   // Analyze the return value and do further treatments if necessary
   if (flag < 0) {
     stats_.ncfn_++;
+    if (convergenceDiagnostics_.isEnabled()) {
+      char* flagName = KINGetReturnFlagName(flag);
+      convergenceDiagnostics_.dump(*model_, flagName, true);
+      free(flagName);
+    }
     return NON_CONV;
   } else if (skipNRIfInitialGuessOK_ && !skipNextNR_ && flag == KIN_INITIAL_GUESS_OK) {
     skipNextNR_ = skipNRIfInitialGuessOK_;
@@ -308,22 +479,41 @@ SolverCommonFixedTimeStep::SolverStatus_t SolverCommonFixedTimeStep::analyzeResu
 int
 SolverCommonFixedTimeStep::callAlgebraicSolver() {
   int flag = 0;
+  stepDifficulty_ = 0.;
   if (skipNextNR_) {
+    refreshContinuousVariables(true);
     return KIN_INITIAL_GUESS_OK;
   } else {
-    // Step initialization
+    // Step initialization, y being overwritten by the extrapolation as soon as two points were accepted
+    refreshContinuousVariables(extrapolationTimes_.size() < 2);
     computePrediction();
+    computeExtrapolation(tSolve_ + h_);
 
     // Forcing the Jacobian calculation for the next Newton-Raphson resolution
+    // Otherwise the Jacobian of the previous time step is reused until it is too old or the convergence becomes too slow
     bool noInitSetup = true;
-    if (stats_.nst_ == 0 || factorizationForced_)
+    if (stats_.nst_ == 0 || factorizationForced_) {
       noInitSetup = false;
+    } else if (degradedMode_) {
+      // the Jacobian is frozen as long as the Newton resolutions converge
+      ++nJacobianReuses_;
+    } else if (isJacobianTooOld()) {
+      noInitSetup = false;
+      ++nSetupsForcedByAge_;
+    } else if (slowConvergence_) {
+      noInitSetup = false;
+      ++nSetupsForcedByRate_;
+    } else {
+      ++nJacobianReuses_;
+    }
 
     // Call the Newton-Raphson resolution
     flag = solverKINEuler_->solve(noInitSetup, skipAlgebraicResidualsEvaluation_);
 
     // Update statistics
     updateStatistics();
+    if (enableStepController_)
+      stepDifficulty_ = evalStepDifficulty();
   }
 
   return flag;
@@ -358,6 +548,36 @@ SolverCommonFixedTimeStep::updateStatistics() {
   stats_.nre_ += nre;
   stats_.nni_ += nNewt_;
   stats_.nje_ += nje;
+
+  // age of the Jacobian that the next time step would reuse
+  if (nje > 0) {
+    jacobianAgeSteps_ = 0;
+    jacobianAgeIterations_ = 0;
+  }
+  ++jacobianAgeSteps_;
+  jacobianAgeIterations_ += nNewt_;
+  slowConvergence_ = maxJacobianConvergenceRate_ > 0. && solverKINEuler_->getConvergenceRate() > maxJacobianConvergenceRate_;
+}
+
+bool
+SolverCommonFixedTimeStep::isJacobianTooOld() const {
+  return (maxJacobianAgeSteps_ > 0 && jacobianAgeSteps_ >= maxJacobianAgeSteps_)
+      || (maxJacobianAgeIterations_ > 0 && jacobianAgeIterations_ >= maxJacobianAgeIterations_);
+}
+
+bool
+SolverCommonFixedTimeStep::setDegradedMode(const bool degraded) {
+  if (degraded == degradedMode_)
+    return true;
+  degradedMode_ = degraded;
+  solverKINEuler_->setMaxIterations(degraded ? degradedMxiter_ : mxiter_);
+  if (degraded) {
+    hMax_ = degradedHMax_ > 0. ? degradedHMax_ : 2. * nominalHMax_;
+  } else {
+    hMax_ = nominalHMax_;
+    hNew_ = min(hNew_, hMax_);
+  }
+  return true;
 }
 
 void SolverCommonFixedTimeStep::handleDivergence(bool& redoStep) {
@@ -367,6 +587,7 @@ void SolverCommonFixedTimeStep::handleDivergence(bool& redoStep) {
   }
   factorizationForced_ = true;
   redoStep = true;
+  previousStepDifficulty_ = 0.;
   decreaseStep();
   restoreContinuousVariables();
 }
@@ -385,13 +606,224 @@ void SolverCommonFixedTimeStep::handleConvergence(bool& redoStep) {
 
 void
 SolverCommonFixedTimeStep::increaseStep() {
-  if (doubleNotEquals(h_, hMax_))
+  if (enableStepController_)
+    hNew_ = max(min(h_ * computeStepControllerFactor(), hMax_), hMin_);
+  else if (doubleNotEquals(h_, hMax_))
     hNew_ = min(h_ / kReduceStep_, hMax_);
   // Limitation to end up the simulation at tEnd
   hNew_ = min(hNew_, tEnd_ - (tSolve_ + h_));
 }
 
+double
+SolverCommonFixedTimeStep::evalStepDifficulty() const {
+  const double iterationsDifficulty = static_cast<double>(nNewt_) / max(stepControllerTargetNewtonIter_, 1);
+  if (doubleIsZero(stepControllerTargetRate_))
+    return iterationsDifficulty;
+  return max(iterationsDifficulty, solverKINEuler_->getConvergenceRate() / stepControllerTargetRate_);
+}
+
+double
+SolverCommonFixedTimeStep::computeStepControllerFactor() {
+  // h_{n+1} = h_n * (1 / e_n)^kI * (e_{n-1} / e_n)^kP, with e_n the difficulty of the last step
+  const double difficulty = max(stepDifficulty_, minimumStepDifficulty);
+  double factor = std::pow(1. / difficulty, stepControllerIntegralGain);
+  if (previousStepDifficulty_ > 0.)
+    factor *= std::pow(previousStepDifficulty_ / difficulty, stepControllerProportionalGain);
+  previousStepDifficulty_ = difficulty;
+  return max(kReduceStep_, min(factor, stepControllerMaxGrowth_));
+}
+
+void
+SolverCommonFixedTimeStep::checkpointContinuousVariables(const bool withDerivatives) {
+  // the current values already are the checkpoint, as after a rollback
+  if (staleContinuousVariables_)
+    return;
+  vectorYSave_.swap(vectorY_);
+  if (withDerivatives)
+    vectorYpSave_.swap(vectorYp_);
+  checkpointDerivatives_ = withDerivatives;
+  staleContinuousVariables_ = true;
+  attachSundialsVectors();
+}
+
+void
+SolverCommonFixedTimeStep::rollbackContinuousVariables() {
+  staleContinuousVariables_ = true;
+}
+
+void
+SolverCommonFixedTimeStep::refreshContinuousVariables(const bool withVariables) {
+  if (!staleContinuousVariables_)
+    return;
+  if (withVariables)
+    vectorY_.assign(vectorYSave_.begin(), vectorYSave_.end());
+  if (checkpointDerivatives_)
+    vectorYp_.assign(vectorYpSave_.begin(), vectorYpSave_.end());
+  staleContinuousVariables_ = false;
+  attachSundialsVectors();
+}
+
+void
+SolverCommonFixedTimeStep::attachSundialsVectors() {
+  // the algebraic solvers keep the sundials vectors, only their data pointer follows the buffers
+  if (sundialsVectorY_ != NULL && !vectorY_.empty())
+    NV_DATA_S(sundialsVectorY_) = &vectorY_[0];
+  if (sundialsVectorYp_ != NULL && !vectorYp_.empty())
+    NV_DATA_S(sundialsVectorYp_) = &vectorYp_[0];
+}
+
+void
+SolverCommonFixedTimeStep::saveExtrapolationPoint(const double t) {
+  if (extrapolationOrder_ == 0)
+    return;
+  // the oldest point is overwritten by the new one
+  if (extrapolationTimes_.size() <= static_cast<size_t>(extrapolationOrder_)) {
+    extrapolationTimes_.push_back(t);
+    extrapolationPoints_.push_back(vectorY_);
+  } else {
+    std::rotate(extrapolationTimes_.begin(), extrapolationTimes_.begin() + 1, extrapolationTimes_.end());
+    std::rotate(extrapolationPoints_.begin(), extrapolationPoints_.begin() + 1, extrapolationPoints_.end());
+    extrapolationTimes_.back() = t;
+    extrapolationPoints_.back().assign(vectorY_.begin(), vectorY_.end());
+  }
+}
+
+void
+SolverCommonFixedTimeStep::resetExtrapolation() {
+  extrapolationTimes_.clear();
+  extrapolationPoints_.clear();
+}
+
+void
+SolverCommonFixedTimeStep::computeExtrapolation(const double t) {
+  // the order is reduced to the number of points accepted since the last discontinuity
+  const size_t nbPoints = extrapolationTimes_.size();
+  if (nbPoints < 2)
+    return;
+
+  // y(t) = sum_j y_j * prod_{m != j} (t - t_m) / (t_j - t_m)
+  extrapolationWeights_.assign(nbPoints, 1.);
+  for (size_t j = 0; j < nbPoints; ++j) {
+    for (size_t m = 0; m < nbPoints; ++m) {
+      if (m != j)
+        extrapolationWeights_[j] *= (t - extrapolationTimes_[m]) / (extrapolationTimes_[j] - extrapolationTimes_[m]);
+    }
+  }
+
+  std::fill(vectorY_.begin(), vectorY_.end(), 0.);
+  for (size_t j = 0; j < nbPoints; ++j) {
+    const double weight = extrapolationWeights_[j];
+    const vector<double>& point = extrapolationPoints_[j];
+    for (size_t i = 0; i < vectorY_.size(); ++i)
+      vectorY_[i] += weight * point[i];
+  }
+}
+
+bool
+SolverCommonFixedTimeStep::isQuasiSteadyState() const {
+  // a discrete event during the step leaves the system far from its equilibrium
+  if (!state_.noFlagSet())
+    return false;
+  // derivatives are estimated over the step as the SIM solver without prediction keeps yp to zero
+  for (unsigned int i = 0; i < differentialVariablesIndices_.size(); ++i) {
+    const int index = differentialVariablesIndices_[i];
+    if (std::abs(vectorY_[index] - vectorYSave_[index]) > qssDerivativeThreshold_ * h_)
+      return false;
+  }
+  return true;
+}
+
+double
+SolverCommonFixedTimeStep::findNextEventTime(const double tMax) {
+  // at the equilibrium point, the roots may only change with time (timers, scheduled events)
+  model_->evalG(tMax, g1_);
+  ++stats_.nge_;
+  if (std::equal(g0_.begin(), g0_.end(), g1_.begin()))
+    return tMax;
+
+  // bisection on the first root change
+  double tLow = tSolve_;
+  double tHigh = tMax;
+  while (tHigh - tLow > hMin_) {
+    const double tMid = 0.5 * (tLow + tHigh);
+    model_->evalG(tMid, g1_);
+    ++stats_.nge_;
+    if (std::equal(g0_.begin(), g0_.end(), g1_.begin()))
+      tLow = tMid;
+    else
+      tHigh = tMid;
+  }
+  return tLow;
+}
+
+bool
+SolverCommonFixedTimeStep::jumpToNextEvent(double& tNxt) {
+  if (model_->sizeY() == 0)
+    return false;
+  const double tMax = (qssMaxJump_ > 0.) ? min(tSolve_ + qssMaxJump_, tEnd_) : tEnd_;
+  double tJump = findNextEventTime(tMax);
+  // the event is too close for a jump to be worth an equilibrium resolution
+  if (tJump - tSolve_ <= hMax_)
+    return false;
+
+  saveContinuousVariables();
+  refreshContinuousVariables(true);
+  solverKINEquilibrium_->setupNewAlgebraicRestoration(fnormtolAlg_, initialaddtolAlg_, scsteptolAlg_, mxnewtstepAlg_, msbsetAlg_, mxiterAlg_,
+                                                      printflAlg_);
+  solverKINEquilibrium_->setInitialValues(tSolve_, vectorY_, vectorYp_);
+  try {
+    const bool noInitSetup = false;
+    solverKINEquilibrium_->solve(noInitSetup);
+  } catch (const Error& e) {
+    if (e.type() != Error::SUNDIALS_ERROR)
+      throw;
+    DYNTraceIf(DEBUG, "") << DYNLog(SolverQSSEquilibriumFailed, tSolve_) << Trace::endline;
+    restoreContinuousVariables();
+    factorizationForced_ = true;
+    return false;
+  }
+
+  long int nre = 0;
+  long int nje = 0;
+  solverKINEquilibrium_->updateStatistics(nNewt_, nre, nje);
+  stats_.nre_ += nre;
+  stats_.nni_ += nNewt_;
+  stats_.nje_ += nje;
+  solverKINEquilibrium_->getValues(vectorY_, vectorYp_);
+  model_->copyContinuousVariables(&vectorY_[0], &vectorYp_[0]);
+
+  // the equilibrium point itself may trigger an event that has to be simulated
+  model_->evalG(tSolve_, g1_);
+  ++stats_.nge_;
+  const bool stableRoots = std::equal(g0_.begin(), g0_.end(), g1_.begin());
+  if (stableRoots)
+    tJump = findNextEventTime(tJump);
+  if (!stableRoots || tJump - tSolve_ <= hMax_) {
+    restoreContinuousVariables();
+    factorizationForced_ = true;
+    return false;
+  }
+
+  DYNTraceIf(DEBUG, "") << DYNLog(SolverQSSJump, tSolve_, tJump) << Trace::endline;
+  h_ = tJump - tSolve_;
+  tNxt = tJump;
+  // land on the event with the smallest step, or go on with the largest one if there is no event
+  hNew_ = (tJump < tMax) ? hMin_ : hMax_;
+  hNew_ = min(hNew_, tEnd_ - tNxt);
+  ++nQSSJumps_;
+  qssJumpedTime_ += h_;
+  nbLastTimeSimulated_ = 0;
+  factorizationForced_ = true;
+  skipNextNR_ = false;
+  previousStepDifficulty_ = 0.;
+  resetExtrapolation();
+  ++stats_.nst_;
+  return true;
+}
+
 void SolverCommonFixedTimeStep::handleRoot(bool& redoStep) {
+  // the trajectory is not smooth across a discrete change
+  resetExtrapolation();
   if (model_->getModeChangeType() == ALGEBRAIC_J_UPDATE_MODE) {
     factorizationForced_ = true;
   } else {
@@ -462,8 +894,29 @@ SolverCommonFixedTimeStep::reinit() {
     // J updates and preconditioner calls must be done on a regular basis.
     bool noInitSetup = !setupNewAlgRestoration(modeChangeType);
 
-    solverKINAlgRestoration_->setInitialValues(tSolve_, vectorY_, vectorYp_);
-    const int flag = solverKINAlgRestoration_->solve(noInitSetup, evaluateOnlyMode);
+    // The correction computed the last time the same transition occurred gives a closer initial guess
+    bool warmStart = false;
+    uint64_t transitionSignature = 0;
+    if (restorationCache_) {
+      model_->getCurrentZ(vectorZ_);
+      transitionSignature = RestorationCache::signature(zBeforeTransition_, vectorZ_);
+      vectorYGuess_.assign(vectorY_.begin(), vectorY_.end());
+      warmStart = restorationCache_->apply(transitionSignature, vectorYGuess_);
+    }
+
+    int flag = 0;
+    solverKINAlgRestoration_->setInitialValues(tSolve_, warmStart ? vectorYGuess_ : vectorY_, vectorYp_);
+    try {
+      // the residuals of the models without mode change are not up to date with a corrected initial guess
+      flag = solverKINAlgRestoration_->solve(noInitSetup, evaluateOnlyMode && !warmStart);
+    } catch (const Error& e) {
+      if (!warmStart || e.type() != Error::SUNDIALS_ERROR)
+        throw;
+      // the saved correction does not fit this transition anymore: restart from the current values
+      warmStart = false;
+      solverKINAlgRestoration_->setInitialValues(tSolve_, vectorY_, vectorYp_);
+      flag = solverKINAlgRestoration_->solve(false, evaluateOnlyMode);
+    }
 
     // Update statistics
     long int nre = 0;
@@ -474,11 +927,18 @@ SolverCommonFixedTimeStep::reinit() {
     stats_.nje_ += nje;
 
     // If the initial guess is fine, nor the variables neither the time would have changed so we can return here and skip following treatments
-    if (flag == KIN_INITIAL_GUESS_OK) {
+    if (flag == KIN_INITIAL_GUESS_OK && !warmStart) {
       model_->reinitMode();
+      if (restorationCache_)
+        model_->getCurrentZ(zBeforeTransition_);
       return;
     }
+    if (restorationCache_)
+      vectorYBeforeRestoration_.assign(vectorY_.begin(), vectorY_.end());
     solverKINAlgRestoration_->getValues(vectorY_, vectorYp_);
+    if (restorationCache_)
+      restorationCache_->store(transitionSignature, vectorYBeforeRestoration_, vectorY_);
+    resetExtrapolation();
 
     if (hasPrediction()) {
       // Recomputation of differential variables' values
@@ -513,6 +973,44 @@ SolverCommonFixedTimeStep::reinit() {
     if (counter >= maxNumberUnstableRoots)
       throw DYNError(Error::SOLVER_ALGO, SolverFixedTimeStepUnstableRoots, solverType());
   } while (modeChangeType >= minimumModeChangeTypeForAlgebraicRestoration_);
+
+  if (restorationCache_)
+    model_->getCurrentZ(zBeforeTransition_);
+}
+
+void
+SolverCommonFixedTimeStep::snapshotState(StateBuffer& state) const {
+  Solver::Impl::snapshotState(state);
+  state.write(h_);
+  state.write(hNew_);
+  state.write(nNewt_);
+  state.write(countRestart_);
+  state.write(skipNextNR_);
+  state.write(skipAlgebraicResidualsEvaluation_);
+  state.write(nbLastTimeSimulated_);
+  state.write(previousStepDifficulty_);
+  state.write(vectorYSave_);
+  state.write(vectorYpSave_);
+}
+
+void
+SolverCommonFixedTimeStep::restoreState(StateBuffer::Reader& state) {
+  Solver::Impl::restoreState(state);
+  state.read(h_);
+  state.read(hNew_);
+  state.read(nNewt_);
+  state.read(countRestart_);
+  state.read(skipNextNR_);
+  state.read(skipAlgebraicResidualsEvaluation_);
+  state.read(nbLastTimeSimulated_);
+  state.read(previousStepDifficulty_);
+  state.read(vectorYSave_);
+  state.read(vectorYpSave_);
+  staleContinuousVariables_ = false;
+  // the last factorized Jacobian was computed on another trajectory
+  factorizationForced_ = true;
+  resetExtrapolation();
+  quasiSteadyState_ = false;
 }
 
 void
@@ -541,4 +1039,30 @@ SolverCommonFixedTimeStep::printSolveSpecific(std::stringstream& msg) const {
           << setw(18) << h_ << " ";
 }
 
+void
+SolverCommonFixedTimeStep::printEnd() const {
+  Solver::Impl::printEnd();
+  Trace::info() << DYNLog(SolverNbJacReuse, nJacobianReuses_) << Trace::endline;
+  Trace::info() << DYNLog(SolverNbJacEvalAge, nSetupsForcedByAge_) << Trace::endline;
+  Trace::info() << DYNLog(SolverNbJacEvalRate, nSetupsForcedByRate_) << Trace::endline;
+  if (enableQSS_) {
+    Trace::info() << DYNLog(SolverNbQSSJumps, nQSSJumps_) << Trace::endline;
+    Trace::info() << DYNLog(SolverQSSJumpedTime, qssJumpedTime_) << Trace::endline;
+  }
+  if (restorationCache_)
+    Trace::info() << DYNLog(SolverNbRestorationWarmStarts, restorationCache_->nbHits()) << Trace::endline;
+}
+
+void
+SolverCommonFixedTimeStep::accountMemory(MemoryUsage& usage) const {
+  if (solverKINEuler_)
+    solverKINEuler_->accountMemory(usage);
+  if (solverKINAlgRestoration_)
+    solverKINAlgRestoration_->accountMemory(usage);
+  if (solverKINYPrim_)
+    solverKINYPrim_->accountMemory(usage);
+  if (solverKINEquilibrium_)
+    solverKINEquilibrium_->accountMemory(usage);
+}
+
 }  // end namespace DYN
@@ -35,6 +35,7 @@ class ParametersSet;
 namespace DYN {
 class SolverKINEuler;
 class SolverKINAlgRestoration;
+class RestorationCache;
 
 /**
  * @brief class SolverCommonFixedTimeStep : Common class between SIM and TRAP.
@@ -112,6 +113,24 @@ class SolverCommonFixedTimeStep : public Solver::Impl {
    */
   void reinit() override;
 
+  /**
+   * @copydoc Solver::snapshotState(StateBuffer& state) const
+   */
+  void snapshotState(StateBuffer& state) const override;
+
+  /**
+   * @copydoc Solver::restoreState(StateBuffer::Reader& state)
+   */
+  void restoreState(StateBuffer::Reader& state) override;
+
+  /**
+   * @copydoc Solver::setDegradedMode(bool degraded)
+   *
+   * The degraded mode limits the number of Newton iterations, reuses the Jacobian as long as the Newton resolutions
+   * converge, and allows larger time steps.
+   */
+  bool setDegradedMode(bool degraded) override;
+
   /**
    * @brief print solver specific introduction information
    *
@@ -126,6 +145,16 @@ class SolverCommonFixedTimeStep : public Solver::Impl {
    */
   void printSolveSpecific(std::stringstream& msg) const override;
 
+  /**
+   * @copydoc Solver::printEnd()
+   */
+  void printEnd() const override;
+
+  /**
+   * @copydoc Solver::accountMemory(MemoryUsage& usage) const
+   */
+  void accountMemory(MemoryUsage& usage) const override;
+
  private:
   /**
    * @brief save the initial values of y before the time step
@@ -155,6 +184,13 @@ class SolverCommonFixedTimeStep : public Solver::Impl {
    */
   SolverStatus_t analyzeResult(int flag);
 
+  /**
+   * @brief whether the Jacobian of a previous time step has been used for too long
+   *
+   * @return @b true if the Jacobian has reached the maximum age in time steps or in Newton iterations
+   */
+  bool isJacobianTooOld() const;
+
   /**
    * @brief update the discrete variables values and the mode of the equations
    *
@@ -191,6 +227,78 @@ class SolverCommonFixedTimeStep : public Solver::Impl {
    */
   void increaseStep();
 
+  /**
+   * @brief store the current values of y as the last accepted point of the extrapolation predictor
+   *
+   * @param t time of the current values of y
+   */
+  void saveExtrapolationPoint(double t);
+
+  /**
+   * @brief forget the accepted points of the extrapolation predictor after a discontinuity
+   *
+   * The order of the predictor is then rebuilt as new points are accepted.
+   */
+  void resetExtrapolation();
+
+  /**
+   * @brief refill the current buffers from the checkpoint if they hold the values of another point
+   *
+   * @param withVariables @b false if the values of y are overwritten right after, only yp being refilled
+   */
+  void refreshContinuousVariables(bool withVariables);
+
+  /**
+   * @brief point the sundials vectors to the current buffers of y and yp
+   */
+  void attachSundialsVectors();
+
+  /**
+   * @brief replace the initial guess of y by the polynomial extrapolation of the last accepted points
+   *
+   * @param t time of the step to predict
+   */
+  void computeExtrapolation(double t);
+
+  /**
+   * @brief measure the difficulty of the last Newton resolution for the step controller
+   *
+   * @return 1 when the resolution converges in the target number of iterations at the target rate, more if it is harder
+   */
+  double evalStepDifficulty() const;
+
+  /**
+   * @brief compute the factor applied to the time step by the PI step controller after a successful step
+   *
+   * @return factor between kReduceStep and the maximum growth of the step
+   */
+  double computeStepControllerFactor();
+
+  /**
+   * @brief whether the last time step ended close to an equilibrium point
+   *
+   * @return @b true if no event occurred during the step and all derivatives are below the quasi-steady state threshold
+   */
+  bool isQuasiSteadyState() const;
+
+  /**
+   * @brief find the time of the first root change before a given time, with the current values of y
+   *
+   * @param tMax upper bound of the search
+   *
+   * @return the latest time before the first root change (up to hMin), tMax if there is no root change
+   */
+  double findNextEventTime(double tMax);
+
+  /**
+   * @brief solve the equilibrium point and jump to the next discrete event instead of stepping through the transient
+   *
+   * @param tNxt the time reached by the solver
+   *
+   * @return @b true if the jump was done, @b false if a normal time step has to be done
+   */
+  bool jumpToNextEvent(double& tNxt);
+
   /**
    * @brief update the solver attributes and strategy following a root detection
    *
@@ -233,6 +341,24 @@ class SolverCommonFixedTimeStep : public Solver::Impl {
   */
   void setDifferentialVariablesIndices();
 
+  /**
+   * @brief make the current values of y, and of yp if required, the checkpoint of the time step
+   *
+   * The buffers of the current values and of the checkpoint are swapped instead of copied, the sundials vectors following
+   * the current buffers. The current buffers are refilled from the checkpoint only before they are read. Nothing is done if
+   * the current values already come from the checkpoint.
+   *
+   * @param withDerivatives @b true if yp is part of the checkpoint
+   */
+  void checkpointContinuousVariables(bool withDerivatives);
+
+  /**
+   * @brief go back to the checkpoint of the time step
+   *
+   * The current buffers are only marked to be refilled from the checkpoint before they are read again.
+   */
+  void rollbackContinuousVariables();
+
   /**
    * @brief call the algebraic solver to find the solution of f(x) = 0
    *
@@ -244,6 +370,7 @@ class SolverCommonFixedTimeStep : public Solver::Impl {
   boost::shared_ptr<SolverKINEuler> solverKINEuler_;  ///< Backward Euler solver
   boost::shared_ptr<SolverKINAlgRestoration> solverKINAlgRestoration_;  ///< Newton Raphson solver for the algebraic variables restoration
   boost::shared_ptr<SolverKINAlgRestoration> solverKINYPrim_;  ///< Newton-Raphson solver for the derivatives of the differential variables restoration
+  boost::shared_ptr<SolverKINAlgRestoration> solverKINEquilibrium_;  ///< Newton-Raphson solver for the equilibrium point of the quasi-steady state mode
 
   // Generic and alterable parameters
   double hMin_;  ///< minimum time-step
@@ -267,15 +394,66 @@ class SolverCommonFixedTimeStep : public Solver::Impl {
   int mxiter_;  ///< maximum number of nonlinear iterations
   int printfl_;  ///< level of verbosity of output
 
+  // Jacobian reuse across time steps (modified Newton)
+  int maxJacobianAgeSteps_;  ///< maximum number of time steps solved with the same Jacobian, 0 for no limit
+  int maxJacobianAgeIterations_;  ///< maximum number of Newton iterations done with the same Jacobian, 0 for no limit
+  double maxJacobianConvergenceRate_;  ///< mean convergence rate above which the Jacobian is evaluated at the next time step, 0 to disable
+  int jacobianAgeSteps_;  ///< number of time steps solved since the last Jacobian evaluation
+  long int jacobianAgeIterations_;  ///< number of Newton iterations done since the last Jacobian evaluation
+  bool slowConvergence_;  ///< the last resolution converged slower than maxJacobianConvergenceRate_
+  long int nJacobianReuses_;  ///< number of resolutions started with the Jacobian of a previous time step
+  long int nSetupsForcedByAge_;  ///< number of Jacobian evaluations forced by the maximum age of the Jacobian
+  long int nSetupsForcedByRate_;  ///< number of Jacobian evaluations forced by a slow convergence
+
   bool skipNextNR_;  ///< indicates if the next algebraic resolution could be skipped
 
   std::vector<double> vectorYSave_;  ///< values of state variables before step
   std::vector<double> vectorYpSave_;  ///< values of previous derivative functions evaluated
+  bool checkpointDerivatives_;  ///< yp is part of the checkpoint of the time step
+  bool staleContinuousVariables_;  ///< the current buffers hold the values of another point than the checkpoint, to refill before use
   std::vector<int> differentialVariablesIndices_;  ///< index of each differential variables
   bool skipAlgebraicResidualsEvaluation_;  ///< flag used to skip algebraic residuals evaluation after a convergence or a mode
   bool optimizeAlgebraicResidualsEvaluations_;  ///< enable or disable the optimization of the number of algebraic residuals evals
   bool skipNRIfInitialGuessOK_;  ///< enable the possibility to skip next iterations if the simulation is stable
   int nbLastTimeSimulated_;  ///< nb times of simulation of the latest time
+
+  // Predictive time step controller
+  bool enableStepController_;  ///< use the PI step controller instead of the fixed kReduceStep factor after a successful step
+  int stepControllerTargetNewtonIter_;  ///< number of Newton iterations per time step targeted by the step controller
+  double stepControllerTargetRate_;  ///< mean convergence rate of the Newton resolution targeted by the step controller
+  double stepControllerMaxGrowth_;  ///< maximum factor between two successive time steps with the step controller
+  double stepDifficulty_;  ///< difficulty of the last Newton resolution, 0 if no resolution was needed
+  double previousStepDifficulty_;  ///< difficulty of the previous successful step, 0 if there is none
+
+  // Polynomial extrapolation of the Newton initial guess
+  int extrapolationOrder_;  ///< maximum order of the extrapolation of y over the last accepted steps, 0 to disable it
+  std::vector<double> extrapolationTimes_;  ///< times of the last accepted points, from the oldest to the newest
+  std::vector<std::vector<double> > extrapolationPoints_;  ///< values of y at the last accepted points, from the oldest to the newest
+  std::vector<double> extrapolationWeights_;  ///< Lagrange weights of the accepted points at the predicted time
+
+  // Quasi-steady state mode
+  bool enableQSS_;  ///< jump to the next discrete event once the system is close to an equilibrium point
+  double qssDerivativeThreshold_;  ///< largest derivative of the differential variables below which the system is quasi-steady
+  double qssMaxJump_;  ///< maximum length of a jump, 0 for no limit
+  bool quasiSteadyState_;  ///< the last time step ended close to an equilibrium point
+  long int nQSSJumps_;  ///< number of jumps to the next discrete event
+  double qssJumpedTime_;  ///< simulated time covered by jumps
+
+  // Warm start of the algebraic restorations
+  int restorationCacheSize_;  ///< maximum number of restoration corrections kept, 0 to disable the warm start
+  boost::shared_ptr<RestorationCache> restorationCache_;  ///< corrections of the previous restorations by mode transition
+  std::vector<double> zBeforeTransition_;  ///< values of the discrete variables at the end of the last restoration
+  std::vector<double> vectorZ_;  ///< current values of the discrete variables
+  std::vector<double> vectorYGuess_;  ///< initial guess of the restoration corrected by the cache
+  std::vector<double> vectorYBeforeRestoration_;  ///< values of y before the restoration
+
+  bool jacobianFreeNewton_;  ///< solve the time steps with a Jacobian-free Newton-Krylov method preconditioned by the sub models blocks
+
+  // Degraded mode, to keep up with a real-time clock
+  bool degradedMode_;  ///< cheaper settings are in use
+  int degradedMxiter_;  ///< maximum number of nonlinear iterations in degraded mode
+  double degradedHMax_;  ///< maximum time-step in degraded mode, 0 for twice the nominal one
+  double nominalHMax_;  ///< maximum time-step out of the degraded mode
 };
 }  // end of namespace DYN
 
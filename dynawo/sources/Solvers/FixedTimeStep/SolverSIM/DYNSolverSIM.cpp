@@ -192,16 +192,12 @@ SolverSIM::computePrediction() {
 
 void
 SolverSIM::saveContinuousVariables() {
-  vectorYSave_.assign(vectorY_.begin(), vectorY_.end());
-  if (hasPrediction())
-    vectorYpSave_.assign(vectorYp_.begin(), vectorYp_.end());
+  checkpointContinuousVariables(hasPrediction());
 }
 
 void
 SolverSIM::restoreContinuousVariables() {
-  vectorY_.assign(vectorYSave_.begin(), vectorYSave_.end());
-  if (hasPrediction())
-    vectorYp_.assign(vectorYpSave_.begin(), vectorYpSave_.end());
+  rollbackContinuousVariables();
 }
 
 }  // end namespace DYN
@@ -1000,15 +1000,33 @@ TEST(ParametersTest, testParameters) {
   params->addParameter(parameters::ParameterFactory::newParameter("optimizeAlgebraicResidualsEvaluations", false));
   params->addParameter(parameters::ParameterFactory::newParameter("optimizeReinitAlgebraicResidualsEvaluations", false));
   params->addParameter(parameters::ParameterFactory::newParameter("skipNRIfInitialGuessOK", false));
+  params->addParameter(parameters::ParameterFactory::newParameter("maxJacobianAgeSteps", 5));
+  params->addParameter(parameters::ParameterFactory::newParameter("maxJacobianAgeIterations", 20));
+  params->addParameter(parameters::ParameterFactory::newParameter("maxJacobianConvergenceRate", 0.5));
+  params->addParameter(parameters::ParameterFactory::newParameter("enableStepController", true));
+  params->addParameter(parameters::ParameterFactory::newParameter("stepControllerTargetNewtonIter", 4));
+  params->addParameter(parameters::ParameterFactory::newParameter("stepControllerTargetRate", 0.2));
+  params->addParameter(parameters::ParameterFactory::newParameter("stepControllerMaxGrowth", 1.5));
+  params->addParameter(parameters::ParameterFactory::newParameter("extrapolationOrder", 2));
+  params->addParameter(parameters::ParameterFactory::newParameter("enableQSS", true));
+  params->addParameter(parameters::ParameterFactory::newParameter("qssDerivativeThreshold", 1e-3));
+  params->addParameter(parameters::ParameterFactory::newParameter("qssMaxJump", 10.));
+  params->addParameter(parameters::ParameterFactory::newParameter("restorationCacheSize", 20));
+  params->addParameter(parameters::ParameterFactory::newParameter("jacobianFreeNewton", false));
+  params->addParameter(parameters::ParameterFactory::newParameter("degradedMxiter", 3));
+  params->addParameter(parameters::ParameterFactory::newParameter("degradedHMax", 2.));
+  params->addParameter(parameters::ParameterFactory::newParameter("incrementalRootEvaluation", true));
+  params->addParameter(parameters::ParameterFactory::newParameter("eventDrivenDiscreteEvaluation", true));
   params->addParameter(parameters::ParameterFactory::newParameter("minimumModeChangeTypeForAlgebraicRestoration", std::string("ALGEBRAIC_J_UPDATE")));
   params->addParameter(parameters::ParameterFactory::newParameter("order1Prediction", false));
   params->addParameter(parameters::ParameterFactory::newParameter("printResiduals", false));
   params->addParameter(parameters::ParameterFactory::newParameter("printUnstableRoot", false));
   params->addParameter(parameters::ParameterFactory::newParameter("printReinitResiduals", false));
   params->addParameter(parameters::ParameterFactory::newParameter("multipleStrategiesForAlgebraicRestoration", false));
+  params->addParameter(parameters::ParameterFactory::newParameter("linearSolverName", std::string("KLU")));
   ASSERT_NO_THROW(solver->setParametersFromPARFile(params));
   ASSERT_NO_THROW(solver->setSolverParameters());
-  ASSERT_EQ(solver->getParametersMap().size(), 45);
+  ASSERT_EQ(solver->getParametersMap().size(), 70);
 }
 
 TEST(ParametersTest, testParametersInit) {
@@ -1059,7 +1077,7 @@ TEST(ParametersTest, testParametersInit) {
   params->addParameter(parameters::ParameterFactory::newParameter("multipleStrategiesForAlgebraicRestoration", false));
   ASSERT_NO_THROW(solver->setParametersFromPARFile(params));
   ASSERT_NO_THROW(solver->setSolverParameters());
-  ASSERT_EQ(solver->getParametersMap().size(), 45);
+  ASSERT_EQ(solver->getParametersMap().size(), 70);
 }
 
 TEST(SimulationTest, testSolverSIMTestPredictionOrder1) {
@@ -81,6 +81,8 @@ SolverTRAP::init(const std::shared_ptr<Model>& model, const double t0, const dou
   initCommon(model, t0, tEnd);
 
   solverKINYPrimInit_.reset(new SolverKINAlgRestoration(printReinitResiduals_));
+  solverKINYPrimInit_->setLinearSolver(linearSolverType_, static_cast<unsigned>(nbThreads_), symbolicAnalysisCache_);
+  solverKINYPrimInit_->setVectorThreadPool(getVectorThreadPool());
   solverKINYPrimInit_->init(model_, SolverKINAlgRestoration::KIN_DERIVATIVES);
 }
 
@@ -162,14 +164,19 @@ SolverTRAP::updateVelocity() {
 
 void
 SolverTRAP::saveContinuousVariables() {
-  vectorYSave_.assign(vectorY_.begin(), vectorY_.end());
-  vectorYpSave_.assign(vectorYp_.begin(), vectorYp_.end());
+  checkpointContinuousVariables(true);
 }
 
 void
 SolverTRAP::restoreContinuousVariables() {
-  vectorY_.assign(vectorYSave_.begin(), vectorYSave_.end());
-  vectorYp_.assign(vectorYpSave_.begin(), vectorYpSave_.end());
+  rollbackContinuousVariables();
+}
+
+void
+SolverTRAP::accountMemory(MemoryUsage& usage) const {
+  SolverCommonFixedTimeStep::accountMemory(usage);
+  if (solverKINYPrimInit_)
+    solverKINYPrimInit_->accountMemory(usage);
 }
 
 }  // end namespace DYN
@@ -141,6 +141,11 @@ class SolverTRAP : public SolverCommonFixedTimeStep {
   */
   void restoreContinuousVariables() override;
 
+  /**
+   * @copydoc SolverCommonFixedTimeStep::accountMemory(MemoryUsage& usage) const
+   */
+  void accountMemory(MemoryUsage& usage) const override;
+
  private:
   boost::shared_ptr<SolverKINAlgRestoration> solverKINYPrimInit_;  ///< Newton-Raphson solver for the derivatives of the differential variables restoration
 };
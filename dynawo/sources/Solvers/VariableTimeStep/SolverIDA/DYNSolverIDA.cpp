@@ -17,6 +17,7 @@
  * @brief Solver implementation based on sundials/IDA solver
  */
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <iomanip>
@@ -27,7 +28,6 @@
 #include <nvector/nvector_serial.h>
 #include <sundials/sundials_types.h>
 #include <sunmatrix/sunmatrix_sparse.h>
-#include <sunlinsol/sunlinsol_klu.h>
 
 #include "PARParametersSet.h"
 #include "PARParameter.h"
@@ -40,6 +40,8 @@
 #include "DYNTrace.h"
 #include "DYNTimer.h"
 #include "DYNSolverCommon.h"
+#include "DYNParallelVector.h"
+#include "DYNMemoryUsage.h"
 
 using std::make_pair;
 using std::setw;
@@ -93,14 +95,22 @@ minStep_(0.),
 maxStep_(0.),
 absAccuracy_(0.),
 relAccuracy_(0.),
+warmRestartAfterAlgebraicRestoration_(false),
+tEnd_(0.),
 flagInit_(false),
 nbLastTimeSimulated_(0),
-lastRowVals_(NULL) {
+lastRowVals_(NULL),
+lastStructureVersion_(0),
+lastStructureHash_(0) {
 }
 
 void
 SolverIDA::cleanIDA() {
+  if (sundialsMatrix_ != NULL && linearSolver_ != NULL && lastRowVals_ != NULL)
+    symbolicAnalysisCache_->store(linearSolver_, lastStructureHash_, SM_NP_S(sundialsMatrix_), SM_NNZ_S(sundialsMatrix_), lastRowVals_,
+                                  lastRowVals_ + SM_NNZ_S(sundialsMatrix_));
   if (sundialsMatrix_ != NULL) {
+    SolverCommon::detachSparseValues(sundialsMatrix_, false);
     SUNMatDestroy(sundialsMatrix_);
     sundialsMatrix_ = NULL;
   }
@@ -117,7 +127,7 @@ SolverIDA::cleanIDA() {
     lastRowVals_ = NULL;
   }
   if (sundialsVectorYType_ != NULL) {
-    N_VDestroy_Serial(sundialsVectorYType_);
+    N_VDestroy(sundialsVectorYType_);
     sundialsVectorYType_ = NULL;
   }
 }
@@ -136,6 +146,8 @@ SolverIDA::defineSpecificParameters() {
   parameters_.insert(make_pair("maxStep", ParameterSolver("maxStep", VAR_TYPE_DOUBLE, mandatory)));
   parameters_.insert(make_pair("absAccuracy", ParameterSolver("absAccuracy", VAR_TYPE_DOUBLE, mandatory)));
   parameters_.insert(make_pair("relAccuracy", ParameterSolver("relAccuracy", VAR_TYPE_DOUBLE, mandatory)));
+  parameters_.insert(make_pair("warmRestartAfterAlgebraicRestoration",
+      ParameterSolver("warmRestartAfterAlgebraicRestoration", VAR_TYPE_BOOL, !mandatory)));
 }
 
 void
@@ -146,6 +158,9 @@ SolverIDA::setSolverSpecificParameters() {
   maxStep_ = findParameter("maxStep").getValue<double>();
   absAccuracy_ = findParameter("absAccuracy").getValue<double>();
   relAccuracy_ = findParameter("relAccuracy").getValue<double>();
+  const ParameterSolver& warmRestart = findParameter("warmRestartAfterAlgebraicRestoration");
+  if (warmRestart.hasValue())
+    warmRestartAfterAlgebraicRestoration_ = warmRestart.getValue<bool>();
 }
 
 const std::string&
@@ -163,6 +178,7 @@ SolverIDA::init(const std::shared_ptr<Model>& model, const double t0, const doub
   // (1) Arguments
   // -------------
   tSolve_ = t0;
+  tEnd_ = tEnd;
 
   // (2) Problem sizing
   // -------------------------------
@@ -236,7 +252,7 @@ SolverIDA::init(const std::shared_ptr<Model>& model, const double t0, const doub
   }
 
   // Algebraic or differential variable indicator (vector<int>)
-  sundialsVectorYType_ = N_VNew_Serial(model->sizeY(), sundialsContext_);
+  sundialsVectorYType_ = ParallelVector::create(model->sizeY(), getVectorThreadPool(), sundialsContext_);
   if (sundialsVectorYType_ == NULL)
     throw DYNError(Error::SUNDIALS_ERROR, SolverCreateID);
 
@@ -256,11 +272,10 @@ SolverIDA::init(const std::shared_ptr<Model>& model, const double t0, const doub
   sundialsMatrix_ = SUNSparseMatrix(model->sizeY(), model->sizeY(), 10., CSR_MAT, sundialsContext_);
   if (sundialsMatrix_ == NULL)
     throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorIDA, "SUNSparseMatrix");
+  SolverCommon::detachSparseValues(sundialsMatrix_, true);
 
-  /* Create KLU SUNLinearSolver object */
-  linearSolver_ = SUNLinSol_KLU(sundialsVectorY_, sundialsMatrix_, sundialsContext_);
-  if (linearSolver_ == NULL)
-    throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorIDA, "SUNLinSol_KLU");
+  /* Create the sparse direct SUNLinearSolver object */
+  linearSolver_ = LinearSolver::create(linearSolverType_, static_cast<unsigned>(nbThreads_), sundialsVectorY_, sundialsMatrix_, sundialsContext_);
 
   /* Attach the matrix and linear solver */
   flag = IDASetLinearSolver(IDAMem_, linearSolver_, sundialsMatrix_);
@@ -324,8 +339,13 @@ SolverIDA::init(const std::shared_ptr<Model>& model, const double t0, const doub
   // KINSOL solver Init
   //-----------------------
   solverKINNormal_.reset(new SolverKINAlgRestoration(printReinitResiduals_));
+  solverKINNormal_->setLinearSolver(linearSolverType_, static_cast<unsigned>(nbThreads_), symbolicAnalysisCache_);
+  solverKINNormal_->setVectorThreadPool(getVectorThreadPool());
   solverKINNormal_->init(model_, SolverKINAlgRestoration::KIN_ALGEBRAIC);
+  solverKINNormal_->setLocalRestoration(localAlgebraicRestoration_);
   solverKINYPrim_.reset(new SolverKINAlgRestoration(printReinitResiduals_));
+  solverKINYPrim_->setLinearSolver(linearSolverType_, static_cast<unsigned>(nbThreads_), symbolicAnalysisCache_);
+  solverKINYPrim_->setVectorThreadPool(getVectorThreadPool());
   solverKINYPrim_->init(model_, SolverKINAlgRestoration::KIN_DERIVATIVES);
 }
 
@@ -593,10 +613,10 @@ SolverIDA::printWeightedErrors() const {
   std::sort(yErr.begin(), yErr.end(), mapcompabs());
 
   if (!yErr.empty()) {
-    Trace::debug() << DYNLog(SolverIDALargestErrors, nbErr) << Trace::endline;
+    DYNTraceIf(DEBUG, "") << DYNLog(SolverIDALargestErrors, nbErr) << Trace::endline;
     int i = 0;
     for (vector<std::pair<double, int> >::iterator it = yErr.begin(); it != yErr.end() && i < nbErr; ++it, ++i) {
-      Trace::debug() << DYNLog(SolverIDAErrorValue, thresholdErr, it->second, getModel().getVariableName(it->second), it->first) << Trace::endline;
+      DYNTraceIf(DEBUG, "") << DYNLog(SolverIDAErrorValue, thresholdErr, it->second, getModel().getVariableName(it->second), it->first) << Trace::endline;
     }
   }
 
@@ -642,18 +662,31 @@ SolverIDA::evalJ(realtype tt, realtype cj,
   realtype* iyy = NV_DATA_S(yy);
   realtype* iyp = NV_DATA_S(yp);
 
-  SparseMatrix smj;
+  SparseMatrix& smj = solver->smj_;
   const int size = model.sizeY();
   smj.init(size, size);
   model.copyContinuousVariables(iyy, iyp);
   model.evalJt(tt, cj, smj);
-  SolverCommon::propagateMatrixStructureChangeToKINSOL(smj, JJ, size, &solver->lastRowVals_, solver->linearSolver_, true);
+  SolverCommon::propagateMatrixStructureChangeToKINSOL(smj, JJ, size, &solver->lastRowVals_, solver->lastStructureVersion_, solver->lastStructureHash_,
+      solver->linearSolver_, true, solver->symbolicAnalysisCache_.get());
 
   return 0;
 }
 
 void
 SolverIDA::solveStep(double tAim, double& tNxt) {
+  double tEvent = tEnd_;
+  if (timeEventScheduling_) {
+    // stop exactly at the next scheduled event instead of stepping over it, the internal time of IDA being possibly ahead after a root
+    double tCurrent = tSolve_;
+    IDAGetCurrentTime(IDAMem_, &tCurrent);
+    tEvent = model_->getNextTimeEvent(std::max(tSolve_, tCurrent));
+    if (tEvent >= tEnd_)
+      tEvent = tEnd_;
+    if (IDASetStopTime(IDAMem_, tEvent) < 0)
+      throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorIDA, "IDASetStopTime");
+  }
+
   int flag = IDASolve(IDAMem_, tAim, &tNxt, sundialsVectorY_, sundialsVectorYp_, IDA_ONE_STEP);
 
   string msg;
@@ -670,7 +703,14 @@ SolverIDA::solveStep(double tAim, double& tNxt) {
       break;
     case IDA_TSTOP_RETURN:
       msg = "IDA_TSTOP_RETURN";
-      updateStatistics();
+      if (tNxt < tEnd_) {
+        // scheduled event: the roots changing exactly at the event time have not been reported by IDA
+        model_->copyContinuousVariables(&vectorY_[0], &vectorYp_[0]);
+        model_->evalG(tNxt, g1_);
+        ++stats_.nge_;
+        if (!std::equal(g0_.begin(), g0_.end(), g1_.begin()))
+          evalZMode(g0_, g1_, tNxt);
+      }
       break;
     default:
       analyseFlag(flag);
@@ -740,7 +780,13 @@ SolverIDA::reinit() {
   if (modeChangeType == NO_MODE) return;
 
   const bool evaluateOnlyMode = optimizeReinitAlgebraicResidualsEvaluations_;
-  if (modeChangeType >= minimumModeChangeTypeForAlgebraicRestoration_) {
+  const bool restoration = modeChangeType >= minimumModeChangeTypeForAlgebraicRestoration_;
+  double lastStep = 0.;
+  if (warmRestartAfterAlgebraicRestoration_ && restoration) {
+    lastStep = getTimeStep();
+    ypBeforeRestoration_.assign(vectorYp_.begin(), vectorYp_.end());
+  }
+  if (restoration) {
     do {
       model_->rotateBuffers();
       state_.reset();
@@ -807,6 +853,54 @@ SolverIDA::reinit() {
   int flag0 = IDAReInit(IDAMem_, tSolve_, sundialsVectorY_, sundialsVectorYp_);  // required to relaunch the simulation
   if (flag0 < 0)
     throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorIDA, "IDAReinit");
+
+  if (warmRestartAfterAlgebraicRestoration_) {
+    // IDA restarts at order 1 in any case, but the step reached before the event is kept as first step
+    // if the restoration left the trajectory of the differential variables unchanged
+    const bool warmRestart = restoration && !doubleIsZero(lastStep) && differentialDerivativesUnchanged();
+    flag0 = IDASetInitStep(IDAMem_, warmRestart ? lastStep : initStep_);
+    if (flag0 < 0)
+      throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorIDA, "IDASetInitStep");
+    if (warmRestart)
+      Trace::debug() << DYNLog(SolverIDAWarmRestart, tSolve_, lastStep) << Trace::endline;
+  }
+}
+
+bool
+SolverIDA::differentialDerivativesUnchanged() const {
+  const std::vector<propertyContinuousVar_t>& modelYType = model_->getYType();
+  for (unsigned int i = 0; i < modelYType.size(); ++i) {
+    if (modelYType[i] != DYN::DIFFERENTIAL)
+      continue;
+    const double tolerance = relAccuracy_ * std::abs(ypBeforeRestoration_[i]) + absAccuracy_;
+    if (std::abs(vectorYp_[i] - ypBeforeRestoration_[i]) > tolerance)
+      return false;
+  }
+  return true;
+}
+
+void
+SolverIDA::snapshotState(StateBuffer& state) const {
+  Solver::Impl::snapshotState(state);
+  state.write(getTimeStep());
+  state.write(nbLastTimeSimulated_);
+}
+
+void
+SolverIDA::restoreState(StateBuffer::Reader& state) {
+  Solver::Impl::restoreState(state);
+  double lastStep = 0.;
+  state.read(lastStep);
+  state.read(nbLastTimeSimulated_);
+
+  int flag = IDAReInit(IDAMem_, tSolve_, sundialsVectorY_, sundialsVectorYp_);
+  if (flag < 0)
+    throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorIDA, "IDAReInit");
+  if (!doubleIsZero(lastStep)) {
+    flag = IDASetInitStep(IDAMem_, lastStep);
+    if (flag < 0)
+      throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorIDA, "IDASetInitStep");
+  }
 }
 
 vector<state_g>
@@ -861,6 +955,18 @@ SolverIDA::printSolveSpecific(std::stringstream& msg) const {
 
 void
 SolverIDA::updateStatistics() {
+  addIDAStatistics(stats_);
+}
+
+void
+SolverIDA::getStatistics(stat_t& statistics) const {
+  statistics = stats_;
+  // the counters of IDA are only added to the solver's counters before its reinitialization
+  addIDAStatistics(statistics);
+}
+
+void
+SolverIDA::addIDAStatistics(stat_t& statistics) const {
   if (IDAMem_ == NULL)
     return;
   // statistics gathering
@@ -892,14 +998,24 @@ SolverIDA::updateStatistics() {
   if (IDAGetNumGEvals(IDAMem_, &nge) < 0)
     throw DYNError(Error::SUNDIALS_ERROR, SolverFuncErrorIDA, "IDAGetNumGEvals");
 
-  // update solver's counters
-  stats_.nst_ += nst;
-  stats_.nre_ += nre;
-  stats_.nje_ += nje;
-  stats_.nni_ += nni;
-  stats_.netf_ += netf;
-  stats_.ncfn_ += ncfn;
-  stats_.nge_ += nge;
+  // update the counters
+  statistics.nst_ += nst;
+  statistics.nre_ += nre;
+  statistics.nje_ += nje;
+  statistics.nni_ += nni;
+  statistics.netf_ += netf;
+  statistics.ncfn_ += ncfn;
+  statistics.nge_ += nge;
+}
+
+void
+SolverIDA::accountMemory(MemoryUsage& usage) const {
+  usage.add(MemoryUsage::SPARSE_MATRICES, smj_.getMemoryUsage() + SolverCommon::getSharedSparseMemoryUsage(sundialsMatrix_, lastRowVals_));
+  usage.add(MemoryUsage::LINEAR_SOLVER_FACTORS, LinearSolver::getMemoryUsage(linearSolver_));
+  if (solverKINNormal_)
+    solverKINNormal_->accountMemory(usage);
+  if (solverKINYPrim_)
+    solverKINYPrim_->accountMemory(usage);
 }
 
 void
@@ -21,6 +21,7 @@
 #define SOLVERS_VARIABLETIMESTEP_SOLVERIDA_DYNSOLVERIDA_H_
 
 #include <boost/shared_ptr.hpp>
+#include <cstdint>
 #include <vector>
 #include <sundials/sundials_linearsolver.h>
 #include <sundials/sundials_matrix.h>
@@ -28,6 +29,7 @@
 
 #include "DYNSolverFactory.h"
 #include "DYNSolverImpl.h"
+#include "DYNSparseMatrix.h"
 
 namespace parameters {
 class ParametersSet;
@@ -94,6 +96,21 @@ class SolverIDA : public Solver::Impl {
    */
   void reinit() override;
 
+  /**
+   * @copydoc Solver::snapshotState(StateBuffer& state) const
+   */
+  void snapshotState(StateBuffer& state) const override;
+
+  /**
+   * @brief restore the state of the solver written by snapshotState
+   *
+   * IDA is reinitialized on the restored variables with the last step size used: the history of the multistep method
+   * is not kept in the snapshot, the integration restarts at order 1.
+   *
+   * @param state snapshot to read
+   */
+  void restoreState(StateBuffer::Reader& state) override;
+
   /**
    * @copydoc Solver::calculateIC()
    */
@@ -144,6 +161,13 @@ class SolverIDA : public Solver::Impl {
    */
   void updateStatistics() override;
 
+  /**
+   * @brief add the statistics of execution of IDA since its last reinitialization
+   *
+   * @param statistics statistics to increment
+   */
+  void addIDAStatistics(stat_t& statistics) const;
+
   /**
    * @brief getter for the last configuration used by the solver
    *
@@ -233,6 +257,16 @@ class SolverIDA : public Solver::Impl {
    */
   void analyseFlag(const int & flag);
 
+  /**
+   * @copydoc Solver::getStatistics(stat_t& statistics) const
+   */
+  void getStatistics(stat_t& statistics) const override;
+
+  /**
+   * @copydoc Solver::accountMemory(MemoryUsage& usage) const
+   */
+  void accountMemory(MemoryUsage& usage) const override;
+
   /**
    * @copydoc Solver::getTimeStep()
    */
@@ -260,10 +294,19 @@ class SolverIDA : public Solver::Impl {
   */
   void setDifferentialVariablesIndices();
 
+  /**
+   * @brief check whether the derivatives of the differential variables recomputed by the algebraic restoration
+   * stay within the integration tolerances of their values before the mode change
+   *
+   * @return @b true if the restoration did not change the derivatives of the differential variables
+   */
+  bool differentialDerivativesUnchanged() const;
+
  private:
   void* IDAMem_;  ///< IDA internal memory structure
   SUNLinearSolver linearSolver_;  ///< Linear Solver pointer
-  SUNMatrix sundialsMatrix_;  ///< sparse SUNMatrix
+  SUNMatrix sundialsMatrix_;  ///< sparse SUNMatrix, sharing the values of smj_
+  SparseMatrix smj_;  ///< last evaluated Jacobian, whose values are used by the linear solver until the next evaluation
   N_Vector sundialsVectorYType_;  ///< property of variables (algebraic/differential) stored in sundials structure
   boost::shared_ptr<SolverKINAlgRestoration> solverKINNormal_;  ///< Newton Raphson solver for the algebraic variables restoration
   boost::shared_ptr<SolverKINAlgRestoration> solverKINYPrim_;  ///< Newton-Raphson solver for the derivatives of the differential variables restoration
@@ -275,11 +318,16 @@ class SolverIDA : public Solver::Impl {
   double maxStep_;  ///< maximum step size
   double absAccuracy_;  ///< relative error tolerance
   double relAccuracy_;  ///< absolute error tolerance
+  bool warmRestartAfterAlgebraicRestoration_;  ///< @b true if the last step is kept after a restoration not changing the differential variables
+  std::vector<double> ypBeforeRestoration_;  ///< derivatives of the variables before the last algebraic restoration
 
+  double tEnd_;  ///< end time of the simulation, stop time of the solver when no time event is scheduled before
   bool flagInit_;  ///< @b true if the solver is in initialization mode
   int nbLastTimeSimulated_;  ///< nb times of simulation of the latest time (to see if the solver succeed to pass through event at one point)
 
   sunindextype* lastRowVals_;  ///< save of last Jacobian structure, to force symbolic factorization if structure change
+  uint64_t lastStructureVersion_;  ///< structure version of the last Jacobian, to copy only values if structure did not change
+  uint64_t lastStructureHash_;  ///< structure hash of the last Jacobian, to find its symbolic analysis in the cache
 };
 
 }  // end of namespace DYN
@@ -46,7 +46,7 @@ INIT_XML_DYNAWO;
 
 namespace DYN {
 
-static SolverFactory::SolverPtr initSolver(bool enableSilentZ = true) {
+static SolverFactory::SolverPtr initSolver(bool enableSilentZ = true, bool warmRestartAfterAlgebraicRestoration = false) {
   // Solver
   SolverFactory::SolverPtr solver = SolverFactory::createSolverFromLib("../dynawo_SolverIDA" + std::string(sharedLibraryExtension()));
 
@@ -72,6 +72,8 @@ static SolverFactory::SolverPtr initSolver(bool enableSilentZ = true) {
   params->addParameter(parameters::ParameterFactory::newParameter("minimalAcceptableStep", 10e-6));
   params->addParameter(parameters::ParameterFactory::newParameter("maximumNumberSlowStepIncrease", 10));
   params->addParameter(parameters::ParameterFactory::newParameter("enableSilentZ", enableSilentZ));
+  params->addParameter(parameters::ParameterFactory::newParameter("warmRestartAfterAlgebraicRestoration",
+      warmRestartAfterAlgebraicRestoration));
   solver->setParameters(params);
 
   return solver;
@@ -129,8 +131,8 @@ static std::shared_ptr<Model> initModel(Modeler modeler, const double& tStart =
 
 
 static std::pair<SolverFactory::SolverPtr, std::shared_ptr<Model> > initSolverAndModel(std::string dydFileName, std::string iidmFileName,
- std::string parFileName, const double& tStart, const double& tStop) {
-  SolverFactory::SolverPtr solver = initSolver();
+ std::string parFileName, const double& tStart, const double& tStop, bool warmRestartAfterAlgebraicRestoration = false) {
+  SolverFactory::SolverPtr solver = initSolver(true, warmRestartAfterAlgebraicRestoration);
 
   // DYD
   boost::shared_ptr<DynamicData> dyd(new DynamicData());
@@ -433,6 +435,41 @@ TEST(SimulationTest, testSolverIDAAlgebraicMode) {
   }
 }
 
+TEST(SimulationTest, testSolverIDAWarmRestartAfterAlgebraicRestoration) {
+  const double tStart = 0.;
+  const double tStop = 3.;
+  std::pair<SolverFactory::SolverPtr, std::shared_ptr<Model> > p = initSolverAndModel("jobs/solverTestDelta.dyd",
+  "jobs/solverTestDelta.iidm", "jobs/solverTestDelta.par", tStart, tStop, true);
+  const SolverFactory::SolverPtr& solver = p.first;
+  std::shared_ptr<Model> model = p.second;
+
+  solver->calculateIC(tStop);
+  double tCurrent = tStart;
+  solver->solve(tStop, tCurrent);
+  // Algebraic mode detection - line opening in the network
+  solver->solve(tStop, tCurrent);
+  ASSERT_EQ(model->getModeChangeType(), ALGEBRAIC_J_UPDATE_MODE);
+
+  // the restoration itself is not affected by the option
+  solver->reinit();
+  std::vector<double> y = solver->getCurrentY();
+  std::vector<double> yp = solver->getCurrentYP();
+  ASSERT_DOUBLE_EQUALS_DYNAWO(y[2], 0.92684239292330972138);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(y[3], -0.12083482860045162421);
+  ASSERT_EQ(model->getModeChangeType(), NO_MODE);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(yp[9], 0.93468597466729808065);
+
+  // the derivative of a differential variable jumped at the line opening: the solver restarts as without the option
+  solver->solve(tStop, tCurrent);
+  y = solver->getCurrentY();
+  yp = solver->getCurrentYP();
+  ASSERT_EQ(solver->getState().noFlagSet(), true);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(y[2], 0.92684239374639887377);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(y[3], -0.12083482837234209295);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(yp[9], 0.93468597860101021446);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(tCurrent, 2.);
+}
+
 TEST(SimulationTest, testSolverIDASilentZ) {
   const double tStart = 0.;
   const double tStop = 10.;
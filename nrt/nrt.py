@@ -12,6 +12,7 @@
 # simulation tool for power systems.
 
 import datetime
+import json
 import sys
 import multiprocessing as mp
 from optparse import OptionParser
@@ -143,6 +144,50 @@ def boolToString(boolean):
 
 class KeyboardInterruptError(Exception): pass
 
+# minimum increase of the run time (in s) reported as a regression, the shortest cases being too noisy
+PERF_MIN_TIME_INCREASE = 1.
+
+##
+# Load the performance baseline
+# @param baseline_file : the baseline file
+# @return the baseline values by case name
+def loadPerfBaseline(baseline_file):
+    if not os.path.isfile(baseline_file):
+        return {}
+    with open(baseline_file) as f:
+        return json.load(f)
+
+##
+# Record the performances of the test cases in the baseline, the other cases being kept
+# @param baseline_file : the baseline file
+# @param baseline : the previous baseline values by case name
+# @param test_cases : the test cases
+def savePerfBaseline(baseline_file, baseline, test_cases):
+    for test_case in test_cases:
+        if test_case.ok_:
+            baseline[test_case.name_] = {"time": test_case.time_, "peakRss": test_case.peak_rss_, "solverStatistics": test_case.solver_statistics_}
+    with open(baseline_file, 'w') as f:
+        json.dump(baseline, f, indent=2, sort_keys=True)
+
+##
+# Compare the performances of a test case with its baseline
+# @param test_case : the test case, whose perf_regressions_ are filled
+# @param reference : the baseline values of the case
+# @param time_tolerance : relative increase of the run time above which it is a regression
+# @param statistics_tolerance : relative increase of a solver statistic above which it is a regression
+# @param rss_tolerance : relative increase of the peak resident memory above which it is a regression
+def comparePerformance(test_case, reference, time_tolerance, statistics_tolerance, rss_tolerance):
+    test_case.perf_regressions_ = []
+    if not test_case.ok_:
+        return
+    if test_case.time_ > reference["time"] * (1 + time_tolerance) and test_case.time_ - reference["time"] > PERF_MIN_TIME_INCREASE:
+        test_case.perf_regressions_.append("run time %.1fs instead of %.1fs" % (test_case.time_, reference["time"]))
+    for key, value in sorted(test_case.solver_statistics_.items()):
+        if key in reference["solverStatistics"] and value > reference["solverStatistics"][key] * (1 + statistics_tolerance):
+            test_case.perf_regressions_.append("%s %d instead of %d" % (key, value, reference["solverStatistics"][key]))
+    if reference["peakRss"] > 0 and test_case.peak_rss_ > reference["peakRss"] * (1 + rss_tolerance):
+        test_case.perf_regressions_.append("peak memory %iMB instead of %iMB" % (test_case.peak_rss_ / 1e6, reference["peakRss"] / 1e6))
+
 ##
 # Run a given non-regression test
 # @param index : the test-case index (order when it will be run among all test cases)
@@ -168,6 +213,9 @@ class NonRegressionTest:
         self.real_time_ = 0
         self.nb_processors_used_ = int(os.getenv("DYNAWO_NB_PROCESSORS_USED"))
         self.timeout = timeout
+        self.perf_mode_ = False
+        self.perf_baseline_ = {}
+        self.number_of_perf_regressions_ = 0
 
     def clear(self,html_output):
         if os.path.isfile(html_output):
@@ -179,6 +227,18 @@ class NonRegressionTest:
     def addTestCase(self, test_case):
         self.test_cases_.append(test_case)
 
+    ##
+    # Compare the performances of the test cases with the baseline
+    def comparePerformances(self, baseline, time_tolerance, statistics_tolerance, rss_tolerance):
+        self.perf_mode_ = True
+        self.perf_baseline_ = baseline
+        self.number_of_perf_regressions_ = 0
+        for test_case in self.test_cases_:
+            if test_case.name_ in baseline:
+                comparePerformance(test_case, baseline[test_case.name_], time_tolerance, statistics_tolerance, rss_tolerance)
+                if len(test_case.perf_regressions_) > 0:
+                    self.number_of_perf_regressions_ += 1
+
 
     def launchCases(self):
         nbCases = len(self.test_cases_)
@@ -238,6 +298,8 @@ class NonRegressionTest:
             self.writeNOKTable(file)
         if self.number_of_tooLong_cases_ > 0:
             self.writeTooLongTable(file)
+        if self.perf_mode_:
+            self.writePerfTable(file)
         file.write("</section>")
 
     def writeDetails(self, file):
@@ -309,6 +371,32 @@ class NonRegressionTest:
                 self.writeCaseSummaryLine (test_case, file)
         file.write("</table>")
 
+    def writePerfTable(self, file):
+        file.write('<h3 id="Performance">Performance</h3>')
+        file.write("<table><tr><th>Test case</th><th>Name</th><th>Run time</th><th>Baseline run time</th><th>Steps</th><th>Newton iterations</th>" \
+            "<th>Jacobian evaluations</th><th>Failures</th><th>Peak memory</th><th>Status</th></tr>")
+
+        for test_case in self.test_cases_:
+            statistics = test_case.solver_statistics_
+            line = '<tr><td><a href="#' + test_case.case_ + '">' + test_case.case_ + "</a></td><td>" + test_case.name_ + "</td>"
+            line += "<td>%.1fs</td>" % test_case.time_
+            if test_case.name_ in self.perf_baseline_:
+                line += "<td>%.1fs</td>" % self.perf_baseline_[test_case.name_]["time"]
+            else:
+                line += "<td>-</td>"
+            for key in ["steps", "newtonIterations", "jacobianEvaluations"]:
+                line += "<td>" + str(statistics.get(key, "-")) + "</td>"
+            line += "<td>" + str(statistics.get("errorTestFailures", 0) + statistics.get("convergenceFailures", 0)) + "</td>"
+            line += "<td>%iMB</td>" % (test_case.peak_rss_ / 1e6)
+            if not test_case.name_ in self.perf_baseline_:
+                line += "<td class='noComparison'>no baseline</td>"
+            elif len(test_case.perf_regressions_) > 0:
+                line += "<td class='comparisonNOk'>" + "<br/>".join(test_case.perf_regressions_) + "</td>"
+            else:
+                line += "<td class='comparisonOk'>OK</td>"
+            file.write(line + "</tr>")
+        file.write("</table>")
+
     def writeDetailsCase(self, file, test_case):
         file.write('<h3 id="' + test_case.case_ + '">' + test_case.case_ + "</h3>")
         file.write("<table><tr><th>Properties</th><th>value</th></tr>")
@@ -316,6 +404,8 @@ class NonRegressionTest:
         file.write("<tr><td>Description</td><td>"+test_case.description_+"</td></tr>")
         file.write("<tr><td>simulation time</td><td>"+timeToString(test_case.time_)+"</td></tr>")
         file.write("<tr><td>return code</td><td>"+str(test_case.code_)+"</td></tr>")
+        if len(test_case.perf_regressions_) > 0:
+            file.write("<tr><td>performance</td><td class='comparisonNOk'>" + "<br/>".join(test_case.perf_regressions_) + "</td></tr>")
         line = "<tr><td>return status</td>"
         testcase_status = "OK"
         if( test_case.ok_ ):
@@ -451,6 +541,8 @@ class NonRegressionTest:
         statistics = "<aside><h1>Statistics</h1><ul><li>Number of failed cases:</li><li>Number of too long cases:</li>"
         if (nb_diff > 0):
             statistics += "<li>Number of failed results comparisons:</li>"
+        if self.perf_mode_:
+            statistics += "<li>Number of performance regressions:</li>"
         statistics += "<li>Complete simulation time(sum of time of each case):</li><li>Non Regression Tests time:</li><li>Number of processors used:</li></ul><ul>"
 
         addOnBeginFailed = ""
@@ -471,6 +563,9 @@ class NonRegressionTest:
         if (nb_diff > 0):
             statistics += "<li>" + str(nb_diff_failed) + "/" + str(nb_diff) +"</li>"
 
+        if self.perf_mode_:
+            statistics += "<li><a href = \"#Performance\">" + str(self.number_of_perf_regressions_) + "/" + str(self.number_of_cases_) + "</a></li>"
+
         statistics += "<li>" + timeToString(self.total_time_) +"</li>" \
             + "<li>" + timeToString(self.real_time_) + "</li>" \
             + "<li>" + str(self.nb_processors_used_) + "</li>" \
@@ -498,6 +593,24 @@ def main():
     options[('-f', '--failed')] = { 'action' : 'store_true', 'dest': 'failed', 'default':'False',
                                     'help': 'Only run failed non-regression tests'}
 
+    options[('--perf',)] = { 'action' : 'store_true', 'dest': 'perf', 'default': False,
+                                    'help': 'Compare the run time, the solver statistics and the peak memory of the cases with a baseline'}
+
+    options[('--perf-baseline',)] = { 'dest': 'perf_baseline', 'default': os.path.join(os.environ["DYNAWO_NRT_DIR"], "perfBaseline.json"),
+                                    'help': 'Performance baseline file'}
+
+    options[('--perf-record',)] = { 'action' : 'store_true', 'dest': 'perf_record', 'default': False,
+                                    'help': 'Record the performances of the successful cases in the baseline (implies --perf)'}
+
+    options[('--perf-time-tolerance',)] = { 'dest': 'perf_time_tolerance', 'type': 'float', 'default': 0.2,
+                                    'help': 'Relative increase of the run time reported as a regression (default 0.2)'}
+
+    options[('--perf-stats-tolerance',)] = { 'dest': 'perf_stats_tolerance', 'type': 'float', 'default': 0.05,
+                                    'help': 'Relative increase of a solver statistic reported as a regression (default 0.05)'}
+
+    options[('--perf-rss-tolerance',)] = { 'dest': 'perf_rss_tolerance', 'type': 'float', 'default': 0.2,
+                                    'help': 'Relative increase of the peak memory reported as a regression (default 0.2)'}
+
     parser = OptionParser(usage)
     for param, option in options.items():
         parser.add_option(*param, **option)
@@ -682,6 +795,14 @@ def main():
                 case.diff_ = results_per_dir[case_dir][0]
                 case.diff_messages_ = results_per_dir[case_dir][1]
 
+        if options.perf or options.perf_record:
+            baseline = loadPerfBaseline(options.perf_baseline)
+            NRT.comparePerformances(baseline, options.perf_time_tolerance, options.perf_stats_tolerance, options.perf_rss_tolerance)
+            if NRT.number_of_perf_regressions_ > 0:
+                printout("%d performance regression(s) against %s\n" % (NRT.number_of_perf_regressions_, options.perf_baseline), RED)
+            if options.perf_record:
+                savePerfBaseline(options.perf_baseline, baseline, NRT.test_cases_)
+
         # Export results as html
         NRT.exportHTML(html_output)
         if( NRT.number_of_nok_cases_ > 0):
@@ -60,6 +60,7 @@ where [option] can be:"
         build-dynawo-target                   build a specific Dynawo target (use help to see all cmake targets)
         build-dynawo-models-cpp               build Dynawo CPP models
         build-dynawo-models                   build Dynawo preassembled models
+        build-models-pgo ([args])             build Dynawo preassembled models with profile-guided optimization trained on the nrt
         build-dynaflow-models                 build DynaFlow preassembled models
         build-dynaswing-models                build DynaSwing preassembled models
         build-dynawaltz-models                build DynaWaltz preassembled models
@@ -129,7 +130,8 @@ where [option] can be:"
         dump-model-gdb                        dump model with debugger
         dump-model-valgrind                   dump model with valgrind
         compileCppModelicaModelInDynamicLib   compile Modelica Model generated for Dynawo
-        update-xml                            update dynawo input files for a new version. See README in util/updateXML/content."
+        update-xml                            update dynawo input files for a new version. See README in util/updateXML/content.
+        tune-solver ([args])                  tune the solver parameters of representative jobs by short sweeps, see tune-solver --help"
 
   export_var_env DYNAWO_DOCUMENTATION_OPTIONS="    =========== Dynawo Documentation
         =========== Launch
@@ -350,6 +352,9 @@ set_environment() {
   fi
   export_var_env DYNAWO_DEBUG_COMPILER_OPTION="-O0"
   export_var_env DYNAWO_FORCE_CXX11_ABI=false
+  export_var_env DYNAWO_MODELS_NATIVE_ARCH=OFF
+  export_var_env DYNAWO_MODELS_LTO=OFF
+  export_var_env DYNAWO_MODELS_PGO=""
 
   # Find build type for third party libraries
   DYNAWO_BUILD_TYPE_THIRD_PARTY=$DYNAWO_BUILD_TYPE
@@ -827,6 +832,18 @@ config_dynawo() {
     CMAKE_OPTIONAL="$CMAKE_OPTIONAL -DZMQ_HOME=$DYNAWO_ZMQ_HOME"
   fi
 
+  if [ -n "$DYNAWO_MODELS_PGO_DIR" ]; then
+    CMAKE_OPTIONAL="$CMAKE_OPTIONAL -DMODELS_PGO_DIR:PATH=$DYNAWO_MODELS_PGO_DIR"
+  fi
+
+  if [ -n "${DYNAWO_MODELS_CACHE_DIR+x}" ]; then
+    CMAKE_OPTIONAL="$CMAKE_OPTIONAL -DMODELS_CACHE_DIR:PATH=$DYNAWO_MODELS_CACHE_DIR"
+  fi
+
+  if [ -n "${DYNAWO_MODELS_BUILD_PARALLEL_LEVEL+x}" ]; then
+    CMAKE_OPTIONAL="$CMAKE_OPTIONAL -DMODELS_BUILD_PARALLEL_LEVEL:STRING=$DYNAWO_MODELS_BUILD_PARALLEL_LEVEL"
+  fi
+
   cmake -DCMAKE_C_COMPILER:PATH=$DYNAWO_C_COMPILER \
     -DCMAKE_CXX_COMPILER:PATH=$DYNAWO_CXX_COMPILER \
     -DCMAKE_BUILD_TYPE:STRING=$DYNAWO_BUILD_TYPE \
@@ -849,6 +866,9 @@ config_dynawo() {
     -DXERCESC_HOME=$DYNAWO_XERCESC_INSTALL_DIR \
     -DDYNAWO_PYTHON_COMMAND="$DYNAWO_PYTHON_COMMAND" \
     -DRELEASE_WITH_DEBUG:BOOL=$DYNAWO_RELEASE_WITH_DEBUG \
+    -DMODELS_NATIVE_ARCH:BOOL=$DYNAWO_MODELS_NATIVE_ARCH \
+    -DMODELS_LTO:BOOL=$DYNAWO_MODELS_LTO \
+    -DMODELS_PGO:STRING=$DYNAWO_MODELS_PGO \
     $CMAKE_OPTIONAL \
     -G "$DYNAWO_CMAKE_GENERATOR" \
     $DYNAWO_SRC_DIR
@@ -1195,6 +1215,24 @@ clean_models() {
   done
 }
 
+# Build the preassembled models with profile-guided optimization, the profiles being collected on the nrt
+build_models_pgo() {
+  # (1) instrumented models
+  export_var_env_force DYNAWO_MODELS_PGO=GENERATE
+  config_dynawo || error_exit "Error during config_dynawo."
+  rm -rf $DYNAWO_BUILD_DIR/M/M/P/*
+  build_dynawo_models || error_exit "Error during build_dynawo_models."
+
+  # (2) training on the nrt, the failed cases still providing profiles
+  nrt $@
+
+  # (3) models optimized with the collected profiles
+  export_var_env_force DYNAWO_MODELS_PGO=USE
+  config_dynawo || error_exit "Error during config_dynawo."
+  rm -rf $DYNAWO_BUILD_DIR/M/M/P/*
+  build_dynawo_models || error_exit "Error during build_dynawo_models."
+}
+
 clean_build_models() {
   clean_models $@
   if [ $# -eq 0 ]; then
@@ -1684,6 +1722,10 @@ update_xml() {
   $DYNAWO_PYTHON_COMMAND $DYNAWO_HOME/util/updateXML/update.py $@
 }
 
+tune_solver() {
+  $DYNAWO_PYTHON_COMMAND $DYNAWO_HOME/util/solverTuning/tuneSolverParameters.py $@
+}
+
 check_coding_files() {
   # html escape .dic files for dictionary
   for dicfile in $(find $DYNAWO_INSTALL_DIR -iname '*.dic')
@@ -2352,6 +2394,10 @@ case $MODE in
     build_dynawo_target ${ARGS} || error_exit "Failed to build Dynawo target"
     ;;
 
+  build-models-pgo)
+    build_models_pgo ${ARGS} || error_exit "Failed to build the preassembled models with profile-guided optimization"
+    ;;
+
   build-dynawo-models)
     build_dynawo_models || error_exit "Failed to build Dynawo models"
     ;;
@@ -2652,6 +2698,10 @@ case $MODE in
     update_xml ${ARGS} || error_exit "Error during update xml"
     ;;
 
+  tune-solver)
+    tune_solver ${ARGS} || error_exit "Error during solver parameters tuning"
+    ;;
+
   version)
     version || error_exit "Error during version visualisation"
     ;;
@@ -11,16 +11,30 @@
 # This file is part of Dynawo, an hybrid C++/Modelica open source time domain
 # simulation tool for power systems.
 import os
+import re
 import sys
 import time
 import subprocess
 import signal
+import threading
+import psutil
 from XMLUtils import FindAll, ImportXMLFileExtended
 import nrtDiff
 
 CURVES_TYPE_XML = 1
 CURVES_TYPE_CSV = 2
 
+# solver execution statistics read in the logs, by key of the performance baseline
+SOLVER_STATISTICS = {
+    "steps": "number of time iterations",
+    "residualEvaluations": "number of residual evaluations",
+    "newtonIterations": "number of nonlinear iterations",
+    "jacobianEvaluations": "number of Jacobian evaluations",
+    "errorTestFailures": "number of error test failures",
+    "convergenceFailures": "number of nonlinear convergence failures",
+}
+SOLVER_STATISTICS_REGEX = re.compile("(" + "|".join(SOLVER_STATISTICS.values()) + r")\s*=\s*(\d+)")
+
 
 class Alarm(Exception):
     pass
@@ -30,6 +44,25 @@ class Alarm(Exception):
 def alarm_handler(signum, frame):
     raise Alarm
 
+##
+# Sample the resident memory of a process and of its children until it ends
+# @param pid : the id of the process
+# @param peak_rss : list whose first element is updated with the peak resident memory (in bytes)
+def monitor_peak_rss(pid, peak_rss):
+    try:
+        process = psutil.Process(pid)
+        while process.status() != psutil.STATUS_ZOMBIE:
+            rss = process.memory_info().rss
+            for child in process.children(recursive=True):
+                try:
+                    rss += child.memory_info().rss
+                except psutil.Error:
+                    pass
+            peak_rss[0] = max(peak_rss[0], rss)
+            time.sleep(0.1)
+    except psutil.Error:
+        pass
+
 class Job:
     def __init__(self):
         self.name_ = ""
@@ -68,6 +101,9 @@ class TestCase:
         self.process_return_codes_ = expected_return_codes
         self.diff_ = None
         self.diff_messages_ = None
+        self.peak_rss_ = 0 # peak resident memory of the run, in bytes
+        self.solver_statistics_ = {} # solver execution statistics of all the jobs
+        self.perf_regressions_ = [] # performance regressions against the baseline
         if (os.path.isfile (self.jobs_file_)):
             self.parseJobsFile()
 
@@ -250,6 +286,10 @@ class TestCase:
         errors = ''
         errorTooLong = -150
         p = subprocess.Popen(commandStr, stdout=subprocess.PIPE, stderr=subprocess.PIPE, shell=True)
+        peak_rss = [0]
+        monitor = threading.Thread(target = monitor_peak_rss, args = (p.pid, peak_rss))
+        monitor.daemon = True
+        monitor.start()
         try:
             output, errors = p.communicate()
             signal.alarm(0)
@@ -257,6 +297,8 @@ class TestCase:
         except Alarm:
             kill_subprocess(p.pid)
             code = errorTooLong
+        monitor.join()
+        self.peak_rss_ = peak_rss[0]
 
         self.code_ = code
         self.outputs_ = output
@@ -275,6 +317,7 @@ class TestCase:
 
         end_time = time.time()
         self.time_ = end_time - start_time
+        self.readSolverStatistics()
 
         # Conversion from csv to html if curves file csv/xml
         for job in self.jobs_:
@@ -289,6 +332,28 @@ class TestCase:
                 job.hasCurves_ = False
                 pass
 
+    ##
+    # Read the solver execution statistics of the jobs in their logs, summed over the jobs
+    def readSolverStatistics(self):
+        names = dict((name, key) for key, name in SOLVER_STATISTICS.items())
+        self.solver_statistics_ = {}
+        for job in self.jobs_:
+            # the statistics are read in the first log where they are printed, the others may be copies
+            for app in job.appenders_:
+                if not os.path.isfile(app):
+                    continue
+                job_statistics = {}
+                with open(app, errors = "replace") as log:
+                    for line in log:
+                        match = SOLVER_STATISTICS_REGEX.search(line)
+                        if match is not None:
+                            key = names[match.group(1)]
+                            job_statistics[key] = job_statistics.get(key, 0) + int(match.group(2))
+                if len(job_statistics) > 0:
+                    for key, value in job_statistics.items():
+                        self.solver_statistics_[key] = self.solver_statistics_.get(key, 0) + value
+                    break
+
     ##
     # Check whether a test case led to satisfactory results
     def gives_satisfactory_results(self):
@@ -0,0 +1,402 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2026, RTE (http://www.rte-france.com)
+# See AUTHORS.txt
+# All rights reserved.
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, you can obtain one at http://mozilla.org/MPL/2.0/.
+# SPDX-License-Identifier: MPL-2.0
+#
+# This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+# simulation tool for power systems.
+
+# Tuning of the solver parameters of a family of cases, by running short sweeps on representative jobs.
+#
+# Each candidate parameter set is written in a copy of the solver parameters file of the jobs, and the jobs are run
+# with this copy and with their solver statistics exported. A candidate is robust if all the jobs succeed and reach
+# their stop time; the robust candidates are ranked by their total wall time, then by their number of error test
+# and convergence failures. The search either sweeps one parameter at a time, keeping the best value before moving
+# to the next one (coordinate search, the default), or runs all the combinations of the candidate values (grid).
+# The runs are reported in a CSV file and the best candidate is written as a recommended solver parameters file.
+
+import argparse
+import copy
+import csv
+import itertools
+import os
+import subprocess
+import sys
+import time
+import xml.etree.ElementTree as ET
+
+DYN_NAMESPACE = "http://www.rte-france.com/dynawo"
+
+ET.register_namespace("dyn", DYN_NAMESPACE)
+
+# default search space by solver: name, type, kind of candidates ("factor" of the current value or absolute "values")
+DEFAULT_SEARCH_SPACE = {
+    "dynawo_SolverSIM": [
+        ("hMin", "DOUBLE", "factor", [0.1, 1., 10.]),
+        ("hMax", "DOUBLE", "factor", [0.5, 1., 2.]),
+        ("kReduceStep", "DOUBLE", "values", [0.25, 0.5, 0.75]),
+        ("maxNewtonTry", "INT", "values", [5, 10, 20]),
+        ("fnormtolAlg", "DOUBLE", "values", [1e-6, 1e-5, 1e-4]),
+    ],
+    "dynawo_SolverIDA": [
+        ("minStep", "DOUBLE", "factor", [0.1, 1., 10.]),
+        ("maxStep", "DOUBLE", "factor", [0.5, 1., 2.]),
+        ("fnormtolAlg", "DOUBLE", "values", [1e-6, 1e-5, 1e-4]),
+        ("initialaddtolAlg", "DOUBLE", "values", [0.1, 1., 10.]),
+    ],
+}
+
+# columns of the solver statistics export counted as failures of a time step
+FAILURE_COLUMNS = ["errorTestFailures", "convergenceFailures"]
+
+
+def dyn(tag):
+    return "{%s}%s" % (DYN_NAMESPACE, tag)
+
+
+def format_value(value, par_type):
+    if par_type == "INT":
+        return str(int(value))
+    return "%.10g" % float(value)
+
+
+class TuningJob:
+    """
+    Representative job of the tuned family, read from a jobs file
+    """
+    def __init__(self, jobs_file):
+        self.jobs_file = os.path.abspath(jobs_file)
+        self.directory = os.path.dirname(self.jobs_file)
+        self.jobs = ET.parse(self.jobs_file)
+        jobs = self.jobs.getroot().findall(dyn("job"))
+        if len(jobs) != 1:
+            raise Exception("%s should define a single job" % jobs_file)
+        self.job = jobs[0]
+        self.solver = self.job.find(dyn("solver"))
+        self.solver_lib = self.solver.get("lib")
+        self.par_file = os.path.join(self.directory, self.solver.get("parFile"))
+        self.par_id = self.solver.get("parId")
+        self.parameters = ET.parse(self.par_file)
+        self.parameters_set = None
+        for par_set in self.parameters.getroot().findall(dyn("set")):
+            if par_set.get("id") == self.par_id:
+                self.parameters_set = par_set
+        if self.parameters_set is None:
+            raise Exception("parameters set %s not found in %s" % (self.par_id, self.par_file))
+        self.name = self.job.get("name")
+
+    def current_parameter(self, name):
+        """
+        (type, value) of a parameter of the solver set, None if it is not set
+        """
+        for par in self.parameters_set.findall(dyn("par")):
+            if par.get("name") == name:
+                return (par.get("type"), par.get("value"))
+        return None
+
+    def parameters_with(self, values, types):
+        """
+        copy of the solver parameters file, the solver set holding the given values
+        """
+        parameters = copy.deepcopy(self.parameters)
+        for par_set in parameters.getroot().findall(dyn("set")):
+            if par_set.get("id") != self.par_id:
+                continue
+            for name, value in values.items():
+                par = None
+                for existing in par_set.findall(dyn("par")):
+                    if existing.get("name") == name:
+                        par = existing
+                if par is None:
+                    par = ET.SubElement(par_set, dyn("par"), {"type": types[name], "name": name})
+                par.set("value", format_value(value, types[name]))
+        return parameters
+
+    def write_variant(self, values, types, run_directory, stop_time):
+        """
+        write the files of a run and return the path of its jobs file
+
+        The jobs file is written next to the original one so that the relative paths of the job and of the dynamic
+        models stay valid, the solver parameters and the outputs being in the run directory.
+        """
+        par_file = os.path.join(run_directory, "solvers.par")
+        self.parameters_with(values, types).write(par_file, xml_declaration=True, encoding="UTF-8")
+
+        jobs = copy.deepcopy(self.jobs)
+        job = jobs.getroot().find(dyn("job"))
+        job.find(dyn("solver")).set("parFile", par_file)
+        if stop_time is not None:
+            job.find(dyn("simulation")).set("stopTime", repr(stop_time))
+        outputs = job.find(dyn("outputs"))
+        outputs.set("directory", os.path.join(run_directory, "outputs"))
+        for statistics in outputs.findall(dyn("solverStatistics")):
+            outputs.remove(statistics)
+        # the outputs follow the order of the schema, the logs being last
+        statistics = ET.Element(dyn("solverStatistics"), {"exportMode": "CSV"})
+        logs = outputs.find(dyn("logs"))
+        outputs.insert(list(outputs).index(logs) if logs is not None else len(outputs), statistics)
+        jobs_file = os.path.join(self.directory, ".tuning-%d-%s.jobs" % (os.getpid(), os.path.basename(run_directory)))
+        jobs.write(jobs_file, xml_declaration=True, encoding="UTF-8")
+        return jobs_file
+
+    def stop_time(self, stop_time):
+        if stop_time is not None:
+            return stop_time
+        return float(self.job.find(dyn("simulation")).get("stopTime"))
+
+
+class Score:
+    """
+    Result of a candidate over all the jobs, lower being better
+    """
+    def __init__(self):
+        self.nb_failed_jobs = 0
+        self.wall_time = 0.
+        self.nb_solver_failures = 0
+
+    def better_than(self, other, min_gain):
+        if self.nb_failed_jobs != other.nb_failed_jobs:
+            return self.nb_failed_jobs < other.nb_failed_jobs
+        # wall time differences below the minimum gain are considered as noise
+        if self.wall_time < other.wall_time * (1. - min_gain):
+            return True
+        if self.wall_time > other.wall_time * (1. + min_gain):
+            return False
+        return self.nb_solver_failures < other.nb_solver_failures
+
+
+def read_solver_statistics(statistics_file):
+    """
+    (last time reached, number of failures) of a run, read in its solver statistics export
+    """
+    last_time = None
+    nb_failures = 0
+    if not os.path.isfile(statistics_file):
+        return (last_time, nb_failures)
+    with open(statistics_file) as csv_file:
+        for row in csv.DictReader(csv_file, delimiter=";"):
+            last_time = float(row["time"])
+            for column in FAILURE_COLUMNS:
+                nb_failures += int(row[column])
+    return (last_time, nb_failures)
+
+
+class Tuner:
+    """
+    Evaluation of candidate parameter sets on the representative jobs
+    """
+    def __init__(self, jobs, options):
+        self.jobs = jobs
+        self.options = options
+        self.scores = {}
+        self.nb_runs = 0
+        self.report = []
+
+    def evaluate(self, values, types):
+        key = tuple(sorted(values.items()))
+        if key in self.scores:
+            return self.scores[key]
+
+        score = Score()
+        for job in self.jobs:
+            wall_times = []
+            job_failed = False
+            for repeat in range(self.options.repeat):
+                self.nb_runs += 1
+                run_directory = os.path.join(self.options.output, "runs", "run_%d" % self.nb_runs)
+                os.makedirs(run_directory)
+                jobs_file = job.write_variant(values, types, run_directory, self.options.stop_time)
+                start = time.time()
+                try:
+                    code = subprocess.call([self.options.dynawo, "jobs", jobs_file], stdout=subprocess.DEVNULL,
+                                           stderr=subprocess.DEVNULL, timeout=self.options.timeout)
+                except subprocess.TimeoutExpired:
+                    code = None
+                wall_time = time.time() - start
+                os.remove(jobs_file)
+
+                last_time, nb_failures = read_solver_statistics(
+                    os.path.join(run_directory, "outputs", "solverStatistics", "solverStatistics.csv"))
+                stop_time = job.stop_time(self.options.stop_time)
+                success = code == 0 and last_time is not None and last_time >= stop_time * (1. - 1e-9)
+                self.report.append((self.nb_runs, job.name, repeat, dict(values), types, wall_time, nb_failures,
+                                    "OK" if success else ("TIMEOUT" if code is None else "KO")))
+                if not success:
+                    job_failed = True
+                    break
+                wall_times.append(wall_time)
+                score.nb_solver_failures += nb_failures
+            if job_failed:
+                score.nb_failed_jobs += 1
+            else:
+                score.wall_time += sorted(wall_times)[len(wall_times) // 2]
+
+        self.scores[key] = score
+        print("%s: %d failed job(s), %.3f s, %d solver failure(s)" %
+              (", ".join("%s=%s" % (name, format_value(value, types[name])) for name, value in key),
+               score.nb_failed_jobs, score.wall_time, score.nb_solver_failures))
+        return score
+
+    def coordinate_search(self, space, baseline, types):
+        best = dict(baseline)
+        best_score = self.evaluate(best, types)
+        for _ in range(self.options.passes):
+            improved = False
+            for name, candidates in space:
+                for value in candidates:
+                    if self.nb_runs >= self.options.max_runs:
+                        return (best, best_score)
+                    candidate = dict(best)
+                    candidate[name] = value
+                    score = self.evaluate(candidate, types)
+                    if score.better_than(best_score, self.options.min_gain):
+                        best, best_score = candidate, score
+                        improved = True
+            if not improved:
+                break
+        return (best, best_score)
+
+    def grid_search(self, space, baseline, types):
+        best = dict(baseline)
+        best_score = self.evaluate(best, types)
+        names = [name for name, _ in space]
+        for combination in itertools.product(*[candidates for _, candidates in space]):
+            if self.nb_runs >= self.options.max_runs:
+                print("maximum number of runs reached, the grid is only partially explored")
+                break
+            candidate = dict(zip(names, combination))
+            score = self.evaluate(candidate, types)
+            if score.better_than(best_score, self.options.min_gain):
+                best, best_score = candidate, score
+        return (best, best_score)
+
+    def write_report(self, names):
+        with open(os.path.join(self.options.output, "tuning.csv"), "w") as report_file:
+            writer = csv.writer(report_file, delimiter=";")
+            writer.writerow(["run", "job", "repeat"] + names + ["wallTime", "solverFailures", "status"])
+            for run, job_name, repeat, values, types, wall_time, nb_failures, status in self.report:
+                # the parameters left to their default value are not written
+                writer.writerow([run, job_name, repeat] +
+                                [format_value(values[name], types[name]) if name in values else "" for name in names] +
+                                ["%.3f" % wall_time, nb_failures, status])
+
+
+def parse_value(text, par_type):
+    if par_type == "INT":
+        return int(text)
+    return float(text)
+
+
+def build_search_space(reference, parameters):
+    """
+    candidate values, baseline values and types of the tuned parameters
+
+    @param reference job whose solver set gives the current values
+    @param parameters list of NAME=V1,V2,... given on the command line, the default search space of the solver if empty
+    """
+    space = []
+    baseline = {}
+    types = {}
+    if parameters:
+        for parameter in parameters:
+            if "=" not in parameter:
+                raise Exception("parameter %s should be given as NAME=V1,V2,..." % parameter)
+            name, texts = parameter.split("=", 1)
+            current = reference.current_parameter(name)
+            if current is not None:
+                par_type = current[0]
+            else:
+                par_type = "INT" if all(text.strip().lstrip("-").isdigit() for text in texts.split(",")) else "DOUBLE"
+            candidates = [parse_value(text, par_type) for text in texts.split(",")]
+            space.append((name, candidates))
+            types[name] = par_type
+            baseline[name] = parse_value(current[1], par_type) if current is not None else candidates[0]
+        return (space, baseline, types)
+
+    if reference.solver_lib not in DEFAULT_SEARCH_SPACE:
+        raise Exception("no default search space for the solver %s, the parameters should be given with --param" %
+                        reference.solver_lib)
+    for name, par_type, kind, candidates in DEFAULT_SEARCH_SPACE[reference.solver_lib]:
+        current = reference.current_parameter(name)
+        if kind == "factor":
+            if current is None:
+                print("%s is not set in the solver parameters set, it is not tuned" % name)
+                continue
+            value = parse_value(current[1], par_type)
+            candidates = [value * factor for factor in candidates]
+        if current is not None:
+            baseline[name] = parse_value(current[1], par_type)
+        else:
+            # the default value of the solver is kept as long as no candidate is better
+            baseline[name] = None
+        space.append((name, candidates))
+        types[name] = par_type
+    return (space, baseline, types)
+
+
+def tune(options):
+    jobs = [TuningJob(jobs_file) for jobs_file in options.jobs]
+    reference = jobs[0]
+    for job in jobs[1:]:
+        if job.solver_lib != reference.solver_lib:
+            raise Exception("all the jobs should use the same solver as %s" % reference.jobs_file)
+    space, baseline, types = build_search_space(reference, options.param)
+    if len(space) == 0:
+        raise Exception("no parameter to tune")
+    if os.path.exists(os.path.join(options.output, "runs")):
+        raise Exception("the output directory %s already holds runs" % options.output)
+    os.makedirs(os.path.join(options.output, "runs"))
+
+    tuner = Tuner(jobs, options)
+    # unset parameters are left out of the baseline, so that the solver defaults are evaluated first
+    baseline = dict((name, value) for name, value in baseline.items() if value is not None)
+    if options.strategy == "grid":
+        best, best_score = tuner.grid_search(space, baseline, types)
+    else:
+        best, best_score = tuner.coordinate_search(space, baseline, types)
+    tuner.write_report([name for name, _ in space])
+
+    if best_score.nb_failed_jobs > 0:
+        raise Exception("no candidate succeeded on all the jobs, see %s" % os.path.join(options.output, "tuning.csv"))
+    recommended = os.path.join(options.output, os.path.basename(reference.par_file))
+    reference.parameters_with(best, types).write(recommended, xml_declaration=True, encoding="UTF-8")
+    print("recommended parameters (set %s): %s" %
+          (reference.par_id, ", ".join("%s=%s" % (name, format_value(best[name], types[name])) for name in sorted(best))))
+    print("%d runs, %.3f s on the jobs, written in %s" % (tuner.nb_runs, best_score.wall_time, recommended))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Tune the solver parameters of a family of cases by running short "
+                                     "sweeps on representative jobs")
+    parser.add_argument("jobs", nargs="+", help="jobs files of the representative cases, using the same solver")
+    parser.add_argument("--dynawo", default=os.environ.get("DYNAWO_ENV_DYNAWO", "dynawo.sh"),
+                        help="Dynawo launcher, called with 'jobs <file>' ($DYNAWO_ENV_DYNAWO by default)")
+    parser.add_argument("--param", action="append",
+                        help="tuned parameter and its candidate values, as NAME=V1,V2,... (repeatable), "
+                        "the default search space of the solver being used if not given")
+    parser.add_argument("--strategy", choices=["coordinate", "grid"], default="coordinate",
+                        help="one parameter at a time (default) or all the combinations of the candidate values")
+    parser.add_argument("--passes", type=int, default=2, help="maximum number of passes of the coordinate search")
+    parser.add_argument("--max-runs", type=int, default=200, help="maximum number of simulations")
+    parser.add_argument("--repeat", type=int, default=1, help="number of runs of each job, the median wall time being kept")
+    parser.add_argument("--stop-time", type=float, help="stop time of the short runs, the one of the jobs by default")
+    parser.add_argument("--timeout", type=float, help="time limit of a run in seconds, a run over it being a failure")
+    parser.add_argument("--min-gain", type=float, default=0.02,
+                        help="minimum relative wall time gain for a candidate to be better, 2%% by default")
+    parser.add_argument("--output", required=True, help="output directory of the runs, report and recommended parameters")
+    options = parser.parse_args()
+
+    try:
+        tune(options)
+    except Exception as e:
+        print("Error: " + str(e))
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
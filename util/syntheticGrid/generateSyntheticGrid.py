@@ -0,0 +1,396 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2026, RTE (http://www.rte-france.com)
+# See AUTHORS.txt
+# All rights reserved.
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, you can obtain one at http://mozilla.org/MPL/2.0/.
+# SPDX-License-Identifier: MPL-2.0
+#
+# This file is part of Dynawo, an hybrid C++/Modelica open source time domain
+# simulation tool for power systems.
+
+# Generation of large synthetic cases for the scalability benchmarks, by tiling a test case.
+#
+# The network, the dynamic models and the curves of the template job are copied once per tile, with the ids of each
+# tile prefixed by T<index>_. The tiles are laid out on a grid and each tile is connected to its east and south
+# neighbours by tie lines between copies of the same bus: both ends have the same initial voltage, so that the tie
+# lines carry no flow and the initial state of the template remains a steady state of the synthetic case.
+# The generators of all the tiles share a single OMEGA_REF model. The models without static id (events, faults)
+# are only kept in the first tile, so that the disturbance of the template is applied once.
+
+import argparse
+import copy
+import math
+import os
+import re
+import sys
+import xml.etree.ElementTree as ET
+
+DYN_NAMESPACE = "http://www.rte-france.com/dynawo"
+IIDM_NAMESPACE = "http://www.itesla_project.eu/schema/iidm/1_0"
+
+ET.register_namespace("dyn", DYN_NAMESPACE)
+ET.register_namespace("iidm", IIDM_NAMESPACE)
+
+DEFAULT_TEMPLATE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "nrt", "data", "IEEE14",
+                                "IEEE14_BasicTestCases", "IEEE14_DisconnectLine", "IEEE14.jobs")
+
+# standard scale points of the scalability benchmarks, as a target number of buses
+SCALE_POINTS = {
+    "1k": 1000,
+    "10k": 10000,
+    "100k": 100000,
+}
+
+# attributes of the network holding the id of an equipment, or a reference to it
+IIDM_ID_ATTRIBUTES = ["id", "bus", "connectableBus", "bus1", "bus2", "connectableBus1", "connectableBus2",
+                      "voltageLevelId1", "voltageLevelId2"]
+
+OMEGA_REF_LIB = "DYNModelOmegaRef"
+NETWORK_ID = "NETWORK"
+# index of a generator in a variable of the OMEGA_REF model, e.g. omega_grp_3_value or numcc_node_3
+OMEGA_REF_INDEX_PATTERN = re.compile(r"^(\w+?_(?:grp|node)_)(\d+)(_value)?$")
+
+
+def dyn(tag):
+    return "{%s}%s" % (DYN_NAMESPACE, tag)
+
+
+def iidm(tag):
+    return "{%s}%s" % (IIDM_NAMESPACE, tag)
+
+
+def local_name(tag):
+    return tag.split("}")[-1]
+
+
+def tile_prefix(tile):
+    return "T%d_" % tile
+
+
+def prefix_network_variable(variable, prefix):
+    # variables of the network are either <staticId>_<var> or @<staticId>@@NODE@_<var>
+    if variable.startswith("@"):
+        return "@" + prefix + variable[1:]
+    return prefix + variable
+
+
+class TemplateCase:
+    """
+    Template job read from a jobs file, with the files it references
+    """
+    def __init__(self, jobs_file):
+        self.directory = os.path.dirname(os.path.abspath(jobs_file))
+        self.jobs = ET.parse(jobs_file)
+        self.job = self.jobs.getroot().find(dyn("job"))
+        if self.job is None:
+            raise Exception("no job defined in " + jobs_file)
+        modeler = self.job.find(dyn("modeler"))
+        self.network_element = modeler.find(dyn("network"))
+        self.dyd_elements = modeler.findall(dyn("dynModels"))
+        if self.network_element is None or len(self.dyd_elements) != 1:
+            raise Exception("the template job should have a network and a single dyd file")
+        self.iidm = ET.parse(self.path(self.network_element.get("iidmFile")))
+        self.dyd = ET.parse(self.path(self.dyd_elements[0].get("dydFile")))
+        self.curves_element = self.job.find(dyn("outputs") + "/" + dyn("curves"))
+        self.crv = ET.parse(self.path(self.curves_element.get("inputFile"))) if self.curves_element is not None else None
+
+        # par files referenced by the job and by the dynamic models, indexed by their name in the template
+        self.par_files = {}
+        for element in [self.job.find(dyn("solver")), self.network_element] + list(self.dyd.getroot()):
+            par_file = element.get("parFile")
+            if par_file is not None and par_file not in self.par_files:
+                self.par_files[par_file] = ET.parse(self.path(par_file))
+
+        self.nb_buses = len(list(self.iidm.getroot().iter(iidm("bus"))))
+        if self.nb_buses == 0:
+            raise Exception("the template network should be in bus breaker topology")
+
+    def path(self, file_name):
+        return os.path.join(self.directory, file_name)
+
+    def find_par_set(self, par_file, par_id):
+        for par_set in self.par_files[par_file].getroot().findall(dyn("set")):
+            if par_set.get("id") == par_id:
+                return par_set
+        raise Exception("parameters set %s not found in %s" % (par_id, par_file))
+
+
+def prefix_iidm_element(element, prefix):
+    for child in element.iter():
+        for attribute in IIDM_ID_ATTRIBUTES:
+            if attribute in child.attrib:
+                child.set(attribute, prefix + child.get(attribute))
+        if "name" in child.attrib:
+            child.set("name", prefix + child.get("name"))
+
+
+def border_buses(template):
+    # two buses of the highest nominal voltage, used as the ends of the east and south tie lines
+    buses = []
+    for voltage_level in template.iidm.getroot().iter(iidm("voltageLevel")):
+        for bus in voltage_level.iter(iidm("bus")):
+            buses.append((float(voltage_level.get("nominalV")), bus.get("id"), voltage_level.get("id")))
+    max_nominal_voltage = max(bus[0] for bus in buses)
+    candidates = [bus for bus in buses if bus[0] == max_nominal_voltage]
+    return candidates[0], candidates[1] if len(candidates) > 1 else candidates[0]
+
+
+def tie_line_impedance(template, nominal_voltage):
+    # median impedance of the template lines at the nominal voltage of the border buses
+    voltage_levels = dict((voltage_level.get("id"), float(voltage_level.get("nominalV")))
+                          for voltage_level in template.iidm.getroot().iter(iidm("voltageLevel")))
+    impedances = sorted((float(line.get("x")), float(line.get("r")))
+                        for line in template.iidm.getroot().iter(iidm("line"))
+                        if voltage_levels.get(line.get("voltageLevelId1")) == nominal_voltage)
+    if not impedances:
+        return 0.1 * nominal_voltage * nominal_voltage / 100., 0.
+    x, r = impedances[len(impedances) // 2]
+    return x, r
+
+
+def tie_line(template, tile1, tile2, border_bus, direction):
+    prefix1 = tile_prefix(tile1)
+    prefix2 = tile_prefix(tile2)
+    x, r = tie_line_impedance(template, border_bus[0])
+    line = ET.Element(iidm("line"))
+    line.set("id", "TIE_%d_%d_%s" % (tile1, tile2, direction))
+    line.set("r", repr(r))
+    line.set("x", repr(x))
+    for attribute in ["g1", "b1", "g2", "b2", "p1", "q1", "p2", "q2"]:
+        line.set(attribute, "0.0")
+    line.set("bus1", prefix1 + border_bus[1])
+    line.set("connectableBus1", prefix1 + border_bus[1])
+    line.set("voltageLevelId1", prefix1 + border_bus[2])
+    line.set("bus2", prefix2 + border_bus[1])
+    line.set("connectableBus2", prefix2 + border_bus[1])
+    line.set("voltageLevelId2", prefix2 + border_bus[2])
+    return line
+
+
+def generate_iidm(template, nb_tiles):
+    template_root = template.iidm.getroot()
+    root = ET.Element(template_root.tag, template_root.attrib)
+    root.set("id", "synthetic_%d" % nb_tiles)
+    root.text = template_root.text
+
+    # the equipments are grouped by type, in the order of the template, as required by the schema
+    groups = []
+    for child in template_root:
+        if not groups or groups[-1][0] != child.tag:
+            groups.append((child.tag, []))
+        groups[-1][1].append(child)
+    grouped_tags = [group[0] for group in groups]
+    if iidm("line") not in grouped_tags:
+        groups.insert(1, (iidm("line"), []))
+
+    east_bus, south_bus = border_buses(template)
+    width = int(math.ceil(math.sqrt(nb_tiles)))
+    for tag, children in groups:
+        for tile in range(nb_tiles):
+            for child in children:
+                element = copy.deepcopy(child)
+                prefix_iidm_element(element, tile_prefix(tile))
+                root.append(element)
+        if tag != iidm("line"):
+            continue
+        for tile in range(nb_tiles):
+            if tile % width + 1 < width and tile + 1 < nb_tiles:
+                root.append(tie_line(template, tile, tile + 1, east_bus, "EAST"))
+            if tile + width < nb_tiles:
+                root.append(tie_line(template, tile, tile + width, south_bus, "SOUTH"))
+    return ET.ElementTree(root)
+
+
+def is_tiled_model(model):
+    return model.get("staticId") is not None
+
+
+def prefix_connect(connect, prefix, shared_model_id=None):
+    for side in ["1", "2"]:
+        model_id = connect.get("id" + side)
+        if model_id == shared_model_id:
+            continue
+        if model_id == NETWORK_ID:
+            variable = connect.get("var" + side)
+            if variable is not None:
+                connect.set("var" + side, prefix_network_variable(variable, prefix))
+        else:
+            connect.set("id" + side, prefix + model_id)
+
+
+def renumber_omega_ref_connect(connect, omega_ref_id, offset):
+    for side in ["1", "2"]:
+        if connect.get("id" + side) != omega_ref_id:
+            continue
+        match = OMEGA_REF_INDEX_PATTERN.match(connect.get("var" + side))
+        if match is None:
+            raise Exception("unexpected variable of " + omega_ref_id + ": " + connect.get("var" + side))
+        index = int(match.group(2)) + offset
+        connect.set("var" + side, match.group(1) + str(index) + (match.group(3) or ""))
+
+
+def generate_dyd_and_par(template, nb_tiles):
+    template_root = template.dyd.getroot()
+    root = ET.Element(template_root.tag, template_root.attrib)
+    root.text = template_root.text
+
+    models = dict((model.get("id"), model) for model in template_root
+                  if local_name(model.tag) in ["blackBoxModel", "modelTemplateExpansion"])
+    omega_ref = None
+    for model in models.values():
+        if model.get("lib") == OMEGA_REF_LIB:
+            omega_ref = model
+    nb_generators = 0
+    omega_ref_set = None
+    if omega_ref is not None:
+        omega_ref_set = template.find_par_set(omega_ref.get("parFile"), omega_ref.get("parId"))
+        nb_generators = int(omega_ref_set.find(dyn("par") + "[@name='nbGen']").get("value"))
+
+    # the connections of the models kept in the first tile only are not tiled
+    def is_tiled_connect(connect):
+        return all(connect.get(side) in [NETWORK_ID, omega_ref.get("id") if omega_ref is not None else None] or
+                   is_tiled_model(models[connect.get(side)]) for side in ["id1", "id2"])
+
+    def is_omega_ref_connect(connect):
+        return omega_ref is not None and omega_ref.get("id") in [connect.get("id1"), connect.get("id2")]
+
+    for child in template_root:
+        tag = local_name(child.tag)
+        if tag in ["macroStaticReference", "macroConnector"] or child is omega_ref:
+            root.append(copy.deepcopy(child))
+        elif tag in ["blackBoxModel", "modelTemplateExpansion"]:
+            tiles = range(nb_tiles) if is_tiled_model(child) else [0]
+            for tile in tiles:
+                model = copy.deepcopy(child)
+                model.set("id", tile_prefix(tile) + model.get("id"))
+                if model.get("staticId") is not None:
+                    model.set("staticId", tile_prefix(tile) + model.get("staticId"))
+                root.append(model)
+        elif tag in ["connect", "macroConnect"]:
+            tiles = range(nb_tiles) if is_tiled_connect(child) else [0]
+            for tile in tiles:
+                connect = copy.deepcopy(child)
+                if is_omega_ref_connect(connect):
+                    renumber_omega_ref_connect(connect, omega_ref.get("id"), tile * nb_generators)
+                    prefix_connect(connect, tile_prefix(tile), omega_ref.get("id"))
+                else:
+                    prefix_connect(connect, tile_prefix(tile))
+                root.append(connect)
+        else:
+            raise Exception("unsupported element of the dyd file: " + tag)
+
+    if omega_ref_set is not None:
+        weights = dict((par.get("name"), par.get("value")) for par in omega_ref_set.findall(dyn("par")))
+        for par in list(omega_ref_set):
+            omega_ref_set.remove(par)
+        nb_generators_par = ET.SubElement(omega_ref_set, dyn("par"), {"type": "INT", "name": "nbGen"})
+        nb_generators_par.set("value", str(nb_tiles * nb_generators))
+        for tile in range(nb_tiles):
+            for generator in range(nb_generators):
+                weight = weights["weight_gen_%d" % generator]
+                ET.SubElement(omega_ref_set, dyn("par"), {"type": "DOUBLE",
+                                                          "name": "weight_gen_%d" % (tile * nb_generators + generator),
+                                                          "value": weight})
+    return ET.ElementTree(root)
+
+
+def generate_curves(template):
+    # the curves of the first tile only
+    template_root = template.crv.getroot()
+    root = ET.Element(template_root.tag, template_root.attrib)
+    root.text = template_root.text
+    prefix = tile_prefix(0)
+    for child in template_root:
+        if not isinstance(child.tag, str):
+            continue
+        curve = copy.deepcopy(child)
+        if curve.get("model") == NETWORK_ID:
+            curve.set("variable", prefix_network_variable(curve.get("variable"), prefix))
+        elif curve.get("model") is not None:
+            curve.set("model", prefix + curve.get("model"))
+        root.append(curve)
+    return ET.ElementTree(root)
+
+
+def write_xml(tree, file_name):
+    ET.indent(tree, space="  ")
+    tree.write(file_name, encoding="UTF-8", xml_declaration=True)
+
+
+def generate(template_file, nb_tiles, output_directory, name):
+    template = TemplateCase(template_file)
+    if not os.path.isdir(output_directory):
+        os.makedirs(output_directory)
+
+    job = copy.deepcopy(template.job)
+    job.set("name", "%s - %d tiles of %s" % (name, nb_tiles, template.job.get("name")))
+    write_xml(generate_iidm(template, nb_tiles), os.path.join(output_directory, name + ".iidm"))
+    job.find(dyn("modeler") + "/" + dyn("network")).set("iidmFile", name + ".iidm")
+    write_xml(generate_dyd_and_par(template, nb_tiles), os.path.join(output_directory, name + ".dyd"))
+    job.find(dyn("modeler") + "/" + dyn("dynModels")).set("dydFile", name + ".dyd")
+    for par_file, par_tree in template.par_files.items():
+        write_xml(par_tree, os.path.join(output_directory, os.path.basename(par_file)))
+    for element in job.iter():
+        if element.get("parFile") is not None:
+            element.set("parFile", os.path.basename(element.get("parFile")))
+
+    outputs = job.find(dyn("outputs"))
+    if template.crv is not None:
+        write_xml(generate_curves(template), os.path.join(output_directory, name + ".crv"))
+        outputs.find(dyn("curves")).set("inputFile", name + ".crv")
+    # the final state values refer to the models of the template
+    final_state_values = outputs.find(dyn("finalStateValues"))
+    if final_state_values is not None:
+        outputs.remove(final_state_values)
+
+    jobs_root = ET.Element(template.jobs.getroot().tag, template.jobs.getroot().attrib)
+    jobs_root.append(job)
+    write_xml(ET.ElementTree(jobs_root), os.path.join(output_directory, name + ".jobs"))
+    print("%s: %d tiles, %d buses" % (os.path.join(output_directory, name + ".jobs"), nb_tiles,
+                                      nb_tiles * template.nb_buses))
+
+
+def nb_tiles_for_buses(template_file, nb_buses):
+    return max(1, int(math.ceil(float(nb_buses) / TemplateCase(template_file).nb_buses)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate a large synthetic case by tiling a test case, "
+                                     "for the scalability benchmarks")
+    parser.add_argument("--template", default=DEFAULT_TEMPLATE,
+                        help="jobs file of the tiled case, IEEE14 - Disconnect Line by default")
+    size = parser.add_mutually_exclusive_group(required=True)
+    size.add_argument("--tiles", type=int, help="number of tiles")
+    size.add_argument("--buses", type=int, help="target number of buses, rounded up to a whole number of tiles")
+    size.add_argument("--scale", choices=sorted(SCALE_POINTS, key=SCALE_POINTS.get),
+                      help="standard scale point of the benchmarks")
+    size.add_argument("--all-scales", action="store_true",
+                      help="generate all the standard scale points, each one in a sub directory of the output directory")
+    parser.add_argument("--output", required=True, help="output directory")
+    parser.add_argument("--name", default="synthetic", help="name of the generated files")
+    options = parser.parse_args()
+
+    try:
+        if options.all_scales:
+            for scale, nb_buses in sorted(SCALE_POINTS.items(), key=lambda item: item[1]):
+                generate(options.template, nb_tiles_for_buses(options.template, nb_buses),
+                         os.path.join(options.output, scale), options.name)
+        elif options.scale is not None:
+            generate(options.template, nb_tiles_for_buses(options.template, SCALE_POINTS[options.scale]),
+                     options.output, options.name)
+        elif options.buses is not None:
+            generate(options.template, nb_tiles_for_buses(options.template, options.buses), options.output, options.name)
+        else:
+            if options.tiles < 1:
+                parser.error("the number of tiles should be positive")
+            generate(options.template, options.tiles, options.output, options.name)
+    except Exception as e:
+        print("Error: " + str(e))
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()